@@ -18,10 +18,31 @@
 #include "Framework/PluginFramework.h"
 #include "Framework/UtilityFramework.h"
 #include "CommonData.h"
+#include "Statistics.h"
 #include "resource.h"
 #include "Shlwapi.h"
 
 
+// std::wstring writeStatistics()
+//
+// Writes the keystroke statistics (see Statistics.h) as JSON to Compose.statistics.json in the plugins configuration
+// directory, and returns the path of the file. Called from the About dialog and at shutdown, if statistics are on.
+
+std::wstring writeStatistics() {
+    std::wstring path(npp(NPPM_GETPLUGINSCONFIGDIR, 0, 0), 0);
+    npp(NPPM_GETPLUGINSCONFIGDIR, path.length() + 1, path.data());
+    path += L"\\Compose.statistics.json";
+    const std::string json = statistics.json();
+    HANDLE file = CreateFile(path.data(), GENERIC_WRITE, 0, 0, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, 0);
+    if (file != INVALID_HANDLE_VALUE) {
+        DWORD written;
+        WriteFile(file, json.data(), static_cast<DWORD>(json.length()), &written, 0);
+        CloseHandle(file);
+    }
+    return path;
+}
+
+
 INT_PTR CALLBACK aboutDialogProc(HWND hwndDlg, UINT uMsg, WPARAM wParam, LPARAM) {
 
     static std::wstring version;  // Once filled in, we don't need to get this information again if About is called again.
@@ -71,6 +92,15 @@ INT_PTR CALLBACK aboutDialogProc(HWND hwndDlg, UINT uMsg, WPARAM wParam, LPARAM)
                 L"Open user documentation."));
             SendDlgItemMessage(hwndDlg, IDC_ABOUT_MORE, BCM_SETNOTE, 0, reinterpret_cast<LPARAM>(
                 L"Show change log, license and other information."));
+            if (statistics.on()) {
+                const std::wstring note = std::format(
+                    L"{} keys, {} sequences: {} explicit, {} implicit, {} with no match. Show timing and counts.",
+                    statistics.keysHandled.load(), statistics.sequencesStarted.load(), statistics.explicitMatches.load(),
+                    statistics.implicitMatches.load(), statistics.rejects.load());
+                SendDlgItemMessage(hwndDlg, IDC_ABOUT_STATISTICS, BCM_SETNOTE, 0, reinterpret_cast<LPARAM>(note.data()));
+            }
+            else SendDlgItemMessage(hwndDlg, IDC_ABOUT_STATISTICS, BCM_SETNOTE, 0, reinterpret_cast<LPARAM>(
+                L"Start counting and timing keystrokes, to see where time is spent if typing lags."));
 
             npp(NPPM_DARKMODESUBCLASSANDTHEME, NPP::NppDarkMode::dmfInit, hwndDlg);  // Include to support dark mode
             return TRUE;
@@ -116,6 +146,18 @@ INT_PTR CALLBACK aboutDialogProc(HWND hwndDlg, UINT uMsg, WPARAM wParam, LPARAM)
             }
             EndDialog(hwndDlg, 0);
             return TRUE;
+        case IDC_ABOUT_STATISTICS:
+            if (statistics.on()) {
+                const std::wstring path = writeStatistics();
+                SendMessage(plugin.nppData._nppHandle, NPPM_DOOPEN, 0, reinterpret_cast<LPARAM>(path.data()));
+                SendMessage(plugin.nppData._nppHandle, NPPM_MENUCOMMAND, 0, IDM_EDIT_TOGGLEREADONLY);
+            }
+            else {
+                data.collectStatistics = true;
+                statistics.enable(true);
+            }
+            EndDialog(hwndDlg, 0);
+            return TRUE;
         }
         break;
 
@@ -21,7 +21,12 @@
 
 #pragma once
 
+#include <atomic>
 #include "Framework/ConfigFramework.h"
+#include "ComposeEngine.h"
+
+class ReverseIndex;     // ReverseIndex.h
+class SequencePalette;  // SequencePalette.h
 
 // Common data structure
 
@@ -33,10 +38,21 @@ inline struct CommonData {
     UINT_PTR     pendingUserDefBuffer = 0;      // Notepad++ BufferID of a user definitions file being edited (0 if none pending)
     bool         pendingQueryOnClose  = false;  // Set if we should ask whether to load pending user definitions file on close
 
-    nlohmann::json rules;
+    // Compiled definitions, built by loadSequenceDefinitions on a worker thread and never changed once published;
+    // a reload publishes a new ComposeDefinitions object, and the old one is freed when the last sequence using it ends.
+
+    std::atomic<std::shared_ptr<const ComposeDefinitions>> definitions;  // Definitions in effect (never null after getFuncsArray)
+
+    // Reverse lookup index for How do I type and the coverage report: null until one of them is first used, then
+    // remade by the loader after each load, so it is usually ready for the definitions in effect.
+
+    std::atomic<std::shared_ptr<const ReverseIndex>> reverseIndex;
+
+    // Sequence palette for the palette panel: null until the panel is first shown, then remade by the loader after each
+    // load. Searching changes the palette's state, so only the main thread searches it, and the loader never changes
+    // a palette once it is published.
 
-    struct CombiningRule { char32_t one, two, up, down; };  // See ProcessCompose.cpp for explanation.
-    std::map<std::wstring, CombiningRule> combiningRules;   // See ProcessCompose.cpp for explanation.
+    std::atomic<std::shared_ptr<SequencePalette>> sequencePalette;
 
     // Data to be saved in the configuration file
 
@@ -44,5 +60,12 @@ inline struct CommonData {
     config<WPARAM>       composeKey             = { "ComposeKey"            , VK_INSERT | (HOTKEYF_EXT << 8) };
     config<bool>         userDefinitionsEnabled = { "UserDefinitionsEnabled", false    };
     config<std::wstring> userDefinitionsFile    = { "UserDefinitionsFile"   , L""      };
+    config<bool>         linearScanMatching     = { "LinearScanMatching"    , false    };  // Not on menu; for comparison
+    config<std::wstring> keystrokeTraceFile     = { "KeystrokeTraceFile"    , L""      };  // Not on menu; see KeystrokeTrace.h
+    config<bool>         collectStatistics      = { "CollectStatistics"     , false    };  // Set from Help/About; see Statistics.h
+    config<bool>         writeTimeline          = { "WriteTimeline"         , false    };  // Not on menu; see Timeline.h
+    config<bool>         commitUniquePrefix     = { "CommitUniquePrefix"    , false    };  // Not on menu; see ComposeEngine.h
+    config<int>          longestMatchTimeout    = { "LongestMatchTimeout"   , 0        };  // Not on menu; milliseconds, 0 for off
+    config<bool>         showCompletions        = { "ShowCompletions"       , false    };  // Not on menu; see ProcessCompose.cpp
 
 } data;
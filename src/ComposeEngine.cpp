@@ -0,0 +1,557 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include "ComposeEngine.h"
+#include "DefaultSequences.h"
+#include "DefinitionsParser.h"
+#include "Statistics.h"
+#include "UnicodeFormatTranslation.h"
+
+namespace {
+
+    // Sets the combining rules from rows with UTF-8 keys; where a key is repeated, the last row wins.
+
+    template<typename Rows> void setCombiningRules(std::vector<CombiningRule>& rules, const Rows& rows) {
+        rules.clear();
+        for (const auto& row : rows) {
+            const std::wstring w = utf8to16(row.key);
+            if (const uint32_t key = ComposeDefinitions::combiningKey(std::u16string(w.begin(), w.end())))
+                rules.push_back({ key, row.one, row.two, row.up, row.down });
+        }
+        std::stable_sort(rules.begin(), rules.end(), [](const auto& a, const auto& b) { return a.key < b.key; });
+        auto kept = rules.begin();
+        for (auto i = rules.begin(); i != rules.end(); ++i)
+            if (i + 1 == rules.end() || (i + 1)->key != i->key) *kept++ = *i;
+        rules.erase(kept, rules.end());
+    }
+
+    int hexValue(char32_t c) { return c <= u'9' ? c - u'0' : c >= u'a' ? c - u'a' + 10 : c - u'A' + 10; }
+
+}
+
+
+
+std::shared_ptr<ComposeDefinitions> ComposeDefinitions::builtIn() {
+    auto definitions = std::make_shared<ComposeDefinitions>();
+    definitions->sequences = defaultSequences::trie();
+    setCombiningRules(definitions->combiningRules, defaultSequences::combiningRules);
+    definitions->indexCombiningRules();
+    return definitions;
+}
+
+
+bool ComposeDefinitions::overlay(std::string_view content, ParsePhases* phases, DefinitionsReport* report,
+                                 std::string* error) {
+    ParsedDefinitions user = parseDefinitions(content, sequences, phases, report);
+    if (!user.valid) {
+        if (error) *error = std::move(user.error);
+        return false;
+    }
+    sequences = std::move(user.sequences);
+    const auto start = std::chrono::steady_clock::now();
+    if (user.replacesCombiningRules) {
+        setCombiningRules(combiningRules, user.combiningRules);
+        indexCombiningRules();
+    }
+    if (phases) phases->combining = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+
+void ComposeDefinitions::keepLinearRules() {
+    linearRules.clear();
+    sequences.forEach([&](std::string_view key, std::u16string_view output) { linearRules.emplace_back(key, output); });
+    linearScan = true;
+}
+
+
+const CombiningRule* ComposeDefinitions::findCombiningRule(uint32_t key) const {
+    auto found = std::lower_bound(combiningRules.begin(), combiningRules.end(), key,
+                                  [](const CombiningRule& rule, uint32_t k) { return rule.key < k; });
+    return found != combiningRules.end() && found->key == key ? &*found : 0;
+}
+
+
+void ComposeDefinitions::indexCombiningRules() {
+    for (char16_t c = 0; c < 128; ++c) {
+        const CombiningRule* found = findCombiningRule(c);
+        asciiRules[c] = found ? static_cast<uint32_t>(found - combiningRules.data()) + 1 : 0;
+    }
+}
+
+
+uint32_t ComposeDefinitions::combiningRule(std::u16string_view keyText) const {
+    if (keyText.length() == 1 && keyText[0] < 128) return asciiRules[keyText[0]] ? asciiRules[keyText[0]] - 1 : noRule;
+    const CombiningRule* found = findCombiningRule(combiningKey(keyText));
+    return found ? static_cast<uint32_t>(found - combiningRules.data()) : noRule;
+}
+
+
+ComposeEngine::ImplicitCombination::Marks* ComposeEngine::ImplicitCombination::marksFor(uint32_t key) {
+    for (size_t i = 0; i < markCount; ++i) if (haveMark[i].key == key) return &haveMark[i];
+    if (markCount == maxMarks) return 0;
+    haveMark[markCount] = Marks();
+    haveMark[markCount].key = key;
+    return &haveMark[markCount++];
+}
+
+
+ComposeEngine::ImplicitCombination::Category ComposeEngine::ImplicitCombination::category(std::u16string_view s) {
+    static constexpr auto ascii = [] {
+        std::array<Category, 128> table;
+        table.fill(Single);
+        for (char c = '0'; c <= '9'; ++c) table[c] = Digit;
+        for (char c = 'a'; c <= 'f'; ++c) table[c] = table[c - 'a' + 'A'] = HexLetter;
+        table['x'] = table['X'] = X;
+        table['&' ] = Amp;
+        table['#' ] = Hash;
+        table[';' ] = Semicolon;
+        table['\r'] = Return;
+        return table;
+    }();
+    if (s.length() == 1) return s[0] < 128 ? ascii[s[0]] : Single;
+    if (s.length() == 2) return Pair;
+    return s == u"[Up]" ? Up : s == u"[Down]" ? Down : Other;
+}
+
+
+// The grammar of implicit combinations: what a key of each category does in each phase, and the phase that follows.
+//
+//     Start, Marked    before the base character, with no accents or some accents typed
+//     Base1, Amp1, Hex1
+//                      after a base character of one code unit and no accents: any other, &, or a hexadecimal digit
+//                      (so that & # begins &# entry and two hexadecimal digits begin #x entry)
+//     Base             after the base character, otherwise
+//     Decimal, HexEntity, HashX
+//                      in numeric entry: &#, &#x and #x
+//     Done             after the combination is complete or a key has been rejected
+//
+// MarkOrBase, MarkOrComplete and MarkOrRefuse add an accent if the key has a combining rule; otherwise they make
+// the key the base character (continuing in the phase given), make it the base character and complete the
+// combination, or reject it. A pending [Up] or [Down] makes any key other than an accent rejected.
+
+ComposeEngine::ImplicitCombination::Step ComposeEngine::ImplicitCombination::step(Phase phase, Category category) {
+    static constexpr auto table = [] {
+        std::array<std::array<Step, Other + 1>, Done + 1> t{};
+        for (Phase p : { Start, Marked, Base1, Amp1, Hex1, Base }) {
+            const Action key = p == Start ? MarkOrBase : p == Marked ? MarkOrComplete : MarkOrRefuse;
+            for (Category c : { Single, Pair, Amp, Hash, X, Semicolon, Digit, HexLetter }) t[p][c] = { key, Done };
+            t[p][Return] = { Finish, Done };
+            t[p][Up] = t[p][Down] = { Modifier, p <= Marked ? p : Base };
+            t[p][Other] = { Refuse, Done };
+        }
+        t[Start][Single] = t[Start][Hash] = t[Start][X] = t[Start][Semicolon] = { MarkOrBase, Base1 };
+        t[Start][Pair]  = { MarkOrBase, Base };
+        t[Start][Amp]   = { MarkOrBase, Amp1 };
+        t[Start][Digit] = t[Start][HexLetter] = { MarkOrBase, Hex1 };
+        t[Amp1][Hash]   = { StartDecimal, Decimal };
+        t[Hex1][Digit]  = t[Hex1][HexLetter] = { StartHashX, HashX };
+        for (Phase p : { Decimal, HexEntity, HashX, Done }) for (Step& step : t[p]) step = { Refuse, Done };
+        for (Phase p : { Decimal, HexEntity, HashX }) {
+            t[p][Return] = { Finish, Done };
+            t[p][Digit]  = { NumericDigit, p };
+            if (p != Decimal) t[p][HexLetter] = { NumericDigit, p };
+        }
+        t[Decimal][X]         = { StartHexEntity, HexEntity };
+        t[Decimal][Semicolon] = t[HexEntity][Semicolon] = { EndEntity, Done };
+        return t;
+    }();
+    return table[phase][category];
+}
+
+
+ComposeEngine::ImplicitCombination::AddStatus ComposeEngine::ImplicitCombination::mark(const CombiningRule& rule) {
+    Marks* markEntry = marksFor(rule.key);
+    if (!markEntry || comb.length() == 32) return Reject;
+    Marks& marks = *markEntry;
+    switch (modPending) {
+    case ModUp:
+        if (rule.up == 1) break;
+        if (marks.up || !rule.up) return Reject;
+        marks.up = true;
+        comb.push_back(rule.up);
+        modPending = ModNone;
+        return Accept;
+    case ModDown:
+        if (rule.down == 1) break;
+        if (marks.down || !rule.down) return Reject;
+        marks.down = true;
+        comb.push_back(rule.down);
+        modPending = ModNone;
+        return Accept;
+    default:;
+    }
+    if (marks.two) return Reject;
+    if (marks.one) {
+        if (!rule.two) return Reject;
+        if (comb.empty() || comb.back() != rule.one) return Reject;
+        marks.one = false;
+        marks.two = true;
+        comb.back() = rule.two;
+        modPending = ModNone;
+        return Accept;
+    }
+    if (rule.one) {
+        marks.one = true;
+        comb.push_back(rule.one);
+        modPending = ModNone;
+        return Accept;
+    }
+    return Reject;
+}
+
+
+ComposeEngine::ImplicitCombination::AddStatus ComposeEngine::ImplicitCombination::add(std::u16string_view s, uint32_t rule) {
+
+    const Step next = step(phase, category(s));
+
+    switch (next.action) {
+
+    case Finish:
+        phase = Done;
+        return Complete;
+
+    case Refuse:
+        phase = Done;
+        return Reject;
+
+    case Modifier:
+        modPending = s == u"[Up]" ? ModUp : ModDown;
+        phase = next.next;
+        return Accept;
+
+    case MarkOrBase:
+    case MarkOrComplete:
+    case MarkOrRefuse:
+        if (rule != ComposeDefinitions::noRule) {
+            if (mark(definitions->combiningRules[rule]) == Reject) {
+                phase = Done;
+                return Reject;
+            }
+            phase = phase <= Marked ? Marked : Base;
+            return Accept;
+        }
+        if (next.action == MarkOrRefuse || modPending != ModNone) {
+            phase = Done;
+            return Reject;
+        }
+        base.assign(s);
+        phase = next.next;
+        return next.action == MarkOrComplete ? Complete : Accept;
+
+    case StartDecimal:
+        base.assign(u"&#");
+        phase = next.next;
+        return Accept;
+
+    case StartHexEntity:
+        if (!comb.empty()) {
+            phase = Done;
+            return Reject;
+        }
+        base.assign(u"&#x");
+        phase = next.next;
+        return Accept;
+
+    case StartHashX:
+        value = hexValue(base[0]) * 16 + hexValue(s[0]);
+        comb.push_back(base[0]);
+        comb.push_back(s[0]);
+        base.assign(u"#x");
+        phase = next.next;
+        return Accept;
+
+    case NumericDigit:
+    {
+        const int v = value * (phase == Decimal ? 10 : 16) + hexValue(s[0]);
+        if (v >= 0x110000 || comb.length() >= 16) {
+            phase = Done;
+            return Reject;
+        }
+        value = v;
+        comb.push_back(s[0]);
+        if (phase == HashX && (value >= 0x11000 || comb.size() > 5)) {
+            phase = Done;
+            return Complete;
+        }
+        return Accept;
+    }
+
+    case EndEntity:
+        comb.push_back(s[0]);
+        phase = Done;
+        return Complete;
+
+    }
+    return Reject;
+
+}
+
+
+std::u16string_view ComposeEngine::ImplicitCombination::compose(Normalizer normalize) {
+
+    const auto timer = statistics.timer(statistics.compose);
+
+    if ( ((base == u"&#" || base == u"&#x") && comb.size() > 1 && comb.back() == u';') || (base == u"#x" && !comb.empty()) ) {
+        if (value >= 0x10000) {
+            composed[0] = static_cast<char16_t>(0xD800 + ((value - 0x10000) >> 10));
+            composed[1] = static_cast<char16_t>(0xDC00 + (value & 0x03FF));
+            return std::u16string_view(composed, 2);
+        }
+        composed[0] = static_cast<char16_t>(value);
+        return std::u16string_view(composed, 1);
+    }
+
+    FixedString<char16_t, 72> s;  // base (at most 3) + comb (at most 32 code points)
+    s.append(base);
+    for (char32_t c : comb)
+        if (c >= 0x10000) {
+            s.push_back(static_cast<char16_t>(0xD800 + ((c - 0x10000) >> 10)));
+            s.push_back(static_cast<char16_t>(0xDC00 + (c & 0x03FF)));
+        }
+        else s.push_back(static_cast<char16_t>(c));
+
+    // A letter and one mark that make a precomposed character (e and U+0301 for é), the most common implicit
+    // combination, takes one lookup in the composition table rather than a full normalization (see precomposeC).
+
+    constexpr size_t room = sizeof composed / sizeof composed[0] - 6;  // leave room for [Down]
+    size_t length = 0;
+    char32_t first;
+    if (normalize && comb.size() == 1 && !base.empty() && unicodeNormalization::decode(base, 0, first) == base.length())
+        length = precomposeC(first, comb[0], composed);
+    if (!length && !s.empty()) {
+        if (normalize) length = normalize(s, composed, room);
+        else {
+            s.view().copy(composed, room);
+            length = s.length();
+        }
+    }
+
+    std::u16string_view mod = modPending == ModUp ? u"[Up]" : modPending == ModDown ? u"[Down]" : u"";
+    mod.copy(composed + length, mod.length());
+    return std::u16string_view(composed, length + mod.length());
+
+}
+
+
+void ComposeEngine::start(std::shared_ptr<const ComposeDefinitions> d) {
+    statistics.count(statistics.sequencesStarted);
+    isComposing = true;
+    definitions = std::move(d);
+    clear();
+}
+
+
+void ComposeEngine::clear() {
+    composeSequence.clear();
+    composeState = SequenceTrie::root;
+    pendingState = SequenceTrie::dead;
+    implicitSuffix.clear();
+    implicitCombination.clear(definitions.get());
+}
+
+
+void ComposeEngine::sendPending(OutputSink& out) {
+    statistics.count(statistics.explicitMatches);
+    out.send(definitions->sequences.output(pendingState));
+    char16_t rest[256];  // composeSequence holds at most 256 bytes, and UTF-16 never takes more code units
+    out.send(std::u16string_view(rest, utf8to16(composeSequence.view().substr(pendingLength), rest)));
+}
+
+
+void ComposeEngine::expire(OutputSink& out) {
+    if (!pending()) return;
+    isComposing = false;
+    sendPending(out);
+    implicitSuffix.clear();
+    composeSequence.clear();
+    composeState = SequenceTrie::root;
+    pendingState = SequenceTrie::dead;
+}
+
+
+void ComposeEngine::restart(OutputSink& out) {
+    if (pending()) {
+        sendPending(out);
+        clear();
+        return;
+    }
+    const std::u16string_view composed = implicitCombination.compose(normalize);
+    statistics.count(composed.empty() ? statistics.rejects : statistics.implicitMatches);
+    out.send(composed);
+    out.send(implicitSuffix);
+    clear();
+}
+
+
+void ComposeEngine::key(std::u16string_view keyText, OutputSink& out, bool choosing) {
+
+    if (!isComposing) return;
+    statistics.count(statistics.keysHandled);
+
+    const SequenceTrie::State before = composeState;
+    FixedString<char, 128> bytesTyped;
+    appendUtf8(bytesTyped, keyText.substr(0, 40));
+    const bool fits = composeSequence.append(bytesTyped);
+
+    if (implicitCombination.add(keyText, definitions->combiningRule(keyText)) == ImplicitCombination::Reject)
+        implicitSuffix.append(keyText);
+
+    bool completes = false;                                   // an explicit sequence ends here
+    bool continues = fits && implicitCombination.open();      // either part can take more keys
+    std::u16string_view output;
+
+    if (definitions->linearScan) {
+        const std::string_view sequence = composeSequence;
+        for (auto& [key, value] : definitions->linearRules) {
+            if (!fits) break;
+            if (key == sequence) {
+                completes = true;
+                output = value;
+                break;
+            }
+            else if (key.length() > sequence.length() && key.starts_with(sequence)) {
+                continues = true;
+                break;
+            }
+        }
+    }
+    else {
+        const SequenceTrie& sequences = definitions->sequences;
+        composeState = fits ? sequences.next(composeState, bytesTyped) : SequenceTrie::dead;
+        const bool extendable = sequences.extendable(composeState);
+        completes = sequences.complete(composeState);
+        continues = continues || extendable;
+        output    = sequences.output(composeState);
+        if (choosing && !completes && !continues && before != SequenceTrie::root
+            && keyText.length() == 1 && keyText[0] >= u'1' && keyText[0] <= u'9') {
+            const std::span<const SequenceTrie::State> choices = sequences.choices(before);
+            if (static_cast<size_t>(keyText[0] - u'1') < choices.size()) {
+                completes = true;
+                output    = sequences.output(choices[keyText[0] - u'1']);
+            }
+        }
+        if (uniquePrefix && extendable && !implicitCombination.open()
+            && sequences.onlyCompletion(composeState) != SequenceTrie::dead) {
+            completes = true;
+            output    = sequences.output(sequences.onlyCompletion(composeState));
+        }
+        else if (longestMatch && completes && extendable) {
+            completes     = false;
+            pendingState  = composeState;
+            pendingLength = composeSequence.length();
+        }
+        else if (!completes && !extendable && pendingState != SequenceTrie::dead) {
+            isComposing = false;
+            sendPending(out);
+            if (!fits) out.send(keyText);
+            implicitSuffix.clear();
+            composeSequence.clear();
+            composeState = SequenceTrie::root;
+            pendingState = SequenceTrie::dead;
+            return;
+        }
+    }
+
+    if (completes) {
+        isComposing = false;
+        statistics.count(statistics.explicitMatches);
+        out.send(output);
+        composeSequence.clear();
+        composeState = SequenceTrie::root;
+        pendingState = SequenceTrie::dead;
+        return;
+    }
+    if (continues) return;
+
+    isComposing = false;
+    const std::u16string_view composed = implicitCombination.compose(normalize);
+    statistics.count(composed.empty() ? statistics.rejects : statistics.implicitMatches);
+    out.send(composed);
+    out.send(implicitSuffix);
+    implicitSuffix.clear();
+    composeSequence.clear();
+    composeState = SequenceTrie::root;
+
+}
+
+
+bool ComposeEngine::handle(const KeyEvent& event, const std::shared_ptr<const ComposeDefinitions>& d, OutputSink& out) {
+    const bool releasing = event.flags & KeyEvent::KeyUp;
+    if (isComposing) {
+        if (event.flags & KeyEvent::ComposeKey) {
+            if (releasing) return true;
+            if (empty()) {
+                cancel();
+                return false;
+            }
+            restart(out);
+            return true;
+        }
+        if (!(event.flags & (KeyEvent::KeyUp | KeyEvent::Repeat)) && !event.text.empty()) key(event.text, out);
+        return true;
+    }
+    if (!(event.flags & KeyEvent::ComposeKey)) return false;
+    if (!releasing) {
+        start(d);
+        return true;
+    }
+    if (empty()) return false;
+    clear();
+    return true;
+}
+
+
+size_t ComposeEngine::process(std::span<const KeyEvent> events, const std::shared_ptr<const ComposeDefinitions>& d,
+                              OutputSink& out) {
+
+    // Collects the text of the batch, sending it on only when there is no more room.
+    class Batch : public OutputSink {
+        OutputSink&                             out;
+        FixedString<char16_t, batchCapacity>    text;
+    public:
+        explicit Batch(OutputSink& out) : out(out) {}
+        void send(std::u16string_view s) override {
+            if (text.append(s)) return;
+            flush();
+            if (!text.append(s)) out.send(s);
+        }
+        void flush() {
+            if (text.empty()) return;
+            out.send(text);
+            text.clear();
+        }
+    } batch(out);
+
+    size_t n = 0;
+    while (n < events.size()) {
+        const KeyEvent& event = events[n++];
+        if (handle(event, d, batch)) continue;
+        if (event.flags & (KeyEvent::ComposeKey | KeyEvent::Name)) break;
+        if (!(event.flags & KeyEvent::KeyUp)) batch.send(event.text);
+    }
+    batch.flush();
+    return n;
+
+}
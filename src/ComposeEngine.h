@@ -0,0 +1,333 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "FixedString.h"
+#include "SequenceTrie.h"
+#include "UnicodeNormalization.h"
+
+// The compose engine: everything about composing that does not depend on Windows or Notepad++.
+//
+// The plugin (ProcessCompose.cpp) turns key messages into key text and the compose key into calls to start, restart,
+// cancel and clear, and inserts output into Scintilla (see EditorSink.h) or sends it by SendInput; other hosts, such
+// as the benchmarks in tools, can drive the same engine directly. Nothing here allocates memory while keys are processed.
+
+
+// A CombiningRule defines the interpretation of a key that represents a combining mark (accent).
+// Each rule contains the char32_t results for a single accent, a double, an up and a down version.
+// A zero means the combination (double, up and/or down) is not valid; a 1 for up or down means use the single accent value.
+// The key is one or two UTF-16 code units, packed by ComposeDefinitions::combiningKey; keys that are longer
+// (which could never be typed as one key) are not kept.
+
+struct CombiningRule { uint32_t key; char32_t one, two, up, down; };
+
+struct ParsePhases;        // DefinitionsParser.h
+struct DefinitionsReport;  // DefinitionsParser.h
+
+
+// ComposeDefinitions holds compiled definitions. Once built, it is never changed; the plugin publishes a new one
+// on each reload (see LoadSequenceDefinitions.cpp), and an engine keeps the one in effect when its sequence began.
+//
+// static std::shared_ptr<ComposeDefinitions> builtIn()
+//     Returns new definitions holding the built-in sequences and combining rules (see DefaultSequences.h).
+//
+// bool overlay(std::string_view content, ParsePhases* phases = 0, DefinitionsReport* report = 0,
+//              std::string* error = 0)
+//     Lays a user definitions file (the bytes of the file) over these definitions; see DefinitionsParser.h.
+//     Returns false, leaving the definitions unchanged, if content is not a valid definitions file, and sets error
+//     (if given) to the reason.
+//     If phases is given, the time taken by each phase is recorded in it; if report is given, duplicate keys and
+//     keys that replace existing sequences are added to it.
+//
+// void keepLinearRules()
+//     Copies the sequences to linearRules and sets linearScan, so the engine matches by linear scan (for comparison).
+//
+// void indexCombiningRules()
+//     Compiles the combining rules for keys of one ASCII character into a table indexed by the character; must be
+//     called whenever combiningRules is changed (builtIn and overlay do so).
+//
+// const CombiningRule* findCombiningRule(uint32_t key) const
+//     Returns the combining rule for a packed key, or null if there is none.
+//
+// uint32_t combiningRule(std::u16string_view keyText) const
+//     Returns the index in combiningRules of the rule for a key, or noRule if there is none.
+
+struct ComposeDefinitions {
+
+    SequenceTrie sequences;                                           // Explicit sequences (built-in, overlaid by user definitions)
+    std::vector<CombiningRule> combiningRules;                        // Sorted by key, no duplicates
+    std::vector<std::pair<std::string, std::u16string>> linearRules;  // Copy of sequences, kept only when linearScan
+    bool         linearScan      = false;                             // Match explicit sequences by scanning linearRules
+    bool         userDefinitions = false;                             // True if userFile is included
+    std::wstring userFile;                                            // User definitions file included, if any
+    size_t       issueCounts[5]  = {};                                // Issues in userFile by DefinitionsIssue::Kind
+    uint32_t     asciiRules[128] = {};                                // 1 + index of combining rule by character, 0 if none
+
+    static constexpr uint32_t noRule = UINT32_MAX;
+
+    static uint32_t combiningKey(std::u16string_view s) {
+        return s.length() == 1 ? s[0] : s.length() == 2 ? s[0] | static_cast<uint32_t>(s[1]) << 16 : 0;
+    }
+
+    static std::shared_ptr<ComposeDefinitions> builtIn();
+    bool overlay(std::string_view content, ParsePhases* phases = 0, DefinitionsReport* report = 0, std::string* error = 0);
+    void keepLinearRules();
+
+    void indexCombiningRules();
+
+    const CombiningRule* findCombiningRule(uint32_t key) const;
+    uint32_t combiningRule(std::u16string_view keyText) const;
+
+};
+
+
+// A KeyEvent is a key message for ComposeEngine::handle or process. flags are those of the key messages in a keystroke
+// trace (KeystrokeTrace.h) that matter here, and Name; text is the key text of a key down (see below), or, with Name,
+// the bracketed name of a key that doesn't type anything. The text must stay valid until the call returns.
+
+struct KeyEvent {
+    enum Flags : uint8_t { KeyUp = 1, Repeat = 2, ComposeKey = 4, Name = 8 };
+    uint8_t             flags = 0;
+    std::u16string_view text;
+};
+
+
+// ComposeEngine holds the state of one compose sequence.
+//
+// Key text is what a key types, as UTF-16, or a bracketed name such as [Left], [Up] or [F5] for a key that doesn't
+// type anything. Composed text is written to an OutputSink.
+//
+// Each key advances both parts of the sequence state in one step: the position in the explicit sequences and the
+// implicit combination. If the position completes an explicit sequence, its output is sent; otherwise the sequence
+// goes on if either part can continue; otherwise the implicit composition and the keys it left over are sent.
+//
+// ComposeEngine(Normalizer normalize = normalizeC)
+//     normalize converts text to Unicode Normalization Form C, writing at most capacity code units to out and
+//     returning the length, or 0 on failure; if it is null, implicit combinations are not normalized.
+//     The default is the normalizer in UnicodeNormalization.h. A letter and one mark that make a precomposed
+//     character are composed by precomposeC (also in UnicodeNormalization.h) without calling normalize.
+//
+// void start(std::shared_ptr<const ComposeDefinitions> definitions)
+//     Begins a sequence (the compose key was pressed while not composing) using the given definitions.
+//
+// void key(std::u16string_view keyText, OutputSink& out, bool choosing = false)
+//     Processes a key typed while composing. When an explicit match is found or an implicit match is complete,
+//     sends the composition and ends composing. When choosing is true, a key 1 to 9 that would end a sequence of at
+//     least one key without a match (it continues neither an explicit sequence nor an implicit combination) instead
+//     sends the output of that choice (see choices); a host passes true only while it is showing the choices, so
+//     that a number key chooses one only when the user can see what it will send.
+//
+// void restart(OutputSink& out)
+//     The compose key was pressed during a sequence: sends the implicit composition so far (or a pending explicit
+//     match) and any keys left over, and begins a new sequence with the same definitions.
+//
+// void cancel()
+//     Ends composing without output (the compose key was pressed again before any other key).
+//
+// void clear()
+//     Discards the sequence so far.
+//
+// void setMatching(bool uniquePrefix, bool longestMatch)
+//     Sets how explicit sequences are matched by the sequence trie (linear scan ignores these), from the next key:
+//     uniquePrefix: when every sequence that begins with the keys typed has the same output, and no implicit
+//                   combination can continue, that output is sent at once without waiting for the rest of the keys.
+//     longestMatch: a sequence that is complete and also the beginning of a longer one is pending rather than sent:
+//                   if the next keys complete a longer sequence, that one is sent; if they lead nowhere, or the host
+//                   calls expire, the longest complete sequence typed is sent followed by the keys after it.
+//     Both are off by default, so a complete sequence is always sent as soon as it is typed.
+//
+// size_t choiceCount() const
+//     The number of choices for the keys typed so far: the first SequenceTrie::maxChoices explicit sequences that
+//     begin with them, shortest first (see SequenceTrie::choices); 0 when not composing, when matching by linear scan
+//     or when no explicit sequence begins with the keys typed.
+//
+// std::u16string_view choice(size_t i, std::span<char> rest, size_t& restLength) const
+//     Returns the output of choice i, and writes the keys that follow the keys typed so far to complete it to rest
+//     (as UTF-8), setting restLength to their length (0 if they don't fit).
+//
+// uint32_t completionCount() const
+//     The number of explicit sequences that begin with the keys typed so far, including those beyond the choices.
+//
+// std::string_view typed() const
+//     The keys typed so far, as UTF-8.
+//
+// bool pending() const
+//     True when longestMatch is on and a complete sequence is waiting for a longer one; the host calls expire after
+//     a timeout if no other key is typed.
+//
+// void expire(OutputSink& out)
+//     If a sequence is pending, sends it and the keys typed after it, and ends composing.
+//
+// bool composing() const
+//     True when a compose sequence is in progress.
+//
+// bool empty() const
+//     True if no keys have been typed in the current sequence.
+//
+// bool handle(const KeyEvent& event, const std::shared_ptr<const ComposeDefinitions>& definitions, OutputSink& out)
+//     Does with a key message what the plugin's processCompose does (other than correcting locking keys): on the
+//     compose key, starts a sequence with definitions, restarts, cancels or clears; while composing, passes the text
+//     of initial key downs to key. Returns true if the engine used the message, false if it should go on as typed.
+//
+// size_t process(std::span<const KeyEvent> events, const std::shared_ptr<const ComposeDefinitions>& definitions,
+//                OutputSink& out)
+//     Handles a batch of key messages, such as macro playback queues, and sends all the text they produce, in
+//     order (what is composed, and the text of key downs the engine doesn't use), in one call to out.send; text
+//     beyond batchCapacity code units is sent in more calls. Returns the number of events handled, which is less
+//     than events.size() if it stopped after a message the engine didn't use that does more than type its text (a Name
+//     key, or the compose key when it cancels an empty sequence); the caller passes that message (the last one
+//     handled) on as usual, then calls again with the rest. Key ups of other keys the engine doesn't use are dropped.
+
+class ComposeEngine {
+
+public:
+
+    using Normalizer = size_t (*)(std::u16string_view text, char16_t* out, size_t capacity);
+
+    class OutputSink {
+    public:
+        virtual void send(std::u16string_view text) = 0;
+    protected:
+        ~OutputSink() = default;
+    };
+
+private:
+
+    // ImplicitCombination keeps track of the progress of an implicit combination.
+    //
+    // The grammar is compiled into a table (see ImplicitCombination::step in ComposeEngine.cpp) giving what each
+    // category of key does in each phase of a combination: the categories are the characters used in numeric entry
+    // (& # x ; and hexadecimal digits), \r, [Up], [Down], other keys of one or two code units and longer keys; the
+    // phases are before and after the base character, and within each kind of numeric entry. Only the accents used
+    // so far and the value of a numeric entry are kept apart from the phase.
+    //
+    // AddStatus add(std::u16string_view s, uint32_t rule)
+    //     Takes a new key to be added to the implicit combination; rule is the index of its combining rule in the
+    //     definitions, or ComposeDefinitions::noRule.
+    //     Returns:
+    //         Accept:   The key has been added; more keys can be added.
+    //         Complete: The key has been added; the combination is finished and no more keys can be added.
+    //         Reject:   The key has not been added; the combination is finished and the supplied key is left over.
+    //
+    //  void clear()
+    //      Resets the implicit combination to an empty sequence.
+    //
+    //  std::u16string_view compose(Normalizer normalize)
+    //      Returns the composed string for the implicit combination, valid until the next call.
+    //
+    //  bool open() const
+    //      True if more keys can be added (no add has returned Complete or Reject).
+
+    class ImplicitCombination {
+    public:
+        enum AddStatus {Accept, Complete, Reject};
+        enum Category : uint8_t { Single, Pair, Return, Amp, Hash, X, Semicolon, Digit, HexLetter, Up, Down, Other };
+        enum Phase    : uint8_t { Start, Marked, Base1, Amp1, Hex1, Base, Decimal, HexEntity, HashX, Done };
+        enum Action   : uint8_t { Finish, Refuse, Modifier, MarkOrBase, MarkOrComplete, MarkOrRefuse,
+                                  StartDecimal, StartHexEntity, StartHashX, NumericDigit, EndEntity };
+        struct Step { Action action; Phase next; };
+    private:
+        enum ModStatus {ModNone, ModUp, ModDown};
+        struct Marks { uint32_t key = 0; bool one = false, two = false, up = false, down = false; };
+        static constexpr size_t maxMarks = 32;
+        const ComposeDefinitions*   definitions = 0;
+        Marks                       haveMark[maxMarks];  // marks used so far, by combining rule key
+        size_t                      markCount = 0;
+        FixedString<char16_t, 4>    base;
+        FixedString<char32_t, 32>   comb;
+        char16_t                    composed[256];
+        int                         value = 0;
+        Phase                       phase = Start;
+        ModStatus                   modPending = ModNone;
+        Marks* marksFor(uint32_t key);
+        AddStatus mark(const CombiningRule& rule);
+        static Category category(std::u16string_view s);
+        static Step step(Phase phase, Category category);
+    public:
+        AddStatus add(std::u16string_view s, uint32_t rule);
+        void clear(const ComposeDefinitions* d) {
+            definitions = d; base.clear(); comb.clear(); markCount = 0; value = 0; phase = Start; modPending = ModNone;
+        }
+        std::u16string_view compose(Normalizer normalize);
+        bool open() const { return phase != Done; }
+    };
+
+    Normalizer                                normalize;
+    std::shared_ptr<const ComposeDefinitions> definitions;        // definitions in effect when the sequence began
+    FixedString<char, 256>                    composeSequence;    // compose sequence so far (encoding is UTF-8)
+    SequenceTrie::State                       composeState = SequenceTrie::root;  // position of composeSequence in definitions->sequences
+    FixedString<char16_t, 512>                implicitSuffix;     // trailing characters that follow a complete implicit match (never
+                                                                  // more code units than composeSequence has bytes, plus one key)
+    ImplicitCombination                       implicitCombination;
+    SequenceTrie::State                       pendingState  = SequenceTrie::dead;  // complete state waiting for a longer match
+    size_t                                    pendingLength = 0;  // bytes of composeSequence that lead to pendingState
+    bool                                      uniquePrefix  = false;
+    bool                                      longestMatch  = false;
+    bool                                      isComposing   = false;
+
+    void sendPending(OutputSink& out);
+
+public:
+
+    explicit ComposeEngine(Normalizer normalize = normalizeC) : normalize(normalize) {}
+
+    void start(std::shared_ptr<const ComposeDefinitions> definitions);
+    void key(std::u16string_view keyText, OutputSink& out, bool choosing = false);
+    void restart(OutputSink& out);
+    void cancel() { isComposing = false; }
+    void clear();
+
+    void setMatching(bool unique, bool longest) { uniquePrefix = unique; longestMatch = longest; }
+    bool pending() const { return isComposing && pendingState != SequenceTrie::dead; }
+    void expire(OutputSink& out);
+
+    bool composing() const { return isComposing; }
+    bool empty() const { return composeSequence.empty(); }
+    std::string_view typed() const { return composeSequence; }
+
+    size_t choiceCount() const {
+        return isComposing && !definitions->linearScan ? definitions->sequences.choices(composeState).size() : 0;
+    }
+
+    std::u16string_view choice(size_t i, std::span<char> rest, size_t& restLength) const {
+        const SequenceTrie::State state = definitions->sequences.choices(composeState)[i];
+        restLength = definitions->sequences.suffix(composeState, state, rest);
+        return definitions->sequences.output(state);
+    }
+
+    uint32_t completionCount() const {
+        return isComposing && !definitions->linearScan ? definitions->sequences.completions(composeState) : 0;
+    }
+
+    static constexpr size_t batchCapacity = 4096;
+
+    bool   handle (const KeyEvent& event, const std::shared_ptr<const ComposeDefinitions>& definitions, OutputSink& out);
+    size_t process(std::span<const KeyEvent> events, const std::shared_ptr<const ComposeDefinitions>& definitions,
+                   OutputSink& out);
+
+};
@@ -0,0 +1,3209 @@
+// Generated by tools/GenerateDefaultSequences.cpp from compose-default.jsonc -- do not edit.
+// 2719 explicit sequences, 15 implicit combining rules.
+
+#pragma once
+
+#include "SequenceTrie.h"
+
+namespace defaultSequences {
+
+inline constexpr uint64_t sourceHash = 0xB92B251228970FDDull;  // FNV-1a hash of compose-default.jsonc
+
+inline constexpr uint32_t none = SequenceTrie::noOutput;
+
+inline constexpr SequenceTrie::Node nodes[] = {
+    {0,none,78,0}, {78,none,28,0}, {106,0,0,1}, {106,none,1,0}, {107,1,0,1}, {107,2,0,1}, {107,3,0,1}, {107,4,0,1}, {107,5,0,1},
+    {107,6,0,1}, {107,7,0,1}, {107,8,0,1}, {107,9,0,1}, {107,10,0,1}, {107,11,0,1}, {107,12,0,1}, {107,13,0,1}, {107,14,0,1},
+    {107,none,1,0}, {108,1,0,1}, {108,none,4,0}, {112,none,1,0}, {113,none,1,0}, {114,none,1,0}, {115,none,1,0}, {116,15,0,1},
+    {116,none,1,0}, {117,none,1,0}, {118,none,1,0}, {119,none,1,0}, {120,16,0,1}, {120,none,1,0}, {121,none,1,0}, {122,none,1,0},
+    {123,none,1,0}, {124,none,1,0}, {125,17,0,1}, {125,none,1,0}, {126,none,1,0}, {127,18,0,1}, {127,19,0,1}, {127,20,0,1},
+    {127,21,0,1}, {127,22,0,1}, {127,23,0,1}, {127,24,0,1}, {127,25,0,1}, {127,26,0,1}, {127,27,0,1}, {127,28,0,1}, {127,29,0,1},
+    {127,none,6,0}, {133,30,0,1}, {133,31,0,1}, {133,32,0,1}, {133,33,0,1}, {133,32,0,1}, {133,33,0,1}, {133,none,5,0},
+    {138,2,0,1}, {138,34,0,1}, {138,35,0,1}, {138,36,0,1}, {138,35,0,1}, {138,none,7,0}, {145,37,0,1}, {145,38,0,1}, {145,39,0,1},
+    {145,40,0,1}, {145,41,0,1}, {145,42,0,1}, {145,43,0,1}, {145,none,1,0}, {146,44,0,1}, {146,none,52,0}, {198,none,16,0},
+    {214,none,1,0}, {215,none,1,0}, {216,none,1,0}, {217,none,1,0}, {218,45,0,1}, {218,none,1,0}, {219,none,1,0}, {220,46,0,1},
+    {220,none,1,0}, {221,none,1,0}, {222,none,1,0}, {223,none,1,0}, {224,none,1,0}, {225,47,0,1}, {225,none,1,0}, {226,none,1,0},
+    {227,none,1,0}, {228,none,1,0}, {229,none,1,0}, {230,48,0,1}, {230,none,2,0}, {232,none,1,0}, {233,none,1,0}, {234,none,1,0},
+    {235,49,0,1}, {235,none,1,0}, {236,50,0,1}, {236,none,1,0}, {237,none,1,0}, {238,51,0,2}, {238,none,1,0}, {239,none,1,0},
+    {240,none,1,0}, {241,none,1,0}, {242,none,1,0}, {243,53,0,1}, {243,none,1,0}, {244,none,1,0}, {245,none,1,0}, {246,none,1,0},
+    {247,54,0,1}, {247,none,1,0}, {248,none,1,0}, {249,none,1,0}, {250,none,1,0}, {251,55,0,1}, {251,none,1,0}, {252,none,1,0},
+    {253,56,0,1}, {253,none,2,0}, {255,none,1,0}, {256,none,1,0}, {257,none,1,0}, {258,57,0,1}, {258,none,1,0}, {259,none,1,0},
+    {260,58,0,2}, {260,none,1,0}, {261,none,1,0}, {262,none,1,0}, {263,none,1,0}, {264,none,1,0}, {265,none,1,0}, {266,none,1,0},
+    {267,none,1,0}, {268,none,1,0}, {269,none,1,0}, {270,none,1,0}, {271,none,1,0}, {272,60,0,1}, {272,none,1,0}, {273,none,1,0},
+    {274,none,1,0}, {275,none,1,0}, {276,61,0,1}, {276,none,2,0}, {278,none,1,0}, {279,none,1,0}, {280,62,0,2}, {280,none,1,0},
+    {281,none,1,0}, {282,none,1,0}, {283,none,1,0}, {284,64,0,1}, {284,none,1,0}, {285,none,1,0}, {286,none,1,0}, {287,none,1,0},
+    {288,none,1,0}, {289,65,0,1}, {289,none,1,0}, {290,none,1,0}, {291,none,1,0}, {292,66,0,1}, {292,none,8,0}, {300,none,2,0},
+    {302,none,1,0}, {303,none,1,0}, {304,none,1,0}, {305,none,1,0}, {306,none,1,0}, {307,none,1,0}, {308,none,1,0}, {309,67,0,1},
+    {309,none,2,0}, {311,none,1,0}, {312,68,0,1}, {312,none,1,0}, {313,none,1,0}, {314,none,1,0}, {315,69,0,1}, {315,none,1,0},
+    {316,none,1,0}, {317,70,0,1}, {317,none,3,0}, {320,none,1,0}, {321,none,1,0}, {322,none,1,0}, {323,none,1,0}, {324,none,1,0},
+    {325,71,0,1}, {325,none,1,0}, {326,none,1,0}, {327,none,1,0}, {328,none,1,0}, {329,none,1,0}, {330,none,1,0}, {331,none,1,0},
+    {332,none,1,0}, {333,72,0,1}, {333,none,1,0}, {334,none,1,0}, {335,73,0,1}, {335,none,1,0}, {336,none,1,0}, {337,74,0,2},
+    {337,none,1,0}, {338,none,1,0}, {339,none,1,0}, {340,76,0,2}, {340,none,1,0}, {341,none,1,0}, {342,none,1,0}, {343,none,1,0},
+    {344,4,0,1}, {344,none,1,0}, {345,none,1,0}, {346,none,1,0}, {347,72,0,1}, {347,none,1,0}, {348,none,1,0}, {349,none,1,0},
+    {350,none,1,0}, {351,none,1,0}, {352,78,0,1}, {352,none,14,0}, {366,none,1,0}, {367,none,1,0}, {368,none,1,0}, {369,79,0,1},
+    {369,none,1,0}, {370,none,1,0}, {371,none,1,0}, {372,80,0,1}, {372,none,3,0}, {375,none,1,0}, {376,none,1,0}, {377,none,1,0},
+    {378,none,1,0}, {379,81,0,1}, {379,none,2,0}, {381,82,0,1}, {381,none,1,0}, {382,none,1,0}, {383,none,1,0}, {384,none,1,0},
+    {385,none,1,0}, {386,none,1,0}, {387,none,1,0}, {388,none,1,0}, {389,none,1,0}, {390,none,1,0}, {391,none,1,0}, {392,none,1,0},
+    {393,none,1,0}, {394,none,1,0}, {395,none,1,0}, {396,none,1,0}, {397,none,1,0}, {398,83,0,1}, {398,none,1,0}, {399,none,1,0},
+    {400,none,1,0}, {401,none,1,0}, {402,none,1,0}, {403,84,0,1}, {403,none,4,0}, {407,none,1,0}, {408,none,1,0}, {409,none,1,0},
+    {410,none,1,0}, {411,85,0,1}, {411,none,1,0}, {412,none,1,0}, {413,none,1,0}, {414,none,1,0}, {415,86,0,1}, {415,none,1,0},
+    {416,none,1,0}, {417,none,1,0}, {418,87,0,1}, {418,none,1,0}, {419,none,1,0}, {420,none,1,0}, {421,none,1,0}, {422,none,1,0},
+    {423,88,0,1}, {423,none,1,0}, {424,none,1,0}, {425,none,1,0}, {426,89,0,1}, {426,none,2,0}, {428,none,1,0}, {429,none,1,0},
+    {430,none,1,0}, {431,none,1,0}, {432,none,1,0}, {433,6,0,1}, {433,none,1,0}, {434,none,1,0}, {435,none,1,0}, {436,none,1,0},
+    {437,none,1,0}, {438,none,1,0}, {439,none,1,0}, {440,90,0,1}, {440,none,1,0}, {441,none,1,0}, {442,84,0,1}, {442,none,1,0},
+    {443,none,1,0}, {444,91,0,1}, {444,none,1,0}, {445,none,1,0}, {446,none,1,0}, {447,none,1,0}, {448,none,4,0}, {452,none,1,0},
+    {453,none,1,0}, {454,none,1,0}, {455,92,0,1}, {455,none,1,0}, {456,none,1,0}, {457,none,1,0}, {458,none,1,0}, {459,none,1,0},
+    {460,93,0,1}, {460,none,1,0}, {461,none,1,0}, {462,none,1,0}, {463,none,1,0}, {464,94,0,1}, {464,none,1,0}, {465,none,1,0},
+    {466,none,1,0}, {467,none,1,0}, {468,none,1,0}, {469,95,0,1}, {469,none,1,0}, {470,none,2,0}, {472,none,1,0}, {473,none,1,0},
+    {474,none,1,0}, {475,none,1,0}, {476,none,1,0}, {477,none,1,0}, {478,none,1,0}, {479,none,1,0}, {480,none,1,0}, {481,none,1,0},
+    {482,none,1,0}, {483,none,1,0}, {484,none,1,0}, {485,none,1,0}, {486,none,1,0}, {487,none,1,0}, {488,none,1,0}, {489,none,1,0},
+    {490,none,1,0}, {491,none,1,0}, {492,none,1,0}, {493,96,0,1}, {493,none,1,0}, {494,none,1,0}, {495,none,1,0}, {496,none,1,0},
+    {497,none,1,0}, {498,none,1,0}, {499,none,2,0}, {501,none,1,0}, {502,none,1,0}, {503,none,1,0}, {504,none,1,0}, {505,none,1,0},
+    {506,none,1,0}, {507,none,1,0}, {508,none,1,0}, {509,none,1,0}, {510,none,1,0}, {511,none,1,0}, {512,35,0,1}, {512,none,1,0},
+    {513,none,1,0}, {514,none,1,0}, {515,none,1,0}, {516,none,1,0}, {517,97,0,1}, {517,none,4,0}, {521,none,1,0}, {522,none,1,0},
+    {523,none,2,0}, {525,98,0,1}, {525,none,1,0}, {526,99,0,1}, {526,none,3,0}, {529,none,1,0}, {530,none,1,0}, {531,none,1,0},
+    {532,none,1,0}, {533,none,1,0}, {534,none,1,0}, {535,100,0,1}, {535,none,1,0}, {536,none,1,0}, {537,none,1,0}, {538,101,0,1},
+    {538,none,1,0}, {539,none,1,0}, {540,none,1,0}, {541,none,1,0}, {542,none,1,0}, {543,none,1,0}, {544,none,1,0}, {545,none,1,0},
+    {546,none,1,0}, {547,none,1,0}, {548,none,1,0}, {549,none,1,0}, {550,102,0,1}, {550,none,2,0}, {552,none,1,0}, {553,103,0,1},
+    {553,none,1,0}, {554,none,1,0}, {555,none,1,0}, {556,none,1,0}, {557,none,1,0}, {558,none,1,0}, {559,104,0,1}, {559,none,1,0},
+    {560,none,1,0}, {561,none,1,0}, {562,none,1,0}, {563,none,1,0}, {564,none,1,0}, {565,none,1,0}, {566,none,1,0}, {567,none,1,0},
+    {568,none,1,0}, {569,none,1,0}, {570,none,1,0}, {571,none,1,0}, {572,none,1,0}, {573,none,1,0}, {574,none,1,0}, {575,none,1,0},
+    {576,none,1,0}, {577,none,1,0}, {578,none,1,0}, {579,none,1,0}, {580,none,1,0}, {581,none,1,0}, {582,none,1,0}, {583,none,1,0},
+    {584,none,1,0}, {585,none,1,0}, {586,none,1,0}, {587,none,1,0}, {588,105,0,1}, {588,none,1,0}, {589,none,1,0}, {590,none,1,0},
+    {591,none,1,0}, {592,106,0,1}, {592,none,1,0}, {593,none,1,0}, {594,none,1,0}, {595,107,0,2}, {595,none,1,0}, {596,none,2,0},
+    {598,109,0,1}, {598,none,1,0}, {599,none,1,0}, {600,none,1,0}, {601,110,0,1}, {601,none,11,0}, {612,none,2,0}, {614,83,0,1},
+    {614,none,1,0}, {615,none,1,0}, {616,none,1,0}, {617,none,1,0}, {618,none,1,0}, {619,none,1,0}, {620,111,0,1}, {620,none,1,0},
+    {621,none,1,0}, {622,none,1,0}, {623,112,0,1}, {623,none,1,0}, {624,none,1,0}, {625,none,1,0}, {626,113,0,1}, {626,none,1,0},
+    {627,none,1,0}, {628,none,1,0}, {629,114,0,1}, {629,none,3,0}, {632,none,1,0}, {633,none,1,0}, {634,none,1,0}, {635,none,1,0},
+    {636,115,0,1}, {636,none,1,0}, {637,none,1,0}, {638,116,0,1}, {638,none,1,0}, {639,none,1,0}, {640,none,1,0}, {641,117,0,1},
+    {641,none,2,0}, {643,none,1,0}, {644,none,1,0}, {645,none,1,0}, {646,none,1,0}, {647,118,0,1}, {647,none,1,0}, {648,119,0,1},
+    {648,none,1,0}, {649,none,2,0}, {651,120,0,1}, {651,none,1,0}, {652,none,1,0}, {653,121,0,1}, {653,none,1,0}, {654,none,1,0},
+    {655,122,0,2}, {655,none,2,0}, {657,none,2,0}, {659,none,1,0}, {660,none,1,0}, {661,none,1,0}, {662,none,1,0}, {663,none,1,0},
+    {664,none,1,0}, {665,none,1,0}, {666,none,4,0}, {670,none,1,0}, {671,none,1,0}, {672,none,1,0}, {673,none,1,0}, {674,none,1,0},
+    {675,3,0,1}, {675,none,1,0}, {676,none,2,0}, {678,none,1,0}, {679,8,0,1}, {679,none,1,0}, {680,none,1,0}, {681,none,1,0},
+    {682,none,1,0}, {683,none,1,0}, {684,none,1,0}, {685,none,1,0}, {686,none,1,0}, {687,none,1,0}, {688,124,0,1}, {688,none,1,0},
+    {689,none,1,0}, {690,none,1,0}, {691,none,1,0}, {692,none,1,0}, {693,20,0,1}, {693,none,1,0}, {694,none,1,0}, {695,none,1,0},
+    {696,none,1,0}, {697,none,1,0}, {698,29,0,1}, {698,none,1,0}, {699,none,1,0}, {700,none,1,0}, {701,none,1,0}, {702,125,0,1},
+    {702,none,1,0}, {703,none,1,0}, {704,none,1,0}, {705,none,1,0}, {706,none,1,0}, {707,none,1,0}, {708,none,1,0}, {709,none,1,0},
+    {710,none,1,0}, {711,none,1,0}, {712,none,1,0}, {713,126,0,1}, {713,none,4,0}, {717,none,1,0}, {718,none,1,0}, {719,127,0,2},
+    {719,none,3,0}, {722,2,0,1}, {722,none,1,0}, {723,none,1,0}, {724,none,1,0}, {725,129,0,1}, {725,none,1,0}, {726,none,1,0},
+    {727,none,1,0}, {728,none,1,0}, {729,none,1,0}, {730,130,0,1}, {730,none,1,0}, {731,none,1,0}, {732,none,1,0}, {733,none,6,0},
+    {739,none,1,0}, {740,none,1,0}, {741,none,1,0}, {742,none,1,0}, {743,none,1,0}, {744,none,1,0}, {745,none,1,0}, {746,none,1,0},
+    {747,none,1,0}, {748,none,1,0}, {749,none,1,0}, {750,none,1,0}, {751,none,1,0}, {752,none,1,0}, {753,none,1,0}, {754,101,0,1},
+    {754,none,1,0}, {755,none,2,0}, {757,none,1,0}, {758,2,0,1}, {758,none,1,0}, {759,none,1,0}, {760,none,1,0}, {761,none,1,0},
+    {762,none,1,0}, {763,none,1,0}, {764,none,1,0}, {765,131,0,1}, {765,none,2,0}, {767,none,1,0}, {768,none,1,0}, {769,none,3,0},
+    {772,none,1,0}, {773,none,1,0}, {774,none,1,0}, {775,none,1,0}, {776,none,1,0}, {777,132,0,1}, {777,none,1,0}, {778,none,1,0},
+    {779,none,1,0}, {780,none,1,0}, {781,none,1,0}, {782,none,1,0}, {783,none,1,0}, {784,none,1,0}, {785,none,1,0}, {786,none,1,0},
+    {787,133,0,1}, {787,none,1,0}, {788,none,1,0}, {789,none,1,0}, {790,117,0,1}, {790,none,1,0}, {791,none,1,0}, {792,none,2,0},
+    {794,none,1,0}, {795,none,1,0}, {796,none,1,0}, {797,none,2,0}, {799,none,1,0}, {800,none,1,0}, {801,none,1,0}, {802,none,1,0},
+    {803,none,1,0}, {804,134,0,1}, {804,none,1,0}, {805,none,1,0}, {806,none,1,0}, {807,none,1,0}, {808,none,1,0}, {809,none,1,0},
+    {810,none,1,0}, {811,none,1,0}, {812,none,1,0}, {813,none,1,0}, {814,135,0,1}, {814,none,1,0}, {815,none,1,0}, {816,none,1,0},
+    {817,none,1,0}, {818,none,1,0}, {819,none,1,0}, {820,none,1,0}, {821,none,1,0}, {822,none,1,0}, {823,none,1,0}, {824,136,0,1},
+    {824,none,1,0}, {825,none,1,0}, {826,none,1,0}, {827,none,1,0}, {828,none,2,0}, {830,none,1,0}, {831,none,1,0}, {832,none,1,0},
+    {833,none,1,0}, {834,none,1,0}, {835,137,0,1}, {835,none,1,0}, {836,none,1,0}, {837,none,1,0}, {838,138,0,1}, {838,none,1,0},
+    {839,none,2,0}, {841,none,1,0}, {842,none,1,0}, {843,none,1,0}, {844,none,1,0}, {845,none,1,0}, {846,139,0,1}, {846,none,1,0},
+    {847,none,1,0}, {848,none,1,0}, {849,none,1,0}, {850,none,1,0}, {851,none,1,0}, {852,none,1,0}, {853,none,1,0}, {854,none,1,0},
+    {855,140,0,1}, {855,none,1,0}, {856,none,1,0}, {857,none,1,0}, {858,none,1,0}, {859,none,1,0}, {860,none,1,0}, {861,none,1,0},
+    {862,none,1,0}, {863,none,1,0}, {864,none,1,0}, {865,none,1,0}, {866,141,0,1}, {866,none,1,0}, {867,none,6,0}, {873,none,1,0},
+    {874,none,1,0}, {875,none,1,0}, {876,none,1,0}, {877,none,3,0}, {880,15,0,1}, {880,none,1,0}, {881,none,1,0}, {882,none,1,0},
+    {883,142,0,1}, {883,none,1,0}, {884,none,1,0}, {885,none,1,0}, {886,none,1,0}, {887,none,1,0}, {888,none,1,0}, {889,none,1,0},
+    {890,143,0,1}, {890,none,1,0}, {891,none,1,0}, {892,none,1,0}, {893,none,1,0}, {894,none,1,0}, {895,144,0,1}, {895,none,1,0},
+    {896,none,1,0}, {897,none,1,0}, {898,none,3,0}, {901,none,1,0}, {902,none,1,0}, {903,none,1,0}, {904,none,1,0}, {905,none,1,0},
+    {906,none,1,0}, {907,none,1,0}, {908,none,1,0}, {909,none,1,0}, {910,none,1,0}, {911,none,1,0}, {912,145,0,1}, {912,none,1,0},
+    {913,none,1,0}, {914,none,1,0}, {915,none,1,0}, {916,none,1,0}, {917,none,1,0}, {918,none,1,0}, {919,none,1,0}, {920,none,1,0},
+    {921,146,0,1}, {921,none,1,0}, {922,none,1,0}, {923,none,1,0}, {924,none,1,0}, {925,none,1,0}, {926,none,2,0}, {928,147,0,1},
+    {928,none,1,0}, {929,none,1,0}, {930,none,1,0}, {931,148,0,1}, {931,none,1,0}, {932,none,1,0}, {933,none,1,0}, {934,none,1,0},
+    {935,none,2,0}, {937,none,1,0}, {938,none,1,0}, {939,none,1,0}, {940,none,1,0}, {941,none,1,0}, {942,none,1,0}, {943,none,1,0},
+    {944,none,1,0}, {945,none,1,0}, {946,149,0,1}, {946,none,1,0}, {947,none,1,0}, {948,none,1,0}, {949,none,1,0}, {950,none,1,0},
+    {951,none,2,0}, {953,150,0,1}, {953,none,1,0}, {954,none,1,0}, {955,none,1,0}, {956,151,0,1}, {956,none,1,0}, {957,none,1,0},
+    {958,none,2,0}, {960,152,0,1}, {960,none,1,0}, {961,none,1,0}, {962,none,1,0}, {963,none,1,0}, {964,none,1,0}, {965,153,0,1},
+    {965,none,1,0}, {966,none,1,0}, {967,none,1,0}, {968,none,1,0}, {969,none,1,0}, {970,131,0,1}, {970,none,2,0}, {972,none,1,0},
+    {973,none,1,0}, {974,154,0,2}, {974,none,1,0}, {975,none,1,0}, {976,none,1,0}, {977,none,1,0}, {978,156,0,1}, {978,none,16,0},
+    {994,none,1,0}, {995,none,1,0}, {996,157,0,1}, {996,none,1,0}, {997,none,1,0}, {998,158,0,1}, {998,none,1,0}, {999,none,1,0},
+    {1000,none,1,0}, {1001,none,1,0}, {1002,none,1,0}, {1003,159,0,1}, {1003,none,3,0}, {1006,none,1,0}, {1007,none,1,0},
+    {1008,none,1,0}, {1009,none,1,0}, {1010,160,0,1}, {1010,none,1,0}, {1011,none,1,0}, {1012,none,1,0}, {1013,161,0,1},
+    {1013,none,1,0}, {1014,162,0,1}, {1014,none,1,0}, {1015,none,1,0}, {1016,none,1,0}, {1017,163,0,1}, {1017,none,1,0},
+    {1018,none,1,0}, {1019,164,0,2}, {1019,none,1,0}, {1020,none,1,0}, {1021,none,1,0}, {1022,none,1,0}, {1023,none,1,0},
+    {1024,166,0,1}, {1024,none,1,0}, {1025,none,1,0}, {1026,none,1,0}, {1027,none,1,0}, {1028,none,1,0}, {1029,none,1,0},
+    {1030,167,0,1}, {1030,none,2,0}, {1032,none,1,0}, {1033,none,1,0}, {1034,none,1,0}, {1035,168,0,1}, {1035,none,1,0},
+    {1036,none,1,0}, {1037,none,2,0}, {1039,none,1,0}, {1040,none,1,0}, {1041,none,1,0}, {1042,none,1,0}, {1043,none,1,0},
+    {1044,none,1,0}, {1045,none,1,0}, {1046,none,1,0}, {1047,none,1,0}, {1048,none,1,0}, {1049,none,1,0}, {1050,169,0,1},
+    {1050,none,1,0}, {1051,none,1,0}, {1052,none,1,0}, {1053,none,1,0}, {1054,none,1,0}, {1055,none,1,0}, {1056,none,1,0},
+    {1057,none,1,0}, {1058,none,1,0}, {1059,none,1,0}, {1060,none,1,0}, {1061,none,1,0}, {1062,none,1,0}, {1063,none,1,0},
+    {1064,none,1,0}, {1065,170,0,1}, {1065,none,2,0}, {1067,none,1,0}, {1068,none,1,0}, {1069,none,1,0}, {1070,171,0,1},
+    {1070,none,1,0}, {1071,none,1,0}, {1072,172,0,2}, {1072,none,1,0}, {1073,none,1,0}, {1074,none,1,0}, {1075,none,1,0},
+    {1076,none,1,0}, {1077,none,1,0}, {1078,174,0,1}, {1078,none,1,0}, {1079,none,2,0}, {1081,none,1,0}, {1082,none,2,0},
+    {1084,175,0,1}, {1084,none,1,0}, {1085,none,1,0}, {1086,none,1,0}, {1087,none,1,0}, {1088,none,1,0}, {1089,176,0,1},
+    {1089,none,1,0}, {1090,none,1,0}, {1091,none,1,0}, {1092,none,1,0}, {1093,none,1,0}, {1094,none,1,0}, {1095,none,1,0},
+    {1096,none,1,0}, {1097,177,0,1}, {1097,none,2,0}, {1099,none,1,0}, {1100,none,1,0}, {1101,178,0,1}, {1101,none,1,0},
+    {1102,none,1,0}, {1103,179,0,1}, {1103,none,1,0}, {1104,none,1,0}, {1105,180,0,1}, {1105,none,1,0}, {1106,none,1,0},
+    {1107,none,1,0}, {1108,181,0,1}, {1108,none,2,0}, {1110,none,1,0}, {1111,none,1,0}, {1112,none,1,0}, {1113,none,1,0},
+    {1114,182,0,1}, {1114,none,1,0}, {1115,none,1,0}, {1116,none,1,0}, {1117,none,1,0}, {1118,none,1,0}, {1119,none,1,0},
+    {1120,none,1,0}, {1121,none,1,0}, {1122,none,1,0}, {1123,none,1,0}, {1124,183,0,1}, {1124,none,5,0}, {1129,none,1,0},
+    {1130,none,1,0}, {1131,184,0,1}, {1131,none,1,0}, {1132,none,1,0}, {1133,185,0,2}, {1133,none,1,0}, {1134,none,1,0},
+    {1135,none,1,0}, {1136,none,1,0}, {1137,none,2,0}, {1139,none,1,0}, {1140,none,1,0}, {1141,none,1,0}, {1142,none,1,0},
+    {1143,none,1,0}, {1144,none,1,0}, {1145,none,1,0}, {1146,none,1,0}, {1147,none,1,0}, {1148,none,1,0}, {1149,none,1,0},
+    {1150,187,0,1}, {1150,none,1,0}, {1151,none,1,0}, {1152,none,1,0}, {1153,none,1,0}, {1154,none,1,0}, {1155,none,1,0},
+    {1156,none,1,0}, {1157,none,1,0}, {1158,none,1,0}, {1159,none,1,0}, {1160,none,1,0}, {1161,none,1,0}, {1162,none,1,0},
+    {1163,none,1,0}, {1164,none,1,0}, {1165,188,0,1}, {1165,none,3,0}, {1168,none,1,0}, {1169,none,1,0}, {1170,189,0,2},
+    {1170,none,1,0}, {1171,none,1,0}, {1172,none,1,0}, {1173,none,1,0}, {1174,191,0,1}, {1174,none,1,0}, {1175,none,1,0},
+    {1176,none,1,0}, {1177,none,1,0}, {1178,none,1,0}, {1179,none,1,0}, {1180,none,1,0}, {1181,none,1,0}, {1182,192,0,1},
+    {1182,none,1,0}, {1183,none,1,0}, {1184,none,1,0}, {1185,192,0,1}, {1185,none,12,0}, {1197,none,1,0}, {1198,none,1,0},
+    {1199,none,1,0}, {1200,193,0,1}, {1200,none,1,0}, {1201,194,0,1}, {1201,none,1,0}, {1202,none,1,0}, {1203,none,1,0},
+    {1204,none,2,0}, {1206,195,0,1}, {1206,none,1,0}, {1207,196,0,1}, {1207,none,1,0}, {1208,none,1,0}, {1209,none,1,0},
+    {1210,none,1,0}, {1211,none,1,0}, {1212,197,0,1}, {1212,none,3,0}, {1215,none,1,0}, {1216,none,1,0}, {1217,none,1,0},
+    {1218,none,1,0}, {1219,198,0,1}, {1219,none,1,0}, {1220,none,1,0}, {1221,none,1,0}, {1222,199,0,1}, {1222,none,1,0},
+    {1223,200,0,1}, {1223,none,1,0}, {1224,none,1,0}, {1225,none,1,0}, {1226,201,0,1}, {1226,none,1,0}, {1227,none,1,0},
+    {1228,202,0,2}, {1228,none,1,0}, {1229,204,0,1}, {1229,none,1,0}, {1230,none,1,0}, {1231,none,1,0}, {1232,205,0,2},
+    {1232,none,1,0}, {1233,none,1,0}, {1234,none,1,0}, {1235,none,1,0}, {1236,none,1,0}, {1237,none,6,0}, {1243,none,1,0},
+    {1244,none,1,0}, {1245,none,1,0}, {1246,none,1,0}, {1247,none,2,0}, {1249,207,0,1}, {1249,none,1,0}, {1250,none,1,0},
+    {1251,none,1,0}, {1252,none,1,0}, {1253,208,0,1}, {1253,none,1,0}, {1254,none,1,0}, {1255,none,1,0}, {1256,none,1,0},
+    {1257,none,1,0}, {1258,none,1,0}, {1259,none,1,0}, {1260,none,1,0}, {1261,none,1,0}, {1262,209,0,1}, {1262,none,1,0},
+    {1263,none,1,0}, {1264,none,1,0}, {1265,none,1,0}, {1266,none,1,0}, {1267,none,1,0}, {1268,none,1,0}, {1269,210,0,1},
+    {1269,none,1,0}, {1270,none,1,0}, {1271,none,1,0}, {1272,none,1,0}, {1273,211,0,1}, {1273,none,1,0}, {1274,none,1,0},
+    {1275,none,1,0}, {1276,none,1,0}, {1277,none,1,0}, {1278,none,1,0}, {1279,none,1,0}, {1280,none,1,0}, {1281,none,1,0},
+    {1282,none,1,0}, {1283,212,0,1}, {1283,none,1,0}, {1284,none,1,0}, {1285,none,1,0}, {1286,none,1,0}, {1287,none,1,0},
+    {1288,213,0,1}, {1288,none,1,0}, {1289,none,1,0}, {1290,none,1,0}, {1291,214,0,2}, {1291,none,1,0}, {1292,216,0,1},
+    {1292,none,8,0}, {1300,none,1,0}, {1301,none,1,0}, {1302,none,1,0}, {1303,none,1,0}, {1304,none,1,0}, {1305,217,0,1},
+    {1305,none,2,0}, {1307,none,1,0}, {1308,none,1,0}, {1309,none,1,0}, {1310,14,0,1}, {1310,none,1,0}, {1311,218,0,1},
+    {1311,none,1,0}, {1312,none,1,0}, {1313,none,1,0}, {1314,none,1,0}, {1315,219,0,1}, {1315,none,1,0}, {1316,none,1,0},
+    {1317,220,0,1}, {1317,none,1,0}, {1318,none,1,0}, {1319,none,1,0}, {1320,none,1,0}, {1321,none,1,0}, {1322,none,1,0},
+    {1323,none,1,0}, {1324,none,1,0}, {1325,none,1,0}, {1326,none,1,0}, {1327,none,1,0}, {1328,221,0,1}, {1328,none,2,0},
+    {1330,none,1,0}, {1331,none,1,0}, {1332,222,0,1}, {1332,none,1,0}, {1333,none,1,0}, {1334,none,1,0}, {1335,none,1,0},
+    {1336,none,1,0}, {1337,none,1,0}, {1338,none,1,0}, {1339,none,1,0}, {1340,none,1,0}, {1341,none,1,0}, {1342,none,1,0},
+    {1343,none,1,0}, {1344,223,0,1}, {1344,none,2,0}, {1346,none,1,0}, {1347,none,1,0}, {1348,221,0,1}, {1348,none,1,0},
+    {1349,none,1,0}, {1350,none,1,0}, {1351,none,1,0}, {1352,224,0,1}, {1352,none,1,0}, {1353,none,1,0}, {1354,none,2,0},
+    {1356,none,1,0}, {1357,none,1,0}, {1358,none,1,0}, {1359,none,1,0}, {1360,none,1,0}, {1361,none,1,0}, {1362,none,1,0},
+    {1363,none,1,0}, {1364,78,0,1}, {1364,none,1,0}, {1365,none,1,0}, {1366,none,1,0}, {1367,none,1,0}, {1368,none,1,0},
+    {1369,225,0,1}, {1369,none,14,0}, {1383,none,1,0}, {1384,none,1,0}, {1385,none,1,0}, {1386,226,0,1}, {1386,none,1,0},
+    {1387,none,1,0}, {1388,none,1,0}, {1389,none,1,0}, {1390,227,0,1}, {1390,none,1,0}, {1391,none,1,0}, {1392,none,1,0},
+    {1393,228,0,1}, {1393,none,1,0}, {1394,none,1,0}, {1395,none,1,0}, {1396,none,1,0}, {1397,none,1,0}, {1398,229,0,1},
+    {1398,none,2,0}, {1400,none,1,0}, {1401,none,1,0}, {1402,none,1,0}, {1403,230,0,1}, {1403,none,1,0}, {1404,231,0,1},
+    {1404,none,1,0}, {1405,none,1,0}, {1406,none,1,0}, {1407,232,0,1}, {1407,none,1,0}, {1408,none,1,0}, {1409,233,0,1},
+    {1409,none,1,0}, {1410,none,1,0}, {1411,none,1,0}, {1412,none,1,0}, {1413,none,1,0}, {1414,234,0,1}, {1414,none,3,0},
+    {1417,233,0,1}, {1417,none,2,0}, {1419,none,1,0}, {1420,none,1,0}, {1421,235,0,1}, {1421,none,1,0}, {1422,none,1,0},
+    {1423,none,1,0}, {1424,none,1,0}, {1425,none,1,0}, {1426,none,1,0}, {1427,none,1,0}, {1428,236,0,1}, {1428,none,1,0},
+    {1429,none,1,0}, {1430,none,1,0}, {1431,none,1,0}, {1432,none,1,0}, {1433,137,0,1}, {1433,none,2,0}, {1435,none,2,0},
+    {1437,237,0,1}, {1437,none,2,0}, {1439,none,1,0}, {1440,none,1,0}, {1441,none,1,0}, {1442,none,1,0}, {1443,238,0,1},
+    {1443,none,1,0}, {1444,none,1,0}, {1445,none,1,0}, {1446,none,1,0}, {1447,none,1,0}, {1448,none,1,0}, {1449,none,1,0},
+    {1450,none,1,0}, {1451,239,0,1}, {1451,none,1,0}, {1452,none,1,0}, {1453,none,1,0}, {1454,none,1,0}, {1455,none,1,0},
+    {1456,none,1,0}, {1457,none,2,0}, {1459,none,1,0}, {1460,none,1,0}, {1461,none,1,0}, {1462,none,1,0}, {1463,none,1,0},
+    {1464,240,0,1}, {1464,none,1,0}, {1465,none,1,0}, {1466,none,1,0}, {1467,none,1,0}, {1468,none,1,0}, {1469,241,0,1},
+    {1469,none,3,0}, {1472,none,1,0}, {1473,none,1,0}, {1474,none,1,0}, {1475,242,0,1}, {1475,none,1,0}, {1476,none,1,0},
+    {1477,243,0,2}, {1477,none,1,0}, {1478,none,1,0}, {1479,245,0,1}, {1479,none,1,0}, {1480,none,1,0}, {1481,none,1,0},
+    {1482,246,0,1}, {1482,none,1,0}, {1483,none,1,0}, {1484,none,1,0}, {1485,none,1,0}, {1486,none,1,0}, {1487,247,0,1},
+    {1487,none,2,0}, {1489,none,1,0}, {1490,none,1,0}, {1491,none,1,0}, {1492,248,0,1}, {1492,none,1,0}, {1493,none,1,0},
+    {1494,249,0,1}, {1494,none,5,0}, {1499,none,2,0}, {1501,none,1,0}, {1502,none,1,0}, {1503,none,1,0}, {1504,250,0,1},
+    {1504,none,1,0}, {1505,251,0,1}, {1505,none,1,0}, {1506,none,1,0}, {1507,252,0,2}, {1507,none,1,0}, {1508,none,1,0},
+    {1509,none,1,0}, {1510,254,0,2}, {1510,none,2,0}, {1512,none,1,0}, {1513,none,1,0}, {1514,256,0,2}, {1514,none,1,0},
+    {1515,none,1,0}, {1516,none,1,0}, {1517,none,1,0}, {1518,258,0,1}, {1518,none,1,0}, {1519,none,1,0}, {1520,none,1,0},
+    {1521,none,1,0}, {1522,259,0,1}, {1522,none,7,0}, {1529,none,1,0}, {1530,none,1,0}, {1531,none,1,0}, {1532,260,0,1},
+    {1532,none,1,0}, {1533,none,1,0}, {1534,none,1,0}, {1535,261,0,1}, {1535,none,1,0}, {1536,none,1,0}, {1537,none,1,0},
+    {1538,none,1,0}, {1539,262,0,1}, {1539,none,2,0}, {1541,none,1,0}, {1542,none,1,0}, {1543,none,1,0}, {1544,none,1,0},
+    {1545,263,0,1}, {1545,none,1,0}, {1546,264,0,1}, {1546,none,1,0}, {1547,none,1,0}, {1548,265,0,2}, {1548,none,1,0},
+    {1549,none,1,0}, {1550,none,1,0}, {1551,267,0,2}, {1551,none,1,0}, {1552,none,1,0}, {1553,none,1,0}, {1554,269,0,2},
+    {1554,none,11,0}, {1565,none,1,0}, {1566,none,1,0}, {1567,none,1,0}, {1568,271,0,1}, {1568,none,1,0}, {1569,272,0,1},
+    {1569,none,5,0}, {1574,none,1,0}, {1575,none,1,0}, {1576,none,1,0}, {1577,none,1,0}, {1578,273,0,1}, {1578,none,1,0},
+    {1579,none,1,0}, {1580,none,1,0}, {1581,none,1,0}, {1582,274,0,1}, {1582,none,1,0}, {1583,none,1,0}, {1584,275,0,1},
+    {1584,none,1,0}, {1585,none,1,0}, {1586,none,1,0}, {1587,none,1,0}, {1588,none,1,0}, {1589,none,1,0}, {1590,none,1,0},
+    {1591,none,1,0}, {1592,276,0,1}, {1592,none,1,0}, {1593,none,1,0}, {1594,277,0,1}, {1594,none,3,0}, {1597,none,1,0},
+    {1598,none,1,0}, {1599,none,1,0}, {1600,none,1,0}, {1601,278,0,1}, {1601,none,1,0}, {1602,none,1,0}, {1603,none,1,0},
+    {1604,none,1,0}, {1605,279,0,1}, {1605,none,1,0}, {1606,280,0,1}, {1606,none,2,0}, {1608,none,1,0}, {1609,none,10,0},
+    {1619,none,2,0}, {1621,none,1,0}, {1622,none,1,0}, {1623,none,1,0}, {1624,none,1,0}, {1625,none,1,0}, {1626,none,1,0},
+    {1627,none,1,0}, {1628,none,1,0}, {1629,none,1,0}, {1630,none,1,0}, {1631,none,1,0}, {1632,281,0,1}, {1632,none,1,0},
+    {1633,none,1,0}, {1634,none,1,0}, {1635,none,3,0}, {1638,16,0,1}, {1638,none,1,0}, {1639,none,1,0}, {1640,none,1,0},
+    {1641,282,0,1}, {1641,none,1,0}, {1642,none,1,0}, {1643,none,1,0}, {1644,none,1,0}, {1645,none,1,0}, {1646,none,1,0},
+    {1647,none,1,0}, {1648,none,1,0}, {1649,none,1,0}, {1650,none,1,0}, {1651,283,0,1}, {1651,none,1,0}, {1652,none,1,0},
+    {1653,none,1,0}, {1654,none,1,0}, {1655,none,1,0}, {1656,none,1,0}, {1657,none,1,0}, {1658,284,0,1}, {1658,none,1,0},
+    {1659,none,2,0}, {1661,none,1,0}, {1662,none,1,0}, {1663,none,1,0}, {1664,none,1,0}, {1665,none,1,0}, {1666,none,1,0},
+    {1667,none,1,0}, {1668,none,1,0}, {1669,none,1,0}, {1670,none,1,0}, {1671,none,1,0}, {1672,285,0,1}, {1672,none,1,0},
+    {1673,none,2,0}, {1675,none,1,0}, {1676,none,1,0}, {1677,none,1,0}, {1678,none,1,0}, {1679,none,1,0}, {1680,none,1,0},
+    {1681,none,1,0}, {1682,none,1,0}, {1683,none,1,0}, {1684,286,0,1}, {1684,none,1,0}, {1685,none,1,0}, {1686,none,1,0},
+    {1687,none,1,0}, {1688,none,1,0}, {1689,none,2,0}, {1691,287,0,1}, {1691,none,1,0}, {1692,none,1,0}, {1693,none,1,0},
+    {1694,288,0,1}, {1694,none,1,0}, {1695,none,1,0}, {1696,none,1,0}, {1697,none,1,0}, {1698,none,1,0}, {1699,289,0,1},
+    {1699,none,1,0}, {1700,none,1,0}, {1701,none,1,0}, {1702,none,1,0}, {1703,none,2,0}, {1705,none,1,0}, {1706,none,1,0},
+    {1707,none,1,0}, {1708,none,1,0}, {1709,none,1,0}, {1710,290,0,1}, {1710,none,1,0}, {1711,none,1,0}, {1712,none,1,0},
+    {1713,none,1,0}, {1714,none,1,0}, {1715,none,1,0}, {1716,291,0,1}, {1716,none,2,0}, {1718,none,1,0}, {1719,none,3,0},
+    {1722,292,0,1}, {1722,none,1,0}, {1723,none,1,0}, {1724,none,1,0}, {1725,none,1,0}, {1726,none,1,0}, {1727,293,0,1},
+    {1727,none,1,0}, {1728,none,1,0}, {1729,none,1,0}, {1730,none,1,0}, {1731,none,1,0}, {1732,none,1,0}, {1733,294,0,1},
+    {1733,none,1,0}, {1734,none,1,0}, {1735,none,1,0}, {1736,none,1,0}, {1737,none,1,0}, {1738,none,1,0}, {1739,none,3,0},
+    {1742,295,0,1}, {1742,none,1,0}, {1743,none,1,0}, {1744,none,1,0}, {1745,296,0,1}, {1745,none,1,0}, {1746,none,1,0},
+    {1747,none,1,0}, {1748,none,1,0}, {1749,none,1,0}, {1750,297,0,1}, {1750,none,1,0}, {1751,none,3,0}, {1754,none,1,0},
+    {1755,none,1,0}, {1756,none,1,0}, {1757,none,1,0}, {1758,none,1,0}, {1759,none,1,0}, {1760,none,1,0}, {1761,none,1,0},
+    {1762,none,1,0}, {1763,none,1,0}, {1764,298,0,1}, {1764,none,1,0}, {1765,none,1,0}, {1766,none,1,0}, {1767,none,1,0},
+    {1768,none,1,0}, {1769,none,1,0}, {1770,none,1,0}, {1771,none,1,0}, {1772,none,1,0}, {1773,299,0,1}, {1773,none,1,0},
+    {1774,none,1,0}, {1775,none,1,0}, {1776,none,1,0}, {1777,none,1,0}, {1778,none,2,0}, {1780,300,0,1}, {1780,none,1,0},
+    {1781,none,1,0}, {1782,none,1,0}, {1783,301,0,1}, {1783,none,1,0}, {1784,none,1,0}, {1785,none,1,0}, {1786,none,1,0},
+    {1787,none,1,0}, {1788,none,2,0}, {1790,302,0,1}, {1790,none,1,0}, {1791,none,1,0}, {1792,none,1,0}, {1793,303,0,1},
+    {1793,none,1,0}, {1794,none,1,0}, {1795,none,1,0}, {1796,none,1,0}, {1797,none,1,0}, {1798,132,0,1}, {1798,none,1,0},
+    {1799,none,1,0}, {1800,none,1,0}, {1801,none,1,0}, {1802,none,1,0}, {1803,none,1,0}, {1804,none,1,0}, {1805,none,1,0},
+    {1806,none,1,0}, {1807,none,1,0}, {1808,133,0,1}, {1808,none,1,0}, {1809,none,6,0}, {1815,none,1,0}, {1816,none,1,0},
+    {1817,none,1,0}, {1818,none,1,0}, {1819,none,1,0}, {1820,none,1,0}, {1821,none,1,0}, {1822,none,1,0}, {1823,none,1,0},
+    {1824,none,1,0}, {1825,none,1,0}, {1826,none,1,0}, {1827,304,0,1}, {1827,none,1,0}, {1828,none,1,0}, {1829,none,1,0},
+    {1830,none,1,0}, {1831,none,1,0}, {1832,none,1,0}, {1833,none,1,0}, {1834,none,1,0}, {1835,none,1,0}, {1836,305,0,1},
+    {1836,none,1,0}, {1837,none,1,0}, {1838,none,1,0}, {1839,none,1,0}, {1840,none,1,0}, {1841,none,1,0}, {1842,none,1,0},
+    {1843,306,0,1}, {1843,none,1,0}, {1844,none,1,0}, {1845,none,1,0}, {1846,none,1,0}, {1847,307,0,1}, {1847,none,1,0},
+    {1848,none,1,0}, {1849,none,1,0}, {1850,none,1,0}, {1851,none,1,0}, {1852,none,1,0}, {1853,none,1,0}, {1854,none,1,0},
+    {1855,none,1,0}, {1856,none,1,0}, {1857,308,0,1}, {1857,none,1,0}, {1858,none,1,0}, {1859,none,1,0}, {1860,none,1,0},
+    {1861,none,1,0}, {1862,309,0,1}, {1862,none,1,0}, {1863,none,1,0}, {1864,310,0,2}, {1864,none,2,0}, {1866,312,0,1},
+    {1866,none,1,0}, {1867,none,1,0}, {1868,none,1,0}, {1869,none,1,0}, {1870,none,1,0}, {1871,none,1,0}, {1872,none,1,0},
+    {1873,none,1,0}, {1874,313,0,1}, {1874,none,1,0}, {1875,none,1,0}, {1876,none,1,0}, {1877,none,1,0}, {1878,none,1,0},
+    {1879,314,0,1}, {1879,none,3,0}, {1882,none,1,0}, {1883,none,4,0}, {1887,none,1,0}, {1888,none,1,0}, {1889,none,1,0},
+    {1890,none,2,0}, {1892,none,1,0}, {1893,none,1,0}, {1894,none,1,0}, {1895,none,1,0}, {1896,none,1,0}, {1897,315,0,1},
+    {1897,none,1,0}, {1898,none,1,0}, {1899,none,1,0}, {1900,none,1,0}, {1901,none,1,0}, {1902,none,1,0}, {1903,none,1,0},
+    {1904,none,1,0}, {1905,none,1,0}, {1906,none,1,0}, {1907,316,0,1}, {1907,none,1,0}, {1908,none,1,0}, {1909,none,1,0},
+    {1910,none,1,0}, {1911,none,1,0}, {1912,none,1,0}, {1913,none,1,0}, {1914,none,1,0}, {1915,none,1,0}, {1916,none,1,0},
+    {1917,317,0,1}, {1917,none,1,0}, {1918,none,1,0}, {1919,none,1,0}, {1920,none,2,0}, {1922,none,1,0}, {1923,none,1,0},
+    {1924,none,1,0}, {1925,none,1,0}, {1926,none,1,0}, {1927,134,0,1}, {1927,none,1,0}, {1928,none,1,0}, {1929,none,1,0},
+    {1930,none,1,0}, {1931,none,1,0}, {1932,none,1,0}, {1933,none,1,0}, {1934,none,1,0}, {1935,none,1,0}, {1936,none,1,0},
+    {1937,135,0,1}, {1937,none,1,0}, {1938,none,1,0}, {1939,none,1,0}, {1940,none,1,0}, {1941,none,1,0}, {1942,none,1,0},
+    {1943,none,1,0}, {1944,none,1,0}, {1945,none,1,0}, {1946,none,1,0}, {1947,136,0,1}, {1947,none,1,0}, {1948,none,1,0},
+    {1949,318,0,2}, {1949,none,1,0}, {1950,none,1,0}, {1951,none,2,0}, {1953,none,1,0}, {1954,none,1,0}, {1955,none,1,0},
+    {1956,none,1,0}, {1957,none,1,0}, {1958,none,1,0}, {1959,none,1,0}, {1960,none,1,0}, {1961,none,1,0}, {1962,320,0,1},
+    {1962,none,1,0}, {1963,none,1,0}, {1964,none,1,0}, {1965,none,1,0}, {1966,none,1,0}, {1967,none,1,0}, {1968,none,1,0},
+    {1969,none,1,0}, {1970,none,1,0}, {1971,none,1,0}, {1972,321,0,1}, {1972,none,3,0}, {1975,none,1,0}, {1976,none,1,0},
+    {1977,276,0,1}, {1977,none,1,0}, {1978,322,0,1}, {1978,none,1,0}, {1979,none,1,0}, {1980,none,1,0}, {1981,none,1,0},
+    {1982,323,0,1}, {1982,none,1,0}, {1983,324,0,1}, {1983,none,8,0}, {1991,none,1,0}, {1992,none,1,0}, {1993,325,0,1},
+    {1993,none,1,0}, {1994,none,1,0}, {1995,326,0,1}, {1995,none,2,0}, {1997,none,1,0}, {1998,none,1,0}, {1999,none,1,0},
+    {2000,none,1,0}, {2001,none,1,0}, {2002,none,1,0}, {2003,none,1,0}, {2004,none,1,0}, {2005,none,1,0}, {2006,327,0,1},
+    {2006,none,1,0}, {2007,none,1,0}, {2008,none,1,0}, {2009,none,1,0}, {2010,none,1,0}, {2011,none,1,0}, {2012,none,1,0},
+    {2013,328,0,1}, {2013,none,1,0}, {2014,none,1,0}, {2015,329,0,2}, {2015,none,1,0}, {2016,none,1,0}, {2017,none,1,0},
+    {2018,none,1,0}, {2019,none,1,0}, {2020,none,1,0}, {2021,none,1,0}, {2022,none,1,0}, {2023,331,0,1}, {2023,none,1,0},
+    {2024,none,1,0}, {2025,none,1,0}, {2026,332,0,2}, {2026,none,1,0}, {2027,none,1,0}, {2028,none,1,0}, {2029,328,0,1},
+    {2029,none,1,0}, {2030,334,0,1}, {2030,none,9,0}, {2039,none,1,0}, {2040,none,1,0}, {2041,none,1,0}, {2042,335,0,1},
+    {2042,none,1,0}, {2043,none,1,0}, {2044,none,1,0}, {2045,none,1,0}, {2046,none,1,0}, {2047,336,0,1}, {2047,none,3,0},
+    {2050,none,1,0}, {2051,none,1,0}, {2052,none,1,0}, {2053,none,1,0}, {2054,337,0,1}, {2054,none,1,0}, {2055,none,1,0},
+    {2056,none,1,0}, {2057,none,1,0}, {2058,338,0,1}, {2058,none,1,0}, {2059,339,0,1}, {2059,none,3,0}, {2062,none,1,0},
+    {2063,none,1,0}, {2064,none,1,0}, {2065,none,1,0}, {2066,none,1,0}, {2067,none,3,0}, {2070,none,1,0}, {2071,none,1,0},
+    {2072,none,1,0}, {2073,none,1,0}, {2074,none,1,0}, {2075,none,1,0}, {2076,none,1,0}, {2077,none,1,0}, {2078,none,1,0},
+    {2079,none,1,0}, {2080,none,1,0}, {2081,28,0,1}, {2081,none,1,0}, {2082,none,1,0}, {2083,none,2,0}, {2085,none,1,0},
+    {2086,none,1,0}, {2087,none,1,0}, {2088,none,1,0}, {2089,none,1,0}, {2090,none,1,0}, {2091,none,1,0}, {2092,28,0,1},
+    {2092,none,1,0}, {2093,none,1,0}, {2094,none,1,0}, {2095,none,1,0}, {2096,none,1,0}, {2097,none,1,0}, {2098,28,0,1},
+    {2098,none,1,0}, {2099,none,1,0}, {2100,none,1,0}, {2101,none,1,0}, {2102,none,1,0}, {2103,none,1,0}, {2104,none,1,0},
+    {2105,none,1,0}, {2106,none,1,0}, {2107,none,1,0}, {2108,none,1,0}, {2109,none,1,0}, {2110,none,1,0}, {2111,28,0,1},
+    {2111,none,1,0}, {2112,none,1,0}, {2113,none,1,0}, {2114,none,2,0}, {2116,none,1,0}, {2117,none,1,0}, {2118,none,1,0},
+    {2119,none,1,0}, {2120,none,1,0}, {2121,none,1,0}, {2122,none,1,0}, {2123,none,1,0}, {2124,none,1,0}, {2125,none,1,0},
+    {2126,none,1,0}, {2127,none,1,0}, {2128,none,1,0}, {2129,none,1,0}, {2130,216,0,1}, {2130,none,1,0}, {2131,none,1,0},
+    {2132,none,1,0}, {2133,none,1,0}, {2134,none,1,0}, {2135,none,1,0}, {2136,none,1,0}, {2137,none,1,0}, {2138,324,0,1},
+    {2138,none,1,0}, {2139,none,1,0}, {2140,none,1,0}, {2141,none,1,0}, {2142,none,1,0}, {2143,340,0,1}, {2143,none,1,0},
+    {2144,none,1,0}, {2145,341,0,2}, {2145,none,4,0}, {2149,none,1,0}, {2150,none,1,0}, {2151,none,1,0}, {2152,none,1,0},
+    {2153,none,1,0}, {2154,343,0,1}, {2154,none,1,0}, {2155,none,1,0}, {2156,none,1,0}, {2157,none,1,0}, {2158,none,1,0},
+    {2159,none,1,0}, {2160,none,1,0}, {2161,none,1,0}, {2162,none,1,0}, {2163,none,1,0}, {2164,none,1,0}, {2165,none,1,0},
+    {2166,none,1,0}, {2167,none,1,0}, {2168,0,0,1}, {2168,none,1,0}, {2169,none,1,0}, {2170,344,0,1}, {2170,none,13,0},
+    {2183,345,0,1}, {2183,none,2,0}, {2185,none,1,0}, {2186,none,1,0}, {2187,none,1,0}, {2188,none,1,0}, {2189,none,1,0},
+    {2190,none,1,0}, {2191,none,1,0}, {2192,none,1,0}, {2193,346,0,1}, {2193,none,1,0}, {2194,none,1,0}, {2195,none,1,0},
+    {2196,none,1,0}, {2197,none,1,0}, {2198,347,0,1}, {2198,none,1,0}, {2199,none,1,0}, {2200,none,1,0}, {2201,none,1,0},
+    {2202,none,1,0}, {2203,none,1,0}, {2204,none,1,0}, {2205,none,1,0}, {2206,none,1,0}, {2207,none,1,0}, {2208,none,1,0},
+    {2209,none,1,0}, {2210,none,1,0}, {2211,none,1,0}, {2212,none,1,0}, {2213,none,1,0}, {2214,none,1,0}, {2215,348,0,1},
+    {2215,none,3,0}, {2218,none,1,0}, {2219,none,1,0}, {2220,none,1,0}, {2221,none,1,0}, {2222,none,1,0}, {2223,none,1,0},
+    {2224,349,0,1}, {2224,none,1,0}, {2225,none,1,0}, {2226,none,1,0}, {2227,none,2,0}, {2229,350,0,1}, {2229,none,1,0},
+    {2230,none,1,0}, {2231,none,1,0}, {2232,none,1,0}, {2233,none,1,0}, {2234,351,0,2}, {2234,none,1,0}, {2235,none,1,0},
+    {2236,none,1,0}, {2237,none,1,0}, {2238,none,1,0}, {2239,353,0,1}, {2239,none,1,0}, {2240,none,1,0}, {2241,none,1,0},
+    {2242,none,1,0}, {2243,none,1,0}, {2244,none,1,0}, {2245,none,7,0}, {2252,354,0,1}, {2252,none,1,0}, {2253,none,1,0},
+    {2254,none,1,0}, {2255,none,1,0}, {2256,none,1,0}, {2257,355,0,1}, {2257,none,1,0}, {2258,none,1,0}, {2259,none,1,0},
+    {2260,none,1,0}, {2261,none,1,0}, {2262,none,1,0}, {2263,none,1,0}, {2264,none,1,0}, {2265,none,1,0}, {2266,356,0,2},
+    {2266,none,1,0}, {2267,none,1,0}, {2268,none,1,0}, {2269,none,1,0}, {2270,none,1,0}, {2271,none,1,0}, {2272,none,1,0},
+    {2273,358,0,2}, {2273,none,1,0}, {2274,none,1,0}, {2275,none,1,0}, {2276,none,1,0}, {2277,360,0,1}, {2277,none,1,0},
+    {2278,none,1,0}, {2279,none,1,0}, {2280,none,1,0}, {2281,none,1,0}, {2282,none,1,0}, {2283,none,1,0}, {2284,none,1,0},
+    {2285,none,1,0}, {2286,none,1,0}, {2287,361,0,2}, {2287,none,1,0}, {2288,none,1,0}, {2289,none,1,0}, {2290,none,1,0},
+    {2291,none,1,0}, {2292,363,0,1}, {2292,none,1,0}, {2293,none,1,0}, {2294,none,1,0}, {2295,none,2,0}, {2297,none,1,0},
+    {2298,none,1,0}, {2299,none,1,0}, {2300,none,1,0}, {2301,none,1,0}, {2302,none,1,0}, {2303,none,1,0}, {2304,none,1,0},
+    {2305,364,0,2}, {2305,none,1,0}, {2306,none,1,0}, {2307,none,1,0}, {2308,none,1,0}, {2309,none,1,0}, {2310,366,0,2},
+    {2310,none,1,0}, {2311,none,2,0}, {2313,none,1,0}, {2314,none,1,0}, {2315,none,1,0}, {2316,none,1,0}, {2317,none,1,0},
+    {2318,none,1,0}, {2319,none,1,0}, {2320,none,1,0}, {2321,none,1,0}, {2322,none,3,0}, {2325,368,0,1}, {2325,none,1,0},
+    {2326,none,1,0}, {2327,none,1,0}, {2328,369,0,2}, {2328,none,1,0}, {2329,none,1,0}, {2330,none,1,0}, {2331,none,1,0},
+    {2332,none,1,0}, {2333,371,0,1}, {2333,none,1,0}, {2334,none,6,0}, {2340,372,0,1}, {2340,none,1,0}, {2341,none,1,0},
+    {2342,none,1,0}, {2343,none,1,0}, {2344,none,1,0}, {2345,373,0,1}, {2345,none,1,0}, {2346,none,1,0}, {2347,none,1,0},
+    {2348,none,1,0}, {2349,none,1,0}, {2350,none,1,0}, {2351,none,1,0}, {2352,374,0,1}, {2352,none,1,0}, {2353,none,1,0},
+    {2354,none,1,0}, {2355,none,1,0}, {2356,375,0,2}, {2356,none,1,0}, {2357,none,1,0}, {2358,none,1,0}, {2359,none,1,0},
+    {2360,none,1,0}, {2361,none,1,0}, {2362,none,1,0}, {2363,none,1,0}, {2364,none,1,0}, {2365,none,1,0}, {2366,377,0,2},
+    {2366,none,1,0}, {2367,none,1,0}, {2368,none,1,0}, {2369,none,1,0}, {2370,none,1,0}, {2371,379,0,1}, {2371,none,1,0},
+    {2372,none,1,0}, {2373,none,1,0}, {2374,none,1,0}, {2375,none,1,0}, {2376,none,2,0}, {2378,none,1,0}, {2379,none,1,0},
+    {2380,none,1,0}, {2381,none,1,0}, {2382,none,1,0}, {2383,none,1,0}, {2384,none,1,0}, {2385,none,1,0}, {2386,none,1,0},
+    {2387,none,1,0}, {2388,none,1,0}, {2389,none,1,0}, {2390,none,1,0}, {2391,none,1,0}, {2392,380,0,2}, {2392,none,1,0},
+    {2393,none,1,0}, {2394,none,1,0}, {2395,none,1,0}, {2396,none,1,0}, {2397,none,1,0}, {2398,none,1,0}, {2399,none,1,0},
+    {2400,382,0,2}, {2400,none,1,0}, {2401,none,1,0}, {2402,none,1,0}, {2403,none,1,0}, {2404,none,1,0}, {2405,none,1,0},
+    {2406,none,1,0}, {2407,none,3,0}, {2410,384,0,1}, {2410,none,1,0}, {2411,none,1,0}, {2412,none,1,0}, {2413,none,1,0},
+    {2414,none,1,0}, {2415,385,0,2}, {2415,none,1,0}, {2416,none,1,0}, {2417,none,1,0}, {2418,none,1,0}, {2419,none,1,0},
+    {2420,none,1,0}, {2421,none,1,0}, {2422,none,1,0}, {2423,none,1,0}, {2424,none,1,0}, {2425,387,0,1}, {2425,none,2,0},
+    {2427,none,1,0}, {2428,none,1,0}, {2429,none,1,0}, {2430,none,1,0}, {2431,none,1,0}, {2432,none,1,0}, {2433,none,1,0},
+    {2434,none,1,0}, {2435,none,1,0}, {2436,none,1,0}, {2437,none,1,0}, {2438,none,1,0}, {2439,none,1,0}, {2440,388,0,1},
+    {2440,none,1,0}, {2441,none,1,0}, {2442,none,1,0}, {2443,none,1,0}, {2444,none,1,0}, {2445,none,1,0}, {2446,none,1,0},
+    {2447,none,1,0}, {2448,none,1,0}, {2449,none,1,0}, {2450,none,1,0}, {2451,none,3,0}, {2454,389,0,1}, {2454,none,1,0},
+    {2455,none,1,0}, {2456,none,1,0}, {2457,390,0,2}, {2457,none,1,0}, {2458,none,1,0}, {2459,none,1,0}, {2460,none,1,0},
+    {2461,none,1,0}, {2462,392,0,1}, {2462,none,2,0}, {2464,none,1,0}, {2465,none,1,0}, {2466,none,1,0}, {2467,none,1,0},
+    {2468,none,1,0}, {2469,none,1,0}, {2470,none,2,0}, {2472,none,1,0}, {2473,none,1,0}, {2474,none,1,0}, {2475,none,2,0},
+    {2477,393,0,2}, {2477,none,1,0}, {2478,none,1,0}, {2479,none,1,0}, {2480,none,1,0}, {2481,none,1,0}, {2482,395,0,1},
+    {2482,none,1,0}, {2483,none,1,0}, {2484,none,1,0}, {2485,none,1,0}, {2486,none,1,0}, {2487,none,2,0}, {2489,396,0,2},
+    {2489,none,1,0}, {2490,none,1,0}, {2491,none,1,0}, {2492,none,1,0}, {2493,none,1,0}, {2494,398,0,1}, {2494,none,3,0},
+    {2497,none,1,0}, {2498,none,1,0}, {2499,none,1,0}, {2500,none,2,0}, {2502,399,0,2}, {2502,none,1,0}, {2503,none,1,0},
+    {2504,none,1,0}, {2505,none,1,0}, {2506,none,1,0}, {2507,401,0,1}, {2507,none,1,0}, {2508,none,1,0}, {2509,none,1,0},
+    {2510,none,1,0}, {2511,none,1,0}, {2512,none,4,0}, {2516,402,0,1}, {2516,none,1,0}, {2517,none,1,0}, {2518,none,1,0},
+    {2519,none,1,0}, {2520,none,1,0}, {2521,403,0,2}, {2521,none,1,0}, {2522,none,1,0}, {2523,none,1,0}, {2524,none,1,0},
+    {2525,none,1,0}, {2526,none,1,0}, {2527,none,1,0}, {2528,none,1,0}, {2529,none,1,0}, {2530,none,1,0}, {2531,405,0,1},
+    {2531,none,1,0}, {2532,none,1,0}, {2533,none,1,0}, {2534,none,1,0}, {2535,none,1,0}, {2536,406,0,2}, {2536,none,1,0},
+    {2537,none,1,0}, {2538,none,1,0}, {2539,none,1,0}, {2540,none,1,0}, {2541,none,2,0}, {2543,408,0,2}, {2543,none,1,0},
+    {2544,none,1,0}, {2545,none,1,0}, {2546,none,1,0}, {2547,none,1,0}, {2548,410,0,1}, {2548,none,1,0}, {2549,none,1,0},
+    {2550,none,1,0}, {2551,none,1,0}, {2552,none,4,0}, {2556,411,0,1}, {2556,none,1,0}, {2557,none,1,0}, {2558,none,1,0},
+    {2559,none,1,0}, {2560,none,1,0}, {2561,412,0,1}, {2561,none,1,0}, {2562,none,1,0}, {2563,none,1,0}, {2564,none,1,0},
+    {2565,none,1,0}, {2566,none,1,0}, {2567,none,1,0}, {2568,none,1,0}, {2569,none,1,0}, {2570,413,0,1}, {2570,none,1,0},
+    {2571,none,1,0}, {2572,none,1,0}, {2573,none,1,0}, {2574,none,1,0}, {2575,414,0,1}, {2575,none,1,0}, {2576,none,1,0},
+    {2577,none,1,0}, {2578,none,1,0}, {2579,none,1,0}, {2580,none,1,0}, {2581,none,1,0}, {2582,none,1,0}, {2583,none,1,0},
+    {2584,none,1,0}, {2585,none,1,0}, {2586,415,0,1}, {2586,none,1,0}, {2587,none,1,0}, {2588,none,1,0}, {2589,416,0,2},
+    {2589,none,1,0}, {2590,none,1,0}, {2591,none,1,0}, {2592,none,1,0}, {2593,none,1,0}, {2594,418,0,1}, {2594,none,1,0},
+    {2595,419,0,1}, {2595,none,14,0}, {2609,none,1,0}, {2610,none,1,0}, {2611,none,1,0}, {2612,none,1,0}, {2613,420,0,1},
+    {2613,none,1,0}, {2614,none,1,0}, {2615,none,1,0}, {2616,none,1,0}, {2617,none,1,0}, {2618,421,0,1}, {2618,none,2,0},
+    {2620,none,1,0}, {2621,none,1,0}, {2622,none,1,0}, {2623,422,0,1}, {2623,none,1,0}, {2624,423,0,1}, {2624,none,1,0},
+    {2625,none,1,0}, {2626,none,1,0}, {2627,none,1,0}, {2628,none,1,0}, {2629,424,0,1}, {2629,none,1,0}, {2630,none,1,0},
+    {2631,425,0,2}, {2631,none,1,0}, {2632,none,1,0}, {2633,none,1,0}, {2634,none,1,0}, {2635,none,1,0}, {2636,427,0,1},
+    {2636,none,3,0}, {2639,none,1,0}, {2640,none,1,0}, {2641,none,1,0}, {2642,428,0,1}, {2642,none,1,0}, {2643,none,1,0},
+    {2644,none,1,0}, {2645,429,0,1}, {2645,none,1,0}, {2646,none,1,0}, {2647,none,1,0}, {2648,none,1,0}, {2649,none,1,0},
+    {2650,430,0,1}, {2650,none,1,0}, {2651,none,1,0}, {2652,none,1,0}, {2653,431,0,2}, {2653,none,1,0}, {2654,none,1,0},
+    {2655,none,1,0}, {2656,none,1,0}, {2657,none,1,0}, {2658,none,1,0}, {2659,none,1,0}, {2660,none,2,0}, {2662,none,1,0},
+    {2663,none,1,0}, {2664,none,1,0}, {2665,none,1,0}, {2666,none,1,0}, {2667,none,1,0}, {2668,none,1,0}, {2669,none,1,0},
+    {2670,none,1,0}, {2671,none,1,0}, {2672,none,1,0}, {2673,36,0,1}, {2673,none,1,0}, {2674,none,1,0}, {2675,none,1,0},
+    {2676,none,1,0}, {2677,none,1,0}, {2678,433,0,1}, {2678,none,1,0}, {2679,434,0,1}, {2679,none,2,0}, {2681,none,1,0},
+    {2682,none,1,0}, {2683,435,0,2}, {2683,none,1,0}, {2684,none,1,0}, {2685,none,1,0}, {2686,none,1,0}, {2687,437,0,1},
+    {2687,none,1,0}, {2688,none,2,0}, {2690,none,1,0}, {2691,none,1,0}, {2692,none,1,0}, {2693,438,0,1}, {2693,none,1,0},
+    {2694,none,1,0}, {2695,none,1,0}, {2696,439,0,1}, {2696,none,1,0}, {2697,none,1,0}, {2698,none,1,0}, {2699,440,0,1},
+    {2699,none,1,0}, {2700,none,1,0}, {2701,none,2,0}, {2703,none,2,0}, {2705,none,1,0}, {2706,none,1,0}, {2707,441,0,1},
+    {2707,none,1,0}, {2708,none,1,0}, {2709,none,2,0}, {2711,none,1,0}, {2712,442,0,1}, {2712,none,1,0}, {2713,none,1,0},
+    {2714,none,1,0}, {2715,443,0,1}, {2715,none,1,0}, {2716,none,1,0}, {2717,none,1,0}, {2718,none,1,0}, {2719,none,1,0},
+    {2720,none,1,0}, {2721,none,1,0}, {2722,none,1,0}, {2723,none,1,0}, {2724,none,1,0}, {2725,none,1,0}, {2726,444,0,1},
+    {2726,none,9,0}, {2735,none,1,0}, {2736,none,1,0}, {2737,none,1,0}, {2738,none,1,0}, {2739,none,1,0}, {2740,none,1,0},
+    {2741,none,1,0}, {2742,445,0,1}, {2742,none,1,0}, {2743,none,1,0}, {2744,446,0,1}, {2744,none,1,0}, {2745,none,1,0},
+    {2746,447,0,2}, {2746,none,1,0}, {2747,none,1,0}, {2748,449,0,1}, {2748,none,1,0}, {2749,450,0,1}, {2749,none,1,0},
+    {2750,none,1,0}, {2751,none,1,0}, {2752,none,1,0}, {2753,none,1,0}, {2754,none,1,0}, {2755,none,1,0}, {2756,none,1,0},
+    {2757,451,0,1}, {2757,none,2,0}, {2759,none,1,0}, {2760,none,1,0}, {2761,none,1,0}, {2762,none,1,0}, {2763,none,1,0},
+    {2764,none,1,0}, {2765,none,1,0}, {2766,none,1,0}, {2767,none,1,0}, {2768,none,1,0}, {2769,none,1,0}, {2770,220,0,1},
+    {2770,none,1,0}, {2771,none,1,0}, {2772,452,0,1}, {2772,none,4,0}, {2776,453,0,1}, {2776,none,1,0}, {2777,none,1,0},
+    {2778,none,1,0}, {2779,none,1,0}, {2780,none,1,0}, {2781,none,4,0}, {2785,454,0,1}, {2785,none,1,0}, {2786,none,1,0},
+    {2787,none,1,0}, {2788,none,1,0}, {2789,none,1,0}, {2790,455,0,1}, {2790,none,1,0}, {2791,none,1,0}, {2792,none,1,0},
+    {2793,none,1,0}, {2794,none,1,0}, {2795,none,1,0}, {2796,none,1,0}, {2797,none,1,0}, {2798,none,1,0}, {2799,none,1,0},
+    {2800,456,0,1}, {2800,none,1,0}, {2801,none,1,0}, {2802,none,1,0}, {2803,none,1,0}, {2804,none,1,0}, {2805,457,0,1},
+    {2805,none,1,0}, {2806,none,1,0}, {2807,none,1,0}, {2808,458,0,1}, {2808,none,2,0}, {2810,none,1,0}, {2811,none,1,0},
+    {2812,none,1,0}, {2813,none,1,0}, {2814,459,0,1}, {2814,none,1,0}, {2815,none,1,0}, {2816,none,1,0}, {2817,none,1,0},
+    {2818,none,1,0}, {2819,none,1,0}, {2820,none,2,0}, {2822,98,0,1}, {2822,none,1,0}, {2823,none,1,0}, {2824,460,0,1},
+    {2824,none,2,0}, {2826,none,1,0}, {2827,none,1,0}, {2828,461,0,2}, {2828,none,1,0}, {2829,463,0,1}, {2829,none,4,0},
+    {2833,none,1,0}, {2834,none,1,0}, {2835,none,1,0}, {2836,464,0,1}, {2836,none,1,0}, {2837,none,1,0}, {2838,465,0,2},
+    {2838,none,1,0}, {2839,none,1,0}, {2840,none,1,0}, {2841,467,0,1}, {2841,none,1,0}, {2842,none,1,0}, {2843,none,1,0},
+    {2844,468,0,2}, {2844,none,12,0}, {2856,none,1,0}, {2857,none,1,0}, {2858,none,1,0}, {2859,none,1,0}, {2860,470,0,1},
+    {2860,none,1,0}, {2861,none,1,0}, {2862,471,0,1}, {2862,none,3,0}, {2865,none,1,0}, {2866,none,1,0}, {2867,none,1,0},
+    {2868,none,1,0}, {2869,472,0,1}, {2869,none,1,0}, {2870,none,1,0}, {2871,473,0,1}, {2871,none,1,0}, {2872,none,2,0},
+    {2874,474,0,1}, {2874,none,1,0}, {2875,none,1,0}, {2876,475,0,1}, {2876,none,3,0}, {2879,none,1,0}, {2880,none,1,0},
+    {2881,none,1,0}, {2882,none,1,0}, {2883,476,0,1}, {2883,none,1,0}, {2884,none,1,0}, {2885,none,1,0}, {2886,none,1,0},
+    {2887,477,0,1}, {2887,none,1,0}, {2888,478,0,1}, {2888,none,2,0}, {2890,479,0,1}, {2890,none,1,0}, {2891,none,1,0},
+    {2892,none,1,0}, {2893,none,1,0}, {2894,none,2,0}, {2896,none,2,0}, {2898,none,1,0}, {2899,none,1,0}, {2900,none,1,0},
+    {2901,none,1,0}, {2902,none,1,0}, {2903,none,1,0}, {2904,480,0,1}, {2904,none,1,0}, {2905,none,1,0}, {2906,none,1,0},
+    {2907,none,1,0}, {2908,none,1,0}, {2909,none,1,0}, {2910,none,1,0}, {2911,none,1,0}, {2912,none,1,0}, {2913,none,1,0},
+    {2914,481,0,1}, {2914,none,1,0}, {2915,none,1,0}, {2916,none,1,0}, {2917,none,1,0}, {2918,none,1,0}, {2919,none,1,0},
+    {2920,none,1,0}, {2921,none,1,0}, {2922,none,1,0}, {2923,none,1,0}, {2924,none,1,0}, {2925,none,1,0}, {2926,none,1,0},
+    {2927,482,0,1}, {2927,none,1,0}, {2928,none,1,0}, {2929,479,0,1}, {2929,none,1,0}, {2930,none,1,0}, {2931,483,0,1},
+    {2931,none,1,0}, {2932,none,1,0}, {2933,none,1,0}, {2934,none,8,0}, {2942,none,2,0}, {2944,none,1,0}, {2945,none,1,0},
+    {2946,none,1,0}, {2947,none,1,0}, {2948,none,1,0}, {2949,none,1,0}, {2950,none,1,0}, {2951,none,1,0}, {2952,none,1,0},
+    {2953,none,1,0}, {2954,none,1,0}, {2955,484,0,1}, {2955,none,1,0}, {2956,none,1,0}, {2957,none,1,0}, {2958,none,3,0},
+    {2961,17,0,1}, {2961,none,1,0}, {2962,none,1,0}, {2963,none,1,0}, {2964,485,0,1}, {2964,none,1,0}, {2965,none,1,0},
+    {2966,none,1,0}, {2967,none,1,0}, {2968,none,1,0}, {2969,none,1,0}, {2970,none,1,0}, {2971,none,1,0}, {2972,none,1,0},
+    {2973,486,0,1}, {2973,none,1,0}, {2974,none,1,0}, {2975,none,1,0}, {2976,none,1,0}, {2977,none,1,0}, {2978,none,1,0},
+    {2979,none,1,0}, {2980,487,0,1}, {2980,none,1,0}, {2981,none,2,0}, {2983,none,1,0}, {2984,none,1,0}, {2985,none,1,0},
+    {2986,none,1,0}, {2987,none,1,0}, {2988,none,1,0}, {2989,none,1,0}, {2990,none,1,0}, {2991,none,1,0}, {2992,none,1,0},
+    {2993,none,1,0}, {2994,488,0,1}, {2994,none,1,0}, {2995,none,2,0}, {2997,none,1,0}, {2998,none,1,0}, {2999,none,1,0},
+    {3000,none,1,0}, {3001,none,1,0}, {3002,none,1,0}, {3003,none,1,0}, {3004,none,1,0}, {3005,none,1,0}, {3006,489,0,1},
+    {3006,none,1,0}, {3007,none,1,0}, {3008,none,1,0}, {3009,none,1,0}, {3010,none,1,0}, {3011,none,2,0}, {3013,490,0,1},
+    {3013,none,1,0}, {3014,none,1,0}, {3015,none,1,0}, {3016,491,0,1}, {3016,none,1,0}, {3017,none,1,0}, {3018,none,1,0},
+    {3019,none,1,0}, {3020,none,1,0}, {3021,492,0,1}, {3021,none,2,0}, {3023,none,1,0}, {3024,none,3,0}, {3027,493,0,1},
+    {3027,none,1,0}, {3028,none,1,0}, {3029,none,1,0}, {3030,none,1,0}, {3031,none,1,0}, {3032,494,0,1}, {3032,none,1,0},
+    {3033,none,1,0}, {3034,none,1,0}, {3035,none,1,0}, {3036,none,1,0}, {3037,none,1,0}, {3038,495,0,1}, {3038,none,1,0},
+    {3039,none,1,0}, {3040,none,1,0}, {3041,none,1,0}, {3042,none,1,0}, {3043,none,1,0}, {3044,none,3,0}, {3047,496,0,1},
+    {3047,none,1,0}, {3048,none,1,0}, {3049,none,1,0}, {3050,497,0,1}, {3050,none,1,0}, {3051,none,1,0}, {3052,none,1,0},
+    {3053,none,1,0}, {3054,none,1,0}, {3055,498,0,1}, {3055,none,1,0}, {3056,none,3,0}, {3059,none,1,0}, {3060,none,1,0},
+    {3061,none,1,0}, {3062,none,1,0}, {3063,none,1,0}, {3064,none,1,0}, {3065,none,1,0}, {3066,none,1,0}, {3067,none,1,0},
+    {3068,none,1,0}, {3069,499,0,1}, {3069,none,1,0}, {3070,none,1,0}, {3071,none,1,0}, {3072,none,1,0}, {3073,none,1,0},
+    {3074,none,1,0}, {3075,none,1,0}, {3076,none,1,0}, {3077,none,1,0}, {3078,500,0,1}, {3078,none,1,0}, {3079,none,1,0},
+    {3080,none,1,0}, {3081,none,1,0}, {3082,none,1,0}, {3083,none,2,0}, {3085,501,0,1}, {3085,none,1,0}, {3086,none,1,0},
+    {3087,none,1,0}, {3088,502,0,1}, {3088,none,1,0}, {3089,none,1,0}, {3090,none,1,0}, {3091,none,1,0}, {3092,none,1,0},
+    {3093,none,2,0}, {3095,503,0,1}, {3095,none,1,0}, {3096,none,1,0}, {3097,none,1,0}, {3098,504,0,1}, {3098,none,1,0},
+    {3099,none,1,0}, {3100,none,1,0}, {3101,none,1,0}, {3102,none,1,0}, {3103,137,0,1}, {3103,none,2,0}, {3105,none,1,0},
+    {3106,none,1,0}, {3107,505,0,1}, {3107,none,1,0}, {3108,none,1,0}, {3109,none,1,0}, {3110,none,1,0}, {3111,none,1,0},
+    {3112,none,1,0}, {3113,none,1,0}, {3114,none,1,0}, {3115,none,1,0}, {3116,none,1,0}, {3117,506,0,1}, {3117,none,1,0},
+    {3118,none,1,0}, {3119,none,1,0}, {3120,none,1,0}, {3121,none,1,0}, {3122,none,1,0}, {3123,none,1,0}, {3124,none,1,0},
+    {3125,none,1,0}, {3126,none,1,0}, {3127,507,0,1}, {3127,none,2,0}, {3129,none,1,0}, {3130,none,1,0}, {3131,508,0,1},
+    {3131,none,1,0}, {3132,509,0,1}, {3132,none,1,0}, {3133,none,1,0}, {3134,none,1,0}, {3135,none,1,0}, {3136,none,1,0},
+    {3137,none,1,0}, {3138,none,1,0}, {3139,none,1,0}, {3140,none,1,0}, {3141,none,1,0}, {3142,510,0,1}, {3142,none,13,0},
+    {3155,none,2,0}, {3157,none,1,0}, {3158,none,1,0}, {3159,none,1,0}, {3160,none,1,0}, {3161,511,0,1}, {3161,none,1,0},
+    {3162,none,1,0}, {3163,512,0,1}, {3163,none,1,0}, {3164,none,1,0}, {3165,none,1,0}, {3166,none,1,0}, {3167,none,1,0},
+    {3168,513,0,1}, {3168,none,1,0}, {3169,none,1,0}, {3170,none,1,0}, {3171,none,1,0}, {3172,none,1,0}, {3173,514,0,1},
+    {3173,none,5,0}, {3178,515,0,1}, {3178,none,1,0}, {3179,none,1,0}, {3180,none,1,0}, {3181,none,1,0}, {3182,516,0,1},
+    {3182,none,1,0}, {3183,none,1,0}, {3184,none,1,0}, {3185,none,1,0}, {3186,517,0,1}, {3186,none,1,0}, {3187,none,1,0},
+    {3188,none,1,0}, {3189,518,0,1}, {3189,none,1,0}, {3190,519,0,1}, {3190,none,1,0}, {3191,none,1,0}, {3192,520,0,2},
+    {3192,none,1,0}, {3193,none,1,0}, {3194,none,1,0}, {3195,none,4,0}, {3199,none,1,0}, {3200,none,1,0}, {3201,none,1,0},
+    {3202,none,1,0}, {3203,none,1,0}, {3204,none,1,0}, {3205,none,1,0}, {3206,none,1,0}, {3207,none,1,0}, {3208,15,0,1},
+    {3208,none,1,0}, {3209,none,1,0}, {3210,none,1,0}, {3211,none,1,0}, {3212,none,1,0}, {3213,none,1,0}, {3214,none,1,0},
+    {3215,none,1,0}, {3216,none,1,0}, {3217,16,0,1}, {3217,none,1,0}, {3218,none,1,0}, {3219,none,1,0}, {3220,none,1,0},
+    {3221,none,1,0}, {3222,none,1,0}, {3223,none,1,0}, {3224,none,1,0}, {3225,none,1,0}, {3226,none,1,0}, {3227,17,0,1},
+    {3227,none,1,0}, {3228,none,1,0}, {3229,none,1,0}, {3230,none,1,0}, {3231,none,1,0}, {3232,none,1,0}, {3233,none,1,0},
+    {3234,18,0,1}, {3234,none,1,0}, {3235,none,1,0}, {3236,none,1,0}, {3237,none,1,0}, {3238,522,0,1}, {3238,none,1,0},
+    {3239,none,1,0}, {3240,none,1,0}, {3241,none,1,0}, {3242,none,1,0}, {3243,none,1,0}, {3244,none,1,0}, {3245,none,1,0},
+    {3246,none,1,0}, {3247,none,1,0}, {3248,523,0,1}, {3248,none,1,0}, {3249,none,1,0}, {3250,none,1,0}, {3251,524,0,2},
+    {3251,none,2,0}, {3253,none,1,0}, {3254,none,1,0}, {3255,526,0,1}, {3255,none,1,0}, {3256,none,1,0}, {3257,none,1,0},
+    {3258,none,4,0}, {3262,527,0,1}, {3262,none,1,0}, {3263,none,1,0}, {3264,none,1,0}, {3265,none,1,0}, {3266,none,1,0},
+    {3267,none,1,0}, {3268,none,1,0}, {3269,none,1,0}, {3270,none,1,0}, {3271,none,1,0}, {3272,none,1,0}, {3273,none,1,0},
+    {3274,528,0,1}, {3274,none,1,0}, {3275,none,2,0}, {3277,none,1,0}, {3278,none,1,0}, {3279,none,1,0}, {3280,none,2,0},
+    {3282,529,0,1}, {3282,none,1,0}, {3283,none,1,0}, {3284,none,1,0}, {3285,none,1,0}, {3286,none,1,0}, {3287,530,0,1},
+    {3287,none,1,0}, {3288,none,1,0}, {3289,none,1,0}, {3290,none,1,0}, {3291,none,1,0}, {3292,none,2,0}, {3294,531,0,1},
+    {3294,none,1,0}, {3295,none,1,0}, {3296,none,1,0}, {3297,none,1,0}, {3298,none,1,0}, {3299,532,0,1}, {3299,none,1,0},
+    {3300,none,1,0}, {3301,none,1,0}, {3302,none,1,0}, {3303,none,1,0}, {3304,533,0,1}, {3304,none,1,0}, {3305,none,1,0},
+    {3306,none,1,0}, {3307,534,0,2}, {3307,none,1,0}, {3308,none,1,0}, {3309,none,1,0}, {3310,536,0,1}, {3310,none,4,0},
+    {3314,none,2,0}, {3316,537,0,1}, {3316,none,1,0}, {3317,none,1,0}, {3318,none,2,0}, {3320,537,0,1}, {3320,none,1,0},
+    {3321,none,1,0}, {3322,none,1,0}, {3323,none,1,0}, {3324,none,1,0}, {3325,538,0,1}, {3325,none,2,0}, {3327,none,1,0},
+    {3328,none,1,0}, {3329,none,1,0}, {3330,none,1,0}, {3331,none,4,0}, {3335,539,0,1}, {3335,none,1,0}, {3336,none,1,0},
+    {3337,none,1,0}, {3338,none,1,0}, {3339,none,1,0}, {3340,540,0,1}, {3340,none,1,0}, {3341,none,1,0}, {3342,none,1,0},
+    {3343,none,1,0}, {3344,none,1,0}, {3345,none,1,0}, {3346,none,1,0}, {3347,none,1,0}, {3348,none,1,0}, {3349,none,1,0},
+    {3350,541,0,1}, {3350,none,1,0}, {3351,none,1,0}, {3352,none,1,0}, {3353,none,1,0}, {3354,none,1,0}, {3355,542,0,1},
+    {3355,none,1,0}, {3356,none,1,0}, {3357,none,1,0}, {3358,none,1,0}, {3359,none,1,0}, {3360,480,0,1}, {3360,none,1,0},
+    {3361,543,0,1}, {3361,none,3,0}, {3364,544,0,1}, {3364,none,1,0}, {3365,none,1,0}, {3366,none,1,0}, {3367,none,1,0},
+    {3368,none,2,0}, {3370,545,0,1}, {3370,none,1,0}, {3371,none,1,0}, {3372,none,1,0}, {3373,none,1,0}, {3374,none,1,0},
+    {3375,546,0,1}, {3375,none,1,0}, {3376,none,1,0}, {3377,none,1,0}, {3378,544,0,1}, {3378,none,11,0}, {3389,none,1,0},
+    {3390,none,1,0}, {3391,none,1,0}, {3392,none,1,0}, {3393,547,0,1}, {3393,none,1,0}, {3394,none,1,0}, {3395,none,1,0},
+    {3396,none,1,0}, {3397,548,0,1}, {3397,none,2,0}, {3399,none,1,0}, {3400,none,1,0}, {3401,none,1,0}, {3402,549,0,1},
+    {3402,none,1,0}, {3403,none,1,0}, {3404,550,0,1}, {3404,none,2,0}, {3406,none,1,0}, {3407,551,0,1}, {3407,none,1,0},
+    {3408,552,0,1}, {3408,none,3,0}, {3411,none,1,0}, {3412,none,1,0}, {3413,none,1,0}, {3414,none,1,0}, {3415,553,0,1},
+    {3415,none,1,0}, {3416,none,1,0}, {3417,none,1,0}, {3418,none,1,0}, {3419,554,0,1}, {3419,none,1,0}, {3420,555,0,1},
+    {3420,none,1,0}, {3421,none,1,0}, {3422,556,0,2}, {3422,none,2,0}, {3424,none,2,0}, {3426,none,1,0}, {3427,none,1,0},
+    {3428,none,1,0}, {3429,none,1,0}, {3430,none,1,0}, {3431,none,1,0}, {3432,558,0,1}, {3432,none,1,0}, {3433,none,1,0},
+    {3434,559,0,1}, {3434,none,2,0}, {3436,none,1,0}, {3437,none,1,0}, {3438,none,1,0}, {3439,none,1,0}, {3440,none,1,0},
+    {3441,none,1,0}, {3442,none,1,0}, {3443,560,0,2}, {3443,none,1,0}, {3444,none,1,0}, {3445,none,1,0}, {3446,none,1,0},
+    {3447,none,1,0}, {3448,none,1,0}, {3449,26,0,1}, {3449,none,1,0}, {3450,none,1,0}, {3451,none,1,0}, {3452,none,4,0},
+    {3456,562,0,1}, {3456,none,1,0}, {3457,none,1,0}, {3458,none,1,0}, {3459,none,1,0}, {3460,none,1,0}, {3461,563,0,1},
+    {3461,none,1,0}, {3462,none,1,0}, {3463,none,1,0}, {3464,none,1,0}, {3465,none,1,0}, {3466,none,1,0}, {3467,none,1,0},
+    {3468,none,1,0}, {3469,none,1,0}, {3470,564,0,1}, {3470,none,1,0}, {3471,none,1,0}, {3472,none,1,0}, {3473,none,1,0},
+    {3474,none,1,0}, {3475,565,0,1}, {3475,none,1,0}, {3476,none,1,0}, {3477,none,1,0}, {3478,566,0,2}, {3478,none,1,0},
+    {3479,none,1,0}, {3480,none,1,0}, {3481,none,1,0}, {3482,none,1,0}, {3483,none,1,0}, {3484,none,1,0}, {3485,none,1,0},
+    {3486,568,0,1}, {3486,none,2,0}, {3488,none,1,0}, {3489,none,1,0}, {3490,569,0,2}, {3490,none,1,0}, {3491,none,1,0},
+    {3492,none,1,0}, {3493,none,1,0}, {3494,571,0,1}, {3494,none,14,0}, {3508,none,2,0}, {3510,none,1,0}, {3511,none,1,0},
+    {3512,none,1,0}, {3513,none,1,0}, {3514,572,0,1}, {3514,none,1,0}, {3515,none,2,0}, {3517,573,0,1}, {3517,none,1,0},
+    {3518,none,1,0}, {3519,none,1,0}, {3520,none,1,0}, {3521,574,0,1}, {3521,none,1,0}, {3522,none,2,0}, {3524,none,1,0},
+    {3525,none,1,0}, {3526,575,0,1}, {3526,none,1,0}, {3527,none,1,0}, {3528,none,1,0}, {3529,576,0,1}, {3529,none,2,0},
+    {3531,none,1,0}, {3532,none,1,0}, {3533,none,1,0}, {3534,577,0,1}, {3534,none,1,0}, {3535,578,0,1}, {3535,none,1,0},
+    {3536,none,1,0}, {3537,none,1,0}, {3538,none,1,0}, {3539,none,1,0}, {3540,579,0,1}, {3540,none,1,0}, {3541,none,1,0},
+    {3542,580,0,2}, {3542,none,1,0}, {3543,none,1,0}, {3544,none,1,0}, {3545,none,1,0}, {3546,none,1,0}, {3547,582,0,1},
+    {3547,none,1,0}, {3548,none,1,0}, {3549,none,1,0}, {3550,none,1,0}, {3551,583,0,1}, {3551,none,2,0}, {3553,none,1,0},
+    {3554,none,1,0}, {3555,none,2,0}, {3557,none,2,0}, {3559,none,1,0}, {3560,none,1,0}, {3561,584,0,1}, {3561,none,1,0},
+    {3562,none,1,0}, {3563,none,2,0}, {3565,none,1,0}, {3566,585,0,1}, {3566,none,1,0}, {3567,none,1,0}, {3568,none,1,0},
+    {3569,586,0,1}, {3569,none,1,0}, {3570,none,1,0}, {3571,none,1,0}, {3572,none,1,0}, {3573,none,1,0}, {3574,none,1,0},
+    {3575,none,1,0}, {3576,none,1,0}, {3577,none,1,0}, {3578,none,1,0}, {3579,none,1,0}, {3580,587,0,1}, {3580,none,1,0},
+    {3581,none,1,0}, {3582,none,2,0}, {3584,588,0,1}, {3584,none,1,0}, {3585,none,1,0}, {3586,none,1,0}, {3587,none,1,0},
+    {3588,589,0,1}, {3588,none,2,0}, {3590,none,1,0}, {3591,none,1,0}, {3592,none,1,0}, {3593,590,0,1}, {3593,none,1,0},
+    {3594,none,1,0}, {3595,591,0,2}, {3595,none,8,0}, {3603,none,1,0}, {3604,none,1,0}, {3605,none,1,0}, {3606,none,1,0},
+    {3607,none,3,0}, {3610,18,0,1}, {3610,none,1,0}, {3611,none,1,0}, {3612,none,1,0}, {3613,593,0,1}, {3613,none,1,0},
+    {3614,none,1,0}, {3615,none,1,0}, {3616,none,1,0}, {3617,none,1,0}, {3618,none,1,0}, {3619,none,1,0}, {3620,none,1,0},
+    {3621,none,1,0}, {3622,594,0,1}, {3622,none,1,0}, {3623,none,1,0}, {3624,none,1,0}, {3625,none,1,0}, {3626,none,1,0},
+    {3627,none,1,0}, {3628,none,1,0}, {3629,none,1,0}, {3630,none,1,0}, {3631,595,0,1}, {3631,none,1,0}, {3632,none,1,0},
+    {3633,none,1,0}, {3634,none,1,0}, {3635,none,1,0}, {3636,none,1,0}, {3637,none,1,0}, {3638,none,1,0}, {3639,none,1,0},
+    {3640,none,1,0}, {3641,none,1,0}, {3642,596,0,1}, {3642,none,1,0}, {3643,none,1,0}, {3644,none,2,0}, {3646,597,0,1},
+    {3646,none,1,0}, {3647,none,1,0}, {3648,none,1,0}, {3649,none,1,0}, {3650,none,1,0}, {3651,598,0,1}, {3651,none,1,0},
+    {3652,none,1,0}, {3653,none,1,0}, {3654,none,1,0}, {3655,none,1,0}, {3656,139,0,1}, {3656,none,1,0}, {3657,none,1,0},
+    {3658,none,1,0}, {3659,none,1,0}, {3660,none,1,0}, {3661,none,1,0}, {3662,none,1,0}, {3663,none,1,0}, {3664,none,1,0},
+    {3665,140,0,1}, {3665,none,1,0}, {3666,none,1,0}, {3667,none,2,0}, {3669,none,1,0}, {3670,none,1,0}, {3671,none,1,0},
+    {3672,none,1,0}, {3673,none,1,0}, {3674,none,1,0}, {3675,none,1,0}, {3676,none,1,0}, {3677,none,1,0}, {3678,599,0,1},
+    {3678,none,1,0}, {3679,none,1,0}, {3680,none,1,0}, {3681,none,1,0}, {3682,none,1,0}, {3683,none,1,0}, {3684,none,1,0},
+    {3685,none,1,0}, {3686,none,1,0}, {3687,none,1,0}, {3688,600,0,1}, {3688,none,1,0}, {3689,none,2,0}, {3691,601,0,1},
+    {3691,none,1,0}, {3692,none,1,0}, {3693,none,1,0}, {3694,602,0,1}, {3694,none,1,0}, {3695,none,1,0}, {3696,none,1,0},
+    {3697,none,1,0}, {3698,603,0,1}, {3698,none,1,0}, {3699,none,1,0}, {3700,none,1,0}, {3701,604,0,2}, {3701,none,1,0},
+    {3702,none,1,0}, {3703,none,1,0}, {3704,none,1,0}, {3705,none,1,0}, {3706,606,0,1}, {3706,none,1,0}, {3707,none,1,0},
+    {3708,none,1,0}, {3709,607,0,1}, {3709,none,9,0}, {3718,none,1,0}, {3719,none,1,0}, {3720,none,1,0}, {3721,none,1,0},
+    {3722,608,0,1}, {3722,none,1,0}, {3723,none,1,0}, {3724,none,1,0}, {3725,609,0,1}, {3725,none,1,0}, {3726,none,1,0},
+    {3727,610,0,1}, {3727,none,1,0}, {3728,none,1,0}, {3729,none,1,0}, {3730,none,2,0}, {3732,611,0,1}, {3732,none,1,0},
+    {3733,612,0,1}, {3733,none,2,0}, {3735,none,1,0}, {3736,613,0,1}, {3736,none,3,0}, {3739,none,1,0}, {3740,none,1,0},
+    {3741,none,1,0}, {3742,614,0,1}, {3742,none,2,0}, {3744,614,0,1}, {3744,none,1,0}, {3745,none,1,0}, {3746,none,1,0},
+    {3747,none,4,0}, {3751,none,1,0}, {3752,none,1,0}, {3753,none,1,0}, {3754,615,0,1}, {3754,none,1,0}, {3755,none,1,0},
+    {3756,none,1,0}, {3757,none,1,0}, {3758,616,0,1}, {3758,none,1,0}, {3759,none,1,0}, {3760,none,1,0}, {3761,none,1,0},
+    {3762,none,1,0}, {3763,none,1,0}, {3764,none,1,0}, {3765,none,1,0}, {3766,none,1,0}, {3767,617,0,1}, {3767,none,1,0},
+    {3768,none,1,0}, {3769,none,1,0}, {3770,none,1,0}, {3771,none,1,0}, {3772,618,0,1}, {3772,none,1,0}, {3773,none,1,0},
+    {3774,none,1,0}, {3775,none,1,0}, {3776,none,1,0}, {3777,none,1,0}, {3778,none,1,0}, {3779,none,1,0}, {3780,none,1,0},
+    {3781,none,1,0}, {3782,21,0,1}, {3782,none,1,0}, {3783,none,1,0}, {3784,619,0,2}, {3784,none,1,0}, {3785,none,1,0},
+    {3786,none,1,0}, {3787,621,0,2}, {3787,none,1,0}, {3788,none,1,0}, {3789,none,1,0}, {3790,623,0,2}, {3790,none,1,0},
+    {3791,none,1,0}, {3792,none,1,0}, {3793,none,1,0}, {3794,none,1,0}, {3795,625,0,1}, {3795,none,5,0}, {3800,none,1,0},
+    {3801,none,1,0}, {3802,none,1,0}, {3803,none,1,0}, {3804,626,0,1}, {3804,none,1,0}, {3805,none,1,0}, {3806,none,1,0},
+    {3807,none,1,0}, {3808,627,0,1}, {3808,none,1,0}, {3809,none,1,0}, {3810,628,0,2}, {3810,none,1,0}, {3811,none,1,0},
+    {3812,none,1,0}, {3813,630,0,2}, {3813,none,1,0}, {3814,none,1,0}, {3815,none,1,0}, {3816,632,0,2}, {3816,none,4,0},
+    {3820,none,1,0}, {3821,none,1,0}, {3822,634,0,2}, {3822,none,1,0}, {3823,636,0,1}, {3823,none,1,0}, {3824,none,1,0},
+    {3825,none,1,0}, {3826,637,0,2}, {3826,none,1,0}, {3827,none,1,0}, {3828,none,1,0}, {3829,639,0,2}, {3829,none,9,0},
+    {3838,none,1,0}, {3839,none,1,0}, {3840,none,1,0}, {3841,641,0,1}, {3841,none,1,0}, {3842,none,1,0}, {3843,none,1,0},
+    {3844,642,0,1}, {3844,none,1,0}, {3845,none,1,0}, {3846,none,1,0}, {3847,643,0,1}, {3847,none,1,0}, {3848,none,1,0},
+    {3849,none,1,0}, {3850,none,1,0}, {3851,none,1,0}, {3852,644,0,1}, {3852,none,2,0}, {3854,none,1,0}, {3855,none,1,0},
+    {3856,none,1,0}, {3857,645,0,1}, {3857,none,1,0}, {3858,646,0,1}, {3858,none,1,0}, {3859,none,1,0}, {3860,647,0,2},
+    {3860,none,1,0}, {3861,none,1,0}, {3862,none,1,0}, {3863,649,0,2}, {3863,none,1,0}, {3864,none,1,0}, {3865,none,1,0},
+    {3866,651,0,2}, {3866,none,1,0}, {3867,none,1,0}, {3868,none,1,0}, {3869,653,0,1}, {3869,none,8,0}, {3877,none,1,0},
+    {3878,none,1,0}, {3879,none,1,0}, {3880,654,0,1}, {3880,none,1,0}, {3881,none,1,0}, {3882,none,1,0}, {3883,none,1,0},
+    {3884,none,1,0}, {3885,655,0,1}, {3885,none,2,0}, {3887,none,1,0}, {3888,none,1,0}, {3889,none,1,0}, {3890,none,1,0},
+    {3891,656,0,1}, {3891,none,1,0}, {3892,657,0,1}, {3892,none,1,0}, {3893,none,1,0}, {3894,none,1,0}, {3895,658,0,1},
+    {3895,none,2,0}, {3897,none,1,0}, {3898,none,1,0}, {3899,none,1,0}, {3900,none,1,0}, {3901,none,1,0}, {3902,none,1,0},
+    {3903,none,1,0}, {3904,none,1,0}, {3905,none,1,0}, {3906,none,1,0}, {3907,none,1,0}, {3908,none,1,0}, {3909,28,0,1},
+    {3909,none,1,0}, {3910,none,1,0}, {3911,659,0,1}, {3911,none,1,0}, {3912,none,1,0}, {3913,660,0,1}, {3913,none,1,0},
+    {3914,none,1,0}, {3915,none,1,0}, {3916,661,0,1}, {3916,none,1,0}, {3917,none,1,0}, {3918,none,1,0}, {3919,662,0,2},
+    {3919,none,16,0}, {3935,none,1,0}, {3936,none,1,0}, {3937,none,1,0}, {3938,none,1,0}, {3939,none,1,0}, {3940,664,0,1},
+    {3940,none,1,0}, {3941,none,1,0}, {3942,none,1,0}, {3943,none,1,0}, {3944,none,1,0}, {3945,665,0,1}, {3945,none,6,0},
+    {3951,666,0,1}, {3951,none,1,0}, {3952,667,0,2}, {3952,none,1,0}, {3953,669,0,1}, {3953,none,1,0}, {3954,none,1,0},
+    {3955,none,1,0}, {3956,670,0,1}, {3956,none,1,0}, {3957,none,1,0}, {3958,none,1,0}, {3959,3,0,1}, {3959,none,1,0},
+    {3960,671,0,1}, {3960,none,1,0}, {3961,none,1,0}, {3962,none,1,0}, {3963,none,1,0}, {3964,672,0,1}, {3964,none,2,0},
+    {3966,60,0,1}, {3966,none,1,0}, {3967,673,0,2}, {3967,none,1,0}, {3968,none,1,0}, {3969,none,1,0}, {3970,none,1,0},
+    {3971,none,1,0}, {3972,675,0,1}, {3972,none,2,0}, {3974,none,2,0}, {3976,none,1,0}, {3977,none,1,0}, {3978,none,1,0},
+    {3979,none,1,0}, {3980,676,0,1}, {3980,none,1,0}, {3981,none,1,0}, {3982,676,0,1}, {3982,none,1,0}, {3983,none,1,0},
+    {3984,none,1,0}, {3985,677,0,1}, {3985,none,2,0}, {3987,none,2,0}, {3989,none,1,0}, {3990,none,1,0}, {3991,678,0,1},
+    {3991,none,1,0}, {3992,none,1,0}, {3993,679,0,1}, {3993,none,1,0}, {3994,46,0,1}, {3994,none,2,0}, {3996,none,5,0},
+    {4001,680,0,1}, {4001,none,1,0}, {4002,none,1,0}, {4003,none,1,0}, {4004,681,0,1}, {4004,none,1,0}, {4005,682,0,1},
+    {4005,none,1,0}, {4006,none,1,0}, {4007,none,1,0}, {4008,none,1,0}, {4009,none,1,0}, {4010,683,0,1}, {4010,none,1,0},
+    {4011,684,0,1}, {4011,none,7,0}, {4018,685,0,1}, {4018,none,1,0}, {4019,686,0,1}, {4019,none,1,0}, {4020,none,1,0},
+    {4021,685,0,1}, {4021,none,1,0}, {4022,none,1,0}, {4023,none,2,0}, {4025,687,0,1}, {4025,none,8,0}, {4033,none,1,0},
+    {4034,688,0,1}, {4034,none,1,0}, {4035,689,0,1}, {4035,none,1,0}, {4036,690,0,1}, {4036,none,1,0}, {4037,691,0,1},
+    {4037,none,1,0}, {4038,692,0,1}, {4038,none,1,0}, {4039,693,0,1}, {4039,none,1,0}, {4040,694,0,1}, {4040,none,1,0},
+    {4041,695,0,1}, {4041,none,1,0}, {4042,none,2,0}, {4044,696,0,1}, {4044,none,1,0}, {4045,none,2,0}, {4047,697,0,1},
+    {4047,none,1,0}, {4048,698,0,1}, {4048,none,2,0}, {4050,none,1,0}, {4051,none,1,0}, {4052,699,0,1}, {4052,none,1,0},
+    {4053,61,0,1}, {4053,none,1,0}, {4054,none,1,0}, {4055,none,1,0}, {4056,none,1,0}, {4057,700,0,1}, {4057,none,2,0},
+    {4059,none,1,0}, {4060,none,1,0}, {4061,none,1,0}, {4062,701,0,1}, {4062,none,1,0}, {4063,none,1,0}, {4064,702,0,2},
+    {4064,none,7,0}, {4071,565,0,1}, {4071,none,1,0}, {4072,704,0,1}, {4072,none,1,0}, {4073,none,1,0}, {4074,none,1,0},
+    {4075,none,1,0}, {4076,705,0,1}, {4076,none,1,0}, {4077,706,0,1}, {4077,none,1,0}, {4078,none,1,0}, {4079,707,0,1},
+    {4079,none,1,0}, {4080,none,1,0}, {4081,708,0,1}, {4081,none,1,0}, {4082,none,1,0}, {4083,none,1,0}, {4084,none,2,0},
+    {4086,565,0,1}, {4086,none,1,0}, {4087,none,1,0}, {4088,706,0,1}, {4088,none,1,0}, {4089,none,1,0}, {4090,none,1,0},
+    {4091,none,1,0}, {4092,709,0,1}, {4092,none,3,0}, {4095,none,1,0}, {4096,none,1,0}, {4097,710,0,2}, {4097,none,1,0},
+    {4098,712,0,1}, {4098,none,1,0}, {4099,none,1,0}, {4100,none,2,0}, {4102,565,0,1}, {4102,none,1,0}, {4103,none,1,0},
+    {4104,110,0,1}, {4104,none,1,0}, {4105,none,1,0}, {4106,none,1,0}, {4107,none,1,0}, {4108,none,1,0}, {4109,713,0,1},
+    {4109,none,1,0}, {4110,none,1,0}, {4111,none,1,0}, {4112,714,0,1}, {4112,none,2,0}, {4114,none,1,0}, {4115,none,1,0},
+    {4116,none,1,0}, {4117,none,1,0}, {4118,none,1,0}, {4119,none,1,0}, {4120,105,0,1}, {4120,none,1,0}, {4121,none,1,0},
+    {4122,none,1,0}, {4123,715,0,1}, {4123,none,16,0}, {4139,none,1,0}, {4140,none,1,0}, {4141,none,1,0}, {4142,716,0,1},
+    {4142,none,2,0}, {4144,none,1,0}, {4145,none,4,0}, {4149,none,1,0}, {4150,none,1,0}, {4151,none,1,0}, {4152,none,1,0},
+    {4153,717,0,1}, {4153,none,1,0}, {4154,none,1,0}, {4155,none,1,0}, {4156,none,1,0}, {4157,none,1,0}, {4158,none,1,0},
+    {4159,none,1,0}, {4160,718,0,1}, {4160,none,1,0}, {4161,none,1,0}, {4162,none,1,0}, {4163,none,1,0}, {4164,none,1,0},
+    {4165,719,0,1}, {4165,none,1,0}, {4166,none,1,0}, {4167,none,2,0}, {4169,720,0,1}, {4169,none,1,0}, {4170,none,1,0},
+    {4171,721,0,1}, {4171,none,2,0}, {4173,none,1,0}, {4174,none,1,0}, {4175,none,1,0}, {4176,722,0,1}, {4176,none,1,0},
+    {4177,none,1,0}, {4178,none,2,0}, {4180,723,0,1}, {4180,none,1,0}, {4181,none,1,0}, {4182,723,0,1}, {4182,none,1,0},
+    {4183,none,1,0}, {4184,none,2,0}, {4186,586,0,1}, {4186,none,1,0}, {4187,none,1,0}, {4188,none,1,0}, {4189,none,1,0},
+    {4190,724,0,1}, {4190,none,2,0}, {4192,none,1,0}, {4193,none,1,0}, {4194,none,1,0}, {4195,717,0,1}, {4195,none,1,0},
+    {4196,725,0,1}, {4196,none,1,0}, {4197,none,1,0}, {4198,none,1,0}, {4199,none,1,0}, {4200,34,0,1}, {4200,none,5,0},
+    {4205,none,1,0}, {4206,none,1,0}, {4207,none,1,0}, {4208,none,2,0}, {4210,71,0,1}, {4210,none,1,0}, {4211,71,0,1},
+    {4211,none,1,0}, {4212,none,1,0}, {4213,none,1,0}, {4214,none,1,0}, {4215,none,1,0}, {4216,726,0,1}, {4216,none,1,0},
+    {4217,none,1,0}, {4218,none,1,0}, {4219,718,0,1}, {4219,none,1,0}, {4220,none,1,0}, {4221,none,1,0}, {4222,none,1,0},
+    {4223,72,0,1}, {4223,none,3,0}, {4226,none,1,0}, {4227,727,0,1}, {4227,none,1,0}, {4228,728,0,1}, {4228,none,1,0},
+    {4229,none,1,0}, {4230,none,1,0}, {4231,none,1,0}, {4232,729,0,1}, {4232,none,1,0}, {4233,none,1,0}, {4234,730,0,2},
+    {4234,none,1,0}, {4235,none,7,0}, {4242,none,3,0}, {4245,none,1,0}, {4246,none,1,0}, {4247,239,0,1}, {4247,none,1,0},
+    {4248,none,1,0}, {4249,none,1,0}, {4250,732,0,1}, {4250,none,1,0}, {4251,none,1,0}, {4252,588,0,1}, {4252,none,3,0},
+    {4255,none,1,0}, {4256,none,1,0}, {4257,none,1,0}, {4258,733,0,1}, {4258,none,1,0}, {4259,none,1,0}, {4260,none,1,0},
+    {4261,none,1,0}, {4262,734,0,1}, {4262,none,1,0}, {4263,none,1,0}, {4264,none,1,0}, {4265,none,1,0}, {4266,none,1,0},
+    {4267,735,0,1}, {4267,none,2,0}, {4269,none,1,0}, {4270,none,1,0}, {4271,none,1,0}, {4272,none,1,0}, {4273,736,0,1},
+    {4273,none,1,0}, {4274,none,1,0}, {4275,none,1,0}, {4276,737,0,1}, {4276,none,1,0}, {4277,none,1,0}, {4278,none,1,0},
+    {4279,none,1,0}, {4280,none,1,0}, {4281,none,1,0}, {4282,none,1,0}, {4283,none,2,0}, {4285,none,1,0}, {4286,none,1,0},
+    {4287,none,1,0}, {4288,none,1,0}, {4289,738,0,1}, {4289,none,1,0}, {4290,none,1,0}, {4291,739,0,1}, {4291,none,1,0},
+    {4292,none,1,0}, {4293,none,1,0}, {4294,none,1,0}, {4295,none,1,0}, {4296,740,0,1}, {4296,none,1,0}, {4297,none,1,0},
+    {4298,none,1,0}, {4299,613,0,1}, {4299,none,1,0}, {4300,none,1,0}, {4301,none,1,0}, {4302,none,1,0}, {4303,none,1,0},
+    {4304,627,0,1}, {4304,none,1,0}, {4305,none,1,0}, {4306,none,1,0}, {4307,none,1,0}, {4308,none,1,0}, {4309,741,0,1},
+    {4309,none,3,0}, {4312,none,2,0}, {4314,none,1,0}, {4315,none,3,0}, {4318,none,1,0}, {4319,none,1,0}, {4320,none,1,0},
+    {4321,none,1,0}, {4322,none,1,0}, {4323,none,1,0}, {4324,none,1,0}, {4325,742,0,1}, {4325,none,1,0}, {4326,none,1,0},
+    {4327,none,1,0}, {4328,none,1,0}, {4329,none,1,0}, {4330,none,1,0}, {4331,188,0,1}, {4331,none,1,0}, {4332,none,1,0},
+    {4333,none,1,0}, {4334,none,1,0}, {4335,none,1,0}, {4336,none,1,0}, {4337,none,1,0}, {4338,none,4,0}, {4342,743,0,1},
+    {4342,none,1,0}, {4343,none,1,0}, {4344,none,1,0}, {4345,none,1,0}, {4346,744,0,1}, {4346,none,1,0}, {4347,none,1,0},
+    {4348,none,1,0}, {4349,none,1,0}, {4350,745,0,1}, {4350,none,1,0}, {4351,none,1,0}, {4352,none,1,0}, {4353,none,1,0},
+    {4354,none,1,0}, {4355,746,0,1}, {4355,none,1,0}, {4356,none,1,0}, {4357,747,0,1}, {4357,none,2,0}, {4359,none,2,0},
+    {4361,none,1,0}, {4362,748,0,1}, {4362,none,1,0}, {4363,749,0,1}, {4363,none,1,0}, {4364,none,1,0}, {4365,750,0,1},
+    {4365,none,1,0}, {4366,none,1,0}, {4367,none,1,0}, {4368,751,0,1}, {4368,none,2,0}, {4370,none,2,0}, {4372,752,0,2},
+    {4372,none,1,0}, {4373,none,1,0}, {4374,none,1,0}, {4375,none,1,0}, {4376,754,0,2}, {4376,none,1,0}, {4377,none,1,0},
+    {4378,756,0,1}, {4378,none,4,0}, {4382,none,1,0}, {4383,none,1,0}, {4384,757,0,2}, {4384,none,2,0}, {4386,597,0,1},
+    {4386,none,1,0}, {4387,none,1,0}, {4388,none,1,0}, {4389,597,0,1}, {4389,none,1,0}, {4390,none,1,0}, {4391,none,1,0},
+    {4392,none,1,0}, {4393,759,0,1}, {4393,none,12,0}, {4405,none,4,0}, {4409,none,1,0}, {4410,760,0,1}, {4410,none,1,0},
+    {4411,761,0,1}, {4411,none,1,0}, {4412,762,0,1}, {4412,none,1,0}, {4413,763,0,1}, {4413,none,5,0}, {4418,764,0,1},
+    {4418,none,1,0}, {4419,765,0,1}, {4419,none,1,0}, {4420,766,0,1}, {4420,none,1,0}, {4421,767,0,1}, {4421,none,1,0},
+    {4422,768,0,1}, {4422,none,4,0}, {4426,none,1,0}, {4427,769,0,1}, {4427,none,1,0}, {4428,770,0,1}, {4428,none,1,0},
+    {4429,771,0,1}, {4429,none,1,0}, {4430,772,0,1}, {4430,none,7,0}, {4437,773,0,1}, {4437,none,1,0}, {4438,774,0,1},
+    {4438,none,1,0}, {4439,775,0,1}, {4439,none,1,0}, {4440,776,0,1}, {4440,none,1,0}, {4441,777,0,1}, {4441,none,1,0},
+    {4442,778,0,1}, {4442,none,1,0}, {4443,779,0,1}, {4443,none,1,0}, {4444,none,1,0}, {4445,none,1,0}, {4446,780,0,1},
+    {4446,none,4,0}, {4450,none,1,0}, {4451,781,0,1}, {4451,none,1,0}, {4452,782,0,1}, {4452,none,1,0}, {4453,783,0,1},
+    {4453,none,1,0}, {4454,784,0,1}, {4454,none,5,0}, {4459,223,0,1}, {4459,none,1,0}, {4460,785,0,1}, {4460,none,1,0},
+    {4461,786,0,1}, {4461,none,1,0}, {4462,787,0,1}, {4462,none,1,0}, {4463,788,0,1}, {4463,none,1,0}, {4464,none,1,0},
+    {4465,none,1,0}, {4466,none,1,0}, {4467,none,1,0}, {4468,789,0,1}, {4468,none,1,0}, {4469,none,1,0}, {4470,none,1,0},
+    {4471,none,1,0}, {4472,790,0,1}, {4472,none,1,0}, {4473,none,1,0}, {4474,none,1,0}, {4475,none,1,0}, {4476,none,1,0},
+    {4477,791,0,1}, {4477,none,4,0}, {4481,none,1,0}, {4482,792,0,1}, {4482,none,1,0}, {4483,793,0,1}, {4483,none,1,0},
+    {4484,794,0,1}, {4484,none,1,0}, {4485,795,0,1}, {4485,none,7,0}, {4492,796,0,1}, {4492,none,1,0}, {4493,797,0,1},
+    {4493,none,1,0}, {4494,798,0,1}, {4494,none,1,0}, {4495,799,0,1}, {4495,none,1,0}, {4496,800,0,1}, {4496,none,1,0},
+    {4497,801,0,1}, {4497,none,1,0}, {4498,802,0,1}, {4498,none,1,0}, {4499,none,1,0}, {4500,none,1,0}, {4501,none,1,0},
+    {4502,none,1,0}, {4503,719,0,1}, {4503,none,2,0}, {4505,none,1,0}, {4506,none,1,0}, {4507,none,1,0}, {4508,4,0,1},
+    {4508,none,1,0}, {4509,none,1,0}, {4510,none,1,0}, {4511,none,1,0}, {4512,803,0,1}, {4512,none,4,0}, {4516,none,1,0},
+    {4517,none,1,0}, {4518,804,0,2}, {4518,none,1,0}, {4519,none,1,0}, {4520,none,1,0}, {4521,806,0,1}, {4521,none,1,0},
+    {4522,none,2,0}, {4524,720,0,1}, {4524,none,1,0}, {4525,721,0,1}, {4525,none,1,0}, {4526,none,3,0}, {4529,807,0,1},
+    {4529,none,1,0}, {4530,808,0,1}, {4530,none,1,0}, {4531,none,1,0}, {4532,none,1,0}, {4533,none,1,0}, {4534,809,0,1},
+    {4534,none,2,0}, {4536,none,1,0}, {4537,none,2,0}, {4539,810,0,1}, {4539,none,1,0}, {4540,none,1,0}, {4541,810,0,1},
+    {4541,none,1,0}, {4542,none,3,0}, {4545,78,0,1}, {4545,none,1,0}, {4546,811,0,1}, {4546,none,2,0}, {4548,225,0,1},
+    {4548,none,1,0}, {4549,225,0,1}, {4549,none,15,0}, {4564,none,3,0}, {4567,none,1,0}, {4568,none,1,0}, {4569,none,1,0},
+    {4570,none,1,0}, {4571,812,0,1}, {4571,none,6,0}, {4577,813,0,1}, {4577,none,1,0}, {4578,none,1,0}, {4579,none,1,0},
+    {4580,814,0,1}, {4580,none,1,0}, {4581,none,1,0}, {4582,none,1,0}, {4583,none,1,0}, {4584,none,1,0}, {4585,815,0,1},
+    {4585,none,2,0}, {4587,none,1,0}, {4588,none,1,0}, {4589,816,0,1}, {4589,none,1,0}, {4590,none,1,0}, {4591,817,0,1},
+    {4591,none,1,0}, {4592,none,1,0}, {4593,none,1,0}, {4594,818,0,1}, {4594,none,1,0}, {4595,819,0,2}, {4595,none,2,0},
+    {4597,none,1,0}, {4598,none,1,0}, {4599,821,0,1}, {4599,none,1,0}, {4600,none,1,0}, {4601,14,0,1}, {4601,none,4,0},
+    {4605,none,2,0}, {4607,none,1,0}, {4608,none,1,0}, {4609,822,0,1}, {4609,none,1,0}, {4610,none,1,0}, {4611,none,1,0},
+    {4612,823,0,1}, {4612,none,1,0}, {4613,none,1,0}, {4614,none,1,0}, {4615,none,1,0}, {4616,824,0,1}, {4616,none,1,0},
+    {4617,none,1,0}, {4618,none,1,0}, {4619,825,0,1}, {4619,none,1,0}, {4620,none,1,0}, {4621,none,2,0}, {4623,826,0,1},
+    {4623,none,1,0}, {4624,none,1,0}, {4625,827,0,1}, {4625,none,1,0}, {4626,none,1,0}, {4627,none,1,0}, {4628,828,0,1},
+    {4628,none,3,0}, {4631,none,1,0}, {4632,none,1,0}, {4633,none,1,0}, {4634,6,0,1}, {4634,none,1,0}, {4635,none,1,0},
+    {4636,none,1,0}, {4637,none,1,0}, {4638,none,1,0}, {4639,829,0,1}, {4639,none,1,0}, {4640,none,2,0}, {4642,830,0,1},
+    {4642,none,1,0}, {4643,none,1,0}, {4644,none,1,0}, {4645,none,1,0}, {4646,none,1,0}, {4647,90,0,1}, {4647,none,1,0},
+    {4648,none,1,0}, {4649,831,0,2}, {4649,none,3,0}, {4652,none,1,0}, {4653,none,1,0}, {4654,833,0,1}, {4654,none,1,0},
+    {4655,none,1,0}, {4656,none,2,0}, {4658,834,0,1}, {4658,none,1,0}, {4659,none,1,0}, {4660,none,1,0}, {4661,none,1,0},
+    {4662,834,0,1}, {4662,none,1,0}, {4663,835,0,1}, {4663,none,1,0}, {4664,none,7,0}, {4671,836,0,1}, {4671,none,1,0},
+    {4672,837,0,1}, {4672,none,3,0}, {4675,19,0,1}, {4675,none,1,0}, {4676,none,1,0}, {4677,838,0,1}, {4677,none,1,0},
+    {4678,none,2,0}, {4680,none,1,0}, {4681,none,1,0}, {4682,none,1,0}, {4683,none,1,0}, {4684,none,2,0}, {4686,none,1,0},
+    {4687,none,1,0}, {4688,none,1,0}, {4689,none,1,0}, {4690,839,0,1}, {4690,none,1,0}, {4691,none,1,0}, {4692,none,1,0},
+    {4693,none,1,0}, {4694,none,1,0}, {4695,840,0,1}, {4695,none,5,0}, {4700,none,1,0}, {4701,471,0,1}, {4701,none,1,0},
+    {4702,841,0,1}, {4702,none,1,0}, {4703,none,1,0}, {4704,none,1,0}, {4705,842,0,1}, {4705,none,1,0}, {4706,none,1,0},
+    {4707,none,1,0}, {4708,none,1,0}, {4709,843,0,1}, {4709,none,1,0}, {4710,none,1,0}, {4711,none,1,0}, {4712,none,1,0},
+    {4713,844,0,1}, {4713,none,1,0}, {4714,838,0,1}, {4714,none,1,0}, {4715,none,1,0}, {4716,none,1,0}, {4717,none,1,0},
+    {4718,none,1,0}, {4719,845,0,1}, {4719,none,1,0}, {4720,none,1,0}, {4721,none,1,0}, {4722,846,0,1}, {4722,none,1,0},
+    {4723,none,1,0}, {4724,none,1,0}, {4725,none,1,0}, {4726,847,0,1}, {4726,none,1,0}, {4727,none,1,0}, {4728,none,1,0},
+    {4729,none,2,0}, {4731,848,0,1}, {4731,none,1,0}, {4732,none,1,0}, {4733,none,1,0}, {4734,848,0,1}, {4734,none,4,0},
+    {4738,none,1,0}, {4739,none,1,0}, {4740,none,2,0}, {4742,849,0,1}, {4742,none,2,0}, {4744,64,0,1}, {4744,none,1,0},
+    {4745,64,0,1}, {4745,none,2,0}, {4747,none,1,0}, {4748,none,2,0}, {4750,850,0,1}, {4750,none,1,0}, {4751,851,0,1},
+    {4751,none,3,0}, {4754,852,0,1}, {4754,none,1,0}, {4755,none,1,0}, {4756,523,0,1}, {4756,none,1,0}, {4757,none,2,0},
+    {4759,none,1,0}, {4760,none,1,0}, {4761,none,1,0}, {4762,none,1,0}, {4763,852,0,1}, {4763,none,1,0}, {4764,none,1,0},
+    {4765,none,1,0}, {4766,103,0,1}, {4766,none,2,0}, {4768,none,2,0}, {4770,564,0,1}, {4770,none,1,0}, {4771,none,1,0},
+    {4772,none,1,0}, {4773,853,0,1}, {4773,none,1,0}, {4774,none,1,0}, {4775,none,1,0}, {4776,102,0,1}, {4776,none,3,0},
+    {4779,none,1,0}, {4780,854,0,2}, {4780,none,1,0}, {4781,none,1,0}, {4782,none,1,0}, {4783,104,0,1}, {4783,none,2,0},
+    {4785,80,0,1}, {4785,none,1,0}, {4786,none,1,0}, {4787,856,0,1}, {4787,none,2,0}, {4789,none,1,0}, {4790,none,1,0},
+    {4791,none,1,0}, {4792,857,0,1}, {4792,none,1,0}, {4793,none,1,0}, {4794,none,1,0}, {4795,858,0,1}, {4795,none,2,0},
+    {4797,none,1,0}, {4798,none,1,0}, {4799,859,0,2}, {4799,none,2,0}, {4801,none,2,0}, {4803,861,0,1}, {4803,none,1,0},
+    {4804,862,0,1}, {4804,none,2,0}, {4806,863,0,1}, {4806,none,1,0}, {4807,864,0,1}, {4807,none,1,0}, {4808,none,1,0},
+    {4809,none,1,0}, {4810,none,1,0}, {4811,865,0,1}, {4811,none,7,0}, {4818,none,1,0}, {4819,none,1,0}, {4820,none,1,0},
+    {4821,none,2,0}, {4823,none,1,0}, {4824,866,0,1}, {4824,none,1,0}, {4825,867,0,1}, {4825,none,2,0}, {4827,none,1,0},
+    {4828,none,1,0}, {4829,868,0,1}, {4829,none,1,0}, {4830,none,1,0}, {4831,869,0,1}, {4831,none,1,0}, {4832,none,1,0},
+    {4833,none,1,0}, {4834,none,2,0}, {4836,870,0,1}, {4836,none,1,0}, {4837,871,0,1}, {4837,none,6,0}, {4843,872,0,1},
+    {4843,none,1,0}, {4844,none,1,0}, {4845,none,1,0}, {4846,none,1,0}, {4847,none,1,0}, {4848,873,0,1}, {4848,none,2,0},
+    {4850,none,1,0}, {4851,none,1,0}, {4852,874,0,1}, {4852,none,1,0}, {4853,none,1,0}, {4854,875,0,1}, {4854,none,1,0},
+    {4855,none,1,0}, {4856,none,1,0}, {4857,876,0,1}, {4857,none,1,0}, {4858,none,1,0}, {4859,877,0,1}, {4859,none,1,0},
+    {4860,878,0,2}, {4860,none,4,0}, {4864,none,1,0}, {4865,none,1,0}, {4866,none,2,0}, {4868,880,0,1}, {4868,none,1,0},
+    {4869,881,0,1}, {4869,none,1,0}, {4870,none,3,0}, {4873,none,1,0}, {4874,none,2,0}, {4876,none,1,0}, {4877,none,1,0},
+    {4878,none,1,0}, {4879,none,1,0}, {4880,868,0,1}, {4880,none,1,0}, {4881,none,1,0}, {4882,none,1,0}, {4883,none,1,0},
+    {4884,869,0,1}, {4884,none,1,0}, {4885,none,1,0}, {4886,none,1,0}, {4887,882,0,1}, {4887,none,1,0}, {4888,none,1,0},
+    {4889,none,1,0}, {4890,none,1,0}, {4891,none,1,0}, {4892,883,0,1}, {4892,none,1,0}, {4893,none,1,0}, {4894,none,1,0},
+    {4895,884,0,1}, {4895,none,1,0}, {4896,none,1,0}, {4897,none,1,0}, {4898,none,1,0}, {4899,none,1,0}, {4900,none,1,0},
+    {4901,none,2,0}, {4903,none,1,0}, {4904,none,1,0}, {4905,none,1,0}, {4906,none,1,0}, {4907,870,0,1}, {4907,none,1,0},
+    {4908,none,1,0}, {4909,none,1,0}, {4910,none,1,0}, {4911,none,1,0}, {4912,880,0,1}, {4912,none,1,0}, {4913,none,1,0},
+    {4914,none,1,0}, {4915,882,0,1}, {4915,none,1,0}, {4916,none,1,0}, {4917,none,1,0}, {4918,883,0,1}, {4918,none,2,0},
+    {4920,none,1,0}, {4921,none,1,0}, {4922,none,1,0}, {4923,none,1,0}, {4924,none,1,0}, {4925,none,1,0}, {4926,96,0,1},
+    {4926,none,1,0}, {4927,none,1,0}, {4928,none,1,0}, {4929,885,0,1}, {4929,none,1,0}, {4930,none,1,0}, {4931,none,1,0},
+    {4932,none,1,0}, {4933,none,1,0}, {4934,886,0,1}, {4934,none,19,0}, {4953,none,1,0}, {4954,none,1,0}, {4955,none,1,0},
+    {4956,131,0,1}, {4956,none,1,0}, {4957,none,1,0}, {4958,none,1,0}, {4959,887,0,1}, {4959,none,4,0}, {4963,none,1,0},
+    {4964,none,1,0}, {4965,none,1,0}, {4966,none,1,0}, {4967,888,0,1}, {4967,none,1,0}, {4968,none,1,0}, {4969,none,1,0},
+    {4970,none,1,0}, {4971,889,0,1}, {4971,none,1,0}, {4972,none,1,0}, {4973,15,0,1}, {4973,none,1,0}, {4974,none,2,0},
+    {4976,890,0,1}, {4976,none,1,0}, {4977,292,0,1}, {4977,none,2,0}, {4979,none,1,0}, {4980,none,1,0}, {4981,none,1,0},
+    {4982,none,1,0}, {4983,none,1,0}, {4984,891,0,1}, {4984,none,1,0}, {4985,none,1,0}, {4986,none,1,0}, {4987,124,0,1},
+    {4987,none,2,0}, {4989,none,1,0}, {4990,none,1,0}, {4991,none,1,0}, {4992,none,1,0}, {4993,892,0,1}, {4993,none,1,0},
+    {4994,893,0,1}, {4994,none,3,0}, {4997,126,0,1}, {4997,none,2,0}, {4999,none,1,0}, {5000,none,1,0}, {5001,none,1,0},
+    {5002,none,1,0}, {5003,115,0,1}, {5003,none,1,0}, {5004,none,1,0}, {5005,894,0,1}, {5005,none,1,0}, {5006,none,1,0},
+    {5007,none,1,0}, {5008,none,1,0}, {5009,none,1,0}, {5010,895,0,1}, {5010,none,3,0}, {5013,none,1,0}, {5014,896,0,1},
+    {5014,none,1,0}, {5015,none,1,0}, {5016,none,1,0}, {5017,897,0,1}, {5017,none,1,0}, {5018,none,1,0}, {5019,none,1,0},
+    {5020,none,1,0}, {5021,none,1,0}, {5022,898,0,1}, {5022,none,2,0}, {5024,none,1,0}, {5025,none,1,0}, {5026,none,1,0},
+    {5027,none,1,0}, {5028,899,0,1}, {5028,none,1,0}, {5029,900,0,2}, {5029,none,1,0}, {5030,none,1,0}, {5031,none,2,0},
+    {5033,none,1,0}, {5034,287,0,1}, {5034,none,1,0}, {5035,490,0,1}, {5035,none,5,0}, {5040,none,1,0}, {5041,none,3,0},
+    {5044,125,0,1}, {5044,none,1,0}, {5045,none,1,0}, {5046,none,2,0}, {5048,125,0,1}, {5048,none,1,0}, {5049,none,1,0},
+    {5050,none,1,0}, {5051,none,1,0}, {5052,902,0,1}, {5052,none,1,0}, {5053,902,0,1}, {5053,none,1,0}, {5054,2,0,1},
+    {5054,none,1,0}, {5055,none,1,0}, {5056,none,1,0}, {5057,none,1,0}, {5058,none,1,0}, {5059,903,0,1}, {5059,none,1,0},
+    {5060,none,1,0}, {5061,none,1,0}, {5062,904,0,1}, {5062,none,3,0}, {5065,905,0,1}, {5065,none,1,0}, {5066,none,1,0},
+    {5067,none,2,0}, {5069,905,0,1}, {5069,none,1,0}, {5070,none,1,0}, {5071,none,1,0}, {5072,none,1,0}, {5073,none,1,0},
+    {5074,none,1,0}, {5075,none,1,0}, {5076,906,0,1}, {5076,none,1,0}, {5077,none,1,0}, {5078,none,1,0}, {5079,906,0,1},
+    {5079,none,1,0}, {5080,none,1,0}, {5081,none,1,0}, {5082,907,0,1}, {5082,none,1,0}, {5083,none,2,0}, {5085,none,1,0},
+    {5086,none,1,0}, {5087,none,1,0}, {5088,908,0,1}, {5088,none,1,0}, {5089,none,1,0}, {5090,none,1,0}, {5091,909,0,1},
+    {5091,none,5,0}, {5096,none,1,0}, {5097,none,1,0}, {5098,none,1,0}, {5099,none,1,0}, {5100,910,0,1}, {5100,none,1,0},
+    {5101,none,1,0}, {5102,911,0,2}, {5102,none,5,0}, {5107,8,0,1}, {5107,none,1,0}, {5108,none,2,0}, {5110,130,0,1},
+    {5110,none,1,0}, {5111,none,1,0}, {5112,none,1,0}, {5113,913,0,1}, {5113,none,1,0}, {5114,none,1,0}, {5115,none,1,0},
+    {5116,none,1,0}, {5117,none,1,0}, {5118,914,0,1}, {5118,none,1,0}, {5119,none,1,0}, {5120,none,1,0}, {5121,none,1,0},
+    {5122,915,0,1}, {5122,none,1,0}, {5123,none,1,0}, {5124,none,1,0}, {5125,none,1,0}, {5126,none,1,0}, {5127,none,1,0},
+    {5128,916,0,1}, {5128,none,1,0}, {5129,none,1,0}, {5130,none,1,0}, {5131,none,1,0}, {5132,none,1,0}, {5133,none,1,0},
+    {5134,none,1,0}, {5135,none,1,0}, {5136,none,1,0}, {5137,none,1,0}, {5138,none,1,0}, {5139,none,1,0}, {5140,69,0,1},
+    {5140,none,1,0}, {5141,none,3,0}, {5144,none,1,0}, {5145,none,1,0}, {5146,none,1,0}, {5147,none,1,0}, {5148,none,1,0},
+    {5149,15,0,1}, {5149,none,1,0}, {5150,none,1,0}, {5151,none,1,0}, {5152,none,1,0}, {5153,none,1,0}, {5154,none,1,0},
+    {5155,none,1,0}, {5156,none,1,0}, {5157,none,1,0}, {5158,none,1,0}, {5159,894,0,1}, {5159,none,1,0}, {5160,none,1,0},
+    {5161,none,1,0}, {5162,none,1,0}, {5163,none,1,0}, {5164,none,1,0}, {5165,none,2,0}, {5167,none,1,0}, {5168,none,1,0},
+    {5169,none,1,0}, {5170,none,1,0}, {5171,287,0,1}, {5171,none,1,0}, {5172,none,1,0}, {5173,none,1,0}, {5174,none,1,0},
+    {5175,none,1,0}, {5176,490,0,1}, {5176,none,2,0}, {5178,none,1,0}, {5179,none,1,0}, {5180,none,1,0}, {5181,none,1,0},
+    {5182,none,1,0}, {5183,none,1,0}, {5184,470,0,1}, {5184,none,2,0}, {5186,none,1,0}, {5187,none,1,0}, {5188,none,1,0},
+    {5189,917,0,1}, {5189,none,1,0}, {5190,none,1,0}, {5191,none,1,0}, {5192,918,0,1}, {5192,none,3,0}, {5195,none,2,0},
+    {5197,none,1,0}, {5198,919,0,2}, {5198,none,1,0}, {5199,921,0,1}, {5199,none,1,0}, {5200,none,1,0}, {5201,922,0,1},
+    {5201,none,1,0}, {5202,none,1,0}, {5203,none,1,0}, {5204,none,1,0}, {5205,923,0,1}, {5205,none,2,0}, {5207,none,1,0},
+    {5208,none,1,0}, {5209,none,1,0}, {5210,924,0,1}, {5210,none,1,0}, {5211,none,2,0}, {5213,925,0,1}, {5213,none,1,0},
+    {5214,744,0,1}, {5214,none,2,0}, {5216,none,1,0}, {5217,none,1,0}, {5218,none,1,0}, {5219,143,0,1}, {5219,none,1,0},
+    {5220,none,1,0}, {5221,none,1,0}, {5222,482,0,1}, {5222,none,1,0}, {5223,none,1,0}, {5224,none,1,0}, {5225,none,1,0},
+    {5226,none,1,0}, {5227,none,1,0}, {5228,926,0,1}, {5228,none,2,0}, {5230,none,1,0}, {5231,none,1,0}, {5232,927,0,1},
+    {5232,none,1,0}, {5233,none,1,0}, {5234,none,1,0}, {5235,none,1,0}, {5236,none,1,0}, {5237,none,1,0}, {5238,928,0,1},
+    {5238,none,18,0}, {5256,none,2,0}, {5258,none,1,0}, {5259,none,1,0}, {5260,none,1,0}, {5261,895,0,1}, {5261,none,1,0},
+    {5262,none,1,0}, {5263,913,0,1}, {5263,none,2,0}, {5265,none,1,0}, {5266,none,1,0}, {5267,none,1,0}, {5268,none,1,0},
+    {5269,929,0,1}, {5269,none,1,0}, {5270,none,1,0}, {5271,none,1,0}, {5272,none,1,0}, {5273,930,0,1}, {5273,none,4,0},
+    {5277,none,1,0}, {5278,none,1,0}, {5279,none,1,0}, {5280,none,1,0}, {5281,931,0,1}, {5281,none,1,0}, {5282,none,2,0},
+    {5284,932,0,1}, {5284,none,1,0}, {5285,933,0,1}, {5285,none,1,0}, {5286,none,1,0}, {5287,none,1,0}, {5288,none,1,0},
+    {5289,934,0,1}, {5289,none,1,0}, {5290,935,0,1}, {5290,none,1,0}, {5291,none,1,0}, {5292,none,1,0}, {5293,936,0,1},
+    {5293,none,1,0}, {5294,183,0,1}, {5294,none,2,0}, {5296,none,1,0}, {5297,none,1,0}, {5298,none,1,0}, {5299,937,0,1},
+    {5299,none,1,0}, {5300,938,0,2}, {5300,none,3,0}, {5303,940,0,1}, {5303,none,1,0}, {5304,none,1,0}, {5305,none,1,0},
+    {5306,none,1,0}, {5307,941,0,1}, {5307,none,2,0}, {5309,942,0,1}, {5309,none,1,0}, {5310,none,1,0}, {5311,none,1,0},
+    {5312,943,0,1}, {5312,none,4,0}, {5316,944,0,1}, {5316,none,1,0}, {5317,none,1,0}, {5318,none,1,0}, {5319,none,1,0},
+    {5320,none,1,0}, {5321,none,1,0}, {5322,945,0,1}, {5322,none,1,0}, {5323,946,0,1}, {5323,none,2,0}, {5325,947,0,1},
+    {5325,none,1,0}, {5326,none,1,0}, {5327,none,1,0}, {5328,948,0,1}, {5328,none,3,0}, {5331,none,1,0}, {5332,none,1,0},
+    {5333,none,1,0}, {5334,949,0,1}, {5334,none,1,0}, {5335,none,1,0}, {5336,none,3,0}, {5339,950,0,1}, {5339,none,1,0},
+    {5340,none,1,0}, {5341,none,1,0}, {5342,950,0,1}, {5342,none,1,0}, {5343,950,0,1}, {5343,none,1,0}, {5344,none,2,0},
+    {5346,none,2,0}, {5348,none,1,0}, {5349,10,0,1}, {5349,none,1,0}, {5350,11,0,1}, {5350,23,0,1}, {5350,none,2,0}, {5352,none,1,0},
+    {5353,951,0,1}, {5353,none,1,0}, {5354,none,1,0}, {5355,24,0,1}, {5355,none,2,0}, {5357,none,1,0}, {5358,none,1,0},
+    {5359,none,1,0}, {5360,952,0,1}, {5360,none,1,0}, {5361,none,1,0}, {5362,953,0,2}, {5362,none,3,0}, {5365,none,1,0},
+    {5366,none,2,0}, {5368,955,0,1}, {5368,none,1,0}, {5369,none,1,0}, {5370,956,0,1}, {5370,none,1,0}, {5371,none,1,0},
+    {5372,none,1,0}, {5373,957,0,1}, {5373,none,1,0}, {5374,none,3,0}, {5377,958,0,1}, {5377,none,1,0}, {5378,none,1,0},
+    {5379,none,1,0}, {5380,958,0,1}, {5380,none,1,0}, {5381,959,0,1}, {5381,none,4,0}, {5385,none,2,0}, {5387,none,1,0},
+    {5388,none,1,0}, {5389,none,1,0}, {5390,932,0,1}, {5390,none,1,0}, {5391,none,1,0}, {5392,none,1,0}, {5393,none,1,0},
+    {5394,934,0,1}, {5394,none,2,0}, {5396,none,1,0}, {5397,none,1,0}, {5398,176,0,1}, {5398,none,1,0}, {5399,none,1,0},
+    {5400,none,1,0}, {5401,none,2,0}, {5403,none,1,0}, {5404,none,1,0}, {5405,none,1,0}, {5406,942,0,1}, {5406,none,1,0},
+    {5407,none,1,0}, {5408,none,1,0}, {5409,none,1,0}, {5410,947,0,1}, {5410,none,3,0}, {5413,none,1,0}, {5414,none,1,0},
+    {5415,none,1,0}, {5416,960,0,1}, {5416,none,1,0}, {5417,none,1,0}, {5418,none,1,0}, {5419,961,0,1}, {5419,none,1,0},
+    {5420,none,2,0}, {5422,100,0,1}, {5422,none,1,0}, {5423,none,1,0}, {5424,962,0,1}, {5424,none,1,0}, {5425,none,1,0},
+    {5426,none,1,0}, {5427,none,1,0}, {5428,none,1,0}, {5429,none,1,0}, {5430,963,0,1}, {5430,none,2,0}, {5432,none,1,0},
+    {5433,none,1,0}, {5434,none,1,0}, {5435,964,0,1}, {5435,none,1,0}, {5436,none,1,0}, {5437,none,1,0}, {5438,965,0,1},
+    {5438,none,3,0}, {5441,none,1,0}, {5442,none,1,0}, {5443,966,0,1}, {5443,none,1,0}, {5444,none,1,0}, {5445,none,1,0},
+    {5446,130,0,1}, {5446,none,1,0}, {5447,none,1,0}, {5448,176,0,1}, {5448,none,2,0}, {5450,none,1,0}, {5451,967,0,1},
+    {5451,none,1,0}, {5452,968,0,1}, {5452,none,2,0}, {5454,none,1,0}, {5455,none,1,0}, {5456,969,0,1}, {5456,none,1,0},
+    {5457,none,1,0}, {5458,970,0,1}, {5458,none,3,0}, {5461,none,1,0}, {5462,none,1,0}, {5463,971,0,1}, {5463,none,1,0},
+    {5464,none,1,0}, {5465,none,1,0}, {5466,182,0,1}, {5466,none,2,0}, {5468,none,1,0}, {5469,none,1,0}, {5470,none,1,0},
+    {5471,none,1,0}, {5472,none,1,0}, {5473,none,1,0}, {5474,none,1,0}, {5475,none,1,0}, {5476,178,0,1}, {5476,none,1,0},
+    {5477,none,1,0}, {5478,none,1,0}, {5479,none,1,0}, {5480,none,1,0}, {5481,none,1,0}, {5482,none,1,0}, {5483,none,1,0},
+    {5484,none,1,0}, {5485,183,0,1}, {5485,none,12,0}, {5497,none,1,0}, {5498,none,1,0}, {5499,none,1,0}, {5500,none,1,0},
+    {5501,none,1,0}, {5502,none,1,0}, {5503,none,1,0}, {5504,none,1,0}, {5505,none,1,0}, {5506,none,1,0}, {5507,none,1,0},
+    {5508,none,1,0}, {5509,937,0,1}, {5509,none,1,0}, {5510,none,1,0}, {5511,972,0,1}, {5511,none,1,0}, {5512,none,1,0},
+    {5513,none,1,0}, {5514,none,1,0}, {5515,none,1,0}, {5516,973,0,1}, {5516,none,3,0}, {5519,none,1,0}, {5520,none,1,0},
+    {5521,none,1,0}, {5522,none,1,0}, {5523,974,0,1}, {5523,none,2,0}, {5525,none,1,0}, {5526,none,1,0}, {5527,975,0,1},
+    {5527,none,1,0}, {5528,none,1,0}, {5529,none,1,0}, {5530,976,0,1}, {5530,none,1,0}, {5531,977,0,2}, {5531,none,1,0},
+    {5532,none,1,0}, {5533,none,1,0}, {5534,none,1,0}, {5535,979,0,1}, {5535,none,1,0}, {5536,none,1,0}, {5537,none,1,0},
+    {5538,none,1,0}, {5539,980,0,2}, {5539,none,3,0}, {5542,none,1,0}, {5543,none,1,0}, {5544,41,0,1}, {5544,none,1,0},
+    {5545,none,1,0}, {5546,none,1,0}, {5547,982,0,1}, {5547,none,1,0}, {5548,none,1,0}, {5549,none,1,0}, {5550,983,0,1},
+    {5550,none,1,0}, {5551,none,1,0}, {5552,none,1,0}, {5553,984,0,1}, {5553,none,2,0}, {5555,none,1,0}, {5556,none,1,0},
+    {5557,985,0,2}, {5557,none,2,0}, {5559,none,1,0}, {5560,none,1,0}, {5561,none,1,0}, {5562,191,0,1}, {5562,none,2,0},
+    {5564,987,0,1}, {5564,none,1,0}, {5565,988,0,1}, {5565,none,1,0}, {5566,none,1,0}, {5567,none,1,0}, {5568,none,1,0},
+    {5569,none,1,0}, {5570,none,1,0}, {5571,none,1,0}, {5572,989,0,1}, {5572,none,2,0}, {5574,none,2,0}, {5576,none,6,0},
+    {5582,none,6,0}, {5588,none,1,0}, {5589,990,0,1}, {5589,none,1,0}, {5590,991,0,1}, {5590,none,1,0}, {5591,992,0,1},
+    {5591,none,1,0}, {5592,993,0,1}, {5592,none,1,0}, {5593,994,0,1}, {5593,none,1,0}, {5594,995,0,1}, {5594,none,2,0},
+    {5596,none,1,0}, {5597,996,0,1}, {5597,none,1,0}, {5598,997,0,1}, {5598,none,3,0}, {5601,none,1,0}, {5602,998,0,1},
+    {5602,none,1,0}, {5603,999,0,1}, {5603,none,1,0}, {5604,1000,0,1}, {5604,none,1,0}, {5605,none,1,0}, {5606,1001,0,1},
+    {5606,none,2,0}, {5608,none,1,0}, {5609,1002,0,1}, {5609,none,1,0}, {5610,1003,0,1}, {5610,none,1,0}, {5611,none,1,0},
+    {5612,1004,0,1}, {5612,none,1,0}, {5613,none,1,0}, {5614,1005,0,1}, {5614,none,1,0}, {5615,none,1,0}, {5616,none,1,0},
+    {5617,1006,0,1}, {5617,none,1,0}, {5618,none,1,0}, {5619,none,1,0}, {5620,1007,0,2}, {5620,none,17,0}, {5637,none,2,0},
+    {5639,209,0,1}, {5639,none,1,0}, {5640,1009,0,1}, {5640,none,3,0}, {5643,none,1,0}, {5644,none,1,0}, {5645,none,1,0},
+    {5646,none,1,0}, {5647,1010,0,1}, {5647,none,1,0}, {5648,none,1,0}, {5649,none,2,0}, {5651,1011,0,1}, {5651,none,1,0},
+    {5652,903,0,1}, {5652,none,1,0}, {5653,1012,0,1}, {5653,none,1,0}, {5654,none,1,0}, {5655,none,1,0}, {5656,none,1,0},
+    {5657,none,1,0}, {5658,1013,0,1}, {5658,none,2,0}, {5660,none,1,0}, {5661,none,1,0}, {5662,none,1,0}, {5663,1014,0,1},
+    {5663,none,1,0}, {5664,1015,0,1}, {5664,none,1,0}, {5665,none,1,0}, {5666,none,1,0}, {5667,1016,0,1}, {5667,none,4,0},
+    {5671,207,0,1}, {5671,none,1,0}, {5672,208,0,1}, {5672,none,3,0}, {5675,207,0,1}, {5675,none,1,0}, {5676,209,0,1},
+    {5676,none,1,0}, {5677,none,1,0}, {5678,none,1,0}, {5679,none,1,0}, {5680,none,1,0}, {5681,212,0,1}, {5681,none,4,0},
+    {5685,212,0,1}, {5685,none,1,0}, {5686,none,1,0}, {5687,1017,0,1}, {5687,none,1,0}, {5688,none,1,0}, {5689,none,2,0},
+    {5691,1018,0,1}, {5691,none,2,0}, {5693,1019,0,1}, {5693,none,1,0}, {5694,1020,0,1}, {5694,none,2,0}, {5696,1021,0,2},
+    {5696,none,1,0}, {5697,none,1,0}, {5698,1023,0,1}, {5698,none,1,0}, {5699,none,1,0}, {5700,1024,0,2}, {5700,none,2,0},
+    {5702,216,0,1}, {5702,none,1,0}, {5703,204,0,1}, {5703,none,1,0}, {5704,none,1,0}, {5705,none,1,0}, {5706,none,1,0},
+    {5707,1026,0,1}, {5707,none,1,0}, {5708,none,1,0}, {5709,none,1,0}, {5710,1027,0,1}, {5710,none,4,0}, {5714,211,0,1},
+    {5714,none,1,0}, {5715,1028,0,1}, {5715,none,1,0}, {5716,1029,0,1}, {5716,none,1,0}, {5717,1030,0,1}, {5717,none,4,0},
+    {5721,none,1,0}, {5722,1031,0,1}, {5722,none,1,0}, {5723,none,2,0}, {5725,1032,0,1}, {5725,none,1,0}, {5726,none,1,0},
+    {5727,none,1,0}, {5728,none,1,0}, {5729,1032,0,1}, {5729,none,2,0}, {5731,1033,0,1}, {5731,none,2,0}, {5733,1033,0,1},
+    {5733,none,1,0}, {5734,1031,0,1}, {5734,none,1,0}, {5735,none,1,0}, {5736,none,1,0}, {5737,1034,0,1}, {5737,none,1,0},
+    {5738,none,1,0}, {5739,none,1,0}, {5740,1035,0,2}, {5740,none,1,0}, {5741,none,1,0}, {5742,none,1,0}, {5743,none,1,0},
+    {5744,20,0,1}, {5744,none,2,0}, {5746,none,1,0}, {5747,none,1,0}, {5748,1037,0,1}, {5748,none,1,0}, {5749,none,3,0},
+    {5752,213,0,1}, {5752,none,1,0}, {5753,1038,0,1}, {5753,none,1,0}, {5754,1039,0,1}, {5754,none,6,0}, {5760,194,0,1},
+    {5760,none,2,0}, {5762,none,1,0}, {5763,1040,0,1}, {5763,none,1,0}, {5764,none,1,0}, {5765,1041,0,1}, {5765,none,1,0},
+    {5766,none,1,0}, {5767,none,1,0}, {5768,1042,0,1}, {5768,none,1,0}, {5769,none,1,0}, {5770,none,1,0}, {5771,none,1,0},
+    {5772,1043,0,1}, {5772,none,1,0}, {5773,none,1,0}, {5774,none,1,0}, {5775,none,1,0}, {5776,none,1,0}, {5777,1044,0,1},
+    {5777,none,5,0}, {5782,none,2,0}, {5784,none,1,0}, {5785,none,1,0}, {5786,none,1,0}, {5787,none,1,0}, {5788,none,1,0},
+    {5789,1012,0,1}, {5789,none,1,0}, {5790,none,1,0}, {5791,1045,0,1}, {5791,none,1,0}, {5792,none,1,0}, {5793,none,1,0},
+    {5794,1042,0,1}, {5794,none,1,0}, {5795,none,2,0}, {5797,none,1,0}, {5798,none,1,0}, {5799,none,1,0}, {5800,none,1,0},
+    {5801,208,0,1}, {5801,none,1,0}, {5802,none,1,0}, {5803,none,1,0}, {5804,none,1,0}, {5805,none,1,0}, {5806,1009,0,1},
+    {5806,none,1,0}, {5807,none,1,0}, {5808,none,1,0}, {5809,none,1,0}, {5810,211,0,1}, {5810,none,1,0}, {5811,none,1,0},
+    {5812,none,1,0}, {5813,213,0,1}, {5813,none,2,0}, {5815,none,1,0}, {5816,none,1,0}, {5817,none,1,0}, {5818,none,1,0},
+    {5819,none,1,0}, {5820,none,1,0}, {5821,none,1,0}, {5822,1046,0,2}, {5822,none,1,0}, {5823,none,1,0}, {5824,1046,0,2},
+    {5824,none,10,0}, {5834,none,1,0}, {5835,none,1,0}, {5836,none,1,0}, {5837,133,0,1}, {5837,none,4,0}, {5841,none,1,0},
+    {5842,none,1,0}, {5843,none,1,0}, {5844,none,1,0}, {5845,21,0,1}, {5845,none,1,0}, {5846,none,1,0}, {5847,990,0,1},
+    {5847,none,1,0}, {5848,none,1,0}, {5849,none,1,0}, {5850,none,1,0}, {5851,221,0,1}, {5851,none,2,0}, {5853,none,1,0},
+    {5854,none,1,0}, {5855,none,1,0}, {5856,1048,0,1}, {5856,none,3,0}, {5859,290,0,1}, {5859,none,1,0}, {5860,none,1,0},
+    {5861,none,1,0}, {5862,1049,0,1}, {5862,none,1,0}, {5863,1050,0,1}, {5863,none,1,0}, {5864,none,1,0}, {5865,none,1,0},
+    {5866,1051,0,1}, {5866,none,1,0}, {5867,none,1,0}, {5868,none,1,0}, {5869,none,1,0}, {5870,1052,0,1}, {5870,none,3,0},
+    {5873,none,1,0}, {5874,none,1,0}, {5875,none,1,0}, {5876,none,2,0}, {5878,1053,0,1}, {5878,none,1,0}, {5879,none,1,0},
+    {5880,none,1,0}, {5881,1053,0,1}, {5881,none,1,0}, {5882,none,1,0}, {5883,none,1,0}, {5884,none,1,0}, {5885,1054,0,1},
+    {5885,none,1,0}, {5886,none,1,0}, {5887,none,1,0}, {5888,none,1,0}, {5889,1055,0,1}, {5889,none,1,0}, {5890,none,1,0},
+    {5891,1056,0,2}, {5891,none,1,0}, {5892,none,2,0}, {5894,none,1,0}, {5895,none,1,0}, {5896,none,1,0}, {5897,none,1,0},
+    {5898,none,1,0}, {5899,1058,0,1}, {5899,none,1,0}, {5900,none,1,0}, {5901,none,1,0}, {5902,none,1,0}, {5903,none,1,0},
+    {5904,1059,0,1}, {5904,none,5,0}, {5909,none,1,0}, {5910,none,1,0}, {5911,none,1,0}, {5912,1060,0,1}, {5912,none,1,0},
+    {5913,none,1,0}, {5914,none,1,0}, {5915,none,1,0}, {5916,1061,0,1}, {5916,none,1,0}, {5917,none,2,0}, {5919,none,1,0},
+    {5920,none,1,0}, {5921,none,1,0}, {5922,none,1,0}, {5923,none,1,0}, {5924,none,1,0}, {5925,none,1,0}, {5926,none,1,0},
+    {5927,none,1,0}, {5928,1062,0,1}, {5928,none,1,0}, {5929,none,1,0}, {5930,none,1,0}, {5931,none,1,0}, {5932,none,1,0},
+    {5933,none,1,0}, {5934,none,1,0}, {5935,none,1,0}, {5936,none,1,0}, {5937,none,1,0}, {5938,1063,0,1}, {5938,none,1,0},
+    {5939,none,1,0}, {5940,1064,0,2}, {5940,none,1,0}, {5941,none,1,0}, {5942,none,1,0}, {5943,none,1,0}, {5944,1066,0,1},
+    {5944,none,3,0}, {5947,none,1,0}, {5948,none,1,0}, {5949,1067,0,2}, {5949,none,1,0}, {5950,none,1,0}, {5951,none,1,0},
+    {5952,none,1,0}, {5953,1051,0,1}, {5953,none,1,0}, {5954,none,1,0}, {5955,none,1,0}, {5956,none,1,0}, {5957,1069,0,1},
+    {5957,none,2,0}, {5959,none,1,0}, {5960,none,1,0}, {5961,none,1,0}, {5962,none,1,0}, {5963,1070,0,1}, {5963,none,1,0},
+    {5964,none,1,0}, {5965,none,1,0}, {5966,none,1,0}, {5967,890,0,1}, {5967,none,15,0}, {5982,none,1,0}, {5983,none,1,0},
+    {5984,none,1,0}, {5985,none,1,0}, {5986,none,1,0}, {5987,1071,0,1}, {5987,none,3,0}, {5990,240,0,1}, {5990,none,1,0},
+    {5991,none,1,0}, {5992,none,1,0}, {5993,1072,0,1}, {5993,none,1,0}, {5994,1073,0,1}, {5994,none,2,0}, {5996,none,1,0},
+    {5997,none,1,0}, {5998,1074,0,1}, {5998,none,1,0}, {5999,none,1,0}, {6000,none,1,0}, {6001,30,0,1}, {6001,none,2,0},
+    {6003,none,1,0}, {6004,133,0,1}, {6004,none,1,0}, {6005,1075,0,2}, {6005,none,1,0}, {6006,none,1,0}, {6007,none,1,0},
+    {6008,none,1,0}, {6009,none,1,0}, {6010,1077,0,1}, {6010,none,4,0}, {6014,236,0,1}, {6014,none,2,0}, {6016,none,1,0},
+    {6017,none,1,0}, {6018,none,1,0}, {6019,1078,0,1}, {6019,none,1,0}, {6020,none,1,0}, {6021,1079,0,1}, {6021,none,1,0},
+    {6022,none,1,0}, {6023,none,1,0}, {6024,none,1,0}, {6025,1080,0,1}, {6025,none,1,0}, {6026,none,1,0}, {6027,none,1,0},
+    {6028,1081,0,1}, {6028,none,1,0}, {6029,none,1,0}, {6030,none,1,0}, {6031,none,1,0}, {6032,1082,0,1}, {6032,none,3,0},
+    {6035,none,3,0}, {6038,none,1,0}, {6039,none,1,0}, {6040,1083,0,1}, {6040,none,3,0}, {6043,none,1,0}, {6044,233,0,1},
+    {6044,none,1,0}, {6045,none,1,0}, {6046,none,1,0}, {6047,none,1,0}, {6048,246,0,1}, {6048,none,1,0}, {6049,none,1,0},
+    {6050,none,1,0}, {6051,none,1,0}, {6052,233,0,1}, {6052,none,1,0}, {6053,none,1,0}, {6054,1084,0,1}, {6054,none,1,0},
+    {6055,none,1,0}, {6056,1085,0,1}, {6056,none,1,0}, {6057,none,1,0}, {6058,none,1,0}, {6059,1086,0,1}, {6059,none,5,0},
+    {6064,167,0,1}, {6064,none,1,0}, {6065,none,1,0}, {6066,none,1,0}, {6067,none,1,0}, {6068,1087,0,1}, {6068,none,1,0},
+    {6069,none,1,0}, {6070,none,2,0}, {6072,1088,0,1}, {6072,none,1,0}, {6073,none,1,0}, {6074,none,1,0}, {6075,1089,0,1},
+    {6075,none,1,0}, {6076,none,1,0}, {6077,none,1,0}, {6078,none,1,0}, {6079,1084,0,1}, {6079,none,5,0}, {6084,238,0,1},
+    {6084,none,1,0}, {6085,none,1,0}, {6086,none,1,0}, {6087,1090,0,1}, {6087,none,2,0}, {6089,none,1,0}, {6090,none,1,0},
+    {6091,none,1,0}, {6092,none,1,0}, {6093,661,0,1}, {6093,none,1,0}, {6094,none,1,0}, {6095,none,1,0}, {6096,none,1,0},
+    {6097,1090,0,1}, {6097,none,1,0}, {6098,none,1,0}, {6099,none,1,0}, {6100,none,1,0}, {6101,none,1,0}, {6102,1091,0,1},
+    {6102,none,1,0}, {6103,none,1,0}, {6104,none,1,0}, {6105,none,1,0}, {6106,1092,0,1}, {6106,none,4,0}, {6110,none,1,0},
+    {6111,none,1,0}, {6112,1093,0,1}, {6112,none,1,0}, {6113,none,1,0}, {6114,none,1,0}, {6115,1094,0,1}, {6115,none,1,0},
+    {6116,none,1,0}, {6117,1095,0,2}, {6117,none,1,0}, {6118,none,1,0}, {6119,1097,0,1}, {6119,none,1,0}, {6120,none,1,0},
+    {6121,none,1,0}, {6122,none,1,0}, {6123,1092,0,1}, {6123,none,1,0}, {6124,none,1,0}, {6125,none,1,0}, {6126,none,1,0},
+    {6127,none,1,0}, {6128,1098,0,1}, {6128,none,2,0}, {6130,none,1,0}, {6131,none,1,0}, {6132,1099,0,2}, {6132,none,1,0},
+    {6133,none,5,0}, {6138,167,0,1}, {6138,none,1,0}, {6139,1101,0,1}, {6139,none,1,0}, {6140,none,1,0}, {6141,none,1,0},
+    {6142,1102,0,1}, {6142,none,2,0}, {6144,1103,0,1}, {6144,none,1,0}, {6145,1104,0,1}, {6145,none,1,0}, {6146,167,0,1},
+    {6146,none,2,0}, {6148,241,0,1}, {6148,none,1,0}, {6149,none,1,0}, {6150,none,1,0}, {6151,none,1,0}, {6152,1105,0,1},
+    {6152,none,2,0}, {6154,none,1,0}, {6155,none,1,0}, {6156,none,1,0}, {6157,1106,0,1}, {6157,none,1,0}, {6158,none,1,0},
+    {6159,1107,0,1}, {6159,none,6,0}, {6165,none,2,0}, {6167,none,1,0}, {6168,none,1,0}, {6169,none,1,0}, {6170,1108,0,1},
+    {6170,none,1,0}, {6171,1109,0,1}, {6171,none,1,0}, {6172,none,1,0}, {6173,1110,0,2}, {6173,none,1,0}, {6174,none,1,0},
+    {6175,none,1,0}, {6176,none,1,0}, {6177,1112,0,1}, {6177,none,1,0}, {6178,none,1,0}, {6179,none,1,0}, {6180,1113,0,2},
+    {6180,none,2,0}, {6182,none,1,0}, {6183,none,1,0}, {6184,1115,0,2}, {6184,none,1,0}, {6185,none,1,0}, {6186,none,1,0},
+    {6187,none,1,0}, {6188,1117,0,1}, {6188,none,1,0}, {6189,none,1,0}, {6190,none,1,0}, {6191,none,1,0}, {6192,1118,0,1},
+    {6192,none,8,0}, {6200,none,1,0}, {6201,none,1,0}, {6202,none,1,0}, {6203,none,2,0}, {6205,1119,0,1}, {6205,none,1,0},
+    {6206,1120,0,1}, {6206,none,2,0}, {6208,none,1,0}, {6209,none,1,0}, {6210,none,1,0}, {6211,none,1,0}, {6212,1121,0,1},
+    {6212,none,1,0}, {6213,1122,0,1}, {6213,none,1,0}, {6214,none,1,0}, {6215,1123,0,2}, {6215,none,1,0}, {6216,none,1,0},
+    {6217,none,1,0}, {6218,none,1,0}, {6219,none,1,0}, {6220,1125,0,1}, {6220,none,1,0}, {6221,none,1,0}, {6222,none,1,0},
+    {6223,1126,0,1}, {6223,none,1,0}, {6224,none,1,0}, {6225,none,1,0}, {6226,1127,0,1}, {6226,none,1,0}, {6227,none,1,0},
+    {6228,none,1,0}, {6229,1128,0,2}, {6229,none,1,0}, {6230,none,1,0}, {6231,none,1,0}, {6232,1130,0,2}, {6232,none,23,0},
+    {6255,none,3,0}, {6258,none,1,0}, {6259,none,1,0}, {6260,none,1,0}, {6261,313,0,1}, {6261,none,1,0}, {6262,none,1,0},
+    {6263,132,0,1}, {6263,none,1,0}, {6264,none,1,0}, {6265,none,1,0}, {6266,none,1,0}, {6267,1132,0,1}, {6267,none,1,0},
+    {6268,none,1,0}, {6269,none,1,0}, {6270,none,1,0}, {6271,1133,0,1}, {6271,none,2,0}, {6273,305,0,1}, {6273,none,1,0},
+    {6274,1134,0,1}, {6274,none,1,0}, {6275,none,1,0}, {6276,none,1,0}, {6277,1135,0,1}, {6277,none,9,0}, {6286,none,1,0},
+    {6287,none,1,0}, {6288,none,1,0}, {6289,none,1,0}, {6290,1136,0,1}, {6290,none,1,0}, {6291,none,1,0}, {6292,none,1,0},
+    {6293,none,1,0}, {6294,none,1,0}, {6295,none,1,0}, {6296,1137,0,1}, {6296,none,1,0}, {6297,none,1,0}, {6298,none,1,0},
+    {6299,none,1,0}, {6300,276,0,1}, {6300,none,1,0}, {6301,none,1,0}, {6302,none,1,0}, {6303,none,1,0}, {6304,1138,0,1},
+    {6304,none,1,0}, {6305,none,3,0}, {6308,281,0,1}, {6308,none,1,0}, {6309,1139,0,1}, {6309,none,1,0}, {6310,none,1,0},
+    {6311,281,0,1}, {6311,none,1,0}, {6312,1140,0,1}, {6312,none,1,0}, {6313,none,1,0}, {6314,none,1,0}, {6315,1141,0,1},
+    {6315,none,1,0}, {6316,none,8,0}, {6324,16,0,1}, {6324,none,2,0}, {6326,282,0,1}, {6326,none,1,0}, {6327,none,1,0},
+    {6328,1142,0,1}, {6328,none,1,0}, {6329,none,1,0}, {6330,1143,0,1}, {6330,none,1,0}, {6331,none,1,0}, {6332,1062,0,1},
+    {6332,none,1,0}, {6333,none,1,0}, {6334,1144,0,1}, {6334,none,1,0}, {6335,none,1,0}, {6336,1145,0,1}, {6336,none,1,0},
+    {6337,none,1,0}, {6338,none,1,0}, {6339,1146,0,1}, {6339,none,1,0}, {6340,none,1,0}, {6341,1147,0,1}, {6341,none,3,0},
+    {6344,1148,0,1}, {6344,none,1,0}, {6345,none,1,0}, {6346,none,1,0}, {6347,1149,0,1}, {6347,none,2,0}, {6349,1150,0,1},
+    {6349,none,1,0}, {6350,1151,0,2}, {6350,none,3,0}, {6353,none,1,0}, {6354,none,1,0}, {6355,none,1,0}, {6356,1153,0,1},
+    {6356,none,1,0}, {6357,none,1,0}, {6358,none,1,0}, {6359,1154,0,1}, {6359,none,2,0}, {6361,none,1,0}, {6362,none,2,0},
+    {6364,none,1,0}, {6365,1155,0,1}, {6365,none,1,0}, {6366,1156,0,1}, {6366,none,2,0}, {6368,none,1,0}, {6369,1157,0,1},
+    {6369,none,1,0}, {6370,none,2,0}, {6372,none,1,0}, {6373,1158,0,1}, {6373,none,1,0}, {6374,1159,0,1}, {6374,none,4,0},
+    {6378,none,1,0}, {6379,none,1,0}, {6380,none,1,0}, {6381,none,1,0}, {6382,1160,0,1}, {6382,none,2,0}, {6384,none,1,0},
+    {6385,none,1,0}, {6386,none,1,0}, {6387,1161,0,1}, {6387,none,1,0}, {6388,none,1,0}, {6389,284,0,1}, {6389,none,1,0},
+    {6390,none,1,0}, {6391,1155,0,1}, {6391,none,1,0}, {6392,1162,0,1}, {6392,none,4,0}, {6396,none,1,0}, {6397,none,1,0},
+    {6398,1163,0,1}, {6398,none,1,0}, {6399,none,1,0}, {6400,none,2,0}, {6402,36,0,1}, {6402,none,1,0}, {6403,34,0,1},
+    {6403,none,2,0}, {6405,none,1,0}, {6406,none,1,0}, {6407,none,1,0}, {6408,none,1,0}, {6409,1164,0,1}, {6409,none,1,0},
+    {6410,none,1,0}, {6411,none,1,0}, {6412,none,1,0}, {6413,none,1,0}, {6414,1165,0,1}, {6414,none,1,0}, {6415,none,1,0},
+    {6416,1166,0,1}, {6416,none,5,0}, {6421,1167,0,1}, {6421,none,1,0}, {6422,none,5,0}, {6427,none,1,0}, {6428,none,1,0},
+    {6429,none,1,0}, {6430,none,1,0}, {6431,none,2,0}, {6433,16,0,1}, {6433,none,1,0}, {6434,none,1,0}, {6435,none,1,0},
+    {6436,none,1,0}, {6437,1147,0,1}, {6437,none,1,0}, {6438,none,1,0}, {6439,none,1,0}, {6440,none,1,0}, {6441,none,1,0},
+    {6442,none,1,0}, {6443,none,2,0}, {6445,none,1,0}, {6446,none,1,0}, {6447,none,1,0}, {6448,none,1,0}, {6449,147,0,1},
+    {6449,none,1,0}, {6450,none,1,0}, {6451,302,0,1}, {6451,none,1,0}, {6452,none,1,0}, {6453,none,1,0}, {6454,none,1,0},
+    {6455,none,1,0}, {6456,none,1,0}, {6457,none,1,0}, {6458,none,1,0}, {6459,none,1,0}, {6460,none,1,0}, {6461,1168,0,1},
+    {6461,none,1,0}, {6462,none,1,0}, {6463,none,1,0}, {6464,none,1,0}, {6465,none,3,0}, {6468,none,1,0}, {6469,none,1,0},
+    {6470,none,1,0}, {6471,none,1,0}, {6472,none,2,0}, {6474,290,0,1}, {6474,none,1,0}, {6475,283,0,1}, {6475,none,1,0},
+    {6476,none,1,0}, {6477,none,1,0}, {6478,none,1,0}, {6479,none,1,0}, {6480,none,1,0}, {6481,none,1,0}, {6482,none,1,0},
+    {6483,481,0,1}, {6483,none,1,0}, {6484,none,1,0}, {6485,none,1,0}, {6486,none,1,0}, {6487,none,1,0}, {6488,none,1,0},
+    {6489,none,1,0}, {6490,none,1,0}, {6491,none,1,0}, {6492,none,1,0}, {6493,1050,0,1}, {6493,none,1,0}, {6494,none,1,0},
+    {6495,none,1,0}, {6496,none,1,0}, {6497,none,1,0}, {6498,none,1,0}, {6499,none,1,0}, {6500,none,1,0}, {6501,none,1,0},
+    {6502,none,1,0}, {6503,1169,0,1}, {6503,none,1,0}, {6504,304,0,1}, {6504,none,3,0}, {6507,1167,0,1}, {6507,none,1,0},
+    {6508,305,0,1}, {6508,none,1,0}, {6509,none,1,0}, {6510,none,1,0}, {6511,none,1,0}, {6512,none,1,0}, {6513,308,0,1},
+    {6513,none,5,0}, {6518,308,0,1}, {6518,none,1,0}, {6519,none,1,0}, {6520,1170,0,1}, {6520,none,1,0}, {6521,none,1,0},
+    {6522,none,2,0}, {6524,1171,0,1}, {6524,none,2,0}, {6526,1172,0,1}, {6526,none,1,0}, {6527,1173,0,1}, {6527,none,2,0},
+    {6529,1174,0,2}, {6529,none,1,0}, {6530,none,1,0}, {6531,1176,0,1}, {6531,none,5,0}, {6536,none,1,0}, {6537,none,1,0},
+    {6538,none,1,0}, {6539,none,1,0}, {6540,none,1,0}, {6541,none,1,0}, {6542,1140,0,1}, {6542,none,1,0}, {6543,none,1,0},
+    {6544,none,1,0}, {6545,1177,0,1}, {6545,none,1,0}, {6546,none,2,0}, {6548,none,1,0}, {6549,none,1,0}, {6550,none,1,0},
+    {6551,304,0,1}, {6551,none,1,0}, {6552,none,1,0}, {6553,none,1,0}, {6554,none,1,0}, {6555,1134,0,1}, {6555,none,1,0},
+    {6556,none,1,0}, {6557,none,1,0}, {6558,306,0,1}, {6558,none,1,0}, {6559,none,1,0}, {6560,none,1,0}, {6561,309,0,1},
+    {6561,none,3,0}, {6564,none,1,0}, {6565,none,1,0}, {6566,none,1,0}, {6567,none,1,0}, {6568,1178,0,1}, {6568,none,1,0},
+    {6569,none,1,0}, {6570,none,1,0}, {6571,none,1,0}, {6572,289,0,1}, {6572,none,1,0}, {6573,1179,0,2}, {6573,none,2,0},
+    {6575,306,0,1}, {6575,none,1,0}, {6576,1181,0,1}, {6576,none,2,0}, {6578,none,1,0}, {6579,none,2,0}, {6581,none,1,0},
+    {6582,147,0,1}, {6582,none,2,0}, {6584,302,0,1}, {6584,none,1,0}, {6585,1182,0,1}, {6585,none,1,0}, {6586,none,1,0},
+    {6587,none,1,0}, {6588,1183,0,1}, {6588,none,1,0}, {6589,none,1,0}, {6590,none,1,0}, {6591,1184,0,1}, {6591,none,5,0},
+    {6596,324,0,1}, {6596,none,1,0}, {6597,none,1,0}, {6598,none,1,0}, {6599,1168,0,1}, {6599,none,1,0}, {6600,none,1,0},
+    {6601,none,1,0}, {6602,none,1,0}, {6603,none,1,0}, {6604,none,1,0}, {6605,908,0,1}, {6605,none,1,0}, {6606,none,1,0},
+    {6607,none,1,0}, {6608,none,1,0}, {6609,1185,0,1}, {6609,none,1,0}, {6610,none,1,0}, {6611,none,1,0}, {6612,1186,0,1},
+    {6612,none,2,0}, {6614,none,1,0}, {6615,none,1,0}, {6616,none,1,0}, {6617,none,1,0}, {6618,1187,0,1}, {6618,none,1,0},
+    {6619,none,1,0}, {6620,none,1,0}, {6621,none,2,0}, {6623,1188,0,1}, {6623,none,1,0}, {6624,none,1,0}, {6625,none,1,0},
+    {6626,none,1,0}, {6627,1188,0,1}, {6627,none,4,0}, {6631,none,1,0}, {6632,1189,0,1}, {6632,none,1,0}, {6633,none,2,0},
+    {6635,1190,0,1}, {6635,none,1,0}, {6636,none,1,0}, {6637,none,1,0}, {6638,none,1,0}, {6639,1190,0,1}, {6639,none,2,0},
+    {6641,1191,0,1}, {6641,none,2,0}, {6643,1191,0,1}, {6643,none,1,0}, {6644,1189,0,1}, {6644,none,1,0}, {6645,none,1,0},
+    {6646,none,1,0}, {6647,1192,0,1}, {6647,none,8,0}, {6655,none,2,0}, {6657,none,1,0}, {6658,none,1,0}, {6659,1193,0,1},
+    {6659,none,1,0}, {6660,none,1,0}, {6661,1194,0,1}, {6661,none,1,0}, {6662,none,1,0}, {6663,none,1,0}, {6664,285,0,1},
+    {6664,none,1,0}, {6665,none,3,0}, {6668,none,1,0}, {6669,none,1,0}, {6670,none,1,0}, {6671,none,2,0}, {6673,none,1,0},
+    {6674,none,1,0}, {6675,none,1,0}, {6676,none,1,0}, {6677,none,1,0}, {6678,315,0,1}, {6678,none,1,0}, {6679,none,1,0},
+    {6680,none,1,0}, {6681,none,1,0}, {6682,none,1,0}, {6683,none,1,0}, {6684,none,1,0}, {6685,none,1,0}, {6686,none,1,0},
+    {6687,none,1,0}, {6688,316,0,1}, {6688,none,1,0}, {6689,none,1,0}, {6690,none,1,0}, {6691,none,1,0}, {6692,none,1,0},
+    {6693,none,1,0}, {6694,1195,0,1}, {6694,none,1,0}, {6695,none,1,0}, {6696,none,1,0}, {6697,none,1,0}, {6698,none,1,0},
+    {6699,none,1,0}, {6700,none,1,0}, {6701,none,1,0}, {6702,none,1,0}, {6703,none,1,0}, {6704,317,0,1}, {6704,none,1,0},
+    {6705,none,1,0}, {6706,none,1,0}, {6707,none,1,0}, {6708,none,1,0}, {6709,none,1,0}, {6710,none,2,0}, {6712,none,1,0},
+    {6713,none,1,0}, {6714,none,1,0}, {6715,none,1,0}, {6716,1144,0,1}, {6716,none,1,0}, {6717,none,1,0}, {6718,none,1,0},
+    {6719,none,1,0}, {6720,none,1,0}, {6721,1196,0,1}, {6721,none,3,0}, {6724,none,1,0}, {6725,none,1,0}, {6726,1197,0,1},
+    {6726,none,1,0}, {6727,1198,0,2}, {6727,none,1,0}, {6728,none,1,0}, {6729,none,1,0}, {6730,1200,0,1}, {6730,none,1,0},
+    {6731,none,1,0}, {6732,none,1,0}, {6733,none,1,0}, {6734,none,1,0}, {6735,1201,0,1}, {6735,none,2,0}, {6737,none,1,0},
+    {6738,none,1,0}, {6739,none,1,0}, {6740,1202,0,1}, {6740,none,1,0}, {6741,none,1,0}, {6742,none,1,0}, {6743,584,0,1},
+    {6743,none,3,0}, {6746,1203,0,1}, {6746,none,1,0}, {6747,none,1,0}, {6748,none,1,0}, {6749,none,1,0}, {6750,1203,0,1},
+    {6750,none,1,0}, {6751,742,0,1}, {6751,none,1,0}, {6752,none,1,0}, {6753,none,2,0}, {6755,1204,0,1}, {6755,none,1,0},
+    {6756,none,1,0}, {6757,1205,0,1}, {6757,none,5,0}, {6762,none,1,0}, {6763,none,1,0}, {6764,none,1,0}, {6765,283,0,1},
+    {6765,none,1,0}, {6766,none,1,0}, {6767,none,1,0}, {6768,none,1,0}, {6769,none,1,0}, {6770,none,1,0}, {6771,917,0,1},
+    {6771,none,1,0}, {6772,none,1,0}, {6773,none,2,0}, {6775,481,0,1}, {6775,none,1,0}, {6776,1206,0,1}, {6776,none,1,0},
+    {6777,1207,0,1}, {6777,none,1,0}, {6778,none,1,0}, {6779,none,1,0}, {6780,1208,0,1}, {6780,none,6,0}, {6786,none,1,0},
+    {6787,none,1,0}, {6788,none,1,0}, {6789,none,1,0}, {6790,1209,0,1}, {6790,none,1,0}, {6791,none,1,0}, {6792,1210,0,2},
+    {6792,none,1,0}, {6793,322,0,1}, {6793,none,1,0}, {6794,none,3,0}, {6797,309,0,1}, {6797,none,1,0}, {6798,1212,0,1},
+    {6798,none,1,0}, {6799,1213,0,1}, {6799,none,2,0}, {6801,none,1,0}, {6802,1156,0,1}, {6802,none,1,0}, {6803,none,2,0},
+    {6805,433,0,1}, {6805,none,1,0}, {6806,1214,0,1}, {6806,none,1,0}, {6807,none,1,0}, {6808,none,1,0}, {6809,none,1,0},
+    {6810,1215,0,1}, {6810,none,8,0}, {6818,272,0,1}, {6818,none,2,0}, {6820,none,1,0}, {6821,1216,0,1}, {6821,none,1,0},
+    {6822,none,1,0}, {6823,1217,0,1}, {6823,none,1,0}, {6824,none,1,0}, {6825,none,1,0}, {6826,1177,0,1}, {6826,none,1,0},
+    {6827,none,1,0}, {6828,none,1,0}, {6829,none,1,0}, {6830,1169,0,1}, {6830,none,1,0}, {6831,none,1,0}, {6832,none,1,0},
+    {6833,none,1,0}, {6834,1218,0,1}, {6834,none,1,0}, {6835,none,1,0}, {6836,none,1,0}, {6837,none,1,0}, {6838,1219,0,1},
+    {6838,none,1,0}, {6839,none,1,0}, {6840,none,1,0}, {6841,none,1,0}, {6842,none,1,0}, {6843,1220,0,1}, {6843,none,2,0},
+    {6845,none,1,0}, {6846,none,1,0}, {6847,none,1,0}, {6848,1221,0,1}, {6848,none,3,0}, {6851,1222,0,1}, {6851,none,1,0},
+    {6852,297,0,1}, {6852,none,1,0}, {6853,745,0,1}, {6853,none,1,0}, {6854,none,2,0}, {6856,none,1,0}, {6857,none,1,0},
+    {6858,none,1,0}, {6859,none,1,0}, {6860,none,1,0}, {6861,1223,0,1}, {6861,none,1,0}, {6862,none,1,0}, {6863,none,1,0},
+    {6864,none,1,0}, {6865,1224,0,1}, {6865,none,2,0}, {6867,none,1,0}, {6868,none,1,0}, {6869,none,1,0}, {6870,none,1,0},
+    {6871,none,1,0}, {6872,none,1,0}, {6873,none,1,0}, {6874,1225,0,2}, {6874,none,1,0}, {6875,none,1,0}, {6876,1225,0,2},
+    {6876,none,14,0}, {6890,none,1,0}, {6891,none,1,0}, {6892,none,1,0}, {6893,none,1,0}, {6894,1227,0,1}, {6894,none,4,0},
+    {6898,none,1,0}, {6899,none,1,0}, {6900,7,0,1}, {6900,none,2,0}, {6902,none,1,0}, {6903,1228,0,1}, {6903,none,2,0},
+    {6905,1229,0,1}, {6905,none,1,0}, {6906,none,1,0}, {6907,none,1,0}, {6908,1229,0,1}, {6908,none,2,0}, {6910,494,0,1},
+    {6910,none,1,0}, {6911,none,1,0}, {6912,none,4,0}, {6916,494,0,1}, {6916,none,1,0}, {6917,none,1,0}, {6918,none,1,0},
+    {6919,none,1,0}, {6920,153,0,1}, {6920,none,1,0}, {6921,none,1,0}, {6922,none,1,0}, {6923,none,1,0}, {6924,293,0,1},
+    {6924,none,1,0}, {6925,none,1,0}, {6926,598,0,1}, {6926,none,1,0}, {6927,none,1,0}, {6928,none,1,0}, {6929,none,1,0},
+    {6930,1230,0,1}, {6930,none,2,0}, {6932,none,1,0}, {6933,none,1,0}, {6934,none,1,0}, {6935,none,1,0}, {6936,1231,0,1},
+    {6936,none,1,0}, {6937,1232,0,1}, {6937,none,1,0}, {6938,none,1,0}, {6939,none,1,0}, {6940,none,1,0}, {6941,1233,0,1},
+    {6941,none,1,0}, {6942,none,1,0}, {6943,none,1,0}, {6944,none,1,0}, {6945,none,1,0}, {6946,none,1,0}, {6947,none,1,0},
+    {6948,none,1,0}, {6949,none,1,0}, {6950,none,1,0}, {6951,none,1,0}, {6952,none,1,0}, {6953,687,0,1}, {6953,none,1,0},
+    {6954,none,1,0}, {6955,1234,0,2}, {6955,none,1,0}, {6956,none,1,0}, {6957,1236,0,1}, {6957,none,3,0}, {6960,none,1,0},
+    {6961,none,1,0}, {6962,none,1,0}, {6963,1237,0,1}, {6963,none,4,0}, {6967,615,0,1}, {6967,none,1,0}, {6968,none,1,0},
+    {6969,none,1,0}, {6970,712,0,1}, {6970,none,1,0}, {6971,none,1,0}, {6972,none,1,0}, {6973,1238,0,1}, {6973,none,1,0},
+    {6974,none,1,0}, {6975,none,1,0}, {6976,90,0,1}, {6976,none,1,0}, {6977,none,1,0}, {6978,none,3,0}, {6981,1239,0,1},
+    {6981,none,1,0}, {6982,789,0,1}, {6982,none,2,0}, {6984,914,0,1}, {6984,none,1,0}, {6985,1240,0,1}, {6985,none,2,0},
+    {6987,none,1,0}, {6988,none,1,0}, {6989,1241,0,1}, {6989,none,1,0}, {6990,none,1,0}, {6991,1054,0,1}, {6991,none,1,0},
+    {6992,none,1,0}, {6993,none,1,0}, {6994,none,1,0}, {6995,none,1,0}, {6996,331,0,1}, {6996,none,2,0}, {6998,none,1,0},
+    {6999,none,1,0}, {7000,none,1,0}, {7001,none,1,0}, {7002,1242,0,1}, {7002,none,1,0}, {7003,none,1,0}, {7004,1243,0,2},
+    {7004,none,1,0}, {7005,331,0,1}, {7005,none,2,0}, {7007,none,1,0}, {7008,none,1,0}, {7009,1245,0,2}, {7009,none,1,0},
+    {7010,none,1,0}, {7011,none,1,0}, {7012,none,1,0}, {7013,666,0,1}, {7013,none,3,0}, {7016,1247,0,1}, {7016,none,1,0},
+    {7017,none,1,0}, {7018,none,1,0}, {7019,none,1,0}, {7020,none,1,0}, {7021,none,1,0}, {7022,1248,0,1}, {7022,none,1,0},
+    {7023,none,1,0}, {7024,none,1,0}, {7025,1248,0,1}, {7025,none,24,0}, {7049,none,2,0}, {7051,none,1,0}, {7052,1249,0,2},
+    {7052,none,2,0}, {7054,1251,0,2}, {7054,none,1,0}, {7055,358,0,2}, {7055,none,3,0}, {7058,none,1,0}, {7059,none,1,0},
+    {7060,none,2,0}, {7062,none,1,0}, {7063,none,1,0}, {7064,none,1,0}, {7065,none,1,0}, {7066,none,1,0}, {7067,1253,0,1},
+    {7067,none,1,0}, {7068,none,1,0}, {7069,none,1,0}, {7070,none,1,0}, {7071,none,1,0}, {7072,none,1,0}, {7073,none,1,0},
+    {7074,none,1,0}, {7075,none,1,0}, {7076,none,1,0}, {7077,1254,0,1}, {7077,none,1,0}, {7078,1255,0,2}, {7078,none,2,0},
+    {7080,1257,0,2}, {7080,none,1,0}, {7081,375,0,2}, {7081,none,1,0}, {7082,none,1,0}, {7083,none,1,0}, {7084,none,1,0},
+    {7085,none,1,0}, {7086,none,1,0}, {7087,none,1,0}, {7088,none,1,0}, {7089,none,1,0}, {7090,none,1,0}, {7091,1259,0,1},
+    {7091,none,2,0}, {7093,none,1,0}, {7094,none,1,0}, {7095,none,1,0}, {7096,none,1,0}, {7097,1260,0,1}, {7097,none,1,0},
+    {7098,none,1,0}, {7099,none,1,0}, {7100,none,1,0}, {7101,1261,0,1}, {7101,none,5,0}, {7106,none,1,0}, {7107,none,1,0},
+    {7108,none,1,0}, {7109,120,0,1}, {7109,none,1,0}, {7110,none,1,0}, {7111,none,1,0}, {7112,none,1,0}, {7113,1262,0,1},
+    {7113,none,1,0}, {7114,none,1,0}, {7115,1263,0,2}, {7115,none,5,0}, {7120,414,0,1}, {7120,none,1,0}, {7121,1265,0,2},
+    {7121,none,1,0}, {7122,none,1,0}, {7123,1267,0,2}, {7123,none,1,0}, {7124,none,1,0}, {7125,1269,0,1}, {7125,none,1,0},
+    {7126,none,1,0}, {7127,none,1,0}, {7128,none,1,0}, {7129,414,0,1}, {7129,none,1,0}, {7130,none,1,0}, {7131,none,2,0},
+    {7133,38,0,1}, {7133,none,1,0}, {7134,none,2,0}, {7136,38,0,1}, {7136,none,1,0}, {7137,344,0,1}, {7137,none,2,0},
+    {7139,none,1,0}, {7140,none,1,0}, {7141,0,0,1}, {7141,none,1,0}, {7142,none,1,0}, {7143,none,2,0}, {7145,364,0,2},
+    {7145,none,1,0}, {7146,366,0,2}, {7146,none,5,0}, {7151,none,2,0}, {7153,none,1,0}, {7154,1270,0,1}, {7154,none,1,0},
+    {7155,none,1,0}, {7156,none,1,0}, {7157,1271,0,1}, {7157,none,1,0}, {7158,none,1,0}, {7159,none,1,0}, {7160,none,1,0},
+    {7161,1272,0,1}, {7161,none,1,0}, {7162,none,1,0}, {7163,none,2,0}, {7165,413,0,1}, {7165,none,1,0}, {7166,none,1,0},
+    {7167,none,1,0}, {7168,1273,0,2}, {7168,none,1,0}, {7169,none,1,0}, {7170,1275,0,1}, {7170,none,1,0}, {7171,1276,0,1},
+    {7171,none,1,0}, {7172,none,1,0}, {7173,none,1,0}, {7174,none,1,0}, {7175,1277,0,1}, {7175,none,7,0}, {7182,350,0,1},
+    {7182,none,1,0}, {7183,none,1,0}, {7184,none,1,0}, {7185,1278,0,1}, {7185,none,1,0}, {7186,none,2,0}, {7188,none,1,0},
+    {7189,none,1,0}, {7190,1279,0,1}, {7190,none,2,0}, {7192,600,0,1}, {7192,none,1,0}, {7193,none,1,0}, {7194,600,0,1},
+    {7194,none,1,0}, {7195,none,1,0}, {7196,none,1,0}, {7197,1280,0,2}, {7197,none,1,0}, {7198,none,1,0}, {7199,none,1,0},
+    {7200,none,1,0}, {7201,346,0,1}, {7201,none,2,0}, {7203,none,1,0}, {7204,none,1,0}, {7205,none,1,0}, {7206,1282,0,1},
+    {7206,none,1,0}, {7207,none,1,0}, {7208,351,0,2}, {7208,none,1,0}, {7209,none,1,0}, {7210,none,1,0}, {7211,none,2,0},
+    {7213,353,0,1}, {7213,none,1,0}, {7214,353,0,1}, {7214,none,1,0}, {7215,none,1,0}, {7216,1283,0,2}, {7216,none,4,0},
+    {7220,none,1,0}, {7221,356,0,2}, {7221,none,3,0}, {7224,355,0,1}, {7224,none,3,0}, {7227,355,0,1}, {7227,none,1,0},
+    {7228,356,0,2}, {7228,none,1,0}, {7229,none,1,0}, {7230,none,1,0}, {7231,none,1,0}, {7232,none,1,0}, {7233,361,0,2},
+    {7233,none,1,0}, {7234,361,0,2}, {7234,none,1,0}, {7235,none,1,0}, {7236,none,1,0}, {7237,363,0,1}, {7237,none,2,0},
+    {7239,354,0,1}, {7239,none,1,0}, {7240,354,0,1}, {7240,none,3,0}, {7243,none,1,0}, {7244,none,1,0}, {7245,none,1,0},
+    {7246,1254,0,1}, {7246,none,1,0}, {7247,none,1,0}, {7248,none,1,0}, {7249,1285,0,1}, {7249,none,1,0}, {7250,none,1,0},
+    {7251,none,1,0}, {7252,1286,0,1}, {7252,none,3,0}, {7255,480,0,1}, {7255,none,2,0}, {7257,1287,0,1}, {7257,none,1,0},
+    {7258,1288,0,1}, {7258,none,1,0}, {7259,480,0,1}, {7259,none,1,0}, {7260,none,1,0}, {7261,none,1,0}, {7262,1289,0,1},
+    {7262,none,7,0}, {7269,none,1,0}, {7270,none,1,0}, {7271,none,1,0}, {7272,1253,0,1}, {7272,none,1,0}, {7273,1290,0,2},
+    {7273,none,1,0}, {7274,none,1,0}, {7275,none,1,0}, {7276,1292,0,1}, {7276,none,1,0}, {7277,none,1,0}, {7278,1293,0,1},
+    {7278,none,4,0}, {7282,373,0,1}, {7282,none,1,0}, {7283,none,2,0}, {7285,none,1,0}, {7286,none,1,0}, {7287,none,1,0},
+    {7288,none,1,0}, {7289,none,1,0}, {7290,1292,0,1}, {7290,none,1,0}, {7291,none,1,0}, {7292,none,1,0}, {7293,none,1,0},
+    {7294,none,1,0}, {7295,none,1,0}, {7296,none,1,0}, {7297,none,1,0}, {7298,none,1,0}, {7299,none,1,0}, {7300,1285,0,1},
+    {7300,none,3,0}, {7303,373,0,1}, {7303,none,1,0}, {7304,1290,0,2}, {7304,none,1,0}, {7305,none,1,0}, {7306,none,1,0},
+    {7307,none,1,0}, {7308,none,1,0}, {7309,377,0,2}, {7309,none,2,0}, {7311,377,0,2}, {7311,none,1,0}, {7312,372,0,1},
+    {7312,none,1,0}, {7313,none,1,0}, {7314,none,1,0}, {7315,379,0,1}, {7315,none,2,0}, {7317,372,0,1}, {7317,none,1,0},
+    {7318,none,2,0}, {7320,368,0,1}, {7320,none,1,0}, {7321,371,0,1}, {7321,none,1,0}, {7322,none,1,0}, {7323,none,1,0},
+    {7324,415,0,1}, {7324,none,2,0}, {7326,none,1,0}, {7327,none,1,0}, {7328,1294,0,2}, {7328,none,3,0}, {7331,1296,0,1},
+    {7331,none,1,0}, {7332,none,4,0}, {7336,349,0,1}, {7336,none,1,0}, {7337,1297,0,2}, {7337,none,1,0}, {7338,none,1,0},
+    {7339,none,1,0}, {7340,1299,0,2}, {7340,none,3,0}, {7343,none,1,0}, {7344,349,0,1}, {7344,none,1,0}, {7345,1301,0,1},
+    {7345,none,1,0}, {7346,1302,0,1}, {7346,none,1,0}, {7347,none,2,0}, {7349,388,0,1}, {7349,none,3,0}, {7352,none,1,0},
+    {7353,388,0,1}, {7353,none,1,0}, {7354,1303,0,1}, {7354,none,1,0}, {7355,1304,0,1}, {7355,none,3,0}, {7358,none,1,0},
+    {7359,none,4,0}, {7363,348,0,1}, {7363,none,1,0}, {7364,none,1,0}, {7365,none,1,0}, {7366,none,1,0}, {7367,none,1,0},
+    {7368,348,0,1}, {7368,none,1,0}, {7369,none,1,0}, {7370,1305,0,2}, {7370,none,1,0}, {7371,1307,0,2}, {7371,none,1,0},
+    {7372,none,1,0}, {7373,none,1,0}, {7374,none,1,0}, {7375,none,1,0}, {7376,1309,0,1}, {7376,none,3,0}, {7379,384,0,1},
+    {7379,none,1,0}, {7380,none,1,0}, {7381,none,1,0}, {7382,387,0,1}, {7382,none,2,0}, {7384,385,0,2}, {7384,none,2,0},
+    {7386,384,0,1}, {7386,none,1,0}, {7387,none,1,0}, {7388,385,0,2}, {7388,none,4,0}, {7392,none,1,0}, {7393,none,1,0},
+    {7394,none,1,0}, {7395,1259,0,1}, {7395,none,1,0}, {7396,none,1,0}, {7397,none,3,0}, {7400,1310,0,1}, {7400,none,1,0},
+    {7401,1311,0,2}, {7401,none,1,0}, {7402,1313,0,2}, {7402,none,1,0}, {7403,none,1,0}, {7404,none,1,0}, {7405,none,1,0},
+    {7406,none,1,0}, {7407,none,1,0}, {7408,none,1,0}, {7409,none,1,0}, {7410,none,1,0}, {7411,1310,0,1}, {7411,none,1,0},
+    {7412,none,1,0}, {7413,none,2,0}, {7415,389,0,1}, {7415,none,1,0}, {7416,392,0,1}, {7416,none,7,0}, {7423,none,4,0},
+    {7427,402,0,1}, {7427,none,1,0}, {7428,none,1,0}, {7429,none,1,0}, {7430,405,0,1}, {7430,none,1,0}, {7431,403,0,2},
+    {7431,none,1,0}, {7432,1315,0,2}, {7432,none,1,0}, {7433,none,1,0}, {7434,none,1,0}, {7435,none,2,0}, {7437,none,1,0},
+    {7438,none,1,0}, {7439,none,1,0}, {7440,415,0,1}, {7440,none,1,0}, {7441,none,1,0}, {7442,none,1,0}, {7443,none,1,0},
+    {7444,none,1,0}, {7445,none,1,0}, {7446,none,1,0}, {7447,none,1,0}, {7448,348,0,1}, {7448,none,1,0}, {7449,none,2,0},
+    {7451,411,0,1}, {7451,none,2,0}, {7453,412,0,1}, {7453,none,1,0}, {7454,412,0,1}, {7454,none,1,0}, {7455,none,1,0},
+    {7456,none,1,0}, {7457,415,0,1}, {7457,none,1,0}, {7458,none,1,0}, {7459,none,1,0}, {7460,348,0,1}, {7460,none,1,0},
+    {7461,none,1,0}, {7462,none,2,0}, {7464,none,1,0}, {7465,none,1,0}, {7466,395,0,1}, {7466,none,1,0}, {7467,none,1,0},
+    {7468,398,0,1}, {7468,none,3,0}, {7471,none,4,0}, {7475,1317,0,1}, {7475,none,1,0}, {7476,1318,0,2}, {7476,none,1,0},
+    {7477,401,0,1}, {7477,none,1,0}, {7478,none,1,0}, {7479,none,2,0}, {7481,399,0,2}, {7481,none,1,0}, {7482,none,2,0},
+    {7484,401,0,1}, {7484,none,1,0}, {7485,1318,0,2}, {7485,none,1,0}, {7486,none,2,0}, {7488,402,0,1}, {7488,none,1,0},
+    {7489,none,1,0}, {7490,403,0,2}, {7490,none,4,0}, {7494,1320,0,1}, {7494,none,1,0}, {7495,1321,0,2}, {7495,none,1,0},
+    {7496,410,0,1}, {7496,none,1,0}, {7497,none,1,0}, {7498,none,2,0}, {7500,408,0,2}, {7500,none,1,0}, {7501,none,2,0},
+    {7503,410,0,1}, {7503,none,1,0}, {7504,1321,0,2}, {7504,none,4,0}, {7508,none,1,0}, {7509,none,1,0}, {7510,360,0,1},
+    {7510,none,1,0}, {7511,none,1,0}, {7512,none,1,0}, {7513,none,1,0}, {7514,1323,0,1}, {7514,none,1,0}, {7515,none,1,0},
+    {7516,374,0,1}, {7516,none,1,0}, {7517,none,1,0}, {7518,none,1,0}, {7519,none,1,0}, {7520,none,1,0}, {7521,none,1,0},
+    {7522,none,2,0}, {7524,none,1,0}, {7525,none,1,0}, {7526,none,1,0}, {7527,none,2,0}, {7529,368,0,1}, {7529,none,1,0},
+    {7530,none,1,0}, {7531,371,0,1}, {7531,none,1,0}, {7532,none,1,0}, {7533,none,1,0}, {7534,none,1,0}, {7535,none,2,0},
+    {7537,389,0,1}, {7537,none,1,0}, {7538,none,1,0}, {7539,392,0,1}, {7539,none,2,0}, {7541,1324,0,1}, {7541,none,3,0},
+    {7544,1325,0,1}, {7544,none,1,0}, {7545,none,1,0}, {7546,none,1,0}, {7547,1326,0,1}, {7547,none,1,0}, {7548,none,1,0},
+    {7549,9,0,1}, {7549,none,9,0}, {7558,none,1,0}, {7559,none,1,0}, {7560,none,1,0}, {7561,none,1,0}, {7562,1327,0,1},
+    {7562,none,1,0}, {7563,none,1,0}, {7564,none,1,0}, {7565,none,1,0}, {7566,1328,0,1}, {7566,none,1,0}, {7567,none,1,0},
+    {7568,1329,0,2}, {7568,none,1,0}, {7569,none,1,0}, {7570,none,1,0}, {7571,none,1,0}, {7572,1331,0,1}, {7572,none,2,0},
+    {7574,none,1,0}, {7575,1332,0,2}, {7575,none,1,0}, {7576,1334,0,2}, {7576,none,1,0}, {7577,none,1,0}, {7578,none,1,0},
+    {7579,none,1,0}, {7580,none,1,0}, {7581,1336,0,1}, {7581,none,3,0}, {7584,none,1,0}, {7585,none,1,0}, {7586,none,1,0},
+    {7587,1337,0,1}, {7587,none,1,0}, {7588,1338,0,2}, {7588,none,2,0}, {7590,1340,0,2}, {7590,none,1,0}, {7591,none,1,0},
+    {7592,none,1,0}, {7593,1342,0,2}, {7593,none,2,0}, {7595,none,1,0}, {7596,none,1,0}, {7597,none,1,0}, {7598,1344,0,1},
+    {7598,none,1,0}, {7599,none,1,0}, {7600,none,1,0}, {7601,none,1,0}, {7602,1345,0,2}, {7602,none,1,0}, {7603,none,1,0},
+    {7604,none,1,0}, {7605,1347,0,2}, {7605,none,3,0}, {7608,none,1,0}, {7609,none,1,0}, {7610,none,1,0}, {7611,1349,0,1},
+    {7611,none,1,0}, {7612,none,2,0}, {7614,none,1,0}, {7615,none,1,0}, {7616,1350,0,1}, {7616,none,2,0}, {7618,599,0,1},
+    {7618,none,1,0}, {7619,none,1,0}, {7620,599,0,1}, {7620,none,1,0}, {7621,none,1,0}, {7622,none,1,0}, {7623,none,1,0},
+    {7624,1351,0,1}, {7624,none,18,0}, {7642,none,1,0}, {7643,841,0,1}, {7643,none,2,0}, {7645,none,1,0}, {7646,none,1,0},
+    {7647,none,1,0}, {7648,none,1,0}, {7649,1352,0,1}, {7649,none,1,0}, {7650,none,1,0}, {7651,842,0,1}, {7651,none,2,0},
+    {7653,none,1,0}, {7654,none,2,0}, {7656,843,0,1}, {7656,none,1,0}, {7657,1353,0,1}, {7657,none,1,0}, {7658,1354,0,1},
+    {7658,none,5,0}, {7663,none,1,0}, {7664,none,1,0}, {7665,none,1,0}, {7666,844,0,1}, {7666,none,1,0}, {7667,none,1,0},
+    {7668,none,1,0}, {7669,none,1,0}, {7670,1355,0,1}, {7670,none,1,0}, {7671,none,1,0}, {7672,1356,0,1}, {7672,none,1,0},
+    {7673,none,1,0}, {7674,92,0,1}, {7674,none,1,0}, {7675,none,1,0}, {7676,none,1,0}, {7677,none,1,0}, {7678,1357,0,1},
+    {7678,none,1,0}, {7679,none,1,0}, {7680,none,1,0}, {7681,none,1,0}, {7682,1358,0,1}, {7682,none,2,0}, {7684,none,1,0},
+    {7685,none,1,0}, {7686,none,1,0}, {7687,1359,0,1}, {7687,none,1,0}, {7688,1360,0,2}, {7688,none,3,0}, {7691,none,1,0},
+    {7692,none,1,0}, {7693,13,0,1}, {7693,none,1,0}, {7694,none,1,0}, {7695,none,1,0}, {7696,none,1,0}, {7697,1362,0,1},
+    {7697,none,1,0}, {7698,1363,0,1}, {7698,none,2,0}, {7700,none,1,0}, {7701,none,1,0}, {7702,none,1,0}, {7703,1364,0,1},
+    {7703,none,1,0}, {7704,429,0,1}, {7704,none,1,0}, {7705,none,1,0}, {7706,none,1,0}, {7707,102,0,1}, {7707,none,4,0},
+    {7711,none,1,0}, {7712,none,1,0}, {7713,none,1,0}, {7714,839,0,1}, {7714,none,2,0}, {7716,none,1,0}, {7717,none,1,0},
+    {7718,1365,0,1}, {7718,none,1,0}, {7719,none,1,0}, {7720,none,1,0}, {7721,none,1,0}, {7722,1366,0,1}, {7722,none,1,0},
+    {7723,none,1,0}, {7724,none,1,0}, {7725,441,0,1}, {7725,none,1,0}, {7726,1367,0,1}, {7726,none,3,0}, {7729,none,1,0},
+    {7730,none,1,0}, {7731,none,1,0}, {7732,1368,0,1}, {7732,none,1,0}, {7733,none,1,0}, {7734,none,1,0}, {7735,1369,0,1},
+    {7735,none,3,0}, {7738,none,1,0}, {7739,none,1,0}, {7740,none,1,0}, {7741,none,1,0}, {7742,1370,0,1}, {7742,none,1,0},
+    {7743,1371,0,1}, {7743,none,1,0}, {7744,none,1,0}, {7745,none,1,0}, {7746,93,0,1}, {7746,none,1,0}, {7747,none,1,0},
+    {7748,none,1,0}, {7749,1372,0,2}, {7749,none,3,0}, {7752,none,1,0}, {7753,none,1,0}, {7754,1374,0,1}, {7754,none,1,0},
+    {7755,none,1,0}, {7756,none,1,0}, {7757,1375,0,1}, {7757,none,1,0}, {7758,none,1,0}, {7759,none,1,0}, {7760,94,0,1},
+    {7760,none,7,0}, {7767,1376,0,1}, {7767,none,1,0}, {7768,none,1,0}, {7769,none,1,0}, {7770,840,0,1}, {7770,none,4,0},
+    {7774,1377,0,1}, {7774,none,1,0}, {7775,none,2,0}, {7777,1378,0,1}, {7777,none,1,0}, {7778,none,1,0}, {7779,1378,0,1},
+    {7779,none,1,0}, {7780,1379,0,1}, {7780,none,1,0}, {7781,1380,0,1}, {7781,none,1,0}, {7782,none,1,0}, {7783,none,1,0},
+    {7784,none,1,0}, {7785,1381,0,1}, {7785,none,1,0}, {7786,none,1,0}, {7787,1382,0,1}, {7787,none,1,0}, {7788,none,1,0},
+    {7789,none,1,0}, {7790,none,1,0}, {7791,none,1,0}, {7792,1383,0,1}, {7792,none,1,0}, {7793,1384,0,1}, {7793,none,3,0},
+    {7796,none,1,0}, {7797,none,1,0}, {7798,1378,0,1}, {7798,none,1,0}, {7799,none,1,0}, {7800,none,1,0}, {7801,none,1,0},
+    {7802,1385,0,1}, {7802,none,1,0}, {7803,none,1,0}, {7804,1386,0,1}, {7804,none,1,0}, {7805,none,2,0}, {7807,none,1,0},
+    {7808,none,1,0}, {7809,none,1,0}, {7810,1387,0,1}, {7810,none,1,0}, {7811,none,1,0}, {7812,none,2,0}, {7814,95,0,1},
+    {7814,none,1,0}, {7815,none,1,0}, {7816,1388,0,1}, {7816,none,1,0}, {7817,none,1,0}, {7818,none,1,0}, {7819,1389,0,1},
+    {7819,none,1,0}, {7820,none,1,0}, {7821,none,1,0}, {7822,none,1,0}, {7823,1390,0,1}, {7823,none,12,0}, {7835,none,1,0},
+    {7836,none,4,0}, {7840,141,0,1}, {7840,none,2,0}, {7842,32,0,1}, {7842,none,1,0}, {7843,none,1,0}, {7844,none,1,0},
+    {7845,none,1,0}, {7846,141,0,1}, {7846,none,2,0}, {7848,none,1,0}, {7849,none,1,0}, {7850,1391,0,1}, {7850,none,1,0},
+    {7851,1392,0,1}, {7851,none,1,0}, {7852,445,0,1}, {7852,none,1,0}, {7853,none,1,0}, {7854,1393,0,1}, {7854,none,1,0},
+    {7855,none,5,0}, {7860,none,1,0}, {7861,none,1,0}, {7862,none,1,0}, {7863,1394,0,1}, {7863,none,1,0}, {7864,none,1,0},
+    {7865,none,1,0}, {7866,1395,0,1}, {7866,none,1,0}, {7867,none,1,0}, {7868,none,1,0}, {7869,44,0,1}, {7869,none,1,0},
+    {7870,597,0,1}, {7870,none,1,0}, {7871,none,1,0}, {7872,none,1,0}, {7873,none,1,0}, {7874,1396,0,1}, {7874,none,1,0},
+    {7875,none,1,0}, {7876,1397,0,2}, {7876,none,3,0}, {7879,none,2,0}, {7881,1399,0,1}, {7881,none,1,0}, {7882,1400,0,1},
+    {7882,none,1,0}, {7883,none,1,0}, {7884,none,1,0}, {7885,none,1,0}, {7886,328,0,1}, {7886,none,1,0}, {7887,none,1,0},
+    {7888,none,1,0}, {7889,1401,0,1}, {7889,none,3,0}, {7892,1402,0,1}, {7892,none,1,0}, {7893,none,1,0}, {7894,none,1,0},
+    {7895,none,1,0}, {7896,none,1,0}, {7897,none,1,0}, {7898,none,1,0}, {7899,987,0,1}, {7899,none,1,0}, {7900,1403,0,1},
+    {7900,none,2,0}, {7902,none,1,0}, {7903,none,2,0}, {7905,none,1,0}, {7906,none,2,0}, {7908,1051,0,1}, {7908,none,1,0},
+    {7909,1404,0,1}, {7909,none,1,0}, {7910,none,1,0}, {7911,1051,0,1}, {7911,none,1,0}, {7912,none,9,0}, {7921,1405,0,1},
+    {7921,none,1,0}, {7922,none,1,0}, {7923,none,1,0}, {7924,none,1,0}, {7925,1406,0,1}, {7925,none,1,0}, {7926,790,0,1},
+    {7926,none,1,0}, {7927,none,1,0}, {7928,none,1,0}, {7929,1407,0,1}, {7929,none,2,0}, {7931,none,1,0}, {7932,915,0,1},
+    {7932,none,1,0}, {7933,1408,0,1}, {7933,none,1,0}, {7934,1409,0,1}, {7934,none,1,0}, {7935,none,1,0}, {7936,451,0,1},
+    {7936,none,1,0}, {7937,none,1,0}, {7938,none,1,0}, {7939,1410,0,1}, {7939,none,1,0}, {7940,none,1,0}, {7941,none,1,0},
+    {7942,1411,0,1}, {7942,none,1,0}, {7943,451,0,1}, {7943,none,3,0}, {7946,none,1,0}, {7947,none,1,0}, {7948,none,1,0},
+    {7949,none,1,0}, {7950,none,1,0}, {7951,none,1,0}, {7952,1412,0,1}, {7952,none,1,0}, {7953,none,1,0}, {7954,1413,0,2},
+    {7954,none,1,0}, {7955,none,1,0}, {7956,none,1,0}, {7957,1415,0,1}, {7957,none,10,0}, {7967,454,0,1}, {7967,none,1,0},
+    {7968,1416,0,1}, {7968,none,1,0}, {7969,none,1,0}, {7970,1417,0,1}, {7970,none,1,0}, {7971,none,1,0}, {7972,none,1,0},
+    {7973,456,0,1}, {7973,none,2,0}, {7975,455,0,1}, {7975,none,6,0}, {7981,454,0,1}, {7981,none,1,0}, {7982,none,1,0},
+    {7983,none,1,0}, {7984,none,1,0}, {7985,none,1,0}, {7986,none,1,0}, {7987,1417,0,1}, {7987,none,1,0}, {7988,none,1,0},
+    {7989,none,1,0}, {7990,none,1,0}, {7991,none,1,0}, {7992,none,1,0}, {7993,none,1,0}, {7994,456,0,1}, {7994,none,1,0},
+    {7995,none,1,0}, {7996,455,0,1}, {7996,none,3,0}, {7999,none,1,0}, {8000,none,1,0}, {8001,none,1,0}, {8002,none,1,0},
+    {8003,none,1,0}, {8004,none,1,0}, {8005,1418,0,1}, {8005,none,1,0}, {8006,none,1,0}, {8007,none,1,0}, {8008,1419,0,1},
+    {8008,none,1,0}, {8009,none,1,0}, {8010,none,1,0}, {8011,1420,0,1}, {8011,none,1,0}, {8012,none,1,0}, {8013,none,1,0},
+    {8014,457,0,1}, {8014,none,1,0}, {8015,none,1,0}, {8016,none,2,0}, {8018,1421,0,1}, {8018,none,1,0}, {8019,452,0,1},
+    {8019,none,3,0}, {8022,none,1,0}, {8023,1419,0,1}, {8023,none,1,0}, {8024,none,1,0}, {8025,1418,0,1}, {8025,none,1,0},
+    {8026,none,1,0}, {8027,none,1,0}, {8028,1420,0,1}, {8028,none,3,0}, {8031,none,1,0}, {8032,459,0,1}, {8032,none,3,0},
+    {8035,none,1,0}, {8036,none,1,0}, {8037,none,1,0}, {8038,none,1,0}, {8039,1422,0,1}, {8039,none,1,0}, {8040,none,1,0},
+    {8041,none,1,0}, {8042,none,1,0}, {8043,1423,0,1}, {8043,none,1,0}, {8044,none,1,0}, {8045,none,1,0}, {8046,none,1,0},
+    {8047,1424,0,1}, {8047,none,2,0}, {8049,460,0,1}, {8049,none,1,0}, {8050,none,1,0}, {8051,460,0,1}, {8051,none,1,0},
+    {8052,none,1,0}, {8053,none,1,0}, {8054,457,0,1}, {8054,none,1,0}, {8055,none,1,0}, {8056,none,1,0}, {8057,none,1,0},
+    {8058,1425,0,1}, {8058,none,2,0}, {8060,none,1,0}, {8061,none,1,0}, {8062,1426,0,2}, {8062,none,1,0}, {8063,1428,0,1},
+    {8063,none,1,0}, {8064,none,1,0}, {8065,none,1,0}, {8066,none,1,0}, {8067,none,1,0}, {8068,25,0,1}, {8068,none,6,0},
+    {8074,none,1,0}, {8075,none,1,0}, {8076,1429,0,2}, {8076,none,1,0}, {8077,none,1,0}, {8078,none,1,0}, {8079,1078,0,1},
+    {8079,none,1,0}, {8080,none,1,0}, {8081,none,1,0}, {8082,1431,0,2}, {8082,none,1,0}, {8083,none,1,0}, {8084,none,1,0},
+    {8085,none,1,0}, {8086,none,1,0}, {8087,1433,0,1}, {8087,none,1,0}, {8088,none,1,0}, {8089,none,1,0}, {8090,1434,0,2},
+    {8090,none,3,0}, {8093,none,1,0}, {8094,none,2,0}, {8096,none,1,0}, {8097,none,1,0}, {8098,none,1,0}, {8099,none,1,0},
+    {8100,none,1,0}, {8101,none,1,0}, {8102,none,1,0}, {8103,222,0,1}, {8103,none,1,0}, {8104,none,1,0}, {8105,none,1,0},
+    {8106,1436,0,1}, {8106,none,1,0}, {8107,none,1,0}, {8108,none,2,0}, {8110,1437,0,1}, {8110,none,1,0}, {8111,none,1,0},
+    {8112,961,0,1}, {8112,none,1,0}, {8113,none,1,0}, {8114,464,0,1}, {8114,none,21,0}, {8135,none,3,0}, {8138,none,1,0},
+    {8139,none,1,0}, {8140,none,1,0}, {8141,507,0,1}, {8141,none,1,0}, {8142,none,1,0}, {8143,137,0,1}, {8143,none,1,0},
+    {8144,none,1,0}, {8145,none,1,0}, {8146,none,1,0}, {8147,1438,0,1}, {8147,none,1,0}, {8148,none,1,0}, {8149,none,1,0},
+    {8150,none,1,0}, {8151,891,0,1}, {8151,none,1,0}, {8152,none,1,0}, {8153,none,1,0}, {8154,1439,0,1}, {8154,none,7,0},
+    {8161,none,2,0}, {8163,none,1,0}, {8164,1440,0,2}, {8164,none,1,0}, {8165,none,1,0}, {8166,none,1,0}, {8167,1442,0,1},
+    {8167,none,1,0}, {8168,none,1,0}, {8169,none,1,0}, {8170,526,0,1}, {8170,none,1,0}, {8171,none,1,0}, {8172,none,1,0},
+    {8173,none,1,0}, {8174,none,1,0}, {8175,none,1,0}, {8176,1443,0,1}, {8176,none,1,0}, {8177,none,4,0}, {8181,484,0,1},
+    {8181,none,1,0}, {8182,1444,0,1}, {8182,none,1,0}, {8183,1445,0,1}, {8183,none,1,0}, {8184,none,1,0}, {8185,484,0,1},
+    {8185,none,1,0}, {8186,none,1,0}, {8187,none,1,0}, {8188,1446,0,1}, {8188,none,1,0}, {8189,none,11,0}, {8200,17,0,1},
+    {8200,none,1,0}, {8201,none,1,0}, {8202,1447,0,1}, {8202,none,2,0}, {8204,485,0,1}, {8204,none,1,0}, {8205,none,1,0},
+    {8206,1448,0,1}, {8206,none,1,0}, {8207,1449,0,1}, {8207,none,1,0}, {8208,none,1,0}, {8209,1450,0,1}, {8209,none,1,0},
+    {8210,none,1,0}, {8211,1063,0,1}, {8211,none,1,0}, {8212,none,1,0}, {8213,1196,0,1}, {8213,none,1,0}, {8214,none,1,0},
+    {8215,1451,0,1}, {8215,none,1,0}, {8216,none,1,0}, {8217,none,1,0}, {8218,1452,0,1}, {8218,none,1,0}, {8219,none,1,0},
+    {8220,1453,0,1}, {8220,none,1,0}, {8221,1454,0,1}, {8221,none,2,0}, {8223,none,1,0}, {8224,none,1,0}, {8225,none,1,0},
+    {8226,1455,0,1}, {8226,none,1,0}, {8227,none,2,0}, {8229,1456,0,1}, {8229,none,1,0}, {8230,none,1,0}, {8231,none,1,0},
+    {8232,none,1,0}, {8233,467,0,1}, {8233,none,3,0}, {8236,none,1,0}, {8237,none,1,0}, {8238,none,1,0}, {8239,741,0,1},
+    {8239,none,1,0}, {8240,none,1,0}, {8241,none,1,0}, {8242,1457,0,1}, {8242,none,2,0}, {8244,none,1,0}, {8245,none,2,0},
+    {8247,none,1,0}, {8248,1458,0,1}, {8248,none,1,0}, {8249,1459,0,1}, {8249,none,2,0}, {8251,none,1,0}, {8252,1460,0,1},
+    {8252,none,1,0}, {8253,none,2,0}, {8255,none,1,0}, {8256,1461,0,1}, {8256,none,1,0}, {8257,1462,0,1}, {8257,none,4,0},
+    {8261,none,1,0}, {8262,none,1,0}, {8263,none,1,0}, {8264,none,1,0}, {8265,1463,0,1}, {8265,none,2,0}, {8267,none,1,0},
+    {8268,none,1,0}, {8269,none,1,0}, {8270,1464,0,1}, {8270,none,1,0}, {8271,none,1,0}, {8272,487,0,1}, {8272,none,1,0},
+    {8273,none,1,0}, {8274,1458,0,1}, {8274,none,1,0}, {8275,1465,0,1}, {8275,none,4,0}, {8279,none,1,0}, {8280,none,1,0},
+    {8281,1466,0,1}, {8281,none,1,0}, {8282,none,1,0}, {8283,none,1,0}, {8284,none,1,0}, {8285,none,1,0}, {8286,1467,0,1},
+    {8286,none,1,0}, {8287,none,1,0}, {8288,none,2,0}, {8290,35,0,1}, {8290,none,1,0}, {8291,35,0,1}, {8291,none,1,0},
+    {8292,none,1,0}, {8293,1468,0,1}, {8293,none,3,0}, {8296,none,1,0}, {8297,none,4,0}, {8301,479,0,1}, {8301,none,1,0},
+    {8302,none,1,0}, {8303,none,1,0}, {8304,508,0,1}, {8304,none,1,0}, {8305,none,1,0}, {8306,none,1,0}, {8307,none,1,0},
+    {8308,479,0,1}, {8308,none,1,0}, {8309,505,0,1}, {8309,none,1,0}, {8310,none,1,0}, {8311,1469,0,1}, {8311,none,1,0},
+    {8312,471,0,1}, {8312,none,3,0}, {8315,none,1,0}, {8316,none,1,0}, {8317,none,1,0}, {8318,none,1,0}, {8319,1470,0,1},
+    {8319,none,1,0}, {8320,none,1,0}, {8321,none,1,0}, {8322,none,1,0}, {8323,492,0,1}, {8323,none,1,0}, {8324,1471,0,2},
+    {8324,none,2,0}, {8326,none,1,0}, {8327,none,2,0}, {8329,none,1,0}, {8330,150,0,1}, {8330,none,2,0}, {8332,503,0,1},
+    {8332,none,1,0}, {8333,1473,0,1}, {8333,none,2,0}, {8335,1474,0,1}, {8335,none,1,0}, {8336,1475,0,1}, {8336,none,3,0},
+    {8339,none,1,0}, {8340,none,1,0}, {8341,none,6,0}, {8347,none,1,0}, {8348,none,1,0}, {8349,none,1,0}, {8350,none,1,0},
+    {8351,none,2,0}, {8353,17,0,1}, {8353,none,1,0}, {8354,none,1,0}, {8355,none,1,0}, {8356,none,1,0}, {8357,1453,0,1},
+    {8357,none,1,0}, {8358,none,1,0}, {8359,none,1,0}, {8360,none,1,0}, {8361,none,1,0}, {8362,none,1,0}, {8363,none,2,0},
+    {8365,none,1,0}, {8366,none,1,0}, {8367,none,1,0}, {8368,none,1,0}, {8369,150,0,1}, {8369,none,1,0}, {8370,none,1,0},
+    {8371,503,0,1}, {8371,none,1,0}, {8372,none,1,0}, {8373,none,1,0}, {8374,none,2,0}, {8376,none,1,0}, {8377,none,1,0},
+    {8378,none,1,0}, {8379,none,1,0}, {8380,none,1,0}, {8381,none,1,0}, {8382,486,0,1}, {8382,none,1,0}, {8383,none,1,0},
+    {8384,none,1,0}, {8385,none,1,0}, {8386,none,1,0}, {8387,none,1,0}, {8388,none,1,0}, {8389,none,1,0}, {8390,177,0,1},
+    {8390,none,1,0}, {8391,none,1,0}, {8392,none,1,0}, {8393,none,1,0}, {8394,none,1,0}, {8395,none,1,0}, {8396,none,1,0},
+    {8397,none,1,0}, {8398,none,1,0}, {8399,none,1,0}, {8400,none,1,0}, {8401,1476,0,1}, {8401,none,1,0}, {8402,none,1,0},
+    {8403,none,1,0}, {8404,none,1,0}, {8405,none,1,0}, {8406,none,1,0}, {8407,none,1,0}, {8408,none,1,0}, {8409,none,1,0},
+    {8410,none,1,0}, {8411,1454,0,1}, {8411,none,1,0}, {8412,none,1,0}, {8413,none,1,0}, {8414,none,1,0}, {8415,none,1,0},
+    {8416,none,1,0}, {8417,none,1,0}, {8418,none,1,0}, {8419,none,1,0}, {8420,none,1,0}, {8421,1477,0,1}, {8421,none,1,0},
+    {8422,none,1,0}, {8423,5,0,1}, {8423,none,1,0}, {8424,none,1,0}, {8425,none,1,0}, {8426,none,1,0}, {8427,none,1,0},
+    {8428,none,1,0}, {8429,none,1,0}, {8430,none,1,0}, {8431,none,1,0}, {8432,none,1,0}, {8433,964,0,1}, {8433,none,3,0},
+    {8436,none,1,0}, {8437,none,1,0}, {8438,none,1,0}, {8439,486,0,1}, {8439,none,1,0}, {8440,none,1,0}, {8441,none,1,0},
+    {8442,177,0,1}, {8442,none,1,0}, {8443,1478,0,1}, {8443,none,1,0}, {8444,none,1,0}, {8445,none,1,0}, {8446,none,1,0},
+    {8447,none,2,0}, {8449,1479,0,1}, {8449,none,1,0}, {8450,none,1,0}, {8451,none,1,0}, {8452,none,1,0}, {8453,1479,0,1},
+    {8453,none,1,0}, {8454,none,1,0}, {8455,none,1,0}, {8456,none,1,0}, {8457,1480,0,1}, {8457,none,4,0}, {8461,none,2,0},
+    {8463,none,1,0}, {8464,none,1,0}, {8465,1481,0,1}, {8465,none,1,0}, {8466,none,1,0}, {8467,1482,0,1}, {8467,none,1,0},
+    {8468,none,1,0}, {8469,none,1,0}, {8470,488,0,1}, {8470,none,3,0}, {8473,none,1,0}, {8474,none,1,0}, {8475,1483,0,1},
+    {8475,none,1,0}, {8476,1484,0,2}, {8476,none,1,0}, {8477,none,1,0}, {8478,none,1,0}, {8479,1486,0,1}, {8479,none,1,0},
+    {8480,none,1,0}, {8481,none,1,0}, {8482,none,1,0}, {8483,none,1,0}, {8484,1487,0,1}, {8484,none,2,0}, {8486,none,1,0},
+    {8487,none,2,0}, {8489,1488,0,1}, {8489,none,1,0}, {8490,none,1,0}, {8491,1489,0,1}, {8491,none,1,0}, {8492,none,1,0},
+    {8493,none,1,0}, {8494,none,1,0}, {8495,none,1,0}, {8496,none,1,0}, {8497,1490,0,1}, {8497,none,1,0}, {8498,none,1,0},
+    {8499,none,1,0}, {8500,none,1,0}, {8501,1476,0,1}, {8501,none,4,0}, {8505,none,1,0}, {8506,none,1,0}, {8507,none,1,0},
+    {8508,none,1,0}, {8509,1491,0,1}, {8509,none,1,0}, {8510,none,1,0}, {8511,1492,0,2}, {8511,none,1,0}, {8512,509,0,1},
+    {8512,none,2,0}, {8514,none,1,0}, {8515,1459,0,1}, {8515,none,1,0}, {8516,none,2,0}, {8518,97,0,1}, {8518,none,1,0},
+    {8519,97,0,1}, {8519,none,3,0}, {8522,none,1,0}, {8523,none,1,0}, {8524,none,1,0}, {8525,none,1,0}, {8526,1477,0,1},
+    {8526,none,1,0}, {8527,none,1,0}, {8528,none,1,0}, {8529,none,1,0}, {8530,1494,0,1}, {8530,none,1,0}, {8531,none,4,0},
+    {8535,1495,0,1}, {8535,none,1,0}, {8536,498,0,1}, {8536,none,1,0}, {8537,746,0,1}, {8537,none,1,0}, {8538,none,1,0},
+    {8539,none,1,0}, {8540,none,1,0}, {8541,1496,0,1}, {8541,none,1,0}, {8542,none,1,0}, {8543,none,1,0}, {8544,none,1,0},
+    {8545,none,1,0}, {8546,none,1,0}, {8547,1497,0,1}, {8547,none,1,0}, {8548,1498,0,1}, {8548,none,19,0}, {8567,none,1,0},
+    {8568,none,1,0}, {8569,none,1,0}, {8570,none,1,0}, {8571,none,1,0}, {8572,1499,0,1}, {8572,none,1,0}, {8573,none,1,0},
+    {8574,none,1,0}, {8575,none,1,0}, {8576,1214,0,1}, {8576,none,10,0}, {8586,539,0,1}, {8586,none,1,0}, {8587,1500,0,1},
+    {8587,none,2,0}, {8589,none,1,0}, {8590,1501,0,1}, {8590,none,1,0}, {8591,none,1,0}, {8592,none,1,0}, {8593,1502,0,1},
+    {8593,none,1,0}, {8594,none,1,0}, {8595,none,1,0}, {8596,541,0,1}, {8596,none,2,0}, {8598,540,0,1}, {8598,none,1,0},
+    {8599,none,1,0}, {8600,none,1,0}, {8601,1503,0,1}, {8601,none,1,0}, {8602,none,1,0}, {8603,none,1,0}, {8604,1504,0,1},
+    {8604,none,3,0}, {8607,none,1,0}, {8608,1505,0,1}, {8608,none,1,0}, {8609,none,1,0}, {8610,1506,0,1}, {8610,none,1,0},
+    {8611,none,1,0}, {8612,none,1,0}, {8613,1507,0,1}, {8613,none,1,0}, {8614,none,1,0}, {8615,none,1,0}, {8616,none,1,0},
+    {8617,none,1,0}, {8618,none,1,0}, {8619,1508,0,1}, {8619,none,1,0}, {8620,none,1,0}, {8621,none,1,0}, {8622,542,0,1},
+    {8622,none,1,0}, {8623,1509,0,1}, {8623,none,1,0}, {8624,none,1,0}, {8625,none,3,0}, {8628,1510,0,1}, {8628,none,1,0},
+    {8629,916,0,1}, {8629,none,1,0}, {8630,1511,0,1}, {8630,none,7,0}, {8637,none,1,0}, {8638,none,1,0}, {8639,none,1,0},
+    {8640,1512,0,1}, {8640,none,1,0}, {8641,none,2,0}, {8643,none,1,0}, {8644,none,1,0}, {8645,1058,0,1}, {8645,none,2,0},
+    {8647,321,0,1}, {8647,none,1,0}, {8648,none,1,0}, {8649,321,0,1}, {8649,none,1,0}, {8650,none,1,0}, {8651,33,0,1},
+    {8651,none,1,0}, {8652,none,1,0}, {8653,1513,0,1}, {8653,none,1,0}, {8654,none,1,0}, {8655,none,1,0}, {8656,none,1,0},
+    {8657,1514,0,1}, {8657,none,1,0}, {8658,none,2,0}, {8660,none,1,0}, {8661,none,1,0}, {8662,none,1,0}, {8663,none,1,0},
+    {8664,67,0,1}, {8664,none,1,0}, {8665,67,0,1}, {8665,none,1,0}, {8666,none,1,0}, {8667,1515,0,1}, {8667,none,1,0},
+    {8668,none,2,0}, {8670,1516,0,2}, {8670,none,1,0}, {8671,none,1,0}, {8672,none,1,0}, {8673,1006,0,1}, {8673,none,4,0},
+    {8677,none,1,0}, {8678,none,1,0}, {8679,none,1,0}, {8680,37,0,1}, {8680,none,2,0}, {8682,none,1,0}, {8683,none,1,0},
+    {8684,none,1,0}, {8685,1518,0,1}, {8685,none,1,0}, {8686,1519,0,1}, {8686,none,1,0}, {8687,none,1,0}, {8688,none,2,0},
+    {8690,none,1,0}, {8691,none,1,0}, {8692,none,1,0}, {8693,615,0,1}, {8693,none,1,0}, {8694,none,1,0}, {8695,none,1,0},
+    {8696,none,1,0}, {8697,none,1,0}, {8698,none,1,0}, {8699,none,1,0}, {8700,none,1,0}, {8701,141,0,1}, {8701,none,1,0},
+    {8702,1520,0,1}, {8702,none,2,0}, {8704,none,1,0}, {8705,none,1,0}, {8706,none,3,0}, {8709,1521,0,1}, {8709,none,1,0},
+    {8710,1522,0,1}, {8710,none,1,0}, {8711,1522,0,1}, {8711,none,8,0}, {8719,562,0,1}, {8719,none,1,0}, {8720,none,1,0},
+    {8721,none,1,0}, {8722,1523,0,1}, {8722,none,2,0}, {8724,563,0,1}, {8724,none,1,0}, {8725,563,0,1}, {8725,none,2,0},
+    {8727,1524,0,1}, {8727,none,1,0}, {8728,1525,0,1}, {8728,none,2,0}, {8730,1526,0,1}, {8730,none,1,0}, {8731,1527,0,1},
+    {8731,none,1,0}, {8732,none,1,0}, {8733,1528,0,1}, {8733,none,1,0}, {8734,none,1,0}, {8735,none,1,0}, {8736,none,1,0},
+    {8737,1529,0,1}, {8737,none,1,0}, {8738,none,1,0}, {8739,none,1,0}, {8740,none,1,0}, {8741,1530,0,1}, {8741,none,1,0},
+    {8742,none,1,0}, {8743,none,1,0}, {8744,none,1,0}, {8745,16,0,1}, {8745,none,4,0}, {8749,none,2,0}, {8751,none,1,0},
+    {8752,none,1,0}, {8753,none,1,0}, {8754,none,1,0}, {8755,none,1,0}, {8756,none,1,0}, {8757,none,1,0}, {8758,none,1,0},
+    {8759,none,1,0}, {8760,none,1,0}, {8761,67,0,1}, {8761,none,1,0}, {8762,none,1,0}, {8763,none,1,0}, {8764,1531,0,1},
+    {8764,none,1,0}, {8765,none,1,0}, {8766,none,1,0}, {8767,none,1,0}, {8768,none,1,0}, {8769,none,1,0}, {8770,1532,0,1},
+    {8770,none,2,0}, {8772,none,1,0}, {8773,615,0,1}, {8773,none,1,0}, {8774,none,1,0}, {8775,1533,0,1}, {8775,none,2,0},
+    {8777,1534,0,1}, {8777,none,2,0}, {8779,1535,0,1}, {8779,none,1,0}, {8780,1536,0,2}, {8780,none,3,0}, {8783,none,1,0},
+    {8784,none,1,0}, {8785,none,1,0}, {8786,none,1,0}, {8787,1538,0,1}, {8787,none,2,0}, {8789,1539,0,1}, {8789,none,2,0},
+    {8791,1540,0,1}, {8791,none,1,0}, {8792,none,1,0}, {8793,1541,0,1}, {8793,none,1,0}, {8794,none,1,0}, {8795,1542,0,2},
+    {8795,none,1,0}, {8796,none,2,0}, {8798,none,1,0}, {8799,none,1,0}, {8800,none,2,0}, {8802,1544,0,1}, {8802,none,1,0},
+    {8803,none,1,0}, {8804,none,1,0}, {8805,1544,0,1}, {8805,none,1,0}, {8806,141,0,1}, {8806,none,3,0}, {8809,none,2,0},
+    {8811,none,1,0}, {8812,none,2,0}, {8814,528,0,1}, {8814,none,1,0}, {8815,1545,0,2}, {8815,none,1,0}, {8816,none,2,0},
+    {8818,533,0,1}, {8818,none,1,0}, {8819,1547,0,2}, {8819,none,1,0}, {8820,none,2,0}, {8822,none,3,0}, {8825,529,0,1},
+    {8825,none,1,0}, {8826,530,0,1}, {8826,none,1,0}, {8827,none,1,0}, {8828,none,2,0}, {8830,529,0,1}, {8830,none,1,0},
+    {8831,none,1,0}, {8832,530,0,1}, {8832,none,3,0}, {8835,531,0,1}, {8835,none,1,0}, {8836,532,0,1}, {8836,none,1,0},
+    {8837,none,1,0}, {8838,none,2,0}, {8840,531,0,1}, {8840,none,1,0}, {8841,none,1,0}, {8842,532,0,1}, {8842,none,3,0},
+    {8845,527,0,1}, {8845,none,1,0}, {8846,none,2,0}, {8848,none,1,0}, {8849,527,0,1}, {8849,none,1,0}, {8850,188,0,1},
+    {8850,none,1,0}, {8851,188,0,1}, {8851,none,1,0}, {8852,none,1,0}, {8853,none,1,0}, {8854,none,1,0}, {8855,17,0,1},
+    {8855,none,4,0}, {8859,none,1,0}, {8860,none,1,0}, {8861,1549,0,2}, {8861,none,1,0}, {8862,none,1,0}, {8863,none,1,0},
+    {8864,none,1,0}, {8865,67,0,1}, {8865,none,1,0}, {8866,none,1,0}, {8867,none,1,0}, {8868,none,1,0}, {8869,1533,0,1},
+    {8869,none,1,0}, {8870,none,1,0}, {8871,none,1,0}, {8872,none,1,0}, {8873,536,0,1}, {8873,none,2,0}, {8875,none,1,0},
+    {8876,none,2,0}, {8878,1551,0,1}, {8878,none,1,0}, {8879,737,0,1}, {8879,none,2,0}, {8881,none,1,0}, {8882,none,1,0},
+    {8883,none,1,0}, {8884,none,1,0}, {8885,none,2,0}, {8887,none,1,0}, {8888,none,1,0}, {8889,none,1,0}, {8890,none,1,0},
+    {8891,none,1,0}, {8892,none,1,0}, {8893,none,1,0}, {8894,959,0,1}, {8894,none,1,0}, {8895,none,1,0}, {8896,none,1,0},
+    {8897,1400,0,1}, {8897,none,1,0}, {8898,none,1,0}, {8899,7,0,1}, {8899,none,5,0}, {8904,none,9,0}, {8913,1552,0,1},
+    {8913,none,1,0}, {8914,1553,0,1}, {8914,none,1,0}, {8915,none,1,0}, {8916,none,1,0}, {8917,1554,0,1}, {8917,none,2,0},
+    {8919,538,0,1}, {8919,none,1,0}, {8920,none,1,0}, {8921,none,1,0}, {8922,1555,0,1}, {8922,none,1,0}, {8923,none,1,0},
+    {8924,none,1,0}, {8925,none,1,0}, {8926,1556,0,1}, {8926,none,2,0}, {8928,none,1,0}, {8929,1557,0,1}, {8929,none,1,0},
+    {8930,1558,0,1}, {8930,none,1,0}, {8931,none,1,0}, {8932,none,1,0}, {8933,none,1,0}, {8934,1559,0,1}, {8934,none,1,0},
+    {8935,none,1,0}, {8936,none,1,0}, {8937,none,1,0}, {8938,1560,0,1}, {8938,none,3,0}, {8941,none,1,0}, {8942,none,3,0},
+    {8945,1552,0,1}, {8945,none,1,0}, {8946,none,2,0}, {8948,538,0,1}, {8948,none,1,0}, {8949,1553,0,1}, {8949,none,1,0},
+    {8950,none,1,0}, {8951,none,2,0}, {8953,1558,0,1}, {8953,none,1,0}, {8954,1557,0,1}, {8954,none,1,0}, {8955,none,1,0},
+    {8956,1561,0,1}, {8956,none,2,0}, {8958,none,1,0}, {8959,1562,0,1}, {8959,none,1,0}, {8960,1563,0,1}, {8960,none,1,0},
+    {8961,none,6,0}, {8967,539,0,1}, {8967,none,1,0}, {8968,none,1,0}, {8969,none,1,0}, {8970,none,1,0}, {8971,none,1,0},
+    {8972,none,1,0}, {8973,1501,0,1}, {8973,none,1,0}, {8974,none,1,0}, {8975,none,1,0}, {8976,none,1,0}, {8977,none,1,0},
+    {8978,none,1,0}, {8979,none,1,0}, {8980,541,0,1}, {8980,none,1,0}, {8981,none,1,0}, {8982,540,0,1}, {8982,none,3,0},
+    {8985,none,1,0}, {8986,none,1,0}, {8987,none,1,0}, {8988,none,1,0}, {8989,none,1,0}, {8990,none,1,0}, {8991,1506,0,1},
+    {8991,none,1,0}, {8992,none,1,0}, {8993,none,1,0}, {8994,1505,0,1}, {8994,none,1,0}, {8995,none,1,0}, {8996,none,1,0},
+    {8997,1507,0,1}, {8997,none,1,0}, {8998,none,1,0}, {8999,none,1,0}, {9000,542,0,1}, {9000,none,1,0}, {9001,543,0,1},
+    {9001,none,1,0}, {9002,none,1,0}, {9003,42,0,1}, {9003,none,13,0}, {9016,none,1,0}, {9017,1564,0,1}, {9017,none,1,0},
+    {9018,1565,0,1}, {9018,none,1,0}, {9019,1566,0,1}, {9019,545,0,1}, {9019,none,1,0}, {9020,1567,0,1}, {9020,none,2,0},
+    {9022,none,1,0}, {9023,none,1,0}, {9024,1568,0,1}, {9024,none,1,0}, {9025,none,1,0}, {9026,none,1,0}, {9027,1569,0,1},
+    {9027,none,2,0}, {9029,546,0,1}, {9029,none,1,0}, {9030,none,1,0}, {9031,none,1,0}, {9032,1570,0,1}, {9032,none,1,0},
+    {9033,none,2,0}, {9035,none,1,0}, {9036,none,1,0}, {9037,1571,0,1}, {9037,none,1,0}, {9038,none,1,0}, {9039,1572,0,1},
+    {9039,none,1,0}, {9040,none,1,0}, {9041,none,1,0}, {9042,none,1,0}, {9043,1573,0,1}, {9043,none,1,0}, {9044,none,1,0},
+    {9045,none,1,0}, {9046,none,1,0}, {9047,1574,0,1}, {9047,none,2,0}, {9049,none,1,0}, {9050,1575,0,1}, {9050,none,1,0},
+    {9051,1576,0,1}, {9051,none,1,0}, {9052,none,1,0}, {9053,none,1,0}, {9054,none,1,0}, {9055,1577,0,1}, {9055,none,3,0},
+    {9058,none,1,0}, {9059,none,3,0}, {9062,545,0,1}, {9062,none,1,0}, {9063,none,2,0}, {9065,546,0,1}, {9065,none,1,0},
+    {9066,1567,0,1}, {9066,none,1,0}, {9067,none,1,0}, {9068,none,2,0}, {9070,1576,0,1}, {9070,none,1,0}, {9071,1575,0,1},
+    {9071,none,1,0}, {9072,none,1,0}, {9073,1578,0,1}, {9073,none,2,0}, {9075,none,1,0}, {9076,1579,0,1}, {9076,none,1,0},
+    {9077,1580,0,1}, {9077,none,3,0}, {9080,none,1,0}, {9081,none,1,0}, {9082,none,1,0}, {9083,1581,0,1}, {9083,none,1,0},
+    {9084,none,2,0}, {9086,none,1,0}, {9087,none,1,0}, {9088,1059,0,1}, {9088,none,2,0}, {9090,320,0,1}, {9090,none,1,0},
+    {9091,none,1,0}, {9092,320,0,1}, {9092,none,1,0}, {9093,none,1,0}, {9094,none,1,0}, {9095,none,1,0}, {9096,1582,0,1},
+    {9096,none,1,0}, {9097,none,1,0}, {9098,none,1,0}, {9099,none,1,0}, {9100,1583,0,1}, {9100,none,13,0}, {9113,none,2,0},
+    {9115,none,1,0}, {9116,none,1,0}, {9117,none,1,0}, {9118,none,1,0}, {9119,1584,0,1}, {9119,none,1,0}, {9120,1585,0,1},
+    {9120,none,1,0}, {9121,none,1,0}, {9122,none,1,0}, {9123,443,0,1}, {9123,none,3,0}, {9126,none,1,0}, {9127,none,1,0},
+    {9128,none,1,0}, {9129,none,1,0}, {9130,1586,0,1}, {9130,none,1,0}, {9131,none,1,0}, {9132,none,1,0}, {9133,none,1,0},
+    {9134,1587,0,1}, {9134,none,1,0}, {9135,1588,0,1}, {9135,none,1,0}, {9136,none,1,0}, {9137,none,1,0}, {9138,568,0,1},
+    {9138,none,1,0}, {9139,none,1,0}, {9140,none,1,0}, {9141,none,1,0}, {9142,none,1,0}, {9143,1589,0,1}, {9143,none,1,0},
+    {9144,none,1,0}, {9145,1590,0,2}, {9145,none,4,0}, {9149,none,2,0}, {9151,none,1,0}, {9152,none,2,0}, {9154,none,1,0},
+    {9155,558,0,1}, {9155,none,1,0}, {9156,none,1,0}, {9157,none,1,0}, {9158,none,1,0}, {9159,558,0,1}, {9159,none,1,0},
+    {9160,none,3,0}, {9163,1592,0,1}, {9163,none,1,0}, {9164,none,1,0}, {9165,none,1,0}, {9166,1593,0,1}, {9166,none,1,0},
+    {9167,1593,0,1}, {9167,none,2,0}, {9169,none,1,0}, {9170,none,2,0}, {9172,none,1,0}, {9173,none,1,0}, {9174,none,1,0},
+    {9175,none,1,0}, {9176,none,1,0}, {9177,none,1,0}, {9178,565,0,1}, {9178,none,1,0}, {9179,none,1,0}, {9180,none,1,0},
+    {9181,562,0,1}, {9181,none,1,0}, {9182,none,1,0}, {9183,none,1,0}, {9184,26,0,1}, {9184,none,2,0}, {9186,none,1,0},
+    {9187,none,1,0}, {9188,565,0,1}, {9188,none,1,0}, {9189,none,1,0}, {9190,none,1,0}, {9191,562,0,1}, {9191,none,1,0},
+    {9192,none,1,0}, {9193,none,1,0}, {9194,1594,0,1}, {9194,none,3,0}, {9197,none,1,0}, {9198,none,1,0}, {9199,none,1,0},
+    {9200,29,0,1}, {9200,none,1,0}, {9201,none,1,0}, {9202,none,3,0}, {9205,1595,0,1}, {9205,none,2,0}, {9207,791,0,1},
+    {9207,none,1,0}, {9208,none,1,0}, {9209,1596,0,1}, {9209,none,1,0}, {9210,1597,0,1}, {9210,none,1,0}, {9211,none,1,0},
+    {9212,1079,0,1}, {9212,none,3,0}, {9215,none,1,0}, {9216,none,1,0}, {9217,1282,0,1}, {9217,none,4,0}, {9221,152,0,1},
+    {9221,none,1,0}, {9222,none,1,0}, {9223,none,1,0}, {9224,1598,0,1}, {9224,none,1,0}, {9225,none,1,0}, {9226,none,1,0},
+    {9227,1599,0,1}, {9227,none,2,0}, {9229,1600,0,2}, {9229,none,1,0}, {9230,none,1,0}, {9231,none,1,0}, {9232,1602,0,1},
+    {9232,none,1,0}, {9233,none,1,0}, {9234,1514,0,1}, {9234,none,1,0}, {9235,none,1,0}, {9236,none,1,0}, {9237,none,1,0},
+    {9238,none,1,0}, {9239,1603,0,1}, {9239,none,3,0}, {9242,none,1,0}, {9243,none,1,0}, {9244,none,1,0}, {9245,548,0,1},
+    {9245,none,7,0}, {9252,none,1,0}, {9253,none,1,0}, {9254,none,1,0}, {9255,none,1,0}, {9256,none,5,0}, {9261,1604,0,1},
+    {9261,none,1,0}, {9262,none,1,0}, {9263,none,1,0}, {9264,none,1,0}, {9265,925,0,1}, {9265,none,1,0}, {9266,none,1,0},
+    {9267,none,1,0}, {9268,none,2,0}, {9270,1222,0,1}, {9270,none,1,0}, {9271,none,1,0}, {9272,297,0,1}, {9272,none,1,0},
+    {9273,1605,0,1}, {9273,none,1,0}, {9274,none,1,0}, {9275,none,1,0}, {9276,none,1,0}, {9277,none,2,0}, {9279,1495,0,1},
+    {9279,none,1,0}, {9280,none,1,0}, {9281,498,0,1}, {9281,none,1,0}, {9282,none,1,0}, {9283,none,1,0}, {9284,1606,0,1},
+    {9284,none,1,0}, {9285,1605,0,1}, {9285,none,1,0}, {9286,none,1,0}, {9287,none,1,0}, {9288,none,1,0}, {9289,none,1,0},
+    {9290,1607,0,1}, {9290,none,1,0}, {9291,none,1,0}, {9292,none,1,0}, {9293,none,1,0}, {9294,1608,0,1}, {9294,none,1,0},
+    {9295,none,1,0}, {9296,1609,0,1}, {9296,none,1,0}, {9297,none,1,0}, {9298,none,1,0}, {9299,none,1,0}, {9300,1610,0,1},
+    {9300,none,1,0}, {9301,none,1,0}, {9302,none,1,0}, {9303,none,1,0}, {9304,none,1,0}, {9305,none,1,0}, {9306,1611,0,1},
+    {9306,none,3,0}, {9309,none,2,0}, {9311,none,1,0}, {9312,1612,0,2}, {9312,none,1,0}, {9313,1614,0,1}, {9313,none,1,0},
+    {9314,none,1,0}, {9315,none,1,0}, {9316,1615,0,1}, {9316,none,1,0}, {9317,none,1,0}, {9318,none,1,0}, {9319,none,1,0},
+    {9320,1616,0,1}, {9320,none,2,0}, {9322,none,1,0}, {9323,none,1,0}, {9324,none,1,0}, {9325,729,0,1}, {9325,none,1,0},
+    {9326,none,1,0}, {9327,none,1,0}, {9328,none,1,0}, {9329,none,2,0}, {9331,none,1,0}, {9332,none,1,0}, {9333,none,1,0},
+    {9334,none,1,0}, {9335,none,1,0}, {9336,none,1,0}, {9337,none,1,0}, {9338,none,1,0}, {9339,none,1,0}, {9340,277,0,1},
+    {9340,none,1,0}, {9341,none,1,0}, {9342,none,1,0}, {9343,none,1,0}, {9344,none,1,0}, {9345,none,1,0}, {9346,none,1,0},
+    {9347,none,1,0}, {9348,none,1,0}, {9349,none,1,0}, {9350,474,0,1}, {9350,none,18,0}, {9368,none,1,0}, {9369,none,1,0},
+    {9370,none,1,0}, {9371,139,0,1}, {9371,none,1,0}, {9372,none,1,0}, {9373,none,1,0}, {9374,1617,0,1}, {9374,none,2,0},
+    {9376,none,1,0}, {9377,none,1,0}, {9378,none,1,0}, {9379,none,1,0}, {9380,1618,0,1}, {9380,none,1,0}, {9381,none,1,0},
+    {9382,18,0,1}, {9382,none,1,0}, {9383,none,2,0}, {9385,none,1,0}, {9386,none,1,0}, {9387,1619,0,1}, {9387,none,1,0},
+    {9388,none,1,0}, {9389,none,1,0}, {9390,1620,0,1}, {9390,none,2,0}, {9392,none,1,0}, {9393,none,1,0}, {9394,none,1,0},
+    {9395,1621,0,1}, {9395,none,1,0}, {9396,1622,0,1}, {9396,none,3,0}, {9399,none,1,0}, {9400,none,1,0}, {9401,none,1,0},
+    {9402,594,0,1}, {9402,none,1,0}, {9403,none,1,0}, {9404,none,1,0}, {9405,none,1,0}, {9406,1623,0,1}, {9406,none,1,0},
+    {9407,none,1,0}, {9408,none,1,0}, {9409,596,0,1}, {9409,none,2,0}, {9411,none,1,0}, {9412,none,1,0}, {9413,none,1,0},
+    {9414,none,1,0}, {9415,1624,0,1}, {9415,none,1,0}, {9416,1625,0,2}, {9416,none,1,0}, {9417,none,1,0}, {9418,none,1,0},
+    {9419,none,1,0}, {9420,none,1,0}, {9421,1627,0,1}, {9421,none,2,0}, {9423,none,1,0}, {9424,none,2,0}, {9426,none,1,0},
+    {9427,300,0,1}, {9427,none,1,0}, {9428,501,0,1}, {9428,none,1,0}, {9429,none,1,0}, {9430,none,1,0}, {9431,1628,0,1},
+    {9431,none,2,0}, {9433,none,2,0}, {9435,none,1,0}, {9436,none,1,0}, {9437,none,2,0}, {9439,1629,0,1}, {9439,none,1,0},
+    {9440,none,1,0}, {9441,1629,0,1}, {9441,none,1,0}, {9442,none,1,0}, {9443,none,1,0}, {9444,1630,0,1}, {9444,none,1,0},
+    {9445,none,1,0}, {9446,none,1,0}, {9447,1631,0,1}, {9447,none,2,0}, {9449,none,1,0}, {9450,none,1,0}, {9451,none,1,0},
+    {9452,1632,0,1}, {9452,none,1,0}, {9453,2,0,1}, {9453,none,2,0}, {9455,none,1,0}, {9456,none,1,0}, {9457,none,1,0},
+    {9458,1633,0,1}, {9458,none,1,0}, {9459,none,1,0}, {9460,1634,0,2}, {9460,none,6,0}, {9466,none,1,0}, {9467,none,1,0},
+    {9468,none,1,0}, {9469,none,1,0}, {9470,none,1,0}, {9471,18,0,1}, {9471,none,1,0}, {9472,none,1,0}, {9473,none,1,0},
+    {9474,none,1,0}, {9475,none,1,0}, {9476,none,1,0}, {9477,none,1,0}, {9478,none,1,0}, {9479,none,1,0}, {9480,595,0,1},
+    {9480,none,1,0}, {9481,none,1,0}, {9482,none,1,0}, {9483,none,1,0}, {9484,none,1,0}, {9485,none,1,0}, {9486,none,2,0},
+    {9488,none,1,0}, {9489,none,1,0}, {9490,none,1,0}, {9491,none,1,0}, {9492,300,0,1}, {9492,none,1,0}, {9493,none,1,0},
+    {9494,none,1,0}, {9495,none,1,0}, {9496,none,1,0}, {9497,501,0,1}, {9497,none,1,0}, {9498,none,1,0}, {9499,none,1,0},
+    {9500,589,0,1}, {9500,none,1,0}, {9501,none,3,0}, {9504,1636,0,1}, {9504,none,1,0}, {9505,601,0,1}, {9505,none,1,0},
+    {9506,none,1,0}, {9507,none,1,0}, {9508,1636,0,1}, {9508,none,1,0}, {9509,none,1,0}, {9510,none,1,0}, {9511,none,1,0},
+    {9512,none,1,0}, {9513,none,1,0}, {9514,none,1,0}, {9515,none,1,0}, {9516,1637,0,1}, {9516,none,3,0}, {9519,none,2,0},
+    {9521,none,1,0}, {9522,none,1,0}, {9523,none,2,0}, {9525,1638,0,1}, {9525,none,1,0}, {9526,none,1,0}, {9527,1638,0,1},
+    {9527,none,1,0}, {9528,none,1,0}, {9529,none,1,0}, {9530,1639,0,1}, {9530,none,1,0}, {9531,none,1,0}, {9532,none,1,0},
+    {9533,1640,0,1}, {9533,none,1,0}, {9534,none,1,0}, {9535,none,1,0}, {9536,1641,0,1}, {9536,none,1,0}, {9537,none,1,0},
+    {9538,none,1,0}, {9539,1642,0,2}, {9539,none,3,0}, {9542,none,1,0}, {9543,none,1,0}, {9544,none,1,0}, {9545,1644,0,1},
+    {9545,none,1,0}, {9546,none,1,0}, {9547,none,1,0}, {9548,none,1,0}, {9549,1645,0,1}, {9549,none,1,0}, {9550,none,2,0},
+    {9552,1604,0,1}, {9552,none,1,0}, {9553,743,0,1}, {9553,none,2,0}, {9555,none,1,0}, {9556,none,1,0}, {9557,none,1,0},
+    {9558,1637,0,1}, {9558,none,1,0}, {9559,none,1,0}, {9560,1646,0,1}, {9560,none,1,0}, {9561,none,1,0}, {9562,none,1,0},
+    {9563,none,1,0}, {9564,none,1,0}, {9565,none,1,0}, {9566,1647,0,1}, {9566,none,15,0}, {9581,none,1,0}, {9582,none,1,0},
+    {9583,none,1,0}, {9584,140,0,1}, {9584,none,1,0}, {9585,none,1,0}, {9586,none,2,0}, {9588,1648,0,1}, {9588,none,1,0},
+    {9589,1649,0,1}, {9589,none,1,0}, {9590,none,1,0}, {9591,none,1,0}, {9592,none,1,0}, {9593,138,0,1}, {9593,none,2,0},
+    {9595,none,1,0}, {9596,none,1,0}, {9597,none,1,0}, {9598,none,1,0}, {9599,1650,0,1}, {9599,none,7,0}, {9606,none,1,0},
+    {9607,none,1,0}, {9608,none,1,0}, {9609,none,1,0}, {9610,none,1,0}, {9611,none,1,0}, {9612,none,1,0}, {9613,959,0,1},
+    {9613,none,1,0}, {9614,none,1,0}, {9615,none,1,0}, {9616,none,1,0}, {9617,none,1,0}, {9618,1120,0,1}, {9618,none,1,0},
+    {9619,none,1,0}, {9620,none,1,0}, {9621,none,1,0}, {9622,none,1,0}, {9623,none,1,0}, {9624,none,1,0}, {9625,950,0,1},
+    {9625,none,3,0}, {9628,none,1,0}, {9629,none,1,0}, {9630,1400,0,1}, {9630,none,1,0}, {9631,1403,0,1}, {9631,none,1,0},
+    {9632,none,1,0}, {9633,none,1,0}, {9634,none,1,0}, {9635,none,1,0}, {9636,460,0,1}, {9636,none,2,0}, {9638,595,0,1},
+    {9638,none,1,0}, {9639,none,1,0}, {9640,1475,0,1}, {9640,none,2,0}, {9642,none,1,0}, {9643,none,1,0}, {9644,none,1,0},
+    {9645,none,1,0}, {9646,1522,0,1}, {9646,none,2,0}, {9648,none,1,0}, {9649,none,1,0}, {9650,none,1,0}, {9651,none,1,0},
+    {9652,none,1,0}, {9653,none,1,0}, {9654,none,2,0}, {9656,1651,0,2}, {9656,none,1,0}, {9657,1653,0,2}, {9657,none,1,0},
+    {9658,none,1,0}, {9659,none,1,0}, {9660,none,1,0}, {9661,none,1,0}, {9662,none,1,0}, {9663,none,2,0}, {9665,1655,0,2},
+    {9665,none,1,0}, {9666,1657,0,2}, {9666,none,2,0}, {9668,none,1,0}, {9669,none,1,0}, {9670,none,1,0}, {9671,none,1,0},
+    {9672,1593,0,1}, {9672,none,1,0}, {9673,none,1,0}, {9674,none,1,0}, {9675,none,1,0}, {9676,none,1,0}, {9677,none,1,0},
+    {9678,none,2,0}, {9680,none,1,0}, {9681,none,1,0}, {9682,none,1,0}, {9683,none,1,0}, {9684,295,0,1}, {9684,none,1,0},
+    {9685,none,1,0}, {9686,none,1,0}, {9687,none,1,0}, {9688,none,1,0}, {9689,496,0,1}, {9689,none,1,0}, {9690,none,1,0},
+    {9691,1659,0,1}, {9691,none,1,0}, {9692,none,1,0}, {9693,none,1,0}, {9694,none,1,0}, {9695,493,0,1}, {9695,none,3,0},
+    {9698,none,3,0}, {9701,1376,0,1}, {9701,none,1,0}, {9702,none,1,0}, {9703,none,1,0}, {9704,1660,0,1}, {9704,none,1,0},
+    {9705,none,1,0}, {9706,1661,0,1}, {9706,none,1,0}, {9707,none,1,0}, {9708,none,1,0}, {9709,none,1,0}, {9710,1662,0,1},
+    {9710,none,2,0}, {9712,none,1,0}, {9713,none,1,0}, {9714,none,1,0}, {9715,616,0,1}, {9715,none,1,0}, {9716,616,0,1},
+    {9716,none,1,0}, {9717,none,1,0}, {9718,1663,0,2}, {9718,none,1,0}, {9719,none,1,0}, {9720,none,1,0}, {9721,none,1,0},
+    {9722,295,0,1}, {9722,none,1,0}, {9723,none,1,0}, {9724,none,2,0}, {9726,none,1,0}, {9727,399,0,2}, {9727,none,1,0},
+    {9728,408,0,2}, {9728,none,1,0}, {9729,none,1,0}, {9730,none,1,0}, {9731,1665,0,2}, {9731,none,1,0}, {9732,none,1,0},
+    {9733,none,1,0}, {9734,none,1,0}, {9735,460,0,1}, {9735,none,1,0}, {9736,none,1,0}, {9737,none,1,0}, {9738,none,1,0},
+    {9739,496,0,1}, {9739,none,2,0}, {9741,none,1,0}, {9742,none,1,0}, {9743,1667,0,2}, {9743,none,2,0}, {9745,none,1,0},
+    {9746,none,2,0}, {9748,none,1,0}, {9749,1653,0,2}, {9749,none,1,0}, {9750,1651,0,2}, {9750,none,1,0}, {9751,none,2,0},
+    {9753,none,1,0}, {9754,1657,0,2}, {9754,none,1,0}, {9755,1655,0,2}, {9755,none,1,0}, {9756,none,1,0}, {9757,none,1,0},
+    {9758,none,1,0}, {9759,none,1,0}, {9760,none,1,0}, {9761,1669,0,1}, {9761,none,7,0}, {9768,none,1,0}, {9769,none,1,0},
+    {9770,none,1,0}, {9771,none,1,0}, {9772,1670,0,1}, {9772,none,2,0}, {9774,none,2,0}, {9776,none,1,0}, {9777,none,1,0},
+    {9778,none,1,0}, {9779,1671,0,1}, {9779,none,1,0}, {9780,none,2,0}, {9782,680,0,1}, {9782,none,1,0}, {9783,1672,0,1},
+    {9783,none,1,0}, {9784,none,1,0}, {9785,none,1,0}, {9786,none,1,0}, {9787,1673,0,1}, {9787,none,1,0}, {9788,none,1,0},
+    {9789,1674,0,2}, {9789,none,1,0}, {9790,none,1,0}, {9791,none,1,0}, {9792,1676,0,2}, {9792,none,1,0}, {9793,1673,0,1},
+    {9793,none,2,0}, {9795,618,0,1}, {9795,none,1,0}, {9796,none,1,0}, {9797,none,1,0}, {9798,none,1,0}, {9799,618,0,1},
+    {9799,none,1,0}, {9800,none,1,0}, {9801,none,1,0}, {9802,1678,0,2}, {9802,none,14,0}, {9816,none,3,0}, {9819,none,1,0},
+    {9820,none,1,0}, {9821,239,0,1}, {9821,none,1,0}, {9822,none,1,0}, {9823,none,1,0}, {9824,732,0,1}, {9824,none,1,0},
+    {9825,none,1,0}, {9826,588,0,1}, {9826,none,1,0}, {9827,none,1,0}, {9828,none,1,0}, {9829,none,1,0}, {9830,738,0,1},
+    {9830,none,1,0}, {9831,none,1,0}, {9832,1680,0,2}, {9832,none,2,0}, {9834,none,1,0}, {9835,none,1,0}, {9836,none,1,0},
+    {9837,135,0,1}, {9837,none,1,0}, {9838,none,1,0}, {9839,none,1,0}, {9840,316,0,1}, {9840,none,1,0}, {9841,1682,0,1},
+    {9841,none,2,0}, {9843,none,1,0}, {9844,none,1,0}, {9845,none,1,0}, {9846,134,0,1}, {9846,none,1,0}, {9847,none,1,0},
+    {9848,none,1,0}, {9849,315,0,1}, {9849,none,1,0}, {9850,none,1,0}, {9851,none,1,0}, {9852,1195,0,1}, {9852,none,1,0},
+    {9853,none,1,0}, {9854,none,1,0}, {9855,1683,0,1}, {9855,none,3,0}, {9858,none,1,0}, {9859,none,1,0}, {9860,none,1,0},
+    {9861,733,0,1}, {9861,none,2,0}, {9863,none,1,0}, {9864,1684,0,2}, {9864,none,1,0}, {9865,none,1,0}, {9866,none,1,0},
+    {9867,734,0,1}, {9867,none,1,0}, {9868,none,1,0}, {9869,none,1,0}, {9870,none,1,0}, {9871,735,0,1}, {9871,none,2,0},
+    {9873,none,1,0}, {9874,none,1,0}, {9875,none,1,0}, {9876,136,0,1}, {9876,none,1,0}, {9877,none,1,0}, {9878,none,1,0},
+    {9879,317,0,1}, {9879,none,2,0}, {9881,none,1,0}, {9882,none,1,0}, {9883,1686,0,2}, {9883,none,1,0}, {9884,none,1,0},
+    {9885,none,1,0}, {9886,none,1,0}, {9887,736,0,1}, {9887,none,2,0}, {9889,none,1,0}, {9890,none,1,0}, {9891,none,1,0},
+    {9892,none,1,0}, {9893,740,0,1}, {9893,none,1,0}, {9894,none,1,0}, {9895,none,1,0}, {9896,739,0,1}, {9896,none,1,0},
+    {9897,none,1,0}, {9898,none,1,0}, {9899,613,0,1}, {9899,none,1,0}, {9900,none,1,0}, {9901,none,1,0}, {9902,none,1,0},
+    {9903,none,1,0}, {9904,627,0,1}, {9904,none,8,0}, {9912,none,1,0}, {9913,none,2,0}, {9915,none,1,0}, {9916,none,1,0},
+    {9917,none,1,0}, {9918,1688,0,1}, {9918,none,1,0}, {9919,1689,0,1}, {9919,none,2,0}, {9921,none,1,0}, {9922,none,1,0},
+    {9923,none,1,0}, {9924,1690,0,1}, {9924,none,1,0}, {9925,1691,0,1}, {9925,none,1,0}, {9926,none,1,0}, {9927,1692,0,1},
+    {9927,none,1,0}, {9928,none,1,0}, {9929,1693,0,2}, {9929,none,1,0}, {9930,none,1,0}, {9931,none,1,0}, {9932,1695,0,1},
+    {9932,none,1,0}, {9933,none,1,0}, {9934,none,1,0}, {9935,1696,0,2}, {9935,none,1,0}, {9936,none,1,0}, {9937,none,1,0},
+    {9938,1698,0,2}, {9938,none,2,0}, {9940,none,1,0}, {9941,none,1,0}, {9942,1700,0,1}, {9942,none,1,0}, {9943,none,1,0},
+    {9944,1701,0,1}, {9944,none,10,0}, {9954,none,1,0}, {9955,none,1,0}, {9956,none,1,0}, {9957,none,1,0}, {9958,none,1,0},
+    {9959,1702,0,1}, {9959,none,2,0}, {9961,none,1,0}, {9962,none,1,0}, {9963,none,1,0}, {9964,none,1,0}, {9965,1703,0,1},
+    {9965,none,1,0}, {9966,1704,0,1}, {9966,none,1,0}, {9967,none,1,0}, {9968,none,1,0}, {9969,1705,0,1}, {9969,none,2,0},
+    {9971,none,1,0}, {9972,none,1,0}, {9973,none,1,0}, {9974,none,1,0}, {9975,660,0,1}, {9975,none,1,0}, {9976,none,1,0},
+    {9977,1706,0,1}, {9977,none,1,0}, {9978,none,1,0}, {9979,1707,0,2}, {9979,none,1,0}, {9980,none,1,0}, {9981,none,1,0},
+    {9982,1709,0,1}, {9982,none,1,0}, {9983,none,1,0}, {9984,none,1,0}, {9985,none,1,0}, {9986,none,1,0}, {9987,none,1,0},
+    {9988,1710,0,1}, {9988,none,1,0}, {9989,none,1,0}, {9990,none,1,0}, {9991,1711,0,2}, {9991,none,1,0}, {9992,none,1,0},
+    {9993,none,1,0}, {9994,1713,0,2}, {9994,none,2,0}, {9996,none,1,0}, {9997,22,0,1}, {9997,none,1,0}, {9998,none,1,0},
+    {9999,27,0,1}, {9999,none,6,0}, {10005,3,0,1}, {10005,1214,0,1}, {10005,none,2,0}, {10007,1715,0,1}, {10007,1716,0,1},
+    {10007,97,0,1}, {10007,433,0,1}, {10007,97,0,1}, {10007,none,69,0}, {10076,none,1,0}, {10077,none,1,0}, {10078,843,0,1},
+    {10078,none,1,0}, {10079,842,0,1}, {10079,none,2,0}, {10081,94,0,1}, {10081,none,1,0}, {10082,95,0,1}, {10082,none,2,0},
+    {10084,93,0,1}, {10084,none,1,0}, {10085,844,0,1}, {10085,none,1,0}, {10086,92,0,1}, {10086,none,1,0}, {10087,1386,0,1},
+    {10087,none,1,0}, {10088,1717,0,1}, {10088,none,11,0}, {10099,1718,0,1}, {10099,none,1,0}, {10100,1719,0,1}, {10100,none,1,0},
+    {10101,1720,0,1}, {10101,none,1,0}, {10102,1721,0,1}, {10102,none,1,0}, {10103,1722,0,1}, {10103,none,1,0}, {10104,1723,0,1},
+    {10104,none,1,0}, {10105,1724,0,1}, {10105,none,1,0}, {10106,1725,0,1}, {10106,none,1,0}, {10107,1726,0,1}, {10107,none,1,0},
+    {10108,1727,0,1}, {10108,none,1,0}, {10109,1728,0,1}, {10109,none,11,0}, {10120,1729,0,1}, {10120,none,1,0}, {10121,1730,0,1},
+    {10121,none,1,0}, {10122,1731,0,1}, {10122,none,1,0}, {10123,1732,0,1}, {10123,none,1,0}, {10124,1733,0,1}, {10124,none,1,0},
+    {10125,1734,0,1}, {10125,none,1,0}, {10126,1735,0,1}, {10126,none,1,0}, {10127,1736,0,1}, {10127,none,1,0}, {10128,1737,0,1},
+    {10128,none,1,0}, {10129,1738,0,1}, {10129,none,1,0}, {10130,1739,0,1}, {10130,none,11,0}, {10141,1740,0,1}, {10141,none,1,0},
+    {10142,1741,0,1}, {10142,none,1,0}, {10143,1742,0,1}, {10143,none,1,0}, {10144,1743,0,1}, {10144,none,1,0}, {10145,1744,0,1},
+    {10145,none,1,0}, {10146,1745,0,1}, {10146,none,1,0}, {10147,1746,0,1}, {10147,none,1,0}, {10148,1747,0,1}, {10148,none,1,0},
+    {10149,1748,0,1}, {10149,none,1,0}, {10150,1749,0,1}, {10150,none,1,0}, {10151,1750,0,1}, {10151,none,11,0}, {10162,1751,0,1},
+    {10162,none,1,0}, {10163,1752,0,1}, {10163,none,1,0}, {10164,1753,0,1}, {10164,none,1,0}, {10165,1754,0,1}, {10165,none,1,0},
+    {10166,1755,0,1}, {10166,none,1,0}, {10167,1756,0,1}, {10167,none,1,0}, {10168,1757,0,1}, {10168,none,1,0}, {10169,1758,0,1},
+    {10169,none,1,0}, {10170,1759,0,1}, {10170,none,1,0}, {10171,1760,0,1}, {10171,none,1,0}, {10172,1761,0,1}, {10172,none,2,0},
+    {10174,1762,0,1}, {10174,none,1,0}, {10175,1763,0,1}, {10175,none,1,0}, {10176,1764,0,1}, {10176,none,1,0}, {10177,1765,0,1},
+    {10177,none,1,0}, {10178,1766,0,1}, {10178,none,1,0}, {10179,1767,0,1}, {10179,none,1,0}, {10180,1768,0,1}, {10180,none,1,0},
+    {10181,1769,0,1}, {10181,none,1,0}, {10182,1770,0,1}, {10182,none,1,0}, {10183,1771,0,1}, {10183,none,1,0}, {10184,1772,0,1},
+    {10184,none,1,0}, {10185,1773,0,1}, {10185,none,1,0}, {10186,1774,0,1}, {10186,none,1,0}, {10187,1775,0,1}, {10187,none,1,0},
+    {10188,1776,0,1}, {10188,none,1,0}, {10189,1777,0,1}, {10189,none,1,0}, {10190,1778,0,1}, {10190,none,1,0}, {10191,1779,0,1},
+    {10191,none,1,0}, {10192,1780,0,1}, {10192,none,1,0}, {10193,1781,0,1}, {10193,none,1,0}, {10194,1782,0,1}, {10194,none,1,0},
+    {10195,1783,0,1}, {10195,none,1,0}, {10196,1784,0,1}, {10196,none,1,0}, {10197,1785,0,1}, {10197,none,1,0}, {10198,1786,0,1},
+    {10198,none,1,0}, {10199,841,0,1}, {10199,none,1,0}, {10200,1787,0,1}, {10200,none,1,0}, {10201,1788,0,1}, {10201,none,1,0},
+    {10202,1789,0,1}, {10202,none,1,0}, {10203,1790,0,1}, {10203,none,1,0}, {10204,1791,0,1}, {10204,none,1,0}, {10205,1792,0,1},
+    {10205,none,1,0}, {10206,1793,0,1}, {10206,none,1,0}, {10207,1794,0,1}, {10207,none,1,0}, {10208,1795,0,1}, {10208,none,1,0},
+    {10209,1796,0,1}, {10209,none,1,0}, {10210,1797,0,1}, {10210,none,1,0}, {10211,1798,0,1}, {10211,none,1,0}, {10212,1799,0,1},
+    {10212,none,1,0}, {10213,1800,0,1}, {10213,none,1,0}, {10214,1801,0,1}, {10214,none,1,0}, {10215,1802,0,1}, {10215,none,1,0},
+    {10216,1803,0,1}, {10216,none,1,0}, {10217,1804,0,1}, {10217,none,1,0}, {10218,1805,0,1}, {10218,none,1,0}, {10219,1806,0,1},
+    {10219,none,1,0}, {10220,1807,0,1}, {10220,none,1,0}, {10221,1808,0,1}, {10221,none,1,0}, {10222,1809,0,1}, {10222,none,1,0},
+    {10223,1810,0,1}, {10223,none,1,0}, {10224,1811,0,1}, {10224,none,1,0}, {10225,1812,0,1}, {10225,none,1,0}, {10226,1813,0,1},
+    {10226,none,1,0}, {10227,1814,0,1}, {10227,none,1,0}, {10228,1815,0,1}, {10228,none,1,0}, {10229,1816,0,1}, {10229,none,1,0},
+    {10230,1817,0,1}, {10230,none,1,0}, {10231,1818,0,1}, {10231,none,1,0}, {10232,1819,0,1}, {10232,none,1,0}, {10233,4,0,1},
+    {10233,none,5,0}, {10238,5,0,1}, {10238,810,0,1}, {10238,90,0,1}, {10238,896,0,1}, {10238,1820,0,1}, {10238,none,1,0},
+    {10239,451,0,1}, {10239,none,3,0}, {10242,6,0,1}, {10242,34,0,1}, {10242,1214,0,1}, {10242,none,17,0}, {10259,7,0,1},
+    {10259,451,0,1}, {10259,none,2,0}, {10261,1520,0,1}, {10261,1233,0,1}, {10261,1239,0,1}, {10261,905,0,1}, {10261,1821,0,1},
+    {10261,1822,0,1}, {10261,1415,0,1}, {10261,1823,0,1}, {10261,571,0,1}, {10261,1821,0,1}, {10261,1415,0,1}, {10261,1233,0,1},
+    {10261,1277,0,1}, {10261,1823,0,1}, {10261,1616,0,1}, {10261,888,0,1}, {10261,none,7,0}, {10268,8,0,1}, {10268,90,0,1},
+    {10268,1054,0,1}, {10268,1209,0,1}, {10268,1491,0,1}, {10268,1084,0,1}, {10268,1112,0,1}, {10268,none,36,0}, {10304,none,2,0},
+    {10306,1715,0,1}, {10306,1716,0,1}, {10306,none,1,0}, {10307,1824,0,1}, {10307,372,0,1}, {10307,350,0,1}, {10307,354,0,1},
+    {10307,1825,0,1}, {10307,1826,0,1}, {10307,1827,0,1}, {10307,156,0,1}, {10307,1828,0,1}, {10307,1829,0,1}, {10307,224,0,1},
+    {10307,1830,0,1}, {10307,1831,0,1}, {10307,323,0,1}, {10307,437,0,1}, {10307,1832,0,1}, {10307,1833,0,1}, {10307,1834,0,1},
+    {10307,1086,0,1}, {10307,1835,0,1}, {10307,1836,0,1}, {10307,1837,0,1}, {10307,923,0,1}, {10307,1838,0,1}, {10307,1839,0,1},
+    {10307,1069,0,1}, {10307,1840,0,1}, {10307,1841,0,1}, {10307,1215,0,1}, {10307,1842,0,1}, {10307,1385,0,1}, {10307,1843,0,1},
+    {10307,1844,0,1}, {10307,1845,0,1}, {10307,1846,0,1}, {10307,none,4,0}, {10311,9,0,1}, {10311,896,0,1}, {10311,1239,0,1},
+    {10311,none,1,0}, {10312,1847,0,1}, {10312,none,1,0}, {10313,none,9,0}, {10322,none,1,0}, {10323,1848,0,1}, {10323,990,0,1},
+    {10323,991,0,1}, {10323,992,0,1}, {10323,993,0,1}, {10323,994,0,1}, {10323,1849,0,1}, {10323,995,0,1}, {10323,1850,0,1},
+    {10323,none,1,0}, {10324,none,2,0}, {10326,996,0,1}, {10326,997,0,1}, {10326,none,2,0}, {10328,10,0,1}, {10328,none,3,0},
+    {10331,998,0,1}, {10331,999,0,1}, {10331,1000,0,1}, {10331,none,2,0}, {10333,11,0,1}, {10333,none,1,0}, {10334,1001,0,1},
+    {10334,none,1,0}, {10335,none,2,0}, {10337,1002,0,1}, {10337,1003,0,1}, {10337,none,1,0}, {10338,12,0,1}, {10338,none,1,0},
+    {10339,none,1,0}, {10340,1004,0,1}, {10340,none,2,0}, {10342,36,0,1}, {10342,905,0,1}, {10342,none,2,0}, {10344,13,0,1},
+    {10344,433,0,1}, {10344,none,6,0}, {10350,36,0,1}, {10350,433,0,1}, {10350,1209,0,1}, {10350,372,0,1}, {10350,1141,0,1},
+    {10350,1167,0,1}, {10350,none,23,0}, {10373,350,0,1}, {10373,1167,0,1}, {10373,100,0,1}, {10373,207,0,1}, {10373,970,0,1},
+    {10373,970,0,1}, {10373,1851,0,1}, {10373,1852,0,1}, {10373,1853,0,1}, {10373,1854,0,1}, {10373,1855,0,1}, {10373,1856,0,1},
+    {10373,1857,0,1}, {10373,1692,0,1}, {10373,970,0,1}, {10373,1858,0,1}, {10373,970,0,1}, {10373,1851,0,1}, {10373,1852,0,1},
+    {10373,1854,0,1}, {10373,1855,0,1}, {10373,1692,0,1}, {10373,115,0,1}, {10373,none,7,0}, {10380,14,0,1}, {10380,35,0,1},
+    {10380,97,0,1}, {10380,1491,0,1}, {10380,354,0,1}, {10380,207,0,1}, {10380,1446,0,1}, {10380,none,2,0}, {10382,31,0,1},
+    {10382,1098,0,1}, {10382,none,2,0}, {10384,1825,0,1}, {10384,45,0,1}, {10384,none,2,0}, {10386,1826,0,1}, {10386,1859,0,1},
+    {10386,none,6,0}, {10392,1827,0,1}, {10392,970,0,1}, {10392,1860,0,1}, {10392,80,0,1}, {10392,1861,0,1}, {10392,1862,0,1},
+    {10392,none,5,0}, {10397,156,0,1}, {10397,none,2,0}, {10399,1863,0,1}, {10399,1864,0,1}, {10399,158,0,1}, {10399,1865,0,1},
+    {10399,1866,0,1}, {10399,none,3,0}, {10402,1828,0,1}, {10402,970,0,1}, {10402,1867,0,1}, {10402,none,3,0}, {10405,1821,0,1},
+    {10405,974,0,1}, {10405,976,0,1}, {10405,none,2,0}, {10407,1829,0,1}, {10407,1868,0,1}, {10407,none,2,0}, {10409,224,0,1},
+    {10409,1851,0,1}, {10409,none,2,0}, {10411,1830,0,1}, {10411,227,0,1}, {10411,none,1,0}, {10412,1831,0,1}, {10412,none,1,0},
+    {10413,1822,0,1}, {10413,none,5,0}, {10418,1415,0,1}, {10418,323,0,1}, {10418,1852,0,1}, {10418,1869,0,1}, {10418,1870,0,1},
+    {10418,none,6,0}, {10424,1853,0,1}, {10424,157,0,1}, {10424,1871,0,1}, {10424,1326,0,1}, {10424,1872,0,1}, {10424,1326,0,1},
+    {10424,none,7,0}, {10431,none,1,0}, {10432,1715,0,1}, {10432,437,0,1}, {10432,80,0,1}, {10432,420,0,1}, {10432,471,0,1},
+    {10432,33,0,1}, {10432,884,0,1}, {10432,none,5,0}, {10437,32,0,1}, {10437,1823,0,1}, {10437,1854,0,1}, {10437,32,0,1},
+    {10437,1873,0,1}, {10437,none,4,0}, {10441,1832,0,1}, {10441,1855,0,1}, {10441,471,0,1}, {10441,1874,0,1}, {10441,none,4,0},
+    {10445,33,0,1}, {10445,1875,0,1}, {10445,33,0,1}, {10445,1876,0,1}, {10445,none,5,0}, {10450,571,0,1}, {10450,1833,0,1},
+    {10450,1856,0,1}, {10450,547,0,1}, {10450,548,0,1}, {10450,none,1,0}, {10451,1857,0,1}, {10451,none,1,0}, {10452,884,0,1},
+    {10452,none,2,0}, {10454,1834,0,1}, {10454,1692,0,1}, {10454,none,3,0}, {10457,1086,0,1}, {10457,none,1,0}, {10458,1877,0,1},
+    {10458,1878,0,1}, {10458,none,4,0}, {10462,none,1,0}, {10463,none,1,0}, {10464,none,1,0}, {10465,none,1,0}, {10466,none,17,0},
+    {10483,15,0,1}, {10483,1879,0,1}, {10483,1880,0,1}, {10483,1881,0,1}, {10483,1882,0,1}, {10483,1883,0,1}, {10483,1884,0,1},
+    {10483,1885,0,1}, {10483,1886,0,1}, {10483,1887,0,1}, {10483,1888,0,1}, {10483,1889,0,1}, {10483,1890,0,1}, {10483,1891,0,1},
+    {10483,1892,0,1}, {10483,1893,0,1}, {10483,none,1,0}, {10484,none,1,0}, {10485,none,1,0}, {10486,none,1,0}, {10487,none,1,0},
+    {10488,131,0,1}, {10488,none,1,0}, {10489,none,1,0}, {10490,none,1,0}, {10491,none,1,0}, {10492,none,2,0}, {10494,16,0,1},
+    {10494,none,1,0}, {10495,none,1,0}, {10496,none,1,0}, {10497,none,1,0}, {10498,none,1,0}, {10499,132,0,1}, {10499,none,1,0},
+    {10500,none,1,0}, {10501,none,1,0}, {10502,none,1,0}, {10503,none,1,0}, {10504,none,2,0}, {10506,17,0,1}, {10506,none,1,0},
+    {10507,none,1,0}, {10508,none,1,0}, {10509,none,1,0}, {10510,none,1,0}, {10511,none,1,0}, {10512,137,0,1}, {10512,none,1,0},
+    {10513,none,1,0}, {10514,none,22,0}, {10536,18,0,1}, {10536,1894,0,1}, {10536,1895,0,1}, {10536,896,0,1}, {10536,1896,0,1},
+    {10536,1897,0,1}, {10536,1898,0,1}, {10536,1564,0,1}, {10536,1565,0,1}, {10536,1566,0,1}, {10536,1899,0,1}, {10536,1900,0,1},
+    {10536,1901,0,1}, {10536,1902,0,1}, {10536,1903,0,1}, {10536,1904,0,1}, {10536,1905,0,1}, {10536,none,1,0}, {10537,none,1,0},
+    {10538,none,1,0}, {10539,139,0,1}, {10539,1379,0,1}, {10539,1906,0,1}, {10539,1907,0,1}, {10539,1380,0,1}, {10539,none,1,0},
+    {10540,19,0,1}, {10540,none,1,0}, {10541,20,0,1}, {10541,none,2,0}, {10543,1835,0,1}, {10543,672,0,1}, {10543,none,1,0},
+    {10544,1836,0,1}, {10544,none,4,0}, {10548,1837,0,1}, {10548,970,0,1}, {10548,80,0,1}, {10548,830,0,1}, {10548,none,5,0},
+    {10553,923,0,1}, {10553,1858,0,1}, {10553,none,1,0}, {10554,1908,0,1}, {10554,968,0,1}, {10554,1909,0,1}, {10554,none,3,0},
+    {10557,1838,0,1}, {10557,970,0,1}, {10557,1910,0,1}, {10557,none,5,0}, {10562,1821,0,1}, {10562,975,0,1}, {10562,979,0,1},
+    {10562,982,0,1}, {10562,1911,0,1}, {10562,none,53,0}, {10615,none,5,0}, {10620,none,2,0}, {10622,1912,0,1}, {10622,1913,0,1},
+    {10622,1914,0,1}, {10622,1915,0,1}, {10622,1916,0,1}, {10622,1917,0,1}, {10622,none,15,0}, {10637,none,2,0}, {10639,1912,0,1},
+    {10639,1913,0,1}, {10639,1918,0,1}, {10639,1919,0,1}, {10639,1920,0,1}, {10639,1921,0,1}, {10639,1922,0,1}, {10639,1923,0,1},
+    {10639,1924,0,1}, {10639,1925,0,1}, {10639,1926,0,1}, {10639,1927,0,1}, {10639,1928,0,1}, {10639,1929,0,1}, {10639,1930,0,1},
+    {10639,1931,0,1}, {10639,1839,0,1}, {10639,54,0,1}, {10639,73,0,1}, {10639,463,0,1}, {10639,121,0,1}, {10639,174,0,1},
+    {10639,449,0,1}, {10639,195,0,1}, {10639,180,0,1}, {10639,245,0,1}, {10639,636,0,1}, {10639,262,0,1}, {10639,274,0,1},
+    {10639,334,0,1}, {10639,419,0,1}, {10639,430,0,1}, {10639,450,0,1}, {10639,483,0,1}, {10639,522,0,1}, {10639,552,0,1},
+    {10639,559,0,1}, {10639,429,0,1}, {10639,91,0,1}, {10639,602,0,1}, {10639,659,0,1}, {10639,677,0,1}, {10639,727,0,1},
+    {10639,1428,0,1}, {10639,897,0,1}, {10639,958,0,1}, {10639,1399,0,1}, {10639,1011,0,1}, {10639,967,0,1}, {10639,1097,0,1},
+    {10639,1682,0,1}, {10639,1119,0,1}, {10639,1138,0,1}, {10639,1247,0,1}, {10639,1324,0,1}, {10639,1370,0,1}, {10639,1402,0,1},
+    {10639,1474,0,1}, {10639,1521,0,1}, {10639,1585,0,1}, {10639,1592,0,1}, {10639,1369,0,1}, {10639,1522,0,1}, {10639,835,0,1},
+    {10639,1636,0,1}, {10639,1706,0,1}, {10639,1868,0,1}, {10639,none,3,0}, {10642,21,0,1}, {10642,1069,0,1}, {10642,1851,0,1},
+    {10642,none,3,0}, {10645,1084,0,1}, {10645,1840,0,1}, {10645,1082,0,1}, {10645,none,3,0}, {10648,22,0,1}, {10648,1112,0,1},
+    {10648,1841,0,1}, {10648,none,1,0}, {10649,1125,0,1}, {10649,none,4,0}, {10653,1415,0,1}, {10653,1215,0,1}, {10653,1852,0,1},
+    {10653,1932,0,1}, {10653,none,4,0}, {10657,23,0,1}, {10657,1233,0,1}, {10657,1842,0,1}, {10657,1237,0,1}, {10657,none,5,0},
+    {10662,24,0,1}, {10662,1277,0,1}, {10662,951,0,1}, {10662,1933,0,1}, {10662,none,1,0}, {10663,1296,0,1}, {10663,none,9,0},
+    {10672,none,1,0}, {10673,1716,0,1}, {10673,1820,0,1}, {10673,1385,0,1}, {10673,80,0,1}, {10673,1358,0,1}, {10673,896,0,1},
+    {10673,471,0,1}, {10673,33,0,1}, {10673,884,0,1}, {10673,none,5,0}, {10678,25,0,1}, {10678,32,0,1}, {10678,1823,0,1},
+    {10678,1854,0,1}, {10678,32,0,1}, {10678,none,3,0}, {10681,1843,0,1}, {10681,1855,0,1}, {10681,471,0,1}, {10681,none,6,0},
+    {10687,33,0,1}, {10687,984,0,1}, {10687,1520,0,1}, {10687,1875,0,1}, {10687,33,0,1}, {10687,1583,0,1}, {10687,none,5,0},
+    {10692,26,0,1}, {10692,1616,0,1}, {10692,1844,0,1}, {10692,1594,0,1}, {10692,548,0,1}, {10692,none,3,0}, {10695,27,0,1},
+    {10695,884,0,1}, {10695,1595,0,1}, {10695,none,2,0}, {10697,1845,0,1}, {10697,1692,0,1}, {10697,none,5,0}, {10702,28,0,1},
+    {10702,1846,0,1}, {10702,none,1,0}, {10703,1934,0,1}, {10703,1935,0,1}, {10703,none,3,0}, {10706,22,0,1}, {10706,27,0,1},
+    {10706,28,0,1}, {10706,none,9,0}, {10715,none,1,0}, {10716,803,0,1}, {10716,888,0,1}, {10716,115,0,1}, {10716,1859,0,1},
+    {10716,1862,0,1}, {10716,1868,0,1}, {10716,830,0,1}, {10716,1868,0,1}, {10716,none,2,0}, {10718,1936,0,1}, {10718,1936,0,1},
+    {10718,none,2,0}, {10720,29,0,1}, {10720,565,0,1},
+};
+
+inline constexpr SequenceTrie::Edge edges[] = {
+    {32,1}, {33,51}, {34,58}, {35,64}, {37,72}, {38,74}, {39,9928}, {40,9937}, {41,10163}, {42,10165}, {43,10171}, {44,10173},
+    {45,10177}, {46,10197}, {47,10205}, {48,10245}, {49,10251}, {50,10263}, {51,10267}, {52,10273}, {53,10277}, {54,10281},
+    {55,10283}, {58,10286}, {59,10289}, {60,10292}, {61,10299}, {62,10323}, {63,10331}, {65,10334}, {66,10337}, {67,10340},
+    {68,10347}, {69,10355}, {70,10359}, {71,10363}, {72,10366}, {73,10369}, {74,10372}, {75,10374}, {76,10376}, {78,10382},
+    {79,10389}, {80,10398}, {82,10404}, {83,10409}, {84,10414}, {87,10420}, {88,10422}, {89,10424}, {90,10427}, {91,10432},
+    {94,10514}, {96,10516}, {97,10518}, {98,10521}, {99,10523}, {100,10528}, {101,10535}, {102,10539}, {103,10545}, {104,10623},
+    {105,10627}, {106,10631}, {107,10635}, {108,10637}, {109,10642}, {110,10647}, {111,10654}, {112,10665}, {114,10671},
+    {115,10675}, {116,10682}, {120,10688}, {121,10692}, {122,10695}, {124,10705}, {126,10718}, {32,2}, {33,3}, {34,5},
+    {39,6}, {41,7}, {42,8}, {44,9}, {45,10}, {46,11}, {48,12}, {51,13}, {52,14}, {54,15}, {59,16}, {62,17}, {63,18}, {91,20},
+    {94,40}, {96,41}, {104,42}, {106,43}, {109,44}, {110,45}, {112,46}, {116,47}, {120,48}, {122,49}, {126,50}, {63,4},
+    {33,19}, {68,21}, {76,26}, {82,31}, {85,37}, {111,22}, {119,23}, {110,24}, {93,25}, {101,27}, {102,28}, {116,29},
+    {93,30}, {105,32}, {103,33}, {104,34}, {116,35}, {93,36}, {112,38}, {93,39}, {33,52}, {63,53}, {80,54}, {83,55}, {112,56},
+    {115,57}, {32,59}, {44,60}, {58,61}, {60,62}, {62,63}, {35,65}, {61,66}, {69,67}, {83,68}, {98,69}, {101,70}, {113,71},
+    {37,73}, {65,75}, {66,170}, {67,231}, {68,481}, {69,859}, {70,1006}, {71,1068}, {72,1176}, {73,1254}, {74,1380}, {75,1409},
+    {76,1442}, {77,1872}, {78,1920}, {79,2486}, {80,2618}, {81,2722}, {82,2738}, {83,3037}, {84,3274}, {85,3391}, {86,3607},
+    {87,3694}, {88,3716}, {89,3730}, {90,3771}, {97,3822}, {98,4027}, {99,4454}, {100,4840}, {101,5145}, {102,5393}, {103,5529},
+    {104,5734}, {105,5878}, {106,6071}, {107,6105}, {108,6146}, {109,6791}, {110,6941}, {111,7541}, {112,7741}, {113,7987},
+    {114,8034}, {115,8469}, {116,9022}, {117,9273}, {118,9490}, {119,9686}, {120,9728}, {121,9831}, {122,9872}, {69,76},
+    {77,81}, {97,84}, {98,90}, {99,96}, {102,103}, {103,106}, {108,112}, {109,117}, {110,122}, {111,125}, {112,133}, {114,146},
+    {115,151}, {116,160}, {117,166}, {108,77}, {105,78}, {103,79}, {59,80}, {80,82}, {59,83}, {99,85}, {117,86}, {116,87},
+    {101,88}, {59,89}, {114,91}, {101,92}, {118,93}, {101,94}, {59,95}, {105,97}, {121,101}, {114,98}, {99,99}, {59,100},
+    {59,102}, {114,104}, {59,105}, {114,107}, {97,108}, {118,109}, {101,110}, {59,111}, {112,113}, {104,114}, {97,115},
+    {59,116}, {97,118}, {99,119}, {114,120}, {59,121}, {100,123}, {59,124}, {103,126}, {112,130}, {111,127}, {110,128},
+    {59,129}, {102,131}, {59,132}, {112,134}, {108,135}, {121,136}, {70,137}, {117,138}, {110,139}, {99,140}, {116,141},
+    {105,142}, {111,143}, {110,144}, {59,145}, {105,147}, {110,148}, {103,149}, {59,150}, {99,152}, {115,155}, {114,153},
+    {59,154}, {105,156}, {103,157}, {110,158}, {59,159}, {105,161}, {108,162}, {100,163}, {101,164}, {59,165}, {109,167},
+    {108,168}, {59,169}, {97,171}, {99,187}, {101,190}, {102,209}, {111,212}, {114,216}, {115,221}, {117,225}, {99,172},
+    {114,180}, {107,173}, {115,174}, {108,175}, {97,176}, {115,177}, {104,178}, {59,179}, {118,181}, {119,183}, {59,182},
+    {101,184}, {100,185}, {59,186}, {121,188}, {59,189}, {99,191}, {114,197}, {116,206}, {97,192}, {117,193}, {115,194},
+    {101,195}, {59,196}, {110,198}, {111,199}, {117,200}, {108,201}, {108,202}, {105,203}, {115,204}, {59,205}, {97,207},
+    {59,208}, {114,210}, {59,211}, {112,213}, {102,214}, {59,215}, {101,217}, {118,218}, {101,219}, {59,220}, {99,222},
+    {114,223}, {59,224}, {109,226}, {112,227}, {101,228}, {113,229}, {59,230}, {72,232}, {79,236}, {97,240}, {99,272},
+    {100,293}, {101,297}, {102,312}, {104,315}, {105,318}, {108,344}, {111,393}, {114,465}, {115,470}, {117,474}, {99,233},
+    {121,234}, {59,235}, {80,237}, {89,238}, {59,239}, {99,241}, {112,246}, {121,266}, {117,242}, {116,243}, {101,244},
+    {59,245}, {59,247}, {105,248}, {116,249}, {97,250}, {108,251}, {68,252}, {105,253}, {102,254}, {102,255}, {101,256},
+    {114,257}, {101,258}, {110,259}, {116,260}, {105,261}, {97,262}, {108,263}, {68,264}, {59,265}, {108,267}, {101,268},
+    {121,269}, {115,270}, {59,271}, {97,273}, {101,278}, {105,283}, {111,287}, {114,274}, {111,275}, {110,276}, {59,277},
+    {100,279}, {105,280}, {108,281}, {59,282}, {114,284}, {99,285}, {59,286}, {110,288}, {105,289}, {110,290}, {116,291},
+    {59,292}, {111,294}, {116,295}, {59,296}, {100,298}, {110,304}, {105,299}, {108,300}, {108,301}, {97,302}, {59,303},
+    {116,305}, {101,306}, {114,307}, {68,308}, {111,309}, {116,310}, {59,311}, {114,313}, {59,314}, {105,316}, {59,317},
+    {114,319}, {99,320}, {108,321}, {101,322}, {68,323}, {77,327}, {80,333}, {84,338}, {111,324}, {116,325}, {59,326},
+    {105,328}, {110,329}, {117,330}, {115,331}, {59,332}, {108,334}, {117,335}, {115,336}, {59,337}, {105,339}, {109,340},
+    {101,341}, {115,342}, {59,343}, {111,345}, {99,346}, {115,368}, {107,347}, {119,348}, {105,349}, {115,350}, {101,351},
+    {67,352}, {111,353}, {110,354}, {116,355}, {111,356}, {117,357}, {114,358}, {73,359}, {110,360}, {116,361}, {101,362},
+    {103,363}, {114,364}, {97,365}, {108,366}, {59,367}, {101,369}, {67,370}, {117,371}, {114,372}, {108,373}, {121,374},
+    {68,375}, {81,387}, {111,376}, {117,377}, {98,378}, {108,379}, {101,380}, {81,381}, {117,382}, {111,383}, {116,384},
+    {101,385}, {59,386}, {117,388}, {111,389}, {116,390}, {101,391}, {59,392}, {108,394}, {110,400}, {112,425}, {117,435},
+    {111,395}, {110,396}, {59,397}, {101,398}, {59,399}, {103,401}, {105,408}, {116,412}, {114,402}, {117,403}, {101,404},
+    {110,405}, {116,406}, {59,407}, {110,409}, {116,410}, {59,411}, {111,413}, {117,414}, {114,415}, {73,416}, {110,417},
+    {116,418}, {101,419}, {103,420}, {114,421}, {97,422}, {108,423}, {59,424}, {102,426}, {114,428}, {59,427}, {111,429},
+    {100,430}, {117,431}, {99,432}, {116,433}, {59,434}, {110,436}, {116,437}, {101,438}, {114,439}, {67,440}, {108,441},
+    {111,442}, {99,443}, {107,444}, {119,445}, {105,446}, {115,447}, {101,448}, {67,449}, {111,450}, {110,451}, {116,452},
+    {111,453}, {117,454}, {114,455}, {73,456}, {110,457}, {116,458}, {101,459}, {103,460}, {114,461}, {97,462}, {108,463},
+    {59,464}, {111,466}, {115,467}, {115,468}, {59,469}, {99,471}, {114,472}, {59,473}, {112,475}, {59,476}, {67,477},
+    {97,478}, {112,479}, {59,480}, {68,482}, {74,491}, {83,495}, {90,499}, {97,503}, {99,516}, {101,524}, {102,530}, {105,533},
+    {111,592}, {115,850}, {59,483}, {111,484}, {116,485}, {114,486}, {97,487}, {104,488}, {100,489}, {59,490}, {99,492},
+    {121,493}, {59,494}, {99,496}, {121,497}, {59,498}, {99,500}, {121,501}, {59,502}, {103,504}, {114,509}, {115,512},
+    {103,505}, {101,506}, {114,507}, {59,508}, {114,510}, {59,511}, {104,513}, {118,514}, {59,515}, {97,517}, {121,522},
+    {114,518}, {111,519}, {110,520}, {59,521}, {59,523}, {108,525}, {59,526}, {116,527}, {97,528}, {59,529}, {114,531},
+    {59,532}, {97,534}, {102,580}, {99,535}, {109,575}, {114,536}, {105,537}, {116,538}, {105,539}, {99,540}, {97,541},
+    {108,542}, {65,543}, {68,549}, {71,563}, {84,569}, {99,544}, {117,545}, {116,546}, {101,547}, {59,548}, {111,550},
+    {116,551}, {117,553}, {59,552}, {98,554}, {108,555}, {101,556}, {65,557}, {99,558}, {117,559}, {116,560}, {101,561},
+    {59,562}, {114,564}, {97,565}, {118,566}, {101,567}, {59,568}, {105,570}, {108,571}, {100,572}, {101,573}, {59,574},
+    {111,576}, {110,577}, {100,578}, {59,579}, {102,581}, {101,582}, {114,583}, {101,584}, {110,585}, {116,586}, {105,587},
+    {97,588}, {108,589}, {68,590}, {59,591}, {112,593}, {116,596}, {117,608}, {119,745}, {102,594}, {59,595}, {59,597},
+    {68,598}, {69,602}, {111,599}, {116,600}, {59,601}, {113,603}, {117,604}, {97,605}, {108,606}, {59,607}, {98,609},
+    {108,610}, {101,611}, {67,612}, {68,628}, {76,640}, {82,700}, {85,715}, {86,733}, {111,613}, {110,614}, {116,615},
+    {111,616}, {117,617}, {114,618}, {73,619}, {110,620}, {116,621}, {101,622}, {103,623}, {114,624}, {97,625}, {108,626},
+    {59,627}, {111,629}, {116,630}, {119,632}, {59,631}, {110,633}, {65,634}, {114,635}, {114,636}, {111,637}, {119,638},
+    {59,639}, {101,641}, {111,665}, {102,642}, {116,643}, {65,644}, {82,650}, {84,661}, {114,645}, {114,646}, {111,647},
+    {119,648}, {59,649}, {105,651}, {103,652}, {104,653}, {116,654}, {65,655}, {114,656}, {114,657}, {111,658}, {119,659},
+    {59,660}, {101,662}, {101,663}, {59,664}, {110,666}, {103,667}, {76,668}, {82,689}, {101,669}, {102,670}, {116,671},
+    {65,672}, {82,678}, {114,673}, {114,674}, {111,675}, {119,676}, {59,677}, {105,679}, {103,680}, {104,681}, {116,682},
+    {65,683}, {114,684}, {114,685}, {111,686}, {119,687}, {59,688}, {105,690}, {103,691}, {104,692}, {116,693}, {65,694},
+    {114,695}, {114,696}, {111,697}, {119,698}, {59,699}, {105,701}, {103,702}, {104,703}, {116,704}, {65,705}, {84,711},
+    {114,706}, {114,707}, {111,708}, {119,709}, {59,710}, {101,712}, {101,713}, {59,714}, {112,716}, {65,717}, {68,723},
+    {114,718}, {114,719}, {111,720}, {119,721}, {59,722}, {111,724}, {119,725}, {110,726}, {65,727}, {114,728}, {114,729},
+    {111,730}, {119,731}, {59,732}, {101,734}, {114,735}, {116,736}, {105,737}, {99,738}, {97,739}, {108,740}, {66,741},
+    {97,742}, {114,743}, {59,744}, {110,746}, {65,747}, {66,765}, {76,771}, {82,808}, {84,834}, {97,844}, {114,748}, {114,749},
+    {111,750}, {119,751}, {59,752}, {66,753}, {85,757}, {97,754}, {114,755}, {59,756}, {112,758}, {65,759}, {114,760},
+    {114,761}, {111,762}, {119,763}, {59,764}, {114,766}, {101,767}, {118,768}, {101,769}, {59,770}, {101,772}, {102,773},
+    {116,774}, {82,775}, {84,787}, {86,797}, {105,776}, {103,777}, {104,778}, {116,779}, {86,780}, {101,781}, {99,782},
+    {116,783}, {111,784}, {114,785}, {59,786}, {101,788}, {101,789}, {86,790}, {101,791}, {99,792}, {116,793}, {111,794},
+    {114,795}, {59,796}, {101,798}, {99,799}, {116,800}, {111,801}, {114,802}, {59,803}, {66,804}, {97,805}, {114,806},
+    {59,807}, {105,809}, {103,810}, {104,811}, {116,812}, {84,813}, {86,823}, {101,814}, {101,815}, {86,816}, {101,817},
+    {99,818}, {116,819}, {111,820}, {114,821}, {59,822}, {101,824}, {99,825}, {116,826}, {111,827}, {114,828}, {59,829},
+    {66,830}, {97,831}, {114,832}, {59,833}, {101,835}, {101,836}, {59,837}, {65,838}, {114,839}, {114,840}, {111,841},
+    {119,842}, {59,843}, {114,845}, {114,846}, {111,847}, {119,848}, {59,849}, {99,851}, {116,854}, {114,852}, {59,853},
+    {114,855}, {111,856}, {107,857}, {59,858}, {78,860}, {84,863}, {97,866}, {99,872}, {100,884}, {102,888}, {103,891},
+    {108,897}, {109,904}, {111,940}, {112,948}, {113,955}, {115,975}, {116,982}, {117,985}, {120,989}, {71,861}, {59,862},
+    {72,864}, {59,865}, {99,867}, {117,868}, {116,869}, {101,870}, {59,871}, {97,873}, {105,878}, {121,882}, {114,874},
+    {111,875}, {110,876}, {59,877}, {114,879}, {99,880}, {59,881}, {59,883}, {111,885}, {116,886}, {59,887}, {114,889},
+    {59,890}, {114,892}, {97,893}, {118,894}, {101,895}, {59,896}, {101,898}, {109,899}, {101,900}, {110,901}, {116,902},
+    {59,903}, {97,905}, {112,909}, {99,906}, {114,907}, {59,908}, {116,910}, {121,911}, {83,912}, {86,924}, {109,913},
+    {97,914}, {108,915}, {108,916}, {83,917}, {113,918}, {117,919}, {97,920}, {114,921}, {101,922}, {59,923}, {101,925},
+    {114,926}, {121,927}, {83,928}, {109,929}, {97,930}, {108,931}, {108,932}, {83,933}, {113,934}, {117,935}, {97,936},
+    {114,937}, {101,938}, {59,939}, {103,941}, {112,945}, {111,942}, {110,943}, {59,944}, {102,946}, {59,947}, {115,949},
+    {105,950}, {108,951}, {111,952}, {110,953}, {59,954}, {117,956}, {97,957}, {105,966}, {108,958}, {59,959}, {84,960},
+    {105,961}, {108,962}, {100,963}, {101,964}, {59,965}, {108,967}, {105,968}, {98,969}, {114,970}, {105,971}, {117,972},
+    {109,973}, {59,974}, {99,976}, {105,979}, {114,977}, {59,978}, {109,980}, {59,981}, {97,983}, {59,984}, {109,986},
+    {108,987}, {59,988}, {105,990}, {112,995}, {115,991}, {116,992}, {115,993}, {59,994}, {111,996}, {110,997}, {101,998},
+    {110,999}, {116,1000}, {105,1001}, {97,1002}, {108,1003}, {69,1004}, {59,1005}, {99,1007}, {102,1010}, {105,1013},
+    {111,1046}, {115,1064}, {121,1008}, {59,1009}, {114,1011}, {59,1012}, {108,1014}, {108,1015}, {101,1016}, {100,1017},
+    {83,1018}, {86,1030}, {109,1019}, {97,1020}, {108,1021}, {108,1022}, {83,1023}, {113,1024}, {117,1025}, {97,1026},
+    {114,1027}, {101,1028}, {59,1029}, {101,1031}, {114,1032}, {121,1033}, {83,1034}, {109,1035}, {97,1036}, {108,1037},
+    {108,1038}, {83,1039}, {113,1040}, {117,1041}, {97,1042}, {114,1043}, {101,1044}, {59,1045}, {112,1047}, {114,1050},
+    {117,1055}, {102,1048}, {59,1049}, {65,1051}, {108,1052}, {108,1053}, {59,1054}, {114,1056}, {105,1057}, {101,1058},
+    {114,1059}, {116,1060}, {114,1061}, {102,1062}, {59,1063}, {99,1065}, {114,1066}, {59,1067}, {74,1069}, {84,1073},
+    {97,1075}, {98,1082}, {99,1088}, {100,1100}, {102,1104}, {103,1107}, {111,1109}, {114,1113}, {115,1170}, {116,1174},
+    {99,1070}, {121,1071}, {59,1072}, {59,1074}, {109,1076}, {109,1077}, {97,1078}, {59,1079}, {100,1080}, {59,1081},
+    {114,1083}, {101,1084}, {118,1085}, {101,1086}, {59,1087}, {101,1089}, {105,1094}, {121,1098}, {100,1090}, {105,1091},
+    {108,1092}, {59,1093}, {114,1095}, {99,1096}, {59,1097}, {59,1099}, {111,1101}, {116,1102}, {59,1103}, {114,1105},
+    {59,1106}, {59,1108}, {112,1110}, {102,1111}, {59,1112}, {101,1114}, {97,1115}, {116,1116}, {101,1117}, {114,1118},
+    {69,1119}, {70,1130}, {71,1140}, {76,1148}, {83,1153}, {84,1164}, {113,1120}, {117,1121}, {97,1122}, {108,1123}, {59,1124},
+    {76,1125}, {101,1126}, {115,1127}, {115,1128}, {59,1129}, {117,1131}, {108,1132}, {108,1133}, {69,1134}, {113,1135},
+    {117,1136}, {97,1137}, {108,1138}, {59,1139}, {114,1141}, {101,1142}, {97,1143}, {116,1144}, {101,1145}, {114,1146},
+    {59,1147}, {101,1149}, {115,1150}, {115,1151}, {59,1152}, {108,1154}, {97,1155}, {110,1156}, {116,1157}, {69,1158},
+    {113,1159}, {117,1160}, {97,1161}, {108,1162}, {59,1163}, {105,1165}, {108,1166}, {100,1167}, {101,1168}, {59,1169},
+    {99,1171}, {114,1172}, {59,1173}, {59,1175}, {65,1177}, {97,1183}, {99,1190}, {102,1195}, {105,1198}, {111,1210},
+    {115,1227}, {117,1236}, {82,1178}, {68,1179}, {99,1180}, {121,1181}, {59,1182}, {99,1184}, {116,1188}, {101,1185},
+    {107,1186}, {59,1187}, {59,1189}, {105,1191}, {114,1192}, {99,1193}, {59,1194}, {114,1196}, {59,1197}, {108,1199},
+    {98,1200}, {101,1201}, {114,1202}, {116,1203}, {83,1204}, {112,1205}, {97,1206}, {99,1207}, {101,1208}, {59,1209},
+    {112,1211}, {114,1214}, {102,1212}, {59,1213}, {105,1215}, {122,1216}, {111,1217}, {110,1218}, {116,1219}, {97,1220},
+    {108,1221}, {76,1222}, {105,1223}, {110,1224}, {101,1225}, {59,1226}, {99,1228}, {116,1231}, {114,1229}, {59,1230},
+    {114,1232}, {111,1233}, {107,1234}, {59,1235}, {109,1237}, {112,1238}, {68,1239}, {69,1248}, {111,1240}, {119,1241},
+    {110,1242}, {72,1243}, {117,1244}, {109,1245}, {112,1246}, {59,1247}, {113,1249}, {117,1250}, {97,1251}, {108,1252},
+    {59,1253}, {69,1255}, {74,1259}, {79,1264}, {97,1268}, {99,1274}, {100,1281}, {102,1285}, {103,1288}, {109,1294},
+    {110,1314}, {111,1351}, {115,1362}, {116,1366}, {117,1372}, {99,1256}, {121,1257}, {59,1258}, {108,1260}, {105,1261},
+    {103,1262}, {59,1263}, {99,1265}, {121,1266}, {59,1267}, {99,1269}, {117,1270}, {116,1271}, {101,1272}, {59,1273},
+    {105,1275}, {121,1279}, {114,1276}, {99,1277}, {59,1278}, {59,1280}, {111,1282}, {116,1283}, {59,1284}, {114,1286},
+    {59,1287}, {114,1289}, {97,1290}, {118,1291}, {101,1292}, {59,1293}, {59,1295}, {97,1296}, {112,1308}, {99,1297},
+    {103,1300}, {114,1298}, {59,1299}, {105,1301}, {110,1302}, {97,1303}, {114,1304}, {121,1305}, {73,1306}, {59,1307},
+    {108,1309}, {105,1310}, {101,1311}, {115,1312}, {59,1313}, {116,1315}, {118,1332}, {59,1316}, {101,1317}, {103,1318},
+    {114,1323}, {114,1319}, {97,1320}, {108,1321}, {59,1322}, {115,1324}, {101,1325}, {99,1326}, {116,1327}, {105,1328},
+    {111,1329}, {110,1330}, {59,1331}, {105,1333}, {115,1334}, {105,1335}, {98,1336}, {108,1337}, {101,1338}, {67,1339},
+    {84,1345}, {111,1340}, {109,1341}, {109,1342}, {97,1343}, {59,1344}, {105,1346}, {109,1347}, {101,1348}, {115,1349},
+    {59,1350}, {103,1352}, {112,1356}, {116,1359}, {111,1353}, {110,1354}, {59,1355}, {102,1357}, {59,1358}, {97,1360},
+    {59,1361}, {99,1363}, {114,1364}, {59,1365}, {105,1367}, {108,1368}, {100,1369}, {101,1370}, {59,1371}, {107,1373},
+    {109,1377}, {99,1374}, {121,1375}, {59,1376}, {108,1378}, {59,1379}, {99,1381}, {102,1388}, {111,1391}, {115,1395},
+    {117,1404}, {105,1382}, {121,1386}, {114,1383}, {99,1384}, {59,1385}, {59,1387}, {114,1389}, {59,1390}, {112,1392},
+    {102,1393}, {59,1394}, {99,1396}, {101,1399}, {114,1397}, {59,1398}, {114,1400}, {99,1401}, {121,1402}, {59,1403},
+    {107,1405}, {99,1406}, {121,1407}, {59,1408}, {72,1410}, {74,1414}, {97,1418}, {99,1423}, {102,1431}, {111,1434},
+    {115,1438}, {99,1411}, {121,1412}, {59,1413}, {99,1415}, {121,1416}, {59,1417}, {112,1419}, {112,1420}, {97,1421},
+    {59,1422}, {101,1424}, {121,1429}, {100,1425}, {105,1426}, {108,1427}, {59,1428}, {59,1430}, {114,1432}, {59,1433},
+    {112,1435}, {102,1436}, {59,1437}, {99,1439}, {114,1440}, {59,1441}, {74,1443}, {84,1447}, {97,1449}, {99,1475}, {101,1488},
+    {102,1745}, {108,1748}, {109,1759}, {111,1765}, {115,1859}, {116,1870}, {99,1444}, {121,1445}, {59,1446}, {59,1448},
+    {99,1450}, {109,1455}, {110,1460}, {112,1463}, {114,1472}, {117,1451}, {116,1452}, {101,1453}, {59,1454}, {98,1456},
+    {100,1457}, {97,1458}, {59,1459}, {103,1461}, {59,1462}, {108,1464}, {97,1465}, {99,1466}, {101,1467}, {116,1468},
+    {114,1469}, {102,1470}, {59,1471}, {114,1473}, {59,1474}, {97,1476}, {101,1481}, {121,1486}, {114,1477}, {111,1478},
+    {110,1479}, {59,1480}, {100,1482}, {105,1483}, {108,1484}, {59,1485}, {59,1487}, {102,1489}, {115,1690}, {116,1490},
+    {65,1491}, {67,1524}, {68,1532}, {70,1569}, {82,1575}, {84,1593}, {85,1628}, {86,1662}, {97,1673}, {114,1679}, {110,1492},
+    {114,1504}, {103,1493}, {108,1494}, {101,1495}, {66,1496}, {114,1497}, {97,1498}, {99,1499}, {107,1500}, {101,1501},
+    {116,1502}, {59,1503}, {114,1505}, {111,1506}, {119,1507}, {59,1508}, {66,1509}, {82,1513}, {97,1510}, {114,1511},
+    {59,1512}, {105,1514}, {103,1515}, {104,1516}, {116,1517}, {65,1518}, {114,1519}, {114,1520}, {111,1521}, {119,1522},
+    {59,1523}, {101,1525}, {105,1526}, {108,1527}, {105,1528}, {110,1529}, {103,1530}, {59,1531}, {111,1533}, {117,1534},
+    {119,1546}, {98,1535}, {108,1536}, {101,1537}, {66,1538}, {114,1539}, {97,1540}, {99,1541}, {107,1542}, {101,1543},
+    {116,1544}, {59,1545}, {110,1547}, {84,1548}, {86,1558}, {101,1549}, {101,1550}, {86,1551}, {101,1552}, {99,1553},
+    {116,1554}, {111,1555}, {114,1556}, {59,1557}, {101,1559}, {99,1560}, {116,1561}, {111,1562}, {114,1563}, {59,1564},
+    {66,1565}, {97,1566}, {114,1567}, {59,1568}, {108,1570}, {111,1571}, {111,1572}, {114,1573}, {59,1574}, {105,1576},
+    {103,1577}, {104,1578}, {116,1579}, {65,1580}, {86,1586}, {114,1581}, {114,1582}, {111,1583}, {119,1584}, {59,1585},
+    {101,1587}, {99,1588}, {116,1589}, {111,1590}, {114,1591}, {59,1592}, {101,1594}, {114,1610}, {101,1595}, {59,1596},
+    {65,1597}, {86,1603}, {114,1598}, {114,1599}, {111,1600}, {119,1601}, {59,1602}, {101,1604}, {99,1605}, {116,1606},
+    {111,1607}, {114,1608}, {59,1609}, {105,1611}, {97,1612}, {110,1613}, {103,1614}, {108,1615}, {101,1616}, {59,1617},
+    {66,1618}, {69,1622}, {97,1619}, {114,1620}, {59,1621}, {113,1623}, {117,1624}, {97,1625}, {108,1626}, {59,1627},
+    {112,1629}, {68,1630}, {84,1641}, {86,1651}, {111,1631}, {119,1632}, {110,1633}, {86,1634}, {101,1635}, {99,1636},
+    {116,1637}, {111,1638}, {114,1639}, {59,1640}, {101,1642}, {101,1643}, {86,1644}, {101,1645}, {99,1646}, {116,1647},
+    {111,1648}, {114,1649}, {59,1650}, {101,1652}, {99,1653}, {116,1654}, {111,1655}, {114,1656}, {59,1657}, {66,1658},
+    {97,1659}, {114,1660}, {59,1661}, {101,1663}, {99,1664}, {116,1665}, {111,1666}, {114,1667}, {59,1668}, {66,1669},
+    {97,1670}, {114,1671}, {59,1672}, {114,1674}, {114,1675}, {111,1676}, {119,1677}, {59,1678}, {105,1680}, {103,1681},
+    {104,1682}, {116,1683}, {97,1684}, {114,1685}, {114,1686}, {111,1687}, {119,1688}, {59,1689}, {115,1691}, {69,1692},
+    {70,1705}, {71,1715}, {76,1723}, {83,1728}, {84,1739}, {113,1693}, {117,1694}, {97,1695}, {108,1696}, {71,1697}, {114,1698},
+    {101,1699}, {97,1700}, {116,1701}, {101,1702}, {114,1703}, {59,1704}, {117,1706}, {108,1707}, {108,1708}, {69,1709},
+    {113,1710}, {117,1711}, {97,1712}, {108,1713}, {59,1714}, {114,1716}, {101,1717}, {97,1718}, {116,1719}, {101,1720},
+    {114,1721}, {59,1722}, {101,1724}, {115,1725}, {115,1726}, {59,1727}, {108,1729}, {97,1730}, {110,1731}, {116,1732},
+    {69,1733}, {113,1734}, {117,1735}, {97,1736}, {108,1737}, {59,1738}, {105,1740}, {108,1741}, {100,1742}, {101,1743},
+    {59,1744}, {114,1746}, {59,1747}, {59,1749}, {101,1750}, {102,1751}, {116,1752}, {97,1753}, {114,1754}, {114,1755},
+    {111,1756}, {119,1757}, {59,1758}, {105,1760}, {100,1761}, {111,1762}, {116,1763}, {59,1764}, {110,1766}, {112,1832},
+    {119,1835}, {103,1767}, {76,1768}, {82,1789}, {108,1800}, {114,1821}, {101,1769}, {102,1770}, {116,1771}, {65,1772},
+    {82,1778}, {114,1773}, {114,1774}, {111,1775}, {119,1776}, {59,1777}, {105,1779}, {103,1780}, {104,1781}, {116,1782},
+    {65,1783}, {114,1784}, {114,1785}, {111,1786}, {119,1787}, {59,1788}, {105,1790}, {103,1791}, {104,1792}, {116,1793},
+    {65,1794}, {114,1795}, {114,1796}, {111,1797}, {119,1798}, {59,1799}, {101,1801}, {102,1802}, {116,1803}, {97,1804},
+    {114,1810}, {114,1805}, {114,1806}, {111,1807}, {119,1808}, {59,1809}, {105,1811}, {103,1812}, {104,1813}, {116,1814},
+    {97,1815}, {114,1816}, {114,1817}, {111,1818}, {119,1819}, {59,1820}, {105,1822}, {103,1823}, {104,1824}, {116,1825},
+    {97,1826}, {114,1827}, {114,1828}, {111,1829}, {119,1830}, {59,1831}, {102,1833}, {59,1834}, {101,1836}, {114,1837},
+    {76,1838}, {82,1848}, {101,1839}, {102,1840}, {116,1841}, {65,1842}, {114,1843}, {114,1844}, {111,1845}, {119,1846},
+    {59,1847}, {105,1849}, {103,1850}, {104,1851}, {116,1852}, {65,1853}, {114,1854}, {114,1855}, {111,1856}, {119,1857},
+    {59,1858}, {99,1860}, {104,1863}, {116,1865}, {114,1861}, {59,1862}, {59,1864}, {114,1866}, {111,1867}, {107,1868},
+    {59,1869}, {59,1871}, {97,1873}, {99,1876}, {101,1879}, {102,1898}, {105,1901}, {111,1910}, {115,1914}, {117,1918},
+    {112,1874}, {59,1875}, {121,1877}, {59,1878}, {100,1880}, {108,1890}, {105,1881}, {117,1882}, {109,1883}, {83,1884},
+    {112,1885}, {97,1886}, {99,1887}, {101,1888}, {59,1889}, {108,1891}, {105,1892}, {110,1893}, {116,1894}, {114,1895},
+    {102,1896}, {59,1897}, {114,1899}, {59,1900}, {110,1902}, {117,1903}, {115,1904}, {80,1905}, {108,1906}, {117,1907},
+    {115,1908}, {59,1909}, {112,1911}, {102,1912}, {59,1913}, {99,1915}, {114,1916}, {59,1917}, {59,1919}, {74,1921},
+    {97,1925}, {99,1931}, {101,1944}, {102,2029}, {111,2032}, {115,2474}, {116,2478}, {117,2484}, {99,1922}, {121,1923},
+    {59,1924}, {99,1926}, {117,1927}, {116,1928}, {101,1929}, {59,1930}, {97,1932}, {101,1937}, {121,1942}, {114,1933},
+    {111,1934}, {110,1935}, {59,1936}, {100,1938}, {105,1939}, {108,1940}, {59,1941}, {59,1943}, {103,1945}, {115,1995},
+    {119,2023}, {97,1946}, {116,1947}, {105,1948}, {118,1949}, {101,1950}, {77,1951}, {84,1963}, {86,1981}, {101,1952},
+    {100,1953}, {105,1954}, {117,1955}, {109,1956}, {83,1957}, {112,1958}, {97,1959}, {99,1960}, {101,1961}, {59,1962},
+    {104,1964}, {105,1965}, {99,1966}, {110,1974}, {107,1967}, {83,1968}, {112,1969}, {97,1970}, {99,1971}, {101,1972},
+    {59,1973}, {83,1975}, {112,1976}, {97,1977}, {99,1978}, {101,1979}, {59,1980}, {101,1982}, {114,1983}, {121,1984},
+    {84,1985}, {104,1986}, {105,1987}, {110,1988}, {83,1989}, {112,1990}, {97,1991}, {99,1992}, {101,1993}, {59,1994},
+    {116,1996}, {101,1997}, {100,1998}, {71,1999}, {76,2014}, {114,2000}, {101,2001}, {97,2002}, {116,2003}, {101,2004},
+    {114,2005}, {71,2006}, {114,2007}, {101,2008}, {97,2009}, {116,2010}, {101,2011}, {114,2012}, {59,2013}, {101,2015},
+    {115,2016}, {115,2017}, {76,2018}, {101,2019}, {115,2020}, {115,2021}, {59,2022}, {76,2024}, {105,2025}, {110,2026},
+    {101,2027}, {59,2028}, {114,2030}, {59,2031}, {66,2033}, {110,2039}, {112,2054}, {116,2057}, {114,2034}, {101,2035},
+    {97,2036}, {107,2037}, {59,2038}, {66,2040}, {114,2041}, {101,2042}, {97,2043}, {107,2044}, {105,2045}, {110,2046},
+    {103,2047}, {83,2048}, {112,2049}, {97,2050}, {99,2051}, {101,2052}, {59,2053}, {102,2055}, {59,2056}, {59,2058},
+    {67,2059}, {68,2075}, {69,2093}, {71,2118}, {72,2172}, {76,2191}, {78,2253}, {80,2283}, {82,2309}, {83,2347}, {84,2434},
+    {86,2462}, {111,2060}, {117,2069}, {110,2061}, {103,2062}, {114,2063}, {117,2064}, {101,2065}, {110,2066}, {116,2067},
+    {59,2068}, {112,2070}, {67,2071}, {97,2072}, {112,2073}, {59,2074}, {111,2076}, {117,2077}, {98,2078}, {108,2079},
+    {101,2080}, {86,2081}, {101,2082}, {114,2083}, {116,2084}, {105,2085}, {99,2086}, {97,2087}, {108,2088}, {66,2089},
+    {97,2090}, {114,2091}, {59,2092}, {108,2094}, {113,2101}, {120,2112}, {101,2095}, {109,2096}, {101,2097}, {110,2098},
+    {116,2099}, {59,2100}, {117,2102}, {97,2103}, {108,2104}, {59,2105}, {84,2106}, {105,2107}, {108,2108}, {100,2109},
+    {101,2110}, {59,2111}, {105,2113}, {115,2114}, {116,2115}, {115,2116}, {59,2117}, {114,2119}, {101,2120}, {97,2121},
+    {116,2122}, {101,2123}, {114,2124}, {59,2125}, {69,2126}, {70,2132}, {71,2142}, {76,2150}, {83,2155}, {84,2166}, {113,2127},
+    {117,2128}, {97,2129}, {108,2130}, {59,2131}, {117,2133}, {108,2134}, {108,2135}, {69,2136}, {113,2137}, {117,2138},
+    {97,2139}, {108,2140}, {59,2141}, {114,2143}, {101,2144}, {97,2145}, {116,2146}, {101,2147}, {114,2148}, {59,2149},
+    {101,2151}, {115,2152}, {115,2153}, {59,2154}, {108,2156}, {97,2157}, {110,2158}, {116,2159}, {69,2160}, {113,2161},
+    {117,2162}, {97,2163}, {108,2164}, {59,2165}, {105,2167}, {108,2168}, {100,2169}, {101,2170}, {59,2171}, {117,2173},
+    {109,2174}, {112,2175}, {68,2176}, {69,2185}, {111,2177}, {119,2178}, {110,2179}, {72,2180}, {117,2181}, {109,2182},
+    {112,2183}, {59,2184}, {113,2186}, {117,2187}, {97,2188}, {108,2189}, {59,2190}, {101,2192}, {102,2193}, {115,2214},
+    {116,2194}, {84,2195}, {114,2196}, {105,2197}, {97,2198}, {110,2199}, {103,2200}, {108,2201}, {101,2202}, {59,2203},
+    {66,2204}, {69,2208}, {97,2205}, {114,2206}, {59,2207}, {113,2209}, {117,2210}, {97,2211}, {108,2212}, {59,2213},
+    {115,2215}, {59,2216}, {69,2217}, {71,2223}, {76,2231}, {83,2236}, {84,2247}, {113,2218}, {117,2219}, {97,2220}, {108,2221},
+    {59,2222}, {114,2224}, {101,2225}, {97,2226}, {116,2227}, {101,2228}, {114,2229}, {59,2230}, {101,2232}, {115,2233},
+    {115,2234}, {59,2235}, {108,2237}, {97,2238}, {110,2239}, {116,2240}, {69,2241}, {113,2242}, {117,2243}, {97,2244},
+    {108,2245}, {59,2246}, {105,2248}, {108,2249}, {100,2250}, {101,2251}, {59,2252}, {101,2254}, {115,2255}, {116,2256},
+    {101,2257}, {100,2258}, {71,2259}, {76,2274}, {114,2260}, {101,2261}, {97,2262}, {116,2263}, {101,2264}, {114,2265},
+    {71,2266}, {114,2267}, {101,2268}, {97,2269}, {116,2270}, {101,2271}, {114,2272}, {59,2273}, {101,2275}, {115,2276},
+    {115,2277}, {76,2278}, {101,2279}, {115,2280}, {115,2281}, {59,2282}, {114,2284}, {101,2285}, {99,2286}, {101,2287},
+    {100,2288}, {101,2289}, {115,2290}, {59,2291}, {69,2292}, {83,2298}, {113,2293}, {117,2294}, {97,2295}, {108,2296},
+    {59,2297}, {108,2299}, {97,2300}, {110,2301}, {116,2302}, {69,2303}, {113,2304}, {117,2305}, {97,2306}, {108,2307},
+    {59,2308}, {101,2310}, {105,2324}, {118,2311}, {101,2312}, {114,2313}, {115,2314}, {101,2315}, {69,2316}, {108,2317},
+    {101,2318}, {109,2319}, {101,2320}, {110,2321}, {116,2322}, {59,2323}, {103,2325}, {104,2326}, {116,2327}, {84,2328},
+    {114,2329}, {105,2330}, {97,2331}, {110,2332}, {103,2333}, {108,2334}, {101,2335}, {59,2336}, {66,2337}, {69,2341},
+    {97,2338}, {114,2339}, {59,2340}, {113,2342}, {117,2343}, {97,2344}, {108,2345}, {59,2346}, {113,2348}, {117,2379},
+    {117,2349}, {97,2350}, {114,2351}, {101,2352}, {83,2353}, {117,2354}, {98,2355}, {112,2366}, {115,2356}, {101,2357},
+    {116,2358}, {59,2359}, {69,2360}, {113,2361}, {117,2362}, {97,2363}, {108,2364}, {59,2365}, {101,2367}, {114,2368},
+    {115,2369}, {101,2370}, {116,2371}, {59,2372}, {69,2373}, {113,2374}, {117,2375}, {97,2376}, {108,2377}, {59,2378},
+    {98,2380}, {99,2391}, {112,2421}, {115,2381}, {101,2382}, {116,2383}, {59,2384}, {69,2385}, {113,2386}, {117,2387},
+    {97,2388}, {108,2389}, {59,2390}, {99,2392}, {101,2393}, {101,2394}, {100,2395}, {115,2396}, {59,2397}, {69,2398},
+    {83,2404}, {84,2415}, {113,2399}, {117,2400}, {97,2401}, {108,2402}, {59,2403}, {108,2405}, {97,2406}, {110,2407},
+    {116,2408}, {69,2409}, {113,2410}, {117,2411}, {97,2412}, {108,2413}, {59,2414}, {105,2416}, {108,2417}, {100,2418},
+    {101,2419}, {59,2420}, {101,2422}, {114,2423}, {115,2424}, {101,2425}, {116,2426}, {59,2427}, {69,2428}, {113,2429},
+    {117,2430}, {97,2431}, {108,2432}, {59,2433}, {105,2435}, {108,2436}, {100,2437}, {101,2438}, {59,2439}, {69,2440},
+    {70,2446}, {84,2456}, {113,2441}, {117,2442}, {97,2443}, {108,2444}, {59,2445}, {117,2447}, {108,2448}, {108,2449},
+    {69,2450}, {113,2451}, {117,2452}, {97,2453}, {108,2454}, {59,2455}, {105,2457}, {108,2458}, {100,2459}, {101,2460},
+    {59,2461}, {101,2463}, {114,2464}, {116,2465}, {105,2466}, {99,2467}, {97,2468}, {108,2469}, {66,2470}, {97,2471},
+    {114,2472}, {59,2473}, {99,2475}, {114,2476}, {59,2477}, {105,2479}, {108,2480}, {100,2481}, {101,2482}, {59,2483},
+    {59,2485}, {69,2487}, {97,2492}, {99,2498}, {100,2505}, {102,2511}, {103,2514}, {109,2520}, {111,2535}, {112,2539},
+    {114,2565}, {115,2567}, {116,2576}, {117,2586}, {118,2590}, {108,2488}, {105,2489}, {103,2490}, {59,2491}, {99,2493},
+    {117,2494}, {116,2495}, {101,2496}, {59,2497}, {105,2499}, {121,2503}, {114,2500}, {99,2501}, {59,2502}, {59,2504},
+    {98,2506}, {108,2507}, {97,2508}, {99,2509}, {59,2510}, {114,2512}, {59,2513}, {114,2515}, {97,2516}, {118,2517},
+    {101,2518}, {59,2519}, {97,2521}, {101,2525}, {105,2529}, {99,2522}, {114,2523}, {59,2524}, {103,2526}, {97,2527},
+    {59,2528}, {99,2530}, {114,2531}, {111,2532}, {110,2533}, {59,2534}, {112,2536}, {102,2537}, {59,2538}, {101,2540},
+    {110,2541}, {67,2542}, {117,2543}, {114,2544}, {108,2545}, {121,2546}, {68,2547}, {81,2559}, {111,2548}, {117,2549},
+    {98,2550}, {108,2551}, {101,2552}, {81,2553}, {117,2554}, {111,2555}, {116,2556}, {101,2557}, {59,2558}, {117,2560},
+    {111,2561}, {116,2562}, {101,2563}, {59,2564}, {59,2566}, {99,2568}, {108,2571}, {114,2569}, {59,2570}, {97,2572},
+    {115,2573}, {104,2574}, {59,2575}, {105,2577}, {108,2578}, {109,2582}, {100,2579}, {101,2580}, {59,2581}, {101,2583},
+    {115,2584}, {59,2585}, {109,2587}, {108,2588}, {59,2589}, {101,2591}, {114,2592}, {66,2593}, {80,2606}, {97,2594},
+    {114,2597}, {114,2595}, {59,2596}, {97,2598}, {99,2599}, {101,2600}, {107,2602}, {59,2601}, {101,2603}, {116,2604},
+    {59,2605}, {97,2607}, {114,2608}, {101,2609}, {110,2610}, {116,2611}, {104,2612}, {101,2613}, {115,2614}, {105,2615},
+    {115,2616}, {59,2617}, {97,2619}, {99,2627}, {102,2630}, {104,2633}, {105,2636}, {108,2638}, {111,2647}, {114,2663},
+    {115,2716}, {114,2620}, {116,2621}, {105,2622}, {97,2623}, {108,2624}, {68,2625}, {59,2626}, {121,2628}, {59,2629},
+    {114,2631}, {59,2632}, {105,2634}, {59,2635}, {59,2637}, {117,2639}, {115,2640}, {77,2641}, {105,2642}, {110,2643},
+    {117,2644}, {115,2645}, {59,2646}, {105,2648}, {112,2660}, {110,2649}, {99,2650}, {97,2651}, {114,2652}, {101,2653},
+    {112,2654}, {108,2655}, {97,2656}, {110,2657}, {101,2658}, {59,2659}, {102,2661}, {59,2662}, {59,2664}, {101,2665},
+    {105,2695}, {111,2699}, {99,2666}, {101,2667}, {100,2668}, {101,2669}, {115,2670}, {59,2671}, {69,2672}, {83,2678},
+    {84,2689}, {113,2673}, {117,2674}, {97,2675}, {108,2676}, {59,2677}, {108,2679}, {97,2680}, {110,2681}, {116,2682},
+    {69,2683}, {113,2684}, {117,2685}, {97,2686}, {108,2687}, {59,2688}, {105,2690}, {108,2691}, {100,2692}, {101,2693},
+    {59,2694}, {109,2696}, {101,2697}, {59,2698}, {100,2700}, {112,2705}, {117,2701}, {99,2702}, {116,2703}, {59,2704},
+    {111,2706}, {114,2707}, {116,2708}, {105,2709}, {111,2710}, {110,2711}, {59,2712}, {97,2713}, {108,2714}, {59,2715},
+    {99,2717}, {105,2720}, {114,2718}, {59,2719}, {59,2721}, {85,2723}, {102,2727}, {111,2730}, {115,2734}, {79,2724},
+    {84,2725}, {59,2726}, {114,2728}, {59,2729}, {112,2731}, {102,2732}, {59,2733}, {99,2735}, {114,2736}, {59,2737},
+    {66,2739}, {69,2744}, {97,2747}, {99,2762}, {101,2775}, {102,2815}, {104,2818}, {105,2821}, {111,2994}, {114,3009},
+    {115,3020}, {117,3026}, {97,2740}, {114,2741}, {114,2742}, {59,2743}, {71,2745}, {59,2746}, {99,2748}, {110,2753},
+    {114,2756}, {117,2749}, {116,2750}, {101,2751}, {59,2752}, {103,2754}, {59,2755}, {114,2757}, {59,2758}, {116,2759},
+    {108,2760}, {59,2761}, {97,2763}, {101,2768}, {121,2773}, {114,2764}, {111,2765}, {110,2766}, {59,2767}, {100,2769},
+    {105,2770}, {108,2771}, {59,2772}, {59,2774}, {59,2776}, {118,2777}, {101,2778}, {114,2779}, {115,2780}, {101,2781},
+    {69,2782}, {85,2801}, {108,2783}, {113,2790}, {101,2784}, {109,2785}, {101,2786}, {110,2787}, {116,2788}, {59,2789},
+    {117,2791}, {105,2792}, {108,2793}, {105,2794}, {98,2795}, {114,2796}, {105,2797}, {117,2798}, {109,2799}, {59,2800},
+    {112,2802}, {69,2803}, {113,2804}, {117,2805}, {105,2806}, {108,2807}, {105,2808}, {98,2809}, {114,2810}, {105,2811},
+    {117,2812}, {109,2813}, {59,2814}, {114,2816}, {59,2817}, {111,2819}, {59,2820}, {103,2822}, {104,2823}, {116,2824},
+    {65,2825}, {67,2857}, {68,2865}, {70,2902}, {84,2908}, {85,2943}, {86,2977}, {97,2988}, {110,2826}, {114,2838}, {103,2827},
+    {108,2828}, {101,2829}, {66,2830}, {114,2831}, {97,2832}, {99,2833}, {107,2834}, {101,2835}, {116,2836}, {59,2837},
+    {114,2839}, {111,2840}, {119,2841}, {59,2842}, {66,2843}, {76,2847}, {97,2844}, {114,2845}, {59,2846}, {101,2848},
+    {102,2849}, {116,2850}, {65,2851}, {114,2852}, {114,2853}, {111,2854}, {119,2855}, {59,2856}, {101,2858}, {105,2859},
+    {108,2860}, {105,2861}, {110,2862}, {103,2863}, {59,2864}, {111,2866}, {117,2867}, {119,2879}, {98,2868}, {108,2869},
+    {101,2870}, {66,2871}, {114,2872}, {97,2873}, {99,2874}, {107,2875}, {101,2876}, {116,2877}, {59,2878}, {110,2880},
+    {84,2881}, {86,2891}, {101,2882}, {101,2883}, {86,2884}, {101,2885}, {99,2886}, {116,2887}, {111,2888}, {114,2889},
+    {59,2890}, {101,2892}, {99,2893}, {116,2894}, {111,2895}, {114,2896}, {59,2897}, {66,2898}, {97,2899}, {114,2900},
+    {59,2901}, {108,2903}, {111,2904}, {111,2905}, {114,2906}, {59,2907}, {101,2909}, {114,2925}, {101,2910}, {59,2911},
+    {65,2912}, {86,2918}, {114,2913}, {114,2914}, {111,2915}, {119,2916}, {59,2917}, {101,2919}, {99,2920}, {116,2921},
+    {111,2922}, {114,2923}, {59,2924}, {105,2926}, {97,2927}, {110,2928}, {103,2929}, {108,2930}, {101,2931}, {59,2932},
+    {66,2933}, {69,2937}, {97,2934}, {114,2935}, {59,2936}, {113,2938}, {117,2939}, {97,2940}, {108,2941}, {59,2942},
+    {112,2944}, {68,2945}, {84,2956}, {86,2966}, {111,2946}, {119,2947}, {110,2948}, {86,2949}, {101,2950}, {99,2951},
+    {116,2952}, {111,2953}, {114,2954}, {59,2955}, {101,2957}, {101,2958}, {86,2959}, {101,2960}, {99,2961}, {116,2962},
+    {111,2963}, {114,2964}, {59,2965}, {101,2967}, {99,2968}, {116,2969}, {111,2970}, {114,2971}, {59,2972}, {66,2973},
+    {97,2974}, {114,2975}, {59,2976}, {101,2978}, {99,2979}, {116,2980}, {111,2981}, {114,2982}, {59,2983}, {66,2984},
+    {97,2985}, {114,2986}, {59,2987}, {114,2989}, {114,2990}, {111,2991}, {119,2992}, {59,2993}, {112,2995}, {117,2998},
+    {102,2996}, {59,2997}, {110,2999}, {100,3000}, {73,3001}, {109,3002}, {112,3003}, {108,3004}, {105,3005}, {101,3006},
+    {115,3007}, {59,3008}, {105,3010}, {103,3011}, {104,3012}, {116,3013}, {97,3014}, {114,3015}, {114,3016}, {111,3017},
+    {119,3018}, {59,3019}, {99,3021}, {104,3024}, {114,3022}, {59,3023}, {59,3025}, {108,3027}, {101,3028}, {68,3029},
+    {101,3030}, {108,3031}, {97,3032}, {121,3033}, {101,3034}, {100,3035}, {59,3036}, {72,3038}, {79,3047}, {97,3053},
+    {99,3059}, {102,3077}, {104,3080}, {105,3123}, {109,3128}, {111,3139}, {113,3143}, {115,3197}, {116,3201}, {117,3205},
+    {67,3039}, {99,3044}, {72,3040}, {99,3041}, {121,3042}, {59,3043}, {121,3045}, {59,3046}, {70,3048}, {84,3049}, {99,3050},
+    {121,3051}, {59,3052}, {99,3054}, {117,3055}, {116,3056}, {101,3057}, {59,3058}, {59,3060}, {97,3061}, {101,3066},
+    {105,3071}, {121,3075}, {114,3062}, {111,3063}, {110,3064}, {59,3065}, {100,3067}, {105,3068}, {108,3069}, {59,3070},
+    {114,3072}, {99,3073}, {59,3074}, {59,3076}, {114,3078}, {59,3079}, {111,3081}, {114,3082}, {116,3083}, {68,3084},
+    {76,3094}, {82,3104}, {85,3115}, {111,3085}, {119,3086}, {110,3087}, {65,3088}, {114,3089}, {114,3090}, {111,3091},
+    {119,3092}, {59,3093}, {101,3095}, {102,3096}, {116,3097}, {65,3098}, {114,3099}, {114,3100}, {111,3101}, {119,3102},
+    {59,3103}, {105,3105}, {103,3106}, {104,3107}, {116,3108}, {65,3109}, {114,3110}, {114,3111}, {111,3112}, {119,3113},
+    {59,3114}, {112,3116}, {65,3117}, {114,3118}, {114,3119}, {111,3120}, {119,3121}, {59,3122}, {103,3124}, {109,3125},
+    {97,3126}, {59,3127}, {97,3129}, {108,3130}, {108,3131}, {67,3132}, {105,3133}, {114,3134}, {99,3135}, {108,3136},
+    {101,3137}, {59,3138}, {112,3140}, {102,3141}, {59,3142}, {114,3144}, {117,3147}, {116,3145}, {59,3146}, {97,3148},
+    {114,3149}, {101,3150}, {59,3151}, {73,3152}, {83,3165}, {85,3191}, {110,3153}, {116,3154}, {101,3155}, {114,3156},
+    {115,3157}, {101,3158}, {99,3159}, {116,3160}, {105,3161}, {111,3162}, {110,3163}, {59,3164}, {117,3166}, {98,3167},
+    {112,3178}, {115,3168}, {101,3169}, {116,3170}, {59,3171}, {69,3172}, {113,3173}, {117,3174}, {97,3175}, {108,3176},
+    {59,3177}, {101,3179}, {114,3180}, {115,3181}, {101,3182}, {116,3183}, {59,3184}, {69,3185}, {113,3186}, {117,3187},
+    {97,3188}, {108,3189}, {59,3190}, {110,3192}, {105,3193}, {111,3194}, {110,3195}, {59,3196}, {99,3198}, {114,3199},
+    {59,3200}, {97,3202}, {114,3203}, {59,3204}, {98,3206}, {99,3218}, {109,3254}, {112,3256}, {59,3207}, {115,3208},
+    {101,3209}, {116,3210}, {59,3211}, {69,3212}, {113,3213}, {117,3214}, {97,3215}, {108,3216}, {59,3217}, {99,3219},
+    {104,3248}, {101,3220}, {101,3221}, {100,3222}, {115,3223}, {59,3224}, {69,3225}, {83,3231}, {84,3242}, {113,3226},
+    {117,3227}, {97,3228}, {108,3229}, {59,3230}, {108,3232}, {97,3233}, {110,3234}, {116,3235}, {69,3236}, {113,3237},
+    {117,3238}, {97,3239}, {108,3240}, {59,3241}, {105,3243}, {108,3244}, {100,3245}, {101,3246}, {59,3247}, {84,3249},
+    {104,3250}, {97,3251}, {116,3252}, {59,3253}, {59,3255}, {59,3257}, {101,3258}, {115,3270}, {114,3259}, {115,3260},
+    {101,3261}, {116,3262}, {59,3263}, {69,3264}, {113,3265}, {117,3266}, {97,3267}, {108,3268}, {59,3269}, {101,3271},
+    {116,3272}, {59,3273}, {72,3275}, {82,3280}, {83,3285}, {97,3293}, {99,3298}, {102,3311}, {104,3314}, {105,3342},
+    {111,3369}, {114,3373}, {115,3382}, {79,3276}, {82,3277}, {78,3278}, {59,3279}, {65,3281}, {68,3282}, {69,3283}, {59,3284},
+    {72,3286}, {99,3290}, {99,3287}, {121,3288}, {59,3289}, {121,3291}, {59,3292}, {98,3294}, {117,3296}, {59,3295}, {59,3297},
+    {97,3299}, {101,3304}, {121,3309}, {114,3300}, {111,3301}, {110,3302}, {59,3303}, {100,3305}, {105,3306}, {108,3307},
+    {59,3308}, {59,3310}, {114,3312}, {59,3313}, {101,3315}, {105,3326}, {114,3316}, {116,3323}, {101,3317}, {102,3318},
+    {111,3319}, {114,3320}, {101,3321}, {59,3322}, {97,3324}, {59,3325}, {99,3327}, {110,3335}, {107,3328}, {83,3329},
+    {112,3330}, {97,3331}, {99,3332}, {101,3333}, {59,3334}, {83,3336}, {112,3337}, {97,3338}, {99,3339}, {101,3340},
+    {59,3341}, {108,3343}, {100,3344}, {101,3345}, {59,3346}, {69,3347}, {70,3353}, {84,3363}, {113,3348}, {117,3349},
+    {97,3350}, {108,3351}, {59,3352}, {117,3354}, {108,3355}, {108,3356}, {69,3357}, {113,3358}, {117,3359}, {97,3360},
+    {108,3361}, {59,3362}, {105,3364}, {108,3365}, {100,3366}, {101,3367}, {59,3368}, {112,3370}, {102,3371}, {59,3372},
+    {105,3374}, {112,3375}, {108,3376}, {101,3377}, {68,3378}, {111,3379}, {116,3380}, {59,3381}, {99,3383}, {116,3386},
+    {114,3384}, {59,3385}, {114,3387}, {111,3388}, {107,3389}, {59,3390}, {97,3392}, {98,3406}, {99,3415}, {100,3422},
+    {102,3428}, {103,3431}, {109,3437}, {110,3442}, {111,3480}, {112,3488}, {114,3588}, {115,3593}, {116,3597}, {117,3603},
+    {99,3393}, {114,3398}, {117,3394}, {116,3395}, {101,3396}, {59,3397}, {114,3399}, {59,3400}, {111,3401}, {99,3402},
+    {105,3403}, {114,3404}, {59,3405}, {114,3407}, {99,3408}, {101,3411}, {121,3409}, {59,3410}, {118,3412}, {101,3413},
+    {59,3414}, {105,3416}, {121,3420}, {114,3417}, {99,3418}, {59,3419}, {59,3421}, {98,3423}, {108,3424}, {97,3425},
+    {99,3426}, {59,3427}, {114,3429}, {59,3430}, {114,3432}, {97,3433}, {118,3434}, {101,3435}, {59,3436}, {97,3438},
+    {99,3439}, {114,3440}, {59,3441}, {100,3443}, {105,3471}, {101,3444}, {114,3445}, {66,3446}, {80,3459}, {97,3447},
+    {114,3450}, {114,3448}, {59,3449}, {97,3451}, {99,3452}, {101,3453}, {107,3455}, {59,3454}, {101,3456}, {116,3457},
+    {59,3458}, {97,3460}, {114,3461}, {101,3462}, {110,3463}, {116,3464}, {104,3465}, {101,3466}, {115,3467}, {105,3468},
+    {115,3469}, {59,3470}, {111,3472}, {110,3473}, {59,3474}, {80,3475}, {108,3476}, {117,3477}, {115,3478}, {59,3479},
+    {103,3481}, {112,3485}, {111,3482}, {110,3483}, {59,3484}, {102,3486}, {59,3487}, {65,3489}, {68,3509}, {69,3519},
+    {84,3531}, {97,3541}, {100,3547}, {112,3557}, {115,3581}, {114,3490}, {114,3491}, {111,3492}, {119,3493}, {59,3494},
+    {66,3495}, {68,3499}, {97,3496}, {114,3497}, {59,3498}, {111,3500}, {119,3501}, {110,3502}, {65,3503}, {114,3504},
+    {114,3505}, {111,3506}, {119,3507}, {59,3508}, {111,3510}, {119,3511}, {110,3512}, {65,3513}, {114,3514}, {114,3515},
+    {111,3516}, {119,3517}, {59,3518}, {113,3520}, {117,3521}, {105,3522}, {108,3523}, {105,3524}, {98,3525}, {114,3526},
+    {105,3527}, {117,3528}, {109,3529}, {59,3530}, {101,3532}, {101,3533}, {59,3534}, {65,3535}, {114,3536}, {114,3537},
+    {111,3538}, {119,3539}, {59,3540}, {114,3542}, {114,3543}, {111,3544}, {119,3545}, {59,3546}, {111,3548}, {119,3549},
+    {110,3550}, {97,3551}, {114,3552}, {114,3553}, {111,3554}, {119,3555}, {59,3556}, {101,3558}, {114,3559}, {76,3560},
+    {82,3570}, {101,3561}, {102,3562}, {116,3563}, {65,3564}, {114,3565}, {114,3566}, {111,3567}, {119,3568}, {59,3569},
+    {105,3571}, {103,3572}, {104,3573}, {116,3574}, {65,3575}, {114,3576}, {114,3577}, {111,3578}, {119,3579}, {59,3580},
+    {105,3582}, {59,3583}, {108,3584}, {111,3585}, {110,3586}, {59,3587}, {105,3589}, {110,3590}, {103,3591}, {59,3592},
+    {99,3594}, {114,3595}, {59,3596}, {105,3598}, {108,3599}, {100,3600}, {101,3601}, {59,3602}, {109,3604}, {108,3605},
+    {59,3606}, {68,3608}, {98,3613}, {99,3617}, {100,3620}, {101,3627}, {102,3677}, {111,3680}, {115,3684}, {118,3688},
+    {97,3609}, {115,3610}, {104,3611}, {59,3612}, {97,3614}, {114,3615}, {59,3616}, {121,3618}, {59,3619}, {97,3621},
+    {115,3622}, {104,3623}, {59,3624}, {108,3625}, {59,3626}, {101,3628}, {114,3630}, {59,3629}, {98,3631}, {116,3635},
+    {121,3666}, {97,3632}, {114,3633}, {59,3634}, {59,3636}, {105,3637}, {99,3638}, {97,3639}, {108,3640}, {66,3641},
+    {76,3645}, {83,3650}, {84,3660}, {97,3642}, {114,3643}, {59,3644}, {105,3646}, {110,3647}, {101,3648}, {59,3649},
+    {101,3651}, {112,3652}, {97,3653}, {114,3654}, {97,3655}, {116,3656}, {111,3657}, {114,3658}, {59,3659}, {105,3661},
+    {108,3662}, {100,3663}, {101,3664}, {59,3665}, {84,3667}, {104,3668}, {105,3669}, {110,3670}, {83,3671}, {112,3672},
+    {97,3673}, {99,3674}, {101,3675}, {59,3676}, {114,3678}, {59,3679}, {112,3681}, {102,3682}, {59,3683}, {99,3685},
+    {114,3686}, {59,3687}, {100,3689}, {97,3690}, {115,3691}, {104,3692}, {59,3693}, {99,3695}, {101,3700}, {102,3705},
+    {111,3708}, {115,3712}, {105,3696}, {114,3697}, {99,3698}, {59,3699}, {100,3701}, {103,3702}, {101,3703}, {59,3704},
+    {114,3706}, {59,3707}, {112,3709}, {102,3710}, {59,3711}, {99,3713}, {114,3714}, {59,3715}, {102,3717}, {105,3720},
+    {111,3722}, {115,3726}, {114,3718}, {59,3719}, {59,3721}, {112,3723}, {102,3724}, {59,3725}, {99,3727}, {114,3728},
+    {59,3729}, {65,3731}, {73,3735}, {85,3739}, {97,3743}, {99,3749}, {102,3756}, {111,3759}, {115,3763}, {117,3767},
+    {99,3732}, {121,3733}, {59,3734}, {99,3736}, {121,3737}, {59,3738}, {99,3740}, {121,3741}, {59,3742}, {99,3744}, {117,3745},
+    {116,3746}, {101,3747}, {59,3748}, {105,3750}, {121,3754}, {114,3751}, {99,3752}, {59,3753}, {59,3755}, {114,3757},
+    {59,3758}, {112,3760}, {102,3761}, {59,3762}, {99,3764}, {114,3765}, {59,3766}, {109,3768}, {108,3769}, {59,3770},
+    {72,3772}, {97,3776}, {99,3782}, {100,3790}, {101,3794}, {102,3811}, {111,3814}, {115,3818}, {99,3773}, {121,3774},
+    {59,3775}, {99,3777}, {117,3778}, {116,3779}, {101,3780}, {59,3781}, {97,3783}, {121,3788}, {114,3784}, {111,3785},
+    {110,3786}, {59,3787}, {59,3789}, {111,3791}, {116,3792}, {59,3793}, {114,3795}, {116,3808}, {111,3796}, {87,3797},
+    {105,3798}, {100,3799}, {116,3800}, {104,3801}, {83,3802}, {112,3803}, {97,3804}, {99,3805}, {101,3806}, {59,3807},
+    {97,3809}, {59,3810}, {114,3812}, {59,3813}, {112,3815}, {102,3816}, {59,3817}, {99,3819}, {114,3820}, {59,3821},
+    {97,3823}, {98,3829}, {99,3835}, {101,3851}, {102,3856}, {103,3860}, {108,3866}, {109,3880}, {110,3890}, {111,3954},
+    {112,3962}, {114,3987}, {115,3992}, {116,4005}, {117,4011}, {119,4015}, {99,3824}, {117,3825}, {116,3826}, {101,3827},
+    {59,3828}, {114,3830}, {101,3831}, {118,3832}, {101,3833}, {59,3834}, {59,3836}, {69,3837}, {100,3839}, {105,3841},
+    {117,3845}, {121,3849}, {59,3838}, {59,3840}, {114,3842}, {99,3843}, {59,3844}, {116,3846}, {101,3847}, {59,3848},
+    {59,3850}, {108,3852}, {105,3853}, {103,3854}, {59,3855}, {59,3857}, {114,3858}, {59,3859}, {114,3861}, {97,3862},
+    {118,3863}, {101,3864}, {59,3865}, {101,3867}, {112,3876}, {102,3868}, {112,3873}, {115,3869}, {121,3870}, {109,3871},
+    {59,3872}, {104,3874}, {59,3875}, {104,3877}, {97,3878}, {59,3879}, {97,3881}, {112,3888}, {99,3882}, {108,3885},
+    {114,3883}, {59,3884}, {103,3886}, {59,3887}, {59,3889}, {100,3891}, {103,3907}, {59,3892}, {97,3893}, {100,3897},
+    {115,3899}, {118,3905}, {110,3894}, {100,3895}, {59,3896}, {59,3898}, {108,3900}, {111,3901}, {112,3902}, {101,3903},
+    {59,3904}, {59,3906}, {59,3908}, {101,3909}, {108,3911}, {109,3914}, {114,3935}, {115,3943}, {122,3949}, {59,3910},
+    {101,3912}, {59,3913}, {115,3915}, {100,3916}, {59,3917}, {97,3918}, {97,3919}, {98,3921}, {99,3923}, {100,3925},
+    {101,3927}, {102,3929}, {103,3931}, {104,3933}, {59,3920}, {59,3922}, {59,3924}, {59,3926}, {59,3928}, {59,3930},
+    {59,3932}, {59,3934}, {116,3936}, {59,3937}, {118,3938}, {98,3939}, {59,3940}, {100,3941}, {59,3942}, {112,3944},
+    {116,3947}, {104,3945}, {59,3946}, {59,3948}, {97,3950}, {114,3951}, {114,3952}, {59,3953}, {103,3955}, {112,3959},
+    {111,3956}, {110,3957}, {59,3958}, {102,3960}, {59,3961}, {59,3963}, {69,3964}, {97,3966}, {101,3971}, {105,3973},
+    {111,3976}, {112,3979}, {59,3965}, {99,3967}, {105,3968}, {114,3969}, {59,3970}, {59,3972}, {100,3974}, {59,3975},
+    {115,3977}, {59,3978}, {114,3980}, {111,3981}, {120,3982}, {59,3983}, {101,3984}, {113,3985}, {59,3986}, {105,3988},
+    {110,3989}, {103,3990}, {59,3991}, {99,3993}, {116,3996}, {121,3998}, {114,3994}, {59,3995}, {59,3997}, {109,3999},
+    {112,4000}, {59,4001}, {101,4002}, {113,4003}, {59,4004}, {105,4006}, {108,4007}, {100,4008}, {101,4009}, {59,4010},
+    {109,4012}, {108,4013}, {59,4014}, {99,4016}, {105,4023}, {111,4017}, {110,4018}, {105,4019}, {110,4020}, {116,4021},
+    {59,4022}, {110,4024}, {116,4025}, {59,4026}, {78,4028}, {97,4032}, {98,4073}, {99,4082}, {100,4089}, {101,4094},
+    {102,4127}, {105,4130}, {107,4201}, {108,4207}, {110,4267}, {111,4278}, {112,4399}, {114,4405}, {115,4415}, {117,4438},
+    {111,4029}, {116,4030}, {59,4031}, {99,4033}, {114,4061}, {107,4034}, {99,4035}, {101,4040}, {112,4048}, {115,4054},
+    {111,4036}, {110,4037}, {103,4038}, {59,4039}, {112,4041}, {115,4042}, {105,4043}, {108,4044}, {111,4045}, {110,4046},
+    {59,4047}, {114,4049}, {105,4050}, {109,4051}, {101,4052}, {59,4053}, {105,4055}, {109,4056}, {59,4057}, {101,4058},
+    {113,4059}, {59,4060}, {118,4062}, {119,4066}, {101,4063}, {101,4064}, {59,4065}, {101,4067}, {100,4068}, {59,4069},
+    {103,4070}, {101,4071}, {59,4072}, {114,4074}, {107,4075}, {59,4076}, {116,4077}, {98,4078}, {114,4079}, {107,4080},
+    {59,4081}, {111,4083}, {121,4087}, {110,4084}, {103,4085}, {59,4086}, {59,4088}, {113,4090}, {117,4091}, {111,4092},
+    {59,4093}, {99,4095}, {109,4102}, {112,4108}, {114,4112}, {116,4117}, {97,4096}, {117,4097}, {115,4098}, {59,4099},
+    {101,4100}, {59,4101}, {112,4103}, {116,4104}, {121,4105}, {118,4106}, {59,4107}, {115,4109}, {105,4110}, {59,4111},
+    {110,4113}, {111,4114}, {117,4115}, {59,4116}, {97,4118}, {104,4120}, {119,4122}, {59,4119}, {59,4121}, {101,4123},
+    {101,4124}, {110,4125}, {59,4126}, {114,4128}, {59,4129}, {103,4131}, {99,4132}, {111,4143}, {115,4159}, {116,4169},
+    {117,4185}, {118,4191}, {119,4195}, {97,4133}, {105,4136}, {117,4140}, {112,4134}, {59,4135}, {114,4137}, {99,4138},
+    {59,4139}, {112,4141}, {59,4142}, {100,4144}, {112,4148}, {116,4153}, {111,4145}, {116,4146}, {59,4147}, {108,4149},
+    {117,4150}, {115,4151}, {59,4152}, {105,4154}, {109,4155}, {101,4156}, {115,4157}, {59,4158}, {113,4160}, {116,4165},
+    {99,4161}, {117,4162}, {112,4163}, {59,4164}, {97,4166}, {114,4167}, {59,4168}, {114,4170}, {105,4171}, {97,4172},
+    {110,4173}, {103,4174}, {108,4175}, {101,4176}, {100,4177}, {117,4182}, {111,4178}, {119,4179}, {110,4180}, {59,4181},
+    {112,4183}, {59,4184}, {112,4186}, {108,4187}, {117,4188}, {115,4189}, {59,4190}, {101,4192}, {101,4193}, {59,4194},
+    {101,4196}, {100,4197}, {103,4198}, {101,4199}, {59,4200}, {97,4202}, {114,4203}, {111,4204}, {119,4205}, {59,4206},
+    {97,4208}, {107,4254}, {111,4263}, {99,4209}, {110,4251}, {107,4210}, {108,4211}, {115,4219}, {116,4226}, {111,4212},
+    {122,4213}, {101,4214}, {110,4215}, {103,4216}, {101,4217}, {59,4218}, {113,4220}, {117,4221}, {97,4222}, {114,4223},
+    {101,4224}, {59,4225}, {114,4227}, {105,4228}, {97,4229}, {110,4230}, {103,4231}, {108,4232}, {101,4233}, {59,4234},
+    {100,4235}, {108,4240}, {114,4245}, {111,4236}, {119,4237}, {110,4238}, {59,4239}, {101,4241}, {102,4242}, {116,4243},
+    {59,4244}, {105,4246}, {103,4247}, {104,4248}, {116,4249}, {59,4250}, {107,4252}, {59,4253}, {49,4255}, {51,4260},
+    {50,4256}, {52,4258}, {59,4257}, {59,4259}, {52,4261}, {59,4262}, {99,4264}, {107,4265}, {59,4266}, {101,4268}, {111,4275},
+    {59,4269}, {113,4270}, {117,4271}, {105,4272}, {118,4273}, {59,4274}, {116,4276}, {59,4277}, {112,4279}, {116,4282},
+    {119,4288}, {120,4293}, {102,4280}, {59,4281}, {59,4283}, {116,4284}, {111,4285}, {109,4286}, {59,4287}, {116,4289},
+    {105,4290}, {101,4291}, {59,4292}, {68,4294}, {72,4303}, {85,4313}, {86,4322}, {98,4336}, {100,4340}, {104,4349},
+    {109,4359}, {112,4365}, {116,4370}, {117,4376}, {118,4385}, {76,4295}, {82,4297}, {108,4299}, {114,4301}, {59,4296},
+    {59,4298}, {59,4300}, {59,4302}, {59,4304}, {68,4305}, {85,4307}, {100,4309}, {117,4311}, {59,4306}, {59,4308}, {59,4310},
+    {59,4312}, {76,4314}, {82,4316}, {108,4318}, {114,4320}, {59,4315}, {59,4317}, {59,4319}, {59,4321}, {59,4323}, {72,4324},
+    {76,4326}, {82,4328}, {104,4330}, {108,4332}, {114,4334}, {59,4325}, {59,4327}, {59,4329}, {59,4331}, {59,4333}, {59,4335},
+    {111,4337}, {120,4338}, {59,4339}, {76,4341}, {82,4343}, {108,4345}, {114,4347}, {59,4342}, {59,4344}, {59,4346},
+    {59,4348}, {59,4350}, {68,4351}, {85,4353}, {100,4355}, {117,4357}, {59,4352}, {59,4354}, {59,4356}, {59,4358}, {105,4360},
+    {110,4361}, {117,4362}, {115,4363}, {59,4364}, {108,4366}, {117,4367}, {115,4368}, {59,4369}, {105,4371}, {109,4372},
+    {101,4373}, {115,4374}, {59,4375}, {76,4377}, {82,4379}, {108,4381}, {114,4383}, {59,4378}, {59,4380}, {59,4382},
+    {59,4384}, {59,4386}, {72,4387}, {76,4389}, {82,4391}, {104,4393}, {108,4395}, {114,4397}, {59,4388}, {59,4390}, {59,4392},
+    {59,4394}, {59,4396}, {59,4398}, {114,4400}, {105,4401}, {109,4402}, {101,4403}, {59,4404}, {101,4406}, {118,4410},
+    {118,4407}, {101,4408}, {59,4409}, {98,4411}, {97,4412}, {114,4413}, {59,4414}, {99,4416}, {101,4419}, {105,4423},
+    {111,4428}, {114,4417}, {59,4418}, {109,4420}, {105,4421}, {59,4422}, {109,4424}, {59,4425}, {101,4426}, {59,4427},
+    {108,4429}, {59,4430}, {98,4431}, {104,4433}, {59,4432}, {115,4434}, {117,4435}, {98,4436}, {59,4437}, {108,4439},
+    {109,4445}, {108,4440}, {59,4441}, {101,4442}, {116,4443}, {59,4444}, {112,4446}, {59,4447}, {69,4448}, {101,4450},
+    {59,4449}, {59,4451}, {113,4452}, {59,4453}, {97,4455}, {99,4493}, {100,4518}, {101,4522}, {102,4542}, {104,4545},
+    {105,4560}, {108,4624}, {111,4633}, {114,4687}, {115,4696}, {116,4709}, {117,4714}, {119,4822}, {121,4834}, {99,4456},
+    {112,4461}, {114,4486}, {117,4457}, {116,4458}, {101,4459}, {59,4460}, {59,4462}, {97,4463}, {98,4467}, {99,4473},
+    {100,4480}, {115,4484}, {110,4464}, {100,4465}, {59,4466}, {114,4468}, {99,4469}, {117,4470}, {112,4471}, {59,4472},
+    {97,4474}, {117,4477}, {112,4475}, {59,4476}, {112,4478}, {59,4479}, {111,4481}, {116,4482}, {59,4483}, {59,4485},
+    {101,4487}, {111,4490}, {116,4488}, {59,4489}, {110,4491}, {59,4492}, {97,4494}, {101,4502}, {105,4507}, {117,4511},
+    {112,4495}, {114,4498}, {115,4496}, {59,4497}, {111,4499}, {110,4500}, {59,4501}, {100,4503}, {105,4504}, {108,4505},
+    {59,4506}, {114,4508}, {99,4509}, {59,4510}, {112,4512}, {115,4513}, {59,4514}, {115,4515}, {109,4516}, {59,4517},
+    {111,4519}, {116,4520}, {59,4521}, {100,4523}, {109,4527}, {110,4533}, {105,4524}, {108,4525}, {59,4526}, {112,4528},
+    {116,4529}, {121,4530}, {118,4531}, {59,4532}, {116,4534}, {59,4535}, {101,4536}, {114,4537}, {100,4538}, {111,4539},
+    {116,4540}, {59,4541}, {114,4543}, {59,4544}, {99,4546}, {101,4549}, {105,4558}, {121,4547}, {59,4548}, {99,4550},
+    {107,4551}, {59,4552}, {109,4553}, {97,4554}, {114,4555}, {107,4556}, {59,4557}, {59,4559}, {114,4561}, {59,4562},
+    {69,4563}, {99,4565}, {101,4607}, {102,4609}, {109,4615}, {115,4619}, {59,4564}, {59,4566}, {101,4567}, {108,4570},
+    {113,4568}, {59,4569}, {101,4571}, {97,4572}, {100,4588}, {114,4573}, {114,4574}, {111,4575}, {119,4576}, {108,4577},
+    {114,4582}, {101,4578}, {102,4579}, {116,4580}, {59,4581}, {105,4583}, {103,4584}, {104,4585}, {116,4586}, {59,4587},
+    {82,4589}, {83,4591}, {97,4593}, {99,4597}, {100,4602}, {59,4590}, {59,4592}, {115,4594}, {116,4595}, {59,4596}, {105,4598},
+    {114,4599}, {99,4600}, {59,4601}, {97,4603}, {115,4604}, {104,4605}, {59,4606}, {59,4608}, {110,4610}, {105,4611},
+    {110,4612}, {116,4613}, {59,4614}, {105,4616}, {100,4617}, {59,4618}, {99,4620}, {105,4621}, {114,4622}, {59,4623},
+    {117,4625}, {98,4626}, {115,4627}, {59,4628}, {117,4629}, {105,4630}, {116,4631}, {59,4632}, {108,4634}, {109,4642},
+    {110,4664}, {112,4675}, {111,4635}, {110,4636}, {59,4637}, {101,4638}, {59,4639}, {113,4640}, {59,4641}, {109,4643},
+    {112,4648}, {97,4644}, {59,4645}, {116,4646}, {59,4647}, {59,4649}, {102,4650}, {108,4653}, {110,4651}, {59,4652},
+    {101,4654}, {109,4655}, {120,4660}, {101,4656}, {110,4657}, {116,4658}, {59,4659}, {101,4661}, {115,4662}, {59,4663},
+    {103,4665}, {105,4671}, {59,4666}, {100,4667}, {111,4668}, {116,4669}, {59,4670}, {110,4672}, {116,4673}, {59,4674},
+    {102,4676}, {114,4678}, {121,4682}, {59,4677}, {111,4679}, {100,4680}, {59,4681}, {59,4683}, {115,4684}, {114,4685},
+    {59,4686}, {97,4688}, {111,4692}, {114,4689}, {114,4690}, {59,4691}, {115,4693}, {115,4694}, {59,4695}, {99,4697},
+    {117,4700}, {114,4698}, {59,4699}, {98,4701}, {112,4705}, {59,4702}, {101,4703}, {59,4704}, {59,4706}, {101,4707},
+    {59,4708}, {100,4710}, {111,4711}, {116,4712}, {59,4713}, {100,4715}, {101,4723}, {108,4730}, {112,4737}, {114,4761},
+    {118,4814}, {119,4818}, {97,4716}, {114,4717}, {114,4718}, {108,4719}, {114,4721}, {59,4720}, {59,4722}, {112,4724},
+    {115,4727}, {114,4725}, {59,4726}, {99,4728}, {59,4729}, {97,4731}, {114,4732}, {114,4733}, {59,4734}, {112,4735},
+    {59,4736}, {59,4738}, {98,4739}, {99,4745}, {100,4752}, {111,4756}, {115,4759}, {114,4740}, {99,4741}, {97,4742},
+    {112,4743}, {59,4744}, {97,4746}, {117,4749}, {112,4747}, {59,4748}, {112,4750}, {59,4751}, {111,4753}, {116,4754},
+    {59,4755}, {114,4757}, {59,4758}, {59,4760}, {97,4762}, {108,4768}, {114,4792}, {118,4796}, {114,4763}, {114,4764},
+    {59,4765}, {109,4766}, {59,4767}, {121,4769}, {101,4770}, {118,4782}, {119,4786}, {113,4771}, {112,4772}, {115,4777},
+    {114,4773}, {101,4774}, {99,4775}, {59,4776}, {117,4778}, {99,4779}, {99,4780}, {59,4781}, {101,4783}, {101,4784},
+    {59,4785}, {101,4787}, {100,4788}, {103,4789}, {101,4790}, {59,4791}, {101,4793}, {110,4794}, {59,4795}, {101,4797},
+    {97,4798}, {114,4799}, {114,4800}, {111,4801}, {119,4802}, {108,4803}, {114,4808}, {101,4804}, {102,4805}, {116,4806},
+    {59,4807}, {105,4809}, {103,4810}, {104,4811}, {116,4812}, {59,4813}, {101,4815}, {101,4816}, {59,4817}, {101,4819},
+    {100,4820}, {59,4821}, {99,4823}, {105,4830}, {111,4824}, {110,4825}, {105,4826}, {110,4827}, {116,4828}, {59,4829},
+    {110,4831}, {116,4832}, {59,4833}, {108,4835}, {99,4836}, {116,4837}, {121,4838}, {59,4839}, {65,4841}, {72,4845},
+    {97,4849}, {98,4868}, {99,4879}, {100,4887}, {101,4904}, {102,4917}, {104,4925}, {105,4932}, {106,4977}, {108,4981},
+    {111,4991}, {114,5077}, {115,5094}, {116,5108}, {117,5118}, {119,5127}, {122,5134}, {114,4842}, {114,4843}, {59,4844},
+    {97,4846}, {114,4847}, {59,4848}, {103,4850}, {108,4855}, {114,4860}, {115,4863}, {103,4851}, {101,4852}, {114,4853},
+    {59,4854}, {101,4856}, {116,4857}, {104,4858}, {59,4859}, {114,4861}, {59,4862}, {104,4864}, {59,4865}, {118,4866},
+    {59,4867}, {107,4869}, {108,4875}, {97,4870}, {114,4871}, {111,4872}, {119,4873}, {59,4874}, {97,4876}, {99,4877},
+    {59,4878}, {97,4880}, {121,4885}, {114,4881}, {111,4882}, {110,4883}, {59,4884}, {59,4886}, {59,4888}, {97,4889},
+    {111,4898}, {103,4890}, {114,4895}, {103,4891}, {101,4892}, {114,4893}, {59,4894}, {114,4896}, {59,4897}, {116,4899},
+    {115,4900}, {101,4901}, {113,4902}, {59,4903}, {103,4905}, {108,4907}, {109,4911}, {59,4906}, {116,4908}, {97,4909},
+    {59,4910}, {112,4912}, {116,4913}, {121,4914}, {118,4915}, {59,4916}, {105,4918}, {114,4923}, {115,4919}, {104,4920},
+    {116,4921}, {59,4922}, {59,4924}, {97,4926}, {114,4927}, {108,4928}, {114,4930}, {59,4929}, {59,4931}, {97,4933},
+    {101,4947}, {103,4949}, {115,4955}, {118,4959}, {109,4934}, {59,4935}, {111,4936}, {115,4945}, {110,4937}, {100,4938},
+    {59,4939}, {115,4940}, {117,4941}, {105,4942}, {116,4943}, {59,4944}, {59,4946}, {59,4948}, {97,4950}, {109,4951},
+    {109,4952}, {97,4953}, {59,4954}, {105,4956}, {110,4957}, {59,4958}, {59,4960}, {105,4961}, {111,4973}, {100,4962},
+    {101,4963}, {59,4964}, {111,4965}, {110,4966}, {116,4967}, {105,4968}, {109,4969}, {101,4970}, {115,4971}, {59,4972},
+    {110,4974}, {120,4975}, {59,4976}, {99,4978}, {121,4979}, {59,4980}, {99,4982}, {111,4983}, {114,4987}, {114,4984},
+    {110,4985}, {59,4986}, {111,4988}, {112,4989}, {59,4990}, {108,4992}, {112,4997}, {116,5000}, {117,5027}, {119,5040},
+    {108,4993}, {97,4994}, {114,4995}, {59,4996}, {102,4998}, {59,4999}, {59,5001}, {101,5002}, {109,5009}, {112,5015},
+    {115,5020}, {113,5003}, {59,5004}, {100,5005}, {111,5006}, {116,5007}, {59,5008}, {105,5010}, {110,5011}, {117,5012},
+    {115,5013}, {59,5014}, {108,5016}, {117,5017}, {115,5018}, {59,5019}, {113,5021}, {117,5022}, {97,5023}, {114,5024},
+    {101,5025}, {59,5026}, {98,5028}, {108,5029}, {101,5030}, {98,5031}, {97,5032}, {114,5033}, {119,5034}, {101,5035},
+    {100,5036}, {103,5037}, {101,5038}, {59,5039}, {110,5041}, {97,5042}, {100,5048}, {104,5059}, {114,5043}, {114,5044},
+    {111,5045}, {119,5046}, {59,5047}, {111,5049}, {119,5050}, {110,5051}, {97,5052}, {114,5053}, {114,5054}, {111,5055},
+    {119,5056}, {115,5057}, {59,5058}, {97,5060}, {114,5061}, {112,5062}, {111,5063}, {111,5064}, {110,5065}, {108,5066},
+    {114,5071}, {101,5067}, {102,5068}, {116,5069}, {59,5070}, {105,5072}, {103,5073}, {104,5074}, {116,5075}, {59,5076},
+    {98,5078}, {99,5085}, {107,5079}, {97,5080}, {114,5081}, {111,5082}, {119,5083}, {59,5084}, {111,5086}, {114,5090},
+    {114,5087}, {110,5088}, {59,5089}, {111,5091}, {112,5092}, {59,5093}, {99,5095}, {111,5100}, {116,5103}, {114,5096},
+    {121,5098}, {59,5097}, {59,5099}, {108,5101}, {59,5102}, {114,5104}, {111,5105}, {107,5106}, {59,5107}, {100,5109},
+    {114,5113}, {111,5110}, {116,5111}, {59,5112}, {105,5114}, {59,5115}, {102,5116}, {59,5117}, {97,5119}, {104,5123},
+    {114,5120}, {114,5121}, {59,5122}, {97,5124}, {114,5125}, {59,5126}, {97,5128}, {110,5129}, {103,5130}, {108,5131},
+    {101,5132}, {59,5133}, {99,5135}, {105,5138}, {121,5136}, {59,5137}, {103,5139}, {114,5140}, {97,5141}, {114,5142},
+    {114,5143}, {59,5144}, {68,5146}, {97,5154}, {99,5165}, {100,5183}, {101,5187}, {102,5189}, {103,5196}, {108,5209},
+    {109,5226}, {110,5249}, {111,5255}, {112,5263}, {113,5283}, {114,5333}, {115,5342}, {116,5353}, {117,5358}, {120,5365},
+    {68,5147}, {111,5151}, {111,5148}, {116,5149}, {59,5150}, {116,5152}, {59,5153}, {99,5155}, {115,5160}, {117,5156},
+    {116,5157}, {101,5158}, {59,5159}, {116,5161}, {101,5162}, {114,5163}, {59,5164}, {97,5166}, {105,5171}, {111,5176},
+    {121,5181}, {114,5167}, {111,5168}, {110,5169}, {59,5170}, {114,5172}, {59,5173}, {99,5174}, {59,5175}, {108,5177},
+    {111,5178}, {110,5179}, {59,5180}, {59,5182}, {111,5184}, {116,5185}, {59,5186}, {59,5188}, {68,5190}, {114,5194},
+    {111,5191}, {116,5192}, {59,5193}, {59,5195}, {59,5197}, {114,5198}, {115,5203}, {97,5199}, {118,5200}, {101,5201},
+    {59,5202}, {59,5204}, {100,5205}, {111,5206}, {116,5207}, {59,5208}, {59,5210}, {105,5211}, {108,5218}, {115,5220},
+    {110,5212}, {116,5213}, {101,5214}, {114,5215}, {115,5216}, {59,5217}, {59,5219}, {59,5221}, {100,5222}, {111,5223},
+    {116,5224}, {59,5225}, {97,5227}, {112,5231}, {115,5241}, {99,5228}, {114,5229}, {59,5230}, {116,5232}, {121,5233},
+    {59,5234}, {115,5235}, {118,5239}, {101,5236}, {116,5237}, {59,5238}, {59,5240}, {112,5242}, {49,5243}, {59,5248},
+    {51,5244}, {52,5246}, {59,5245}, {59,5247}, {103,5250}, {115,5252}, {59,5251}, {112,5253}, {59,5254}, {103,5256},
+    {112,5260}, {111,5257}, {110,5258}, {59,5259}, {102,5261}, {59,5262}, {97,5264}, {108,5270}, {115,5274}, {114,5265},
+    {59,5266}, {115,5267}, {108,5268}, {59,5269}, {117,5271}, {115,5272}, {59,5273}, {105,5275}, {59,5276}, {108,5277},
+    {118,5281}, {111,5278}, {110,5279}, {59,5280}, {59,5282}, {99,5284}, {115,5294}, {117,5311}, {118,5326}, {105,5285},
+    {111,5289}, {114,5286}, {99,5287}, {59,5288}, {108,5290}, {111,5291}, {110,5292}, {59,5293}, {105,5295}, {108,5298},
+    {109,5296}, {59,5297}, {97,5299}, {110,5300}, {116,5301}, {103,5302}, {108,5306}, {116,5303}, {114,5304}, {59,5305},
+    {101,5307}, {115,5308}, {115,5309}, {59,5310}, {97,5312}, {101,5316}, {105,5320}, {108,5313}, {115,5314}, {59,5315},
+    {115,5317}, {116,5318}, {59,5319}, {118,5321}, {59,5322}, {68,5323}, {68,5324}, {59,5325}, {112,5327}, {97,5328},
+    {114,5329}, {115,5330}, {108,5331}, {59,5332}, {68,5334}, {97,5338}, {111,5335}, {116,5336}, {59,5337}, {114,5339},
+    {114,5340}, {59,5341}, {99,5343}, {100,5346}, {105,5350}, {114,5344}, {59,5345}, {111,5347}, {116,5348}, {59,5349},
+    {109,5351}, {59,5352}, {97,5354}, {104,5356}, {59,5355}, {59,5357}, {109,5359}, {114,5362}, {108,5360}, {59,5361},
+    {111,5363}, {59,5364}, {99,5366}, {105,5369}, {112,5373}, {108,5367}, {59,5368}, {115,5370}, {116,5371}, {59,5372},
+    {101,5374}, {111,5383}, {99,5375}, {116,5376}, {97,5377}, {116,5378}, {105,5379}, {111,5380}, {110,5381}, {59,5382},
+    {110,5384}, {101,5385}, {110,5386}, {116,5387}, {105,5388}, {97,5389}, {108,5390}, {101,5391}, {59,5392}, {97,5394},
+    {99,5407}, {101,5410}, {102,5416}, {105,5432}, {106,5437}, {108,5442}, {110,5454}, {111,5458}, {112,5471}, {114,5479},
+    {115,5525}, {108,5395}, {108,5396}, {105,5397}, {110,5398}, {103,5399}, {100,5400}, {111,5401}, {116,5402}, {115,5403},
+    {101,5404}, {113,5405}, {59,5406}, {121,5408}, {59,5409}, {109,5411}, {97,5412}, {108,5413}, {101,5414}, {59,5415},
+    {105,5417}, {108,5422}, {114,5430}, {108,5418}, {105,5419}, {103,5420}, {59,5421}, {105,5423}, {108,5426}, {103,5424},
+    {59,5425}, {105,5427}, {103,5428}, {59,5429}, {59,5431}, {108,5433}, {105,5434}, {103,5435}, {59,5436}, {108,5438},
+    {105,5439}, {103,5440}, {59,5441}, {97,5443}, {108,5446}, {116,5450}, {116,5444}, {59,5445}, {105,5447}, {103,5448},
+    {59,5449}, {110,5451}, {115,5452}, {59,5453}, {111,5455}, {102,5456}, {59,5457}, {112,5459}, {114,5462}, {102,5460},
+    {59,5461}, {97,5463}, {107,5467}, {108,5464}, {108,5465}, {59,5466}, {59,5468}, {118,5469}, {59,5470}, {97,5472},
+    {114,5473}, {116,5474}, {105,5475}, {110,5476}, {116,5477}, {59,5478}, {97,5480}, {111,5521}, {99,5481}, {115,5518},
+    {49,5482}, {50,5495}, {51,5500}, {52,5507}, {53,5510}, {55,5515}, {50,5483}, {51,5485}, {52,5487}, {53,5489}, {54,5491},
+    {56,5493}, {59,5484}, {59,5486}, {59,5488}, {59,5490}, {59,5492}, {59,5494}, {51,5496}, {53,5498}, {59,5497}, {59,5499},
+    {52,5501}, {53,5503}, {56,5505}, {59,5502}, {59,5504}, {59,5506}, {53,5508}, {59,5509}, {54,5511}, {56,5513}, {59,5512},
+    {59,5514}, {56,5516}, {59,5517}, {108,5519}, {59,5520}, {119,5522}, {110,5523}, {59,5524}, {99,5526}, {114,5527},
+    {59,5528}, {69,5530}, {97,5534}, {98,5548}, {99,5554}, {100,5561}, {101,5565}, {102,5597}, {103,5600}, {105,5604},
+    {106,5609}, {108,5613}, {110,5621}, {111,5642}, {114,5646}, {115,5651}, {116,5662}, {118,5722}, {59,5531}, {108,5532},
+    {59,5533}, {99,5535}, {109,5540}, {112,5546}, {117,5536}, {116,5537}, {101,5538}, {59,5539}, {109,5541}, {97,5542},
+    {59,5543}, {100,5544}, {59,5545}, {59,5547}, {114,5549}, {101,5550}, {118,5551}, {101,5552}, {59,5553}, {105,5555},
+    {121,5559}, {114,5556}, {99,5557}, {59,5558}, {59,5560}, {111,5562}, {116,5563}, {59,5564}, {59,5566}, {108,5567},
+    {113,5569}, {115,5579}, {59,5568}, {59,5570}, {113,5571}, {115,5573}, {59,5572}, {108,5574}, {97,5575}, {110,5576},
+    {116,5577}, {59,5578}, {59,5580}, {99,5581}, {100,5584}, {108,5592}, {99,5582}, {59,5583}, {111,5585}, {116,5586},
+    {59,5587}, {111,5588}, {59,5589}, {108,5590}, {59,5591}, {59,5593}, {101,5594}, {115,5595}, {59,5596}, {114,5598},
+    {59,5599}, {59,5601}, {103,5602}, {59,5603}, {109,5605}, {101,5606}, {108,5607}, {59,5608}, {99,5610}, {121,5611},
+    {59,5612}, {59,5614}, {69,5615}, {97,5617}, {106,5619}, {59,5616}, {59,5618}, {59,5620}, {69,5622}, {97,5624}, {101,5632},
+    {115,5638}, {59,5623}, {112,5625}, {59,5626}, {112,5627}, {114,5628}, {111,5629}, {120,5630}, {59,5631}, {59,5633},
+    {113,5634}, {59,5635}, {113,5636}, {59,5637}, {105,5639}, {109,5640}, {59,5641}, {112,5643}, {102,5644}, {59,5645},
+    {97,5647}, {118,5648}, {101,5649}, {59,5650}, {99,5652}, {105,5655}, {114,5653}, {59,5654}, {109,5656}, {59,5657},
+    {101,5658}, {108,5660}, {59,5659}, {59,5661}, {59,5663}, {99,5664}, {100,5670}, {108,5674}, {113,5679}, {114,5685},
+    {99,5665}, {105,5667}, {59,5666}, {114,5668}, {59,5669}, {111,5671}, {116,5672}, {59,5673}, {80,5675}, {97,5676},
+    {114,5677}, {59,5678}, {117,5680}, {101,5681}, {115,5682}, {116,5683}, {59,5684}, {97,5686}, {100,5696}, {101,5700},
+    {108,5713}, {115,5718}, {112,5687}, {114,5693}, {112,5688}, {114,5689}, {111,5690}, {120,5691}, {59,5692}, {114,5694},
+    {59,5695}, {111,5697}, {116,5698}, {59,5699}, {113,5701}, {108,5702}, {113,5707}, {101,5703}, {115,5704}, {115,5705},
+    {59,5706}, {108,5708}, {101,5709}, {115,5710}, {115,5711}, {59,5712}, {101,5714}, {115,5715}, {115,5716}, {59,5717},
+    {105,5719}, {109,5720}, {59,5721}, {101,5723}, {110,5731}, {114,5724}, {116,5725}, {110,5726}, {101,5727}, {113,5728},
+    {113,5729}, {59,5730}, {69,5732}, {59,5733}, {65,5735}, {97,5739}, {98,5766}, {99,5770}, {101,5775}, {102,5795}, {107,5798},
+    {111,5812}, {115,5853}, {121,5867}, {114,5736}, {114,5737}, {59,5738}, {105,5740}, {108,5745}, {109,5748}, {114,5753},
+    {114,5741}, {115,5742}, {112,5743}, {59,5744}, {102,5746}, {59,5747}, {105,5749}, {108,5750}, {116,5751}, {59,5752},
+    {100,5754}, {114,5758}, {99,5755}, {121,5756}, {59,5757}, {59,5759}, {99,5760}, {119,5764}, {105,5761}, {114,5762},
+    {59,5763}, {59,5765}, {97,5767}, {114,5768}, {59,5769}, {105,5771}, {114,5772}, {99,5773}, {59,5774}, {97,5776}, {108,5785},
+    {114,5790}, {114,5777}, {116,5778}, {115,5779}, {59,5780}, {117,5781}, {105,5782}, {116,5783}, {59,5784}, {108,5786},
+    {105,5787}, {112,5788}, {59,5789}, {99,5791}, {111,5792}, {110,5793}, {59,5794}, {114,5796}, {59,5797}, {115,5799},
+    {101,5800}, {119,5806}, {97,5801}, {114,5802}, {111,5803}, {119,5804}, {59,5805}, {97,5807}, {114,5808}, {111,5809},
+    {119,5810}, {59,5811}, {97,5813}, {109,5817}, {111,5822}, {112,5845}, {114,5848}, {114,5814}, {114,5815}, {59,5816},
+    {116,5818}, {104,5819}, {116,5820}, {59,5821}, {107,5823}, {108,5824}, {114,5834}, {101,5825}, {102,5826}, {116,5827},
+    {97,5828}, {114,5829}, {114,5830}, {111,5831}, {119,5832}, {59,5833}, {105,5835}, {103,5836}, {104,5837}, {116,5838},
+    {97,5839}, {114,5840}, {114,5841}, {111,5842}, {119,5843}, {59,5844}, {102,5846}, {59,5847}, {98,5849}, {97,5850},
+    {114,5851}, {59,5852}, {99,5854}, {108,5857}, {116,5862}, {114,5855}, {59,5856}, {97,5858}, {115,5859}, {104,5860},
+    {59,5861}, {114,5863}, {111,5864}, {107,5865}, {59,5866}, {98,5868}, {112,5873}, {117,5869}, {108,5870}, {108,5871},
+    {59,5872}, {104,5874}, {101,5875}, {110,5876}, {59,5877}, {97,5879}, {99,5885}, {101,5893}, {102,5901}, {103,5906},
+    {105,5912}, {106,5931}, {109,5936}, {110,5964}, {111,6012}, {112,6026}, {113,6031}, {115,6037}, {116,6056}, {117,6063},
+    {99,5880}, {117,5881}, {116,5882}, {101,5883}, {59,5884}, {59,5886}, {105,5887}, {121,5891}, {114,5888}, {99,5889},
+    {59,5890}, {59,5892}, {99,5894}, {120,5897}, {121,5895}, {59,5896}, {99,5898}, {108,5899}, {59,5900}, {102,5902},
+    {114,5904}, {59,5903}, {59,5905}, {114,5907}, {97,5908}, {118,5909}, {101,5910}, {59,5911}, {59,5913}, {105,5914},
+    {110,5922}, {111,5927}, {105,5915}, {110,5919}, {110,5916}, {116,5917}, {59,5918}, {116,5920}, {59,5921}, {102,5923},
+    {105,5924}, {110,5925}, {59,5926}, {116,5928}, {97,5929}, {59,5930}, {108,5932}, {105,5933}, {103,5934}, {59,5935},
+    {97,5937}, {111,5957}, {112,5960}, {99,5938}, {103,5941}, {116,5954}, {114,5939}, {59,5940}, {101,5942}, {108,5944},
+    {112,5949}, {59,5943}, {105,5945}, {110,5946}, {101,5947}, {59,5948}, {97,5950}, {114,5951}, {116,5952}, {59,5953},
+    {104,5955}, {59,5956}, {102,5958}, {59,5959}, {101,5961}, {100,5962}, {59,5963}, {59,5965}, {99,5966}, {102,5971},
+    {111,5979}, {116,5984}, {97,5967}, {114,5968}, {101,5969}, {59,5970}, {105,5972}, {110,5973}, {59,5974}, {116,5975},
+    {105,5976}, {101,5977}, {59,5978}, {100,5980}, {111,5981}, {116,5982}, {59,5983}, {59,5985}, {99,5986}, {101,5990},
+    {108,6001}, {112,6007}, {97,5987}, {108,5988}, {59,5989}, {103,5991}, {114,5996}, {101,5992}, {114,5993}, {115,5994},
+    {59,5995}, {99,5997}, {97,5998}, {108,5999}, {59,6000}, {97,6002}, {114,6003}, {104,6004}, {107,6005}, {59,6006},
+    {114,6008}, {111,6009}, {100,6010}, {59,6011}, {99,6013}, {103,6016}, {112,6020}, {116,6023}, {121,6014}, {59,6015},
+    {111,6017}, {110,6018}, {59,6019}, {102,6021}, {59,6022}, {97,6024}, {59,6025}, {114,6027}, {111,6028}, {100,6029},
+    {59,6030}, {117,6032}, {101,6033}, {115,6034}, {116,6035}, {59,6036}, {99,6038}, {105,6041}, {114,6039}, {59,6040},
+    {110,6042}, {59,6043}, {69,6044}, {100,6046}, {115,6050}, {118,6054}, {59,6045}, {111,6047}, {116,6048}, {59,6049},
+    {59,6051}, {118,6052}, {59,6053}, {59,6055}, {59,6057}, {105,6058}, {108,6059}, {100,6060}, {101,6061}, {59,6062},
+    {107,6064}, {109,6068}, {99,6065}, {121,6066}, {59,6067}, {108,6069}, {59,6070}, {99,6072}, {102,6079}, {109,6082},
+    {111,6087}, {115,6091}, {117,6100}, {105,6073}, {121,6077}, {114,6074}, {99,6075}, {59,6076}, {59,6078}, {114,6080},
+    {59,6081}, {97,6083}, {116,6084}, {104,6085}, {59,6086}, {112,6088}, {102,6089}, {59,6090}, {99,6092}, {101,6095},
+    {114,6093}, {59,6094}, {114,6096}, {99,6097}, {121,6098}, {59,6099}, {107,6101}, {99,6102}, {121,6103}, {59,6104},
+    {97,6106}, {99,6113}, {102,6121}, {103,6124}, {104,6130}, {106,6134}, {111,6138}, {115,6142}, {112,6107}, {112,6108},
+    {97,6109}, {59,6110}, {118,6111}, {59,6112}, {101,6114}, {121,6119}, {100,6115}, {105,6116}, {108,6117}, {59,6118},
+    {59,6120}, {114,6122}, {59,6123}, {114,6125}, {101,6126}, {101,6127}, {110,6128}, {59,6129}, {99,6131}, {121,6132},
+    {59,6133}, {99,6135}, {121,6136}, {59,6137}, {112,6139}, {102,6140}, {59,6141}, {99,6143}, {114,6144}, {59,6145},
+    {65,6147}, {66,6160}, {69,6165}, {72,6169}, {97,6173}, {98,6247}, {99,6272}, {100,6291}, {101,6316}, {102,6462}, {103,6475},
+    {104,6479}, {106,6492}, {108,6496}, {109,6518}, {110,6534}, {111,6555}, {112,6660}, {114,6667}, {115,6691}, {116,6722},
+    {117,6766}, {118,6779}, {97,6148}, {114,6152}, {116,6155}, {114,6149}, {114,6150}, {59,6151}, {114,6153}, {59,6154},
+    {97,6156}, {105,6157}, {108,6158}, {59,6159}, {97,6161}, {114,6162}, {114,6163}, {59,6164}, {59,6166}, {103,6167},
+    {59,6168}, {97,6170}, {114,6171}, {59,6172}, {99,6174}, {101,6179}, {103,6186}, {109,6191}, {110,6196}, {112,6204},
+    {113,6206}, {114,6210}, {116,6237}, {117,6175}, {116,6176}, {101,6177}, {59,6178}, {109,6180}, {112,6181}, {116,6182},
+    {121,6183}, {118,6184}, {59,6185}, {114,6187}, {97,6188}, {110,6189}, {59,6190}, {98,6192}, {100,6193}, {97,6194},
+    {59,6195}, {103,6197}, {59,6198}, {100,6199}, {108,6201}, {59,6200}, {101,6202}, {59,6203}, {59,6205}, {117,6207},
+    {111,6208}, {59,6209}, {114,6211}, {59,6212}, {98,6213}, {102,6218}, {104,6221}, {108,6224}, {112,6227}, {115,6230},
+    {116,6234}, {59,6214}, {102,6215}, {115,6216}, {59,6217}, {115,6219}, {59,6220}, {107,6222}, {59,6223}, {112,6225},
+    {59,6226}, {108,6228}, {59,6229}, {105,6231}, {109,6232}, {59,6233}, {108,6235}, {59,6236}, {59,6238}, {97,6239},
+    {101,6243}, {105,6240}, {108,6241}, {59,6242}, {59,6244}, {115,6245}, {59,6246}, {97,6248}, {98,6252}, {114,6256},
+    {114,6249}, {114,6250}, {59,6251}, {114,6253}, {107,6254}, {59,6255}, {97,6257}, {107,6263}, {99,6258}, {101,6259},
+    {107,6261}, {59,6260}, {59,6262}, {101,6264}, {115,6266}, {59,6265}, {108,6267}, {100,6268}, {117,6270}, {59,6269},
+    {59,6271}, {97,6273}, {101,6278}, {117,6286}, {121,6289}, {114,6274}, {111,6275}, {110,6276}, {59,6277}, {100,6279},
+    {105,6283}, {105,6280}, {108,6281}, {59,6282}, {108,6284}, {59,6285}, {98,6287}, {59,6288}, {59,6290}, {99,6292},
+    {113,6295}, {114,6301}, {115,6313}, {97,6293}, {59,6294}, {117,6296}, {111,6297}, {59,6298}, {114,6299}, {59,6300},
+    {100,6302}, {117,6307}, {104,6303}, {97,6304}, {114,6305}, {59,6306}, {115,6308}, {104,6309}, {97,6310}, {114,6311},
+    {59,6312}, {104,6314}, {59,6315}, {59,6317}, {102,6318}, {103,6401}, {113,6403}, {115,6413}, {116,6319}, {97,6320},
+    {104,6331}, {108,6346}, {114,6357}, {116,6390}, {114,6321}, {114,6322}, {111,6323}, {119,6324}, {59,6325}, {116,6326},
+    {97,6327}, {105,6328}, {108,6329}, {59,6330}, {97,6332}, {114,6333}, {112,6334}, {111,6335}, {111,6336}, {110,6337},
+    {100,6338}, {117,6343}, {111,6339}, {119,6340}, {110,6341}, {59,6342}, {112,6344}, {59,6345}, {101,6347}, {102,6348},
+    {116,6349}, {97,6350}, {114,6351}, {114,6352}, {111,6353}, {119,6354}, {115,6355}, {59,6356}, {105,6358}, {103,6359},
+    {104,6360}, {116,6361}, {97,6362}, {104,6370}, {115,6379}, {114,6363}, {114,6364}, {111,6365}, {119,6366}, {59,6367},
+    {115,6368}, {59,6369}, {97,6371}, {114,6372}, {112,6373}, {111,6374}, {111,6375}, {110,6376}, {115,6377}, {59,6378},
+    {113,6380}, {117,6381}, {105,6382}, {103,6383}, {97,6384}, {114,6385}, {114,6386}, {111,6387}, {119,6388}, {59,6389},
+    {104,6391}, {114,6392}, {101,6393}, {101,6394}, {116,6395}, {105,6396}, {109,6397}, {101,6398}, {115,6399}, {59,6400},
+    {59,6402}, {59,6404}, {113,6405}, {115,6407}, {59,6406}, {108,6408}, {97,6409}, {110,6410}, {116,6411}, {59,6412},
+    {59,6414}, {99,6415}, {100,6418}, {103,6426}, {115,6431}, {99,6416}, {59,6417}, {111,6419}, {116,6420}, {59,6421},
+    {111,6422}, {59,6423}, {114,6424}, {59,6425}, {59,6427}, {101,6428}, {115,6429}, {59,6430}, {97,6432}, {100,6439},
+    {101,6443}, {103,6454}, {115,6458}, {112,6433}, {112,6434}, {114,6435}, {111,6436}, {120,6437}, {59,6438}, {111,6440},
+    {116,6441}, {59,6442}, {113,6444}, {103,6445}, {113,6449}, {116,6446}, {114,6447}, {59,6448}, {103,6450}, {116,6451},
+    {114,6452}, {59,6453}, {116,6455}, {114,6456}, {59,6457}, {105,6459}, {109,6460}, {59,6461}, {105,6463}, {108,6468},
+    {114,6473}, {115,6464}, {104,6465}, {116,6466}, {59,6467}, {111,6469}, {111,6470}, {114,6471}, {59,6472}, {59,6474},
+    {59,6476}, {69,6477}, {59,6478}, {97,6480}, {98,6488}, {114,6481}, {100,6482}, {117,6484}, {59,6483}, {59,6485}, {108,6486},
+    {59,6487}, {108,6489}, {107,6490}, {59,6491}, {99,6493}, {121,6494}, {59,6495}, {59,6497}, {97,6498}, {99,6502}, {104,6509},
+    {116,6514}, {114,6499}, {114,6500}, {59,6501}, {111,6503}, {114,6504}, {110,6505}, {101,6506}, {114,6507}, {59,6508},
+    {97,6510}, {114,6511}, {100,6512}, {59,6513}, {114,6515}, {105,6516}, {59,6517}, {105,6519}, {111,6524}, {100,6520},
+    {111,6521}, {116,6522}, {59,6523}, {117,6525}, {115,6526}, {116,6527}, {59,6528}, {97,6529}, {99,6530}, {104,6531},
+    {101,6532}, {59,6533}, {69,6535}, {97,6537}, {101,6545}, {115,6551}, {59,6536}, {112,6538}, {59,6539}, {112,6540},
+    {114,6541}, {111,6542}, {120,6543}, {59,6544}, {59,6546}, {113,6547}, {59,6548}, {113,6549}, {59,6550}, {105,6552},
+    {109,6553}, {59,6554}, {97,6556}, {98,6563}, {110,6567}, {111,6608}, {112,6626}, {116,6636}, {119,6642}, {122,6651},
+    {110,6557}, {114,6560}, {103,6558}, {59,6559}, {114,6561}, {59,6562}, {114,6564}, {107,6565}, {59,6566}, {103,6568},
+    {108,6569}, {109,6590}, {114,6597}, {101,6570}, {102,6571}, {116,6572}, {97,6573}, {114,6579}, {114,6574}, {114,6575},
+    {111,6576}, {119,6577}, {59,6578}, {105,6580}, {103,6581}, {104,6582}, {116,6583}, {97,6584}, {114,6585}, {114,6586},
+    {111,6587}, {119,6588}, {59,6589}, {97,6591}, {112,6592}, {115,6593}, {116,6594}, {111,6595}, {59,6596}, {105,6598},
+    {103,6599}, {104,6600}, {116,6601}, {97,6602}, {114,6603}, {114,6604}, {111,6605}, {119,6606}, {59,6607}, {112,6609},
+    {97,6610}, {114,6611}, {114,6612}, {111,6613}, {119,6614}, {108,6615}, {114,6620}, {101,6616}, {102,6617}, {116,6618},
+    {59,6619}, {105,6621}, {103,6622}, {104,6623}, {116,6624}, {59,6625}, {97,6627}, {102,6630}, {108,6632}, {114,6628},
+    {59,6629}, {59,6631}, {117,6633}, {115,6634}, {59,6635}, {105,6637}, {109,6638}, {101,6639}, {115,6640}, {59,6641},
+    {97,6643}, {98,6647}, {115,6644}, {116,6645}, {59,6646}, {97,6648}, {114,6649}, {59,6650}, {59,6652}, {101,6653},
+    {102,6658}, {110,6654}, {103,6655}, {101,6656}, {59,6657}, {59,6659}, {97,6661}, {114,6662}, {59,6663}, {108,6664},
+    {116,6665}, {59,6666}, {97,6668}, {99,6672}, {104,6679}, {109,6685}, {116,6687}, {114,6669}, {114,6670}, {59,6671},
+    {111,6673}, {114,6674}, {110,6675}, {101,6676}, {114,6677}, {59,6678}, {97,6680}, {114,6681}, {59,6682}, {100,6683},
+    {59,6684}, {59,6686}, {114,6688}, {105,6689}, {59,6690}, {97,6692}, {99,6697}, {104,6700}, {105,6702}, {113,6709},
+    {116,6717}, {113,6693}, {117,6694}, {111,6695}, {59,6696}, {114,6698}, {59,6699}, {59,6701}, {109,6703}, {59,6704},
+    {101,6705}, {103,6707}, {59,6706}, {59,6708}, {98,6710}, {117,6712}, {59,6711}, {111,6713}, {59,6714}, {114,6715},
+    {59,6716}, {114,6718}, {111,6719}, {107,6720}, {59,6721}, {59,6723}, {99,6724}, {100,6730}, {104,6734}, {105,6739},
+    {108,6744}, {113,6749}, {114,6755}, {99,6725}, {105,6727}, {59,6726}, {114,6728}, {59,6729}, {111,6731}, {116,6732},
+    {59,6733}, {114,6735}, {101,6736}, {101,6737}, {59,6738}, {109,6740}, {101,6741}, {115,6742}, {59,6743}, {97,6745},
+    {114,6746}, {114,6747}, {59,6748}, {117,6750}, {101,6751}, {115,6752}, {116,6753}, {59,6754}, {80,6756}, {105,6760},
+    {97,6757}, {114,6758}, {59,6759}, {59,6761}, {101,6762}, {102,6764}, {59,6763}, {59,6765}, {114,6767}, {100,6768},
+    {117,6774}, {115,6769}, {104,6770}, {97,6771}, {114,6772}, {59,6773}, {104,6775}, {97,6776}, {114,6777}, {59,6778},
+    {101,6780}, {110,6788}, {114,6781}, {116,6782}, {110,6783}, {101,6784}, {113,6785}, {113,6786}, {59,6787}, {69,6789},
+    {59,6790}, {68,6792}, {97,6797}, {99,6834}, {100,6842}, {101,6847}, {102,6860}, {104,6863}, {105,6866}, {108,6895},
+    {110,6902}, {111,6908}, {112,6917}, {115,6919}, {117,6928}, {68,6793}, {111,6794}, {116,6795}, {59,6796}, {99,6798},
+    {108,6801}, {112,6810}, {114,6829}, {114,6799}, {59,6800}, {101,6802}, {116,6804}, {59,6803}, {59,6805}, {101,6806},
+    {115,6807}, {101,6808}, {59,6809}, {59,6811}, {115,6812}, {116,6813}, {111,6814}, {59,6815}, {100,6816}, {108,6821},
+    {117,6826}, {111,6817}, {119,6818}, {110,6819}, {59,6820}, {101,6822}, {102,6823}, {116,6824}, {59,6825}, {112,6827},
+    {59,6828}, {107,6830}, {101,6831}, {114,6832}, {59,6833}, {111,6835}, {121,6840}, {109,6836}, {109,6837}, {97,6838},
+    {59,6839}, {59,6841}, {97,6843}, {115,6844}, {104,6845}, {59,6846}, {97,6848}, {115,6849}, {117,6850}, {114,6851},
+    {101,6852}, {100,6853}, {97,6854}, {110,6855}, {103,6856}, {108,6857}, {101,6858}, {59,6859}, {114,6861}, {59,6862},
+    {111,6864}, {59,6865}, {99,6867}, {100,6871}, {110,6885}, {114,6868}, {111,6869}, {59,6870}, {59,6872}, {97,6873},
+    {99,6877}, {100,6881}, {115,6874}, {116,6875}, {59,6876}, {105,6878}, {114,6879}, {59,6880}, {111,6882}, {116,6883},
+    {59,6884}, {117,6886}, {115,6887}, {59,6888}, {98,6889}, {100,6891}, {59,6890}, {59,6892}, {117,6893}, {59,6894},
+    {99,6896}, {100,6899}, {112,6897}, {59,6898}, {114,6900}, {59,6901}, {112,6903}, {108,6904}, {117,6905}, {115,6906},
+    {59,6907}, {100,6909}, {112,6914}, {101,6910}, {108,6911}, {115,6912}, {59,6913}, {102,6915}, {59,6916}, {59,6918},
+    {99,6920}, {116,6923}, {114,6921}, {59,6922}, {112,6924}, {111,6925}, {115,6926}, {59,6927}, {59,6929}, {108,6930},
+    {109,6937}, {116,6931}, {105,6932}, {109,6933}, {97,6934}, {112,6935}, {59,6936}, {97,6938}, {112,6939}, {59,6940},
+    {71,6942}, {76,6949}, {82,6976}, {86,6987}, {97,6998}, {98,7035}, {99,7045}, {100,7071}, {101,7076}, {102,7116}, {103,7119},
+    {104,7144}, {105,7157}, {106,7165}, {108,7169}, {109,7229}, {111,7233}, {112,7265}, {114,7299}, {115,7328}, {116,7417},
+    {117,7453}, {118,7464}, {119,7521}, {103,6943}, {116,6945}, {59,6944}, {59,6946}, {118,6947}, {59,6948}, {101,6950},
+    {108,6970}, {116,6972}, {102,6951}, {116,6952}, {97,6953}, {114,6959}, {114,6954}, {114,6955}, {111,6956}, {119,6957},
+    {59,6958}, {105,6960}, {103,6961}, {104,6962}, {116,6963}, {97,6964}, {114,6965}, {114,6966}, {111,6967}, {119,6968},
+    {59,6969}, {59,6971}, {59,6973}, {118,6974}, {59,6975}, {105,6977}, {103,6978}, {104,6979}, {116,6980}, {97,6981},
+    {114,6982}, {114,6983}, {111,6984}, {119,6985}, {59,6986}, {68,6988}, {100,6993}, {97,6989}, {115,6990}, {104,6991},
+    {59,6992}, {97,6994}, {115,6995}, {104,6996}, {59,6997}, {98,6999}, {99,7003}, {110,7008}, {112,7011}, {116,7026},
+    {108,7000}, {97,7001}, {59,7002}, {117,7004}, {116,7005}, {101,7006}, {59,7007}, {103,7009}, {59,7010}, {59,7012},
+    {69,7013}, {105,7015}, {111,7018}, {112,7021}, {59,7014}, {100,7016}, {59,7017}, {115,7019}, {59,7020}, {114,7022},
+    {111,7023}, {120,7024}, {59,7025}, {117,7027}, {114,7028}, {59,7029}, {97,7030}, {108,7031}, {59,7032}, {115,7033},
+    {59,7034}, {115,7036}, {117,7039}, {112,7037}, {59,7038}, {109,7040}, {112,7041}, {59,7042}, {101,7043}, {59,7044},
+    {97,7046}, {101,7053}, {111,7058}, {117,7066}, {121,7069}, {112,7047}, {114,7049}, {59,7048}, {111,7050}, {110,7051},
+    {59,7052}, {100,7054}, {105,7055}, {108,7056}, {59,7057}, {110,7059}, {103,7060}, {59,7061}, {100,7062}, {111,7063},
+    {116,7064}, {59,7065}, {112,7067}, {59,7068}, {59,7070}, {97,7072}, {115,7073}, {104,7074}, {59,7075}, {59,7077},
+    {65,7078}, {97,7082}, {100,7092}, {113,7096}, {115,7101}, {120,7109}, {114,7079}, {114,7080}, {59,7081}, {114,7083},
+    {104,7084}, {114,7087}, {107,7085}, {59,7086}, {59,7088}, {111,7089}, {119,7090}, {59,7091}, {111,7093}, {116,7094},
+    {59,7095}, {117,7097}, {105,7098}, {118,7099}, {59,7100}, {101,7102}, {105,7106}, {97,7103}, {114,7104}, {59,7105},
+    {109,7107}, {59,7108}, {105,7110}, {115,7111}, {116,7112}, {59,7113}, {115,7114}, {59,7115}, {114,7117}, {59,7118},
+    {69,7120}, {101,7122}, {115,7136}, {116,7140}, {59,7121}, {59,7123}, {113,7124}, {115,7134}, {59,7125}, {113,7126},
+    {115,7128}, {59,7127}, {108,7129}, {97,7130}, {110,7131}, {116,7132}, {59,7133}, {59,7135}, {105,7137}, {109,7138},
+    {59,7139}, {59,7141}, {114,7142}, {59,7143}, {65,7145}, {97,7149}, {112,7153}, {114,7146}, {114,7147}, {59,7148},
+    {114,7150}, {114,7151}, {59,7152}, {97,7154}, {114,7155}, {59,7156}, {59,7158}, {115,7159}, {118,7163}, {59,7160},
+    {100,7161}, {59,7162}, {59,7164}, {99,7166}, {121,7167}, {59,7168}, {65,7170}, {69,7174}, {97,7176}, {100,7180}, {101,7183},
+    {115,7218}, {116,7222}, {114,7171}, {114,7172}, {59,7173}, {59,7175}, {114,7177}, {114,7178}, {59,7179}, {114,7181},
+    {59,7182}, {59,7184}, {102,7185}, {113,7204}, {115,7214}, {116,7186}, {97,7187}, {114,7193}, {114,7188}, {114,7189},
+    {111,7190}, {119,7191}, {59,7192}, {105,7194}, {103,7195}, {104,7196}, {116,7197}, {97,7198}, {114,7199}, {114,7200},
+    {111,7201}, {119,7202}, {59,7203}, {59,7205}, {113,7206}, {115,7208}, {59,7207}, {108,7209}, {97,7210}, {110,7211},
+    {116,7212}, {59,7213}, {59,7215}, {115,7216}, {59,7217}, {105,7219}, {109,7220}, {59,7221}, {59,7223}, {114,7224},
+    {105,7225}, {59,7226}, {101,7227}, {59,7228}, {105,7230}, {100,7231}, {59,7232}, {112,7234}, {116,7237}, {102,7235},
+    {59,7236}, {59,7238}, {105,7239}, {110,7255}, {110,7240}, {59,7241}, {69,7242}, {100,7244}, {118,7248}, {59,7243},
+    {111,7245}, {116,7246}, {59,7247}, {97,7249}, {98,7251}, {99,7253}, {59,7250}, {59,7252}, {59,7254}, {105,7256}, {59,7257},
+    {118,7258}, {97,7259}, {98,7261}, {99,7263}, {59,7260}, {59,7262}, {59,7264}, {97,7266}, {111,7280}, {114,7286}, {114,7267},
+    {59,7268}, {97,7269}, {115,7275}, {116,7278}, {108,7270}, {108,7271}, {101,7272}, {108,7273}, {59,7274}, {108,7276},
+    {59,7277}, {59,7279}, {108,7281}, {105,7282}, {110,7283}, {116,7284}, {59,7285}, {59,7287}, {99,7288}, {101,7292},
+    {117,7289}, {101,7290}, {59,7291}, {59,7293}, {99,7294}, {59,7295}, {101,7296}, {113,7297}, {59,7298}, {65,7300},
+    {97,7304}, {105,7312}, {116,7322}, {114,7301}, {114,7302}, {59,7303}, {114,7305}, {114,7306}, {59,7307}, {99,7308},
+    {119,7310}, {59,7309}, {59,7311}, {103,7313}, {104,7314}, {116,7315}, {97,7316}, {114,7317}, {114,7318}, {111,7319},
+    {119,7320}, {59,7321}, {114,7323}, {105,7324}, {59,7325}, {101,7326}, {59,7327}, {99,7329}, {104,7339}, {105,7356},
+    {109,7363}, {112,7367}, {113,7371}, {117,7380}, {59,7330}, {99,7331}, {101,7335}, {114,7337}, {117,7332}, {101,7333},
+    {59,7334}, {59,7336}, {59,7338}, {111,7340}, {114,7341}, {116,7342}, {109,7343}, {112,7347}, {105,7344}, {100,7345},
+    {59,7346}, {97,7348}, {114,7349}, {97,7350}, {108,7351}, {108,7352}, {101,7353}, {108,7354}, {59,7355}, {109,7357},
+    {59,7358}, {101,7359}, {59,7360}, {113,7361}, {59,7362}, {105,7364}, {100,7365}, {59,7366}, {97,7368}, {114,7369},
+    {59,7370}, {115,7372}, {117,7373}, {98,7374}, {112,7377}, {101,7375}, {59,7376}, {101,7378}, {59,7379}, {98,7381},
+    {99,7396}, {112,7402}, {59,7382}, {69,7383}, {101,7385}, {115,7387}, {59,7384}, {59,7386}, {101,7388}, {116,7389},
+    {59,7390}, {101,7391}, {113,7392}, {59,7393}, {113,7394}, {59,7395}, {99,7397}, {59,7398}, {101,7399}, {113,7400},
+    {59,7401}, {59,7403}, {69,7404}, {101,7406}, {115,7408}, {59,7405}, {59,7407}, {101,7409}, {116,7410}, {59,7411},
+    {101,7412}, {113,7413}, {59,7414}, {113,7415}, {59,7416}, {103,7418}, {105,7421}, {108,7426}, {114,7429}, {108,7419},
+    {59,7420}, {108,7422}, {100,7423}, {101,7424}, {59,7425}, {103,7427}, {59,7428}, {105,7430}, {97,7431}, {110,7432},
+    {103,7433}, {108,7434}, {101,7435}, {108,7436}, {114,7444}, {101,7437}, {102,7438}, {116,7439}, {59,7440}, {101,7441},
+    {113,7442}, {59,7443}, {105,7445}, {103,7446}, {104,7447}, {116,7448}, {59,7449}, {101,7450}, {113,7451}, {59,7452},
+    {59,7454}, {109,7455}, {59,7456}, {101,7457}, {115,7461}, {114,7458}, {111,7459}, {59,7460}, {112,7462}, {59,7463},
+    {68,7465}, {72,7470}, {97,7475}, {100,7478}, {103,7483}, {105,7488}, {108,7494}, {114,7507}, {115,7517}, {97,7466},
+    {115,7467}, {104,7468}, {59,7469}, {97,7471}, {114,7472}, {114,7473}, {59,7474}, {112,7476}, {59,7477}, {97,7479},
+    {115,7480}, {104,7481}, {59,7482}, {101,7484}, {116,7486}, {59,7485}, {59,7487}, {110,7489}, {102,7490}, {105,7491},
+    {110,7492}, {59,7493}, {65,7495}, {101,7499}, {116,7501}, {114,7496}, {114,7497}, {59,7498}, {59,7500}, {59,7502},
+    {114,7503}, {105,7504}, {101,7505}, {59,7506}, {65,7508}, {116,7512}, {114,7509}, {114,7510}, {59,7511}, {114,7513},
+    {105,7514}, {101,7515}, {59,7516}, {105,7518}, {109,7519}, {59,7520}, {65,7522}, {97,7526}, {110,7536}, {114,7523},
+    {114,7524}, {59,7525}, {114,7527}, {104,7528}, {114,7531}, {107,7529}, {59,7530}, {59,7532}, {111,7533}, {119,7534},
+    {59,7535}, {101,7537}, {97,7538}, {114,7539}, {59,7540}, {83,7542}, {97,7544}, {99,7553}, {100,7561}, {101,7582},
+    {102,7587}, {103,7594}, {104,7605}, {105,7612}, {108,7616}, {109,7636}, {111,7657}, {112,7661}, {114,7673}, {115,7707},
+    {116,7719}, {117,7732}, {118,7736}, {59,7543}, {99,7545}, {115,7550}, {117,7546}, {116,7547}, {101,7548}, {59,7549},
+    {116,7551}, {59,7552}, {105,7554}, {121,7559}, {114,7555}, {59,7556}, {99,7557}, {59,7558}, {59,7560}, {97,7562},
+    {98,7566}, {105,7571}, {111,7574}, {115,7577}, {115,7563}, {104,7564}, {59,7565}, {108,7567}, {97,7568}, {99,7569},
+    {59,7570}, {118,7572}, {59,7573}, {116,7575}, {59,7576}, {111,7578}, {108,7579}, {100,7580}, {59,7581}, {108,7583},
+    {105,7584}, {103,7585}, {59,7586}, {99,7588}, {114,7592}, {105,7589}, {114,7590}, {59,7591}, {59,7593}, {111,7595},
+    {114,7598}, {116,7603}, {110,7596}, {59,7597}, {97,7599}, {118,7600}, {101,7601}, {59,7602}, {59,7604}, {98,7606},
+    {109,7610}, {97,7607}, {114,7608}, {59,7609}, {59,7611}, {110,7613}, {116,7614}, {59,7615}, {97,7617}, {99,7621},
+    {105,7630}, {116,7634}, {114,7618}, {114,7619}, {59,7620}, {105,7622}, {114,7625}, {114,7623}, {59,7624}, {111,7626},
+    {115,7627}, {115,7628}, {59,7629}, {110,7631}, {101,7632}, {59,7633}, {59,7635}, {97,7637}, {101,7641}, {105,7645},
+    {99,7638}, {114,7639}, {59,7640}, {103,7642}, {97,7643}, {59,7644}, {99,7646}, {100,7651}, {110,7653}, {114,7647},
+    {111,7648}, {110,7649}, {59,7650}, {59,7652}, {117,7654}, {115,7655}, {59,7656}, {112,7658}, {102,7659}, {59,7660},
+    {97,7662}, {101,7665}, {108,7669}, {114,7663}, {59,7664}, {114,7666}, {112,7667}, {59,7668}, {117,7670}, {115,7671},
+    {59,7672}, {59,7674}, {97,7675}, {100,7679}, {105,7691}, {111,7696}, {115,7699}, {118,7705}, {114,7676}, {114,7677},
+    {59,7678}, {59,7680}, {101,7681}, {102,7687}, {109,7689}, {114,7682}, {59,7683}, {111,7684}, {102,7685}, {59,7686},
+    {59,7688}, {59,7690}, {103,7692}, {111,7693}, {102,7694}, {59,7695}, {114,7697}, {59,7698}, {108,7700}, {111,7701},
+    {112,7702}, {101,7703}, {59,7704}, {59,7706}, {99,7708}, {108,7711}, {111,7716}, {114,7709}, {59,7710}, {97,7712},
+    {115,7713}, {104,7714}, {59,7715}, {108,7717}, {59,7718}, {105,7720}, {108,7721}, {109,7725}, {100,7722}, {101,7723},
+    {59,7724}, {101,7726}, {115,7727}, {59,7728}, {97,7729}, {115,7730}, {59,7731}, {109,7733}, {108,7734}, {59,7735},
+    {98,7737}, {97,7738}, {114,7739}, {59,7740}, {97,7742}, {99,7760}, {101,7763}, {102,7784}, {104,7787}, {105,7801},
+    {108,7813}, {109,7856}, {111,7858}, {114,7873}, {115,7975}, {117,7981}, {114,7743}, {59,7744}, {97,7745}, {115,7752},
+    {116,7758}, {59,7746}, {108,7747}, {108,7748}, {101,7749}, {108,7750}, {59,7751}, {105,7753}, {108,7756}, {109,7754},
+    {59,7755}, {59,7757}, {59,7759}, {121,7761}, {59,7762}, {114,7764}, {99,7765}, {105,7769}, {109,7773}, {112,7777},
+    {116,7779}, {110,7766}, {116,7767}, {59,7768}, {111,7770}, {100,7771}, {59,7772}, {105,7774}, {108,7775}, {59,7776},
+    {59,7778}, {101,7780}, {110,7781}, {107,7782}, {59,7783}, {114,7785}, {59,7786}, {105,7788}, {109,7792}, {111,7797},
+    {59,7789}, {118,7790}, {59,7791}, {109,7793}, {97,7794}, {116,7795}, {59,7796}, {110,7798}, {101,7799}, {59,7800},
+    {59,7802}, {116,7803}, {118,7811}, {99,7804}, {104,7805}, {102,7806}, {111,7807}, {114,7808}, {107,7809}, {59,7810},
+    {59,7812}, {97,7814}, {117,7824}, {110,7815}, {99,7816}, {107,7821}, {107,7817}, {59,7818}, {104,7819}, {59,7820},
+    {118,7822}, {59,7823}, {115,7825}, {59,7826}, {97,7827}, {98,7832}, {99,7834}, {100,7838}, {101,7843}, {109,7845},
+    {115,7848}, {116,7852}, {99,7828}, {105,7829}, {114,7830}, {59,7831}, {59,7833}, {105,7835}, {114,7836}, {59,7837},
+    {111,7839}, {117,7841}, {59,7840}, {59,7842}, {59,7844}, {110,7846}, {59,7847}, {105,7849}, {109,7850}, {59,7851},
+    {119,7853}, {111,7854}, {59,7855}, {59,7857}, {105,7859}, {112,7866}, {117,7869}, {110,7860}, {116,7861}, {105,7862},
+    {110,7863}, {116,7864}, {59,7865}, {102,7867}, {59,7868}, {110,7870}, {100,7871}, {59,7872}, {59,7874}, {69,7875},
+    {97,7877}, {99,7880}, {101,7884}, {105,7926}, {110,7932}, {111,7942}, {115,7966}, {117,7970}, {59,7876}, {112,7878},
+    {59,7879}, {117,7881}, {101,7882}, {59,7883}, {59,7885}, {99,7886}, {59,7887}, {97,7888}, {99,7895}, {101,7903}, {110,7906},
+    {115,7922}, {112,7889}, {112,7890}, {114,7891}, {111,7892}, {120,7893}, {59,7894}, {117,7896}, {114,7897}, {108,7898},
+    {121,7899}, {101,7900}, {113,7901}, {59,7902}, {113,7904}, {59,7905}, {97,7907}, {101,7914}, {115,7918}, {112,7908},
+    {112,7909}, {114,7910}, {111,7911}, {120,7912}, {59,7913}, {113,7915}, {113,7916}, {59,7917}, {105,7919}, {109,7920},
+    {59,7921}, {105,7923}, {109,7924}, {59,7925}, {109,7927}, {101,7928}, {59,7929}, {115,7930}, {59,7931}, {69,7933},
+    {97,7935}, {115,7938}, {59,7934}, {112,7936}, {59,7937}, {105,7939}, {109,7940}, {59,7941}, {100,7943}, {102,7945},
+    {112,7961}, {59,7944}, {97,7946}, {108,7951}, {115,7956}, {108,7947}, {97,7948}, {114,7949}, {59,7950}, {105,7952},
+    {110,7953}, {101,7954}, {59,7955}, {117,7957}, {114,7958}, {102,7959}, {59,7960}, {59,7962}, {116,7963}, {111,7964},
+    {59,7965}, {105,7967}, {109,7968}, {59,7969}, {114,7971}, {101,7972}, {108,7973}, {59,7974}, {99,7976}, {105,7979},
+    {114,7977}, {59,7978}, {59,7980}, {110,7982}, {99,7983}, {115,7984}, {112,7985}, {59,7986}, {102,7988}, {105,7991},
+    {111,7995}, {112,7999}, {115,8005}, {117,8009}, {114,7989}, {59,7990}, {110,7992}, {116,7993}, {59,7994}, {112,7996},
+    {102,7997}, {59,7998}, {114,8000}, {105,8001}, {109,8002}, {101,8003}, {59,8004}, {99,8006}, {114,8007}, {59,8008},
+    {97,8010}, {101,8024}, {111,8031}, {116,8011}, {101,8012}, {105,8020}, {114,8013}, {110,8014}, {105,8015}, {111,8016},
+    {110,8017}, {115,8018}, {59,8019}, {110,8021}, {116,8022}, {59,8023}, {115,8025}, {116,8026}, {59,8027}, {101,8028},
+    {113,8029}, {59,8030}, {116,8032}, {59,8033}, {65,8035}, {66,8048}, {72,8053}, {97,8057}, {98,8137}, {99,8162}, {100,8181},
+    {101,8200}, {102,8220}, {104,8233}, {105,8246}, {108,8344}, {109,8355}, {110,8366}, {111,8371}, {112,8399}, {114,8413},
+    {115,8418}, {116,8437}, {117,8460}, {120,8467}, {97,8036}, {114,8040}, {116,8043}, {114,8037}, {114,8038}, {59,8039},
+    {114,8041}, {59,8042}, {97,8044}, {105,8045}, {108,8046}, {59,8047}, {97,8049}, {114,8050}, {114,8051}, {59,8052},
+    {97,8054}, {114,8055}, {59,8056}, {99,8058}, {100,8065}, {101,8069}, {110,8076}, {113,8086}, {114,8090}, {116,8124},
+    {101,8059}, {117,8061}, {59,8060}, {116,8062}, {101,8063}, {59,8064}, {105,8066}, {99,8067}, {59,8068}, {109,8070},
+    {112,8071}, {116,8072}, {121,8073}, {118,8074}, {59,8075}, {103,8077}, {59,8078}, {100,8079}, {101,8081}, {108,8083},
+    {59,8080}, {59,8082}, {101,8084}, {59,8085}, {117,8087}, {111,8088}, {59,8089}, {114,8091}, {59,8092}, {97,8093},
+    {98,8096}, {99,8101}, {102,8103}, {104,8106}, {108,8109}, {112,8112}, {115,8115}, {116,8119}, {119,8122}, {112,8094},
+    {59,8095}, {59,8097}, {102,8098}, {115,8099}, {59,8100}, {59,8102}, {115,8104}, {59,8105}, {107,8107}, {59,8108},
+    {112,8110}, {59,8111}, {108,8113}, {59,8114}, {105,8116}, {109,8117}, {59,8118}, {108,8120}, {59,8121}, {59,8123},
+    {97,8125}, {105,8129}, {105,8126}, {108,8127}, {59,8128}, {111,8130}, {59,8131}, {110,8132}, {97,8133}, {108,8134},
+    {115,8135}, {59,8136}, {97,8138}, {98,8142}, {114,8146}, {114,8139}, {114,8140}, {59,8141}, {114,8143}, {107,8144},
+    {59,8145}, {97,8147}, {107,8153}, {99,8148}, {101,8149}, {107,8151}, {59,8150}, {59,8152}, {101,8154}, {115,8156},
+    {59,8155}, {108,8157}, {100,8158}, {117,8160}, {59,8159}, {59,8161}, {97,8163}, {101,8168}, {117,8176}, {121,8179},
+    {114,8164}, {111,8165}, {110,8166}, {59,8167}, {100,8169}, {105,8173}, {105,8170}, {108,8171}, {59,8172}, {108,8174},
+    {59,8175}, {98,8177}, {59,8178}, {59,8180}, {99,8182}, {108,8185}, {113,8191}, {115,8197}, {97,8183}, {59,8184}, {100,8186},
+    {104,8187}, {97,8188}, {114,8189}, {59,8190}, {117,8192}, {111,8193}, {59,8194}, {114,8195}, {59,8196}, {104,8198},
+    {59,8199}, {97,8201}, {99,8215}, {103,8218}, {108,8202}, {59,8203}, {105,8204}, {112,8208}, {115,8213}, {110,8205},
+    {101,8206}, {59,8207}, {97,8209}, {114,8210}, {116,8211}, {59,8212}, {59,8214}, {116,8216}, {59,8217}, {59,8219},
+    {105,8221}, {108,8226}, {114,8231}, {115,8222}, {104,8223}, {116,8224}, {59,8225}, {111,8227}, {111,8228}, {114,8229},
+    {59,8230}, {59,8232}, {97,8234}, {111,8242}, {114,8235}, {100,8236}, {117,8238}, {59,8237}, {59,8239}, {108,8240},
+    {59,8241}, {59,8243}, {118,8244}, {59,8245}, {103,8247}, {110,8330}, {115,8333}, {104,8248}, {116,8249}, {97,8250},
+    {104,8261}, {108,8276}, {114,8296}, {115,8308}, {116,8319}, {114,8251}, {114,8252}, {111,8253}, {119,8254}, {59,8255},
+    {116,8256}, {97,8257}, {105,8258}, {108,8259}, {59,8260}, {97,8262}, {114,8263}, {112,8264}, {111,8265}, {111,8266},
+    {110,8267}, {100,8268}, {117,8273}, {111,8269}, {119,8270}, {110,8271}, {59,8272}, {112,8274}, {59,8275}, {101,8277},
+    {102,8278}, {116,8279}, {97,8280}, {104,8287}, {114,8281}, {114,8282}, {111,8283}, {119,8284}, {115,8285}, {59,8286},
+    {97,8288}, {114,8289}, {112,8290}, {111,8291}, {111,8292}, {110,8293}, {115,8294}, {59,8295}, {105,8297}, {103,8298},
+    {104,8299}, {116,8300}, {97,8301}, {114,8302}, {114,8303}, {111,8304}, {119,8305}, {115,8306}, {59,8307}, {113,8309},
+    {117,8310}, {105,8311}, {103,8312}, {97,8313}, {114,8314}, {114,8315}, {111,8316}, {119,8317}, {59,8318}, {104,8320},
+    {114,8321}, {101,8322}, {101,8323}, {116,8324}, {105,8325}, {109,8326}, {101,8327}, {115,8328}, {59,8329}, {103,8331},
+    {59,8332}, {105,8334}, {110,8335}, {103,8336}, {100,8337}, {111,8338}, {116,8339}, {115,8340}, {101,8341}, {113,8342},
+    {59,8343}, {97,8345}, {104,8349}, {109,8353}, {114,8346}, {114,8347}, {59,8348}, {97,8350}, {114,8351}, {59,8352},
+    {59,8354}, {111,8356}, {117,8357}, {115,8358}, {116,8359}, {59,8360}, {97,8361}, {99,8362}, {104,8363}, {101,8364},
+    {59,8365}, {109,8367}, {105,8368}, {100,8369}, {59,8370}, {97,8372}, {98,8379}, {112,8383}, {116,8393}, {110,8373},
+    {114,8376}, {103,8374}, {59,8375}, {114,8377}, {59,8378}, {114,8380}, {107,8381}, {59,8382}, {97,8384}, {102,8387},
+    {108,8389}, {114,8385}, {59,8386}, {59,8388}, {117,8390}, {115,8391}, {59,8392}, {105,8394}, {109,8395}, {101,8396},
+    {115,8397}, {59,8398}, {97,8400}, {112,8406}, {114,8401}, {59,8402}, {103,8403}, {116,8404}, {59,8405}, {111,8407},
+    {108,8408}, {105,8409}, {110,8410}, {116,8411}, {59,8412}, {97,8414}, {114,8415}, {114,8416}, {59,8417}, {97,8419},
+    {99,8424}, {104,8427}, {113,8429}, {113,8420}, {117,8421}, {111,8422}, {59,8423}, {114,8425}, {59,8426}, {59,8428},
+    {98,8430}, {117,8432}, {59,8431}, {111,8433}, {59,8434}, {114,8435}, {59,8436}, {104,8438}, {105,8443}, {114,8448},
+    {114,8439}, {101,8440}, {101,8441}, {59,8442}, {109,8444}, {101,8445}, {115,8446}, {59,8447}, {105,8449}, {59,8450},
+    {101,8451}, {102,8453}, {108,8455}, {59,8452}, {59,8454}, {116,8456}, {114,8457}, {105,8458}, {59,8459}, {108,8461},
+    {117,8462}, {104,8463}, {97,8464}, {114,8465}, {59,8466}, {59,8468}, {97,8470}, {98,8476}, {99,8481}, {100,8529},
+    {101,8537}, {102,8575}, {104,8582}, {105,8612}, {108,8652}, {109,8657}, {111,8693}, {112,8709}, {113,8721}, {114,8767},
+    {115,8772}, {116,8791}, {117,8818}, {119,8997}, {122,9017}, {99,8471}, {117,8472}, {116,8473}, {101,8474}, {59,8475},
+    {113,8477}, {117,8478}, {111,8479}, {59,8480}, {59,8482}, {69,8483}, {97,8485}, {99,8492}, {101,8496}, {105,8502},
+    {110,8506}, {112,8516}, {115,8523}, {121,8527}, {59,8484}, {112,8486}, {114,8488}, {59,8487}, {111,8489}, {110,8490},
+    {59,8491}, {117,8493}, {101,8494}, {59,8495}, {59,8497}, {100,8498}, {105,8499}, {108,8500}, {59,8501}, {114,8503},
+    {99,8504}, {59,8505}, {69,8507}, {97,8509}, {115,8512}, {59,8508}, {112,8510}, {59,8511}, {105,8513}, {109,8514},
+    {59,8515}, {111,8517}, {108,8518}, {105,8519}, {110,8520}, {116,8521}, {59,8522}, {105,8524}, {109,8525}, {59,8526},
+    {59,8528}, {111,8530}, {116,8531}, {59,8532}, {98,8533}, {101,8535}, {59,8534}, {59,8536}, {65,8538}, {97,8542}, {99,8552},
+    {109,8555}, {115,8558}, {116,8563}, {120,8572}, {114,8539}, {114,8540}, {59,8541}, {114,8543}, {104,8544}, {114,8547},
+    {107,8545}, {59,8546}, {59,8548}, {111,8549}, {119,8550}, {59,8551}, {116,8553}, {59,8554}, {105,8556}, {59,8557},
+    {119,8559}, {97,8560}, {114,8561}, {59,8562}, {109,8564}, {105,8565}, {110,8570}, {110,8566}, {117,8567}, {115,8568},
+    {59,8569}, {59,8571}, {116,8573}, {59,8574}, {114,8576}, {59,8577}, {111,8578}, {119,8579}, {110,8580}, {59,8581},
+    {97,8583}, {99,8587}, {111,8594}, {121,8610}, {114,8584}, {112,8585}, {59,8586}, {104,8588}, {121,8592}, {99,8589},
+    {121,8590}, {59,8591}, {59,8593}, {114,8595}, {116,8596}, {109,8597}, {112,8601}, {105,8598}, {100,8599}, {59,8600},
+    {97,8602}, {114,8603}, {97,8604}, {108,8605}, {108,8606}, {101,8607}, {108,8608}, {59,8609}, {59,8611}, {103,8613},
+    {109,8621}, {109,8614}, {97,8615}, {59,8616}, {102,8617}, {118,8619}, {59,8618}, {59,8620}, {59,8622}, {100,8623},
+    {101,8627}, {103,8631}, {108,8635}, {110,8639}, {112,8642}, {114,8647}, {111,8624}, {116,8625}, {59,8626}, {59,8628},
+    {113,8629}, {59,8630}, {59,8632}, {69,8633}, {59,8634}, {59,8636}, {69,8637}, {59,8638}, {101,8640}, {59,8641}, {108,8643},
+    {117,8644}, {115,8645}, {59,8646}, {97,8648}, {114,8649}, {114,8650}, {59,8651}, {97,8653}, {114,8654}, {114,8655},
+    {59,8656}, {97,8658}, {101,8674}, {105,8681}, {116,8687}, {108,8659}, {115,8670}, {108,8660}, {115,8661}, {101,8662},
+    {116,8663}, {109,8664}, {105,8665}, {110,8666}, {117,8667}, {115,8668}, {59,8669}, {104,8671}, {112,8672}, {59,8673},
+    {112,8675}, {97,8676}, {114,8677}, {115,8678}, {108,8679}, {59,8680}, {100,8682}, {108,8684}, {59,8683}, {101,8685},
+    {59,8686}, {59,8688}, {101,8689}, {59,8690}, {115,8691}, {59,8692}, {102,8694}, {108,8699}, {112,8706}, {116,8695},
+    {99,8696}, {121,8697}, {59,8698}, {59,8700}, {98,8701}, {59,8702}, {97,8703}, {114,8704}, {59,8705}, {102,8707}, {59,8708},
+    {97,8710}, {100,8711}, {114,8719}, {101,8712}, {115,8713}, {59,8714}, {117,8715}, {105,8716}, {116,8717}, {59,8718},
+    {59,8720}, {99,8722}, {115,8733}, {117,8757}, {97,8723}, {117,8728}, {112,8724}, {59,8725}, {115,8726}, {59,8727},
+    {112,8729}, {59,8730}, {115,8731}, {59,8732}, {117,8734}, {98,8735}, {112,8746}, {59,8736}, {101,8737}, {115,8739},
+    {59,8738}, {101,8740}, {116,8741}, {59,8742}, {101,8743}, {113,8744}, {59,8745}, {59,8747}, {101,8748}, {115,8750},
+    {59,8749}, {101,8751}, {116,8752}, {59,8753}, {101,8754}, {113,8755}, {59,8756}, {59,8758}, {97,8759}, {102,8765},
+    {114,8760}, {101,8761}, {102,8763}, {59,8762}, {59,8764}, {59,8766}, {97,8768}, {114,8769}, {114,8770}, {59,8771},
+    {99,8773}, {101,8776}, {109,8781}, {116,8786}, {114,8774}, {59,8775}, {116,8777}, {109,8778}, {110,8779}, {59,8780},
+    {105,8782}, {108,8783}, {101,8784}, {59,8785}, {97,8787}, {114,8788}, {102,8789}, {59,8790}, {97,8792}, {114,8797},
+    {114,8793}, {59,8794}, {102,8795}, {59,8796}, {97,8798}, {110,8815}, {105,8799}, {103,8800}, {104,8801}, {116,8802},
+    {101,8803}, {112,8811}, {112,8804}, {115,8805}, {105,8806}, {108,8807}, {111,8808}, {110,8809}, {59,8810}, {104,8812},
+    {105,8813}, {59,8814}, {115,8816}, {59,8817}, {98,8819}, {99,8876}, {109,8917}, {110,8919}, {112,8922}, {59,8820},
+    {69,8821}, {100,8823}, {101,8827}, {109,8833}, {110,8838}, {112,8843}, {114,8848}, {115,8853}, {59,8822}, {111,8824},
+    {116,8825}, {59,8826}, {59,8828}, {100,8829}, {111,8830}, {116,8831}, {59,8832}, {117,8834}, {108,8835}, {116,8836},
+    {59,8837}, {69,8839}, {101,8841}, {59,8840}, {59,8842}, {108,8844}, {117,8845}, {115,8846}, {59,8847}, {97,8849},
+    {114,8850}, {114,8851}, {59,8852}, {101,8854}, {105,8868}, {117,8871}, {116,8855}, {59,8856}, {101,8857}, {110,8862},
+    {113,8858}, {59,8859}, {113,8860}, {59,8861}, {101,8863}, {113,8864}, {59,8865}, {113,8866}, {59,8867}, {109,8869},
+    {59,8870}, {98,8872}, {112,8874}, {59,8873}, {59,8875}, {99,8877}, {59,8878}, {97,8879}, {99,8886}, {101,8894}, {110,8897},
+    {115,8913}, {112,8880}, {112,8881}, {114,8882}, {111,8883}, {120,8884}, {59,8885}, {117,8887}, {114,8888}, {108,8889},
+    {121,8890}, {101,8891}, {113,8892}, {59,8893}, {113,8895}, {59,8896}, {97,8898}, {101,8905}, {115,8909}, {112,8899},
+    {112,8900}, {114,8901}, {111,8902}, {120,8903}, {59,8904}, {113,8906}, {113,8907}, {59,8908}, {105,8910}, {109,8911},
+    {59,8912}, {105,8914}, {109,8915}, {59,8916}, {59,8918}, {103,8920}, {59,8921}, {49,8923}, {50,8925}, {51,8927}, {59,8929},
+    {69,8930}, {100,8932}, {101,8940}, {104,8946}, {108,8954}, {109,8959}, {110,8964}, {112,8969}, {115,8974}, {59,8924},
+    {59,8926}, {59,8928}, {59,8931}, {111,8933}, {115,8936}, {116,8934}, {59,8935}, {117,8937}, {98,8938}, {59,8939},
+    {59,8941}, {100,8942}, {111,8943}, {116,8944}, {59,8945}, {115,8947}, {111,8948}, {117,8951}, {108,8949}, {59,8950},
+    {98,8952}, {59,8953}, {97,8955}, {114,8956}, {114,8957}, {59,8958}, {117,8960}, {108,8961}, {116,8962}, {59,8963},
+    {69,8965}, {101,8967}, {59,8966}, {59,8968}, {108,8970}, {117,8971}, {115,8972}, {59,8973}, {101,8975}, {105,8989},
+    {117,8992}, {116,8976}, {59,8977}, {101,8978}, {110,8983}, {113,8979}, {59,8980}, {113,8981}, {59,8982}, {101,8984},
+    {113,8985}, {59,8986}, {113,8987}, {59,8988}, {109,8990}, {59,8991}, {98,8993}, {112,8995}, {59,8994}, {59,8996},
+    {65,8998}, {97,9002}, {110,9012}, {114,8999}, {114,9000}, {59,9001}, {114,9003}, {104,9004}, {114,9007}, {107,9005},
+    {59,9006}, {59,9008}, {111,9009}, {119,9010}, {59,9011}, {119,9013}, {97,9014}, {114,9015}, {59,9016}, {108,9018},
+    {105,9019}, {103,9020}, {59,9021}, {97,9023}, {98,9031}, {99,9035}, {100,9048}, {101,9052}, {102,9058}, {104,9061},
+    {105,9111}, {111,9130}, {112,9153}, {114,9159}, {115,9227}, {119,9242}, {114,9024}, {117,9029}, {103,9025}, {101,9026},
+    {116,9027}, {59,9028}, {59,9030}, {114,9032}, {107,9033}, {59,9034}, {97,9036}, {101,9041}, {121,9046}, {114,9037},
+    {111,9038}, {110,9039}, {59,9040}, {100,9042}, {105,9043}, {108,9044}, {59,9045}, {59,9047}, {111,9049}, {116,9050},
+    {59,9051}, {108,9053}, {114,9054}, {101,9055}, {99,9056}, {59,9057}, {114,9059}, {59,9060}, {101,9062}, {105,9081},
+    {107,9099}, {111,9107}, {114,9063}, {116,9072}, {101,9064}, {52,9065}, {102,9067}, {59,9066}, {111,9068}, {114,9069},
+    {101,9070}, {59,9071}, {97,9073}, {59,9074}, {115,9075}, {118,9079}, {121,9076}, {109,9077}, {59,9078}, {59,9080},
+    {99,9082}, {110,9095}, {107,9083}, {97,9084}, {115,9091}, {112,9085}, {112,9086}, {114,9087}, {111,9088}, {120,9089},
+    {59,9090}, {105,9092}, {109,9093}, {59,9094}, {115,9096}, {112,9097}, {59,9098}, {97,9100}, {115,9103}, {112,9101},
+    {59,9102}, {105,9104}, {109,9105}, {59,9106}, {114,9108}, {110,9109}, {59,9110}, {108,9112}, {109,9116}, {110,9127},
+    {100,9113}, {101,9114}, {59,9115}, {101,9117}, {115,9118}, {59,9119}, {98,9120}, {100,9125}, {59,9121}, {97,9122},
+    {114,9123}, {59,9124}, {59,9126}, {116,9128}, {59,9129}, {101,9131}, {112,9134}, {115,9150}, {97,9132}, {59,9133},
+    {59,9135}, {98,9136}, {99,9140}, {102,9144}, {111,9137}, {116,9138}, {59,9139}, {105,9141}, {114,9142}, {59,9143},
+    {59,9145}, {111,9146}, {114,9147}, {107,9148}, {59,9149}, {97,9151}, {59,9152}, {114,9154}, {105,9155}, {109,9156},
+    {101,9157}, {59,9158}, {97,9160}, {105,9164}, {112,9220}, {100,9161}, {101,9162}, {59,9163}, {97,9165}, {100,9195},
+    {101,9199}, {109,9201}, {112,9207}, {115,9212}, {116,9215}, {110,9166}, {103,9167}, {108,9168}, {101,9169}, {59,9170},
+    {100,9171}, {108,9176}, {113,9184}, {114,9186}, {111,9172}, {119,9173}, {110,9174}, {59,9175}, {101,9177}, {102,9178},
+    {116,9179}, {59,9180}, {101,9181}, {113,9182}, {59,9183}, {59,9185}, {105,9187}, {103,9188}, {104,9189}, {116,9190},
+    {59,9191}, {101,9192}, {113,9193}, {59,9194}, {111,9196}, {116,9197}, {59,9198}, {59,9200}, {105,9202}, {110,9203},
+    {117,9204}, {115,9205}, {59,9206}, {108,9208}, {117,9209}, {115,9210}, {59,9211}, {98,9213}, {59,9214}, {105,9216},
+    {109,9217}, {101,9218}, {59,9219}, {101,9221}, {122,9222}, {105,9223}, {117,9224}, {109,9225}, {59,9226}, {99,9228},
+    {104,9233}, {116,9237}, {114,9229}, {121,9231}, {59,9230}, {59,9232}, {99,9234}, {121,9235}, {59,9236}, {114,9238},
+    {111,9239}, {107,9240}, {59,9241}, {105,9243}, {111,9247}, {120,9244}, {116,9245}, {59,9246}, {104,9248}, {101,9249},
+    {97,9250}, {100,9251}, {108,9252}, {114,9262}, {101,9253}, {102,9254}, {116,9255}, {97,9256}, {114,9257}, {114,9258},
+    {111,9259}, {119,9260}, {59,9261}, {105,9263}, {103,9264}, {104,9265}, {116,9266}, {97,9267}, {114,9268}, {114,9269},
+    {111,9270}, {119,9271}, {59,9272}, {65,9274}, {72,9278}, {97,9282}, {98,9291}, {99,9300}, {100,9307}, {102,9321},
+    {103,9329}, {104,9335}, {108,9346}, {109,9363}, {111,9370}, {112,9378}, {114,9435}, {115,9456}, {116,9460}, {117,9475},
+    {119,9483}, {114,9275}, {114,9276}, {59,9277}, {97,9279}, {114,9280}, {59,9281}, {99,9283}, {114,9288}, {117,9284},
+    {116,9285}, {101,9286}, {59,9287}, {114,9289}, {59,9290}, {114,9292}, {99,9293}, {101,9296}, {121,9294}, {59,9295},
+    {118,9297}, {101,9298}, {59,9299}, {105,9301}, {121,9305}, {114,9302}, {99,9303}, {59,9304}, {59,9306}, {97,9308},
+    {98,9312}, {104,9317}, {114,9309}, {114,9310}, {59,9311}, {108,9313}, {97,9314}, {99,9315}, {59,9316}, {97,9318},
+    {114,9319}, {59,9320}, {105,9322}, {114,9327}, {115,9323}, {104,9324}, {116,9325}, {59,9326}, {59,9328}, {114,9330},
+    {97,9331}, {118,9332}, {101,9333}, {59,9334}, {97,9336}, {98,9342}, {114,9337}, {108,9338}, {114,9340}, {59,9339},
+    {59,9341}, {108,9343}, {107,9344}, {59,9345}, {99,9347}, {116,9359}, {111,9348}, {114,9355}, {114,9349}, {110,9350},
+    {59,9351}, {101,9352}, {114,9353}, {59,9354}, {111,9356}, {112,9357}, {59,9358}, {114,9360}, {105,9361}, {59,9362},
+    {97,9364}, {108,9368}, {99,9365}, {114,9366}, {59,9367}, {59,9369}, {103,9371}, {112,9375}, {111,9372}, {110,9373},
+    {59,9374}, {102,9376}, {59,9377}, {97,9379}, {100,9385}, {104,9395}, {108,9413}, {115,9417}, {117,9426}, {114,9380},
+    {114,9381}, {111,9382}, {119,9383}, {59,9384}, {111,9386}, {119,9387}, {110,9388}, {97,9389}, {114,9390}, {114,9391},
+    {111,9392}, {119,9393}, {59,9394}, {97,9396}, {114,9397}, {112,9398}, {111,9399}, {111,9400}, {110,9401}, {108,9402},
+    {114,9407}, {101,9403}, {102,9404}, {116,9405}, {59,9406}, {105,9408}, {103,9409}, {104,9410}, {116,9411}, {59,9412},
+    {117,9414}, {115,9415}, {59,9416}, {105,9418}, {59,9419}, {104,9420}, {108,9422}, {59,9421}, {111,9423}, {110,9424},
+    {59,9425}, {112,9427}, {97,9428}, {114,9429}, {114,9430}, {111,9431}, {119,9432}, {115,9433}, {59,9434}, {99,9436},
+    {105,9448}, {116,9452}, {111,9437}, {114,9444}, {114,9438}, {110,9439}, {59,9440}, {101,9441}, {114,9442}, {59,9443},
+    {111,9445}, {112,9446}, {59,9447}, {110,9449}, {103,9450}, {59,9451}, {114,9453}, {105,9454}, {59,9455}, {99,9457},
+    {114,9458}, {59,9459}, {100,9461}, {105,9465}, {114,9470}, {111,9462}, {116,9463}, {59,9464}, {108,9466}, {100,9467},
+    {101,9468}, {59,9469}, {105,9471}, {59,9472}, {102,9473}, {59,9474}, {97,9476}, {109,9480}, {114,9477}, {114,9478},
+    {59,9479}, {108,9481}, {59,9482}, {97,9484}, {110,9485}, {103,9486}, {108,9487}, {101,9488}, {59,9489}, {65,9491},
+    {66,9495}, {68,9501}, {97,9506}, {99,9603}, {100,9606}, {101,9611}, {102,9633}, {108,9636}, {110,9641}, {111,9648},
+    {112,9652}, {114,9657}, {115,9662}, {122,9679}, {114,9492}, {114,9493}, {59,9494}, {97,9496}, {114,9497}, {59,9498},
+    {118,9499}, {59,9500}, {97,9502}, {115,9503}, {104,9504}, {59,9505}, {110,9507}, {114,9512}, {103,9508}, {114,9509},
+    {116,9510}, {59,9511}, {101,9513}, {107,9521}, {110,9527}, {112,9535}, {114,9547}, {115,9552}, {116,9579}, {112,9514},
+    {115,9515}, {105,9516}, {108,9517}, {111,9518}, {110,9519}, {59,9520}, {97,9522}, {112,9523}, {112,9524}, {97,9525},
+    {59,9526}, {111,9528}, {116,9529}, {104,9530}, {105,9531}, {110,9532}, {103,9533}, {59,9534}, {104,9536}, {105,9539},
+    {114,9541}, {105,9537}, {59,9538}, {59,9540}, {111,9542}, {112,9543}, {116,9544}, {111,9545}, {59,9546}, {59,9548},
+    {104,9549}, {111,9550}, {59,9551}, {105,9553}, {117,9558}, {103,9554}, {109,9555}, {97,9556}, {59,9557}, {98,9559},
+    {112,9569}, {115,9560}, {101,9561}, {116,9562}, {110,9563}, {101,9564}, {113,9565}, {59,9566}, {113,9567}, {59,9568},
+    {115,9570}, {101,9571}, {116,9572}, {110,9573}, {101,9574}, {113,9575}, {59,9576}, {113,9577}, {59,9578}, {104,9580},
+    {114,9585}, {101,9581}, {116,9582}, {97,9583}, {59,9584}, {105,9586}, {97,9587}, {110,9588}, {103,9589}, {108,9590},
+    {101,9591}, {108,9592}, {114,9597}, {101,9593}, {102,9594}, {116,9595}, {59,9596}, {105,9598}, {103,9599}, {104,9600},
+    {116,9601}, {59,9602}, {121,9604}, {59,9605}, {97,9607}, {115,9608}, {104,9609}, {59,9610}, {101,9612}, {108,9621},
+    {114,9626}, {59,9613}, {98,9614}, {101,9618}, {97,9615}, {114,9616}, {59,9617}, {113,9619}, {59,9620}, {108,9622},
+    {105,9623}, {112,9624}, {59,9625}, {98,9627}, {116,9631}, {97,9628}, {114,9629}, {59,9630}, {59,9632}, {114,9634},
+    {59,9635}, {116,9637}, {114,9638}, {105,9639}, {59,9640}, {115,9642}, {117,9643}, {98,9644}, {112,9646}, {59,9645},
+    {59,9647}, {112,9649}, {102,9650}, {59,9651}, {114,9653}, {111,9654}, {112,9655}, {59,9656}, {116,9658}, {114,9659},
+    {105,9660}, {59,9661}, {99,9663}, {117,9666}, {114,9664}, {59,9665}, {98,9667}, {112,9673}, {110,9668}, {69,9669},
+    {101,9671}, {59,9670}, {59,9672}, {110,9674}, {69,9675}, {101,9677}, {59,9676}, {59,9678}, {105,9680}, {103,9681},
+    {122,9682}, {97,9683}, {103,9684}, {59,9685}, {99,9687}, {101,9692}, {102,9708}, {111,9711}, {112,9715}, {114,9717},
+    {115,9724}, {105,9688}, {114,9689}, {99,9690}, {59,9691}, {100,9693}, {105,9703}, {98,9694}, {103,9698}, {97,9695},
+    {114,9696}, {59,9697}, {101,9699}, {59,9700}, {113,9701}, {59,9702}, {101,9704}, {114,9705}, {112,9706}, {59,9707},
+    {114,9709}, {59,9710}, {112,9712}, {102,9713}, {59,9714}, {59,9716}, {59,9718}, {101,9719}, {97,9720}, {116,9721},
+    {104,9722}, {59,9723}, {99,9725}, {114,9726}, {59,9727}, {99,9729}, {100,9740}, {102,9745}, {104,9748}, {105,9757},
+    {108,9759}, {109,9768}, {110,9772}, {111,9776}, {114,9793}, {115,9802}, {117,9811}, {118,9821}, {119,9825}, {97,9730},
+    {105,9733}, {117,9737}, {112,9731}, {59,9732}, {114,9734}, {99,9735}, {59,9736}, {112,9738}, {59,9739}, {116,9741},
+    {114,9742}, {105,9743}, {59,9744}, {114,9746}, {59,9747}, {65,9749}, {97,9753}, {114,9750}, {114,9751}, {59,9752},
+    {114,9754}, {114,9755}, {59,9756}, {59,9758}, {65,9760}, {97,9764}, {114,9761}, {114,9762}, {59,9763}, {114,9765},
+    {114,9766}, {59,9767}, {97,9769}, {112,9770}, {59,9771}, {105,9773}, {115,9774}, {59,9775}, {100,9777}, {112,9781},
+    {116,9788}, {111,9778}, {116,9779}, {59,9780}, {102,9782}, {108,9784}, {59,9783}, {117,9785}, {115,9786}, {59,9787},
+    {105,9789}, {109,9790}, {101,9791}, {59,9792}, {65,9794}, {97,9798}, {114,9795}, {114,9796}, {59,9797}, {114,9799},
+    {114,9800}, {59,9801}, {99,9803}, {113,9806}, {114,9804}, {59,9805}, {99,9807}, {117,9808}, {112,9809}, {59,9810},
+    {112,9812}, {116,9817}, {108,9813}, {117,9814}, {115,9815}, {59,9816}, {114,9818}, {105,9819}, {59,9820}, {101,9822},
+    {101,9823}, {59,9824}, {101,9826}, {100,9827}, {103,9828}, {101,9829}, {59,9830}, {97,9832}, {99,9840}, {101,9847},
+    {102,9850}, {105,9853}, {111,9857}, {115,9861}, {117,9865}, {99,9833}, {117,9834}, {121,9838}, {116,9835}, {101,9836},
+    {59,9837}, {59,9839}, {105,9841}, {121,9845}, {114,9842}, {99,9843}, {59,9844}, {59,9846}, {110,9848}, {59,9849},
+    {114,9851}, {59,9852}, {99,9854}, {121,9855}, {59,9856}, {112,9858}, {102,9859}, {59,9860}, {99,9862}, {114,9863},
+    {59,9864}, {99,9866}, {109,9869}, {121,9867}, {59,9868}, {108,9870}, {59,9871}, {97,9873}, {99,9879}, {100,9887},
+    {101,9891}, {102,9900}, {104,9903}, {105,9907}, {111,9914}, {115,9918}, {119,9922}, {99,9874}, {117,9875}, {116,9876},
+    {101,9877}, {59,9878}, {97,9880}, {121,9885}, {114,9881}, {111,9882}, {110,9883}, {59,9884}, {59,9886}, {111,9888},
+    {116,9889}, {59,9890}, {101,9892}, {116,9897}, {116,9893}, {114,9894}, {102,9895}, {59,9896}, {97,9898}, {59,9899},
+    {114,9901}, {59,9902}, {99,9904}, {121,9905}, {59,9906}, {103,9908}, {114,9909}, {97,9910}, {114,9911}, {114,9912},
+    {59,9913}, {112,9915}, {102,9916}, {59,9917}, {99,9919}, {114,9920}, {59,9921}, {106,9923}, {110,9925}, {59,9924},
+    {106,9926}, {59,9927}, {32,9929}, {44,9930}, {47,9931}, {59,9934}, {60,9935}, {62,9936}, {79,9932}, {111,9933}, {40,9938},
+    {42,9941}, {43,9943}, {45,9947}, {46,9951}, {47,9953}, {48,9955}, {49,9957}, {50,9979}, {51,10001}, {52,10023}, {53,10045},
+    {54,10049}, {55,10051}, {56,10053}, {57,10055}, {61,10057}, {65,10059}, {66,10061}, {67,10063}, {68,10065}, {69,10067},
+    {70,10069}, {71,10071}, {72,10073}, {73,10075}, {74,10077}, {75,10079}, {76,10081}, {77,10083}, {78,10085}, {79,10087},
+    {80,10089}, {81,10091}, {82,10093}, {83,10095}, {84,10097}, {85,10099}, {86,10101}, {87,10103}, {88,10105}, {89,10107},
+    {90,10109}, {97,10111}, {98,10113}, {99,10115}, {100,10117}, {101,10119}, {102,10121}, {103,10123}, {104,10125}, {105,10127},
+    {106,10129}, {107,10131}, {108,10133}, {109,10135}, {110,10137}, {111,10139}, {112,10141}, {113,10143}, {114,10145},
+    {115,10147}, {116,10149}, {117,10151}, {118,10153}, {119,10155}, {120,10157}, {121,10159}, {122,10161}, {41,9939},
+    {41,9940}, {41,9942}, {41,9944}, {43,9945}, {41,9946}, {41,9948}, {45,9949}, {41,9950}, {41,9952}, {41,9954}, {41,9956},
+    {41,9958}, {48,9959}, {49,9961}, {50,9963}, {51,9965}, {52,9967}, {53,9969}, {54,9971}, {55,9973}, {56,9975}, {57,9977},
+    {41,9960}, {41,9962}, {41,9964}, {41,9966}, {41,9968}, {41,9970}, {41,9972}, {41,9974}, {41,9976}, {41,9978}, {41,9980},
+    {48,9981}, {49,9983}, {50,9985}, {51,9987}, {52,9989}, {53,9991}, {54,9993}, {55,9995}, {56,9997}, {57,9999}, {41,9982},
+    {41,9984}, {41,9986}, {41,9988}, {41,9990}, {41,9992}, {41,9994}, {41,9996}, {41,9998}, {41,10000}, {41,10002}, {48,10003},
+    {49,10005}, {50,10007}, {51,10009}, {52,10011}, {53,10013}, {54,10015}, {55,10017}, {56,10019}, {57,10021}, {41,10004},
+    {41,10006}, {41,10008}, {41,10010}, {41,10012}, {41,10014}, {41,10016}, {41,10018}, {41,10020}, {41,10022}, {41,10024},
+    {48,10025}, {49,10027}, {50,10029}, {51,10031}, {52,10033}, {53,10035}, {54,10037}, {55,10039}, {56,10041}, {57,10043},
+    {41,10026}, {41,10028}, {41,10030}, {41,10032}, {41,10034}, {41,10036}, {41,10038}, {41,10040}, {41,10042}, {41,10044},
+    {41,10046}, {48,10047}, {41,10048}, {41,10050}, {41,10052}, {41,10054}, {41,10056}, {41,10058}, {41,10060}, {41,10062},
+    {41,10064}, {41,10066}, {41,10068}, {41,10070}, {41,10072}, {41,10074}, {41,10076}, {41,10078}, {41,10080}, {41,10082},
+    {41,10084}, {41,10086}, {41,10088}, {41,10090}, {41,10092}, {41,10094}, {41,10096}, {41,10098}, {41,10100}, {41,10102},
+    {41,10104}, {41,10106}, {41,10108}, {41,10110}, {41,10112}, {41,10114}, {41,10116}, {41,10118}, {41,10120}, {41,10122},
+    {41,10124}, {41,10126}, {41,10128}, {41,10130}, {41,10132}, {41,10134}, {41,10136}, {41,10138}, {41,10140}, {41,10142},
+    {41,10144}, {41,10146}, {41,10148}, {41,10150}, {41,10152}, {41,10154}, {41,10156}, {41,10158}, {41,10160}, {41,10162},
+    {32,10164}, {32,10166}, {42,10167}, {46,10168}, {48,10169}, {111,10170}, {45,10172}, {32,10174}, {34,10175}, {39,10176},
+    {32,10178}, {43,10179}, {45,10180}, {48,10183}, {58,10184}, {70,10185}, {75,10186}, {76,10187}, {80,10188}, {84,10189},
+    {102,10190}, {108,10191}, {109,10192}, {110,10193}, {112,10194}, {116,10195}, {124,10196}, {32,10181}, {45,10182},
+    {32,10198}, {42,10199}, {46,10200}, {60,10201}, {62,10202}, {105,10203}, {106,10204}, {39,10206}, {47,10209}, {60,10211},
+    {61,10212}, {62,10213}, {65,10214}, {66,10215}, {67,10216}, {68,10217}, {69,10218}, {71,10219}, {72,10220}, {73,10221},
+    {74,10222}, {76,10223}, {79,10224}, {82,10225}, {84,10226}, {89,10227}, {90,10228}, {97,10229}, {98,10230}, {99,10231},
+    {100,10232}, {101,10233}, {103,10234}, {104,10235}, {105,10236}, {106,10237}, {108,10238}, {109,10239}, {111,10240},
+    {114,10241}, {116,10242}, {121,10243}, {122,10244}, {79,10207}, {111,10208}, {67,10210}, {32,10246}, {42,10247}, {45,10248},
+    {47,10249}, {51,10250}, {47,10252}, {49,10253}, {50,10255}, {51,10256}, {52,10257}, {53,10258}, {54,10259}, {55,10260},
+    {56,10261}, {57,10262}, {48,10254}, {47,10264}, {51,10265}, {53,10266}, {32,10268}, {47,10269}, {52,10270}, {53,10271},
+    {56,10272}, {32,10274}, {47,10275}, {53,10276}, {47,10278}, {54,10279}, {56,10280}, {32,10282}, {47,10284}, {56,10285},
+    {34,10287}, {45,10288}, {32,10290}, {39,10291}, {34,10293}, {39,10294}, {46,10295}, {47,10296}, {60,10297}, {61,10298},
+    {47,10300}, {60,10301}, {61,10302}, {62,10303}, {67,10304}, {69,10305}, {72,10306}, {76,10307}, {78,10308}, {80,10309},
+    {82,10310}, {84,10311}, {87,10312}, {89,10313}, {99,10314}, {100,10315}, {101,10316}, {104,10317}, {108,10318}, {112,10319},
+    {114,10320}, {121,10321}, {124,10322}, {32,10324}, {34,10325}, {39,10326}, {46,10327}, {47,10328}, {61,10329}, {62,10330},
+    {33,10332}, {63,10333}, {47,10335}, {69,10336}, {47,10338}, {124,10339}, {47,10341}, {61,10342}, {69,10343}, {79,10344},
+    {114,10345}, {124,10346}, {47,10348}, {62,10349}, {72,10352}, {90,10353}, {122,10354}, {90,10350}, {122,10351}, {47,10356},
+    {61,10357}, {69,10358}, {45,10360}, {105,10361}, {108,10362}, {47,10364}, {124,10365}, {47,10367}, {61,10368}, {47,10370},
+    {74,10371}, {47,10373}, {45,10375}, {45,10377}, {47,10378}, {61,10379}, {74,10380}, {106,10381}, {61,10383}, {71,10384},
+    {74,10385}, {79,10386}, {106,10387}, {111,10388}, {39,10390}, {47,10392}, {67,10393}, {69,10394}, {82,10395}, {83,10396},
+    {88,10397}, {47,10391}, {33,10399}, {45,10400}, {61,10401}, {80,10402}, {116,10403}, {47,10405}, {61,10406}, {79,10407},
+    {115,10408}, {33,10410}, {77,10411}, {79,10412}, {83,10413}, {45,10415}, {47,10416}, {61,10417}, {72,10418}, {77,10419},
+    {61,10421}, {79,10423}, {47,10425}, {61,10426}, {47,10428}, {62,10429}, {72,10431}, {72,10430}, {68,10433}, {76,10460},
+    {82,10472}, {85,10486}, {111,10434}, {119,10435}, {110,10436}, {93,10437}, {32,10438}, {40,10439}, {41,10440}, {43,10441},
+    {45,10442}, {48,10443}, {49,10444}, {50,10445}, {51,10446}, {52,10447}, {53,10448}, {54,10449}, {55,10450}, {56,10451},
+    {57,10452}, {61,10453}, {91,10454}, {68,10455}, {111,10456}, {119,10457}, {110,10458}, {93,10459}, {101,10461}, {102,10462},
+    {116,10463}, {93,10464}, {32,10465}, {91,10466}, {76,10467}, {101,10468}, {102,10469}, {116,10470}, {93,10471}, {105,10473},
+    {103,10474}, {104,10475}, {116,10476}, {93,10477}, {32,10478}, {91,10479}, {82,10480}, {105,10481}, {103,10482}, {104,10483},
+    {116,10484}, {93,10485}, {112,10487}, {93,10488}, {32,10489}, {40,10490}, {41,10491}, {42,10492}, {43,10493}, {45,10494},
+    {48,10495}, {49,10496}, {50,10497}, {51,10498}, {52,10499}, {53,10500}, {54,10501}, {55,10502}, {56,10503}, {57,10504},
+    {61,10505}, {91,10506}, {97,10510}, {105,10511}, {110,10512}, {111,10513}, {85,10507}, {112,10508}, {93,10509}, {32,10515},
+    {32,10517}, {47,10519}, {101,10520}, {47,10522}, {47,10524}, {61,10525}, {111,10526}, {124,10527}, {47,10529}, {61,10530},
+    {62,10531}, {104,10533}, {122,10534}, {122,10532}, {47,10536}, {61,10537}, {101,10538}, {45,10540}, {102,10541}, {105,10542},
+    {108,10543}, {115,10544}, {34,10546}, {39,10554}, {47,10572}, {65,10573}, {66,10574}, {67,10575}, {68,10576}, {69,10577},
+    {70,10578}, {71,10579}, {72,10580}, {73,10581}, {74,10582}, {75,10583}, {76,10584}, {77,10585}, {78,10586}, {79,10587},
+    {80,10588}, {82,10589}, {83,10590}, {84,10591}, {85,10592}, {86,10593}, {88,10594}, {89,10595}, {90,10596}, {97,10597},
+    {98,10598}, {99,10599}, {100,10600}, {101,10601}, {102,10602}, {103,10603}, {104,10604}, {105,10605}, {106,10606},
+    {107,10607}, {108,10608}, {109,10609}, {110,10610}, {111,10611}, {112,10612}, {114,10613}, {115,10614}, {116,10615},
+    {117,10616}, {118,10617}, {119,10618}, {120,10619}, {121,10620}, {122,10621}, {124,10622}, {39,10547}, {73,10550},
+    {89,10551}, {105,10552}, {121,10553}, {105,10548}, {121,10549}, {34,10555}, {65,10558}, {69,10559}, {72,10560}, {73,10561},
+    {79,10562}, {86,10563}, {89,10564}, {97,10565}, {101,10566}, {104,10567}, {105,10568}, {111,10569}, {118,10570}, {121,10571},
+    {105,10556}, {121,10557}, {32,10624}, {47,10625}, {61,10626}, {46,10628}, {47,10629}, {106,10630}, {32,10632}, {46,10633},
+    {47,10634}, {107,10636}, {45,10638}, {47,10639}, {61,10640}, {106,10641}, {32,10643}, {45,10644}, {47,10645}, {99,10646},
+    {32,10648}, {45,10649}, {103,10650}, {106,10651}, {111,10652}, {116,10653}, {39,10655}, {42,10657}, {47,10658}, {99,10659},
+    {101,10660}, {111,10661}, {114,10662}, {115,10663}, {120,10664}, {47,10656}, {32,10666}, {33,10667}, {45,10668}, {61,10669},
+    {112,10670}, {47,10672}, {61,10673}, {111,10674}, {33,10676}, {102,10677}, {104,10678}, {109,10679}, {111,10680},
+    {115,10681}, {32,10683}, {45,10684}, {47,10685}, {104,10686}, {109,10687}, {32,10689}, {111,10690}, {120,10691}, {47,10693},
+    {61,10694}, {32,10696}, {47,10697}, {62,10698}, {104,10700}, {119,10701}, {104,10699}, {106,10702}, {110,10703}, {115,10704},
+    {32,10706}, {45,10708}, {61,10709}, {66,10710}, {67,10711}, {71,10712}, {99,10713}, {103,10714}, {124,10715}, {124,10707},
+    {66,10716}, {98,10717}, {32,10719}, {126,10720},
+};
+
+inline constexpr char16_t text[] = {
+    0x00A0, 0x2E18, 0x00A8, 0x00B4, 0x02D8, 0x02DA, 0x00B8, 0x00AF, 0x02D9, 0x2007, 0x2004, 0x2005, 0x2006, 0x02DB, 0x02C7,
+    0x2193, 0x2190, 0x2192, 0x2191, 0x02C6, 0x0060, 0x200A, 0x200D, 0x2003, 0x2002, 0x2008, 0x2009, 0x200C, 0x200B, 0x02DC,
+    0x00A1, 0x203D, 0x00B6, 0x00A7, 0x201E, 0x201D, 0x201C, 0x266F, 0x266E, 0x266B, 0x266C, 0x266D, 0x266A, 0x2669, 0x2030,
+    0x00C6, 0x0026, 0x00C1, 0x0102, 0x00C2, 0x0410, 0xD835, 0xDD04, 0x00C0, 0x0391, 0x0100, 0x2A53, 0x0104, 0xD835, 0xDD38,
+    0x2061, 0x00C5, 0xD835, 0xDC9C, 0x2254, 0x00C3, 0x00C4, 0x2216, 0x2AE7, 0x2306, 0x0411, 0x2235, 0x212C, 0x0392, 0xD835,
+    0xDD05, 0xD835, 0xDD39, 0x224E, 0x0427, 0x00A9, 0x0106, 0x22D2, 0x2145, 0x212D, 0x010C, 0x00C7, 0x0108, 0x2230, 0x010A,
+    0x00B7, 0x03A7, 0x2299, 0x2296, 0x2295, 0x2297, 0x2232, 0x2019, 0x2237, 0x2A74, 0x2261, 0x222F, 0x222E, 0x2102, 0x2210,
+    0x2233, 0x2A2F, 0xD835, 0xDC9E, 0x22D3, 0x224D, 0x2911, 0x0402, 0x0405, 0x040F, 0x2021, 0x21A1, 0x2AE4, 0x010E, 0x0414,
+    0x2207, 0x0394, 0xD835, 0xDD07, 0x02DD, 0x22C4, 0x2146, 0xD835, 0xDD3B, 0x20DC, 0x2250, 0x21D3, 0x21D0, 0x21D4, 0x27F8,
+    0x27FA, 0x27F9, 0x21D2, 0x22A8, 0x21D1, 0x21D5, 0x2225, 0x2913, 0x21F5, 0x0311, 0x2950, 0x295E, 0x21BD, 0x2956, 0x295F,
+    0x21C1, 0x2957, 0x22A4, 0x21A7, 0xD835, 0xDC9F, 0x0110, 0x014A, 0x00D0, 0x00C9, 0x011A, 0x00CA, 0x042D, 0x0116, 0xD835,
+    0xDD08, 0x00C8, 0x2208, 0x0112, 0x25FB, 0x25AB, 0x0118, 0xD835, 0xDD3C, 0x0395, 0x2A75, 0x2242, 0x21CC, 0x2130, 0x2A73,
+    0x0397, 0x00CB, 0x2203, 0x2147, 0x0424, 0xD835, 0xDD09, 0x25FC, 0x25AA, 0xD835, 0xDD3D, 0x2200, 0x2131, 0x0403, 0x003E,
+    0x0393, 0x03DC, 0x011E, 0x0122, 0x011C, 0x0413, 0x0120, 0xD835, 0xDD0A, 0x22D9, 0xD835, 0xDD3E, 0x2265, 0x22DB, 0x2267,
+    0x2AA2, 0x2277, 0x2A7E, 0x2273, 0xD835, 0xDCA2, 0x226B, 0x042A, 0x005E, 0x0124, 0x210C, 0x210B, 0x210D, 0x2500, 0x0126,
+    0x224F, 0x0415, 0x0132, 0x0401, 0x00CD, 0x00CE, 0x0418, 0x0130, 0x2111, 0x00CC, 0x012A, 0x2148, 0x222C, 0x222B, 0x22C2,
+    0x2063, 0x2062, 0x012E, 0xD835, 0xDD40, 0x0399, 0x2110, 0x0128, 0x0406, 0x00CF, 0x0134, 0x0419, 0xD835, 0xDD0D, 0xD835,
+    0xDD41, 0xD835, 0xDCA5, 0x0408, 0x0404, 0x0425, 0x040C, 0x039A, 0x0136, 0x041A, 0xD835, 0xDD0E, 0xD835, 0xDD42, 0xD835,
+    0xDCA6, 0x0409, 0x003C, 0x0139, 0x039B, 0x27EA, 0x2112, 0x219E, 0x013D, 0x013B, 0x041B, 0x27E8, 0x21E4, 0x21C6, 0x2308,
+    0x27E6, 0x2961, 0x21C3, 0x2959, 0x230A, 0x2194, 0x294E, 0x22A3, 0x21A4, 0x295A, 0x22B2, 0x29CF, 0x22B4, 0x2951, 0x2960,
+    0x21BF, 0x2958, 0x21BC, 0x2952, 0x22DA, 0x2266, 0x2276, 0x2AA1, 0x2A7D, 0x2272, 0xD835, 0xDD0F, 0x22D8, 0x21DA, 0x013F,
+    0x27F5, 0x27F7, 0x27F6, 0xD835, 0xDD43, 0x2199, 0x2198, 0x21B0, 0x0141, 0x226A, 0x2905, 0x041C, 0x205F, 0x2133, 0xD835,
+    0xDD10, 0x2213, 0xD835, 0xDD44, 0x039C, 0x040A, 0x0143, 0x0147, 0x0145, 0x041D, 0x000A, 0xD835, 0xDD11, 0x2060, 0x2115,
+    0x2AEC, 0x2262, 0x226D, 0x2226, 0x2209, 0x2260, 0x2242, 0x0338, 0x2204, 0x226F, 0x2271, 0x2267, 0x0338, 0x226B, 0x0338,
+    0x2279, 0x2A7E, 0x0338, 0x2275, 0x224E, 0x0338, 0x224F, 0x0338, 0x22EA, 0x29CF, 0x0338, 0x22EC, 0x226E, 0x2270, 0x2278,
+    0x226A, 0x0338, 0x2A7D, 0x0338, 0x2274, 0x2AA2, 0x0338, 0x2AA1, 0x0338, 0x2280, 0x2AAF, 0x0338, 0x22E0, 0x220C, 0x22EB,
+    0x29D0, 0x0338, 0x22ED, 0x228F, 0x0338, 0x22E2, 0x2290, 0x0338, 0x22E3, 0x2282, 0x20D2, 0x2288, 0x2281, 0x2AB0, 0x0338,
+    0x22E1, 0x227F, 0x0338, 0x2283, 0x20D2, 0x2289, 0x2241, 0x2244, 0x2247, 0x2249, 0x2224, 0xD835, 0xDCA9, 0x00D1, 0x039D,
+    0x0152, 0x00D3, 0x00D4, 0x041E, 0x0150, 0xD835, 0xDD12, 0x00D2, 0x014C, 0x03A9, 0x039F, 0xD835, 0xDD46, 0x2018, 0x2A54,
+    0xD835, 0xDCAA, 0x00D8, 0x00D5, 0x2A37, 0x00D6, 0x203E, 0x23DE, 0x23B4, 0x23DC, 0x2202, 0x041F, 0xD835, 0xDD13, 0x03A6,
+    0x03A0, 0x00B1, 0x2119, 0x2ABB, 0x227A, 0x2AAF, 0x227C, 0x227E, 0x2033, 0x220F, 0x221D, 0xD835, 0xDCAB, 0x03A8, 0x0022,
+    0xD835, 0xDD14, 0x211A, 0xD835, 0xDCAC, 0x2910, 0x00AE, 0x0154, 0x27EB, 0x21A0, 0x2916, 0x0158, 0x0156, 0x0420, 0x211C,
+    0x220B, 0x21CB, 0x296F, 0x03A1, 0x27E9, 0x21E5, 0x21C4, 0x2309, 0x27E7, 0x295D, 0x21C2, 0x2955, 0x230B, 0x22A2, 0x21A6,
+    0x295B, 0x22B3, 0x29D0, 0x22B5, 0x294F, 0x295C, 0x21BE, 0x2954, 0x21C0, 0x2953, 0x211D, 0x2970, 0x21DB, 0x211B, 0x21B1,
+    0x29F4, 0x0429, 0x0428, 0x042C, 0x015A, 0x2ABC, 0x0160, 0x015E, 0x015C, 0x0421, 0xD835, 0xDD16, 0x03A3, 0x2218, 0xD835,
+    0xDD4A, 0x221A, 0x25A1, 0x2293, 0x228F, 0x2291, 0x2290, 0x2292, 0x2294, 0xD835, 0xDCAE, 0x22C6, 0x22D0, 0x2286, 0x227B,
+    0x2AB0, 0x227D, 0x227F, 0x2211, 0x22D1, 0x2283, 0x2287, 0x00DE, 0x2122, 0x040B, 0x0426, 0x0009, 0x03A4, 0x0164, 0x0162,
+    0x0422, 0xD835, 0xDD17, 0x2234, 0x0398, 0x205F, 0x200A, 0x223C, 0x2243, 0x2245, 0x2248, 0xD835, 0xDD4B, 0x20DB, 0xD835,
+    0xDCAF, 0x0166, 0x00DA, 0x219F, 0x2949, 0x040E, 0x016C, 0x00DB, 0x0423, 0x0170, 0xD835, 0xDD18, 0x00D9, 0x016A, 0x005F,
+    0x23DF, 0x23B5, 0x23DD, 0x22C3, 0x228E, 0x0172, 0xD835, 0xDD4C, 0x2912, 0x21C5, 0x2195, 0x296E, 0x22A5, 0x21A5, 0x2196,
+    0x2197, 0x03D2, 0x03A5, 0x016E, 0xD835, 0xDCB0, 0x0168, 0x00DC, 0x22AB, 0x2AEB, 0x0412, 0x22A9, 0x2AE6, 0x22C1, 0x2016,
+    0x2223, 0x007C, 0x2758, 0x2240, 0xD835, 0xDD19, 0xD835, 0xDD4D, 0xD835, 0xDCB1, 0x22AA, 0x0174, 0x22C0, 0xD835, 0xDD1A,
+    0xD835, 0xDD4E, 0xD835, 0xDCB2, 0xD835, 0xDD1B, 0x039E, 0xD835, 0xDD4F, 0xD835, 0xDCB3, 0x042F, 0x0407, 0x042E, 0x00DD,
+    0x0176, 0x042B, 0xD835, 0xDD1C, 0xD835, 0xDD50, 0xD835, 0xDCB4, 0x0178, 0x0416, 0x0179, 0x017D, 0x0417, 0x017B, 0x0396,
+    0x2128, 0x2124, 0xD835, 0xDCB5, 0x00E1, 0x0103, 0x223E, 0x223E, 0x0333, 0x223F, 0x00E2, 0x0430, 0x00E6, 0xD835, 0xDD1E,
+    0x00E0, 0x2135, 0x03B1, 0x0101, 0x2A3F, 0x2227, 0x2A55, 0x2A5C, 0x2A58, 0x2A5A, 0x2220, 0x29A4, 0x2221, 0x29A8, 0x29A9,
+    0x29AA, 0x29AB, 0x29AC, 0x29AD, 0x29AE, 0x29AF, 0x221F, 0x22BE, 0x299D, 0x2222, 0x237C, 0x0105, 0xD835, 0xDD52, 0x2A70,
+    0x2A6F, 0x224A, 0x224B, 0x0027, 0x00E5, 0xD835, 0xDCB6, 0x002A, 0x00E3, 0x00E4, 0x2A11, 0x2AED, 0x224C, 0x03F6, 0x2035,
+    0x223D, 0x22CD, 0x22BD, 0x2305, 0x23B6, 0x0431, 0x29B0, 0x03B2, 0x2136, 0x226C, 0xD835, 0xDD1F, 0x25EF, 0x2A00, 0x2A01,
+    0x2A02, 0x2A06, 0x2605, 0x25BD, 0x25B3, 0x2A04, 0x290D, 0x29EB, 0x25B4, 0x25BE, 0x25C2, 0x25B8, 0x2423, 0x2592, 0x2591,
+    0x2593, 0x2588, 0x003D, 0x20E5, 0x2261, 0x20E5, 0x2310, 0xD835, 0xDD53, 0x22C8, 0x2557, 0x2554, 0x2556, 0x2553, 0x2550,
+    0x2566, 0x2569, 0x2564, 0x2567, 0x255D, 0x255A, 0x255C, 0x2559, 0x2551, 0x256C, 0x2563, 0x2560, 0x256B, 0x2562, 0x255F,
+    0x29C9, 0x2555, 0x2552, 0x2510, 0x250C, 0x2565, 0x2568, 0x252C, 0x2534, 0x229F, 0x229E, 0x22A0, 0x255B, 0x2558, 0x2518,
+    0x2514, 0x2502, 0x256A, 0x2561, 0x255E, 0x253C, 0x2524, 0x251C, 0x00A6, 0xD835, 0xDCB7, 0x204F, 0x005C, 0x29C5, 0x27C8,
+    0x2022, 0x2AAE, 0x0107, 0x2229, 0x2A44, 0x2A49, 0x2A4B, 0x2A47, 0x2A40, 0x2229, 0xFE00, 0x2041, 0x2A4D, 0x010D, 0x00E7,
+    0x0109, 0x2A4C, 0x2A50, 0x010B, 0x29B2, 0x00A2, 0xD835, 0xDD20, 0x0447, 0x2713, 0x03C7, 0x25CB, 0x29C3, 0x2257, 0x21BA,
+    0x21BB, 0x24C8, 0x229B, 0x229A, 0x229D, 0x2A10, 0x2AEF, 0x29C2, 0x2663, 0x003A, 0x002C, 0x0040, 0x2201, 0x2A6D, 0xD835,
+    0xDD54, 0x2117, 0x21B5, 0x2717, 0xD835, 0xDCB8, 0x2ACF, 0x2AD1, 0x2AD0, 0x2AD2, 0x22EF, 0x2938, 0x2935, 0x22DE, 0x22DF,
+    0x21B6, 0x293D, 0x222A, 0x2A48, 0x2A46, 0x2A4A, 0x228D, 0x2A45, 0x222A, 0xFE00, 0x21B7, 0x293C, 0x22CE, 0x22CF, 0x00A4,
+    0x2231, 0x232D, 0x2965, 0x2020, 0x2138, 0x2010, 0x290F, 0x010F, 0x0434, 0x21CA, 0x2A77, 0x00B0, 0x03B4, 0x29B1, 0x297F,
+    0xD835, 0xDD21, 0x2666, 0x03DD, 0x22F2, 0x00F7, 0x22C7, 0x0452, 0x231E, 0x230D, 0x0024, 0xD835, 0xDD55, 0x2251, 0x2238,
+    0x2214, 0x22A1, 0x231F, 0x230C, 0xD835, 0xDCB9, 0x0455, 0x29F6, 0x0111, 0x22F1, 0x25BF, 0x29A6, 0x045F, 0x27FF, 0x00E9,
+    0x2A6E, 0x011B, 0x2256, 0x00EA, 0x2255, 0x044D, 0x0117, 0x2252, 0xD835, 0xDD22, 0x2A9A, 0x00E8, 0x2A96, 0x2A98, 0x2A99,
+    0x23E7, 0x2113, 0x2A95, 0x2A97, 0x0113, 0x2205, 0x014B, 0x0119, 0xD835, 0xDD56, 0x22D5, 0x29E3, 0x2A71, 0x03B5, 0x03F5,
+    0x003D, 0x225F, 0x2A78, 0x29E5, 0x2253, 0x2971, 0x212F, 0x03B7, 0x00F0, 0x00EB, 0x20AC, 0x0021, 0x0444, 0x2640, 0xFB03,
+    0xFB00, 0xFB04, 0xD835, 0xDD23, 0xFB01, 0x0066, 0x006A, 0xFB02, 0x25B1, 0x0192, 0xD835, 0xDD57, 0x22D4, 0x2AD9, 0x2A0D,
+    0x00BD, 0x2153, 0x00BC, 0x2155, 0x2159, 0x215B, 0x2154, 0x2156, 0x00BE, 0x2157, 0x215C, 0x2158, 0x215A, 0x215D, 0x215E,
+    0x2044, 0x2322, 0xD835, 0xDCBB, 0x2A8C, 0x01F5, 0x03B3, 0x2A86, 0x011F, 0x011D, 0x0433, 0x0121, 0x2AA9, 0x2A80, 0x2A82,
+    0x2A84, 0x22DB, 0xFE00, 0x2A94, 0xD835, 0xDD24, 0x2137, 0x0453, 0x2A92, 0x2AA5, 0x2AA4, 0x2269, 0x2A8A, 0x2A88, 0x22E7,
+    0xD835, 0xDD58, 0x210A, 0x2A8E, 0x2A90, 0x2AA7, 0x2A7A, 0x22D7, 0x2995, 0x2A7C, 0x2978, 0x2269, 0xFE00, 0x044A, 0x2948,
+    0x21AD, 0x210F, 0x0125, 0x2665, 0x2026, 0x22B9, 0xD835, 0xDD25, 0x2925, 0x2926, 0x21FF, 0x223B, 0x21A9, 0x21AA, 0xD835,
+    0xDD59, 0x2015, 0xD835, 0xDCBD, 0x0127, 0x2043, 0x00ED, 0x00EE, 0x0438, 0x0435, 0xD835, 0xDD26, 0x00EC, 0x2A0C, 0x222D,
+    0x29DC, 0x2129, 0x0133, 0x012B, 0x0131, 0x22B7, 0x01B5, 0x2105, 0x221E, 0x29DD, 0x22BA, 0x2A17, 0x2A3C, 0x0451, 0x012F,
+    0xD835, 0xDD5A, 0x03B9, 0x00BF, 0xD835, 0xDCBE, 0x22F9, 0x22F5, 0x22F4, 0x22F3, 0x0129, 0x0456, 0x00EF, 0x0135, 0x0439,
+    0xD835, 0xDD27, 0x0237, 0xD835, 0xDD5B, 0xD835, 0xDCBF, 0x0458, 0x0454, 0x03BA, 0x03F0, 0x0137, 0x043A, 0xD835, 0xDD28,
+    0x0138, 0x0445, 0x045C, 0xD835, 0xDD5C, 0xD835, 0xDCC0, 0x291B, 0x290E, 0x2A8B, 0x2962, 0x013A, 0x29B4, 0x03BB, 0x2991,
+    0x2A85, 0x00AB, 0x291F, 0x291D, 0x21AB, 0x2939, 0x2973, 0x21A2, 0x2AAB, 0x2919, 0x2AAD, 0x2AAD, 0xFE00, 0x290C, 0x2772,
+    0x007B, 0x005B, 0x298B, 0x298F, 0x298D, 0x013E, 0x013C, 0x043B, 0x2936, 0x2967, 0x294B, 0x21B2, 0x2264, 0x21C7, 0x22CB,
+    0x2AA8, 0x2A7F, 0x2A81, 0x2A83, 0x22DA, 0xFE00, 0x2A93, 0x22D6, 0x297C, 0xD835, 0xDD29, 0x2A91, 0x296A, 0x2584, 0x0459,
+    0x296B, 0x25FA, 0x0140, 0x23B0, 0x2268, 0x2A89, 0x2A87, 0x22E6, 0x27EC, 0x21FD, 0x27FC, 0x21AC, 0x2985, 0xD835, 0xDD5D,
+    0x2A2D, 0x2A34, 0x2217, 0x25CA, 0x0028, 0x2993, 0x296D, 0x200E, 0x22BF, 0x2039, 0xD835, 0xDCC1, 0x2A8D, 0x2A8F, 0x201A,
+    0x0142, 0x2AA6, 0x2A79, 0x22C9, 0x2976, 0x2A7B, 0x2996, 0x25C3, 0x294A, 0x2966, 0x2268, 0xFE00, 0x223A, 0x2642, 0x2720,
+    0x25AE, 0x2A29, 0x043C, 0x2014, 0xD835, 0xDD2A, 0x2127, 0x00B5, 0x2AF0, 0x2212, 0x2A2A, 0x2ADB, 0x22A7, 0xD835, 0xDD5E,
+    0xD835, 0xDCC2, 0x03BC, 0x22B8, 0x22D9, 0x0338, 0x226B, 0x20D2, 0x21CD, 0x21CE, 0x22D8, 0x0338, 0x226A, 0x20D2, 0x21CF,
+    0x22AF, 0x22AE, 0x0144, 0x2220, 0x20D2, 0x2A70, 0x0338, 0x224B, 0x0338, 0x0149, 0x2A43, 0x0148, 0x0146, 0x2A6D, 0x0338,
+    0x2A42, 0x043D, 0x2013, 0x21D7, 0x2924, 0x2250, 0x0338, 0x2928, 0xD835, 0xDD2B, 0x21AE, 0x2AF2, 0x22FC, 0x22FA, 0x045A,
+    0x2266, 0x0338, 0x219A, 0x2025, 0xD835, 0xDD5F, 0x00AC, 0x22F9, 0x0338, 0x22F5, 0x0338, 0x22F7, 0x22F6, 0x22FE, 0x22FD,
+    0x2AFD, 0x20E5, 0x2202, 0x0338, 0x2A14, 0x219B, 0x2933, 0x0338, 0x219D, 0x0338, 0xD835, 0xDCC3, 0x2284, 0x2AC5, 0x0338,
+    0x2285, 0x2AC6, 0x0338, 0x00F1, 0x03BD, 0x0023, 0x2116, 0x22AD, 0x2904, 0x224D, 0x20D2, 0x22AC, 0x2265, 0x20D2, 0x003E,
+    0x20D2, 0x29DE, 0x2902, 0x2264, 0x20D2, 0x003C, 0x20D2, 0x22B4, 0x20D2, 0x2903, 0x22B5, 0x20D2, 0x223C, 0x20D2, 0x21D6,
+    0x2923, 0x2927, 0x00F3, 0x00F4, 0x043E, 0x0151, 0x2A38, 0x29BC, 0x0153, 0x29BF, 0xD835, 0xDD2C, 0x00F2, 0x29C1, 0x29B5,
+    0x29BE, 0x29BB, 0x29C0, 0x014D, 0x03C9, 0x03BF, 0x29B6, 0xD835, 0xDD60, 0x29B7, 0x29B9, 0x2228, 0x2A5D, 0x2134, 0x00AA,
+    0x00BA, 0x22B6, 0x2A56, 0x2A57, 0x2A5B, 0x00F8, 0x2298, 0x00F5, 0x2A36, 0x00F6, 0x233D, 0x2AF3, 0x2AFD, 0x043F, 0x0025,
+    0x002E, 0x2031, 0xD835, 0xDD2D, 0x03C6, 0x03D5, 0x260E, 0x03C0, 0x03D6, 0x210E, 0x002B, 0x2A23, 0x2A22, 0x2A25, 0x2A72,
+    0x2A26, 0x2A27, 0x2A15, 0xD835, 0xDD61, 0x00A3, 0x2AB3, 0x2AB7, 0x2AB9, 0x2AB5, 0x22E8, 0x2032, 0x232E, 0x2312, 0x2313,
+    0x22B0, 0xD835, 0xDCC5, 0x03C8, 0xD835, 0xDD2E, 0xD835, 0xDD62, 0x2057, 0xD835, 0xDCC6, 0x2A16, 0x003F, 0x291C, 0x2964,
+    0x223D, 0x0331, 0x0155, 0x29B3, 0x2992, 0x29A5, 0x00BB, 0x2975, 0x2920, 0x2933, 0x291E, 0x2945, 0x2974, 0x21A3, 0x219D,
+    0x291A, 0x2236, 0x2773, 0x007D, 0x005D, 0x298C, 0x298E, 0x2990, 0x0159, 0x0157, 0x0440, 0x2937, 0x2969, 0x21B3, 0x25AD,
+    0x297D, 0xD835, 0xDD2F, 0x296C, 0x03C1, 0x03F1, 0x21C9, 0x22CC, 0x200F, 0x23B1, 0x2AEE, 0x27ED, 0x21FE, 0x2986, 0xD835,
+    0xDD63, 0x2A2E, 0x2A35, 0x0029, 0x2994, 0x2A12, 0x203A, 0xD835, 0xDCC7, 0x22CA, 0x25B9, 0x29CE, 0x2968, 0x211E, 0x015B,
+    0x2AB4, 0x2AB8, 0x0161, 0x015F, 0x015D, 0x2AB6, 0x2ABA, 0x22E9, 0x2A13, 0x0441, 0x22C5, 0x2A66, 0x21D8, 0x003B, 0x2929,
+    0x2736, 0xD835, 0xDD30, 0x0449, 0x0448, 0x00AD, 0x03C3, 0x03C2, 0x2A6A, 0x2A9E, 0x2AA0, 0x2A9D, 0x2A9F, 0x2246, 0x2A24,
+    0x2972, 0x2A33, 0x29E4, 0x2323, 0x2AAA, 0x2AAC, 0x2AAC, 0xFE00, 0x044C, 0x002F, 0x29C4, 0x233F, 0xD835, 0xDD64, 0x2660,
+    0x2293, 0xFE00, 0x2294, 0xFE00, 0xD835, 0xDCC8, 0x2606, 0x2282, 0x2AC5, 0x2ABD, 0x2AC3, 0x2AC1, 0x2ACB, 0x228A, 0x2ABF,
+    0x2979, 0x2AC7, 0x2AD5, 0x2AD3, 0x00B9, 0x00B2, 0x00B3, 0x2AC6, 0x2ABE, 0x2AD8, 0x2AC4, 0x27C9, 0x2AD7, 0x297B, 0x2AC2,
+    0x2ACC, 0x228B, 0x2AC0, 0x2AC8, 0x2AD4, 0x2AD6, 0x21D9, 0x292A, 0x00DF, 0x2316, 0x03C4, 0x0165, 0x0163, 0x0442, 0x2315,
+    0xD835, 0xDD31, 0x03B8, 0x03D1, 0x00FE, 0x00D7, 0x2A31, 0x2A30, 0x2336, 0x2AF1, 0xD835, 0xDD65, 0x2ADA, 0x2034, 0x25B5,
+    0x225C, 0x25EC, 0x2A3A, 0x2A39, 0x29CD, 0x2A3B, 0x23E2, 0xD835, 0xDCC9, 0x0446, 0x045B, 0x0167, 0x2963, 0x00FA, 0x045E,
+    0x016D, 0x00FB, 0x0443, 0x0171, 0x297E, 0xD835, 0xDD32, 0x00F9, 0x2580, 0x231C, 0x230F, 0x25F8, 0x016B, 0x0173, 0xD835,
+    0xDD66, 0x03C5, 0x21C8, 0x231D, 0x230E, 0x016F, 0x25F9, 0xD835, 0xDCCA, 0x22F0, 0x0169, 0x00FC, 0x29A7, 0x2AE8, 0x2AE9,
+    0x299C, 0x228A, 0xFE00, 0x2ACB, 0xFE00, 0x228B, 0xFE00, 0x2ACC, 0xFE00, 0x0432, 0x22BB, 0x225A, 0x22EE, 0xD835, 0xDD33,
+    0xD835, 0xDD67, 0xD835, 0xDCCB, 0x299A, 0x0175, 0x2A5F, 0x2259, 0x2118, 0xD835, 0xDD34, 0xD835, 0xDD68, 0xD835, 0xDCCC,
+    0xD835, 0xDD35, 0x03BE, 0x22FB, 0xD835, 0xDD69, 0xD835, 0xDCCD, 0x00FD, 0x044F, 0x0177, 0x044B, 0x00A5, 0xD835, 0xDD36,
+    0x0457, 0xD835, 0xDD6A, 0xD835, 0xDCCE, 0x044E, 0x00FF, 0x017A, 0x017E, 0x0437, 0x017C, 0x03B6, 0xD835, 0xDD37, 0x0436,
+    0x21DD, 0xD835, 0xDD6B, 0xD835, 0xDCCF, 0x01FE, 0x01FF, 0x24EA, 0x2460, 0x2469, 0x246A, 0x246B, 0x246C, 0x246D, 0x246E,
+    0x246F, 0x2470, 0x2471, 0x2472, 0x2461, 0x2473, 0x3251, 0x3252, 0x3253, 0x3254, 0x3255, 0x3256, 0x3257, 0x3258, 0x3259,
+    0x2462, 0x325A, 0x325B, 0x325C, 0x325D, 0x325E, 0x325F, 0x32B1, 0x32B2, 0x32B3, 0x32B4, 0x2463, 0x32B5, 0x32B6, 0x32B7,
+    0x32B8, 0x32B9, 0x32BA, 0x32BB, 0x32BC, 0x32BD, 0x32BE, 0x2464, 0x32BF, 0x2465, 0x2466, 0x2467, 0x2468, 0x229C, 0x24B6,
+    0x24B7, 0x24B8, 0x24B9, 0x24BA, 0x24BB, 0x24BC, 0x24BD, 0x24BE, 0x24BF, 0x24C0, 0x24C1, 0x24C2, 0x24C3, 0x24C4, 0x24C5,
+    0x24C6, 0x24C7, 0x24C9, 0x24CA, 0x24CB, 0x24CC, 0x24CD, 0x24CE, 0x24CF, 0x24D0, 0x24D1, 0x24D2, 0x24D3, 0x24D4, 0x24D5,
+    0x24D6, 0x24D7, 0x24D8, 0x24D9, 0x24DA, 0x24DB, 0x24DC, 0x24DD, 0x24DE, 0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3, 0x24E4,
+    0x24E5, 0x24E6, 0x24E7, 0x24E8, 0x24E9, 0x25E6, 0x20A3, 0x20AD, 0x20BD, 0x20A1, 0x023A, 0x0243, 0x023B, 0x0246, 0x01E4,
+    0x0197, 0x0248, 0x024C, 0x023E, 0x024E, 0x2C65, 0x0180, 0x023C, 0x0247, 0x01E5, 0x0268, 0x0249, 0x20A5, 0x024D, 0x2C66,
+    0x024F, 0x01B6, 0x2189, 0x2152, 0x2150, 0x2151, 0x20B4, 0x20A4, 0x20A6, 0x20B1, 0x20B9, 0x20AE, 0x20A9, 0x20AB, 0x0E3F,
+    0x20A0, 0x20A2, 0x20B5, 0x01C4, 0x01C5, 0x01F1, 0x01F2, 0x018F, 0x20B2, 0x01C7, 0x01C8, 0x01CA, 0x01CB, 0x20A7, 0x20A8,
+    0x2120, 0x1E9E, 0x01EE, 0x01B7, 0x208D, 0x208E, 0x208A, 0x208B, 0x2080, 0x2081, 0x2082, 0x2083, 0x2084, 0x2085, 0x2086,
+    0x2087, 0x2088, 0x2089, 0x208C, 0x207D, 0x207E, 0x207A, 0x207B, 0x2070, 0x2074, 0x2075, 0x2076, 0x2077, 0x2078, 0x2079,
+    0x207C, 0x2071, 0x207F, 0x01C6, 0x01F3, 0x0259, 0x017F, 0x0390, 0x03B0, 0x03AA, 0x03AB, 0x03CA, 0x03CB, 0x0386, 0x0388,
+    0x0389, 0x038A, 0x038C, 0x038F, 0x038E, 0x03AC, 0x03AD, 0x03AE, 0x03AF, 0x03CC, 0x03CE, 0x03CD, 0x01C9, 0x01CC, 0x01EF,
+    0x0292, 0x20BF,
+};
+
+struct CombiningRule { const char* key; char32_t one, two, up, down; };
+
+inline constexpr CombiningRule combiningRules[] = {
+    { "'", 0x0301, 0x030B, 0x0001, 0x0317 },
+    { ")", 0x0306, 0x0000, 0x0001, 0x032E },
+    { ">", 0x030C, 0x0000, 0x0001, 0x032C },
+    { ",", 0x0327, 0x0000, 0x0313, 0x0326 },
+    { "^", 0x0302, 0x0000, 0x0001, 0x032D },
+    { "\"", 0x0308, 0x0000, 0x0001, 0x0324 },
+    { ".", 0x0307, 0x0000, 0x0001, 0x0323 },
+    { "`", 0x0300, 0x030F, 0x0001, 0x0316 },
+    { "?", 0x0309, 0x0000, 0x0001, 0x0000 },
+    { "+", 0x031B, 0x0000, 0x0001, 0x0000 },
+    { "-", 0x0304, 0x0000, 0x0001, 0x0331 },
+    { ";", 0x0328, 0x0000, 0x1DCE, 0x0001 },
+    { "*", 0x030A, 0x0000, 0x0001, 0x0325 },
+    { "~", 0x0303, 0x0000, 0x0001, 0x0330 },
+    { "_", 0x0332, 0x0333, 0x0305, 0x0001 },
+};
+
+inline constexpr uint8_t noCategory = 0xFF;
+
+inline constexpr const char* categories[] = {
+    "Spacing diacritics",
+    "Quotation marks",
+    "Superscripts and subscripts",
+    "Fractions",
+    "Latin letters with strokes",
+    "Circled numbers, letters and mathematical signs",
+    "Latin Ligatures, digraphs and extended letters",
+    "Currency signs",
+    "Greek alphabet",
+    "Spaces",
+    "Arrows",
+    "Remaining ISO-8859-1 symbols",
+    "Remaining Windows-1252 symbols",
+    "More symbols",
+    "HTML named character references",
+};
+
+inline constexpr uint8_t nodeCategories[] = {  // index in categories for each complete node, else noCategory
+    255, 255, 9, 255, 13, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 0, 0, 255, 13, 255, 255, 255, 255, 255, 10, 255, 255, 255,
+    255, 10, 255, 255, 255, 255, 255, 10, 255, 255, 10, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 0, 255, 11, 13, 11, 11, 11, 11,
+    255, 0, 1, 1, 1, 1, 255, 13, 13, 13, 13, 13, 13, 13, 255, 12, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255,
+    255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255,
+    14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255,
+    255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14,
+    255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14,
+    255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255,
+    255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255,
+    14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255,
+    255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 14,
+    255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14,
+    255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255,
+    14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 14, 255,
+    255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14,
+    255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255,
+    14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14,
+    255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14,
+    255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255,
+    14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255,
+    14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255,
+    14, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 14,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    255, 14, 255, 14, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14,
+    255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255,
+    255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255,
+    255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255,
+    14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14,
+    255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255,
+    255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255,
+    14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255,
+    14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255,
+    255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255,
+    255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14,
+    255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255,
+    14, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255,
+    255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255,
+    255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255,
+    14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255,
+    14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14,
+    255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    14, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255,
+    255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255,
+    255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255,
+    255, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14,
+    255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 14,
+    255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255,
+    14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14,
+    255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255,
+    255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14,
+    255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255,
+    255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14,
+    255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255,
+    14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14,
+    255, 255, 14, 255, 14, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255,
+    14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 14,
+    255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255,
+    14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14,
+    255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    14, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255,
+    255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255,
+    14, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 14, 255,
+    255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255,
+    255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 14,
+    255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255,
+    14, 255, 14, 255, 14, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 14, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    14, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14,
+    255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255,
+    255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14,
+    255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14,
+    255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14,
+    255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 255,
+    14, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255,
+    255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 14,
+    255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255,
+    14, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 14, 255, 255, 255,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255,
+    255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255,
+    255, 255, 14, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 14, 255, 255,
+    255, 14, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255, 255, 255, 255, 255, 14, 255, 14, 255, 255, 255, 14,
+    255, 255, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 255, 255, 14, 255, 255, 255, 255, 255, 255, 14, 255,
+    255, 255, 14, 255, 255, 255, 14, 255, 255, 14, 255, 255, 14, 255, 0, 1, 255, 4, 4, 1, 1, 1, 255, 255, 255, 5, 255,
+    5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5,
+    255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255,
+    5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5,
+    255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255,
+    5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5,
+    255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255,
+    5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5,
+    255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 5, 255, 0, 255, 0, 12, 11, 11, 13, 255, 11, 255,
+    0, 1, 1, 255, 0, 11, 255, 11, 12, 13, 11, 7, 7, 7, 7, 4, 7, 7, 12, 12, 7, 4, 12, 255, 0, 11, 12, 1, 1, 6, 6, 255,
+    255, 4, 4, 255, 7, 13, 13, 13, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 7, 4, 4,
+    4, 4, 4, 255, 9, 11, 13, 255, 3, 255, 255, 255, 3, 3, 3, 3, 3, 3, 3, 3, 3, 255, 255, 3, 3, 255, 9, 255, 3, 3, 3, 255,
+    9, 255, 3, 255, 255, 3, 3, 255, 9, 255, 255, 3, 255, 1, 11, 255, 0, 1, 255, 1, 1, 1, 13, 1, 13, 255, 13, 13, 13, 13,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 12, 255, 0, 1, 1, 1, 13, 13, 1, 255, 13, 11, 255, 4, 6, 255,
+    4, 7, 255, 4, 7, 7, 11, 7, 7, 255, 4, 255, 6, 6, 6, 6, 6, 255, 4, 7, 6, 255, 7, 6, 6, 255, 4, 7, 255, 4, 7, 255, 4,
+    6, 255, 4, 255, 7, 255, 7, 4, 7, 6, 6, 255, 7, 6, 6, 13, 6, 13, 255, 255, 4, 4, 11, 6, 11, 11, 7, 255, 11, 7, 7, 11,
+    7, 255, 4, 7, 11, 7, 255, 11, 13, 11, 6, 255, 4, 4, 7, 6, 12, 255, 7, 255, 7, 255, 4, 7, 255, 4, 255, 6, 6, 255, 255,
+    255, 255, 255, 255, 10, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 10, 255, 255, 255, 255,
+    255, 10, 255, 255, 255, 255, 255, 10, 255, 255, 255, 255, 255, 255, 10, 255, 255, 255, 255, 255, 255, 10, 255, 255,
+    255, 10, 2, 2, 11, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 10, 11, 2, 2, 11, 255, 0, 255, 0, 255, 4,
+    6, 255, 4, 255, 4, 7, 11, 7, 255, 4, 7, 255, 6, 6, 6, 255, 4, 7, 6, 255, 7, 6, 6, 6, 6, 255, 255, 255, 8, 8, 8, 8,
+    8, 8, 255, 255, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 7, 255, 9, 4, 7,
+    255, 6, 4, 6, 255, 9, 6, 4, 255, 6, 255, 7, 4, 7, 6, 255, 9, 12, 7, 11, 255, 9, 12, 6, 6, 255, 11, 255, 255, 4, 13,
+    4, 11, 6, 11, 11, 11, 7, 255, 9, 11, 7, 7, 11, 255, 4, 7, 11, 255, 11, 12, 11, 13, 11, 6, 255, 9, 4, 4, 6, 12, 255,
+    9, 7, 11, 255, 4, 7, 255, 9, 4, 255, 6, 6, 255, 9, 9, 9, 255, 255, 11, 12, 12, 7, 7, 7, 7, 7, 255, 7, 7, 255, 0, 13,
+};
+
+inline SequenceTrie trie() {
+    return SequenceTrie(nodes, edges, std::u16string_view(text, std::size(text)));
+}
+
+}
@@ -0,0 +1,142 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include "ComposeEngine.h"
+#include "DefinitionsParser.h"
+#include "FixedString.h"
+#include "UnicodeFormatTranslation.h"
+
+// analyzeDefinitions finds the explicit sequences in compiled definitions that can't be typed, or that hide something
+// else that could be typed, and adds them to a DefinitionsReport (see DefinitionsParser.h); duplicate keys and
+// overrides are found while the definitions are parsed, by passing the same report to ComposeDefinitions::overlay.
+//
+// A sequence is shadowed when a shorter sequence that begins it is complete, since the engine sends the shorter one
+// as soon as it is typed. A sequence that isn't shadowed is typed, key by key, into an engine with the same combining
+// rules and no explicit sequences: if the keys make an implicit combination (complete, or able to continue) whose
+// composition differs from the sequence's output, the sequence hides it. Keys are taken one code point at a time,
+// except that a bracketed name, like [Up], is one key.
+//
+// Every sequence is checked for shadowing, so the analysis of definitions laid over the built-in ones includes the
+// built-in sequences a user file shadows. Only the sequences the file defines or changes are checked against implicit
+// combinations, though, since the built-in ones that hide a combination do so on purpose. Keys that leave a modifier
+// key, like [Up], pending when the sequence ends make no combination, so they hide none. The time taken is about
+// proportional to the total length of the keys.
+//
+// void analyzeDefinitions(const ComposeDefinitions& definitions, DefinitionsReport& report,
+//                         const SequenceTrie* base = 0)
+//     Adds the shadowed sequences and those that hide implicit combinations or #x entry to report. If base is given
+//     (the sequences the file was laid over), a sequence with the same key and output in base is not checked for
+//     hiding an implicit combination or #x entry; otherwise every sequence is.
+
+namespace definitionsAnalyzer {
+
+    // Collects the composition and the keys left over, which the engine sends in separate calls.
+
+    class Capture : public ComposeEngine::OutputSink {
+    public:
+        FixedString<char16_t, 256> composed;
+        FixedString<char16_t, 512> leftOver;
+        int                        sends = 0;
+        void send(std::u16string_view s) override {
+            if (sends++ == 0) composed.assign(s);
+            else leftOver.append(s);
+        }
+        void clear() { composed.clear(); leftOver.clear(); sends = 0; }
+    };
+
+    // Returns the length of the first key in s: a bracketed name, or one code point.
+
+    inline size_t keyLength(std::u16string_view s) {
+        if (s[0] == u'[') {
+            const size_t close = s.find_first_of(u"[]", 1);
+            if (close != std::u16string_view::npos && close > 2 && s[close] == u']') return close + 1;
+        }
+        return s.length() > 1 && s[0] >= 0xD800 && s[0] < 0xDC00 && s[1] >= 0xDC00 && s[1] < 0xE000 ? 2 : 1;
+    }
+
+    inline bool isHexDigit(std::u16string_view key) {
+        if (key.length() != 1) return false;
+        const char16_t c = key[0];
+        return (c >= u'0' && c <= u'9') || (c >= u'a' && c <= u'f') || (c >= u'A' && c <= u'F');
+    }
+
+}
+
+inline void analyzeDefinitions(const ComposeDefinitions& definitions, DefinitionsReport& report,
+                               const SequenceTrie* base = 0) {
+
+    using namespace definitionsAnalyzer;
+
+    auto implicitOnly = std::make_shared<ComposeDefinitions>();
+    implicitOnly->combiningRules = definitions.combiningRules;
+    implicitOnly->indexCombiningRules();
+    ComposeEngine engine;
+    Capture capture;
+    char16_t text[256];
+
+    const SequenceTrie& trie = definitions.sequences;
+    trie.forEach([&](std::string_view key, std::u16string_view output) {
+
+        SequenceTrie::State state = SequenceTrie::root;
+        for (size_t i = 0; i + 1 < key.length(); ++i) {
+            state = trie.next(state, key.substr(i, 1));
+            if (trie.complete(state)) {
+                report.add(DefinitionsIssue::Shadowed, key, output, trie.output(state), key.substr(0, i + 1));
+                return;
+            }
+        }
+
+        if (base) {
+            const SequenceTrie::State inBase = base->next(SequenceTrie::root, key);
+            if (base->complete(inBase) && base->output(inBase) == output) return;
+        }
+
+        const size_t length = utf8to16(key, text);
+        if (length == 0 || length > std::size(text)) return;
+        const std::u16string_view keys(text, length);
+        engine.start(implicitOnly);
+        capture.clear();
+        size_t keyCount = 0;
+        bool   hex = true;
+        for (size_t i = 0; i < keys.length() && engine.composing();) {
+            const size_t n = keyLength(keys.substr(i));
+            if (keyCount++ < 2) hex = hex && isHexDigit(keys.substr(i, n));
+            engine.key(keys.substr(i, n), capture);
+            i += n;
+            if (!engine.composing() && i < keys.length()) return;  // the combination ended before the last key
+        }
+        if (engine.composing()) {
+            engine.restart(capture);
+            engine.cancel();
+        }
+        if (!capture.leftOver.empty() || capture.composed == output) return;
+        const std::u16string_view composed = capture.composed;
+        if (composed.empty() || composed.ends_with(u"[Up]") || composed.ends_with(u"[Down]")) return;  // nothing combined
+        report.add(hex && keyCount >= 2 ? DefinitionsIssue::HexEntry : DefinitionsIssue::Implicit, key, output, composed);
+
+    });
+
+}
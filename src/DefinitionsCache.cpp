@@ -0,0 +1,302 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// A compiled copy of the definitions in effect when a user definitions file is used (the built-in sequences with the
+// user file laid over them, and the combining rules) is kept in Compose.cache in the plugins configuration directory.
+// When the user definitions file has not changed, readDefinitionsCache maps the cache into memory and uses it
+// directly, so the user file does not have to be read or parsed; the cache also holds the trie's node summaries and
+// choice lists (see SequenceTrie.h), so they are not computed again either, and the counts of duplicate and overriding
+// sequences found while the file was parsed.
+//
+// The cache is keyed by the user file's path, size and last write time, and by a hash of its content; if only the
+// time has changed (the file was touched or copied) but the content hash still matches, the cache is used and rewritten.
+// The header also records the cache format version, the layout of the structures and a hash of the built-in
+// definitions, so a cache made by a different version of the plugin is ignored. All positions in the file are offsets
+// from its beginning, and everything is bounds-checked before use, so a damaged cache is simply rebuilt.
+//
+// These run on the loader thread (see LoadSequenceDefinitions.cpp), so they take the cache file path as an argument
+// rather than asking Notepad++ for it; one load at a time is guaranteed by the loader.
+//
+// bool readDefinitionsCache(const std::wstring& cacheFile, const std::wstring& userFile, std::string& content,
+//                           ComposeDefinitions& definitions)
+//     If a valid cache exists for userFile, sets definitions.sequences, definitions.combiningRules and
+//     definitions.issueCounts from it and returns true. Otherwise returns false; if the user file was read to check its hash, its bytes are left in content.
+//
+// void writeDefinitionsCache(const std::wstring& cacheFile, const std::wstring& userFile, const std::string& content,
+//                            const ComposeDefinitions& definitions)
+//     Writes definitions.sequences, definitions.combiningRules and definitions.issueCounts to the cache for userFile, whose bytes are content.
+//     Must follow a call to readDefinitionsCache for the same file, which records its size and time.
+
+#include "Framework/PluginFramework.h"
+#include "Framework/UtilityFramework.h"
+#include "CommonData.h"
+#include "DefaultSequences.h"
+
+void writeDefinitionsCache(const std::wstring& cacheFile, const std::wstring& userFile, const std::string& content,
+                           const ComposeDefinitions& definitions);
+
+namespace {
+
+    constexpr char     cacheMagic[8] = { 'C', 'o', 'm', 'p', 'o', 's', 'e', 'C' };
+    constexpr uint32_t cacheVersion  = 5;
+    constexpr uint32_t cacheLayout   = sizeof(SequenceTrie::Node) | sizeof(SequenceTrie::Edge) << 8 | sizeof(wchar_t) << 16
+                                     | sizeof(SequenceTrie::Summary) << 24;
+
+    struct Section {
+        uint32_t offset;
+        uint32_t count;
+    };
+
+    struct CacheHeader {
+        char     magic[8];
+        uint32_t version;
+        uint32_t layout;
+        uint64_t builtinHash;
+        uint64_t fileSize;
+        uint64_t fileTime;
+        uint64_t contentHash;
+        uint32_t issueCounts[5];  // ComposeDefinitions::issueCounts
+        Section  path;            // wchar_t
+        Section  nodes;           // SequenceTrie::Node
+        Section  edges;           // SequenceTrie::Edge
+        Section  text;            // char16_t
+        Section  summaries;       // SequenceTrie::Summary
+        Section  choices;         // SequenceTrie::State
+        Section  combining;       // CombiningRule
+    };
+
+    struct FileKey {
+        std::wstring path;
+        uint64_t     size = 0;
+        uint64_t     time = 0;
+    } lastKey;  // set by readDefinitionsCache for writeDefinitionsCache
+
+    uint64_t fnv1a(std::string_view s) {
+        uint64_t h = 0xCBF29CE484222325ull;
+        for (const char c : s) h = (h ^ static_cast<unsigned char>(c)) * 0x100000001B3ull;
+        return h;
+    }
+
+    bool getFileKey(const std::wstring& path, FileKey& key) {
+        WIN32_FILE_ATTRIBUTE_DATA attributes;
+        if (!GetFileAttributesEx(path.data(), GetFileExInfoStandard, &attributes)) return false;
+        key.path = path;
+        key.size = static_cast<uint64_t>(attributes.nFileSizeHigh) << 32 | attributes.nFileSizeLow;
+        key.time = static_cast<uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32
+                 | attributes.ftLastWriteTime.dwLowDateTime;
+        return true;
+    }
+
+    bool readFile(const std::wstring& path, std::string& content) {
+        HANDLE file = CreateFile(path.data(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, 0, OPEN_EXISTING, 0, 0);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER size;
+        bool ok = GetFileSizeEx(file, &size) && size.QuadPart < 0x7FFFFFFF;
+        if (ok) {
+            content.resize(static_cast<size_t>(size.QuadPart));
+            DWORD read = 0;
+            ok = content.empty() || (ReadFile(file, content.data(), static_cast<DWORD>(content.size()), &read, 0)
+                                     && read == content.size());
+        }
+        CloseHandle(file);
+        if (!ok) content.clear();
+        return ok;
+    }
+
+    // Maps the cache file and returns a pointer to the view that unmaps it when the last copy is released.
+
+    std::shared_ptr<const void> mapCache(const std::wstring& path, size_t& size) {
+        HANDLE file = CreateFile(path.data(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, 0, OPEN_EXISTING, 0, 0);
+        if (file == INVALID_HANDLE_VALUE) return {};
+        LARGE_INTEGER fileSize;
+        HANDLE mapping = 0;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart >= static_cast<LONGLONG>(sizeof(CacheHeader))
+                                           && fileSize.QuadPart < 0x7FFFFFFF)
+            mapping = CreateFileMapping(file, 0, PAGE_READONLY, 0, 0, 0);
+        CloseHandle(file);
+        if (!mapping) return {};
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!view) return {};
+        size = static_cast<size_t>(fileSize.QuadPart);
+        return std::shared_ptr<const void>(view, [](const void* p) { UnmapViewOfFile(p); });
+    }
+
+    template<typename T> bool sectionValid(const Section& section, size_t fileSize) {
+        return section.offset % alignof(T) == 0 && section.offset <= fileSize
+            && section.count <= (fileSize - section.offset) / sizeof(T);
+    }
+
+    template<typename T> std::span<const T> sectionSpan(const void* base, const Section& section) {
+        return std::span<const T>(reinterpret_cast<const T*>(static_cast<const char*>(base) + section.offset), section.count);
+    }
+
+}
+
+
+bool readDefinitionsCache(const std::wstring& cacheFile, const std::wstring& userFile, std::string& content,
+                          ComposeDefinitions& definitions) {
+
+    content.clear();
+    lastKey = FileKey();
+    FileKey key;
+    if (!getFileKey(userFile, key)) return false;
+    lastKey = key;
+
+    size_t size = 0;
+    std::shared_ptr<const void> view = mapCache(cacheFile, size);
+    if (!view) return false;
+    const CacheHeader& header = *static_cast<const CacheHeader*>(view.get());
+
+    if (memcmp(header.magic, cacheMagic, sizeof cacheMagic) || header.version != cacheVersion
+        || header.layout != cacheLayout || header.builtinHash != defaultSequences::sourceHash) return false;
+    if ( !sectionValid<wchar_t           >(header.path         , size) || !sectionValid<SequenceTrie::Node>(header.nodes, size)
+      || !sectionValid<SequenceTrie::Edge>(header.edges        , size) || !sectionValid<char16_t          >(header.text , size)
+      || !sectionValid<SequenceTrie::Summary>(header.summaries, size) || !sectionValid<SequenceTrie::State>(header.choices, size)
+      || !sectionValid<CombiningRule     >(header.combining, size) )
+        return false;
+
+    const auto path = sectionSpan<wchar_t>(view.get(), header.path);
+    if (std::wstring_view(path.data(), path.size()) != userFile || header.fileSize != key.size) return false;
+    bool refresh = false;
+    if (header.fileTime != key.time) {
+        if (!readFile(userFile, content) || fnv1a(content) != header.contentHash) return false;
+        refresh = true;
+    }
+
+    const auto nodes = sectionSpan<SequenceTrie::Node>(view.get(), header.nodes);
+    const auto edges = sectionSpan<SequenceTrie::Edge>(view.get(), header.edges);
+    const auto text  = sectionSpan<char16_t          >(view.get(), header.text );
+    if (nodes.empty()) return false;
+    for (uint32_t state = 0; state < nodes.size(); ++state) {
+        const auto& node = nodes[state];
+        if (node.firstEdge > edges.size() || node.edgeCount > edges.size() - node.firstEdge) return false;
+        if (node.outputOffset != SequenceTrie::noOutput
+            && (node.outputOffset > text.size() || node.outputLength > text.size() - node.outputOffset)) return false;
+        // build numbers nodes depth-first, so every edge leads forward; this also rules out cycles
+        for (uint32_t e = node.firstEdge; e < node.firstEdge + node.edgeCount; ++e)
+            if (edges[e].target <= state || edges[e].target >= nodes.size()) return false;
+    }
+
+    // the summaries and choices are used as they are, so every state they give must be a complete node
+    const auto summaries = sectionSpan<SequenceTrie::Summary>(view.get(), header.summaries);
+    const auto choices   = sectionSpan<SequenceTrie::State  >(view.get(), header.choices  );
+    auto completeState = [&](SequenceTrie::State state) {
+        return state < nodes.size() && nodes[state].outputOffset != SequenceTrie::noOutput;
+    };
+    if (summaries.size() != nodes.size()) return false;
+    for (const auto& summary : summaries) {
+        if (summary.only != SequenceTrie::dead && !completeState(summary.only)) return false;
+        if (summary.choices > choices.size()
+            || std::min(summary.completions, SequenceTrie::maxChoices) > choices.size() - summary.choices) return false;
+    }
+    for (const SequenceTrie::State choice : choices) if (!completeState(choice)) return false;
+
+    const auto combining = sectionSpan<CombiningRule>(view.get(), header.combining);
+    for (size_t i = 0; i < combining.size(); ++i)
+        if (!combining[i].key || (i > 0 && combining[i].key <= combining[i - 1].key)) return false;
+
+    definitions.sequences = SequenceTrie(nodes, edges, std::u16string_view(text.data(), text.size()), summaries, choices, view);
+    definitions.combiningRules.assign(combining.begin(), combining.end());
+    definitions.indexCombiningRules();
+    std::copy(std::begin(header.issueCounts), std::end(header.issueCounts), definitions.issueCounts);
+    if (refresh) writeDefinitionsCache(cacheFile, userFile, content, definitions);
+    return true;
+
+}
+
+
+void writeDefinitionsCache(const std::wstring& cacheFile, const std::wstring& userFile, const std::string& content,
+                           const ComposeDefinitions& definitions) {
+
+    if (lastKey.path != userFile) return;
+
+    const auto nodes = definitions.sequences.nodeArray();
+    const auto edges = definitions.sequences.edgeArray();
+    const auto text  = definitions.sequences.textArray();
+    const auto summaries = definitions.sequences.summaryArray();
+    const auto choices   = definitions.sequences.choiceArray();
+
+    const auto& combining = definitions.combiningRules;
+
+    CacheHeader header = {};
+    memcpy(header.magic, cacheMagic, sizeof cacheMagic);
+    header.version     = cacheVersion;
+    header.layout      = cacheLayout;
+    header.builtinHash = defaultSequences::sourceHash;
+    header.fileSize    = lastKey.size;
+    header.fileTime    = lastKey.time;
+    header.contentHash = fnv1a(content);
+    for (size_t i = 0; i < std::size(header.issueCounts); ++i)
+        header.issueCounts[i] = static_cast<uint32_t>(definitions.issueCounts[i]);
+
+    size_t size = sizeof header;
+    auto place = [&](Section& section, size_t count, size_t elementSize) {
+        size = (size + 7) & ~size_t(7);
+        section = { static_cast<uint32_t>(size), static_cast<uint32_t>(count) };
+        size += count * elementSize;
+    };
+    place(header.path         , userFile.length()     , sizeof(wchar_t           ));
+    place(header.nodes        , nodes.size()          , sizeof(SequenceTrie::Node));
+    place(header.edges        , edges.size()          , sizeof(SequenceTrie::Edge));
+    place(header.text         , text.length()         , sizeof(char16_t          ));
+    place(header.summaries    , summaries.size()      , sizeof(SequenceTrie::Summary));
+    place(header.choices      , choices.size()        , sizeof(SequenceTrie::State));
+    place(header.combining    , combining.size()      , sizeof(CombiningRule));
+    if (size >= 0x7FFFFFFF) return;
+
+    std::vector<char> buffer(size, 0);
+    auto copy = [&](const Section& section, const void* source, size_t bytes) {
+        if (bytes) memcpy(buffer.data() + section.offset, source, bytes);
+    };
+    copy({ 0, 1 }              , &header             , sizeof header);
+    copy(header.path           , userFile.data()     , userFile.length()      * sizeof(wchar_t));
+    copy(header.nodes          , nodes.data()        , nodes.size_bytes());
+    copy(header.edges          , edges.data()        , edges.size_bytes());
+    copy(header.text           , text.data()         , text.length()          * sizeof(char16_t));
+    copy(header.summaries      , summaries.data()    , summaries.size_bytes());
+    copy(header.choices        , choices.data()      , choices.size_bytes());
+    copy(header.combining      , combining.data()    , combining.size()       * sizeof(CombiningRule));
+
+    // Write to a temporary file, then move it into place. If the old cache is still mapped (by this or another
+    // instance of Notepad++) it can't be replaced, but it can be renamed; renamed files are deleted when possible.
+
+    const std::wstring& path = cacheFile;
+    const std::wstring temp = path + L".tmp";
+    HANDLE file = CreateFile(temp.data(), GENERIC_WRITE, 0, 0, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, 0);
+    if (file == INVALID_HANDLE_VALUE) return;
+    DWORD written = 0;
+    const bool ok = WriteFile(file, buffer.data(), static_cast<DWORD>(buffer.size()), &written, 0) && written == buffer.size();
+    CloseHandle(file);
+    if (!ok) {
+        DeleteFile(temp.data());
+        return;
+    }
+    if (!MoveFileEx(temp.data(), path.data(), MOVEFILE_REPLACE_EXISTING)) {
+        const std::wstring old = path + L"." + std::to_wstring(GetTickCount64()) + L".old";
+        if (!MoveFileEx(path.data(), old.data(), 0) || !MoveFileEx(temp.data(), path.data(), 0)) DeleteFile(temp.data());
+    }
+
+    const std::wstring directory = path.substr(0, path.find_last_of(L'\\') + 1);
+    WIN32_FIND_DATA found;
+    HANDLE search = FindFirstFile((path + L".*.old").data(), &found);
+    if (search != INVALID_HANDLE_VALUE) {
+        do DeleteFile((directory + found.cFileName).data());
+        while (FindNextFile(search, &found));
+        FindClose(search);
+    }
+
+}
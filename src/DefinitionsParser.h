@@ -0,0 +1,336 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include "nlohmann/json.hpp"
+#include "SequenceTrie.h"
+#include "UnicodeFormatTranslation.h"
+
+// parseDefinitions reads a sequence definitions file (JSON, comments allowed) with nlohmann's SAX interface and lays it
+// over a base set of sequences, without building a JSON document in memory.
+//
+// Keys are copied once, as they are parsed, into a single arena string, and values are converted to UTF-16 into
+// another; entries record offsets into them.
+// After parsing, the entries are sorted by key (the last of any duplicates wins, as when a document is parsed),
+// merged with the base sequences and compiled into a SequenceTrie. A sequence whose value is not a string
+// (usually null) removes the base sequence with the same key.
+//
+// The object "implicit combining rules", if present, replaces the base combining rules; its rows are returned in
+// combiningRules. If any row is malformed, combiningRules is empty (so there are no implicit combinations).
+//
+// ParsedDefinitions parseDefinitions(std::string_view content, const SequenceTrie& base, ParsePhases* phases = 0,
+//                                    DefinitionsReport* report = 0)
+//     Returns the result; valid is false if content is not a JSON object, and error then says why (the parser's
+//     message, with the line and column, if it is not valid JSON).
+//     If phases is given, the time taken by each phase is recorded in it (for benchmarks).
+//     If report is given, duplicate keys and keys that replace a base sequence with a different output are added
+//     to it as they are merged (see DefinitionsAnalyzer.h for the rest of the analysis).
+
+struct ParsedDefinitions {
+    struct CombiningRow {
+        std::string key;
+        char32_t one, two, up, down;
+    };
+    bool                      valid = false;
+    std::string               error;  // why content is not valid, if it isn't
+    SequenceTrie              sequences;
+    bool                      replacesCombiningRules = false;
+    std::vector<CombiningRow> combiningRules;
+};
+
+// DefinitionsReport collects problems found in definitions: by parseDefinitions, and by analyzeDefinitions
+// (DefinitionsAnalyzer.h). Each issue names a sequence (its key, as UTF-8) and its output, and another sequence or
+// output that it conflicts with:
+//
+//     Duplicate  the key is defined more than once; output is the definition that is used, other the one replaced
+//     Override   the key replaces a base sequence (usually a built-in one); other is the base output
+//     Shadowed   a shorter sequence, otherKey, is complete, so this one can't be typed (unless longest match is on)
+//     Implicit   the keys also make an implicit combination, other, which this sequence hides
+//     HexEntry   the sequence begins with two hexadecimal digits, so it hides #x entry of other
+//
+// counts has the number of issues of each kind; only the first limit issues are kept in issues.
+
+struct DefinitionsIssue {
+    enum Kind : uint8_t { Duplicate, Override, Shadowed, Implicit, HexEntry };
+    Kind           kind;
+    std::string    key;
+    std::u16string output;
+    std::string    otherKey;
+    std::u16string other;
+};
+
+struct DefinitionsReport {
+    size_t                        counts[5] = {};
+    std::vector<DefinitionsIssue> issues;
+    size_t                        limit = SIZE_MAX;
+    void add(DefinitionsIssue::Kind kind, std::string_view key, std::u16string_view output,
+             std::u16string_view other, std::string_view otherKey = {}) {
+        ++counts[kind];
+        if (issues.size() >= limit) return;
+        issues.push_back({ kind, std::string(key), std::u16string(output), std::string(otherKey), std::u16string(other) });
+    }
+};
+
+// ParsePhases holds the milliseconds taken by the phases of loading definitions: parse, sort, merge and build
+// are set by parseDefinitions, and combining (setting the combining rules) by ComposeDefinitions::overlay.
+
+struct ParsePhases {
+    double parse     = 0;
+    double sort      = 0;
+    double merge     = 0;
+    double build     = 0;
+    double combining = 0;
+};
+
+namespace definitionsParser {
+
+    // Returns the milliseconds since the last call, and restarts the count.
+
+    inline double lap(std::chrono::steady_clock::time_point& since) {
+        const auto now = std::chrono::steady_clock::now();
+        const double elapsed = std::chrono::duration<double, std::milli>(now - since).count();
+        since = now;
+        return elapsed;
+    }
+
+    inline constexpr std::string_view combiningRulesKey = "implicit combining rules";
+
+    class Reader {
+
+    public:
+
+        using json = nlohmann::json;
+
+        struct Entry {
+            uint32_t keyOffset;
+            uint32_t keyLength;
+            uint32_t valueOffset;
+            uint32_t valueLength;
+            bool     remove;
+        };
+
+        std::string        arena;
+        std::u16string     valueArena;
+        std::vector<Entry> entries;
+        ParsedDefinitions& result;
+        bool               rootIsObject = false;
+
+    private:
+
+        size_t      depth = 0;           // number of containers open
+        std::string currentKey;          // most recent key
+        bool        inCombining = false; // inside the "implicit combining rules" object
+        bool        combiningValid = true;
+        ParsedDefinitions::CombiningRow row = {};
+        size_t      rowCount = 0;
+        bool        rowFirstIsString = false;
+
+        uint32_t store(std::string_view s) {
+            const uint32_t offset = static_cast<uint32_t>(arena.length());
+            arena += s;
+            return offset;
+        }
+
+        void addEntry(const std::string* value) {
+            const uint32_t keyOffset   = store(currentKey);
+            const uint32_t valueOffset = static_cast<uint32_t>(valueArena.length());
+            if (value) {
+                const std::wstring w = utf8to16(*value);
+                valueArena.append(w.begin(), w.end());
+            }
+            entries.push_back({ keyOffset, static_cast<uint32_t>(currentKey.length()), valueOffset,
+                                static_cast<uint32_t>(valueArena.length() - valueOffset), !value });
+        }
+
+        void invalidateCombining() {
+            combiningValid = false;
+            result.combiningRules.clear();
+        }
+
+        // Handles any scalar value; text is null unless the value is a string, flag is -1 unless it is a boolean.
+
+        bool scalar(const std::string* text, int flag) {
+            if (depth == 0) return true;
+            if (depth == 1) {
+                addEntry(text);
+                if (currentKey == combiningRulesKey) {
+                    result.replacesCombiningRules = true;
+                    invalidateCombining();
+                }
+            }
+            else if (depth == 2 && inCombining) invalidateCombining();
+            else if (depth == 3 && inCombining && combiningValid) {
+                char32_t c = 0;
+                if (text) {
+                    const std::u32string u = utf8to32(*text);
+                    if (u.length() != 1) invalidateCombining();
+                    else c = u[0];
+                    if (rowCount == 0) rowFirstIsString = true;
+                }
+                else if (flag >= 0) c = flag ? 1 : 0;
+                else invalidateCombining();
+                switch (rowCount++) {
+                case 0: row.one  = c; break;
+                case 1: row.two  = c; break;
+                case 2: row.up   = c; break;
+                case 3: row.down = c; break;
+                }
+            }
+            return true;
+        }
+
+        bool open(bool object) {
+            if (depth == 0) rootIsObject = object;
+            else if (depth == 1) {
+                addEntry(nullptr);
+                if (currentKey == combiningRulesKey) {
+                    result.replacesCombiningRules = true;
+                    result.combiningRules.clear();
+                    combiningValid = object;
+                    inCombining    = object;
+                }
+            }
+            else if (depth == 2 && inCombining) {
+                if (!object) {
+                    row = { currentKey, 0, 0, 0, 0 };
+                    rowCount = 0;
+                    rowFirstIsString = false;
+                }
+                else invalidateCombining();
+            }
+            else if (depth == 3 && inCombining) invalidateCombining();
+            ++depth;
+            return true;
+        }
+
+        bool close() {
+            --depth;
+            if (depth == 2 && inCombining && combiningValid) {
+                if (rowCount == 4 && rowFirstIsString) result.combiningRules.push_back(std::move(row));
+                else invalidateCombining();
+            }
+            else if (depth == 1) inCombining = false;
+            return true;
+        }
+
+    public:
+
+        Reader(ParsedDefinitions& result, size_t sizeHint) : result(result) {
+            arena.reserve(sizeHint);
+            valueArena.reserve(sizeHint / 4);
+        }
+
+        bool null()                                            { return scalar(nullptr, -1); }
+        bool boolean(bool b)                                   { return scalar(nullptr, b ? 1 : 0); }
+        bool number_integer(json::number_integer_t)            { return scalar(nullptr, -1); }
+        bool number_unsigned(json::number_unsigned_t)          { return scalar(nullptr, -1); }
+        bool number_float(json::number_float_t, const std::string&) { return scalar(nullptr, -1); }
+        bool string(std::string& s)                            { return scalar(&s, -1); }
+        bool binary(json::binary_t&)                           { return scalar(nullptr, -1); }
+        bool start_object(size_t)                              { return open(true); }
+        bool end_object()                                      { return close(); }
+        bool start_array(size_t)                               { return open(false); }
+        bool end_array()                                       { return close(); }
+        bool key(std::string& s)                               { currentKey = s; return true; }
+        bool parse_error(size_t, const std::string&, const nlohmann::detail::exception& e) {
+            const std::string_view what = e.what();  // "[json.exception.parse_error.101] parse error at line ..."
+            result.error = what.substr(what.find("] ") == what.npos ? 0 : what.find("] ") + 2);
+            return false;
+        }
+
+    };
+
+}
+
+inline ParsedDefinitions parseDefinitions(std::string_view content, const SequenceTrie& base, ParsePhases* phases = 0,
+                                          DefinitionsReport* report = 0) {
+
+    ParsePhases unused;
+    ParsePhases& phase = phases ? *phases : unused;
+    auto since = std::chrono::steady_clock::now();
+
+    ParsedDefinitions result;
+    definitionsParser::Reader reader(result, content.length());
+    if (!nlohmann::json::sax_parse(content.begin(), content.end(), &reader, nlohmann::json::input_format_t::json, true, true)
+        || !reader.rootIsObject) {
+        if (result.error.empty()) result.error = "the file is not a JSON object";
+        result.combiningRules.clear();
+        return result;
+    }
+    result.valid = true;
+    phase.parse = definitionsParser::lap(since);
+
+    const std::string&    arena      = reader.arena;
+    const std::u16string& valueArena = reader.valueArena;
+    const auto& entries = reader.entries;
+    auto keyOf = [&](uint32_t i) { return std::string_view(arena).substr(entries[i].keyOffset, entries[i].keyLength); };
+    std::vector<uint32_t> order(entries.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keyOf(a) < keyOf(b); });
+    phase.sort = definitionsParser::lap(since);
+
+    // The base keys are produced one at a time by forEach, so they are copied end to end into one string.
+
+    std::string baseKeys;
+    std::vector<std::pair<uint32_t, std::u16string_view>> baseRules;  // end of key in baseKeys, output in base
+    base.forEach([&](std::string_view key, std::u16string_view output) {
+        baseKeys += key;
+        baseRules.emplace_back(static_cast<uint32_t>(baseKeys.length()), output);
+    });
+
+    SequenceTrie::Rules merged;
+    merged.reserve(baseRules.size() + entries.size());
+    size_t b = 0;
+    uint32_t baseStart = 0;
+    auto baseKey = [&]() { return std::string_view(baseKeys).substr(baseStart, baseRules[b].first - baseStart); };
+    auto valueOf = [&](uint32_t i) { return std::u16string_view(valueArena).substr(entries[i].valueOffset, entries[i].valueLength); };
+    for (size_t i = 0; i < order.size(); ++i) {
+        const std::string_view key = keyOf(order[i]);
+        if (i + 1 < order.size() && keyOf(order[i + 1]) == key) /* a later duplicate wins */ {
+            if (report && key != definitionsParser::combiningRulesKey) {
+                size_t last = i + 1;
+                while (last + 1 < order.size() && keyOf(order[last + 1]) == key) ++last;
+                report->add(DefinitionsIssue::Duplicate, key, valueOf(order[last]), valueOf(order[i]));
+            }
+            continue;
+        }
+        for (; b < baseRules.size() && baseKey() < key; baseStart = baseRules[b++].first)
+            merged.emplace_back(baseKey(), baseRules[b].second);
+        const auto& entry = entries[order[i]];
+        if (b < baseRules.size() && baseKey() == key) {
+            if (report && !entry.remove && valueOf(order[i]) != baseRules[b].second)
+                report->add(DefinitionsIssue::Override, key, valueOf(order[i]), baseRules[b].second);
+            baseStart = baseRules[b++].first;
+        }
+        if (!entry.remove) merged.emplace_back(key, valueOf(order[i]));
+    }
+    for (; b < baseRules.size(); baseStart = baseRules[b++].first) merged.emplace_back(baseKey(), baseRules[b].second);
+    phase.merge = definitionsParser::lap(since);
+
+    result.sequences = SequenceTrie::build(merged);
+    phase.build = definitionsParser::lap(since);
+    return result;
+
+}
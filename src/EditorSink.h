@@ -0,0 +1,149 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <string_view>
+#include "ComposeEngine.h"
+#include "UnicodeFormatTranslation.h"
+
+// EditorSink writes composed text straight into an editor, instead of sending it as simulated keystrokes; whatever
+// one sequence sends is a single undo action. The editor is reached through the TextEditor interface, which the
+// plugin implements with Scintilla (see ProcessCompose.cpp) and tools can implement with a stand-in. Nothing here
+// allocates memory: text is translated to UTF-8 in pieces, in a fixed buffer.
+//
+// TextEditor::beginUndoAction(), TextEditor::endUndoAction()
+//     Begin and end a group of changes that is undone as one.
+//
+// TextEditor::insert(std::string_view text)
+//     Inserts UTF-8 text at each selection (there can be more than one), replacing it, and leaves the carets after
+//     the text. The first piece of text in a sequence replaces whatever was selected; the selections are then empty,
+//     so the pieces after it are simply added.
+//
+// TextEditor::finish()
+//     Called once after the last insertion of a sequence (to scroll the caret into view, for example).
+//
+// EditorSink(TextEditor& editor)
+//     Makes a sink that writes to editor.
+//
+// void send(std::u16string_view text)
+//     Writes text to the editor, beginning an undo action if this is the first text since finish.
+//
+// void finish()
+//     Ends the undo action begun by send, if any; called after each call to the engine that can send output.
+
+// void insertAtSelection(Editor& sci, std::string_view text)
+//     Inserts UTF-8 text at the only selection of a Scintilla view, as typing does: the selection is replaced (an empty
+//     one in virtual space is first filled out with spaces) and the caret left after the text. Editor is as for
+//     insertAtSelections. The insertion is made with ReplaceSel and AddText, which Scintilla reports for macro
+//     recording, so a macro recorded while composing types the same text when it is played back.
+//
+// void insertAtSelections(Editor& sci, std::string_view text)
+//     Inserts UTF-8 text at every selection of a Scintilla view, as typing does when multi-editing is on: each
+//     selection is replaced (an empty one in virtual space is first filled out with spaces) and its caret left after
+//     the text. Editor is Scintilla::ScintillaCall, or anything with the same members. Selections are taken in index
+//     order, and each one's position is read only when it is reached, so it includes the moves Scintilla has made
+//     for the insertions before it; nothing needs to be sorted or stored, however many selections there are.
+//     Each insertion is made with ReplaceTarget; the caller saves and restores the target. ReplaceTarget is not
+//     reported for macro recording, so the plugin sends text as keystrokes instead while a macro is being recorded.
+
+template<typename Editor> void insertAtSelection(Editor& sci, std::string_view text) {
+    static constexpr std::string_view spaces = "                                ";
+    using Position = decltype(sci.SelectionNCaretVirtualSpace(0));
+    if (!sci.SelectionEmpty()) sci.ReplaceSel("");
+    else {
+        auto space = std::min(sci.SelectionNCaretVirtualSpace(0), sci.SelectionNAnchorVirtualSpace(0));
+        while (space > 0) {
+            const auto n = std::min<Position>(space, spaces.length());
+            sci.AddText(n, spaces.data());
+            space -= n;
+        }
+    }
+    sci.AddText(static_cast<Position>(text.length()), text.data());
+}
+
+template<typename Editor> void insertAtSelections(Editor& sci, std::string_view text) {
+    static constexpr std::string_view spaces = "                                ";
+    const int count = sci.Selections();
+    for (int i = 0; i < count; ++i) {
+        const auto start = sci.SelectionNStart(i);
+        const auto end   = sci.SelectionNEnd(i);
+        sci.SetTargetRange(start, end);
+        if (start == end) {
+            auto space = std::min(sci.SelectionNCaretVirtualSpace(i), sci.SelectionNAnchorVirtualSpace(i));
+            while (space > 0) {
+                const auto n = std::min<decltype(space)>(space, spaces.length());
+                sci.ReplaceTarget(spaces.substr(0, n));
+                sci.SetTargetRange(sci.TargetEnd(), sci.TargetEnd());
+                space -= n;
+            }
+        }
+        sci.ReplaceTarget(text);
+        const auto caret = sci.TargetEnd();
+        sci.SetSelectionNAnchor(i, caret);
+        sci.SetSelectionNCaret(i, caret);
+    }
+}
+
+class TextEditor {
+public:
+    virtual void beginUndoAction() = 0;
+    virtual void endUndoAction() = 0;
+    virtual void insert(std::string_view text) = 0;
+    virtual void finish() = 0;
+protected:
+    ~TextEditor() = default;
+};
+
+class EditorSink : public ComposeEngine::OutputSink {
+
+    static constexpr size_t pieceLength = 1024;  // UTF-16 code units translated at a time
+
+    TextEditor& editor;
+    bool        inserting = false;  // an undo action is open
+    char        buffer[3 * pieceLength];
+
+public:
+
+    explicit EditorSink(TextEditor& editor) : editor(editor) {}
+
+    void send(std::u16string_view text) override {
+        while (!text.empty()) {
+            size_t n = text.length() < pieceLength ? text.length() : pieceLength;
+            if (n < text.length() && text[n - 1] >= 0xD800 && text[n - 1] < 0xDC00) --n;  // don't split a surrogate pair
+            const size_t length = utf16to8(text.substr(0, n), std::span<char>(buffer));
+            if (!inserting) editor.beginUndoAction();
+            editor.insert(std::string_view(buffer, length));
+            inserting = true;
+            text.remove_prefix(n);
+        }
+    }
+
+    void finish() {
+        if (!inserting) return;
+        editor.finish();
+        editor.endUndoAction();
+        inserting = false;
+    }
+
+};
@@ -0,0 +1,106 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+// FixedString<CharT, capacity> holds up to capacity characters inside the object itself. It is used for the state
+// kept while keys are typed, so that processing a keystroke never allocates memory.
+//
+// bool append(std::basic_string_view<CharT> s)
+// bool push_back(CharT c)
+//     Adds to the end; if there is not enough room, leaves the string unchanged and returns false.
+//
+// void assign(std::basic_string_view<CharT> s)
+//     Replaces the contents (truncated to capacity).
+//
+// operator std::basic_string_view<CharT>() const
+//     Views the contents; the view is invalidated by any change.
+
+template<typename CharT, size_t capacity> class FixedString {
+
+    CharT  chars[capacity];
+    size_t count = 0;
+
+public:
+
+    using View = std::basic_string_view<CharT>;
+
+    bool append(View s) {
+        if (s.length() > capacity - count) return false;
+        s.copy(chars + count, s.length());
+        count += s.length();
+        return true;
+    }
+
+    bool push_back(CharT c) {
+        if (count == capacity) return false;
+        chars[count++] = c;
+        return true;
+    }
+
+    void assign(View s) {
+        count = 0;
+        append(s.substr(0, capacity));
+    }
+
+    void clear()                    { count = 0; }
+    void pop_back()                 { --count; }
+    bool empty() const              { return count == 0; }
+    size_t length() const           { return count; }
+    size_t size() const             { return count; }
+    CharT& back()                   { return chars[count - 1]; }
+    CharT  back() const             { return chars[count - 1]; }
+    CharT  operator[](size_t i) const { return chars[i]; }
+    const CharT* begin() const      { return chars; }
+    const CharT* end() const        { return chars + count; }
+    View view() const               { return View(chars, count); }
+    operator View() const           { return view(); }
+    bool operator==(View s) const   { return view() == s; }
+
+};
+
+
+// bool appendUtf8(FixedString<char, N>& s, std::u16string_view text)
+//
+// Appends UTF-16 text to s as UTF-8 (unpaired surrogates become U+FFFD); returns false if it doesn't fit.
+
+template<size_t N> inline bool appendUtf8(FixedString<char, N>& s, std::u16string_view text) {
+    for (size_t i = 0; i < text.length(); ++i) {
+        char32_t c = text[i];
+        if (c >= 0xD800 && c <= 0xDFFF) {
+            if (c < 0xDC00 && i + 1 < text.length() && text[i + 1] >= 0xDC00 && text[i + 1] <= 0xDFFF)
+                c = 0x10000 + ((c - 0xD800) << 10) + (text[++i] - 0xDC00);
+            else c = 0xFFFD;
+        }
+        char bytes[4];
+        size_t n;
+        if (c < 0x80)         { bytes[0] = static_cast<char>(c); n = 1; }
+        else if (c < 0x800)   { bytes[0] = static_cast<char>(0xC0 | c >> 6 ); n = 2; }
+        else if (c < 0x10000) { bytes[0] = static_cast<char>(0xE0 | c >> 12); n = 3; }
+        else                  { bytes[0] = static_cast<char>(0xF0 | c >> 18); n = 4; }
+        for (size_t k = n - 1; k > 0; --k, c >>= 6) bytes[k] = static_cast<char>(0x80 | (c & 0x3F));
+        if (!s.append(std::string_view(bytes, n))) return false;
+    }
+    return true;
+}
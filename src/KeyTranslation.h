@@ -0,0 +1,154 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+// KeyTranslationCache remembers, for each of the last few keyboard layouts used, what each key types with each
+// combination of Shift, Ctrl and Alt, and the names of keys, so that the layout is asked about a key only the first
+// time it is used. The plugin's layout (ProcessCompose.cpp) asks Windows with ToUnicodeEx, and tools can use a fake.
+//
+// The tables are kept inside the object (about 70K for each layout), so looking up a key never allocates memory.
+// When a layout not in the cache is used, the one least recently used is dropped and its tables are refilled as keys
+// are used. A translation longer than maxText code units is not kept; the layout is asked each time.
+//
+// KeyboardLayout::translate(uint8_t virtualKey, uint8_t scanCode, uint8_t modifiers, char16_t* out, int capacity)
+//     Writes what the key types with the given modifiers to out, and returns the number of code units (at most
+//     capacity), 0 if it types nothing, or -1 for a dead key, in which case out holds the key's spacing character.
+//     It must not leave the layout in a different state (as a dead key would).
+//
+// KeyboardLayout::keyName(uint8_t scanCode, bool extended, char16_t* out, int capacity)
+//     Writes the name of the key to out and returns its length, or 0 if it has none.
+//
+// Translation translate(KeyboardLayout& layout, uintptr_t id, uint8_t virtualKey, uint8_t scanCode, uint8_t modifiers)
+//     Returns what a key types in the layout identified by id (for Windows, the HKL): length is as returned by
+//     KeyboardLayout::translate, and text holds the code units (the spacing character for a dead key). The text is
+//     valid until the next call.
+//
+// std::u16string_view name(KeyboardLayout& layout, uintptr_t id, uint8_t scanCode, bool extended)
+//     Returns the name of a key, or an empty view if it has none; valid until the next call.
+//
+// void clear()
+//     Forgets all layouts.
+//
+// size_t misses() const
+//     The number of times a layout has been asked, for checking.
+
+class KeyboardLayout {
+public:
+    virtual int translate(uint8_t virtualKey, uint8_t scanCode, uint8_t modifiers, char16_t* out, int capacity) = 0;
+    virtual int keyName(uint8_t scanCode, bool extended, char16_t* out, int capacity) = 0;
+protected:
+    ~KeyboardLayout() = default;
+};
+
+class KeyTranslationCache {
+
+public:
+
+    enum Modifiers : uint8_t { Shift = 1, Control = 2, Alt = 4 };
+
+    static constexpr int    maxText  = 8;
+    static constexpr int    maxName  = 31;
+    static constexpr size_t layouts  = 4;
+
+    struct Translation {
+        int                 length = 0;
+        std::u16string_view text;
+    };
+
+private:
+
+    static constexpr int8_t unknown = INT8_MIN;  // not yet asked
+    static constexpr int8_t tooLong = INT8_MAX;  // longer than maxText
+
+    struct Key  { int8_t length = unknown; char16_t text[maxText]; };
+    struct Name { int8_t length = unknown; char16_t text[maxName]; };
+
+    struct Layout {
+        uintptr_t id   = 0;
+        uint64_t  used = 0;      // when last used; 0 if the slot is empty
+        Key       keys[256 * 8];  // by virtual key and modifiers
+        Name      names[512];     // by scan code and extended bit
+    };
+
+    Layout   slots[layouts];
+    uint64_t clock   = 0;
+    size_t   asked   = 0;
+    char16_t scratch[64];        // for translations too long to keep
+
+    Layout& find(uintptr_t id) {
+        Layout* oldest = slots;
+        for (Layout& slot : slots) {
+            if (slot.used && slot.id == id) {
+                slot.used = ++clock;
+                return slot;
+            }
+            if (slot.used < oldest->used) oldest = &slot;
+        }
+        oldest->id   = id;
+        oldest->used = ++clock;
+        for (Key&  key  : oldest->keys ) key.length  = unknown;
+        for (Name& name : oldest->names) name.length = unknown;
+        return *oldest;
+    }
+
+public:
+
+    Translation translate(KeyboardLayout& layout, uintptr_t id, uint8_t virtualKey, uint8_t scanCode, uint8_t modifiers) {
+        Key& key = find(id).keys[virtualKey * 8 + (modifiers & 7)];
+        if (key.length == unknown) {
+            ++asked;
+            int length = layout.translate(virtualKey, scanCode, modifiers & 7, scratch, static_cast<int>(std::size(scratch)));
+            if (length < 0) length = -1;
+            if (length > maxText) {
+                key.length = tooLong;
+                return { length, std::u16string_view(scratch, length) };
+            }
+            key.length = static_cast<int8_t>(length);
+            std::u16string_view(scratch, length < 0 ? 1 : length).copy(key.text, maxText);
+        }
+        else if (key.length == tooLong) {
+            ++asked;
+            const int length = layout.translate(virtualKey, scanCode, modifiers & 7, scratch, static_cast<int>(std::size(scratch)));
+            return { length, std::u16string_view(scratch, length) };  // only ever longer than maxText
+        }
+        return { key.length, std::u16string_view(key.text, key.length < 0 ? 1 : key.length) };
+    }
+
+    std::u16string_view name(KeyboardLayout& layout, uintptr_t id, uint8_t scanCode, bool extended) {
+        Name& name = find(id).names[scanCode * 2 + extended];
+        if (name.length == unknown) {
+            ++asked;
+            const int length = layout.keyName(scanCode, extended, name.text, maxName);
+            name.length = static_cast<int8_t>(length < 0 ? 0 : length > maxName ? maxName : length);
+        }
+        return std::u16string_view(name.text, name.length);
+    }
+
+    void clear() { for (Layout& slot : slots) slot.used = 0; }
+
+    size_t misses() const { return asked; }
+
+};
@@ -0,0 +1,172 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include "ComposeEngine.h"
+#include "UnicodeFormatTranslation.h"
+
+// A keystroke trace records the key messages processMessages sees while composing (and the compose key itself),
+// with what was sent in response, so that a sequence can be replayed through the engine without Windows;
+// see tools/TraceReplayBenchmark.cpp. The plugin writes one when the hidden setting KeystrokeTraceFile names a file.
+//
+// A trace is UTF-8 text, one event per line:
+//
+//     <time> <virtual key> <scan code> <flags> <text>
+//         A key message. time is the milliseconds since the previous key message, in decimal; virtual key and scan
+//         code are in hexadecimal. flags are letters: d (key down) or u (key up), r (repeat: the key was already down),
+//         k (the compose key), and S, C, A and E for the Shift, Ctrl, Alt and extended-key modifiers. text is what the
+//         key typed, or the bracketed name of a key that doesn't type anything (see ComposeEngine), for an initial
+//         key down while composing, and otherwise empty. It runs to the end of the line.
+//
+//     > <text>
+//         Text sent as input in response to the preceding key message.
+//
+//     # <comment>
+//
+// In text, a backslash, a control character or an unpaired surrogate is written as \uXXXX.
+//
+// template<size_t N> bool appendTraceKey(FixedString<char, N>& line, uint32_t time, uint16_t virtualKey, uint16_t scanCode,
+//                                        uint8_t flags, std::u16string_view text)
+// template<size_t N> bool appendTraceOutput(FixedString<char, N>& line, std::u16string_view text)
+//     Append the line for a key message (see TraceEvent) or for output, with its newline, without allocating memory;
+//     if there is not enough room, return false (line may then hold part of the event).
+//
+// bool parseTraceLine(std::string_view line, TraceEvent& event)
+//     Reads a line (without its newline) into event; returns false for a blank line, a comment or a line
+//     that is not valid.
+//
+// void replayTraceEvent(ComposeEngine& engine, const std::shared_ptr<const ComposeDefinitions>& definitions,
+//                       const TraceEvent& event, ComposeEngine::OutputSink& out)
+//     Does with a key message what processCompose does, by ComposeEngine::handle. Output events are ignored.
+
+struct TraceEvent {
+
+    enum Flags : uint8_t { KeyUp = 1, Repeat = 2, ComposeKey = 4, Shift = 8, Control = 16, Alt = 32, Extended = 64 };
+
+    bool           output     = false;  // True for text sent as input; only text is used
+    uint32_t       time       = 0;
+    uint16_t       virtualKey = 0;
+    uint16_t       scanCode   = 0;
+    uint8_t        flags      = 0;
+    std::u16string text;
+
+};
+
+
+namespace keystrokeTrace {
+
+    constexpr std::string_view flagLetters = "urkSCAE";  // in the order of TraceEvent::Flags
+
+    template<size_t N> inline bool appendText(FixedString<char, N>& line, std::u16string_view text) {
+        for (size_t i = 0; i < text.length(); ++i) {
+            const char16_t c = text[i];
+            const bool pair = c >= 0xD800 && c < 0xDC00 && i + 1 < text.length() && text[i + 1] >= 0xDC00 && text[i + 1] <= 0xDFFF;
+            if (pair) {
+                if (!appendUtf8(line, text.substr(i++, 2))) return false;
+            }
+            else if (c < 0x20 || c == 0x7F || c == u'\\' || (c >= 0xD800 && c <= 0xDFFF)) {
+                char escape[7];
+                std::snprintf(escape, sizeof escape, "\\u%04X", static_cast<unsigned>(c));
+                if (!line.append(std::string_view(escape, 6))) return false;
+            }
+            else if (!appendUtf8(line, text.substr(i, 1))) return false;
+        }
+        return true;
+    }
+
+}
+
+
+template<size_t N> inline bool appendTraceKey(FixedString<char, N>& line, uint32_t time, uint16_t virtualKey, uint16_t scanCode,
+                                               uint8_t flags, std::u16string_view text) {
+    char fields[40];
+    int length = std::snprintf(fields, sizeof fields, "%u %02X %02X %c", static_cast<unsigned>(time), static_cast<unsigned>(virtualKey),
+                               static_cast<unsigned>(scanCode), flags & TraceEvent::KeyUp ? 'u' : 'd');
+    for (size_t i = 1; i < keystrokeTrace::flagLetters.length(); ++i)
+        if (flags & (1 << i)) fields[length++] = keystrokeTrace::flagLetters[i];
+    if (!text.empty()) fields[length++] = ' ';
+    return line.append(std::string_view(fields, length)) && keystrokeTrace::appendText(line, text) && line.push_back('\n');
+}
+
+
+template<size_t N> inline bool appendTraceOutput(FixedString<char, N>& line, std::u16string_view text) {
+    return line.append("> ") && keystrokeTrace::appendText(line, text) && line.push_back('\n');
+}
+
+
+inline bool parseTraceLine(std::string_view line, TraceEvent& event) {
+
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+    if (line.empty() || line[0] == '#') return false;
+
+    event = TraceEvent();
+    if (line.starts_with("> ")) {
+        event.output = true;
+        line.remove_prefix(2);
+    }
+    else {
+        unsigned time, virtualKey, scanCode;
+        char flags[16];
+        int consumed = 0;
+        if (std::sscanf(std::string(line.substr(0, 80)).c_str(), "%u %x %x %15s%n", &time, &virtualKey, &scanCode, flags, &consumed) != 4
+            || virtualKey > 0xFFFF || scanCode > 0xFFFF) return false;
+        event.time       = time;
+        event.virtualKey = static_cast<uint16_t>(virtualKey);
+        event.scanCode   = static_cast<uint16_t>(scanCode);
+        for (const char* f = flags; *f; ++f) {
+            if (*f == 'd' && f == flags) continue;
+            const size_t bit = keystrokeTrace::flagLetters.find(*f);
+            if (bit == std::string_view::npos || (bit == 0 && f != flags)) return false;
+            event.flags |= static_cast<uint8_t>(1 << bit);
+        }
+        line.remove_prefix(consumed);
+        if (!line.empty()) {
+            if (line[0] != ' ') return false;
+            line.remove_prefix(1);
+        }
+    }
+
+    for (size_t i = 0; i < line.length();) {
+        const size_t escape = line.find("\\u", i);
+        const std::wstring w = utf8to16(line.substr(i, escape == std::string_view::npos ? escape : escape - i));
+        event.text.append(w.begin(), w.end());
+        if (escape == std::string_view::npos) break;
+        unsigned c;
+        if (escape + 6 > line.length() || std::sscanf(std::string(line.substr(escape + 2, 4)).c_str(), "%4x", &c) != 1) return false;
+        event.text += static_cast<char16_t>(c);
+        i = escape + 6;
+    }
+    return true;
+
+}
+
+
+inline void replayTraceEvent(ComposeEngine& engine, const std::shared_ptr<const ComposeDefinitions>& definitions,
+                             const TraceEvent& event, ComposeEngine::OutputSink& out) {
+    if (event.output) return;
+    const uint8_t flags = event.flags & (TraceEvent::KeyUp | TraceEvent::Repeat | TraceEvent::ComposeKey);  // same as KeyEvent
+    engine.handle({ flags, event.text }, definitions, out);
+}
@@ -14,66 +14,273 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <condition_variable>
 #include <fstream>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include "Framework/PluginFramework.h"
 #include "Framework/UtilityFramework.h"
 #include "UnicodeFormatTranslation.h"
 #include "CommonData.h"
+#include "DefaultSequences.h"
+#include "DefinitionsAnalyzer.h"
+#include "ReverseIndex.h"
+#include "SequencePalette.h"
+#include "Timeline.h"
 
 extern NPP::FuncItem menuDefinition[];      // Defined in Plugin.cpp
 extern int menuItem_UserDefinitions;        // Defined in Plugin.cpp
 
+void refreshSequencePalette();              // Defined in Palette.cpp
+
+bool readDefinitionsCache (const std::wstring& cacheFile, const std::wstring& userFile, std::string& content,
+                           ComposeDefinitions& definitions);        // Defined in DefinitionsCache.cpp
+void writeDefinitionsCache(const std::wstring& cacheFile, const std::wstring& userFile, const std::string& content,
+                           const ComposeDefinitions& definitions);  // Defined in DefinitionsCache.cpp
+
+// Definitions are loaded and compiled on a worker thread, so that a large or slow user definitions file doesn't hold up
+// Notepad++. The result is published to data.definitions with an atomic pointer swap; processMessages takes a reference
+// to the definitions in effect when each sequence begins, so it never sees a partly built table, and a reload that
+// happens during a sequence takes effect with the next one. A load that fails publishes nothing. The user definitions
+// file is only read and checked here (by parseDefinitions, see DefinitionsParser.h), never on the main thread.
+//
+// When a load finishes and no other load is waiting, the worker posts a message to a message-only window, so that
+// the user definitions settings and the menu check can be brought into agreement with the definitions in effect
+// on the main thread. If the last load failed, the main thread instead tells the user why, and the settings keep
+// the file that was chosen (so it is tried again at the next load), while the definitions in effect stay as they were.
+//
+// Each step of a load is recorded in the timeline (see Timeline.h), labeled with the reason for the load; when the
+// WriteTimeline setting is on, the timeline is written to Compose.timeline.json in the plugins configuration directory
+// whenever the loader finishes, and at shutdown.
+//
+// Every load of a user definitions file also analyzes it (see DefinitionsAnalyzer.h): duplicates and overrides are
+// counted as the file is parsed (and kept in the cache), and shadowed sequences and those that hide an implicit
+// combination or #x entry are found in the compiled definitions. The counts are kept in ComposeDefinitions::issueCounts
+// for the coverage report (see ProcessCommands.cpp) and recorded with the analyze step of the timeline.
+//
+// Once How do I type or the coverage report has been used, the loader also remakes the reverse index (see
+// ReverseIndex.h) after each load, so that it is ready when they are used again. Likewise, once the sequence palette
+// has been shown, the loader remakes it (see SequencePalette.h), and the panel shows the new one when the loader
+// has finished.
+//
+// void loadSequenceDefinitions(const char* reason)
+//     Called on the main thread; asks the worker to load definitions according to the current settings.
+//     The first call publishes the built-in definitions immediately, so there is always a working table.
+//     If another load is waiting, it is replaced. reason (startup, menu, save prompt or close prompt)
+//     labels the load in the timeline.
+//
+// void stopLoadingSequenceDefinitions()
+//     Called on the main thread at shutdown; waits for a load in progress to finish and ends the worker.
+
 namespace {
 
-    bool getRule(const nlohmann::json& j, char32_t& c) {
-        if (j.is_string()) {
-            auto s = utf8to32(j);
-            if (s.length() != 1) 
-                return false;
-            c = s[0];
-            return true;
-        }
-        if (!j.is_boolean()) 
-            return false;
-        c = j ? 1 : 0;
-        return true;
+    struct LoadRequest {
+        bool         userDefinitionsEnabled;
+        std::wstring userDefinitionsFile;
+        std::wstring cacheFile;
+        bool         linearScanMatching;
+        const char*  reason;
+    };
+
+    std::mutex                 loaderMutex;         // Guards pendingRequest and stopLoader
+    std::condition_variable    loaderWake;
+    std::optional<LoadRequest> pendingRequest;
+    bool                       stopLoader   = false;
+    std::thread                loader;
+    HWND                       loaderWindow = 0;    // Receives WM_APP when the loader has finished all requests
+    std::wstring               timelineFile;        // Where the timeline is written, if WriteTimeline is on
+
+    struct LoadFailure {
+        std::wstring file;
+        std::string  error;
+    };
+    std::optional<LoadFailure> loadFailure;         // Set by the loader when the last load failed; guarded by loaderMutex
+
+    void writeTimeline() {
+        if (!timeline.on() || timelineFile.empty()) return;
+        std::ofstream(timelineFile, std::ios::binary) << timeline.json();
     }
 
-}
+    // Returns the compiled definitions, or null, with the reason in error, if the user definitions file can't be read
+    // or isn't valid.
 
-bool loadSequenceDefinitions() {
-    auto n = SendMessage(plugin.nppData._nppHandle, NPPM_GETPLUGINHOMEPATH, 0, 0);
-    std::wstring path(n, 0);
-    SendMessage(plugin.nppData._nppHandle, NPPM_GETPLUGINHOMEPATH, n + 1, reinterpret_cast<LPARAM>(path.data()));
-    path += L"\\Compose\\compose-default.jsonc";
-    std::ifstream file(path.data());
-    if (!file) return false;
-    data.rules = nlohmann::json::parse(file, 0, false, true);
-    if (data.userDefinitionsEnabled) {
-        std::ifstream userfile(data.userDefinitionsFile);
-        if (userfile) {
-            auto userrules = nlohmann::json::parse(userfile, 0, false, true);
-            if (userrules.is_discarded()) data.userDefinitionsEnabled = false;
-            else data.rules.update(userrules);
+    std::shared_ptr<const ComposeDefinitions> compile(const LoadRequest& request, std::string& error) {
+
+        Timeline::Span span(timeline, "compile", "load", "\"reason\": " + Timeline::quote(request.reason)
+                          + (request.userDefinitionsEnabled ? ", \"file\": " + Timeline::quote(utf16to8(request.userDefinitionsFile)) : ""));
+
+        auto definitions = std::make_shared<ComposeDefinitions>();
+        std::string content;
+        DefinitionsReport report;
+        report.limit = 0;
+        bool cached = false;
+        if (request.userDefinitionsEnabled) {
+            Timeline::Span step(timeline, "read cache", "load");
+            cached = readDefinitionsCache(request.cacheFile, request.userDefinitionsFile, content, *definitions);
         }
-        else data.userDefinitionsEnabled = false;
+
+        if (!cached) {
+
+            {
+                Timeline::Span step(timeline, "built-in definitions", "load");
+                definitions = ComposeDefinitions::builtIn();
+            }
+
+            if (request.userDefinitionsEnabled) {
+                if (content.empty()) {
+                    Timeline::Span step(timeline, "read file", "load");
+                    std::ifstream userfile(request.userDefinitionsFile, std::ios::binary | std::ios::ate);
+                    content.resize(userfile ? static_cast<size_t>(userfile.tellg()) : 0);
+                    if (!userfile || !userfile.seekg(0).read(content.data(), content.size())) {
+                        error = "the file can't be read";
+                        return {};
+                    }
+                }
+                ParsePhases phases;
+                double start = timeline.now();
+                if (!definitions->overlay(content, &phases, &report, &error)) return {};
+                for (const auto& [name, milliseconds] : { std::pair("parse", phases.parse), std::pair("sort", phases.sort),
+                                                          std::pair("update merge", phases.merge), std::pair("build", phases.build),
+                                                          std::pair("implicit combining rules", phases.combining) }) {
+                    timeline.complete(name, "load", start, start + milliseconds * 1000);
+                    start += milliseconds * 1000;
+                }
+            }
+
+        }
+
+        if (request.userDefinitionsEnabled) {
+            // The cache keeps the counts made while parsing; the rest are found in the compiled definitions either way.
+            if (cached) for (const auto kind : { DefinitionsIssue::Duplicate, DefinitionsIssue::Override })
+                report.counts[kind] = definitions->issueCounts[kind];
+            const double start = timeline.now();
+            const SequenceTrie builtIn = defaultSequences::trie();
+            analyzeDefinitions(*definitions, report, &builtIn);
+            std::copy(std::begin(report.counts), std::end(report.counts), definitions->issueCounts);
+            if (timeline.on()) {
+                std::string args;
+                for (const auto& [name, kind] : { std::pair("duplicate", DefinitionsIssue::Duplicate),
+                                                  std::pair("override", DefinitionsIssue::Override),
+                                                  std::pair("shadowed", DefinitionsIssue::Shadowed),
+                                                  std::pair("implicit", DefinitionsIssue::Implicit),
+                                                  std::pair("hex entry", DefinitionsIssue::HexEntry) })
+                    args += (args.empty() ? "" : ", ") + Timeline::quote(name) + ": " + std::to_string(report.counts[kind]);
+                timeline.complete("analyze", "load", start, timeline.now(), args);
+            }
+            if (!cached) {
+                Timeline::Span step(timeline, "write cache", "load");
+                writeDefinitionsCache(request.cacheFile, request.userDefinitionsFile, content, *definitions);
+            }
+            definitions->userDefinitions = true;
+            definitions->userFile        = request.userDefinitionsFile;
+        }
+        if (request.linearScanMatching) {
+            Timeline::Span step(timeline, "linear rules", "load");
+            definitions->keepLinearRules();
+        }
+        return definitions;
+
     }
 
-    data.combiningRules.clear();
-
-    if (data.rules.contains("implicit combining rules") && data.rules["implicit combining rules"].is_object()) {
-        const nlohmann::json j = data.rules["implicit combining rules"];
-        bool valid = true;
-        for (const auto& [key, array] : j.items()) {
-            if (!array.is_array() || array.size() != 4) { valid = false; break; }
-            CommonData::CombiningRule& rule = data.combiningRules[utf8to16(key)];
-            if (!array[0].is_string() || array[0].empty()) { valid = false; break; }
-            if ( !getRule(array[0], rule.one) || !getRule(array[1], rule.two )
-              || !getRule(array[2], rule.up ) || !getRule(array[3], rule.down) ) { valid = false; break; }
+    void loaderThread() {
+        timeline.nameThread("definitions loader");
+        std::unique_lock lock(loaderMutex);
+        for (;;) {
+            loaderWake.wait(lock, [] { return stopLoader || pendingRequest; });
+            if (stopLoader) return;
+            const LoadRequest request = std::move(*pendingRequest);
+            pendingRequest.reset();
+            lock.unlock();
+            std::string error;
+            auto definitions = compile(request, error);
+            if (definitions) {
+                data.definitions.store(definitions);
+                if (data.sequencePalette.load()) {
+                    Timeline::Span step(timeline, "sequence palette", "load");
+                    data.sequencePalette.store(std::make_shared<SequencePalette>(definitions));
+                }
+                if (data.reverseIndex.load()) {
+                    Timeline::Span step(timeline, "reverse index", "load");
+                    data.reverseIndex.store(ReverseIndex::build(std::move(definitions)));
+                }
+            }
+            lock.lock();
+            if (definitions) loadFailure.reset();
+            else loadFailure = { request.userDefinitionsFile, std::move(error) };
+            if (!pendingRequest) PostMessage(loaderWindow, WM_APP, 0, 0);
         }
-        if (!valid) data.combiningRules.clear();
     }
 
-    npp(NPPM_SETMENUITEMCHECK, menuDefinition[menuItem_UserDefinitions]._cmdID, data.userDefinitionsEnabled.get());
-    return true;
+    LRESULT CALLBACK loaderWindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
+        if (msg != WM_APP) return DefWindowProc(hwnd, msg, wParam, lParam);
+        std::optional<LoadFailure> failure;
+        {
+            std::lock_guard lock(loaderMutex);
+            failure = std::move(loadFailure);
+            loadFailure.reset();
+        }
+        if (!failure) {
+            const auto definitions = data.definitions.load();
+            if (definitions->userDefinitions) data.userDefinitionsFile = definitions->userFile;
+            data.userDefinitionsEnabled = definitions->userDefinitions;
+        }
+        npp(NPPM_SETMENUITEMCHECK, menuDefinition[menuItem_UserDefinitions]._cmdID, data.userDefinitionsEnabled.get());
+        refreshSequencePalette();
+        writeTimeline();
+        if (failure) TaskDialog(plugin.nppData._nppHandle, 0, L"Compose", L"User definitions not loaded",
+                                (L"\"" + failure->file + L"\" could not be loaded: " + utf8to16(failure->error)
+                                 + L".\n\nThe definitions in effect have not been changed.").data(),
+                                0, TD_ERROR_ICON, 0);
+        return 0;
+    }
+
+}
+
+
+void loadSequenceDefinitions(const char* reason) {
+
+    Timeline::Span span(timeline, "loadSequenceDefinitions", "load", "\"reason\": " + Timeline::quote(reason));
+
+    if (!loaderWindow) {
+        std::string error;
+        data.definitions.store(compile({ false, L"", L"", data.linearScanMatching, reason }, error));  // built-in only, so it can't fail
+        WNDCLASSEX wc = { sizeof(WNDCLASSEX) };
+        wc.lpfnWndProc   = loaderWindowProc;
+        wc.hInstance     = plugin.dllInstance;
+        wc.lpszClassName = L"Compose.DefinitionsLoader";
+        RegisterClassEx(&wc);
+        loaderWindow = CreateWindowEx(0, wc.lpszClassName, 0, 0, 0, 0, 0, 0, HWND_MESSAGE, 0, plugin.dllInstance, 0);
+    }
+
+    LoadRequest request;
+    request.userDefinitionsEnabled = data.userDefinitionsEnabled;
+    request.userDefinitionsFile    = data.userDefinitionsFile;
+    request.linearScanMatching     = data.linearScanMatching;
+    request.reason                 = reason;
+    request.cacheFile.resize(npp(NPPM_GETPLUGINSCONFIGDIR, 0, 0), 0);
+    npp(NPPM_GETPLUGINSCONFIGDIR, request.cacheFile.length() + 1, request.cacheFile.data());
+    timelineFile = request.cacheFile + L"\\Compose.timeline.json";
+    request.cacheFile += L"\\Compose.cache";
+
+    {
+        std::lock_guard lock(loaderMutex);
+        pendingRequest = std::move(request);
+    }
+    loaderWake.notify_one();
+    if (!loader.joinable()) loader = std::thread(loaderThread);
+
+}
+
+
+void stopLoadingSequenceDefinitions() {
+    {
+        std::lock_guard lock(loaderMutex);
+        stopLoader = true;
+    }
+    loaderWake.notify_one();
+    if (loader.joinable()) loader.join();
+    if (loaderWindow) DestroyWindow(loaderWindow);
+    loaderWindow = 0;
+    writeTimeline();
 }
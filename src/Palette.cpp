@@ -0,0 +1,263 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "Framework/PluginFramework.h"
+#include "Framework/UtilityFramework.h"
+#include "CommonData.h"
+#include "DefinitionsAnalyzer.h"
+#include "EditorSink.h"
+#include "SequencePalette.h"
+#include "Timeline.h"
+#include "resource.h"
+#include "Shlwapi.h"
+
+extern NPP::FuncItem menuDefinition[];      // Defined in Plugin.cpp
+extern int menuItem_SequencePalette;        // Defined in Plugin.cpp
+
+// The sequence palette (see SequencePalette.h) is shown in a Notepad++ docking panel: a search box above a virtual
+// list view of the sequences that match it, searched again as each key is typed. Up, Down, Page Up and Page Down in
+// the search box move the selection in the list; Enter, or a double click in the list, inserts the output of the
+// selected sequence at each selection in the editor, as one undo action, and Escape returns to the editor.
+//
+// The palette is made when the panel is first shown, and after that the loader remakes it after each load; when
+// a load finishes while the panel is showing, the search is repeated in the new palette.
+//
+// void toggleSequencePalette()
+//     Menu command: shows the panel, making it the first time, or hides it.
+//
+// void refreshSequencePalette()
+//     Called on the main thread when the loader has finished; shows the palette for the definitions in effect.
+//
+// void sequencePaletteDarkModeChanged()
+//     Called on NPPN_DARKMODECHANGED.
+
+namespace {
+
+    constexpr UINT DMN_CLOSE = 1050 + 1;  // DMN_FIRST + 1 in Notepad++'s dockingResource.h, which isn't in Host
+
+    HWND                             panel      = 0;
+    bool                             panelShown = false;
+    std::shared_ptr<SequencePalette> palette;      // The palette shown in the list
+    std::vector<uint32_t>            results;      // Indexes in palette of the sequences in the list, in order
+    std::wstring                     cellText;     // Text returned for LVN_GETDISPINFO, which must outlive the message
+
+    // Returns the palette for the definitions in effect, making it now if the loader hasn't.
+
+    std::shared_ptr<SequencePalette> currentPalette() {
+        const auto definitions = data.definitions.load();
+        auto p = data.sequencePalette.load();
+        if (!p || p->definitions() != definitions) {
+            Timeline::Span span(timeline, "sequence palette", "command");
+            const HCURSOR cursor = SetCursor(LoadCursor(0, IDC_WAIT));
+            p = std::make_shared<SequencePalette>(definitions);
+            SetCursor(cursor);
+            data.sequencePalette.store(p);
+        }
+        return p;
+    }
+
+    // Shows keys as they are pressed, separated by spaces.
+
+    std::wstring describeKeys(std::string_view utf8) {
+        const std::wstring wide = utf8to16(utf8);
+        const std::u16string_view keys(reinterpret_cast<const char16_t*>(wide.data()), wide.length());
+        std::wstring result;
+        for (size_t i = 0; i < keys.length();) {
+            const std::u16string_view key = keys.substr(i, definitionsAnalyzer::keyLength(keys.substr(i)));
+            if (i) result += L' ';
+            result += key == u"\r" ? L"Enter" : key == u" " ? L"Space" : key == u"\t" ? L"Tab" : std::wstring(key.begin(), key.end());
+            i += key.length();
+        }
+        return result;
+    }
+
+    // Shows output on one line, with control characters as their control pictures.
+
+    std::wstring describeOutput(std::u16string_view output) {
+        std::wstring result(output.begin(), output.end());
+        for (wchar_t& c : result) if (c < 0x20) c = static_cast<wchar_t>(0x2400 + c);
+        return result;
+    }
+
+    void search() {
+        std::wstring query(GetWindowTextLength(GetDlgItem(panel, IDC_PALETTE_SEARCH)), 0);
+        GetDlgItemText(panel, IDC_PALETTE_SEARCH, query.data(), static_cast<int>(query.length() + 1));
+        palette->search(utf16to8(query), results);
+        HWND list = GetDlgItem(panel, IDC_PALETTE_LIST);
+        ListView_SetItemCountEx(list, results.size(), 0);
+        if (!results.empty()) {
+            ListView_SetItemState(list, 0, LVIS_SELECTED | LVIS_FOCUSED, LVIS_SELECTED | LVIS_FOCUSED);
+            ListView_EnsureVisible(list, 0, FALSE);
+        }
+        InvalidateRect(list, 0, TRUE);
+        const std::wstring count = results.size() == palette->size() ? std::to_wstring(results.size())
+                                 : std::to_wstring(results.size()) + L" of " + std::to_wstring(palette->size());
+        SetDlgItemText(panel, IDC_PALETTE_COUNT, count.data());
+    }
+
+    void insertSelected() {
+        const int item = ListView_GetNextItem(GetDlgItem(panel, IDC_PALETTE_LIST), -1, LVNI_SELECTED);
+        if (item < 0 || static_cast<size_t>(item) >= results.size()) return;
+        const std::u16string& output = (*palette)[results[item]].output;
+        plugin.getScintillaPointers();
+        plugin.sci.BeginUndoAction();
+        insertAtSelections(plugin.sci, fromWide(std::wstring(output.begin(), output.end())));
+        plugin.sci.EndUndoAction();
+        plugin.sci.ScrollCaret();
+        SetFocus(plugin.currentScintilla());
+    }
+
+    void layout(HWND hwndDlg, int width, int height) {
+        RECT r = { 4, 14, 48, 8 };  // margin, search box height, count width and count height in dialog units
+        MapDialogRect(hwndDlg, &r);
+        const int margin = r.left, boxHeight = r.top, countWidth = r.right, countHeight = r.bottom;
+        const int boxWidth = std::max(width - countWidth - 3 * margin, 0);
+        SetWindowPos(GetDlgItem(hwndDlg, IDC_PALETTE_SEARCH), 0, margin, margin, boxWidth, boxHeight, SWP_NOZORDER);
+        SetWindowPos(GetDlgItem(hwndDlg, IDC_PALETTE_COUNT), 0, width - margin - countWidth,
+                     margin + (boxHeight - countHeight) / 2, countWidth, countHeight, SWP_NOZORDER);
+        SetWindowPos(GetDlgItem(hwndDlg, IDC_PALETTE_LIST), 0, margin, 2 * margin + boxHeight,
+                     std::max(width - 2 * margin, 0), std::max(height - 3 * margin - boxHeight, 0), SWP_NOZORDER);
+    }
+
+    LRESULT CALLBACK searchSubclass(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam, UINT_PTR, DWORD_PTR) {
+        if (msg == WM_KEYDOWN) switch (wParam) {
+        case VK_UP:
+        case VK_DOWN:
+        case VK_PRIOR:
+        case VK_NEXT:
+            SendDlgItemMessage(GetParent(hWnd), IDC_PALETTE_LIST, msg, wParam, lParam);
+            return 0;
+        }
+        return DefSubclassProc(hWnd, msg, wParam, lParam);
+    }
+
+    INT_PTR CALLBACK paletteDialogProc(HWND hwndDlg, UINT uMsg, WPARAM wParam, LPARAM lParam) {
+        switch (uMsg) {
+        case WM_DESTROY:
+            RemoveWindowSubclass(GetDlgItem(hwndDlg, IDC_PALETTE_SEARCH), searchSubclass, 1);
+            return TRUE;
+        case WM_INITDIALOG:
+        {
+            SetWindowSubclass(GetDlgItem(hwndDlg, IDC_PALETTE_SEARCH), searchSubclass, 1, 0);
+            SendDlgItemMessage(hwndDlg, IDC_PALETTE_SEARCH, EM_SETCUEBANNER, TRUE,
+                               reinterpret_cast<LPARAM>(L"Search keys, characters and names"));
+            HWND list = GetDlgItem(hwndDlg, IDC_PALETTE_LIST);
+            ListView_SetExtendedListViewStyle(list, LVS_EX_FULLROWSELECT | LVS_EX_DOUBLEBUFFER | LVS_EX_LABELTIP);
+            static constexpr struct { const wchar_t* name; int width; } columns[] =
+                { { L"Sequence", 50 }, { L"Output", 30 }, { L"Name", 120 }, { L"Category", 80 } };
+            for (int i = 0; i < static_cast<int>(std::size(columns)); ++i) {
+                RECT r = { columns[i].width, 0, 0, 0 };
+                MapDialogRect(hwndDlg, &r);
+                LVCOLUMN column = {};
+                column.mask    = LVCF_TEXT | LVCF_WIDTH;
+                column.pszText = const_cast<wchar_t*>(columns[i].name);
+                column.cx      = r.left;
+                ListView_InsertColumn(list, i, &column);
+            }
+            npp(NPPM_DARKMODESUBCLASSANDTHEME, NPP::NppDarkMode::dmfInit, hwndDlg);
+            return TRUE;
+        }
+        case WM_SIZE:
+            layout(hwndDlg, LOWORD(lParam), HIWORD(lParam));
+            return TRUE;
+        case WM_COMMAND:
+            switch (LOWORD(wParam)) {
+            case IDC_PALETTE_SEARCH:
+                if (HIWORD(wParam) == EN_CHANGE && palette) search();
+                return TRUE;
+            case IDOK:
+                insertSelected();
+                return TRUE;
+            case IDCANCEL:
+                SetFocus(plugin.currentScintilla());
+                return TRUE;
+            }
+            return FALSE;
+        case WM_NOTIFY:
+        {
+            const NMHDR* nmhdr = reinterpret_cast<const NMHDR*>(lParam);
+            if (nmhdr->idFrom != IDC_PALETTE_LIST) {
+                if (LOWORD(nmhdr->code) != DMN_CLOSE) return FALSE;  // sent by the docking container
+                panelShown = false;
+                npp(NPPM_SETMENUITEMCHECK, menuDefinition[menuItem_SequencePalette]._cmdID, 0);
+                return TRUE;
+            }
+            switch (nmhdr->code) {
+            case LVN_GETDISPINFO:
+            {
+                LVITEM& item = reinterpret_cast<NMLVDISPINFO*>(lParam)->item;
+                if (!(item.mask & LVIF_TEXT) || static_cast<size_t>(item.iItem) >= results.size()) return TRUE;
+                const PaletteEntry& entry = (*palette)[results[item.iItem]];
+                switch (item.iSubItem) {
+                case 0: cellText = describeKeys(entry.keys);                                break;
+                case 1: cellText = describeOutput(entry.output);                            break;
+                case 2: cellText = utf8to16(entry.name);                                    break;
+                case 3: cellText = utf8to16(SequencePalette::categoryName(entry.category)); break;
+                }
+                item.pszText = cellText.data();
+                return TRUE;
+            }
+            case LVN_ITEMACTIVATE:
+                insertSelected();
+                return TRUE;
+            }
+            return FALSE;
+        }
+        }
+        return FALSE;
+    }
+
+}
+
+
+void toggleSequencePalette() {
+    if (!panel) {
+        panel = CreateDialogParam(plugin.dllInstance, MAKEINTRESOURCE(IDD_PALETTE), plugin.nppData._nppHandle,
+                                  paletteDialogProc, 0);
+        if (!panel) return;
+        static wchar_t moduleName[MAX_PATH];
+        GetModuleFileName(plugin.dllInstance, moduleName, MAX_PATH);
+        static NPP::tTbData dock = {};
+        dock.hClient       = panel;
+        dock.pszName       = L"Sequence palette";
+        dock.dlgID         = menuItem_SequencePalette;
+        dock.uMask         = DWS_DF_CONT_RIGHT | DWS_USEOWNDARKMODE;
+        dock.pszModuleName = PathFindFileName(moduleName);
+        npp(NPPM_DMMREGASDCKDLG, 0, &dock);
+        npp(NPPM_MODELESSDIALOG, MODELESSDIALOGADD, panel);
+    }
+    panelShown = !panelShown;
+    if (panelShown) {
+        palette = currentPalette();
+        search();
+        npp(NPPM_DMMSHOW, 0, panel);
+        SetFocus(GetDlgItem(panel, IDC_PALETTE_SEARCH));
+    }
+    else npp(NPPM_DMMHIDE, 0, panel);
+    npp(NPPM_SETMENUITEMCHECK, menuDefinition[menuItem_SequencePalette]._cmdID, panelShown);
+}
+
+
+void refreshSequencePalette() {
+    if (!panelShown) return;
+    palette = currentPalette();
+    search();
+}
+
+
+void sequencePaletteDarkModeChanged() {
+    if (panel) npp(NPPM_DARKMODESUBCLASSANDTHEME, NPP::NppDarkMode::dmfHandleChange, panel);
+}
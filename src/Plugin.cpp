@@ -17,6 +17,8 @@
 #include "Framework/PluginFramework.h"
 #include "Framework/UtilityFramework.h"
 #include "CommonData.h"
+#include "Statistics.h"
+#include "Timeline.h"
 using namespace NPP;
 
 
@@ -25,9 +27,14 @@ using namespace NPP;
 void loadConfiguration();  // Defined in Configuration.cpp
 void saveConfiguration();  // Defined in Configuration.cpp
 
-// Routine to load the sequence definitions
+// Routines to load the sequence definitions
 
-bool loadSequenceDefinitions();  // defined in LoadSequenceDefinitions.cpp
+void loadSequenceDefinitions(const char* reason);  // defined in LoadSequenceDefinitions.cpp
+void stopLoadingSequenceDefinitions();             // defined in LoadSequenceDefinitions.cpp
+
+// Routine to save keystroke statistics
+
+std::wstring writeStatistics();  // defined in About.cpp
 
 // Routines that process menu commands
 
@@ -35,6 +42,9 @@ void toggleEnabled();               // defined in ProcessCommands.cpp
 void showComposeKeyDialog();        // defined in ComposeKeyDialog.cpp
 void selectUserDefinitionsFile();   // defined in ProcessCommands.cpp
 void newUserDefinitionsFile();      // defined in ProcessCommands.cpp
+void howDoITypeSelected();          // defined in ProcessCommands.cpp
+void showCoverageReport();          // defined in ProcessCommands.cpp
+void toggleSequencePalette();       // defined in Palette.cpp
 void showAboutDialog();             // defined in About.cpp
 
 // Routines that process Notepad++ notifications
@@ -42,6 +52,7 @@ void showAboutDialog();             // defined in About.cpp
 void fileBeforeClose(const NMHDR*);
 void fileClosed(const NMHDR*);
 void fileSaved(const NMHDR*);
+void sequencePaletteDarkModeChanged();  // defined in Palette.cpp
 
 
 // Name and define any shortcut keys to be assigned as menu item defaults: Ctrl, Alt, Shift and the virtual key code
@@ -63,16 +74,22 @@ void fileSaved(const NMHDR*);
 // to get the menu item identifier assigned by Notepad++.
 
 FuncItem menuDefinition[] = {
-    { L"Enabled"                  , []() {plugin.cmd(toggleEnabled            );}, 0, false, 0},
-    { L"Compose key..."           , []() {plugin.cmd(showComposeKeyDialog     );}, 0, false, 0},
-    { L"---"                      , 0                                            , 0, false, 0},
-    { L"User definitions file..." , []() {plugin.cmd(selectUserDefinitionsFile);}, 0, false, 0},
-    { L"New user definitions file", []() {plugin.cmd(newUserDefinitionsFile);   }, 0, false, 0},
-    { L"Help/About..."            , []() {plugin.cmd(showAboutDialog          );}, 0, false, 0}
+    { L"Enabled"                          , []() {plugin.cmd(toggleEnabled            );}, 0, false, 0},
+    { L"Compose key..."                   , []() {plugin.cmd(showComposeKeyDialog     );}, 0, false, 0},
+    { L"---"                              , 0                                            , 0, false, 0},
+    { L"User definitions file..."         , []() {plugin.cmd(selectUserDefinitionsFile);}, 0, false, 0},
+    { L"New user definitions file"        , []() {plugin.cmd(newUserDefinitionsFile   );}, 0, false, 0},
+    { L"---"                              , 0                                            , 0, false, 0},
+    { L"How do I type selected character?", []() {plugin.cmd(howDoITypeSelected       );}, 0, false, 0},
+    { L"Coverage by Unicode block"        , []() {plugin.cmd(showCoverageReport       );}, 0, false, 0},
+    { L"Sequence palette"                 , []() {plugin.cmd(toggleSequencePalette    );}, 0, false, 0},
+    { L"---"                              , 0                                            , 0, false, 0},
+    { L"Help/About..."                    , []() {plugin.cmd(showAboutDialog          );}, 0, false, 0}
 };
 
 int menuItem_ToggleEnabled = 0;
 int menuItem_UserDefinitions = 3;
+int menuItem_SequencePalette = 8;
 
 
 // Tell Notepad++ the plugin name
@@ -85,8 +102,17 @@ extern "C" __declspec(dllexport) const wchar_t* getName() {
 // Tell Notepad++ about the plugin menu
 
 extern "C" __declspec(dllexport) FuncItem * getFuncsArray(int *n) {
-    loadConfiguration();
+    const double start = timeline.now();
+    {
+        Timeline::Span span(timeline, "loadConfiguration", "startup");
+        loadConfiguration();
+    }
+    timeline.enable(data.writeTimeline);
+    timeline.nameThread("Notepad++");
+    statistics.enable(data.collectStatistics);
+    loadSequenceDefinitions("startup");
     *n = sizeof(menuDefinition) / sizeof(FuncItem);
+    timeline.complete("getFuncsArray", "startup", start, timeline.now());
     return reinterpret_cast<FuncItem*>(&menuDefinition);
 }
 
@@ -111,6 +137,10 @@ extern "C" __declspec(dllexport) void beNotified(SCNotification *np) {
             plugin.startupOrShutdown = false;
             break;
 
+        case NPPN_DARKMODECHANGED:
+            sequencePaletteDarkModeChanged();
+            break;
+
         case NPPN_FILEBEFORECLOSE:
             fileBeforeClose(nmhdr);
             break;
@@ -124,13 +154,18 @@ extern "C" __declspec(dllexport) void beNotified(SCNotification *np) {
             break;
 
         case NPPN_READY:
-            plugin.startupOrShutdown = false;
-            if (loadSequenceDefinitions() && data.enabled) toggleEnabled();
-            npp(NPPM_SETMENUITEMCHECK, menuDefinition[menuItem_UserDefinitions]._cmdID, data.userDefinitionsEnabled ? 1 : 0);
+            {
+                Timeline::Span span(timeline, "NPPN_READY", "startup");
+                plugin.startupOrShutdown = false;
+                if (data.enabled) toggleEnabled();
+                npp(NPPM_SETMENUITEMCHECK, menuDefinition[menuItem_UserDefinitions]._cmdID, data.userDefinitionsEnabled ? 1 : 0);
+            }
             break;
 
         case NPPN_SHUTDOWN:
             if (data.hookCompose) UnhookWindowsHookEx(data.hookCompose);
+            stopLoadingSequenceDefinitions();
+            if (statistics.on()) writeStatistics();
             saveConfiguration();
             break;
 
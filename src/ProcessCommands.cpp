@@ -18,6 +18,8 @@
 #include "Framework/UtilityFramework.h"
 #include "CommonData.h"
 #include "FileDialogBase.h"
+#include "ReverseIndex.h"
+#include "Timeline.h"
 #include <fstream>
 
 
@@ -25,7 +27,7 @@ extern NPP::FuncItem menuDefinition[];      // Defined in Plugin.cpp
 extern int menuItem_ToggleEnabled;          // Defined in Plugin.cpp
 extern int menuItem_UserDefinitions;        // Defined in Plugin.cpp
 
-bool             loadSequenceDefinitions();             // Defined in LoadSequenceDefinitions.cpp
+void             loadSequenceDefinitions(const char*);  // Defined in LoadSequenceDefinitions.cpp
 LRESULT CALLBACK processMessages(int, WPARAM, LPARAM);  // Defined in ProcessCompose.cpp
 void             showComposeKeyDialog();                // Defined in ComposeKeyDialog.cpp
 
@@ -70,29 +72,11 @@ void newUserDefinitionsFile() {
 
 void selectUserDefinitionsFile() {
 
-    struct FOD : OpenDialogBase {
-
-        STDMETHODIMP OnFileOk(IFileDialog*) override {
-            if (GetSelectedControlItem(2) == 22) return S_OK;
-            std::wstring filename = GetResultPath();
-            std::ifstream userfile(filename);
-            if (userfile) {
-                auto userrules = nlohmann::json::parse(userfile, 0, false, true);
-                if (userrules.is_discarded()) {
-                    HWND hw = 0;
-                    if (auto polew = QueryInterface<IOleWindow>()) {
-                        polew->GetWindow(&hw);
-                        polew->Release();
-                    }
-                    TaskDialog(hw, 0, L"Compose: Select or edit a user definitions file", L"Invalid JSON file",
-                               (L"\"" + filename + L"\" is not a valid JSON file. Please choose a different file.").data(),
-                               0, TD_ERROR_ICON, 0);
-                    return S_FALSE;
-                }
-            }
-            return S_OK;
-        }
+    // The file is not checked here: the loader reads and checks it, and reports it if it isn't valid
+    // (see LoadSequenceDefinitions.cpp).
 
+    struct FOD : OpenDialogBase {
+        STDMETHODIMP OnFileOk(IFileDialog*) override { return S_OK; }
     } fod;
 
     fod.SetFileName(data.userDefinitionsFile);
@@ -113,7 +97,7 @@ void selectUserDefinitionsFile() {
         if (fod.GetSelectedControlItem(2) == 21) {
             data.userDefinitionsFile = filename;
             data.userDefinitionsEnabled = true;
-            loadSequenceDefinitions();
+            loadSequenceDefinitions("menu");
         }
         else {
             if (npp(NPPM_DOOPEN, 0, filename.data())) {
@@ -125,7 +109,114 @@ void selectUserDefinitionsFile() {
 
     else if (fod.lastResult() == 1 && data.userDefinitionsEnabled) {
         data.userDefinitionsEnabled = false;
-        loadSequenceDefinitions();
+        loadSequenceDefinitions("menu");
+    }
+
+}
+
+
+namespace {
+
+    // Returns the reverse index for the definitions in effect, making it now if the loader hasn't.
+
+    std::shared_ptr<const ReverseIndex> reverseIndex() {
+        const auto definitions = data.definitions.load();
+        auto index = data.reverseIndex.load();
+        if (!index || index->definitions() != definitions) {
+            Timeline::Span span(timeline, "reverse index", "command");
+            const HCURSOR cursor = SetCursor(LoadCursor(0, IDC_WAIT));
+            index = ReverseIndex::build(definitions);
+            SetCursor(cursor);
+            data.reverseIndex.store(index);
+        }
+        return index;
+    }
+
+    // Shows the keys of a way to type something as the user would press them.
+
+    std::wstring describeKeys(std::u16string_view keys) {
+        std::wstring result = L"Compose";
+        for (size_t i = 0; i < keys.length();) {
+            const std::u16string_view key = keys.substr(i, definitionsAnalyzer::keyLength(keys.substr(i)));
+            result += L"  ";
+            result += key == u"\r" ? L"Enter" : key == u" " ? L"Space" : key == u"\t" ? L"Tab" : std::wstring(key.begin(), key.end());
+            i += key.length();
+        }
+        return result;
     }
 
-}
\ No newline at end of file
+}
+
+
+void howDoITypeSelected() {
+    std::string selected = sci.GetSelText();
+    if (selected.empty()) {
+        const Scintilla::Position position = sci.CurrentPos();
+        selected = sci.StringOfRange(Scintilla::Span(position, sci.PositionAfter(position)));
+    }
+    const std::wstring wide = toWide(selected);
+    std::u16string text(wide.begin(), wide.end());
+    if (text.empty() || text.length() > 64) return;
+    const auto index = reverseIndex();
+    std::vector<TypingWay> ways = index->ways(text);
+    if (ways.empty()) {
+        const std::u16string composed = normalize(text, NormalizationForm::C);
+        if (composed != text) ways = index->ways(text = composed);
+    }
+    static constexpr const wchar_t* kinds[] = { L"sequence", L"implicit combination", L"numeric entry" };
+    constexpr size_t shown = 12;
+    std::wstring content;
+    for (size_t i = 0; i < ways.size() && i < shown; ++i)
+        content += describeKeys(ways[i].keys) + L"    (" + kinds[ways[i].kind] + L")\n";
+    if (ways.size() > shown) content += L"and " + std::to_wstring(ways.size() - shown) + L" more";
+    if (ways.empty()) content = L"This can't be typed with Compose using the definitions in effect.";
+    const std::wstring instruction = L"How do I type \u201C" + std::wstring(text.begin(), text.end()) + L"\u201D?";
+    TaskDialog(plugin.nppData._nppHandle, 0, L"Compose", instruction.data(), content.data(), 0, 0, 0);
+}
+
+
+void showCoverageReport() {
+    const auto index = reverseIndex();
+    const auto& definitions = *index->definitions();
+    std::string report = "Compose: code points that can be typed with an explicit sequence or an implicit combination,\r\n"
+                         "by Unicode block (#x entry can type any code point, so it isn't counted).\r\n\r\n"
+                         "Definitions: built-in";
+    char line[160];
+    if (definitions.userDefinitions) {
+        const size_t* counts = definitions.issueCounts;  // in DefinitionsIssue::Kind order
+        std::snprintf(line, sizeof line, "\r\nIssues in user definitions: %zu duplicate, %zu override, %zu shadowed, "
+                      "%zu hide implicit, %zu hide #x", counts[0], counts[1], counts[2], counts[3], counts[4]);
+        report += " and " + utf16to8(definitions.userFile) + line;
+    }
+    report += "\r\n\r\n";
+    std::snprintf(line, sizeof line, "%-44s %-14s %8s %8s %8s %8s\r\n", "Block", "Range", "Assigned", "Explicit",
+                  "Implicit", "Either");
+    report += line;
+    size_t assigned = 0, explicitCount = 0, implicitCount = 0, covered = 0, empty = 0;
+    for (const ReverseIndex::BlockCoverage& block : index->coverage()) {
+        assigned += block.block->assigned;
+        if (!block.covered) {
+            ++empty;
+            continue;
+        }
+        explicitCount += block.explicitCount;
+        implicitCount += block.implicitCount;
+        covered       += block.covered;
+        char range[16];
+        std::snprintf(range, sizeof range, "%04X..%04X", static_cast<unsigned>(block.block->first),
+                      static_cast<unsigned>(block.block->last));
+        std::snprintf(line, sizeof line, "%-44s %-14s %8u %8u %8u %8u %5.1f%%\r\n", block.block->name, range,
+                      block.block->assigned, block.explicitCount, block.implicitCount, block.covered,
+                      100.0 * block.covered / std::max(block.block->assigned, 1u));
+        report += line;
+    }
+    std::snprintf(line, sizeof line, "\r\n%-44s %-14s %8zu %8zu %8zu %8zu\r\n\r\n%zu blocks with nothing covered are not listed.\r\n",
+                  "All blocks", "", assigned, explicitCount, implicitCount, covered, empty);
+    report += line;
+    npp(NPPM_MENUCOMMAND, 0, IDM_FILE_NEW);
+    if (npp(NPPM_SETBUFFERENCODING, npp(NPPM_GETCURRENTBUFFERID, 0, 0), 1)) {
+        plugin.getScintillaPointers();
+        sci.SetTargetRange(0, 0);
+        sci.ReplaceTarget(report.data());
+    }
+}
@@ -20,235 +20,216 @@
 // SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 // #include "Framework/UtilityFrameworkMIT.h"
-#include "UnicodeFormatTranslation.h"
+#include <charconv>
+#include "Framework/PluginFramework.h"
 #include "CommonData.h"
-
-// CombiningRule and combiningRules are defined in CommonData.cpp:
-// 
-//     struct CombiningRule { char32_t one, two, up, down; };
-//     std::map<std::wstring, CombiningRule> combiningRules;
-// 
-// LoadSequenceDefinitions fills in combiningRules from the sequence definition file(s).
-// 
-// A CombiningRule defines the interpretation of keys that represent combining marks (accents).
-// Each rule contains the char32_t results for a single accent, a double, an up and a down version.
-// A zero means the combination (double, up and/or down) is not valid; a 1 for up or down means use the single accent value.
-// 
-// combiningRules is a std::map from std::wstrings that represent combining marks to the CombiningRule structures that define them.
+#include "EditorSink.h"
+#include "KeyTranslation.h"
+#include "KeystrokeTrace.h"
+#include "Statistics.h"
+#ifdef _DEBUG
+#include <crtdbg.h>
+#endif
+
+// This is the Windows side of composing: it turns key messages into key text for the ComposeEngine (ComposeEngine.h),
+// which does the rest, and inserts what the engine composes directly into the Scintilla view that has the focus,
+// or, when the focus is elsewhere (as in a dialog), sends it as simulated keyboard input.
+//
+// Nothing on the path that processes a keystroke allocates memory: state is kept in FixedString buffers whose capacities
+// are more than any real sequence needs (a sequence that outgrows them ends as if it had no match), and definitions are
+// only referenced. In debug builds, processCompose asserts that no allocations were made while it ran.
 
 
 namespace {
 
-    std::string  composeSequence;            // compose sequence so far (encoding is UTF-8)
-    std::wstring implicitSuffix;             // trailing characters that follow a complete implicit match
-    int          correctingKeyLock = 0;      // set to pass one keyup/keydown pair because it is being sent to correct the lock state
-    bool         composing = false;          // true when a compose sequence is in progress
+    int  correctingKeyLock = 0;  // set to pass one keyup/keydown pair because it is being sent to correct the lock state
 
 
-    // ImplicitCombination implicitCombination keeps track of the progress of an implicit combination.
-    // 
-    // AddStatus add(std::wstring_view s)
-    //     Takes a new key to be added to the implicit combination.
-    //     Returns:
-    //         Accept:   The key has been added; more keys can be added.
-    //         Complete: The key has been added; the combination is finished and no more keys can be added.
-    //         Reject:   The key has not been added; the combination is finished and the supplied key is left over.
+    ComposeEngine engine;  // normalizes implicit combinations with UnicodeNormalization.h, not NormalizeString
+
+
+    // When the hidden setting KeystrokeTraceFile names a file, the key messages seen while composing, and the text sent,
+    // are appended to it as a keystroke trace (see KeystrokeTrace.h). Lines are collected in traceBuffer and written
+    // when a sequence ends, or when the buffer is full.
     //
-    //  void clear()
-    //      Resets the implicit combination to an empty sequence.
+    // bool tracing()
+    //     True when a trace is being written.
     //
-    //  std::wstring compose()
-    //      Returns the composed string for the implicit combination.
+    // void traceKey(WPARAM wParam, LPARAM lParam, bool composeKey, std::u16string_view text = {})
+    //     Records a key message; text is the key text passed to the engine, if any.
     //
-    //  AddStatus status() const
-    //      Returns the status from the last add operation.
+    // void traceOutput(std::u16string_view text)
+    //     Records text sent as input.
+    //
+    // void traceFlush()
+    //     Appends what has been recorded to the trace file.
+
+    FixedString<char, 16384> traceBuffer;
+    DWORD traceTime = 0;  // time of the last key message recorded
+
+    bool tracing() { return !data.keystrokeTraceFile.get().empty(); }
+
+    void traceFlush() {
+        if (traceBuffer.empty()) return;
+        HANDLE file = CreateFile(data.keystrokeTraceFile.get().data(), FILE_APPEND_DATA, FILE_SHARE_READ, 0,
+                                 OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, 0);
+        if (file != INVALID_HANDLE_VALUE) {
+            DWORD written;
+            WriteFile(file, traceBuffer.begin(), static_cast<DWORD>(traceBuffer.length()), &written, 0);
+            CloseHandle(file);
+        }
+        traceBuffer.clear();
+    }
 
-    class ImplicitCombination {
-    public:
-        enum AddStatus {Accept, Complete, Reject};
-    private:
-        enum ModStatus {ModNone, ModUp, ModDown};
-        struct Marks { bool one = false, two = false, up = false, down = false; };
-        std::map<std::wstring, Marks> haveMark;
-        std::wstring          base;
-        std::vector<char32_t> comb;
-        int                   value = 0;
-        AddStatus             addStatus = Accept;
-        ModStatus             modPending = ModNone;
-    public:
-        AddStatus add(const std::wstring& s);
-        void clear() { base.clear(); comb.clear(); haveMark.clear(); value = 0; addStatus = Accept; modPending = ModNone; }
-        std::wstring  compose() const;
-        AddStatus status() const { return addStatus; }
-    } implicitCombination;
+    template<typename F> void traceLine(F append) {
+        const size_t length = traceBuffer.length();
+        if (append()) return;
+        while (traceBuffer.length() > length) traceBuffer.pop_back();
+        traceFlush();
+        if (!append()) traceBuffer.clear();  // a line longer than the buffer is left out
+    }
 
+    void traceKey(WPARAM wParam, LPARAM lParam, bool composeKey, std::u16string_view text = {}) {
+        const DWORD time = GetMessageTime();
+        const uint8_t flags = (lParam & 0x80000000            ? TraceEvent::KeyUp      : 0)
+                            | (lParam & 0x40000000            ? TraceEvent::Repeat     : 0)
+                            | (composeKey                     ? TraceEvent::ComposeKey : 0)
+                            | (GetKeyState(VK_SHIFT  ) < 0    ? TraceEvent::Shift      : 0)
+                            | (GetKeyState(VK_CONTROL) < 0    ? TraceEvent::Control    : 0)
+                            | ((lParam >> 16) & KF_ALTDOWN    ? TraceEvent::Alt        : 0)
+                            | ((lParam >> 16) & KF_EXTENDED   ? TraceEvent::Extended   : 0);
+        const uint32_t elapsed = traceTime ? time - traceTime : 0;
+        traceTime = time;
+        traceLine([&] { return appendTraceKey(traceBuffer, elapsed, static_cast<uint16_t>(wParam),
+                                              static_cast<uint16_t>((lParam >> 16) & 0x1FF), flags, text); });
+    }
 
-    ImplicitCombination::AddStatus ImplicitCombination::add(const std::wstring& s) {
+    void traceOutput(std::u16string_view text) {
+        traceLine([&] { return appendTraceOutput(traceBuffer, text); });
+    }
 
-        if (addStatus != Accept) return addStatus = Reject;
-        if (s == L"\r") return addStatus = Complete;
 
-        if (base.length() == 1) {
-            if (s.length() == 1 && comb.empty() && modPending == ModNone) {
-                wchar_t b = base[0];
-                wchar_t c = s[0];
-                if (b == L'&' && c == L'#') {
-                    base = L"&#";
-                    return Accept;
-                }
-                else if (iswxdigit(b) && iswxdigit(c)) {
-                    base = L"#x";
-                    comb.push_back(b);
-                    comb.push_back(c);
-                    value = (b <= L'9' ? b - L'0' : b >= L'a' ? b - L'a' + 10 : b - L'A' + 10) * 16
-                          + (c <= L'9' ? c - L'0' : c >= L'a' ? c - L'a' + 10 : c - L'A' + 10);
-                    return Accept;
-                }
-            }
-        }
+    // SendInputSink sends text as simulated keyboard input.
 
-        else if (base == L"&#" || base == L"&#x" || base == L"#x") {
-            if (s.length() != 1) return addStatus = Reject;
-            const wchar_t c = s[0];
-            if (c == L';') {
-                if (base == L"#x") return addStatus = Reject;
-                comb.push_back(c);
-                return addStatus = Complete;
-            }
-            int v;
-            if (base == L"&#") {
-                if (comb.empty() && (c == L'X' || c == L'x')) {
-                    base = L"&#x";
-                    return Accept;
+    class SendInputSink : public ComposeEngine::OutputSink {
+    public:
+        void send(std::u16string_view text) override {
+            const auto timer = statistics.timer(statistics.send);
+            if (!text.empty() && tracing()) traceOutput(text);
+            static INPUT input[2 * 64];
+            while (!text.empty()) {
+                const size_t n = text.length() < 64 ? text.length() : 64;
+                for (size_t i = 0; i < n; ++i) {
+                    input[2 * i].type           = input[2 * i + 1].type           = INPUT_KEYBOARD;
+                    input[2 * i].ki.wVk         = input[2 * i + 1].ki.wVk         = 0;
+                    input[2 * i].ki.wScan       = input[2 * i + 1].ki.wScan       = text[i];
+                    input[2 * i].ki.time        = input[2 * i + 1].ki.time        = 0;
+                    input[2 * i].ki.dwExtraInfo = input[2 * i + 1].ki.dwExtraInfo = 0;
+                    input[2 * i].ki.dwFlags     = KEYEVENTF_UNICODE;
+                    input[2 * i + 1].ki.dwFlags = KEYEVENTF_KEYUP | KEYEVENTF_UNICODE;
                 }
-                if (!iswdigit(c)) return addStatus = Reject;
-                v = value * 10;
+                SendInput(static_cast<UINT>(n * 2), input, sizeof INPUT);
+                text.remove_prefix(n);
             }
-            else {
-                if (!iswxdigit(c)) return addStatus = Reject;
-                v = value * 16;
-            }
-            v += c <= L'9' ? c - L'0' : c >= L'a' ? c - L'a' + 10 : c - L'A' + 10;
-            if (v < 0x110000) {
-                value = v;
-                comb.push_back(c);
-                return addStatus = (base == L"#x" && (value >= 0x11000 || comb.size() > 5) ? Complete : Accept);
-            }
-            return addStatus = Reject;
         }
-
-        if (s.length() > 2) /* bracketed name of a non-character key */ {
-            if (s == L"[Up]"  ) { modPending = ModUp  ; return Accept; }
-            if (s == L"[Down]") { modPending = ModDown; return Accept; }
-            return addStatus = Reject;
-        }
-
-        if (data.combiningRules.contains(s)) {
-            const CommonData::CombiningRule& rule = data.combiningRules[s];
-            Marks& marks = haveMark[s];
-            switch (modPending) {
-            case ModUp:
-                if (rule.up == 1) break;
-                if (marks.up || !rule.up) return addStatus = Reject;
-                marks.up = true;
-                comb.push_back(rule.up);
-                modPending = ModNone;
-                return Accept;
-            case ModDown:
-                if (rule.down == 1) break;
-                if (marks.down || !rule.down) return addStatus = Reject;
-                marks.down = true;
-                comb.push_back(rule.down);
-                modPending = ModNone;
-                return Accept;
-            default:;
-            }
-            if (marks.two) return addStatus = Reject;
-            if (marks.one) {
-                if (!rule.two) return addStatus = Reject;
-                if (comb.empty() || comb.back() != rule.one) return addStatus = Reject;
-                marks.one = false;
-                marks.two = true;
-                comb.back() = rule.two;
-                modPending = ModNone;
-                return Accept;
-            }
-            if (rule.one) {
-                marks.one = true;
-                comb.push_back(rule.one);
-                modPending = ModNone;
-                return Accept;
-            }
-            return addStatus = Reject;
-        }
-
-        if (modPending != ModNone || !base.empty()) return addStatus = Reject;
-        base = s;
-        return addStatus = (comb.empty() ? Accept : Complete);
-
-    }
+    } sendInput;
 
 
-    std::wstring ImplicitCombination::compose() const {
+    // ScintillaEditor inserts text into the Scintilla view whose pointers are in plugin.sci, at every selection (see
+    // insertAtSelection and insertAtSelections in EditorSink.h), all in one undo action. As when typing, only the main
+    // selection is kept if multi-editing is off, and a rectangular selection is left as a zero-width rectangle after
+    // the text.
 
-        if ( ((base == L"&#" || base == L"&#x") && comb.size() > 1 && comb.back() == L';') || (base == L"#x" && !comb.empty()) ) {
-            std::wstring r;
-            if (value >= 0x10000) {
-                r  = static_cast<wchar_t>(0xD800 + ((value - 0x10000) >> 10));
-                r += static_cast<wchar_t>(0xDC00 + (value & 0x03FF));
+    class ScintillaEditor : public TextEditor {
+        Scintilla::Position targetStart = 0;
+        Scintilla::Position targetEnd   = 0;
+        bool                rectangular = false;
+    public:
+        void beginUndoAction() override {
+            Scintilla::ScintillaCall& sci = plugin.sci;
+            sci.BeginUndoAction();
+            targetStart = sci.TargetStart();
+            targetEnd   = sci.TargetEnd();
+            rectangular = sci.SelectionIsRectangle();
+            if (sci.Selections() > 1 && !sci.AdditionalSelectionTyping()) {
+                const int main = sci.MainSelection();
+                const Scintilla::Position caretSpace  = sci.SelectionNCaretVirtualSpace(main);
+                const Scintilla::Position anchorSpace = sci.SelectionNAnchorVirtualSpace(main);
+                sci.SetSelection(sci.SelectionNCaret(main), sci.SelectionNAnchor(main));
+                sci.SetSelectionNCaretVirtualSpace(0, caretSpace);
+                sci.SetSelectionNAnchorVirtualSpace(0, anchorSpace);
+                rectangular = false;
             }
-            else r = static_cast<wchar_t>(value);
-            return r;
         }
-
-        std::wstring s = base;
-        for (char32_t c : comb)
-            if (c >= 0x10000) {
-                s += static_cast<wchar_t>(0xD800 + ((c - 0x10000) >> 10));
-                s += static_cast<wchar_t>(0xDC00 + (c & 0x03FF));
-            }
-            else s += static_cast<wchar_t>(c);
-
-        std::wstring r;
-        if (!s.empty()) {
-            const int sl = static_cast<int>(s.length());
-            const int rl = NormalizeString(NormalizationC, s.data(), sl, 0, 0);
-            if (rl > 0) {
-                r.resize(rl);
-                const int nl = NormalizeString(NormalizationC, s.data(), sl, r.data(), rl);
-                if (nl <= 0) r.clear(); else r.resize(nl);
+        void endUndoAction() override {
+            plugin.sci.SetTargetRange(targetStart, targetEnd);
+            plugin.sci.EndUndoAction();
+        }
+        void insert(std::string_view text) override {
+            if (plugin.sci.Selections() == 1) insertAtSelection(plugin.sci, text);
+            else insertAtSelections(plugin.sci, text);
+        }
+        void finish() override {
+            Scintilla::ScintillaCall& sci = plugin.sci;
+            if (rectangular) {
+                // the ranges of a rectangular selection run from the anchor's line to the caret's line
+                const Scintilla::Position anchor = sci.SelectionNCaret(0);
+                const Scintilla::Position caret  = sci.SelectionNCaret(sci.Selections() - 1);
+                sci.SetRectangularSelectionAnchor(anchor);
+                sci.SetRectangularSelectionCaret(caret);
             }
+            sci.ScrollCaret();
         }
+    } scintillaEditor;
 
-        switch (modPending) {
-        case ModUp  : r += L"[Up]"  ; break;
-        case ModDown: r += L"[Down]"; break;
-        default: ;
-        }
-        return r;
-    }
+    // ScintillaSink writes text into the Scintilla view, as one undo action for each sequence (see EditorSink.h).
 
+    class ScintillaSink : public EditorSink {
+    public:
+        ScintillaSink() : EditorSink(scintillaEditor) {}
+        void send(std::u16string_view text) override {
+            const auto timer = statistics.timer(statistics.send);
+            if (!text.empty() && tracing()) traceOutput(text);
+            EditorSink::send(text);
+        }
+    } scintillaInsert;
 
-    // void sendString(std::wstring_view text)
+    // ComposeOutput is the sink passed to the engine. On the first text sent after finish, it chooses where the text
+    // goes: scintillaInsert when the focus is in a Scintilla view of a UTF-8 document, not in overtype mode; otherwise
+    // sendInput, so that keys typed in a dialog (or in an ANSI document, where text must be translated as Scintilla
+    // translates typing) still reach the control that has the focus, as before. Text for more than one selection is
+    // also sent with sendInput while a macro is being recorded, since Scintilla does not record how it is inserted.
     //
-    // Sends a string as simulated keyboard input.
-
-    void sendString(std::wstring_view text) {
-        size_t n = text.length();
-        if (!n) return;
-        INPUT* input = new INPUT[2 * n];
-        for (size_t i = 0; i < n; ++i) {
-            input[2 * i].type           = input[2 * i + 1].type           = INPUT_KEYBOARD;
-            input[2 * i].ki.wVk         = input[2 * i + 1].ki.wVk         = 0;
-            input[2 * i].ki.wScan       = input[2 * i + 1].ki.wScan       = text[i];
-            input[2 * i].ki.time        = input[2 * i + 1].ki.time        = 0;
-            input[2 * i].ki.dwExtraInfo = input[2 * i + 1].ki.dwExtraInfo = 0;
-            input[2 * i].ki.dwFlags     = KEYEVENTF_UNICODE;
-            input[2 * i + 1].ki.dwFlags = KEYEVENTF_KEYUP | KEYEVENTF_UNICODE;
+    // void finish()
+    //     Called after each call to the engine that can send text; ends the undo action, if there was text.
+
+    class ComposeOutput : public ComposeEngine::OutputSink {
+        ComposeEngine::OutputSink* target = 0;
+        static ComposeEngine::OutputSink& choose() {
+            const HWND focus = GetFocus();
+            if (!focus || (focus != plugin.nppData._scintillaMainHandle && focus != plugin.nppData._scintillaSecondHandle))
+                return sendInput;
+            plugin.getScintillaPointers(focus);
+            if (plugin.sci.CodePage() != Scintilla::CpUtf8 || plugin.sci.Overtype())
+                return sendInput;
+            if (plugin.sci.Selections() > 1 && plugin.sci.AdditionalSelectionTyping()
+                && SendMessage(plugin.nppData._nppHandle, NPPM_GETCURRENTMACROSTATUS, 0, 0)
+                   == static_cast<LRESULT>(NPP::MacroStatus::RecordInProgress))
+                return sendInput;
+            statistics.count(statistics.directInserts);
+            return scintillaInsert;
         }
-        SendInput(static_cast<UINT>(n * 2), input, sizeof INPUT);
-        delete[] input;
-    }
+    public:
+        void send(std::u16string_view text) override {
+            if (text.empty()) return;
+            if (!target) target = &choose();
+            target->send(text);
+        }
+        void finish() {
+            if (target == &scintillaInsert) scintillaInsert.finish();
+            target = 0;
+        }
+    } composeOutput;
 
 
     // void reverseLockingKey(WPARAM virtualKey = 0)
@@ -276,67 +257,189 @@ namespace {
     }
 
 
-    // void processSequence(WPARAM wParam, LPARAM lParam)
+    // WindowsKeyboard asks Windows what keys type in the current keyboard layout, for keyTranslations.
     //
-    // Accumulates keystrokes while composing.
-    // When an explicit match is found or an implicit match is complete, sends composition and sets composing = false.
+    // Keys are translated with ToUnicodeEx using only the state of Shift, Ctrl and Alt (Caps Lock is ignored, as it
+    // always has been), and with the flag that leaves the keyboard state alone; where that flag is not supported,
+    // a dead key is translated a second time, which clears it, so asking about a dead key never changes what the next
+    // key types. Dead keys are still not used in sequences.
 
-    void processSequence(WPARAM wParam, LPARAM lParam) {
+    class WindowsKeyboard : public KeyboardLayout {
+    public:
+        HKL layout = 0;
+        int translate(uint8_t virtualKey, uint8_t scanCode, uint8_t modifiers, char16_t* out, int capacity) override {
+            BYTE state[256] = {};
+            if (modifiers & KeyTranslationCache::Shift  ) state[VK_SHIFT  ] = state[VK_LSHIFT  ] = 0x80;
+            if (modifiers & KeyTranslationCache::Control) state[VK_CONTROL] = state[VK_LCONTROL] = 0x80;
+            if (modifiers & KeyTranslationCache::Alt    ) state[VK_MENU   ] = state[VK_LMENU   ] = 0x80;
+            wchar_t text[16];
+            const int length = ToUnicodeEx(virtualKey, scanCode, state, text, 16, 4, layout);
+            if (length < 0) {
+                wchar_t again[16];
+                ToUnicodeEx(virtualKey, scanCode, state, again, 16, 4, layout);
+            }
+            const int n = length < 0 ? 1 : length < capacity ? length : capacity;
+            std::copy(text, text + n, out);
+            return length < 0 ? -1 : n;
+        }
+        int keyName(uint8_t scanCode, bool extended, char16_t* out, int capacity) override {
+            wchar_t name[32];
+            const int length = GetKeyNameText(scanCode << 16 | (extended ? 1 << 24 : 0), name, 32);
+            const int n = length < capacity ? length : capacity;
+            std::copy(name, name + n, out);
+            return n;
+        }
+    } windowsKeyboard;
 
-        UINT scanCode = (lParam & 0x00FF0000) >> 16;
-        unsigned char keyboardState[256];
-        GetKeyboardState(keyboardState);
-        keyboardState[VK_CAPITAL] = 0;  // Ignore caps lock if toggled
+    KeyTranslationCache keyTranslations;
 
-        wchar_t charsTyped[16];
-        int len = ToUnicode(static_cast<UINT>(wParam), scanCode, keyboardState, charsTyped, 16, 0);
-        if (len < 0) return;
 
-        std::wstring stringTyped;
-        if (len == 0) /* map some non-character keys we can use */ {
+    // void getKeyText(WPARAM wParam, LPARAM lParam, FixedString<char16_t, 40>& stringTyped)
+    //
+    // Sets stringTyped to the key text for a keystroke (see ComposeEngine.h), or leaves it empty if the key is not used.
+    // Translations are cached for each keyboard layout (see KeyTranslation.h); since the layout is checked on every
+    // keystroke, changing the input language takes effect with the next key.
+
+    void getKeyText(WPARAM wParam, LPARAM lParam, FixedString<char16_t, 40>& stringTyped) {
+
+        const uint8_t scanCode  = static_cast<uint8_t>((lParam & 0x00FF0000) >> 16);
+        const uint8_t modifiers = (GetKeyState(VK_SHIFT  ) < 0 ? KeyTranslationCache::Shift   : 0)
+                                | (GetKeyState(VK_CONTROL) < 0 ? KeyTranslationCache::Control : 0)
+                                | (GetKeyState(VK_MENU   ) < 0 ? KeyTranslationCache::Alt     : 0);
+        windowsKeyboard.layout = GetKeyboardLayout(0);
+        const uintptr_t layoutId = reinterpret_cast<uintptr_t>(windowsKeyboard.layout);
+        const auto typed = keyTranslations.translate(windowsKeyboard, layoutId, static_cast<uint8_t>(wParam), scanCode, modifiers);
+        if (typed.length < 0) return;
+
+        if (typed.length == 0) /* map some non-character keys we can use */ {
             switch (wParam) {
             case VK_SHIFT:
             case VK_CONTROL:
             case VK_MENU:
                 return;
-            case VK_LEFT   : stringTyped = L"[Left]" ; break;
-            case VK_UP     : stringTyped = L"[Up]"   ; break;
-            case VK_RIGHT  : stringTyped = L"[Right]"; break;
-            case VK_DOWN   : stringTyped = L"[Down]" ; break;
+            case VK_LEFT   : stringTyped.assign(u"[Left]" ); break;
+            case VK_UP     : stringTyped.assign(u"[Up]"   ); break;
+            case VK_RIGHT  : stringTyped.assign(u"[Right]"); break;
+            case VK_DOWN   : stringTyped.assign(u"[Down]" ); break;
             default:
             {
                 reverseLockingKey(wParam);
-                wchar_t keyname[32];
-                if (GetKeyNameText(static_cast<LONG>(lParam), keyname, 32))
-                    stringTyped = L"[" + std::wstring(keyname) + L"]";
-                else return;
+                const std::u16string_view name = keyTranslations.name(windowsKeyboard, layoutId, scanCode, (lParam >> 24) & 1);
+                if (name.empty()) return;
+                stringTyped.push_back(u'[');
+                stringTyped.append(name);
+                stringTyped.push_back(u']');
             }
             }
         }
-        else stringTyped = std::wstring(charsTyped, len);
-
-        if (implicitCombination.add(stringTyped) == ImplicitCombination::Reject) implicitSuffix += stringTyped;
-
-        composeSequence += utf16to8(stringTyped);
-        size_t sequenceLength = composeSequence.length();
-        for (auto& rule : data.rules.items()) {
-            if (!rule.value().is_string()) continue;
-            std::string key = rule.key();
-            if (key == composeSequence) {
-                composing = false;
-                sendString(utf8to16(rule.value()));
-                composeSequence.clear();
-                return;
+        else stringTyped.assign(typed.text);
+
+    }
+
+
+    // When the ShowCompletions setting is on, the explicit sequences that complete the keys typed so far (up to nine,
+    // fewest keys first) are shown in a calltip in the Scintilla view that has the focus, numbered, so that a number
+    // key that doesn't continue the sequence chooses one while the calltip is shown (see ComposeEngine::key). The
+    // choices are computed when definitions are compiled (see SequenceTrie.h), so showing them only formats a few
+    // lines, even for & and its thousands of HTML character references. Keys are shown with spaces and control
+    // characters as visible symbols; the calltip is only shown in UTF-8 documents, since its text is UTF-8.
+    //
+    // void showChoices()
+    //     Called after each key, restart or clear; shows the calltip for the keys typed so far, or removes it.
+
+    HWND choicesView = 0;  // Scintilla view showing the calltip, if any
+
+    template<size_t N> void appendVisible(FixedString<char, N>& s, std::string_view text, bool spaces) {
+        for (const char c : text) {
+            const unsigned char b = static_cast<unsigned char>(c);
+            if (b < 0x20) {
+                s.append("\xE2\x90");  // control pictures, U+2400 to U+241F
+                s.push_back(static_cast<char>(0x80 + b));
             }
-            else if (key.length() > sequenceLength && key.substr(0, sequenceLength) == composeSequence) return;
+            else if (b == ' ' && spaces) s.append("\xE2\x90\xA3");  // open box
+            else s.push_back(c);
         }
+    }
 
-        if (implicitCombination.status() == ImplicitCombination::Accept) return;
-        composing = false;
-        sendString(implicitCombination.compose() + implicitSuffix);
-        implicitSuffix.clear();
-        composeSequence.clear();
+    void showChoices() {
+        const HWND focus = GetFocus();
+        const bool show  = data.showCompletions && !engine.empty() && engine.choiceCount()
+                        && (focus == plugin.nppData._scintillaMainHandle || focus == plugin.nppData._scintillaSecondHandle);
+        if (choicesView && (!show || choicesView != focus)) {
+            plugin.getScintillaPointers(choicesView);
+            plugin.sci.CallTipCancel();
+            choicesView = 0;
+        }
+        if (!show) return;
+        plugin.getScintillaPointers(focus);
+        if (plugin.sci.CodePage() != Scintilla::CpUtf8) return;
+        constexpr size_t shownOutput = 32;  // UTF-16 code units of each output shown
+        FixedString<char, 4096> tip;
+        for (size_t i = 0; i < engine.choiceCount(); ++i) {
+            char rest[256];
+            size_t restLength;
+            const std::u16string_view output = engine.choice(i, rest, restLength);
+            FixedString<char, 128> outputText;
+            appendUtf8(outputText, output.substr(0, shownOutput));
+            FixedString<char, 2048> line;
+            if (i) line.push_back('\n');
+            line.push_back(static_cast<char>('1' + i));
+            line.append("  ");
+            appendVisible(line, engine.typed(), true);
+            appendVisible(line, std::string_view(rest, restLength), true);
+            line.append("   ");
+            appendVisible(line, outputText, false);
+            if (output.length() > shownOutput) line.append("\xE2\x80\xA6");  // ellipsis
+            if (tip.length() + line.length() > 4096 - 32) break;
+            tip.append(line);
+        }
+        if (const uint32_t more = engine.completionCount() - static_cast<uint32_t>(engine.choiceCount())) {
+            char number[16];
+            tip.append("\n+");
+            tip.append(std::string_view(number, std::to_chars(number, number + sizeof number, more).ptr - number));
+            tip.append(" more");
+        }
+        tip.push_back('\0');
+        plugin.sci.CallTipShow(plugin.sci.CurrentPos(), tip.begin());
+        choicesView = focus;
+    }
+
+
+    // When the LongestMatchTimeout setting is not zero, a sequence that is complete but also the beginning of a longer
+    // one waits (see ComposeEngine::setMatching); waitForLongestMatch, called after each key, sets a thread timer
+    // which sends the sequence if no other key is typed within that many milliseconds.
+
+    UINT_PTR longestMatchTimer = 0;
+
+    void CALLBACK longestMatchExpired(HWND, UINT, UINT_PTR, DWORD) {
+        KillTimer(0, longestMatchTimer);
+        longestMatchTimer = 0;
+        engine.expire(composeOutput);
+        composeOutput.finish();
+        showChoices();
+        if (!engine.composing()) traceFlush();
+    }
+
+    void waitForLongestMatch() {
+        if (longestMatchTimer) KillTimer(0, longestMatchTimer);
+        longestMatchTimer = engine.pending() ? SetTimer(0, 0, data.longestMatchTimeout, longestMatchExpired) : 0;
+    }
+
+
+    // void processSequence(WPARAM wParam, LPARAM lParam)
+    //
+    // Passes the text of a keystroke typed while composing to the engine.
 
+    void processSequence(WPARAM wParam, LPARAM lParam) {
+        const auto timer = statistics.timer(statistics.processSequence);
+        FixedString<char16_t, 40> stringTyped;
+        getKeyText(wParam, lParam, stringTyped);
+        if (tracing()) traceKey(wParam, lParam, false, stringTyped);
+        if (stringTyped.empty()) return;
+        engine.key(stringTyped, composeOutput, choicesView && choicesView == GetFocus());
+        composeOutput.finish();
+        waitForLongestMatch();
+        showChoices();
     }
 
 
@@ -345,7 +448,43 @@ namespace {
     // Handles the compose key and delegates keystrokes while composing to processSequence.
     // Returns true if keystroke should be blocked or false if it should be passed on.
 
+#ifdef _DEBUG
+
+    // In debug builds, KeystrokeAllocationCheck counts heap allocations made through the C runtime on this thread
+    // while it exists, and asserts that there were none. It is used in processCompose.
+
+    class KeystrokeAllocationCheck {
+        inline static _CRT_ALLOC_HOOK previousHook = 0;
+        inline static bool            installed    = false;
+        inline static DWORD           thread       = 0;
+        inline static long            count        = -1;  // -1 when not counting
+        static int __cdecl hook(int allocType, void* userData, size_t size, int blockType, long request,
+                                const unsigned char* file, int line) {
+            if (count >= 0 && allocType != _HOOK_FREE && blockType != _CRT_BLOCK && GetCurrentThreadId() == thread) ++count;
+            return previousHook ? previousHook(allocType, userData, size, blockType, request, file, line) : TRUE;
+        }
+    public:
+        KeystrokeAllocationCheck() {
+            if (!installed) {
+                previousHook = _CrtSetAllocHook(hook);
+                installed = true;
+            }
+            thread = GetCurrentThreadId();
+            count = 0;
+        }
+        ~KeystrokeAllocationCheck() {
+            _ASSERTE(count == 0 && "heap allocation while processing a keystroke");
+            count = -1;
+        }
+    };
+
+#endif
+
     bool processCompose(WPARAM wParam, LPARAM lParam) {
+#ifdef _DEBUG
+        KeystrokeAllocationCheck allocationCheck;
+#endif
+        const auto timer = statistics.timer(statistics.processCompose);
         if (correctingKeyLock) {
             --correctingKeyLock;
             return false;
@@ -355,16 +494,17 @@ namespace {
                                   | (GetKeyState(VK_CONTROL) < 0  ? HOTKEYF_CONTROL << 8 : 0)
                                   | ((lParam >> 16) & KF_ALTDOWN  ? HOTKEYF_ALT     << 8 : 0)
                                   | ((lParam >> 16) & KF_EXTENDED ? HOTKEYF_EXT     << 8 : 0)) == data.composeKey;
-        if (composing) {
+        if (tracing() && (composeKey || (engine.composing() && lParam & 0xC0000000))) traceKey(wParam, lParam, composeKey);
+        if (engine.composing()) {
             if (composeKey) {
                 if (releasing) return true;
-                else if (composeSequence.empty()) composing = false;
+                else if (engine.empty()) engine.cancel();
                 else {
                     reverseLockingKey();
-                    sendString(implicitCombination.compose() + implicitSuffix);
-                    composeSequence.clear();
-                    implicitSuffix.clear();
-                    implicitCombination.clear();
+                    engine.restart(composeOutput);
+                    composeOutput.finish();
+                    waitForLongestMatch();
+                    showChoices();
                     return true;
                 }
             }
@@ -377,18 +517,15 @@ namespace {
         }
         else if (composeKey) {
             if (releasing) {
-                if (!composeSequence.empty()) {
-                    composeSequence.clear();
-                    implicitSuffix.clear();
-                    implicitCombination.clear();
+                if (!engine.empty()) {
+                    engine.clear();
+                    showChoices();
                     return true;
                 }
             }
             else {
-                composing = true;
-                composeSequence.clear();
-                implicitSuffix.clear();
-                implicitCombination.clear();
+                engine.setMatching(data.commitUniquePrefix, data.longestMatchTimeout > 0);
+                engine.start(data.definitions.load());
                 reverseLockingKey();
                 return true;
             }
@@ -408,18 +545,22 @@ namespace {
 LRESULT CALLBACK processMessages(int code, WPARAM wParam, LPARAM lParam) {
     MSG& msg = *reinterpret_cast<MSG*>(lParam);
     static bool suppressNextContextMenu = false;
+    statistics.count(statistics.messagesSeen);
     if (code == HC_ACTION && wParam == PM_REMOVE) {
         switch (LOWORD(msg.message)) {
         case WM_KEYDOWN:
         case WM_SYSKEYDOWN:
-            if (composing && msg.wParam == VK_APPS) {
+            if (engine.composing() && msg.wParam == VK_APPS) {
                 suppressNextContextMenu = true;
             }
             [[fallthrough]];
         case WM_KEYUP:
         case WM_SYSKEYUP:
             if (!data.bypassCompose && msg.wParam != VK_PACKET) {
-                if (processCompose(msg.wParam, msg.lParam)) {
+                const auto timer = statistics.timer(statistics.processMessages);
+                const bool blocked = processCompose(msg.wParam, msg.lParam);
+                if (!engine.composing()) traceFlush();
+                if (blocked) {
                     msg.message = WM_NULL;
                     return 0;
                 }
@@ -427,7 +568,7 @@ LRESULT CALLBACK processMessages(int code, WPARAM wParam, LPARAM lParam) {
             }
             break;
         case WM_CONTEXTMENU:
-            if (composing || suppressNextContextMenu) {
+            if (engine.composing() || suppressNextContextMenu) {
                 suppressNextContextMenu = false;
                 msg.message = WM_NULL;
                 return 0;
@@ -18,16 +18,15 @@
 #include "Framework/UtilityFramework.h"
 #include "CommonData.h"
 #include "FileDialogBase.h"
-#include <fstream>
 
-bool loadSequenceDefinitions();
+void loadSequenceDefinitions(const char* reason);
 
 
 namespace {
 
     std::wstring forwardCloseFileName;  // Full path and name of a user definitions file about to close
 
-    void askUserDefinitionsFile(std::wstring fileName) {
+    void askUserDefinitionsFile(std::wstring fileName, const char* reason) {
 
         data.pendingQueryOnClose = false;
 
@@ -37,20 +36,9 @@ namespace {
             TDCBF_YES_BUTTON | TDCBF_NO_BUTTON, 0, &response);
         if (response != IDYES) return;
 
-        std::ifstream userfile(fileName);
-        if (userfile) {
-            auto userrules = nlohmann::json::parse(userfile, 0, false, true);
-            if (userrules.is_discarded()) {
-                TaskDialog(plugin.nppData._nppHandle, 0, L"Compose", L"Invalid JSON file",
-                    (L"\"" + fileName + L"\" is not a valid JSON file.").data(),
-                    0, TD_WARNING_ICON, 0);
-                return;
-            }
-        }
-
         data.userDefinitionsFile = fileName;
         data.userDefinitionsEnabled = true;
-        loadSequenceDefinitions();
+        loadSequenceDefinitions(reason);
 
     }
 
@@ -69,7 +57,7 @@ void fileBeforeClose(const NMHDR* nm) {
 void fileClosed(const NMHDR* nm) {
 	if (nm->idFrom != data.pendingUserDefBuffer) return;
 	if (npp(NPPM_GETPOSFROMBUFFERID, nm->idFrom, 0) != -1) /* still open in other view */ return;
-    if (data.pendingQueryOnClose) askUserDefinitionsFile(forwardCloseFileName);
+    if (data.pendingQueryOnClose) askUserDefinitionsFile(forwardCloseFileName, "close prompt");
 	data.pendingUserDefBuffer = 0;
 }
 
@@ -84,6 +72,6 @@ void fileSaved(const NMHDR* nm) {
     fileName.resize(fileNameLength);
     npp(NPPM_GETFULLPATHFROMBUFFERID, nm->idFrom, fileName.data());
 
-    askUserDefinitionsFile(fileName);
+    askUserDefinitionsFile(fileName, "save prompt");
 
 }
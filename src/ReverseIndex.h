@@ -0,0 +1,384 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "ComposeEngine.h"
+#include "DefinitionsAnalyzer.h"
+#include "UnicodeFormatTranslation.h"
+#include "UnicodeNormalization.h"
+#include "UnicodeTables.h"
+
+// ReverseIndex lists the ways text can be typed with compiled definitions, for "How do I type...?" and the coverage
+// report. A way is the key text of each key typed after the compose key (\r for Enter), of one of three kinds:
+//
+//     Explicit  a sequence whose output is the text, unless a shorter sequence that begins it is complete
+//     Implicit  the accents and then the base character, or the base character, the accents and Enter, when the
+//               canonical decomposition of the text is a base character followed by accents that each have a
+//               combining rule (as a single or double accent, or with [Up] or [Down])
+//     HexEntry  the hexadecimal value of a single code point (at least two digits), followed by Enter unless that
+//               completes it, or &#x entry if #x entry is hidden by an explicit sequence
+//
+// Implicit and hex entry ways are typed into a ComposeEngine with the definitions (with the default matching)
+// to make sure they produce the text, so a way hidden by an explicit sequence isn't listed.
+//
+// build enumerates every explicit sequence, and the implicit ways of every code point that has a canonical
+// decomposition, on several threads: each thread takes subtrees of the sequence trie, then groups of code points,
+// until there are none left, and sorts what it found; the sorted parts are then merged. Hex entry, and implicit
+// ways of text that is not a single precomposed character (such as a letter with an accent that has no precomposed
+// form), are worked out when asked for.
+//
+// static std::shared_ptr<const ReverseIndex> build(std::shared_ptr<const ComposeDefinitions> definitions,
+//                                                  unsigned threads = 0)
+//     Makes the index for definitions, using the given number of threads (0 for one per processor).
+//
+// const std::shared_ptr<const ComposeDefinitions>& definitions() const
+//     The definitions the index was made for.
+//
+// std::vector<TypingWay> ways(std::u16string_view text) const
+//     The ways to type text, fewest keys first.
+//
+// std::vector<BlockCoverage> coverage() const
+//     For each Unicode block, the number of its assigned code points that can be typed by explicit sequences, by
+//     implicit combinations, and by either (#x entry, which can type any code point, isn't counted).
+//
+// size_t size() const
+//     The number of ways in the index.
+
+struct TypingWay {
+    enum Kind : uint8_t { Explicit, Implicit, HexEntry };
+    Kind           kind;
+    uint16_t       keystrokes;  // number of keys typed after the compose key
+    std::u16string keys;        // key text of each key in turn
+    bool operator==(const TypingWay&) const = default;
+};
+
+class ReverseIndex {
+
+public:
+
+    struct BlockCoverage {
+        const unicodeTables::Block* block;
+        uint32_t explicitCount = 0;
+        uint32_t implicitCount = 0;
+        uint32_t covered       = 0;
+    };
+
+private:
+
+    struct Entry {
+        uint32_t        output, keys;  // offsets in outputText and keyText
+        uint16_t        outputLength, keysLength;
+        uint16_t        keystrokes;
+        TypingWay::Kind kind;
+    };
+
+    struct Part {
+        std::vector<Entry> entries;
+        std::u16string     outputText, keyText;
+        void add(TypingWay::Kind kind, std::u16string_view output, std::u16string_view keys, size_t keystrokes) {
+            entries.push_back({ static_cast<uint32_t>(outputText.length()), static_cast<uint32_t>(keyText.length()),
+                                static_cast<uint16_t>(output.length()), static_cast<uint16_t>(keys.length()),
+                                static_cast<uint16_t>(keystrokes), kind });
+            outputText += output;
+            keyText    += keys;
+        }
+    };
+
+    struct MarkKeys { char32_t mark; uint16_t keystrokes; std::u16string keys; };
+
+    std::shared_ptr<const ComposeDefinitions> source;
+    std::vector<MarkKeys>                     markKeys;  // fewest keys for each accent, sorted by accent
+    std::vector<Entry>                        entries;   // sorted by output, then keystrokes, then keys
+    std::u16string                            outputText, keyText;
+
+    static std::u16string_view outputOf(const Entry& e, std::u16string_view text) { return text.substr(e.output, e.outputLength); }
+    static std::u16string_view keysOf  (const Entry& e, std::u16string_view text) { return text.substr(e.keys, e.keysLength); }
+
+    static auto order(std::u16string_view outputs, std::u16string_view keys) {
+        return [=](const Entry& a, const Entry& b) {
+            if (const auto c = outputOf(a, outputs).compare(outputOf(b, outputs)); c) return c < 0;
+            if (a.keystrokes != b.keystrokes) return a.keystrokes < b.keystrokes;
+            return keysOf(a, keys) < keysOf(b, keys);
+        };
+    }
+
+    static size_t keyCount(std::u16string_view keys) {
+        size_t count = 0;
+        for (size_t i = 0; i < keys.length(); i += definitionsAnalyzer::keyLength(keys.substr(i))) ++count;
+        return count;
+    }
+
+    // True if typing keys into engine, from the start of a sequence, sends text and nothing else.
+
+    bool types(ComposeEngine& engine, definitionsAnalyzer::Capture& capture, std::u16string_view keys,
+               std::u16string_view text) const {
+        engine.start(source);
+        capture.clear();
+        for (size_t i = 0; i < keys.length();) {
+            if (!engine.composing()) return false;
+            const size_t n = definitionsAnalyzer::keyLength(keys.substr(i));
+            engine.key(keys.substr(i, n), capture);
+            i += n;
+        }
+        if (engine.composing()) {
+            engine.cancel();
+            return false;
+        }
+        return capture.composed == text && capture.leftOver.empty();
+    }
+
+    // Adds the implicit ways of typing text to part, if its canonical decomposition is a base character followed
+    // by accents that have combining rules. Keys that make a complete explicit sequence are left to the explicit way.
+
+    void addImplicit(Part& part, ComposeEngine& engine, definitionsAnalyzer::Capture& capture,
+                     std::u16string_view text) const {
+        const std::u16string decomposed = normalize(text, NormalizationForm::D);
+        if (decomposed.empty()) return;
+        const std::u16string_view base = std::u16string_view(decomposed).substr(0, codePointLength(decomposed));
+        std::u16string marks;
+        size_t marksTyped = 0;
+        for (size_t i = base.length(); i < decomposed.length();) {
+            const size_t n = codePointLength(std::u16string_view(decomposed).substr(i));
+            const char32_t c = n == 2 ? 0x10000 + ((decomposed[i] - 0xD800) << 10) + (decomposed[i + 1] - 0xDC00) : decomposed[i];
+            const auto found = std::lower_bound(markKeys.begin(), markKeys.end(), c,
+                                                [](const MarkKeys& m, char32_t c) { return m.mark < c; });
+            if (found == markKeys.end() || found->mark != c) return;
+            marks += found->keys;
+            marksTyped += found->keystrokes;
+            i += n;
+        }
+        if (!marksTyped) return;
+        char bytes[1024];
+        for (const std::u16string& keys : { marks + std::u16string(base), std::u16string(base) + marks + u'\r' }) {
+            const size_t length = utf16to8(keys, bytes);
+            if (length <= std::size(bytes) && source->sequences.complete(source->sequences.next(SequenceTrie::root,
+                                                                                                std::string_view(bytes, length))))
+                continue;
+            if (types(engine, capture, keys, text)) part.add(TypingWay::Implicit, text, keys, keyCount(keys));
+        }
+    }
+
+    static size_t codePointLength(std::u16string_view s) {
+        return s.length() > 1 && s[0] >= 0xD800 && s[0] < 0xDC00 && s[1] >= 0xDC00 && s[1] < 0xE000 ? 2 : 1;
+    }
+
+public:
+
+    static std::shared_ptr<const ReverseIndex> build(std::shared_ptr<const ComposeDefinitions> definitions,
+                                                     unsigned threads = 0);
+
+    const std::shared_ptr<const ComposeDefinitions>& definitions() const { return source; }
+    size_t size() const { return entries.size(); }
+
+    std::vector<TypingWay>     ways(std::u16string_view text) const;
+    std::vector<BlockCoverage> coverage() const;
+
+};
+
+
+inline std::shared_ptr<const ReverseIndex> ReverseIndex::build(std::shared_ptr<const ComposeDefinitions> definitions,
+                                                               unsigned threads) {
+
+    auto index = std::make_shared<ReverseIndex>();
+    index->source = std::move(definitions);
+
+    for (const CombiningRule& rule : index->source->combiningRules) {
+        const char16_t units[] = { static_cast<char16_t>(rule.key), static_cast<char16_t>(rule.key >> 16) };
+        const std::u16string key(units, rule.key >> 16 ? 2 : 1);
+        if (definitionsAnalyzer::keyLength(key) != key.length()) continue;  // two keys in one, which can't be typed
+        if (rule.one)      index->markKeys.push_back({ rule.one , 1, key });
+        if (rule.two)      index->markKeys.push_back({ rule.two , 2, key + key });
+        if (rule.up   > 1) index->markKeys.push_back({ rule.up  , 2, u"[Up]" + key });
+        if (rule.down > 1) index->markKeys.push_back({ rule.down, 2, u"[Down]" + key });
+    }
+    std::stable_sort(index->markKeys.begin(), index->markKeys.end(), [](const MarkKeys& a, const MarkKeys& b) {
+        return a.mark != b.mark ? a.mark < b.mark : a.keystrokes < b.keystrokes;
+    });
+    index->markKeys.erase(std::unique(index->markKeys.begin(), index->markKeys.end(),
+                                      [](const MarkKeys& a, const MarkKeys& b) { return a.mark == b.mark; }),
+                          index->markKeys.end());
+
+    // Work items are the subtrees below the root of the trie, then groups of code points with decompositions.
+
+    const SequenceTrie& trie = index->source->sequences;
+    const SequenceTrie::Node& root = trie.nodeArray()[SequenceTrie::root];
+    const auto rootEdges = trie.edgeArray().subspan(root.firstEdge, root.edgeCount);
+    constexpr size_t groupSize = 64;
+    const size_t codes = std::size(unicodeTables::canonicalCodes);
+    const size_t work  = rootEdges.size() + (codes + groupSize - 1) / groupSize;
+    std::atomic<size_t> nextItem = 0;
+
+    if (!threads) threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<Part> parts(threads);
+
+    auto worker = [&](Part& part) {
+        ComposeEngine engine;
+        definitionsAnalyzer::Capture capture;
+        char16_t keys[256];
+        for (size_t item; (item = nextItem++) < work;) {
+            if (item < rootEdges.size()) {
+                const char prefix = static_cast<char>(rootEdges[item].byte);
+                trie.forEach([&](std::string_view key, std::u16string_view output) {
+                    SequenceTrie::State state = SequenceTrie::root;
+                    for (size_t i = 0; i + 1 < key.length(); ++i)
+                        if (trie.complete(state = trie.next(state, key.substr(i, 1)))) return;  // shadowed
+                    const size_t length = utf8to16(key, keys);
+                    if (length == 0 || length > std::size(keys)) return;
+                    const std::u16string_view k(keys, length);
+                    part.add(TypingWay::Explicit, output, k, keyCount(k));
+                }, rootEdges[item].target, std::string_view(&prefix, 1));
+            }
+            else {
+                const size_t first = (item - rootEdges.size()) * groupSize;
+                for (size_t i = first; i < std::min(first + groupSize, codes); ++i) {
+                    const char32_t c = unicodeTables::canonicalCodes[i];
+                    const char16_t text[] = { static_cast<char16_t>(c < 0x10000 ? c : 0xD800 + ((c - 0x10000) >> 10)),
+                                              static_cast<char16_t>(0xDC00 + (c & 0x3FF)) };
+                    index->addImplicit(part, engine, capture, std::u16string_view(text, c < 0x10000 ? 1 : 2));
+                }
+            }
+        }
+        std::sort(part.entries.begin(), part.entries.end(), order(part.outputText, part.keyText));
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker, std::ref(parts[t]));
+    worker(parts[0]);
+    for (std::thread& thread : pool) thread.join();
+
+    // Concatenate the sorted parts, then merge them in pairs.
+
+    size_t entryCount = 0, outputLength = 0, keysLength = 0;
+    for (const Part& part : parts) {
+        entryCount   += part.entries.size();
+        outputLength += part.outputText.length();
+        keysLength   += part.keyText.length();
+    }
+    index->entries.reserve(entryCount);
+    index->outputText.reserve(outputLength);
+    index->keyText.reserve(keysLength);
+    std::vector<size_t> bounds = { 0 };
+    for (Part& part : parts) {
+        const uint32_t outputBase = static_cast<uint32_t>(index->outputText.length());
+        const uint32_t keysBase   = static_cast<uint32_t>(index->keyText.length());
+        for (Entry e : part.entries) {
+            e.output += outputBase;
+            e.keys   += keysBase;
+            index->entries.push_back(e);
+        }
+        index->outputText += part.outputText;
+        index->keyText    += part.keyText;
+        bounds.push_back(index->entries.size());
+        part = Part();
+    }
+    const auto less = order(index->outputText, index->keyText);
+    const size_t runs = parts.size();
+    for (size_t width = 1; width < runs; width *= 2)
+        for (size_t i = 0; i + width < runs; i += 2 * width)
+            std::inplace_merge(index->entries.begin() + bounds[i], index->entries.begin() + bounds[i + width],
+                               index->entries.begin() + bounds[std::min(i + 2 * width, runs)], less);
+
+    return index;
+
+}
+
+
+inline std::vector<TypingWay> ReverseIndex::ways(std::u16string_view text) const {
+
+    std::vector<TypingWay> result;
+    if (text.empty()) return result;
+    const auto first = std::lower_bound(entries.begin(), entries.end(), text,
+        [&](const Entry& e, std::u16string_view t) { return outputOf(e, outputText) < t; });
+    const auto last  = std::upper_bound(first, entries.end(), text,
+        [&](std::u16string_view t, const Entry& e) { return t < outputOf(e, outputText); });
+    bool implicit = false;
+    for (auto e = first; e != last; ++e) {
+        result.push_back({ e->kind, e->keystrokes, std::u16string(keysOf(*e, keyText)) });
+        implicit = implicit || e->kind == TypingWay::Implicit;
+    }
+
+    ComposeEngine engine;
+    definitionsAnalyzer::Capture capture;
+    if (!implicit) {
+        Part part;
+        addImplicit(part, engine, capture, text);
+        for (const Entry& e : part.entries) result.push_back({ e.kind, e.keystrokes, std::u16string(keysOf(e, part.keyText)) });
+    }
+
+    if (codePointLength(text) == text.length()) {
+        const char32_t c = text.length() == 2 ? 0x10000 + ((text[0] - 0xD800) << 10) + (text[1] - 0xDC00) : text[0];
+        const char* const forms[] = { "%02x", "%02X", "&#x%x;", "&#%u;" };
+        for (size_t f = 0; f < std::size(forms); ++f) {
+            char digits[16];
+            std::snprintf(digits, sizeof digits, forms[f], static_cast<unsigned>(c));
+            std::u16string keys(digits, digits + std::strlen(digits));
+            if (f < 2 && c < 0x11000) keys += u'\r';  // #x entry of a code point from 11000 on completes itself
+            if (types(engine, capture, keys, text)) {
+                result.push_back({ TypingWay::HexEntry, static_cast<uint16_t>(keys.length()), keys });
+                break;
+            }
+        }
+    }
+
+    std::stable_sort(result.begin(), result.end(),
+                     [](const TypingWay& a, const TypingWay& b) { return a.keystrokes < b.keystrokes; });
+    return result;
+
+}
+
+
+inline std::vector<ReverseIndex::BlockCoverage> ReverseIndex::coverage() const {
+
+    std::vector<BlockCoverage> result;
+    for (const unicodeTables::Block& block : unicodeTables::blocks) result.push_back({ &block });
+
+    for (size_t i = 0; i < entries.size();) {
+        const std::u16string_view output = outputOf(entries[i], outputText);
+        bool byExplicit = false, byImplicit = false;
+        for (; i < entries.size() && outputOf(entries[i], outputText) == output; ++i) {
+            byExplicit = byExplicit || entries[i].kind == TypingWay::Explicit;
+            byImplicit = byImplicit || entries[i].kind == TypingWay::Implicit;
+        }
+        if (codePointLength(output) != output.length()) continue;
+        const char32_t c = output.length() == 2 ? 0x10000 + ((output[0] - 0xD800) << 10) + (output[1] - 0xDC00) : output[0];
+        const auto block = std::upper_bound(std::begin(unicodeTables::blocks), std::end(unicodeTables::blocks), c,
+                                            [](char32_t c, const unicodeTables::Block& b) { return c < b.first; });
+        if (block == std::begin(unicodeTables::blocks) || c > block[-1].last) continue;
+        BlockCoverage& coverage = result[block - std::begin(unicodeTables::blocks) - 1];
+        coverage.explicitCount += byExplicit;
+        coverage.implicitCount += byImplicit;
+        ++coverage.covered;
+    }
+
+    return result;
+
+}
@@ -0,0 +1,566 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ComposeEngine.h"
+#include "DefaultSequences.h"
+#include "UnicodeFormatTranslation.h"
+#include "UnicodeNames.h"
+
+// The sequence palette lists every explicit sequence in compiled definitions with its output, the Unicode names of
+// the characters in the output and its category, and finds them as a search is typed. The plugin shows it in a
+// docking panel (see Palette.cpp); nothing here depends on Windows.
+//
+// PaletteIndex searches a fixed list of texts, each of which is in a group (such as a category) that has a text of
+// its own. Texts are folded (ASCII letters made lowercase, and spaces made separators, like the separators between
+// fields), and a query is folded the same way and split into terms. A text matches if every term is in it or in its
+// group's text: a term of three or more bytes anywhere, and a shorter term at the start of a word. For each term it
+// scores 6 if the term is a whole word, 4 if it begins a word and 2 otherwise, and results are ordered by their total,
+// then by their order in the list, with a counting sort, since there are few possible totals.
+//
+// The trigrams in the texts (other than those that span words), the trigrams that begin with a separator and the
+// first byte of each word are indexed: for each one, the list of texts that contain it, with the best score it has
+// in each as a term. A group's text is shared by many texts, so it is not indexed, but checked once per search.
+//
+// Each term selects the texts in the list for the n-gram it is (if it has three or fewer bytes) or for its least
+// common trigram, and those in groups it matches; the term that selects the fewest is used. When the query only adds
+// to the last one searched (as it does while it is typed), the texts that matched it are used instead, if there are
+// fewer of them, and the scores of the terms that haven't changed are kept. The other terms are then scored: one of
+// up to three bytes from its list, and a longer one by finding it in each text that is in its list. So a query of one
+// term of up to three bytes is answered without looking at any text. The results of recent searches are kept, so
+// that erasing part of a query shows the results it had before at once.
+//
+// If nothing matches, terms of six or more bytes may match with one byte wrong, missing or extra (scoring 1). The
+// texts selected are then those that share enough of the trigrams in the longest such term (one mistake spoils at
+// most three of them), and those in groups that match it.
+//
+// PaletteIndex(const std::vector<std::string>& texts, const std::vector<uint16_t>& groupOf,
+//              const std::vector<std::string>& groups)
+//     Makes an index of texts, in which each text's fields (such as its keys and its name) are separated by
+//     PaletteIndex::separator. groupOf[i] is the index in groups of the group of texts[i]; texts must be in the order
+//     of their groups.
+//
+// void search(std::string_view query, std::vector<uint32_t>& results)
+//     Sets results to the indexes of the texts that match query, best first; an empty query matches every text.
+//
+// size_t size() const
+//     The number of texts.
+//
+// SequencePalette(std::shared_ptr<const ComposeDefinitions> definitions)
+//     Makes the palette for definitions. Sequences are in the order of the categories, then by key: the built-in
+//     categories are the sections of compose-default.jsonc (see DefaultSequences.h), and sequences in a user
+//     definitions file that aren't the same as a built-in sequence are in a last category, User definitions.
+//
+// const PaletteEntry& operator[](size_t i) const, size_t size() const
+//     The sequences.
+//
+// static std::string_view categoryName(uint8_t category)
+//     The name of a category.
+//
+// void search(std::string_view query, std::vector<uint32_t>& results)
+//     Searches the keys, output, names and category of each sequence, as PaletteIndex::search.
+
+class PaletteIndex {
+
+public:
+
+    static constexpr char separator = '\x1F';
+
+private:
+
+    static constexpr size_t   maxTerms  = 8;
+    static constexpr int      maxScore  = 6 * maxTerms;
+    static constexpr size_t   minFuzzy  = 6;            // shortest term that may match with a mistake
+    static constexpr size_t   maxFuzzy  = 64;           // and the longest
+    static constexpr uint32_t textMask  = 0x3FFFFFFF;   // a posting is a text index, with its score / 2 in the top bits
+    static constexpr uint32_t wordStart = 0x1000000;    // n-gram of a separator and the byte in the low bits
+
+    struct List { uint32_t offset = 0, count = 0, last = 0; };  // last is 1 + the last text added while building
+
+    std::string              text;         // all texts, folded, each beginning and ending with separator
+    std::vector<uint32_t>    starts;       // offset of each text in text (its first separator is the last one's last)
+    std::vector<uint16_t>    groupOf;
+    std::vector<std::string> groups;       // folded
+    std::vector<uint32_t>    groupStarts;  // first text in each group, and the end
+    std::vector<uint32_t>    postings;
+    std::vector<uint32_t>    slots;        // open addressing hash table of n-grams + 1, or 0 for an empty slot
+    std::vector<List>        lists;        // the list for each slot
+    size_t                   gramCount = 0;
+
+    // The last search, and space kept between searches so they seldom allocate
+
+    using Scores = std::array<uint8_t, maxTerms>;
+
+    std::vector<std::string> lastTerms;    // terms of the last search that matched exactly
+    std::vector<uint32_t>    lastMatches;  // texts it matched, in order
+    std::vector<Scores>      lastScores;   // score of each term in each of them
+    std::vector<uint32_t>    candidates;
+    std::vector<Scores>      termScores;   // score of each term in each candidate
+    std::vector<uint8_t>     totals;       // total score of each candidate
+    std::vector<uint8_t>     groupScores;  // score of each term in each group's text
+    std::vector<uint8_t>     shared;       // trigrams shared with a fuzzy term, for each text
+
+    struct Search { std::vector<std::string> terms; std::vector<uint32_t> results; };
+
+    static constexpr size_t  maxHistory  = 32;
+    std::vector<Search>      history;      // recent searches, oldest first, for when a query is erased
+    size_t                   historySize = 0;
+
+    static uint32_t trigram(std::string_view s) {
+        return static_cast<unsigned char>(s[0]) << 16 | static_cast<unsigned char>(s[1]) << 8 | static_cast<unsigned char>(s[2]);
+    }
+
+    std::string_view textOf(uint32_t i) const { return std::string_view(text).substr(starts[i], starts[i + 1] - starts[i] + 1); }
+
+    size_t slot(uint32_t gram) const {
+        size_t i = (gram * 0x9E3779B1u) & (slots.size() - 1);
+        while (slots[i] && slots[i] != gram + 1) i = (i + 1) & (slots.size() - 1);
+        return i;
+    }
+
+    List& insert(uint32_t gram) {
+        if (2 * (gramCount + 1) > slots.size()) {
+            std::vector<uint32_t> oldSlots(2 * slots.size());
+            std::vector<List>     oldLists(oldSlots.size());
+            slots.swap(oldSlots);
+            lists.swap(oldLists);
+            for (size_t i = 0; i < oldSlots.size(); ++i) if (oldSlots[i]) {
+                const size_t j = slot(oldSlots[i] - 1);
+                slots[j] = oldSlots[i];
+                lists[j] = oldLists[i];
+            }
+        }
+        const size_t i = slot(gram);
+        if (!slots[i]) {
+            slots[i] = gram + 1;
+            ++gramCount;
+        }
+        return lists[i];
+    }
+
+    std::span<const uint32_t> list(uint32_t gram) const {
+        const size_t i = slot(gram);
+        return slots[i] ? std::span<const uint32_t>(postings).subspan(lists[i].offset, lists[i].count) : std::span<const uint32_t>();
+    }
+
+    // Calls f(gram, score) for each n-gram indexed in a text.
+
+    template<typename F> static void forEachGram(std::string_view s, F f) {
+        for (size_t p = 0; p + 2 < s.length(); ++p) {
+            if (s[p + 1] == separator) continue;
+            if (s[p] == separator) {
+                const bool single = s[p + 2] == separator;
+                f(wordStart | static_cast<unsigned char>(s[p + 1]), single ? 6 : 4);
+                if (!single) f(trigram(s.substr(p, 3)), s[p + 3] == separator ? 6 : 4);
+            }
+            else if (s[p + 2] != separator)
+                f(trigram(s.substr(p, 3)), s[p - 1] == separator ? (s[p + 3] == separator ? 6 : 4) : 2);
+        }
+    }
+
+    // The list that selects the texts in which term is, and whether it holds only those texts.
+
+    std::pair<std::span<const uint32_t>, bool> listFor(std::string_view term) const {
+        if (term.length() == 1) return { list(wordStart | static_cast<unsigned char>(term[0])), true };
+        if (term.length() == 2)
+            return { list(separator << 16 | static_cast<unsigned char>(term[0]) << 8 | static_cast<unsigned char>(term[1])), true };
+        std::span<const uint32_t> shortest = list(trigram(term));
+        for (size_t i = 1; i + 3 <= term.length() && !shortest.empty(); ++i) {
+            const auto l = list(trigram(term.substr(i, 3)));
+            if (l.size() < shortest.size()) shortest = l;
+        }
+        return { shortest, term.length() == 3 };
+    }
+
+    // Score of term in s (see above), or 0 if it isn't there.
+
+    static int score(std::string_view s, std::string_view term) {
+        int best = 0;
+        for (size_t at = s.find(term); at != std::string_view::npos && best < 6; at = s.find(term, at + 1)) {
+            const bool start = at == 0 || s[at - 1] == separator;
+            if (!start && term.length() < 3) continue;
+            const bool end = at + term.length() == s.length() || s[at + term.length()] == separator;
+            best = std::max(best, start ? (end ? 6 : 4) : 2);
+        }
+        return best;
+    }
+
+    // True if term is within one edit (a byte changed, missing or extra) of some part of s. Bit i of exact is set if
+    // the first i + 1 bytes of term end at the current byte of s, and of near if they do with one edit.
+
+    static bool nearly(std::string_view s, std::string_view term) {
+        std::array<uint64_t, 256> mask = {};
+        for (size_t i = 0; i < term.length(); ++i) mask[static_cast<unsigned char>(term[i])] |= uint64_t(1) << i;
+        const uint64_t found = uint64_t(1) << (term.length() - 1);
+        uint64_t exact = 0, near = 1;
+        for (const char c : s) {
+            const uint64_t m       = mask[static_cast<unsigned char>(c)];
+            const uint64_t before  = exact << 1 | 1;
+            const uint64_t matched = before & m;
+            near  = ((near << 1) & m) | before | exact | matched << 1;
+            exact = matched;
+            if ((exact | near) & found) return true;
+        }
+        return false;
+    }
+
+    static std::vector<std::string> termsOf(std::string_view query) {
+        std::vector<std::string> terms;
+        const std::string folded = fold(query);
+        for (size_t i = 0; i < folded.length() && terms.size() < maxTerms;) {
+            const size_t end = std::min(folded.find(separator, i), folded.length());
+            if (end > i) terms.push_back(folded.substr(i, end - i));
+            i = end + 1;
+        }
+        return terms;
+    }
+
+    // True if every text that matches terms also matches lastTerms.
+
+    bool refines(const std::vector<std::string>& terms) const {
+        if (lastTerms.empty() || terms.size() < lastTerms.size()) return false;
+        for (size_t i = 0; i < lastTerms.size(); ++i)
+            if (!terms[i].starts_with(lastTerms[i]) || (lastTerms[i].length() < 3 && terms[i].length() >= 3)) return false;
+        return true;
+    }
+
+    uint32_t groupSize(size_t g) const { return groupStarts[g + 1] - groupStarts[g]; }
+
+    // Orders the candidates that have a nonzero total, best first, into results; bucket[maxScore - t + 1] is the number
+    // of candidates with total t.
+
+    void rank(std::array<uint32_t, maxScore + 2>& bucket, std::vector<uint32_t>& results) const {
+        bucket[maxScore + 1] = 0;
+        for (size_t i = 1; i < bucket.size(); ++i) bucket[i] += bucket[i - 1];
+        results.resize(bucket.back());
+        for (size_t i = 0; i < candidates.size(); ++i) if (totals[i]) results[bucket[maxScore - totals[i]]++] = candidates[i];
+    }
+
+public:
+
+    PaletteIndex(const std::vector<std::string>& texts, const std::vector<uint16_t>& groupOf,
+                 const std::vector<std::string>& groups) : groupOf(groupOf), slots(1024), lists(1024) {
+
+        for (const std::string& g : groups) this->groups.push_back(fold(g));
+        starts.reserve(texts.size() + 1);
+        text += separator;
+        for (const std::string& t : texts) {
+            starts.push_back(static_cast<uint32_t>(text.length() - 1));
+            text += fold(t);
+            text += separator;
+        }
+        starts.push_back(static_cast<uint32_t>(text.length() - 1));
+        for (size_t g = 0; g <= groups.size(); ++g)
+            groupStarts.push_back(static_cast<uint32_t>(std::lower_bound(groupOf.begin(), groupOf.end(), g) - groupOf.begin()));
+
+        // Count, then fill, the lists. A text is in a list once however often the n-gram is in it, with its best score.
+
+        uint32_t total = 0;
+        for (uint32_t i = 0; i < texts.size(); ++i) forEachGram(textOf(i), [&](uint32_t gram, int) {
+            List& l = insert(gram);
+            if (l.last != i + 1) {
+                l.last = i + 1;
+                ++l.count;
+                ++total;
+            }
+        });
+        uint32_t offset = 0;
+        for (List& l : lists) {
+            l.offset = offset;
+            offset  += l.count;
+            l.count  = l.last = 0;
+        }
+        postings.assign(total, 0);
+        for (uint32_t i = 0; i < texts.size(); ++i) forEachGram(textOf(i), [&](uint32_t gram, int s) {
+            List& l = lists[slot(gram)];
+            if (l.last != i + 1) {
+                l.last = i + 1;
+                postings[l.offset + l.count++] = i;
+            }
+            uint32_t& p = postings[l.offset + l.count - 1];
+            p = std::max(p, i | static_cast<uint32_t>(s / 2) << 30);
+        });
+
+    }
+
+    static std::string fold(std::string_view s) {
+        std::string folded(s);
+        for (char& c : folded) {
+            if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+            else if (c == ' ') c = separator;
+        }
+        return folded;
+    }
+
+    size_t size() const { return starts.size() - 1; }
+
+    void search(std::string_view query, std::vector<uint32_t>& results) {
+        const std::vector<std::string> terms = termsOf(query);
+        if (terms.empty()) {
+            results.resize(size());
+            for (uint32_t i = 0; i < size(); ++i) results[i] = i;
+            return;
+        }
+        for (size_t i = history.size(); i > 0; --i) if (history[i - 1].terms == terms) {
+            results = history[i - 1].results;
+            return;
+        }
+        match(terms, results);
+        history.push_back({ terms, results });
+        historySize += results.size();
+        while (history.size() > maxHistory || historySize > size()) {
+            historySize -= history.front().results.size();
+            history.erase(history.begin());
+        }
+    }
+
+private:
+
+    void match(const std::vector<std::string>& terms, std::vector<uint32_t>& results) {
+
+        const size_t groupCount = groups.size();
+        groupScores.resize(terms.size() * groupCount);
+        for (size_t k = 0; k < terms.size(); ++k) for (size_t g = 0; g < groupCount; ++g)
+            groupScores[k * groupCount + g] = static_cast<uint8_t>(score(groups[g], terms[k]));
+
+        // Select texts with the term that selects the fewest, or with the texts that matched the last search.
+
+        std::array<std::pair<std::span<const uint32_t>, bool>, maxTerms> termLists;
+        size_t driver = 0, fewest = SIZE_MAX;
+        for (size_t k = 0; k < terms.size(); ++k) {
+            termLists[k] = listFor(terms[k]);
+            size_t count = termLists[k].first.size();
+            for (size_t g = 0; g < groupCount; ++g) if (groupScores[k * groupCount + g]) count += groupSize(g);
+            if (count < fewest) {
+                driver = k;
+                fewest = count;
+            }
+        }
+
+        std::array<bool, maxTerms> known = {};
+        if (refines(terms) && lastMatches.size() < fewest) {
+            candidates.swap(lastMatches);
+            termScores.swap(lastScores);
+            for (size_t k = 0; k < lastTerms.size(); ++k) known[k] = terms[k] == lastTerms[k];
+        }
+        else {
+            // Merge the list with the groups the term matches.
+            const auto [l, exact] = termLists[driver];
+            candidates.resize(fewest);
+            termScores.assign(fewest, Scores());
+            size_t i = 0, n = 0;
+            auto add = [&](uint32_t text, int s) {
+                candidates[n] = text;
+                termScores[n++][driver] = static_cast<uint8_t>(s);
+            };
+            for (size_t g = 0; g < groupCount; ++g) {
+                const int gs = groupScores[driver * groupCount + g];
+                if (!gs) continue;
+                for (; i < l.size() && (l[i] & textMask) < groupStarts[g]; ++i) add(l[i] & textMask, 2 * (l[i] >> 30));
+                for (uint32_t t = groupStarts[g]; t < groupStarts[g + 1]; ++t) {
+                    int s = gs;
+                    if (i < l.size() && (l[i] & textMask) == t) s = std::max(s, 2 * static_cast<int>(l[i++] >> 30));
+                    add(t, s);
+                }
+            }
+            for (; i < l.size(); ++i) add(l[i] & textMask, 2 * (l[i] >> 30));
+            candidates.resize(n);
+            termScores.resize(n);
+            known[driver] = exact;
+        }
+
+        // Score the other terms, dropping texts that don't have them: short terms from their lists, then the rest from
+        // the texts that are in their lists.
+
+        for (const bool fromLists : { true, false }) for (size_t k = 0; k < terms.size(); ++k) {
+            if (known[k] || termLists[k].second != fromLists) continue;
+            const std::string_view term = terms[k];
+            const uint8_t* gs = &groupScores[k * groupCount];
+            const auto l = termLists[k].first;
+            const bool gallop = l.size() > 8 * candidates.size();
+            size_t i = 0, kept = 0;
+            for (size_t c = 0; c < candidates.size(); ++c) {
+                const uint32_t t = candidates[c];
+                int s = gs[groupOf[t]];
+                if (gallop) i = std::lower_bound(l.begin() + i, l.end(), t, [](uint32_t p, uint32_t t) { return (p & textMask) < t; }) - l.begin();
+                else while (i < l.size() && (l[i] & textMask) < t) ++i;
+                if (i < l.size() && (l[i] & textMask) == t && s < 6)
+                    s = std::max(s, fromLists ? 2 * static_cast<int>(l[i] >> 30) : score(textOf(t), term));
+                if (!s) continue;
+                candidates[kept]    = t;
+                termScores[kept]    = termScores[c];
+                termScores[kept][k] = static_cast<uint8_t>(s);
+                ++kept;
+            }
+            candidates.resize(kept);
+            termScores.resize(kept);
+            known[k] = true;
+        }
+
+        std::array<uint32_t, maxScore + 2> bucket = {};
+        totals.resize(candidates.size());
+        for (size_t c = 0; c < candidates.size(); ++c) {
+            int total = 0;
+            for (size_t k = 0; k < terms.size(); ++k) total += termScores[c][k];
+            totals[c] = static_cast<uint8_t>(total);
+            ++bucket[maxScore - total + 1];
+        }
+        rank(bucket, results);
+        if (!results.empty()) {
+            lastTerms = terms;
+            lastMatches.swap(candidates);
+            lastScores.swap(termScores);
+            return;
+        }
+        lastTerms.clear();
+
+        // Nothing matched exactly: let long terms match with one mistake.
+
+        auto fuzzy = [&](size_t k) { return terms[k].length() >= minFuzzy && terms[k].length() <= maxFuzzy; };
+        size_t longest = SIZE_MAX;
+        for (size_t k = 0; k < terms.size(); ++k)
+            if (fuzzy(k) && (longest == SIZE_MAX || terms[k].length() > terms[longest].length())) longest = k;
+        if (longest == SIZE_MAX) return;
+        std::vector<uint8_t> groupNearly(terms.size() * groupCount);
+        for (size_t k = 0; k < terms.size(); ++k) for (size_t g = 0; g < groupCount; ++g)
+            groupNearly[k * groupCount + g] = fuzzy(k) && nearly(groups[g], terms[k]);
+
+        const std::string_view term = terms[longest];
+        std::vector<uint32_t> grams;
+        for (size_t i = 0; i + 3 <= term.length(); ++i) grams.push_back(trigram(term.substr(i, 3)));
+        std::sort(grams.begin(), grams.end());
+        grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+        const size_t threshold = grams.size() > 4 ? grams.size() - 3 : 1;
+        shared.resize(size());
+        std::vector<uint32_t> touched;
+        for (const uint32_t g : grams) for (const uint32_t p : list(g)) if (!shared[p & textMask]++) touched.push_back(p & textMask);
+        candidates.clear();
+        for (const uint32_t t : touched) {
+            if (shared[t] >= threshold) candidates.push_back(t);
+            shared[t] = 0;
+        }
+        for (size_t g = 0; g < groupCount; ++g)
+            if (groupScores[longest * groupCount + g] || groupNearly[longest * groupCount + g])
+                for (uint32_t t = groupStarts[g]; t < groupStarts[g + 1]; ++t) candidates.push_back(t);
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        bucket.fill(0);
+        totals.assign(candidates.size(), 0);
+        for (size_t c = 0; c < candidates.size(); ++c) {
+            const uint32_t t = candidates[c];
+            int total = 0;
+            for (size_t k = 0; k < terms.size(); ++k) {
+                int s = std::max<int>(groupScores[k * groupCount + groupOf[t]], score(textOf(t), terms[k]));
+                if (!s && fuzzy(k) && (groupNearly[k * groupCount + groupOf[t]] || nearly(textOf(t), terms[k]))) s = 1;
+                if (!s) {
+                    total = 0;
+                    break;
+                }
+                total += s;
+            }
+            totals[c] = static_cast<uint8_t>(total);
+            ++bucket[maxScore - total + 1];
+        }
+        rank(bucket, results);
+
+    }
+
+};
+
+
+struct PaletteEntry {
+    std::string    keys;      // key text of each key in turn, as UTF-8
+    std::u16string output;
+    std::string    name;      // names of the code points in output, separated by commas (empty if there are many)
+    uint8_t        category;
+};
+
+
+class SequencePalette {
+
+    std::shared_ptr<const ComposeDefinitions> source;
+    std::vector<PaletteEntry>                 entries;
+    std::unique_ptr<PaletteIndex>             index;
+
+    static constexpr size_t  maxNamed     = 4;  // most code points named
+    static constexpr uint8_t userCategory = static_cast<uint8_t>(std::size(defaultSequences::categories));
+    static constexpr uint8_t noCategory   = userCategory + 1;
+
+public:
+
+    explicit SequencePalette(std::shared_ptr<const ComposeDefinitions> definitions) : source(std::move(definitions)) {
+        const SequenceTrie  builtIn = defaultSequences::trie();
+        const SequenceTrie& trie    = source->sequences;
+        trie.forEach([&](std::string_view key, std::u16string_view output) {
+            PaletteEntry& e = entries.emplace_back();
+            e.keys   = key;
+            e.output = output;
+            const SequenceTrie::State state = builtIn.next(SequenceTrie::root, key);
+            if (builtIn.complete(state) && builtIn.output(state) == output)
+                e.category = defaultSequences::nodeCategories[state] == defaultSequences::noCategory
+                           ? noCategory : defaultSequences::nodeCategories[state];
+            else e.category = source->userDefinitions ? userCategory : noCategory;
+            char32_t codes[maxNamed];
+            const size_t count = utf16to32(output, codes);
+            if (count <= maxNamed) for (const char32_t c : std::span(codes, count)) {
+                if (!e.name.empty()) e.name += ", ";
+                e.name += unicodeName(c);
+            }
+        });
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const PaletteEntry& a, const PaletteEntry& b) { return a.category < b.category; });
+        std::vector<std::string> texts, groups;
+        std::vector<uint16_t> groupOf;
+        texts.reserve(entries.size());
+        groupOf.reserve(entries.size());
+        for (const PaletteEntry& e : entries) {
+            std::string output(utf16to8Length(e.output), 0);
+            utf16to8(e.output, output);
+            texts.push_back(e.keys + PaletteIndex::separator + output + PaletteIndex::separator + e.name);
+            groupOf.push_back(e.category);
+        }
+        for (uint8_t category = 0; category <= noCategory; ++category) groups.emplace_back(categoryName(category));
+        index = std::make_unique<PaletteIndex>(texts, groupOf, groups);
+    }
+
+    const std::shared_ptr<const ComposeDefinitions>& definitions() const { return source; }
+
+    const PaletteEntry& operator[](size_t i) const { return entries[i]; }
+    size_t size() const { return entries.size(); }
+
+    static std::string_view categoryName(uint8_t category) {
+        return category < userCategory ? defaultSequences::categories[category]
+             : category == userCategory ? "User definitions" : "";
+    }
+
+    void search(std::string_view query, std::vector<uint32_t>& results) { index->search(query, results); }
+
+};
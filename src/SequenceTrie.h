@@ -0,0 +1,401 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// SequenceTrie holds the explicit sequence definitions compiled into a prefix tree over the UTF-8 bytes of their keys.
+//
+// Nodes and edges are stored in flat arrays; the edges leaving a node are contiguous and sorted by byte value,
+// so following one key takes a binary search among at most 256 edges per byte, regardless of the number of rules.
+// Outputs are stored as UTF-16, which is what is sent when a sequence is typed, end to end in a single string;
+// identical outputs (common, since many characters have more than one sequence) are stored only once.
+// A node takes 12 bytes and an edge 8 bytes; outputs are limited to 65535 UTF-16 code units.
+//
+// When a trie is made, a summary of each node is computed (12 bytes more per node), unless it is given the summaries
+// and choices computed before (as a cache file stores them): the number of defined sequences
+// that begin with the sequence leading to it, and whether they all have the same output, so that what can still
+// follow a state is known without walking the tree. The summary also locates the node's choices: the first
+// maxChoices of those sequences, shortest first, then in key order, merged from the choices of the nodes its edges
+// lead to. A node that is not complete and has one edge shares the choices of the node that edge leads to, so
+// the lists take a few bytes per sequence, and a prefix with thousands of completions needs no more work to show
+// than one with two.
+//
+// Nodes are numbered in depth-first order, so the nodes below a node follow it, and each of its edges leads to the
+// first of a run of nodes that ends where the next edge's run begins; that is how suffix finds the keys between two
+// states without storing a parent for each node.
+//
+// A SequenceTrie either owns its arrays (when made by build) or refers to arrays stored elsewhere, such as the
+// constexpr tables in DefaultSequences.h generated from compose-default.jsonc or a memory-mapped cache file.
+//
+// SequenceTrie(std::span<const Node> nodes, std::span<const Edge> edges, std::string_view text,
+//              std::shared_ptr<const void> backing = {})
+//     Makes a trie that refers to existing arrays, which must outlive it unless backing keeps them alive.
+//
+// SequenceTrie(std::span<const Node> nodes, std::span<const Edge> edges, std::u16string_view text,
+//              std::span<const Summary> summaries, std::span<const State> choices, std::shared_ptr<const void> backing = {})
+//     The same, but with the summaries and choices already computed (as summaryArray and choiceArray return them,
+//     for a cache file), so they are not computed again; the caller checks that they fit the nodes.
+//
+// static SequenceTrie build(const std::vector<std::pair<std::string_view, std::u16string_view>>& rules)
+//     Makes a trie that owns its arrays. The rules (UTF-8 keys, UTF-16 outputs) must be sorted by key
+//     (as std::string compares them) and must not contain duplicate keys.
+//
+// State next(State state, std::string_view bytes) const
+//     Returns the state reached by following bytes from state, or dead if there is no such path
+//     (or if state does not belong to this trie, as when definitions were reloaded during a sequence).
+//
+// bool complete(State state) const
+//     True if the sequence leading to state is a defined sequence.
+//
+// bool extendable(State state) const
+//     True if some longer sequence begins with the sequence leading to state.
+//
+// std::u16string_view output(State state) const
+//     The UTF-16 output for a complete state.
+//
+// uint32_t completions(State state) const
+//     The number of defined sequences that begin with the sequence leading to state, including that sequence.
+//
+// State onlyCompletion(State state) const
+//     A complete state whose output is the output of every defined sequence that begins with the sequence leading
+//     to state, or dead if their outputs differ or there are none.
+//
+// std::span<const State> choices(State state) const
+//     The complete states of up to maxChoices defined sequences that begin with the sequence leading to state
+//     (including that sequence), fewest bytes first, then in key order.
+//
+// size_t suffix(State from, State to, std::span<char> out) const
+//     Writes to out the bytes that lead from from to to, and returns their number; returns 0 if to is not reached
+//     from from (as its choices are) or out is too small.
+//
+// void forEach(F f, State from = root, std::string_view prefix = {}) const
+//     Calls f(std::string_view key, std::u16string_view output) for each defined sequence, in key order; if from
+//     is given, only for those that begin with prefix, the sequence leading to from (so that separate subtrees can
+//     be walked on separate threads).
+//
+// size_t storageBytes() const
+//     The memory used by the nodes, edges, outputs, summaries and choices.
+
+class SequenceTrie {
+
+public:
+
+    using State = uint32_t;
+    static constexpr State    root       = 0;
+    static constexpr State    dead       = UINT32_MAX;
+    static constexpr uint32_t noOutput   = UINT32_MAX;
+    static constexpr uint32_t maxChoices = 9;         // the number keys 1 to 9
+
+    struct Node {
+        uint32_t firstEdge    = 0;
+        uint32_t outputOffset = noOutput;
+        uint16_t edgeCount    = 0;
+        uint16_t outputLength = 0;
+    };
+
+    struct Edge {
+        unsigned char byte;
+        State         target;
+    };
+
+    struct Summary {
+        uint32_t completions = 0;
+        State    only        = dead;
+        uint32_t choices     = 0;     // offset in the choice array of the first of min(completions, maxChoices) states
+    };
+
+    using Rules = std::vector<std::pair<std::string_view, std::u16string_view>>;
+
+private:
+
+    static std::span<const Node> emptyRoot() {
+        static constexpr Node node[] = { { 0, noOutput, 0, 0 } };
+        return node;
+    }
+
+    std::vector<Node> nodeStore;
+    std::vector<Edge> edgeStore;
+    std::vector<char16_t> textStore;
+    std::vector<Summary>  summaryStore;
+    std::vector<State>    choiceStore;
+    std::shared_ptr<const void> backing;
+
+    std::span<const Node>    nodes = emptyRoot();
+    std::span<const Edge>    edges;
+    std::u16string_view      text;
+    std::span<const Summary> summaries;
+    std::span<const State>   choiceList;
+
+    // Adds a node for the rules from first to last, which share their first depth bytes, and records the rules
+    // that continue it to be added by build; the nodes are numbered in depth-first order.
+
+    struct Pending {
+        Rules::const_iterator next, last;  // rules not yet added below the node
+        size_t                depth;
+        uint32_t              edge;        // next edge of the node to fill
+    };
+
+    State add(Rules::const_iterator first, Rules::const_iterator last, size_t depth,
+              std::unordered_map<std::u16string_view, uint32_t>& stored, std::vector<Pending>& pending) {
+        const State state = static_cast<State>(nodeStore.size());
+        nodeStore.emplace_back();
+        if (first != last && first->first.length() == depth) {
+            const std::u16string_view output = first->second.substr(0, UINT16_MAX);
+            auto [found, isNew] = stored.try_emplace(output, static_cast<uint32_t>(textStore.size()));
+            if (isNew) textStore.insert(textStore.end(), output.begin(), output.end());
+            nodeStore[state].outputOffset = found->second;
+            nodeStore[state].outputLength = static_cast<uint16_t>(output.length());
+            ++first;
+        }
+        uint32_t count = 0;
+        for (auto i = first; i != last; ++count) {
+            const char c = i->first[depth];
+            while (i != last && i->first[depth] == c) ++i;
+        }
+        const uint32_t firstEdge = static_cast<uint32_t>(edgeStore.size());
+        nodeStore[state].firstEdge = firstEdge;
+        nodeStore[state].edgeCount = static_cast<uint16_t>(count);
+        edgeStore.resize(edgeStore.size() + count);
+        pending.push_back({ first, last, depth, firstEdge });
+        return state;
+    }
+
+    // Adds the nodes for sorted rules with a stack rather than recursion, so a very long key can't overflow the
+    // stack of the thread that builds the trie.
+
+    void addAll(const Rules& rules) {
+        std::unordered_map<std::u16string_view, uint32_t> stored;
+        std::vector<Pending> pending;
+        add(rules.begin(), rules.end(), 0, stored, pending);
+        while (!pending.empty()) {
+            Pending& node = pending.back();
+            if (node.next == node.last) {
+                pending.pop_back();
+                continue;
+            }
+            const char c     = node.next->first[node.depth];
+            const auto first = node.next;
+            while (node.next != node.last && node.next->first[node.depth] == c) ++node.next;
+            const uint32_t edge = node.edge++;
+            const State target = add(first, node.next, node.depth + 1, stored, pending);  // invalidates node
+            edgeStore[edge] = { static_cast<unsigned char>(c), target };
+        }
+    }
+
+    static uint32_t choiceCount(const Summary& summary) { return std::min(summary.completions, maxChoices); }
+
+    // Edges always lead to higher-numbered nodes (see add), so every node's children are summarized before it.
+    // A node's choices are merged from its children's by depth; as the children are in byte order, and each list is
+    // in order, the first of the children with the shortest next sequence has the next one in key order.
+
+    void summarize() {
+        summaryStore.assign(nodes.size(), Summary());
+        choiceStore.clear();
+        std::vector<uint16_t> depth(nodes.size());
+        for (size_t state = 0; state < nodes.size(); ++state)
+            for (uint32_t e = nodes[state].firstEdge; e < nodes[state].firstEdge + nodes[state].edgeCount; ++e)
+                depth[edges[e].target] = static_cast<uint16_t>(depth[state] + 1);
+        std::vector<uint32_t> taken;  // choices of each child merged so far
+        for (size_t state = nodes.size(); state-- > 0;) {
+            Summary& summary = summaryStore[state];
+            if (complete(static_cast<State>(state))) summary = { 1, static_cast<State>(state) };
+            const Node& node = nodes[state];
+            for (uint32_t e = node.firstEdge; e < node.firstEdge + node.edgeCount; ++e) {
+                const Summary& child = summaryStore[edges[e].target];
+                if (!child.completions) continue;
+                if (!summary.completions) summary.only = child.only;
+                else if (summary.only != dead && (child.only == dead || output(child.only) != output(summary.only)))
+                    summary.only = dead;
+                summary.completions += child.completions;
+            }
+            if (!complete(static_cast<State>(state)) && node.edgeCount == 1) {
+                summary.choices = summaryStore[edges[node.firstEdge].target].choices;
+                continue;
+            }
+            summary.choices = static_cast<uint32_t>(choiceStore.size());
+            if (complete(static_cast<State>(state))) choiceStore.push_back(static_cast<State>(state));
+            taken.assign(node.edgeCount, 0);
+            while (choiceStore.size() - summary.choices < maxChoices) {
+                uint32_t next = UINT32_MAX;
+                int      nextDepth = INT32_MAX;
+                for (uint32_t i = 0; i < node.edgeCount; ++i) {
+                    const Summary& child = summaryStore[edges[node.firstEdge + i].target];
+                    if (taken[i] == choiceCount(child)) continue;
+                    const int d = depth[choiceStore[child.choices + taken[i]]];
+                    if (d < nextDepth) {
+                        next      = i;
+                        nextDepth = d;
+                    }
+                }
+                if (next == UINT32_MAX) break;
+                const State choice = choiceStore[summaryStore[edges[node.firstEdge + next].target].choices + taken[next]++];
+                choiceStore.push_back(choice);
+            }
+        }
+        summaryStore.shrink_to_fit();
+        choiceStore.shrink_to_fit();
+        summaries  = summaryStore;
+        choiceList = choiceStore;
+    }
+
+public:
+
+    SequenceTrie() {}
+
+    SequenceTrie(std::span<const Node> nodes, std::span<const Edge> edges, std::u16string_view text,
+                 std::shared_ptr<const void> backing = {})
+        : backing(std::move(backing)), nodes(nodes), edges(edges), text(text) { summarize(); }
+
+    SequenceTrie(std::span<const Node> nodes, std::span<const Edge> edges, std::u16string_view text,
+                 std::span<const Summary> summaries, std::span<const State> choices, std::shared_ptr<const void> backing = {})
+        : backing(std::move(backing)), nodes(nodes), edges(edges), text(text), summaries(summaries), choiceList(choices) {}
+
+    SequenceTrie(const SequenceTrie&) = delete;
+    SequenceTrie& operator=(const SequenceTrie&) = delete;
+
+    SequenceTrie(SequenceTrie&& other) noexcept { *this = std::move(other); }
+
+    SequenceTrie& operator=(SequenceTrie&& other) noexcept {
+        nodeStore = std::move(other.nodeStore);
+        edgeStore = std::move(other.edgeStore);
+        textStore = std::move(other.textStore);
+        summaryStore = std::move(other.summaryStore);
+        choiceStore = std::move(other.choiceStore);
+        backing   = std::move(other.backing);
+        nodes = other.nodes;
+        edges = other.edges;
+        text  = other.text;
+        summaries  = other.summaries;
+        choiceList = other.choiceList;
+        other.nodes = emptyRoot();
+        other.edges = {};
+        other.text  = {};
+        other.summaries  = {};
+        other.choiceList = {};
+        return *this;
+    }
+
+    static SequenceTrie build(const Rules& rules) {
+        SequenceTrie trie;
+        trie.addAll(rules);
+        trie.nodeStore.shrink_to_fit();
+        trie.edgeStore.shrink_to_fit();
+        trie.textStore.shrink_to_fit();
+        trie.nodes = trie.nodeStore;
+        trie.edges = trie.edgeStore;
+        trie.text  = std::u16string_view(trie.textStore.data(), trie.textStore.size());
+        trie.summarize();
+        return trie;
+    }
+
+    std::span<const Node>    nodeArray   () const { return nodes;      }
+    std::span<const Edge>    edgeArray   () const { return edges;      }
+    std::u16string_view      textArray   () const { return text;       }
+    std::span<const Summary> summaryArray() const { return summaries;  }
+    std::span<const State>   choiceArray () const { return choiceList; }
+
+    size_t storageBytes() const {
+        return nodes.size_bytes() + edges.size_bytes() + text.length() * sizeof(char16_t) + summaries.size_bytes()
+             + choiceList.size_bytes();
+    }
+
+    State next(State state, std::string_view bytes) const {
+        for (const char c : bytes) {
+            if (state >= nodes.size()) return dead;
+            const unsigned char b = static_cast<unsigned char>(c);
+            const Edge* low  = edges.data() + nodes[state].firstEdge;
+            const Edge* high = low + nodes[state].edgeCount;
+            state = dead;
+            while (low < high) {
+                const Edge* middle = low + (high - low) / 2;
+                if (middle->byte < b) low = middle + 1;
+                else if (middle->byte > b) high = middle;
+                else {
+                    state = middle->target;
+                    break;
+                }
+            }
+        }
+        return state;
+    }
+
+    bool complete  (State state) const { return state < nodes.size() && nodes[state].outputOffset != noOutput; }
+    bool extendable(State state) const { return state < nodes.size() && nodes[state].edgeCount > 0; }
+
+    std::u16string_view output(State state) const {
+        if (!complete(state)) return {};
+        return text.substr(nodes[state].outputOffset, nodes[state].outputLength);
+    }
+
+    uint32_t completions   (State state) const { return state < summaries.size() ? summaries[state].completions : 0; }
+    State    onlyCompletion(State state) const { return state < summaries.size() ? summaries[state].only : dead; }
+
+    std::span<const State> choices(State state) const {
+        if (state >= summaries.size()) return {};
+        return choiceList.subspan(summaries[state].choices, choiceCount(summaries[state]));
+    }
+
+    size_t suffix(State from, State to, std::span<char> out) const {
+        size_t length = 0;
+        for (State state = from; state != to; ++length) {
+            if (state > to || to >= nodes.size() || length == out.size()) return 0;
+            const Edge* first = edges.data() + nodes[state].firstEdge;
+            const Edge* edge  = std::upper_bound(first, first + nodes[state].edgeCount, to,
+                                                 [](State target, const Edge& e) { return target < e.target; });
+            if (edge == first) return 0;
+            --edge;
+            out[length] = static_cast<char>(edge->byte);
+            state = edge->target;
+        }
+        return length;
+    }
+
+    template<typename F> void forEach(F f, State from = root, std::string_view prefix = {}) const {
+        struct Position { State state; uint32_t edge; };
+        std::vector<Position> stack = { { from, 0 } };
+        std::string key(prefix);
+        if (complete(from)) f(std::string_view(key), output(from));
+        while (!stack.empty()) {
+            Position& position = stack.back();
+            const Node& node = nodes[position.state];
+            if (position.edge == node.edgeCount) {
+                stack.pop_back();
+                if (!key.empty()) key.pop_back();
+                continue;
+            }
+            const Edge& edge = edges[node.firstEdge + position.edge++];
+            key += static_cast<char>(edge.byte);
+            if (complete(edge.target)) f(std::string_view(key), output(edge.target));
+            stack.push_back({ edge.target, 0 });
+        }
+    }
+
+};
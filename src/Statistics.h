@@ -0,0 +1,183 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// Statistics counts what happens while keys are processed and how long it takes, so that reports of lag can be tied
+// to numbers. Collection is off unless turned on (the plugin's CollectStatistics setting); when it is off, each
+// counter and timer costs one test of a flag. Counters are relaxed atomics, so they can be read on another thread
+// (or while the About dialog is showing) without locks; they are only ever updated on the thread that processes keys.
+//
+// A LatencyHistogram counts durations in buckets by powers of two: bucket n holds durations from 2^(n-1) up to 2^n
+// nanoseconds (bucket 0 holds zero), and the last bucket holds all longer durations.
+//
+// void Statistics::enable(bool on)
+//     Turns collection on or off; turning it on clears the counts.
+//
+// bool Statistics::on() const
+//     True if statistics are being collected.
+//
+// void Statistics::count(Counter& counter)
+//     Adds one to a counter, if collection is on.
+//
+// Statistics::Timer timer(Statistics::LatencyHistogram& histogram)
+//     Adds the time until timer is destroyed to histogram, if collection is on.
+//
+// std::string Statistics::json() const
+//     The counts and histograms, as JSON.
+
+class Statistics {
+
+public:
+
+    using Counter = std::atomic<uint64_t>;
+
+    class LatencyHistogram {
+    public:
+        static constexpr size_t buckets = 32;
+        Counter bucket[buckets] = {};
+        Counter count       = 0;
+        Counter nanoseconds = 0;
+        Counter maximum     = 0;
+        void record(uint64_t ns) {
+            bucket[std::min<size_t>(std::bit_width(ns), buckets - 1)].fetch_add(1, std::memory_order_relaxed);
+            count.fetch_add(1, std::memory_order_relaxed);
+            nanoseconds.fetch_add(ns, std::memory_order_relaxed);
+            if (ns > maximum.load(std::memory_order_relaxed)) maximum.store(ns, std::memory_order_relaxed);
+        }
+        // Returns the upper bound, in nanoseconds, of the bucket that holds the given fraction of durations.
+        uint64_t percentile(double fraction) const {
+            const uint64_t n = count.load(std::memory_order_relaxed);
+            uint64_t seen = 0;
+            for (size_t i = 0; i < buckets; ++i) {
+                seen += bucket[i].load(std::memory_order_relaxed);
+                if (n && seen >= fraction * n) return i ? uint64_t(1) << i : 0;
+            }
+            return maximum.load(std::memory_order_relaxed);
+        }
+    };
+
+    class Timer {
+        LatencyHistogram* histogram;
+        std::chrono::steady_clock::time_point start;
+    public:
+        explicit Timer(LatencyHistogram& h, bool on) : histogram(on ? &h : 0) {
+            if (histogram) start = std::chrono::steady_clock::now();
+        }
+        ~Timer() {
+            if (histogram) histogram->record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+        }
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+    };
+
+private:
+
+    std::atomic<bool> collecting = false;
+
+public:
+
+    // Counters
+
+    Counter messagesSeen;       // messages seen by processMessages
+    Counter keysHandled;        // keys passed to the engine while composing
+    Counter sequencesStarted;   // compose key pressed when not composing
+    Counter explicitMatches;    // sequences ended by an explicit sequence
+    Counter implicitMatches;    // sequences ended by an implicit combination or numeric entry
+    Counter rejects;            // sequences ended with nothing composed (keys left over are sent as typed)
+    Counter directInserts;      // sequences whose output was inserted directly into Scintilla, not sent as input
+
+    // Time spent in each phase
+
+    LatencyHistogram processMessages;  // the WH_GETMESSAGE hook, for key messages
+    LatencyHistogram processCompose;   // handling a key message
+    LatencyHistogram processSequence;  // translating a key and passing it to the engine
+    LatencyHistogram compose;          // composing an implicit combination (ImplicitCombination::compose)
+    LatencyHistogram send;             // sending composed text
+
+    bool on() const { return collecting.load(std::memory_order_relaxed); }
+
+    void enable(bool on) {
+        if (on && !collecting) {
+            for (Counter* c : { &messagesSeen, &keysHandled, &sequencesStarted, &explicitMatches, &implicitMatches, &rejects, &directInserts })
+                c->store(0, std::memory_order_relaxed);
+            for (LatencyHistogram* h : { &processMessages, &processCompose, &processSequence, &compose, &send }) {
+                for (Counter& b : h->bucket) b.store(0, std::memory_order_relaxed);
+                h->count.store(0, std::memory_order_relaxed);
+                h->nanoseconds.store(0, std::memory_order_relaxed);
+                h->maximum.store(0, std::memory_order_relaxed);
+            }
+        }
+        collecting.store(on, std::memory_order_relaxed);
+    }
+
+    void count(Counter& counter) { if (on()) counter.fetch_add(1, std::memory_order_relaxed); }
+
+    Timer timer(LatencyHistogram& histogram) { return Timer(histogram, on()); }
+
+    std::string json() const {
+        std::string s = "{\n";
+        auto number = [&](const char* name, uint64_t value, bool last = false) {
+            char line[96];
+            std::snprintf(line, sizeof line, "    \"%s\": %llu%s\n", name, static_cast<unsigned long long>(value), last ? "" : ",");
+            s += line;
+        };
+        number("messagesSeen"    , messagesSeen    .load(std::memory_order_relaxed));
+        number("keysHandled"     , keysHandled     .load(std::memory_order_relaxed));
+        number("sequencesStarted", sequencesStarted.load(std::memory_order_relaxed));
+        number("explicitMatches" , explicitMatches .load(std::memory_order_relaxed));
+        number("implicitMatches" , implicitMatches .load(std::memory_order_relaxed));
+        number("rejects"         , rejects         .load(std::memory_order_relaxed));
+        number("directInserts"   , directInserts   .load(std::memory_order_relaxed));
+        s += "    \"latencyNanoseconds\": {\n";
+        const std::pair<const char*, const LatencyHistogram*> histograms[] = {
+            { "processMessages", &processMessages }, { "processCompose", &processCompose },
+            { "processSequence", &processSequence }, { "compose", &compose }, { "send", &send } };
+        for (size_t k = 0; k < std::size(histograms); ++k) {
+            const auto& [name, h] = histograms[k];
+            const uint64_t n = h->count.load(std::memory_order_relaxed);
+            char line[256];
+            std::snprintf(line, sizeof line, "        \"%s\": { \"count\": %llu, \"mean\": %llu, \"p50\": %llu, \"p99\": %llu, \"max\": %llu,"
+                                             " \"buckets\": [", name, static_cast<unsigned long long>(n),
+                          static_cast<unsigned long long>(n ? h->nanoseconds.load(std::memory_order_relaxed) / n : 0),
+                          static_cast<unsigned long long>(h->percentile(0.5)), static_cast<unsigned long long>(h->percentile(0.99)),
+                          static_cast<unsigned long long>(h->maximum.load(std::memory_order_relaxed)));
+            s += line;
+            for (size_t i = 0; i < LatencyHistogram::buckets; ++i)
+                s += (i ? ", " : "") + std::to_string(h->bucket[i].load(std::memory_order_relaxed));
+            s += k + 1 == std::size(histograms) ? "] }\n" : "] },\n";
+        }
+        s += "    }\n}\n";
+        return s;
+    }
+
+};
+
+inline Statistics statistics;
@@ -0,0 +1,158 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Timeline records how long startup and loading definitions take, step by step, as trace events that can be viewed
+// in chrome://tracing or https://ui.perfetto.dev (the Trace Event Format, with "X" complete events and thread names).
+//
+// It records from the start, so that the steps before the configuration is read are included, until it is turned
+// off; the plugin turns it off after loadConfiguration unless the WriteTimeline setting is on. Recording takes a lock,
+// so it is meant only for steps that take a noticeable time, never for individual keystrokes.
+//
+// void enable(bool on)
+//     Turns recording on or off; turning it off discards what has been recorded.
+//
+// bool on() const
+//     True if recording.
+//
+// double now() const
+//     Microseconds since the timeline began.
+//
+// void complete(std::string_view name, std::string_view category, double start, double end, std::string_view args = {})
+//     Records a step that took place from start to end (as returned by now) on the calling thread. args, if given,
+//     is the body of a JSON object (such as "\"file\": \"x.json\""); use Timeline::quote for strings.
+//
+// void nameThread(std::string_view name)
+//     Names the calling thread in the timeline.
+//
+// std::string json() const
+//     The timeline in Trace Event Format.
+//
+// Timeline::Span span(timeline, name, category, args = {})
+//     Records a step from when span is made until it is destroyed.
+
+class Timeline {
+
+    struct Event {
+        std::string name;
+        std::string category;
+        std::string args;
+        double      start;
+        double      duration;
+        uint32_t    thread;
+        bool        threadName;
+    };
+
+    const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    std::atomic<bool>  recording = true;
+    mutable std::mutex mutex;
+    std::vector<Event> events;
+
+    static uint32_t threadNumber() {
+        static std::atomic<uint32_t> next = 1;
+        thread_local const uint32_t number = next++;
+        return number;
+    }
+
+public:
+
+    static std::string quote(std::string_view s) {
+        std::string q = "\"";
+        for (const char c : s) {
+            if (c == '"' || c == '\\') { q += '\\'; q += c; }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                char escape[8];
+                std::snprintf(escape, sizeof escape, "\\u%04X", static_cast<unsigned>(c));
+                q += escape;
+            }
+            else q += c;
+        }
+        return q + '"';
+    }
+
+    void enable(bool on) {
+        recording = on;
+        if (!on) {
+            std::lock_guard lock(mutex);
+            events.clear();
+        }
+    }
+
+    bool on() const { return recording; }
+
+    double now() const { return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - origin).count(); }
+
+    void complete(std::string_view name, std::string_view category, double start, double end, std::string_view args = {}) {
+        if (!recording) return;
+        std::lock_guard lock(mutex);
+        events.push_back({ std::string(name), std::string(category), std::string(args), start, end - start, threadNumber(), false });
+    }
+
+    void nameThread(std::string_view name) {
+        if (!recording) return;
+        std::lock_guard lock(mutex);
+        events.push_back({ std::string(name), {}, {}, 0, 0, threadNumber(), true });
+    }
+
+    std::string json() const {
+        std::lock_guard lock(mutex);
+        std::string s = "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+        for (size_t i = 0; i < events.size(); ++i) {
+            const Event& e = events[i];
+            char times[96];
+            if (e.threadName) s += "{\"ph\": \"M\", \"name\": \"thread_name\", \"pid\": 1, \"tid\": " + std::to_string(e.thread)
+                                 + ", \"args\": {\"name\": " + quote(e.name) + "}}";
+            else {
+                std::snprintf(times, sizeof times, "\"ts\": %.3f, \"dur\": %.3f", e.start, e.duration);
+                s += "{\"ph\": \"X\", \"name\": " + quote(e.name) + ", \"cat\": " + quote(e.category) + ", \"pid\": 1, \"tid\": "
+                   + std::to_string(e.thread) + ", " + times + ", \"args\": {" + e.args + "}}";
+            }
+            s += i + 1 < events.size() ? ",\n" : "\n";
+        }
+        return s + "]}\n";
+    }
+
+    class Span {
+        Timeline&   timeline;
+        std::string name;
+        std::string category;
+        std::string args;
+        double      start;
+    public:
+        Span(Timeline& timeline, std::string_view name, std::string_view category, std::string_view args = {})
+            : timeline(timeline), name(name), category(category), args(args), start(timeline.now()) {}
+        ~Span() { timeline.complete(name, category, start, timeline.now(), args); }
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+    };
+
+};
+
+inline Timeline timeline;
@@ -21,7 +21,40 @@
 
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define UNICODE_FORMAT_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UNICODE_FORMAT_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define UNICODE_FORMAT_NEON 1
+#endif
+
+// Translation between UTF-8, UTF-16 and UTF-32.
+//
+// Each translation comes in three forms:
+//
+// std::wstring utf8to16(std::string_view s, InvalidUnicode errs = InvalidUnicode::Substitute)  (and so on)
+//     Returns the translation as a string. UTF-16 strings are std::wstring, as Windows uses them.
+//
+// size_t utf8to16(std::string_view s, std::span<char16_t> out, InvalidUnicode errs = InvalidUnicode::Substitute)
+//     Writes the translation to out and returns its length; does not allocate memory. If the translation is longer
+//     than out, nothing is written and the length is returned anyway, so the caller can tell and try again.
+//
+// size_t utf8to16Length(std::string_view s, InvalidUnicode errs = InvalidUnicode::Substitute)
+//     Returns the exact length of the translation.
+//
+// Runs of ASCII (and, from UTF-16 to UTF-32 and back, of characters in the Basic Multilingual Plane other than
+// surrogates) are translated a block at a time with SSE2 (or AVX2, when the compiler targets it) on x86 and x64,
+// and NEON on ARM; elsewhere, and for the rest, one character at a time.
 
 enum class InvalidUnicode {
     Substitute  = 0,  // Use substitution character when transcoding invalid Unicode
@@ -34,8 +67,8 @@ namespace utf8byte {
     inline bool isTrail(char c) { return (c & 0xC0) == 0x80; }
     inline bool isLead2(char c) { return (c & 0xE0) == 0xC0 && (c & 0xFE) != 0xC0; }
     inline bool isLead3(char c) { return (c & 0xF0) == 0xE0; }
-    inline bool isLead4(char c) { return (c & 0xFC) == 0xF0 || c == 0xF4; }
-    inline bool isTrash(char c) { return (c & 0xFE) == 0xC0 || ((c & 0xF0) == 0xF0 && (c & 0x0C) != 0x00 && c != 0xF4); }
+    inline bool isLead4(char c) { return (c & 0xFC) == 0xF0 || static_cast<unsigned char>(c) == 0xF4; }
+    inline bool isTrash(char c) { return (c & 0xFE) == 0xC0 || ((c & 0xF0) == 0xF0 && (c & 0x0C) != 0x00 && static_cast<unsigned char>(c) != 0xF4); }
     inline bool badPair(unsigned char c1, unsigned char c2) {
         // checks first two of 3 or 4 byte sequences; does not validate 1 or 2 byte sequences
         return ((c1 == 0xE0 && c2 < 0xA0) || (c1 == 0xED && c2 > 0x9F) || (c1 == 0xF0 && c2 < 0x90) || (c1 == 0xF4 && c2 > 0x8F));
@@ -55,151 +88,465 @@ namespace utf8byte {
 }
 
 
-// Translation between utf-8, utf-16 and utf-32
+// Block translation of runs of ASCII and BMP characters. Each function handles the leading run of its input that it
+// can and returns the number of code units handled; when out is null it only counts.
 
-inline std::u32string utf16to32(const std::wstring_view w) {
-    std::u32string u;
-    for (size_t i = 0; i < w.length(); ++i) {
-        if (w[i] >= 0xD800 && w[i] < 0xDC00 && i + 1 < w.length() && w[i + 1] >= 0xDC00 && w[i + 1] <= 0xDFFF) {
-            u += (static_cast<char32_t>(w[i] & 0x7FF) << 10 | (w[i + 1] & 0x03FF)) + 0x10000;
-            ++i;
+namespace utfBlock {
+
+    inline size_t asciiFrom8(const char* s, size_t n, char16_t* out) {
+        size_t i = 0;
+#if UNICODE_FORMAT_AVX2
+        for (; i + 32 <= n; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+            if (_mm256_movemask_epi8(v)) break;
+            if (!out) continue;
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i     ), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+        }
+#endif
+#if UNICODE_FORMAT_SSE2
+        for (; i + 16 <= n; i += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            if (_mm_movemask_epi8(v)) break;
+            if (!out) continue;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i    ), _mm_unpacklo_epi8(v, _mm_setzero_si128()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_unpackhi_epi8(v, _mm_setzero_si128()));
         }
-        else u += w[i];
+#elif UNICODE_FORMAT_NEON
+        for (; i + 16 <= n; i += 16) {
+            const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(s + i));
+            if (vmaxvq_u8(v) & 0x80) break;
+            if (!out) continue;
+            vst1q_u16(reinterpret_cast<uint16_t*>(out + i    ), vmovl_u8(vget_low_u8 (v)));
+            vst1q_u16(reinterpret_cast<uint16_t*>(out + i + 8), vmovl_u8(vget_high_u8(v)));
+        }
+#endif
+        for (; i < n && !(s[i] & 0x80); ++i) if (out) out[i] = s[i];
+        return i;
     }
-    return u;
+
+    inline size_t asciiFrom8(const char* s, size_t n, char32_t* out) {
+        size_t i = 0;
+#if UNICODE_FORMAT_SSE2
+        for (; i + 16 <= n; i += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            if (_mm_movemask_epi8(v)) break;
+            if (!out) continue;
+            const __m128i low  = _mm_unpacklo_epi8(v, _mm_setzero_si128());
+            const __m128i high = _mm_unpackhi_epi8(v, _mm_setzero_si128());
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i     ), _mm_unpacklo_epi16(low , _mm_setzero_si128()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i +  4), _mm_unpackhi_epi16(low , _mm_setzero_si128()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i +  8), _mm_unpacklo_epi16(high, _mm_setzero_si128()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 12), _mm_unpackhi_epi16(high, _mm_setzero_si128()));
+        }
+#elif UNICODE_FORMAT_NEON
+        for (; i + 16 <= n; i += 16) {
+            const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(s + i));
+            if (vmaxvq_u8(v) & 0x80) break;
+            if (!out) continue;
+            const uint16x8_t low = vmovl_u8(vget_low_u8(v)), high = vmovl_u8(vget_high_u8(v));
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + i     ), vmovl_u16(vget_low_u16 (low )));
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + i +  4), vmovl_u16(vget_high_u16(low )));
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + i +  8), vmovl_u16(vget_low_u16 (high)));
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + i + 12), vmovl_u16(vget_high_u16(high)));
+        }
+#endif
+        for (; i < n && !(s[i] & 0x80); ++i) if (out) out[i] = s[i];
+        return i;
+    }
+
+    inline size_t asciiTo8(const char16_t* w, size_t n, char* out) {
+        size_t i = 0;
+#if UNICODE_FORMAT_AVX2
+        for (; i + 32 <= n; i += 32) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i     ));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i + 16));
+            if (!_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_set1_epi16(static_cast<short>(0xFF80)))) break;
+            if (out) _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+        }
+#endif
+#if UNICODE_FORMAT_SSE2
+        for (; i + 16 <= n; i += 16) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i    ));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i + 8));
+            const __m128i high = _mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16(static_cast<short>(0xFF80)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF) break;
+            if (out) _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(a, b));
+        }
+#elif UNICODE_FORMAT_NEON
+        for (; i + 16 <= n; i += 16) {
+            const uint16x8_t a = vld1q_u16(reinterpret_cast<const uint16_t*>(w + i    ));
+            const uint16x8_t b = vld1q_u16(reinterpret_cast<const uint16_t*>(w + i + 8));
+            if (vmaxvq_u16(vorrq_u16(a, b)) >= 0x80) break;
+            if (out) vst1q_u8(reinterpret_cast<uint8_t*>(out + i), vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+        }
+#endif
+        for (; i < n && w[i] < 0x80; ++i) if (out) out[i] = static_cast<char>(w[i]);
+        return i;
+    }
+
+    // Counts the UTF-8 bytes for the leading run of w without surrogates, eight code units at a time; returns the
+    // number of code units counted, which is a multiple of eight.
+
+    inline size_t bmpLength8(const char16_t* w, size_t n, size_t& bytes) {
+        size_t i = 0;
+#if UNICODE_FORMAT_SSE2
+        // Each unit takes three bytes, less one for each of 0x7F and 0x7FF it does not exceed; the comparisons give -1
+        // in the lanes of those units, which are summed in 16-bit lanes and added to bytes before they can overflow.
+        const __m128i zero = _mm_setzero_si128();
+        __m128i sum = zero;
+        auto flush = [&] {
+            alignas(16) int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_madd_epi16(sum, _mm_set1_epi16(1)));
+            bytes -= static_cast<size_t>(-(lanes[0] + lanes[1] + lanes[2] + lanes[3]));
+            sum = zero;
+        };
+        for (; i + 8 <= n; i += 8) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i));
+            const __m128i surrogate = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xF800))),
+                                                      _mm_set1_epi16(static_cast<short>(0xD800)));
+            if (_mm_movemask_epi8(surrogate)) break;
+            sum = _mm_add_epi16(sum, _mm_add_epi16(_mm_cmpeq_epi16(_mm_subs_epu16(v, _mm_set1_epi16(0x7F )), zero),
+                                                   _mm_cmpeq_epi16(_mm_subs_epu16(v, _mm_set1_epi16(0x7FF)), zero)));
+            bytes += 24;
+            if ((i & 0xFFF8) == 0xFFF8) flush();
+        }
+        flush();
+#elif UNICODE_FORMAT_NEON
+        for (; i + 8 <= n; i += 8) {
+            const uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t*>(w + i));
+            if (vmaxvq_u16(vceqq_u16(vandq_u16(v, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800)))) break;
+            bytes += 8 + vaddvq_u16(vandq_u16(vcgeq_u16(v, vdupq_n_u16(0x80)), vdupq_n_u16(1)))
+                       + vaddvq_u16(vandq_u16(vcgeq_u16(v, vdupq_n_u16(0x800)), vdupq_n_u16(1)));
+        }
+#endif
+        return i;
+    }
+
+    inline size_t bmpFrom16(const char16_t* w, size_t n, char32_t* out) {
+        size_t i = 0;
+#if UNICODE_FORMAT_SSE2
+        for (; i + 8 <= n; i += 8) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i));
+            const __m128i surrogate = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xF800))),
+                                                      _mm_set1_epi16(static_cast<short>(0xD800)));
+            if (_mm_movemask_epi8(surrogate)) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i    ), _mm_unpacklo_epi16(v, _mm_setzero_si128()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), _mm_unpackhi_epi16(v, _mm_setzero_si128()));
+        }
+#elif UNICODE_FORMAT_NEON
+        for (; i + 8 <= n; i += 8) {
+            const uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t*>(w + i));
+            if (vmaxvq_u16(vceqq_u16(vandq_u16(v, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800)))) break;
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + i    ), vmovl_u16(vget_low_u16 (v)));
+            vst1q_u32(reinterpret_cast<uint32_t*>(out + i + 4), vmovl_u16(vget_high_u16(v)));
+        }
+#endif
+        for (; i < n && (w[i] < 0xD800 || w[i] > 0xDFFF); ++i) out[i] = w[i];
+        return i;
+    }
+
+    inline size_t bmpTo16(const char32_t* u, size_t n, char16_t* out) {
+        size_t i = 0;
+#if UNICODE_FORMAT_SSE2
+        for (; i + 8 <= n; i += 8) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u + i    ));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u + i + 4));
+            const __m128i limit = _mm_set1_epi32(0xD800 >> 11);
+            const __m128i below = _mm_and_si128(_mm_cmplt_epi32(_mm_srli_epi32(a, 11), limit), _mm_cmplt_epi32(_mm_srli_epi32(b, 11), limit));
+            if (_mm_movemask_epi8(below) != 0xFFFF) break;
+            // packs_epi32 saturates to signed 16 bits, so the values are moved into that range and back
+            const __m128i bias = _mm_set1_epi32(0x8000);
+            const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(a, bias), _mm_sub_epi32(b, bias));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi16(packed, _mm_set1_epi16(static_cast<short>(0x8000))));
+        }
+#elif UNICODE_FORMAT_NEON
+        for (; i + 8 <= n; i += 8) {
+            const uint32x4_t a = vld1q_u32(reinterpret_cast<const uint32_t*>(u + i    ));
+            const uint32x4_t b = vld1q_u32(reinterpret_cast<const uint32_t*>(u + i + 4));
+            if (vmaxvq_u32(vorrq_u32(a, b)) >= 0xD800) break;
+            vst1q_u16(reinterpret_cast<uint16_t*>(out + i), vcombine_u16(vmovn_u32(a), vmovn_u32(b)));
+        }
+#endif
+        for (; i < n && u[i] < 0xD800; ++i) out[i] = static_cast<char16_t>(u[i]);
+        return i;
+    }
+
 }
 
-inline std::wstring utf32to16(const std::u32string_view u) {
-    std::wstring w;
-    for (size_t i = 0; i < u.length(); ++i) {
-        if (u[i] >= 0x10000) {
-            w += static_cast<wchar_t>(0xD800 + ((u[i] - 0x10000) >> 10));
-            w += static_cast<wchar_t>(0xDC00 + (u[i] & 0x03FF));
+
+// Character at a time translation, on which the functions below are built. When out is null, they only count.
+
+namespace utfCore {
+
+    template<typename CharT> size_t from8(std::string_view s, CharT* out, InvalidUnicode errs) {
+        size_t n = 0;
+        auto put = [&](char32_t c) {
+            if constexpr (sizeof(CharT) == 2) if (c >= 0x10000) {
+                if (out) {
+                    out[n    ] = static_cast<CharT>(0xD800 + ((c - 0x10000) >> 10));
+                    out[n + 1] = static_cast<CharT>(0xDC00 + (c & 0x03FF));
+                }
+                n += 2;
+                return;
+            }
+            if (out) out[n] = static_cast<CharT>(c);
+            ++n;
+        };
+        for (size_t i = 0; i < s.length(); ++i) {
+            switch (utf8byte::implicit_length(s[i])) {
+            case 1: {
+                const size_t ascii = utfBlock::asciiFrom8(s.data() + i, s.length() - i, out ? out + n : nullptr);
+                n += ascii;
+                i += ascii - 1;
+                continue;
+            }
+            case 2:
+                if (i + 1 >= s.length() || !utf8byte::isTrail(s[i + 1])) break;
+                put(utf8byte::to32(s[i], s[i + 1]));
+                i += 1;
+                continue;
+            case 3:
+                if (i + 2 >= s.length() || !utf8byte::isTrail(s[i + 1]) || !utf8byte::isTrail(s[i + 2])) break;
+                if ((errs != InvalidUnicode::Preserve_16 || static_cast<unsigned char>(s[i]) != 0xED)
+                    && utf8byte::badPair(s[i], s[i + 1])) break;
+                put(utf8byte::to32(s[i], s[i + 1], s[i + 2]));
+                i += 2;
+                continue;
+            case 4:
+                if (i + 3 >= s.length() || !utf8byte::valid_trail(s[i], s[i + 1], s[i + 2], s[i + 3])) break;
+                put(utf8byte::to32(s[i], s[i + 1], s[i + 2], s[i + 3]));
+                i += 3;
+                continue;
+            }
+            put(errs == InvalidUnicode::Preserve_8 ? 0xDC00 + static_cast<unsigned char>(s[i]) : 0xFFFD);
+        }
+        return n;
+    }
+
+    template<typename CharT> size_t to8(std::basic_string_view<CharT> w, char* out, InvalidUnicode errs) {
+        size_t n = 0;
+        auto put = [&](char32_t c) {
+            if (c < 0x80) {
+                if (out) out[n] = static_cast<char>(c);
+                n += 1;
+            }
+            else if (c < 0x800) {
+                if (out) {
+                    out[n    ] = static_cast<char>((c >> 6) | 0xC0);
+                    out[n + 1] = static_cast<char>((c & 0x3F) | 0x80);
+                }
+                n += 2;
+            }
+            else if (c < 0x10000) {
+                if (out) {
+                    out[n    ] = static_cast<char>((c >> 12) | 0xE0);
+                    out[n + 1] = static_cast<char>(((c >> 6) & 0x3F) | 0x80);
+                    out[n + 2] = static_cast<char>((c & 0x3F) | 0x80);
+                }
+                n += 3;
+            }
+            else {
+                if (out) {
+                    out[n    ] = static_cast<char>((c >> 18) | 0xF0);
+                    out[n + 1] = static_cast<char>(((c >> 12) & 0x3F) | 0x80);
+                    out[n + 2] = static_cast<char>(((c >> 6) & 0x3F) | 0x80);
+                    out[n + 3] = static_cast<char>((c & 0x3F) | 0x80);
+                }
+                n += 4;
+            }
+        };
+        for (size_t i = 0; i < w.length(); ++i) {
+            if constexpr (sizeof(CharT) == 2) if (!out) {
+                const size_t bmp = utfBlock::bmpLength8(w.data() + i, w.length() - i, n);
+                if (bmp) {
+                    i += bmp - 1;
+                    continue;
+                }
+            }
+            const char32_t c = w[i];
+            if (c < 0x80) {
+                if constexpr (sizeof(CharT) == 2) {
+                    const size_t ascii = utfBlock::asciiTo8(w.data() + i, w.length() - i, out ? out + n : nullptr);
+                    n += ascii;
+                    i += ascii - 1;
+                }
+                else put(c);
+            }
+            else if (c < 0xD800 || (c > 0xDFFF && c < 0x110000)) put(c);
+            else if (sizeof(CharT) == 2 && c < 0xDC00 && i + 1 < w.length() && w[i + 1] >= 0xDC00 && w[i + 1] <= 0xDFFF) {
+                put(0x10000 + ((c - 0xD800) << 10) + (w[i + 1] - 0xDC00));
+                ++i;
+            }
+            else if (errs == InvalidUnicode::Preserve_8 && c >= 0xDC80 && c <= 0xDCFF) {
+                if (out) out[n] = static_cast<char>(c & 0xFF);
+                ++n;
+            }
+            else if (errs == InvalidUnicode::Preserve_16 && c >= 0xD800 && c <= 0xDFFF) put(c);
+            else put(0xFFFD);
+        }
+        return n;
+    }
+
+    inline size_t from16(std::u16string_view w, char32_t* out) {
+        size_t n = 0;
+        for (size_t i = 0; i < w.length(); ++i) {
+            if (out && w[i] < 0xD800) {
+                const size_t bmp = utfBlock::bmpFrom16(w.data() + i, w.length() - i, out + n);
+                n += bmp;
+                i += bmp - 1;
+            }
+            else if (w[i] >= 0xD800 && w[i] < 0xDC00 && i + 1 < w.length() && w[i + 1] >= 0xDC00 && w[i + 1] <= 0xDFFF) {
+                if (out) out[n] = 0x10000 + ((w[i] - 0xD800) << 10) + (w[i + 1] - 0xDC00);
+                ++n;
+                ++i;
+            }
+            else {
+                if (out) out[n] = w[i];
+                ++n;
+            }
         }
-        else w += static_cast<wchar_t>(u[i]);
+        return n;
     }
-    return w;
+
+    inline size_t to16(std::u32string_view u, char16_t* out) {
+        size_t n = 0;
+        for (size_t i = 0; i < u.length(); ++i) {
+            const char32_t c = u[i];
+            if (out && c < 0xD800) {
+                const size_t bmp = utfBlock::bmpTo16(u.data() + i, u.length() - i, out + n);
+                n += bmp;
+                i += bmp - 1;
+            }
+            else if (c >= 0x10000 && c < 0x110000) {
+                if (out) {
+                    out[n    ] = static_cast<char16_t>(0xD800 + ((c - 0x10000) >> 10));
+                    out[n + 1] = static_cast<char16_t>(0xDC00 + (c & 0x03FF));
+                }
+                n += 2;
+            }
+            else {
+                if (out) out[n] = c < 0x110000 ? static_cast<char16_t>(c) : u'\xFFFD';
+                ++n;
+            }
+        }
+        return n;
+    }
+
+    // Views a std::wstring_view as UTF-16, copying it into temp where wchar_t is not 16 bits.
+
+    inline std::u16string_view view16(std::wstring_view w, std::u16string& temp) {
+        if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+            return std::u16string_view(reinterpret_cast<const char16_t*>(w.data()), w.length());
+        temp.assign(w.begin(), w.end());
+        return temp;
+    }
+
+    // Sets a std::wstring from UTF-16 written by convert(char16_t* out), given the exact length.
+
+    template<typename F> std::wstring wide(size_t length, F convert) {
+        std::wstring w(length, 0);
+        if constexpr (sizeof(wchar_t) == sizeof(char16_t)) convert(reinterpret_cast<char16_t*>(w.data()));
+        else {
+            std::u16string temp(length, 0);
+            convert(temp.data());
+            w.assign(temp.begin(), temp.end());
+        }
+        return w;
+    }
+
+}
+
+
+// Exact lengths
+
+inline size_t utf8to16Length(std::string_view s, InvalidUnicode errs = InvalidUnicode::Substitute) {
+    return utfCore::from8<char16_t>(s, nullptr, errs);
+}
+
+inline size_t utf8to32Length(std::string_view s, InvalidUnicode errs = InvalidUnicode::Substitute) {
+    return utfCore::from8<char32_t>(s, nullptr, errs);
+}
+
+inline size_t utf16to8Length(std::u16string_view w, InvalidUnicode errs = InvalidUnicode::Substitute) {
+    return utfCore::to8(w, nullptr, errs);
+}
+
+inline size_t utf32to8Length(std::u32string_view u, InvalidUnicode errs = InvalidUnicode::Substitute) {
+    return utfCore::to8(u, nullptr, errs);
+}
+
+inline size_t utf16to32Length(std::u16string_view w) { return utfCore::from16(w, nullptr); }
+inline size_t utf32to16Length(std::u32string_view u) { return utfCore::to16(u, nullptr); }
+
+
+// Translation into caller-provided buffers; the first test in each is the most the translation can need.
+
+inline size_t utf8to16(std::string_view s, std::span<char16_t> out, InvalidUnicode errs = InvalidUnicode::Substitute) {
+    if (out.size() < s.length()) if (const size_t n = utf8to16Length(s, errs); n > out.size()) return n;
+    return utfCore::from8(s, out.data(), errs);
+}
+
+inline size_t utf8to32(std::string_view s, std::span<char32_t> out, InvalidUnicode errs = InvalidUnicode::Substitute) {
+    if (out.size() < s.length()) if (const size_t n = utf8to32Length(s, errs); n > out.size()) return n;
+    return utfCore::from8(s, out.data(), errs);
+}
+
+inline size_t utf16to8(std::u16string_view w, std::span<char> out, InvalidUnicode errs = InvalidUnicode::Substitute) {
+    if (out.size() / 3 < w.length()) if (const size_t n = utf16to8Length(w, errs); n > out.size()) return n;
+    return utfCore::to8(w, out.data(), errs);
+}
+
+inline size_t utf32to8(std::u32string_view u, std::span<char> out, InvalidUnicode errs = InvalidUnicode::Substitute) {
+    if (out.size() / 4 < u.length()) if (const size_t n = utf32to8Length(u, errs); n > out.size()) return n;
+    return utfCore::to8(u, out.data(), errs);
+}
+
+inline size_t utf16to32(std::u16string_view w, std::span<char32_t> out) {
+    if (out.size() < w.length()) if (const size_t n = utf16to32Length(w); n > out.size()) return n;
+    return utfCore::from16(w, out.data());
+}
+
+inline size_t utf32to16(std::u32string_view u, std::span<char16_t> out) {
+    if (out.size() / 2 < u.length()) if (const size_t n = utf32to16Length(u); n > out.size()) return n;
+    return utfCore::to16(u, out.data());
+}
+
+
+// Translation into strings
+
+inline std::u32string utf16to32(const std::wstring_view w) {
+    std::u16string temp;
+    const std::u16string_view v = utfCore::view16(w, temp);
+    std::u32string u(utf16to32Length(v), 0);
+    utfCore::from16(v, u.data());
+    return u;
+}
+
+inline std::wstring utf32to16(const std::u32string_view u) {
+    return utfCore::wide(utf32to16Length(u), [&](char16_t* out) { utfCore::to16(u, out); });
 }
 
 inline std::u32string utf8to32(const std::string_view s, InvalidUnicode errs = InvalidUnicode::Substitute) {
-    std::u32string u;
-    for (size_t i = 0; i < s.length(); ++i) {
-        switch (utf8byte::implicit_length(s[i])) {
-        case 1:
-            u += s[i];
-            continue;
-        case 2:
-            if (i + 1 >= s.length() || !utf8byte::isTrail(s[i + 1])) break;
-            u += utf8byte::to32(s[i], s[i + 1]);
-            i += 1;
-            continue;
-        case 3:
-            if (i + 2 >= s.length() || !utf8byte::isTrail(s[i + 1]) || !utf8byte::isTrail(s[i + 2])) break;
-            if ((errs != InvalidUnicode::Preserve_16 || s[i] != 0xED) && utf8byte::badPair(s[i], s[i + 1])) break;
-            u += static_cast<wchar_t>(utf8byte::to32(s[i], s[i + 1], s[i + 2]));
-            i += 2;
-            continue;
-        case 4:
-            if (i + 3 >= s.length() || !utf8byte::valid_trail(s[i], s[i + 1], s[i + 2]), s[i + 3]) break;
-            u += utf8byte::to32(s[i], s[i + 1], s[i + 2]);
-            i += 3;
-            continue;
-        }
-        u += (errs == InvalidUnicode::Preserve_8) ? 0xDC00 + s[i] : 0xFFFD;
-    }
+    std::u32string u(utf8to32Length(s, errs), 0);
+    utfCore::from8(s, u.data(), errs);
     return u;
 }
 
 inline std::string utf32to8(const std::u32string_view u, InvalidUnicode errs = InvalidUnicode::Substitute) {
-    std::string s;
-    for (auto c : u) {
-        if (c < 0x80) s += static_cast<char>(c);
-        else if (c < 0x800) {
-            s += static_cast<char>((c >> 6) | 0xC0);
-            s += static_cast<char>((c & 0x3F) | 0x80);
-        }
-        else if (c >= 0xD800 && c <= 0xDFFF && errs != InvalidUnicode::Preserve_16) {
-            if (errs == InvalidUnicode::Preserve_8 && (c >= 0xDC80 && c <= 0xDCFF)) s += static_cast<char>(0xFF & c);
-            else s += "\xEF\xBF\xBD";
-        }
-        else if (c <= 0x10000) {
-            s += static_cast<char>((c >> 12) | 0xE0);
-            s += static_cast<char>(((c >> 6) & 0x3F) | 0x80);
-            s += static_cast<char>((c & 0x3F) | 0x80);
-        }
-        else if (c <= 0x110000){
-            s += static_cast<char>((c >> 18) | 0xF0);
-            s += static_cast<char>(((c >> 12) & 0x3F) | 0x80);
-            s += static_cast<char>(((c >> 6) & 0x3F) | 0x80);
-            s += static_cast<char>((c & 0x3F) | 0x80);
-        }
-        else s += "\xEF\xBF\xBD";
-    }
+    std::string s(utf32to8Length(u, errs), 0);
+    utfCore::to8(u, s.data(), errs);
     return s;
 }
 
 inline std::wstring utf8to16(const std::string_view s, InvalidUnicode errs = InvalidUnicode::Substitute) {
-    std::wstring w;
-    for (size_t i = 0; i < s.length(); ++i) {
-        switch (utf8byte::implicit_length(s[i])) {
-        case 1:
-            w += s[i];
-            continue;
-        case 2:
-            if (i + 1 >= s.length() || !utf8byte::isTrail(s[i + 1])) break;
-            w += static_cast<wchar_t>(utf8byte::to32(s[i], s[i + 1]));
-            i += 1;
-            continue;
-        case 3:
-            if (i + 2 >= s.length() || !utf8byte::isTrail(s[i + 1]) || !utf8byte::isTrail(s[i + 2])) break;
-            if ((errs != InvalidUnicode::Preserve_16 || s[i] != 0xED) && utf8byte::badPair(s[i], s[i + 1])) break;
-            w += static_cast<wchar_t>(utf8byte::to32(s[i], s[i + 1], s[i + 2]));
-            i += 2;
-            continue;
-        case 4:
-            if (i + 3 >= s.length() || !utf8byte::valid_trail(s[i], s[i + 1], s[i + 2], s[i + 3])) break;
-            char32_t u = utf8byte::to32(s[i], s[i + 1], s[i + 2], s[i + 3]);
-            w += static_cast<wchar_t>(0xD800 + ((u - 0x10000) >> 10));
-            w += static_cast<wchar_t>(0xDC00 + (u & 0x03FF));
-            i += 3;
-            continue;
-        }
-        w += (errs == InvalidUnicode::Preserve_8) ? 0xDC00 + s[i] : 0xFFFD;
-    }
-    return w;
+    return utfCore::wide(utf8to16Length(s, errs), [&](char16_t* out) { utfCore::from8(s, out, errs); });
 }
 
 inline std::string utf16to8(const std::wstring_view w, InvalidUnicode errs = InvalidUnicode::Substitute) {
-    std::string s;
-    for (size_t i = 0; i < w.length(); ++i) {
-        wchar_t c = w[i];
-        if (c < 0x80) s += static_cast<char>(c);
-        else if (c < 0x800) {
-            s += static_cast<char>((c >> 6) | 0xC0);
-            s += static_cast<char>((c & 0x3F) | 0x80);
-        }
-        else if (c < 0xD800 && c > 0xDFFF) {
-            s += static_cast<char>((c >> 12) | 0xE0);
-            s += static_cast<char>(((c >> 6) & 0x3F) | 0x80);
-            s += static_cast<char>((c & 0x3F) | 0x80);
-        }
-        else {
-            if (i + 1 < w.length() && w[i + 1] >= 0xDC00 && w[i + 1] <= 0xDFFF) {
-                char32_t u = (static_cast<char32_t>(c & 0x7FF) << 10 | (w[i + 1] & 0x03FF)) + 0x10000;
-                s += static_cast<char>((u >> 18) | 0xF0);
-                s += static_cast<char>(((u >> 12) & 0x3F) | 0x80);
-                s += static_cast<char>(((u >> 6) & 0x3F) | 0x80);
-                s += static_cast<char>((u & 0x3F) | 0x80);
-                ++i;
-            }
-            else if (errs == InvalidUnicode::Preserve_8 && (c >= 0xDC80 && c <= 0xDCFF)) s += static_cast<char>(0xFF & c);
-            else if (errs == InvalidUnicode::Preserve_16) {
-                s += static_cast<char>(0xED);
-                s += static_cast<char>(((c >> 6) & 0x3F) | 0x80);
-                s += static_cast<char>((c & 0x3F) | 0x80);
-            }
-            else s += "\xEF\xBF\xBD";
-        }
-    }
+    std::u16string temp;
+    const std::u16string_view v = utfCore::view16(w, temp);
+    std::string s(utf16to8Length(v, errs), 0);
+    utfCore::to8(v, s.data(), errs);
     return s;
-}
\ No newline at end of file
+}
@@ -0,0 +1,2709 @@
+// Generated by tools/GenerateUnicodeNames.py from Unicode 14.0.0 character data -- do not edit.
+// 32647 names of 13106 words in 1464 runs, 13 ranges of numbered names.
+
+#pragma once
+
+#include <cstdint>
+
+namespace unicodeNameTables {
+
+inline constexpr const char* unicodeVersion = "14.0.0";
+
+struct Run   { char32_t first; uint16_t count; const char* names; };
+struct Range { char32_t first, last; const char* prefix; };
+
+inline constexpr unsigned oneByte = 0xBF;
+
+inline constexpr const char* words[] = {
+    "LETTER", "SIGN", "WITH", "SMALL", "SYLLABLE", "CAPITAL", "HIEROGLYPH", "LATIN", "ARABIC", "YI", "CUNEIFORM",
+    "SYMBOL", "MATHEMATICAL", "EGYPTIAN", "DIGIT", "FORM", "VOWEL", "TANGUT", "CANADIAN", "SYLLABICS", "A",
+    "SIGNWRITING", "TIMES", "BAMUM", "AND", "BOLD", "ANATOLIAN", "ARROW", "HANGUL", "NUMBER", "LINEAR", "COMBINING",
+    "LIGATURE", "GREEK", "ETHIOPIC", "MUSICAL", "OLD", "RIGHT", "ABOVE", "LEFT", "FOR", "CYRILLIC", "MARK", "SQUARE",
+    "ITALIC", "CIRCLED", "RADICAL", "SANS-SERIF", "U", "ONE", "FINAL", "DOUBLE", "TAI", "O", "TWO", "BLACK", "E",
+    "BELOW", "I", "DOT", "VAI", "MODIFIER", "B", "WHITE", "HENTAIGANA", "THREE", "TO", "VARIATION", "PATTERN",
+    "BRAILLE", "BYZANTINE", "KATAKANA", "STROKE", "ISOLATED", "OF", "HEAVY", "MIDDLE", "MYANMAR", "FOUR", "KANGXI",
+    "KIKAKUI", "MENDE", "HOOK", "VERTICAL", "TIBETAN", "FIVE", "CJK", "INITIAL", "MEEM", "HMONG", "KA", "RIGHTWARDS",
+    "YEH", "COPTIC", "ZNAMENNY", "CARRIER", "PLUS", "UP", "R", "S", "BOX", "SQUARED", "GEORGIAN", "CHEROKEE", "FACE",
+    "MONGOLIAN", "INDEX", "LOWER", "DEVANAGARI", "LEFTWARDS", "HALF", "L", "PHASE-E", "BLOCK", "UPPER", "DOWN", "EIGHT",
+    "SIX", "ALEF", "BAR", "CIRCLE", "MIAO", "LIGHT", "VOCALIC", "KHMER", "TILE", "DRAWINGS", "DUPLOYAN", "SEVEN",
+    "BRACKET", "HA", "PARENTHESIZED", "THAM", "GONDI", "HUNDRED", "LOW", "NINE", "TONE", "JONGSEONG", "DOTS",
+    "GLAGOLITIC", "HEBREW", "HIGH", "TAMIL", "THUMB", "MALAYALAM", "OVER", "SIYAQ", "PAHAWH", "CHOSEONG", "BALINESE",
+    "PA", "HAND-FIST", "N", "HALFWIDTH", "MEROITIC", "RA", "SCRIPT", "IDEOGRAPHIC", "RING", "TURNED", "IDEOGRAM",
+    "PHASE-D", "ALCHEMICAL", "EQUAL", "HAH", "NEUME", "BRAHMI", "MA", "LA", "LONG", "THOUSAND", "HORIZONTAL", "NA",
+    "NUMERIC", "TRIANGLE", "M", "OPEN", "SINHALA", "YA", "TA", "HUNGARIAN", "DOWNWARDS", "MEDIUM", "SA", "TILDE",
+    "BARB", "DIAGONAL", "NORTH", "TAG", "UPWARDS", "DA", "FULLWIDTH", "G", "JEEM", "GA", "PUNCTUATION", "T", "DOMINO",
+    "K", "TELUGU", "CYPRO-MINOAN", "FRAKTUR", "V", "FRACTION", "MEDIAL", "NEGATIVE", "PHASE-C", "SIDDHAM", "BHAIKSUKI",
+    "D", "DOUBLE-STRUCK", "H", "NEWA", "ARMENIAN", "BENGALI", "CHESS", "SHARADA", "CHARACTER", "HIRAGANA", "JUNGSEONG",
+    "OR", "Z", "ACUTE", "BA", "LARGE", "Y", "ZERO", "GUJARATI", "IDEOGRAPH", "JAVANESE", "MEDEFAIDRIN", "ORIYA",
+    "CURSIVE", "KANNADA", "SYRIAC", "WEST-CREE", "AA", "RUNIC", "TANGSA", "ADLAM", "CONSONANT", "SOUTH", "C", "CARD",
+    "NEW", "PHASE-A", "THAI", "REVERSED", "GRANTHA", "P", "SOGDIAN", "X", "CITI", "LUE", "MOVEMENT-WALLPLANE",
+    "SUBJOINED", "WARANG", "CHAM", "DASIA", "PLAYING", "SOYOMBO", "TEN", "LAO", "SAURASHTRA", "TIRHUTA", "AI",
+    "CIRCUMFLEX", "SINGLE", "TETRAGRAM", "W", "DESERET", "GURMUKHI", "HAMZA", "II", "J", "MAYEK", "MEETEI", "MODI",
+    "NOTATION", "PSILI", "INDIC", "NUMERAL", "POINTING", "GA2", "MOVEMENT-FLOORPLANE", "TRIANGLE-HEADED", "ARROWHEAD",
+    "DIAERESIS", "NGA", "AU", "BOPOMOFO", "MASARAM", "JA", "LAM", "LEPCHA", "SHA", "STOP", "UU", "CA", "OMEGA",
+    "TURKIC", "VIET", "WA", "AKURU", "ALPHA", "DIVES", "F", "OSAGE", "SHORT", "SUNDANESE", "ZANABAZAR", "CHAKMA",
+    "LITTLE", "NYIAKENG", "PUACHUE", "APL", "FUNCTIONAL", "GRAVE", "LINE", "VITHKUQI", "KHUDAWADI", "MAKSURA",
+    "TELEGRAPH", "ACCENT", "KAITHI", "KHAH", "KHAROSHTHI", "LIMBU", "MACRON", "MARCHEN", "NOON", "ON", "TAKRI", "CHA",
+    "INVERTED", "CENTRE", "KHA", "NOT", "NYA", "AHOM", "LI", "NANDINAGARI", "ORNAMENT", "ARABIAN", "HARPOON",
+    "HEXAGRAM", "ROTATED", "ANGLE", "EAST", "GUNJALA", "IN", "LAGAB", "KHOJKI", "MONOSPACE", "NKO", "OXIA", "SAMARITAN",
+    "VARIA", "COMMA", "OTTOMAN", "TAIL", "THA", "DOGRA", "GREATER-THAN", "LESS-THAN", "Q", "STAR", "TRIPLE", "NUN",
+    "TIFINAGH", "WANCHO", "HAU", "AEGEAN", "BREVE", "CIN", "INSCRIPTIONAL", "PAU", "ASH", "BATAK", "EN", "ETA", "GUNU",
+    "PAHLAVI", "PHAGS-PA", "PHASE-B", "AVESTAN", "CYPRIOT", "PHA", "VA", "WEST", "HITTING", "IOTA", "PHASE-F",
+    "ACROPHONIC", "ALBANIAN", "ANUSVARA", "CAUCASIAN", "DEGREES", "PERSIAN", "TEH", "CROSS", "FULL", "PI", "ROMAN",
+    "UNIFIED", "KAYAH", "MANICHAEAN", "ROHINGYA", "SEEN", "TTA", "DDA", "HANIFI", "KAF", "THAANA", "ZA", "CARIAN",
+    "DISC", "HEH", "LE", "LISU", "MOUTH", "OL", "TWENTY", "CHIKI", "DHA", "OO", "SHAVIAN", "UPSILON", "VEDIC",
+    "DIAMOND", "GHA", "OPERATOR", "PE", "PERISPOMENI", "TOP", "YEZIDI", "ASTERISK", "MTAVRULI", "PARENTHESIS",
+    "PHAISTOS", "SHAN", "SHE", "AIN", "BEH", "CARON", "NAGRI", "NNA", "SYLOTI", "BHA", "CLOSED", "MAHJONG", "OE",
+    "SHEEN", "THE", "ALI", "GALI", "MRO", "PERMIC", "DOTTED", "EE", "NEUTRAL", "ORKHON", "RETROFLEX", "TTHA", "WAW",
+    "DASH", "FA", "HE", "TENU", "VIRAMA", "WIDE-HEADED", "ALTERNATE", "ARCHAIC", "BASSA", "DDHA", "DESCENDER",
+    "ELBASAN", "MU", "NABATAEAN", "NO", "OSMANYA", "RR", "SSA", "SUBSCRIPT", "TAH", "YU", "CURVE", "MAHAJANI", "EIGHTH",
+    "EPSILON", "FEH", "MULTANI", "NINETY", "QUARTER", "REH", "SECTION", "VISARGA", "YPOGEGRAMMENI", "AN", "BOTTOM",
+    "CORNER", "HI", "INSTRUMENTAL", "POINTED", "REJANG", "TE", "VAH", "CURLY", "EQUALS", "FROM", "JHA", "LU2", "QAF",
+    "SIDE", "STRAIGHT", "ARABIC-INDIC", "FIFTY", "GLOTTAL", "LL", "NE", "NI", "SOMPENG", "SORA", "TACK", "CANDRABINDU",
+    "DUG", "HORN", "ME", "RAISED", "SAD", "SEVENTY", "STRELA", "AE", "INDICATOR", "PRESENTATION", "SHIN", "WAVE",
+    "AFFIX", "COLON", "CROSSING", "DAD", "DAY", "DINGBAT", "HIEROGLYPHIC", "IGI", "NU", "PALMYRENE", "SHELL", "VARIANT",
+    "YO", "ARAMAIC", "DIGRAPH", "END", "EZEN", "FINGERS", "HAND", "HAND-HINGE", "IMPERIAL", "RUMI", "TOTO", "UGARITIC",
+    "VERY", "YENISEI", "YUS", "BENT", "BUGINESE", "DANDA", "HEART", "MI", "OMICRON", "PARTHIAN", "QUOTATION", "THIRTY",
+    "TSA", "CEDILLA", "CONJOINED", "GAR", "KISIM5", "LOGICAL", "LYCIAN", "MANDAIC", "MOON", "OGHAM", "PALATAL",
+    "PHOENICIAN", "PSALTER", "QUESTION", "SAG", "TODO", "VESSEL", "VOCAL", "CHORASMIAN", "EPACT", "HEAD", "KNIGHT",
+    "PROSGEGRAMMENI", "RHO", "SLANTED", "SUPERSCRIPT", "UD", "AT", "CLOCK", "DAG", "FORTY", "GOTHIC", "HAND-FLAT", "HO",
+    "LLA", "LOOP", "LOOPED", "LYDIAN", "NEO", "NINDA2", "NOTE", "POINT", "URU", "BETWEEN", "BU", "CHI", "EXCLAMATION",
+    "EYES", "GHAIN", "HATRAN", "HOUR", "LAING", "LU", "REGIONAL", "RO", "SEPARATOR", "SHAFT", "SIGMA", "SO", "SUBSET",
+    "SUPERSET", "TORTOISE", "UYGHUR", "WE", "INTEGRAL", "KHAMTI", "KO", "MAKASAR", "NOTEHEAD", "NUKTA", "PHI", "QUAD",
+    "STRETCHED", "THETA", "TU", "UNDERBAR", "ATTIC", "CHE", "DAGESH", "EQUILATERAL", "GI", "INDEPENDENT", "KI",
+    "QUADRANT", "RIGHT-POINTING", "SMILING", "SOLIDUS", "THEH", "WO", "ALTERNATING", "DISH", "EL", "ELYMAIC", "OVERLAY",
+    "RU", "SI", "SIBE", "TAGALOG", "UE", "WORD", "ARM", "C-SIMPLIFIED", "CURL", "DE", "EXTENDED", "GAMMA", "GAN2",
+    "GISH", "KU", "LEAF", "MAI", "MAN", "MO", "PERSON", "SE", "SPACE", "SU", "TRIANGULAR", "WI", "ZE", "ZHA", "AB",
+    "ANTICLOCKWISE", "ATTACHED", "DOTLESS", "HANUNOO", "KE", "MANCHU", "MINUS", "REVERSE", "THO", "TIP", "ARC", "BUHID",
+    "CLAN", "CURVED", "DELTA", "DO", "HINGED", "INSULAR", "LEFT-POINTING", "LEG", "LO", "MAYAN", "NG", "QA", "RRA",
+    "UNION", "AB2", "ABBREVIATION", "ANNOTATION", "ARCHAION", "BAD", "BETA", "BI", "DAL", "DI", "DU", "ESH", "INSIDE",
+    "KUR", "MEM", "RED", "SIDEWAYS", "TI", "TONOS", "TWO-HEADED", "VULGAR", "BLACKFOOT", "COUNTING", "EM", "FILL",
+    "FLOOR", "FORWARD", "FTHORA", "GHE", "GURAGE", "HAND-ANGLE", "INTERSECTION", "KAPPA", "KAREN", "KING", "PAP", "PO",
+    "RE", "REST", "ROD", "SPOKED", "TAGBANWA", "TAU", "WALL", "AL", "ALEPH", "ARROWS", "BETH", "CEILING", "CIRCLES",
+    "DIALYTIKA", "GU", "GUD", "HAND-CIRCLE", "HEARTS", "IE", "MUSH", "N-ARY", "OBLIQUE", "PSI", "SAYISI", "SIXTY",
+    "SOUND", "TAW", "TONGUE", "UP-POINTING", "VE", "ALMOST", "AVAGRAHA", "CIM", "CLOCKWISE", "EARTH", "GIMEL",
+    "IOTIFIED", "KAPH", "KOMI", "MOVEMENT-DIAGONAL", "OUT", "QUEEN", "RI", "ROTATION", "SADHE", "SAMEKH", "SHAD",
+    "SHESHIG", "SLASH", "SPREAD", "SUN", "TAILED", "TAK4", "YE", "ZAIN", "ZHE", "BE", "BIG", "CANDRA", "DENTISTRY",
+    "EIGHTHS", "EIGHTY", "EMPTY", "EQUIVALENT", "ER", "HAND-CUP", "HETH", "IM", "KASKAL", "KOET", "LAGAR", "LAMEDH",
+    "LENGTH", "MGO", "NASKAPI", "OGONEK", "QUARTERS", "RISING", "ROC", "ROTATION-FLOORPLANE", "ROTATION-WALLPLANE",
+    "ROUNDED", "SHADE", "SHU", "THROUGH", "TSHA", "TWELVE", "U2", "XA", "XI", "YODH", "AS", "BIRGA", "BULLET", "CAN",
+    "CHECK", "CLUBS", "DIAMONDS", "FARSI", "FATHA", "GO", "HU", "HUMP", "KASRA", "LAMDA", "NOR", "NUNUZ", "NYI", "PWO",
+    "SARA", "SHADDA", "SOFT", "SPADES", "TONAL", "TSE", "WATER", "WRIST", "XIANGQI", "ZAH", "ZAYIN", "ANG", "BALLOT",
+    "BINDU", "CAT", "CROSSED", "DASHED", "DOWN-POINTING", "DZA", "ELEMENT", "ET", "ICHOS", "LOZENGE", "MARTYRIA",
+    "MINNAN", "MON", "MULTIPLE", "MULTIPLICATION", "OM", "OVERBAR", "PADA", "PALI", "POVYSHE", "PRECEDES", "PRODUCT",
+    "PU", "RESH", "ROUND", "RTAGS", "SHADOWED", "SHIM", "SUCCEEDS", "THIRD", "WOODS-CREE", "ZETA", "AH", "AY", "AYIN",
+    "BACK", "BALL", "BISHOP", "BO", "BY", "CO", "DESCRIPTION", "DOES", "E2", "ELEVEN", "ENG", "EZH", "FE", "FLAG",
+    "HANGZHOU", "HYPHEN", "JE", "KEHEH", "KHO", "KRYZHEM", "LAL", "LUM", "MEASURED", "MURDA", "NATTILIK", "NUBIAN",
+    "OCLOCK", "OJIBWAY", "PAWN", "PRIME", "ROOK", "SEMICOLON", "SHA3", "SHAR2", "TEDUNG", "TELEPHONE", "UNIT", "UR2",
+    "USH", "WIDE", "Y-CREE", "YANG", "YIG", "ZIGZAG", "ZO", "ZU", "BELT", "BESIDE", "CHO", "CLICK", "DAMMA", "ES", "FI",
+    "FIFTEEN", "FIRE", "FO", "HAA", "INVERSE", "JO", "KIEVAN", "KIRGHIZ", "KLYUCHEVAYA", "KRYUKOVAYA", "LAK-617", "LEK",
+    "MADDA", "MEN", "NOSE", "OCR", "PHO", "QUADRUPLE", "RAYS", "RIBBON", "SALTIRE", "SCHWA", "SHO", "SIMALUNGUN",
+    "SKAMEYTSA", "STATYA", "STEM", "TENS", "TETH", "TSHEG", "WAVY", "WIDTH", "WIND", "WU", "YERU", "ZI", "ALPAPRAANA",
+    "AM", "ASH2", "ATTAK", "BARRED", "BRACKETED", "BUT", "CARET", "CHINESE", "CLEF", "CLOUD", "CURRENCY", "DALETH",
+    "DOUBLE-LINE", "DYNAMIC", "DZ", "EF", "EH", "ESH2", "EYE", "FINGER", "FISH", "FLEX", "GAD", "GAF", "GE",
+    "HAND-HOOK", "HARD", "HORA", "KAK", "LAK-648", "LEFT-STEM", "LITH", "LUNATE", "MAHAAPRAANA", "MALE", "NORMAL",
+    "NOTCHED", "PAGE", "PARALLEL", "PREFIXED", "RDEL", "RECYCLING", "SAL", "SALT", "SEGMENTED", "SIMILAR", "SIXTEEN",
+    "SVARITA", "TAB", "THESPIAN", "TICK", "TONE-2", "TONE-5", "TRAVEL-WALLPLANE", "TREE", "TWELFTHS", "UNDER", "VO",
+    "VOICED", "WESTERN", "YOD", "APOSTROPHE", "ASTROLOGICAL", "BAMBOOS", "BARREE", "BUBBLE", "BUR", "CE", "CENTRED",
+    "CHARACTERS", "CHILLU", "CIEUC", "CONTAINING", "CONTAINS", "CROSSED-TAIL", "CRYPTOGRAMMIC", "DIGRAM", "EI",
+    "EIGHTEEN", "EMOJI", "ENVELOPE", "EU", "FILLER", "FIRST", "FRONT", "FU", "GAL", "GESH2", "HANDS", "HHA", "HORSE",
+    "IEUNG", "IMAGE", "ITERATION", "KAVYKA", "KEY", "LARGEST", "METRICAL", "MONOGRAM", "NEITHER", "NYO", "PEE", "PEH",
+    "PINWHEEL", "RECTANGLE", "REFORMED", "REPEAT", "RHA", "SANDHI", "SECOND", "SET", "SHU2", "SLOAN", "SUIT", "TEXT",
+    "THEN", "THIRDS", "TONE-3", "UM", "UN", "UR", "VI", "VINE", "YAT", "YIN", "ABKHASIAN", "AGOGI", "AIRPLANE",
+    "AMPERSAND", "ANO", "AWAY", "BACKHAND", "BEGIN", "BLUE", "BUD", "CAR", "CHIEUCH", "COMPRESSED", "CRESCENTS", "CUM",
+    "DIALECT-P", "DIE", "DIVISION", "DODEKATA", "DRAGON", "DZE", "ELLIPSIS", "ENDING", "ETH", "EXTENSION", "FIGURE",
+    "FISHHOOK", "FOURTEEN", "GOAL", "GREEN", "HAND-CLAW", "HAND-OVAL", "HIEUH", "HUB2", "ICE", "JAPANESE", "JI", "JOT",
+    "KHIEUKH", "KIYEOK", "LENTICULAR", "LHA", "LIMB", "LIPS", "LOCATION", "LOGOGRAM", "LONSUM", "MAHAPRANA", "MARKER",
+    "MFON", "MIEUM", "MOUNTAIN", "MOVEMENT", "NAGA", "NAME", "NIEUN", "NINETEEN", "NIZKO", "NJE", "NUNAVIK", "OPPOSING",
+    "OU", "OVERLINE", "PAIRED", "PHARYNGEAL", "PHIEUPH", "PIECE", "PIEUP", "PROLATIONE", "QOPH", "RIEUL", "RUPEE",
+    "SASAK", "SECANT", "SEVENTEEN", "SHEI", "SIMANSIS", "SIOS", "STAFF", "STATERS", "STICK", "SUBGROUP", "SUBUNIT",
+    "SUKUN", "SVETLAYA", "TEMPUS", "TH", "TH-CREE", "THAL", "THIEUTH", "THIRTEEN", "THORN", "THOUSANDS", "TIKEUT",
+    "TOWARDS", "TRIGRAM", "TUAREG", "TUG2", "TURNSTILE", "VEE", "VERTICALLY", "VRAKHIYA", "WOMAN", "ZAPYATAYA", "AD",
+    "ANGLED", "ARKTIKO", "BACKSLASH", "BAN2", "BBA", "BELL", "CHEST", "DAGGER", "DIATONIKI", "DIESIS", "DIGA", "DIM",
+    "DIPLI", "DOLLAR", "DUN3", "EAR", "ENCLOSING", "EYEBROWS", "FALLING", "FATHATAN", "FEE", "FITA", "FLAT", "FOLDER",
+    "GAN", "GI4", "GIR2", "GU2", "HAIR", "HAT", "HEEL", "JOINER", "JU", "KATAKANA-HIRAGANA", "KATO", "KET", "LUGAL",
+    "MALO", "MASH", "MEASURE", "MID", "MILLIONS", "MOUSE", "MOVEMENT-HINGE", "NASALIZED", "NGO", "ODD", "OPENING",
+    "ORE", "OUTLINED", "PLACE", "PLASTICS", "POWERS", "RAIN", "SEE", "SH", "SHARP", "SHIMA", "SHOE", "SHWE", "SPEAKER",
+    "SPEECH", "SPIRAL", "SURROUND", "TAA", "TALENTS", "TALLY", "TAM", "TAR", "TCHEH", "TEARDROP-SPOKED", "TEETH",
+    "TENSE", "TET", "THI", "TIR", "TONE-4", "TRAVEL-FLOORPLANE", "TSI", "VOS", "VU", "WITHIN", "WRINKLED", "YFESIS",
+    "-A", "AEN", "AIR", "AITON", "AK", "ANTIMONY", "APPROXIMATELY", "AV", "BABY", "BARLINE", "BEE", "BEND", "BET",
+    "BLACK-FEATHERED", "BOOK", "BOW", "BRIDGE", "BROKEN", "BRUSH", "BURU", "BUTTON", "CHEEKS", "CONTACT", "CONTROL",
+    "COPPER", "CORNERS", "CRESCENT", "CUPPED", "DEE", "DIFFERENTIAL", "DIGAMMA", "DIVIDER", "DOG", "DRUM", "DUB",
+    "DVOECHELNAYA", "EAT", "ECH", "EK", "ENY", "EPIGRAPHIC", "EQUIHOPPER", "ERIN2", "ERROR-BARRED", "EVEN", "EXTREMELY",
+    "FEMALE", "FLICK", "GANGIA", "GAP", "GGA", "GIR3", "GLASS", "GREAT", "GROMOPOVODNAYA", "HAL", "HAR", "HIP",
+    "HOLDING", "HOOKED", "HORI", "HOUSE", "IMPERFECTA", "INFINITY", "IOTATED", "IS", "IZHE", "IZHITSA", "JEE",
+    "JIHVAMULIYA", "KAI", "KAN", "KEN", "KHEI", "KHOKHLOM", "KISS", "KNIFE", "KOPPA", "KU3", "KUSHU2", "LAK-449",
+    "LEIMMA", "LLLA", "LOO", "LU3", "MBAA", "MUSH3", "MYA", "NAA", "NABLA", "NARROW", "NDA", "NET", "NHA", "NJI",
+    "NUMERATOR", "ORANGE", "OSOKA", "OTTAVA", "PALM", "PARTIAL", "PEAKS", "PEN", "PIRIG", "POSITION", "POWER", "RADI",
+    "RAE", "REPA", "RICE", "RUSSIAN", "SAMPI", "SAN", "SAR", "SCISSORS", "SHARU", "SHI", "SHID", "SHIR", "SINGLE-LINE",
+    "SIXTEENTH", "SPLIT", "SQUEEZE", "STILE", "SUBSTITUTION", "SUM", "SUNG", "SWASH", "TALL", "TATWEEL", "TEE", "THAN",
+    "THREE-D", "TIE", "TOO", "TROEZENIAN", "TTEH", "TUR", "UA", "UK", "UPADHMANIYA", "URUDA", "VAV", "VOLAPUK",
+    "VRACHY", "VYSOKO", "WEIGHT", "WIGGLY", "XE", "YAA", "YEE", "YN", "ZAPYATOY", "ADEG", "AFRICAN", "ALAYHE", "ALL",
+    "ALLAAHU", "ANUDATTA", "APLI", "AQ", "BAHAR2", "BAL", "BARS", "BBE", "BEEH", "BEHEH", "BLACK-LETTER", "BOARD",
+    "BREATHY", "BUILDING", "CASKET", "CHARIOT", "CHART", "CHRIVI", "CIRCULAR", "CLOSING", "CLUSTER-INITIAL",
+    "COMMERCIAL", "COW", "CUBED", "CUP", "CURVING", "DAMMATAN", "DHE", "DISK", "DKAR", "DOACHASHMEE", "DOCUMENT",
+    "DOUBLED", "DYEH", "DZHA", "EC", "ELAMITE", "EO", "ERA", "EYEGAZE-WALLPLANE", "EZ", "FACING", "FENCE", "FILE",
+    "FITZPATRICK", "FLATTENED", "FLOURISH", "FLOWER", "FRANKS", "FREE", "GAA", "GEE", "GEMINATION", "GESHU", "GHUNNA",
+    "GOLUBCHIK", "GORAZDO", "GORGON", "GRINNING", "GTER", "GUEH", "HALF-CIRCLE", "HENG", "HIE", "HOO", "HOT", "IDIM",
+    "IMPERFECTUM", "INPUT", "INTERROBANG", "IR", "IU", "JIL", "JJA", "JOINED", "KAD3", "KAL", "KANA", "KASRATAN",
+    "KENTIMATA", "KEYBOARD", "KOMBUVA", "KOO", "KOREAN", "KPA", "KSSA", "LAA", "LAME", "LEFT-HAND", "LEFT-TO-RIGHT",
+    "LIGHTNING", "MAP", "MARK-1", "MARK-2", "MBA", "MECHIK", "MEDAL", "MOBILE", "MONKEY", "MUCH", "MV", "MYSLITE",
+    "NAG", "NAR", "NASAL", "NDOLE", "NEPOSTOYANNAYA", "NESTED", "NGGA", "NGOEH", "NJEE", "NN", "NNNA", "NOTES", "NYEH",
+    "OA", "OH", "OI", "ONCOMING", "ORIGINAL", "OVAL", "OVERLAPPING", "OW", "PAD", "PARAGRAPH", "PARESTIGMENON", "PATH",
+    "PEHEH", "PENTAGON", "PER", "PERCENT", "PII", "PLUTO", "POINTER", "POLE", "PON", "POO", "PRIZNAK", "PWA", "QAR",
+    "QI", "QU", "RAA", "RANGE", "REE", "REPETITION", "RETURN", "RNOON", "ROCKET", "ROOT", "ROTUNDA", "SCREEN",
+    "SELECTOR", "SEMICIRCLE", "SEMIDIRECT", "SHOULDER", "SII", "SIMPLIFIED", "SMILE", "SOO", "START", "STRESS",
+    "SUBLIMATE", "SUMMATION", "SWIRL", "TALING", "TCHEHEH", "TEHEH", "THAA", "THEE", "THESEOS", "TINY", "TITLO",
+    "TONE-1", "TRAFFIC", "TRIDENT", "TTE", "TTEHEH", "TUM", "TURTLE", "TWE", "U-SHAPED", "UIGHUR", "UMBRELLA", "VEH",
+    "WAA", "WALK", "WAY", "WITHOUT", "WOO", "YAE", "YAJURVEDIC", "YELLOW", "YEN", "YER", "YOT", "ZEE", "ZEN", "AC",
+    "ACE", "AG", "ALAYHI", "ALTA", "AMAR", "AO", "APPROXIMATE", "AQUA", "ARROW-TAIL", "ARROWHEADS", "ARSEOS",
+    "AS-SALAAM", "BAA", "BAG", "BALAG", "BAN", "BANKNOTE", "BASE", "BEAMED", "BHE", "BIRD", "BONE", "BOTTLE", "BOWTIE",
+    "BULUG", "CAMERA", "CANCELLATION", "CANTILLATION", "CAP", "CENTRALIZATION", "CHAR", "CHECKER", "CHEE", "CHIN",
+    "CHROMA", "CHU", "CI", "CIL", "CLUSTER-FINAL", "COMPONENT", "CROP", "CUATRILLO", "CUSP", "DALET", "DANG", "DDDA",
+    "DEGREE", "DEL", "DELIMITER", "DEVICE", "DEZH", "DIASTOLI", "DIGORGON", "DIN", "DIRECTION", "DJE", "DLA", "DON",
+    "DOWNWARD", "DRAUGHTS", "DREAMY", "DYO", "DZELO", "EASTERN", "EGYPTOLOGICAL", "EIE", "EKFONITIKON", "ELECTRIC",
+    "ELLIPSE", "ENC", "ENT", "EP", "ERR", "EX", "EXTRA-HIGH", "EXTRA-LOW", "EYEGAZE-FLOORPLANE", "FAA", "FEATHER",
+    "FINGER-POST", "FIXED-FORM", "FLOPPY", "FLORETTE", "FOOD", "FOOT", "FORK", "FORMAT", "FOURTH", "FRAME", "FROWN",
+    "FROWNING", "GABA", "GBE", "GHAN", "GLOBE", "GOLD", "GRASS", "GROMNAYA", "GROMOKRYZHEVAYA", "GUR", "HAE", "HAMMER",
+    "HAND-CURLICUE", "HEADED", "HEAVEN", "HEE", "HELMET", "HOE", "HOURGLASS", "HP", "HV", "HYPHEN-MINUS", "IA",
+    "IDENTICAL", "IMIN", "INSERT", "INTEGRATION", "IRON", "ISOLATE", "ISOSCELES", "J-SIMPLIFIED", "JACK", "JHAN",
+    "JOIN", "JOKER", "KAA", "KANG", "KAPA", "KENTIMA", "KHAR", "KHI", "KID", "KISSING", "KK", "KLASMA", "KM", "KNUCKLE",
+    "KPO", "KRYZH", "KSI", "KUL", "KUT", "KWAA", "KWE", "KWI", "KYEE", "LAI", "LAMED", "LAS", "LEE", "LEFT-FACING",
+    "LENGA", "LENGTHENER", "LEZH", "LIP", "LJE", "LOCK", "LONGA", "LOQ", "LOTUS", "LOW-FALLING", "MAILBOX", "MARBUTA",
+    "MBE", "MBEE", "MCHU", "MEAT", "MEMBER", "MERCURY", "MIDDLE-WELSH", "MIM", "MIN", "MM", "MONOCULAR", "MUG", "MUSIC",
+    "MWA", "MWI", "NDAA", "NDE", "NDU", "NGAA", "NGI", "NIEUN-CIEUC", "NIEUN-HIEUH", "NIGHT", "NIKOLSBURG", "NOW",
+    "NTAP", "NTEUM", "NWA", "NYAM", "NYIS", "OBOLS", "OHM", "OIL", "OK", "OOU", "OT", "OX", "PAA", "PALAUNG", "PAPER",
+    "PAR", "PARENTHESES", "PATAH", "PEDESTAL", "PENCIL", "PENTAGRAM", "PERFECTA", "PHAR", "PHONE", "PIEUP-SIOS", "PIG",
+    "PLA", "POETRY", "POLICE", "POSTAL", "POT", "POUND", "POVODNAYA", "PROSTAYA", "PWI", "QAMATS", "QE", "QO", "QUILL",
+    "QUILT", "RAD", "RAFE", "RAILWAY", "RAM", "RAT", "RECEIVER", "REGULUS", "RELATION", "REN", "RIEUL-HIEUH",
+    "RIEUL-KIYEOK", "RIEUL-MIEUM", "RIEUL-PIEUP", "RIEUL-SIOS", "RIGHT-FACING", "RIGHT-HAND", "RIGHT-SHADOWED",
+    "RIGHT-TO-LEFT", "RII", "RUB", "RUDIMENTA", "RUM", "SAA", "SANYAKA", "SATANGA", "SCAN", "SEBATBEIT", "SEQUENTIAL",
+    "SERIFS", "SGAW", "SHAKING", "SHEE", "SHHA", "SHII", "SHITA", "SHOGI", "SHORTHAND", "SHORTS", "SIG4", "SILHOUETTE",
+    "SIN", "SIXTEENTHS", "SKEWED", "SLIGHTLY", "SLOZHITIE", "SNAKE", "SOUTH-SLAVEY", "SPIRIT", "SQUARES", "SQUIGGLE",
+    "SS", "SSANGCIEUC", "SSANGKIYEOK", "SSANGPIEUP", "SSANGSIOS", "SSANGTIKEUT", "SUKU", "SUR", "SUU", "SVASTI",
+    "SWEAT", "TAN", "TESH", "THIN", "THUMBS", "TIGER", "TIKHAYA", "TILTING", "TOGETHER", "TONE-6", "TONE-8", "TOOTH",
+    "TOPBAR", "TRESVETLAYA", "TROMIKON", "TS", "TSO", "TSU", "TTHO", "TURN", "TWENTY-FIVE", "TYPE", "UC", "UDATTA",
+    "UI", "ULU", "UMUM", "US", "VANE", "VIN", "WASLA", "WEE", "WHEEL", "WINE", "WOMANS", "WYNN", "XAN", "XYEEM", "YAH",
+    "YERI", "YIDDISH", "YOO", "YOQ", "YUT", "YYA", "ZAL", "ZATA", "ZHAR", "ZHEE", "ZZA", "-KHYIL", "A2", "AELA-PILLA",
+    "ALIF", "ALLO", "ALTERNATIVE", "ANGER", "ANJI", "ANSHE", "APOSTROFOS", "AR", "ARISTERA", "AROUND", "ASHGAB",
+    "ASSYRIAN", "AW", "AXE", "AYB", "AZU", "BACK-TILTED", "BACKSLANTED", "BALLOON", "BALLOON-SPOKED", "BAMBOO", "BANK",
+    "BAT", "BATH", "BAYANNA", "BEAVER", "BEHIND", "BEI", "BEN", "BILABIAL", "BLACKLETTER", "BOLT", "BOWL", "BRANCH",
+    "BREATH", "BRICK", "BROWN", "BUBBLES", "BUKY", "BUON", "BUS", "BZHI", "CAA", "CAKE", "CALENDAR", "CALL", "CARIK",
+    "CASTLE", "CCHE", "CHASHKA", "CHICK", "CHILD", "CHRISTMAS", "CHROA", "CHRONON", "CLIFF", "CLOSE", "CLOTH",
+    "CLOTHES", "CLUB", "CM", "COLD", "COMPLETION", "COMPOSITION", "COMPUTER", "CONCAVE-SIDED", "CONSTANT",
+    "CONSTRUCTION", "CONTAIN", "CONTOUR", "COO", "COUNCIL", "COVER", "COVERING", "CREDIT", "CROCUS", "CRYING", "CU",
+    "CUBE", "CURRENT", "CUT", "CWA", "CWAA", "CWI", "DAHAL", "DANTAJA", "DAP", "DAYANNA", "DDAHAL", "DDAL", "DDAYANNA",
+    "DDO", "DECIMAL", "DEER", "DENE", "DENTAL", "DEPARTING", "DESCENDING", "DIM2", "DIRECT", "DIVIDE", "DIVIDED",
+    "DJERV", "DJERVI", "DM", "DOBRO", "DRACHMA", "DRY", "DUL", "DUN", "DWE", "EA", "EB", "ELEPHANT", "ENCLOSURE", "ENN",
+    "ENTRY", "EPIDAUREAN", "ETERNITY", "EV", "EW", "EXO", "EYELASHES", "FACTOR", "FANEROSIS", "FAX", "FEED", "FENG",
+    "FERMATA", "FIFTH", "FIFTHS", "FINGERED", "FIST", "FLEURON", "FLORAL", "FLY", "FLYING", "FOM", "FOO", "FOREHEAD",
+    "FORMEE", "FORTY-FIVE", "FRITU", "FROG", "FRONT-TILTED", "GATHERING", "GAYANNA", "GAYANUKITTA", "GBA", "GBU",
+    "GEAR", "GERESH", "GESHTIN", "GGE", "GHHA", "GHOST", "GIM", "GJE", "GLAGOLI", "GRACE", "GRASP", "GSUM", "GUM",
+    "HALANTA", "HARKLEAN", "HATAF", "HEADSTROKE", "HERMIONIAN", "HERU", "HEXAGON", "HLI", "HNA", "HOLAM", "HON",
+    "HUMAN", "HUNDREDS", "HWE", "IB", "IC", "ICON", "IH", "INCREASE", "INFORMATION", "ING", "INI", "INSERTION",
+    "INTERLINEAR", "INVISIBLE", "IO", "IQ", "ISH", "ISON", "IT", "IY", "JAYANNA", "JEGOGAN", "JEH", "JONA", "JOY",
+    "KA2", "KAD5", "KAKO", "KAPYEOUNMIEUM", "KAPYEOUNPHIEUPH", "KAPYEOUNPIEUP", "KARO", "KATHAKA", "KAY", "KEE", "KEH",
+    "KETTI", "KHE", "KHUEN", "KIN", "KIYEOK-SIOS", "KKA", "KNUCKLES", "KOI", "KORONIS", "KRATIMA", "KUOP", "KW", "KWA",
+    "KXA", "KYA", "LAAM", "LAKH", "LAP", "LAST", "LAZY", "LEADER", "LEATHER", "LEERAEWA", "LEFT-SHADED", "LET",
+    "LETTERS", "LH", "LIMMU", "LINES", "LISH", "LJUDIJE", "LOVE", "LUH", "LUL", "LWA", "LY", "MAA", "MACHINE", "MAEM",
+    "MAEMBA", "MANDAILING", "MAPIQ", "MASK", "MB", "MBI", "MBIT", "MBO", "MBOO", "MBU", "MEDIEVAL", "MEE", "MEEEE",
+    "MEGA", "MES", "MEUT", "MID-LEVEL", "MIEUM-PIEUP", "MIEUM-SIOS", "MILITARY", "MINIMA", "MIT", "MNAS", "MONOGRAPH",
+    "MONTH", "MOO", "MOOD", "MOUND", "MRACHNAYA", "MULTIMAP", "MULTISET", "MUOY", "MUURDHAJA", "MWAA", "MWE", "N-CREE",
+    "NAH", "NASALIZATION", "NASHI", "NATURAL", "NDAP", "NDEE", "NDI", "NDO", "NEE", "NEN", "NEWLINE", "NGGE", "NGGEN",
+    "NGGO", "NGGOO", "NGGU", "NGOM", "NIEUN-SIOS", "NIEUN-TIKEUT", "NIM", "NIN", "NJAEM", "NJU", "NO-BREAK", "NOO",
+    "NRA", "NSHA", "NSHUT", "NTEE", "NUNG", "NV", "NWAA", "NYE", "NYET", "NYU", "NZA", "OFFICE", "OLDER", "ONU", "OP",
+    "OPEN-HEADED", "OPPOSITION", "OQ", "OUTER", "OVERLAID", "OVERLAP", "OXEIA", "OY", "PAN", "PANSIOS", "PARAGRAPHOS",
+    "PARAKALESMA", "PARAKLITIKI", "PART", "PARTY", "PAW", "PEACE", "PEDAL", "PEPET", "PERFECTUM", "PERPENDICULAR",
+    "PEUX", "PHE", "PICTURE", "PIEUP-CIEUC", "PIEUP-SIOS-TIKEUT", "PIEUP-TIKEUT", "PING", "PIWR", "PLACEHOLDER",
+    "PODCHASHIE", "POKOJI", "POLISH", "POMMEE", "POP", "POST", "POUTING", "PRAM", "PRAM-BEI", "PRAM-BUON", "PRAM-MUOY",
+    "PRAM-PII", "PREGNANT", "PRISHTHAMATRA", "PTHAHA", "PUAE", "PURPLE", "PUSHPIN", "PUT", "PWAA", "PWE", "QAA", "QAAF",
+    "QOF", "QOO", "QUO", "QUU", "RACING", "RAP", "RATHA", "REPEATED", "REUX", "RIEUL-PHIEUPH", "RIEUL-THIEUTH",
+    "RIEUL-TIKEUT", "RIGHT-SHADED", "RISH", "RITSI", "ROCK", "ROG", "ROSETTE", "RREH", "RUNNING", "SAFETY", "SAM",
+    "SAT", "SAW", "SAYANNA", "SCHEMA", "SCHOOL", "SEAL", "SEGMENT", "SEGOL", "SEMI-VOICED", "SEMIBREVIS",
+    "SEMICIRCULAR", "SEMIMINIMA", "SEUX", "SHADED", "SHCHA", "SHEEP", "SHESH", "SHIELD", "SHIP", "SHOO", "SHOQ", "SHTA",
+    "SHWA", "SILK", "SIMA", "SIOS-CIEUC", "SIOS-KIYEOK", "SIOS-PIEUP", "SIOS-TIKEUT", "SIXTH", "SIXTY-FOURTH",
+    "SKLIRON", "SKULL", "SLEEPING", "SLOVO", "SNOUT", "SNOW", "SNOWFLAKE", "SNOWMAN", "SOT", "SOURCE", "SPACING",
+    "SPHERICAL", "SPOON", "SSANGIEUNG", "SSANGNIEUN", "SSI", "SSO", "SSU", "ST", "STEP", "STIGMA", "STOCK", "STONE",
+    "STOPITSA", "STRANNO", "STRATUM", "STRIKE", "STROKES", "STUCK-OUT", "SUA", "SUBLINEAR", "SULFUR", "SUPRALINEAR",
+    "SURFACE", "SUSPENSION", "SV", "SWA", "SWAA", "SYMBOLS", "SYNAGMA", "TAALUJA", "TABLE", "TAE", "TARGET", "TAV",
+    "TEARS", "TENT", "TENTH", "TESSERA", "TETARTOS", "THII", "THIRTY-FIVE", "THIRTY-SECOND", "THOO", "THOUGHT",
+    "THREAD", "THU", "THUNDER", "THWA", "THWAA", "TIGHT", "TIL", "TIME", "TLA", "TLE", "TLHA", "TLI", "TLO", "TLU",
+    "TONE-7", "TOP-LIGHTED", "TOUCH", "TRA", "TRAIN", "TRANSPOSITION", "TREND", "TRUCK", "TRUE", "TSADI", "TSATA", "TT",
+    "TTHAA", "TTO", "TVRIDO", "TWA", "TWAA", "TWENTY-TWO", "TWO-CIRCLE", "UH", "UKRAINIAN", "UKU", "UPTURN", "UUE",
+    "VAREIA", "VEDE", "VERSE", "VEW", "VY", "WAE", "WAU", "WAVES", "WAVING", "WEO", "WHEAT", "WHEELCHAIR", "WHOLE",
+    "WON", "WOOD", "WORK", "WRINKLES", "WUE", "XEH", "XW", "YAGH", "YAJ", "YAK", "YATI", "YAZH", "YEO", "YEORINHIEUH",
+    "YESIEUNG", "YESTU", "YIT", "YIWN", "YUQ", "YWA", "YWAA", "YY", "ZEMLJA", "ZHI", "ZHIVETE", "ZHO", "ZHU", "ZQAPHA",
+    "ZU5", "-DZUD", "-UM", "A001", "A002", "A003", "A004", "A005", "A006", "A007", "A008", "A009", "A010", "A011",
+    "A012", "A013", "A014", "A015", "A016", "A017", "A018", "A019", "A020", "A021", "A022", "A023", "A024", "A025",
+    "A026", "A027", "A028", "A029", "A030", "A031", "A032", "A033", "A034", "A035", "A036", "A037", "A038", "A039",
+    "A040", "A041", "A042", "A043", "A044", "A045", "A045A", "A046", "A047", "A048", "A049", "A050", "A051", "A052",
+    "A053", "A054", "A055", "A056", "A057", "A058", "A059", "A060", "A061", "A062", "A063", "A064", "A065", "A066",
+    "A067", "A068", "A069", "A070", "A301", "A302", "A303", "A304", "A305", "A306", "A307", "A308", "A309A", "A310",
+    "A311", "A312", "A314", "A315", "A316", "A317", "A318", "A319", "A320", "A321", "A322", "A323", "A324", "A325",
+    "A326", "A327", "A328", "A329", "A330", "A331", "A333", "A334", "A335", "A336", "A337", "A338", "A339", "A340",
+    "A341", "A342", "A343", "A344", "A345", "A346", "A347", "A348", "A349", "A350", "A351", "A352", "A353", "A354",
+    "A355", "A356", "A357", "A358", "A359", "A360", "A361", "A362", "A363", "A364", "A365", "A366", "A367", "A368",
+    "A369", "A370", "A371", "A501", "A502", "A503", "A504", "A505", "A506", "A508", "A509", "A510", "A511", "A512",
+    "A513", "A515", "A516", "A520", "A521", "A523", "A524", "A525", "A526", "A527", "A528", "A529", "A530", "AAI",
+    "AAN", "AAY", "ACADEMY", "ACCOUNT", "ACKNOWLEDGE", "ACTIVATE", "ACTUALLY", "ADULT", "AEB", "AEDA-PILLA", "AEE",
+    "AEG", "AEK", "AESC", "AET", "AEY", "AKARA", "AKHMIMIC", "ALAPH", "ALEMBIC", "ALEUT", "ALFA", "ALIEN", "ALLAAH",
+    "ALLI", "ALLIANCE", "ALVEOLAR", "AMB", "ANCHOR", "ANCORA", "ANGLICANA", "ANTARGOMUKHA", "ANTENNA", "ANTIMONIATE",
+    "ANTIRESTRICTION", "AP", "APESO", "APLOUN", "APODERMA", "APOSTROFOI", "APPLE", "ARAD", "ARAEA", "ARCH",
+    "ARDHAVISARGA", "ARGI", "ARGOSYNTHETON", "ARPEGGIATO", "ARTS", "ASCENDING", "ASHES", "ASPIRATION", "ASYMPTOTICALLY",
+    "ATHAPASCAN", "ATIU", "AUE", "AUTOMOBILE", "AWX", "AX", "AYAH", "AYN", "AZ", "B001", "B002", "B003", "B004", "B005",
+    "B006", "B007", "B008", "B009", "BADGER", "BALUDA", "BASELINE", "BASHKIR", "BATHTUB", "BATTERY", "BBI", "BBO",
+    "BBU", "BBUT", "BCAD", "BEAM", "BEAR", "BEAT", "BEER", "BEETLE", "BENZENE", "BERBER", "BEVERAGE", "BHETH", "BHO",
+    "BICYCLIST", "BINARY", "BINDI", "BINDING", "BINOCULAR", "BIT", "BITING", "BLADE", "BLANK", "BLENDED", "BLINK",
+    "BLOCK-2", "BLOCK-3", "BLOCK-4", "BLOCK-5", "BLOCK-6", "BLOCK-7", "BLOOD", "BLOSSOM", "BLOWING", "BOAR", "BOAT",
+    "BODY", "BOHAIRIC", "BOO", "BOOKMARK", "BOOMERANG", "BOOT", "BOTH", "BOUQUET", "BRA", "BRDA", "BREAD", "BREVIS",
+    "BRIGHTNESS", "BROAD", "BUILDINGS", "BULLHORN", "BWA", "BWEE", "BWI", "BYELORUSSIAN-UKRAINIAN", "BZUNG", "CADUCEUS",
+    "CAKRA", "CALYA", "CAMEL", "CANCEL", "CANNON", "CARPENTRY", "CART", "CAUDATE", "CAULDRON", "CAYANNA", "CAYN", "CC",
+    "CD", "CECAK", "CEE", "CENT", "CENTRELINE", "CER-WA", "CH", "CHAA", "CHAIR", "CHAT", "CHEH", "CHELYUSTKA",
+    "CHEVRON", "CHOREVMA", "CHRONOU", "CHURCH", "CIP", "CIRCLING", "CITY", "CITYSCAPE", "CLINKING", "CLUSTER", "COAT",
+    "CON", "CONGRATULATION", "CONJOINING", "CONSECUTIVE", "CONVERGING", "COOKIE", "COPRODUCT", "COPYRIGHT", "CREAM",
+    "CRICKET", "CROSSBAR", "CROSSBONES", "CROSSHATCH", "CROWN", "CULTIVATION", "CUOP", "CURLICUE", "CWE", "CWII", "CWO",
+    "CWOO", "CY", "CYA", "CYP", "CYT", "DAA", "DAALI", "DALATH", "DALDA", "DAMP", "DAP-BEI", "DAP-BUON", "DAP-MUOY",
+    "DAP-PII", "DAP-PRAM", "DAR", "DARA3", "DARK", "DARKENING", "DAT", "DATE", "DB", "DCHE", "DDAA", "DDDHA", "DDE",
+    "DDHAA", "DDHO", "DDI", "DDU", "DDUR", "DEATH", "DECORATION", "DECREASE", "DEI", "DELETE", "DEMESTVENNY",
+    "DENOMINATOR", "DEPARTURE", "DESERT", "DESKTOP", "DEXIA", "DEYTEROS", "DH", "DHO", "DIB", "DIFONIAS", "DIGRAMMOS",
+    "DIMINUTION-1", "DIRECTIONAL", "DIRECTLY", "DISAPPOINTED", "DISIMOU", "DIVINATION", "DIZZY", "DJA", "DOI", "DOLLS",
+    "DONG", "DOO", "DOOR", "DOUBLE-LINED", "DOVE", "DRACHMAS", "DRAM", "DRESS", "DRINK", "DRIVE", "DROP-SHADOWED",
+    "DROPLET", "DUNG", "DV", "DVOECHELNOPOVODNAYA", "DZEE", "DZHE", "DZI", "DZJE", "DZO", "DZU", "DZWE", "DZZE",
+    "DZZHE", "EAGLE", "EARS", "EARTHLY", "ECS", "ED", "EG", "EGG", "EGY", "EHCHA", "EHKA", "EHPA", "EHTA", "EHTSA",
+    "EIGHTIETHS", "EIN", "EJ", "ELIFI", "ELY", "EMBEDDING", "EMP", "EMPHASIS", "ENCLOSURES", "ENGINE", "ENT-SHAPED",
+    "ENTER", "ENTERPRISE", "EPENTHETIC", "ERASE", "EREN", "ERIS", "ESASA", "ESCAPE", "ESHE3", "ESZ", "ETERON", "ETY",
+    "EURO", "EUROPEAN", "EWE", "EYN", "EZS", "FAMILY", "FAN", "FATHER", "FEI", "FEMININE", "FIELD", "FILM", "FINANCIAL",
+    "FLAME", "FLATBREAD", "FLEXUS", "FLIP", "FLUTE", "FLUTTERING", "FOLLOWING", "FONT", "FOOTBALL", "FOOTNOTE",
+    "FORKED", "FORTIETH", "FOUNTAIN", "FOX", "FRENCH", "FRETBOARD", "FUE", "FUNCTION", "FUR", "FUSA", "FWA", "FWAA",
+    "FWEE", "FWI", "GAETTA-PILLA", "GAH", "GAMAL", "GAME", "GAPPED", "GARSHUNI", "GATE", "GAY", "GBEE", "GBI", "GBO",
+    "GBOO", "GCIG", "GENERAL", "GENIKI", "GEOMETRICALLY", "GEP", "GERSHAYIM", "GESTURE", "GGI", "GGO", "GGOP", "GGU",
+    "GGUO", "GHAA", "GHAD", "GHEUAE", "GHO", "GIBBOUS", "GLISSANDO", "GNYIS", "GORGI", "GORTHMIKON", "GOT", "GRAM",
+    "GREATER", "GREGORIAN", "GROUND", "GROUP", "GRU", "GUARD", "GUG", "GUL", "GUR7", "GV", "GWA", "GWE", "GWEE", "GWI",
+    "GYAS", "GYON", "HAN", "HANDLE", "HASANTA", "HATE", "HAVE", "HBASA", "HEADSTONE", "HEART-SHAPED", "HEI", "HEN",
+    "HET", "HETA", "HG", "HHAA", "HHWA", "HIGH-REVERSED-9", "HIGH-SPEED", "HII", "HIN", "HINGE", "HIRIQ", "HIT", "HIYO",
+    "HLA", "HMO", "HOCKEY", "HOLE", "HOLLOW", "HOLO", "HOMOTHETIC", "HORNS", "HORR", "HOTEL", "HTA", "HUGGING", "HUN",
+    "HWAIR", "HXIT", "HXOP", "HXUO", "HYA", "HYPHENATION", "HZ", "IAN", "IAUDA", "ICHIMATOS", "IDENTIFICATION",
+    "IDEOGRAPH-4E09", "IDEOGRAPH-4E8C", "IDEOGRAPH-6253", "IEUNG-KIYEOK", "IG", "IJ", "IJE", "IKARA", "IL", "ILIMMU",
+    "INHERENT", "INHIBIT", "INNER", "INTERIOR", "INTERLACED", "INTERPOLATION", "INTERSECTING", "IS-PILLA", "ISSHAR",
+    "IX", "IYEK", "JAA", "JADE", "JAR", "JAW", "JHEH", "JIIM", "JJI", "JJIE", "JJO", "JJU", "JJUT", "JJY", "JNYA",
+    "JOO", "JWA", "KAAF", "KAB", "KABA", "KAD2", "KAH", "KAP", "KAPYEOUNRIEUL", "KAPYEOUNSSANGPIEUP", "KASHMIRI",
+    "KAYANNA", "KAZAKH", "KEEPING", "KEMPLI", "KEMPUL", "KESH2", "KEUM", "KEUX", "KEYCAP", "KG", "KHAA", "KHAI",
+    "KHAKASSIAN", "KHANG", "KHAPH", "KHHA", "KHHO", "KHMU", "KINNA", "KIP", "KIT", "KJE", "KLYUCH",
+    "KLYUCHENEPOSTOYANNAYA", "KNIGHT-BISHOP", "KNIGHT-QUEEN", "KNIGHT-ROOK", "KOK", "KON", "KONTEVMA", "KORANIC",
+    "KOTO", "KP", "KPE", "KPEE", "KPI", "KPOO", "KPU", "KRYUK", "KU4", "KUN", "KVA", "KWEE", "KWII", "KWO", "KWOO",
+    "L-SHAPED", "LABIAL", "LABOR", "LAE", "LAK-050", "LAK-079", "LAK-081", "LAKE", "LAMP", "LAN", "LANE", "LANES",
+    "LANTANG", "LARGER", "LATERAL", "LATINATE", "LAULA", "LAW", "LAYANNA", "LCE", "LEANING", "LEEEE", "LEGETOS",
+    "LELET", "LENIS", "LESH", "LESSER", "LEU", "LEVEL", "LHAA", "LHI", "LHO", "LID", "LIE", "LING", "LINK", "LIQUID",
+    "LIRA", "LITTER", "LIWN", "LJ", "LOCOMOTIVE", "LOGOTYPE", "LOM", "LOOT", "LOW-9", "LOWERED", "LS", "LUGGAGE", "LV",
+    "LWAA", "LWE", "LWI", "LWII", "LWO", "LWOO", "LYR", "LZ", "M001", "M002", "M003", "M004", "M005", "M006", "M007",
+    "M008", "M009", "M010", "M011", "M012", "M013", "M014", "M015", "M016", "M017", "M018", "M019", "M020", "M021",
+    "M022", "M023", "M024", "M025", "M026", "M027", "M028", "M029", "M030", "M031", "M032", "M033", "M034", "M035",
+    "M036", "M037", "M038", "M039", "M040", "M041", "M042", "M043", "M044", "MADDAH", "MAE", "MAESI", "MAGNIFYING",
+    "MAH", "MALAKON", "MANDARIN", "MAQ", "MAR", "MARK-3", "MASH2", "MAY", "MBANYI", "MBEN", "MBEUM", "MC", "MCHAN",
+    "MDUN", "MECHANICAL", "MEEJ", "MEET", "MELON", "MEM-QOPH", "MERGE", "MERKHA", "MESH", "MESO", "METAL", "MEUN",
+    "MGBA", "MHA", "MICROPHONE", "MIDLINE", "MIEE", "MIEUM-KIYEOK", "MIEUM-PANSIOS", "MIG", "MIIM", "MILLE", "MIRROR",
+    "MLA", "MODIFIER-2", "MODIFIER-3", "MODIFIER-4", "MODIFIER-5", "MODIFIER-6", "MONEY", "MONOFONIAS", "MONOGRAMMOS",
+    "MOP", "MORTAR", "MOTHER", "MOTOR", "MOVE", "MPA", "MUAE", "MUAN", "MUCAAD", "MVOP", "MW", "MWEE", "MWII", "MWO",
+    "MWOO", "MY", "NA-2", "NA2", "NAASIKYAYA", "NAE", "NAKAARA", "NAM", "NAM2", "NANA", "NAQ", "NATIONAL", "NAYANNA",
+    "NBIE", "NDAM", "NDOO", "NE-2", "NECK", "NEGATED", "NENOE", "NEPTUNE", "NEQUDAA", "NEST", "NEWSPAPER", "NGAS",
+    "NGE", "NGEN", "NGGAAM", "NGGEE", "NGGEUAET", "NGGI", "NGGUOQ", "NGHA", "NGKA", "NGKUE", "NGKWAEN", "NGON", "NGOP",
+    "NGOU", "NIB", "NIEUN-KIYEOK", "NIEUN-PANSIOS", "NII", "NJ", "NJA", "NJAEMLI", "NJAM", "NJEUX", "NJO", "NJOO",
+    "NJUAE", "NJUEQ", "NKAARAE", "NODE", "NORTHERN", "NOTCH", "NOTEBOOK", "NOZHKA", "NSHIEE", "NSIEE", "NTAA", "NTOG",
+    "NTUU", "NU11", "NUAE", "NUENG", "NULL", "NUT", "NUTILLU", "NWE", "NWI", "NWII", "NWO", "NWOO", "NY", "NYAA",
+    "NYEE", "NYHA", "NYIP", "NYIT", "NYOP", "NZUP", "OAY", "OCTAGON", "OEE", "OEK", "OIN", "OKARA", "OKTO", "OLIGON",
+    "OLIVE", "OMET", "OMISSION", "ONE-HUNDRED-AND-SIXTIETH", "ONG", "ONN", "OOE", "OPEN-CIRCUIT-OUTPUT", "OPEN-O",
+    "OPTICAL", "ORDINAL", "ORNATE", "OS", "OTU", "OUNCE", "OV", "OVERLONG", "OVERRIDE", "OVERSTRUCK", "OYRANISMA",
+    "PAA-PILLA", "PAAM", "PAGES", "PAKPAK", "PALOCHKA", "PAMADA", "PAMPHYLIAN", "PAMUDPOD", "PANGOLAT", "PANTI", "PARA",
+    "PARALLELOGRAM", "PARAPHRASE", "PARTNERSHIP", "PASANGAN", "PATTY", "PAYANNA", "PAYEROK", "PEDESTRIAN", "PELASTON",
+    "PENNANT", "PENTASEME", "PEOPLE", "PEPPER", "PERCUSSIVE", "PEREVODKA", "PERNIN", "PERSONAL", "PESH2", "PESO",
+    "PETALLED", "PHAA", "PHIEUPH-PIEUP", "PHILIPPINE", "PHRASE", "PHUR", "PIASMA", "PICK", "PIE", "PIEUP-CHIEUCH",
+    "PIEUP-HIEUH", "PIEUP-KIYEOK", "PIEUP-PHIEUPH", "PIEUP-SIOS-KIYEOK", "PIEUP-THIEUTH", "PILCROW", "PIN", "PIP",
+    "PIPAEMBA", "PIPAEMGBIEE", "PISELEH", "PIT", "PITCHFORK", "PLAGIOS", "PLANCK", "PLANE", "PLOPHU", "PLUTA",
+    "PNEUMATA", "POLI", "POLLU", "PORRECTUS", "POSSESSION", "POTATO", "PRECEDE", "PRECEDING", "PREPONDERANCE", "PRINT",
+    "PRINTER", "PROLONGED", "PROPELLER", "PROPORTION", "PROTOS", "PSIFISTON", "PUE", "PUP", "PWEE", "PWII", "PWOO",
+    "PYT", "QAI", "QATAN", "QII", "QITSA", "QOT", "QUA", "QUE", "QUI", "QUINDICESIMA", "QUOTE", "QUV", "QWE", "QWEE",
+    "QWI", "R-CREE", "RA-2", "RABBIT", "RACQUET", "RADIO", "RAISING", "RAMS", "RANA", "RAY", "RBASA", "RDO", "REACH",
+    "READING", "RECORD", "RECTANGULAR", "RECTILINEAR", "REDUPLICATION", "RELAXED", "RELIEVED", "REPLACEMENT",
+    "RERENGGAN", "RESOURCE", "RESPONSE", "RESTRICTED", "REVOLVING", "RGYA", "RGYAN", "RGYINGS", "RIEE",
+    "RIEUL-KAPYEOUNPIEUP", "RIEUL-KHIEUKH", "RIEUL-KIYEOK-SIOS", "RIEUL-NIEUN", "RIEUL-PANSIOS", "RIEUL-PIEUP-SIOS",
+    "RIEUL-SSANGKIYEOK", "RIEUL-YEORINHIEUH", "RIKRIK", "RINGS", "RIPPLE", "RJE", "RNAM", "RNYING", "ROLLER", "ROLLING",
+    "ROMANIAN", "ROO", "ROTATIONS", "RRE", "RRO", "RULER", "RUMAI", "RWA", "RWAA", "RY", "S-SHAPED", "SA-2", "SADE",
+    "SAFHA", "SAH", "SALLA", "SALLALLAHOU", "SALTILLO", "SAMBA", "SANDAL", "SANSKRIT", "SAP", "SARI", "SATELLITE",
+    "SAY", "SCANDICUS", "SCOOTER", "SCOTS", "SEGNO", "SEH", "SEISMA", "SELF", "SEMISOFT", "SEMIVOWEL", "SEMKATH",
+    "SERIF", "SESAME", "SEXTULA", "SGAB", "SHA6", "SHAA", "SHANG", "SHAPES", "SHAPING", "SHAT", "SHELF", "SHET",
+    "SHEUX", "SHIFT", "SHIQ", "SHOG", "SHOP", "SHOPPING", "SHOY", "SHRI", "SHRIMP", "SHTAPIC", "SHUR", "SHWAA", "SHWI",
+    "SHWII", "SHWO", "SHWOO", "SHY", "SIG", "SIGMOID", "SIGNS", "SIK2", "SILA3", "SIMULTANEOUS", "SINDHI", "SINNYIIYHE",
+    "SIOS-CHIEUCH", "SIOS-HIEUH", "SIOS-MIEUM", "SIOS-NIEUN", "SIOS-RIEUL", "SIOS-THIEUTH", "SIXTHS", "SIZE", "SJE",
+    "SKATE", "SKI", "SLICE", "SLOPING", "SLOW", "SLUR", "SMALLER", "SMASH", "SMOKING", "SOAP", "SOCIETY", "SOF",
+    "SOLDIER", "SOLID", "SOM", "SOROCHYA", "SOU", "SOUTHERN", "SPADE", "SPARKLE", "SPEAR", "SPECIAL", "SPIDER",
+    "SPIDERY", "SPIRITUS", "SPLAYED", "SQUAT", "SQUIRREL", "SREDNE", "SSANGHIEUH", "SSANGRIEUL", "SSE", "SSUU",
+    "STAMPED", "STANDARD", "STAVROS", "STEAM", "STICKING", "STORE", "STRONG", "STUDY", "SUBJOINER", "SUBSTITUTE",
+    "SUCCEED", "SUCKED", "SUE", "SUHUR", "SUNGLASSES", "SUNRISE", "SUPER", "SUPERVISE", "SURANG", "SW", "SWAPPING",
+    "SWE", "SWEET", "SWI", "SWII", "SWO", "SWOO", "SYMBOL-1", "SYMBOL-11", "SYMBOL-12", "SYMBOL-13", "SYMBOL-14",
+    "SYMBOL-17", "SYMBOL-18", "SYMBOL-19", "SYMBOL-2", "SYMBOL-23", "SYMBOL-24", "SYMBOL-4", "SYMBOL-5", "SYMBOL-50",
+    "SYMBOL-51", "SYMBOL-52", "SYMBOL-53", "SYMBOL-54", "SYMBOL-7", "SYMBOL-8", "SYMMETRIC", "TA-2", "TA-ROL",
+    "TABULATION", "TAMING", "TANGENT", "TANNED", "TAPE", "TAT", "TAXI", "TAYANNA", "TC", "TCHE", "TE-2", "TELEIA",
+    "TELISHA", "TELOUS", "TENNIS", "TERMINAL", "TETARTIMORION", "TETRASEME", "TETRASIMOU", "TEUAEN", "TEUAEQ", "THEMA",
+    "THEMATISMOS", "THERE", "THERMOMETER", "THETHE", "THONG", "THREE-QUARTER", "TIGHTLY-CLOSED", "TIKEUT-CIEUC",
+    "TIKEUT-KIYEOK", "TIKEUT-PIEUP", "TIKEUT-RIEUL", "TIKEUT-SIOS", "TIKHY", "TIRONIAN", "TIT", "TITA", "TIWN", "TJE",
+    "TLHE", "TLHI", "TLHO", "TLV", "TOQ", "TORCULUS", "TORSO-WALLPLANE", "TOT", "TOTAL", "TOUCHING", "TOUCHTONE",
+    "TRACK", "TRADITIONAL", "TRAM", "TRANSMISSION", "TRAY", "TREMOLO-1", "TREMOLO-2", "TREMOLO-3", "TRESILLO",
+    "TRIANGLE-ROUND", "TRICOLON", "TRIGRAMMOS", "TRISEME", "TRISIMOU", "TRITIMORION", "TROKUTASTI", "TROPICAL", "TRUNK",
+    "TSEE", "TSHE", "TSHES", "TSHOOK", "TSSE", "TSV", "TSWE", "TTAA", "TTAYANNA", "TTHE", "TTHI", "TTI", "TTTA",
+    "TTUDDAAG", "TUK", "TUOT", "TUP", "TURBAN", "TWENTIETH", "TWENTIETHS", "TWENTY-EIGHTH", "TWENTY-FOUR", "TWENTY-ONE",
+    "TWENTY-THREE", "TWI", "TWII", "TWO-WAY", "TWOO", "TXWV", "TYPE-3", "TYPE-4", "TYPE-5", "TYPE-6", "TZ", "UB",
+    "UBADAMA", "UEX", "UEZ", "UKARA", "UNDERLINE", "UNDERTIE", "UNIVERSAL", "UNK", "UNN", "UO", "UPWARD", "URANUS",
+    "USED", "UY", "UZ3", "VAA", "VAMAGOMUKHA", "VEND", "VEP", "VICTORY", "VIDA", "VIDEO", "VIETNAMESE", "VINEGAR",
+    "VISIGOTHIC", "VIYO", "VOICING", "VOO", "VOU", "VUR", "WAITING", "WANING", "WAP", "WASALLAM", "WATCH",
+    "WAW-AYIN-RESH", "WAX", "WAXING", "WC", "WEARY", "WEDGE-TAILED", "WEI", "WHALE", "WII", "WINDOW", "WINDU",
+    "WINKING", "WOLOSO", "WOOL", "WRENCH", "WRITING", "WULU", "WUO", "WV", "XO", "XVA", "XYA", "XYE", "YA-YO", "YAKH",
+    "YAM", "YAN", "YAP", "YAQ", "YAR", "YAWN", "YAY", "YAZ", "YEAR", "YESIEUNG-PANSIOS", "YESIEUNG-SIOS", "YFEN", "YHE",
+    "YIE", "YO-I", "YO-YA", "YO-YAE", "YOGH", "YPOKRISIS", "YR", "YU-I", "YU-YE", "YU-YEO", "YUDH", "YUJ", "YUM",
+    "YUOP", "YUWOQ", "YV", "YWE", "YWI", "YWII", "YWO", "YWOO", "ZA7", "ZAA", "ZADERZHKA", "ZAKRYTAYA", "ZAQEF", "ZAYN",
+    "ZEMLYA", "ZHWE", "ZIB", "ZIDA", "ZIZ2", "ZJE", "ZLA", "ZLAMA", "ZOO", "ZOT", "ZUP", "ZUR", "ZY", "ZZE", "ZZI",
+    "ZZIET", "ZZO", "ZZU", "-CHAL", "-CHAR", "-KHYUD", "-PHRU", "A-1", "A-2", "A-3", "A-EU", "A-O", "A-U", "A-WO",
+    "A005A", "A006A", "A006B", "A010A", "A014A", "A017A", "A026A", "A028B", "A032A", "A039A", "A040A", "A041A", "A042A",
+    "A043A", "A046A", "A046B", "A066A", "A066B", "A066C", "A071", "A072", "A073", "A074", "A075", "A076", "A077",
+    "A078", "A079", "A080", "A081", "A082", "A083", "A084", "A085", "A086", "A087", "A088", "A089", "A090", "A091",
+    "A092", "A093", "A094", "A095", "A096", "A097", "A097A", "A098", "A098A", "A099", "A100", "A100-102", "A100A",
+    "A101", "A101A", "A102", "A102A", "A103", "A104", "A104A", "A104B", "A104C", "A105", "A105A", "A105B", "A106",
+    "A107", "A107A", "A107B", "A107C", "A108", "A109", "A110", "A110A", "A110B", "A111", "A112", "A113", "A114", "A115",
+    "A115A", "A116", "A117", "A118", "A119", "A120", "A120B", "A121", "A122", "A123", "A124", "A125", "A125A", "A126",
+    "A127", "A128", "A129", "A130", "A131", "A131C", "A132", "A133", "A134", "A135", "A135A", "A136", "A137", "A138",
+    "A139", "A140", "A141", "A142", "A143", "A144", "A145", "A146", "A147", "A148", "A149", "A150", "A151", "A152",
+    "A153", "A154", "A155", "A156", "A157", "A158", "A159", "A160", "A161", "A162", "A163", "A164", "A165", "A166",
+    "A167", "A168", "A169", "A170", "A171", "A172", "A173", "A174", "A175", "A176", "A177", "A178", "A179", "A180",
+    "A181", "A182", "A183", "A184", "A185", "A186", "A187", "A188", "A189", "A190", "A191", "A192", "A193", "A194",
+    "A195", "A196", "A197", "A198", "A199", "A200", "A201", "A202", "A202A", "A202B", "A203", "A204", "A205", "A206",
+    "A207", "A207A", "A208", "A209", "A209A", "A210", "A211", "A212", "A213", "A214", "A215", "A215A", "A216", "A216A",
+    "A217", "A218", "A219", "A220", "A221", "A222", "A223", "A224", "A225", "A226", "A227", "A227A", "A228", "A229",
+    "A230", "A231", "A232", "A233", "A234", "A235", "A236", "A237", "A238", "A239", "A240", "A241", "A242", "A243",
+    "A244", "A245", "A246", "A247", "A248", "A249", "A250", "A251", "A252", "A253", "A254", "A255", "A256", "A257",
+    "A258", "A259", "A260", "A261", "A262", "A263", "A264", "A265", "A266", "A267", "A267A", "A268", "A269", "A270",
+    "A271", "A272", "A273", "A274", "A275", "A276", "A277", "A278", "A279", "A280", "A281", "A282", "A283", "A284",
+    "A285", "A286", "A287", "A288", "A289", "A289A", "A290", "A291", "A292", "A293", "A294", "A294A", "A295", "A296",
+    "A297", "A298", "A299", "A299A", "A3", "A300", "A309", "A309B", "A309C", "A313", "A313A", "A313B", "A313C", "A329A",
+    "A332", "A332A", "A332B", "A332C", "A336A", "A336B", "A336C", "A359A", "A364A", "A368A", "A371A", "A372", "A373",
+    "A374", "A375", "A376", "A377", "A378", "A379", "A380", "A381", "A381A", "A382", "A383", "A383A", "A384", "A385",
+    "A386", "A386A", "A387", "A388", "A389", "A390", "A391", "A392", "A393", "A394", "A395", "A396", "A397", "A398",
+    "A399", "A400", "A400-VAS", "A401", "A401-VAS", "A402", "A402-VAS", "A403", "A403-VAS", "A404", "A404-VAS", "A405",
+    "A405-VAS", "A406", "A406-VAS", "A407", "A407-VAS", "A408", "A408-VAS", "A409", "A409-VAS", "A410", "A410-VAS",
+    "A410A", "A411", "A411-VAS", "A412", "A412-VAS", "A413", "A413-VAS", "A414", "A414-VAS", "A415", "A415-VAS", "A416",
+    "A416-VAS", "A417", "A417-VAS", "A418", "A418-VAS", "A419", "A420", "A421", "A422", "A423", "A424", "A425", "A426",
+    "A427", "A428", "A429", "A430", "A431", "A432", "A433", "A434", "A435", "A436", "A437", "A438", "A439", "A440",
+    "A441", "A442", "A443", "A444", "A445", "A446", "A447", "A448", "A449", "A450", "A450A", "A451", "A452", "A453",
+    "A454", "A455", "A456", "A457", "A457A", "A458", "A459", "A460", "A461", "A462", "A463", "A464", "A465", "A466",
+    "A467", "A468", "A469", "A470", "A471", "A472", "A473", "A474", "A475", "A476", "A477", "A478", "A479", "A480",
+    "A481", "A482", "A483", "A484", "A485", "A486", "A487", "A488", "A489", "A490", "A491", "A492", "A493", "A494",
+    "A495", "A496", "A497", "A507", "A514", "A517", "A518", "A519", "A522", "A531", "A532", "A534", "A535", "A536",
+    "A537", "A538", "A539", "A540", "A541", "A542", "A545", "A547", "A548", "A549", "A550", "A551", "A552", "A553",
+    "A554", "A555", "A556", "A557", "A559", "A563", "A564", "A565", "A566", "A568", "A569", "A570", "A571", "A572",
+    "A573", "A574", "A575", "A576", "A577", "A578", "A579", "A580", "A581", "A582", "A583", "A584", "A585", "A586",
+    "A587", "A588", "A589", "A591", "A592", "A594", "A595", "A596", "A598", "A600", "A601", "A602", "A603", "A604",
+    "A606", "A608", "A609", "A610", "A611", "A612", "A613", "A614", "A615", "A616", "A617", "A618", "A619", "A620",
+    "A621", "A622", "A623", "A624", "A626", "A627", "A628", "A629", "A634", "A637", "A638", "A640", "A642", "A643",
+    "A644", "A645", "A646", "A648", "A649", "A651", "A652", "A653", "A654", "A655", "A656", "A657", "A658", "A659",
+    "A660", "A661", "A662", "A663", "A664", "A701", "A702", "A703", "A704", "A705", "A706", "A707", "A708", "A709",
+    "A709-2", "A709-3", "A709-4", "A709-6", "A710", "A711", "A712", "A713", "A714", "A715", "A717", "A726", "A732",
+    "A800", "A801", "A802", "A803", "A804", "A805", "A806", "A807", "AA001", "AA002", "AA003", "AA004", "AA005",
+    "AA006", "AA007", "AA007A", "AA007B", "AA008", "AA009", "AA010", "AA011", "AA012", "AA013", "AA014", "AA015",
+    "AA016", "AA017", "AA018", "AA019", "AA020", "AA021", "AA022", "AA023", "AA024", "AA025", "AA026", "AA027", "AA028",
+    "AA029", "AA030", "AA031", "AA032", "AABAAFILI", "AAJ", "AAK", "AAM", "AANG", "AAO", "AARU", "AAU", "AAW",
+    "AAYANNA", "AAYIN", "AAZHAAKKU", "AB001", "AB002", "AB003", "AB004", "AB005", "AB006", "AB007", "AB008", "AB009",
+    "AB010", "AB011", "AB013", "AB016", "AB017", "AB020", "AB021", "AB021F", "AB021M", "AB022", "AB022F", "AB022M",
+    "AB023", "AB023M", "AB024", "AB026", "AB027", "AB028", "AB029", "AB030", "AB031", "AB034", "AB037", "AB038",
+    "AB039", "AB040", "AB041", "AB044", "AB045", "AB046", "AB047", "AB048", "AB049", "AB050", "AB051", "AB053", "AB054",
+    "AB055", "AB056", "AB057", "AB058", "AB059", "AB060", "AB061", "AB065", "AB066", "AB067", "AB069", "AB070", "AB073",
+    "AB074", "AB076", "AB077", "AB078", "AB079", "AB080", "AB081", "AB082", "AB085", "AB086", "AB087", "AB118", "AB120",
+    "AB122", "AB123", "AB131A", "AB131B", "AB164", "AB171", "AB180", "AB188", "AB191", "ABACUS", "ABAFILI", "ABB",
+    "ABUNDANCE", "ABYSMAL", "ACCENT-STACCATO", "ACCEPT", "ACCOMMODATION", "ACCORDION", "ACCUMULATION",
+    "ACUTE-GRAVE-ACUTE", "ACUTE-MACRON", "ADAK", "ADDAK", "ADDRESS", "ADDRESSED", "ADHESIVE", "ADI", "ADMETOS",
+    "ADMISSION", "ADO", "ADVANCE", "ADVANTAGE", "AED", "AEEYANNA", "AEL", "AENG", "AER", "AERIAL", "AES", "AESCULAPIUS",
+    "AEYANNA", "AFFRICATION", "AFGHANI", "AFOREMENTIONED", "AFSAAQ", "AFTER", "AGAIN", "AGAINST", "AGE", "AGGRAVATED",
+    "AGGRAVATION", "AGUNG", "AHAD", "AHAGGAR", "AHANG", "AHH", "AHSA", "AHSDA", "AID", "AIHVUS", "AIKARA", "AILM",
+    "AINN", "AINU", "AIVA", "AIVILIK", "AIYANNA", "AKBAR", "AKSA", "AKTIESELSKAB", "AL-JUZ", "AL-LAKUNA", "ALAF",
+    "ALAN", "ALARM", "ALAYHAA", "ALAYHIM", "ALAYHIMAA", "ALAYNAA", "ALF", "ALGIZ", "ALIFU", "ALIGNED", "ALKALI",
+    "ALKALI-2", "ALLAH", "ALLAHOU", "ALPA", "ALPAPRANA", "ALT", "ALTERNATION", "ALUM", "AMALGAM", "AMALGAMATION",
+    "AMBA", "AMBULANCE", "AMERICAN", "AMERICAS", "AMOUNT", "AMPHORA", "AMPS", "AMULET", "AN-NISF", "ANAP", "ANATOMICAL",
+    "ANATRICHISMA", "ANDAP", "ANGED", "ANGEL", "ANGKA", "ANGKHANKHU", "ANGRY", "ANGSTROM", "ANGUISHED", "ANGULAR",
+    "ANH", "ANHAA", "ANHU", "ANHUM", "ANHUMAA", "ANHUNNA", "ANIMAL", "ANKH", "ANN", "ANNAAU", "ANNUITY", "ANPEA",
+    "ANSUZ", "ANT", "ANTICLOCKWISE-ROTATED", "ANTIFONIA", "ANTIKENOKYLISMA", "ANTIKENOMA", "ANTIMONY-2", "ANUSVARAYA",
+    "AOR", "AOU", "APAATO", "APART", "APIN", "APODEXIA", "APOLLON", "APOTHEMA", "APOTHES", "APPLICATION", "APPROACH",
+    "APPROACHES", "APRIL", "APUN", "AQUAFORTIS", "AQUARIUS", "AR-RAHEEM", "AR-RAHMAN", "AR-RUB", "ARAEA-A", "ARAEA-E",
+    "ARAEA-EO", "ARAEA-I", "ARAEA-U", "ARAEAE", "ARDHACANDRA", "ARE", "AREPA", "ARGON", "ARGOTERI", "ARIES", "ARKAANU",
+    "ARKAB", "ARLAUG", "ARMOUR", "ARMS", "ARMY", "AROUND-PROFILE", "AROURA", "AROUSING", "ARRAY", "ARRIVE", "ARRIVING",
+    "ARROWHEAD-SHAPED", "ARSENIC", "ARTA", "ARTABE", "ARTICULATED", "ARTIST", "ARUHUA", "AS-SAJDA", "AS-SALAATU",
+    "ASAL2", "ASAT", "ASCENT", "ASCIA", "ASH3", "ASH9", "ASIA-AUSTRALIA", "ASPER", "ASPIRATED", "ASSALLAM", "ASSERTION",
+    "ASTERISCUS", "ASTERISKS", "ASTERISM", "ASTONISHED", "ASTRAEA", "ASTRONOMICAL", "ASYURA", "ASZ", "ATH-THALATHA",
+    "ATHARVAVEDIC", "ATHLETIC", "ATIKRAMA", "ATIYA", "ATMAAU", "ATNAH", "ATOM", "ATT", "ATTACHING", "ATTENTION",
+    "ATTHACAN", "AUBERGINE", "AUGMENTATION", "AUGUST", "AUNN", "AURAMAZDAA", "AURAMAZDAA-2", "AURAMAZDAAHA",
+    "AURIPIGMENT", "AUSTRAL", "AUTO", "AUTOMATED", "AUTUMN", "AUYANNA", "AVAKRAHASANYA", "AVERAGE", "AVOCADO", "AWC",
+    "AWE", "AWQ", "AWZ", "AYANNA", "AYER", "AYIN-DALETH", "AZZA", "B005A", "B010", "B011", "B012", "B013", "B014",
+    "B015", "B016", "B017", "B018", "B019", "B020", "B021", "B022", "B023", "B024", "B025", "B026", "B027", "B028",
+    "B029", "B030", "B031", "B032", "B033", "B034", "B036", "B037", "B038", "B039", "B040", "B041", "B042", "B043",
+    "B044", "B045", "B046", "B047", "B048", "B049", "B050", "B051", "B052", "B053", "B054", "B055", "B056", "B057",
+    "B058", "B059", "B060", "B061", "B062", "B063", "B064", "B065", "B066", "B067", "B068", "B069", "B070", "B071",
+    "B072", "B073", "B074", "B075", "B076", "B077", "B078", "B079", "B080", "B081", "B082", "B083", "B085", "B086",
+    "B087", "B089", "B090", "B091", "B100", "B102", "B104", "B105", "B105F", "B105M", "B106F", "B106M", "B107F",
+    "B107M", "B108F", "B108M", "B109F", "B109M", "B120", "B121", "B122", "B123", "B125", "B127", "B128", "B130", "B131",
+    "B132", "B133", "B135", "B140", "B141", "B142", "B145", "B146", "B150", "B151", "B152", "B153", "B154", "B155",
+    "B156", "B157", "B158", "B159", "B160", "B161", "B162", "B163", "B164", "B165", "B166", "B167", "B168", "B169",
+    "B170", "B171", "B172", "B173", "B174", "B176", "B177", "B178", "B179", "B180", "B181", "B182", "B183", "B184",
+    "B185", "B189", "B190", "B191", "B200", "B201", "B202", "B203", "B204", "B205", "B206", "B207", "B208", "B209",
+    "B210", "B211", "B212", "B213", "B214", "B215", "B216", "B217", "B218", "B219", "B220", "B221", "B222", "B225",
+    "B226", "B227", "B228", "B229", "B230", "B231", "B232", "B233", "B234", "B236", "B240", "B241", "B242", "B243",
+    "B245", "B246", "B247", "B248", "B249", "B250", "B251", "B252", "B253", "B254", "B255", "B256", "B257", "B258",
+    "B259", "B305", "BA-2", "BAARERU", "BACKSPACE", "BACON", "BACTRIAN", "BADGE", "BADMINTON", "BAG3", "BAGA", "BAGEL",
+    "BAGGAGE", "BAGS", "BAGUETTE", "BAH", "BAHIRGOMUKHA", "BAHT", "BAIMAI", "BAIRKAN", "BALD", "BALLET", "BALLPOINT",
+    "BANANA", "BAND", "BANDAGE", "BANG", "BANJO", "BANTOC", "BAP", "BARA2", "BARBER", "BARIYOOSAN", "BARLEY", "BARREKH",
+    "BARRIER", "BASEBALL", "BASH", "BASKET", "BASKETBALL", "BATHAMASAT", "BAU", "BAX", "BB", "BBAA", "BBAP", "BBAT",
+    "BBAX", "BBEE", "BBEP", "BBEX", "BBIE", "BBIEP", "BBIET", "BBIEX", "BBIP", "BBIT", "BBIX", "BBOP", "BBOT", "BBOX",
+    "BBUO", "BBUOP", "BBUOX", "BBUP", "BBUR", "BBURX", "BBUX", "BBY", "BBYP", "BBYT", "BBYX", "BEACH", "BEADS", "BEAN",
+    "BEANS", "BEARDED", "BEATING", "BECAUSE", "BED", "BEEHIVE", "BEETA", "BEFORE", "BEGINNER", "BEGINNING", "BEITH",
+    "BELGTHOR", "BELLHOP", "BENDE", "BENTO", "BEORC", "BEP", "BERKANAN", "BEX", "BEYYAL", "BH", "BHAA", "BHAM",
+    "BHATTIPROLU", "BHEE", "BHI", "BHOO", "BHU", "BIB", "BIBLE-CREE", "BICEPS", "BICYCLE", "BICYCLES", "BIDENTAL",
+    "BIE", "BIEP", "BIET", "BIEX", "BIKINI", "BILLED", "BILLIARDS", "BILLIONS", "BINOVILE", "BIOHAZARD", "BIP",
+    "BIRTHDAY", "BIRU", "BISAH", "BISECTING", "BISMILLAH", "BISMUTH", "BISON", "BITCOIN", "BITE", "BITTER", "BIX",
+    "BJARKAN", "BKA-", "BLA", "BLOCK-1358", "BLOND", "BLOW", "BLOWFISH", "BLUEBERRIES", "BOA", "BOMB", "BOOKS", "BOOTS",
+    "BOP", "BORAX", "BORAX-2", "BORAX-3", "BORUTO", "BORZAYA", "BORZY", "BOT", "BOTTOM-LIGHTED", "BOTTOM-SHADED",
+    "BOUNDARY", "BOWING", "BOWLING", "BOXING", "BOY", "BOYS", "BQ", "BRACE", "BRACKETS", "BRAIN", "BRAKCET", "BRANCHES",
+    "BRANCHING", "BREAKTHROUGH", "BREAST-FEEDING", "BREVE-MACRON", "BRI", "BRIDE", "BRIEFCASE", "BRIEFS", "BRISTLE",
+    "BROCCOLI", "BRONZE", "BROOM", "BSDUS", "BSKA-", "BSKUR", "BSTAR", "BUCKET", "BUCKLE", "BUFFALO", "BUG", "BULB",
+    "BULL", "BULLS", "BULLSEYE", "BUMPY", "BUNG", "BUNNY", "BUO", "BUOP", "BUOX", "BUOY", "BUP", "BUR2", "BURRITO",
+    "BURX", "BUSINESS", "BUSSYERU", "BUST", "BUSTS", "BUTTER", "BUTTERFLY", "BUUMISH", "BUX", "BWE", "BXG", "BYP",
+    "BYR", "BYRX", "BYT", "BYX", "C-18", "C-39", "C001", "C002", "C002A", "C002B", "C002C", "C003", "C004", "C005",
+    "C006", "C007", "C008", "C009", "C010", "C010A", "C011", "C012", "C013", "C014", "C015", "C016", "C017", "C018",
+    "C019", "C020", "C021", "C022", "C023", "C024", "CAAI", "CAANG", "CABBAGE-TREE", "CABINET", "CABLEWAY", "CACTUS",
+    "CADA", "CAESURA", "CAH", "CAI", "CAL", "CALC", "CALCULATOR", "CALX", "CAMNUC", "CAMPING", "CANCER", "CANDLE",
+    "CANDY", "CANE", "CANG", "CANNED", "CANOE", "CAPITULUM", "CAPO", "CAPPED", "CAPRICORN", "CAPTIVE", "CAPUT", "CARDS",
+    "CARE", "CAROUSEL", "CARP", "CARRIAGE", "CARROT", "CARS", "CARTRIDGE", "CARTWHEEL", "CARYSTIAN", "CATAWA", "CAU",
+    "CAUDA", "CAUTION", "CAVE", "CAX", "CCA", "CCAA", "CCE", "CCEE", "CCHA", "CCHAA", "CCHEE", "CCHHA", "CCHHAA",
+    "CCHHE", "CCHHEE", "CCHHI", "CCHHO", "CCHHU", "CCHI", "CCHO", "CCHU", "CCI", "CCO", "CCU", "CEALC", "CECEK", "CEDI",
+    "CEEB", "CEEV", "CEIRT", "CELEBRATION", "CELSIUS", "CELTIC", "CEN", "CENTURIAL", "CEONGCHIEUMCHIEUCH",
+    "CEONGCHIEUMCIEUC", "CEONGCHIEUMSIOS", "CEONGCHIEUMSSANGCIEUC", "CEONGCHIEUMSSANGSIOS", "CEP", "CEREK", "CEREMONY",
+    "CERES", "CEVITU", "CEX", "CHAD", "CHADA", "CHAINS", "CHAMILI", "CHAMILON", "CHAMKO", "CHAN", "CHANG", "CHANGE",
+    "CHAP", "CHAPTER", "CHATTAWA", "CHAU", "CHAVIYANI", "CHAX", "CHEEK", "CHEEM", "CHEERING", "CHEESE", "CHEIKHAN",
+    "CHEIKHEI", "CHEINAP", "CHELNU", "CHEN", "CHEP", "CHEQUERED", "CHERRIES", "CHERRY", "CHERY", "CHESTNUT", "CHET",
+    "CHEX", "CHHA", "CHHIM", "CHICKEN", "CHIEUCH-HIEUH", "CHIEUCH-KHIEUKH", "CHIL", "CHILDREN", "CHIM", "CHIME",
+    "CHING", "CHINOOK", "CHIPMUNK", "CHIRET", "CHIRON", "CHITUEUMCHIEUCH", "CHITUEUMCIEUC", "CHITUEUMSIOS",
+    "CHITUEUMSSANGCIEUC", "CHITUEUMSSANGSIOS", "CHOA", "CHOCOLATE", "CHOE", "CHOKE", "CHOP", "CHOPSTICKS", "CHOT",
+    "CHOX", "CHOY", "CHRYSANTHEMUM", "CHULA", "CHUO", "CHUOP", "CHUOT", "CHUOX", "CHUP", "CHUR", "CHURX", "CHUX",
+    "CHWA", "CHWV", "CHY", "CHYP", "CHYR", "CHYRX", "CHYT", "CHYX", "CIE", "CIEP", "CIET", "CIEUC-IEUNG", "CIEUC-PIEUP",
+    "CIEUC-SSANGPIEUP", "CIEX", "CII", "CINEMA", "CINNABAR", "CIRCULATION", "CIRCUS", "CIT", "CITATION", "CIVILIAN",
+    "CIX", "CL", "CLAIM", "CLAMSHELL", "CLAPPER", "CLAPPING", "CLASSICAL", "CLAW", "CLEAR", "CLEAVER", "CLEF-1",
+    "CLEF-2", "CLIMACUS", "CLIMBING", "CLINGING", "CLIPBOARD", "CLIVIS", "CLOSENESS", "CLOSET", "CLOSURE", "CLOVER",
+    "CLOWN", "CLUB-SPOKED", "CM001", "CM002", "CM004", "CM005", "CM006", "CM007", "CM008", "CM009", "CM010", "CM011",
+    "CM012", "CM012B", "CM013", "CM015", "CM017", "CM019", "CM021", "CM023", "CM024", "CM025", "CM026", "CM027",
+    "CM028", "CM029", "CM030", "CM033", "CM034", "CM035", "CM036", "CM037", "CM038", "CM039", "CM040", "CM041", "CM044",
+    "CM046", "CM047", "CM049", "CM050", "CM051", "CM052", "CM053", "CM054", "CM055", "CM056", "CM058", "CM059", "CM060",
+    "CM061", "CM062", "CM063", "CM064", "CM066", "CM067", "CM068", "CM069", "CM070", "CM071", "CM072", "CM073", "CM074",
+    "CM075", "CM075B", "CM076", "CM078", "CM079", "CM080", "CM081", "CM082", "CM083", "CM084", "CM085", "CM086",
+    "CM087", "CM088", "CM089", "CM090", "CM091", "CM092", "CM094", "CM095", "CM096", "CM097", "CM098", "CM099", "CM100",
+    "CM101", "CM102", "CM103", "CM104", "CM105", "CM107", "CM108", "CM109", "CM110", "CM112", "CM114", "CM301", "CM302",
+    "COA", "COASTER", "COCKROACH", "COCKTAIL", "COCONUT", "CODA", "COENG", "COFFIN", "COIN", "COLL", "COLLISION",
+    "COLOR", "COLUMN", "COMB", "COMBINATION", "COMBINED", "COMET", "COMING", "COMMON", "COMPARE", "COMPASS",
+    "COMPLEMENT", "COMPLETED", "COMPLIANCE", "COMPONENT-001", "COMPONENT-002", "COMPONENT-003", "COMPONENT-004",
+    "COMPONENT-005", "COMPONENT-006", "COMPONENT-007", "COMPONENT-008", "COMPONENT-009", "COMPONENT-010",
+    "COMPONENT-011", "COMPONENT-012", "COMPONENT-013", "COMPONENT-014", "COMPONENT-015", "COMPONENT-016",
+    "COMPONENT-017", "COMPONENT-018", "COMPONENT-019", "COMPONENT-020", "COMPONENT-021", "COMPONENT-022",
+    "COMPONENT-023", "COMPONENT-024", "COMPONENT-025", "COMPONENT-026", "COMPONENT-027", "COMPONENT-028",
+    "COMPONENT-029", "COMPONENT-030", "COMPONENT-031", "COMPONENT-032", "COMPONENT-033", "COMPONENT-034",
+    "COMPONENT-035", "COMPONENT-036", "COMPONENT-037", "COMPONENT-038", "COMPONENT-039", "COMPONENT-040",
+    "COMPONENT-041", "COMPONENT-042", "COMPONENT-043", "COMPONENT-044", "COMPONENT-045", "COMPONENT-046",
+    "COMPONENT-047", "COMPONENT-048", "COMPONENT-049", "COMPONENT-050", "COMPONENT-051", "COMPONENT-052",
+    "COMPONENT-053", "COMPONENT-054", "COMPONENT-055", "COMPONENT-056", "COMPONENT-057", "COMPONENT-058",
+    "COMPONENT-059", "COMPONENT-060", "COMPONENT-061", "COMPONENT-062", "COMPONENT-063", "COMPONENT-064",
+    "COMPONENT-065", "COMPONENT-066", "COMPONENT-067", "COMPONENT-068", "COMPONENT-069", "COMPONENT-070",
+    "COMPONENT-071", "COMPONENT-072", "COMPONENT-073", "COMPONENT-074", "COMPONENT-075", "COMPONENT-076",
+    "COMPONENT-077", "COMPONENT-078", "COMPONENT-079", "COMPONENT-080", "COMPONENT-081", "COMPONENT-082",
+    "COMPONENT-083", "COMPONENT-084", "COMPONENT-085", "COMPONENT-086", "COMPONENT-087", "COMPONENT-088",
+    "COMPONENT-089", "COMPONENT-090", "COMPONENT-091", "COMPONENT-092", "COMPONENT-093", "COMPONENT-094",
+    "COMPONENT-095", "COMPONENT-096", "COMPONENT-097", "COMPONENT-098", "COMPONENT-099", "COMPONENT-100",
+    "COMPONENT-101", "COMPONENT-102", "COMPONENT-103", "COMPONENT-104", "COMPONENT-105", "COMPONENT-106",
+    "COMPONENT-107", "COMPONENT-108", "COMPONENT-109", "COMPONENT-110", "COMPONENT-111", "COMPONENT-112",
+    "COMPONENT-113", "COMPONENT-114", "COMPONENT-115", "COMPONENT-116", "COMPONENT-117", "COMPONENT-118",
+    "COMPONENT-119", "COMPONENT-120", "COMPONENT-121", "COMPONENT-122", "COMPONENT-123", "COMPONENT-124",
+    "COMPONENT-125", "COMPONENT-126", "COMPONENT-127", "COMPONENT-128", "COMPONENT-129", "COMPONENT-130",
+    "COMPONENT-131", "COMPONENT-132", "COMPONENT-133", "COMPONENT-134", "COMPONENT-135", "COMPONENT-136",
+    "COMPONENT-137", "COMPONENT-138", "COMPONENT-139", "COMPONENT-140", "COMPONENT-141", "COMPONENT-142",
+    "COMPONENT-143", "COMPONENT-144", "COMPONENT-145", "COMPONENT-146", "COMPONENT-147", "COMPONENT-148",
+    "COMPONENT-149", "COMPONENT-150", "COMPONENT-151", "COMPONENT-152", "COMPONENT-153", "COMPONENT-154",
+    "COMPONENT-155", "COMPONENT-156", "COMPONENT-157", "COMPONENT-158", "COMPONENT-159", "COMPONENT-160",
+    "COMPONENT-161", "COMPONENT-162", "COMPONENT-163", "COMPONENT-164", "COMPONENT-165", "COMPONENT-166",
+    "COMPONENT-167", "COMPONENT-168", "COMPONENT-169", "COMPONENT-170", "COMPONENT-171", "COMPONENT-172",
+    "COMPONENT-173", "COMPONENT-174", "COMPONENT-175", "COMPONENT-176", "COMPONENT-177", "COMPONENT-178",
+    "COMPONENT-179", "COMPONENT-180", "COMPONENT-181", "COMPONENT-182", "COMPONENT-183", "COMPONENT-184",
+    "COMPONENT-185", "COMPONENT-186", "COMPONENT-187", "COMPONENT-188", "COMPONENT-189", "COMPONENT-190",
+    "COMPONENT-191", "COMPONENT-192", "COMPONENT-193", "COMPONENT-194", "COMPONENT-195", "COMPONENT-196",
+    "COMPONENT-197", "COMPONENT-198", "COMPONENT-199", "COMPONENT-200", "COMPONENT-201", "COMPONENT-202",
+    "COMPONENT-203", "COMPONENT-204", "COMPONENT-205", "COMPONENT-206", "COMPONENT-207", "COMPONENT-208",
+    "COMPONENT-209", "COMPONENT-210", "COMPONENT-211", "COMPONENT-212", "COMPONENT-213", "COMPONENT-214",
+    "COMPONENT-215", "COMPONENT-216", "COMPONENT-217", "COMPONENT-218", "COMPONENT-219", "COMPONENT-220",
+    "COMPONENT-221", "COMPONENT-222", "COMPONENT-223", "COMPONENT-224", "COMPONENT-225", "COMPONENT-226",
+    "COMPONENT-227", "COMPONENT-228", "COMPONENT-229", "COMPONENT-230", "COMPONENT-231", "COMPONENT-232",
+    "COMPONENT-233", "COMPONENT-234", "COMPONENT-235", "COMPONENT-236", "COMPONENT-237", "COMPONENT-238",
+    "COMPONENT-239", "COMPONENT-240", "COMPONENT-241", "COMPONENT-242", "COMPONENT-243", "COMPONENT-244",
+    "COMPONENT-245", "COMPONENT-246", "COMPONENT-247", "COMPONENT-248", "COMPONENT-249", "COMPONENT-250",
+    "COMPONENT-251", "COMPONENT-252", "COMPONENT-253", "COMPONENT-254", "COMPONENT-255", "COMPONENT-256",
+    "COMPONENT-257", "COMPONENT-258", "COMPONENT-259", "COMPONENT-260", "COMPONENT-261", "COMPONENT-262",
+    "COMPONENT-263", "COMPONENT-264", "COMPONENT-265", "COMPONENT-266", "COMPONENT-267", "COMPONENT-268",
+    "COMPONENT-269", "COMPONENT-270", "COMPONENT-271", "COMPONENT-272", "COMPONENT-273", "COMPONENT-274",
+    "COMPONENT-275", "COMPONENT-276", "COMPONENT-277", "COMPONENT-278", "COMPONENT-279", "COMPONENT-280",
+    "COMPONENT-281", "COMPONENT-282", "COMPONENT-283", "COMPONENT-284", "COMPONENT-285", "COMPONENT-286",
+    "COMPONENT-287", "COMPONENT-288", "COMPONENT-289", "COMPONENT-290", "COMPONENT-291", "COMPONENT-292",
+    "COMPONENT-293", "COMPONENT-294", "COMPONENT-295", "COMPONENT-296", "COMPONENT-297", "COMPONENT-298",
+    "COMPONENT-299", "COMPONENT-300", "COMPONENT-301", "COMPONENT-302", "COMPONENT-303", "COMPONENT-304",
+    "COMPONENT-305", "COMPONENT-306", "COMPONENT-307", "COMPONENT-308", "COMPONENT-309", "COMPONENT-310",
+    "COMPONENT-311", "COMPONENT-312", "COMPONENT-313", "COMPONENT-314", "COMPONENT-315", "COMPONENT-316",
+    "COMPONENT-317", "COMPONENT-318", "COMPONENT-319", "COMPONENT-320", "COMPONENT-321", "COMPONENT-322",
+    "COMPONENT-323", "COMPONENT-324", "COMPONENT-325", "COMPONENT-326", "COMPONENT-327", "COMPONENT-328",
+    "COMPONENT-329", "COMPONENT-330", "COMPONENT-331", "COMPONENT-332", "COMPONENT-333", "COMPONENT-334",
+    "COMPONENT-335", "COMPONENT-336", "COMPONENT-337", "COMPONENT-338", "COMPONENT-339", "COMPONENT-340",
+    "COMPONENT-341", "COMPONENT-342", "COMPONENT-343", "COMPONENT-344", "COMPONENT-345", "COMPONENT-346",
+    "COMPONENT-347", "COMPONENT-348", "COMPONENT-349", "COMPONENT-350", "COMPONENT-351", "COMPONENT-352",
+    "COMPONENT-353", "COMPONENT-354", "COMPONENT-355", "COMPONENT-356", "COMPONENT-357", "COMPONENT-358",
+    "COMPONENT-359", "COMPONENT-360", "COMPONENT-361", "COMPONENT-362", "COMPONENT-363", "COMPONENT-364",
+    "COMPONENT-365", "COMPONENT-366", "COMPONENT-367", "COMPONENT-368", "COMPONENT-369", "COMPONENT-370",
+    "COMPONENT-371", "COMPONENT-372", "COMPONENT-373", "COMPONENT-374", "COMPONENT-375", "COMPONENT-376",
+    "COMPONENT-377", "COMPONENT-378", "COMPONENT-379", "COMPONENT-380", "COMPONENT-381", "COMPONENT-382",
+    "COMPONENT-383", "COMPONENT-384", "COMPONENT-385", "COMPONENT-386", "COMPONENT-387", "COMPONENT-388",
+    "COMPONENT-389", "COMPONENT-390", "COMPONENT-391", "COMPONENT-392", "COMPONENT-393", "COMPONENT-394",
+    "COMPONENT-395", "COMPONENT-396", "COMPONENT-397", "COMPONENT-398", "COMPONENT-399", "COMPONENT-400",
+    "COMPONENT-401", "COMPONENT-402", "COMPONENT-403", "COMPONENT-404", "COMPONENT-405", "COMPONENT-406",
+    "COMPONENT-407", "COMPONENT-408", "COMPONENT-409", "COMPONENT-410", "COMPONENT-411", "COMPONENT-412",
+    "COMPONENT-413", "COMPONENT-414", "COMPONENT-415", "COMPONENT-416", "COMPONENT-417", "COMPONENT-418",
+    "COMPONENT-419", "COMPONENT-420", "COMPONENT-421", "COMPONENT-422", "COMPONENT-423", "COMPONENT-424",
+    "COMPONENT-425", "COMPONENT-426", "COMPONENT-427", "COMPONENT-428", "COMPONENT-429", "COMPONENT-430",
+    "COMPONENT-431", "COMPONENT-432", "COMPONENT-433", "COMPONENT-434", "COMPONENT-435", "COMPONENT-436",
+    "COMPONENT-437", "COMPONENT-438", "COMPONENT-439", "COMPONENT-440", "COMPONENT-441", "COMPONENT-442",
+    "COMPONENT-443", "COMPONENT-444", "COMPONENT-445", "COMPONENT-446", "COMPONENT-447", "COMPONENT-448",
+    "COMPONENT-449", "COMPONENT-450", "COMPONENT-451", "COMPONENT-452", "COMPONENT-453", "COMPONENT-454",
+    "COMPONENT-455", "COMPONENT-456", "COMPONENT-457", "COMPONENT-458", "COMPONENT-459", "COMPONENT-460",
+    "COMPONENT-461", "COMPONENT-462", "COMPONENT-463", "COMPONENT-464", "COMPONENT-465", "COMPONENT-466",
+    "COMPONENT-467", "COMPONENT-468", "COMPONENT-469", "COMPONENT-470", "COMPONENT-471", "COMPONENT-472",
+    "COMPONENT-473", "COMPONENT-474", "COMPONENT-475", "COMPONENT-476", "COMPONENT-477", "COMPONENT-478",
+    "COMPONENT-479", "COMPONENT-480", "COMPONENT-481", "COMPONENT-482", "COMPONENT-483", "COMPONENT-484",
+    "COMPONENT-485", "COMPONENT-486", "COMPONENT-487", "COMPONENT-488", "COMPONENT-489", "COMPONENT-490",
+    "COMPONENT-491", "COMPONENT-492", "COMPONENT-493", "COMPONENT-494", "COMPONENT-495", "COMPONENT-496",
+    "COMPONENT-497", "COMPONENT-498", "COMPONENT-499", "COMPONENT-500", "COMPONENT-501", "COMPONENT-502",
+    "COMPONENT-503", "COMPONENT-504", "COMPONENT-505", "COMPONENT-506", "COMPONENT-507", "COMPONENT-508",
+    "COMPONENT-509", "COMPONENT-510", "COMPONENT-511", "COMPONENT-512", "COMPONENT-513", "COMPONENT-514",
+    "COMPONENT-515", "COMPONENT-516", "COMPONENT-517", "COMPONENT-518", "COMPONENT-519", "COMPONENT-520",
+    "COMPONENT-521", "COMPONENT-522", "COMPONENT-523", "COMPONENT-524", "COMPONENT-525", "COMPONENT-526",
+    "COMPONENT-527", "COMPONENT-528", "COMPONENT-529", "COMPONENT-530", "COMPONENT-531", "COMPONENT-532",
+    "COMPONENT-533", "COMPONENT-534", "COMPONENT-535", "COMPONENT-536", "COMPONENT-537", "COMPONENT-538",
+    "COMPONENT-539", "COMPONENT-540", "COMPONENT-541", "COMPONENT-542", "COMPONENT-543", "COMPONENT-544",
+    "COMPONENT-545", "COMPONENT-546", "COMPONENT-547", "COMPONENT-548", "COMPONENT-549", "COMPONENT-550",
+    "COMPONENT-551", "COMPONENT-552", "COMPONENT-553", "COMPONENT-554", "COMPONENT-555", "COMPONENT-556",
+    "COMPONENT-557", "COMPONENT-558", "COMPONENT-559", "COMPONENT-560", "COMPONENT-561", "COMPONENT-562",
+    "COMPONENT-563", "COMPONENT-564", "COMPONENT-565", "COMPONENT-566", "COMPONENT-567", "COMPONENT-568",
+    "COMPONENT-569", "COMPONENT-570", "COMPONENT-571", "COMPONENT-572", "COMPONENT-573", "COMPONENT-574",
+    "COMPONENT-575", "COMPONENT-576", "COMPONENT-577", "COMPONENT-578", "COMPONENT-579", "COMPONENT-580",
+    "COMPONENT-581", "COMPONENT-582", "COMPONENT-583", "COMPONENT-584", "COMPONENT-585", "COMPONENT-586",
+    "COMPONENT-587", "COMPONENT-588", "COMPONENT-589", "COMPONENT-590", "COMPONENT-591", "COMPONENT-592",
+    "COMPONENT-593", "COMPONENT-594", "COMPONENT-595", "COMPONENT-596", "COMPONENT-597", "COMPONENT-598",
+    "COMPONENT-599", "COMPONENT-600", "COMPONENT-601", "COMPONENT-602", "COMPONENT-603", "COMPONENT-604",
+    "COMPONENT-605", "COMPONENT-606", "COMPONENT-607", "COMPONENT-608", "COMPONENT-609", "COMPONENT-610",
+    "COMPONENT-611", "COMPONENT-612", "COMPONENT-613", "COMPONENT-614", "COMPONENT-615", "COMPONENT-616",
+    "COMPONENT-617", "COMPONENT-618", "COMPONENT-619", "COMPONENT-620", "COMPONENT-621", "COMPONENT-622",
+    "COMPONENT-623", "COMPONENT-624", "COMPONENT-625", "COMPONENT-626", "COMPONENT-627", "COMPONENT-628",
+    "COMPONENT-629", "COMPONENT-630", "COMPONENT-631", "COMPONENT-632", "COMPONENT-633", "COMPONENT-634",
+    "COMPONENT-635", "COMPONENT-636", "COMPONENT-637", "COMPONENT-638", "COMPONENT-639", "COMPONENT-640",
+    "COMPONENT-641", "COMPONENT-642", "COMPONENT-643", "COMPONENT-644", "COMPONENT-645", "COMPONENT-646",
+    "COMPONENT-647", "COMPONENT-648", "COMPONENT-649", "COMPONENT-650", "COMPONENT-651", "COMPONENT-652",
+    "COMPONENT-653", "COMPONENT-654", "COMPONENT-655", "COMPONENT-656", "COMPONENT-657", "COMPONENT-658",
+    "COMPONENT-659", "COMPONENT-660", "COMPONENT-661", "COMPONENT-662", "COMPONENT-663", "COMPONENT-664",
+    "COMPONENT-665", "COMPONENT-666", "COMPONENT-667", "COMPONENT-668", "COMPONENT-669", "COMPONENT-670",
+    "COMPONENT-671", "COMPONENT-672", "COMPONENT-673", "COMPONENT-674", "COMPONENT-675", "COMPONENT-676",
+    "COMPONENT-677", "COMPONENT-678", "COMPONENT-679", "COMPONENT-680", "COMPONENT-681", "COMPONENT-682",
+    "COMPONENT-683", "COMPONENT-684", "COMPONENT-685", "COMPONENT-686", "COMPONENT-687", "COMPONENT-688",
+    "COMPONENT-689", "COMPONENT-690", "COMPONENT-691", "COMPONENT-692", "COMPONENT-693", "COMPONENT-694",
+    "COMPONENT-695", "COMPONENT-696", "COMPONENT-697", "COMPONENT-698", "COMPONENT-699", "COMPONENT-700",
+    "COMPONENT-701", "COMPONENT-702", "COMPONENT-703", "COMPONENT-704", "COMPONENT-705", "COMPONENT-706",
+    "COMPONENT-707", "COMPONENT-708", "COMPONENT-709", "COMPONENT-710", "COMPONENT-711", "COMPONENT-712",
+    "COMPONENT-713", "COMPONENT-714", "COMPONENT-715", "COMPONENT-716", "COMPONENT-717", "COMPONENT-718",
+    "COMPONENT-719", "COMPONENT-720", "COMPONENT-721", "COMPONENT-722", "COMPONENT-723", "COMPONENT-724",
+    "COMPONENT-725", "COMPONENT-726", "COMPONENT-727", "COMPONENT-728", "COMPONENT-729", "COMPONENT-730",
+    "COMPONENT-731", "COMPONENT-732", "COMPONENT-733", "COMPONENT-734", "COMPONENT-735", "COMPONENT-736",
+    "COMPONENT-737", "COMPONENT-738", "COMPONENT-739", "COMPONENT-740", "COMPONENT-741", "COMPONENT-742",
+    "COMPONENT-743", "COMPONENT-744", "COMPONENT-745", "COMPONENT-746", "COMPONENT-747", "COMPONENT-748",
+    "COMPONENT-749", "COMPONENT-750", "COMPONENT-751", "COMPONENT-752", "COMPONENT-753", "COMPONENT-754",
+    "COMPONENT-755", "COMPONENT-756", "COMPONENT-757", "COMPONENT-758", "COMPONENT-759", "COMPONENT-760",
+    "COMPONENT-761", "COMPONENT-762", "COMPONENT-763", "COMPONENT-764", "COMPONENT-765", "COMPONENT-766",
+    "COMPONENT-767", "COMPONENT-768", "COMPRESSION", "COMPUTERS", "CONCAVE-POINTED", "CONFETTI", "CONFLICT",
+    "CONFOUNDED", "CONFUSED", "CONGRUENT", "CONICAL", "CONJUGATE", "CONJUNCTION", "CONSTANCY", "CONTEMPLATION",
+    "CONTENTION", "CONTINUATION", "CONTINUING", "CONTINUOUS", "CONTOURED", "CONTRACTION", "CONTRARIETY", "CONVENIENCE",
+    "COOKED", "COOKING", "COOL", "COP", "COPPER-2", "COPY", "COPYLEFT", "CORAL", "CORK", "CORNISH", "CORONIS",
+    "CORPORATION", "CORPSE", "CORRECT", "CORRESPONDS", "COT", "COUCH", "COUNTERBORE", "COUNTERSINK", "COUPLE", "COWBOY",
+    "COX", "CRAB", "CRACKER", "CRAYON", "CREATIVE", "CRESCENDO", "CROCODILE", "CROISSANT", "CROIX", "CRUCIBLE",
+    "CRUCIBLE-2", "CRUCIBLE-3", "CRUCIBLE-4", "CRUCIBLE-5", "CRUCIFORM", "CRUTCH", "CRUZEIRO", "CRYSTAL", "CUAM",
+    "CUCUMBER", "CUO", "CUOX", "CUPCAKE", "CUPIDO", "CUR", "CURLED", "CURLING", "CURRY", "CURX", "CUSTARD", "CUSTOMER",
+    "CUSTOMS", "CUX", "CWEORTH", "CYAW", "CYAY", "CYCLONE", "CYLINDRICITY", "CYPERUS", "CYR", "CYRENAIC", "CYRX", "CYX",
+    "D001", "D002", "D003", "D004", "D005", "D006", "D007", "D008", "D008A", "D009", "D010", "D011", "D012", "D013",
+    "D014", "D015", "D016", "D017", "D018", "D019", "D020", "D021", "D022", "D023", "D024", "D025", "D026", "D027",
+    "D027A", "D028", "D029", "D030", "D031", "D031A", "D032", "D033", "D034", "D034A", "D035", "D036", "D037", "D038",
+    "D039", "D040", "D041", "D042", "D043", "D044", "D045", "D046", "D046A", "D047", "D048", "D048A", "D049", "D050",
+    "D050A", "D050B", "D050C", "D050D", "D050E", "D050F", "D050G", "D050H", "D050I", "D051", "D052", "D052A", "D053",
+    "D054", "D054A", "D055", "D056", "D057", "D058", "D059", "D060", "D061", "D062", "D063", "D064", "D065", "D066",
+    "D067", "D067A", "D067B", "D067C", "D067D", "D067E", "D067F", "D067G", "D067H", "D2", "DAADHU", "DAASU", "DAEG",
+    "DAENG", "DAG3", "DAGALGA", "DAGAZ", "DAGBASINNA", "DAGS", "DAH", "DAHYAAUSH", "DAHYAAUSH-2", "DAI", "DAING",
+    "DAIR", "DALAT", "DALETH-RESH", "DAM", "DAMARU", "DANCER", "DANCING", "DANGO", "DANTAYALAN", "DARA4", "DARGA",
+    "DART", "DASEIA", "DATA", "DAVID", "DAVIYANI", "DAWB", "DAX", "DAY-NIGHT", "DD", "DDAP", "DDAT", "DDAX", "DDEE",
+    "DDEP", "DDEX", "DDHE", "DDHEE", "DDHI", "DDHU", "DDIE", "DDIEP", "DDIEX", "DDIP", "DDIT", "DDIX", "DDOA", "DDOP",
+    "DDOT", "DDOX", "DDUO", "DDUOP", "DDUOX", "DDUP", "DDURX", "DDUT", "DDUX", "DDWA", "DEAD", "DEAF", "DEBIT",
+    "DECAYED", "DECEMBER", "DECIDUOUS", "DECISIVENESS", "DECORATIVE", "DECRESCENDO", "DEEL", "DEEPLY", "DEFECTIVENESS",
+    "DEFINITION", "DEHI", "DEK", "DEKA", "DELETION", "DELICIOUS", "DELIVERANCE", "DELIVERY", "DELPHIC", "DELT",
+    "DENARIUS", "DENG", "DENNEN", "DEP", "DEPARTMENT", "DEPTH", "DERBITSA", "DERELICT", "DERET", "DERET-HIDET", "DESI",
+    "DESIGN", "DESK", "DEUNG", "DEVELOPMENT", "DEX", "DEYTEROU", "DHAA", "DHAALU", "DHADHE", "DHAL", "DHALATH",
+    "DHALETH", "DHAMEDH", "DHARMA", "DHEE", "DHHA", "DHHE", "DHHEE", "DHHI", "DHHO", "DHHOO", "DHHU", "DHI", "DHII",
+    "DHOO", "DHOU", "DHU", "DIAERESIS-RING", "DIAERESIZED", "DIAMETER", "DIARGON", "DIATONON", "DIEP", "DIESEL", "DIEX",
+    "DIFAT", "DIFFERENCE", "DIFFICULTIES", "DIFFICULTY", "DIFTOGGOS", "DIGITS", "DIGRAMMA", "DIL", "DIMENSION",
+    "DIMENSIONAL", "DIMIDIA", "DIMINISHMENT", "DIMINUTION-2", "DIMINUTION-3", "DIMMING", "DING", "DIP", "DIPLOUN",
+    "DIPPER", "DIPTE", "DIRGA", "DISABLED", "DISCONTINUOUS", "DISGUISED", "DISPERSION", "DISPUTED", "DISSOLVE",
+    "DISSOLVE-2", "DISTILL", "DISTINGUISH", "DISTORTION", "DIT", "DITTO", "DIVERGENCE", "DIVIDERS", "DIVIDES", "DIVING",
+    "DIVORCE", "DIX", "DIYA", "DJ", "DL", "DLE", "DLEE", "DLHA", "DLHYA", "DLI", "DLO", "DLU", "DNA", "DO-O", "DOA",
+    "DODO", "DOING", "DOIT", "DOKMAI", "DOLIUM", "DOLPHIN", "DOMAIN", "DOONG", "DOP", "DOROME", "DORU", "DOTS-1",
+    "DOTS-12", "DOTS-123", "DOTS-1234", "DOTS-12345", "DOTS-123456", "DOTS-1234567", "DOTS-12345678", "DOTS-1234568",
+    "DOTS-123457", "DOTS-1234578", "DOTS-123458", "DOTS-12346", "DOTS-123467", "DOTS-1234678", "DOTS-123468",
+    "DOTS-12347", "DOTS-123478", "DOTS-12348", "DOTS-1235", "DOTS-12356", "DOTS-123567", "DOTS-1235678", "DOTS-123568",
+    "DOTS-12357", "DOTS-123578", "DOTS-12358", "DOTS-1236", "DOTS-12367", "DOTS-123678", "DOTS-12368", "DOTS-1237",
+    "DOTS-12378", "DOTS-1238", "DOTS-124", "DOTS-1245", "DOTS-12456", "DOTS-124567", "DOTS-1245678", "DOTS-124568",
+    "DOTS-12457", "DOTS-124578", "DOTS-12458", "DOTS-1246", "DOTS-12467", "DOTS-124678", "DOTS-12468", "DOTS-1247",
+    "DOTS-12478", "DOTS-1248", "DOTS-125", "DOTS-1256", "DOTS-12567", "DOTS-125678", "DOTS-12568", "DOTS-1257",
+    "DOTS-12578", "DOTS-1258", "DOTS-126", "DOTS-1267", "DOTS-12678", "DOTS-1268", "DOTS-127", "DOTS-1278", "DOTS-128",
+    "DOTS-13", "DOTS-134", "DOTS-1345", "DOTS-13456", "DOTS-134567", "DOTS-1345678", "DOTS-134568", "DOTS-13457",
+    "DOTS-134578", "DOTS-13458", "DOTS-1346", "DOTS-13467", "DOTS-134678", "DOTS-13468", "DOTS-1347", "DOTS-13478",
+    "DOTS-1348", "DOTS-135", "DOTS-1356", "DOTS-13567", "DOTS-135678", "DOTS-13568", "DOTS-1357", "DOTS-13578",
+    "DOTS-1358", "DOTS-136", "DOTS-1367", "DOTS-13678", "DOTS-1368", "DOTS-137", "DOTS-1378", "DOTS-138", "DOTS-14",
+    "DOTS-145", "DOTS-1456", "DOTS-14567", "DOTS-145678", "DOTS-14568", "DOTS-1457", "DOTS-14578", "DOTS-1458",
+    "DOTS-146", "DOTS-1467", "DOTS-14678", "DOTS-1468", "DOTS-147", "DOTS-1478", "DOTS-148", "DOTS-15", "DOTS-156",
+    "DOTS-1567", "DOTS-15678", "DOTS-1568", "DOTS-157", "DOTS-1578", "DOTS-158", "DOTS-16", "DOTS-167", "DOTS-1678",
+    "DOTS-168", "DOTS-17", "DOTS-178", "DOTS-18", "DOTS-2", "DOTS-23", "DOTS-234", "DOTS-2345", "DOTS-23456",
+    "DOTS-234567", "DOTS-2345678", "DOTS-234568", "DOTS-23457", "DOTS-234578", "DOTS-23458", "DOTS-2346", "DOTS-23467",
+    "DOTS-234678", "DOTS-23468", "DOTS-2347", "DOTS-23478", "DOTS-2348", "DOTS-235", "DOTS-2356", "DOTS-23567",
+    "DOTS-235678", "DOTS-23568", "DOTS-2357", "DOTS-23578", "DOTS-2358", "DOTS-236", "DOTS-2367", "DOTS-23678",
+    "DOTS-2368", "DOTS-237", "DOTS-2378", "DOTS-238", "DOTS-24", "DOTS-245", "DOTS-2456", "DOTS-24567", "DOTS-245678",
+    "DOTS-24568", "DOTS-2457", "DOTS-24578", "DOTS-2458", "DOTS-246", "DOTS-2467", "DOTS-24678", "DOTS-2468",
+    "DOTS-247", "DOTS-2478", "DOTS-248", "DOTS-25", "DOTS-256", "DOTS-2567", "DOTS-25678", "DOTS-2568", "DOTS-257",
+    "DOTS-2578", "DOTS-258", "DOTS-26", "DOTS-267", "DOTS-2678", "DOTS-268", "DOTS-27", "DOTS-278", "DOTS-28", "DOTS-3",
+    "DOTS-34", "DOTS-345", "DOTS-3456", "DOTS-34567", "DOTS-345678", "DOTS-34568", "DOTS-3457", "DOTS-34578",
+    "DOTS-3458", "DOTS-346", "DOTS-3467", "DOTS-34678", "DOTS-3468", "DOTS-347", "DOTS-3478", "DOTS-348", "DOTS-35",
+    "DOTS-356", "DOTS-3567", "DOTS-35678", "DOTS-3568", "DOTS-357", "DOTS-3578", "DOTS-358", "DOTS-36", "DOTS-367",
+    "DOTS-3678", "DOTS-368", "DOTS-37", "DOTS-378", "DOTS-38", "DOTS-4", "DOTS-45", "DOTS-456", "DOTS-4567",
+    "DOTS-45678", "DOTS-4568", "DOTS-457", "DOTS-4578", "DOTS-458", "DOTS-46", "DOTS-467", "DOTS-4678", "DOTS-468",
+    "DOTS-47", "DOTS-478", "DOTS-48", "DOTS-5", "DOTS-56", "DOTS-567", "DOTS-5678", "DOTS-568", "DOTS-57", "DOTS-578",
+    "DOTS-58", "DOTS-6", "DOTS-67", "DOTS-678", "DOTS-68", "DOTS-7", "DOTS-78", "DOTS-8", "DOTTED-L", "DOTTED-N",
+    "DOTTED-P", "DOUBLE-ENDED", "DOUBT", "DOUGHNUT", "DOWNSCALING", "DOX", "DRAFTING", "DRIL", "DROMEDARY", "DROOLING",
+    "DROP", "DROPS", "DRUMSTICKS", "DUB2", "DUCK", "DUDA", "DUGUD", "DUH", "DUM", "DUMPLING", "DUN4", "DUO", "DUOX",
+    "DUP", "DUPONDIUS", "DUR", "DUR2", "DURATION", "DURX", "DUSHENNA", "DUSK", "DUT", "DUTIES", "DUX", "DVA", "DVD",
+    "DVISVARA", "DVOECHELNOKRYZHEVAYA", "DVOETOCHIE", "DVUMYA", "DWA", "DWO", "DYAN", "DZAA", "DZAY", "DZHOI", "DZITA",
+    "DZYAY", "DZYI", "DZZA", "E-2", "E-3", "E-4", "E-5", "E-6", "E-MAIL", "E001", "E002", "E003", "E004", "E005",
+    "E006", "E007", "E008", "E008A", "E009", "E009A", "E010", "E011", "E012", "E013", "E014", "E015", "E016", "E016A",
+    "E017", "E017A", "E018", "E019", "E020", "E020A", "E021", "E022", "E023", "E024", "E025", "E026", "E027", "E028",
+    "E028A", "E029", "E030", "E031", "E032", "E033", "E034", "E034A", "E036", "E037", "E038", "EABHADH", "EADHADH",
+    "EAMHANCHOLL", "EARLY", "EASE", "EBEFILI", "EDD", "EDIN", "EDITORIAL", "EEBEEFILI", "EEH", "EEKAA", "EEN",
+    "EEYANNA", "EGGS", "EGIR", "EHWAZ", "EIGHT-THIRTY", "EIGHTIETH", "EIS", "EJECT", "EKAM", "EKARA", "EKS",
+    "EKSTREPTON", "ELAFRON", "ELECTRICAL", "ELECTRONICS", "ELEVATOR", "ELEVATUS", "ELEVEN-THIRTY", "ELF", "ELIF", "ELT",
+    "EMBELLISHMENT", "EMBLEM", "EMBROIDERY", "EMPHATIC", "ENARMONIOS", "ENARXIS", "ENCOUNTERS", "ENDEAVOUR", "ENDEP",
+    "ENDOFONON", "ENLARGEMENT", "ENNI", "ENOS", "ENQUIRY", "ENTERING", "ENTHUSIASM", "ENTRY-1", "ENTRY-2",
+    "ENUMERATION", "EO-EU", "EO-O", "EO-U", "EOH", "EOLHX", "EPEGERMA", "EPOCH", "EQ", "EQUIANGULAR", "EQUID", "ERG",
+    "ERS", "ES-1", "ES-2", "ES-3", "ES-TE", "ESH16", "ESH21", "ESO", "ESS", "ESTIMATED", "ESTIMATES", "ESUKUUDO",
+    "ETHEL", "ETNAHTA", "EU-A", "EU-E", "EU-EO", "EU-EU", "EU-O", "EU-U", "EULER", "EURO-CURRENCY", "EUROPE-AFRICA",
+    "EVENING", "EVERGREEN", "EVERY", "EXCELLENT", "EXCESS", "EXCHANGE", "EXCITEMENT", "EXHALE", "EXHAUSTION", "EXIST",
+    "EXISTS", "EXPLODING", "EXPONENT", "EXPRESSIONLESS", "EXTINGUISHER", "EXTRA", "EXTRATERRESTRIAL", "EYANNA",
+    "EYBEYFILI", "EYEBROW", "EYEGLASSES", "EYYY", "F001", "F001A", "F002", "F003", "F004", "F005", "F006", "F007",
+    "F008", "F009", "F010", "F011", "F012", "F013", "F013A", "F014", "F015", "F016", "F017", "F018", "F019", "F020",
+    "F021", "F021A", "F022", "F023", "F024", "F025", "F026", "F027", "F028", "F029", "F030", "F031", "F031A", "F032",
+    "F033", "F034", "F035", "F036", "F037", "F037A", "F038", "F038A", "F039", "F040", "F041", "F042", "F043", "F044",
+    "F045", "F045A", "F046", "F046A", "F047", "F047A", "F048", "F049", "F050", "F051", "F051A", "F051B", "F051C",
+    "F052", "F053", "FAAFU", "FAAI", "FAAMAE", "FACE-1", "FACE-2", "FACE-3", "FACE-4", "FACE-5", "FACE-6", "FACINGS",
+    "FACSIMILE", "FACTORY", "FAHRENHEIT", "FAIB", "FAIHU", "FAILURE", "FAIRY", "FAJ", "FALAFEL", "FALLEN", "FAM",
+    "FANG", "FAP", "FAQ", "FAR", "FAST", "FAT", "FATIGUE", "FAYANNA", "FEAR", "FEARFUL", "FEARN", "FEBRUARY", "FEEM",
+    "FEENG", "FEHU", "FELLOWSHIP", "FENCER", "FEOH", "FERRIS", "FERRY", "FESTIVAL", "FETH", "FEUFEUAET", "FEUX", "FF",
+    "FFI", "FFL", "FHTORA", "FIGHT", "FIGURE-1", "FIGURE-2", "FIGURE-3", "FII", "FILLED", "FILLER-1", "FILLER-2",
+    "FINGERNAILS", "FINITE", "FIP", "FIRECRACKER", "FIREWORK", "FIREWORKS", "FIRI", "FISHEYE", "FISHING", "FISTED",
+    "FIT", "FIVE-LINE", "FIVE-THIRTY", "FIX", "FL", "FLA", "FLAG-1", "FLAG-2", "FLAG-3", "FLAG-4", "FLAG-5", "FLAGS",
+    "FLAMINGO", "FLASH", "FLATNESS", "FLEUR-DE-LIS", "FLEXED", "FLIGHT", "FLOORPLANE", "FLOWERS", "FLOWING", "FLUSHED",
+    "FM", "FOG", "FOGGY", "FOLDED", "FOLLY", "FON", "FONDUE", "FONGMAN", "FOOL", "FOOTPRINTS", "FOOTSTOOL", "FOP",
+    "FORCE", "FORCES", "FORKING", "FORMATTING", "FORMS", "FORTE", "FORTUNE", "FOSTERING", "FOUR-LINE", "FOUR-PER-EM",
+    "FOUR-STRING", "FOUR-THIRTY", "FRAGMENT", "FRAGRANT", "FRAMES", "FRANC", "FREEZING", "FRICATIVE", "FRIED", "FRIES",
+    "FRONT-FACING", "FUA", "FUEL", "FUET", "FUJI", "FULLNESS", "FUNERAL", "FUP", "FURX", "FUSE", "FUT", "FUX", "FWE",
+    "FY", "FYA", "FYP", "FYT", "FYX", "G001", "G002", "G003", "G004", "G005", "G006", "G006A", "G007", "G007A", "G007B",
+    "G008", "G009", "G010", "G011", "G011A", "G012", "G013", "G014", "G015", "G016", "G017", "G018", "G019", "G020",
+    "G020A", "G021", "G022", "G023", "G024", "G025", "G026", "G026A", "G027", "G028", "G029", "G030", "G031", "G032",
+    "G033", "G034", "G035", "G036", "G036A", "G037", "G037A", "G038", "G039", "G040", "G041", "G042", "G043", "G043A",
+    "G044", "G045", "G045A", "G046", "G047", "G048", "G049", "G050", "G051", "G052", "G053", "G054", "G2", "GAAFU",
+    "GAAHLAA", "GADOL", "GAG", "GAI", "GALAM", "GAM", "GAMAN", "GAML", "GAMLA", "GANDA", "GANMA", "GAR3", "GARDEN",
+    "GARLIC", "GARMENT", "GARON", "GASHAN", "GAT", "GAUNTLET", "GAX", "GB", "GBAKURUNEN", "GBAYI", "GBEN", "GBET",
+    "GBEUX", "GBIEE", "GBON", "GCAN", "GDAN", "GE22", "GEBA", "GEBO", "GEDE", "GEDOLA", "GEEM", "GEM", "GEMINATE",
+    "GEMINI", "GEN", "GENERIC", "GENIE", "GENITIVE", "GENTLE", "GEOMETRIC", "GER", "GERMAN", "GET", "GETA", "GEX", "GG",
+    "GGAA", "GGAP", "GGAT", "GGAX", "GGEE", "GGEP", "GGET", "GGEX", "GGIE", "GGIEP", "GGIEX", "GGIT", "GGIX", "GGOT",
+    "GGOX", "GGUOP", "GGUOT", "GGUOX", "GGUP", "GGUR", "GGURX", "GGUT", "GGUX", "GGWA", "GGWAA", "GGWE", "GGWEE",
+    "GGWI", "GH", "GHAAMAE", "GHAINU", "GHAMAL", "GHAMMA", "GHAP", "GHARAE", "GHAYN", "GHEE", "GHET", "GHEUAEGHEUAE",
+    "GHEUAERAE", "GHEUGHEN", "GHEUGHEUAEM", "GHEUN", "GHEUX", "GHEYS", "GHI", "GHIMEL", "GHOM", "GHOU", "GHU", "GHWA",
+    "GHZ", "GIBA", "GIDIM", "GIE", "GIEP", "GIET", "GIEX", "GIFT", "GIG", "GIGA", "GIMEL-HETH", "GINII", "GIP",
+    "GIRAFFE", "GIRL", "GIRLS", "GIRUDAA", "GISAL", "GIT", "GIX", "GLA", "GLASSES", "GLEICH", "GLOVE", "GLOVES",
+    "GLOWING", "GN", "GNAVIYANI", "GOA", "GOAT", "GOBLIN", "GOGGLES", "GOING", "GOK", "GOLFER", "GONG", "GOO", "GOOD",
+    "GOP", "GORA", "GORGOSYNTHETON", "GORGOTERI", "GORILLA", "GORT", "GOX", "GPA", "GRADUAL", "GRADUATION", "GRAF",
+    "GRAIN", "GRAMMA", "GRAPES", "GRAPHEME", "GRATER", "GRAVE-ACUTE-GRAVE", "GRAVE-MACRON", "GRAVEYARD", "GREATNESS",
+    "GRIMACING", "GRONTHISMATA", "GROWING", "GUA", "GUAN", "GUARANI", "GUARDEDNESS", "GUARDSMAN", "GUEI", "GUIDE",
+    "GUITAR", "GUO", "GUOP", "GUOT", "GUOX", "GUP", "GURAMU", "GURAMUTON", "GURUN", "GURUSH", "GURX", "GUT", "GUX",
+    "GVANG", "GW", "GWAA", "GWU", "GY", "GYA", "GYAA", "GYAN", "GYE", "GYEE", "GYFU", "GYI", "GYO", "GYU", "H-TYPE",
+    "H001", "H002", "H003", "H004", "H005", "H006", "H006A", "H007", "H008", "HA-1", "HA-10", "HA-11", "HA-2", "HA-3",
+    "HA-4", "HA-5", "HA-6", "HA-7", "HA-8", "HA-9", "HA-HA", "HAAM", "HAARU", "HADES", "HAEGL", "HAFUKH", "HAFUKHA",
+    "HAGL", "HAGLAZ", "HAI", "HAIRCUT", "HAIS", "HAITU", "HALBERD", "HALF-1", "HALF-2", "HALO", "HALQA", "HAM",
+    "HAMBURGER", "HAMSA", "HAMSTER", "HAN-AKAT", "HANDBAG", "HANDBALL", "HANDLES", "HANDSHAKE", "HANG", "HAO", "HAP",
+    "HAPPY", "HARBAHAY", "HARDNESS", "HARMONIC", "HASER", "HATCHING", "HATHI", "HAUPTSTIMME", "HAWJ", "HAX", "HAY",
+    "HAYANNA", "HBASA-ESASA", "HC", "HDR", "HE-1", "HE-2", "HE-3", "HE-4", "HE-5", "HE-6", "HE-7", "HE-GOAT",
+    "HEAD-BANDAGE", "HEADING", "HEADPHONE", "HEADSCARF", "HEAR-NO-EVIL", "HEARING", "HEAVENLY", "HEDGEHOG", "HEEI",
+    "HEIGHT", "HEISEI", "HEKUTAARU", "HELICOPTER", "HELIX", "HELLSCHREIBER", "HELM", "HEMP", "HEP", "HERAEUM", "HERB",
+    "HERMES", "HERMITIAN", "HERUTU", "HEX", "HEXIFORM", "HEYT", "HHE", "HHEE", "HHI", "HHO", "HHU", "HHWE", "HHWEE",
+    "HHWI", "HHYA", "HHYAA", "HHYE", "HHYEE", "HHYI", "HHYO", "HHYU", "HI-1", "HI-2", "HI-3", "HI-4", "HI-5", "HI-6",
+    "HI-7", "HI-RES", "HIBISCUS", "HIDE", "HIDET", "HIDING", "HIEUH-MIEUM", "HIEUH-NIEUN", "HIEUH-PIEUP", "HIEUH-RIEUL",
+    "HIEUH-SIOS", "HIEX", "HIGH-HEELED", "HIGH-LOW", "HIKING", "HINDU", "HIPPOPOTAMUS", "HISTORIC", "HIZB", "HK", "HL",
+    "HLAP", "HLAT", "HLAU", "HLAX", "HLE", "HLEP", "HLEX", "HLIE", "HLIEP", "HLIEX", "HLIP", "HLIT", "HLIX", "HLO",
+    "HLOP", "HLOX", "HLU", "HLUO", "HLUOP", "HLUOX", "HLUP", "HLUR", "HLURX", "HLUT", "HLUX", "HLY", "HLYP", "HLYR",
+    "HLYRX", "HLYT", "HLYX", "HM", "HMA", "HMAP", "HMAT", "HMAX", "HME", "HMI", "HMIE", "HMIEP", "HMIEX", "HMIP",
+    "HMIT", "HMIX", "HMOP", "HMOT", "HMOX", "HMU", "HMUO", "HMUOP", "HMUOX", "HMUP", "HMUR", "HMURX", "HMUT", "HMUX",
+    "HMY", "HMYP", "HMYR", "HMYRX", "HMYX", "HNAP", "HNAT", "HNAU", "HNAX", "HNE", "HNEP", "HNEX", "HNI", "HNIE",
+    "HNIEP", "HNIET", "HNIEX", "HNIP", "HNIT", "HNIX", "HNOP", "HNOT", "HNOX", "HNUB", "HNUO", "HNUOX", "HNUT", "HO-1",
+    "HO-2", "HO-3", "HO-4", "HO-5", "HO-6", "HO-7", "HO-8", "HOA", "HOCHO", "HOI", "HOKA", "HOM", "HONEY", "HONEYBEE",
+    "HOON", "HOOP", "HOORU", "HOOU", "HOP", "HORIZONTAL-00-00", "HORIZONTAL-00-01", "HORIZONTAL-00-02",
+    "HORIZONTAL-00-03", "HORIZONTAL-00-04", "HORIZONTAL-00-05", "HORIZONTAL-00-06", "HORIZONTAL-01-00",
+    "HORIZONTAL-01-01", "HORIZONTAL-01-02", "HORIZONTAL-01-03", "HORIZONTAL-01-04", "HORIZONTAL-01-05",
+    "HORIZONTAL-01-06", "HORIZONTAL-02-00", "HORIZONTAL-02-01", "HORIZONTAL-02-02", "HORIZONTAL-02-03",
+    "HORIZONTAL-02-04", "HORIZONTAL-02-05", "HORIZONTAL-02-06", "HORIZONTAL-03-00", "HORIZONTAL-03-01",
+    "HORIZONTAL-03-02", "HORIZONTAL-03-03", "HORIZONTAL-03-04", "HORIZONTAL-03-05", "HORIZONTAL-03-06",
+    "HORIZONTAL-04-00", "HORIZONTAL-04-01", "HORIZONTAL-04-02", "HORIZONTAL-04-03", "HORIZONTAL-04-04",
+    "HORIZONTAL-04-05", "HORIZONTAL-04-06", "HORIZONTAL-05-00", "HORIZONTAL-05-01", "HORIZONTAL-05-02",
+    "HORIZONTAL-05-03", "HORIZONTAL-05-04", "HORIZONTAL-05-05", "HORIZONTAL-05-06", "HORIZONTAL-06-00",
+    "HORIZONTAL-06-01", "HORIZONTAL-06-02", "HORIZONTAL-06-03", "HORIZONTAL-06-04", "HORIZONTAL-06-05",
+    "HORIZONTAL-06-06", "HORIZONTALLY", "HOSPITAL", "HOTA", "HOX", "HOY", "HPA", "HPWG", "HRYVNIA", "HTTA", "HU-1",
+    "HU-2", "HU-3", "HUAN", "HUARADDO", "HUB", "HUIITO", "HUK", "HUL2", "HUNG", "HUO", "HUOP", "HUOT", "HUOX", "HURAN",
+    "HUSH", "HUSHED", "HUT", "HUVA", "HWA", "HWAH", "HWEE", "HWI", "HWO", "HWU", "HXA", "HXAP", "HXAT", "HXAX", "HXE",
+    "HXEP", "HXEX", "HXI", "HXIE", "HXIEP", "HXIET", "HXIEX", "HXIP", "HXIX", "HXO", "HXOT", "HXOX", "HXUOP", "HXUOT",
+    "HXUOX", "HXWG", "HYGIEA", "HYGIEIA", "HYPODIASTOLE", "HYSTERESIS", "HZG", "HZT", "HZW", "HZWG", "HZZ", "HZZP",
+    "HZZZ", "HZZZG", "I-1", "I-2", "I-3", "I-4", "I-A", "I-ARAEA", "I-BEAM", "I-EU", "I-I", "I-O", "I-O-I", "I-U",
+    "I-YA", "I-YA-O", "I-YAE", "I-YE", "I-YEO", "I-YO", "I-YU", "I001", "I002", "I003", "I004", "I005", "I005A", "I006",
+    "I007", "I008", "I009", "I009A", "I010", "I010A", "I011", "I011A", "I012", "I013", "I014", "I015", "IANG",
+    "IBIFILI", "ICELANDIC-YR", "ICHADIN", "ICHOU", "ID", "IDEOGRAPH-4E00", "IDEOGRAPH-4E2D", "IDEOGRAPH-4EA4",
+    "IDEOGRAPH-518D", "IDEOGRAPH-521D", "IDEOGRAPH-524D", "IDEOGRAPH-5272", "IDEOGRAPH-52DD", "IDEOGRAPH-53CC",
+    "IDEOGRAPH-53F3", "IDEOGRAPH-5408", "IDEOGRAPH-5439", "IDEOGRAPH-55B6", "IDEOGRAPH-58F0", "IDEOGRAPH-591A",
+    "IDEOGRAPH-5929", "IDEOGRAPH-5B57", "IDEOGRAPH-5B89", "IDEOGRAPH-5DE6", "IDEOGRAPH-5F8C", "IDEOGRAPH-624B",
+    "IDEOGRAPH-6295", "IDEOGRAPH-6307", "IDEOGRAPH-6355", "IDEOGRAPH-6557", "IDEOGRAPH-6599", "IDEOGRAPH-65B0",
+    "IDEOGRAPH-6620", "IDEOGRAPH-6708", "IDEOGRAPH-6709", "IDEOGRAPH-672C", "IDEOGRAPH-6E80", "IDEOGRAPH-6F14",
+    "IDEOGRAPH-70B9", "IDEOGRAPH-7121", "IDEOGRAPH-751F", "IDEOGRAPH-7533", "IDEOGRAPH-76D7", "IDEOGRAPH-7981",
+    "IDEOGRAPH-7A7A", "IDEOGRAPH-7D42", "IDEOGRAPH-89E3", "IDEOGRAPH-8CA9", "IDEOGRAPH-8D70", "IDEOGRAPH-904A",
+    "IDEOGRAPH-914D", "IDLE", "IEP", "IET", "IEUNG-CHIEUCH", "IEUNG-CIEUC", "IEUNG-HIEUH", "IEUNG-KHIEUKH",
+    "IEUNG-MIEUM", "IEUNG-PANSIOS", "IEUNG-PHIEUPH", "IEUNG-PIEUP", "IEUNG-RIEUL", "IEUNG-SIOS", "IEUNG-SSANGKIYEOK",
+    "IEUNG-THIEUTH", "IEUNG-TIKEUT", "IEX", "IF", "IFIN", "IGGWS", "IIYANNA", "IL2", "ILIMMU3", "ILIMMU4", "ILUT",
+    "ILUUYANNA", "ILUY", "ILUYANNA", "IMAALA", "IMIDIARGON", "IMIFONON", "IMIFTHORA", "IMIFTHORON", "IMIN3", "IMISEOS",
+    "IMN", "IMP", "IN-ALAF", "INAP", "INBOX", "INCH", "INCLUDING", "INCOMING", "INCOMPLETE", "INCREASES", "INCREMENT",
+    "INDIAN", "INDICTION", "INDIRECT", "INDUSTRIAL", "INFLUENCE", "INGWAZ", "INHALE", "ININGU", "INK", "INN", "INNN",
+    "INNOCENCE", "INSECT", "INTERCALATE", "INTEREST", "INTERLOCKED", "INTERSYLLABIC", "INTI", "INVERTEBRATE", "INY",
+    "INYA", "IODHADH", "IONG", "IOR", "IP", "IRB", "IRI", "IRON-COPPER", "IRUUYANNA", "IRUYANNA", "ISAKIA", "ISAZ",
+    "ISEN-ISEN", "ISHMAAM", "ISLAND", "ISS", "ITEM", "ITS", "IUJA", "IWAZ", "IWN", "IYANNA", "IZ", "IZAKAYA",
+    "JACK-O-LANTERN", "JACKS", "JAH", "JAIN", "JALL", "JALLAJALALOUHOU", "JANUARY", "JAPAN", "JAVIYANI", "JAYIN",
+    "JAYN", "JEANS", "JER", "JERA", "JERAN", "JERUSALEM", "JEU", "JHAA", "JHAM", "JHAYIN", "JHO", "JHOX", "JIA", "JIE",
+    "JIEP", "JIET", "JIEX", "JIGSAW", "JIP", "JIT", "JIX", "JJE", "JJEE", "JJIEP", "JJIET", "JJIEX", "JJIP", "JJIT",
+    "JJIX", "JJOP", "JJOT", "JJOX", "JJUO", "JJUOP", "JJUOX", "JJUP", "JJUR", "JJURX", "JJUX", "JJYP", "JJYT", "JJYX",
+    "JOA", "JOINTS", "JONG", "JOP", "JOVE", "JOX", "JOYOUS", "JOYSTICK", "JUDEO-SPANISH", "JUDGE", "JUDUL", "JUEUI",
+    "JUGGLING", "JULY", "JUNE", "JUNO", "JUO", "JUOP", "JUOT", "JUOX", "JUP", "JUPITER", "JUR", "JURX", "JUT", "JUU",
+    "JUX", "JY", "JYP", "JYR", "JYRX", "JYT", "JYX", "K001", "K002", "K003", "K004", "K005", "K006", "K007", "K008",
+    "K2", "KA-1", "KA-10", "KA-11", "KA-2", "KA-3", "KA-4", "KA-5", "KA-6", "KA-7", "KA-8", "KA-9", "KA-KE", "KAAB",
+    "KAABA", "KAACU", "KAAFU", "KAAI", "KAAN", "KAANKUU", "KAAV", "KACHKA", "KAD", "KAD4", "KAFA", "KAIB", "KAIRI",
+    "KAIV", "KAKABAT", "KAM", "KAM2", "KAM4", "KANAKO", "KANGAROO", "KANTAJA", "KAPAL", "KAPO", "KAQ", "KAR", "KARAN",
+    "KARATTO", "KAROR", "KARORAN", "KARORII", "KARSHANA", "KAT", "KATAVA", "KATAVASMA", "KATHISTI", "KAUB", "KAUN",
+    "KAUNA", "KAUV", "KAV", "KAWB", "KAWI", "KAWV", "KAX", "KB", "KCAL", "KE-1", "KE-2", "KE-3", "KE-4", "KE-5", "KE-6",
+    "KEAAE", "KEB", "KEEB", "KEENG", "KEESU", "KEEV", "KEFULA", "KELVIN", "KEMBANG", "KEMPHRENG", "KENAT", "KEOW",
+    "KEP", "KERET", "KES", "KEUAE", "KEUAEM", "KEUAERI", "KEUAETMEUN", "KEUKAQ", "KEUKEUTNDA", "KEUOT", "KEUP",
+    "KEUPUQ", "KEUSEUX", "KEUSHEUAEP", "KEUYEUX", "KEV", "KEX", "KHAB", "KHAF", "KHAMILO", "KHAN", "KHANDA", "KHAV",
+    "KHEE", "KHETH", "KHIT", "KHITAN", "KHOMUT", "KHON", "KHONNA", "KHOT", "KHOU", "KHU", "KHUAT", "KHUDAM",
+    "KHUEN-LUE", "KHWAI", "KHZ", "KI-1", "KI-2", "KI-3", "KI-4", "KI-5", "KI-6", "KI-7", "KI-8", "KIAB", "KIAV", "KIB",
+    "KICK", "KIE", "KIEEM", "KIEP", "KIEX", "KIH", "KII", "KIIZH", "KILLER", "KIMONO", "KINDERGARTEN", "KINSHIP", "KIQ",
+    "KIRO", "KIROGURAMU", "KIROMEETORU", "KIROWATTO", "KISAL", "KISH", "KITE", "KIV", "KIW", "KIWIFRUIT", "KIX",
+    "KIYEOK-CHIEUCH", "KIYEOK-HIEUH", "KIYEOK-KHIEUKH", "KIYEOK-NIEUN", "KIYEOK-PIEUP", "KIYEOK-RIEUL",
+    "KIYEOK-SIOS-KIYEOK", "KIYEOK-TIKEUT", "KKE", "KKEE", "KKI", "KKO", "KKU", "KL", "KLA", "KLITON",
+    "KLYUCHENEPOSTOYANNY", "KLYUCHEPOVODNAYA", "KLYUCHEPOVODNY", "KLYUCHEVOY", "KNEELING", "KNOBS", "KNOT", "KO-1",
+    "KO-2", "KO-3", "KO-KI", "KOA", "KOALA", "KOB", "KOBYLA", "KOGHOM", "KOH", "KOINI", "KOKE", "KOKO", "KOMBU", "KOOB",
+    "KOOMUUT", "KOOPO", "KOOV", "KOP", "KOQNDON", "KORON", "KORUNA", "KOT", "KOUFISMA", "KOV", "KOVUU", "KOX", "KPAH",
+    "KPAN", "KPARAQ", "KPEN", "KPEUX", "KPOQ", "KRA", "KRATIMATA", "KRATIMOKOUFISMA", "KRATIMOYPORROON", "KREMASTI",
+    "KRONOS", "KRYZHEVAYA", "KT", "KU-1", "KU-2", "KU-3", "KU-4", "KU-5", "KU-6", "KU-7", "KU7", "KUA", "KUAB", "KUAV",
+    "KUB", "KUET", "KUFISMA", "KUG", "KUNDDALIYA", "KUNG", "KUO", "KUOM", "KUOQ", "KUOX", "KUP", "KUPNAYA", "KUQ",
+    "KUROONE", "KURT", "KURUNI", "KURUZEIRO", "KURX", "KUSMA", "KUUH", "KUV", "KUX", "KUZHI", "KV", "KWAET", "KWAY",
+    "KWB", "KWM", "KWU318", "KWV", "KXAA", "KXE", "KXEE", "KXI", "KXO", "KXU", "KXWA", "KXWAA", "KXWE", "KXWEE", "KXWI",
+    "KYAA", "KYATHOS", "KYE", "KYI", "KYLISMA", "KYO", "KYU", "KYURII", "L-TYPE", "L001", "L002", "L002A", "L003",
+    "L004", "L005", "L006", "L006A", "L007", "L008", "L2", "L3", "L4", "L6", "LAAI", "LAAMU", "LAAN", "LAANAE", "LAB",
+    "LABAT", "LABEL", "LABIALIZATION", "LABOURING", "LACA", "LACK", "LACROSSE", "LADDER", "LADY", "LAEV", "LAGU",
+    "LAGUS", "LAH", "LAHSHU", "LAJANYALAN", "LAK-003", "LAK-020", "LAK-021", "LAK-025", "LAK-030", "LAK-051", "LAK-062",
+    "LAK-080", "LAK-092", "LAK-130", "LAK-142", "LAK-210", "LAK-219", "LAK-220", "LAK-225", "LAK-228", "LAK-238",
+    "LAK-265", "LAK-266", "LAK-343", "LAK-347", "LAK-348", "LAK-383", "LAK-384", "LAK-390", "LAK-441", "LAK-450",
+    "LAK-457", "LAK-470", "LAK-483", "LAK-490", "LAK-492", "LAK-493", "LAK-495", "LAK-550", "LAK-608", "LAK-636",
+    "LAK-668", "LAK-724", "LAK-749", "LAKHAN", "LAKKHANGYAO", "LAMADH", "LAMBDA", "LAMD", "LAND", "LANGUAGE", "LANTERN",
+    "LAPAQ", "LAQ", "LARI", "LARYNGEAL", "LAT", "LATE", "LATIK", "LAU", "LAUGHING", "LAUJ", "LAUKAZ", "LAX", "LAY",
+    "LAYAR", "LCI", "LD", "LD2", "LDAN", "LEAD", "LEADING", "LEAFY", "LEDGER", "LEEK", "LEFT-HANDED", "LEFT-LIGHTED",
+    "LEFT-SIDE", "LEGION", "LEGS", "LEI", "LEMOI", "LEMON", "LENGTH-1", "LENGTH-2", "LENGTH-3", "LENGTH-4", "LENGTH-5",
+    "LENGTH-6", "LENGTH-7", "LEO", "LEOPARD", "LEP", "LESS", "LEUAEM", "LEUAEP", "LEUM", "LEVEL-2", "LEVEL-3",
+    "LEVITATING", "LEX", "LHAG", "LHAVIYANI", "LHE", "LHEE", "LHII", "LHOO", "LHU", "LHYA", "LIABILITY", "LIBERTY",
+    "LIBRA", "LICKING", "LIEE", "LIEP", "LIET", "LIEX", "LIFE", "LIFTER", "LIGATING", "LIGHTHOUSE", "LII", "LIL",
+    "LILITH", "LILY", "LIMBS", "LIME", "LIMIT", "LIMITATION", "LIMITED", "LIMMU2", "LIMMU4", "LINE-1", "LINE-3",
+    "LINE-7", "LINE-9", "LINGSA", "LINKED", "LINKING", "LION", "LIPSTICK", "LIQ", "LIS", "LIT", "LITRA", "LIVRE", "LIX",
+    "LIZARD", "LLAMA", "LLE", "LLHA", "LLL", "LM", "LN", "LOA", "LOBSTER", "LOCATION-FLOORPLANE", "LOCATION-WALLPLANE",
+    "LOCATIVE", "LODESTONE", "LOG", "LOGR", "LOLL", "LOLLIPOP", "LOMKA", "LOMMAE", "LONG-BRANCH-AR",
+    "LONG-BRANCH-HAGALL", "LONG-BRANCH-MADR", "LONG-BRANCH-OSS", "LONG-BRANCH-SOL", "LONG-BRANCH-YR", "LONG-LEGGED",
+    "LOOK", "LOON", "LOP", "LORRAINE", "LORRY", "LOS", "LOSSLESS", "LOT", "LOTION", "LOUDLY", "LOUDSPEAKER", "LOURE",
+    "LOW-MID", "LOW-REVERSED-9", "LOX", "LUAEP", "LUB", "LUHUR", "LUIS", "LUNGS", "LUNGSI", "LUO", "LUOP", "LUOT",
+    "LUOX", "LUP", "LUR", "LURX", "LUS", "LUT", "LUX", "LX", "LYA", "LYGISMA", "LYING", "LYIT", "LYP", "LYRX", "LYT",
+    "LYX", "LYY", "M001A", "M001B", "M003A", "M010A", "M012A", "M012B", "M012C", "M012D", "M012E", "M012F", "M012G",
+    "M012H", "M015A", "M016A", "M017A", "M022A", "M024A", "M028A", "M031A", "M033A", "M033B", "M040A", "M045", "M046",
+    "M047", "M048", "M049", "M050", "M051", "M052", "M053", "M054", "M055", "M056", "M057", "M058", "M059", "M060",
+    "M061", "M062", "M063", "M064", "M065", "M066", "M067", "M068", "M069", "M070", "M071", "M072", "M073", "M074",
+    "M075", "M076", "M077", "M078", "M079", "M080", "M081", "M082", "M083", "M084", "M085", "M086", "M087", "M088",
+    "M089", "M090", "M091", "M092", "M093", "M094", "M095", "M096", "M097", "M098", "M099", "M100", "M101", "M102",
+    "M103", "M104", "M105", "M106", "M107", "M108", "M109", "M110", "M111", "M112", "M113", "M114", "M115", "M116",
+    "M117", "M118", "M119", "M120", "M121", "M122", "M123", "M124", "M125", "M126", "M127", "M128", "M129", "M130",
+    "M131", "M132", "M133", "M134", "M135", "M136", "M137", "M138", "M139", "M140", "M141", "M142", "M143", "M144",
+    "M145", "M146", "M147", "M148", "M149", "M150", "M151", "M152", "M153", "M154", "M155", "M156", "M157", "M158",
+    "M159", "M160", "M161", "M162", "M163", "M164", "M165", "M166", "M167", "M168", "M169", "M170", "M171", "M172",
+    "M173", "M174", "M175", "M176", "M177", "M178", "M179", "M180", "M181", "M182", "M183", "M184", "M185", "M186",
+    "M187", "M188", "M189", "M190", "M191", "M192", "M193", "M194", "M195", "M196", "M197", "MA-1", "MA-2", "MA-3",
+    "MA-4", "MA-5", "MA-6", "MA-7", "MA2", "MAAI", "MAAYYAA", "MACRON-ACUTE", "MACRON-BREVE", "MACRON-GRAVE", "MADU",
+    "MADYA", "MAEKEUP", "MAELEE", "MAEMBGBIEE", "MAEMGBIEE", "MAEMKPEN", "MAEMVEUX", "MAENJET", "MAENYI", "MAGE",
+    "MAGIC", "MAGNET", "MAHAPAKH", "MAHHA", "MAIDEN", "MAIKURO", "MAIMALAI", "MAIMUAN", "MAIRU", "MAITAIKHU",
+    "MAIYAMOK", "MAIZE", "MALEERI", "MALTESE", "MAMMOTH", "MANACLES", "MANAT", "MANGALAM", "MANGO", "MANNA", "MANNAZ",
+    "MANS", "MANSUAE", "MANSYON", "MANTELPIECE", "MANUAL", "MAO", "MAPLE", "MAQAF", "MARCASITE", "MARCATO",
+    "MARCATO-STACCATO", "MARCH", "MARE", "MARK-4", "MARKS", "MARRATAN", "MARRIAGE", "MARRYING", "MARTIAL", "MARUKU",
+    "MARWARI", "MARY", "MASCULINE", "MASHFAAT", "MASORA", "MASSAGE", "MASSING", "MASU", "MAT", "MATE", "MATERIALS",
+    "MATRIX", "MATTOCK", "MAU", "MAX", "MAXIMA", "MAXIMIZE", "MAYANNA", "MB2", "MB3", "MB4", "MBAAKET", "MBAARAE",
+    "MBAQ", "MBEEKEET", "MBERAE", "MBEURI", "MBEUX", "MBIRIEEN", "MBUAE", "MBUAEM", "MBUE", "MBUO", "MBUOQ", "MBUU",
+    "MD", "ME-1", "ME-2", "ME-MA", "MED", "MEDICAL", "MEDICINE", "MEEMU", "MEETORU", "MEGALI", "MEGAPHONE", "MEGATON",
+    "MEIZI", "MELIK", "MELODIC", "MELTING", "MEMBERSHIP", "MEMO", "MENDUT", "MENOE", "MENORAH", "MENS", "MERI",
+    "MERIDIANS", "MERPERSON", "MESI", "MESSENIAN", "META", "METEG", "METEK", "METOBELUS", "METRETES", "METRIA", "METRO",
+    "MEUNJOMNDEUQ", "MEUQ", "MEX", "MEZZO", "MFAA", "MFEUAE", "MFEUQ", "MFEUT", "MFIEE", "MFIYAQ", "MFO", "MG", "MGA",
+    "MGAP", "MGAT", "MGAX", "MGBASA", "MGBASAQ", "MGBE", "MGBEE", "MGBEN", "MGBEUN", "MGBI", "MGBIEE", "MGBO",
+    "MGBOFUM", "MGBOO", "MGBU", "MGE", "MGEP", "MGEX", "MGIE", "MGIEX", "MGOP", "MGOT", "MGOX", "MGU", "MGUO", "MGUOP",
+    "MGUOX", "MGUP", "MGUR", "MGURX", "MGUT", "MGUX", "MH", "MHZ", "MI-1", "MI-2", "MI-3", "MI-4", "MI-5", "MI-6",
+    "MI-7", "MICRO", "MICROBE", "MICROSCOPE", "MIE", "MIEP", "MIEUM-CHIEUCH", "MIEUM-CIEUC", "MIEUM-HIEUH",
+    "MIEUM-NIEUN", "MIEUM-PIEUP-SIOS", "MIEUM-RIEUL", "MIEUM-SSANGNIEUN", "MIEUM-SSANGSIOS", "MIEUM-TIKEUT", "MIEX",
+    "MII", "MIIN", "MIKRI", "MIKRON", "MIKURON", "MIL", "MILK", "MILKY", "MILL", "MILLET", "MIME", "MINIBUS",
+    "MINIDISC", "MINIMIZE", "MINISTER", "MINUS-OR-PLUS", "MINY", "MIP", "MIRED", "MIRI", "MIRIBAARU", "MISRA", "MIX",
+    "MKPARAQ", "ML", "MNYAM", "MO-1", "MO-2", "MO-3", "MO-4", "MO-5", "MO-6", "MOA", "MODE", "MODEL", "MODELS", "MODEM",
+    "MODERN", "MODESTY", "MODIFIER-10", "MODIFIER-11", "MODIFIER-12", "MODIFIER-13", "MODIFIER-14", "MODIFIER-15",
+    "MODIFIER-16", "MODIFIER-7", "MODIFIER-8", "MODIFIER-9", "MODULO", "MOHAMMAD", "MOKHASSAS", "MOL", "MONEY-MOUTH",
+    "MONGKEUAEQ", "MONI", "MONOCLE", "MONORAIL", "MONOSTABLE", "MONSTER", "MONTIEEN", "MOOMEUT", "MOOMPUQ",
+    "MOOSE-CREE", "MORNING", "MORPHOLOGICAL", "MORTUUM", "MOSQUE", "MOSQUITO", "MOT", "MOTORCYCLE", "MOTORIZED",
+    "MOTORWAY", "MOUNT", "MOUNTAINS", "MOVED", "MOVES", "MOVIE", "MOX", "MOYAI", "MQ", "MR", "MRACHNO",
+    "MRACHNOTIKHAYA", "MRACHNY", "MS", "MU-1", "MU-2", "MU-3", "MU-4", "MU-GAAHLAA", "MUAS", "MUE", "MUEN", "MUGS",
+    "MUIN", "MUKHA", "MUKKURUNI", "MUKPHRENG", "MULTI", "MULTIOCULAR", "MUM", "MUN", "MUNAH", "MUNSUB", "MUO", "MUOMAE",
+    "MUOP", "MUOT", "MUOX", "MUP", "MUQDAM", "MUR", "MURE", "MURGU2", "MURX", "MUS", "MUSHROOM", "MUT", "MUTHALIYA",
+    "MUUSIKATOAN", "MUUVUZHAKKU", "MUX", "MVEUAENGAM", "MVI", "MX", "MYP", "MYT", "MYX", "MZ", "N-MU-MO-1", "N-MU-MO-2",
+    "N001", "N002", "N003", "N004", "N005", "N006", "N007", "N008", "N009", "N010", "N011", "N012", "N013", "N014",
+    "N015", "N016", "N017", "N018", "N018A", "N018B", "N019", "N020", "N021", "N022", "N023", "N024", "N025", "N025A",
+    "N026", "N027", "N028", "N029", "N030", "N031", "N032", "N033", "N033A", "N034", "N034A", "N035", "N035A", "N036",
+    "N037", "N037A", "N038", "N039", "N040", "N041", "N042", "NA-1", "NA-3", "NA-4", "NA-5", "NA-6", "NA-7", "NA-8",
+    "NA-9", "NA4", "NAAI", "NAAKSIKYAYA", "NAGAR", "NAIL", "NAIRA", "NAN", "NAND", "NANGMONTHO", "NANO", "NANSANAQ",
+    "NAOS", "NAP", "NAU", "NAUD", "NAUDIZ", "NAUSEATED", "NAUTHS", "NAX", "NAXIAN", "NAY", "NAZAR", "NBA", "NBAP",
+    "NBAT", "NBAX", "NBI", "NBIEP", "NBIEX", "NBIP", "NBIT", "NBIX", "NBO", "NBOP", "NBOT", "NBOX", "NBU", "NBUP",
+    "NBUR", "NBURX", "NBUT", "NBUX", "NBY", "NBYP", "NBYR", "NBYRX", "NBYT", "NBYX", "NCA", "NCHAU", "ND",
+    "NDAANGGEUAET", "NDAT", "NDAX", "NDEP", "NDEUAEREE", "NDEUT", "NDEUX", "NDEX", "NDIAQ", "NDIDA", "NDIE", "NDIEX",
+    "NDIP", "NDIQ", "NDIT", "NDIX", "NDOMBU", "NDON", "NDOP", "NDOT", "NDOX", "NDUN", "NDUP", "NDUR", "NDURX", "NDUT",
+    "NDUX", "NE-1", "NE-3", "NE-4", "NE-5", "NE-6", "NE-KO", "NEBENSTIMME", "NECKTIE", "NEEDLE", "NEGATION", "NEL",
+    "NEMKA", "NENANO", "NEP", "NERD", "NESSUS", "NESTING", "NETWORKED", "NEUTER", "NEX", "NEXT", "NF", "NGAAI", "NGAH",
+    "NGAI", "NGAN", "NGANGU", "NGAP", "NGAQ", "NGAT", "NGAX", "NGEADAL", "NGEP", "NGEUREUT", "NGEX", "NGG", "NGGAA",
+    "NGGAAMAE", "NGGAP", "NGGEEEE", "NGGEET", "NGGEU", "NGGEUAE", "NGGEUX", "NGGUA", "NGGUAEN", "NGGUAESHAE", "NGGUEET",
+    "NGGUM", "NGGUOM", "NGGUON", "NGGUP", "NGGURAE", "NGGWAEN", "NGIE", "NGIEP", "NGIEX", "NGII", "NGKAAMI", "NGKAP",
+    "NGKAQ", "NGKEUAEM", "NGKEUAEQ", "NGKEURI", "NGKEUX", "NGKIEE", "NGKINDI", "NGKUENZEUM", "NGKUM", "NGKUN", "NGKUP",
+    "NGKYEE", "NGOO", "NGOQ", "NGOT", "NGOX", "NGU", "NGUAE", "NGUAET", "NGUAN", "NGUE", "NGUN", "NGUO", "NGUOT",
+    "NGUOX", "NGVE", "NGYE", "NH", "NHAY", "NHJA", "NHUE", "NI-1", "NI-2", "NI-3", "NI-4", "NI-5", "NI-6", "NI-7",
+    "NI-TE", "NI2", "NIA", "NIE", "NIEP", "NIEUN-CHIEUCH", "NIEUN-PIEUP", "NIEUN-RIEUL", "NIEUN-THIEUTH", "NIEX",
+    "NIGGAHITA", "NIGIDAESH", "NIGIDAMIN", "NIHSHVASA", "NIKA", "NIKAHIT", "NIKHAHIT", "NIN9", "NINE-THIRTY", "NINJA",
+    "NINTH", "NION", "NIP", "NIRUGU", "NISAG", "NIT", "NITRE", "NIX", "NJAA", "NJAP", "NJAQ", "NJEEEE", "NJEUAEM",
+    "NJEUAENA", "NJEUT", "NJIE", "NJIEE", "NJIEP", "NJIET", "NJIEX", "NJIP", "NJIT", "NJIX", "NJOP", "NJOT", "NJOX",
+    "NJUO", "NJUOX", "NJUP", "NJUQA", "NJUR", "NJURX", "NJUX", "NJY", "NJYP", "NJYR", "NJYRX", "NJYT", "NJYX", "NKA",
+    "NKAU", "NKINDI", "NKOM", "NL001", "NL002", "NL003", "NL004", "NL005", "NL005A", "NL006", "NL007", "NL008", "NL009",
+    "NL010", "NL011", "NL012", "NL013", "NL014", "NL015", "NL016", "NL017", "NL017A", "NL018", "NL019", "NL020", "NLAU",
+    "NM", "NNAA", "NNE", "NNG", "NNGA", "NNGAA", "NNGI", "NNGII", "NNGO", "NNGOO", "NNHA", "NNO", "NNYA", "NO-1",
+    "NO-2", "NO-3", "NO-4", "NO-5", "NOA", "NOKHUK", "NOMINAL", "NOMISMA", "NON", "NON-BREAKING", "NON-JOINER",
+    "NON-POTABLE", "NONFORKING", "NOONU", "NOP", "NORDIC", "NORTHEAST-POINTING", "NORTHWEST", "NOTTO", "NOVEMBER",
+    "NOVILE", "NOWC", "NOX", "NOY", "NPA", "NPLA", "NQA", "NQIG", "NRAP", "NRAT", "NRAX", "NRE", "NREP", "NRES", "NRET",
+    "NREX", "NRO", "NROP", "NROX", "NRU", "NRUA", "NRUP", "NRUR", "NRURX", "NRUT", "NRUX", "NRY", "NRYP", "NRYR",
+    "NRYRX", "NRYT", "NRYX", "NS", "NSA", "NSEN", "NSEUAEN", "NSHAQ", "NSHEE", "NSHUE", "NSHUET", "NSHUOP", "NSIEEP",
+    "NSIEET", "NSOM", "NSUM", "NSUN", "NSUOT", "NTA", "NTEN", "NTEUNGBA", "NTHAU", "NTIEE", "NTOQPEN", "NTSA", "NTSAU",
+    "NTU", "NTUJ", "NTUM", "NTXA", "NTXIV", "NU-1", "NU-2", "NU-3", "NU001", "NU002", "NU003", "NU004", "NU005",
+    "NU006", "NU007", "NU008", "NU009", "NU010", "NU010A", "NU011", "NU011A", "NU012", "NU013", "NU014", "NU015",
+    "NU016", "NU017", "NU018", "NU018A", "NU019", "NU020", "NU021", "NU022", "NU022A", "NUE", "NUM", "NUMBERS",
+    "NUMERO", "NUNAVUT", "NUO", "NUOP", "NUOX", "NUP", "NUR", "NURX", "NUSHU", "NUUN", "NUX", "NW", "NYAEMAE", "NYAH",
+    "NYAJ", "NYAN", "NYCA", "NYD", "NYEN", "NYIE", "NYIEP", "NYIET", "NYIEX", "NYIN", "NYIN-DO", "NYIR", "NYIX", "NYJA",
+    "NYOA", "NYON", "NYOO", "NYOT", "NYOX", "NYUE", "NYUN", "NYUO", "NYUOP", "NYUOX", "NYUP", "NYUT", "NYUX", "NYWA",
+    "NZAP", "NZAQ", "NZAT", "NZAX", "NZE", "NZEUM", "NZEX", "NZI", "NZIE", "NZIEP", "NZIEX", "NZIP", "NZIT", "NZIX",
+    "NZOP", "NZOX", "NZU", "NZUN", "NZUO", "NZUOX", "NZUQ", "NZUR", "NZURX", "NZUX", "NZY", "NZYP", "NZYR", "NZYRX",
+    "NZYT", "NZYX", "O-1", "O-2", "O-3", "O-E", "O-EO", "O-O", "O-O-I", "O-U", "O-YA", "O-YAE", "O-YE", "O-YEO", "O001",
+    "O001A", "O002", "O003", "O004", "O005", "O005A", "O006", "O006A", "O006B", "O006C", "O006D", "O006E", "O006F",
+    "O007", "O008", "O009", "O010", "O010A", "O010B", "O010C", "O011", "O012", "O013", "O014", "O015", "O016", "O017",
+    "O018", "O019", "O019A", "O020", "O020A", "O021", "O022", "O023", "O024", "O024A", "O025", "O025A", "O026", "O027",
+    "O028", "O029", "O029A", "O030", "O030A", "O031", "O032", "O033", "O033A", "O034", "O035", "O036", "O036A", "O036B",
+    "O036C", "O036D", "O037", "O038", "O039", "O040", "O041", "O042", "O043", "O044", "O045", "O046", "O047", "O048",
+    "O049", "O050", "O050A", "O050B", "O051", "OABOAFILI", "OAK", "OB", "OBELOS", "OBELUS", "OBJECT", "OBLACHKO",
+    "OBLAKO", "OBOFILI", "OBOL", "OBSERVER", "OBSTRUCTION", "OC", "OCCLUSION", "OCHKOM", "OCTAGONAL", "OCTOBER",
+    "OCTOPUS", "ODEN", "OER", "OEY", "OFF", "OFFICER", "OG", "OGRE", "OJEON", "OLE", "OMALON", "ON-OFF", "ONAP",
+    "ONE-LINE", "ONE-PIECE", "ONE-THIRTY", "ONE-WAY", "ONESELF", "ONION", "ONKAR", "ONSU", "OOBOOFILI", "OOH", "OOMU",
+    "OON", "OOYANNA", "OOZE", "OPEN-OUTLINED", "OPEN-P", "OPHIUCHUS", "OPPOSE", "OPPRESSION", "OPTION", "ORANGUTAN",
+    "ORCHID", "ORE-2", "ORIGIN", "ORNAMENTS", "ORTHODOX", "ORTHOGONAL", "OTHAL", "OTHALAN", "OTHER", "OTHERS",
+    "OTSECHKA", "OTT", "OTTER", "OUNKIA", "OUTBOX", "OUTLINE", "OVERHEATED", "OWL", "OXEIAI", "OYANNA", "OYSTER", "OZ",
+    "P001", "P001A", "P002", "P003", "P003A", "P004", "P005", "P006", "P007", "P008", "P009", "P010", "P011", "P2",
+    "PAAI", "PAARAE", "PAARAM", "PAASENTO", "PAATU", "PACKAGE", "PACKING", "PADDLE", "PADMA", "PAGER", "PAGODA", "PAH",
+    "PAINTBRUSH", "PAIRTHRA", "PAIYANNOI", "PALATALIZATION", "PALATALIZED", "PALETTE", "PALKA", "PALLAS", "PALLAWA",
+    "PALMS", "PALUTA", "PAMAAEH", "PAMENENG", "PAMEPET", "PAMINGKAL", "PAMSHAE", "PAMUNGKAH", "PANAELAENG", "PANAM",
+    "PANCAKES", "PANDA", "PANEULEUNG", "PANG", "PANGHULU", "PANGKAT", "PANGKON", "PANGLAYAR", "PANGLONG", "PANGRANGKEP",
+    "PANGWISAD", "PANOLONG", "PANONGONAN", "PANSIOS-KAPYEOUNPIEUP", "PANSIOS-PIEUP", "PANYAKRA", "PANYANGGA",
+    "PANYECEK", "PANYIKU", "PANYUKU", "PAO", "PAPERCLIP", "PAPERCLIPS", "PAPYRUS", "PARACHUTE", "PARAGRAPHUS",
+    "PARAKLIT", "PAREREN", "PARICHON", "PARK", "PARROT", "PARTIALLY-RECYCLED", "PARUM", "PASEQ", "PASHAE", "PASHTA",
+    "PASSED", "PASSENGER", "PASSIMBANG", "PASSIVE-PULL-DOWN-OUTPUT", "PASSIVE-PULL-UP-OUTPUT", "PASSPORT", "PASUQ",
+    "PAT", "PATAK", "PATHAKKU", "PATHAMASAT", "PAUK", "PAUSE", "PAVIYANI", "PAX", "PAY", "PAZER", "PC", "PD", "PEACH",
+    "PEACOCK", "PEANUTS", "PEAR", "PEDESTRIANS", "PEEI", "PEEKING", "PEEM", "PEEP", "PEESHI", "PEEZI", "PEITH",
+    "PENETRATION", "PENGKAL", "PENGUIN", "PENIHI", "PENNY", "PENSIVE", "PENSU", "PENTATHLON", "PEORTH", "PERFORMING",
+    "PERMANENT", "PERSEVERING", "PERSPECTIVE", "PERTHO", "PES", "PESETA", "PET", "PETASMA", "PETASTI",
+    "PETASTOKOUFISMA", "PETRI", "PEUT", "PEUTAE", "PF", "PG", "PH", "PHAARKAA", "PHAB", "PHAM", "PHAN", "PHEE",
+    "PHIEUPH-HIEUH", "PHIEUPH-SIOS", "PHIEUPH-THIEUTH", "PHILOSOPHERS", "PHINTHU", "PHNAEK", "PHOA", "PHOLUS", "PHONES",
+    "PHU", "PHUNG", "PHUTHAO", "PHWA", "PIANO", "PIASTRE", "PIASUTORU", "PICKET", "PICKUP", "PIEEQ", "PIEET", "PIEP",
+    "PIET", "PIEUP-KHIEUKH", "PIEUP-MIEUM", "PIEUP-NIEUN", "PIEUP-RIEUL", "PIEUP-RIEUL-PHIEUPH", "PIEUP-SIOS-CIEUC",
+    "PIEUP-SIOS-PIEUP", "PIEUP-SIOS-THIEUTH", "PIEUP-SSANGSIOS", "PIEX", "PIKO", "PIKURU", "PILE", "PILL", "PINARBORAS",
+    "PINATA", "PINCHED", "PINCHING", "PINE", "PINEAPPLE", "PIPING", "PIR2", "PIRACY", "PIRIEEN", "PISCES", "PISTOL",
+    "PIX", "PIZZA", "PIZZICATO", "PLACARD", "PLAK", "PLANET", "PLANT", "PLATE", "PLAYGROUND", "PLEADING", "PLETHRON",
+    "PLHAU", "PLOW", "PLUG", "PLUK", "PLUM", "PLUMED", "PLUNGER", "PLURAL", "PLUS-MINUS", "PM", "POA", "POCKET",
+    "PODATUS", "PODCHASHIEM", "PODVERTKA", "POETIC", "POINTO", "POINTS", "POKRYTIE", "POLKULIZMY", "POLNAYA", "POLO",
+    "POLUPOVODNAYA", "PONDO", "POODLE", "POON", "POPCORN", "POPPER", "POPPING", "PORTABLE", "POSEIDON", "POSITIONS",
+    "POSTBOX", "POSTPOSITION", "POTABLE", "POTTED", "POUCH", "POULTRY", "POURING", "POVODNY", "POWDER", "POWDERED",
+    "POX", "POY", "PPA", "PPM", "PPV", "PR", "PRAYER", "PRECEDED", "PRECIPITATE", "PREFACE", "PRENKHA", "PRESCRIPTION",
+    "PRESENT", "PRESSED", "PRETZEL", "PREVIOUS", "PRINCE", "PRINCESS", "PRINTS", "PRIVATE", "PROBING", "PROFOUND",
+    "PROGRESS", "PROHIBITED", "PROJECTION", "PROJECTIVE", "PROJECTOR", "PROOF", "PROPERTY", "PROPORTIONAL",
+    "PROSERPINA", "PROTOVARYS", "PROVE", "PS", "PSIFISTOLYGISMA", "PSIFISTOPARAKALESMA", "PSIFISTOSYNAGMA", "PSILON",
+    "PTE", "PU2", "PUAQ", "PUB", "PUBLIC", "PUCK", "PUFFED", "PUM", "PUMP", "PUNCTUS", "PUNG", "PUNGAAM", "PUO", "PUOP",
+    "PUOX", "PUQ", "PUR", "PURIFY", "PURITY", "PURNAMA", "PURSE", "PURX", "PUSHING", "PUSHPIKA", "PUTNAYA",
+    "PUTREFACTION", "PUUT", "PUX", "PUZZLE", "PV", "PW", "PWOY", "PY", "PYP", "PYR", "PYRX", "PYX", "PZ", "Q001",
+    "Q002", "Q003", "Q004", "Q005", "Q006", "Q007", "QAAFU", "QAAI", "QADMA", "QAIRTHRA", "QALA", "QAPH", "QAQ",
+    "QARNEY", "QAU", "QAY", "QEE", "QETANA", "QGA", "QHA", "QHAA", "QHAU", "QHE", "QHEE", "QHI", "QHO", "QHOPH", "QHU",
+    "QHWA", "QHWAA", "QHWE", "QHWEE", "QHWI", "QIE", "QIEP", "QIET", "QIEX", "QIF", "QIP", "QIT", "QIX", "QN", "QOA",
+    "QOP", "QOPA", "QOX", "QP", "QUADCOLON", "QUANTITY", "QUATERNION", "QUBUTS", "QUDDISA", "QUESTIONED", "QUF",
+    "QUICK", "QUINARIUS", "QUINCUNX", "QUINTESSENCE", "QUINTILE", "QUK", "QUOP", "QUOT", "QUOX", "QUP", "QUR", "QURX",
+    "QUSHSHAYA", "QUT", "QUUV", "QUX", "QWA", "QWAA", "QY", "QYA", "QYAA", "QYE", "QYEE", "QYI", "QYO", "QYP", "QYR",
+    "QYRX", "QYT", "QYU", "QYX", "R001", "R002", "R002A", "R003", "R003A", "R003B", "R004", "R005", "R006", "R007",
+    "R008", "R009", "R010", "R010A", "R011", "R012", "R013", "R014", "R015", "R016", "R016A", "R017", "R018", "R019",
+    "R020", "R021", "R022", "R023", "R024", "R025", "R026", "R027", "R028", "R029", "RA-1", "RA-3", "RA-4", "RA-KARA",
+    "RA2", "RA3", "RAAI", "RAB", "RACCOON", "RADIOACTIVE", "RAEM", "RAH", "RAHIMAHU", "RAHIMAHUM", "RAHMATULLAH", "RAI",
+    "RAIDA", "RAIDO", "RAIL", "RAINBOW", "RAKHANG", "RAMBAT", "RAN", "RAPISMA", "RAQ", "RASHA", "RASOUL", "RASWADI",
+    "RATA", "RATIO", "RAU", "RAVNO", "RAX", "RAYANNA", "RAZOR", "RAZSEKA", "RE-1", "RE-2", "RE-3", "RE-4", "REAHMUK",
+    "REALGAR", "REALGAR-2", "RECEIPT", "RECEPTIVE", "RECITATIVE", "RECORDER", "RECORDING", "RECREATIONAL", "RECYCLED",
+    "REFERENCE", "REGIA", "REGIA-2", "REGISTERED", "REGULUS-2", "REGULUS-3", "REGULUS-4", "REI", "REID", "REIWA",
+    "RELAA", "RELATIONAL", "RELEASE", "RELIGION", "REMEDY", "REMINDER", "REMU", "RENTOGEN", "REP", "REPH", "REPHA",
+    "REPRESENT", "REREKAN", "RESH-AYIN", "RESH-AYIN-DALETH", "RESIDENCE", "RESISTANCE", "RESOLUTION", "RESTROOM",
+    "RESUPINUS", "RETORT", "RETREAT", "REU", "REVERSED-SCHWA", "REVIA", "REVMA", "REVOLUTION", "REX", "RH",
+    "RHINOCEROS", "RHOTIC", "RI-1", "RI-2", "RI-3", "RI-4", "RI-5", "RI-6", "RI-7", "RIAL", "RICEM", "RICKSHAW", "RIEL",
+    "RIEUL-CIEUC", "RIEUL-KIYEOK-HIEUH", "RIEUL-MIEUM-HIEUH", "RIEUL-MIEUM-KIYEOK", "RIEUL-MIEUM-SIOS",
+    "RIEUL-PIEUP-HIEUH", "RIEUL-PIEUP-PHIEUPH", "RIEUL-PIEUP-TIKEUT", "RIEUL-SSANGPIEUP", "RIEUL-SSANGSIOS",
+    "RIEUL-SSANGTIKEUT", "RIEUL-TIKEUT-HIEUH", "RIEUL-YEORINHIEUH-HIEUH", "RIEUL-YESIEUNG", "RIFLE", "RIGHT-HANDED",
+    "RIGHT-LIGHTED", "RIGHT-SIDE", "RIGHTHAND", "RIGVEDIC", "RIM", "RIMGBA", "RIN", "RINFORZANDO", "RINGED", "RINGING",
+    "RIP", "RIRA", "RITTORU", "RITUAL", "RIVER", "RJES", "RMT", "RO-1", "RO-2", "RO-3", "RO-4", "RO-5", "RO-6", "RO2",
+    "ROA", "ROAR", "ROASTED", "ROBAT", "ROBOT", "ROGOM", "ROLL", "ROLLED-UP", "ROM", "ROOF", "ROOM", "ROOSTER", "ROP",
+    "ROSE", "ROSH", "ROT", "ROUND-TIPPED", "ROWBOAT", "ROX", "RRAX", "RREP", "RRET", "RREX", "RROP", "RROT", "RROX",
+    "RRRA", "RRU", "RRUO", "RRUOX", "RRUP", "RRUR", "RRURX", "RRUT", "RRUX", "RRY", "RRYP", "RRYR", "RRYRX", "RRYT",
+    "RRYX", "RTE", "RTHANG", "RU-1", "RU-2", "RU-3", "RU-4", "RU-5", "RU-6", "RUA", "RUBLE", "RUE", "RUGBY", "RUIS",
+    "RUKKAKHA", "RULAI", "RULE", "RULE-DELAYED", "RUN", "RUNNER", "RUNOUT", "RUO", "RUOP", "RUOX", "RUP", "RUPII",
+    "RUR", "RURX", "RUSI", "RUT", "RUUBURU", "RUX", "RWAHA", "RWE", "RWEE", "RWI", "RWII", "RWO", "RWOO", "RYA", "RYP",
+    "RYR", "RYRX", "RYT", "RYX", "RYY", "S-W", "S001", "S002", "S002A", "S003", "S004", "S005", "S006", "S006A", "S007",
+    "S008", "S009", "S010", "S011", "S012", "S013", "S014", "S014A", "S014B", "S015", "S016", "S017", "S017A", "S018",
+    "S019", "S020", "S021", "S022", "S023", "S024", "S025", "S026", "S026A", "S026B", "S027", "S028", "S029", "S030",
+    "S031", "S032", "S033", "S034", "S035", "S035A", "S036", "S037", "S038", "S039", "S040", "S041", "S042", "S043",
+    "S044", "S045", "S046", "SA-1", "SA-3", "SA-4", "SA-5", "SA-6", "SA-7", "SA-8", "SA-I", "SAADHU", "SAAI",
+    "SACRIFICIAL", "SAGA", "SAGITTARIUS", "SAIKURU", "SAIL", "SAILBOAT", "SAJDAH", "SAKE", "SAKEUAE", "SAKHA", "SAKIN",
+    "SAKOT", "SAKTA", "SAL-AMMONIAC", "SALA", "SALAAMUHU", "SALAD", "SALAM", "SALLALLAAHU", "SALLALLAHU", "SALT-2",
+    "SALUTING", "SAMKA", "SAMPHAO", "SAMVAT", "SAMYOK", "SANAH", "SAND", "SANDWICH", "SANGA2", "SANNYA", "SANTIIMU",
+    "SANYOOGA", "SAPA", "SAQ", "SASH", "SATCHEL", "SATKAAN", "SATKAANKUU", "SATURN", "SAUCER", "SAUIL", "SAUROPOD",
+    "SAVOURING", "SAWAN", "SAX", "SAXIMATA", "SAXOPHONE", "SBRUL", "SBUB", "SCALES", "SCARF", "SCEPTER", "SCHOLAR",
+    "SCHROEDER", "SCORE", "SCORPION", "SCORPIUS", "SCREAMING", "SCREWDRIVER", "SCROLL", "SCRUPLE", "SCWA", "SD",
+    "SDONG", "SE-1", "SE-2", "SE-3", "SE-4", "SE-5", "SEAGULL", "SEAT", "SECRET", "SECTOR", "SEDNA", "SEE-NO-EVIL",
+    "SEEDLING", "SEENU", "SEEV", "SELECTOR-1", "SELECTOR-10", "SELECTOR-100", "SELECTOR-101", "SELECTOR-102",
+    "SELECTOR-103", "SELECTOR-104", "SELECTOR-105", "SELECTOR-106", "SELECTOR-107", "SELECTOR-108", "SELECTOR-109",
+    "SELECTOR-11", "SELECTOR-110", "SELECTOR-111", "SELECTOR-112", "SELECTOR-113", "SELECTOR-114", "SELECTOR-115",
+    "SELECTOR-116", "SELECTOR-117", "SELECTOR-118", "SELECTOR-119", "SELECTOR-12", "SELECTOR-120", "SELECTOR-121",
+    "SELECTOR-122", "SELECTOR-123", "SELECTOR-124", "SELECTOR-125", "SELECTOR-126", "SELECTOR-127", "SELECTOR-128",
+    "SELECTOR-129", "SELECTOR-13", "SELECTOR-130", "SELECTOR-131", "SELECTOR-132", "SELECTOR-133", "SELECTOR-134",
+    "SELECTOR-135", "SELECTOR-136", "SELECTOR-137", "SELECTOR-138", "SELECTOR-139", "SELECTOR-14", "SELECTOR-140",
+    "SELECTOR-141", "SELECTOR-142", "SELECTOR-143", "SELECTOR-144", "SELECTOR-145", "SELECTOR-146", "SELECTOR-147",
+    "SELECTOR-148", "SELECTOR-149", "SELECTOR-15", "SELECTOR-150", "SELECTOR-151", "SELECTOR-152", "SELECTOR-153",
+    "SELECTOR-154", "SELECTOR-155", "SELECTOR-156", "SELECTOR-157", "SELECTOR-158", "SELECTOR-159", "SELECTOR-16",
+    "SELECTOR-160", "SELECTOR-161", "SELECTOR-162", "SELECTOR-163", "SELECTOR-164", "SELECTOR-165", "SELECTOR-166",
+    "SELECTOR-167", "SELECTOR-168", "SELECTOR-169", "SELECTOR-17", "SELECTOR-170", "SELECTOR-171", "SELECTOR-172",
+    "SELECTOR-173", "SELECTOR-174", "SELECTOR-175", "SELECTOR-176", "SELECTOR-177", "SELECTOR-178", "SELECTOR-179",
+    "SELECTOR-18", "SELECTOR-180", "SELECTOR-181", "SELECTOR-182", "SELECTOR-183", "SELECTOR-184", "SELECTOR-185",
+    "SELECTOR-186", "SELECTOR-187", "SELECTOR-188", "SELECTOR-189", "SELECTOR-19", "SELECTOR-190", "SELECTOR-191",
+    "SELECTOR-192", "SELECTOR-193", "SELECTOR-194", "SELECTOR-195", "SELECTOR-196", "SELECTOR-197", "SELECTOR-198",
+    "SELECTOR-199", "SELECTOR-2", "SELECTOR-20", "SELECTOR-200", "SELECTOR-201", "SELECTOR-202", "SELECTOR-203",
+    "SELECTOR-204", "SELECTOR-205", "SELECTOR-206", "SELECTOR-207", "SELECTOR-208", "SELECTOR-209", "SELECTOR-21",
+    "SELECTOR-210", "SELECTOR-211", "SELECTOR-212", "SELECTOR-213", "SELECTOR-214", "SELECTOR-215", "SELECTOR-216",
+    "SELECTOR-217", "SELECTOR-218", "SELECTOR-219", "SELECTOR-22", "SELECTOR-220", "SELECTOR-221", "SELECTOR-222",
+    "SELECTOR-223", "SELECTOR-224", "SELECTOR-225", "SELECTOR-226", "SELECTOR-227", "SELECTOR-228", "SELECTOR-229",
+    "SELECTOR-23", "SELECTOR-230", "SELECTOR-231", "SELECTOR-232", "SELECTOR-233", "SELECTOR-234", "SELECTOR-235",
+    "SELECTOR-236", "SELECTOR-237", "SELECTOR-238", "SELECTOR-239", "SELECTOR-24", "SELECTOR-240", "SELECTOR-241",
+    "SELECTOR-242", "SELECTOR-243", "SELECTOR-244", "SELECTOR-245", "SELECTOR-246", "SELECTOR-247", "SELECTOR-248",
+    "SELECTOR-249", "SELECTOR-25", "SELECTOR-250", "SELECTOR-251", "SELECTOR-252", "SELECTOR-253", "SELECTOR-254",
+    "SELECTOR-255", "SELECTOR-256", "SELECTOR-26", "SELECTOR-27", "SELECTOR-28", "SELECTOR-29", "SELECTOR-3",
+    "SELECTOR-30", "SELECTOR-31", "SELECTOR-32", "SELECTOR-33", "SELECTOR-34", "SELECTOR-35", "SELECTOR-36",
+    "SELECTOR-37", "SELECTOR-38", "SELECTOR-39", "SELECTOR-4", "SELECTOR-40", "SELECTOR-41", "SELECTOR-42",
+    "SELECTOR-43", "SELECTOR-44", "SELECTOR-45", "SELECTOR-46", "SELECTOR-47", "SELECTOR-48", "SELECTOR-49",
+    "SELECTOR-5", "SELECTOR-50", "SELECTOR-51", "SELECTOR-52", "SELECTOR-53", "SELECTOR-54", "SELECTOR-55",
+    "SELECTOR-56", "SELECTOR-57", "SELECTOR-58", "SELECTOR-59", "SELECTOR-6", "SELECTOR-60", "SELECTOR-61",
+    "SELECTOR-62", "SELECTOR-63", "SELECTOR-64", "SELECTOR-65", "SELECTOR-66", "SELECTOR-67", "SELECTOR-68",
+    "SELECTOR-69", "SELECTOR-7", "SELECTOR-70", "SELECTOR-71", "SELECTOR-72", "SELECTOR-73", "SELECTOR-74",
+    "SELECTOR-75", "SELECTOR-76", "SELECTOR-77", "SELECTOR-78", "SELECTOR-79", "SELECTOR-8", "SELECTOR-80",
+    "SELECTOR-81", "SELECTOR-82", "SELECTOR-83", "SELECTOR-84", "SELECTOR-85", "SELECTOR-86", "SELECTOR-87",
+    "SELECTOR-88", "SELECTOR-89", "SELECTOR-9", "SELECTOR-90", "SELECTOR-91", "SELECTOR-92", "SELECTOR-93",
+    "SELECTOR-94", "SELECTOR-95", "SELECTOR-96", "SELECTOR-97", "SELECTOR-98", "SELECTOR-99", "SELENA", "SELFIE",
+    "SEMISEXTILE", "SEMK", "SEMUNCIA", "SENTAGON", "SENTI", "SENTO", "SEP", "SEPARATED", "SEPTEMBER", "SEPTUPLE",
+    "SERIOUS", "SERVICE", "SESQUIQUADRATE", "SESTERTIUS", "SETFON", "SEUAEQ", "SEUNYAM", "SEVEN-THIRTY", "SEVENTH",
+    "SEVERANCE", "SEWING", "SEX", "SEXTANS", "SEXTANT-1", "SEXTANT-12", "SEXTANT-123", "SEXTANT-1234", "SEXTANT-12345",
+    "SEXTANT-12346", "SEXTANT-1235", "SEXTANT-12356", "SEXTANT-1236", "SEXTANT-124", "SEXTANT-1245", "SEXTANT-12456",
+    "SEXTANT-1246", "SEXTANT-125", "SEXTANT-1256", "SEXTANT-126", "SEXTANT-13", "SEXTANT-134", "SEXTANT-1345",
+    "SEXTANT-13456", "SEXTANT-1346", "SEXTANT-1356", "SEXTANT-136", "SEXTANT-14", "SEXTANT-145", "SEXTANT-1456",
+    "SEXTANT-146", "SEXTANT-15", "SEXTANT-156", "SEXTANT-16", "SEXTANT-2", "SEXTANT-23", "SEXTANT-234", "SEXTANT-2345",
+    "SEXTANT-23456", "SEXTANT-2346", "SEXTANT-235", "SEXTANT-2356", "SEXTANT-236", "SEXTANT-24", "SEXTANT-245",
+    "SEXTANT-2456", "SEXTANT-25", "SEXTANT-256", "SEXTANT-26", "SEXTANT-3", "SEXTANT-34", "SEXTANT-345", "SEXTANT-3456",
+    "SEXTANT-346", "SEXTANT-35", "SEXTANT-356", "SEXTANT-36", "SEXTANT-4", "SEXTANT-45", "SEXTANT-456", "SEXTANT-46",
+    "SEXTANT-5", "SEXTANT-56", "SEXTANT-6", "SEXTILE", "SEYK", "SG", "SGOR", "SGRA", "SH2", "SHAB6", "SHAK", "SHAKER",
+    "SHAKTI", "SHALLOW", "SHALSHELET", "SHAMROCK", "SHAP", "SHAPE", "SHARA", "SHARK", "SHAVED", "SHAVIYANI", "SHAX",
+    "SHAY", "SHCHOOI", "SHE-GOAT", "SHEENU", "SHEG9", "SHEN", "SHEP", "SHEQEL", "SHESH2", "SHESHLAM", "SHEUAE",
+    "SHEUAEQ", "SHEUAEQTU", "SHEUOQ", "SHEVA", "SHEX", "SHIIN", "SHINDA", "SHINIG", "SHINTO", "SHIRAE", "SHIRT",
+    "SHIYYAALAA", "SHOA", "SHOCKED", "SHOES", "SHOOI", "SHOOT", "SHOOTING", "SHORT-TWIG-AR", "SHORT-TWIG-BJARKAN",
+    "SHORT-TWIG-HAGALL", "SHORT-TWIG-MADR", "SHORT-TWIG-NAUD", "SHORT-TWIG-OSS", "SHORT-TWIG-SOL", "SHORT-TWIG-TYR",
+    "SHORT-TWIG-YR", "SHORTCAKE", "SHORTENER", "SHOT", "SHOU", "SHOULDERED", "SHOWER", "SHOX", "SHRA", "SHRAA", "SHRII",
+    "SHRINE", "SHRO", "SHROO", "SHRUG", "SHUANGXI", "SHUBUR", "SHUENSHUET", "SHUEQ", "SHUFFLE", "SHUL", "SHUM", "SHUO",
+    "SHUOP", "SHUOX", "SHUP", "SHURX", "SHUT", "SHUTTLECOCK", "SHUX", "SHV", "SHWOY", "SHYA", "SHYE", "SHYP", "SHYR",
+    "SHYRX", "SHYT", "SHYX", "SI-1", "SI-2", "SI-3", "SI-4", "SI-5", "SI-6", "SIA", "SICKLE", "SICKNESS", "SIDDHI",
+    "SIE", "SIEE", "SIEP", "SIEX", "SIGEL", "SIKI", "SILIQUA", "SILVER", "SINE", "SINGAAT", "SINKING", "SINOLOGICAL",
+    "SINUSOID", "SIOS-IEUNG", "SIOS-KAPYEOUNPIEUP", "SIOS-KHIEUKH", "SIOS-PANSIOS", "SIOS-PHIEUPH", "SIOS-PIEUP-KIYEOK",
+    "SIOS-SSANGSIOS", "SIP", "SIRINGU", "SIRRAH", "SISA", "SIT", "SITE", "SIX-LINE", "SIX-PER-EM", "SIX-STRING",
+    "SIX-THIRTY", "SIXTEENTH-1", "SIXTEENTH-2", "SIXTY-FOURTHS", "SK", "SKATEBOARD", "SKIER", "SKIN", "SKOBA", "SKUNK",
+    "SKW", "SKWA", "SLAVE", "SLAVONIC", "SLED", "SLEEP", "SLEEPY", "SLEUTH", "SLIDE", "SLIDER", "SLIDING", "SLING",
+    "SLOPE", "SLOT", "SLOTH", "SLOWLY", "SMEAR", "SMIRKING", "SNA", "SNAIL", "SNAP", "SNEEZING", "SNOWBOARDER", "SO-1",
+    "SO-2", "SO-3", "SO-4", "SO-5", "SO-6", "SO-7", "SOA", "SOCCER", "SOCKS", "SOFTBALL", "SOFTNESS",
+    "SOFTWARE-FUNCTION", "SON", "SONG", "SONJAM", "SOON", "SOP", "SOQ", "SORI", "SOS", "SOUNAP", "SOW", "SOWILO", "SOX",
+    "SOY", "SP", "SPA", "SPAGHETTI", "SPARKLER", "SPARKLES", "SPARKLING", "SPATHI", "SPE", "SPEAK-NO-EVIL", "SPEAKING",
+    "SPEEDBOAT", "SPENT", "SPESMILO", "SPI", "SPICE", "SPINE", "SPIRANT", "SPLASHING", "SPLITTING", "SPO", "SPONGE",
+    "SPOOL", "SPORTS", "SPOT", "SPOUTING", "SPRECHGESANG", "SPRING", "SPRINGS", "SPROUT", "SPUNGS", "SPWA", "SPY",
+    "SQUEEZED", "SQUID", "SQUISH", "SR", "SSAA", "SSANGARAEA", "SSANGCIEUC-HIEUH", "SSANGMIEUM", "SSANGRIEUL-KHIEUKH",
+    "SSANGSIOS-KIYEOK", "SSANGSIOS-PIEUP", "SSANGSIOS-TIKEUT", "SSANGTHIEUTH", "SSANGTIKEUT-PIEUP", "SSANGYEORINHIEUH",
+    "SSAP", "SSAT", "SSAX", "SSEE", "SSEP", "SSEX", "SSHE", "SSHIN", "SSIE", "SSIEP", "SSIEX", "SSIP", "SSIT", "SSIX",
+    "SSOP", "SSOT", "SSOX", "SSUP", "SSUT", "SSUX", "SSY", "SSYP", "SSYR", "SSYRX", "SSYT", "SSYX", "ST2",
+    "STACCATISSIMO", "STACCATO", "STACKED", "STADIUM", "STALLION", "STAN", "STAND", "STANDING", "STANDSTILL", "STARK",
+    "STARRED", "STARS", "STARTING", "STATION", "STATUE", "STAUROS", "STAVROU", "STEAMING", "STEAMY", "STENOGRAPHIC",
+    "STEREO", "STETHOSCOPE", "STILL", "STIMME", "STIRRUP", "STOPPAGE", "STOPPING", "STOPWATCH", "STOVE", "STRAGGISMATA",
+    "STRAIF", "STRAIGHTNESS", "STRAINER", "STRATIAN", "STRATUM-2", "STRAW", "STRAWBERRY", "STREAMER", "STRENGTH",
+    "STRETCH", "STRICTLY", "STRIDE", "STRIKETHROUGH", "STRIPE", "STROKE-1", "STROKE-10", "STROKE-11", "STROKE-2",
+    "STROKE-3", "STROKE-4", "STROKE-5", "STROKE-6", "STROKE-7", "STROKE-8", "STROKE-9", "STUDIO", "STUFFED", "STUPA",
+    "STWA", "SU-1", "SU-2", "SU-3", "SU-4", "SU-5", "SU-6", "SU-7", "SU-8", "SUAB", "SUAE", "SUAEN", "SUAET", "SUAM",
+    "SUBHAANAHU", "SUBITO", "SUBJECT", "SUBLIMATE-2", "SUBLIMATE-3", "SUBLIMATION", "SUBPUNCTIS", "SUCK", "SUCKING",
+    "SUD", "SUD2", "SUITABLE", "SUMASH", "SUMMER", "SUNFLOWER", "SUNSET", "SUO", "SUOP", "SUOX", "SUP", "SUPERFIXED",
+    "SUPERHERO", "SUPERIMPOSED", "SUPERVILLAIN", "SUR9", "SURE", "SURFER", "SURX", "SURYA", "SUSHI", "SUT", "SUTRA",
+    "SUX", "SVETLO", "SVETLY", "SWAN", "SWG", "SWIMMER", "SWIMMING", "SWIMSUIT", "SWORD", "SWORDS", "SWUNG", "SWZ",
+    "SY", "SYA", "SYI", "SYMBOL-10", "SYMBOL-15", "SYMBOL-16", "SYMBOL-20", "SYMBOL-21", "SYMBOL-22", "SYMBOL-25",
+    "SYMBOL-26", "SYMBOL-27", "SYMBOL-29", "SYMBOL-3", "SYMBOL-30", "SYMBOL-32", "SYMBOL-36", "SYMBOL-37", "SYMBOL-38",
+    "SYMBOL-39", "SYMBOL-40", "SYMBOL-42", "SYMBOL-43", "SYMBOL-45", "SYMBOL-47", "SYMBOL-48", "SYMBOL-49", "SYMBOL-6",
+    "SYMBOL-9", "SYMMETRY", "SYNAFI", "SYNAGOGUE", "SYNCHRONOUS", "SYNDESMOS", "SYNEVMA", "SYOUWA", "SYP", "SYR",
+    "SYRINGE", "SYRMA", "SYRMATIKI", "SYRX", "SYT", "SYX", "SZ", "SZA", "SZAA", "SZE", "SZEE", "SZI", "SZO", "SZU",
+    "SZWA", "SZWG", "SZZ", "T-REX", "T-SHIRT", "T001", "T002", "T003", "T003A", "T004", "T005", "T006", "T007", "T007A",
+    "T008", "T008A", "T009", "T009A", "T010", "T011", "T011A", "T012", "T013", "T014", "T015", "T016", "T016A", "T017",
+    "T018", "T019", "T020", "T021", "T022", "T023", "T024", "T025", "T026", "T027", "T028", "T029", "T030", "T031",
+    "T032", "T032A", "T033", "T033A", "T034", "T035", "T036", "TA-1", "TA-3", "TA-4", "TA2", "TAAALAA", "TAAF", "TAAI",
+    "TAAM", "TAAQ", "TAASHAE", "TABAARAKA", "TABS", "TACO", "TAEN", "TAHALA", "TAILLESS", "TAISYOU", "TAK", "TAKE",
+    "TAKEOUT", "TAKHALLUS", "TALENT", "TAMALE", "TAMAN", "TANA", "TANABATA", "TANG", "TANGERINE", "TAO", "TAP", "TAPER",
+    "TAQ", "TARTAR", "TARTAR-2", "TARUNG", "TAS", "TASHEEL", "TASSI", "TATTOOED", "TAUM", "TAURUS", "TAVIYANI", "TAWA",
+    "TAWELLEMET", "TAX", "TAY", "TE-1", "TE-3", "TE-4", "TE-5", "TE-6", "TE-7", "TE-8", "TE-9", "TE-U", "TEA", "TEACUP",
+    "TEAPOT", "TEAR", "TEAR-OFF", "TEARDROP-BARBED", "TEARDROP-SHANKED", "TEDDY", "TEEEE", "TEENS", "TEGEH", "TEIWS",
+    "TEK", "TELESCOPE", "TELEVISION", "TELLER", "TELU", "TEMPLE", "TEN-THIRTY", "TENGE", "TENUTO", "TEP", "TERMINATOR",
+    "TESSARON", "TEST", "TETRAFONIAS", "TETRAPLI", "TEU", "TEUN", "TEUT", "TEUTEUWEN", "TEUTEUX", "TEVIR", "TEX",
+    "THAALU", "THAHAN", "THAJ", "THAMEDH", "THANNA", "THANTHAKHAT", "THAW", "THEA", "THEREFORE", "THERMODYNAMIC",
+    "THES", "THETH", "THEY", "THIAB", "THICK", "THIGH", "THING", "THINKING", "THIRD-STAGE", "THIRTY-ONE", "THITA",
+    "THIUTH", "THOA", "THOJ", "THOM", "THOU", "THREE-CIRCLE", "THREE-DOT", "THREE-EM", "THREE-HUNDRED-AND-TWENTIETH",
+    "THREE-LEGGED", "THREE-LINE", "THREE-PER-EM", "THREE-THIRTY", "THROWING", "THUNDERSTORM", "THUNG", "THURISAZ",
+    "THURS", "THWE", "THWEE", "THWI", "THWII", "THWO", "THWOO", "THYOOM", "THZ", "TI-1", "TI-2", "TI-3", "TI-4", "TI-5",
+    "TI-6", "TI-7", "TI2", "TIARA", "TICKET", "TICKETS", "TIEP", "TIEX", "TII", "TIKEUT-CHIEUCH", "TIKEUT-MIEUM",
+    "TIKEUT-SIOS-KIYEOK", "TIKEUT-THIEUTH", "TILES", "TILT", "TIMER", "TIN", "TINAGMA", "TINCTURE", "TING", "TINNE",
+    "TIPEHA", "TIPPI", "TIRED", "TIRTA", "TIRYAK", "TITUAEP", "TIWAZ", "TIWR", "TIX", "TLEE", "TLHEE", "TLHOO", "TLHU",
+    "TLHWE", "TLHYA", "TN", "TO-1", "TO-2", "TO-3", "TO-4", "TO-5", "TO-6", "TO-RA", "TOA", "TOANDAKHIAT", "TOCHKA",
+    "TOILET", "TOKYO", "TOLONG", "TOMATO", "TOMPI", "TON", "TONE-B", "TONE-D", "TONE-G", "TONE-J", "TONE-M", "TONE-S",
+    "TONE-V", "TONG", "TOOLBOX", "TOON", "TOOTHBRUSH", "TORCH", "TORNADO", "TORSO", "TORSO-FLOORPLANE", "TOS",
+    "TOUCHES", "TOURNOIS", "TOV", "TOWER", "TOX", "TR", "TRACKBALL", "TRACTOR", "TRADE", "TRAILING", "TRAMWAY",
+    "TRANSPLUTO", "TRANSVERSAL", "TRAP", "TRAPEZIUM", "TREADING", "TREDECILE", "TRESVETLO", "TRESVETLY", "TRI", "TRIA",
+    "TRIFOLIATE", "TRIFONIAS", "TRIGORGON", "TRIISAP", "TRILL", "TRILLIONS", "TRION", "TRIPLI", "TRIPOD", "TRITOS",
+    "TRIUMPH", "TROLL", "TROLLEY", "TROLLEYBUS", "TROMIKOLYGISMA", "TROMIKOPARAKALESMA", "TROMIKOPSIFISTON",
+    "TROMIKOSYNAGMA", "TROPHY", "TRUMP-1", "TRUMP-10", "TRUMP-11", "TRUMP-12", "TRUMP-13", "TRUMP-14", "TRUMP-15",
+    "TRUMP-16", "TRUMP-17", "TRUMP-18", "TRUMP-19", "TRUMP-2", "TRUMP-20", "TRUMP-21", "TRUMP-3", "TRUMP-4", "TRUMP-5",
+    "TRUMP-6", "TRUMP-7", "TRUMP-8", "TRUMP-9", "TRUMPET", "TRUNCATED", "TRUTH", "TRYASKA", "TRYASOGLASNAYA",
+    "TRYASOPOVODNAYA", "TRYASOSTRELNAYA", "TRYBLION", "TSAA", "TSAADIY", "TSAB", "TSEEB", "TSERE", "TSHAB", "TSHEEJ",
+    "TSHOOJ", "TSHUGS", "TSIU", "TSOV", "TSSA", "TSWA", "TSWB", "TT2", "TTEE", "TTH", "TTHEE", "TTHOO", "TTHU", "TTHWE",
+    "TTSA", "TTSE", "TTSEE", "TTSI", "TTSO", "TTSU", "TTTHA", "TTU", "TTUDDAG", "TU-1", "TU-2", "TU-3", "TU-4", "TU-TO",
+    "TUAE", "TUAEP", "TUB", "TUBE", "TUGRIK", "TUKWENTIS", "TULIP", "TUMAE", "TUMBLER", "TUMETES", "TUNNY", "TUO",
+    "TUOP", "TUOX", "TUPNI", "TURKEY", "TURKISH", "TURO2", "TURU", "TURX", "TUT", "TUTEYASAT", "TUTTY", "TUUMU", "TUX",
+    "TUXEDO", "TVIMADUR", "TWELFTH", "TWELVE-THIRTY", "TWENTY-EIGHT", "TWENTY-NINE", "TWENTY-SEVEN", "TWENTY-SIX",
+    "TWISTED", "TWISTING", "TWO-EM", "TWO-LINE", "TWO-THIRTY", "TXA", "TXHEEJ", "TYA", "TYAY", "TYE", "TYI", "TYO",
+    "TYPE-1", "TYPE-1-2", "TYPE-2", "TYPE-7", "TYR", "TZA", "TZAA", "TZE", "TZEE", "TZI", "TZIR", "TZO", "TZOA", "TZU",
+    "U-1", "U-2", "U-3", "U-4", "U-5", "U-A", "U-AE", "U-EO-EU", "U-I-I", "U-U", "U-YE", "U-YEO", "U001", "U002",
+    "U003", "U004", "U005", "U006", "U006A", "U006B", "U007", "U008", "U009", "U010", "U011", "U012", "U013", "U014",
+    "U015", "U016", "U017", "U018", "U019", "U020", "U021", "U022", "U023", "U023A", "U024", "U025", "U026", "U027",
+    "U028", "U029", "U029A", "U030", "U031", "U032", "U032A", "U033", "U034", "U035", "U036", "U037", "U038", "U039",
+    "U040", "U041", "U042", "UAN", "UANG", "UATH", "UBHAYATO", "UBUFILI", "UDAAT", "UDARKA", "UDUG", "UEA", "UEC",
+    "UEE", "UEI", "UEN", "UEQ", "UEY", "UHD", "UIC", "UILLEANN", "UIQ", "UIUC", "UIUQ", "UIUX", "UIUZ", "UIX", "UIZ",
+    "UMBIN", "UNA", "UNAMUSED", "UNAP", "UNASPIRATED", "UNBLENDED", "UNCERTAINTY", "UNCIA", "UNDERDOT", "UNDO",
+    "UNEVEN", "UNG", "UNICORN", "UNIFORM", "UNITED", "UNITY", "UNKNOWN", "UNMARRIED", "UOG", "UON", "UOP", "UOX",
+    "UPRIGHT", "UPSIDE-DOWN", "UQ", "UR4", "URA", "URI", "URI3", "URINE", "URN", "URUS", "URUZ", "USE", "USH2",
+    "USHENNA", "USHUMX", "USHX", "USSU", "USSU3", "UTUKI", "UUU", "UUU2", "UUU3", "UUUU", "UUYANNA", "UWU", "UX",
+    "UYANNA", "UZ", "UZHAKKU", "UZU", "V001", "V001A", "V001B", "V001C", "V001D", "V001E", "V001F", "V001G", "V001H",
+    "V001I", "V002", "V002A", "V003", "V004", "V005", "V006", "V007", "V007A", "V007B", "V008", "V009", "V010", "V011",
+    "V011A", "V011B", "V011C", "V012", "V012A", "V012B", "V013", "V014", "V015", "V016", "V017", "V018", "V019", "V020",
+    "V020A", "V020B", "V020C", "V020D", "V020E", "V020F", "V020G", "V020H", "V020I", "V020J", "V020K", "V020L", "V021",
+    "V022", "V023", "V023A", "V024", "V025", "V026", "V027", "V028", "V028A", "V029", "V029A", "V030", "V030A", "V031",
+    "V031A", "V032", "V033", "V033A", "V034", "V035", "V036", "V037", "V037A", "V038", "V039", "V040", "V040A", "VAAVU",
+    "VAJ", "VAKAIYARAA", "VALLEY", "VAMPIRE", "VAP", "VAPOURS", "VARAAKAN", "VAREIAI", "VARIKA", "VARYS", "VASIS",
+    "VASTNESS", "VAT", "VATHY", "VAU", "VAX", "VAYANNA", "VC", "VECTOR", "VEHICLE", "VEIL", "VELI", "VER", "VERDIGRIS",
+    "VERGE", "VERSICLE", "VERTICAL-00-00", "VERTICAL-00-01", "VERTICAL-00-02", "VERTICAL-00-03", "VERTICAL-00-04",
+    "VERTICAL-00-05", "VERTICAL-00-06", "VERTICAL-01-00", "VERTICAL-01-01", "VERTICAL-01-02", "VERTICAL-01-03",
+    "VERTICAL-01-04", "VERTICAL-01-05", "VERTICAL-01-06", "VERTICAL-02-00", "VERTICAL-02-01", "VERTICAL-02-02",
+    "VERTICAL-02-03", "VERTICAL-02-04", "VERTICAL-02-05", "VERTICAL-02-06", "VERTICAL-03-00", "VERTICAL-03-01",
+    "VERTICAL-03-02", "VERTICAL-03-03", "VERTICAL-03-04", "VERTICAL-03-05", "VERTICAL-03-06", "VERTICAL-04-00",
+    "VERTICAL-04-01", "VERTICAL-04-02", "VERTICAL-04-03", "VERTICAL-04-04", "VERTICAL-04-05", "VERTICAL-04-06",
+    "VERTICAL-05-00", "VERTICAL-05-01", "VERTICAL-05-02", "VERTICAL-05-03", "VERTICAL-05-04", "VERTICAL-05-05",
+    "VERTICAL-05-06", "VERTICAL-06-00", "VERTICAL-06-01", "VERTICAL-06-02", "VERTICAL-06-03", "VERTICAL-06-04",
+    "VERTICAL-06-05", "VERTICAL-06-06", "VEST", "VESTA", "VEUAE", "VEUAEPEN", "VEUM", "VEUX", "VEX", "VEYZ", "VFA",
+    "VHA", "VIBRATION", "VIDEOCASSETTE", "VIDJ", "VIDJ-2", "VIE", "VIEP", "VIEWDATA", "VIEWER", "VIEWING", "VIEX",
+    "VIGINTILE", "VILLAGE", "VINEGAR-2", "VINEGAR-3", "VIOLIN", "VIP", "VIRGA", "VIRGO", "VIRIAM", "VISARGAYA", "VIT",
+    "VITAE", "VITAE-2", "VITRIOL", "VITRIOL-2", "VIX", "VOCALIZATION", "VOD", "VOICELESS", "VOID", "VOIDED", "VOLCANO",
+    "VOLLEYBALL", "VOLTAGE", "VOLUME", "VOM", "VOMITING", "VOOI", "VOP", "VOT", "VOW", "VOWEL-CARRIER", "VOX", "VQ",
+    "VS", "VUEQ", "VULCANUS", "VUP", "VURX", "VUT", "VUX", "VW", "VWA", "VWJ", "VX", "VYP", "VYR", "VYRX", "VYT", "VYX",
+    "VZ", "VZMET", "W001", "W002", "W003", "W003A", "W004", "W005", "W006", "W007", "W008", "W009", "W009A", "W010",
+    "W010A", "W011", "W012", "W013", "W014", "W014A", "W015", "W016", "W017", "W017A", "W018", "W018A", "W019", "W020",
+    "W021", "W022", "W023", "W024", "W024A", "W025", "WA-1", "WA-2", "WA-3", "WA-4", "WA-5", "WA-AALIH", "WA-SALLAM",
+    "WA-TAAALAA", "WAAALIHEE", "WAAJIB", "WAAVU", "WADDA", "WAEN", "WAFFLE", "WAI", "WAIST", "WALLPLANE", "WAN", "WAND",
+    "WANDERER", "WANGKUOQ", "WAQFA", "WARNING", "WAS-SALAAM", "WASSALLAM", "WASTEBASKET", "WASTING", "WAT",
+    "WATERMELON", "WATTO", "WB", "WE-1", "WE-2", "WE-3", "WE-4", "WEAPON", "WEB", "WEDDING", "WEDGE", "WEEN", "WELL",
+    "WEN", "WEP", "WET", "WEUX", "WEX", "WG", "WH", "WHEELED", "WHITE-FEATHERED", "WI-1", "WI-2", "WI-3", "WI-4",
+    "WI-5", "WIANG", "WIANGWAAK", "WIDENING", "WIGGLES", "WIGNYAN", "WILTED", "WIN", "WINGS", "WINJA", "WINK", "WINTER",
+    "WIRED", "WO-1", "WO-2", "WO-3", "WO-4", "WO-5", "WO-6", "WO-7", "WOA", "WOE", "WOLF", "WOMEN", "WOMENS", "WOON",
+    "WOP", "WORDSPACE", "WORKER", "WORLD", "WORM", "WORRIED", "WORSHIP", "WOW", "WOX", "WRAP", "WRAPPED", "WREATH",
+    "WRESTLERS", "WRONG", "WRY", "WUAEN", "WUAET", "WUI", "WUN", "WUNJO", "WUOP", "WUOX", "WUP", "WVA", "WVE", "WVI",
+    "WZ", "X-RAY", "X-X", "X001", "X002", "X003", "X004", "X004A", "X004B", "X005", "X006", "X006A", "X007", "X008",
+    "X008A", "XAA", "XAPH", "XAU", "XAUS", "XEE", "XESTES", "XEYN", "XG", "XHEYN", "XIAB", "XIE", "XIEP", "XIET",
+    "XIEX", "XIP", "XIRON", "XIT", "XIX", "XOA", "XOP", "XOPH", "XOR", "XOT", "XOX", "XSHAAYATHIYA", "XU", "XUO",
+    "XUOX", "XVE", "XWA", "XWAA", "XWE", "XWEE", "XWI", "XY", "XYAA", "XYEE", "XYI", "XYO", "XYOO", "XYOOJ", "XYP",
+    "XYR", "XYRX", "XYT", "XYU", "XYX", "Y001", "Y001A", "Y002", "Y003", "Y004", "Y005", "Y006", "Y007", "Y008", "YA-1",
+    "YA-2", "YA-3", "YA-4", "YA-5", "YA-O", "YA-U", "YAADO", "YAAI", "YAARU", "YAB", "YABH", "YACH", "YAD", "YADD",
+    "YADDH", "YADH", "YAEMMAE", "YAF", "YAFU", "YAG", "YAGHH", "YAGN", "YAHH", "YAKASH", "YAKHH", "YAL", "YAMAKKAN",
+    "YAMOK", "YARN", "YARR", "YAS", "YASH", "YASS", "YATH", "YATT", "YAU", "YAV", "YAW", "YAWNING", "YAYANNA", "YAYD",
+    "YAZZ", "YEA", "YEEG", "YEIN", "YENAP", "YEO-O", "YEO-U", "YEO-YA", "YERAH", "YESIEUNG-HIEUH", "YESIEUNG-MIEUM",
+    "YETIV", "YEUAE", "YEUAET", "YEUM", "YEUQ", "YEURAE", "YEUX", "YEW", "YEY", "YHA", "YI-U", "YIEE", "YIEP", "YIET",
+    "YIEX", "YIH", "YII", "YING", "YIP", "YIX", "YIZET", "YO-1", "YO-2", "YO-3", "YO-4", "YO-5", "YO-6", "YO-A",
+    "YO-AE", "YO-EO", "YO-O", "YO-YEO", "YO-YO", "YOA", "YOMO", "YOP", "YORI", "YOU", "YOUTHFUL", "YOUTHFULNESS",
+    "YOWD", "YOX", "YOY", "YPORROI", "YPSILI", "YRY", "YU-1", "YU-2", "YU-3", "YU-4", "YU-A", "YU-AE", "YU-E", "YU-EO",
+    "YU-O", "YU-U", "YUAEN", "YUAN", "YUE", "YUEQ", "YUI", "YUN", "YUO", "YUOM", "YUOT", "YUOX", "YUP", "YUR", "YURX",
+    "YUUKALEAPINTU", "YUX", "YYAA", "YYE", "YYP", "YYR", "YYRX", "YYT", "YYX", "Z001", "Z002", "Z002A", "Z002B",
+    "Z002C", "Z002D", "Z003", "Z003A", "Z003B", "Z004", "Z004A", "Z005", "Z005A", "Z006", "Z007", "Z008", "Z009",
+    "Z010", "Z011", "Z012", "Z013", "Z014", "Z015", "Z015A", "Z015B", "Z015C", "Z015D", "Z015E", "Z015F", "Z015G",
+    "Z015H", "Z015I", "Z016", "Z016A", "Z016B", "Z016C", "Z016D", "Z016E", "Z016F", "Z016G", "Z016H", "ZAEF", "ZAG",
+    "ZAI", "ZAKRYTOE", "ZAMX", "ZANOZHEK", "ZAP", "ZAPYATYMI", "ZARL", "ZARQA", "ZAT", "ZAVIYANI", "ZAX", "ZAYIN-YODH",
+    "ZE2", "ZEBRA", "ZELO", "ZEP", "ZEUS", "ZEVOK", "ZEX", "ZH", "ZHAA", "ZHAIN", "ZHAP", "ZHAT", "ZHAX", "ZHAYIN",
+    "ZHEP", "ZHET", "ZHEX", "ZHIL", "ZHOI", "ZHOO", "ZHOP", "ZHOT", "ZHOX", "ZHUO", "ZHUOP", "ZHUOX", "ZHUP", "ZHUR",
+    "ZHURX", "ZHUT", "ZHUX", "ZHWA", "ZHY", "ZHYP", "ZHYR", "ZHYRX", "ZHYT", "ZHYX", "ZI3", "ZIE", "ZIEP", "ZIEX",
+    "ZIG", "ZILDE", "ZINOR", "ZIP", "ZIPPER-MOUTH", "ZIQAA", "ZIT", "ZIX", "ZMEYTSA", "ZOA", "ZOMBIE", "ZOP", "ZOX",
+    "ZRA", "ZSA", "ZSHA", "ZUBUR", "ZUM", "ZUO", "ZUOP", "ZUOX", "ZURX", "ZUT", "ZUX", "ZWA", "ZWARAKAY", "ZWJ",
+    "ZYGOS", "ZYP", "ZYR", "ZYRX", "ZYT", "ZYX", "ZZAA", "ZZAP", "ZZAT", "ZZAX", "ZZEE", "ZZEP", "ZZEX", "ZZIE",
+    "ZZIEP", "ZZIEX", "ZZIP", "ZZIT", "ZZIX", "ZZOP", "ZZOX", "ZZSA", "ZZSYA", "ZZUP", "ZZUR", "ZZURX", "ZZUX", "ZZY",
+    "ZZYA", "ZZYP", "ZZYR", "ZZYRX", "ZZYT", "ZZYX",
+};
+
+inline constexpr Run runs[] = {
+    {0x20,32,"\301\364\000\301\257+\000\301\177+\000\036\002\000\304&\002\000\305\215\002\000\303\262\000\303o\000(\300\371\000&\300\371\000\300\367\000a\002\000\300\251\000\306B\000\300\324\300k\000\301\327\000\017\300%\000\0172\000\0177\000\017B\000\017O\000\017V\000\017v\000\017\201\000\017u\000\017\211\000\301^\000\302\366\000\300\257\002\000\301@\002\000\300\256\002\000\301\216+\000"},
+    {0x40,32,"\305 \301\234\000\010\006\001\025\000\010\006\001\077\000\010\006\001\3005\000\010\006\001\300\024\000\010\006\0019\000\010\006\001\300u\000\010\006\001\300\003\000\010\006\001\300\026\000\010\006\001;\000\010\006\001\300U\000\010\006\001\300\011\000\010\006\001p\000\010\006\001\261\000\010\006\001\232\000\010\006\0016\000\010\006\001\300<\000\010\006\001\300\260\000\010\006\001c\000\010\006\001d\000\010\006\001\300\007\000\010\006\0011\000\010\006\001\300\015\000\010\006\001\300P\000\010\006\001\300>\000\010\006\001\300$\000\010\006\001\300 \000(,\202\000\302\003\301\327\000&,\202\000\300M\300\206\000\210\300\201\000"},
+    {0x60,31,"\300\200\300\206\000\010\004\001\025\000\010\004\001\077\000\010\004\001\3005\000\010\004\001\300\024\000\010\004\0019\000\010\004\001\300u\000\010\004\001\300\003\000\010\004\001\300\026\000\010\004\001;\000\010\004\001\300U\000\010\004\001\300\011\000\010\004\001p\000\010\004\001\261\000\010\004\001\232\000\010\004\0016\000\010\004\001\300<\000\010\004\001\300\260\000\010\004\001c\000\010\004\001d\000\010\004\001\300\007\000\010\004\0011\000\010\004\001\300\015\000\010\004\001\300P\000\010\004\001\300>\000\010\004\001\300$\000\010\004\001\300 \000(\301\077\202\000T\300\201\000&\301\077\202\000\272\000"},
+    {0xA0,32,"\310^\301\364\000\300\221\301\257+\000\312\240\002\000\306\256\002\000\303<\002\000\305\314\002\000\304~x\000\3013\002\000\300b\000\312\273\002\000\313H\315,\301Y\000\302\0164\300\236\301\177+\000\300\224\002\000\302\251\302\346\000\351T\002\000\300\213\000\306\001\002\000\3508\002\000\301\2327\000\301\232B\000\300!\300\206\000\344*\002\000\315c\002\000M<\000\301\202\000\301\2322\000\343\260\315,\301Y\000\301\3254\300\236\301\177+\000\302)\300\0162\3011\000\302)\300\0162o\000\302)\300\016B\302\206\000\300\221\301\216+\000"},
+    {0xC0,32,"\010\006\001\025\003\300\200\000\010\006\001\025\003\300!\000\010\006\001\025\003\300M\000\010\006\001\025\003\272\000\010\006\001\025\003\300b\000\010\006\001\025\003\240'\000\010\006\001\301X\000\010\006\001\3005\003\301\202\000\010\006\0019\003\300\200\000\010\006\0019\003\300!\000\010\006\0019\003\300M\000\010\006\0019\003\300b\000\010\006\001;\003\300\200\000\010\006\001;\003\300!\000\010\006\001;\003\300M\000\010\006\001;\003\300b\000\010\006\001\303\306\000\010\006\001\232\003\272\000\010\006\0016\003\300\200\000\010\006\0016\003\300!\000\010\006\0016\003\300M\000\010\006\0016\003\272\000\010\006\0016\003\300b\000\302\302\002\000\010\006\0016\003I\000\010\006\0011\003\300\200\000\010\006\0011\003\300!\000\010\006\0011\003\300M\000\010\006\0011\003\300b\000\010\006\001\300$\003\300!\000\010\006\001\304\013\000\010\004\001\304Qd\000"},
+    {0xE0,32,"\010\004\001\025\003\300\200\000\010\004\001\025\003\300!\000\010\004\001\025\003\300M\000\010\004\001\025\003\272\000\010\004\001\025\003\300b\000\010\004\001\025\003\240'\000\010\004\001\301X\000\010\004\001\3005\003\301\202\000\010\004\0019\003\300\200\000\010\004\0019\003\300!\000\010\004\0019\003\300M\000\010\004\0019\003\300b\000\010\004\001;\003\300\200\000\010\004\001;\003\300!\000\010\004\001;\003\300M\000\010\004\001;\003\300b\000\010\004\001\303\306\000\010\004\001\232\003\272\000\010\004\0016\003\300\200\000\010\004\0016\003\300!\000\010\004\0016\003\300M\000\010\004\0016\003\272\000\010\004\0016\003\300b\000\303\300\002\000\010\004\0016\003I\000\010\004\0011\003\300\200\000\010\004\0011\003\300!\000\010\004\0011\003\300M\000\010\004\0011\003\300b\000\010\004\001\300$\003\300!\000\010\004\001\304\013\000\010\004\001\300$\003\300b\000"},
+    {0x100,32,"\010\006\001\025\003\300\213\000\010\004\001\025\003\300\213\000\010\006\001\025\003\300\270\000\010\004\001\025\003\300\270\000\010\006\001\025\003\302\205\000\010\004\001\025\003\302\205\000\010\006\001\3005\003\300!\000\010\004\001\3005\003\300!\000\010\006\001\3005\003\300M\000\010\004\001\3005\003\300M\000\010\006\001\3005\003<'\000\010\004\001\3005\003<'\000\010\006\001\3005\003\300\377\000\010\004\001\3005\003\300\377\000\010\006\001\300\024\003\300\377\000\010\004\001\300\024\003\300\377\000\010\006\001\300\024\003I\000\010\004\001\300\024\003I\000\010\006\0019\003\300\213\000\010\004\0019\003\300\213\000\010\006\0019\003\300\270\000\010\004\0019\003\300\270\000\010\006\0019\003<'\000\010\004\0019\003<'\000\010\006\0019\003\302\205\000\010\004\0019\003\302\205\000\010\006\0019\003\300\377\000\010\004\0019\003\300\377\000\010\006\001\300\003\003\300M\000\010\004\001\300\003\003\300M\000\010\006\001\300\003\003\300\270\000\010\004\001\300\003\003\300\270\000"},
+    {0x120,32,"\010\006\001\300\003\003<'\000\010\004\001\300\003\003<'\000\010\006\001\300\003\003\301\202\000\010\004\001\300\003\003\301\202\000\010\006\001\300\026\003\300M\000\010\004\001\300\026\003\300M\000\010\006\001\300\026\003I\000\010\004\001\300\026\003I\000\010\006\001;\003\272\000\010\004\001;\003\272\000\010\006\001;\003\300\213\000\010\004\001;\003\300\213\000\010\006\001;\003\300\270\000\010\004\001;\003\300\270\000\010\006\001;\003\302\205\000\010\004\001;\003\302\205\000\010\006\001;\003<'\000\010\004\001\301\375;\000\010\006!\313\313\000\010\004!\313\313\000\010\006\001\300U\003\300M\000\010\004\001\300U\003\300M\000\010\006\001\300\011\003\301\202\000\010\004\001\300\011\003\301\202\000\010\004\001\341\203\000\010\006\001p\003\300!\000\010\004\001p\003\300!\000\010\006\001p\003\301\202\000\010\004\001p\003\301\202\000\010\006\001p\003\300\377\000\010\004\001p\003\300\377\000\010\006\001p\003M<\000"},
+    {0x140,32,"\010\004\001p\003M<\000\010\006\001p\003I\000\010\004\001p\003I\000\010\006\001\232\003\300!\000\010\004\001\232\003\300!\000\010\006\001\232\003\301\202\000\010\004\001\232\003\301\202\000\010\006\001\232\003\300\377\000\010\004\001\232\003\300\377\000\010\004\001\232\350a\302\333\303o\000\010\006\001\302\341\000\010\004\001\302\341\000\010\006\0016\003\300\213\000\010\004\0016\003\300\213\000\010\006\0016\003\300\270\000\010\004\0016\003\300\270\000\010\006\0016\0034\300!\000\010\004\0016\0034\300!\000\010\006!\301\007\000\010\004!\301\007\000\010\006\001c\003\300!\000\010\004\001c\003\300!\000\010\006\001c\003\301\202\000\010\004\001c\003\301\202\000\010\006\001c\003\300\377\000\010\004\001c\003\300\377\000\010\006\001d\003\300!\000\010\004\001d\003\300!\000\010\006\001d\003\300M\000\010\004\001d\003\300M\000\010\006\001d\003\301\202\000\010\004\001d\003\301\202\000"},
+    {0x160,32,"\010\006\001d\003\300\377\000\010\004\001d\003\300\377\000\010\006\001\300\007\003\301\202\000\010\004\001\300\007\003\301\202\000\010\006\001\300\007\003\300\377\000\010\004\001\300\007\003\300\377\000\010\006\001\300\007\003I\000\010\004\001\300\007\003I\000\010\006\0011\003\272\000\010\004\0011\003\272\000\010\006\0011\003\300\213\000\010\004\0011\003\300\213\000\010\006\0011\003\300\270\000\010\004\0011\003\300\270\000\010\006\0011\003\240'\000\010\004\0011\003\240'\000\010\006\0011\0034\300!\000\010\004\0011\0034\300!\000\010\006\0011\003\302\205\000\010\004\0011\003\302\205\000\010\006\001\300P\003\300M\000\010\004\001\300P\003\300M\000\010\006\001\300$\003\300M\000\010\004\001\300$\003\300M\000\010\006\001\300$\003\300b\000\010\006\001\300 \003\300!\000\010\004\001\300 \003\300!\000\010\006\001\300 \003<'\000\010\004\001\300 \003<'\000\010\006\001\300 \003\300\377\000\010\004\001\300 \003\300\377\000\010\004\001\253d\000"},
+    {0x180,32,"\010\004\001\077\003I\000\010\006\001\077\003S\000\010\006\001\077\003\306\377\000\010\004\001\077\003\306\377\000\010\006\001\212v\000\010\004\001\212v\000\010\006\001\2626\000\010\006\001\3005\003S\000\010\004\001\3005\003S\000\010\006\001\305\010\300\024\000\010\006\001\300\024\003S\000\010\006\001\300\024\003\306\377\000\010\004\001\300\024\003\306\377\000\010\004\001\241\302\012\000\010\006\001\300:9\000\010\006\001\303\042\000\010\006\001\2629\000\010\006\001\300u\003S\000\010\004\001\300u\003S\000\010\006\001\300\003\003S\000\010\006\001\301\352\000\010\004\001\306A\000\010\006\001\300\312\000\010\006\001;\003I\000\010\006\001\300\011\003S\000\010\004\001\300\011\003S\000\010\004\001p\003x\000\010\004\001\342\026\003I\000\010\006\001\241\261\000\010\006\001\232\003(S\000\010\004\001\232\003\253&\302\017\000\010\006\0016\003M\272\000"},
+    {0x1A0,32,"\010\006\0016\003\301R\000\010\004\0016\003\301R\000\010\006\001\305\200\000\010\004\001\305\200\000\010\006\001\300<\003S\000\010\004\001\300<\003S\000\010\001\317\036\000\010\006\001\2127\000\010\004\001\2127\000\010\006\001\302 \000\010\001\300:\302 \301\244\000\010\004\001\300\007\003\301\213S\000\010\006\001\300\007\003S\000\010\004\001\300\007\003S\000\010\006\001\300\007\003\301\022S\000\010\006\0011\003\301R\000\010\004\0011\003\301R\000\010\006\001\300\356\000\010\006\001\300\015\003S\000\010\006\001\300$\003S\000\010\004\001\300$\003S\000\010\006\001\300 \003I\000\010\004\001\300 \003I\000\010\006\001\302\342\000\010\006\001\302\342\300:\000\010\004\001\302\342\300:\000\010\004\001\302\342\003\300\253\000\010\0017\003I\000\010\006\001\212V\000\010\004\001\212V\000\010\001\300\221\301I\300k\003I\000\010\001\307\027\000"},
+    {0x1C0,32,"\010\001\307\210\303\011\000\010\001\3140\303\011\000\010\001\312#\303\011\000\010\001\301\022\303\011\000\010\006\001\303@\003\300\377\000\010\006\001\300\024\003\004\001\300 \003\300\377\000\010\004\001\303@\003\300\377\000\010\006\001\314J\000\010\006\001p\003\004\001\300U\000\010\004\001\314J\000\010\006\001\314\362\000\010\006\001\232\003\004\001\300U\000\010\004\001\314\362\000\010\006\001\025\003\300\377\000\010\004\001\025\003\300\377\000\010\006\001;\003\300\377\000\010\004\001;\003\300\377\000\010\006\0016\003\300\377\000\010\004\0016\003\300\377\000\010\006\0011\003\300\377\000\010\004\0011\003\300\377\000\010\006\0011\003\300b\031\300\213\000\010\004\0011\003\300b\031\300\213\000\010\006\0011\003\300b\031\300!\000\010\004\0011\003\300b\031\300!\000\010\006\0011\003\300b\031\300\377\000\010\004\0011\003\300b\031\300\377\000\010\006\0011\003\300b\031\300\200\000\010\004\0011\003\300b\031\300\200\000\010\004\001\2419\000\010\006\001\025\003\300b\031\300\213\000\010\004\001\025\003\300b\031\300\213\000"},
+    {0x1E0,32,"\010\006\001\025\003<'\031\300\213\000\010\004\001\025\003<'\031\300\213\000\010\006\001\301X\003\300\213\000\010\004\001\301X\003\300\213\000\010\006\001\300\003\003I\000\010\004\001\300\003\003I\000\010\006\001\300\003\003\300\377\000\010\004\001\300\003\003\300\377\000\010\006\001\300\011\003\300\377\000\010\004\001\300\011\003\300\377\000\010\006\0016\003\302\205\000\010\004\0016\003\302\205\000\010\006\0016\003\302\205\031\300\213\000\010\004\0016\003\302\205\031\300\213\000\010\006\001\302\342\003\300\377\000\010\004\001\302\342\003\300\377\000\010\004\001\300U\003\300\377\000\010\006\001\303@\000\010\006\001\300\024\003\004\001\300 \000\010\004\001\303@\000\010\006\001\300\003\003\300!\000\010\004\001\300\003\003\300!\000\010\006\001\313\273\000\010\006\001\307\027\000\010\006\001\232\003\300\200\000\010\004\001\232\003\300\200\000\010\006\001\025\003\240'\031\300!\000\010\004\001\025\003\240'\031\300!\000\010\006\001\301X\003\300!\000\010\004\001\301X\003\300!\000\010\006\0016\003I\031\300!\000\010\004\0016\003I\031\300!\000"},
+    {0x200,32,"\010\006\001\025\0034\300\200\000\010\004\001\025\0034\300\200\000\010\006\001\025\003\300\221\300\270\000\010\004\001\025\003\300\221\300\270\000\010\006\0019\0034\300\200\000\010\004\0019\0034\300\200\000\010\006\0019\003\300\221\300\270\000\010\004\0019\003\300\221\300\270\000\010\006\001;\0034\300\200\000\010\004\001;\0034\300\200\000\010\006\001;\003\300\221\300\270\000\010\004\001;\003\300\221\300\270\000\010\006\0016\0034\300\200\000\010\004\0016\0034\300\200\000\010\006\0016\003\300\221\300\270\000\010\004\0016\003\300\221\300\270\000\010\006\001c\0034\300\200\000\010\004\001c\0034\300\200\000\010\006\001c\003\300\221\300\270\000\010\004\001c\003\300\221\300\270\000\010\006\0011\0034\300\200\000\010\004\0011\0034\300\200\000\010\006\0011\003\300\221\300\270\000\010\004\0011\003\300\221\300\270\000\010\006\001d\003\300\251:\000\010\004\001d\003\300\251:\000\010\006\001\300\007\003\300\251:\000\010\004\001\300\007\003\300\251:\000\010\006\001\317\034\000\010\004\001\317\034\000\010\006\001\300\026\003\300\377\000\010\004\001\300\026\003\300\377\000"},
+    {0x220,32,"\010\006\001\232\003\253&\302\017\000\010\004\001\300\024\003\301\347\000\010\006\001\303\354\000\010\004\001\303\354\000\010\006\001\300 \003S\000\010\004\001\300 \003S\000\010\006\001\025\003<'\000\010\004\001\025\003<'\000\010\006\0019\003\301\202\000\010\004\0019\003\301\202\000\010\006\0016\003\300b\031\300\213\000\010\004\0016\003\300b\031\300\213\000\010\006\0016\003\272\031\300\213\000\010\004\0016\003\272\031\300\213\000\010\006\0016\003<'\000\010\004\0016\003<'\000\010\006\0016\003<'\031\300\213\000\010\004\0016\003<'\031\300\213\000\010\006\001\300$\003\300\213\000\010\004\001\300$\003\300\213\000\010\004\001p\003\301\347\000\010\004\001\232\003\301\347\000\010\004\001\300\007\003\301\347\000\010\004\001\301\375\300U\000\010\004\001\312\335\301k\000\010\004\001\350\325\301k\000\010\006\001\025\003I\000\010\006\001\3005\003I\000\010\004\001\3005\003I\000\010\006\001p\003x\000\010\006\001\300\007\003\274I\000\010\004\001d\003\304\354\300\253\000"},
+    {0x240,32,"\010\004\001\300 \003\304\354\300\253\000\010\006\001\301I\300k\000\010\004\001\301I\300k\000\010\006\001\077\003I\000\010\006\0011x\000\010\006\001\241\300\015\000\010\006\0019\003I\000\010\004\0019\003I\000\010\006\001\300U\003I\000\010\004\001\300U\003I\000\010\006\001\004\300\260\003S\300\253\000\010\004\001\300\260\003S\300\253\000\010\006\001c\003I\000\010\004\001c\003I\000\010\006\001\300$\003I\000\010\004\001\300$\003I\000\010\004\001\241\025\000\010\004\001\300s\000\010\004\001\241\300s\000\010\004\001\077\003S\000\010\004\001\2626\000\010\004\001\3005\003\301\347\000\010\004\001\300\024\003\300\253\000\010\004\001\300\024\003S\000\010\004\001\300:9\000\010\004\001\303\042\000\010\004\001\303\042\003S\000\010\004\001\2629\000\010\004\001\300:\2629\000\010\004\001\300:\2629\003S\000\010\004\001\301\005\300:\2629\000\010\004\001\301\375\300U\003I\000"},
+    {0x260,32,"\010\004\001\300\003\003S\000\010\004\001\236\300\003\000\010\001\004\006\300\003\000\010\004\001\301\352\000\010\004\001\315\232\301R\000\010\004\001\241\300\026\000\010\004\001\300\026\003S\000\010\004\001\305I\003S\000\010\004\001;\003I\000\010\004\001\300\312\000\010\001\004\006;\000\010\004\001p\003M\272\000\010\004\001p\003\303\006\000\010\004\001p\003\301\022S\000\010\004\001\306l\000\010\004\001\241\261\000\010\004\001\241\261\003\253\302\017\000\010\004\001\261\003S\000\010\004\001\232\003(S\000\010\004\001\232\003\301\022S\000\010\001\004\006\232\000\010\004\001\30356\000\010\001\004\006\301\007\000\010\004\001\301\005\300n\000\010\004\001\301\307\000\010\004\001\241c\000\010\004\001\241c\003\253\302\017\000\010\004\001\241c\003S\000\010\004\001c\003\253\302\017\000\010\004\001c\003\300\253\000\010\004\001c\003\303\311\000\010\004\001\300:c\003\303\311\000"},
+    {0x280,32,"\010\001\004\006c\000\010\001\004\006\300\221c\000\010\004\001d\003S\000\010\004\001\302 \000\010\004\001\301\375\300U\003I\031S\000\010\004\001\316-\300:\302 \000\010\004\001\302 \003\301\347\000\010\004\001\241\300\007\000\010\004\001\300\007\003\301\022S\000\010\004\0011x\000\010\004\001\300\356\000\010\004\001\300\015\003S\000\010\004\001\241\300\015\000\010\004\001\241\300P\000\010\004\001\241\300$\000\010\001\004\006\300$\000\010\004\001\300 \003\301\022S\000\010\004\001\300 \003\301\347\000\010\004\001\302\342\000\010\004\001\302\342\003\301\347\000\010\001\301I\300k\000\010\001\303\357\303l\335\032\000\010\001\300\221\301I\300k\000\010\001\301\311\3005\000\010\001\307F\303\011\000\010\001\004\006\077\000\010\004\001\301\005\2629\000\010\001\004\006\300\003\003S\000\010\001\004\006\300\026\000\010\004\001\300U\003\303|\000\010\004\001\241\300\011\000\010\001\004\006p\000"},
+    {0x2A0,32,"\010\004\001\300\260\003S\000\010\001\301I\300k\003I\000\010\001\300:\301I\300k\003I\000\010\004\001\303@\301k\000\010\004\001\306\005\301k\000\010\004\001\303@\301k\003\301\347\000\010\004\001\307\003\301k\000\010\004\001\306\365\301k\000\010\004\001\316n\301k\003\301\347\000\010\004\001\307\250\301k\000\010\004\001\314Q\301k\000\010\004\001\314[\301k\000\010\001\307F\315N\000\010\001\324F\315N\000\010\004\001\241\300\026\003\303\311\000\010\004\001\241\300\026\003\303\311\031\300\253\000>\001\004\300\026\000>\001\004\300\026\003S\000>\001\004\300U\000>\001\004c\000>\001\004\241c\000>\001\004\241c\003S\000>\001\004\006\300\221c\000>\001\004\300P\000>\001\004\300$\000>\001\302\364\000>\0014\302\364\000>\001\241\300\251\000>\001\303o\000>\001\300:\300\251\000>\001&o\240\000>\001(o\240\000"},
+    {0x2C0,32,">\001\301I\300k\000>\001\300:\301I\300k\000>\001(\300a\000>\001&\300a\000>\001b\300a\000>\001t\300a\000>\001\300M\300\206\000\300\377\000>\001T\300\201\000>\001\300\213\000>\001\300!\300\206\000>\001\300\200\300\206\000>\001\210T\300\201\000>\001\210\300\213\000>\001\210\300\200\300\206\000>\001\210\300!\300\206\000>\001\301\366\301^\000>\001o\301\366\301^\000>\001\303v&o\240\000>\001\303v(o\240\000>\001b\301O\000>\001t\301O\000>\001a\002\000>\001\302\002\002\000\300\270\000<'\000\240'\000\302\205\000\004\272\0004\300!\300\206\000>\001\351yS\000>\001\300\323\300\206\000"},
+    {0x2E0,32,">\001\004\301\352\000>\001\004p\000>\001\004d\000>\001\004\300>\000>\001\004\300:\301I\300k\000>\001\306\035\212x\000>\001\217\212x\000>\001\304A\212x\000>\001\210\212x\000>\001\306\036\212x\000>\001\303\256\307\211\212+\000>\001\303\001\307\211\212+\000>\001\316\350\000>\001\357\240\000>\0014\303o\000>\001\210t\300a\000>\001\210b\300a\000>\001\210(\300a\000>\001\210&\300a\000>\001\210\240\000>\001M\300\200\300\206\000>\001M4\300\200\300\206\000>\001M4\300!\300\206\000>\001\210\272\000>\001\301T\301^\000>\001\303\266\217\212\000>\001\301l\217\212\000>\001\303\266\210\212\000>\001\301l\210\212\000>\001\315\356\000>\001\262\315\356\000>\001\210(\034\000"},
+    {0x300,32," \300\200\300\206\000 \300!\300\206\000 \300M\300\206\000 \272\000 \300\213\000 \303\355\000 \300\270\000 <'\000 \300b\000 S'\000 \240'\000 4\300!\300\206\000 \300\377\000 T\300\201'\000 4T\300\201'\000 4\300\200\300\206\000 \301P\000 \300\221\300\270\000 \241\300\251'\000 \300\251'\000 \300:\300\251'\000 \300\251'&\000 \300\200\300\206:\000 \300!\300\206:\000 (\301O:\000 &\301O:\000 (\300\236'\000 \301R\000 (o\240:\000 b\301O:\000 t\301O:\000 a\002:\000"},
+    {0x320,32," \302\002\002:\000 \347\203S:\000 \301\022S:\000 <:\000 \300b:\000 \240:\000 \300\251:\000 \301\202\000 \302\205\000 T\300\201:\000 \304}:\000 \300\2214\3124:\000 \300\377:\000 \300M\300\206:\000 \300\270:\000 \300\221\300\270:\000 \272:\000 \300\213:\000 \210\300\201\000 4\210\300\201\000 \272\301\336\000 \300wI\301\336\000 \253I\301\336\000 \300w\301\327\301\336\000 \253\301\327\301\336\000 &o\240:\000 \300\221\304}:\000 ,:\000 \352\213:\000 \300>'\000 T\272\000 4\303\355\000"},
+    {0x340,32," \300\200\212+\000 \300!\212+\000 \042\300\364\000 \042\310\004\000 \042\302G\302'\000 \042\3015\000 \304}'\000 \301@\002:\000 4T\300\201:\000 (\300\236:\000 \300\224\272'\000 \313\264'\000 \302X\245C'\000 (&\034:\000 \277\034:\000 \336\014\3048\000 &\300a'\000 (o\240'\000 \307\251\000 \300>:\000 (\300a:\000 &\300a:\000 &\300a\031b\300a:\000 &o\240'\000 <'&\000 \300\367:\000 4\240:\000 \303\003'\000 4\300\270:\000 4\300\270\000 4\300\213\000 4\300\213:\000"},
+    {0x360,24," 4\272\000 4\300\221\300\270\000 4\134\034:\000 \010\004\001\025\000 \010\004\0019\000 \010\004\001;\000 \010\004\0016\000 \010\004\0011\000 \010\004\001\3005\000 \010\004\001\300\024\000 \010\004\001\300\026\000 \010\004\001\261\000 \010\004\001c\000 \010\004\001\300\007\000 \010\004\001\300\015\000 \010\004\001\300>\000\042\006\001\313\242\000\042\004\001\313\242\000\042\006\001\301\034\304\334\000\042\004\001\301\034\304\334\000\042\300\134\002\000\042l\300\134\002\000\042\006\001\315<\304\213\000\042\004\001\315<\304\213\000"},
+    {0x37A,6,"\042\3015\000\042\004\300:\303R\301\272\014\000\042\004\301\016\303R\301\272\014\000\042\004\300:\301\016\303R\301\272\014\000\042\301\216+\000\042\006\001\305\316\000"},
+    {0x384,7,"\042\302'\000\042\302G\302'\000\042\006\001\300s\003\302'\000\042\303\263\316q\000\042\006\001\301-\003\302'\000\042\006\001\300\277\003\302'\000\042\006\001\300\312\003\302'\000"},
+    {0x38C,1,"\042\006\001\301}\003\302'\000"},
+    {0x38E,20,"\042\006\001\300\356\003\302'\000\042\006\001\300n\003\302'\000\042\004\001\300\312\003\302G\031\302'\000\042\006\001\300s\000\042\006\001\302\033\000\042\006\001\301\352\000\042\006\001\302\012\000\042\006\001\301-\000\042\006\001\302\323\000\042\006\001\300\277\000\042\006\001\301\312\000\042\006\001\300\312\000\042\006\001\3025\000\042\006\001\302\242\000\042\006\001\301!\000\042\006\001\301e\000\042\006\001\302\223\000\042\006\001\301}\000\042\006\001\300\325\000\042\006\001\301\230\000"},
+    {0x3A3,32,"\042\006\001\301\272\000\042\006\001\302\077\000\042\006\001\300\356\000\042\006\001\301\307\000\042\006\001\301\256\000\042\006\001\302P\000\042\006\001\300n\000\042\006\001\300\312\003\302G\000\042\006\001\300\356\003\302G\000\042\004\001\300s\003\302'\000\042\004\001\301-\003\302'\000\042\004\001\300\277\003\302'\000\042\004\001\300\312\003\302'\000\042\004\001\300\356\003\302G\031\302'\000\042\004\001\300s\000\042\004\001\302\033\000\042\004\001\301\352\000\042\004\001\302\012\000\042\004\001\301-\000\042\004\001\302\323\000\042\004\001\300\277\000\042\004\001\301\312\000\042\004\001\300\312\000\042\004\001\3025\000\042\004\001\302\242\000\042\004\001\301!\000\042\004\001\301e\000\042\004\001\302\223\000\042\004\001\301}\000\042\004\001\300\325\000\042\004\001\301\230\000\042\004\0013\301\272\000"},
+    {0x3C3,32,"\042\004\001\301\272\000\042\004\001\302\077\000\042\004\001\300\356\000\042\004\001\301\307\000\042\004\001\301\256\000\042\004\001\302P\000\042\004\001\300n\000\042\004\001\300\312\003\302G\000\042\004\001\300\356\003\302G\000\042\004\001\301}\003\302'\000\042\004\001\300\356\003\302'\000\042\004\001\300n\003\302'\000\042\006\304\263\014\000\042\302\033\014\000\042\301\312\014\000\042\300\356\003S\014\000\042\300\356\003\300!\031S\014\000\042\300\356\003\300b\031S\014\000\042\301\307\014\000\042\300\325\014\000\042\304\263\014\000\042\001\301\034\304\272\000\042\004\001\301\034\304\272\000\042\001\310\355\000\042\004\001\310\355\000\042\001\304\213\000\042\004\001\304\213\000\042\001\304\272\000\042\004\001\304\272\000\042\001\304\334\000\042\004\001\304\334\000^\006\001\303\372\000"},
+    {0x3E3,32,"^\004\001\303\372\000^\006\001\313G\000^\004\001\313G\000^\006\001\304\266\000^\004\001\304\266\000^\006\001\304\251\000^\004\001\304\251\000^\006\001\304\235\000^\004\001\304\235\000^\006\001\304R\000^\004\001\304R\000^\006\001\312\352\000^\004\001\312\352\000\042\3025\014\000\042\301\230\014\000\042\303R\301\272\014\000\042\001\305\316\000\042\006\301\312\014\000\042\303R\301-\014\000\042\300:\303R\301-\014\000\042\006\001\303#\000\042\004\001\303#\000\042\006\303R\301\272\014\000\042\006\001\304\335\000\042\004\001\304\335\000\042\301\230\003I\014\000\042\006\300:\303R\301\272\014\000\042\006\301\016\303R\301\272\014\000\042\006\300:\301\016\303R\301\272\014\000*\006\001\302L\003\300\200\000*\006\001\307\345\000*\006\001\306\012\000"},
+    {0x403,32,"*\006\001\307\306\000*\006\001\3113\302L\000*\006\001\303\303\000*\006\001\312\216;\000*\006\001\012\000*\006\001\302\347\000*\006\001\306n\000*\006\001\303\351\000*\006\001\316\254\000*\006\001\314\011\000*\006\001;\003\300\200\000*\006\001\300w1\000*\006\001\313\023\000*\006\001\025\000*\006\001\302r\000*\006\001\302W\000*\006\001\3021\000*\006\001\301\350\000*\006\001\302L\000*\006\001\302q\000*\006\001\301\370\000*\006\001;\000*\006\001\300w;\000*\006\001[\000*\006\001\301\334\000*\006\001\302,\000*\006\001\300\276\000*\006\0016\000*\006\001\300\363\000*\006\001\302z\000*\006\001\303\013\000*\006\001\301=\000"},
+    {0x423,32,"*\006\0011\000*\006\001\303A\000*\006\001\203\000*\006\001\302\254\000*\006\001\301\316\000*\006\001\300j\000*\006\001\310\310\000*\006\001\303L\002\000*\006\001\303/\000*\006\001\302\251\002\000*\006\0019\000*\006\001\301)\000*\006\001\264\000*\004\001\025\000*\004\001\302r\000*\004\001\302W\000*\004\001\3021\000*\004\001\301\350\000*\004\001\302L\000*\004\001\302q\000*\004\001\301\370\000*\004\001;\000*\004\001\300w;\000*\004\001[\000*\004\001\301\334\000*\004\001\302,\000*\004\001\300\276\000*\004\0016\000*\004\001\300\363\000*\004\001\302z\000*\004\001\303\013\000*\004\001\301=\000"},
+    {0x443,32,"*\004\0011\000*\004\001\303A\000*\004\001\203\000*\004\001\302\254\000*\004\001\301\316\000*\004\001\300j\000*\004\001\310\310\000*\004\001\303L\002\000*\004\001\303/\000*\004\001\302\251\002\000*\004\0019\000*\004\001\301)\000*\004\001\264\000*\004\001\302L\003\300\200\000*\004\001\307\345\000*\004\001\306\012\000*\004\001\307\306\000*\004\001\3113\302L\000*\004\001\303\303\000*\004\001\312\216;\000*\004\001\012\000*\004\001\302\347\000*\004\001\306n\000*\004\001\303\351\000*\004\001\316\254\000*\004\001\314\011\000*\004\001;\003\300\200\000*\004\001\300w1\000*\004\001\313\023\000*\006\001\300n\000*\004\001\300n\000*\006\001\303\255\000"},
+    {0x463,32,"*\004\001\303\255\000*\006\001\302^9\000*\004\001\302^9\000*\006\001\300{\301w\000*\004\001\300{\301w\000*\006\001\302^\300{\301w\000*\004\001\302^\300{\301w\000*\006\001\302s\301w\000*\004\001\302s\301w\000*\006\001\302^\302s\301w\000*\004\001\302^\302s\301w\000*\006\001\306^\000*\004\001\306^\000*\006\001\302P\000*\004\001\302P\000*\006\001\304.\000*\004\001\304.\000*\006\001\304\260\000*\004\001\304\260\000*\006\001\304\260\0034\300\200\300\206\000*\004\001\304\260\0034\300\200\300\206\000*\006\001\304\370\000*\004\001\304\370\000*\006\001\302\314\300n\000*\004\001\302\314\300n\000*\006\001\300n\003\305\267\000*\004\001\300n\003\305\267\000*\006\001\306\231\000*\004\001\306\231\000*\006\001\304\272\000*\004\001\304\272\000*\304\014\002\000"},
+    {0x483,32," *\305\267\000 *\347\202\000 *\300E\315p\000 *\300Z\315p\000 *\350B\000 *\207\304\014\002\000 *\304B\002\000*\006\001\300w;\003\300\253\000*\004\001\300w;\003\300\253\000*\006\001\315\341\002\000*\004\001\315\341\002\000*\006\001\302z\003\303d\000*\004\001\302z\003\303d\000*\006\001\3021\003\3115\000*\004\001\3021\003\3115\000*\006\001\3021\003I\000*\004\001\3021\003I\000*\006\001\3021\003MS\000*\004\001\3021\003MS\000*\006\001\302q\003\301\037\000*\004\001\302q\003\301\037\000*\006\001\301\370\003\301\037\000*\004\001\301\370\003\301\037\000*\006\001[\003\301\037\000*\004\001[\003\301\037\000*\006\001[\003TI\000*\004\001[\003TI\000*\006\001[\003I\000*\004\001[\003I\000*\006\001\312S[\000*\004\001\312S[\000*\006\001\300\276\003\301\037\000"},
+    {0x4A3,32,"*\004\001\300\276\003\301\037\000*\006!\300\276\3021\000*\004!\300\276\3021\000*\006\001\300\363\003MS\000*\004\001\300\363\003MS\000*\006\001\303\257\203\000*\004\001\303\257\203\000*\006\001\303\013\003\301\037\000*\004\001\303\013\003\301\037\000*\006\001\301=\003\301\037\000*\004\001\301=\003\301\037\000*\006\001\301F1\000*\004\001\301F1\000*\006\001\301F1\003I\000*\004\001\301F1\003I\000*\006\001\203\003\301\037\000*\004\001\203\003\301\037\000*\006!\301=\302\254\000*\004!\301=\302\254\000*\006\001\301\316\003\301\037\000*\004\001\301\316\003\301\037\000*\006\001\301\316\003TI\000*\004\001\301\316\003TI\000*\006\001\306\327\000*\004\001\306\327\000*\006\001\303\257\301\316\000*\004\001\303\257\301\316\000*\006\001\303\257\301\316\003\301\037\000*\004\001\303\257\301\316\003\301\037\000*\001\315:\000*\006\001\302q\003\300\270\000*\004\001\302q\003\300\270\000"},
+    {0x4C3,32,"*\006\001[\003S\000*\004\001[\003S\000*\006\001\301\334\003\300\253\000*\004\001\301\334\003\300\253\000*\006\001\300\276\003S\000*\004\001\300\276\003S\000*\006\001\300\276\003\300\253\000*\004\001\300\276\003\300\253\000*\006\001\313\377\301\316\000*\004\001\313\377\301\316\000*\006\001\302,\003\300\253\000*\004\001\302,\003\300\253\000*\004\001\315:\000*\006\001\025\003\300\270\000*\004\001\025\003\300\270\000*\006\001\025\003\300b\000*\004\001\025\003\300b\000*\006!\025\302L\000*\004!\025\302L\000*\006\001\302L\003\300\270\000*\004\001\302L\003\300\270\000*\006\001\303\042\000*\004\001\303\042\000*\006\001\303\042\003\300b\000*\004\001\303\042\003\300b\000*\006\001\302q\003\300b\000*\004\001\302q\003\300b\000*\006\001\301\370\003\300b\000*\004\001\301\370\003\300b\000*\006\001\303\257\303\303\000*\004\001\303\257\303\303\000*\006\001;\003\300\213\000"},
+    {0x4E3,32,"*\004\001;\003\300\213\000*\006\001;\003\300b\000*\004\001;\003\300b\000*\006\0016\003\300b\000*\004\0016\003\300b\000*\006\001\30356\000*\004\001\30356\000*\006\001\30356\003\300b\000*\004\001\30356\003\300b\000*\006\0019\003\300b\000*\004\0019\003\300b\000*\006\0011\003\300\213\000*\004\0011\003\300\213\000*\006\0011\003\300b\000*\004\0011\003\300b\000*\006\0011\0034\300!\000*\004\0011\0034\300!\000*\006\001\301\316\003\300b\000*\004\001\301\316\003\300b\000*\006\001\3021\003\301\037\000*\004\001\3021\003\301\037\000*\006\001\303/\003\300b\000*\004\001\303/\003\300b\000*\006\001\3021\003I\031S\000*\004\001\3021\003I\031S\000*\006\001\203\003S\000*\004\001\203\003S\000*\006\001\203\003I\000*\004\001\203\003I\000*\006\001\302`\301\350\000*\004\001\302`\301\350\000*\006\001\302`\306\012\000"},
+    {0x503,32,"*\004\001\302`\306\012\000*\006\001\302`\3178\000*\004\001\302`\3178\000*\006\001\302`\313\025\000*\004\001\302`\313\025\000*\006\001\302`\306n\000*\004\001\302`\306n\000*\006\001\302`\303\351\000*\004\001\302`\303\351\000*\006\001\302`\316\022\000*\004\001\302`\316\022\000*\006\001\302`\316\215\000*\004\001\302`\316\215\000*\006\001\300:\301\370\000*\004\001\300:\301\370\000*\006\001\301\334\003S\000*\004\001\301\334\003S\000*\006\001\303\330\000*\004\001\303\330\000*\006\001\303\235\000*\004\001\303\235\000*\006\001\305\311\000*\004\001\305\311\000*\006\001\302\023\000*\004\001\302\023\000*\006\001\301\300\000*\004\001\301\300\000*\006\001\312\035[\000*\004\001\312\035[\000*\006\001\301\334\003MS\000*\004\001\301\334\003MS\000*\006\001\300\276\003MS\000"},
+    {0x523,13,"*\004\001\300\276\003MS\000*\006\001\300\363\003\301\037\000*\004\001\300\363\003\301\037\000*\006\001\306\327\003\301\037\000*\004\001\306\327\003\301\037\000*\006\001\300\276\003(S\000*\004\001\300\276\003(S\000*\006\001\313\032\000*\004\001\313\032\000*\006\001\312\336\000*\004\001\312\336\000*\006\001\301\334\003\301\037\000*\004\001\301\334\003\301\037\000"},
+    {0x531,32,"\300\030\006\001\3077\000\300\030\006\001\307E\000\300\030\006\001\307\305\000\300\030\006\001\300\001\000\300\030\006\001\304\222\000\300\030\006\001\300\341\000\300\030\006\001\303B\000\300\030\006\001\302\273\000\300\030\006\001C\000\300\030\006\001\302q\000\300\030\006\001\307\341\000\300\030\006\001\314I\000\300\030\006\001\311I\000\300\030\006\001\300m\000\300\030\006\001\304\265\000\300\030\006\001\301\242\000\300\030\006\001\300g\000\300\030\006\001\313}\000\300\030\006\001\312\247\000\300\030\006\001\303\032\000\300\030\006\001\012\000\300\030\006\001\306\216\000\300\030\006\001\300j\000\300\030\006\001\303k\000\300\030\006\001\300\220\000\300\030\006\001\303\230\000\300\030\006\001\313\337\000\300\030\006\001\235\000\300\030\006\001\315\336\000\300\030\006\001\311:\000\300\030\006\001\316\214\000\300\030\006\001\3012\000"},
+    {0x551,6,"\300\030\006\001\302\334\000\300\030\006\001\311U\000\300\030\006\001\310\213\000\300\030\006\001\307\372\000\300\030\006\001\305\177\000\300\030\006\001\301.\000"},
+    {0x559,32,"\300\030>\001(o\240\000\300\030\303o\000\300\030\313/+\000\300\030\301\257+\000\300\030\300\251\000\300\030\301\216+\000\300\030\302\027+\000\300\030\004\001\241\3077\000\300\030\004\001\3077\000\300\030\004\001\307E\000\300\030\004\001\307\305\000\300\030\004\001\300\001\000\300\030\004\001\304\222\000\300\030\004\001\300\341\000\300\030\004\001\303B\000\300\030\004\001\302\273\000\300\030\004\001C\000\300\030\004\001\302q\000\300\030\004\001\307\341\000\300\030\004\001\314I\000\300\030\004\001\311I\000\300\030\004\001\300m\000\300\030\004\001\304\265\000\300\030\004\001\301\242\000\300\030\004\001\300g\000\300\030\004\001\313}\000\300\030\004\001\312\247\000\300\030\004\001\303\032\000\300\030\004\001\012\000\300\030\004\001\306\216\000\300\030\004\001\300j\000\300\030\004\001\303k\000"},
+    {0x579,18,"\300\030\004\001\300\220\000\300\030\004\001\303\230\000\300\030\004\001\313\337\000\300\030\004\001\235\000\300\030\004\001\315\336\000\300\030\004\001\311:\000\300\030\004\001\316\214\000\300\030\004\001\3012\000\300\030\004\001\302\334\000\300\030\004\001\311U\000\300\030\004\001\310\213\000\300\030\004\001\307\372\000\300\030\004\001\305\177\000\300\030\004\001\301.\000\300\030\004!\304\222\311U\000\300\030\004\001\012\003I\000\300\030\300\324\300k\000\300\030\302\346\000"},
+    {0x58D,3,"\306\305\300\030\307\237\002\000\306i\300\030\307\237\002\000\300\030\313\011\002\000"},
+    {0x591,32,"\216\300\206\334B\000\216\300\206\310\301\000\216\300\206\353\365\000\216\300\206\3171\315\207\000\216\300\206\3171\335r\000\216\300\206\356t\000\216\300\206\351s\000\216\300\206\362:\000\216\300\206\347\265\000\216\300\206\361\271\000\216\300\206\356)\000\216\300\206\307\300\000\216\300\206\307\300\344\250\000\216\300\206\313u\000\216\300\206\350\264\315@\000\216\300\206\316r\335\223\000\216\300\206\347\306\000\216\300\206\322\361\336Q\000\216\300\206\344\240\000\216\300\206\343\207\000\216\300\206\314\240\000\216\300\206\314\240\340\373\000\216\300\206\331\344\000\216\300\206\350\257\000\216\300\206\316r\350\270\000\216\300\206\361\266\307E\361\333\000\216\300\206\3476\000\216\300\206\340\026\000\216\300\206\332\030\000\216\300\206\362k\000\216+\343\262y\000\216\301\252\354\015\000"},
+    {0x5B1,23,"\216\301\252\307\316\310\301\000\216\301\252\307\316\306\240\000\216\301\252\307\316\306\262\000\216\301\252\313\253\000\216\301\252\356\355\000\216\301\252\310\301\000\216\301\252\306\240\000\216\301\252\306\262\000\216\301\252\307\325\000\216\301\252\307\325\336n)\304\373\000\216\301\252\350\331\000\216\301\252\301\317\300\037\310%\000\216\301\252\343\355\000\216\300\006\343\241\000\216\301\252\306\270\000\216\300\006\347\263\000\216\301\252\301[<\000\216\301\252\306\337<\000\216\300\006\316\036\347\274\000\216+s<\000\216+l<\000\216\300\006\300\263\336R\000\216\301\252\306\262\315\207\000"},
+    {0x5D0,27,"\216\001w\000\216\001\304y\000\216\001\302]\000\216\001\305\375\000\216\001\301\027\000\216\001\304\373\000\216\001\302\261\000\216\001\313\241\000\216\001\304b\000\216\001\303n\000\216\0013\300\337\000\216\001\300\337\000\216\001\306f\000\216\0013\302#\000\216\001\302#\000\216\0013\300\263\000\216\001\300\263\000\216\001\302g\000\216\001\302\326\000\216\0013\300\363\000\216\001\300\363\000\216\0013\311(\000\216\001\311(\000\216\001\310\244\000\216\001\302\313\000\216\001\301[\000\216\001\311\006\000"},
+    {0x5EF,6,"\216\303n\260\000\216!\307\0344\304\373\000\216!\307\034\304\373\303n\000\216!\307\0344\303n\000\216\300\006\307\300\000\216\300\006\313u\000"},
+    {0x600,32,"\011\036\002\000\011\002\352_\000\011\313U\303\337\000\011\002\315\316\000\011\002\352]\000\011\036+'\000\301G\307w\305\240\000\301G\306*\305\240\000\011\315\234\000\301G\305\214\314\256\002\000\301G\305\214\300H\254\002\000\322G\002\000\011\300\251\000\011\312\334\301\270\000\011\350\077\3119\002\000\011\002\344N\000\011\002\315\321\305\011\360\352\000\011\002\305\011\322\341\000\011\002\351-\305\011\000\011\002\304\327\322s\322\222\000\011\002\355\345\000\011\004\217\301(\000\011\004\217!w\003\300h\003]\000\011\004\217\302p\000\011\004\302\235\000\011\004\303\012\000\011\004\302\241\000\011\302\366\000\011\001+\000\011\301lK\303\244+\000\011\300\262<\300\006+\000\011\301\216+\000"},
+    {0x620,32,"\011\001\313\362]\000\011\001\300S\000\011\001w\003\303\031'\000\011\001w\003\300S'\000\011\001\301\024\003\300S'\000\011\001w\003\300S:\000\011\001]\003\300S'\000\011\001w\000\011\001\300\376\000\011\001\300\322\306u\000\011\001\300\322\000\011\001\301\330\000\011\001\300\004\000\011\001\246\000\011\001\300\210\000\011\001\302\035\000\011\001\304\010\000\011\001\3012\000\011\001\302p\000\011\001\300\333\000\011\001\301\010\000\011\001\301U\000\011\001\301`\000\011\001\301(\000\011\001\302\260\000\011\001\300\375\000\011\001\301\261\000\011\001\302\350\0037\214'\000\011\001\302\350\003B\214:\000\011\001\302\234]\003\300\221\300\015\000\011\001\302\234]\0037\214'\000\011\001\302\234]\003B\214'\000"},
+    {0x640,32,"\011\304\356\000\011\001\301.\000\011\001\301D\000\011\001\300\337\000\011\001\300h\000\011\001Y\000\011\001\300\215\000\011\001\300\344\000\011\001\301\024\000\011\001w\300\204\000\011\001]\000\011\304,\000\011\305%\000\011\305Y\000\011\302\235\000\011\303\012\000\011\302\241\000\011\302\250\000\011\304\003\000\011\314\210'\000\011\300S'\000\011\300S:\000\011\301'w\000\011\300\221\303\012\000\011+\300\215\305A\000\011\362\202\000\011\021\002\004\300\015'\000\011\021\002\300\221\004\300\015'\000\011\021\002<:\000\011\300:\303\012\000\011\302\235\0037\214\000\011\303+\300S:\000"},
+    {0x660,32,"\301G\017\300%\000\301G\0172\000\301G\0177\000\301G\017B\000\301G\017O\000\301G\017V\000\301G\017v\000\301G\017\201\000\301G\017u\000\301G\017\211\000\011\305\215\002\000\011\307\205\301\270\000\011\304\014\301\270\000\011V\301;\300\261\000\011\001\301\375\300\376\000\011\001\301\375\301D\000\011\001\301\232w\000\011\001w\307\022\000\011\001w\003\303+\300S'\000\011\001w\003\303+\300S:\000\011\001\217\300S\000\011\001\217\300Sw\000\011\001\217\300S\301\024\000\011\0011\003\300S'\000\011\001\217\300S]\000\011\001\304\365\000\011\001\305\274\000\011\001\305\023\000\011\001\300\322\003\240\000\011\001\300\322\003B\214'\267\000\011\001\303\230\000\011\001\305\262\000"},
+    {0x680,32,"\011\001\305\024\000\011\001\246\003\300S'\000\011\001\246\0037\214T'\000\011\001\305}\000\011\001\305,\000\011\001\246\003B\214'\000\011\001\304^\000\011\001\305\261\000\011\001\307\202\000\011\001\302\035\003\240\000\011\001\302\035\003<:\000\011\001\302\035\003<:\031\004\301(\000\011\001\307}\000\011\001\307\201\000\011\001\307\225\000\011\001\302\035\003B\214'\267\000\011\001\302\035\003O\214'\000\011\001\310\266\000\011\001\3012\003\004\300\015\000\011\001\3012\003\240\000\011\001\3012\003<:\000\011\001\3012\003\004\300\015:\000\011\001\3012\003<:\031<'\000\011\001\3012\0037\214'\000\011\001\307\355\000\011\001\3012\003O\214'\000\011\001\300\333\003<:\031<'\000\011\001\300\333\003B\214:\000\011\001\300\333\003B\214:\031B\214'\000\011\001\301U\0037\214:\000\011\001\301U\003B\214'\000\011\001\301(\003B\214'\000"},
+    {0x6A0,32,"\011\001\300\375\003B\214'\000\011\001\301\375\301.\000\011\001\301.\003<\344\204:\000\011\001\301.\003<:\000\011\001\305\303\000\011\001\301.\003B\214:\000\011\001\305\212\000\011\001\301D\003<'\000\011\001\301D\003B\214'\000\011\001\302\350\000\011\001\304\354\300\337\000\011\001\300\337\003\240\000\011\001\300\337\003<'\000\011\001\302\022\000\011\001\300\337\003B\214:\000\011\001\303I\000\011\001\303I\003\240\000\011\001\305x\000\011\001\303I\0037\214:\000\011\001\305G\000\011\001\303I\003B\214'\000\011\001\300h\003\004\300\015\000\011\001\300h\003<'\000\011\001\300h\003B\214'\000\011\001\300h\003B\214:\000\011\001\300\215\003<:\000\011\001\300\215\305A\000\011\001\305\236\000\011\001\300\215\003\240\000\011\001\300\215\003B\214'\000\011\001\300\344\305)\000\011\001\304^\003<'\000"},
+    {0x6C0,32,"\011\001\300\344\003]'\000\011\001\300\344\303\313\000\011\001\300\344\303\313\003\300S'\000\011\001\300\322\306u\303\313\000\011\001\301\024\003\240\000\011\001\303\024\301\007\000\011\001\301\007\000\011\0011\000\011\001\301)\000\011\001\303\024\301)\000\011\001\301\024\0037\214'\000\011\001\302W\000\011\001\302\234]\000\011\001]\003\300\253\000\011\001]\003\004\300\015\000\011\001\301\024\003<'\000\011\0019\000\011\001]\003B\214:\000\011\001]\303r\000\011\001]\303r\003\300S'\000\011\300\324\300k\000\011\001\301X\000\011\004\217!\301U\003\300h\003w\300\204\000\011\004\217!\301D\003\300h\003w\300\204\000\011\004\217YX\020\000\011\004\217\300hw\000\011\004\217\300\004\000\011\004\217B\214\000\011\004\217\300\333\000\011\301lK\312D\000\011\305\253K\306\312\301\334\336\302\000\011\004\217\302\213\300%\000"},
+    {0x6E0,32,"\011\004\217\357\262\315\242\300%\000\011\004\217\301\375\301\225K\300\210\000\011\004\217YJ\020\000\011\004\210\300\333\000\011\004\217\303\031\000\011\004\301\024\000\011\004]\000\011\004\217]\000\011\004\217\300\215\000\011\304KK\352K\000\011\302x\300\222\210\300k\000\011\302x\300\222\217\300k\000\011\302\213\217\300k\003\334\331\300\222\000\011\004\210Y\000\011\001\302\035\003\300\221\300\015\000\011\001\3012\003\300\221\300\015\000\301\351\301G\017\300%\000\301\351\301G\0172\000\301\351\301G\0177\000\301\351\301G\017B\000\301\351\301G\017O\000\301\351\301G\017V\000\301\351\301G\017v\000\301\351\301G\017\201\000\301\351\301G\017u\000\301\351\301G\017\211\000\011\001\301\010\003<:\000\011\001\301`\003<:\000\011\001\301\261\003<:\000\011\002\316\010\303\262\000\011\002\316\010\350Q\303\032\000\011\001\300\344\003\300\221\300\015\000"},
+    {0x700,14,"\300-\301lK\305\207\000\300-\310\371\300\324\300k\000\300-\310\367\300\324\300k\000\300-\310\371\301^\000\300-\310\367\301^\000\300-\255\301^\000\300-\301^\306\341(\000\300-\301^\306\341&\000\300-\310\371\301^\306\341(\000\300-\310\367\301^\306\341&\000\300-\331,\000\300-\307\315\347 \000\300-\307\315\343\357\000\300-\307\315\322\343\000"},
+    {0x70F,32,"\300-\302\027+\000\300-\001\312\033\000\300-\001\301\232\312\033\000\300-\001\302D\000\300-\001\313f\000\300-\001\313f\313i\000\300-\001\312\317\000\300-\001\301\375\312\317\310\261\000\300-\001\301\027\000\300-\001\301\024\000\300-\001\302p\000\300-\001\302|\000\300-\001\303)\000\300-\001\303)\313i\000\300-\001\317\042\000\300-\001\317\042\301\027\000\300-\001\302_\000\300-\001\342\025\000\300-\001\306}\000\300-\001\300\263\000\300-\001\315\343\000\300-\0013\315\343\000\300-\0019\000\300-\001\300\363\000\300-\001\300:\300\363\000\300-\001\302f\000\300-\001\350\262\000\300-\001\310\261\000\300-\001\301[\000\300-\001\302T\000\300-\001\300\321\312c\000\300-\001\300\321\335\303\000"},
+    {0x72F,28,"\300-\001\300\321\3326\000\300-\310\233'\000\300-\310\233:\000\300-\310\233\301\016\000\300-\311_'\000\300-\311_:\000\300-\311_\301\016\000\300-\315\235'\000\300-\315\235:\000\300-\301\016\317:\255\000\300-\301\016\317:\322\217\000\300-\313\234'\000\300-\313\234:\000\300-\336v\301\016\000\300-\3139'\000\300-\3139:\000\300-\351\365\000\300-\313H<\000\300-\350\351\000\300-\351\343\000\300-7T\214'\000\300-7T\214:\000\300-B\214'\000\300-B\214:\000\300-\302O\300\201'\000\300-\302O\300\201:\000\300-\306\202\000\300-\323\373\000"},
+    {0x74D,32,"\300-\001\300=\362H\000\300-\001\300=\314\002\000\300-\001\300=\302\343\000\011\001\300\376\003B\214\337^:\000\011\001\300\376\003<:\031B\214'\000\011\001\300\376\003B\214\300]\277:\000\011\001\300\376\003B\214\300]\277:\0317\214'\000\011\001\300\376\0037\214:\031<'\000\011\001\300\376\003\300\221\004\300\015:\000\011\001\300\376\003\004\300\015\000\011\001\246\0037\214'\000\011\001\246\003B\214\300]\277:\000\011\001\302\035\0037\214\304\024:\031\004\301(\000\011\001\302\035\003\300\221\004\300\015:\000\011\001\3012\003I\000\011\001\300\333\003O\214'\000\011\001\300\375\0037\214'\000\011\001\300\375\003B\214\300]\267'\000\011\001\300\375\0037\214\304\024'\000\011\001\301.\0037\214:\000\011\001\301.\003B\214\300]\277:\000\011\001\302\350\003<'\000\011\001\302\350\003B\214'\000\011\001\302\350\003B\214\300]\277:\000\011\001Y\003<'\000\011\001Y\003<:\000\011\001\300\215\0037\214:\000\011\001\300\215\003\004\301(\000\011\001\300\215\003\004\300\015\000\011\001\300h\003x\000\011\001\3012\0037\214\304\024'\000\011\001\3012\003\300S'\000"},
+    {0x76D,32,"\011\001\300\333\0037\214\304\024'\000\011\001\246\003\004\011\001\301(:\000\011\001\246\003\004\011\001\301(\0317\214\000\011\001\300\333\003\004\011\001\301(\0317\214\000\011\001\3012\003\004\011\001\301(\0317\214\000\011\001\246\003\004\011\001\301('\000\011\001w\003\301\351\301G\0177'\000\011\001w\003\301\351\301G\017B'\000\011\001\302\234]\003\301\351\301G\0177'\000\011\001\302\234]\003\301\351\301G\017B'\000\011\001\302\234]\003\301\351\301G\017O:\000\011\001\301\024\003\301\351\301G\0177'\000\011\001\301\024\003\301\351\301G\017B'\000\011\001]\303r\003\301\351\301G\0177'\000\011\001]\303r\003\301\351\301G\017B'\000\011\001\246\003\301\351\301G\017O:\000\011\001\300\333\003\301\351\301G\017O'\000\011\001\300\333\003\300\221\300\015\000\011\001\300\337\0037\214'\000\300\340\001\303\020\000\300\340\001\353\374\000\300\340\001\346\031\000\300\340\001\305\231\000\300\340\001\305\336\000\300\340\001\342M\000\300\340\001\340\303\000\300\340\001\322n\000\300\340\001\360\036\000\300\340\001\343\330\000\300\340\001\334\243\000\300\340\001\3323\000\300\340\001\305\263\000"},
+    {0x78D,32,"\300\340\001\341\327\000\300\340\001\335p\000\300\340\001\335\362\000\300\340\001\352\222\000\300\340\001\331\351\000\300\340\001\362<\000\300\340\001\355\372\000\300\340\001\305\003\000\300\340\001\347\303\000\300\340\001\340^\000\300\340\001\3254\000\300\340\001\316\262\000\300\340\001\313\244\000\300\340\001\313\375\000\300\340\001\356+\000\300\340\001\317.\000\300\340\001\354\002\000\300\340\001\352C\000\300\340\001\331\314\000\300\340\001C\000\300\340\001\303\004\000\300\340\001\322\134\000\300\340\001\335\302\000\300\340\001\350\255\000\300\340\001\360\334\000\300\340\322'\000\300\340\321\310\000\300\340\337\310\000\300\340\333\375\000\300\340\357\207\000\300\340\347B\000\300\340\333\371\000"},
+    {0x7AD,5,"\300\340\334^\000\300\340\347$\000\300\340\347\034\000\300\340\304\003\000\300\340\001\304\305\000"},
+    {0x7C0,32,"\300\245\017\300%\000\300\245\0172\000\300\245\0177\000\300\245\017B\000\300\245\017O\000\300\245\017V\000\300\245\017v\000\300\245\017\201\000\300\245\017u\000\300\245\017\211\000\300\245\001\025\000\300\245\001\301\017\000\300\245\001;\000\300\245\0019\000\300\245\0011\000\300\245\001\300\354\000\300\245\0016\000\300\245\001\331\323\000\300\245\001\232\000\300\245\001\300\042\000\300\245\001\230\000\300\245\001\265\000\300\245\001\300g\000\300\245\001\300\220\000\300\245\001\300\001\000\300\245\001\235\000\300\245\001\302\024\000\300\245\001\271\000\300\245\001\307\275\000\300\245\001\301\026\000\300\245\001[\000\300\245\001\252\000"},
+    {0x7E0,27,"\300\245\001\256\316\375\000\300\245\001\251\000\300\245\001\300\225\000\300\245\001\256\000\300\245\001\203\000\300\245\001\300q\000\300\245\001\264\000\300\245\001\300\225\316\375\000\300\245\001\307\356\300g\000\300\245\001\307\356\300\220\000\300\245\001\307\356\235\000\300\245 \300w\217\212\000\300\245 \300w\210\212\000\300\245 \300w\302\207\212\000\300\245 \253\307\212\212\000\300\245 \253\217\212\000\300\245 \253\210\212\000\300\245 \253\302\207\212\000\300\245 \310H+\000\300\245 4<'\000\300\245\217\212\303o\000\300\245\210\212\303o\000\300\245\014\300\354\332#\000\300\245\014\335\206\000\300\245\300\251\000\300\245\301\257+\000\300\245\341\351\000"},
+    {0x7FD,32,"\300\245\331\342\000\300\245\332\214\002\000\300\245\355\350\002\000\300\247\001\322e\000\300\247\001\312j\000\300\247\001\335w\000\300\247\001\331\333\000\300\247\001\307\352\000\300\247\001\305\336\000\300\247\001\305\320\000\300\247\001\307\351\000\300\247\001\316\212\000\300\247\001\307\037\000\300\247\001\313\352\000\300\247\001\341\333\000\300\247\001\306}\000\300\247\001\300\263\000\300\247\001\354^\000\300\247\001\300\241\000\300\247\001\303\014\000\300\247\001\356\352\000\300\247\001\350\334\000\300\247\001\310\261\000\300\247\001\300\373\000\300\247\001\355\326\000\300\247+\300\241\000\300\247+\340!\000\300\247+\347)\000\300\247+\301\317\000\300\247>\001\3135\307\037\000\300\247+\3135\307\037\000\300\247\021\002\2539\000"},
+    {0x81D,17,"\300\247\021\0029\000\300\247\021\002\3152\300/\000\300\247\021\002\253\300/\000\300\247\021\002\300/\000\300\247\021\002\3152\025\000\300\247\021\002\253\025\000\300\247\021\002\025\000\300\247>\001\300w\025\000\300\247\021\002\300w\025\000\300\247\021\002\2531\000\300\247\021\0021\000\300\247>\001;\000\300\247\021\002\253;\000\300\247\021\002;\000\300\247\021\0026\000\300\247\021\002\304\003\000\300\247+\314\334\000"},
+    {0x830,15,"\300\247\300\006\314\334\000\300\247\300\006\322I\000\300\247\300\006\322\210\000\300\247\300\006\324\003\000\300\247\300\006\322\360\000\300\247\300\006\354\025\000\300\247\302\027+\000\300\247\300\006\343\337\315\211\000\300\247\300\006\362n\000\300\247\300\006\315\211\000\300\247\300\006\3621\000\300\247\300\006\357\037\000\300\247\300\006\322\303\000\300\247\300\006\316\036\343\261\000\300\247\300\006\322\231\000"},
+    {0x840,28,"\301\210\001\336]\000\301\210\001\301\372\000\301\210\001\305\323\000\301\210\001\304\030\000\301\210\001\302\324\000\301\210\001\357\277\000\301\210\001\312F\000\301\210\001\307\351\000\301\210\001\322\363\000\301\210\001\322a\000\301\210\001\304q\000\301\210\001\302A\000\301\210\001\3032\000\301\210\001\3016\000\301\210\001\302\225\000\301\210\001\300\241\000\301\210\001\312,\000\301\210\001\322\352\000\301\210\001\305\016\000\301\210\001\3070\000\301\210\001\300\274\000\301\210\001\301\234\000\301\210\001\333\255\000\301\210\001\340\311\000\301\210\001\300\375\000\301\210\322F+\000\301\210\360\216+\000\301\210\305\077+\000"},
+    {0x85E,1,"\301\210\300\006\000"},
+    {0x860,11,"\300-\001\222\300c\000\300-\001\222\300g\000\300-\001\222\300\225\000\300-\001\222\300\334\000\300-\001\222\301\002\000\300-\001\222\305{\000\300-\001\222\301\004\000\300-\001\222\235\000\300-\001\222\301\243\000\300-\001\222\304\277\000\300-\001\222\301&\000"},
+    {0x870,31,"\011\001w\003\301\374\302\235\000\011\001w\003\301\374\300\365&\302\235\000\011\001w\003&MI\000\011\001w\003(MI\000\011\001w\003\301\374\302\241\000\011\001w\003\301\374\3017&\302\241\000\011\001w\003\301\374\302\314<'\000\011\001w\003\301\374&\302\314<\000\011\001w\003\301\374(\302\314<\000\011\001w\003\301\374\302\314<:\000\011\001w\003<'\000\011\001w\003\301\374\300\365&\302\235\031<'\000\011\001w\003&MI\031<'\000\011\001w\003\301\374\3017&\302\241\031<'\000\011\001w\003\301\374\300\365&\302\235\031(\240\000\011\001w\003&MI\031(\240\000\011\001w\003\301\374\3017&\302\241\031(\240\000\011\001w\003\301\374&\300S\000\011\001w\003\301\374(\300S\000\011\304\356\003\3154\300S\000\011\304\356\003\3154\301\024\000\011\304\356\0037\214:\000\011\001\306\366]\000\011\312R\302\314<\000\011\301T\302\314<\000\011\001\300\215\003\300\221\004\300\015\000\011\001\246\003\300\221\004\300\015:\000\011\001\301(\003<:\000\011\001\301(\003B\214:\000\011\001\302\350\0037\214\304\024:\000\011T\300\253\000"},
+    {0x890,2,"\011\306\256+'\000\011\350\003+'\000"},
+    {0x898,32,"\011\004\217\301\344\322c\000\011\004\210\301\344\340K\000\011\004\210\301\344\340\030\000\011\004\210\301\344\355\365\000\011\303\031\360\333\000\011\301\232w\344l\000\011\305+\303\031\000\011o\303\031\223\303\031\000\011\001\300\376\003\004\300\015:\000\011\001\300\376\003\300S'\000\011\001\300\004\0037\214'\000\011\001\301(\0037\214'\000\011\001\301.\003<:\031B\214'\000\011\001\301D\003<:\000\011\001\300h\0034x\000\011\001Y\003B\214'\000\011\001]\0037\214:\031\300S'\000\011\001]\0037\214:\031<'\000\011\001\3012\003\301\244\000\011\001\301\024\003<\304j\000\011\001\300\332]\000\011\001\210w\000\011\001\302\035\003B\214:\000\011\001\301U\003B\214:\000\011\001\303I\003\300\221I\000\011\001\301F\301\024\000\011\001\302p\003\300\221\300\015'\000\011\001\300\375\003B\214:\000\011\001\300\337\003<:\000\011\001\301D\003<:\031\301#\214'\000\011\001\300\376\003\004Y'\000\011\001\303\230\003\004Y'\000"},
+    {0x8B8,32,"\011\001\300\322\003\004\300\322'\000\011\001\3012\003\004\300\215'\000\011\001]\0037\214:\031\004\300\215'\000\011\001\305\010\301.\000\011\001\305\010\301D\000\011\001\305\010\300\215\000\011\001\303\230\003\004\300\015\000\011\001\300\322\003\004\300\015\000\011\001\304\365\003\004\300\015\000\011\001\304^\003\004\300\015\000\011\001\302\350\003\004\300\015\000\011\001\301\261\003B\214'\000\011\001\305\010\301D\003B\214'\000\011\001\300\004\003B\214'\000\011\001\300\004\003B\214:\000\011\001\300h\003\004\011\001\301('\000\011\001\336\010\000\011\004\302\234]\000\011\004\217\302\234]\000\011\004\217]\303r\0037\214:\000\011\004\217\301\344\315\317\000\011\004\217\302\260\000\011\300#\302\314<'\000\011\300#\302\314<:\000\011\304\003:\000\011\300#y:\000\011\300#\302\314<\302!y:\000\011\004\210\301\024\000\011\004\217\301\344\322\266\000\011\004\217\301U\000\011\004\217\300\375\000\011\004\217\301D\000"},
+    {0x8D8,32,"\011\004\217\300\215\003\302\241\000\011\004\210\300\215\003\302\241\000\011\004\217\301\344\322\353\000\011\004\217\301\344\322\326\000\011\004\217\301\344\322\203\000\011\004\217\301\344\352Q\000\011\004\217\301\344\350\314\000\011\004\217\301\344\360\347\000\011\004\217\313U\303\337\000\011\004\217\002\315\316\000\011\332h\301lK\312D\000\011\241\303\012:\000\011\301\077\302\235\000\011\301\077\303\012\000\011\301\077\302\241\000\011\301\077\304,\000\011\301\077\305%\000\011\301\077\305Y\000\011\2122<'\000\011\2127\214'\000\011\212\301\244'\000\011\2122<:\000\011\2127\214:\000\011\212\301\244:\000\011\262\304,\000\011\262\305%\000\011\262\305Y\000\011\004\217\301\024\000\011\302\235\003\240\000\011\302\235\003<'\000\011\302\241\003<:\000\011(\300a'\000"},
+    {0x8F8,32,"\011&\300a'\000\011(\300a:\000\011&\300a:\000\0114&\300a'\000\0114&\300a'\003<\000\011&\300a'\003<\000\011\303\012\003<\000\011+\302%\300\215\305A\000m\002\300\221\301P\000m\002\301P\000m\002\300\316\000m\002\3014\000m\001\300w\025\000m\001\025\000m\001\300/\000m\001;\000m\001\300T\000m\0011\000m\001\300l\000m\001|c\000m\001|p\000m\001\302t9\000m\001\300w9\000m\0019\000m\001\300L\000m\001\302t6\000m\001\300w6\000m\0016\000m\001\300d\000m\001[\000m\001\300\223\000m\001\300\005\000"},
+    {0x918,32,"m\001\300\361\000m\001\300c\000m\001\300m\000m\001\300\220\000m\001\300g\000m\001\301B\000m\001\300\225\000m\001\300\334\000m\001\301\023\000m\001\300\335\000m\001\301\036\000m\001\301\002\000m\001\265\000m\001\300\254\000m\001\300\001\000m\001\300\353\000m\001\256\000m\001\305{\000m\001\230\000m\001\300\306\000m\001\300\042\000m\001\301\004\000m\001\251\000m\001\264\000m\001\235\000m\001\302\024\000m\001\252\000m\001\301\243\000m\001\304\277\000m\001\300\307\000m\001\300j\000m\001\301&\000"},
+    {0x938,32,"m\001\271\000m\001\203\000m\021\002\301\007\000m\021\002\315(\000m\002\301\306\000m\002\302Y\000m\021\002\300/\000m\021\002;\000m\021\002\300T\000m\021\0021\000m\021\002\300l\000m\021\002|c\000m\021\002|\301%\000m\021\002\302t9\000m\021\002\300w9\000m\021\0029\000m\021\002\300L\000m\021\002\302t6\000m\021\002\300w6\000m\021\0026\000m\021\002\300d\000m\002\301\031\000m\021\002\310\2329\000m\021\002\3075\000m\302\303\000m\305\254\002\307\013\000m\305\254\002\305\014\000m\300\200\300\206\000m\300!\300\206\000m\021\002\302t\2539\000m\021\002\301\343\000m\021\002\3116\000"},
+    {0x958,32,"m\001\302\023\000m\001\314\003\000m\001\307\303\000m\001\300\341\000m\001\312\340\000m\001\303\235\000m\001\301\026\000m\001\307 \000m\001|\301%\000m\001|\301J\000m\021\002|p\000m\021\002|\301J\000m\301z\000m4\301z\000m\017\300%\000m\0172\000m\0177\000m\017B\000m\017O\000m\017V\000m\017v\000m\017\201\000m\017u\000m\017\211\000m\302\027\002\000m\002\217\310\343<\000m\001\302t\025\000m\001\301\007\000m\001\315(\000m\001\3075\000m\001\301\343\000m\001\3116\000"},
+    {0x978,12,"m\001\343\256\300\335\000m\001\301\371\000m\001L\264\000m\001\304\237\000m\001\305T\000m\001\301I\300k\000m\001\305\377\000m\001\304\035\000\300\031\307-\000\300\031\002\301P\000\300\031\002\300\316\000\300\031\002\3014\000"},
+    {0x985,8,"\300\031\001\025\000\300\031\001\300/\000\300\031\001;\000\300\031\001\300T\000\300\031\0011\000\300\031\001\300l\000\300\031\001|c\000\300\031\001|p\000"},
+    {0x98F,2,"\300\031\0019\000\300\031\001\300L\000"},
+    {0x993,22,"\300\031\0016\000\300\031\001\300d\000\300\031\001[\000\300\031\001\300\223\000\300\031\001\300\005\000\300\031\001\300\361\000\300\031\001\300c\000\300\031\001\300m\000\300\031\001\300\220\000\300\031\001\300g\000\300\031\001\301B\000\300\031\001\300\225\000\300\031\001\300\334\000\300\031\001\301\023\000\300\031\001\300\335\000\300\031\001\301\036\000\300\031\001\301\002\000\300\031\001\265\000\300\031\001\300\254\000\300\031\001\300\001\000\300\031\001\300\353\000\300\031\001\256\000"},
+    {0x9AA,7,"\300\031\001\230\000\300\031\001\300\306\000\300\031\001\300\042\000\300\031\001\301\004\000\300\031\001\251\000\300\031\001\264\000\300\031\001\235\000"},
+    {0x9B2,1,"\300\031\001\252\000"},
+    {0x9B6,4,"\300\031\001\300j\000\300\031\001\301&\000\300\031\001\271\000\300\031\001\203\000"},
+    {0x9BC,9,"\300\031\002\301\306\000\300\031\002\302Y\000\300\031\021\002\300/\000\300\031\021\002;\000\300\031\021\002\300T\000\300\031\021\0021\000\300\031\021\002\300l\000\300\031\021\002|c\000\300\031\021\002|\301%\000"},
+    {0x9C7,2,"\300\031\021\0029\000\300\031\021\002\300L\000"},
+    {0x9CB,4,"\300\031\021\0026\000\300\031\021\002\300d\000\300\031\002\301\031\000\300\031\001\341\027\265\000"},
+    {0x9D7,1,"\300\031\300d\302\202+\000"},
+    {0x9DC,2,"\300\031\001\302\024\000\300\031\001\303\235\000"},
+    {0x9DF,5,"\300\031\001\307 \000\300\031\001|\301%\000\300\031\001|\301J\000\300\031\021\002|p\000\300\031\021\002|\301J\000"},
+    {0x9E6,25,"\300\031\017\300%\000\300\031\0172\000\300\031\0177\000\300\031\017B\000\300\031\017O\000\300\031\017V\000\300\031\017v\000\300\031\017\201\000\300\031\017u\000\300\031\017\211\000\300\031\001\235\003M\274\000\300\031\001\235\003l\274\000\300\031\303\366+\000\300\031\303\366\002\000\300\031\303<\304\3142\000\300\031\303<\304\3147\000\300\031\303<\304\314B\000\300\031\303<\304\314O\000\300\031\303<\304\3142\342D\304\360\301\011\312\355\000\300\031\303<\312\355\303`\000\300\031\313\330\000\300\031\335z+\000\300\031\001\300\357\300\316\000\300\031\302\027\002\000\300\031\303\236+\000"},
+    {0xA01,3,"\300R\002\3222\312g\000\300R\002\312g\000\300R\002\3014\000"},
+    {0xA05,6,"\300R\001\025\000\300R\001\300/\000\300R\001;\000\300R\001\300T\000\300R\0011\000\300R\001\300l\000"},
+    {0xA0F,2,"\300R\001\301\017\000\300R\001\300L\000"},
+    {0xA13,22,"\300R\001\300\354\000\300R\001\300d\000\300R\001[\000\300R\001\300\223\000\300R\001\300\005\000\300R\001\300\361\000\300R\001\300c\000\300R\001\300m\000\300R\001\300\220\000\300R\001\300g\000\300R\001\301B\000\300R\001\300\225\000\300R\001\300\334\000\300R\001\301\023\000\300R\001\300\335\000\300R\001\301\036\000\300R\001\301\002\000\300R\001\265\000\300R\001\300\254\000\300R\001\300\001\000\300R\001\300\353\000\300R\001\256\000"},
+    {0xA2A,7,"\300R\001\230\000\300R\001\300\306\000\300R\001\300\042\000\300R\001\301\004\000\300R\001\251\000\300R\001\264\000\300R\001\235\000"},
+    {0xA32,2,"\300R\001\252\000\300R\001\301\243\000"},
+    {0xA35,2,"\300R\001\300\307\000\300R\001\300j\000"},
+    {0xA38,2,"\300R\001\271\000\300R\001\203\000"},
+    {0xA3C,1,"\300R\002\301\306\000"},
+    {0xA3E,5,"\300R\021\002\300/\000\300R\021\002;\000\300R\021\002\300T\000\300R\021\0021\000\300R\021\002\300l\000"},
+    {0xA47,2,"\300R\021\002\301\017\000\300R\021\002\300L\000"},
+    {0xA4B,3,"\300R\021\002\300\354\000\300R\021\002\300d\000\300R\002\301\031\000"},
+    {0xA51,1,"\300R\002\357\210\000"},
+    {0xA59,4,"\300R\001\314\003\000\300R\001\307\303\000\300R\001\300\341\000\300R\001\302\024\000"},
+    {0xA5E,1,"\300R\001\301\026\000"},
+    {0xA66,17,"\300R\017\300%\000\300R\0172\000\300R\0177\000\300R\017B\000\300R\017O\000\300R\017V\000\300R\017v\000\300R\017\201\000\300R\017u\000\300R\017\211\000\300R\356u\000\300R\3223\000\300R\340D\000\300R\357\266\000\300R\304\223\347@\000\300R\002\361\234\000\300R\302\027\002\000"},
+    {0xA81,3,"\300&\002\301P\000\300&\002\300\316\000\300&\002\3014\000"},
+    {0xA85,9,"\300&\001\025\000\300&\001\300/\000\300&\001;\000\300&\001\300T\000\300&\0011\000\300&\001\300l\000\300&\001|c\000\300&\001|p\000\300&\021\302t9\000"},
+    {0xA8F,3,"\300&\0019\000\300&\001\300L\000\300&\021\302t6\000"},
+    {0xA93,22,"\300&\0016\000\300&\001\300d\000\300&\001[\000\300&\001\300\223\000\300&\001\300\005\000\300&\001\300\361\000\300&\001\300c\000\300&\001\300m\000\300&\001\300\220\000\300&\001\300g\000\300&\001\301B\000\300&\001\300\225\000\300&\001\300\334\000\300&\001\301\023\000\300&\001\300\335\000\300&\001\301\036\000\300&\001\301\002\000\300&\001\265\000\300&\001\300\254\000\300&\001\300\001\000\300&\001\300\353\000\300&\001\256\000"},
+    {0xAAA,7,"\300&\001\230\000\300&\001\300\306\000\300&\001\300\042\000\300&\001\301\004\000\300&\001\251\000\300&\001\264\000\300&\001\235\000"},
+    {0xAB2,2,"\300&\001\252\000\300&\001\301\243\000"},
+    {0xAB5,5,"\300&\001\300\307\000\300&\001\300j\000\300&\001\301&\000\300&\001\271\000\300&\001\203\000"},
+    {0xABC,10,"\300&\002\301\306\000\300&\002\302Y\000\300&\021\002\300/\000\300&\021\002;\000\300&\021\002\300T\000\300&\021\0021\000\300&\021\002\300l\000\300&\021\002|c\000\300&\021\002|\301%\000\300&\021\002\302t9\000"},
+    {0xAC7,3,"\300&\021\0029\000\300&\021\002\300L\000\300&\021\002\302t6\000"},
+    {0xACB,3,"\300&\021\0026\000\300&\021\002\300d\000\300&\002\301\031\000"},
+    {0xAD0,1,"\300&\302\303\000"},
+    {0xAE0,4,"\300&\001|\301%\000\300&\001|\301J\000\300&\021\002|p\000\300&\021\002|\301J\000"},
+    {0xAE6,12,"\300&\017\300%\000\300&\0172\000\300&\0177\000\300&\017B\000\300&\017O\000\300&\017V\000\300&\017v\000\300&\017\201\000\300&\017u\000\300&\017\211\000\300&\302\027\002\000\300&\303\366\002\000"},
+    {0xAF9,7,"\300&\001\301\371\000\300&\002\304\003\000\300&\002\302\250\000\300&\002\314\210\000\300&\002\356F\301\306'\000\300&\002y\301\306'\000\300&\002\3111\301\306'\000"},
+    {0xB01,3,"\300*\002\301P\000\300*\002\300\316\000\300*\002\3014\000"},
+    {0xB05,8,"\300*\001\025\000\300*\001\300/\000\300*\001;\000\300*\001\300T\000\300*\0011\000\300*\001\300l\000\300*\001|c\000\300*\001|p\000"},
+    {0xB0F,2,"\300*\0019\000\300*\001\300L\000"},
+    {0xB13,22,"\300*\0016\000\300*\001\300d\000\300*\001[\000\300*\001\300\223\000\300*\001\300\005\000\300*\001\300\361\000\300*\001\300c\000\300*\001\300m\000\300*\001\300\220\000\300*\001\300g\000\300*\001\301B\000\300*\001\300\225\000\300*\001\300\334\000\300*\001\301\023\000\300*\001\300\335\000\300*\001\301\036\000\300*\001\301\002\000\300*\001\265\000\300*\001\300\254\000\300*\001\300\001\000\300*\001\300\353\000\300*\001\256\000"},
+    {0xB2A,7,"\300*\001\230\000\300*\001\300\306\000\300*\001\300\042\000\300*\001\301\004\000\300*\001\251\000\300*\001\264\000\300*\001\235\000"},
+    {0xB32,2,"\300*\001\252\000\300*\001\301\243\000"},
+    {0xB35,5,"\300*\001\300\307\000\300*\001\300j\000\300*\001\301&\000\300*\001\271\000\300*\001\203\000"},
+    {0xB3C,9,"\300*\002\301\306\000\300*\002\302Y\000\300*\021\002\300/\000\300*\021\002;\000\300*\021\002\300T\000\300*\021\0021\000\300*\021\002\300l\000\300*\021\002|c\000\300*\021\002|\301%\000"},
+    {0xB47,2,"\300*\021\0029\000\300*\021\002\300L\000"},
+    {0xB4B,3,"\300*\021\0026\000\300*\021\002\300d\000\300*\002\301\031\000"},
+    {0xB55,3,"\300*\002\303\355\000\300*\300L\302\202+\000\300*\300d\302\202+\000"},
+    {0xB5C,2,"\300*\001\302\024\000\300*\001\303\235\000"},
+    {0xB5F,5,"\300*\001\307 \000\300*\001|\301%\000\300*\001|\301J\000\300*\021\002|p\000\300*\021\002|\301J\000"},
+    {0xB66,18,"\300*\017\300%\000\300*\0172\000\300*\0177\000\300*\017B\000\300*\017O\000\300*\017V\000\300*\017v\000\300*\017\201\000\300*\017u\000\300*\017\211\000\300*\313\330\000\300*\001\300q\000\300*\300\0162\3011\000\300*\300\0162o\000\300*\300\016B\302\206\000\300*\300\0162\304\345\000\300*\300\0162\301,\000\300*\300\016B\306\340\000"},
+    {0xB82,2,"\220\002\300\316\000\220\002\3014\000"},
+    {0xB85,6,"\220\001\025\000\220\001\300/\000\220\001;\000\220\001\300T\000\220\0011\000\220\001\300l\000"},
+    {0xB8E,3,"\220\0019\000\220\001\301\017\000\220\001\300L\000"},
+    {0xB92,4,"\220\0016\000\220\001\300\354\000\220\001\300d\000\220\001[\000"},
+    {0xB99,2,"\220\001\300c\000\220\001\300m\000"},
+    {0xB9C,1,"\220\001\300g\000"},
+    {0xB9E,2,"\220\001\300\225\000\220\001\300\334\000"},
+    {0xBA3,2,"\220\001\301\002\000\220\001\265\000"},
+    {0xBA8,3,"\220\001\256\000\220\001\305{\000\220\001\230\000"},
+    {0xBAE,12,"\220\001\251\000\220\001\264\000\220\001\235\000\220\001\302\024\000\220\001\252\000\220\001\301\243\000\220\001\304\277\000\220\001\300\307\000\220\001\300j\000\220\001\301&\000\220\001\271\000\220\001\203\000"},
+    {0xBBE,5,"\220\021\002\300/\000\220\021\002;\000\220\021\002\300T\000\220\021\0021\000\220\021\002\300l\000"},
+    {0xBC6,3,"\220\021\0029\000\220\021\002\301\017\000\220\021\002\300L\000"},
+    {0xBCA,4,"\220\021\0026\000\220\021\002\300\354\000\220\021\002\300d\000\220\002\301\031\000"},
+    {0xBD0,1,"\220\302\303\000"},
+    {0xBD7,1,"\220\300d\302\202+\000"},
+    {0xBE6,21,"\220\017\300%\000\220\0172\000\220\0177\000\220\017B\000\220\017O\000\220\017V\000\220\017v\000\220\017\201\000\220\017u\000\220\017\211\000\220\036\300H\000\220\0362\207\000\220\0362\254\000\220\301a\002\000\220\310;\002\000\220\317\023\002\000\220\332\015\002\000\220\307s\002\000\220\302\225'\002\000\220\303\366\002\000\220\036\002\000"},
+    {0xC00,13,"\300\012\002 \301P'\000\300\012\002\301P\000\300\012\002\300\316\000\300\012\002\3014\000\300\012\002 \300\316'\000\300\012\001\025\000\300\012\001\300/\000\300\012\001;\000\300\012\001\300T\000\300\012\0011\000\300\012\001\300l\000\300\012\001|c\000\300\012\001|p\000"},
+    {0xC0E,3,"\300\012\0019\000\300\012\001\301\017\000\300\012\001\300L\000"},
+    {0xC12,23,"\300\012\0016\000\300\012\001\300\354\000\300\012\001\300d\000\300\012\001[\000\300\012\001\300\223\000\300\012\001\300\005\000\300\012\001\300\361\000\300\012\001\300c\000\300\012\001\300m\000\300\012\001\300\220\000\300\012\001\300g\000\300\012\001\301B\000\300\012\001\300\225\000\300\012\001\300\334\000\300\012\001\301\023\000\300\012\001\300\335\000\300\012\001\301\036\000\300\012\001\301\002\000\300\012\001\265\000\300\012\001\300\254\000\300\012\001\300\001\000\300\012\001\300\353\000\300\012\001\256\000"},
+    {0xC2A,16,"\300\012\001\230\000\300\012\001\300\306\000\300\012\001\300\042\000\300\012\001\301\004\000\300\012\001\251\000\300\012\001\264\000\300\012\001\235\000\300\012\001\302\024\000\300\012\001\252\000\300\012\001\301\243\000\300\012\001\304\277\000\300\012\001\300\307\000\300\012\001\300j\000\300\012\001\301&\000\300\012\001\271\000\300\012\001\203\000"},
+    {0xC3C,9,"\300\012\002\301\306\000\300\012\002\302Y\000\300\012\021\002\300/\000\300\012\021\002;\000\300\012\021\002\300T\000\300\012\021\0021\000\300\012\021\002\300l\000\300\012\021\002|c\000\300\012\021\002|\301%\000"},
+    {0xC46,3,"\300\012\021\0029\000\300\012\021\002\301\017\000\300\012\021\002\300L\000"},
+    {0xC4A,4,"\300\012\021\0026\000\300\012\021\002\300\354\000\300\012\021\002\300d\000\300\012\002\301\031\000"},
+    {0xC55,2,"\300\012\302\202+\000\300\012\300L\302\202+\000"},
+    {0xC58,3,"\300\012\001\301\201\000\300\012\001\302\271\000\300\012\001\351\307\000"},
+    {0xC5D,1,"\300\012\001\314\315\315r\000"},
+    {0xC60,4,"\300\012\001|\301%\000\300\012\001|\301J\000\300\012\021\002|p\000\300\012\021\002|\301J\000"},
+    {0xC66,10,"\300\012\017\300%\000\300\012\0172\000\300\012\0177\000\300\012\017B\000\300\012\017O\000\300\012\017V\000\300\012\017v\000\300\012\017\201\000\300\012\017u\000\300\012\017\211\000"},
+    {0xC77,22,"\300\012\002\300\022\000\300\012\300\016\017\300%)\304G\304MKO\000\300\012\300\016\0172)\304G\304MKO\000\300\012\300\016\0177)\304G\304MKO\000\300\012\300\016\017B)\304G\304MKO\000\300\012\300\016\0172)\304\231\304MKO\000\300\012\300\016\0177)\304\231\304MKO\000\300\012\300\016\017B)\304\231\304MKO\000\300\012\002\357$\000\300,\002\310\343\301P\000\300,\002\301P\000\300,\002\300\316\000\300,\002\3014\000\300,\002\300\022\000\300,\001\025\000\300,\001\300/\000\300,\001;\000\300,\001\300T\000\300,\0011\000\300,\001\300l\000\300,\001|c\000\300,\001|p\000"},
+    {0xC8E,3,"\300,\0019\000\300,\001\301\017\000\300,\001\300L\000"},
+    {0xC92,23,"\300,\0016\000\300,\001\300\354\000\300,\001\300d\000\300,\001[\000\300,\001\300\223\000\300,\001\300\005\000\300,\001\300\361\000\300,\001\300c\000\300,\001\300m\000\300,\001\300\220\000\300,\001\300g\000\300,\001\301B\000\300,\001\300\225\000\300,\001\300\334\000\300,\001\301\023\000\300,\001\300\335\000\300,\001\301\036\000\300,\001\301\002\000\300,\001\265\000\300,\001\300\254\000\300,\001\300\001\000\300,\001\300\353\000\300,\001\256\000"},
+    {0xCAA,10,"\300,\001\230\000\300,\001\300\306\000\300,\001\300\042\000\300,\001\301\004\000\300,\001\251\000\300,\001\264\000\300,\001\235\000\300,\001\302\024\000\300,\001\252\000\300,\001\301\243\000"},
+    {0xCB5,5,"\300,\001\300\307\000\300,\001\300j\000\300,\001\301&\000\300,\001\271\000\300,\001\203\000"},
+    {0xCBC,9,"\300,\002\301\306\000\300,\002\302Y\000\300,\021\002\300/\000\300,\021\002;\000\300,\021\002\300T\000\300,\021\0021\000\300,\021\002\300l\000\300,\021\002|c\000\300,\021\002|\301%\000"},
+    {0xCC6,3,"\300,\021\0029\000\300,\021\002\301\017\000\300,\021\002\300L\000"},
+    {0xCCA,4,"\300,\021\0026\000\300,\021\002\300\354\000\300,\021\002\300d\000\300,\002\301\031\000"},
+    {0xCD5,2,"\300,\302\202+\000\300,\300L\302\202+\000"},
+    {0xCDD,2,"\300,\001\314\315\315r\000\300,\001\301\026\000"},
+    {0xCE0,4,"\300,\001|\301%\000\300,\001|\301J\000\300,\021\002|p\000\300,\021\002|\301J\000"},
+    {0xCE6,10,"\300,\017\300%\000\300,\0172\000\300,\0177\000\300,\017B\000\300,\017O\000\300,\017V\000\300,\017v\000\300,\017\201\000\300,\017u\000\300,\017\211\000"},
+    {0xCF1,2,"\300,\002\304\262\000\300,\002\304\371\000"},
+    {0xD00,13,"\222\002 \300\316'\000\222\002\301P\000\222\002\300\316\000\222\002\3014\000\222\001\300\357\300\316\000\222\001\025\000\222\001\300/\000\222\001;\000\222\001\300T\000\222\0011\000\222\001\300l\000\222\001|c\000\222\001|p\000"},
+    {0xD0E,3,"\222\0019\000\222\001\301\017\000\222\001\300L\000"},
+    {0xD12,32,"\222\0016\000\222\001\300\354\000\222\001\300d\000\222\001[\000\222\001\300\223\000\222\001\300\005\000\222\001\300\361\000\222\001\300c\000\222\001\300m\000\222\001\300\220\000\222\001\300g\000\222\001\301B\000\222\001\300\225\000\222\001\300\334\000\222\001\301\023\000\222\001\300\335\000\222\001\301\036\000\222\001\301\002\000\222\001\265\000\222\001\300\254\000\222\001\300\001\000\222\001\300\353\000\222\001\256\000\222\001\305{\000\222\001\230\000\222\001\300\306\000\222\001\300\042\000\222\001\301\004\000\222\001\251\000\222\001\264\000\222\001\235\000\222\001\302\024\000"},
+    {0xD32,19,"\222\001\252\000\222\001\301\243\000\222\001\304\277\000\222\001\300\307\000\222\001\300j\000\222\001\301&\000\222\001\271\000\222\001\203\000\222\001\316\267\000\222\002Tx\301\031\000\222\002\305\035\301\031\000\222\002\302Y\000\222\021\002\300/\000\222\021\002;\000\222\021\002\300T\000\222\021\0021\000\222\021\002\300l\000\222\021\002|c\000\222\021\002|\301%\000"},
+    {0xD46,3,"\222\021\0029\000\222\021\002\301\017\000\222\021\002\300L\000"},
+    {0xD4A,6,"\222\021\0026\000\222\021\002\300\354\000\222\021\002\300d\000\222\002\301\031\000\222\001<\351d\000\222\002\315@\000"},
+    {0xD54,16,"\222\001\303x\261\000\222\001\303x\300$\000\222\001\303x\342~\000\222\300d\302\202+\000\222\300\0162\315%\000\222\300\0162\313W\000\222\300\016B\313(\000\222\300\0162\316\275\000\222\300\0162\311\011\000\222\300\016B\316\276\000\222\300\0162\307\252\000\222\001\301\034\300T\000\222\001|\301%\000\222\001|\301J\000\222\021\002|p\000\222\021\002|\301J\000"},
+    {0xD66,26,"\222\017\300%\000\222\0172\000\222\0177\000\222\017B\000\222\017O\000\222\017V\000\222\017v\000\222\017\201\000\222\017u\000\222\017\211\000\222\036\300H\000\222\0362\207\000\222\0362\254\000\222\300\0162\3011\000\222\300\0162o\000\222\300\016B\302\206\000\222\300\0162\304\345\000\222\300\0162\301,\000\222\300\016B\306\340\000\222\312\334+\000\222\001\303x\305z\000\222\001\303x\232\000\222\001\303x\301%\000\222\001\303xp\000\222\001\303x\301J\000\222\001\303x\300\011\000"},
+    {0xD81,3,"\263\002\301P\000\263\002\322\243\000\263\002\360\207\000"},
+    {0xD85,18,"\263\001\323\014\000\263\001\321\321\000\263\001\322E\000\263\001\322>\000\263\001\340S\000\263\001\340\020\000\263\001\357\314\000\263\001\357\311\000\263\001\340G\000\263\001\340F\000\263\001\340\027\000\263\001\340\025\000\263\001\334]\000\263\001\334\002\000\263\001\322_\000\263\001\347b\000\263\001\347F\000\263\001\323\004\000"},
+    {0xD9A,24,"\263\001\3031\313\363\000\263\001\303S\313\363\000\263\001\3031\307\273\000\263\001\303S\307\273\000\263\001\340\325\314\313\000\263\001\306\316\307\273\000\263\001\3031\312\232\000\263\001\303S\312\232\000\263\001\3031\307\353\000\263\001\303S\307\353\000\263\001\311\002\314\313\000\263\001\311\002\352e\344\370\000\263\001\306\316\307\353\000\263\001\3031\316\263\000\263\001\303S\316\263\000\263\001\3031\307\203\000\263\001\303S\307\203\000\263\001\310C\314\323\000\263\001\306\316\307\203\000\263\001\3031\316m\000\263\001\303S\316m\000\263\001\3031\307\200\000\263\001\303S\307\200\000\263\001\307~\314\323\000"},
+    {0xDB3,9,"\263\001\306\316\307\200\000\263\001\3031\315F\000\263\001\303S\315F\000\263\001\3031\307A\000\263\001\303S\307A\000\263\001\343\277\000\263\001\322{\307A\000\263\001\361\254\000\263\001\351@\000"},
+    {0xDBD,1,"\263\001\307~\3144\000"},
+    {0xDC0,7,"\263\001\360/\000\263\001\311\002\310\274\000\263\001\310C\310\274\000\263\001\307~\310\274\000\263\001\336u\000\263\001\310C\3144\000\263\001\334\277\000"},
+    {0xDCA,1,"\263\002\322d\000"},
+    {0xDCF,6,"\263\021\002\307(\000\263\021\002\307\373\312\022\000\263\021\002\304#\312\022\000\263\021\002\307\373\313\327\000\263\021\002\304#\313\327\000\263\021\002\307\373\3156\000"},
+    {0xDD6,1,"\263\021\002\304#\3156\000"},
+    {0xDD8,8,"\263\021\002\313d\000\263\021\002\305\134\000\263\021\002\304#\305\134\000\263\021\002\341o\332\032\000\263\021\002\305\134\303\020\307(\000\263\021\002\305\134\303\020\304#\307(\000\263\021\002\305\134\303\020\307\274\000\263\021\002\307\274\000"},
+    {0xDE6,10,"\263\303Q\017\300%\000\263\303Q\0172\000\263\303Q\0177\000\263\303Q\017B\000\263\303Q\017O\000\263\303Q\017V\000\263\303Q\017v\000\263\303Q\017\201\000\263\303Q\017u\000\263\303Q\017\211\000"},
+    {0xDF2,3,"\263\021\002\304#\313d\000\263\021\002\304#\307\274\000\263\300\006\341\232\000"},
+    {0xE01,32,"\3009\300\034\301\303\304\263\000\3009\300\034\302\351\313\376\000\3009\300\034\302\351\341#\000\3009\300\034\302\351\341&\000\3009\300\034\302\351\341\036\000\3009\300\034\302\351\3513\000\3009\300\034\304F\345\221\000\3009\300\034\303\010\325-\000\3009\300\034\303\010\325P\000\3009\300\034\303\010\325.\000\3009\300\034\301\273\301\273\000\3009\300\034\303\010\325\134\000\3009\300\034\301i\361\312\000\3009\300\034\302\013\325(\000\3009\300\034C\347\276\000\3009\300\034\302\004\304\360\000\3009\300\034\302\004\344\376\000\3009\300\034\302\004\347\377\000\3009\300\034\301#\310P\000\3009\300\034\302\013\332\031\000\3009\300\034C\355\355\000\3009\300\034\302\004\356O\000\3009\300\034\302\004\356,\000\3009\300\034\302\004\316\200\000\3009\300\034\301#\301e\000\3009\300\034\302\332\323\353\000\3009\300\034\3029\306\251\000\3009\300\034\303\035\347\376\000\3009\300\034\303\017\301\026\000\3009\300\034\303\035\347\362\000\3009\300\034\303\017\313E\000\3009\300\034\303\035\352\134\000"},
+    {0xE21,26,"\3009\300\034\301\361\251\000\3009\300\034\301i\311M\000\3009\300\034\301\267\351\336\000\3009\300\034\301\337\000\3009\300\034\302\020\314D\000\3009\300\034\301\265\000\3009\300\034\301\331\360\336\000\3009\300\034\301\273\352S\000\3009\300\034\301\273\351\361\000\3009\300\034\301\273\310\366\000\3009\300\034\301\242\304\246\000\3009\300\034\302\020\325d\000\3009\300\0346\302\262\000\3009\300\034\301\242\346\021\000\3009\300\034\347\201\000\3009\300\034\302\247\025\000\3009\300\034\301\357\336b\000\3009\300\034\302\247\300/\000\3009\300\034\302\247\3032\000\3009\300\034\302\247;\000\3009\300\034\302\247\300T\000\3009\300\034\302\247\301\343\000\3009\300\034\302\247\357\215\000\3009\300\034\302\2471\000\3009\300\034\302\247\300l\000\3009\300\034\347\370\000"},
+    {0xE3F,29,"\3009\303<\014\323\352\000\3009\300\034\302\2479\000\3009\300\034\302\247\301X\000\3009\300\034\302\2476\000\3009\300\034\302\247\300L\343\214\000\3009\300\034\302\247\300L\343\213\000\3009\300\034\342\024\000\3009\300\034\343\217\000\3009\300\034\343\216\000\3009\300\034\301\357\304\223\000\3009\300\034\301\357\302\004\000\3009\300\034\301\357\356\267\000\3009\300\034\301\357\3252\000\3009\300\034\3560\000\3009\300\034\345\267\000\3009\300\034\361\237\000\3009\300\034\335\004\000\3009\017\300%\000\3009\0172\000\3009\0177\000\3009\017B\000\3009\017O\000\3009\017V\000\3009\017v\000\3009\017\201\000\3009\017u\000\3009\017\211\000\3009\300\034\322\213\000\3009\300\034\341\035\000"},
+    {0xE81,2,"\300I\001\301\303\000\300I\001\302\351\304\353\000"},
+    {0xE84,1,"\300I\001\302\351\304\134\000"},
+    {0xE86,5,"\300I\001\302\306\300\361\000\300I\001\304F\000\300I\001\302\334\000\300I\001\302\306\300\220\000\300I\001\301\273\304\134\000"},
+    {0xE8C,24,"\300I\001\302\306\301B\000\300I\001\303\226\000\300I\001\302\306\300\225\000\300I\001\302\306\300\334\000\300I\001\302\306\301\023\000\300I\001\302\306\300\335\000\300I\001\302\306\301\036\000\300I\001\302\306\301\002\000\300I\001\302\013\000\300I\001C\000\300I\001\302\004\304\353\000\300I\001\302\004\304\134\000\300I\001\302\306\300\353\000\300I\001\301#\000\300I\001\302\332\000\300I\001\3029\000\300I\001\303\035\304\353\000\300I\001\303\017\304\134\000\300I\001\303\035\304\134\000\300I\001\303\017\304\353\000\300I\001\302\306\301\004\000\300I\001\301\361\000\300I\001\301i\000\300I\001\302\020\314D\000"},
+    {0xEA5,1,"\300I\001\302\020\314N\000"},
+    {0xEA7,23,"\300I\001\301\331\000\300I\001\315\325\300j\000\300I\001\315\325\301&\000\300I\001\301\273\304\353\000\300I\001\301\242\304\353\000\300I\001\302\306\301\243\000\300I\0016\000\300I\001\301\242\304\134\000\300I\303\304\000\300I\021\002\025\000\300I\021\002\301\357\304\264\000\300I\021\002\300/\000\300I\021\002\3032\000\300I\021\002;\000\300I\021\002\300T\000\300I\021\002\300$\000\300I\021\002\311Y\000\300I\021\0021\000\300I\021\002\300l\000\300I\002\302\306\301\031\000\300I\021\002\301\357\314\020\000\300I\315\342\002\302\020\000\300I\315\342\002\303\226\000"},
+    {0xEC0,5,"\300I\021\0029\000\300I\021\002\303\177\000\300I\021\0026\000\300I\021\002\302\325\000\300I\021\002\300L\000"},
+    {0xEC6,1,"\300I\301\303\252\000"},
+    {0xEC8,6,"\300I\212\301\357\304\223\000\300I\212\301\357\302\004\000\300I\212\301\357\302&\000\300I\212\301\357\324\366\000\300I\305\354+\000\300I\345\261\000"},
+    {0xED0,10,"\300I\017\300%\000\300I\0172\000\300I\0177\000\300I\017B\000\300I\017O\000\300I\017V\000\300I\017v\000\300I\017\201\000\300I\017u\000\300I\017\211\000"},
+    {0xEDC,4,"\300I\301\242\301#\000\300I\301\242\301\361\000\300I\001\314\005\302\236\000\300I\001\314\005\303\226\000"},
+    {0xF00,32,"U\005\302\303\000U+\305F\303\002\302\203\356\342\025\000U+\305F\303\002\302\203\311b\315\275\312Z\251\000U+\305F\303\002\302\203\311b\305F\303*\251\000U+X\303\002\302\203\314\231\251\000U+\305\036\303\002\302\203\315\347\251\000U+\3038\303\002\302\203\315Y\302h\251\000U+\303\002\302\203\303*\302h\251\000U+\352u\302h\000U+\324\215\303\002\302\203\000U+\324^\315\363\303\002\302\203\000U+\340:\303*\000U+\306\003\303*\324\216\000U+\302h\000U+\306\223\302h\000U+\303*\302h\000U+\306\223\303*\302h\000U+\351\233\325>\354\312\302h\000U+\315\255\313\206\302h\000U+\3038\311a\302\315\301S\253\302\230\000U+\305F\303*\000U\314L\002\325'\302\315\000U\314L\002\342L\302\315\000U\303p\002\353\356\335\215\317F\302\315\000U\303p\002\317G\230\000U\303p\002\352\205\356\361\000U\002\303Z\305(\313p\000U\002\303Z\305(\313\202\000U\002\303Z\305(\307\312\000U\002\303Z\305q\313p\000U\002\303Z\305q\313\202\000U\002\303Z\305(\303Z\305q\000"},
+    {0xF20,32,"U\017\300%\000U\0172\000U\0177\000U\017B\000U\017O\000U\017V\000U\017v\000U\017\201\000U\017u\000U\017\211\000U\017o2\000U\017o7\000U\017oB\000U\017oO\000U\017oV\000U\017ov\000U\017o\201\000U\017ou\000U\017o\211\000U\017o\300%\000U+\324\213\302\315\000U+\314\337\312\217\302\245\3179\000U+\3038\311a\302\315\307R\314\254\302\230\000U+\314\337\312\217\353\355\302\315\000U+\301\316\302\203\000U+\301\201\317H\000U+\313\215\302\315\313\226\000U+\313\215\302\315\313\225\000U+\302\262\314\001\313\226\000U+\302\262\314\001\313\225\000U\002\317\017\316\255\000U\002\314\220\316\255\000"},
+    {0xF40,8,"U\001[\000U\001\300\223\000U\001\300\005\000U\001\300\361\000U\001\300c\000U\001\300m\000U\001\300\220\000U\001\300g\000"},
+    {0xF49,32,"U\001\300\225\000U\001\300\334\000U\001\301\023\000U\001\300\335\000U\001\301\036\000U\001\301\002\000U\001\265\000U\001\300\254\000U\001\300\001\000U\001\300\353\000U\001\256\000U\001\230\000U\001\300\306\000U\001\300\042\000U\001\301\004\000U\001\251\000U\001\301\201\000U\001\302\217\000U\001\302\271\000U\001\305-\000U\001\300q\000U\001\301\371\000U\001\300\341\000U\001\304m\000U\001\264\000U\001\235\000U\001\252\000U\001\300j\000U\001\301&\000U\001\271\000U\001\203\000U\001\025\000"},
+    {0xF69,4,"U\001\305`\000U\001\306#\235\000U\001\310\001\000U\001\302\024\000"},
+    {0xF71,32,"U\021\002\300/\000U\021\002;\000U\021\002\300T\000U\021\0021\000U\021\002\300l\000U\021\002|c\000U\021\002|\301%\000U\021\002|p\000U\021\002|\301J\000U\021\0029\000U\021\002\301\017\000U\021\0026\000U\021\002\300\354\000U\002\351\244\301\365\300c\301\267\000U\002\315\275\312Z\000U\021\002\300:;\000U\021\002\300:\300T\000U\002\302\245\3179\304\305\300\001\000U\002\354\216\342,\000U+\307\314\000U+\347\211\000U\002\342)\302\315\000U\002\303\001\302\315\000U\002\3145\301\201\302\230\000U\002\306x\302\230\000U\002\313\213\302\230\315\257\000U\002\313\213\343\325\315\257\000U\002\300\221\306x\302\230\000U\300B\002\3145\301\201\302\230\000U\300B\002\306x\302\230\000U\300B\002\300\221\306x\302\230\000U\300B\001[\000"},
+    {0xF91,7,"U\300B\001\300\223\000U\300B\001\300\005\000U\300B\001\300\361\000U\300B\001\300c\000U\300B\001\300m\000U\300B\001\300\220\000U\300B\001\300g\000"},
+    {0xF99,32,"U\300B\001\300\225\000U\300B\001\300\334\000U\300B\001\301\023\000U\300B\001\300\335\000U\300B\001\301\036\000U\300B\001\301\002\000U\300B\001\265\000U\300B\001\300\254\000U\300B\001\300\001\000U\300B\001\300\353\000U\300B\001\256\000U\300B\001\230\000U\300B\001\300\306\000U\300B\001\300\042\000U\300B\001\301\004\000U\300B\001\251\000U\300B\001\301\201\000U\300B\001\302\217\000U\300B\001\302\271\000U\300B\001\305-\000U\300B\001\300q\000U\300B\001\301\371\000U\300B\001\300\341\000U\300B\001\304m\000U\300B\001\264\000U\300B\001\235\000U\300B\001\252\000U\300B\001\300j\000U\300B\001\301&\000U\300B\001\271\000U\300B\001\203\000U\300B\001\025\000"},
+    {0xFB9,4,"U\300B\001\305`\000U\300B\001\306#\300q\000U\300B\001\306#\264\000U\300B\001\306#\235\000"},
+    {0xFBE,15,"U\301\355\301\337\300\223\000U\301\355\301\337\300\223\307R\314\254\302\230\000U\305\355\002L\312]\000U\305\355\002{\312]\000U\305\355\002\324\343\356\010\000U\305\355\002\352v\317E\000U\014\333\227\301\255\000U\014\315\236\315\274\000U\014\347{\335\216\000U\014\315\236\315\274\315\255\313\206\000U\014\315Y\230\000U\014\302\243\301\255\000U\014\302\243\301\255\306\223\307&\000U\014\302\243\301\255\307\312\307&\000U\014\302\243\301\255\307R\307&\000"},
+    {0xFCE,13,"U\002\303Z\305q\303Z\305(\000U\002\303Z\305q\307\312\000U+\324\214\315\363\301\321\302\203\315\256\000U+\344R\303\002\301\321\302\203\315\256\000U+\306\223\303*\000U+X\312\204\315\276\303\002\302\203\314\231\251\000U+\305\036\312\204\315\276\303\002\302\203\315\347\251\000\306\305\306\362\002\000\306i\306\362\002\000\306\305\306\362\002\003\214\000\306i\306\362\002\003\214\000U+\342.\314\230\302\315\000U+\356\255\314\230\302\315\000"},
+    {0x1000,32,"N\001[\000N\001\300\223\000N\001\300\005\000N\001\300\361\000N\001\300c\000N\001\300m\000N\001\300\220\000N\001\300g\000N\001\301B\000N\001\300\225\000N\001\346\012\000N\001\300\334\000N\001\301\023\000N\001\300\335\000N\001\301\036\000N\001\301\002\000N\001\265\000N\001\300\254\000N\001\300\001\000N\001\300\353\000N\001\256\000N\001\230\000N\001\300\306\000N\001\300\042\000N\001\301\004\000N\001\251\000N\001\264\000N\001\235\000N\001\252\000N\001\300q\000N\001\271\000N\001\203\000"},
+    {0x1020,32,"N\001\301\243\000N\001\025\000N\001\300\373\025\000N\001;\000N\001\300T\000N\0011\000N\001\300l\000N\0019\000N\001\302\3009\000N\0016\000N\001\300d\000N\021\002\304\355\300/\000N\021\002\300/\000N\021\002;\000N\021\002\300T\000N\021\0021\000N\021\002\300l\000N\021\0029\000N\021\002\300L\000N\021\002\302\300\300T\000N\021\002\302\3006\000N\021\0029'\000N\002\300\316\000N\002<:\000N\002\3014\000N\002\301\031\000N\002\322\331\000N\3003\002\300\017\264\000N\3003\002\300\017\235\000N\3003\002\300\017\300q\000N\3003\002\300\017\203\000N\001\304\242\271\000"},
+    {0x1040,32,"N\017\300%\000N\0172\000N\0177\000N\017B\000N\017O\000N\017V\000N\017v\000N\017\201\000N\017u\000N\017\211\000N\002\300{\3013\000N\002\3013\000N\014\342\205\000N\014\326\025\000N\014\322H\000N\014\335\233\000N\001\300j\000N\001\301&\000N\001|c\000N\001|\301%\000N\001|p\000N\001|\301J\000N\021\002|c\000N\021\002|\301%\000N\021\002|p\000N\021\002|\301J\000N\001\302\300\300c\000N\001\302\300\301B\000N\001\302\300\304\035\000N\001\302\300\305\022\000N\3003\002\302\300\300\017\256\000N\3003\002\302\300\300\017\251\000"},
+    {0x1060,32,"N\3003\002\302\300\300\017\252\000N\001\306\324\3026\300j\000N\021\002\306\324\3026\303\203\000N\212+\306\324\3026\336p\000N\212+\306\324\3026\301\377\303\035\000N\001\303m\302\246\3026\300\254\000N\001\303m\302\246\3026\305\225\000N\021\002\303m\302\246\3026\303\203\000N\021\002\303m\302\246\3026\301\343\000N\002\303m\302\246\3026\305\270\000N\002\303m\302\246\3026\303e\000N\002\303m\302\246\3026\303\247\000N\002\303m\302\246\3026\304e\000N\002\303m\302\246\3026\303f\000N\001\306\022\302\246\3026\301\002\000N\001\306\022\302\246\3026\311W\000N\001\306\022\302\246\3026\335\326\000N\021\002\335\220\3026;\000N\021\002\300\330\301\007\000N\021\002\300\3301\000N\021\002\300\330\301\017\000N\001\300\373[\000N\001\300\373\300\223\000N\001\300\373\300\005\000N\001\300\373\300m\000N\001\300\373\300\341\000N\001\300\373\300\225\000N\001\300\373\300\001\000N\001\300\373\256\000N\001\300\373\300\306\000N\001\300\373\301\026\000N\001\300\373\300\042\000"},
+    {0x1080,32,"N\001\300\373\300\254\000N\001\300\373\203\000N\3003\002\300\373\300\017\300q\000N\021\002\300\373\300/\000N\021\002\300\3739\000N\021\002\300\3739'\000N\021\002\300\3733\300$\000N\002\300\373\303e\000N\002\300\373\303\247\000N\002\300\373\303f\000N\002\300\373\306\374\000N\002\300\373\307p\303e\000N\002\300\373\307p\303\247\000N\002\300\373\307p\334\032\212\000N\001\315\307\306\234\301\026\000N\002\315\307\306\234\303f\000N\300\373\017\300%\000N\300\373\0172\000N\300\373\0177\000N\300\373\017B\000N\300\373\017O\000N\300\373\017V\000N\300\373\017v\000N\300\373\017\201\000N\300\373\017u\000N\300\373\017\211\000N\002\301\302\305\270\000N\002\301\302\303\247\000N\021\002\304p\025\000N\021\002\304p\300L\000N\014\300\3732\000N\014\300\373\301\257\000"},
+    {0x10A0,32,"g\006\001\3016\000g\006\001\305\341\000g\006\001\3041\000g\006\001\306\014\000g\006\001\300\276\000g\006\001\307\021\000g\006\001\305\320\000g\006\001\306\364\000g\006\001\300\241\000g\006\001\304\264\000g\006\001\306g\000g\006\001\301\360\000g\006\001\305r\000g\006\001\300\216\000g\006\001\306\236\000g\006\001\307#\000g\006\001\304\330\000g\006\001\304\335\000g\006\001\304]\000g\006\001\303\251\000g\006\001\306\245\000g\006\001\306T\000g\006\001\3060\000g\006\001\305\226\000g\006\001\301[\000g\006\001\305\363\000g\006\001\302\230\000g\006\001\305S\000g\006\001\305\367\000g\006\001\305\360\000g\006\001\307\030\000g\006\001\306M\000"},
+    {0x10C0,6,"g\006\001\3067\000g\006\001\301\027\000g\006\001\305J\000g\006\001\301\300\000g\006\001\304\245\000g\006\001\306>\000"},
+    {0x10C7,1,"g\006\001\305\005\000"},
+    {0x10CD,1,"g\006\001\304n\000"},
+    {0x10D0,32,"g\001\3016\000g\001\305\341\000g\001\3041\000g\001\306\014\000g\001\300\276\000g\001\307\021\000g\001\305\320\000g\001\306\364\000g\001\300\241\000g\001\304\264\000g\001\306g\000g\001\301\360\000g\001\305r\000g\001\300\216\000g\001\306\236\000g\001\307#\000g\001\304\330\000g\001\304\335\000g\001\304]\000g\001\303\251\000g\001\306\245\000g\001\306T\000g\001\3060\000g\001\305\226\000g\001\301[\000g\001\305\363\000g\001\302\230\000g\001\305S\000g\001\305\367\000g\001\305\360\000g\001\307\030\000g\001\306M\000"},
+    {0x10F0,32,"g\001\3067\000g\001\301\027\000g\001\305J\000g\001\301\300\000g\001\304\245\000g\001\306>\000g\001\303\014\000g\001\305\005\000g\001\313+\000g\001\241\3041\000g\001\300\375\000g\305\207\301\270\000>\001g\305r\000g\001\304n\000g\001\303L\002\000g\001\314#\002\000\035\226\303\326\000\035\226\306\353\000\035\226\303\346\000\035\226\304\015\000\035\226\306\356\000\035\226\303\365\000\035\226\303\341\000\035\226\303\362\000\035\226\306\354\000\035\226\303\374\000\035\226\306\355\000\035\226\303\215\000\035\226\303y\000\035\226\306\352\000\035\226\303\272\000\035\226\303\325\000"},
+    {0x1110,32,"\035\226\304\011\000\035\226\303\360\000\035\226\303\317\000\035\226\314\357\000\035\226\310\347\000\035\226\310Y\000\035\226\345\255\000\035\226\316\204\000\035\226\315\264\000\035\226\3161\000\035\226\306\300\000\035\226\313\360\000\035\226\3104\000\035\226\307\363\000\035\226\315_\000\035\226\350\015\000\035\226\310\211\000\035\226\306\247\000\035\226\315a\000\035\226\310\210\000\035\226\350\021\000\035\226\350\023\000\035\226\350\020\000\035\226\310\207\000\035\226\315]\000\035\226\315b\000\035\226\315`\000\035\226\307\365\000\035\226\313\361\000\035\226\310\324\000\035\226\316\015\000\035\226\310\326\000"},
+    {0x1130,32,"\035\226\316\016\000\035\226\316\014\000\035\226\310\325\000\035\226\354g\000\035\226\354h\000\035\226\354b\000\035\226\310\323\000\035\226\316\012\000\035\226\354d\000\035\226\316\017\000\035\226\354f\000\035\226\316\013\000\035\226\325W\000\035\226\325Y\000\035\226\325\036\000\035\226\325 \000\035\226\310x\000\035\226\313\311\000\035\226\340\013\000\035\226\340\003\000\035\226\340\006\000\035\226\340\010\000\035\226\340\004\000\035\226\310\346\000\035\226\337\377\000\035\226\337\376\000\035\226\340\012\000\035\226\340\005\000\035\226\311R\000\035\226\325x\000\035\226\325V\000\035\226\325X\000"},
+    {0x1150,32,"\035\226\325\035\000\035\226\325\037\000\035\226\325K\000\035\226\325J\000\035\226\325U\000\035\226\325\034\000\035\226\315V\000\035\226\307\364\000\035\226\3160\000\035\226\311Q\000\035\226\341R\000\035\226\310X\000\035\226\306\212\000\035\226\306\213\000\035\226\316\206\000\035\226\303\204\000\035\300\036\303\204\000\035\300\036\025\000\035\300\036\301X\000\035\300\036\264\000\035\300\036\305\311\000\035\300\036\3050\000\035\300\0369\000\035\300\036\311P\000\035\300\036\302o\000\035\300\0366\000\035\300\036\300q\000\035\300\036\311<\000\035\300\036\301\007\000\035\300\036\301i\000\035\300\0361\000\035\300\036\311@\000"},
+    {0x1170,32,"\035\300\036\301\300\000\035\300\036\301\367\000\035\300\036\301)\000\035\300\036\303\203\000\035\300\036\012\000\035\300\036;\000\035\300\036\317M\000\035\300\036\317N\000\035\300\036\361\211\000\035\300\036\317\011\000\035\300\036\334+\000\035\300\036\334,\000\035\300\036\334*\000\035\300\036\361\263\000\035\300\036\361\264\000\035\300\036\346\310\000\035\300\036\346\307\000\035\300\036\346\316\000\035\300\036\346\311\000\035\300\036\346\313\000\035\300\036\317\032\000\035\300\036\317\033\000\035\300\036\361\330\000\035\300\036\361\327\000\035\300\036\317\031\000\035\300\036\357M\000\035\300\036\357N\000\035\300\036\357O\000\035\300\036\357R\000\035\300\036\357Q\000\035\300\036\361\353\000\035\300\036\361\356\000"},
+    {0x1190,32,"\035\300\036\361\355\000\035\300\036\317!\000\035\300\036\317 \000\035\300\036\361\360\000\035\300\036\317\037\000\035\300\036\334H\000\035\300\036\334F\000\035\300\036\361\303\000\035\300\036\337\245\000\035\300\036\337\255\000\035\300\036\337\252\000\035\300\036\337\254\000\035\300\036\337\250\000\035\300\036\337\246\000\035\300\036\3123\000\035\300\036\322\271\000\035\300\036\322\273\000\035\300\036\322\272\000\035\300\036\354\322\000\035\300\036\317L\000\035\300\036\361\212\000\035\300\036\361\265\000\035\300\036\346\314\000\035\300\036\346\315\000\035\213\303\326\000\035\213\306\353\000\035\213\307\377\000\035\213\303\346\000\035\213\306\212\000\035\213\306\213\000\035\213\304\015\000\035\213\303\365\000"},
+    {0x11B0,32,"\035\213\306\301\000\035\213\306\302\000\035\213\306\303\000\035\213\306\304\000\035\213\310\256\000\035\213\310\255\000\035\213\306\300\000\035\213\303\341\000\035\213\303\362\000\035\213\306\247\000\035\213\303\374\000\035\213\306\355\000\035\213\303\215\000\035\213\303y\000\035\213\303\272\000\035\213\303\325\000\035\213\304\011\000\035\213\303\360\000\035\213\303\317\000\035\213\341P\000\035\213\341Q\000\035\213\314\357\000\035\213\310Y\000\035\213\310X\000\035\213\314\360\000\035\213\345\257\000\035\213\316\204\000\035\213\316\206\000\035\213\315\263\000\035\213\315\264\000\035\213\310\257\000\035\213\351\220\000"},
+    {0x11D0,32,"\035\213\3161\000\035\213\351\210\000\035\213\351\211\000\035\213\315\266\000\035\213\351\212\000\035\213\315\261\000\035\213\351\216\000\035\213\315\265\000\035\213\315\262\000\035\213\315\270\000\035\213\314\252\000\035\213\3444\000\035\213\3104\000\035\213\3105\000\035\213\3446\000\035\213\314\253\000\035\213\344/\000\035\213\3441\000\035\213\307\363\000\035\213\350\016\000\035\213\315`\000\035\213\315^\000\035\213\307\365\000\035\213\310\324\000\035\213\310\326\000\035\213\316\016\000\035\213\310\325\000\035\213\310x\000\035\213\313\311\000\035\213\340\011\000\035\213\310\346\000\035\213\340\002\000"},
+    {0x11F0,32,"\035\213\311R\000\035\213\317\025\000\035\213\317\024\000\035\213\315V\000\035\213\307\364\000\035\213\336\267\000\035\213\336\271\000\035\213\336\266\000\035\213\336\270\000\035\213\311Q\000\035\213\341N\000\035\213\341O\000\035\213\341K\000\035\213\341M\000\035\213\341L\000\035\213\310\347\000#\005\203\000#\005\302\237\000#\005\3019\000#\005\303\020\000#\005\306<\000#\005\301\027\000#\005\301\242\000#\005\337!\000#\005\252\000#\005\301\265\000#\005\300\227\000#\005\305a\000#\005\306h\000#\005\300\345\000#\005\302\020\000#\005\310\036\000"},
+    {0x1210,32,"#\005\303\213\000#\005\336\237\000#\005\336\235\000#\005\313\244\000#\005\336\234\000#\005\336\233\000#\005\336\236\000#\005\313\245\000#\005\251\000#\005\301!\000#\005\301|\000#\005\310 \000#\005\310.\000#\005\301S\000#\005\301\361\000#\005\306\203\000#\005\355\231\000#\005\355\237\000#\005\355\235\000#\005\355\232\000#\005\355\234\000#\005\355\233\000#\005\355\236\000#\005\355\240\000#\005\235\000#\005\301\337\000#\005\302d\000#\005\305\231\000#\005\305\233\000#\005\302:\000#\005\301\267\000#\005\315\310\000"},
+    {0x1230,25,"#\005\271\000#\005\301\365\000#\005\301\340\000#\005\306\315\000#\005\304O\000#\005\301\363\000#\005\301\273\000#\005\310\375\000#\005\300j\000#\005\302\215\000#\005\304\341\000#\005\315\351\000#\005\306\326\000#\005\300\374\000#\005\303#\000#\005\310\320\000#\005\302\023\000#\005\305\230\000#\005\305\227\000#\005\310\242\000#\005\350\267\000#\005\306\263\000#\005\306\264\000#\005\350\321\000#\005\350\355\000"},
+    {0x124A,4,"#\005\315\223\000#\005\350\356\000#\005\315\222\000#\005\315\221\000"},
+    {0x1250,7,"#\005\350\272\000#\005\350\302\000#\005\350\277\000#\005\350\273\000#\005\350\276\000#\005\350\275\000#\005\350\300\000"},
+    {0x1258,1,"#\005\350\303\000"},
+    {0x125A,4,"#\005\350\307\000#\005\350\304\000#\005\350\306\000#\005\350\305\000"},
+    {0x1260,32,"#\005\300\042\000#\005\301\255\000#\005\302\034\000#\005\305\336\000#\005\304w\000#\005\302r\000#\005\302\332\000#\005\312\213\000#\005\300\307\000#\005\304i\000#\005\303\253\000#\005\316\335\000#\005\304\023\000#\005\302W\000#\005\303k\000#\005\360\250\000#\005\265\000#\005\301\313\000#\005\302&\000#\005\304Y\000#\005\304\357\000#\005\301=\000#\005C\000#\005\311.\000#\005\300m\000#\005\307v\000#\005\305\366\000#\005\307S\000#\005\312\237\000#\005\303u\000#\005\302\334\000#\005\307z\000"},
+    {0x1280,9,"#\005\302\222\000#\005\361e\000#\005\302\223\000#\005\361L\000#\005\361P\000#\005\305\002\000#\005\317\005\000#\005\361^\000#\005\361i\000"},
+    {0x128A,4,"#\005\361m\000#\005\361j\000#\005\361l\000#\005\361k\000"},
+    {0x1290,32,"#\005\256\000#\005\301e\000#\005\301L\000#\005\304\305\000#\005\310O\000#\005\301K\000#\005\301#\000#\005\306\221\000#\005\300\225\000#\005\310i\000#\005\302\245\000#\005\315\023\000#\005\315\024\000#\005\310g\000#\005\303\226\000#\005\346\245\000#\005\301I\025\000#\005\301I1\000#\005\301I;\000#\005\301I\300/\000#\005\301I\301\017\000#\005\301I9\000#\005\301I6\000#\005\301I\300q\000#\005[\000#\005\301\355\000#\005\301\323\000#\005\306P\000#\005\307\371\000#\005\301\377\000#\005\301\303\000#\005\341f\000"},
+    {0x12B0,1,"#\005\310\010\000"},
+    {0x12B2,4,"#\005\306c\000#\005\306a\000#\005\314\036\000#\005\306b\000"},
+    {0x12B8,7,"#\005\310\011\000#\005\341\271\000#\005\341\267\000#\005\341\264\000#\005\341\266\000#\005\341\265\000#\005\341\270\000"},
+    {0x12C0,1,"#\005\341\272\000"},
+    {0x12C2,4,"#\005\341\276\000#\005\341\273\000#\005\341\275\000#\005\341\274\000"},
+    {0x12C8,15,"#\005\300q\000#\005\303.\000#\005\301\367\000#\005\305\304\000#\005\307\023\000#\005\301\300\000#\005\301\331\000#\005\361\035\000#\005\303\357\025\000#\005\303\3571\000#\005\303\357;\000#\005\303\357\300/\000#\005\303\357\301\017\000#\005\303\3579\000#\005\303\3576\000"},
+    {0x12D8,32,"#\005\300\341\000#\005\303\005\000#\005\3030\000#\005\317.\000#\005\305\317\000#\005\301\370\000#\005\303\004\000#\005\362\201\000#\005\301\371\000#\005\311^\000#\005\311[\000#\005\362G\000#\005\307$\000#\005\302q\000#\005\311]\000#\005\362^\000#\005\264\000#\005\301)\000#\005\012\000#\005\305\003\000#\005\305\004\000#\005\302o\000#\005\301i\000#\005\361\332\000#\005\300\001\000#\005\302\037\000#\005\302\036\000#\005\312\315\000#\005\304\211\000#\005\301\350\000#\005\302\013\000#\005\333\270\000"},
+    {0x12F8,25,"#\005\300\335\000#\005\312\345\000#\005\312\344\000#\005\312\337\000#\005\331\361\000#\005\312\341\000#\005\307\204\000#\005\332\012\000#\005\300g\000#\005\3049\000#\005\303\323\000#\005\313\333\000#\005\304\261\000#\005\302\347\000#\005\303\022\000#\005\313\351\000#\005\300\005\000#\005\302H\000#\005\301\321\000#\005\305=\000#\005\305>\000#\005\303J\000#\005\302\236\000#\005\335\363\000#\005\313\221\000"},
+    {0x1312,4,"#\005\313\224\000#\005\336+\000#\005\313\223\000#\005\313\222\000"},
+    {0x1318,32,"#\005\304\237\000#\005\313z\000#\005\313w\000#\005\335\244\000#\005\335\250\000#\005\307\302\000#\005\313x\000#\005\335\274\000#\005\300\254\000#\005\311\022\000#\005\304c\000#\005\305\263\000#\005\305\264\000#\005\301\011\000#\005\302\004\000#\005\311\024\000#\005\300\220\000#\005\305\365\000#\005\301\256\000#\005\312\244\000#\005\305\362\000#\005\301\316\000#\005\303\010\000#\005\325m\000#\005\300\306\000#\005\347\375\000#\005\301\307\000#\005\315U\000#\005\347\363\000#\005\310\205\000#\005\303\035\000#\005\350\001\000"},
+    {0x1338,32,"#\005\301\201\000#\005\307\005\000#\005\304g\000#\005\356\351\000#\005\316\253\000#\005\302\254\000#\005\307\004\000#\005\356\365\000#\005\357\077\000#\005\357G\000#\005\357C\000#\005\357@\000#\005\357B\000#\005\357A\000#\005\357E\000#\005\357F\000#\005\301\026\000#\005\303\207\000#\005\303\014\000#\005\306 \000#\005\304-\000#\005\302\343\000#\005\303\017\000#\005\313`\000#\005\230\000#\005\302\312\000#\005\300\325\000#\005\306\233\000#\005\303\227\000#\005\300\363\000#\005\3029\000#\005\305\225\000"},
+    {0x1358,3,"#\005\351\374\000#\005\304\304\000#\005\335+\000"},
+    {0x135D,32,"# \305\077\031\021\302\202+\000# \021\302\202+\000# \305\077+\000#\3013+\000#\361$\000#\300\324\300k\000#\300\251\000#\302\366\000#\301^\000#\350c\301^\000#\301\216+\000#\305\207\301\270\000#\0172\000#\0177\000#\017B\000#\017O\000#\017V\000#\017v\000#\017\201\000#\017u\000#\017\211\000#\036\300H\000#\036\300\351\000#\036\301\200\000#\036\301\237\000#\036\301H\000#\036\302R\000#\036\301V\000#\036\302w\000#\036\3010\000#\036\207\000#\036\300H\254\000"},
+    {0x1380,26,"#\005\306\321\306\203\000#\005\306\204\000#\005\314\304\000#\005\310E\000#\005\306\321\312\213\000#\005\312\215\000#\005\312\214\000#\005\324\252\000#\005\306\321\313`\000#\005\313c\000#\005\313b\000#\005\335)\000#\005\306\321\305\225\000#\005\306\261\000#\005\315\202\000#\005\310\241\000#\302\253+\361\315\000#\302\253+\332)\000#\302\253+\315\271\000#\302\253+\300w\315\271\000#\302\253+\332O\000#\302\253+\340\377\000#\302\253+\325S\000#\302\253+\336\264\000#\302\253+\332*\000#\302\253+\341\244\000"},
+    {0x13A0,32,"h\001\025\000h\0019\000h\001;\000h\0016\000h\0011\000h\001\300\015\000h\001\300\005\000h\001[\000h\001\303J\000h\001\301\321\000h\001\302\236\000h\001\302H\000h\001\313\220\000h\001\203\000h\001\301\027\000h\001\3019\000h\001\301\242\000h\001\302\237\000h\001\306A\000h\001\252\000h\001\300\345\000h\001\300\227\000h\001\302\020\000h\001\301\265\000h\001\314S\000h\001\251\000h\001\301S\000h\001\301|\000h\001\301\361\000h\001\301!\000h\001\256\000h\001\307\324\000"},
+    {0x13C0,32,"h\001\310G\000h\001\301K\000h\001\301L\000h\001\301#\000h\001\301e\000h\001\310e\000h\001\315\213\000h\001\315\214\000h\001\315\215\000h\001\310\246\000h\001\310\247\000h\001\315\220\000h\001\271\000h\001d\000h\001\301\363\000h\001\301\340\000h\001\301\273\000h\001\301\365\000h\001\310\374\000h\001\300\001\000h\001\265\000h\001\301\350\000h\001\301=\000h\001\302\036\000h\001\302&\000h\001\302\013\000h\001\302\037\000h\001\313\020\000h\001\306\013\000h\001\311\031\000h\001\311\032\000h\001\311\034\000"},
+    {0x13E0,22,"h\001\311\035\000h\001\311\036\000h\001\316\221\000h\001\301\201\000h\001\302\254\000h\001\304g\000h\001\307\004\000h\001\307\005\000h\001\316\260\000h\001\300q\000h\001\301\300\000h\001\301\367\000h\001\301\331\000h\001\303.\000h\001\317\004\000h\001\264\000h\001\302o\000h\001\012\000h\001\301i\000h\001\301)\000h\001\317'\000h\001\305o\000"},
+    {0x13F8,6,"h\004\001\302o\000h\004\001\012\000h\004\001\301i\000h\004\001\301)\000h\004\001\317'\000h\004\001\305o\000"},
+    {0x1400,32,"\023\024\302\346\000\023\0249\000\023\024\312\010\000\023\024;\000\023\024\300T\000\023\0246\000\023\024\300\354\000\023\024\302\377\300\354\000\023\024`\301\017\000\023\024`;\000\023\024\025\000\023\024\300/\000\023\024\301\300\000\023\024\300.\301\300\000\023\024\301\367\000\023\024\300.\301\367\000\023\024\316\371\000\023\024\300.\316\371\000\023\024\301\331\000\023\024\300.\301\331\000\023\024\305\310\000\023\024\300.\305\310\000\023\024\302\204\305\310\000\023\024\300q\000\023\024\300.\300q\000\023\024\305\304\000\023\024\300.\305\304\000\023\024\302\204\305\304\000\023\024\300L\000\023\024\302\377\300P\000\023\024\301I\300k\000\023\0243\300!\000"},
+    {0x1420,32,"\023\0243\300\200\000\023\0243\3017o\240\000\023\0243\300\365o\240\000\023\0243&o\240\000\023\0243\240\000\023\02434\300!\000\023\02434\300wT\310\364\000\023\0243M<\000\023\0243\300w\255I\000\023\0243a\000\023\0243t\301O\000\023\024\300\276\000\023\024\300\241\000\023\024\300\216\000\023\024\3016\000\023\024\300\363\000\023\024\347s\000\023\024\300\325\000\023\024\305\216\000\023\024\3029\000\023\024\305\223\000\023\024\302\377\305\223\000\023\024`\306<\000\023\024`\3019\000\023\024\230\000\023\024\306\233\000\023\024\310\241\000\023\024\300.\310\241\000\023\024\306\261\000\023\024\300.\306\261\000\023\024\315\203\000\023\024\300.\315\203\000"},
+    {0x1440,32,"\023\024\302\246\000\023\024\300.\302\246\000\023\024\315\204\000\023\024\300.\315\204\000\023\024\305\225\000\023\024\300.\305\225\000\023\024\310\240\000\023\024\300.\310\240\000\023\024\302\377\310\240\000\023\024\300<\000\023\024\300.\300<\000\023\024`\300\026\000\023\024\301=\000\023\024\355\327\000\023\024\302&\000\023\024\356g\000\023\024C\000\023\024\304\363\000\023\024\302\377\304\363\000\023\024`\304\211\000\023\024`\302\036\000\023\024\265\000\023\024\304Y\000\023\024\305\277\000\023\024\300.\305\277\000\023\024\316\303\000\023\024\300.\316\303\000\023\024\316\304\000\023\024\300.\316\304\000\023\0247\000\023\024\300.7\000\023\024\316\306\000"},
+    {0x1460,32,"\023\024\300.\316\306\000\023\024\311.\000\023\024\300.\311.\000\023\024\311/\000\023\024\300.\311/\000\023\024\302\204\311/\000\023\024\300\007\000\023\024\305\273\000\023\024\316\266\000\023\024\311,\000\023\024\300\334\000\023\024\301\377\000\023\024\340\304\000\023\024\301\323\000\023\024\3419\000\023\024\301\303\000\023\024\305]\000\023\024\302\377\305]\000\023\024[\000\023\024\306P\000\023\024\306b\000\023\024\300.\306b\000\023\024\306c\000\023\024\300.\306c\000\023\024\314\037\000\023\024\300.\314\037\000\023\024\314 \000\023\024\300.\314 \000\023\024\314!\000\023\024\300.\314!\000\023\024\310\010\000\023\024\300.\310\010\000"},
+    {0x1480,32,"\023\024\306a\000\023\024\300.\306a\000\023\024\302\204\306a\000\023\024\300\011\000\023\024\310\007\000\023\024\306\345\307\372\000\023\024\306\345\3418\000\023\024\306\345\341k\000\023\024\306\345\313\356\000\023\024\303u\000\023\024\324\317\000\023\024\305\366\000\023\024\325|\000\023\024\302\334\000\023\024\307o\000\023\024\302\377\307o\000\023\024\300m\000\023\024\307S\000\023\024\312\305\000\023\024\300.\312\305\000\023\024\307|\000\023\024\300.\307|\000\023\024\312\306\000\023\024\300.\312\306\000\023\024\312\307\000\023\024\300.\312\307\000\023\024\312\310\000\023\024\300.\312\310\000\023\024\307z\000\023\024\300.\307z\000\023\024\307{\000\023\024\300.\307{\000"},
+    {0x14A0,32,"\023\024\302\204\307{\000\023\024\3005\000\023\024\302Q\304\006\000\023\024\301S\000\023\024\343u\000\023\024\301|\000\023\024\3449\000\023\024\301\361\000\023\024\310<\000\023\024\302\377\310<\000\023\024\251\000\023\024\310 \000\023\024\310E\000\023\024\300.\310E\000\023\024\306\204\000\023\024\300.\306\204\000\023\024\314\305\000\023\024\300.\314\305\000\023\024\314\306\000\023\024\300.\314\306\000\023\024\314\307\000\023\024\300.\314\307\000\023\024\306\203\000\023\024\300.\306\203\000\023\024\310D\000\023\024\300.\310D\000\023\024\302\204\310D\000\023\024\261\000\023\024\300.\261\000\023\024\344!\000\023\024\312>\261\000\023\024\302Q\261\000"},
+    {0x14C0,32,"\023\024\301K\000\023\024\344\367\000\023\024\301L\000\023\024\314\361\000\023\024\301#\000\023\024\310_\000\023\024\302\377\310_\000\023\024\256\000\023\024\304\305\000\023\024\315\015\000\023\024\300.\315\015\000\023\024\306\221\000\023\024\300.\306\221\000\023\024\310f\000\023\024\300.\310f\000\023\024\302\204\310f\000\023\024\232\000\023\024`\302\022\000\023\024\345\234\000\023\024\300\345\000\023\024\341\326\000\023\024\300\227\000\023\024\342`\000\023\024\302\020\000\023\024\304\300\000\023\024\302\377\304\300\000\023\024\252\000\023\024\305a\000\023\024\314U\000\023\024\300.\314U\000\023\024\314V\000\023\024\300.\314V\000"},
+    {0x14E0,32,"\023\024\314W\000\023\024\300.\314W\000\023\024\314X\000\023\024\300.\314X\000\023\024\314Y\000\023\024\300.\314Y\000\023\024\310\036\000\023\024\300.\310\036\000\023\024\314T\000\023\024\300.\314T\000\023\024p\000\023\024\300.p\000\023\024\300\017p\000\023\024\301\363\000\023\024\352D\000\023\024\301\340\000\023\024\305\247\000\023\024\301\273\000\023\024\305\252\000\023\024\302\377\305\252\000\023\024\271\000\023\024\306\315\000\023\024\316I\000\023\024\300.\316I\000\023\024\316K\000\023\024\300.\316K\000\023\024\316L\000\023\024\300.\316L\000\023\024\316M\000\023\024\300.\316M\000\023\024\316N\000\023\024\300.\316N\000"},
+    {0x1500,32,"\023\024\310\375\000\023\024\300.\310\375\000\023\024\310\376\000\023\024\300.\310\376\000\023\024\302\204\310\376\000\023\024d\000\023\024\312>d\000\023\024\316G\000\023\024\302*d\000\023\024\344x\354v\000\023\024\302\204\354|\000\023\024\302\204\352\004\000\023\024\302\204\354\313\000\023\024\302\204\3552\000\023\024\302\204\354}\000\023\024\302\204\352\203\000\023\024\300\374\000\023\024\304\341\000\023\024\306\330\000\023\024\303#\000\023\024\310\315\000\023\024\300j\000\023\024\315\351\000\023\024\304T\000\023\024\300.\304T\000\023\024\315\374\000\023\024\300.\315\374\000\023\024\315\375\000\023\024\300.\315\375\000\023\024\315\376\000\023\024\300.\315\376\000\023\024\315\377\000"},
+    {0x1520,32,"\023\024\300.\315\377\000\023\024\310\320\000\023\024\300.\310\320\000\023\024\315\373\000\023\024\300.\315\373\000\023\024\304P\000\023\024\302o\000\023\024\361\214\000\023\024\012\000\023\024\361\311\000\023\024\301i\000\023\024\307\035\000\023\024\302\377\307\035\000\023\024\264\000\023\024\305\003\000\023\024\317(\000\023\024\300.\317(\000\023\024\317)\000\023\024\300.\317)\000\023\024\317*\000\023\024\300.\317*\000\023\024\317+\000\023\024\300.\317+\000\023\024\317,\000\023\024\300.\317,\000\023\024\311W\000\023\024\300.\311W\000\023\024\311X\000\023\024\300.\311X\000\023\024\302\204\311X\000\023\024\300$\000\023\024\324B\300$\000"},
+    {0x1540,32,"\023\024\300.\300$\000\023\024\302Q\012\000\023\024\302:\000\023\024\315\224\302:\000\023\024\300.\300\345\000\023\024\351%\000\023\024\302d\000\023\024\306\311\000\023\024\301\267\000\023\024\315\302\000\023\024\300.\302\020\000\023\024\235\000\023\024\305\231\000\023\024\300.\252\000\023\024\315\311\000\023\024\300.\315\311\000\023\024c\000\023\024\300.c\000\023\024\300\017c\000\023\024\302\343\000\023\024\334\244\000\023\024\303\014\000\023\024\334\330\000\023\024\303\017\000\023\024\307\263\000\023\024\301\026\000\023\024\306 \000\023\024\313a\000\023\024\300.\313a\000\023\024\300u\000\023\024\301\011\000\023\024\310F\301\011\000"},
+    {0x1560,32,"\023\024\304c\000\023\024\310F\304c\000\023\024\311\014\000\023\024\310F\311\014\000\023\024\302\004\000\023\024\311\017\000\023\024\300\254\000\023\024\305\263\000\023\024\311\025\000\023\024\300.\311\025\000\023\024\304\006\000\023\024\316\264\000\023\024\316\265\000\023\024\307\006\000\023\024\301\023\000\023\024\356\371\000\023\024\3577\000\023\024\3578\000\023\024\3579\000\023\024\3575\000\023\024\303\352\301\027\000\023\024\303\352\3019\000\023\024\303\352\313\250\000\023\024\303\352\301\242\000\023\024\303\352\305K\000\023\024\303\352\203\000\023\024\303\352\303\020\000\023\024\303\352\300\026\000\023\024\346}\300\026\000\023\024\336\303\000\023\024\350\256\000\023\024\305\227\000"},
+    {0x1580,32,"\023\024\315\210\000\023\024\306\264\000\023\024\310\245\000\023\024\302\023\000\023\024\310\242\000\023\024\300\260\000\023\024\316\216\000\023\024\316\217\000\023\024\316\220\000\023\024\311\033\000\023\024\300.\302:\000\023\024\300.\302d\000\023\024\300.\301\267\000\023\024\300.\235\000\023\024\345[\000\023\024\306\211\000\023\024\345~\000\023\024\304F\000\023\024\345\215\000\023\024\300c\000\023\024\306\210\000\023\024\302\022\000\023\024\346\001\000\023\024\302Q\300\374\000\023\024\302Q\304\341\000\023\024\302Q\303#\000\023\024\302Q\300j\000\023\024\302\322\301\011\000\023\024\302\322\304c\000\023\024\302\322\302\004\000\023\024\302\322\300\254\000\023\024\302\322\304\006\000"},
+    {0x15A0,32,"\023\024\314@\000\023\024\342P\000\023\024\314A\000\023\024\342Q\000\023\024\303\330\000\023\024\314\077\000\023\024\310\026\000\023\024\304\007\301\011\000\023\024\304\007\304c\000\023\024\304\007\311\014\000\023\024\304\007\302\004\000\023\024\304\007\311\017\000\023\024\304\007\300\254\000\023\024\304\007\305\263\000\023\024\304\007\304\006\000\023\024\322^\077\000\023\024\302*9\000\023\024\302*;\000\023\024\302*6\000\023\024\302*\025\000\023\024\302*\301\300\000\023\024\302*\301\367\000\023\024\302*\301\331\000\023\024\302*\300q\000\023\024\302*\301K\000\023\024\302*\301L\000\023\024\302*\301#\000\023\024\302*\256\000\023\024\302*\301\377\000\023\024\302*\301\323\000\023\024\302*\301\303\000\023\024\302*[\000"},
+    {0x15C0,32,"\023\024\302Q\301\027\000\023\024\302Q\3019\000\023\024\302Q\301\242\000\023\024\302Q\203\000\023\024`\335\325\000\023\024`\313\177\000\023\024`\3021\000\023\024`\335\310\000\023\024`\335\321\000\023\024`\300\361\000\023\024`\301\337\000\023\024`\301\267\000\023\024`\302:\000\023\024`\305\233\000\023\024`\302d\000\023\024`\235\000\023\024`\303.\000\023\024`\301\331\000\023\024`\301\300\000\023\024`\307\023\000\023\024`\301\367\000\023\024`\300q\000\023\024`\337\177\000\023\024`\337~\000\023\024`\307\331\000\023\024`\337|\000\023\024`\337}\000\023\024`\337z\000\023\024`\311\022\000\023\024`\302\004\000\023\024`\301\011\000\023\024`\305\264\000"},
+    {0x15E0,32,"\023\024`\304c\000\023\024`\300\254\000\023\024`\357\006\000\023\024`\311,\000\023\024`\305\273\000\023\024`\356\370\000\023\024`\316\266\000\023\024`\300\334\000\023\024`\302\312\000\023\024`\3029\000\023\024`\300\363\000\023\024`\303\227\000\023\024`\300\325\000\023\024`\230\000\023\024`\300<\000\023\024`\302H\000\023\024`\302\236\000\023\024`\303J\000\023\024`\305>\000\023\024`\301\321\000\023\024`\300\005\000\023\024`\341\042\000\023\024`\302\351\000\023\024`\307\374\000\023\024`\341\031\000\023\024`\306U\000\023\024`\300\223\000\023\024`\341W\000\023\024`\341V\000\023\024`\341S\000\023\024`\341T\000\023\024`\341U\000"},
+    {0x1600,32,"\023\024`\310\001\000\023\024`\306X\000\023\024`\301e\000\023\024`\301#\000\023\024`\301K\000\023\024`\310O\000\023\024`\301L\000\023\024`\256\000\023\024`\301!\000\023\024`\301\361\000\023\024`\301S\000\023\024`\310.\000\023\024`\301|\000\023\024`\251\000\023\024`\301)\000\023\024`\301i\000\023\024`\302o\000\023\024`\305\004\000\023\024`\012\000\023\024`\264\000\023\024`\3049\000\023\024\302Q\3049\000\023\024`\303\022\000\023\024`\302\347\000\023\024`\304\261\000\023\024`\303\323\000\023\024\302Q\303\323\000\023\024`\300g\000\023\024`\313\344\000\023\024`\313\343\000\023\024`\340u\000\023\024`\340v\000"},
+    {0x1620,32,"\023\024`\313\341\000\023\024`\305T\000\023\024`\301\265\000\023\024`\302\020\000\023\024`\300\345\000\023\024`\306h\000\023\024`\300\227\000\023\024`\252\000\023\024`\332\177\000\023\024`\332~\000\023\024`\332y\000\023\024`\332z\000\023\024`\332}\000\023\024`\306\013\000\023\024`\342R\000\023\024`\314A\000\023\024`\342N\000\023\024`\342O\000\023\024`\314@\000\023\024`\303\330\000\023\024`\356\200\000\023\024`\316\220\000\023\024`\316\216\000\023\024`\356~\000\023\024`\316\217\000\023\024`\311\033\000\023\024`\311\036\000\023\024`\311\035\000\023\024`\311\032\000\023\024`\356}\000\023\024`\311\034\000\023\024`\311\031\000"},
+    {0x1640,32,"\023\024`\303\005\000\023\024`\303\004\000\023\024`\301\370\000\023\024`\305\317\000\023\024`\3030\000\023\024`\300\341\000\023\024`\300 \000\023\024`X\300 \000\023\024`\313\027\000\023\024`\313\026\000\023\024`\303\303\000\023\024`\313\022\000\023\024`\313\024\000\023\024`\302\271\000\023\024`\301\365\000\023\024`\301\273\000\023\024`\301\363\000\023\024`\304O\000\023\024`\301\340\000\023\024`\271\000\023\024`\302\215\000\023\024`\303#\000\023\024`\300\374\000\023\024`\306\326\000\023\024`\304\341\000\023\024`\300j\000\023\024`\304P\000\023\024`\307\005\000\023\024`\307\004\000\023\024`\302\254\000\023\024`\316\253\000\023\024`\304g\000"},
+    {0x1660,32,"\023\024`\301\201\000\023\024`\305\365\000\023\024`\303\010\000\023\024`\301\316\000\023\024`\305\362\000\023\024`\301\256\000\023\024`\300\220\000\023\024`\357\004\000\023\024`\357\003\000\023\024`\356\377\000\023\024`\357\001\000\023\024`\357\002\000\023\024`\356\376\000\023\024\301\256\002\000\023\024\300\324\300k\000\023\024\315\206\000\023\024\345]\000\023\024\346\004\000\023\024\346\005\000\023\024\346\006\000\023\024\346\007\000\023\024\346\002\000\023\024\346\003\000\023\024\302\322\356S\000\023\024\302\322\356T\000\023\024\302\322\356U\000\023\024\302\322\356V\000\023\024\302\322\356W\000\023\024\302\322\311\024\000\023\024\302\322\311\025\000\023\024\302\3223\304\006\000\023\024\302*\300P\000"},
+    {0x1680,29,"\301\212\301\364+\000\301\212\001\324/\000\301\212\001\342\246\000\301\212\001\334\302\000\301\212\001\352I\000\301\212\001\345\274\000\301\212\001\357\205\000\301\212\001\331\332\000\301\212\001\356s\000\301\212\001\326\010\000\301\212\001\325\026\000\301\212\001\344\230\000\301\212\001\336\003\000\301\212\001\345d\000\301\212\001\355\026\000\301\212\001\351\342\000\301\212\001\322Z\000\301\212\001\315'\000\301\212\001\303\252\000\301\212\001\333\365\000\301\212\001\340\077\000\301\212\001\333\364\000\301\212\001\300\037\000\301\212\001\357\224\000\301\212\001\340\016\000\301\212\001\333\366\000\301\212\001\347\324\000\301\212\306!+\000\301\212\300:\306!+\000"},
+    {0x16A0,32,"\3000\001\334\306\334\311\302\343\300u\000\3000\001\300\015\000\3000\001\357\274\303\2521\000\3000\001\317\036\000\3000\001\300$\000\3000\001\300P\000\3000\001\356P\356Q\304\013\000\3000\001\303\306\000\3000\001\322\234\025\000\3000\001\315.6\000\3000\001\305\321\025\000\3000\001\312\026\000\3000\001\342\2206\000\3000\001\354!6\000\3000\0016\000\3000\001\301\007\000\3000\001\300\216\000\3000\001\3510\306\267\351Yc\000\3000\001\340\346\000\3000\001\325\032\000\3000\001\340\345\300\011\000\3000\001\300\003\000\3000\001\302\341\000\3000\001\335\221\3363\300\003\000\3000\001\301\204\000\3000\001\3616\307\027\300P\000\3000\001\336T\300\026\000\3000\001\336P\300\026\000\3000\001\342\216\300\026\000\3000\001\354\036\300\026\000\3000\001\345\006\346\215\345\005\232\000\3000\001\354 \232\000"},
+    {0x16C0,32,"\3000\001\333\217\000\3000\001\340I\304\256\340M;\000\3000\0019\000\3000\001\340d\300U\000\3000\001\335\236\000\3000\001\342\215\301X\000\3000\001\354\034\025\000\3000\001\340Q\334-\000\3000\001\347\342\347\335\300<\000\3000\001\322m\334.\000\3000\001\354\252d\000\3000\001\354Y\342\221d\000\3000\001\354\042d\000\3000\001\3005\000\3000\001\300 \000\3000\001\356z\304d\357>\300\007\000\3000\001\354#\300\007\000\3000\001\300\024\000\3000\001\3246\3244\324]\077\000\3000\001\354\035\077\000\3000\001\333\220\000\3000\001\347I\000\3000\001\334\005\303B9\000\3000\001\343\231\301\360\261\000\3000\001\342\217\261\000\3000\001\354\037\261\000\3000\001\342%\341\345\342\210p\000\3000\001\333\216\000\3000\001\340/\000\3000\001\307\340\000\3000\001\331\322\331\316\300\024\000\3000\001\347V\334A6\000"},
+    {0x16E0,25,"\3000\001\304(\000\3000\001\340A\000\3000\001\331e\000\3000\001\324\332\000\3000\001\325\021\000\3000\001\354\374\000\3000\001\342\222\000\3000\001\354$\000\3000\001\337\311\000\3000\001\300\260\000\3000\001\300>\000\3000\300N\300\006\000\3000\302\301\300\006\000\3000\300\323\300\006\000\3000\322\305\014\000\3000\357'\014\000\3000\3240\014\000\3000\001\300\011\000\3000\001\304P\000\3000\001\300\354\000\3000\001\305;\305\031\315.\000\3000\001\305;\305\031\304\256\000\3000\001\305;\305\031\303B\000\3000\001\305;\305\031\305\321\000\3000\001\305;\305\031\312\026\000"},
+    {0x1700,22,"\301\342\001\025\000\301\342\001;\000\301\342\0011\000\301\342\001[\000\301\342\001\300\005\000\301\342\001\300c\000\301\342\001\265\000\301\342\001\300\001\000\301\342\001\256\000\301\342\001\230\000\301\342\001\300\042\000\301\342\001\251\000\301\342\001\264\000\301\342\001\235\000\301\342\001\252\000\301\342\001\300q\000\301\342\001\271\000\301\342\001\203\000\301\342\021\002;\000\301\342\021\0021\000\301\342\002\301\031\000\301\342\002\315=\000"},
+    {0x171F,24,"\301\342\001\301\034\235\000\301\376\001\025\000\301\376\001;\000\301\376\0011\000\301\376\001[\000\301\376\001\300\005\000\301\376\001\300c\000\301\376\001\265\000\301\376\001\300\001\000\301\376\001\256\000\301\376\001\230\000\301\376\001\300\042\000\301\376\001\251\000\301\376\001\264\000\301\376\001\235\000\301\376\001\252\000\301\376\001\300q\000\301\376\001\271\000\301\376\001\203\000\301\376\021\002;\000\301\376\021\0021\000\301\376\002\315=\000\315W\300N\300\006\000\315W4\300\006\000"},
+    {0x1740,20,"\302\007\001\025\000\302\007\001;\000\302\007\0011\000\302\007\001[\000\302\007\001\300\005\000\302\007\001\300c\000\302\007\001\265\000\302\007\001\300\001\000\302\007\001\256\000\302\007\001\230\000\302\007\001\300\042\000\302\007\001\251\000\302\007\001\264\000\302\007\001\235\000\302\007\001\252\000\302\007\001\300q\000\302\007\001\271\000\302\007\001\203\000\302\007\021\002;\000\302\007\021\0021\000"},
+    {0x1760,13,"\302>\001\025\000\302>\001;\000\302>\0011\000\302>\001[\000\302>\001\300\005\000\302>\001\300c\000\302>\001\265\000\302>\001\300\001\000\302>\001\256\000\302>\001\230\000\302>\001\300\042\000\302>\001\251\000\302>\001\264\000"},
+    {0x176E,3,"\302>\001\252\000\302>\001\300q\000\302>\001\271\000"},
+    {0x1772,2,"\302>\021\002;\000\302>\021\0021\000"},
+    {0x1780,32,"}\001[\000}\001\300\223\000}\001\301\303\000}\001\302\351\000}\001\304F\000}\001\300m\000}\001\300\220\000}\001\302\334\000}\001\303\010\000}\001\303\226\000}\001\300\001\000}\001\301\023\000}\001\302\013\000}\001\307\006\000}\001\346\011\000}\001\265\000}\001\300\254\000}\001C\000}\001\302\004\000}\001\301#\000}\001\300\042\000}\001\300\306\000}\001\3029\000}\001\303\035\000}\001\301\361\000}\001\301i\000}\001\301\267\000}\001\302\020\000}\001\303k\000}\001\300j\000}\001\310\351\000}\001\271\000"},
+    {0x17A0,32,"}\001\203\000}\001\252\000}\001\302\023\000}\301\322\021\350\263\000}\301\322\021\310\242\000}\301\322\021\305\227\000}\301\322\021\315\210\000}\301\322\021\305\230\000}\301\322\021\350\342\000}\301\322\021\310\247\000}\301\322\021\350\353\000}\301\322\021\315\312\000}\301\322\021\352\003\000}\301\322\021\310\037\000}\301\322\021\342\274\000}\301\322\021\306\263\000}\301\322\021\315\206\000}\301\322\021\310\245\307\0112\000}\301\322\021\310\245\307\0117\000}\301\322\021\350\265\000}\021\313\320\305\016\000}\021\313\320\300/\000}\021\002\300/\000}\021\002;\000}\021\002\300T\000}\021\002\300$\000}\021\002\311Y\000}\021\0021\000}\021\002\300l\000}\021\002\304\367\000}\021\002\301\007\000}\021\002\264\000"},
+    {0x17C0,30,"}\021\002\302L\000}\021\0029\000}\021\002\301X\000}\021\002\300L\000}\021\002\300\354\000}\021\002\300d\000}\002\345\266\000}\002\351G\000}\002\361\376\000}\002\344\261\000}\002\356\274\000}\002\323\365\000}\002\351\260\000}\002\356\214\000}\002\340\317\000}\002\322V\000}\002\352^\352c\000}\002\360\206\000}\002\326\005\000}\002\324\002\000}\002\341\026\000}\002\323\371\000}\002\324\335\305\216\341\251\000}\002\303\030\304\363\000}\002\3248\000}\002\347\371\314\300\000}\002\341q\000}\303<\014\351\204\000}\002\323\005\000}\002\322\366\000"},
+    {0x17E0,10,"}\017\300%\000}\0172\000}\0177\000}\017B\000}\017O\000}\017V\000}\017v\000}\017\201\000}\017u\000}\017\211\000"},
+    {0x17F0,10,"}\014\303\030\3034\354\240\000}\014\303\030\3034\310B\000}\014\303\030\3034\305\216\000}\014\303\030\3034\307D\000}\014\303\030\3034\307P\000}\014\303\030\3034\310\224\000}\014\303\030\3034\310\227\000}\014\303\030\3034\310\230\000}\014\303\030\3034\310\225\000}\014\303\030\3034\310\226\000"},
+    {0x1800,26,"j\302\226\000j\303\304\000j\300\251\000j\300\324\300k\000j\301^\000jO\214\000j\301\220\302\251\302\346\000j\301\341\005\324s\303\337\000j\302\001\300\251\000j\302\001\300\324\300k\000j\345\276\000j\305<D\305\2432\000j\305<D\305\2437\000j\305<D\305\243B\000j\021\301\270\000j\305<D\305\243O\000j\017\300%\000j\0172\000j\0177\000j\017B\000j\017O\000j\017V\000j\017v\000j\017\201\000j\017u\000j\017\211\000"},
+    {0x1820,32,"j\001\025\000j\0019\000j\001;\000j\0016\000j\0011\000j\001\301\007\000j\001\301\343\000j\001\301\017\000j\001\256\000j\001\302\262\000j\001\300\042\000j\001\230\000j\001\302\023\000j\001\300\005\000j\001\251\000j\001\252\000j\001\271\000j\001\300j\000j\001\265\000j\001\300\001\000j\001\300\220\000j\001\300g\000j\001\264\000j\001\235\000j\001\300q\000j\001\301\026\000j\001[\000j\001\300\223\000j\001\301\201\000j\001\300\341\000j\001\303\020\000j\001\362v\000"},
+    {0x1840,32,"j\001\303\330\000j\001\311[\000j\001\301\256\000j\001\301\220\253\021\002\000j\001\301\2209\000j\001\301\220;\000j\001\301\2206\000j\001\301\2201\000j\001\301\220\301\007\000j\001\301\220\301\343\000j\001\301\220\302\262\000j\001\301\220\300\042\000j\001\301\220\230\000j\001\301\220\302\023\000j\001\301\220\300\005\000j\001\301\220\251\000j\001\301\220\265\000j\001\301\220\300\001\000j\001\301\220\300\220\000j\001\301\220\300g\000j\001\301\220\301\201\000j\001\301\220\264\000j\001\301\220\300q\000j\001\301\220[\000j\001\301\220\305=\000j\001\301\220\303\020\000j\001\301\220\340l\000j\001\301\220\345\251\000j\001\301\220\302\271\000j\001\301\3419\000j\001\301\341;\000j\001\301\341\307\352\000"},
+    {0x1860,25,"j\001\301\341\301\343\000j\001\301\3411\000j\001\301\341\302\262\000j\001\301\341[\000j\001\301\341\300\005\000j\001\301\341\203\000j\001\301\341\230\000j\001\301\341\300j\000j\001\301\341\265\000j\001\301\341\300\001\000j\001\301\341\300g\000j\001\301\341\301\026\000j\001\301\341\305=\000j\001\301\341\303\020\000j\001\301\341\301\201\000j\001\301\341\300\341\000j\001\301\341\305\231\000j\001\301\341\300\220\000j\001\301\341\301\371\000j\001\302\001;\000j\001\302\001[\000j\001\302\001\235\000j\001\302\001\301\026\000j\001\302\001\301\371\000j\001\300\220\0037\214\000"},
+    {0x1880,32,"j\001\301\012\301\013\300\3162\000j\001\301\012\301\013\30142\000j\001\301\012\301\013\331\336\000j\001\301\012\301\013\316\316\000j\001\301\012\301\013\300\221\316\316\000j\001\301\012\301\013\312Q\000j\001\301\012\301\013B\312Q\000j\001\301\012\301\013\025\000j\001\301\012\301\013;\000j\001\301\012\301\013[\000j\001\301\012\301\013\300c\000j\001\301\012\301\013\300m\000j\001\301\012\301\013\300\334\000j\001\301\012\301\013\301\023\000j\001\301\012\301\013\300\335\000j\001\301\012\301\013\301\002\000j\001\301\012\301\013\265\000j\001\301\012\301\013\300\001\000j\001\301\012\301\013\230\000j\001\301\012\301\013\300\306\000j\001\301\012\301\013\301&\000j\001\301\012\301\013\301\371\000j\001\301\012\301\013\300\341\000j\001\301\012\301\013\302\324\000j\001\301\220\301\012\301\013\265\000j\001\301\220\301\012\301\013\301\371\000j\001\302\001\301\012\301\013\300\361\000j\001\302\001\301\012\301\013\300c\000j\001\302\001\301\012\301\013\300m\000j\001\302\001\301\012\301\013\301B\000j\001\302\001\301\012\301\013\300\334\000j\001\302\001\301\012\301\013\301\036\000"},
+    {0x18A0,11,"j\001\302\001\301\012\301\013\265\000j\001\302\001\301\012\301\013\300\353\000j\001\302\001\301\012\301\013\301&\000j\001\302\001\301\012\301\013\312\312\000j\001\302\001\301\012\301\013\301\371\000j\001\302\001\301\012\301\013\300\341\000j\001\301\012\301\013o1\000j\001\301\012\301\013o\264\000j\001\302\001\301\012\301\013\301\004\000j\001\301\012\301\013\331\321\000j\001\302\001\301\012\301\013\303\330\000"},
+    {0x18B0,32,"\023\024\310v\000\023\024\302\325\000\023\024\312\012\000\023\024\305\306\000\023\024\350[\000\023\024\347\305\000\023\024\350\237\000\023\024\355\376\000\023\024\307\370\000\023\024\341\257\000\023\024\314\223\000\023\024\346#\000\023\024\345\013\000\023\024\342'\000\023\024\354\254\000\023\024\315\331\000\023\024\315\366\000\023\024\353\376\000\023\024\354C\000\023\024\361\343\000\023\024\317\021\000\023\024\315\234\000\023\024\315\016\000\023\024\302\362\315\016\000\023\024\315\017\000\023\024\302\362\315\017\000\023\024\315\020\000\023\024\302\362\315\020\000\023\024\315\021\000\023\024\302\362\315\021\000\023\024\351\367\000\023\024\351\370\000"},
+    {0x18D0,32,"\023\024\351\371\000\023\024\351\372\000\023\024\351\373\000\023\024\315\310\000\023\024\302\362\300<\000\023\024\302\362\300\007\000\023\024\302\362\300\011\000\023\024\302\362\3005\000\023\024\302\362\261\000\023\024\302\362\232\000\023\024\302\362d\000\023\024\302\362\304P\000\023\024\306\022\300P\000\023\024\303m\300P\000\023\0243\004\240\000\023\0243\301T<\000\023\024\315\224\351\366\000\023\024\300.\304\300\000\023\024\300.\305a\000\023\024\356R\000\023\024\311\024\000\023\024\356\375\000\023\024\356\373\000\023\024\311+\000\023\024\356\201\000\023\024\356\177\000\023\024\302Q\304T\000\023\024\302Q\310\315\000\023\024\302Q\305K\000\023\024`\336,\000\023\024`\307\207\305>\000\023\024`\305=\000"},
+    {0x18F0,6,"\023\024`\313\221\000\023\024\302Q\340\243\000\023\024`\313\351\000\023\024\307B\307\207p\000\023\024\307B\307\207c\000\023\024`\307\210d\000"},
+    {0x1900,31,"\300\212\360\235\001\000\300\212\001[\000\300\212\001\300\223\000\300\212\001\300\005\000\300\212\001\300\361\000\300\212\001\300c\000\300\212\001\300m\000\300\212\001\300\220\000\300\212\001\300g\000\300\212\001\301B\000\300\212\001\317\014\000\300\212\001\265\000\300\212\001\300\254\000\300\212\001\300\001\000\300\212\001\300\353\000\300\212\001\256\000\300\212\001\230\000\300\212\001\300\306\000\300\212\001\300\042\000\300\212\001\301\004\000\300\212\001\251\000\300\212\001\264\000\300\212\001\235\000\300\212\001\252\000\300\212\001\300q\000\300\212\001\300j\000\300\212\001\301&\000\300\212\001\271\000\300\212\001\203\000\300\212\001\3360\000\300\212\001\311\042\000"},
+    {0x1920,12,"\300\212\021\002\025\000\300\212\021\002;\000\300\212\021\0021\000\300\212\021\002\301\017\000\300\212\021\002\300L\000\300\212\021\002\300\354\000\300\212\021\002\300d\000\300\212\021\0029\000\300\212\021\0026\000\300\212\300B\001\264\000\300\212\300B\001\235\000\300\212\300B\001\300q\000"},
+    {0x1930,12,"\300\212\004\001[\000\300\212\004\001\300c\000\300\212\004\001\300\316\000\300\212\004\001\265\000\300\212\004\001\256\000\300\212\004\001\230\000\300\212\004\001\251\000\300\212\004\001\235\000\300\212\004\001\252\000\300\212\002\344\233\000\300\212\002\340\376\000\300\212\002\352B\000"},
+    {0x1940,1,"\300\212\002\304\300\000"},
+    {0x1944,32,"\300\212\301\257+\000\300\212\301\216+\000\300\212\017\300%\000\300\212\0172\000\300\212\0177\000\300\212\017B\000\300\212\017O\000\300\212\017V\000\300\212\017v\000\300\212\017\201\000\300\212\017u\000\300\212\017\211\0005\300\345\001[\0005\300\345\001\302\222\0005\300\345\001\300c\0005\300\345\001\301\201\0005\300\345\001\271\0005\300\345\001\264\0005\300\345\001\265\0005\300\345\001\300\254\0005\300\345\001\252\0005\300\345\001\230\0005\300\345\001\300\306\0005\300\345\001\251\0005\300\345\001\301\026\0005\300\345\001\300\307\0005\300\345\001\203\0005\300\345\001\302\023\0005\300\345\001\300\223\0005\300\345\001\302\217\0005\300\345\001\256\0005\300\345\001\025\000"},
+    {0x1964,10,"5\300\345\001;\0005\300\345\001\301\017\0005\300\345\001\303B\0005\300\345\0011\0005\300\345\001\300\354\0005\300\345\0016\0005\300\345\001\301\343\0005\300\345\0019\0005\300\345\001\312@\0005\300\345\001\300L\000"},
+    {0x1970,5,"5\300\345\001\303e\0005\300\345\001\303\247\0005\300\345\001\304e\0005\300\345\001\303f\0005\300\345\001\306\374\000"},
+    {0x1980,32,"\30075\300@\001\217\302\023\000\30075\300@\001\210\302\023\000\30075\300@\001\217[\000\30075\300@\001\217\302\222\000\30075\300@\001\217\300c\000\30075\300@\001\210[\000\30075\300@\001\210\302\222\000\30075\300@\001\210\300c\000\30075\300@\001\217\301\201\000\30075\300@\001\217\271\000\30075\300@\001\217\264\000\30075\300@\001\210\301\201\000\30075\300@\001\210\271\000\30075\300@\001\210\264\000\30075\300@\001\217\265\000\30075\300@\001\217\300\254\000\30075\300@\001\217\256\000\30075\300@\001\210\265\000\30075\300@\001\210\300\254\000\30075\300@\001\210\256\000\30075\300@\001\217\230\000\30075\300@\001\217\300\306\000\30075\300@\001\217\251\000\30075\300@\001\210\230\000\30075\300@\001\210\300\306\000\30075\300@\001\210\251\000\30075\300@\001\217\301\026\000\30075\300@\001\217\300\307\000\30075\300@\001\217\252\000\30075\300@\001\210\301\026\000\30075\300@\001\210\300\307\000\30075\300@\001\210\252\000"},
+    {0x19A0,12,"\30075\300@\001\217\203\000\30075\300@\001\217\300\001\000\30075\300@\001\217\300\042\000\30075\300@\001\210\203\000\30075\300@\001\210\300\001\000\30075\300@\001\210\300\042\000\30075\300@\001\217\314\035\000\30075\300@\001\217\317\006\000\30075\300@\001\210\314\035\000\30075\300@\001\210\317\006\000\30075\300@\001\217\310\366\000\30075\300@\001\210\310\366\000"},
+    {0x19B0,26,"\30075\300@\021\002\021\354&\000\30075\300@\021\002\300/\000\30075\300@\021\002\300T\000\30075\300@\021\0021\000\30075\300@\021\002\300l\000\30075\300@\021\0029\000\30075\300@\021\002\301X\000\30075\300@\021\0026\000\30075\300@\021\002\305~\000\30075\300@\021\002\301\343\000\30075\300@\021\002\302\325\000\30075\300@\021\002\312\012\000\30075\300@\021\002\316\333\000\30075\300@\021\002\310v\000\30075\300@\021\002\315\032\000\30075\300@\021\002\357\221\000\30075\300@\021\002\307\352\000\30075\300@\0013\300\015\000\30075\300@\0013\302\022\000\30075\300@\0013\232\000\30075\300@\0013\261\000\30075\300@\0013\300\011\000\30075\300@\0013\300\024\000\30075\300@\0013\077\000\30075\300@\212\305g\000\30075\300@\212\305h\000"},
+    {0x19D0,11,"\30075\300@\017\300%\000\30075\300@\0172\000\30075\300@\0177\000\30075\300@\017B\000\30075\300@\017O\000\30075\300@\017V\000\30075\300@\017v\000\30075\300@\017\201\000\30075\300@\017u\000\30075\300@\017\211\000\30075\300@\205\0172\000"},
+    {0x19DE,32,"\30075\300@\002\314%\000\30075\300@\002\341\344\000}\014\347\300\000}\014\310B\302\177\000}\014\305\216\302\177\000}\014\307D\302\177\000}\014\307P\302\177\000}\014\310\224\302\177\000}\014\310\227\302\177\000}\014\310\230\302\177\000}\014\310\225\302\177\000}\014\310\226\302\177\000}\014\307\177\302\177\000}\014\312\324\302\177\000}\014\312\325\302\177\000}\014\312\322\302\177\000}\014\312\323\302\177\000}\014\312\326\302\177\000}\014\357\042\000}\014\310B\302\210\000}\014\305\216\302\210\000}\014\307D\302\210\000}\014\307P\302\210\000}\014\310\224\302\210\000}\014\310\227\302\210\000}\014\310\230\302\210\000}\014\310\225\302\210\000}\014\310\226\302\210\000}\014\307\177\302\210\000}\014\312\324\302\210\000}\014\312\325\302\210\000}\014\312\322\302\210\000"},
+    {0x19FE,30,"}\014\312\323\302\210\000}\014\312\326\302\210\000\301y\001[\000\301y\001\300\005\000\301y\001\300c\000\301y\001\314\350\000\301y\001\230\000\301y\001\300\042\000\301y\001\251\000\301y\001\314\276\000\301y\001\265\000\301y\001\300\001\000\301y\001\256\000\301y\001\310`\000\301y\001\300m\000\301y\001\300g\000\301y\001\300\225\000\301y\001\346\214\000\301y\001\264\000\301y\001\235\000\301y\001\252\000\301y\001\300\307\000\301y\001\271\000\301y\001\025\000\301y\001\203\000\301y\021\002;\000\301y\021\0021\000\301y\021\0029\000\301y\021\0026\000\301y\021\002\301X\000"},
+    {0x1A1E,32,"\301y\347\207\000\301y\301lK\3013\0005\205\001\217[\0005\205\001\217\300\223\0005\205\001\217\310\011\0005\205\001\210[\0005\205\001\210\310\011\0005\205\001\210\300\223\0005\205\001\300c\0005\205\001\217\300m\0005\205\001\217\300\220\0005\205\001\210\300m\0005\205\001\210\271\0005\205\001\210\300\220\0005\205\001\300\225\0005\205\001\351;\0005\205\001\217\310\252\0005\205\001\300\001\0005\205\001\210\310\252\0005\205\001\315\233\0005\205\001\217\265\0005\205\001\217\300\254\0005\205\001\210\265\0005\205\001\210\300\254\0005\205\001\256\0005\205\001\300\042\0005\205\001\217\230\0005\205\001\217\300\306\0005\205\001\217\301\026\0005\205\001\210\230\0005\205\001\210\301\026\0005\205\001\210\300\306\000"},
+    {0x1A3E,32,"5\205\001\251\0005\205\001\210\264\0005\205\001\217\264\0005\205\001\235\0005\205\001\351\340\0005\205\001\252\0005\205\001\300@\0005\205\001\300q\0005\205\001\217\300j\0005\205\001\217\301&\0005\205\001\217\271\0005\205\001\217\203\0005\205\001\301\243\0005\205\001\025\0005\205\001\210\203\0005\205\001;\0005\205\001\300T\0005\205\0011\0005\205\001\300l\0005\205\001\301\017\0005\205\001\300\354\0005\205\001\314%\0005\205\001\304\242\271\0005\205\3003\002\300\017\235\0005\205\3003\002\300\017\252\0005\205\3003\002\252\355\353\306e\0005\205\002\301\357\306Q\306e\0005\205\3003\0023\300c\0005\205\3003\002\210\230\0005\205\3003\002\217\310\252\300\037\210\230\0005\205\3003\002\251\0005\205\3003\002\300\042\000"},
+    {0x1A5E,1,"5\205\3003\002\271\000"},
+    {0x1A60,29,"5\205\002\352P\0005\205\021\002\025\0005\205\021\002\301\357\310\272\0005\205\021\002\300/\0005\205\021\002\304\355\300/\0005\205\021\002;\0005\205\021\002\300T\0005\205\021\002\301\343\0005\205\021\002\3116\0005\205\021\0021\0005\205\021\002\300l\0005\205\021\0026\0005\205\021\002\305~:\0005\205\021\002\310v\0005\205\021\0029\0005\205\021\002\301X\0005\205\021\002\300\354\0005\205\021\002\300L\0005\205\021\002\205\300L\0005\205\021\002\305~'\0005\205\002\301\357\306Q\0005\205\002\305\270\0005\205\002\303e\0005\205\002\307\375\303\247\0005\205\002\307\375\304e\0005\205\002\307\375\303f\0005\205\002\235\336M\0005\205\002\301\357\310\271\0005\205\002\341%\340\332\000"},
+    {0x1A7F,11,"5\205 \303}<\0005\205\303M\017\300%\0005\205\303M\0172\0005\205\303M\0177\0005\205\303M\017B\0005\205\303M\017O\0005\205\303M\017V\0005\205\303M\017v\0005\205\303M\017\201\0005\205\303M\017u\0005\205\303M\017\211\000"},
+    {0x1A90,10,"5\205\205\017\300%\0005\205\205\0172\0005\205\205\0177\0005\205\205\017B\0005\205\205\017O\0005\205\205\017V\0005\205\205\017v\0005\205\205\017\201\0005\205\205\017u\0005\205\205\017\211\000"},
+    {0x1AA0,14,"5\205\002\361\012\0005\205\002\361\013\0005\205\002\352q\0005\205\002\341\001\0005\205\002\337b\0005\205\002\332\206\0005\205\002\300:\300\235\315\233\0005\205\002\301\357\361\240\0005\205\002\340\305\0005\205\002\340\306\0005\205\002\352j\0005\205\002\352k\0005\205\002\336g\0005\205\002\324\320\000"},
+    {0x1AB0,31," \305+\300M\300\206\000 \332G\000 \304\254\000 \267\034\000 \300\262<\000 \361\077:\000 \305\001\300\201:\000 \262+:\000 4\262+:\000 {\305\357I:\000 \316:\305\357I:\000 \306\237'\000 4\306\237'\000 \306\237:\000 \306\237\301\336\000 \010\004\001\300P:\000 \010\004\001\241\300P:\000 (\300\371'(\000 &\300\371'&\000 (\300\371:(\000 &\300\371:&\000 ,\324{'\000 \036\002'\000 \300\2214\3124'\000 a\002'\000 4a\002'\000 4a\002:\000 \300\262\300!\300\206\000 \010\004\001\302\015\300\003\000 \010\004\001\302\015c\000 \010\004\001\302\015\300\007\000"},
+    {0x1B00,32,"\227\002\307\015\351\202\000\227\002\307\015\302t\000\227\002\325\022\000\227\002\316F\000\227\002\324T\000\227\001\312\031\000\227\001\312\031\302\371\000\227\001\313\315\000\227\001\313\315\302\371\000\227\001\316\321\000\227\001\316\321\302\371\000\227\001\235\304\331\000\227\001\235\304\331\302\371\000\227\001\252\306j\000\227\001\252\306j\302\371\000\227\001\334\013\000\227\001\322Y\000\227\001\315\037\000\227\001\315\037\302\371\000\227\001[\000\227\001[\303\336\000\227\001\300\005\000\227\001\300\005\335\376\000\227\001\300c\000\227\001\300m\000\227\001\300m\341\337\000\227\001\300g\000\227\001\300g\340c\000\227\001\300\225\000\227\001\265\342!\000\227\001\265\302\356\303\336\000\227\001\300\001\302\356\322u\000"},
+    {0x1B20,32,"\227\001\300\001\302\356\303\336\000\227\001\256\3514\000\227\001\265\000\227\001\265\355\373\000\227\001\300\001\000\227\001\300\001\343z\000\227\001\256\000\227\001\230\000\227\001\230\340\326\000\227\001\300\042\000\227\001\300\042\340\375\000\227\001\251\000\227\001\264\000\227\001\235\000\227\001\252\000\227\001\300q\000\227\001\271\352F\000\227\001\271\352f\000\227\001\271\000\227\001\203\000\227\002\351g\000\227\021\002\302\371\000\227\021\002\307\015\000\227\021\002\307\015\315\327\000\227\021\002\306\357\000\227\021\002\306\357\340\024\000\227\021\002\235\304\331\000\227\021\002\235\304\331\302\371\000\227\021\002\252\306j\000\227\021\002\252\306j\302\371\000\227\021\002\305\260\000\227\021\002\305\260\304\331\000"},
+    {0x1B40,13,"\227\021\002\305\260\302\371\000\227\021\002\305\260\304\331\302\371\000\227\021\002\310\201\000\227\021\002\310\201\302\371\000\227\305\007\305\007\000\227\001\300\337\303\367\000\227\001\341 \303\367\000\227\001\357D\303\367\000\227\001\303A\303\367\000\227\001\302W\303\367\000\227\001\307!\303\367\000\227\001\322\351\303\367\000\227\001\301\034\313\347\000"},
+    {0x1B50,32,"\227\017\300%\000\227\0172\000\227\0177\000\227\017B\000\227\017O\000\227\017V\000\227\017v\000\227\017\201\000\227\017u\000\227\017\211\000\227\315\077\000\227\315;\000\227\316\373\000\227\307W\347\217\000\227\307W\354Z\000\227\307W\347\255\000\227\347\213\000\227$\014\313\003\000\227$\014\332\042\000\227$\014\313\017\000\227$\014\305\376\000\227$\014\305\376\316F\000\227$\014\332^\000\227$\014\331\317\000\227$\014\332.\000\227$\014\331\331\000\227$\014\305\376\335\222\000\227$\014 \356\023\000\227$\014 \334\037\000\227$\014 \313\367\000\227$\014 \313\366\000\227$\014 \307\354\000"},
+    {0x1B70,15,"\227$\014 \313\367\003\307\354\000\227$\014 \313\366\003\307\354\000\227$\014 \3242\000\227$\014 \335\372\000\227$\014\306\306\262\301Q\000\227$\014\306\306\262\301\236\000\227$\014\306\306\301\005\316\271\000\227$\014\306\306\301\005\355\342\000\227$\014\305c\262\347\225\000\227$\014\305c\262\350\212\000\227$\014\305c\301\005\350)\000\227$\014\305c\301\005\3503\000\227$\014\305c\262\310\212\000\227\315\077\314.\000\227\315;\314.\000"},
+    {0x1B80,32,"\300x\002\347\243\000\300x\002\347\231\000\300x\002\347\234\000\300x\001\025\000\300x\001;\000\300x\0011\000\300x\001\301X\000\300x\0016\000\300x\0019\000\300x\001\303\203\000\300x\001[\000\300x\001\302\023\000\300x\001\300\005\000\300x\001\300c\000\300x\001\300m\000\300x\001\300g\000\300x\001\300\341\000\300x\001\300\225\000\300x\001\265\000\300x\001\300\001\000\300x\001\256\000\300x\001\230\000\300x\001\301\026\000\300x\001\300\307\000\300x\001\300\042\000\300x\001\251\000\300x\001\264\000\300x\001\235\000\300x\001\252\000\300x\001\300q\000\300x\001\271\000\300x\001\302\222\000"},
+    {0x1BA0,32,"\300x\001\203\000\300x\3003\002\347\215\000\300x\3003\002\347\241\000\300x\3003\002\347\244\000\300x\021\002\347\226\000\300x\021\002\347\245\000\300x\021\002\347\220\000\300x\021\002\347\235\000\300x\021\002\347\214\000\300x\021\002\347\224\000\300x\002\347\212\000\300x\002\301\031\000\300x\3003\002\315D\251\000\300x\3003\002\315D\300q\000\300x\001\300\223\000\300x\001\355m\000\300x\017\300%\000\300x\0172\000\300x\0177\000\300x\017B\000\300x\017O\000\300x\017V\000\300x\017v\000\300x\017\201\000\300x\017u\000\300x\017\211\000\300x\302Y\000\300x\001\351q\000\300x\001\314=\000\300x\001\301\004\000\300x\0013\300\011\000\300x\0013\261\000"},
+    {0x1BC0,32,"\300\275\001\025\000\300\275\001\303$\025\000\300\275\001\203\000\300\275\001\303$\203\000\300\275\001\310$\203\000\300\275\001\300\042\000\300\275\001\307\366\300\042\000\300\275\001\230\000\300\275\001\303$\230\000\300\275\001\256\000\300\275\001\310$\256\000\300\275\001\300q\000\300\275\001\303$\300q\000\300\275\001\3159\300q\000\300\275\001\300\005\000\300\275\001\303$\300\005\000\300\275\001\300g\000\300\275\001\300\001\000\300\275\001\235\000\300\275\001\303$\235\000\300\275\001\251\000\300\275\001\303$\251\000\300\275\001\316$\265\000\300\275\001\314\375\265\000\300\275\001\271\000\300\275\001\303$\271\000\300\275\001\310$\271\000\300\275\001\264\000\300\275\001\303$\264\000\300\275\001\300c\000\300\275\001\252\000\300\275\001\303$\252\000"},
+    {0x1BE0,20,"\300\275\001\300\225\000\300\275\001\300m\000\300\275\001\304\310\000\300\275\001\305i\000\300\275\001;\000\300\275\0011\000\300\275\002\356\222\000\300\275\021\0029\000\300\275\021\002\31599\000\300\275\021\002\301\017\000\300\275\021\002;\000\300\275\021\002\307\366;\000\300\275\021\0026\000\300\275\021\002\307\3666\000\300\275\021\0021\000\300\275\021\0021)\303$\271\000\300\275\3003\002\302\022\000\300\275\3003\002\300\026\000\300\275\315>\000\300\275\347\236\000"},
+    {0x1BFC,32,"\300\275\014\302\264\256\343\356\000\300\275\014\302\264\350\031\000\300\275\014\302\264\340\224\000\300\275\014\302\264\315>\000\300i\001[\000\300i\001\341Y\000\300i\001\300\223\000\300i\001\300\005\000\300i\001\335\353\000\300i\001\300c\000\300i\001\300m\000\300i\001\300\220\000\300i\001\300g\000\300i\001\300\225\000\300i\001\265\000\300i\001\300\254\000\300i\001\300\001\000\300i\001\256\000\300i\001\230\000\300i\001\306\251\000\300i\001\300\306\000\300i\001\301\026\000\300i\001\334\353\000\300i\001\300\042\000\300i\001\324_\000\300i\001\251\000\300i\001\314\260\000\300i\001\301\201\000\300i\001\302\217\000\300i\001\302\271\000\300i\001\264\000\300i\001\235\000"},
+    {0x1C1C,28,"\300i\001\252\000\300i\001\203\000\300i\001\313\256\000\300i\001\300\307\000\300i\001\271\000\300i\001\300j\000\300i\001\300q\000\300i\001\025\000\300i\300B\001\264\000\300i\300B\001\235\000\300i\021\002\300/\000\300i\021\002;\000\300i\021\0026\000\300i\021\002\300\354\000\300i\021\0021\000\300i\021\002\300l\000\300i\021\0029\000\300i\3003\002\300\011\000\300i\3003\002\261\000\300i\3003\002p\000\300i\3003\002\232\000\300i\3003\002\300<\000\300i\3003\002c\000\300i\3003\002\300\007\000\300i\3003\002\346\224\000\300i\3003\002\306Q\000\300i\002\3515\000\300i\002\301\306\000"},
+    {0x1C3B,15,"\300i\300\006\316e\000\300i\300\006\310h\356X\316e\000\300i\300\006\312\242\000\300i\300\006\316\256\312\242\000\300i\300\006\316\256\000\300i\017\300%\000\300i\0172\000\300i\0177\000\300i\017B\000\300i\017O\000\300i\017V\000\300i\017v\000\300i\017\201\000\300i\017u\000\300i\017\211\000"},
+    {0x1C4D,32,"\300i\001\300\334\000\300i\001\301\023\000\300i\001\300\335\000\300\350\300\352\017\300%\000\300\350\300\352\0172\000\300\350\300\352\0177\000\300\350\300\352\017B\000\300\350\300\352\017O\000\300\350\300\352\017V\000\300\350\300\352\017v\000\300\350\300\352\017\201\000\300\350\300\352\017u\000\300\350\300\352\017\211\000\300\350\300\352\001\252\000\300\350\300\352\001\301\234\000\300\350\300\352\001\305\323\000\300\350\300\352\001\302\262\000\300\350\300\352\001\302A\000\300\350\300\352\001\305a\000\300\350\300\352\001\321\312\000\300\350\300\352\001\321\311\000\300\350\300\352\001\321\313\000\300\350\300\352\001\321\320\000\300\350\300\352\001\300\227\000\300\350\300\352\001\304\256\000\300\350\300\352\001\307\335\000\300\350\300\352\001\340=\000\300\350\300\352\001\305Q\000\300\350\300\352\001\301\265\000\300\350\300\352\001\307\012\000\300\350\300\352\001\301\233\000\300\350\300\352\001\316\326\000"},
+    {0x1C6D,28,"\300\350\300\352\001\316\333\000\300\350\300\352\001\300\345\000\300\350\300\352\001\306\032\000\300\350\300\352\001\333\372\000\300\350\300\352\001\300\276\000\300\350\300\352\001\306\033\000\300\350\300\352\001\302\020\000\300\350\300\352\001\347Z\000\300\350\300\352\001\347\036\000\300\350\300\352\001\3151\000\300\350\300\352\001\305\177\000\300\350\300\352\301!\357\007\000\300\350\300\352\335q\316\270\000\300\350\300\352\344\223\316\270\000\300\350\300\352\351[\000\300\350\300\352\347\357\000\300\350\300\352\322Q\000\300\350\300\352\300\006\314\301\000\300\350\300\352\300\0064\314\301\000*\004\001\302\213\302W\000*\004\001\342\223\301\350\000*\004\001\304\3076\000*\004\001\302\376\303\013\000*\004\001\304\355\301=\000*\004\001\356I\301=\000*\004\001\304\355\303L\002\000*\004\001\304\355\303\255\000*\004\001\357\241\304\370\000"},
+    {0x1C90,32,"g\300\370\006\001\3016\000g\300\370\006\001\305\341\000g\300\370\006\001\3041\000g\300\370\006\001\306\014\000g\300\370\006\001\300\276\000g\300\370\006\001\307\021\000g\300\370\006\001\305\320\000g\300\370\006\001\306\364\000g\300\370\006\001\300\241\000g\300\370\006\001\304\264\000g\300\370\006\001\306g\000g\300\370\006\001\301\360\000g\300\370\006\001\305r\000g\300\370\006\001\300\216\000g\300\370\006\001\306\236\000g\300\370\006\001\307#\000g\300\370\006\001\304\330\000g\300\370\006\001\304\335\000g\300\370\006\001\304]\000g\300\370\006\001\303\251\000g\300\370\006\001\306\245\000g\300\370\006\001\306T\000g\300\370\006\001\3060\000g\300\370\006\001\305\226\000g\300\370\006\001\301[\000g\300\370\006\001\305\363\000g\300\370\006\001\302\230\000g\300\370\006\001\305S\000g\300\370\006\001\305\367\000g\300\370\006\001\305\360\000g\300\370\006\001\307\030\000g\300\370\006\001\306M\000"},
+    {0x1CB0,11,"g\300\370\006\001\3067\000g\300\370\006\001\301\027\000g\300\370\006\001\305J\000g\300\370\006\001\301\300\000g\300\370\006\001\304\245\000g\300\370\006\001\306>\000g\300\370\006\001\303\014\000g\300\370\006\001\305\005\000g\300\370\006\001\313+\000g\300\370\006\001\241\3041\000g\300\370\006\001\300\375\000"},
+    {0x1CBD,11,"g\300\370\006\001\304n\000g\300\370\006\001\303L\002\000g\300\370\006\001\314#\002\000\300x\300\006\302\264\355\134\000\300x\300\006\302\264\347\232\000\300x\300\006\302\264\350\223\000\300x\300\006\302\264\312\221\000\300x\300\006\302\264\314=\306\317\000\300x\300\006\302\264[\306\317\000\300x\300\006\302\264\300\001\306\317\000\300x\300\006\302\264\300\042\306\317\000"},
+    {0x1CD0,32,"\300\357\212\340\337\000\300\357\212\353\371\000\300\357\212\350d\000\300\357\002\345\264\000\300\357\002\305\312\314\250\303a\000\300\357\212\305\312\322N\301\322\303a\000\300\357\212\305\312\301\322\303a\000\300\357\212\305\312\307\367\301\322\303a\000\300\357\212\302t:\000\300\357\212\305\312\307\367\301\322\303a\352{\000\300\357\2124\303a\000\300\357\212\300\262\303a\000\300\357\212\307\367\305\014\000\300\357\212<:\000\300\357\2127\214:\000\300\357\212B\214:\000\300\357\212\351\230\313\362\301\322\303a\000\300\357\212\322\354\301\322\303a\000\300\357\002\3014\303a\000\300\357\002\3014\307\013\000\300\357\002\300:\3014\307\013\000\300\357\002\3014\305\014\000\300\357\002\300:\3014\305\014\000\300\357\002\3014\307\013\003\300\253\000\300\357\002\3014\305\014\003\300\253\000\300\357\002\300\316\312(\000\300\357\002\300\316\323\351\000\300\357\002\300\316\316\336\000\300\357\002\300\316\316\336\003\300\253\000\300\357\002\356x\000\300\357\002\336\231\253\300\316\000\300\357\002\253\300\316\000"},
+    {0x1CF0,11,"\300\357\002\351\327\253\300\316\000\300\357\002\300\316\357\206\344\231\000\300\357\002\3125\000\300\357\002\300\235\3125\000\300\357\212\302t'\000\300\357\002\304\262\000\300\357\002\304\371\000\300\357\002\322\356\000\300\357\212\240'\000\300\357\2124\240'\000\300\357\0024\300\316\312(\000"},
+    {0x1D00,32,"\010\001\004\006\025\000\010\001\004\006\301X\000\010\004\001\241\301X\000\010\001\004\006\3035\077\000\010\001\004\006\3005\000\010\001\004\006\300\024\000\010\001\004\006\303\306\000\010\001\004\0069\000\010\004\001\241\2629\000\010\004\001\241;\000\010\001\004\006\300U\000\010\001\004\006\300\011\000\010\001\004\006p\003I\000\010\001\004\006\261\000\010\001\004\006\300:\232\000\010\001\004\0066\000\010\001\004\006\2626\000\010\004\001\302%6\000\010\004\001\302%\2626\000\010\004\001\302%6\003I\000\010\004\001\241\301\007\000\010\001\004\006\303\354\000\010\004\001\300\365o6\000\010\004\001\3017o6\000\010\001\004\006\300<\000\010\001\004\006\300:c\000\010\001\004\006\241c\000\010\001\004\006\300\007\000\010\001\004\0061\000\010\004\001\302%1\000\010\004\001\302%\332H1\000\010\004\001\302%\241\261\000"},
+    {0x1D20,32,"\010\001\004\006\300\015\000\010\001\004\006\300P\000\010\001\004\006\300 \000\010\001\004\006\302\342\000\010\001\303l\342\036\354\275\000\010\001\300\375\000\042\001\004\006\301\352\000\042\001\004\006\302\242\000\042\001\004\006\300\325\000\042\001\004\006\301\230\000\042\001\004\006\302P\000*\001\004\006\301\334\000>\001\006\025\000>\001\006\301X\000>\001\006\077\000>\001\006\3035\077\000>\001\006\300\024\000>\001\0069\000>\001\006\300:9\000>\001\006\300\003\000>\001\006\300\026\000>\001\006;\000>\001\006\300U\000>\001\006\300\011\000>\001\006p\000>\001\006\261\000>\001\006\232\000>\001\006\300:\232\000>\001\0066\000>\001\006\303\354\000>\001\006\300<\000>\001\006c\000"},
+    {0x1D40,32,">\001\006\300\007\000>\001\0061\000>\001\006\300P\000>\001\004\025\000>\001\004\241\025\000>\001\004\300s\000>\001\004\241\301X\000>\001\004\077\000>\001\004\300\024\000>\001\0049\000>\001\004\303\042\000>\001\004\2629\000>\001\004\241\2629\000>\001\004\300\003\000>\001\004\241;\000>\001\004\300\011\000>\001\004\261\000>\001\004\302\341\000>\001\0046\000>\001\004\2626\000>\001\004\300\365o6\000>\001\004\3017o6\000>\001\004\300<\000>\001\004\300\007\000>\001\0041\000>\001\004\302%1\000>\001\004\241\261\000>\001\004\300\015\000>\001\004\300\375\000>\001\004\302\033\000>\001\004\042\301\352\000>\001\004\302\012\000"},
+    {0x1D60,32,">\001\004\042\301\307\000>\001\004\301\256\000\010\301'\004\001;\000\010\301'\004\001c\000\010\301'\004\0011\000\010\301'\004\001\300\015\000\042\301'\004\001\302\033\000\042\301'\004\001\301\352\000\042\301'\004\001\301\230\000\042\301'\004\001\301\307\000\042\301'\004\001\301\256\000\010\004\001\301\343\000\010\004\001\077\003M\272\000\010\004\001\300\024\003M\272\000\010\004\001\300u\003M\272\000\010\004\001\261\003M\272\000\010\004\001\232\003M\272\000\010\004\001\300<\003M\272\000\010\004\001c\003M\272\000\010\004\001c\003\303\311\031M\272\000\010\004\001d\003M\272\000\010\004\001\300\007\003M\272\000\010\004\001\300 \003M\272\000\010\004\001\241\300\003\000>\001*\300\276\000\010\004\001\302\015\300\003\000\010\004\001\304\006\003\355\042\000\010\004\006\001;\003I\000\010\004\001\300\312\003I\000\010\004\001\300<\003I\000\010\004\006\0011\003I\000\010\004\001\300\356\003I\000"},
+    {0x1D80,32,"\010\004\001\077\003\301\213S\000\010\004\001\300\024\003\301\213S\000\010\004\001\300u\003\301\213S\000\010\004\001\300\003\003\301\213S\000\010\004\001\300\011\003\301\213S\000\010\004\001p\003\301\213S\000\010\004\001\261\003\301\213S\000\010\004\001\232\003\301\213S\000\010\004\001\300<\003\301\213S\000\010\004\001c\003\301\213S\000\010\004\001d\003\301\213S\000\010\004\001\302 \003\301\213S\000\010\004\001\300\015\003\301\213S\000\010\004\001\300>\003\301\213S\000\010\004\001\300 \003\301\213S\000\010\004\001\025\003\301\022S\000\010\004\001\300s\003\301\022S\000\010\004\001\300\024\003S\031\300\253\000\010\004\0019\003\301\022S\000\010\004\001\2629\003\301\022S\000\010\004\001\300:\2629\003\301\022S\000\010\004\001\303\042\003\301\022S\000\010\004\001;\003\301\022S\000\010\004\001\2626\003\301\022S\000\010\004\001\302 \003\301\022S\000\010\004\0011\003\301\022S\000\010\004\001\302\342\003\301\022S\000>\001\004\241\300s\000>\001\004\3005\000>\001\004\3005\003\301\347\000>\001\004\303\306\000>\001\004\300:\2629\000"},
+    {0x1DA0,32,">\001\004\300u\000>\001\004\301\375\300U\003I\000>\001\004\236\300\003\000>\001\004\241\300\026\000>\001\004;\003I\000>\001\004\300\312\000>\001\004\006;\000>\001\004\006;\003I\000>\001\004\300U\003\303|\000>\001\004p\003\301\022S\000>\001\004p\003\301\213S\000>\001\004\006p\000>\001\004\261\003S\000>\001\004\241\261\003\253\302\017\000>\001\004\232\003(S\000>\001\004\232\003\301\022S\000>\001\004\006\232\000>\001\004\30356\000>\001\004\301\307\000>\001\004d\003S\000>\001\004\302 \000>\001\004\300\007\003\301\213S\000>\001\0041x\000>\001\004\300\356\000>\001\004\0061\000>\001\004\300\015\003S\000>\001\004\241\300\015\000>\001\004\300 \000>\001\004\300 \003\301\022S\000>\001\004\300 \003\301\347\000>\001\004\302\342\000>\001\004\301\312\000"},
+    {0x1DC0,32," \301\016\300\200\300\206\000 \301\016\300!\300\206\000 \306\344:\000 \310\373+\000 \343w\000 \336\017\000 \343y\000 \3221\000 \336\016\000 \3220\000 \010\004\001c:\000 \324\202\000 \343x\000 4\300M'\000 \302\205'\000 \303\003:\000 \304\256:\000 \303\252'\000 \307\017'\000 \010\004\001\3058\262\025'\000 \010\004\001\301X\000 \010\004\001\305\327\000 \010\004\001\304t\000 \010\004\001\3005\301\202\000 \010\004\001\302\015\300\024\000 \010\004\001\303\306\000 \010\004\001\300\003\000 \010\001\004\006\300\003\000 \010\004\001\300\011\000 \010\004\001p\000 \010\001\004\006p\000 \010\001\004\006\261\000"},
+    {0x1DE0,32," \010\004\001\232\000 \010\001\004\006\232\000 \010\001\004\006c\000 \010\004\001c\305\241\000 \010\004\001d\000 \010\004\001\253d\000 \010\004\001\300 \000 \010\004\001\300s\000 \010\004\001\077\000 \010\004\001\302\033\000 \010\004\001\303\042\000 \010\004\001\300u\000 \010\004\001p\0034M\272\000 \010\004\0016\003{\305\357I\000 \010\004\001\300<\000 \010\004\001\302 \000 \010\004\0011\003{\305\357I\000 \010\004\001\300P\000 \010\004\001\025\003\300b\000 \010\004\0016\003\300b\000 \010\004\0011\003\300b\000 b\301O'\000 \303\220'&\000 \303\220'(\000 <'(\000 \302\376\300\221\304}:\000 <:(\000 \332\033+\000 4\300\221\300\270:\000 \302X\245C:\000 (\300a'\000 &\300a\031t\300a:\000"},
+    {0x1E00,32,"\010\006\001\025\003\240:\000\010\004\001\025\003\240:\000\010\006\001\077\003<'\000\010\004\001\077\003<'\000\010\006\001\077\003<:\000\010\004\001\077\003<:\000\010\006\001\077\003\300\201:\000\010\004\001\077\003\300\201:\000\010\006\001\3005\003\301\202\031\300!\000\010\004\001\3005\003\301\202\031\300!\000\010\006\001\300\024\003<'\000\010\004\001\300\024\003<'\000\010\006\001\300\024\003<:\000\010\004\001\300\024\003<:\000\010\006\001\300\024\003\300\201:\000\010\004\001\300\024\003\300\201:\000\010\006\001\300\024\003\301\202\000\010\004\001\300\024\003\301\202\000\010\006\001\300\024\003\300M:\000\010\004\001\300\024\003\300M:\000\010\006\0019\003\300\213\031\300\200\000\010\004\0019\003\300\213\031\300\200\000\010\006\0019\003\300\213\031\300!\000\010\004\0019\003\300\213\031\300!\000\010\006\0019\003\300M:\000\010\004\0019\003\300M:\000\010\006\0019\003\272:\000\010\004\0019\003\272:\000\010\006\0019\003\301\202\031\300\270\000\010\004\0019\003\301\202\031\300\270\000\010\006\001\300u\003<'\000\010\004\001\300u\003<'\000"},
+    {0x1E20,32,"\010\006\001\300\003\003\300\213\000\010\004\001\300\003\003\300\213\000\010\006\001\300\026\003<'\000\010\004\001\300\026\003<'\000\010\006\001\300\026\003<:\000\010\004\001\300\026\003<:\000\010\006\001\300\026\003\300b\000\010\004\001\300\026\003\300b\000\010\006\001\300\026\003\301\202\000\010\004\001\300\026\003\301\202\000\010\006\001\300\026\003\300\270:\000\010\004\001\300\026\003\300\270:\000\010\006\001;\003\272:\000\010\004\001;\003\272:\000\010\006\001;\003\300b\031\300!\000\010\004\001;\003\300b\031\300!\000\010\006\001\300\011\003\300!\000\010\004\001\300\011\003\300!\000\010\006\001\300\011\003<:\000\010\004\001\300\011\003<:\000\010\006\001\300\011\003\300\201:\000\010\004\001\300\011\003\300\201:\000\010\006\001p\003<:\000\010\004\001p\003<:\000\010\006\001p\003<:\031\300\213\000\010\004\001p\003<:\031\300\213\000\010\006\001p\003\300\201:\000\010\004\001p\003\300\201:\000\010\006\001p\003\300M:\000\010\004\001p\003\300M:\000\010\006\001\261\003\300!\000\010\004\001\261\003\300!\000"},
+    {0x1E40,32,"\010\006\001\261\003<'\000\010\004\001\261\003<'\000\010\006\001\261\003<:\000\010\004\001\261\003<:\000\010\006\001\232\003<'\000\010\004\001\232\003<'\000\010\006\001\232\003<:\000\010\004\001\232\003<:\000\010\006\001\232\003\300\201:\000\010\004\001\232\003\300\201:\000\010\006\001\232\003\300M:\000\010\004\001\232\003\300M:\000\010\006\0016\003\272\031\300!\000\010\004\0016\003\272\031\300!\000\010\006\0016\003\272\031\300b\000\010\004\0016\003\272\031\300b\000\010\006\0016\003\300\213\031\300\200\000\010\004\0016\003\300\213\031\300\200\000\010\006\0016\003\300\213\031\300!\000\010\004\0016\003\300\213\031\300!\000\010\006\001\300<\003\300!\000\010\004\001\300<\003\300!\000\010\006\001\300<\003<'\000\010\004\001\300<\003<'\000\010\006\001c\003<'\000\010\004\001c\003<'\000\010\006\001c\003<:\000\010\004\001c\003<:\000\010\006\001c\003<:\031\300\213\000\010\004\001c\003<:\031\300\213\000\010\006\001c\003\300\201:\000\010\004\001c\003\300\201:\000"},
+    {0x1E60,32,"\010\006\001d\003<'\000\010\004\001d\003<'\000\010\006\001d\003<:\000\010\004\001d\003<:\000\010\006\001d\003\300!\031<'\000\010\004\001d\003\300!\031<'\000\010\006\001d\003\300\377\031<'\000\010\004\001d\003\300\377\031<'\000\010\006\001d\003<:\031<'\000\010\004\001d\003<:\031<'\000\010\006\001\300\007\003<'\000\010\004\001\300\007\003<'\000\010\006\001\300\007\003<:\000\010\004\001\300\007\003<:\000\010\006\001\300\007\003\300\201:\000\010\004\001\300\007\003\300\201:\000\010\006\001\300\007\003\300M:\000\010\004\001\300\007\003\300M:\000\010\006\0011\003\300b:\000\010\004\0011\003\300b:\000\010\006\0011\003\272:\000\010\004\0011\003\272:\000\010\006\0011\003\300M:\000\010\004\0011\003\300M:\000\010\006\0011\003\272\031\300!\000\010\004\0011\003\272\031\300!\000\010\006\0011\003\300\213\031\300b\000\010\004\0011\003\300\213\031\300b\000\010\006\001\300\015\003\272\000\010\004\001\300\015\003\272\000\010\006\001\300\015\003<:\000\010\004\001\300\015\003<:\000"},
+    {0x1E80,32,"\010\006\001\300P\003\300\200\000\010\004\001\300P\003\300\200\000\010\006\001\300P\003\300!\000\010\004\001\300P\003\300!\000\010\006\001\300P\003\300b\000\010\004\001\300P\003\300b\000\010\006\001\300P\003<'\000\010\004\001\300P\003<'\000\010\006\001\300P\003<:\000\010\004\001\300P\003<:\000\010\006\001\300>\003<'\000\010\004\001\300>\003<'\000\010\006\001\300>\003\300b\000\010\004\001\300>\003\300b\000\010\006\001\300$\003<'\000\010\004\001\300$\003<'\000\010\006\001\300 \003\300M\000\010\004\001\300 \003\300M\000\010\006\001\300 \003<:\000\010\004\001\300 \003<:\000\010\006\001\300 \003\300\201:\000\010\004\001\300 \003\300\201:\000\010\004\001\300\026\003\300\201:\000\010\004\001\300\007\003\300b\000\010\004\001\300P\003\240'\000\010\004\001\300$\003\240'\000\010\004\001\025\003&o\240\000\010\004\001\253d\003<'\000\010\004\001\253d\003\274I\000\010\004\001\253d\003\217I\000\010\006\001\304Qd\000\010\004\001\302\012\000"},
+    {0x1EA0,32,"\010\006\001\025\003<:\000\010\004\001\025\003<:\000\010\006\001\025\003S'\000\010\004\001\025\003S'\000\010\006\001\025\003\300M\031\300!\000\010\004\001\025\003\300M\031\300!\000\010\006\001\025\003\300M\031\300\200\000\010\004\001\025\003\300M\031\300\200\000\010\006\001\025\003\300M\031S'\000\010\004\001\025\003\300M\031S'\000\010\006\001\025\003\300M\031\272\000\010\004\001\025\003\300M\031\272\000\010\006\001\025\003\300M\031<:\000\010\004\001\025\003\300M\031<:\000\010\006\001\025\003\300\270\031\300!\000\010\004\001\025\003\300\270\031\300!\000\010\006\001\025\003\300\270\031\300\200\000\010\004\001\025\003\300\270\031\300\200\000\010\006\001\025\003\300\270\031S'\000\010\004\001\025\003\300\270\031S'\000\010\006\001\025\003\300\270\031\272\000\010\004\001\025\003\300\270\031\272\000\010\006\001\025\003\300\270\031<:\000\010\004\001\025\003\300\270\031<:\000\010\006\0019\003<:\000\010\004\0019\003<:\000\010\006\0019\003S'\000\010\004\0019\003S'\000\010\006\0019\003\272\000\010\004\0019\003\272\000\010\006\0019\003\300M\031\300!\000\010\004\0019\003\300M\031\300!\000"},
+    {0x1EC0,32,"\010\006\0019\003\300M\031\300\200\000\010\004\0019\003\300M\031\300\200\000\010\006\0019\003\300M\031S'\000\010\004\0019\003\300M\031S'\000\010\006\0019\003\300M\031\272\000\010\004\0019\003\300M\031\272\000\010\006\0019\003\300M\031<:\000\010\004\0019\003\300M\031<:\000\010\006\001;\003S'\000\010\004\001;\003S'\000\010\006\001;\003<:\000\010\004\001;\003<:\000\010\006\0016\003<:\000\010\004\0016\003<:\000\010\006\0016\003S'\000\010\004\0016\003S'\000\010\006\0016\003\300M\031\300!\000\010\004\0016\003\300M\031\300!\000\010\006\0016\003\300M\031\300\200\000\010\004\0016\003\300M\031\300\200\000\010\006\0016\003\300M\031S'\000\010\004\0016\003\300M\031S'\000\010\006\0016\003\300M\031\272\000\010\004\0016\003\300M\031\272\000\010\006\0016\003\300M\031<:\000\010\004\0016\003\300M\031<:\000\010\006\0016\003\301R\031\300!\000\010\004\0016\003\301R\031\300!\000\010\006\0016\003\301R\031\300\200\000\010\004\0016\003\301R\031\300\200\000\010\006\0016\003\301R\031S'\000\010\004\0016\003\301R\031S'\000"},
+    {0x1EE0,32,"\010\006\0016\003\301R\031\272\000\010\004\0016\003\301R\031\272\000\010\006\0016\003\301R\031<:\000\010\004\0016\003\301R\031<:\000\010\006\0011\003<:\000\010\004\0011\003<:\000\010\006\0011\003S'\000\010\004\0011\003S'\000\010\006\0011\003\301R\031\300!\000\010\004\0011\003\301R\031\300!\000\010\006\0011\003\301R\031\300\200\000\010\004\0011\003\301R\031\300\200\000\010\006\0011\003\301R\031S'\000\010\004\0011\003\301R\031S'\000\010\006\0011\003\301R\031\272\000\010\004\0011\003\301R\031\272\000\010\006\0011\003\301R\031<:\000\010\004\0011\003\301R\031<:\000\010\006\001\300$\003\300\200\000\010\004\001\300$\003\300\200\000\010\006\001\300$\003<:\000\010\004\001\300$\003<:\000\010\006\001\300$\003S'\000\010\004\001\300$\003S'\000\010\006\001\300$\003\272\000\010\004\001\300$\003\272\000\010\006\001\306|\301J\000\010\004\001\306|\301J\000\010\006\001\306|\300\015\000\010\004\001\306|\300\015\000\010\006\001\300$\003\301\244\000\010\004\001\300$\003\301\244\000"},
+    {0x1F00,22,"\042\004\001\300s\003\300Z\000\042\004\001\300s\003\300E\000\042\004\001\300s\003\300Z\031\300\250\000\042\004\001\300s\003\300E\031\300\250\000\042\004\001\300s\003\300Z\031\300\246\000\042\004\001\300s\003\300E\031\300\246\000\042\004\001\300s\003\300Z\031\300\364\000\042\004\001\300s\003\300E\031\300\364\000\042\006\001\300s\003\300Z\000\042\006\001\300s\003\300E\000\042\006\001\300s\003\300Z\031\300\250\000\042\006\001\300s\003\300E\031\300\250\000\042\006\001\300s\003\300Z\031\300\246\000\042\006\001\300s\003\300E\031\300\246\000\042\006\001\300s\003\300Z\031\300\364\000\042\006\001\300s\003\300E\031\300\364\000\042\004\001\301-\003\300Z\000\042\004\001\301-\003\300E\000\042\004\001\301-\003\300Z\031\300\250\000\042\004\001\301-\003\300E\031\300\250\000\042\004\001\301-\003\300Z\031\300\246\000\042\004\001\301-\003\300E\031\300\246\000"},
+    {0x1F18,6,"\042\006\001\301-\003\300Z\000\042\006\001\301-\003\300E\000\042\006\001\301-\003\300Z\031\300\250\000\042\006\001\301-\003\300E\031\300\250\000\042\006\001\301-\003\300Z\031\300\246\000\042\006\001\301-\003\300E\031\300\246\000"},
+    {0x1F20,32,"\042\004\001\300\277\003\300Z\000\042\004\001\300\277\003\300E\000\042\004\001\300\277\003\300Z\031\300\250\000\042\004\001\300\277\003\300E\031\300\250\000\042\004\001\300\277\003\300Z\031\300\246\000\042\004\001\300\277\003\300E\031\300\246\000\042\004\001\300\277\003\300Z\031\300\364\000\042\004\001\300\277\003\300E\031\300\364\000\042\006\001\300\277\003\300Z\000\042\006\001\300\277\003\300E\000\042\006\001\300\277\003\300Z\031\300\250\000\042\006\001\300\277\003\300E\031\300\250\000\042\006\001\300\277\003\300Z\031\300\246\000\042\006\001\300\277\003\300E\031\300\246\000\042\006\001\300\277\003\300Z\031\300\364\000\042\006\001\300\277\003\300E\031\300\364\000\042\004\001\300\312\003\300Z\000\042\004\001\300\312\003\300E\000\042\004\001\300\312\003\300Z\031\300\250\000\042\004\001\300\312\003\300E\031\300\250\000\042\004\001\300\312\003\300Z\031\300\246\000\042\004\001\300\312\003\300E\031\300\246\000\042\004\001\300\312\003\300Z\031\300\364\000\042\004\001\300\312\003\300E\031\300\364\000\042\006\001\300\312\003\300Z\000\042\006\001\300\312\003\300E\000\042\006\001\300\312\003\300Z\031\300\250\000\042\006\001\300\312\003\300E\031\300\250\000\042\006\001\300\312\003\300Z\031\300\246\000\042\006\001\300\312\003\300E\031\300\246\000\042\006\001\300\312\003\300Z\031\300\364\000\042\006\001\300\312\003\300E\031\300\364\000"},
+    {0x1F40,6,"\042\004\001\301}\003\300Z\000\042\004\001\301}\003\300E\000\042\004\001\301}\003\300Z\031\300\250\000\042\004\001\301}\003\300E\031\300\250\000\042\004\001\301}\003\300Z\031\300\246\000\042\004\001\301}\003\300E\031\300\246\000"},
+    {0x1F48,6,"\042\006\001\301}\003\300Z\000\042\006\001\301}\003\300E\000\042\006\001\301}\003\300Z\031\300\250\000\042\006\001\301}\003\300E\031\300\250\000\042\006\001\301}\003\300Z\031\300\246\000\042\006\001\301}\003\300E\031\300\246\000"},
+    {0x1F50,8,"\042\004\001\300\356\003\300Z\000\042\004\001\300\356\003\300E\000\042\004\001\300\356\003\300Z\031\300\250\000\042\004\001\300\356\003\300E\031\300\250\000\042\004\001\300\356\003\300Z\031\300\246\000\042\004\001\300\356\003\300E\031\300\246\000\042\004\001\300\356\003\300Z\031\300\364\000\042\004\001\300\356\003\300E\031\300\364\000"},
+    {0x1F59,1,"\042\006\001\300\356\003\300E\000"},
+    {0x1F5B,1,"\042\006\001\300\356\003\300E\031\300\250\000"},
+    {0x1F5D,1,"\042\006\001\300\356\003\300E\031\300\246\000"},
+    {0x1F5F,31,"\042\006\001\300\356\003\300E\031\300\364\000\042\004\001\300n\003\300Z\000\042\004\001\300n\003\300E\000\042\004\001\300n\003\300Z\031\300\250\000\042\004\001\300n\003\300E\031\300\250\000\042\004\001\300n\003\300Z\031\300\246\000\042\004\001\300n\003\300E\031\300\246\000\042\004\001\300n\003\300Z\031\300\364\000\042\004\001\300n\003\300E\031\300\364\000\042\006\001\300n\003\300Z\000\042\006\001\300n\003\300E\000\042\006\001\300n\003\300Z\031\300\250\000\042\006\001\300n\003\300E\031\300\250\000\042\006\001\300n\003\300Z\031\300\246\000\042\006\001\300n\003\300E\031\300\246\000\042\006\001\300n\003\300Z\031\300\364\000\042\006\001\300n\003\300E\031\300\364\000\042\004\001\300s\003\300\250\000\042\004\001\300s\003\300\246\000\042\004\001\301-\003\300\250\000\042\004\001\301-\003\300\246\000\042\004\001\300\277\003\300\250\000\042\004\001\300\277\003\300\246\000\042\004\001\300\312\003\300\250\000\042\004\001\300\312\003\300\246\000\042\004\001\301}\003\300\250\000\042\004\001\301}\003\300\246\000\042\004\001\300\356\003\300\250\000\042\004\001\300\356\003\300\246\000\042\004\001\300n\003\300\250\000\042\004\001\300n\003\300\246\000"},
+    {0x1F80,32,"\042\004\001\300s\003\300Z\031\3015\000\042\004\001\300s\003\300E\031\3015\000\042\004\001\300s\003\300Z\031\300\250\031\3015\000\042\004\001\300s\003\300E\031\300\250\031\3015\000\042\004\001\300s\003\300Z\031\300\246\031\3015\000\042\004\001\300s\003\300E\031\300\246\031\3015\000\042\004\001\300s\003\300Z\031\300\364\031\3015\000\042\004\001\300s\003\300E\031\300\364\031\3015\000\042\006\001\300s\003\300Z\031\301\227\000\042\006\001\300s\003\300E\031\301\227\000\042\006\001\300s\003\300Z\031\300\250\031\301\227\000\042\006\001\300s\003\300E\031\300\250\031\301\227\000\042\006\001\300s\003\300Z\031\300\246\031\301\227\000\042\006\001\300s\003\300E\031\300\246\031\301\227\000\042\006\001\300s\003\300Z\031\300\364\031\301\227\000\042\006\001\300s\003\300E\031\300\364\031\301\227\000\042\004\001\300\277\003\300Z\031\3015\000\042\004\001\300\277\003\300E\031\3015\000\042\004\001\300\277\003\300Z\031\300\250\031\3015\000\042\004\001\300\277\003\300E\031\300\250\031\3015\000\042\004\001\300\277\003\300Z\031\300\246\031\3015\000\042\004\001\300\277\003\300E\031\300\246\031\3015\000\042\004\001\300\277\003\300Z\031\300\364\031\3015\000\042\004\001\300\277\003\300E\031\300\364\031\3015\000\042\006\001\300\277\003\300Z\031\301\227\000\042\006\001\300\277\003\300E\031\301\227\000\042\006\001\300\277\003\300Z\031\300\250\031\301\227\000\042\006\001\300\277\003\300E\031\300\250\031\301\227\000\042\006\001\300\277\003\300Z\031\300\246\031\301\227\000\042\006\001\300\277\003\300E\031\300\246\031\301\227\000\042\006\001\300\277\003\300Z\031\300\364\031\301\227\000\042\006\001\300\277\003\300E\031\300\364\031\301\227\000"},
+    {0x1FA0,21,"\042\004\001\300n\003\300Z\031\3015\000\042\004\001\300n\003\300E\031\3015\000\042\004\001\300n\003\300Z\031\300\250\031\3015\000\042\004\001\300n\003\300E\031\300\250\031\3015\000\042\004\001\300n\003\300Z\031\300\246\031\3015\000\042\004\001\300n\003\300E\031\300\246\031\3015\000\042\004\001\300n\003\300Z\031\300\364\031\3015\000\042\004\001\300n\003\300E\031\300\364\031\3015\000\042\006\001\300n\003\300Z\031\301\227\000\042\006\001\300n\003\300E\031\301\227\000\042\006\001\300n\003\300Z\031\300\250\031\301\227\000\042\006\001\300n\003\300E\031\300\250\031\301\227\000\042\006\001\300n\003\300Z\031\300\246\031\301\227\000\042\006\001\300n\003\300E\031\300\246\031\301\227\000\042\006\001\300n\003\300Z\031\300\364\031\301\227\000\042\006\001\300n\003\300E\031\300\364\031\301\227\000\042\004\001\300s\003\304\375\000\042\004\001\300s\003\300\213\000\042\004\001\300s\003\300\250\031\3015\000\042\004\001\300s\003\3015\000\042\004\001\300s\003\300\246\031\3015\000"},
+    {0x1FB6,15,"\042\004\001\300s\003\300\364\000\042\004\001\300s\003\300\364\031\3015\000\042\006\001\300s\003\304\375\000\042\006\001\300s\003\300\213\000\042\006\001\300s\003\300\250\000\042\006\001\300s\003\300\246\000\042\006\001\300s\003\301\227\000\042\310\004\000\042\301\227\000\042\300Z\000\042\300\364\000\042\302G\031\300\364\000\042\004\001\300\277\003\300\250\031\3015\000\042\004\001\300\277\003\3015\000\042\004\001\300\277\003\300\246\031\3015\000"},
+    {0x1FC6,14,"\042\004\001\300\277\003\300\364\000\042\004\001\300\277\003\300\364\031\3015\000\042\006\001\301-\003\300\250\000\042\006\001\301-\003\300\246\000\042\006\001\300\277\003\300\250\000\042\006\001\300\277\003\300\246\000\042\006\001\300\277\003\301\227\000\042\300Z\031\300\250\000\042\300Z\031\300\246\000\042\300Z\031\300\364\000\042\004\001\300\312\003\304\375\000\042\004\001\300\312\003\300\213\000\042\004\001\300\312\003\302G\031\300\250\000\042\004\001\300\312\003\302G\031\300\246\000"},
+    {0x1FD6,6,"\042\004\001\300\312\003\300\364\000\042\004\001\300\312\003\302G\031\300\364\000\042\006\001\300\312\003\304\375\000\042\006\001\300\312\003\300\213\000\042\006\001\300\312\003\300\250\000\042\006\001\300\312\003\300\246\000"},
+    {0x1FDD,19,"\042\300E\031\300\250\000\042\300E\031\300\246\000\042\300E\031\300\364\000\042\004\001\300\356\003\304\375\000\042\004\001\300\356\003\300\213\000\042\004\001\300\356\003\302G\031\300\250\000\042\004\001\300\356\003\302G\031\300\246\000\042\004\001\301\230\003\300Z\000\042\004\001\301\230\003\300E\000\042\004\001\300\356\003\300\364\000\042\004\001\300\356\003\302G\031\300\364\000\042\006\001\300\356\003\304\375\000\042\006\001\300\356\003\300\213\000\042\006\001\300\356\003\300\250\000\042\006\001\300\356\003\300\246\000\042\006\001\301\230\003\300E\000\042\302G\031\300\250\000\042\302G\031\300\246\000\042\300\250\000"},
+    {0x1FF2,3,"\042\004\001\300n\003\300\250\031\3015\000\042\004\001\300n\003\3015\000\042\004\001\300n\003\300\246\031\3015\000"},
+    {0x1FF6,9,"\042\004\001\300n\003\300\364\000\042\004\001\300n\003\300\364\031\3015\000\042\006\001\301}\003\300\250\000\042\006\001\301}\003\300\246\000\042\006\001\300n\003\300\250\000\042\006\001\300n\003\300\246\000\042\006\001\300n\003\301\227\000\042\300\246\000\042\300E\000"},
+    {0x2000,32,"\300\276\301\310\000\302,\301\310\000\300\276\301\364\000\302,\301\364\000\356K\301\364\000\335\022\301\364\000\354p\301\364\000\303\310\301\364\000\300\006\301\364\000\306\366\301\364\000\3045\301\364\000\300%\303,\301\364\000\300%\303,\346\026\000\300%\303,\3048\000\305d+\000\306\310+\000\302\346\000\346\025\302\346\000\303\310\301\025\000\300\276\301\025\000\302,\301\025\000\255x\0004T\300\201\0004\210\300\201\000(\300N\301\177+\000&\300N\301\177+\000\300N\314O\301\177+\000\300N\313\246\301\177+\000(4\301\177+\000&4\301\177+\0004\314O\301\177+\0004\313\246\301\177+\000"},
+    {0x2020,32,"\304 \0004\304 \000\302\227\000\301\366\302\227\0002<\310\020\0007<\310\020\000\255\303\304\000\313\300\301\252\000\300\201\301\270\000\305\207\301\270\000\305d\313-\000\306\310\313-\000\310\221\312\371\335\014\000\305d\3153\000\306\310\3153\000\304\307\310^\301\364\000\305\214\314\256\002\000\305\214\300H\254\002\000\302\364\0004\302\364\000\300\262\302\364\000\300:\302\364\000\300:4\302\364\000\300:\300\262\302\364\000\3038\000\300N\302\016\300\236\301\177+\000\300N\301\325\300\236\301\177+\000\351Q+\0004\301\257+\000\305P\000\303\355\000\316\323\000"},
+    {0x2040,32,"\300\034\304\362\000\3038\307\342\301\252\000\322\345\000\302\346\302\227\000\300\016\302j\000(,\202\003\306\265\000&,\202\003\306\265\0004\301\216+\000\301\216\301\257+\000\301\257\301\216+\000\316\211\002\302\273\000\300:\315c\002\0008n\302\227\0008\134\302\227\000\210\300\367\000\300:\302\366\000\307ab\0007\322\344\322o\304\024\000\305 \302\002\002\000\355j\301\025\000\300\221\316\323\000\305:\300\006+\000B<\300\006\000\303\036\302\364\000O<\300\006\000V<\300\006\0007<\300\006\000O<+\000\301\016\300\323\000\316\243\000TO\214\000\270\015\301\364\000"},
+    {0x2060,5,"\301\344\3048\000\313]\322\255\000\307\344\027\000\307\344\301\270\000\307\344a\000"},
+    {0x2066,12,"\305d\306I\000\306\310\306I\000\303\205\316:\306I\000\310\221\312\371\306I\000\313\321\316c\316H\000\312\016\316c\316H\000\313\321\011\020\315\354\000\312\016\011\020\315\354\000\314\322\017\315\353\000\346\022\017\315\353\000\301\232\300%\000\301\232\010\004\001;\000"},
+    {0x2074,27,"\301\232O\000\301\232V\000\301\232v\000\301\232\201\000\301\232u\000\301\232\211\000\301\232a\002\000\301\232\302\002\000\301\232\301@\002\000\301\232(\300\371\000\301\232&\300\371\000\301\232\010\004\001\232\000\301'\300%\000\301'2\000\301'7\000\301'B\000\301'O\000\301'V\000\301'v\000\301'\201\000\301'u\000\301'\211\000\301'a\002\000\301'\302\002\000\301'\301@\002\000\301'(\300\371\000\301'&\300\371\000"},
+    {0x2090,13,"\010\301'\004\001\025\000\010\301'\004\0019\000\010\301'\004\0016\000\010\301'\004\001\300>\000\010\301'\004\001\303\042\000\010\301'\004\001\300\026\000\010\301'\004\001\300\011\000\010\301'\004\001p\000\010\301'\004\001\261\000\010\301'\004\001\232\000\010\301'\004\001\300<\000\010\301'\004\001d\000\010\301'\004\001\300\007\000"},
+    {0x20A0,32,"\334J\002\000\301^\002\000\331T\002\000\313Z\335\030\002\000\314G\002\000\344A\002\000\344\373\002\000\347\344\002\000\303\366\002\000\311D\002\000\3007\354\006\002\000\313\003\002\000\313\077\002\000\314\007\002\000\357\021\002\000\307\223\002\000\335\237\347\331\002\000\315S\002\000\336\027\002\000\322\377\002\000\337e\002\000\325\023\002\000\342x\356\245\002\000\354\271\002\000\356\034\002\000\340*\303\366\002\000\357\035\314G\002\000\346\033+\002\000\343\225\002\000\351\337\002\000\342\035\002\000\324Y\002\000"},
+    {0x20C0,1,"\316!\002\000"},
+    {0x20D0,32," (\300\233'\000 &\300\233'\000 \253T\300\201\301\336\000 \300wT\300\201\301\336\000 \301\373\034'\000 \302[\034'\000 (\034'\000 &\034'\000 \240\301\336\000 \302[\240\301\336\000 \301\373\240\301\336\000 B\214'\000 O\214'\000 \304)y\000 \304),\000 \304)\300\360\000 \304)y\304\033\000 (&\034'\000 \304)\305\242\000 \304)\313\373\000 \304)\316\330\300]\260\000 \302\003\301\327\301\336\000 4TI\301\336\000 \322\232\014\000 \300\262\357\244\000 \302\376\304}'\000 n\034\301\336\000 \2534\301\327\301\336\000 \134\300\233\003\273\267\000 n\300\233\003\273\267\000 (\034:\000 &\034:\000"},
+    {0x20F0,1," \300\367'\000"},
+    {0x2100,32,"\312\014K\000\3225C\301\011\355B\000\300\025\006\3005\000\306\001\325\030\000\300\222\300\201\014\000\324\355K\000\324\325\357\235\000\334I\307k\000\352\202\000\306\001\334\257\000\236\004\300\003\000\236\006\300\026\000\305\025\006\300\026\000\300\025\006\300\026\000\315l\307k\000\315l\307k\2237\300\325\000\236\006;\000\305\025\006;\000\236\006p\000\236\004p\000p\077x\014\000\300\025\006\232\000\346|\002\000\302S\351N\312\273\000\236\006\300<\000\300\025\006\300<\000\300\025\006\300\260\000\236\006c\000\305\025\006c\000\300\025\006c\000\350e\355\343\000\315\252\000"},
+    {0x2120,32,"\353\242+\000\302\372\002\000\356\254+\002\000\3608\000\300\025\006\300 \000\3150\002\000\306\225\002\000\300\221\306\225\002\000\305\025\006\300 \000\241\042\004\001\300\312\000\340\374\002\000\322\215\002\000\236\006\077\000\305\025\006\3005\000\334>\014\000\236\0049\000\236\0069\000\236\006\300u\000\241\006\300u\000\236\006\261\000\236\0046\000w\014\000\304y\014\000\302]\014\000\305\375\014\000\307\337\310\342\000\300\235\006\300\260\000\334\255\002\000\300\025\004\300\325\000\300\025\004\301\352\000\300\025\006\301\352\000\300\025\006\300\325\000"},
+    {0x2140,32,"\300\025\302N\305\256\000\2410\006\300\003\000\2410\006p\000\300:0\006p\000\2410\006\300$\000\300\025-\006\300\024\000\300\025-\004\300\024\000\300\025-\0049\000\300\025-\004;\000\300\025-\004\300U\000\350v\300\201\000\241\303\262\000\305\214\002\000\322b\000\241\004\300u\000\014)\300\247\310\342\000\302)\300\0162\353\251\000\302)\300\0162\345\273\000\302)\300\0162\311\011\000\302)\300\0162\302\321\000\302)\300\0167\303\246\000\302)\300\0162\307\252\000\302)\300\0167\307\253\000\302)\300\016B\307\253\000\302)\300\016O\307\253\000\302)\300\0162\310\327\000\302)\300\016V\316\020\000\302)\300\0162\301,\000\302)\300\016B\302v\000\302)\300\016V\302v\000\302)\300\016\201\302v\000\300\016\304\3142\000"},
+    {0x2160,32,"\300\326\300\1342\000\300\326\300\1347\000\300\326\300\134B\000\300\326\300\134O\000\300\326\300\134V\000\300\326\300\134v\000\300\326\300\134\201\000\300\326\300\134u\000\300\326\300\134\211\000\300\326\300\134\300H\000\300\326\300\134\302\340\000\300\326\300\134\302\220\000\300\326\300\134\301H\000\300\326\300\1342\207\000\300\326\300\134V\207\000\300\326\300\1342\254\000\004\300\326\300\1342\000\004\300\326\300\1347\000\004\300\326\300\134B\000\004\300\326\300\134O\000\004\300\326\300\134V\000\004\300\326\300\134v\000\004\300\326\300\134\201\000\004\300\326\300\134u\000\004\300\326\300\134\211\000\004\300\326\300\134\300H\000\004\300\326\300\134\302\340\000\004\300\326\300\134\302\220\000\004\300\326\300\134\301H\000\004\300\326\300\1342\207\000\004\300\326\300\134V\207\000\004\300\326\300\1342\254\000"},
+    {0x2180,12,"\300\326\300\1342\254\3005\300\024\000\300\326\300\134V\254\000\300\326\300\134\300H\254\000\300\326\300\134\300:2\207\000\010\004\001\300:\3005\000\300\326\300\134v\342 \020\000\300\326\300\134\301H\333\367\020\000\300\326\300\134\301H\254\000\300\326\300\1342\207\254\000\302)\300\016\300%\303\246\000\241\0177\000\241\017B\000"},
+    {0x2190,32,"n\034\000\277\034\000\134\034\000\267\034\000(&\034\000bt\034\000\275\300\310\034\000\275\300\237\034\000\3004\300\237\034\000\3004\300\310\034\000n\034\003I\000\134\034\003I\000n\301\134\034\000\134\301\134\034\000n7\306:\034\000\2777\306:\034\000\1347\306:\034\000\2677\306:\034\000n\034\003\300\253\000\134\034\003\300\253\000n\034\301Ax\000\277\034\301Ax\000\134\034\301Ax\000\267\034\301Ax\000bt\034\003\305\343\000n\034\003S\000\134\034\003S\000n\034\003\301\244\000\134\034\003\301\244\000(&\301\134\034\000(&\034\003I\000\267\303\003\034\000"},
+    {0x21B0,32,"\277\034\003\302\005n\000\277\034\003\302\005\134\000\267\034\003\302\005n\000\267\034\003\302\005\134\000\134\034\003\3018\267\000\267\034\003\3018n\000\301\373\300\365\305\244\034\000\302[\300\365\305\244\034\000\275\300\310\034C\253x\000n\034Cx\223\134\034Cx\000\301\373\262y\034\000\302[\262y\034\000n\300\233\003\273\277\000n\300\233\003\273\267\000\277\300\233\003\273\134\000\277\300\233\003\273n\000\134\300\233\003\273\277\000\134\300\233\003\273\267\000\267\300\233\003\273\134\000\267\300\233\003\273n\000\134\034\223n\034\000\277\034nK\267\034\000n\034\223\134\034\000n\303\356\302C\000\277\303\356\302C\000\134\303\356\302C\000\267\303\356\302C\000n\300\233\223\134\300\233\000\134\300\233\223n\300\233\000n4\034\003I\000(&4\034\003I\000\1344\034\003I\000"},
+    {0x21D0,32,"n4\034\000\2774\034\000\1344\034\000\2674\034\000(&4\034\000bt4\034\000\275\300\3104\034\000\275\300\2374\034\000\3004\300\2374\034\000\3004\300\3104\034\000n\300\262\034\000\134\300\262\034\000n\306\350\034\000\134\306\350\034\000\277\034\0034I\000\267\034\0034I\000n\302\267\034\000\277\302\267\034\000\134\302\267\034\000\267\302\267\034\000n\034Cx\000\134\034Cx\000n@\034\000\277@\034\000\134@\034\000\267@\034\000\277@\034\301Ax\000\277@\034\300\216\306\241\000\277@\034\300\216\306\241\003\255x\000\277@\034\300\216\306\241\003Tx\000\277@4\034\000\277@4\034\300\216\306\241\000"},
+    {0x21F0,32,"\134@\034\301A\302@\000\275\300\310\034C\3018\000\3004\300\237\034C\3018\000bt@\034\000&\034\003\004y\000\267\034nK\277\034\000B\134\302C\000n\034\003TI\000\134\034\003TI\000(&\034\003TI\000n\034\0034TI\000\134\034\0034TI\000(&\034\0034TI\000n\310o\034\000\134\310o\034\000(&\310o\034\000)\305\012\000\326\024\000\304\321\304\212\000\316}\334V\000\316}\302\336\300\224\334U\000\302x\303\240\000\340)\000\304\306\000\302\272K\000\300\224\3016\302\272K\000\004\302\272K\000\303{\302\225\306z\000\302\336\300\224\307m\302\225\306z\000\004\303{\302\225\306z\000\301lK\350u\000\302N\302\311\000"},
+    {0x2210,32,"\302N\312\272\000\302N\305\256\000\302\002\002\000\344H\002\000<a\000\303\300\302j\000\303\240\302\002\000\300\367\300\362\000\240\300\362\000\302\227\300\362\000,\305\240\000\307w\305\240\000\306*\305\240\000\350wC\000\304\254\000&\300\236\000\300\236\000\302\355\300\236\000\310\344\300\236\000\332r\000\302\336\300\224\307\215\000\303XC\000\300\224\303XC\000\301\206\031\000\301\206\300\037\000\3024\000\302\025\000\301\301\0004\301\301\000\300\262\301\301\000\307n\301\301\000\310\372\301\301\000"},
+    {0x2230,32,"\360\226\301\301\000\302[\301\301\000\302[\307n\301\301\000\301\373\307n\301\301\000\3563\000\324(\000\351<\000\315}\000<\302\002\000\334P\000\335\235\315}\000\313\264\000\272\300\362\000\300:\272\000\300\221\310\017d\000\354]\301\134\000\361.\302\311\000\300\224\272\000\302\002\272\000\312=\245C\000\300\224\312=\245C\000\304s\245C\000\304s\3037\300\224\312\017\245C\000\303\225\304s\302\243\312\017\245C\000\302X\245C\000\300\224\302X\245C\000\302X\245\300\037\245C\000\300\262\272\000\305\012\245C\000\302yC\000\313s\302yC\000\332P\301\254\000"},
+    {0x2250,32,"\322\257\301\011\342f\000\313s\245C\000\304s\245C\300\037\301\011\303\216K\000\303\216K\300\037\304s\245C\000\301^\301@\000\301@\301^\000\240\300\241\245C\000\240\245C\000\331=C\000\334\077\000\3342C\000\300\261\301@\000\302\012\245C\000\245C\302\333\332\027\000\302\355\302\333\000\350\333\245C\000\300\224\245C\000\306DC\000\300\224\306DC\000\355 \302yC\000\300\257\300\037\245C\000\300\256\300\037\245C\000\300\257\223\245C\000\300\256\223\245C\000\300\257\3037\300\224\245C\000\300\256\3037\300\224\245C\000\305n\300\257\000\305n\300\256\000\301\254\000\300\224\302yC\000\300\224\300\257\000\300\224\300\256\000"},
+    {0x2270,32,"\303\225\300\257\302\243\245C\000\303\225\300\256\302\243\245C\000\300\257\300\037\302yC\000\300\256\300\037\302yC\000\303\225\300\257\302\243\302yC\000\303\225\300\256\302\243\302yC\000\300\257\300\037\300\256\000\300\256\300\037\300\257\000\303\225\300\257\302\243\300\256\000\303\225\300\256\302\243\300\257\000\302\310\000\302\320\000\302\310\300\037\245C\000\302\320\300\037\245C\000\302\310\300\037\302yC\000\302\320\300\037\302yC\000\302\336\300\224\315v\000\302\336\300\224\316>\000\301\274K\000\301\275K\000\300\224\025\301\274K\000\300\224\025\301\275K\000\301\274K\300\037\245C\000\301\275K\300\037\245C\000\303\225\025\301\274K\302\243\245C\000\303\225\025\301\275K\302\243\245C\000\301\274K\003\300\224\245C\000\301\275K\003\300\224\245C\000\310A\000\310A\302\302\000\310A\302\025\000,\303\216K\000"},
+    {0x2290,32,",\305\202K\000,\303\216K\300\037\245C\000,\305\202K\300\037\245C\000,\305\356\000,\305#\000.a\000.\302\002\000.\027\000.\303\300\302j\000.<\300\362\000.\240\300\362\000.\300\367\300\362\000.\301@\000.\301\025\000fa\000f\302\002\000f\027\000f<\300\362\000&\301O\000(\301O\000t\301O\000b\301O\000\322\342\000\344\134\000\311'\000\335\012\000\300\262Tx&\304\022\0004Tx4&\304\022\000\302\336\300\224\350z\000\300\224\311'\000\302\336\300\224\335\011\000\314\3314Tx4&\304\022\000"},
+    {0x22B0,32,"\302\310\303j\306\276\000\302\320\303j\306\276\000\303U\304\001K\000\303{\302\225\303U\304\001\000\303U\304\001K\300\037\245C\000\303{\302\225\303U\304\001\300\037\245C\000\305\202K\000\303\216K\000\310@\000\336\226\331#\343\271\000\3407\000\361a\000\344\375\000\302\243\000&\300\236\003\302\006\000&\260\000\302N\301\206\031\000\302N\301\206\300\037\000\302N\3024\000\302N\302\025\000\300\360\300\362\000<\300\362\000\300\261\300\362\000\303\300\027\000\305\351\000(\303U\307\244\305\245\302\311\000&\303U\307\244\305\245\302\311\000(\305\245\302\311\000&\305\245\302\311\000\300:\272\301@\000\301\077\301\206\300\037\000\301\077\301\206\031\000"},
+    {0x22D0,32,"4\301\274\0004\301\275\0004\3024\0004\302\025\000\315j\000\245\031\303XC\000\300\257\003<\000\300\256\003<\000\301u\305n\300\257\000\301u\305n\300\256\000\300\257\245C\300\037\300\256\000\300\256\245C\300\037\300\257\000\245C\300\037\300\257\000\245C\300\037\300\256\000\245C\300\037\302\310\000\245C\300\037\302\320\000\302\336\300\224\315v\300\037\245\000\302\336\300\224\316>\300\037\245\000\300\224,\303\216K\300\037\245C\000\300\224,\305\202K\300\037\245C\000,\303\216K\300\037\300\224\245C\000,\305\202K\300\037\300\224\245C\000\300\257\3037\300\224\302yC\000\300\256\3037\300\224\302yC\000\302\310\3037\300\224\302yC\000\302\320\3037\300\224\302yC\000\300\224\303U\304\001K\000\302\336\300\224\307m\302\225\303U\304\001\000\300\224\303U\304\001K\300\037\245C\000\302\336\300\224\307m\302\225\303U\304\001\300\037\245\000T\303\304\000\314\250\255\303\304\000"},
+    {0x22F0,32,"b&\274\303\304\000t&\274\303\304\000\302\272K\003\253\255I\000\302\272K\003Tx\301\234\301lK\255I\000\004\302\272K\003Tx\301\234\301lK\255I\000\302\272K\003<'\000\302\272K\003\302\304\000\004\302\272K\003\302\304\000\302\272K\003\301\314\000\302\272K\0037\255\310\364\000\303{\003\253\255I\000\303{\003Tx\301\234\301lK\255I\000\004\303{\003Tx\301\234\301lK\255I\000\303{\003\302\304\000\004\303{\003\302\304\000\300 \300Y\305\337\343\341\000\332I\002\000\306\026\034\000\304\252\000b\300a\000t\300a\000\350s\000\347\341\000\303+\300\201\000(\302E\000&\302E\000(\302.\000&\302.\000\3017&\305\372\000\3017(\305\372\000\300\365&\305\372\000\300\365(\305\372\000"},
+    {0x2310,32,"\300:\300\224\002\000,\302\275\000\302\006\000\310\300\000\352\216\000\302\372\351M\000\304\325\301Y\000\360z,\000\304KK\3408\002\000\241\300\224\002\000\316\360\000\306\077\000\300\365(\3018\000\300\365&\3018\000\3017(\3018\000\3017&\3018\000\300\365o\301\301\000\3017o\301\301\000\306,\000\305\251\000b\300a\301\2547\255\305\021\000\347M\303\221\000\3136C\301\011&\000\300>\300\241\025\303\232e\000\305[\000\302\016\300\236\202\000\301\325\300\236\202\000\3136C\301\011(\000\312`\240\000\331i\000\305\012\322\311\000\355\211\000"},
+    {0x2330,32,"\316\226\351\351\000\332W\347Q\000\331\042\355\357\000\354\210\000\331@\000\331A\000\300~\300\177\014\337\247\000\300~\300\177\014\354\317\301\310\000\300~\300\177\014\301\310\245\000\300~\300\177\014\301\310\307\215\000\300~\300\177\014\301\310\300\360\000\300~\300\177\014\301\310\303\324\000\300~\300\177\014\301\310y\000\300~\300\177\014y\304\350\000\300~\300\177\014y\303\324\000\300~\300\177\014\302jx\000\300~\300\177\014\304\033x\000\300~\300\177\014\301\310\302j\000\300~\300\177\014\301\310\304\033\000\300~\300\177\014\301\310\300\257\000\300~\300\177\014\301\310\300\256\000\300~\300\177\014n\307\020\000\300~\300\177\014\134\307\020\000\300~\300\177\014\301\310n\034\000\300~\300\177\014\301\310\134\034\000\300~\300\177\014y\304\033\000\300~\300\177\014t\301O\301\314\000\300~\300\177\014\302\012\304\350\000\300~\300\177\014\301\310t\3038\000\300~\300\177\014\301\310\302\012\000\300~\300\177\014t\301O\303\324\000\300~\300\177\014\277\307\020\000"},
+    {0x2350,32,"\300~\300\177\014\301\310\277\034\000\300~\300\177\014b\301O\302\304\000\300~\300\177\014\306\002\304\350\000\300~\300\177\014\301\310b\3038\000\300~\300\177\014\301\310\306\002\000\300~\300\177\014b\301O\303\324\000\300~\300\177\014\267\307\020\000\300~\300\177\014\301\310\267\034\000\300~\300\177\014\315\217\301\314\000\300~\300\177\014\302\012\301\314\000\300~\300\177\014\300\360\301\314\000\300~\300\177\014\303\324\301\314\000\300~\300\177\014y\301\314\000\300~\300\177\014b\304S\303\324\000\300~\300\177\014\315\217\301\310\000\300~\300\177\014y\300\261\000\300~\300\177\014\301\310\301^\000\300~\300\177\014b\301O\300b\000\300~\300\177\014\306\002\300b\000\300~\300\177\014\300\261\300b\000\300~\300\177\014\303\324\300b\000\300~\300\177\014y\300b\000\300~\300\177\014t\304S\304\350\000\300~\300\177\014(\304S\304\350\000\300~\300\177\014\272\300b\000\300~\300\177\014\300\256\300b\000\300~\300\177\014\300\251x\000\300~\300\177\014\306\002\272\000\300~\300\177\014\362j\000\300~\300\177\014\304\350\272\000\300~\300\177\014\302\366\301\314\000\300~\300\177\014\301\310\300\224\245\000"},
+    {0x2370,32,"\300~\300\177\014\301\310\301\216\000\300~\300\177\014t\3038\272\000\300~\300\177\014b\3038\272\000\300~\300\177\014\300\312\000\300~\300\177\014\301\230\000\300~\300\177\014\300n\000\300~\300\177\014\300s\301\314\000\300~\300\177\014\301-\301\314\000\300~\300\177\014\300\312\301\314\000\300~\300\177\014\300n\301\314\000\300~\300\177\014\300s\000\300\224\302\231+\000&\300\236\003\267\303\003\034\000\354)\262e\000\304\036\014\000T\300\201\003M<\000\307\342\014\000\331*\316\322\014\000\332e\316\322\014\000\313/\014\000\307h\014\000@,\003\300\222T\300\201\000\3133\014\000\307+\303\221\014\000\336\220\014\000.\255x\003\314\376\000.\260t\000\304~y\003\346\035\034\000\357\245\014\000\344s\014\000\337\230\014\000\315)\3367\014\000"},
+    {0x2390,32,"\315)\341\307\014\000\347\271\014\000\347\272\014\000\307\214\307x\014\0207\000\354\237\014\000\300~\300\177\014\301\310\000\307\205\301\270\303\221\014\000\350i\303W\000\345Y\303W\000\315y\305\242\014\000\325\214\305\242\014\000(\300\371sS\000(\300\371\303\307\000(\300\371lS\000&\300\371sS\000&\300\371\303\307\000&\300\371lS\000(,\202s\3018\000(,\202\303\307\000(,\202l\3018\000&,\202s\3018\000&,\202\303\307\000&,\202l\3018\000(\301\077\202sS\000(\301\077\202M\303\361\000(\301\077\202lS\000\301\077\202\303\307\000&\301\077\202sS\000&\301\077\202M\303\361\000&\301\077\202lS\000\301\301\303\307\000\255\300\201\303\307\000"},
+    {0x23B0,32,"s(\300\037l&\301\077\202\3013\000s&\300\037l(\301\077\202\3013\000\305\256\300\365\000\305\256\3017\000\300\365,\202\000\3017,\202\000\3017,\202\223\300\365,\202\000/\014\3017\000(Te\300\201\000&Te\300\201\000\255\306\320\342k\000\255\306\320\342l\000\255\306\320\342m\000\255\306\320\342n\000\302u\014{T\031\300\365&\000\302u\014{T\031\3017&\000\302u\014{T\003y\000\302u\014{t\031\255\003y\000\302u\014{b\031\255\003y\000\302u\014{T\003\260\000\302u\014{t\031\255\003\260\000\302u\014{b\031\255\003\260\000\302u\014{T\031\301\134\000\302u\014{t\031\255\003\301\134\000\302u\014{b\031\255\003\301\134\000\302u\014{t\031\255\000\302u\014{b\031\255\000\302u\014{T\031\300\365(\000\302u\014{T\031\3017(\000,\306'\000\305\235\014\000\334\011\014\000"},
+    {0x23D0,32,"T\300\201\303\307\000\303\223\300\270\000\303\223\253\223\300w\000\303\223\300w\223\253\000\303\223\253\2237\306\334\000\303\2237\306\334\223\253\000\303\2237\306\334\305U\000\303\223\316\245\000\303\223\316w\000\303\223\315K\000\302\134\313\211\000\335&\000\300\365\300\371\000\3017\300\371\000\300\365\301\077\202\000\3017\301\077\202\000\300\365\301\276\301g\202\000\3017\301\276\301g\202\000@\356\262\000\312`\240\003y\000\355\027\000\334\364\000\305\321\307x\000\334\017\3024\000\307\205\334X\014\0008\301\3254\260\0008\302\0164\260\0008\302V4\260\0008\302\2704\260\0008\301\3254\260\003Tx\0008\302\0164\260\003Tx\0008\301\325\260\0034Tx\000"},
+    {0x23F0,32,"\322g\301\235\000\355\023\000\356n\301\235\000\306\077\003\334\372\352`\0008\270\302\016\260\0008\270\301\325\260\0008\270\302V\260\0008\270\302\270\260\0004Tx\0008,)\300k\0008y)\315\241\000\304\326\014\000\304\326\3478\014\000\304\326\300\216\014\000\304\326\354\201\014\000\347&\303D\014\000\014)\315\012\000\014)\305\253K\336\202\000\014)\305\253K\303\244\000\014)\301lK\303\244\000\014)\301lK\316\234\000\014)\334$\000\014)\312\015\000\014)\304\036\000\014)\323\335\000\014)\255\316f\000\014)\300\201\307\247\000\014)T\316f\000\014)\020\307\247\000\014)\324\360\305\235\000\014)\315\361\302b\000\014)\315\361\300\241\000"},
+    {0x2410,23,"\014)\331\347\314E\313:\000\014)\306\004\304\2042\000\014)\306\004\304\2047\000\014)\306\004\304\204B\000\014)\306\004\304\204O\000\014)\300\020\312\015\000\014)\355\214\337\373\000\014)\301lK\316\234r\000\014)\312\224\000\014)\301lK\270\000\014)\316=\000\014)\313:\000\014)\3056\301\270\000\014)\313\212\301\270\000\014)\315\241\301\270\000\014)\302\373\301\270\000\014)\301\364\000\014)\312\353\000\312m\014\000\262e\000\014)\310Q\000\014)\312\353\0207\000\014)\316=\0207\000"},
+    {0x2440,11,"\303\034S\000\303\034\312\245\000\303\034\306(\000\303\034\300\221\306(\000\303\034\303\006\324\220\000\303\034\304|\304\362\000\303\034\307J\307>\313\305\000\303\034\322\177K\302\231\000\303\034\301\025\000\303\034\331b\312\014\036\000\303\0344\304\033\000"},
+    {0x2460,32,".\0172\000.\0177\000.\017B\000.\017O\000.\017V\000.\017v\000.\017\201\000.\017u\000.\017\211\000.\036\300H\000.\036\302\340\000.\036\302\220\000.\036\304\012\000.\036\303\312\000.\036\303\015\000.\036\303`\000.\036\303\371\000.\036\303\200\000.\036\303\347\000.\036\300\351\000\204\0172\000\204\0177\000\204\017B\000\204\017O\000\204\017V\000\204\017v\000\204\017\201\000\204\017u\000\204\017\211\000\204\036\300H\000\204\036\302\340\000\204\036\302\220\000"},
+    {0x2480,32,"\204\036\304\012\000\204\036\303\312\000\204\036\303\015\000\204\036\303`\000\204\036\303\371\000\204\036\303\200\000\204\036\303\347\000\204\036\300\351\000\0172\300\324\300k\000\0177\300\324\300k\000\017B\300\324\300k\000\017O\300\324\300k\000\017V\300\324\300k\000\017v\300\324\300k\000\017\201\300\324\300k\000\017u\300\324\300k\000\017\211\300\324\300k\000\036\300H\300\324\300k\000\036\302\340\300\324\300k\000\036\302\220\300\324\300k\000\036\304\012\300\324\300k\000\036\303\312\300\324\300k\000\036\303\015\300\324\300k\000\036\303`\300\324\300k\000\036\303\371\300\324\300k\000\036\303\200\300\324\300k\000\036\303\347\300\324\300k\000\036\300\351\300\324\300k\000\204\010\004\001\025\000\204\010\004\001\077\000\204\010\004\001\3005\000\204\010\004\001\300\024\000"},
+    {0x24A0,32,"\204\010\004\0019\000\204\010\004\001\300u\000\204\010\004\001\300\003\000\204\010\004\001\300\026\000\204\010\004\001;\000\204\010\004\001\300U\000\204\010\004\001\300\011\000\204\010\004\001p\000\204\010\004\001\261\000\204\010\004\001\232\000\204\010\004\0016\000\204\010\004\001\300<\000\204\010\004\001\300\260\000\204\010\004\001c\000\204\010\004\001d\000\204\010\004\001\300\007\000\204\010\004\0011\000\204\010\004\001\300\015\000\204\010\004\001\300P\000\204\010\004\001\300>\000\204\010\004\001\300$\000\204\010\004\001\300 \000.\010\006\001\025\000.\010\006\001\077\000.\010\006\001\3005\000.\010\006\001\300\024\000.\010\006\0019\000.\010\006\001\300u\000.\010\006\001\300\003\000.\010\006\001\300\026\000.\010\006\001;\000.\010\006\001\300U\000"},
+    {0x24C0,32,".\010\006\001\300\011\000.\010\006\001p\000.\010\006\001\261\000.\010\006\001\232\000.\010\006\0016\000.\010\006\001\300<\000.\010\006\001\300\260\000.\010\006\001c\000.\010\006\001d\000.\010\006\001\300\007\000.\010\006\0011\000.\010\006\001\300\015\000.\010\006\001\300P\000.\010\006\001\300>\000.\010\006\001\300$\000.\010\006\001\300 \000.\010\004\001\025\000.\010\004\001\077\000.\010\004\001\3005\000.\010\004\001\300\024\000.\010\004\0019\000.\010\004\001\300u\000.\010\004\001\300\003\000.\010\004\001\300\026\000.\010\004\001;\000.\010\004\001\300U\000.\010\004\001\300\011\000.\010\004\001p\000.\010\004\001\261\000.\010\004\001\232\000.\010\004\0016\000.\010\004\001\300<\000"},
+    {0x24E0,32,".\010\004\001\300\260\000.\010\004\001c\000.\010\004\001d\000.\010\004\001\300\007\000.\010\004\0011\000.\010\004\001\300\015\000.\010\004\001\300P\000.\010\004\001\300>\000.\010\004\001\300$\000.\010\004\001\300 \000.\017\300%\000\300\020.\036\302\340\000\300\020.\036\302\220\000\300\020.\036\304\012\000\300\020.\036\303\312\000\300\020.\036\303\015\000\300\020.\036\303`\000\300\020.\036\303\371\000\300\020.\036\303\200\000\300\020.\036\303\347\000\300\020.\036\300\351\0004.\0172\0004.\0177\0004.\017B\0004.\017O\0004.\017V\0004.\017v\0004.\017\201\0004.\017u\0004.\017\211\0004.\036\300H\000\300\020.\017\300%\000"},
+    {0x2500,32,"e\177{\255\000e\177L\255\000e\177{T\000e\177LT\000e\177{\300\262\301\025\255\000e\177L\300\262\301\025\255\000e\177{\300\262\301\025T\000e\177L\300\262\301\025T\000e\177{\303\036\301\025\255\000e\177L\303\036\301\025\255\000e\177{\303\036\301\025T\000e\177L\303\036\301\025T\000e\177{t\031&\000e\177t{\031&L\000e\177tL\031&{\000e\177Lt\031&\000e\177{t\031(\000e\177t{\031(L\000e\177tL\031({\000e\177Lt\031(\000e\177{b\031&\000e\177b{\031&L\000e\177bL\031&{\000e\177Lb\031&\000e\177{b\031(\000e\177b{\031(L\000e\177bL\031({\000e\177Lb\031(\000e\177{T\031&\000e\177T{\031&L\000e\177bL\031&t{\000e\177tL\031&b{\000"},
+    {0x2520,32,"e\177TL\031&{\000e\177t{\031&bL\000e\177b{\031&tL\000e\177LT\031&\000e\177{T\031(\000e\177T{\031(L\000e\177bL\031(t{\000e\177tL\031(b{\000e\177TL\031({\000e\177t{\031(bL\000e\177b{\031(tL\000e\177LT\031(\000e\177{t\031\255\000e\177(L\031&t{\000e\177&L\031(t{\000e\177t{\031\255L\000e\177tL\031\255{\000e\177&{\031(tL\000e\177({\031&tL\000e\177Lt\031\255\000e\177{b\031\255\000e\177(L\031&b{\000e\177&L\031(b{\000e\177b{\031\255L\000e\177bL\031\255{\000e\177&{\031(bL\000e\177({\031&bL\000e\177Lb\031\255\000e\177{T\031\255\000e\177(L\031&T{\000e\177&L\031(T{\000e\177T{\031\255L\000"},
+    {0x2540,32,"e\177bL\031t\255{\000e\177tL\031b\255{\000e\177TL\031\255{\000e\177(bL\031&t{\000e\177&bL\031(t{\000e\177(tL\031&b{\000e\177&tL\031(b{\000e\177t{\031b\255L\000e\177b{\031t\255L\000e\177&{\031(TL\000e\177({\031&TL\000e\177LT\031\255\000e\177{4\301\025\255\000e\177L4\301\025\255\000e\177{4\301\025T\000e\177L4\301\025T\000e\1774\255\000e\1774T\000e\177t\300N\031&4\000e\177t4\031&\300N\000e\1774t\031&\000e\177t\300N\031(4\000e\177t4\031(\300N\000e\1774t\031(\000e\177b\300N\031&4\000e\177b4\031&\300N\000e\1774b\031&\000e\177b\300N\031(4\000e\177b4\031(\300N\000e\1774b\031(\000e\177T\300N\031&4\000e\177T4\031&\300N\000"},
+    {0x2560,32,"e\1774T\031&\000e\177T\300N\031(4\000e\177T4\031(\300N\000e\1774T\031(\000e\177t\300N\031\2554\000e\177t4\031\255\300N\000e\1774t\031\255\000e\177b\300N\031\2554\000e\177b4\031\255\300N\000e\1774b\031\255\000e\177T\300N\031\2554\000e\177T4\031\255\300N\000e\1774T\031\255\000e\177{\302\006t\031&\000e\177{\302\006t\031(\000e\177{\302\006b\031(\000e\177{\302\006b\031&\000e\177{\274s&Cl(\000e\177{\274s(Cl&\000e\177{\274\300\323\000e\177{(\000e\177{b\000e\177{&\000e\177{t\000e\177L(\000e\177Lb\000e\177L&\000e\177Lt\000e\177{(\031L&\000e\177{b\031Lt\000e\177L(\031{&\000e\177Lb\031{t\000"},
+    {0x2580,32,"sor\000l2\301,r\000l2\3011r\000lB\302vr\000lor\000lV\302vr\000lB\302\206r\000l\201\302vr\000\300\324r\000(\201\302vr\000(B\302\206r\000(V\302vr\000(or\000(B\302vr\000(2\3011r\000(2\301,r\000&or\000{\302\214\000\270\302\214\000\312\331\302\214\000s2\301,r\000&2\301,r\000\301\324l(\000\301\324l&\000\301\324s(\000\301\324s(\031l(\031l&\000\301\324s(\031l&\000\301\324s(\031s&\031l(\000\301\324s(\031s&\031l&\000\301\324s&\000\301\324s&\031l(\000\301\324s&\031l(\031l&\000"},
+    {0x25A0,32,"8,\000@,\000@,\003\302\213\304\206\000@,\303z8\004,\000,\003\255\302-\000,\003T\302-\000,\003\347T\312\300\302-\000,\003s(Cl&\302-\000,\003s&Cl(\302-\000,\003\274\312\300\302-\0008\004,\000@\004,\0008\303\232\000@\303\232\0008T\303\232\000@T\303\232\0008\315A\000@\315A\0008\302V\260\000@\302V\260\0008\302V\004\260\000@\302V\004\260\0008\301\325\260\000@\301\325\260\0008\301\325\004\260\000@\301\325\004\260\0008\301\325\305\220\000@\301\325\305\220\0008\302\270\260\000@\302\270\260\0008\302\270\004\260\000@\302\270\004\260\000"},
+    {0x25C0,32,"8\302\016\260\000@\302\016\260\0008\302\016\004\260\000@\302\016\004\260\0008\302\016\305\220\000@\302\016\305\220\0008\300\360\000@\300\360\000@\300\360\303z8\004\300\360\000\334\343\000\302\275\000@y\000\301\016y\000y\003T\302-\000\324\226\0008y\000y\003(o8\000y\003&o8\000y\003lo8\000y\003so8\000y\003s&\301\3248\000y\003\305\012\3037s(\301\3248\000(o8y\000&o8y\000\303\021\302\227\000\303\021@y\000so\303\021@y\000lo\303\021@y\000s(\301\324\305\035\302\006\000s&\301\324\305\035\302\006\000l&\301\324\305\035\302\006\000l(\301\324\305\035\302\006\000"},
+    {0x25E0,32,"soy\000loy\0008l&\260\0008l(\260\0008s(\260\0008s&\260\000@\302\227\000,\003(o8\000,\003&o8\000,\003s(\274o8\000,\003l&\274o8\000@,\003T\324U\300\201\000@\302V\260\003<\000\302V\260\003(o8\000\302V\260\003&o8\000\300#y\000@,\003s(\301\324\000@,\003l(\301\324\000@,\003l&\301\324\000@,\003s&\301\324\000@y\003s(\301\324\000@y\003l(\301\324\000@y\003l&\301\324\000@y\003s&\301\324\000s(\260\000s&\260\000l(\260\000@\270,\0008\270,\000@\270\004,\0008\270\004,\000l&\260\000"},
+    {0x2600,32,"8\302l\003\303\037\000\303;\000\305\302\000\310\340\000\326\017\0008\300\261\000@\300\261\000\305e\000\356N\000\302l\000\312:\314\374\000\307\212\314\374\000\331$\000\310p\0008\302\372\000@\302\372\000\302\263e\000\302\263e\003\302\231\000\302\263e\003\300>\000\303!\000\305\302\003\304N\333\233\000\305L\312b\000@\306\332\303\361\0008\306\332\303\361\000\353\366\000\300:\300\235\307\257\301{\302\227\0008(\300]k\0008&\300]k\000@(\300]k\000@b\300]k\000@&\300]k\000@t\300]k\000"},
+    {0x2620,32,"\310\332\031\312\277\000\324\371\002\000\351(\002\000\324P\002\000\312\220\000\322\227\000\347S\300\323\000\301\256\301\230\000\300\323K\342\227\000\300\323K\340e\000\300\261\031\304\207\000\302\234\014\000\3227\353\363\000\3068\031\354R\000\310\177\014\000\303\256\303\001\000\304\017)\306;\000\304\017)\314)\000\304\017)\303\016\000\304\017)\311\023\000\304\017)\303-\000\304\017)\302\255\000\304\017)\303\342\000\304\017)\302\134\000\307\024K\3329\000@\306-i\000@\301\326i\0008\301\326i\000@\302l\003\303\037\000\303\205\3011\301\211\000\310\016\3011\301\211\000\306{\000"},
+    {0x2640,32,"\304\233\002\000\302\134\000\303T\002\000\340\237\000\352l\000\316\331\000\314\333\000\305\217\000\322\302\000\355\371\000\335\227\000\324\337\000\342A\000\360\205\000\342V\000\352~\000\352G\000\324\351\000\322\263\000\350#\000@\300\032\3027\000@\300\032\302c\000@\300\032\302\365\000@\300\032\302\331\000@\300\032\301\226\000@\300\032\302\363\0008\300\032\3027\0008\300\032\302c\0008\300\032\302\365\0008\300\032\302\331\0008\300\032\301\226\0008\300\032\302\363\000"},
+    {0x2660,32,"8\316%\303\243\000@\301{\303\243\000@\300\360\303\243\0008\307d\303\243\000@\316%\303\243\0008\301{\303\243\0008\300\360\303\243\000@\307d\303\243\000\305L\354\310\000\3011\301\251\000\301,\301\251\000\305\344\301,\305|\000\305\344\304\345\305|\000\306\202\304/\002\000\306\202\310J\002\000\306\202\304Q\002\000\300\310\300-\300\323\000\300\237\300-\300\323\000\316\324\303[\014\000\303[\014)\357:\304L\000\303[\014)\357<\304L\000\303[\014)\316\310\304L\000\303[\014)\316\311\304L\000\303[\014)\316\312\304L\000\303[\014)\316\313\304L\000\303[\014)\357=\304L\000\303[\014)\335\231\343\270\0008\316\324\303[\014\000\351P\306\235\014\000\347\261\306\235\014\000\347\337\306\235\002\000\311B\014\000"},
+    {0x2680,32,"\303\277\334\246\000\303\277\334\247\000\303\277\334\250\000\303\277\334\251\000\303\277\334\252\000\303\277\334\253\000@y\003<&\000@y\0037\214\0008y\003@<&\0008y\0037@\214\000\303\224)\303\001\000\303\224)\303\256\000\303~)\313\207\303\001\000\303~)\314<\303\256\000\303~)\314<\303\001\000\303~)\313\207\303\256\000@\302\344\0008\302\344\000\3068\031\315[\000\312%\000\302\266\355i\000\303\375K\322D\000\352w\000\312\034\000\305:\000\307\277\000\303\375K\336\225\000\322\362\014\000\334\365\000\304J@\300\261\000B\310\030\312\270&\000B\310\030\312\270(\000"},
+    {0x26A0,32,"\360\350\002\000\217\360\225\002\000\305+\304\233\002\000\305+\303T\002\000\3409\304\233\031\303T\002\000\303T\031\304\233\002\000\303T\003I\002\000\303T\003I\031\303T\031\304\233\002\000T\303T\003I\002\000\255\303T\003I\002\000\270@y\000\2708y\000\270\004@y\000\343\252\014\000\332t\014\000\357\255\315C\014\000\326\006\000\335#\357\272\000\345W\000\325$\000\347\206\000\340\231\000\360k\000\325T\0008\301\211\342b\000\353\352\000\353\227\000\350\337\000\353\243\000\354\233\302\330\000\323\375\000f\303\221\000"},
+    {0x26C0,32,"@\306\016\301\360\000@\306\016\3027\0008\306\016\301\360\0008\306\016\3027\000\310\340\305\307\310\336\000\302l\307C\303;\000\304N\0008\310\340\000\311\023\303;\031\304N\000\241@\306\332\303\361\000\2418\306\332\303\361\000@\300\360\300\241,\000\301_\314-\000\332d\303\271\000\347J\000\315[\000\303\271\354\206\000\306=\003@\300\323\000.\301_\314-\000\325)\000\301#\307\235\000\301\033\347=(\305\306\305\271\0008\316\305(\305\306\305\271\000@\316\305(\305\306\305\271\0008(\314,\314\237\000@(\314,\314\237\000\313\014\316\027\002\000L@\302\270\260\000(\301\005\307\235\000f\303!\000\304+\274\300\241@y\300\2418,\0008\311&\000"},
+    {0x26E0,32,"\315\253(\334'\000\315\253(\334(\000\322\350\014)\316\331\000Ly\003I\0317\214'\000\306\243\000\351\224\313\324\306\243\000\3422\313\324\306\243\000\300\221\306\243\0008\300\323\300\216\310\313\000\354\022\354/\000\312\254\000\307X\000\336\301\354n\000\307\277\305\307\337l\000\307\277\003\336e\000\305f\014)\342_\000\303\342\000\305\302\300\216\313\211\000\313X\000\302\344\300\241\313\261\000\334\313\000\352J\000,O\304\206\000\354x\000\303\321\316\023\000\301\362\003\302\330\000\311\010\000\303\322\307>\014\000\313\235\336\020\014\000\335\037\350\210\000\305#\300\2168,\000@\302\344\003\255M8\355#\000"},
+    {0x2700,32,"8\310\270\304\337\000s\312l\304\337\0008\304\337\000l\312l\304\337\000@\304\337\000@L\302\231+\000\302\372\303\333\002\000\316j\313\014\000\303\261\000\303\202\000\301T\307\255\000\301T\301o\000\316\341\301o\000\317\001\301o\000l&\306\242\000\306\242\000s&\306\242\000@\314\356\0008\314\356\000\302\231+\000L\302\231+\000\302\302\300>\000L\302\302\300>\000\302\263\300>\000L\302\263\300>\000\304J\042\300\323\000L\042\300\323\000\262\300\222\300\323\000L\262\300\222\300\323\000\010\300\323\000\302\316@\010\300\323\000\304J\010\300\323\000"},
+    {0x2720,32,"\343\222\300\323\000\300\261K\331\350\000O\304_\300\367\000O\307<\300\367\000LO\307<\300\367\000O\325\232\300\367\0008O\301;\300\261\000@O\301;\300\261\000\354\261\000\305\254\304J@\300\261\000.@\300\261\000\262\300\2228\300\261\0008\300\222@\300\261\000\304J8\300\261\000L\304J8\300\261\000\303\231\300\261\000\302\316@\300\261\000L\300\367\000\262\300\222\300\367\000u\302=\300\367\000u\301;8\300\261\000u\301;\303\231\300\261\000v\301;8\300\261\000u\301;\315\2438\300\261\000Lu\301;\315\2438\300\261\000\302\220\301;8\300\261\000\303`\301;\300\367\000\304_\300\367\000\262\300\222\304_\300\367\000L\304_\300\367\000v\315T8\031@\306%\0008\306%\000"},
+    {0x2740,32,"@\306%\000u\315T\304J8\306%\000.\262\300\222u\301;\300\261\000L\304_\303\231\300\367\000\310\337\000\311\026\356\271\310\337\000L\312\251\310\337\000\316&\000L\316&\000\307<\300\367\000u\304_\315|\300\367\000Lu\304_\315|\300\367\000\300\323+\000\302\316@y\000\300\020f\300\323+\000l&\313\015@,\000s&\313\015@,\000l&\302\316@,\000s&\302\316@,\0008\301\216+\300\231\000@\301\216+\300\231\000@\301\257+\300\231\0008\300\360\302\002@\300>\000L\301\257+\014\000{Tx\000\270Tx\000LTx\000L\300N\241\300\251\301\177+\300\231\000L\300N\300\251\301\177+\300\231\000L4\241\300\251\301\177+\300\231\000L4\300\251\301\177+\300\231\000L\210\300N\300\251\301\177+\300\231\000"},
+    {0x2760,32,"L\2104\300\251\301\177+\300\231\000\302\011\303'\305\207\002\300\231\000L\301\257+\300\231\000L\301{\301\257+\300\231\000L8\301{\000\300\235L8\301{\302\227\000\307\257\301{\000\300\235\307\257\301{\302\227\000\270(\300\371\300\231\000\270&\300\371\300\231\000\270\3058(\300\371\300\231\000\270\3058&\300\371\300\231\000\270\302\016\300\236\202\300\231\000\270\301\325\300\236\202\300\231\000L\302\016\300\236\301\177+\300\231\000L\301\325\300\236\301\177+\300\231\000L\302\016\300\236\202\300\231\000L\301\325\300\236\202\300\231\000{(\301\276\301g\202\300\231\000{&\301\276\301g\202\300\231\000\270(\301\077\202\300\231\000\270&\301\077\202\300\231\000\301b\300\020.\0172\000\301b\300\020.\0177\000\301b\300\020.\017B\000\301b\300\020.\017O\000\301b\300\020.\017V\000\301b\300\020.\017v\000\301b\300\020.\017\201\000\301b\300\020.\017u\000\301b\300\020.\017\211\000\301b\300\020.\036\300H\000"},
+    {0x2780,32,"\301b.0\0172\000\301b.0\0177\000\301b.0\017B\000\301b.0\017O\000\301b.0\017V\000\301b.0\017v\000\301b.0\017\201\000\301b.0\017u\000\301b.0\017\211\000\301b.0\036\300H\000\301b\300\020.0\0172\000\301b\300\020.0\0177\000\301b\300\020.0\017B\000\301b\300\020.0\017O\000\301b\300\020.0\017V\000\301b\300\020.0\017v\000\301b\300\020.0\017\201\000\301b\300\020.0\017u\000\301b\300\020.0\017\211\000\301b\300\020.0\036\300H\000L\301\032\134\034\000La\002\000L\302\002\002\000L\303\300\002\000L\3004\300\237\034\000L\134\034\000L\275\300\237\034\000\333\226\301\252\134\034\000L\351\275\134\034\000\300`\134\034\000L\300`\134\034\000\302\267\300`\134\034\000"},
+    {0x27A0,32,"L\302\267\300`\134\034\0008\134\034\000\304\361\311 \134\300a\000\304\361\324q\134\300a\0008\134\300a\000L8\302\011\267\031\134\034\000L8\302\011\277\031\134\034\000\316-8\134\034\000L\331\0348\134\034\000\310\260@\134\034\000\310\023@\134\034\000\3079\302\316@\134\034\000\307\271\302\316@\134\034\000Ll\306\307@\134\034\000Ls\306\307@\134\034\000\303Vl\306\307@\134\034\000\301\077\301\244\000\303Vs\306\307@\134\034\000.L@\134\034\000\361\004\134\034\000\304z\3004\300\237\034\000\304z\134\034\000\304z\275\300\237\034\000L\304z\3004\300\237\034\000L\304z\134\034\000L\304z\275\300\237\034\000\356\016\134\034\000L\356\017\134\034\000\316\366\134\034\000L\316\366\134\034\000\347H\134\034\0004\301\077\301\244\000"},
+    {0x27C0,32,"B\332X\300\236\000@\260\303z\004@\260\000\310\203\000\262\301\274\000\262\301\275\000(\315\313\305\337\306\003\000&\315\313\305\337\306\003\000\300\037\003<\302!\000\302\003\301\327\315w\301\274\000\301\275\315w\301\327\000Tx\003\255I\000\015\302\207\274\000\253\303\300\000\015\304+\274\000f\301\206\031\000f\301\206\300\037\000@\300\360\003\303v<\000\031\003<\000\302\272K\304H\277\000l&\3018\003<\000s(\3018\003<\000(\310r\306N\000&\310r\306N\000\300\324\310r\306N\000\300#b\301O\000\300#t\301O\000(\031&4\304\022\000(\031&\301O\000(\310@\000\253&\301O\000\253(\301O\000b\301O\003y'\000"},
+    {0x27E0,32,"\302\275\307\216\302\333\255\351\345\000@\307j\300\360\000@\307j\300\360\003n\303d\000@\307j\300\360\003\134\303d\000@,\003n\303d\000@,\003\134\303d\000\015(@,\202\000\015&@,\202\000\015(\300\236\202\000\015&\300\236\202\000\015(4\300\236\202\000\015&4\300\236\202\000\015(@\301\276\301g\202\000\015&@\301\276\301g\202\000\015(\3058\300\371\000\015&\3058\300\371\000\277\303\036\034\000\267\303\036\034\000\301\373\313hy\034\000\302[\313hy\034\000&\034\003.a\000\253n\034\000\253\134\034\000\253(&\034\000\253n4\034\000\253\1344\034\000\253(&4\034\000\253n\034\301Ax\000\253\134\034\301Ax\000\253n4\034\301Ax\000\253\1344\034\301Ax\000\253\134\306\350\034\000"},
+    {0x2800,32,"FE\312m\000FE\332\216\000FE\333\017\000FE\332\217\000FE\333O\000FE\332\317\000FE\333\020\000FE\332\220\000FE\333o\000FE\332\357\000FE\3330\000FE\332\260\000FE\333P\000FE\332\320\000FE\333\021\000FE\332\221\000FE\333\177\000FE\332\377\000FE\333@\000FE\332\300\000FE\333`\000FE\332\340\000FE\333!\000FE\332\241\000FE\333p\000FE\332\360\000FE\3331\000FE\332\261\000FE\333Q\000FE\332\321\000FE\333\022\000FE\332\222\000"},
+    {0x2820,32,"FE\333\207\000FE\333\010\000FE\333H\000FE\332\310\000FE\333h\000FE\332\350\000FE\333)\000FE\332\251\000FE\333x\000FE\332\370\000FE\3339\000FE\332\271\000FE\333Y\000FE\332\331\000FE\333\032\000FE\332\232\000FE\333\200\000FE\333\001\000FE\333A\000FE\332\301\000FE\333a\000FE\332\341\000FE\333\042\000FE\332\242\000FE\333q\000FE\332\361\000FE\3332\000FE\332\262\000FE\333R\000FE\332\322\000FE\333\023\000FE\332\223\000"},
+    {0x2840,32,"FE\333\213\000FE\333\014\000FE\333L\000FE\332\314\000FE\333l\000FE\332\354\000FE\333-\000FE\332\255\000FE\333|\000FE\332\374\000FE\333=\000FE\332\275\000FE\333]\000FE\332\335\000FE\333\036\000FE\332\236\000FE\333\204\000FE\333\005\000FE\333E\000FE\332\305\000FE\333e\000FE\332\345\000FE\333&\000FE\332\246\000FE\333u\000FE\332\365\000FE\3336\000FE\332\266\000FE\333V\000FE\332\326\000FE\333\027\000FE\332\227\000"},
+    {0x2860,32,"FE\333\210\000FE\333\011\000FE\333I\000FE\332\311\000FE\333i\000FE\332\351\000FE\333*\000FE\332\252\000FE\333y\000FE\332\371\000FE\333:\000FE\332\272\000FE\333Z\000FE\332\332\000FE\333\033\000FE\332\233\000FE\333\201\000FE\333\002\000FE\333B\000FE\332\302\000FE\333b\000FE\332\342\000FE\333#\000FE\332\243\000FE\333r\000FE\332\362\000FE\3333\000FE\332\263\000FE\333S\000FE\332\323\000FE\333\024\000FE\332\224\000"},
+    {0x2880,32,"FE\333\215\000FE\333\016\000FE\333N\000FE\332\316\000FE\333n\000FE\332\356\000FE\333/\000FE\332\257\000FE\333~\000FE\332\376\000FE\333\077\000FE\332\277\000FE\333_\000FE\332\337\000FE\333 \000FE\332\240\000FE\333\206\000FE\333\007\000FE\333G\000FE\332\307\000FE\333g\000FE\332\347\000FE\333(\000FE\332\250\000FE\333w\000FE\332\367\000FE\3338\000FE\332\270\000FE\333X\000FE\332\330\000FE\333\031\000FE\332\231\000"},
+    {0x28A0,32,"FE\333\212\000FE\333\013\000FE\333K\000FE\332\313\000FE\333k\000FE\332\353\000FE\333,\000FE\332\254\000FE\333{\000FE\332\373\000FE\333<\000FE\332\274\000FE\333\134\000FE\332\334\000FE\333\035\000FE\332\235\000FE\333\203\000FE\333\004\000FE\333D\000FE\332\304\000FE\333d\000FE\332\344\000FE\333%\000FE\332\245\000FE\333t\000FE\332\364\000FE\3335\000FE\332\265\000FE\333U\000FE\332\325\000FE\333\026\000FE\332\226\000"},
+    {0x28C0,32,"FE\333\214\000FE\333\015\000FE\333M\000FE\332\315\000FE\333m\000FE\332\355\000FE\333.\000FE\332\256\000FE\333}\000FE\332\375\000FE\333>\000FE\332\276\000FE\333^\000FE\332\336\000FE\333\037\000FE\332\237\000FE\333\205\000FE\333\006\000FE\333F\000FE\332\306\000FE\333f\000FE\332\346\000FE\333'\000FE\332\247\000FE\333v\000FE\332\366\000FE\3337\000FE\332\267\000FE\333W\000FE\332\327\000FE\333\030\000FE\332\230\000"},
+    {0x28E0,32,"FE\333\211\000FE\333\012\000FE\333J\000FE\332\312\000FE\333j\000FE\332\352\000FE\333+\000FE\332\253\000FE\333z\000FE\332\372\000FE\333;\000FE\332\273\000FE\333[\000FE\332\333\000FE\333\034\000FE\332\234\000FE\333\202\000FE\333\003\000FE\333C\000FE\332\303\000FE\333c\000FE\332\343\000FE\333$\000FE\332\244\000FE\333s\000FE\332\363\000FE\3334\000FE\332\264\000FE\333T\000FE\332\324\000FE\333\025\000FE\332\225\000"},
+    {0x2900,32,"\134\302(\034\003TI\000\134\302(\034\0034TI\000n4\034\003TI\000\1344\034\003TI\000(&4\034\003TI\000\134\302(\034\301Ax\000n4\034\301Ax\000\1344\034\301Ax\000\267\034\003\255I\000\277\034\003\255I\000\277\300\262\034\000\267\300\262\034\000n4\301\025\034\000\1344\301\025\034\000n\300\262\301\025\034\000\134\300\262\301\025\034\000\134\302(\300\262\301\025\034\000\134\034\003\301\016\303'\000\277\034Cx\000\267\034Cx\000\134\034\003\300\253\003TI\000\134\034\003\300\253\0034TI\000\134\302(\034\003\300\253\000\134\302(\034\003\300\253\003TI\000\134\302(\034\003\300\253\0034TI\000n\305\332\000\134\305\332\000n4\305\332\000\1344\305\332\000n\034C8\300\360\000\134\034C8\300\360\000n\034\301AxC8\300\360\000"},
+    {0x2920,32,"\134\034\301AxC8\300\360\000\275\300\310\031\3004\300\237\034\000\275\300\237\031\3004\300\310\034\000\275\300\310\034\003S\000\275\300\237\034\003S\000\3004\300\237\034\003S\000\3004\300\310\034\003S\000\275\300\310\034\031\275\300\237\034\000\275\300\237\034\031\3004\300\237\034\000\3004\300\237\034\031\3004\300\310\034\000\3004\300\310\034\031\275\300\310\034\000\302\207\274\301_\304+\274\000\304+\274\301_\302\207\274\000\3004\300\237\034\301_\275\300\237\034\000\275\300\237\034\301_\3004\300\237\034\000\304+\274\301_\275\300\237\034\000\302\207\274\301_\3004\300\237\034\000\275\300\237\034\301_\275\300\310\034\000\275\300\310\034\301_\275\300\237\034\000\301\134\034\300]\312\372&\000\034\300]\134\303\245\305$\277\000\034\300]\134\303\245\305$\267\000\034\300]\267\303\245\305$n\000\034\300]\267\303\245\305$\134\000\351\226\302\006\302[\034\000\3424\302\006\301\373\034\000\300\365\302\006\301\373\034\000\3017\302\006\301\373\034\000\300\365\302\006\302[\034\003\302\002\000\300\365\302\006\301\373\034\003a\000l&\310\304\302[\034\000l(\310\304\301\373\034\000"},
+    {0x2940,32,"\301\373\301\005y\034\000\302[\301\005y\034\000\134\034'\300wn\034\000n\034'\300w\134\034\000\300w\134\034'n\034\000\134\034\003a:\000n\034\003a:\000\134\034\302\216\300>\000(&\034\302\216\004y\000\277\302(\034\301A\004y\000(\273b&\273t\300\233\000(\273t&\273b\300\233\000b\273&t\273(\300\233\000b\273(t\273&\300\233\000(\273b&\273b\300\233\000b\273&t\273&\300\233\000(\273t&\273t\300\233\000b\273(t\273(\300\233\000n\300\233\003\273bCx\000\134\300\233\003\273bCx\000\277\300\233\003\273&Cx\000\267\300\233\003\273&Cx\000n\300\233\003\273tCx\000\134\300\233\003\273tCx\000\277\300\233\003\273(Cx\000\267\300\233\003\273(Cx\000n\300\233\003\273b\301Ax\000\134\300\233\003\273b\301Ax\000\277\300\233\003\273&\301Ax\000\267\300\233\003\273&\301Ax\000n\300\233\003\273t\301Ax\000\134\300\233\003\273t\301Ax\000"},
+    {0x2960,32,"\277\300\233\003\273(\301Ax\000\267\300\233\003\273(\301Ax\000n\300\233\003\273b'n\300\233\003\273t\000\277\300\233\003\273(\303\007\277\300\233\003\273&\000\134\300\233\003\273b'\134\300\233\003\273t\000\267\300\233\003\273(\303\007\267\300\233\003\273&\000n\300\233\003\273b'\134\300\233\003\273b\000n\300\233\003\273t'\134\300\233\003\273t\000\134\300\233\003\273b'n\300\233\003\273b\000\134\300\233\003\273t'n\300\233\003\273t\000n\300\233\003\273b'\253\301\025\000n\300\233\003\273t:\253\301\025\000\134\300\233\003\273b'\253\301\025\000\134\300\233\003\273t:\253\301\025\000\277\300\233\003\273(\303\007\267\300\233\003\273&\000\267\300\233\003\273(\303\007\277\300\233\003\273&\000&4\034\003\302\213\301\225\000\301@\002'\134\034\000\272\300\362'\134\034\000n\034'\272\300\362\000\134\034'\272\300\362\000\134\034'\302X\245C\000\300\257'n\034\000n\034\302\216\300\257\000\300\256'\134\034\000\301\274'\134\034\000n\034\302\216\301\274\000\301\275'n\034\000(\303F\300\253\000&\303F\300\253\000b\303F\300\253\000t\303F\300\253\000"},
+    {0x2980,32,"\300\262Tx\306\003\000\300 \300Y\354\304\000\300 \300Y\307\011\301^\000(@\301\077\202\000&@\301\077\202\000(@\300\371\000&@\300\371\000\300 \300Y(\303\216\202\000\300 \300Y&\303\216\202\000\300 \300Y(\312h\202\000\300 \300Y&\312h\202\000(,\202\003\301\314\000&,\202\003\301\314\000(,\202\003\303d\300\241\300\365\3018\000&,\202\003\303d\300\241\3017\3018\000(,\202\003\303d\300\241\3017\3018\000&,\202\003\303d\300\241\300\365\3018\000(\300\236\202\003<\000&\300\236\202\003<\000(\302\006\300\257\202\000&\302\006\300\256\202\0004(\302\006\300\256\202\0004&\302\006\300\257\202\000(8\301\276\301g\202\000&8\301\276\301g\202\000\301\016\3055\000T\303\003\300\201\000\302\355\300\236\304H(\000&\300\236\301h\003,\000\302\355&\300\236\003<\000\300\236\003d\302!\000\300!\300\236\000"},
+    {0x29A0,32,"\310\344\300\236\304H(\000\310\344\300\236\304Hb\000\241\300\236\000\300:\300\236\000\300\236\003\301\314\000\300:\300\236\003\301\314\000\302O\300\236\304Hb\000\302O\300\236\304Ht\000\302\355\300\236\003\262\301\345\303\305\300\241\034\300]b\031&\000\302\355\300\236\003\262\301\345\303\305\300\241\034\300]b\031(\000\302\355\300\236\003\262\301\345\303\305\300\241\034\300]t\031&\000\302\355\300\236\003\262\301\345\303\305\300\241\034\300]t\031(\000\302\355\300\236\003\262\301\345\303\305\300\241\034\300]&\031b\000\302\355\300\236\003\262\301\345\303\305\300\241\034\300](\031b\000\302\355\300\236\003\262\301\345\303\305\300\241\034\300]&\031t\000\302\355\300\236\003\262\301\345\303\305\300\241\034\300](\031t\000\300:\302x\303\240\000\302x\303\240\003\302\304\000\302x\303\240\003\004y'\000\302x\303\240\003&\034'\000\302x\303\240\003(\034'\000y\003\255x\000.Tx\000.\303X\000.\302\003\301\327\000.\310\203\000y\307\216\302\333\255x\031\300\365o\307\216\302\333Tx\000y\003\355V\300>\000.\322\236\303\300\002\000b\034\302\216y\000.@\302\227\000.\302\227\000"},
+    {0x29C0,32,".\300\257\000.\300\256\000y\003\004yC\301\011&\000y\0037\255\310\364C\301\011&\000f\302\207\274\302j\000f\304+\274\302j\000f\300\367\000f\004y\000f,\0007\305U\306\347\000\260\003<'\000\260\003\301\314\000d\300\241\260\000\260\003\306\323\301\234\3017\000&\260'(\260\000(\260\303\007Tx\000Tx\303\007&\260\000\305\351\003(o8\000\305\351\003&o8\0008\305\351\000\027\003(o8\000\027\003&o8\000@\306\077\0008\306\077\000(\305\001\3055\000&\305\001\3055\000(4\305\001\3055\000&4\305\001\3055\000\340'\304\254\000\304\362\223\304\254\000\304\254\314\331\003Tx\000\333\221\310@\000"},
+    {0x29E0,32,",\003\331+\347^\000\340(\302\225\000\3547\302\311\000\301@\002\031\301\231\303X\000\301@\002\031\301\231\303X\003\272'\000\306DC\031\301\231\303X\000\335\355\355\001\000\3564\000\302\270\260\003(o8\000\302\270\260\003&o8\0008\300\360\003t\034\0008\302\275\000@y\003t\034\0008y\003t\034\000\304\230@,\000\304\2308,\000\304\230@\300\360\000\304\2308\300\360\000\304\230@y\000\304\2308y\000\351\346\000\302\003\301\327\300\362\000\301\327\003\302\304\000\302\003\301\327\003\255I\000\302s\301\327\000\302s\302\003\301\327\0004a\000\300\262a\000\302\016\302\011\300\236\202\000\301\325\302\011\300\236\202\000\305\266\000\344I\000"},
+    {0x2A00,32,"\302N.<\300\362\000\302N.a\300\362\000\302N.\027\300\362\000\302N\302\025\300\362\003<\000\302N\302\025\300\362\003a\000\302N,\3024\300\362\000\302N,\302\025\300\362\0007\301\206\031\300\362\0007\301\206\300\037\300\362\000\302N\027\300\362\000\344j7\304\352\000\305\256\003\301\301\000\303\036\301\301\300\362\000\334\335\310|\301\301\000\301\301\0034I\000\301\301\323\006\003\302j\000\325\177\313]\000\301\373\306G\000\300\201\306G\003\315\242\305\211\3072\305\221\000\300\201\306G\003\310\304\305\211\3072\305\221\000\300\201\306G\300\224\340%\301\011\305\221\000\301\301\3072\025\301\252\300\362\000\350\330\301\301\300\362\000\301\301\003n\034\003S\000\301\301\003\027\002\000\301\301\003\3024\000\301\301\003\302\025\000\301\301\003\302\304\000\301\301\003\301\314\000\306N\000\300#(\260\300\362\000\300 \300Y\310\275\307h\000"},
+    {0x2A20,32,"\300 \300Y\310\275\350\037\000\300 \300Y\310\275\350r\000a\002\003\004y'\000a\002\003\300M\300\206'\000a\002\003\272'\000a\002\003<:\000a\002\003\272:\000a\002\003\301'7\000a\002\0038\260\000\302\002\002\003\300\251'\000\302\002\002\003<:\000\302\002\002\003\304+\214\000\302\002\002\003\302\207\214\000a\002\300\241(oy\000a\002\300\241&oy\000\3601\300\037\300\323\302\311\000\302\302\002\003<'\000\302\302\002\003\301\314\000\305\245\302\311\003\3017\301\005\000\316\032\302\311\000\302\302\002\300\241(oy\000\302\302\002\300\241&oy\000.\302\302\002\003\300M\300\206\000\302\302\002\300\2414y\000.\303\300\002\000a\002\300\241\260\000\302\002\002\300\241\260\000\302\302\002\300\241\260\000\313\323\302\311\000\351\227\313\323\302\311\000\300 \300Y\351\134\307h\000\322z\300\037\312\272\000"},
+    {0x2A40,32,"\3024\003<\000\302\025\003\302\002\002\000\302\025\003\302\304\000\3024\003\302\304\000\3024\003\301\206\031\000\302\025\003\301\206\300\037\000\302\025'\3024\000\3024'\302\025\000\302\025'x'\3024\000\3024'x'\302\025\000\302\025\303\007\031\305U\003\302\025\000\3024\303\007\031\305U\003\3024\000\301\005\302\025\003\306\323\000\301\005\3024\003\306\323\0004,\3024\0004,\302\025\000\301\005\302\025\003\306\323\031\316\032\302\311\000\301\206\031\003<'\000\301\206\300\037\003<'\0004\301\206\031\0004\301\206\300\037\0007\313\326\301\206\031\0007\313\326\301\206\300\037\000\316\026\300#\300\037\000\316\026\300#\031\000\301\206\300\037\305\204\301\206\031\000\301\206\031\003M\303'\000\301\206\300\037\003M\303'\000\301\206\031\003\255\301\025\000\301\206\300\037\003\255\301\025\000\301\206\031\0034\302\304\000\301\206\031\003\301\314\000"},
+    {0x2A60,32,"\301\206\031\0034\301\314\000\004\304\023\003\301\314\000\301\206\300\037\0034\302\304\000\301\206\300\037\0034\301\314\000\300 \300Y\332\211\312+\000\300 \300Y\305\232\312+\000\301@\002\003<:\000\306D\003<'\000\300\262\255x\0034TI\000\300\262\255x\003\300\262TI\000\272\300\362\003<'\000\272\300\362\003\302\207\214\000\303_\302\002\303_\000\331!\003<'\000\301@\003\300\367\000\302X\245C\003\300M\300\206\000\304s\245\300\037\245C\000\301@\002'a\002\000a\002'\301@\002\000\301@\002'\272\300\362\0004\301^\245\0007\312\267\301@\316\004\000B\312\267\301@\316\004\000\301@\002\0037\214'\0317\214:\000\302y\003O\214'\000\300\257\003y\302!\000\300\256\003y\302!\000\300\257\003\301\216+'\000\300\256\003\301\216+'\000\300\257\300\037\301\231\245C\000\300\256\300\037\301\231\245C\000\300\257\300\037\301\231\245C\003<\302!\000"},
+    {0x2A80,32,"\300\256\300\037\301\231\245C\003<\302!\000\300\257\300\037\301\231\245C\003<'\000\300\256\300\037\301\231\245C\003<'\000\300\257\300\037\301\231\245C\003<'&\000\300\256\300\037\301\231\245C\003<'(\000\300\257\300\037\305\330\000\300\256\300\037\305\330\000\300\257\031\304\344\300\224\245C\000\300\256\031\304\344\300\224\245C\000\300\257\031\300\224\305\330\000\300\256\031\300\224\305\330\000\300\257'\303>\245'\300\256\000\300\256'\303>\245'\300\257\000\300\257'\303_\300\037\245\000\300\256'\303_\300\037\245\000\300\257'\303_'\300\256\000\300\256'\303_'\300\257\000\300\257'\300\256'\303>\245\000\300\256'\300\257'\303>\245\000\300\257'\301\231\245'\300\256'\301\231\245\000\300\256'\301\231\245'\300\257'\301\231\245\000\301\231\245C\300\037\300\257\000\301\231\245C\300\037\300\256\000\301\231\245C\300\037\300\257\003<\302!\000\301\231\245C\300\037\300\256\003<\302!\000\303>\245C\300\037\300\257\000\303>\245C\300\037\300\256\000\303>\301\231\245C\300\037\300\257\000\303>\301\231\245C\300\037\300\256\000\303_\300\037\300\257\000\303_\300\037\300\256\000\303_'\300\257'\301@\002\000"},
+    {0x2AA0,32,"\303_'\300\256'\301@\002\0004\305v\300\257\0004\305v\300\256\0004\305v\300\257\003\301\314\000\300\256\305\204\300\257\000\300\256\303\007\300\257\000\300\257\301\005\302\333\301*\000\300\256\301\005\302\333\301*\000\300\257\301\005\302\333\301*'\301\231\245\000\300\256\301\005\302\333\301*'\301\231\245\000\316\031\304\360\000\314/\304\360\000\316\031\304\360\300\037\245C\000\314/\304\360\300\037\245C\000\301@\002\003\324\227'\000\302\310'\304\344\301@\002\000\302\320'\304\344\301@\002\000\302\310'\304\344\300\224\245C\000\302\320'\304\344\300\224\245C\000\302\310'\301@\002\000\302\320'\301@\002\000\302\310'\300\224\245C\000\302\320'\300\224\245C\000\302\310'\302X\245C\000\302\320'\302X\245C\000\302\310'\300\224\302X\245C\000\302\320'\300\224\302X\245C\0004\302\310\0004\302\320\000\301\274\003<\000\301\275\003<\000\301\274\003a\002:\000"},
+    {0x2AC0,32,"\301\275\003a\002:\000\301\274\003\302\302\002:\000\301\275\003\302\302\002:\000\301\274K\300\037\245C\003<'\000\301\275K\300\037\245C\003<'\000\301\274K'\301@\002\000\301\275K'\301@\002\000\301\274K'\272\300\362\000\301\275K'\272\300\362\000\301\274K'\302X\245C\000\301\275K'\302X\245C\000\301\274K'\300\224\245C\000\301\275K'\300\224\245C\000,(\262e\300\362\000,&\262e\300\362\000\301\005\301\274\000\301\005\301\275\000\301\005\301\274\300\037\245C\000\301\005\301\275\300\037\245C\000\301\274'\301\275\000\301\275'\301\274\000\301\274'\301\274\000\301\275'\301\275\000\301\275\303\007\301\274\000\301\275\303\007\031\305U\302\333\301\025\003\301\274\000\302\272K\304H\267\000\315j\003\304\357\300\365\000\356\260\3024\000\335\013\000\346\030\000\300w(\301O\000\300wt\301O\000"},
+    {0x2AE0,32,"\300wb\301O\000\310\203\003d\000Tx\300\262&\304\022\0004Tx(\304\022\000Tx4(\304\022\0004Tx4(\304\022\000\253\301\025\301A(\306zK4T\000\300wt\301O\003\302\304\000\300wb\301O\003\301\314\000\300wb\301O'\300wt\301O\0004t\301O\0004b\301O\0004I\300\224\002\000\300:4I\300\224\002\000\302\336\300\224\307\215\003\300:\345N\302j\000T\300\201\003y'\000T\300\201\003y:\000t\301O\003y:\000\303X\003\255I\000\303X\003\272\300\362\000\300\262Tx\312f\306\276\000\300\262Tx\003\255I\000\300\262\301^\300\362\000\300\262\305v\300\257\000\300\262\305v\300\256\000\303>\301\231\300\257\300\037\245C\000\303>\301\231\300\256\300\037\245C\000\300\262\301\327\312f\306\276\000\300#\300\262Tx\300\362\0004\301\327\300\362\000@Tx\000\302N@Tx\000"},
+    {0x2B00,32,"\275\300\237@\034\000\275\300\310@\034\000\3004\300\237@\034\000\3004\300\310@\034\000(&@\034\000n8\034\000\2778\034\000\2678\034\000\275\300\2378\034\000\275\300\3108\034\000\3004\300\2378\034\000\3004\300\3108\034\000(&8\034\000bt8\034\000\134\034\003\302\005\267\000\134\034\003\302\005\277\000n\034\003\302\005\267\000n\034\003\302\005\277\000,\003\300\365o8\000,\003\3017o8\000,\003s&\274o8\000,\003l(\274o8\000\300\360\003(o8\000\300\360\003&o8\000\300\360\003\300\365o8\000\300\360\003\3017o8\000\301\016,\0008\300#,\000@\300#,\0008\301u\004,\000@\301u\004,\0008\305\213\000"},
+    {0x2B20,32,"@\305\213\000@\307\322\0008\307\322\000\2558\307\322\0008\300#y\0008\270\300\360\000@\270\300\360\0008\270\302\275\000@\270\302\275\0008\004\300\360\0008\004\302\275\000@\004\302\275\0008\255\306\027\000@\255\306\027\0008T\306\027\000@T\306\027\000(\034\003\004y\000Bn\302C\000(\034\003.a\000\253n\306\350\034\000n\302(\034\003TI\000n\302(\034\0034TI\000n\302(\034\301Ax\000n\302(\300\262\301\025\034\000n\034\003\301\016\303'\000n\034\003\300\253\003TI\000n\034\003\300\253\0034TI\000n\302(\034\003\300\253\000n\302(\034\003\300\253\003TI\000n\302(\034\003\300\253\0034TI\000n\034\302\216\300>\000\301\134\034\300]\312\372(\000"},
+    {0x2B40,32,"\301@\002'n\034\000\302\003\272\300\362'n\034\000n\034'\302\003\302X\245C\000\134\034\302\216\300\256\000\134\034\302\216\301\275\000n\303\036\034\000\134\303\036\034\000\302\003\272\300\362'\134\034\000\134\034'\302\003\302X\245C\000\272\300\362'n\034\000n\034'\302X\245C\000n\034'\302\003\272\300\362\000\134\034'\302\003\272\300\362\000\267\300`\303\003\034\000\300w\301\231\275\034\000\300w\307:\3004\034\000@\270\300\261\0008\004\300\261\000@\004\300\261\0008\301\325\305\213\000@\301\325\305\213\000L\300#y\000L\305\203\003\305\203\302!\000Ly\003y\302!\000Ly\000L.\303!\000\301\231\275\034\003\304\250\301\225\000\307:\3004\034\003\304\250\300\253\000\301\231\275\034\003\255\300\253\000\307:\3004\034\003\255\300\253\000\301x\034\300]\267\303\245\275\300\237\000\300w\301x\034\300]\267\303\245\275\300\237\000"},
+    {0x2B60,20,"n\300`\034\000\277\300`\034\000\134\300`\034\000\267\300`\034\000(&\300`\034\000bt\300`\034\000\275\300\310\300`\034\000\275\300\237\300`\034\000\3004\300\237\300`\034\000\3004\300\310\300`\034\000n\300`\302\267\034\000\277\300`\302\267\034\000\134\300`\302\267\034\000\267\300`\302\267\034\000\302[\300`\262y\034\000\301\373\300`\262y\034\000n\300`\034Cx\000\277\300`\034Cx\000\134\300`\034Cx\000\267\300`\034Cx\000"},
+    {0x2B76,32,"\275\300\310\300`\034Cx\000\275\300\237\300`\034Cx\000\3004\300\237\300`\034Cx\000\3004\300\310\300`\034Cx\000n\300`\034\0034\255I\000\277\300`\034\0034\255I\000\134\300`\034\0034\255I\000\267\300`\034\0034\255I\000\255\303b\303\221\000T\303b\303\221\000n\300`\034\223\134\300`\034\000\277\300`\034nK\267\300`\034\000\134\300`\034\223n\300`\034\000\267\300`\034nK\277\300`\034\000n\300`\303\356\302C\000\277\300`\303\356\302C\000\134\300`\303\356\302C\000\267\300`\303\356\302C\000n8.@\034\000\2778.@\034\000\1348.@\034\000\2678.@\034\000\301\373\300`&\305\300\034\000\301\373\300`\3017\305\300\034\000\301\373\300`(\305\300\034\000\301\373\300`\300\365\305\300\034\000\305\235(\000\305\235&\000\310Q(\000\310Q&\000O\3018\302C\312\256\301\373\000\1348\034\000"},
+    {0x2B97,32,"\014)\307\011\025\334\020\000\304\361\311 n\301\320\300a\000\304\361\351\225\277\301\320\300a\000\304\361\311 \134\301\320\300a\000\304\361\3423\267\301\320\300a\0008n\301\320\300a\0008\277\301\320\300a\0008\134\301\320\300a\0008\267\301\320\300a\000\267\300`\034\003\253\302\005n\000\267\300`\034\003\253\302\005\134\000\277\300`\034\003\253\302\005n\000\277\300`\034\003\253\302\005\134\000n\300`\034\003\253\302\005\277\000\134\300`\034\003\253\302\005\277\000n\300`\034\003\253\302\005\267\000\134\300`\034\003\253\302\005\267\0008\302\011\267\031n\034\0008\302\011\267\031\134\034\0008\302\011\277\031n\034\0008\302\011\277\031\134\034\0008\302\011n\031\277\034\0008\302\011\134\031\277\034\0008\302\011n\031\267\034\0008\302\011\134\031\267\034\000\303 \034t(\000\303 \034t&\000\303 \034b(\000\303 \034b&\000\303 \034(b\000\303 \034&b\000\303 \034(t\000"},
+    {0x2BB7,32,"\303 \034&t\000\277@\034\301Ax\003\255x\000b\300a\300\241\025\303\232e\000\305\204@\306\347\000\305\204@\0318\306\347\000\305\2048\306\347\000\302\263e\003{\300>\000.\300>\000.\032\300>\0008,\303v\0008\300\360\303v\000\2418\305\213\000\2558\315\033\0008\315\033\0008\270\302V\260\303v\0008\270\302\270\260\303v\0008\270\302\016\260\303v\0008\270\301\325\260\303v\000\314\333\0207\000\300\365o8y\000\3017o8y\000{O\301;8\305\374\000\300\235{O\301;8\305\374\000@O\301;\305\374\000\300\235@O\301;\305\374\000,\304\325\301Y\000\357\242\002\000\313\212+\000\305\217\0207\000\305\217\020B\000\305\217\020O\000\305\217\020V\000"},
+    {0x2BD7,32,"\356\257\000\350x\000\322\347\000\337\225\000\347\373\000\345T\000@\301\211\353\225\0008\300\360\300\216\300\323\000\311'{\301\211\322\321\000\331[\000\336O\000\362C\000\341\210\000\322\252\000\3228\000\360\242\000\350N\000(o8\300\261\000&o8\300\261\000\300\261\003(o8\000\300\261\003&o8\000n\302(\034\003\260\305\333\000\277\302(\034\003\260\305\333\000\134\302(\034\003\260\305\333\000\267\302(\034\003\260\305\333\000\3138\0202\000\3138\0207\000\352\217\000\304\333\303p\014\360~\000\304\333\303p\014\346 \000\304\333\303p\014\350\341\000\304\333\303p\014\324O\000"},
+    {0x2BF7,32,"\304\333\303p\014\353\232\000\304\333\303p\014\356\264\000\301@\002\003\304\254:\000\357\252\014\000\353\236\014\000\305+\014\000\347\266\014\000\300:&\300\236\000\336\217\347\302\014\000\215\006\001\3078\000\215\006\001\307O\000\215\006\001\3118\000\215\006\001\307\307\000\215\006\001\307\222\000\215\006\001\311S\000\215\006\001\311\134\000\215\006\001\306\021\000\215\006\001\311Z\000\215\006\001\304\257\000\215\006\001X\304\257\000\215\006\001;\000\215\006\001\307\220\000\215\006\001\307\362\000\215\006\001\310\032\000\215\006\001\305p\000\215\006\001\310I\000\215\006\001\310m\000\215\006\001\310\216\000\215\006\001\310\262\000\215\006\001\310\334\000\215\006\001\311-\000\215\006\001\3114\000"},
+    {0x2C17,32,"\215\006\001\307\267\000\215\006\001\307\321\000\215\006\001\315/\000\215\006\001\300\363\000\215\006\001\310\317\000\215\006\001\304g\000\215\006\001\305\034\000\215\006\001\300j\000\215\006\001\303/\000\215\006\001\307\033\000\215\006\001\311N\000\215\006\001\316*\203\000\215\006\001\301)\000\215\006\001\004\301w\000\215\006\001\004\301w\003\300\253\000\215\006\001\301i\000\215\006\001\304\255\004\301w\000\215\006\001\302s\301w\000\215\006\001\304\255\302s\301w\000\215\006\001\304.\000\215\006\001\304\260\000\215\006\001\315\371\000\215\006\001\316\250\025\000\215\006\001\3141\305p\000\215\006\001\312\230\305\034\000\215\004\001\3078\000\215\004\001\307O\000\215\004\001\3118\000\215\004\001\307\307\000\215\004\001\307\222\000\215\004\001\311S\000\215\004\001\311\134\000"},
+    {0x2C37,32,"\215\004\001\306\021\000\215\004\001\311Z\000\215\004\001\304\257\000\215\004\001X\304\257\000\215\004\001;\000\215\004\001\307\220\000\215\004\001\307\362\000\215\004\001\310\032\000\215\004\001\305p\000\215\004\001\310I\000\215\004\001\310m\000\215\004\001\310\216\000\215\004\001\310\262\000\215\004\001\310\334\000\215\004\001\311-\000\215\004\001\3114\000\215\004\001\307\267\000\215\004\001\307\321\000\215\004\001\315/\000\215\004\001\300\363\000\215\004\001\310\317\000\215\004\001\304g\000\215\004\001\305\034\000\215\004\001\300j\000\215\004\001\303/\000\215\004\001\307\033\000\215\004\001\311N\000\215\004\001\316*\203\000\215\004\001\301)\000\215\004\001\004\301w\000\215\004\001\004\301w\003\300\253\000\215\004\001\301i\000"},
+    {0x2C57,32,"\215\004\001\304\255\004\301w\000\215\004\001\302s\301w\000\215\004\001\304\255\302s\301w\000\215\004\001\304.\000\215\004\001\304\260\000\215\004\001\315\371\000\215\004\001\316\250\025\000\215\004\001\3141\305p\000\215\004\001\312\230\305\034\000\010\006\001p\0034x\000\010\004\001p\0034x\000\010\006\001p\003M\272\000\010\006\001\300<\003I\000\010\006\001c\003\300\253\000\010\004\001\025\003I\000\010\004\001\300\007\003\274I\000\010\006\001\300\026\003\301\037\000\010\004\001\300\026\003\301\037\000\010\006\001\300\011\003\301\037\000\010\004\001\300\011\003\301\037\000\010\006\001\300 \003\301\037\000\010\004\001\300 \003\301\037\000\010\006\001\300s\000\010\006\001\261\003S\000\010\006\001\241\025\000\010\006\001\241\300s\000\010\004\001\300\015\003&S\000\010\006\001\300P\003S\000\010\004\001\300P\003S\000\010\004\001\300\015\003\301\347\000\010\006\001o\300\026\000\010\004\001o\300\026\000"},
+    {0x2C77,32,"\010\004\001\355\340\301\307\000\010\004\0019\003\314\376\000\010\004\001\241c\003\300\253\000\010\004\0016\003\210\240\302!\000\010\001\004\006\2419\000\010\301'\004\001\300U\000>\001\006\300\015\000\010\006\001d\003\304\354\300\253\000\010\006\001\300 \003\304\354\300\253\000^\006\001\312\036\000^\004\001\312\036\000^\006\001\316\342\000^\004\001\316\342\000^\006\001\301\352\000^\004\001\301\352\000^\006\001\312\320\000^\004\001\312\320\000^\006\001\306\024\000^\004\001\306\024\000^\006\001\316#\000^\004\001\316#\000^\006\001\307\042\000^\004\001\307\042\000^\006\001\313\232\000^\004\001\313\232\000^\006\001\316\177\000^\004\001\316\177\000^\006\001\313\303\000^\004\001\313\303\000^\006\001\306R\000^\004\001\306R\000^\006\001\3142\000"},
+    {0x2C97,32,"^\004\001\3142\000^\006\001\301|\000^\004\001\301|\000^\006\001\301L\000^\004\001\301L\000^\006\001\306^\000^\004\001\306^\000^\006\0016\000^\004\0016\000^\006\001\300\325\000^\004\001\300\325\000^\006\001\301\267\000^\004\001\301\267\000^\006\001\310\322\000^\004\001\310\322\000^\006\001\302\077\000^\004\001\302\077\000^\006\001\304\367\000^\004\001\304\367\000^\006\001\303\014\000^\004\001\303\014\000^\006\001\306U\000^\004\001\306U\000^\006\001\302P\000^\004\001\302P\000^\006\001\306\230\000^\004\001\306\230\000^\006\001\303\276w\000^\004\001\303\276w\000^\006\001%^\300\375\000^\004\001%^\300\375\000^\006\001\303}\306\024\000"},
+    {0x2CB7,32,"^\004\001\303}\306\024\000^\006\001\303\276\306R\000^\004\001\303\276\306R\000^\006\001\303\276\301L\000^\004\001\303\276\301L\000^\006\001\303}\301L\000^\004\001\303}\301L\000^\006\001%^\306\230\000^\004\001%^\306\230\000^\006\001\304\334\000^\004\001\304\334\000^\006\001\302\266\303\372\000^\004\001\302\266\303\372\000^\006\001%^\303\372\000^\004\001%^\303\372\000^\006\001%^\302 \000^\004\001%^\302 \000^\006\001\312\032\304\266\000^\004\001\312\032\304\266\000^\006\001\303\276\304\251\000^\004\001\303\276\304\251\000^\006\001%^\304\251\000^\004\001%^\304\251\000^\006\001%^\203\000^\004\001%^\203\000^\006\001\314\042\203\000^\004\001\314\042\203\000^\006\001%^\313\237\000^\004\001%^\313\237\000^\006\001%^\3046\000^\004\001%^\3046\000^\006\001%^\304\235\000"},
+    {0x2CD7,29,"^\004\001%^\304\235\000^\006\001%^\312\377\000^\004\001%^\312\377\000^\006\001%^\304R\000^\004\001%^\304R\000^\006\001%\302\360\304R\000^\004\001%\302\360\304R\000^\006\001%\302\360\306\211\000^\004\001%\302\360\306\211\000^\006\001%\302\360\302\245\000^\004\001%\302\360\302\245\000^\006\001%\302\360\311=\000^\004\001%\302\360\311=\000^\014\304\263\000^\014\301|\301\267\000^\014\300\325\301\267\000^\014\355\007\000^\014\302\077\301\267\000^\014\306U\301\267\000^\014\304R\310\322\000^\006\001\303}\303\372\000^\004\001\303}\303\372\000^\006\001\303}\304\235\000^\004\001\303}\304\235\000^ \301L'\000^ \316+\322\337\000^ \316+\314:\000^\006\001\312|\304\266\000^\004\001\312|\304\266\000"},
+    {0x2CF9,32,"^%\302\360\300\324\300k\000^%\302\360\307\214\301\216+\000^%\302\360\340,\301\216+\000^%\302\360\3119\304\214\000^\300\0162o\000^\300\324\300k\000^\344z\304\214\000g\004\001\3016\000g\004\001\305\341\000g\004\001\3041\000g\004\001\306\014\000g\004\001\300\276\000g\004\001\307\021\000g\004\001\305\320\000g\004\001\306\364\000g\004\001\300\241\000g\004\001\304\264\000g\004\001\306g\000g\004\001\301\360\000g\004\001\305r\000g\004\001\300\216\000g\004\001\306\236\000g\004\001\307#\000g\004\001\304\330\000g\004\001\304\335\000g\004\001\304]\000g\004\001\303\251\000g\004\001\306\245\000g\004\001\306T\000g\004\001\3060\000g\004\001\305\226\000g\004\001\301[\000"},
+    {0x2D19,13,"g\004\001\305\363\000g\004\001\302\230\000g\004\001\305S\000g\004\001\305\367\000g\004\001\305\360\000g\004\001\307\030\000g\004\001\306M\000g\004\001\3067\000g\004\001\301\027\000g\004\001\305J\000g\004\001\301\300\000g\004\001\304\245\000g\004\001\306>\000"},
+    {0x2D27,1,"g\004\001\305\005\000"},
+    {0x2D2D,1,"g\004\001\304n\000"},
+    {0x2D30,32,"\300\264\001\264\000\300\264\001\361\216\000\300\264\001\361\217\000\300\264\001\361\230\000\300\264\001\361\231\000\300\264\001\312a\312\013\311L\000\300\264\001\311L\000\300\264\001\361\221\000\300\264\001\361\224\000\300\264\001\361\222\000\300\264\001\361\223\000\300\264\001\361\301\000\300\264\001\361\226\000\300\264\001\311M\000\300\264\001\304\020\311M\000\300\264\001\361\235\000\300\264\001\307\032\000\300\264\001\312a\312\013\307\032\000\300\264\001\304\020\307\032\000\300\264\001\361\233\000\300\264\001\305\003\000\300\264\001\317\012\000\300\264\001\304\020\317\012\000\300\264\001\317\016\000\300\264\001\304\020\317\016\000\300\264\001\012\000\300\264\001\311O\000\300\264\001\322R\311O\000\300\264\001\304\020\311O\000\300\264\001\361\236\000\300\264\001\317\013\000\300\264\001\317\014\000"},
+    {0x2D50,24,"\300\264\001\304\020\361\232\000\300\264\001\304\020\303\001\000\300\264\001\317\015\000\300\264\001\301)\000\300\264\001\317\017\000\300\264\001\361\242\000\300\264\001\311K\000\300\264\001\304\020\311K\000\300\264\001\323\015\311K\000\300\264\001\361\243\000\300\264\001\361\245\000\300\264\001\361\244\000\300\264\001\303\255\000\300\264\001\361\246\000\300\264\001\361\220\000\300\264\001\361\247\000\300\264\001\361\251\000\300\264\001\361\252\000\300\264\001\317\021\000\300\264\001\317\022\000\300\264\001\355\374\317\022\000\300\264\001\361\256\000\300\264\001\302o\000\300\264\001\301i\000"},
+    {0x2D6F,2,"\300\264>\001\341\335+\000\300\264\301\270+\000"},
+    {0x2D7F,24,"\300\264\3003\3048\000#\005\342\201\000#\005\344Y\000#\005\351\255\000#\005\354\232\000#\005\354\026\000#\005\324e\000#\005\356\213\000#\005\325\376\000#\005\346\020\000#\005\346\230\000#\005\301I\305~\000#\005\362r\000#\005\332\202\000#\005\331\376\000#\005\340\212\000#\005\356A\000#\005\325Z\000#\005\347\372\000#\005\350:\000#\005\335\273\000#\005\335\277\000#\005\335\276\000#\005\335\275\000"},
+    {0x2DA0,7,"#\005\301&\000#\005\310\352\000#\005\310\350\000#\005\354\321\000#\005\354\337\000#\005\3162\000#\005\310\351\000"},
+    {0x2DA8,7,"#\005\324\374\000#\005\325\020\000#\005\325\016\000#\005\324\375\000#\005\324\377\000#\005\324\376\000#\005\325\017\000"},
+    {0x2DB0,7,"#\005\307%\000#\005\317D\000#\005\317A\000#\005\362\212\000#\005\362\216\000#\005\317@\000#\005\317C\000"},
+    {0x2DB8,7,"#\005\325\001\000#\005\325\015\000#\005\325\013\000#\005\325\002\000#\005\325\003\000#\005\307Y\000#\005\325\014\000"},
+    {0x2DC0,7,"#\005\350\360\000#\005\350\372\000#\005\350\364\000#\005\350\361\000#\005\350\363\000#\005\350\362\000#\005\350\365\000"},
+    {0x2DC8,7,"#\005\310\012\000#\005\341\305\000#\005\341\302\000#\005\341\277\000#\005\306d\000#\005\341\301\000#\005\341\304\000"},
+    {0x2DD0,7,"#\005\317\007\000#\005\361y\000#\005\361q\000#\005\361o\000#\005\361p\000#\005\317\010\000#\005\361r\000"},
+    {0x2DD8,7,"#\005\336.\000#\005\3366\000#\005\3364\000#\005\336/\000#\005\3362\000#\005\3361\000#\005\3365\000"},
+    {0x2DE0,32," *\001\302r\000 *\001\302W\000 *\001\3021\000 *\001\301\350\000 *\001\302q\000 *\001\301\370\000 *\001[\000 *\001\301\334\000 *\001\302,\000 *\001\300\276\000 *\0016\000 *\001\300\363\000 *\001\302z\000 *\001\303\013\000 *\001\301=\000 *\001\203\000 *\001\302\254\000 *\001\301\316\000 *\001\300j\000 *\001\310\310\000 *\001\304.\000 *\001\3349\000 *\001\025\000 *\001\302L\000 *\001\307\217\000 *\001\310:\304\370\000 *\001\303\255\000 *\001\301)\000 *\001\302^\025\000 *\001\300{\301w\000 *\001\302s\301w\000 *\001\302^\302s\301w\000"},
+    {0x2E00,32,"&\300\236\304\351\303\337\000&\300\236\301\016\304\351\303\337\000(\304\351\202\000&\304\351\202\000(\301\016\304\351\202\000&\301\016\304\351\202\000\301T\313\325\303\337\000\301T\301\016\313\325\303\337\000\301\016\311$\303\337\000(\311$\202\000&\311$\202\000\301T,\000(\301T\315$\202\000&\301T\315$\202\000\333\374\3319\000\310y\000\313V\310y\000\300:\313V\310y\000\337\227\000\301\016\347\037\000\267\312&\000\277\312&\000\301\016\301\325\300\236\0004\302O\302\346\000\300\221\305P\000\304\320\307J\000\302\346\003\300b\000\272\003\240'\000(\210\315B\202\000&\210\315B\202\000\272\003<'\000\272\003<:\000"},
+    {0x2E20,32,"(Tx\003\306\265\000&Tx\003\306\265\000\300\365(o\202\000\300\365&o\202\000\3017(o\202\000\3017&o\202\000(\302%1\202\000&\302%1\202\000(4\300\371\000&4\300\371\0007\214\2232<\300\006\0002<\2237\214\300\006\000fO<\300\006\000V<+\000\300:\301\216+\000T\272\000\240\301\252\000\301\344\301\270M<\000\241\300\251\000\301T<\000\301T\300\251\000\241\302\366\000\304 \003(\313\214\000\304 \003&\313\214\000\241\304 \000\300\365o\3013\002\000\3570\301\025\000\356G\301\025\000\355\013\300\324\300k\000Tv\214\000\305\001T\300\201\000\324\346\000"},
+    {0x2E40,30,"4\302\346\000\300:\300\251\0004\342\241\301\177+\000\301\025\003(\3115\0004\310\373+\000\300\221\210\303\220\000\300\221\210\303\220\003\303\220'\000\210\303\220\000\210\303\220\003<\0004\354\371\300\251\000\301\016\301\327\000\300\262\304 \000\310-\300\251\000\347\253+\000\350\211\334\022+\000\3318\3119\304\214\000\300\323\315E\003&\312\276\000\300\323\315E\003(\312\276\000\316\211\002\006\302\273\000\310-\301\257+\000\310-\301\216+\000(,\202\003I\000&,\202\003I\000(,\202\0034I\000&,\202\0034I\000\300\365o(\300\371\000\300\365o&\300\371\000\3017o(\300\371\000\3017o&\300\371\000\302O\302\346\000"},
+    {0x2E80,26,"W/\303\234\000W/\307`\000W/\303\2372\000W/\303\2377\000W/\303\237B\000W/\301\362\000W/e\000W/\311\003\000W/\304\2712\000W/\304\2717\000W/\312\375\000W/\310\277\000W/\0042\000W/\0047\000W/\305b2\000W/\305b7\000W/\305bB\000W/\305bO\000W/\306\344\000W/\311\021\000W/\310\3352\000W/\310\3357\000W/\301{2\000W/\301{7\000W/\301o\000W/\310\251\000"},
+    {0x2E9B,32,"W/\325]\000W/\302l\000W/\301\211\000W/\312\347\000W/\314\273\000W/\325\203\000W/\302\2552\000W/\302\2557\000W/\303\016\000W/\310~2\000W/\310~7\000W/\305\250o\303h\316\252\000W/\305!\000W/\304\215\000W/\313\334\000W/\307HK\307b\000W/\303D\000W/\306\3462\000W/\306\3467\000W/\307=\000W/\310\321\000W/\301\346\310\321\000W/\304\3112\000W/\304\3117\000W/\304\311B\000W/\304\311O\000W/\314\241\000W/\310\311\000W/\306\272\000W/\313A\000W/%\000W/\304\1772\000"},
+    {0x2EBB,32,"W/\304\1777\000W/\306y\000W/\314\272\000W/\30632\000W/\30637\000W/\3063B\000W/\306\370\000W/\307c\000W/\300\3102\000W/\300\3107\000W/\301\346\304O\000W/\305\250\301R\000W/\301R\000W/\301\346\304V\000W/\301\346\301g\000W/\306'\000W/\301\346\312\227\000W/\305\250\305\305\000W/\305\3052\000W/\305\3057\000W/\312\257\000W/\301\346\3062\000W/\2532\000W/\2537\000W/\301\346\253\000W/\301\346\313j\000W/\310>2\000W/\310>7\000W/\304N\000W/\303\267\000W/\301\346\316i\310\021\000W/\301\346\301\356\000"},
+    {0x2EDB,25,"W/\301\346\303-\000W/\301\346\307\260\000W/\304\2212\000W/\304\2217\000W/\304\221B\000W/\301\346\304\221\000W/\301\225\000W/\301\346\303\214\000W/\305\347\000W/\307\304\000W/\301\346\303F\000W/\301\346\305\346\000W/\301\346\303]\000W/\305\250\311A\000W/\305\250\305\313\000W/\301\346\307\270\000W/\306K\304\231\000W/\301\346\304\231\000W/\306K\306\376\000W/\301\346\306\376\000W/\306K\303\302\000W/\301\346\303\302\000W/\305\276\000W/\306K\305\276\000W/\301\346\305\276\000"},
+    {0x2F00,32,"P/2\000P/\300\201\000P/<\000P/\302j\000P/\303\237\000P/S\000P/7\000P/\314B\000P/\301\360\000P/\3426\000P/\3133\000P/u\000P/te\000P/\307q\000P/\303\321\000P/\311\003\000P/\262e\000P/\304\271\000P/\304\326\000P/\361,\000P/\310\345\000P/&\262e\000P/\336\265\307\233\000P/\300H\000P/\312\375\000P/\310\277\000P/\307`\000P/\350m\000P/\322K\000P/\300\347\000P/\307\233\000P/\302\134\000"},
+    {0x2F20,32,"P/\352z\000P/\302\236\000P/\302\236\354\213\000P/\334L\000P/\302s\000P/\304\026\000P/\307\134\000P/\351\266\000P/\340$\000P/\004\000P/\305b\000P/\331;\000P/\354\311\000P/\303\342\000P/\351\243\000P/\311F\000P/\347>\000P/\316\274\000P/\307\224\000P/\300w\311\021\000P/\301\016\307`\000P/\253\355!\000P/7\303\212\000P/\354\032\000P/\304|\000P/\310\335\000P/\324\207\000P/\310\354\000P/\301{\000P/\336Y\000P/\313\005\000P/\301o\000"},
+    {0x2F40,32,"P/\307J\000P/\310\251\000P/\236\000P/\332a\000P/\3076\000P/,\000P/\300\224\000P/\302l\000P/\315\331\000P/\301\211\000P/\303h\000P/\341\340\000P/\300k\000P/\312\347\000P/\360\365\000P/\302\013\300\224\000P/\326\022\000P/\313^\000P/\302\010\000P/\3167\000P/\302\255\000P/\303\016\000P/\325\213\000P/\313F\000P/4\300>\000P/o\303h\316\252\000P/\316\025\000P/\334\270\000P/\305!\000P/\304\215\000P/\350o\000P/\313\334\000"},
+    {0x2F60,32,"P/\314\235\000P/~\000P/\316J\000P/\342\134\000P/\357\275\000P/\313I\000P/\307HK\307b\000P/\354S\000P/\301\016\311\010\000P/@\000P/\354y\000P/\301\333\000P/\303D\000P/\316'\000P/\034\000P/\310\357\000P/\306\346\000P/\316\231\000P/\336\011\000P/\324\372\000P/\354\375\000P/\307=\000P/\304\332\000P/\310\321\000P/\313\335\000P/\304\311\000P/\310\311\000P/\306!\000P/%\000P/\031\000P/\3501\000P/\304(\000"},
+    {0x2F80,32,"P/\304\177\000P/\306y\000P/\344G\000P/\315\340\000P/\322\315\000P/\314\272\000P/\302U\000P/\347K\000P/\312z\000P/\355\022\000P/\326\012\000P/\3063\000P/\306\370\000P/\3406\000P/\312v\000P/\305\305\307\233\000P/\307c\000P/\300\310\000P/\304O\000P/\301R\000P/\304V\000P/\360!\000P/\324$\000P/\306\250\000P/\312P\000P/\301g\000P/\302$\000P/\351\347\000P/\306'\000P/\312{\000P/\312\227\000P/\324[\000"},
+    {0x2FA0,32,"P/\344y\000P/\305\305\000P/\312\257\000P/\307\025\000P/\332l\000P/\360\177\000P/\3062\000P/\253\000P/\313j\000P/\310>\000P/\354~\000P/\300w\302m\305\346\000P/\304N\000P/\303\267\000P/\3610\000P/i\000P/\310\021\000P/\316i\310\021\000P/\3421\000P/\302S\000P/\301\356\000P/\303-\000P/\307\260\000P/\304\221\000P/\301\225\000P/\335\026\000P/\303\214\000P/\305\347\000P/\304\355\000P/\3045\000P/\334\324\000P/\352E\307\025\000"},
+    {0x2FC0,22,"P/\312\231\000P/\307\304\000P/\303F\000P/\305\346\000P/\303]\000P/\307\206\000P/\311A\000P/\336\221\000P/\305\313\000P/\344B\000P/8\000P/\334\031\000P/\307\270\000P/\356\301\000P/\304\216\000P/\306\273\000P/\303\033\000P/\304\231\000P/\306\376\000P/\303\302\000P/\305\276\000P/\313P\000"},
+    {0x2FF0,12,"\237\302\335\300\034(C&\000\237\302\335\300\034'C:\000\237\302\335\300\034(CM\031&\000\237\302\335\300\034'CM\031:\000\237\302\335\300\034\300\324\304X\000\237\302\335\300\034\304X\301A'\000\237\302\335\300\034\304X\301A:\000\237\302\335\300\034\304X\301A(\000\237\302\335\300\034\304X\301As(\000\237\302\335\300\034\304X\301As&\000\237\302\335\300\034\304X\301Al(\000\237\302\335\300\034\310s\000"},
+    {0x3000,32,"\237\301\364\000\237\300\251\000\237\300\324\300k\000\332o+\000\303\322\340-\3165\014\000\237\303\217+\000\237\305\036+\000\237\036\300%\000(\300\236\202\000&\300\236\202\000(4\300\236\202\000&4\300\236\202\000(\3018\202\000&\3018\202\000(@\3018\202\000&@\3018\202\000(8\303\327\202\000&8\303\327\202\000\306\254+\000\335\241+\000(\301\276\301g\202\000&\301\276\301g\202\000(@\303\327\202\000&@\303\327\202\000(@\301\276\301g\202\000&@\301\276\301g\202\000(@,\202\000&@,\202\000\301\134\301\025\000\300:4\302\364\301\177+\0004\302\364\301\177+\000\2104\302\364\301\177+\000"},
+    {0x3020,32,"\306\254+i\000\302\345\300\1342\000\302\345\300\1347\000\302\345\300\134B\000\302\345\300\134O\000\302\345\300\134V\000\302\345\300\134v\000\302\345\300\134\201\000\302\345\300\134u\000\302\345\300\134\211\000\237\314>\212+\000\237\302\207\212+\000\237\307\211\212+\000\237\334%\212+\000\035\300N<\212+\000\0354<\212+\000\303+\301\025\000T\305X\303\234+\000T\305X\303\234\003\303l\302S+\000T\305X\303\234+so\000T\305X\303\234\003\303l\302S+so\000T\305X\303\234+lo\000.\306\254+\000\237\300\205\300\201\307\247\301\270\014\000\302\345\300\134\300H\000\302\345\300\134\300\351\000\302\345\300\134\301\200\000T\237\303\217+\000\343\265+\000\310|\322w+\000\237D\301Y\000\237o\302-\301\364\000"},
+    {0x3041,32,"\300\035\001\004\025\000\300\035\001\025\000\300\035\001\004;\000\300\035\001;\000\300\035\001\0041\000\300\035\0011\000\300\035\001\0049\000\300\035\0019\000\300\035\001\0046\000\300\035\0016\000\300\035\001[\000\300\035\001\300\005\000\300\035\001\301\323\000\300\035\001\301\321\000\300\035\001\301\355\000\300\035\001\302H\000\300\035\001\301\377\000\300\035\001\303J\000\300\035\001\301\303\000\300\035\001\302\236\000\300\035\001\271\000\300\035\001\300\341\000\300\035\001\301\340\000\300\035\001\3030\000\300\035\001\301\365\000\300\035\001\303\005\000\300\035\001\301\363\000\300\035\001\301\370\000\300\035\001\301\273\000\300\035\001\303\004\000\300\035\001\265\000\300\035\001\300\001\000"},
+    {0x3061,32,"\300\035\001\302&\000\300\035\001\302\036\000\300\035\001\004\301\313\000\300\035\001\301\313\000\300\035\001\302\037\000\300\035\001\301=\000\300\035\001\301\350\000\300\035\001C\000\300\035\001\302\013\000\300\035\001\256\000\300\035\001\301L\000\300\035\001\301e\000\300\035\001\301K\000\300\035\001\301#\000\300\035\001\203\000\300\035\001\300\042\000\300\035\001\230\000\300\035\001\3019\000\300\035\001\302\034\000\300\035\001\300\325\000\300\035\001\302\237\000\300\035\001\301\255\000\300\035\001\302\312\000\300\035\001\301\027\000\300\035\001\302r\000\300\035\001\300\363\000\300\035\001\301\242\000\300\035\001\302\332\000\300\035\001\3029\000\300\035\001\251\000\300\035\001\301|\000\300\035\001\301!\000"},
+    {0x3081,22,"\300\035\001\301S\000\300\035\001\301\361\000\300\035\001\004\264\000\300\035\001\264\000\300\035\001\004\301)\000\300\035\001\301)\000\300\035\001\004\301i\000\300\035\001\301i\000\300\035\001\235\000\300\035\001\302d\000\300\035\001\301\337\000\300\035\001\302:\000\300\035\001\301\267\000\300\035\001\004\300q\000\300\035\001\300q\000\300\035\001\301\367\000\300\035\001\301\300\000\300\035\001\301\331\000\300\035\001\232\000\300\035\001\304i\000\300\035\001\004[\000\300\035\001\004\301\377\000"},
+    {0x3099,32," \304:\303l\302S+\000 \304:\310\302\302S+\000\304:\303l\302S+\000\304:\310\302\302S+\000\300\035\303\217+\000\300\035\303l\303\217+\000\300\035\301k\361\335\000\304:4\302\346\000H\001\004\025\000H\001\025\000H\001\004;\000H\001;\000H\001\0041\000H\0011\000H\001\0049\000H\0019\000H\001\0046\000H\0016\000H\001[\000H\001\300\005\000H\001\301\323\000H\001\301\321\000H\001\301\355\000H\001\302H\000H\001\301\377\000H\001\303J\000H\001\301\303\000H\001\302\236\000H\001\271\000H\001\300\341\000H\001\301\340\000H\001\3030\000"},
+    {0x30B9,32,"H\001\301\365\000H\001\303\005\000H\001\301\363\000H\001\301\370\000H\001\301\273\000H\001\303\004\000H\001\265\000H\001\300\001\000H\001\302&\000H\001\302\036\000H\001\004\301\313\000H\001\301\313\000H\001\302\037\000H\001\301=\000H\001\301\350\000H\001C\000H\001\302\013\000H\001\256\000H\001\301L\000H\001\301e\000H\001\301K\000H\001\301#\000H\001\203\000H\001\300\042\000H\001\230\000H\001\3019\000H\001\302\034\000H\001\300\325\000H\001\302\237\000H\001\301\255\000H\001\302\312\000H\001\301\027\000"},
+    {0x30D9,32,"H\001\302r\000H\001\300\363\000H\001\301\242\000H\001\302\332\000H\001\3029\000H\001\251\000H\001\301|\000H\001\301!\000H\001\301S\000H\001\301\361\000H\001\004\264\000H\001\264\000H\001\004\301)\000H\001\301)\000H\001\004\301i\000H\001\301i\000H\001\235\000H\001\302d\000H\001\301\337\000H\001\302:\000H\001\301\267\000H\001\004\300q\000H\001\300q\000H\001\301\367\000H\001\301\300\000H\001\301\331\000H\001\232\000H\001\304i\000H\001\004[\000H\001\004\301\377\000H\001\300\307\000H\001\303\253\000"},
+    {0x30F9,7,"H\001\302W\000H\001\303k\000HM<\000\304:\315{\302S+\000H\303\217+\000H\303l\303\217+\000H\301k\314\023\000"},
+    {0x3105,32,"\300e\001\077\000\300e\001\300<\000\300e\001\261\000\300e\001\300u\000\300e\001\300\024\000\300e\001\300\007\000\300e\001\232\000\300e\001p\000\300e\001\300\003\000\300e\001\300\011\000\300e\001\300\026\000\300e\001\300U\000\300e\001\300\260\000\300e\001\300>\000\300e\001\362F\000\300e\001\312\243\000\300e\001\304P\000\300e\001c\000\300e\001\300 \000\300e\001\3005\000\300e\001d\000\300e\001\025\000\300e\0016\000\300e\0019\000\300e\001\303B\000\300e\001\300L\000\300e\001\303\177\000\300e\001\300d\000\300e\001\303\354\000\300e\001\3016\000\300e\001\300\276\000\300e\001\302\262\000"},
+    {0x3125,11,"\300e\001\302\341\000\300e\001\302z\000\300e\001;\000\300e\0011\000\300e\001\305R\000\300e\001\300\015\000\300e\001\302\022\000\300e\001\335\361\000\300e\001\307\335\000\300e\0016\003<'\000\300e\001\305z\000"},
+    {0x3131,32,"\035\001\303\326\000\035\001\306\353\000\035\001\307\377\000\035\001\303\346\000\035\001\306\212\000\035\001\306\213\000\035\001\304\015\000\035\001\306\356\000\035\001\303\365\000\035\001\306\301\000\035\001\306\302\000\035\001\306\303\000\035\001\306\304\000\035\001\310\256\000\035\001\310\255\000\035\001\306\300\000\035\001\303\341\000\035\001\303\362\000\035\001\306\354\000\035\001\306\247\000\035\001\303\374\000\035\001\306\355\000\035\001\303\215\000\035\001\303y\000\035\001\306\352\000\035\001\303\272\000\035\001\303\325\000\035\001\304\011\000\035\001\303\360\000\035\001\303\317\000\035\001\025\000\035\001\301X\000"},
+    {0x3151,32,"\035\001\264\000\035\001\305\311\000\035\001\3050\000\035\0019\000\035\001\311P\000\035\001\302o\000\035\0016\000\035\001\300q\000\035\001\311<\000\035\001\301\007\000\035\001\301i\000\035\0011\000\035\001\311@\000\035\001\301\300\000\035\001\301\367\000\035\001\301)\000\035\001\303\203\000\035\001\012\000\035\001;\000\035\303\204\000\035\001\310\347\000\035\001\310Y\000\035\001\310X\000\035\001\314\360\000\035\001\315\263\000\035\001\310\257\000\035\001\315\266\000\035\001\315\265\000\035\001\315\270\000\035\001\3104\000\035\001\3105\000\035\001\314\253\000"},
+    {0x3171,30,"\035\001\307\363\000\035\001\315_\000\035\001\310\211\000\035\001\315a\000\035\001\310\210\000\035\001\310\207\000\035\001\315b\000\035\001\307\365\000\035\001\313\361\000\035\001\310\324\000\035\001\316\015\000\035\001\310\326\000\035\001\310\325\000\035\001\310\323\000\035\001\310x\000\035\001\310\346\000\035\001\311R\000\035\001\317\025\000\035\001\317\024\000\035\001\307\364\000\035\001\3160\000\035\001\311Q\000\035\001\317\032\000\035\001\317\033\000\035\001\317\031\000\035\001\317!\000\035\001\317 \000\035\001\317\037\000\035\001\3123\000\035\001\322\274\000"},
+    {0x3190,32,"\237\302\030\342q+\000\237\302\030\302\003+\000\237\302\0302+\000\237\302\0307+\000\237\302\030B+\000\237\302\030O+\000\237\302\030\300\365+\000\237\302\030M+\000\237\302\030\3017+\000\237\302\030\303\205+\000\237\302\030\303\237+\000\237\302\030\302\321+\000\237\302\030\306*+\000\237\302\030\306;+\000\237\302\030\302\134+\000\237\302\030\301\360+\000\300e\001\301\255\000\300e\001\3030\000\300e\001\303\323\000\300e\001\302H\000\300e\001\301\017\000\300e\001\307\234\000\300e\001\300\354\000\300e\001\315'\000\300e\001\305Q\000\300e\001\322\230\000\300e\001\3403\000\300e\001\316\326\000\300e\001\302}\000\300e\001\345h\000\300e\001\322[\000\300e\001\322\372\000"},
+    {0x31B0,32,"\300e\001\3032\000\300e\001\302\303\000\300e\001\315&\000\300e\001\3404\000\300e3\001\300<\000\300e3\001\300\007\000\300e3\001\300\011\000\300e3\001\300\026\000\300e\001\335\300\000\300e\001\310\026\000\300e\001\317\077\000\300e3\001\300\003\000\300e\001\336*\000\300e\001\310\007\000\300e\001\301\007\000\300e\001\302\324\000WI\300\007\000WI\361\001\000WI\361S\000WI\324\253\000WI\316G\000WI\337\235\000WI\337\231\000WI\306@\000WI\337\234\000WI\355\241\000WI\337\232\000WI\337\236\000WI\337d\000WI\337\233\000WI\337\237\000WI\232\000"},
+    {0x31D0,20,"WI\300\026\000WId\000WI\300<\000WI\354\255\000WI\300\024\000WI\313\301\000WI\313\243\000WI\355\230\000WI\355k\000WI\310\353\000WI\353\354\000WI\347\310\000WI\350\245\000WI\356\203\000WI\355\242\000WI\355d\000WI\337\224\000WI\337\240\000WI\347\355\000WI\300\260\000"},
+    {0x31F0,32,"H\001\004\301\355\000H\001\004\301\340\000H\001\004\301\365\000H\001\004C\000H\001\004\301e\000H\001\004\203\000H\001\004\3019\000H\001\004\302\237\000H\001\004\301\027\000H\001\004\301\242\000H\001\004\301!\000H\001\004\235\000H\001\004\302d\000H\001\004\301\337\000H\001\004\302:\000H\001\004\301\267\000\204\035\303\326\000\204\035\303\346\000\204\035\304\015\000\204\035\303\365\000\204\035\303\341\000\204\035\303\362\000\204\035\303\374\000\204\035\303\215\000\204\035\303y\000\204\035\303\272\000\204\035\303\325\000\204\035\304\011\000\204\035\303\360\000\204\035\303\317\000\204\035\303\326\025\000\204\035\303\346\025\000"},
+    {0x3210,15,"\204\035\304\015\025\000\204\035\303\365\025\000\204\035\303\341\025\000\204\035\303\362\025\000\204\035\303\374\025\000\204\035\303\215\025\000\204\035\303y\025\000\204\035\303\272\025\000\204\035\303\325\025\000\204\035\304\011\025\000\204\035\303\360\025\000\204\035\303\317\025\000\204\035\303y1\000\204\305^\300\034\3475\000\204\305^\300\0346\302\237\000"},
+    {0x3220,32,"\204\300'2\000\204\300'7\000\204\300'B\000\204\300'O\000\204\300'V\000\204\300'v\000\204\300'\201\000\204\300'u\000\204\300'\211\000\204\300'\300H\000\204\300'\301\211\000\204\300'\303\016\000\204\300'\302\255\000\204\300'\311E\000\204\300'\314\243\000\204\300'\302\134\000\204\300'\302l\000\204\300'\310\356\000\204\300'\313\233\000\204\300'\316\035\000\204\300'\303\345\000\204\300'\316(\000\204\300'\313K\000\204\300'\312\265\000\204\300'\314$\000\204\300'\351f\000\204\300'\307V\000\204\300'\316;\000\204\300'\316E\000\204\300'\3134\000\204\300'\315\251\000\204\300'\312\042\000"},
+    {0x3240,32,"\204\300'\334\314\000\204\300'\302;\000\204\300'\315\340\000\204\300'\315\237\000.\300'\301\216\000.\300'\341=\000.\300'\310\276\000.\300'\314\023\000.\036\300H\300\2168,\000.\036\300\351\300\2168,\000.\036\301\200\300\2168,\000.\036\301\237\300\2168,\000.\036\301H\300\2168,\000.\036\302R\300\2168,\000.\036\301V\300\2168,\000.\036\302w\300\2168,\000\315C\002\000.\036\300\3512\000.\036\300\3517\000.\036\300\351B\000.\036\300\351O\000.\036\300\351V\000.\036\300\351v\000.\036\300\351\201\000.\036\300\351u\000.\036\300\351\211\000.\036\301\200\000.\036\301\2002\000.\036\301\2007\000.\036\301\200B\000.\036\301\200O\000.\036\301\200V\000"},
+    {0x3260,32,".\035\303\326\000.\035\303\346\000.\035\304\015\000.\035\303\365\000.\035\303\341\000.\035\303\362\000.\035\303\374\000.\035\303\215\000.\035\303y\000.\035\303\272\000.\035\303\325\000.\035\304\011\000.\035\303\360\000.\035\303\317\000.\035\303\326\025\000.\035\303\346\025\000.\035\304\015\025\000.\035\303\365\025\000.\035\303\341\025\000.\035\303\362\025\000.\035\303\374\025\000.\035\303\215\025\000.\035\303y\025\000.\035\303\272\025\000.\035\303\325\025\000.\035\304\011\025\000.\035\303\360\025\000.\035\303\317\025\000.\305^\300\034\325,\000.\305^\300\034\340\225\000.\035\303\2151\000\305^\3165\014\000"},
+    {0x3280,32,".\300'2\000.\300'7\000.\300'B\000.\300'O\000.\300'V\000.\300'v\000.\300'\201\000.\300'u\000.\300'\211\000.\300'\300H\000.\300'\301\211\000.\300'\303\016\000.\300'\302\255\000.\300'\311E\000.\300'\314\243\000.\300'\302\134\000.\300'\302l\000.\300'\310\356\000.\300'\313\233\000.\300'\316\035\000.\300'\303\345\000.\300'\316(\000.\300'\313K\000.\300'\312\265\000.\300'\314$\000.\300'\352\215\000.\300'\303T\000.\300'\304\233\000.\300'\355K\000.\300'\334O\000.\300'\315y\000.\300'\322\365\000"},
+    {0x32A0,32,".\300'\340N\000.\300'\302;\000.\300'\3314\000.\300'\331<\000.\300'\217\000.\300'\300\222\000.\300'\210\000.\300'(\000.\300'&\000.\300'\343\327\000.\300'\351^\000.\300'\316;\000.\300'\316E\000.\300'\3134\000.\300'\315\251\000.\300'\312\042\000.\300'\306\214\000.\036\301\200v\000.\036\301\200\201\000.\036\301\200u\000.\036\301\200\211\000.\036\301\237\000.\036\301\2372\000.\036\301\2377\000.\036\301\237B\000.\036\301\237O\000.\036\301\237V\000.\036\301\237v\000.\036\301\237\201\000.\036\301\237u\000.\036\301\237\211\000.\036\301H\000"},
+    {0x32C0,32,"\237\300\205\014)\340\134\000\237\300\205\014)\334\303\000\237\300\205\014)\343\245\000\237\300\205\014)\322\260\000\237\300\205\014)\314\223\000\237\300\205\014)\340\230\000\237\300\205\014)\340\227\000\237\300\205\014)\322\371\000\237\300\205\014)\353\237\000\237\300\205\014)\347,\000\237\300\205\014)\346\037\000\237\300\205\014)\332\017\000,\313\243\000,\3344\000,\307\240\000\342h\342T\002\000.H\025\000.H;\000.H1\000.H9\000.H6\000.H[\000.H\301\323\000.H\301\355\000.H\301\377\000.H\301\303\000.H\271\000.H\301\340\000.H\301\365\000.H\301\363\000.H\301\273\000.H\265\000"},
+    {0x32E0,32,".H\302&\000.H\301\313\000.H\301=\000.HC\000.H\256\000.H\301L\000.H\301e\000.H\301K\000.H\301#\000.H\203\000.H\3019\000.H\302\237\000.H\301\027\000.H\301\242\000.H\251\000.H\301|\000.H\301!\000.H\301S\000.H\301\361\000.H\264\000.H\301)\000.H\301i\000.H\235\000.H\302d\000.H\301\337\000.H\302:\000.H\301\267\000.H\300q\000.H\301\367\000.H\301\300\000.H\301\331\000,\3051\303\345\351Z\000"},
+    {0x3300,32,",\322\246\000,\322\325\000,\322\233\000,\321\316\000,\3401\000,\340;\000,\357\257\000,\334@\000,\333\377\000,\347A\000,\347D\000,\340\315\000,\340\333\000,\340\336\000,\335\200\000,\335{\000,\335\340\000,\335\342\000,\341\306\000,\335\347\000,\341@\000,\341A\000,\341B\000,\341C\000,\336\042\000,\336#\000,\341\246\000,\341\243\000,\340\371\000,\341w\000,\341r\000,\352H\000"},
+    {0x3320,32,",\352d\000,\354j\000,\353\233\000,\353\234\000,\331\315\000,\332+\000,\332\215\000,\356\223\000,\344\377\000,\346\036\000,\336X\000,\347v\000,\347w\000,\323\334\000,\350\004\000,\350\026\000,\350\025\000,\324S\000,\337k\000,\337m\000,\324\243\000,\337u\000,\336\214\000,\315S\000,\347\330\000,\336\227\000,\347\333\000,\347\323\000,\324+\000,\350@\000,\324m\000,\307\326\000"},
+    {0x3340,32,",\350G\000,\337*\000,\337(\000,\343\212\000,\343\215\000,\343\210\000,\343\255\000,\343\234\000,\344=\000,\344L\000,\344M\000,\3100\000,\343\334\000,\343\331\000,\361\213\000,\361\215\000,\361\362\000,\351\241\000,\351\240\000,\351\356\000,\351\363\000,\351a\000,\351b\000,\360\357\000\237\300\205\014)\301\263\300%\000\237\300\205\014)\301\2632\000\237\300\205\014)\301\2637\000\237\300\205\014)\301\263B\000\237\300\205\014)\301\263O\000\237\300\205\014)\301\263V\000\237\300\205\014)\301\263v\000\237\300\205\014)\301\263\201\000"},
+    {0x3360,32,"\237\300\205\014)\301\263u\000\237\300\205\014)\301\263\211\000\237\300\205\014)\301\263\300H\000\237\300\205\014)\301\263\302\340\000\237\300\205\014)\301\263\302\220\000\237\300\205\014)\301\263\304\012\000\237\300\205\014)\301\263\303\312\000\237\300\205\014)\301\263\303\015\000\237\300\205\014)\301\263\303`\000\237\300\205\014)\301\263\303\371\000\237\300\205\014)\301\263\303\200\000\237\300\205\014)\301\263\303\347\000\237\300\205\014)\301\263\300\351\000\237\300\205\014)\301\263\316\301\000\237\300\205\014)\301\263\3110\000\237\300\205\014)\301\263\316\302\000\237\300\205\014)\301\263\316\300\000,\337c\000,\300\001\000,\300d\000,x\000,\3151\000,\347\307\000,\307\221\000,\307\221f\000,\307\221\305\042\000,\305R\000,\3051\303\345\336\213\000,\3051\303\345\355\217\000,\3051\303\345\355\341\000,\3051\303\345\343\335\000,\331:\000"},
+    {0x3380,32,",\230\322\201\000,\256\000,\301!\025\000,\251\000,[\000,\340\355\000,\310'\000,\335\205\000,\324\331\000,\340\356\000,\347\354\000,\345Z\000,\301!\300u\000,\301!\300\003\000,\343\376\000,\313\374\000,\313\301\000,\341'\000,\344\042\000,\335\327\000,\356Y\000,\301!p\000,\344Q\000,\332x\000,\341X\000,\334\374\000,\345\375\000,\301!\261\000,\306\177\000,\307e\000,\306Z\000,\306\177f\000"},
+    {0x33A0,32,",\307ef\000,\261f\000,\306Zf\000,\306\177\305\042\000,\307e\305\042\000,\261\305\042\000,\306Z\305\042\000,\261\223d\000,\261\223df\000,\230\000,\305_\000,\314\276\000,\336\005\000,\306\267\000,\306\267\223d\000,\306\267\223df\000,\350{\000,\346@\000,\301!d\000,\344\216\000,\350\235\000,\310e\000,\301!\300\015\000,\305o\000,\341\255\000,\305o\3100\000,\350\236\000,\346\207\000,\301!\300P\000,\314\303\000,\310\007\000,\314\303\3100\000"},
+    {0x33C0,32,",\300\011\306\225\000,\261\306\225\000,\3032\000,\324y\000,\312\234\000,\312\235\000,\3005\223\313\374\000,\302\334\000,\312\335\000,\336-\000,\203\000,\306@\000,\300\241\000,\306X\000,\306Z\006\000,\341\212\000,\342\177\000,\342\200\000,\342\207\000,\342\263\000,\310'\004\000,\344>\000,\344m\000,\347\356\000,\3509\000,\350]\000,\350_\000,\354\320\000,\310\374\000,\360\360\000,\300\015\223\261\000,\025\223\261\000"},
+    {0x33E0,32,"\237\300\205\014)\301a2\000\237\300\205\014)\301a7\000\237\300\205\014)\301aB\000\237\300\205\014)\301aO\000\237\300\205\014)\301aV\000\237\300\205\014)\301av\000\237\300\205\014)\301a\201\000\237\300\205\014)\301au\000\237\300\205\014)\301a\211\000\237\300\205\014)\301a\300H\000\237\300\205\014)\301a\302\340\000\237\300\205\014)\301a\302\220\000\237\300\205\014)\301a\304\012\000\237\300\205\014)\301a\303\312\000\237\300\205\014)\301a\303\015\000\237\300\205\014)\301a\303`\000\237\300\205\014)\301a\303\371\000\237\300\205\014)\301a\303\200\000\237\300\205\014)\301a\303\347\000\237\300\205\014)\301a\300\351\000\237\300\205\014)\301a\316\301\000\237\300\205\014)\301a\3110\000\237\300\205\014)\301a\316\302\000\237\300\205\014)\301a\316\300\000\237\300\205\014)\301a\307\010\000\237\300\205\014)\301a\357-\000\237\300\205\014)\301a\357,\000\237\300\205\014)\301a\357*\000\237\300\205\014)\301a\357+\000\237\300\205\014)\301a\301\200\000\237\300\205\014)\301a\356>\000,\303\210\000"},
+    {0x4DC0,32,"\300\234)\301\011\331H\306;\000\300\234)\301\011\351K\302\134\000\300\234)\332R\301\234\301\011\324.\000\300\234)\361\337\335\001\000\300\234)\316\354\000\300\234)\331\036\000\300\234)\301\011\322\310\000\300\234)\304\247\306\373\000\300\234)\004\316g\000\300\234)\356\263\000\300\234)\310\177\000\300\234)\354\377\000\300\234)\334\307\000\300\234)\304\242\315t\000\300\234)\344_\000\300\234)\334&\000\300\234)\313R\000\300\234)\311F\300\216\301\011\332\016\000\300\234)\322\256\000\300\234)\331&\000\300\234)\312k\302\216\000\300\234)\307\310\000\300\234)\354\277\322\247\000\300\234)\305\235\000\300\234)\3405\000\300\234)\304\242\316g\000\300\234)\300\347\304\206\000\300\234)\304\242\315x\000\300\234)\301\011\322*\302\255\000\300\234)\301\011\325\222\303\016\000\300\234)\340.\000\300\234)\333\253\000"},
+    {0x4DE0,32,"\300\234)\351p\000\300\234)\304\242\304\326\000\300\234)\350p\000\300\234)\312\332K\301\011{\000\300\234)\301\011\313D\000\300\234)\310p\000\300\234)\347'\000\300\234)\332\035\000\300\234)\312\351\000\300\234)\307\336\000\300\234)\324\200\000\300\234)\326\020C\314\234\000\300\234)\307\272\306\373\000\300\234)\350\226\316\330\000\300\234)\347L\000\300\234)\301\011\360\372\000\300\234)\351u\000\300\234)\301\011\312\231\000\300\234)\301\011\322\313\311\023\000\300\234)\301\011\313\365\355\016\303\342\000\300\234)\332/\000\300\234)\301\011\343\253\343\211\000\300\234)\322)\000\300\234)\301\011\360\345\000\300\234)\301\011\335\234\303-\000\300\234)\301\011\340\220\314)\000\300\234)\332g\000\300\234)\342g\000\300\234)\313\322\356\343\000\300\234)\004\315x\000\300\234)\322J\307g\000\300\234)\324,\307g\000"},
+    {0xA000,32,"\012\005\307\351\000\012\005\313\331\000\012\005;\000\012\005\340B\000\012\005\337\375\000\012\005\340\014\000\012\005\302L\000\012\005\337\374\000\012\005\301\234\000\012\005\312C\000\012\005\025\000\012\005\312,\000\012\005\357\261\000\012\005\316\327\000\012\005\357\260\000\012\005\306\231\000\012\005\306\232\000\012\0056\000\012\005\310n\000\012\005\306\034\000\012\0059\000\012\005\303.\000\012\005\312j\000\012\005\324\134\000\012\005\302\034\000\012\005\324Q\000\012\005\324I\000\012\005\324J\000\012\005\324G\000\012\005\324H\000\012\005\307\077\000\012\005\324\004\000"},
+    {0xA020,32,"\012\005\300\042\000\012\005\323\366\000\012\005\324\234\000\012\005\324\232\000\012\005\324\233\000\012\005\324p\000\012\005e\000\012\005\302\332\000\012\005\324i\000\012\005\3247\000\012\005\302r\000\012\005\3245\000\012\005\3037\000\012\005\324\251\000\012\005\301\255\000\012\005\324\236\000\012\005\324\241\000\012\005\303t\000\012\005\324\257\000\012\005\324\260\000\012\005\302\333\000\012\005\324\254\000\012\005\324\256\000\012\005\324\255\000\012\005\315i\000\012\005\350%\000\012\005\300\325\000\012\005\315e\000\012\005\350\024\000\012\005\315\134\000\012\005\350\011\000\012\005\347\275\000"},
+    {0xA040,32,"\012\005\347\304\000\012\005\230\000\012\005\3028\000\012\005\350\216\000\012\005\350\214\000\012\005\350\215\000\012\005\306\255\000\012\005\350Z\000\012\005\3029\000\012\005\310\221\000\012\005\310\237\000\012\005\350\233\000\012\005\302\312\000\012\005\315\201\000\012\005\350\225\000\012\005\350\220\000\012\005\315\205\000\012\005\350\244\000\012\005\350\240\000\012\005\350\241\000\012\005\350\243\000\012\005\350\242\000\012\005\324\022\000\012\005\324\023\000\012\005\312V\000\012\005\324\021\000\012\005\324\017\000\012\005\324\020\000\012\005\324\015\000\012\005\324\016\000\012\005\324\010\000\012\005\324\011\000"},
+    {0xA060,32,"\012\005\304\035\000\012\005\324\007\000\012\005\324\031\000\012\005\324\027\000\012\005\324\030\000\012\005\324\025\000\012\005\324\026\000\012\005\312W\000\012\005\324\024\000\012\005\324\014\000\012\005\305\022\000\012\005\324\013\000\012\005\312Y\000\012\005\324\035\000\012\005\312X\000\012\005\324\032\000\012\005\324\034\000\012\005\324\033\000\012\005\324 \000\012\005\324!\000\012\005\324\036\000\012\005\324\037\000\012\005\345\025\000\012\005\345\026\000\012\005\345\021\000\012\005\345\024\000\012\005\345\023\000\012\005\314\324\000\012\005\345\022\000\012\005\345\017\000\012\005\345\020\000\012\005\345\015\000"},
+    {0xA080,32,"\012\005\345\016\000\012\005\345\031\000\012\005\345\032\000\012\005\345\027\000\012\005\345\030\000\012\005\345\037\000\012\005\345 \000\012\005\345\033\000\012\005\345\034\000\012\005\345\036\000\012\005\345\035\000\012\005\345%\000\012\005\345&\000\012\005\345!\000\012\005\345\042\000\012\005\345$\000\012\005\345#\000\012\005\336\357\000\012\005\336\360\000\012\005\336\352\000\012\005\336\356\000\012\005\336\355\000\012\005\336\353\000\012\005\336\354\000\012\005\336\347\000\012\005\336\350\000\012\005\336\345\000\012\005\336\346\000\012\005\336\367\000\012\005\336\365\000\012\005\336\366\000\012\005\336\362\000"},
+    {0xA0A0,32,"\012\005\336\363\000\012\005\313\257\000\012\005\336\361\000\012\005\336\373\000\012\005\336\374\000\012\005\336\364\000\012\005\336\370\000\012\005\336\372\000\012\005\336\371\000\012\005\337\002\000\012\005\336\375\000\012\005\336\376\000\012\005\337\001\000\012\005\336\377\000\012\005\3108\000\012\005\344O\000\012\005\301|\000\012\005\344J\000\012\005\3448\000\012\005\344-\000\012\005\344.\000\012\005\343\266\000\012\005\343\274\000\012\005\251\000\012\005\305f\000\012\005\344\245\000\012\005\344\246\000\012\005\344\242\000\012\005\344\244\000\012\005\344~\000\012\005\344\207\000\012\005\301\361\000"},
+    {0xA0C0,32,"\012\005\314\271\000\012\005\343\365\000\012\005\301S\000\012\005\344\257\000\012\005\344\263\000\012\005\301!\000\012\005\344\247\000\012\005\344\254\000\012\005\344\251\000\012\005\344\270\000\012\005\344\271\000\012\005\314\310\000\012\005\344\267\000\012\005\334\346\000\012\005\334\351\000\012\005\303\014\000\012\005\334\336\000\012\005\334\275\000\012\005\307\246\000\012\005\301\026\000\012\005\334\271\000\012\005\313Y\000\012\005\303\017\000\012\005\335\010\000\012\005\335'\000\012\005\335(\000\012\005\303\207\000\012\005\335$\000\012\005\335%\000\012\005\313^\000\012\005\335-\000\012\005\335.\000"},
+    {0xA0E0,32,"\012\005\335*\000\012\005\335,\000\012\005\360\210\000\012\005\360\215\000\012\005\303\253\000\012\005\360\203\000\012\005\300p\000\012\005\360}\000\012\005\360x\000\012\005\360y\000\012\005\360+\000\012\005\360.\000\012\005\300\307\000\012\005\360#\000\012\005\360\233\000\012\005\360\236\000\012\005\303k\000\012\005\360\232\000\012\005\360p\000\012\005\316\340\000\012\005\360\245\000\012\005\360\246\000\012\005\304i\000\012\005\360\243\000\012\005\360\244\000\012\005\316\353\000\012\005\360\256\000\012\005\360\257\000\012\005\311;\000\012\005\360\253\000\012\005\360\255\000\012\005\360\254\000"},
+    {0xA100,32,"\012\005\332n\000\012\005\332u\000\012\005\302\036\000\012\005\332_\000\012\005\332N\000\012\005\303\277\000\012\005\332L\000\012\005\312\333\000\012\005\331\353\000\012\005\300\001\000\012\005\307\177\000\012\005\333\246\000\012\005\333\245\000\012\005<\000\012\005\333\225\000\012\005\302\013\000\012\005\332\213\000\012\005\3320\000\012\005\301\350\000\012\005\332$\000\012\005\333\257\000\012\005\333\261\000\012\005\302\037\000\012\005\333\247\000\012\005\333\254\000\012\005\333\251\000\012\005\316\212\000\012\005\356|\000\012\005\302&\000\012\005\302\005\000\012\005\356f\000\012\005\304\362\000"},
+    {0xA120,32,"\012\005\356e\000\012\005\316k\000\012\005\355\375\000\012\005\265\000\012\005\355\356\000\012\005\316\272\000\012\005\357\032\000\012\005\357\030\000\012\005\357\031\000\012\005\316\225\000\012\005\356\250\000\012\005C\000\012\005\300\365\000\012\005\356*\000\012\005\301=\000\012\005\356\036\000\012\005\357!\000\012\005\357%\000\012\005\301\313\000\012\005\316\273\000\012\005\357 \000\012\005\304\366\000\012\005\331\374\000\012\005\331\375\000\012\005\312\344\000\012\005\331\373\000\012\005\331\372\000\012\005\331\370\000\012\005\331\371\000\012\005\331\357\000\012\005\331\360\000\012\005\300\335\000"},
+    {0xA140,32,"\012\005\331\356\000\012\005\332\005\000\012\005\332\003\000\012\005\332\004\000\012\005\332\001\000\012\005\332\002\000\012\005\307\204\000\012\005\331\377\000\012\005\331\363\000\012\005\312\341\000\012\005\331\362\000\012\005\332\010\000\012\005\332\011\000\012\005\312\345\000\012\005\332\006\000\012\005\332\007\000\012\005\312\346\000\012\005\3458\000\012\005\3459\000\012\005\310M\000\012\005\3456\000\012\005\3455\000\012\005\3454\000\012\005\345+\000\012\005\345,\000\012\005\304\310\000\012\005\310K\000\012\005\345=\000\012\005\345>\000\012\005\310N\000\012\005\345<\000\012\005\3451\000"},
+    {0xA160,32,"\012\005\306\206\000\012\005\345-\000\012\005\345C\000\012\005\345D\000\012\005\306\207\000\012\005\345@\000\012\005\345B\000\012\005\345A\000\012\005\337\020\000\012\005\337\021\000\012\005\337\012\000\012\005\337\017\000\012\005\337\015\000\012\005\337\016\000\012\005\337\013\000\012\005\337\014\000\012\005\337\004\000\012\005\337\006\000\012\005\307\324\000\012\005\337\003\000\012\005\337\027\000\012\005\337\026\000\012\005\337\023\000\012\005\337\024\000\012\005\337\022\000\012\005\337\011\000\012\005\337\007\000\012\005\337\010\000\012\005\337\030\000\012\005\345\300\000\012\005\345\302\000\012\005\301L\000"},
+    {0xA180,32,"\012\005\345\275\000\012\005\345\260\000\012\005\345\252\000\012\005\345\253\000\012\005\345\011\000\012\005\256\000\012\005\345\003\000\012\005\346\200\000\012\005\346~\000\012\005\346\177\000\012\005\300\224\000\012\005\346\042\000\012\005\301#\000\012\005\346\032\000\012\005\345X\000\012\005\301K\000\012\005\345R\000\012\005\315\013\000\012\005\346\206\000\012\005\301e\000\012\005\346\201\000\012\005\346\203\000\012\005\346\202\000\012\005\336\320\000\012\005\336\321\000\012\005\307\323\000\012\005\336\317\000\012\005\336\316\000\012\005\336\314\000\012\005\336\315\000\012\005\336\306\000\012\005\336\310\000"},
+    {0xA1A0,32,"\012\005\313\256\000\012\005\336\305\000\012\005\336\330\000\012\005\336\326\000\012\005\336\327\000\012\005\336\324\000\012\005\336\322\000\012\005\336\323\000\012\005\336\313\000\012\005\336\311\000\012\005\336\312\000\012\005\336\334\000\012\005\336\335\000\012\005\336\325\000\012\005\336\331\000\012\005\336\333\000\012\005\336\332\000\012\005\336\342\000\012\005\336\343\000\012\005\336\336\000\012\005\336\337\000\012\005\336\341\000\012\005\336\340\000\012\005\342v\000\012\005\342y\000\012\005\300\227\000\012\005\306m\000\012\005\342Z\000\012\005\342[\000\012\005\314C\000\012\005\342Y\000\012\005\342\037\000"},
+    {0xA1C0,32,"\012\005\342&\000\012\005\252\000\012\005\310\015\000\012\005\342\253\000\012\005\342\254\000\012\005\342\251\000\012\005\342\252\000\012\005\342\233\000\012\005\342\242\000\012\005\302\020\000\012\005\342\226\000\012\005\342K\000\012\005\300\345\000\012\005\342C\000\012\005\342\261\000\012\005\342\262\000\012\005\301\265\000\012\005\342\255\000\012\005\342\257\000\012\005\342\256\000\012\005\342\272\000\012\005\342\273\000\012\005\310\037\000\012\005\342\270\000\012\005\342\271\000\012\005\314Z\000\012\005\335\351\000\012\005\335\352\000\012\005\301\321\000\012\005\335\343\000\012\005\335\334\000\012\005\335\335\000"},
+    {0xA1E0,32,"\012\005\335\332\000\012\005\335\333\000\012\005\335\202\000\012\005\335\204\000\012\005\300\005\000\012\005\304\236\000\012\005\336\037\000\012\005\336 \000\012\005\336\035\000\012\005\336\036\000\012\005\313\205\000\012\005\336\004\000\012\005\302\236\000\012\005\335\375\000\012\005\335\240\000\012\005\335\242\000\012\005\303J\000\012\005\313t\000\012\005\336'\000\012\005\336(\000\012\005\302H\000\012\005\336!\000\012\005\336&\000\012\005\3066\000\012\005\314\010\000\012\005\341J\000\012\005\301\323\000\012\005\314\007\000\012\005\3417\000\012\005\3414\000\012\005\3416\000\012\005\340\340\000"},
+    {0xA200,32,"\012\005\340\354\000\012\005[\000\012\005\313\357\000\012\005\341\237\000\012\005\341\234\000\012\005\310\006\000\012\005\341x\000\012\005\341|\000\012\005\301\303\000\012\005\341t\000\012\005\304<\000\012\005\341\022\000\012\005\301\377\000\012\005\341\002\000\012\005\306`\000\012\005\341\253\000\012\005\301\355\000\012\005\341\240\000\012\005\341\247\000\012\005\302\042\000\012\005\335\257\000\012\005\335\260\000\012\005\313w\000\012\005\335\256\000\012\005\335\254\000\012\005\335\255\000\012\005\335\246\000\012\005\335\247\000\012\005\304\237\000\012\005\335\245\000\012\005\335\264\000\012\005\335\265\000"},
+    {0xA220,32,"\012\005\313{\000\012\005\335\263\000\012\005\335\261\000\012\005\335\262\000\012\005\313x\000\012\005\313y\000\012\005\335\252\000\012\005\335\253\000\012\005\307\302\000\012\005\335\251\000\012\005\335\271\000\012\005\335\272\000\012\005\313z\000\012\005\335\266\000\012\005\335\270\000\012\005\335\267\000\012\005\344\024\000\012\005\344\023\000\012\005\344\002\000\012\005\344\003\000\012\005\343\377\000\012\005\344\001\000\012\005\344\033\000\012\005\344\031\000\012\005\344\032\000\012\005\344\026\000\012\005\344\027\000\012\005\302\203\000\012\005\344\025\000\012\005\344\022\000\012\005\344\020\000\012\005\344\021\000"},
+    {0xA240,32,"\012\005\344\037\000\012\005\344 \000\012\005\344\030\000\012\005\344\034\000\012\005\344\036\000\012\005\344\035\000\012\005\313\274\000\012\005\337\215\000\012\005\337\207\000\012\005\337\214\000\012\005\337\212\000\012\005\337\213\000\012\005\337\210\000\012\005\337\211\000\012\005\337\202\000\012\005\337\203\000\012\005\337\200\000\012\005\337\201\000\012\005\337\222\000\012\005\337\223\000\012\005\313\276\000\012\005\337\221\000\012\005\337\217\000\012\005\337\220\000\012\005\337\216\000\012\005\313\275\000\012\005\337\206\000\012\005\337\204\000\012\005\337\205\000\012\005\345}\000\012\005\345{\000\012\005\345|\000"},
+    {0xA260,32,"\012\005\345b\000\012\005\345c\000\012\005\300c\000\012\005\345`\000\012\005\345\230\000\012\005\345\231\000\012\005\345\227\000\012\005\345\217\000\012\005\345\220\000\012\005\304F\000\012\005\314\354\000\012\005\345g\000\012\005\314\340\000\012\005\345e\000\012\005\313\254\000\012\005\336\273\000\012\005\305J\000\012\005\3046\000\012\005\336s\000\012\005\203\000\012\005\336i\000\012\005\337s\000\012\005\337t\000\012\005\337q\000\012\005\337r\000\012\005\305L\000\012\005\337a\000\012\005\301\242\000\012\005\337,\000\012\005\336\230\000\012\005\301\027\000\012\005\336\222\000"},
+    {0xA280,32,"\012\005\360\355\000\012\005\316\362\000\012\005\300q\000\012\005\316\356\000\012\005\3618\000\012\005\317\003\000\012\005\3617\000\012\005\361+\000\012\005\301\331\000\012\005\361#\000\012\005\360\377\000\012\005\301\300\000\012\005\360\374\000\012\005\362o\000\012\005\362p\000\012\005\3030\000\012\005\362l\000\012\005\362h\000\012\005\362f\000\012\005\362g\000\012\005\362;\000\012\005\362=\000\012\005\300\341\000\012\005\3627\000\012\005\362}\000\012\005\362{\000\012\005\362|\000\012\005\317<\000\012\005\362u\000\012\005\303\004\000\012\005\362t\000\012\005\362E\000"},
+    {0xA2A0,32,"\012\005\301\370\000\012\005\362B\000\012\005\362\177\000\012\005\362\200\000\012\005\303\005\000\012\005\317=\000\012\005\362~\000\012\005\317>\000\012\005\362\210\000\012\005\362\211\000\012\005\317\077\000\012\005\362\205\000\012\005\362\207\000\012\005\362\206\000\012\005\325\201\000\012\005\325\204\000\012\005\305\366\000\012\005\312\255\000\012\005\325w\000\012\005\325{\000\012\005\325u\000\012\005\325v\000\012\005\302\265\000\012\005\324\373\000\012\005\300m\000\012\005\305\356\000\012\005\331Y\000\012\005\331X\000\012\005\312\303\000\012\005\331>\000\012\005\331D\000\012\005\302\334\000"},
+    {0xA2C0,32,"\012\005\3312\000\012\005\325&\000\012\005\303u\000\012\005\325!\000\012\005\307y\000\012\005\331d\000\012\005\307v\000\012\005\305#\000\012\005\331`\000\012\005\331\134\000\012\005\312\314\000\012\005\331n\000\012\005\312\311\000\012\005\312\313\000\012\005\331m\000\012\005\331k\000\012\005\362\225\000\012\005\362\226\000\012\005\317A\000\012\005\362\224\000\012\005\317B\000\012\005\362\223\000\012\005\362\221\000\012\005\362\222\000\012\005\362\214\000\012\005\362\215\000\012\005\307%\000\012\005\362\213\000\012\005\362\230\000\012\005\317C\000\012\005\362\227\000\012\005\362\220\000"},
+    {0xA2E0,32,"\012\005\317@\000\012\005\362\217\000\012\005\362\236\000\012\005\317D\000\012\005\362\233\000\012\005\362\235\000\012\005\362\234\000\012\005\362\244\000\012\005\362\245\000\012\005\362\237\000\012\005\362\241\000\012\005\362\243\000\012\005\362\242\000\012\005\346\262\000\012\005\346\263\000\012\005\346\255\000\012\005\346\261\000\012\005\346\260\000\012\005\346\256\000\012\005\346\257\000\012\005\346\250\000\012\005\346\251\000\012\005\310j\000\012\005\346\246\000\012\005\346\271\000\012\005\346\270\000\012\005\346\265\000\012\005\346\264\000\012\005\346\254\000\012\005\346\252\000\012\005\346\275\000\012\005\346\266\000"},
+    {0xA300,32,"\012\005\315\031\000\012\005\346\274\000\012\005\346\273\000\012\005\346\302\000\012\005\346\303\000\012\005\346\276\000\012\005\346\277\000\012\005\346\301\000\012\005\346\300\000\012\005\354m\000\012\005v\000\012\005\301\340\000\012\005\354i\000\012\005\354X\000\012\005\354U\000\012\005\354W\000\012\005\310\272\000\012\005\352r\000\012\005\271\000\012\005\315\326\000\012\005\355R\000\012\005\355P\000\012\005\355Q\000\012\005\310\341\000\012\005\354\253\000\012\005\301\273\000\012\005\354\244\000\012\005\353\254\000\012\005\301\363\000\012\005\353\235\000\012\005\355^\000\012\005\355`\000"},
+    {0xA320,32,"\012\005\301\365\000\012\005\355S\000\012\005\355[\000\012\005\306\360\000\012\005\355\226\000\012\005\355\227\000\012\005\355l\000\012\005\355\220\000\012\005\355\225\000\012\005\355\221\000\012\005\354\350\000\012\005\354\351\000\012\005\310\350\000\012\005\354\347\000\012\005\354\346\000\012\005\354\344\000\012\005\354\345\000\012\005\354\335\000\012\005\354\336\000\012\005\301&\000\012\005\354\334\000\012\005\354\353\000\012\005\354\354\000\012\005\310\351\000\012\005\354\352\000\012\005\354\341\000\012\005\3162\000\012\005\354\340\000\012\005\354\356\000\012\005\354\357\000\012\005\310\352\000\012\005\354\355\000"},
+    {0xA340,32,"\012\005\354\364\000\012\005\354\365\000\012\005\354\360\000\012\005\354\361\000\012\005\354\363\000\012\005\354\362\000\012\005\362J\000\012\005\362K\000\012\005\301\371\000\012\005\362I\000\012\005\362X\000\012\005\362V\000\012\005\362W\000\012\005\362T\000\012\005\362U\000\012\005\311]\000\012\005\362S\000\012\005\362N\000\012\005\362O\000\012\005\302q\000\012\005\362M\000\012\005\362\134\000\012\005\362]\000\012\005\311^\000\012\005\362Y\000\012\005\362[\000\012\005\362Z\000\012\005\362c\000\012\005\362d\000\012\005\362_\000\012\005\362`\000\012\005\362b\000"},
+    {0xA360,32,"\012\005\362a\000\012\005\312\246\000\012\005\3255\000\012\005\300\220\000\012\005\3250\000\012\005\325g\000\012\005\325h\000\012\005\325e\000\012\005\325f\000\012\005\325`\000\012\005\325a\000\012\005\303\010\000\012\005\325^\000\012\005\325E\000\012\005\325F\000\012\005\301\316\000\012\005\325\077\000\012\005\325l\000\012\005\305\365\000\012\005\325i\000\012\005\325k\000\012\005\325j\000\012\005\325s\000\012\005\325t\000\012\005\325o\000\012\005\325p\000\012\005\325r\000\012\005\325q\000\012\005\351\300\000\012\005\302\024\000\012\005\351\312\000\012\005\351\311\000"},
+    {0xA380,32,"\012\005\351\305\000\012\005\351\306\000\012\005\315\305\000\012\005\351\304\000\012\005\351\302\000\012\005\351\303\000\012\005\315\304\000\012\005\351\301\000\012\005\351\316\000\012\005\351\317\000\012\005\351\310\000\012\005\351\313\000\012\005\351\315\000\012\005\351\314\000\012\005\351\324\000\012\005\351\325\000\012\005\351\320\000\012\005\351\321\000\012\005\351\323\000\012\005\351\322\000\012\005\346)\000\012\005\346*\000\012\005\310`\000\012\005\346(\000\012\005\3462\000\012\005\3460\000\012\005\3461\000\012\005\346.\000\012\005\346/\000\012\005\346+\000\012\005\346,\000\012\005\3468\000"},
+    {0xA3A0,32,"\012\005\3469\000\012\005\3463\000\012\005\3465\000\012\005\3467\000\012\005\3466\000\012\005\346>\000\012\005\346\077\000\012\005\346:\000\012\005\346;\000\012\005\346=\000\012\005\346<\000\012\005\315\355\000\012\005\353\375\000\012\005\300j\000\012\005\353\367\000\012\005\354<\000\012\005\354:\000\012\005\354;\000\012\005\354'\000\012\005\354+\000\012\005\303#\000\012\005\315\364\000\012\005\315\357\000\012\005\354\016\000\012\005\300\374\000\012\005\354\005\000\012\005\354\077\000\012\005\354A\000\012\005\302\215\000\012\005\354=\000\012\005\354>\000\012\005\315\372\000"},
+    {0xA3C0,32,"\012\005\354I\000\012\005\354J\000\012\005\316\001\000\012\005\354F\000\012\005\354H\000\012\005\354G\000\012\005\306\273\000\012\005\351\077\000\012\005\235\000\012\005\310\251\000\012\005\351\354\000\012\005\351\352\000\012\005\351\353\000\012\005\351\274\000\012\005\351\277\000\012\005\301\267\000\012\005\351\271\000\012\005\351v\000\012\005\302:\000\012\005\351c\000\012\005\351\362\000\012\005\351\364\000\012\005\301\337\000\012\005\351\355\000\012\005\351\360\000\012\005\351\357\000\012\005\352\001\000\012\005\352\002\000\012\005\315\312\000\012\005\351\375\000\012\005\351\377\000\012\005\351\376\000"},
+    {0xA3E0,32,"\012\005\340s\000\012\005\340t\000\012\005\303\323\000\012\005\340r\000\012\005\340o\000\012\005\340p\000\012\005\340m\000\012\005\340n\000\012\005\340\234\000\012\005\340\235\000\012\005\340\232\000\012\005\340\233\000\012\005\303\324\000\012\005\340\217\000\012\005\303\022\000\012\005\340\215\000\012\005\340\242\000\012\005\340\244\000\012\005\3049\000\012\005\340\236\000\012\005\340\241\000\012\005\340\240\000\012\005\340\251\000\012\005\340\252\000\012\005\340\245\000\012\005\340\246\000\012\005\340\250\000\012\005\340\247\000\012\005\350\316\000\012\005\350\317\000\012\005\305\227\000\012\005\350\315\000"},
+    {0xA400,32,"\012\005\350\312\000\012\005\350\313\000\012\005\350\310\000\012\005\350\311\000\012\005\350\344\000\012\005\350\345\000\012\005\310\246\000\012\005\350\343\000\012\005\315\212\000\012\005\350\324\000\012\005\306\264\000\012\005\350\322\000\012\005\350\352\000\012\005\350\354\000\012\005\305\230\000\012\005\350\346\000\012\005\350\350\000\012\005\350\347\000\012\005\350\371\000\012\005\350\373\000\012\005\350\357\000\012\005\350\366\000\012\005\350\370\000\012\005\350\367\000\012\005\340{\000\012\005\340|\000\012\005\313\341\000\012\005\340z\000\012\005\340x\000\012\005\340y\000\012\005\313\342\000\012\005\340w\000"},
+    {0xA420,32,"\012\005\340\202\000\012\005\340\200\000\012\005\340\201\000\012\005\340~\000\012\005\340\177\000\012\005\313\343\000\012\005\340}\000\012\005\313\345\000\012\005\340\206\000\012\005\313\344\000\012\005\340\203\000\012\005\340\205\000\012\005\340\204\000\012\005\340\210\000\012\005\340\211\000\012\005\313\346\000\012\005\340\207\000\012\005\345\320\000\012\005\345\321\000\012\005\304\313\000\012\005\345\317\000\012\005\345\315\000\012\005\345\316\000\012\005\345\312\000\012\005\345\314\000\012\005\345\326\000\012\005\345\325\000\012\005\345\323\000\012\005\345\324\000\012\005\314\367\000\012\005\345\322\000\012\005\345\333\000"},
+    {0xA440,32,"\012\005\310]\000\012\005\345\327\000\012\005\345\332\000\012\005\345\331\000\012\005\345\340\000\012\005\345\341\000\012\005\345\334\000\012\005\345\335\000\012\005\345\337\000\012\005\345\336\000\012\005\315\027\000\012\005\346\226\000\012\005\302\245\000\012\005\315\026\000\012\005\346\221\000\012\005\346\222\000\012\005\346\217\000\012\005\346\220\000\012\005\346\241\000\012\005\346\237\000\012\005\346\240\000\012\005\346\233\000\012\005\346\234\000\012\005\303\226\000\012\005\315\030\000\012\005\346\243\000\012\005\346\244\000\012\005\310i\000\012\005\346\242\000\012\005\361\134\000\012\005\361]\000\012\005\302\223\000"},
+    {0xA460,32,"\012\005\361Z\000\012\005\361X\000\012\005\361Y\000\012\005\361V\000\012\005\361W\000\012\005\361g\000\012\005\361f\000\012\005\361b\000\012\005\361c\000\012\005\317\005\000\012\005\361_\000\012\005\361x\000\012\005\361z\000\012\005\361n\000\012\005\361u\000\012\005\361w\000\012\005\361v\000\012\005\311T\000\012\005\361\314\000\012\005\012\000\012\005\361\313\000\012\005\361\306\000\012\005\361\307\000\012\005\317\030\000\012\005\361\305\000\012\005\361\371\000\012\005\361\372\000\012\005\361\367\000\012\005\317%\000\012\005\305\316\000\012\005\361\342\000\012\005\301i\000"},
+    {0xA480,13,"\012\005\361\334\000\012\005\307\037\000\012\005\361\377\000\012\005\301)\000\012\005\361\373\000\012\005\361\375\000\012\005\361\374\000\012\005\362\006\000\012\005\362\007\000\012\005\311Y\000\012\005\362\003\000\012\005\362\005\000\012\005\362\004\000"},
+    {0xA490,32,"\012/\315\212\000\012/\300\227\000\012/\314\010\000\012/\315\026\000\012/\312\313\000\012/\310\350\000\012/\313y\000\012/\313t\000\012/\301|\000\012/\313\274\000\012/\314Z\000\012/\312Y\000\012/\314\271\000\012/\301i\000\012/\310\237\000\012/\313\276\000\012/\316k\000\012/\300\005\000\012/\317=\000\012/\312\314\000\012/\312\346\000\012/\303t\000\012/\313{\000\012/\315\030\000\012/\301\313\000\012/\310n\000\012/\313\345\000\012/\317<\000\012/\315\205\000\012/\313\257\000\012/\311T\000\012/\316\353\000"},
+    {0xA4B0,23,"\012/\316\001\000\012/\316\340\000\012/\300\341\000\012/\303\022\000\012/\315\031\000\012/\313\346\000\012/\313\205\000\012/\313\342\000\012/\301\331\000\012/\302\037\000\012/\315\372\000\012/\314C\000\012/\312\311\000\012/\312\303\000\012/\312\255\000\012/\313\275\000\012/\315\355\000\012/\317>\000\012/\315\364\000\012/\301\316\000\012/\317B\000\012/\314\324\000\012/\301\377\000"},
+    {0xA4D0,32,"\300\346\001\300\042\000\300\346\001\230\000\300\346\001\300\306\000\300\346\001\300\001\000\300\346\001\265\000\300\346\001\300\254\000\300\346\001\300\005\000\300\346\001[\000\300\346\001\300\223\000\300\346\001\300g\000\300\346\001\300m\000\300\346\001\300\220\000\300\346\001\302\271\000\300\346\001\301\201\000\300\346\001\302\217\000\300\346\001\251\000\300\346\001\256\000\300\346\001\252\000\300\346\001\271\000\300\346\001\301\371\000\300\346\001\300\341\000\300\346\001\300c\000\300\346\001\203\000\300\346\001\302\222\000\300\346\001\303\213\000\300\346\001\301\026\000\300\346\001\300q\000\300\346\001\300j\000\300\346\001\264\000\300\346\001\300\361\000\300\346\001\025\000\300\346\001\301X\000"},
+    {0xA4F0,32,"\300\346\0019\000\300\346\001\303\203\000\300\346\001;\000\300\346\0016\000\300\346\0011\000\300\346\001\301\343\000\300\346\001\3112\000\300\346\001\301\007\000\300\346\001\212\304\304\302&\000\300\346\001\212\256\3029\000\300\346\001\212\304\304\312\312\000\300\346\001\212\304\304\302\332\000\300\346\001\212\304\304\256\000\300\346\001\212\304\304\340f\000\300\346\300\006\300\251\000\300\346\300\006\300\324\300k\000=\005\301\017\000=\005\334\001\000=\005\306<\000=\005\307\023\000=\005\360\371\000=\005\303\227\000=\005\324=\000=\005\304w\000=\005\306w\000=\005\314\026\000=\005\344\007\000=\005\313l\000=\005\304-\000=\005\304\023\000=\005\304\357\000=\005\305\264\000"},
+    {0xA510,32,"=\005\332:\000=\005\332=\000=\005\306h\000=\005\305\233\000=\005\304\211\000=\005\310L\000=\005\304O\000=\005\306\326\000=\005\305\317\000=\005\307$\000=\005\312\237\000=\005\304\261\000=\005\305y\000=\005\305\004\000=\005\307\371\000=\005\314\343\000=\005\305>\000=\005\310.\000=\005\310O\000=\005\315\024\000=\005;\000=\005\300\241\000=\005\3019\000=\005\313\251\000=\005\301\367\000=\005\361\020\000=\005\300\325\000=\005\324>\000=\005\302\034\000=\005\310(\000=\005\314\027\000=\005\344\012\000"},
+    {0xA530,32,"=\005\313m\000=\005\303\014\000=\005\303\253\000=\005\302&\000=\005\304c\000=\005\332B\000=\005\332>\000=\005\300\227\000=\005\302d\000=\005\302\036\000=\005\310M\000=\005\301\340\000=\005\304\341\000=\005\3030\000=\005\311[\000=\005\305\366\000=\005\303\323\000=\005\304\313\000=\005\012\000=\005\301\323\000=\005\314\345\000=\005\301\321\000=\005\301|\000=\005\301L\000=\005\302\245\000=\005\025\000=\005\3016\000=\005\345^\000=\005\203\000=\005\313\227\000=\005\300q\000=\005\360\343\000"},
+    {0xA550,32,"=\005\230\000=\005\301\004\000=\005\300\042\000=\005\305i\000=\005\305_\000=\005\341~\000=\005\314\245\000=\005\307\275\000=\005\301\026\000=\005\300\307\000=\005\265\000=\005\300\254\000=\005\300\353\000=\005\332;\000=\005\252\000=\005\235\000=\005\300\001\000=\005\304\310\000=\005\271\000=\005\300j\000=\005\300\341\000=\005\301\371\000=\005\300m\000=\005\300g\000=\005\314\363\000=\005\264\000=\005[\000=\005\304\264\000=\005\305w\000=\005\300\005\000=\005\251\000=\005\256\000"},
+    {0xA570,32,"=\005\300\225\000=\005\300\354\000=\005\347E\000=\005\305K\000=\005\305\310\000=\005\361\042\000=\005\305\223\000=\005\324\077\000=\005\312}\000=\005\310+\000=\005\314\030\000=\005\344\016\000=\005\313o\000=\005\307\263\000=\005\316\351\000=\005\304\363\000=\005\311\017\000=\005\332D\000=\005\332@\000=\005\304\300\000=\005\315\302\000=\005\313\004\000=\005\314\326\000=\005\305\252\000=\005\310\315\000=\005\317;\000=\005\362R\000=\005\307o\000=\005\313\350\000=\005\314\370\000=\005\307\035\000=\005\305]\000"},
+    {0xA590,32,"=\005\310U\000=\005\335\373\000=\005\310<\000=\005\310_\000=\005\346\232\000=\0051\000=\005\303\251\000=\005\302\237\000=\005\313\272\000=\005\303.\000=\005\3615\000=\005\302\312\000=\005\324@\000=\005\301\255\000=\005\310,\000=\005\314\031\000=\005\344\017\000=\005\307\276\000=\005\303\207\000=\005\304i\000=\005\301\313\000=\005\311\022\000=\005\332F\000=\005\332A\000=\005\301\265\000=\005\301\337\000=\005\302\037\000=\005\306\207\000=\005\301\365\000=\005\302\215\000=\005\303\005\000=\005\311^\000"},
+    {0xA5B0,32,"=\005\307v\000=\005\3049\000=\005\310]\000=\005\301)\000=\005\301\355\000=\005\310V\000=\005\302H\000=\005\301!\000=\005\301e\000=\005\310i\000=\0056\000=\005\300\216\000=\005\314\353\000=\005\301\242\000=\005\307\326\000=\005\301\331\000=\005\311D\000=\005\3029\000=\005\312d\000=\005\302\332\000=\005\310*\000=\005\306\134\000=\005\344\014\000=\005\313n\000=\005\335\214\000=\005\303\017\000=\005\303k\000=\005C\000=\005\302\004\000=\005\312\364\000=\005\332\077\000=\005\302\020\000"},
+    {0xA5D0,32,"=\005\301\267\000=\005\302\013\000=\005\310N\000=\005\301\273\000=\005\303#\000=\005\303\004\000=\005\311]\000=\005\302\334\000=\005\303\022\000=\005\314\367\000=\005\301i\000=\005\301\303\000=\005\310T\000=\005\302\236\000=\005\301\361\000=\005\301#\000=\005\303\226\000=\0059\000=\005\300\276\000=\005\314\341\000=\005\301\027\000=\005\313\240\000=\005\301\300\000=\005\360\373\000=\005\300\363\000=\005\305\345\000=\005\302r\000=\005\306v\000=\005\314\025\000=\005\341\200\000=\005\344\006\000=\005\306/\000"},
+    {0xA5F0,32,"=\005\335\210\000=\005\302\343\000=\005\302W\000=\005\301=\000=\005\301\011\000=\005\305&\000=\005\332<\000=\005\300\345\000=\005\302:\000=\005\301\350\000=\005\306\206\000=\005\301\363\000=\005\300\374\000=\005\301\370\000=\005\302q\000=\005\303u\000=\005\302\347\000=\005\303\351\000=\005\302o\000=\005\301\377\000=\005\310R\000=\005\310S\000=\005\303J\000=\005\335\230\000=\005\301S\000=\005\301K\000=\005\310g\000=\005\302\022\000=\005\306k\000=\300\251\000=\300\324\300k\000=\301\216+\000"},
+    {0xA610,28,"=\005\305t\301\026\000=\005\305t[\000=\005\305t\305\252\000=\014\334\305\000=\014\340\370\000=\014\356r\000=\014\314\361\000=\014\323\363\000=\014\306 \000=\014\304Y\000=\014\305\376\000=\014\332\212\000=\014\341\233\000=\014\356\233\000=\014\332\201\000=\014\340\214\000=\017\300%\000=\0172\000=\0177\000=\017B\000=\017O\000=\017V\000=\017v\000=\017\201\000=\017u\000=\017\211\000=\005\305t\251\000=\005\305t\302\013\000"},
+    {0xA640,32,"*\006\001\3173\000*\004\001\3173\000*\006\001\306\021\000*\004\001\306\021\000*\006\001\300:\303\303\000*\004\001\300:\303\303\000*\006\001\300\312\000*\004\001\300\312\000*\006\001\307\217\000*\004\001\307\217\000*\006\001\310:\304\370\000*\004\001\310:\304\370\000*\006\001\312\210\300n\000*\004\001\312\210\300n\000*\006\001\301\020\305\315\000*\004\001\301\020\305\315\000*\006\001\303/\003\302\327\305\315\000*\004\001\303/\003\302\327\305\315\000*\006\001\302^\303\255\000*\004\001\302^\303\255\000*\006\001\300:\301)\000*\004\001\300:\301)\000*\006\001\302^\025\000*\004\001\302^\025\000*\006\001\301\005\300{\301w\000*\004\001\301\005\300{\301w\000*\006\001\312n\301w\000*\004\001\312n\301w\000*\006\001\302^\301\005\300{\301w\000*\004\001\302^\301\005\300{\301w\000*\006\001\305\005\000*\004\001\305\005\000"},
+    {0xA660,32,"*\006\001\300:\302\254\000*\004\001\300:\302\254\000*\006\001\302\251\301\350\000*\004\001\302\251\301\350\000*\006\001\302\251\301\334\000*\004\001\302\251\301\334\000*\006\001\302\251\302,\000*\004\001\302\251\302,\000*\006\001\306\2006\000*\004\001\306\2006\000*\006\001\312i6\000*\004\001\312i6\000*\006\0014\306\2006\000*\004\0014\306\2006\000*\001\344\2356\000 *\360\261\000 *\300H\304B\002\000 *\207\304B\002\000 *\254\304B\002\000\354\177\300\367\000 *\001\3113\302L\000 *\001;\000 *\001\012\000 *\0011\000 *\001\303L\002\000 *\001\303/\000 *\001\302\251\002\000 *\001\300n\000 *\303\220\000 *\315G\000*\303\220\000*\315G\000"},
+    {0xA680,32,"*\006\001\307\227\000*\004\001\307\227\000*\006\001\313\030\000*\004\001\313\030\000*\006\001\3174\000*\004\001\3174\000*\006\001\307Y\000*\004\001\307Y\000*\006\001\313\031\000*\004\001\313\031\000*\006\001\301=\003MS\000*\004\001\301=\003MS\000*\006\001\305\277\000*\004\001\305\277\000*\006\001\316\261\000*\004\001\316\261\000*\006\001\316\257\000*\004\001\316\257\000*\006\001\316o\000*\004\001\316o\000*\006\001\307\331\000*\004\001\307\331\000*\006\001\304T\000*\004\001\304T\000*\006\00146\000*\004\00146\000*\006\001\302\2666\000*\004\001\302\2666\000>\001*\303L\002\000>\001*\302\251\002\000 *\001\303A\000 *\001\302^9\000"},
+    {0xA6A0,32,"\030\001\025\000\030\001[\000\030\0011\000\030\001\301\355\000\030\001\301\017\000\030\001\305\233\000\030\001\311\004\000\030\0016\000\030\001\302\245\000\030\001;\000\030\001\252\000\030\001\230\000\030\001\306\311\000\030\001\315\260\000\030\001\3147\000\030\001\310/\000\030\001\304Y\000\030\001\306\205\000\030\001\310\134\000\030\001\261\000\030\001\306\361\000\030\001\301!\000\030\001\306\330\000\030\001\301\340\000\030\001\315\360\000\030\001\310\306\000\030\001\306d\000\030\001\304<\000\030\001\315\010\000\030\001\301e\000\030\001\314\371\000\030\001\307\036\000"},
+    {0xA6C0,32,"\030\001\302\215\000\030\001\311V\000\030\001\264\000\030\001\310a\000\030\001\313\372\000\030\001\310\204\000\030\001\305y\000\030\001\310c\000\030\001\315\200\000\030\001\311H\000\030\001\303\227\000\030\001\304-\000\030\001\301\337\000\030\001\301\265\000\030\001\301|\000\030\001\301L\000\030\001\310\254\000\030\001\304\330\000\030\001\304\265\000\030\001\314\352\000\030\001\305w\000\030\001\300c\000\030\001\303#\000\030\001\310\234\000\030\001\303\207\000\030\001\307\262\000\030\001\300q\000\030\001\256\000\030\001\300\227\000\030\001\300\325\000\030\001\306q\000\030\001\301\303\000"},
+    {0xA6E0,24,"\030\001\314\225\000\030\001\306\277\000\030\001\303\032\000\030\001\251\000\030\001\302&\000\030\001\301\323\000\030\001\301\361\000\030\001\304\302\000\030\001\304b\000\030\001\305_\000\030\001\300H\000\030\001\315\006\000\030\001\315\323\000\030\001\334\245\000\030\001\341{\000\030\001\341j\000\030 +\341u\000\030 +\357\022\000\030\314\364\000\030\300\324\300k\000\030\301^\000\030\300\251\000\030\302\366\000\030\301\216+\000"},
+    {0xA700,32,">\001\3039\212\303\256\310\212\000>\001\3039\212\303\001\310\212\000>\001\3039\212\303\256\315\352\000>\001\3039\212\303\001\315\352\000>\001\3039\212\303\256\305\230\000>\001\3039\212\303\001\305\230\000>\001\3039\212\303\256\301\337\000>\001\3039\212\303\001\301\337\000>\001\306\035\301\016\212x\000>\001\217\301\016\212x\000>\001\304A\301\016\212x\000>\001\210\301\016\212x\000>\001\306\036\301\016\212x\000>\001\306\035\301\016\303P\212x\000>\001\217\301\016\303P\212x\000>\001\304A\301\016\303P\212x\000>\001\210\301\016\303P\212x\000>\001\306\036\301\016\303P\212x\000>\001\306\035\303P\212x\000>\001\217\303P\212x\000>\001\304A\303P\212x\000>\001\210\303P\212x\000>\001\306\036\303P\212x\000>\001<Tx\000>\001<\302j\000>\001<\255x\000>\001l&\3018\300\236\000>\001\301Tb\034\000>\001\301Tt\034\000>\001\301T\301\257+\000>\001\301T\300\221\301\257+\000>\001\210\300\221\301\257+\000"},
+    {0xA720,32,">\001\305\254\031\217\212\000>\001\305\254\031\210\212\000\010\006\001\306\023w\000\010\004\001\306\023w\000\010\006\001\306\023\300\375\000\010\004\001\306\023\300\375\000\010\006\001\305I\000\010\004\001\305I\000\010\006\001\316\314\000\010\004\001\316\314\000\010\006\001\316\241\000\010\004\001\316\241\000\010\006\001\305\373\000\010\004\001\305\373\000\010\006\001\305\373\003\300\251\000\010\004\001\305\373\003\300\251\000\010\001\004\006\300u\000\010\001\004\006d\000\010\006\001\300/\000\010\004\001\300/\000\010\006\001\305\327\000\010\004\001\305\327\000\010\006\001\300d\000\010\004\001\300d\000\010\006\001\304t\000\010\004\001\304t\000\010\006\001\304t\003\255x\000\010\004\001\304t\003\255x\000\010\006\001\302\325\000\010\004\001\302\325\000\010\006\001\300:\3005\003<\000\010\004\001\300:\3005\003<\000"},
+    {0xA740,32,"\010\006\001\300\011\003I\000\010\004\001\300\011\003I\000\010\006\001\300\011\003\274I\000\010\004\001\300\011\003\274I\000\010\006\001\300\011\003I\031\274I\000\010\004\001\300\011\003I\031\274I\000\010\006\001\304~p\000\010\004\001\304~p\000\010\006\001p\003\217I\000\010\004\001p\003\217I\000\010\006\0016\003\253I\301\336\000\010\004\0016\003\253I\301\336\000\010\006\0016\003\301\244\000\010\004\0016\003\301\244\000\010\006\001\300\354\000\010\004\001\300\354\000\010\006\001\300<\003I\302\216\301\037\000\010\004\001\300<\003I\302\216\301\037\000\010\006\001\300<\003\3059\000\010\004\001\300<\003\3059\000\010\006\001\300<\003\316.\300\253\000\010\004\001\300<\003\316.\300\253\000\010\006\001\300\260\003I\302\216\301\037\000\010\004\001\300\260\003I\302\216\301\037\000\010\006\001\300\260\003\274I\000\010\004\001\300\260\003\274I\000\010\006\001c\305\241\000\010\004\001c\305\241\000\010\006\001\306\314\305\241\000\010\004\001\306\314\305\241\000\010\006\001\300\015\003\274I\000\010\004\001\300\015\003\274I\000"},
+    {0xA760,32,"\010\006\001\311;\000\010\004\001\311;\000\010\006\001\316\346\300 \000\010\004\001\316\346\300 \000\010\006\001\304\013\003I\000\010\004\001\304\013\003I\000\010\006\001\304\013\003I\302\216\301\037\000\010\004\001\304\013\003I\302\216\301\037\000\010\006\001\316\337\000\010\004\001\316\337\000\010\006\001\302\273\000\010\004\001\302\273\000\010\006\001\304\256\000\010\004\001\304\256\000\010\006\001\312\264\000\010\004\001\312\264\000>\001\307\017\000\010\004\001\333\242\000\010\004\001\302\354\000\010\004\001\344\236\000\010\004\001\346z\000\010\004\001\306\314\000\010\001\004\006\306\314\000\010\004\001\305\275\000\010\004\001\303\250\000\010\006\001\302\015\300\024\000\010\004\001\302\015\300\024\000\010\006\001\302\015\300u\000\010\004\001\302\015\300u\000\010\006\001\302\015\300\003\000\010\006\001\241\302\015\300\003\000\010\004\001\241\302\015\300\003\000"},
+    {0xA780,32,"\010\006\001\241p\000\010\004\001\241p\000\010\006\001\302\015c\000\010\004\001\302\015c\000\010\006\001\302\015d\000\010\004\001\302\015d\000\010\006\001\302\015\300\007\000\010\004\001\302\015\300\007\000>\001\210\300M\300\206\000>\001\301^\000>\001\300w\301@\002\000\010\006\001\315\322\000\010\004\001\315\322\000\010\006\001\241\300\026\000\010\004\001p\003\301\022S\031\303\006\000\010\001\354`<\000\010\006\001\232\003\301\037\000\010\004\001\232\003\301\037\000\010\006\001\3005\003x\000\010\004\001\3005\003x\000\010\004\001\3005\003\301\213S\000\010\004\001\300\026\003\301\213S\000\010\006\001\077\003\3059\000\010\004\001\077\003\3059\000\010\006\001\300u\003I\000\010\004\001\300u\003I\000\010\006\001\304\374\301X\000\010\004\001\304\374\301X\000\010\006\001\304\374\301\007\000\010\004\001\304\374\301\007\000\010\006\001\304\374\301\343\000\010\004\001\304\374\301\343\000"},
+    {0xA7A0,32,"\010\006\001\300\003\003\302OI\000\010\004\001\300\003\003\302OI\000\010\006\001\300\011\003\302OI\000\010\004\001\300\011\003\302OI\000\010\006\001\232\003\302OI\000\010\004\001\232\003\302OI\000\010\006\001c\003\302OI\000\010\004\001c\003\302OI\000\010\006\001d\003\302OI\000\010\004\001d\003\302OI\000\010\006\001\300\026\003S\000\010\006\001\300:\2629\000\010\006\001\236\300\003\000\010\006\001p\003\303\006\000\010\006\001\004\006;\000\010\001\004\006\300\260\000\010\006\001\241\300\011\000\010\006\001\241\300\007\000\010\006\001\300U\003\303|\000\010\006\001\301\256\000\010\006\001\302\033\000\010\004\001\302\033\000\010\006\001\300n\000\010\004\001\300n\000\010\006\0011\003I\000\010\004\0011\003I\000\010\006\001\301I\025\000\010\004\001\301I\025\000\010\006\001\301I;\000\010\004\001\301I;\000\010\006\001\301I1\000\010\004\001\301I1\000"},
+    {0xA7C0,11,"\010\006\001%\310\2176\000\010\004\001%\310\2176\000\010\006\001\312'\300P\000\010\004\001\312'\300P\000\010\006\001\3005\003\301\213S\000\010\006\001d\003S\000\010\006\001\300 \003\301\213S\000\010\006\001\300\024\003\300wI\301\336\000\010\004\001\300\024\003\300wI\301\336\000\010\006\001d\003\300wI\301\336\000\010\004\001d\003\300wI\301\336\000"},
+    {0xA7D0,2,"\010\006\001\301\005\302\015\300\003\000\010\004\001\301\005\302\015\300\003\000"},
+    {0xA7D3,1,"\010\004\0014\304\013\000"},
+    {0xA7D5,5,"\010\004\0014\307\027\000\010\006\001M\315\334d\000\010\004\001M\315\334d\000\010\006\001\316\003d\000\010\004\001\316\003d\000"},
+    {0xA7F2,32,">\001\006\3005\000>\001\006\300u\000>\001\006\300\260\000\010\006\001\300:o\300\026\000\010\004\001\300:o\300\026\000\010\304\225\001\302%;\000>\001\006\300\026\003I\000>\001\004!\301\007\000\010\001\004\006\241\261\000\010\304\225\001\300:\300u\000\010\304\225\001\300:\300<\000\010\304\225\001\300\221\261\000\010\304\225\001;\306p\000\010\304\225\001\301\034\261\000\301\003\301\001\001\025\000\301\003\301\001\001;\000\301\003\301\001\002\333\264\000\301\003\301\001\0011\000\301\003\301\001\0019\000\301\003\301\001\0016\000\301\003\301\001\002\313\231\000\301\003\301\001\001\301\303\000\301\003\301\001\001\302\351\000\301\003\301\001\001\302\236\000\301\003\301\001\001\313\177\000\301\003\301\001\002\300\316\000\301\003\301\001\001\302\334\000\301\003\301\001\001\303\010\000\301\003\301\001\001\303\022\000\301\003\301\001\001\340j\000\301\003\301\001\001\311,\000\301\003\301\001\001\307\006\000"},
+    {0xA812,27,"\301\003\301\001\001\307\204\000\301\003\301\001\001\312\343\000\301\003\301\001\001C\000\301\003\301\001\001\302\004\000\301\003\301\001\001\302\013\000\301\003\301\001\001\312\364\000\301\003\301\001\001\301#\000\301\003\301\001\001\3029\000\301\003\301\001\001\303\035\000\301\003\301\001\001\302\332\000\301\003\301\001\001\312d\000\301\003\301\001\001\301\361\000\301\003\301\001\001\301\267\000\301\003\301\001\001\302\020\000\301\003\301\001\001\315\305\000\301\003\301\001\001\301\273\000\301\003\301\001\001\301\242\000\301\003\301\001\021\002\025\000\301\003\301\001\021\002;\000\301\003\301\001\021\0021\000\301\003\301\001\021\0029\000\301\003\301\001\021\002\300\354\000\301\003\301\001\306\252\305g\000\301\003\301\001\306\252\305h\000\301\003\301\001\306\252\314\221\000\301\003\301\001\306\252\343\247\000\301\003\301\001\002\301\033\313\231\000"},
+    {0xA830,10,"\275\300[\300\0162\3011\000\275\300[\300\0162o\000\275\300[\300\016B\302\206\000\275\300[\300\0162\304\345\000\275\300[\300\0162\301,\000\275\300[\300\016B\306\340\000\275\300[\3011+\000\275\300[\310\214+\000\275\300[\303\366+\000\275\300[\350\327+\000"},
+    {0xA840,32,"\300\302\001[\000\300\302\001\300\223\000\300\302\001\300\005\000\300\302\001\300c\000\300\302\001\300m\000\300\302\001\300\220\000\300\302\001\300g\000\300\302\001\300\225\000\300\302\001\265\000\300\302\001\300\254\000\300\302\001\300\001\000\300\302\001\256\000\300\302\001\230\000\300\302\001\300\306\000\300\302\001\300\042\000\300\302\001\251\000\300\302\001\301\201\000\300\302\001\302\217\000\300\302\001\302\271\000\300\302\001\300q\000\300\302\001\301\371\000\300\302\001\300\341\000\300\302\001\004\025\000\300\302\001\264\000\300\302\001\235\000\300\302\001\252\000\300\302\001\300j\000\300\302\001\271\000\300\302\001\203\000\300\302\001\025\000\300\302\001;\000\300\302\0011\000"},
+    {0xA860,24,"\300\302\0019\000\300\302\0016\000\300\302\001\302\023\000\300\302\001\302\222\000\300\302\001\301\026\000\300\302\001\304\237\000\300\302\001\301\017\000\300\302\300B\001\300q\000\300\302\300B\001\264\000\300\302\001\300\334\000\300\302\001\301\023\000\300\302\001\300\335\000\300\302\001\301\002\000\300\302\001\301\033\264\000\300\302\001\360\220\300j\000\300\302\001\303l\203\000\300\302\001\322\340\301\026\000\300\302\300B\001\235\000\300\302\355T\001\235\000\300\302\001\301P\000\300\302\300N\301\225+\000\300\3024\301\225+\000\300\302+\302h\000\300\302+4\302h\000"},
+    {0xA880,32,"\300J\002\300\316\000\300J\002\3014\000\300J\001\025\000\300J\001\300/\000\300J\001;\000\300J\001\300T\000\300J\0011\000\300J\001\300l\000\300J\001|c\000\300J\001|\301%\000\300J\001|p\000\300J\001|\301J\000\300J\0019\000\300J\001\301\017\000\300J\001\300L\000\300J\0016\000\300J\001\300\354\000\300J\001\300d\000\300J\001[\000\300J\001\300\223\000\300J\001\300\005\000\300J\001\300\361\000\300J\001\300c\000\300J\001\300m\000\300J\001\300\220\000\300J\001\300g\000\300J\001\301B\000\300J\001\300\225\000\300J\001\300\334\000\300J\001\301\023\000\300J\001\300\335\000\300J\001\301\036\000"},
+    {0xA8A0,32,"\300J\001\301\002\000\300J\001\265\000\300J\001\300\254\000\300J\001\300\001\000\300J\001\300\353\000\300J\001\256\000\300J\001\230\000\300J\001\300\306\000\300J\001\300\042\000\300J\001\301\004\000\300J\001\251\000\300J\001\264\000\300J\001\235\000\300J\001\252\000\300J\001\300\307\000\300J\001\300j\000\300J\001\301&\000\300J\001\271\000\300J\001\203\000\300J\001\301\243\000\300J\3003\002\336N\000\300J\021\002\300/\000\300J\021\002;\000\300J\021\002\300T\000\300J\021\0021\000\300J\021\002\300l\000\300J\021\002|c\000\300J\021\002|\301%\000\300J\021\002|p\000\300J\021\002|\301J\000\300J\021\0029\000\300J\021\002\301\017\000"},
+    {0xA8C0,6,"\300J\021\002\300L\000\300J\021\0026\000\300J\021\002\300\354\000\300J\021\002\300d\000\300J\002\301\031\000\300J\002\301P\000"},
+    {0xA8CE,12,"\300J\301z\000\300J4\301z\000\300J\017\300%\000\300J\0172\000\300J\0177\000\300J\017B\000\300J\017O\000\300J\017V\000\300J\017v\000\300J\017\201\000\300J\017u\000\300J\017\211\000"},
+    {0xA8E0,32," m\017\300%\000 m\0172\000 m\0177\000 m\017B\000 m\017O\000 m\017V\000 m\017v\000 m\017\201\000 m\017u\000 m\017\211\000 m\001\025\000 m\0011\000 m\001[\000 m\001\256\000 m\001\230\000 m\001\235\000 m\001\303\253\000 m\002\302Y\000m\002\310\343\301P\000m\002\301P\301\031\000m\0024\301P\301\031\000m\002\301P7\000m\002\301PB\000m\002\301P\302Y\000m\002\350\227\000m\304\236\303\204\000m\3038\000m\307\317\000m\002\300\022\000m\340Y\302\303\000m\001\302\325\000m\021\002\302\325\000"},
+    {0xA900,32,"\300\330\300\227\017\300%\000\300\330\300\227\0172\000\300\330\300\227\0177\000\300\330\300\227\017B\000\300\330\300\227\017O\000\300\330\300\227\017V\000\300\330\300\227\017v\000\300\330\300\227\017\201\000\300\330\300\227\017u\000\300\330\300\227\017\211\000\300\330\300\227\001[\000\300\330\300\227\001\300\223\000\300\330\300\227\001\300\005\000\300\330\300\227\001\300c\000\300\330\300\227\001\271\000\300\330\300\227\001\300j\000\300\330\300\227\001\300\341\000\300\330\300\227\001\300\225\000\300\330\300\227\001\265\000\300\330\300\227\001\313\270\000\300\330\300\227\001\256\000\300\330\300\227\001\230\000\300\330\300\227\001\300\306\000\300\330\300\227\001\251\000\300\330\300\227\001\300\001\000\300\330\300\227\001\300\042\000\300\330\300\227\001\235\000\300\330\300\227\001\264\000\300\330\300\227\001\252\000\300\330\300\227\001\300q\000\300\330\300\227\001\300\254\000\300\330\300\227\001\203\000"},
+    {0xA920,32,"\300\330\300\227\001\300\307\000\300\330\300\227\001\300m\000\300\330\300\227\001\025\000\300\330\300\227\001\301\007\000\300\330\300\227\001;\000\300\330\300\227\001\300\354\000\300\330\300\227\021\301\343\000\300\330\300\227\0219\000\300\330\300\227\0211\000\300\330\300\227\021\301\017\000\300\330\300\227\0216\000\300\330\300\227\212\315n\000\300\330\300\227\212\312\222\000\300\330\300\227\212\312\222\315n\000\300\330\300\227\002\307|\000\300\330\300\227\002\354D\000\301<\001[\000\301<\001\300\005\000\301<\001\300c\000\301<\001\265\000\301<\001\300\001\000\301<\001\256\000\301<\001\230\000\301<\001\300\042\000\301<\001\251\000\301<\001\300m\000\301<\001\300g\000\301<\001\300\225\000\301<\001\271\000\301<\001\235\000\301<\001\252\000\301<\001\264\000"},
+    {0xA940,20,"\301<\001\300q\000\301<\001\203\000\301<\001\305i\000\301<\001\305w\000\301<\001\304\310\000\301<\001\346\227\000\301<\001\025\000\301<\021\002;\000\301<\021\0021\000\301<\021\0029\000\301<\021\002\300L\000\301<\021\0026\000\301<\021\002\300d\000\301<\021\002\303\203\000\301<\021\002\307\230\000\301<\3003\002\302\022\000\301<\3003\002\232\000\301<\3003\002c\000\301<\3003\002\300\026\000\301<\301\031\000"},
+    {0xA95F,30,"\301<\3013+\000\035\226\356i\000\035\226\316\205\000\035\226\316\207\000\035\226\316\203\000\035\226\306\301\000\035\226\315\267\000\035\226\310\257\000\035\226\351\217\000\035\226\306\302\000\035\226\306\303\000\035\226\351\215\000\035\226\315\261\000\035\226\306\304\000\035\226\351\205\000\035\226\315\262\000\035\226\314\252\000\035\226\3447\000\035\226\3105\000\035\226\350\022\000\035\226\350\013\000\035\226\315^\000\035\226\354\327\000\035\226\340\007\000\035\226\340\001\000\035\226\354\323\000\035\226\354\331\000\035\226\347\364\000\035\226\336\272\000\035\226\354\333\000"},
+    {0xA980,32,"\300(\002\347\242\000\300(\002\312\236\000\300(\002\342(\000\300(\002\361\016\000\300(\001\025\000\300(\001;\340\352\000\300(\001;\000\300(\001\300T\000\300(\0011\000\300(\001\230\325\042\000\300(\001\300c\3149\000\300(\001\300c\3149\351:\000\300(\0019\000\300(\001\300L\000\300(\0016\000\300(\001[\000\300(\001[\303\367\000\300(\001[\302\356\000\300(\001\300\005\000\300(\001\300\005\302\356\000\300(\001\300c\000\300(\001\300m\000\300(\001\300m\302\356\000\300(\001\300g\000\300(\001\300\225\302\356\000\300(\001\300g\303\336\000\300(\001\300\225\000\300(\001\300\334\000\300(\001\300\334\303\336\000\300(\001\300\335\000\300(\001\300\335\303\336\000\300(\001\256\302\356\000"},
+    {0xA9A0,32,"\300(\001\265\000\300(\001\265\302\356\000\300(\001\300\001\000\300(\001\300\001\303\336\000\300(\001\256\000\300(\001\230\000\300(\001\230\302\356\000\300(\001\300\042\000\300(\001\300\042\302\356\000\300(\001\251\000\300(\001\264\000\300(\001\235\000\300(\001\235\322P\000\300(\001\252\000\300(\001\300q\000\300(\001\271\302\356\000\300(\001\271\303\336\000\300(\001\271\000\300(\001\203\000\300(\002\312\236\356\031\000\300(\021\002\355\363\000\300(\021\002\356\220\000\300(\021\002\317\002\000\300(\021\002\317\002\343\336\000\300(\021\002\306\357\000\300(\021\002\306\357\343\343\000\300(\021\002\305\260\000\300(\021\002\332c\344\252\000\300(\021\002\310\201\000\300(\3003\002\341\003\000\300(\3003\002\347\326\000\300(\3003\002\312\221\000"},
+    {0xA9C0,14,"\300(\347\230\000\300((\315\250\000\300(&\315\250\000\300(\302\305\322\207\000\300(\302\305\343{\000\300(\302\305\342\245\000\300(\302\305\316\373\000\300(\302\305\347\227\000\300(\302\305\342o\000\300(\302\305\342\250\000\300(\302\305\305\007\000\300(\302\305\305\007\305\007\000\300(\302\305\315h\000\300(\241\302\305\315h\000"},
+    {0xA9CF,11,"\300(\347\233\000\300(\017\300%\000\300(\0172\000\300(\0177\000\300(\017B\000\300(\017O\000\300(\017V\000\300(\017v\000\300(\017\201\000\300(\017u\000\300(\017\211\000"},
+    {0xA9DE,32,"\300(\302\305\356w\357\026\000\300(\302\305\340J\000N\001\300\373\300\361\000N\001\300\373\300\220\000N\001\300\373\301B\000N\001\300\373\301\002\000N\001\300\373\301\004\000N\002\300\373\310\273\000N>\001\300\373\315\244\000N\0015\301\264\300\225\000N\0015\301\264\301\026\000N\0015\301\264\300\005\000N\0015\301\264\300\361\000N\0015\301\264\300g\000N\0015\301\264\301B\000N\0015\301\264\300\335\000N\0015\301\264\301\036\000N\0015\301\264\301\002\000N5\301\264\017\300%\000N5\301\264\0172\000N5\301\264\0177\000N5\301\264\017B\000N5\301\264\017O\000N5\301\264\017V\000N5\301\264\017v\000N5\301\264\017\201\000N5\301\264\017u\000N5\301\264\017\211\000N\0015\301\264\301\243\000N\0015\301\264\300\001\000N\0015\301\264\300\353\000N\0015\301\264\300\042\000"},
+    {0xA9FE,1,"N\0015\301\264\301\004\000"},
+    {0xAA00,32,"\300D\001\025\000\300D\001;\000\300D\0011\000\300D\0019\000\300D\001\300L\000\300D\0016\000\300D\001[\000\300D\001\300\223\000\300D\001\300\005\000\300D\001\300\361\000\300D\001\345\225\000\300D\001\300c\000\300D\001\300\220\000\300D\001\325G\000\300D\001\300g\000\300D\001\301B\000\300D\001\345\237\000\300D\001\304\312\000\300D\001\345\236\000\300D\001\265\000\300D\001\300\254\000\300D\001\300\001\000\300D\001\300\353\000\300D\001\346y\000\300D\001\256\000\300D\001\300\335\000\300D\001\230\000\300D\001\350\134\000\300D\001\300\306\000\300D\001\300\042\000\300D\001\301\004\000\300D\001\344\225\000"},
+    {0xAA20,23,"\300D\001\251\000\300D\001\304\035\000\300D\001\264\000\300D\001\235\000\300D\001\252\000\300D\001\300\307\000\300D\001\301&\000\300D\001\271\000\300D\001\203\000\300D\021\002\300/\000\300D\021\002;\000\300D\021\002\300T\000\300D\021\002\303\177\000\300D\021\0021\000\300D\021\002\301\007\000\300D\021\0026\000\300D\021\002\300L\000\300D\021\002\300d\000\300D\021\002\301\343\000\300D\3003\002\264\000\300D\3003\002\235\000\300D\3003\002\252\000\300D\3003\002\300q\000"},
+    {0xAA40,14,"\300D\0013\300\011\000\300D\0013\300\003\000\300D\0013\302\022\000\300D\3003\0023\302\022\000\300D\0013\312\243\000\300D\0013\300\007\000\300D\0013\232\000\300D\0013\300<\000\300D\0013\300$\000\300D\0013c\000\300D\0013p\000\300D\0013\306\351\000\300D\3003\0023\261\000\300D\3003\0023\300\026\000"},
+    {0xAA50,10,"\300D\017\300%\000\300D\0172\000\300D\0177\000\300D\017B\000\300D\017O\000\300D\017V\000\300D\017v\000\300D\017\201\000\300D\017u\000\300D\017\211\000"},
+    {0xAA5C,32,"\300D\300\006\304W\000\300D\300\006\301z\000\300D\300\0064\301z\000\300D\300\006\300\262\301z\000N\001\301\302\300\005\000N\001\301\302\300m\000N\001\301\302\300\220\000N\001\301\302\300g\000N\001\301\302\301B\000N\001\301\302\300\225\000N\001\301\302\300\334\000N\001\301\302\301\023\000N\001\301\302\300\335\000N\001\301\302\301\036\000N\001\301\302\300\353\000N\001\301\302\256\000N\001\301\302\271\000N\001\301\302\203\000N\001\301\302\303\213\000N\001\301\302\301\026\000N>\001\301\302\315\244\000N\001\301\302\302\222\000N\001\301\302\300\341\000N\001\301\302\235\000N\303\334\301\302\315\032\000N\303\334\301\302\350\320\000N\303\334\301\302\336\344\000N\014\304p\301\257\000N\014\304p2\000N\014\304p7\000N\001\304p\235\000N\002\347\246\3026\212\000"},
+    {0xAA7C,32,"N\0025\301\264\303e\000N\0025\301\264\303f\000N\001\304T\306\234\300\220\000N\001\304T\306\234\300j\0005\300p\001\210\301\303\0005\300p\001\217\301\303\0005\300p\001\210\302\351\0005\300p\001\217\302\351\0005\300p\001\210\314\004\0005\300p\001\217\314\004\0005\300p\001\210\302\236\0005\300p\001\217\302\236\0005\300p\001\210\304F\0005\300p\001\217\304F\0005\300p\001\210\302\334\0005\300p\001\217\302\334\0005\300p\001\210\303\010\0005\300p\001\217\303\010\0005\300p\001\210\301\273\0005\300p\001\217\301\273\0005\300p\001\210\303\226\0005\300p\001\217\303\226\0005\300p\001\210\302\013\0005\300p\001\217\302\013\0005\300p\001\210C\0005\300p\001\217C\0005\300p\001\210\302\004\0005\300p\001\217\302\004\0005\300p\001\210\301#\0005\300p\001\217\301#\0005\300p\001\210\302\332\0005\300p\001\217\302\332\000"},
+    {0xAA9C,32,"5\300p\001\210\3029\0005\300p\001\217\3029\0005\300p\001\210\303\035\0005\300p\001\217\303\035\0005\300p\001\210\303\017\0005\300p\001\217\303\017\0005\300p\001\210\301\361\0005\300p\001\217\301\361\0005\300p\001\210\301i\0005\300p\001\217\301i\0005\300p\001\210\301\267\0005\300p\001\217\301\267\0005\300p\001\210\302\020\0005\300p\001\217\302\020\0005\300p\001\210\303k\0005\300p\001\217\303k\0005\300p\001\210\301\242\0005\300p\001\217\301\242\0005\300p\001\2106\0005\300p\001\2176\0005\300p\301\357\306Q\0005\300p\021\300/\0005\300p\021;\0005\300p\021\301\343\0005\300p\0211\0005\300p\0219\0005\300p\0216\0005\300p\301\357\341\033\0005\300p\021\306C\0005\300p\021\357\213\0005\300p\021\304\367\0005\300p\021\312@\000"},
+    {0xAABC,7,"5\300p\021\302\325\0005\300p\021\3016\0005\300p\021\3032\0005\300p\212\301\357\304\223\0005\300p\212\301\357\315\011\0005\300p\212\301\357\302\004\0005\300p\212\301\357\354\241\000"},
+    {0xAADB,28,"5\300p\014\314\020\0005\300p\014\315\011\0005\300p\014\310\271\0005\300p\014\301\242\337#\0005\300p\014\310\003\310\003\000\300W\300V\0019\000\300W\300V\0016\000\300W\300V\001\300\220\000\300W\300V\001\300\225\000\300W\300V\001\300\334\000\300W\300V\001\301\023\000\300W\300V\001\300\335\000\300W\300V\001\301\036\000\300W\300V\001\301\002\000\300W\300V\001\300j\000\300W\300V\001\301&\000\300W\300V\021\002\300T\000\300W\300V\021\002\300l\000\300W\300V\021\002\312\010\000\300W\300V\021\002\300d\000\300W\300V\021\002\321\317\000\300W\300V\325:\000\300W\300V\322S\341$\000\300W\300V\307-\000\300W\300V\005\305\234+\000\300W\300V\301\344\305\234+\000\300W\300V\021\002\3014\000\300W\300V\301\031\000"},
+    {0xAB01,6,"#\005\356\374\000#\005\316\265\000#\005\311+\000#\005\356\372\000#\005\316\264\000#\005\307\006\000"},
+    {0xAB09,6,"#\005\331\367\000#\005\331\366\000#\005\312\342\000#\005\331\365\000#\005\331\364\000#\005\312\343\000"},
+    {0xAB11,6,"#\005\313\027\000#\005\313\024\000#\005\333\273\000#\005\313\022\000#\005\303\303\000#\005\313\026\000"},
+    {0xAB20,7,"#\005\325\004\000#\005\325\012\000#\005\325\010\000#\005\325\005\000#\005\325\007\000#\005\325\006\000#\005\325\011\000"},
+    {0xAB28,7,"#\005\304\035\000#\005\312X\000#\005\312V\000#\005\324\006\000#\005\324\012\000#\005\305\022\000#\005\312W\000"},
+    {0xAB30,32,"\010\004\001\3035\300s\000\010\004\001\025\351r\000\010\004\001\307G9\000\010\004\001\30359\000\010\004\0019\003\3059\000\010\004\001\314:\300u\000\010\004\001\236\300\003\003\303|\000\010\004\001p\003\300\221\310\017d\000\010\004\001p\0034M\272\000\010\004\001p\003M\240\000\010\004\001\261\003\303|\000\010\004\001\232\003\303|\000\010\004\001\302\341\003\303|\000\010\004\001\307G6\000\010\004\001\307G6\003I\000\010\004\001\2626\003I\000\010\004\001\300\221\301\007\000\010\004\001\241\301\007\003I\000\010\004\001\241\301\007\003\255I\000\010\004\001\2416\315*\000\010\004\001\2416\315*\003I\000\010\004\001\355\020c\000\010\001\004\006c\003&\302\017\000\010\004\001c\305\307\313\230\000\010\004\0014c\000\010\004\001c\003\303|\000\010\004\0014c\003\303|\000\010\004\001\236c\000\010\004\001\236c\003\240\000\010\004\001\312R\302 \000\010\004\0011\003\300w&\302\017\000\010\004\0011x\003\300w&\302\017\000"},
+    {0xAB50,28,"\010\004\001\307\014\000\010\004\001\241\307\014\000\010\004\0011\003(S\000\010\004\001\301\256\000\010\004\001\301\256\003\210&\240\000\010\004\001\301\256\003\210(\315\344\000\010\004\001\300>\003\210&\240\000\010\004\001\300>\003\253(\302\017\000\010\004\001\300>\003\253(\302\017\031\210&\240\000\010\004\001\300>\003\253(\302\017\003\315\344\000\010\004\001\300$\003\300w&\302\017\000>\300\270\003\300\221\300\270\000>\001\004\305I\000>\001\004p\003\300\221\310\017d\000>\001\004p\003M\272\000>\001\0041\003(S\000\010\004\001\352N\303\255\000\010\004\001\302^9\000\010\004\001\262\301\007\000\010\004\001\316\327\000\010\004\001\300\221\300s\000\042\001\004\006\300n\000\010\004\001\303@\301k\003\301\022S\000\010\004\001\307\003\301k\003\301\022S\000\010\004\001\241c\003M\272\000>\001\004\241\300P\000>\001(\301O\000>\001&\301O\000"},
+    {0xAB70,32,"h\004\001\025\000h\004\0019\000h\004\001;\000h\004\0016\000h\004\0011\000h\004\001\300\015\000h\004\001\300\005\000h\004\001[\000h\004\001\303J\000h\004\001\301\321\000h\004\001\302\236\000h\004\001\302H\000h\004\001\313\220\000h\004\001\203\000h\004\001\301\027\000h\004\001\3019\000h\004\001\301\242\000h\004\001\302\237\000h\004\001\306A\000h\004\001\252\000h\004\001\300\345\000h\004\001\300\227\000h\004\001\302\020\000h\004\001\301\265\000h\004\001\314S\000h\004\001\251\000h\004\001\301S\000h\004\001\301|\000h\004\001\301\361\000h\004\001\301!\000h\004\001\256\000h\004\001\307\324\000"},
+    {0xAB90,32,"h\004\001\310G\000h\004\001\301K\000h\004\001\301L\000h\004\001\301#\000h\004\001\301e\000h\004\001\310e\000h\004\001\315\213\000h\004\001\315\214\000h\004\001\315\215\000h\004\001\310\246\000h\004\001\310\247\000h\004\001\315\220\000h\004\001\271\000h\004\001d\000h\004\001\301\363\000h\004\001\301\340\000h\004\001\301\273\000h\004\001\301\365\000h\004\001\310\374\000h\004\001\300\001\000h\004\001\265\000h\004\001\301\350\000h\004\001\301=\000h\004\001\302\036\000h\004\001\302&\000h\004\001\302\013\000h\004\001\302\037\000h\004\001\313\020\000h\004\001\306\013\000h\004\001\311\031\000h\004\001\311\032\000h\004\001\311\034\000"},
+    {0xABB0,32,"h\004\001\311\035\000h\004\001\311\036\000h\004\001\316\221\000h\004\001\301\201\000h\004\001\302\254\000h\004\001\304g\000h\004\001\307\004\000h\004\001\307\005\000h\004\001\316\260\000h\004\001\300q\000h\004\001\301\300\000h\004\001\301\367\000h\004\001\301\331\000h\004\001\303.\000h\004\001\317\004\000h\004\001\264\000\300W\300V\001\314\017\000\300W\300V\001\310\271\000\300W\300V\001\306e\000\300W\300V\001\3108\000\300W\300V\001\230\000\300W\300V\001\256\000\300W\300V\001\325L\000\300W\300V\001\311\027\000\300W\300V\001\341!\000\300W\300V\001\314\355\000\300W\300V\001\356D\000\300W\300V\001\360\340\000\300W\300V\001\303\001\000\300W\300V\001\337n\000\300W\300V\001\303\251\000\300W\300V\001;\000"},
+    {0xABD0,30,"\300W\300V\001\347\361\000\300W\300V\001\322\357\000\300W\300V\001\335\370\000\300W\300V\001\340h\000\300W\300V\001\351.\000\300W\300V\001\300\042\000\300W\300V\001\305S\000\300W\300V\001\332V\000\300W\300V\001\335\324\000\300W\300V\001\332E\000\300W\300V\001\324;\000\300W\300V\001\314\017\303\335\000\300W\300V\001\306e\303\335\000\300W\300V\001\3108\303\335\000\300W\300V\001\230\303\335\000\300W\300V\001\256\303\335\000\300W\300V\001\311\027\303\335\000\300W\300V\001\314\355\303\335\000\300W\300V\001;\303\335\000\300W\300V\021\002\3479\000\300W\300V\021\002\340\042\000\300W\300V\021\002\322\204\000\300W\300V\021\002\361\262\000\300W\300V\021\002\354\250\000\300W\300V\021\002\357\237\000\300W\300V\021\002\325<\000\300W\300V\021\002\310d\000\300W\300V\325;\000\300W\300V\302\354\313\332\000\300W\300V\322\261\313\332\000"},
+    {0xABF0,10,"\300W\300V\017\300%\000\300W\300V\0172\000\300W\300V\0177\000\300W\300V\017B\000\300W\300V\017O\000\300W\300V\017V\000\300W\300V\017v\000\300W\300V\017\201\000\300W\300V\017u\000\300W\300V\017\211\000"},
+    {0xD7B0,23,"\035\300\036\346\317\000\035\300\036\346\312\000\035\300\036\361\324\000\035\300\036\361\325\000\035\300\036\361\326\000\035\300\036\357S\000\035\300\036\357P\000\035\300\036\361\354\000\035\300\036\361\357\000\035\300\036\334C\000\035\300\036\334E\000\035\300\036\334D\000\035\300\036\334G\000\035\300\036\337\256\000\035\300\036\337\257\000\035\300\036\337\261\000\035\300\036\337\260\000\035\300\036\337\253\000\035\300\036\337\262\000\035\300\036\337\263\000\035\300\036\337\251\000\035\300\036\322\267\000\035\300\036\322\270\000"},
+    {0xD7CB,32,"\035\213\345\256\000\035\213\345\254\000\035\213\306\356\000\035\213\354\332\000\035\213\316\205\000\035\213\316\207\000\035\213\356j\000\035\213\316\203\000\035\213\356h\000\035\213\356k\000\035\213\315\267\000\035\213\351\206\000\035\213\354\325\000\035\213\351\207\000\035\213\351\214\000\035\213\351\213\000\035\213\351\222\000\035\213\351\221\000\035\213\313\360\000\035\213\3442\000\035\213\3445\000\035\213\354\324\000\035\213\3443\000\035\213\3440\000\035\213\310\211\000\035\213\350\017\000\035\213\350\014\000\035\213\306\354\000\035\213\310\210\000\035\213\310\207\000\035\213\315]\000\035\213\316\014\000"},
+    {0xD7EB,17,"\035\213\354c\000\035\213\354\326\000\035\213\354\330\000\035\213\354e\000\035\213\310\323\000\035\213\316\012\000\035\213\316\017\000\035\213\316\013\000\035\213\347\240\000\035\213\347\237\000\035\213\361\270\000\035\213\361\267\000\035\213\325y\000\035\213\325z\000\035\213\306\352\000\035\213\347\365\000\035\213\347\366\000"},
+    {0xFB00,7,"\010\004!\334\320\000\010\004!\303\014\000\010\004!\334\352\000\010\004!\334\321\000\010\004!\334\322\000\010\004!\253d\300\007\000\010\004!\310\353\000"},
+    {0xFB13,5,"\300\030\004!\303\032\306\216\000\300\030\004!\303\032\304\222\000\300\030\004!\303\032\307\341\000\300\030\004!\311:\306\216\000\300\030\004!\303\032\311I\000"},
+    {0xFB1D,26,"\216\001\303n\003\313\253\000\216\301\252\340\222\360'\000\216!\307\034\303n\303n\306\240\000\216\001\307+\302\326\000\216\001\302\376w\000\216\001\302\376\305\375\000\216\001\302\376\301\027\000\216\001\302\376\300\337\000\216\001\302\376\306f\000\216\001\302\3763\302#\000\216\001\302\376\302\313\000\216\001\302\376\311\006\000\216\001\307+a\002\000\216\001\301[\003\301[<\000\216\001\301[\003\306\337<\000\216\001\301[\003\301\317\031\301[<\000\216\001\301[\003\301\317\031\306\337<\000\216\001w\003\306\240\000\216\001w\003\306\262\000\216\001w\003\310%\000\216\001\304y\003\301\317\000\216\001\302]\003\301\317\000\216\001\305\375\003\301\317\000\216\001\301\027\003\310%\000\216\001\304\373\003\301\317\000\216\001\302\261\003\301\317\000"},
+    {0xFB38,5,"\216\001\304b\003\301\317\000\216\001\303n\003\301\317\000\216\0013\300\337\003\301\317\000\216\001\300\337\003\301\317\000\216\001\306f\003\301\317\000"},
+    {0xFB3E,1,"\216\001\302#\003\301\317\000"},
+    {0xFB40,2,"\216\001\300\263\003\301\317\000\216\001\302g\003\301\317\000"},
+    {0xFB43,2,"\216\0013\300\363\003\301\317\000\216\001\300\363\003\301\317\000"},
+    {0xFB46,32,"\216\001\311(\003\301\317\000\216\001\310\244\003\301\317\000\216\001\302\313\003\301\317\000\216\001\301[\003\301\317\000\216\001\311\006\003\301\317\000\216\001\304\373\003\307\325\000\216\001\304y\003\306\270\000\216\001\300\337\003\306\270\000\216\001\300\363\003\306\270\000\216!w\306f\000\011\001w\307\022J\020\000\011\001w\307\0223\020\000\011\001\305\023J\020\000\011\001\305\0233\020\000\011\001\305\023X\020\000\011\001\305\023\300\017\020\000\011\001\303\230J\020\000\011\001\303\2303\020\000\011\001\303\230X\020\000\011\001\303\230\300\017\020\000\011\001\305\024J\020\000\011\001\305\0243\020\000\011\001\305\024X\020\000\011\001\305\024\300\017\020\000\011\001\305\274J\020\000\011\001\305\2743\020\000\011\001\305\274X\020\000\011\001\305\274\300\017\020\000\011\001\305\262J\020\000\011\001\305\2623\020\000\011\001\305\262X\020\000\011\001\305\262\300\017\020\000"},
+    {0xFB66,32,"\011\001\304\365J\020\000\011\001\304\3653\020\000\011\001\304\365X\020\000\011\001\304\365\300\017\020\000\011\001\305\303J\020\000\011\001\305\3033\020\000\011\001\305\303X\020\000\011\001\305\303\300\017\020\000\011\001\305\212J\020\000\011\001\305\2123\020\000\011\001\305\212X\020\000\011\001\305\212\300\017\020\000\011\001\305,J\020\000\011\001\305,3\020\000\011\001\305,X\020\000\011\001\305,\300\017\020\000\011\001\305}J\020\000\011\001\305}3\020\000\011\001\305}X\020\000\011\001\305}\300\017\020\000\011\001\304^J\020\000\011\001\304^3\020\000\011\001\304^X\020\000\011\001\304^\300\017\020\000\011\001\305\261J\020\000\011\001\305\2613\020\000\011\001\305\261X\020\000\011\001\305\261\300\017\020\000\011\001\307\201J\020\000\011\001\307\2013\020\000\011\001\307}J\020\000\011\001\307}3\020\000"},
+    {0xFB86,32,"\011\001\307\225J\020\000\011\001\307\2253\020\000\011\001\307\202J\020\000\011\001\307\2023\020\000\011\001\307\355J\020\000\011\001\307\3553\020\000\011\001\310\266J\020\000\011\001\310\2663\020\000\011\001\302\350J\020\000\011\001\302\3503\020\000\011\001\302\350X\020\000\011\001\302\350\300\017\020\000\011\001\303IJ\020\000\011\001\303I3\020\000\011\001\303IX\020\000\011\001\303I\300\017\020\000\011\001\305GJ\020\000\011\001\305G3\020\000\011\001\305GX\020\000\011\001\305G\300\017\020\000\011\001\305xJ\020\000\011\001\305x3\020\000\011\001\305xX\020\000\011\001\305x\300\017\020\000\011\001\300\215\305AJ\020\000\011\001\300\215\305A3\020\000\011\001\305\236J\020\000\011\001\305\2363\020\000\011\001\305\236X\020\000\011\001\305\236\300\017\020\000\011\001\300\344\003]'J\020\000\011\001\300\344\003]'3\020\000"},
+    {0xFBA6,29,"\011\001\300\344\303\313J\020\000\011\001\300\344\303\3133\020\000\011\001\300\344\303\313X\020\000\011\001\300\344\303\313\300\017\020\000\011\001\300\344\305)J\020\000\011\001\300\344\305)3\020\000\011\001\300\344\305)X\020\000\011\001\300\344\305)\300\017\020\000\011\001]\303rJ\020\000\011\001]\303r3\020\000\011\001]\303r\003\300S'J\020\000\011\001]\303r\003\300S'3\020\000\011\014<'\000\011\014<:\000\011\0147\214'\000\011\0147\214:\000\011\014B\214'\000\011\014B\214:\000\011\014B\214\300]\267'\000\011\014B\214\300]\267:\000\011\014O\214'\000\011\014O\214:\000\011\0144Tx:\000\011\0147\214\304\024'\000\011\0147\214\304\024:\000\011\014\240\000\011\014\004\301('\000\011\014\004\301(:\000\011\014\307\022'\000"},
+    {0xFBD3,32,"\011\001\302\022J\020\000\011\001\302\0223\020\000\011\001\302\022X\020\000\011\001\302\022\300\017\020\000\011\0011J\020\000\011\00113\020\000\011\001\301\007J\020\000\011\001\301\0073\020\000\011\001\301)J\020\000\011\001\301)3\020\000\011\0011\003\300S'J\020\000\011\001\302WJ\020\000\011\001\302W3\020\000\011\001\303\024\301\007J\020\000\011\001\303\024\301\0073\020\000\011\001\303\024\301)J\020\000\011\001\303\024\301)3\020\000\011\0019J\020\000\011\00193\020\000\011\0019X\020\000\011\0019\300\017\020\000\011\001\305\301\313\364\303\024w\300\204X\020\000\011\001\305\301\313\364\303\024w\300\204\300\017\020\000\011!]\003\300S'\003wJ\020\000\011!]\003\300S'\003w3\020\000\011!]\003\300S'\003\301XJ\020\000\011!]\003\300S'\003\301X3\020\000\011!]\003\300S'\003\301\024J\020\000\011!]\003\300S'\003\301\0243\020\000\011!]\003\300S'\0031J\020\000\011!]\003\300S'\00313\020\000\011!]\003\300S'\003\301\007J\020\000"},
+    {0xFBF3,32,"\011!]\003\300S'\003\301\0073\020\000\011!]\003\300S'\003\301)J\020\000\011!]\003\300S'\003\301)3\020\000\011!]\003\300S'\0039J\020\000\011!]\003\300S'\00393\020\000\011!]\003\300S'\0039X\020\000\011!\305\301\303\024]\003\300S'\003w\300\204J\020\000\011!\305\301\303\024]\003\300S'\003w\300\2043\020\000\011!\305\301\303\024]\003\300S'\003w\300\204X\020\000\011\001\302\234]J\020\000\011\001\302\234]3\020\000\011\001\302\234]X\020\000\011\001\302\234]\300\017\020\000\011!]\003\300S'\003\300\004J\020\000\011!]\003\300S'\003\246J\020\000\011!]\003\300S'\003YJ\020\000\011!]\003\300S'\003w\300\204J\020\000\011!]\003\300S'\003]J\020\000\011!\300\376\003\300\004J\020\000\011!\300\376\003\246J\020\000\011!\300\376\003\300\210J\020\000\011!\300\376\003YJ\020\000\011!\300\376\003w\300\204J\020\000\011!\300\376\003]J\020\000\011!\300\322\003\300\004J\020\000\011!\300\322\003\246J\020\000\011!\300\322\003\300\210J\020\000\011!\300\322\003YJ\020\000\011!\300\322\003w\300\204J\020\000\011!\300\322\003]J\020\000\011!\301\330\003\300\004J\020\000\011!\301\330\003YJ\020\000"},
+    {0xFC13,32,"\011!\301\330\003w\300\204J\020\000\011!\301\330\003]J\020\000\011!\300\004\003\246J\020\000\011!\300\004\003YJ\020\000\011!\246\003\300\004J\020\000\011!\246\003YJ\020\000\011!\300\210\003\300\004J\020\000\011!\300\210\003\246J\020\000\011!\300\210\003YJ\020\000\011!\300\333\003\300\004J\020\000\011!\300\333\003\246J\020\000\011!\300\333\003\300\210J\020\000\011!\300\333\003YJ\020\000\011!\301U\003\246J\020\000\011!\301U\003YJ\020\000\011!\301`\003\300\004J\020\000\011!\301`\003\246J\020\000\011!\301`\003\300\210J\020\000\011!\301`\003YJ\020\000\011!\301(\003\246J\020\000\011!\301(\003YJ\020\000\011!\302\260\003YJ\020\000\011!\300\375\003\300\004J\020\000\011!\300\375\003YJ\020\000\011!\301\261\003\300\004J\020\000\011!\301\261\003YJ\020\000\011!\301.\003\300\004J\020\000\011!\301.\003\246J\020\000\011!\301.\003\300\210J\020\000\011!\301.\003YJ\020\000\011!\301.\003w\300\204J\020\000\011!\301.\003]J\020\000"},
+    {0xFC33,32,"\011!\301D\003\246J\020\000\011!\301D\003YJ\020\000\011!\301D\003w\300\204J\020\000\011!\301D\003]J\020\000\011!\300\337\003wJ\020\000\011!\300\337\003\300\004J\020\000\011!\300\337\003\246J\020\000\011!\300\337\003\300\210J\020\000\011!\300\337\003\300hJ\020\000\011!\300\337\003YJ\020\000\011!\300\337\003w\300\204J\020\000\011!\300\337\003]J\020\000\011!\300h\003\300\004J\020\000\011!\300h\003\246J\020\000\011!\300h\003\300\210J\020\000\011!\300h\003YJ\020\000\011!\300h\003w\300\204J\020\000\011!\300h\003]J\020\000\011!Y\003\300\004J\020\000\011!Y\003\246J\020\000\011!Y\003\300\210J\020\000\011!Y\003YJ\020\000\011!Y\003w\300\204J\020\000\011!Y\003]J\020\000\011!\300\215\003\300\004J\020\000\011!\300\215\003\246J\020\000\011!\300\215\003\300\210J\020\000\011!\300\215\003YJ\020\000\011!\300\215\003w\300\204J\020\000\011!\300\215\003]J\020\000\011!\300\344\003\300\004J\020\000\011!\300\344\003YJ\020\000"},
+    {0xFC53,32,"\011!\300\344\003w\300\204J\020\000\011!\300\344\003]J\020\000\011!]\003\300\004J\020\000\011!]\003\246J\020\000\011!]\003\300\210J\020\000\011!]\003YJ\020\000\011!]\003w\300\204J\020\000\011!]\003]J\020\000\011!\304\010\003\301\232wJ\020\000\011!\3012\003\301\232wJ\020\000\011!w\300\204\003\301\232wJ\020\000\011!\302\250\003\305%J\020\000\011!\302\250\003\305YJ\020\000\011!\302\250\003\302\235J\020\000\011!\302\250\003\303\012J\020\000\011!\302\250\003\302\241J\020\000\011!\302\250\003\301\232wJ\020\000\011!]\003\300S'\003\30123\020\000\011!]\003\300S'\003\302p3\020\000\011!]\003\300S'\003Y3\020\000\011!]\003\300S'\003\300\2153\020\000\011!]\003\300S'\003w\300\2043\020\000\011!]\003\300S'\003]3\020\000\011!\300\376\003\30123\020\000\011!\300\376\003\302p3\020\000\011!\300\376\003Y3\020\000\011!\300\376\003\300\2153\020\000\011!\300\376\003w\300\2043\020\000\011!\300\376\003]3\020\000\011!\300\322\003\30123\020\000\011!\300\322\003\302p3\020\000\011!\300\322\003Y3\020\000"},
+    {0xFC73,32,"\011!\300\322\003\300\2153\020\000\011!\300\322\003w\300\2043\020\000\011!\300\322\003]3\020\000\011!\301\330\003\30123\020\000\011!\301\330\003\302p3\020\000\011!\301\330\003Y3\020\000\011!\301\330\003\300\2153\020\000\011!\301\330\003w\300\2043\020\000\011!\301\330\003]3\020\000\011!\301.\003w\300\2043\020\000\011!\301.\003]3\020\000\011!\301D\003w\300\2043\020\000\011!\301D\003]3\020\000\011!\300\337\003w3\020\000\011!\300\337\003\300h3\020\000\011!\300\337\003Y3\020\000\011!\300\337\003w\300\2043\020\000\011!\300\337\003]3\020\000\011!\300h\003Y3\020\000\011!\300h\003w\300\2043\020\000\011!\300h\003]3\020\000\011!Y\003w3\020\000\011!Y\003Y3\020\000\011!\300\215\003\30123\020\000\011!\300\215\003\302p3\020\000\011!\300\215\003Y3\020\000\011!\300\215\003\300\2153\020\000\011!\300\215\003w\300\2043\020\000\011!\300\215\003]3\020\000\011!w\300\204\003\301\232w3\020\000\011!]\003\30123\020\000\011!]\003\302p3\020\000"},
+    {0xFC93,32,"\011!]\003Y3\020\000\011!]\003\300\2153\020\000\011!]\003w\300\2043\020\000\011!]\003]3\020\000\011!]\003\300S'\003\300\004X\020\000\011!]\003\300S'\003\246X\020\000\011!]\003\300S'\003\300\210X\020\000\011!]\003\300S'\003YX\020\000\011!]\003\300S'\003\300\344X\020\000\011!\300\376\003\300\004X\020\000\011!\300\376\003\246X\020\000\011!\300\376\003\300\210X\020\000\011!\300\376\003YX\020\000\011!\300\376\003\300\344X\020\000\011!\300\322\003\300\004X\020\000\011!\300\322\003\246X\020\000\011!\300\322\003\300\210X\020\000\011!\300\322\003YX\020\000\011!\300\322\003\300\344X\020\000\011!\301\330\003YX\020\000\011!\300\004\003\246X\020\000\011!\300\004\003YX\020\000\011!\246\003\300\004X\020\000\011!\246\003YX\020\000\011!\300\210\003\300\004X\020\000\011!\300\210\003YX\020\000\011!\300\333\003\300\004X\020\000\011!\300\333\003\246X\020\000\011!\300\333\003\300\210X\020\000\011!\300\333\003YX\020\000\011!\301U\003\246X\020\000\011!\301U\003\300\210X\020\000"},
+    {0xFCB3,32,"\011!\301U\003YX\020\000\011!\301`\003\300\004X\020\000\011!\301`\003\246X\020\000\011!\301`\003\300\210X\020\000\011!\301`\003YX\020\000\011!\301(\003\246X\020\000\011!\302\260\003YX\020\000\011!\300\375\003\300\004X\020\000\011!\300\375\003YX\020\000\011!\301\261\003\300\004X\020\000\011!\301\261\003YX\020\000\011!\301.\003\300\004X\020\000\011!\301.\003\246X\020\000\011!\301.\003\300\210X\020\000\011!\301.\003YX\020\000\011!\301D\003\246X\020\000\011!\301D\003YX\020\000\011!\300\337\003\300\004X\020\000\011!\300\337\003\246X\020\000\011!\300\337\003\300\210X\020\000\011!\300\337\003\300hX\020\000\011!\300\337\003YX\020\000\011!\300h\003\300\004X\020\000\011!\300h\003\246X\020\000\011!\300h\003\300\210X\020\000\011!\300h\003YX\020\000\011!\300h\003\300\344X\020\000\011!Y\003\300\004X\020\000\011!Y\003\246X\020\000\011!Y\003\300\210X\020\000\011!Y\003YX\020\000\011!\300\215\003\300\004X\020\000"},
+    {0xFCD3,32,"\011!\300\215\003\246X\020\000\011!\300\215\003\300\210X\020\000\011!\300\215\003YX\020\000\011!\300\215\003\300\344X\020\000\011!\300\344\003\300\004X\020\000\011!\300\344\003YX\020\000\011!\300\344\003\301\232wX\020\000\011!]\003\300\004X\020\000\011!]\003\246X\020\000\011!]\003\300\210X\020\000\011!]\003YX\020\000\011!]\003\300\344X\020\000\011!]\003\300S'\003Y\300\017\020\000\011!]\003\300S'\003\300\344\300\017\020\000\011!\300\376\003Y\300\017\020\000\011!\300\376\003\300\344\300\017\020\000\011!\300\322\003Y\300\017\020\000\011!\300\322\003\300\344\300\017\020\000\011!\301\330\003Y\300\017\020\000\011!\301\330\003\300\344\300\017\020\000\011!\300\333\003Y\300\017\020\000\011!\300\333\003\300\344\300\017\020\000\011!\301\010\003Y\300\017\020\000\011!\301\010\003\300\344\300\017\020\000\011!\300\337\003\300h\300\017\020\000\011!\300\337\003Y\300\017\020\000\011!\300h\003Y\300\017\020\000\011!\300\215\003Y\300\017\020\000\011!\300\215\003\300\344\300\017\020\000\011!]\003Y\300\017\020\000\011!]\003\300\344\300\017\020\000\011!\302\250\003\302\235\300\017\020\000"},
+    {0xFCF3,32,"\011!\302\250\003\303\012\300\017\020\000\011!\302\250\003\302\241\300\017\020\000\011!\301(\003w\300\204J\020\000\011!\301(\003]J\020\000\011!\300\375\003w\300\204J\020\000\011!\300\375\003]J\020\000\011!\301\261\003w\300\204J\020\000\011!\301\261\003]J\020\000\011!\300\333\003w\300\204J\020\000\011!\300\333\003]J\020\000\011!\301\010\003w\300\204J\020\000\011!\301\010\003]J\020\000\011!\246\003w\300\204J\020\000\011!\246\003]J\020\000\011!\300\004\003w\300\204J\020\000\011!\300\004\003]J\020\000\011!\300\210\003w\300\204J\020\000\011!\300\210\003]J\020\000\011!\301U\003w\300\204J\020\000\011!\301U\003]J\020\000\011!\301`\003w\300\204J\020\000\011!\301`\003]J\020\000\011!\301\010\003\300\004J\020\000\011!\301\010\003\246J\020\000\011!\301\010\003\300\210J\020\000\011!\301\010\003YJ\020\000\011!\301\010\003\3012J\020\000\011!\300\333\003\3012J\020\000\011!\301U\003\3012J\020\000\011!\301`\003\3012J\020\000\011!\301(\003w\300\2043\020\000\011!\301(\003]3\020\000"},
+    {0xFD13,32,"\011!\300\375\003w\300\2043\020\000\011!\300\375\003]3\020\000\011!\301\261\003w\300\2043\020\000\011!\301\261\003]3\020\000\011!\300\333\003w\300\2043\020\000\011!\300\333\003]3\020\000\011!\301\010\003w\300\2043\020\000\011!\301\010\003]3\020\000\011!\246\003w\300\2043\020\000\011!\246\003]3\020\000\011!\300\004\003w\300\2043\020\000\011!\300\004\003]3\020\000\011!\300\210\003w\300\2043\020\000\011!\300\210\003]3\020\000\011!\301U\003w\300\2043\020\000\011!\301U\003]3\020\000\011!\301`\003w\300\2043\020\000\011!\301`\003]3\020\000\011!\301\010\003\300\0043\020\000\011!\301\010\003\2463\020\000\011!\301\010\003\300\2103\020\000\011!\301\010\003Y3\020\000\011!\301\010\003\30123\020\000\011!\300\333\003\30123\020\000\011!\301U\003\30123\020\000\011!\301`\003\30123\020\000\011!\301\010\003\300\004X\020\000\011!\301\010\003\246X\020\000\011!\301\010\003\300\210X\020\000\011!\301\010\003YX\020\000\011!\300\333\003\300\344X\020\000\011!\301\010\003\300\344X\020\000"},
+    {0xFD33,32,"\011!\301(\003YX\020\000\011!\300\333\003\300\004\300\017\020\000\011!\300\333\003\246\300\017\020\000\011!\300\333\003\300\210\300\017\020\000\011!\301\010\003\300\004\300\017\020\000\011!\301\010\003\246\300\017\020\000\011!\301\010\003\300\210\300\017\020\000\011!\301(\003Y\300\017\020\000\011!\302\260\003Y\300\017\020\000\011!w\003\304,3\020\000\011!w\003\304,J\020\000\315-(\300\371\000\315-&\300\371\000\011!\351+\312 \000\011!\304\327\305\013\322\220\000\011!\304\327\305\013\322\221\000\011!\304\327\305\013\322\223\000\011!\304\327\305\013\322\224\000\011!\304\327\305\013\322\225\000\011!\352W\305\324\360\327\000\011!\305\324\305\335\000\011!\322i\305\335\000\011!\322j\305\335\000\011!\305\324\322\327\360\351\000\011!\350\332\354k\000\011!\352X\305\324\360\332\360\330\000\011!\322h\305\335\000\011!\355\333\360\331\000\011!\351,\312 \000\011!\300\322\003\300\004\003YX\020\000\011!\300\322\003\246\003\300\0043\020\000\011!\300\322\003\246\003\300\004X\020\000"},
+    {0xFD53,32,"\011!\300\322\003\246\003YX\020\000\011!\300\322\003\300\210\003YX\020\000\011!\300\322\003Y\003\300\004X\020\000\011!\300\322\003Y\003\246X\020\000\011!\300\322\003Y\003\300\210X\020\000\011!\300\004\003Y\003\2463\020\000\011!\300\004\003Y\003\246X\020\000\011!\246\003Y\003]3\020\000\011!\246\003Y\003w\300\2043\020\000\011!\300\333\003\246\003\300\004X\020\000\011!\300\333\003\300\004\003\246X\020\000\011!\300\333\003\300\004\003w\300\2043\020\000\011!\300\333\003Y\003\2463\020\000\011!\300\333\003Y\003\246X\020\000\011!\300\333\003Y\003\300\004X\020\000\011!\300\333\003Y\003Y3\020\000\011!\300\333\003Y\003YX\020\000\011!\301U\003\246\003\2463\020\000\011!\301U\003\246\003\246X\020\000\011!\301U\003Y\003Y3\020\000\011!\301\010\003\246\003Y3\020\000\011!\301\010\003\246\003YX\020\000\011!\301\010\003\300\004\003]3\020\000\011!\301\010\003Y\003\300\2103\020\000\011!\301\010\003Y\003\300\210X\020\000\011!\301\010\003Y\003Y3\020\000\011!\301\010\003Y\003YX\020\000\011!\301`\003\246\003w\300\2043\020\000\011!\301`\003\300\210\003Y3\020\000\011!\301`\003\300\210\003YX\020\000\011!\301(\003Y\003\2463\020\000\011!\301(\003Y\003\246X\020\000"},
+    {0xFD73,29,"\011!\301(\003Y\003YX\020\000\011!\301(\003Y\003]3\020\000\011!\300\375\003\300\004\003Y3\020\000\011!\300\375\003Y\003Y3\020\000\011!\300\375\003Y\003YX\020\000\011!\300\375\003Y\003w\300\2043\020\000\011!\301\261\003Y\003Y3\020\000\011!\301\261\003Y\003]3\020\000\011!\301\261\003Y\003w\300\2043\020\000\011!\301.\003\300\210\003Y3\020\000\011!\301.\003\300\210\003YX\020\000\011!\301D\003Y\003\2463\020\000\011!\301D\003Y\003Y3\020\000\011!\300h\003\246\003Y3\020\000\011!\300h\003\246\003]3\020\000\011!\300h\003\246\003w\300\2043\020\000\011!\300h\003\300\004\003\300\004X\020\000\011!\300h\003\300\004\003\300\0043\020\000\011!\300h\003\300\210\003Y3\020\000\011!\300h\003\300\210\003YX\020\000\011!\300h\003Y\003\2463\020\000\011!\300h\003Y\003\246X\020\000\011!Y\003\246\003\300\004X\020\000\011!Y\003\246\003YX\020\000\011!Y\003\246\003]3\020\000\011!Y\003\300\004\003\246X\020\000\011!Y\003\300\004\003YX\020\000\011!Y\003\300\210\003\300\004X\020\000\011!Y\003\300\210\003YX\020\000"},
+    {0xFD92,32,"\011!Y\003\300\004\003\300\210X\020\000\011!\300\344\003Y\003\300\004X\020\000\011!\300\344\003Y\003YX\020\000\011!\300\215\003\246\003YX\020\000\011!\300\215\003\246\003w\300\2043\020\000\011!\300\215\003\300\004\003Y3\020\000\011!\300\215\003\300\004\003YX\020\000\011!\300\215\003\300\004\003w\300\2043\020\000\011!\300\215\003Y\003]3\020\000\011!\300\215\003Y\003w\300\2043\020\000\011!]\003Y\003Y3\020\000\011!]\003Y\003YX\020\000\011!\300\376\003\300\210\003]3\020\000\011!\300\322\003\300\004\003]3\020\000\011!\300\322\003\300\004\003w\300\2043\020\000\011!\300\322\003\300\210\003]3\020\000\011!\300\322\003\300\210\003w\300\2043\020\000\011!\300\322\003Y\003]3\020\000\011!\300\322\003Y\003w\300\2043\020\000\011!\300\004\003Y\003]3\020\000\011!\300\004\003\246\003w\300\2043\020\000\011!\300\004\003Y\003w\300\2043\020\000\011!\300\333\003\300\210\003w\300\2043\020\000\011!\301U\003\246\003]3\020\000\011!\301\010\003\246\003]3\020\000\011!\301`\003\246\003]3\020\000\011!\300h\003\300\004\003]3\020\000\011!\300h\003Y\003]3\020\000\011!]\003\246\003]3\020\000\011!]\003\300\004\003]3\020\000\011!]\003Y\003]3\020\000\011!Y\003Y\003]3\020\000"},
+    {0xFDB2,22,"\011!\301D\003Y\003]3\020\000\011!\300\215\003\246\003]3\020\000\011!\301D\003Y\003\246X\020\000\011!\300h\003\246\003YX\020\000\011!\300\375\003Y\003]3\020\000\011!\300\337\003Y\003]3\020\000\011!\300\215\003\300\004\003\246X\020\000\011!Y\003\300\210\003]3\020\000\011!\300h\003\300\004\003YX\020\000\011!\300\337\003Y\003Y3\020\000\011!\300h\003\300\004\003Y3\020\000\011!\300\215\003\300\004\003\2463\020\000\011!\300\004\003\246\003]3\020\000\011!\246\003\300\004\003]3\020\000\011!Y\003\300\004\003]3\020\000\011!\301.\003Y\003]3\020\000\011!\300\376\003\246\003]3\020\000\011!\300\337\003Y\003YX\020\000\011!\300\375\003\300\004\003YX\020\000\011!\301U\003Y\003YX\020\000\011!\300\333\003\300\210\003]3\020\000\011!\300\215\003\300\004\003]3\020\000"},
+    {0xFDCF,1,"\011!\352T\322k\000"},
+    {0xFDF0,32,"\011!\315\320\316\332\302\225\314\022\300k\002J\020\000\011!\350\261\316\332\302\225\314\022\300k\002J\020\000\011!\322rJ\020\000\011!\322`J\020\000\011!\344kJ\020\000\011!\352VJ\020\000\011!\3519J\020\000\011!\305\011J\020\000\011!\316\357J\020\000\011!\315\320J\020\000\011!\315\321\305\011\316\357\000\011!\340[\000\351\201\002\000\011!\324V\322\265\322\264\000\011!\355@\300q\355\325\000\011!\323\017\300q\340Z\000D\352\224\000D\353\004\000D\353H\000D\353S\000D\353^\000D\353i\000D\353t\000D\353\177\000D\353\212\000D\352\225\000D\352\240\000D\352\253\000D\352\266\000D\352\301\000D\352\314\000D\352\327\000"},
+    {0xFE10,10,"\301Z\020)T\300\251\000\301Z\020)T\237\300\251\000\301Z\020)T\237\300\324\300k\000\301Z\020)T\301^\000\301Z\020)T\302\366\000\301Z\020)T\301\257+\000\301Z\020)T\301\216+\000\301Z\020)T(@\303\327\202\000\301Z\020)T&@\303\327\324}\000\301Z\020)T\255\303\304\000"},
+    {0xFE20,32," !(o\000 !&o\000 4\272(o\000 4\272&o\000 \300\213(o\000 \300\213&o\000 \312\266\300\213\000 !(o:\000 !&o:\000 \272(o:\000 \272&o:\000 \300\213(o:\000 \300\213&o:\000 \312\266\300\213:\000 *\305\267(o\000 *\305\267&o\000\301Z\020)T7<\310\020\000\301Z\020)T\302,\301\025\000\301Z\020)T\300\276\301\025\000\301Z\020)T\210\300\201\000\301Z\020)T\303+\210\300\201\000\301Z\020)T(\300\371\000\301Z\020)T&\300\371\000\301Z\020)T(\301\077\202\000\301Z\020)T&\301\077\202\000\301Z\020)T(\301\276\301g\202\000\301Z\020)T&\301\276\301g\202\000\301Z\020)T(8\303\327\202\000\301Z\020)T&8\303\327\202\000\301Z\020)T(4\300\236\202\000\301Z\020)T&4\300\236\202\000\301Z\020)T(\300\236\202\000"},
+    {0xFE40,19,"\301Z\020)T&\300\236\202\000\301Z\020)T(\3018\202\000\301Z\020)T&\3018\202\000\301Z\020)T(@\3018\202\000\301Z\020)T&@\3018\202\000\315\345<\000@\315\345<\000\301Z\020)T(,\202\000\301Z\020)T&,\202\000\302\267\303\355\000\312\241\303\355\000\303+\303\355\0004\303+\303\355\000\302\267\210\300\201\000\312\241\210\300\201\000\303+\210\300\201\000\004\300\251\000\004\237\300\251\000\004\300\324\300k\000"},
+    {0xFE54,19,"\004\302\366\000\004\301^\000\004\301\216+\000\004\301\257+\000\004\302,\301\025\000\004(\300\371\000\004&\300\371\000\004(\301\077\202\000\004&\301\077\202\000\004(\301\276\301g\202\000\004&\301\276\301g\202\000\004\036\002\000\004\303\262\000\004\300\367\000\004a\002\000\004\306B\000\004\300\257\002\000\004\300\256\002\000\004\301@\002\000"},
+    {0xFE68,4,"\004\302\003\301\327\000\004\304&\002\000\004\305\215\002\000\004\305 \301\234\000"},
+    {0xFE70,5,"\011\304,J\020\000\011\304\356\003\304,'\000\011\305%J\020\000\011\300\253\335\025\000\011\305YJ\020\000"},
+    {0xFE76,32,"\011\302\235J\020\000\011\302\235\300\017\020\000\011\303\012J\020\000\011\303\012\300\017\020\000\011\302\241J\020\000\011\302\241\300\017\020\000\011\302\250J\020\000\011\302\250\300\017\020\000\011\304\003J\020\000\011\304\003\300\017\020\000\011\001\300SJ\020\000\011\001w\003\303\031'J\020\000\011\001w\003\303\031'3\020\000\011\001w\003\300S'J\020\000\011\001w\003\300S'3\020\000\011\001\301\024\003\300S'J\020\000\011\001\301\024\003\300S'3\020\000\011\001w\003\300S:J\020\000\011\001w\003\300S:3\020\000\011\001]\003\300S'J\020\000\011\001]\003\300S'3\020\000\011\001]\003\300S'X\020\000\011\001]\003\300S'\300\017\020\000\011\001wJ\020\000\011\001w3\020\000\011\001\300\376J\020\000\011\001\300\3763\020\000\011\001\300\376X\020\000\011\001\300\376\300\017\020\000\011\001\300\322\306uJ\020\000\011\001\300\322\306u3\020\000\011\001\300\322J\020\000"},
+    {0xFE96,32,"\011\001\300\3223\020\000\011\001\300\322X\020\000\011\001\300\322\300\017\020\000\011\001\301\330J\020\000\011\001\301\3303\020\000\011\001\301\330X\020\000\011\001\301\330\300\017\020\000\011\001\300\004J\020\000\011\001\300\0043\020\000\011\001\300\004X\020\000\011\001\300\004\300\017\020\000\011\001\246J\020\000\011\001\2463\020\000\011\001\246X\020\000\011\001\246\300\017\020\000\011\001\300\210J\020\000\011\001\300\2103\020\000\011\001\300\210X\020\000\011\001\300\210\300\017\020\000\011\001\302\035J\020\000\011\001\302\0353\020\000\011\001\304\010J\020\000\011\001\304\0103\020\000\011\001\3012J\020\000\011\001\30123\020\000\011\001\302pJ\020\000\011\001\302p3\020\000\011\001\300\333J\020\000\011\001\300\3333\020\000\011\001\300\333X\020\000\011\001\300\333\300\017\020\000\011\001\301\010J\020\000"},
+    {0xFEB6,32,"\011\001\301\0103\020\000\011\001\301\010X\020\000\011\001\301\010\300\017\020\000\011\001\301UJ\020\000\011\001\301U3\020\000\011\001\301UX\020\000\011\001\301U\300\017\020\000\011\001\301`J\020\000\011\001\301`3\020\000\011\001\301`X\020\000\011\001\301`\300\017\020\000\011\001\301(J\020\000\011\001\301(3\020\000\011\001\301(X\020\000\011\001\301(\300\017\020\000\011\001\302\260J\020\000\011\001\302\2603\020\000\011\001\302\260X\020\000\011\001\302\260\300\017\020\000\011\001\300\375J\020\000\011\001\300\3753\020\000\011\001\300\375X\020\000\011\001\300\375\300\017\020\000\011\001\301\261J\020\000\011\001\301\2613\020\000\011\001\301\261X\020\000\011\001\301\261\300\017\020\000\011\001\301.J\020\000\011\001\301.3\020\000\011\001\301.X\020\000\011\001\301.\300\017\020\000\011\001\301DJ\020\000"},
+    {0xFED6,32,"\011\001\301D3\020\000\011\001\301DX\020\000\011\001\301D\300\017\020\000\011\001\300\337J\020\000\011\001\300\3373\020\000\011\001\300\337X\020\000\011\001\300\337\300\017\020\000\011\001\300hJ\020\000\011\001\300h3\020\000\011\001\300hX\020\000\011\001\300h\300\017\020\000\011\001YJ\020\000\011\001Y3\020\000\011\001YX\020\000\011\001Y\300\017\020\000\011\001\300\215J\020\000\011\001\300\2153\020\000\011\001\300\215X\020\000\011\001\300\215\300\017\020\000\011\001\300\344J\020\000\011\001\300\3443\020\000\011\001\300\344X\020\000\011\001\300\344\300\017\020\000\011\001\301\024J\020\000\011\001\301\0243\020\000\011\001w\300\204J\020\000\011\001w\300\2043\020\000\011\001]J\020\000\011\001]3\020\000\011\001]X\020\000\011\001]\300\017\020\000\011!\300h\003w\003\303\031'J\020\000"},
+    {0xFEF6,7,"\011!\300h\003w\003\303\031'3\020\000\011!\300h\003w\003\300S'J\020\000\011!\300h\003w\003\300S'3\020\000\011!\300h\003w\003\300S:J\020\000\011!\300h\003w\003\300S:3\020\000\011!\300h\003wJ\020\000\011!\300h\003w3\020\000"},
+    {0xFEFF,1,"\300%\303,\310^\301\364\000"},
+    {0xFF01,32,"\300\002\301\257+\000\300\002\301\177+\000\300\002\036\002\000\300\002\304&\002\000\300\002\305\215\002\000\300\002\303\262\000\300\002\303o\000\300\002(\300\371\000\300\002&\300\371\000\300\002\300\367\000\300\002a\002\000\300\002\300\251\000\300\002\306B\000\300\002\300\324\300k\000\300\002\301\327\000\300\002\017\300%\000\300\002\0172\000\300\002\0177\000\300\002\017B\000\300\002\017O\000\300\002\017V\000\300\002\017v\000\300\002\017\201\000\300\002\017u\000\300\002\017\211\000\300\002\301^\000\300\002\302\366\000\300\002\300\257\002\000\300\002\301@\002\000\300\002\300\256\002\000\300\002\301\216+\000\300\002\305 \301\234\000"},
+    {0xFF21,32,"\300\002\010\006\001\025\000\300\002\010\006\001\077\000\300\002\010\006\001\3005\000\300\002\010\006\001\300\024\000\300\002\010\006\0019\000\300\002\010\006\001\300u\000\300\002\010\006\001\300\003\000\300\002\010\006\001\300\026\000\300\002\010\006\001;\000\300\002\010\006\001\300U\000\300\002\010\006\001\300\011\000\300\002\010\006\001p\000\300\002\010\006\001\261\000\300\002\010\006\001\232\000\300\002\010\006\0016\000\300\002\010\006\001\300<\000\300\002\010\006\001\300\260\000\300\002\010\006\001c\000\300\002\010\006\001d\000\300\002\010\006\001\300\007\000\300\002\010\006\0011\000\300\002\010\006\001\300\015\000\300\002\010\006\001\300P\000\300\002\010\006\001\300>\000\300\002\010\006\001\300$\000\300\002\010\006\001\300 \000\300\002(,\202\000\300\002\302\003\301\327\000\300\002&,\202\000\300\002\300M\300\206\000\300\002\210\300\201\000\300\002\300\200\300\206\000"},
+    {0xFF41,32,"\300\002\010\004\001\025\000\300\002\010\004\001\077\000\300\002\010\004\001\3005\000\300\002\010\004\001\300\024\000\300\002\010\004\0019\000\300\002\010\004\001\300u\000\300\002\010\004\001\300\003\000\300\002\010\004\001\300\026\000\300\002\010\004\001;\000\300\002\010\004\001\300U\000\300\002\010\004\001\300\011\000\300\002\010\004\001p\000\300\002\010\004\001\261\000\300\002\010\004\001\232\000\300\002\010\004\0016\000\300\002\010\004\001\300<\000\300\002\010\004\001\300\260\000\300\002\010\004\001c\000\300\002\010\004\001d\000\300\002\010\004\001\300\007\000\300\002\010\004\0011\000\300\002\010\004\001\300\015\000\300\002\010\004\001\300P\000\300\002\010\004\001\300>\000\300\002\010\004\001\300$\000\300\002\010\004\001\300 \000\300\002(\301\077\202\000\300\002T\300\201\000\300\002&\301\077\202\000\300\002\272\000\300\002(@\300\371\000\300\002&@\300\371\000"},
+    {0xFF61,32,"\233\237\300\324\300k\000\233(\3018\202\000\233&\3018\202\000\233\237\300\251\000\233HM<\000\233H\001\301\331\000\233H\001\004\025\000\233H\001\004;\000\233H\001\0041\000\233H\001\0049\000\233H\001\0046\000\233H\001\004\264\000\233H\001\004\301)\000\233H\001\004\301i\000\233H\001\004\301\313\000\233\304:\315{\302S+\000\233H\001\025\000\233H\001;\000\233H\0011\000\233H\0019\000\233H\0016\000\233H\001[\000\233H\001\301\323\000\233H\001\301\355\000\233H\001\301\377\000\233H\001\301\303\000\233H\001\271\000\233H\001\301\340\000\233H\001\301\365\000\233H\001\301\363\000\233H\001\301\273\000\233H\001\265\000"},
+    {0xFF81,32,"\233H\001\302&\000\233H\001\301\313\000\233H\001\301=\000\233H\001C\000\233H\001\256\000\233H\001\301L\000\233H\001\301e\000\233H\001\301K\000\233H\001\301#\000\233H\001\203\000\233H\001\3019\000\233H\001\302\237\000\233H\001\301\027\000\233H\001\301\242\000\233H\001\251\000\233H\001\301|\000\233H\001\301!\000\233H\001\301S\000\233H\001\301\361\000\233H\001\264\000\233H\001\301)\000\233H\001\301i\000\233H\001\235\000\233H\001\302d\000\233H\001\301\337\000\233H\001\302:\000\233H\001\301\267\000\233H\001\300q\000\233H\001\232\000\233H\303l\302S+\000\233H\310\302\302S+\000\233\035\303\204\000"},
+    {0xFFA1,30,"\233\035\001\303\326\000\233\035\001\306\353\000\233\035\001\307\377\000\233\035\001\303\346\000\233\035\001\306\212\000\233\035\001\306\213\000\233\035\001\304\015\000\233\035\001\306\356\000\233\035\001\303\365\000\233\035\001\306\301\000\233\035\001\306\302\000\233\035\001\306\303\000\233\035\001\306\304\000\233\035\001\310\256\000\233\035\001\310\255\000\233\035\001\306\300\000\233\035\001\303\341\000\233\035\001\303\362\000\233\035\001\306\354\000\233\035\001\306\247\000\233\035\001\303\374\000\233\035\001\306\355\000\233\035\001\303\215\000\233\035\001\303y\000\233\035\001\306\352\000\233\035\001\303\272\000\233\035\001\303\325\000\233\035\001\304\011\000\233\035\001\303\360\000\233\035\001\303\317\000"},
+    {0xFFC2,6,"\233\035\001\025\000\233\035\001\301X\000\233\035\001\264\000\233\035\001\305\311\000\233\035\001\3050\000\233\035\0019\000"},
+    {0xFFCA,6,"\233\035\001\311P\000\233\035\001\302o\000\233\035\0016\000\233\035\001\300q\000\233\035\001\311<\000\233\035\001\301\007\000"},
+    {0xFFD2,6,"\233\035\001\301i\000\233\035\0011\000\233\035\001\311@\000\233\035\001\301\300\000\233\035\001\301\367\000\233\035\001\301)\000"},
+    {0xFFDA,3,"\233\035\001\303\203\000\233\035\001\012\000\233\035\001;\000"},
+    {0xFFE0,7,"\300\002\312\240\002\000\300\002\306\256\002\000\300\002\300\224\002\000\300\002\300\213\000\300\002\304~x\000\300\002\305\314\002\000\300\002\311D\002\000"},
+    {0xFFE8,7,"\233\335\015{T\000\233n\034\000\233\277\034\000\233\134\034\000\233\267\034\000\2338,\000\233@y\000"},
+    {0xFFF9,5,"\307\343\302\030\312%\000\307\343\302\030\301\270\000\307\343\302\030\356\037\000\347!\315\247\300\034\000\315\247\300\034\000"},
+    {0x10000,12,"\037\077\005\312N\025\000\037\077\005\323,9\000\037\077\005\323#;\000\037\077\005\323C6\000\037\077\005\323\0211\000\037\077\005\312G\300\001\000\037\077\005\3233\301\350\000\037\077\005\312M\302\036\000\037\077\005\323\025\302\013\000\037\077\005\3239\302\037\000\037\077\005\323\077\300g\000\037\077\005\3234\302\347\000"},
+    {0x1000D,26,"\037\077\005\323*\303\022\000\037\077\005\323G\3049\000\037\077\005\323S[\000\037\077\005\3232\301\377\000\037\077\005\323I\301\323\000\037\077\005\323L\301\303\000\037\077\005\323W\301\355\000\037\077\005\323V\251\000\037\077\005\323\024\301S\000\037\077\005\323O\301|\000\037\077\005\323\026\301\361\000\037\077\005\323\036\301!\000\037\077\005\312L\256\000\037\077\005\323\037\301K\000\037\077\005\323%\301L\000\037\077\005\323:\301#\000\037\077\005\323=\301e\000\037\077\005\312I\230\000\037\077\005\323N\300\363\000\037\077\005\323-\300\325\000\037\077\005\323\022\3029\000\037\077\005\3238\302\312\000\037\077\005\323\027\302\023\000\037\077\005\323T\306\263\000\037\077\005\323\034\305\227\000\037\077\005\323'\306\264\000"},
+    {0x10028,19,"\037\077\005\323B\235\000\037\077\005\323\042\302:\000\037\077\005\323;\302d\000\037\077\005\312H\301\267\000\037\077\005\323!\301\337\000\037\077\005\323&\271\000\037\077\005\312O\301\363\000\037\077\005\323/\301\340\000\037\077\005\323\023\301\273\000\037\077\005\323@\301\365\000\037\077\005\323A\265\000\037\077\005\312J\301=\000\037\077\005\323+\302&\000\037\077\005\312KC\000\037\077\005\323K\301\313\000\037\077\005\323<\300q\000\037\077\005\323Q\301\300\000\037\077\005\323.\301\367\000\037\077\005\3230\301\331\000"},
+    {0x1003C,2,"\037\077\005\323\030\300\341\000\037\077\005\323P\301\370\000"},
+    {0x1003F,15,"\037\077\005\323\033\303\004\000\037\077\005\323 \307'\000\037\077\005\3231\320i\000\037\077\005\323Z\300d\000\037\077\005\323M\307\227\000\037\077\005\323^\333\271\000\037\077\005\3236\306\221\000\037\077\005\323$\350\201\000\037\077\005\323D\350\200\000\037\077\005\323R\351#\000\037\077\005\323(\351$\000\037\077\005\323J\351\254\000\037\077\005\323H\355\324\000\037\077\005\323\134\305\277\000\037\077\005\323_7\000"},
+    {0x10050,14,"\037\077\014\323\031\000\037\077\014\323\032\000\037\077\014\323\035\000\037\077\014\323)\000\037\077\014\3235\000\037\077\014\3237\000\037\077\014\323>\000\037\077\014\323E\000\037\077\014\323F\000\037\077\014\323U\000\037\077\014\323X\000\037\077\014\323Y\000\037\077\014\323[\000\037\077\014\323]\000"},
+    {0x10080,32,"\037\077\242\323`\301\360\000\037\077\242\323a\304\026\000\037\077\242\323b\307\206\000\037\077\242\323c\3343\000\037\077\242\323d\343\246\000\037\077\242\323e\354\373\000\037\077\242\323f\313A\000\037\077\242\323g\306\272\000\037\077\242\323h\354\001\000\037\077\242\323i\336\200\000\037\077\242\323j\354\251\000\037\077\242\323k\312y\000\037\077\242\323l\305!\000\037\077\242\323m\324\224\000\037\077\242\323n\311A\000\037\077\242\323o\323\372\000\037\077\242\323p\315\042\000\037\077\242\323q\354\273\000\037\077\242\323r\331j\000\037\077\303\224\323s\340\327\000\037\077\303\224\323t\340\323\000\037\077\242\323u\306\226\000\037\077\242\323v\307\025\000\037\077\242\323w\000\037\077\303\224\323x\322\277\000\037\077\303\224\323y\343\347\000\037\077\242\323z\324\211\000\037\077\242\323{\3062\000\037\077\242\323|\000\037\077\242\323}\316\376\000\037\077\242\323~\000\037\077\242\323\177\000"},
+    {0x100A0,32,"\037\077\242\323\200\301R\000\037\077\242\323\201\000\037\077\242\323\202\000\037\077\242\323\203\000\037\077\303\224\323\205\357\036\000\037\077\242\323\206\000\037\077\242\323\207\000\037\077\242\323\210\307b\000\037\077\242\323\211\000\037\077\242\323\212\000\037\077\242\323\213\335\177\000\037\077\242\323\214\322\306\000\037\077\242\323\215\000\037\077\242\323\216\000\037\077\242\323\217\000\037\077\242\323\220\000\037\077\242\323\221\000\037\077\242\323\222\000\037\077\242\323\223\000\037\077\242\323\224\000\037\077\242\323\225\000\037\077\242\323\226\310;\000\037\077\242\323\227\000\037\077\242\323\230\303h\000\037\077\242\323\231\000\037\077\242\323\232\000\037\077\242\323\233\000\037\077\242\323\234\000\037\077\242\323\235\000\037\077\242\323\236\000\037\077\242\323\237\000\037\077\242\323\240\000"},
+    {0x100C0,32,"\037\077\242\323\241\000\037\077\242\323\242\000\037\077\242\323\243\000\037\077\242\323\244\306=\000\037\077\242\323\271\335\007\000\037\077\242\323\274\312T\000\037\077\242\323\301\316'\000\037\077\242\323\302\034\000\037\077\242\323\303\000\037\077\242\323\304\355h\000\037\077\242\323\305\000\037\077\242\323\306\000\037\077\242\323\307\361\003\305\032\000\037\077\242\323\310\305\032\000\037\077\242\323\311\305\032\306+\000\037\077\242\323\312\307\024\000\037\077\242\323\313\000\037\077\242\323\314\000\037\077\303\224\323\315\332b\000\037\077\242\323\316\000\037\077\242\323\317\000\037\077\242\323\321\000\037\077\242\323\322\000\037\077\242\323\323\000\037\077\242\323\324\331\345\000\037\077\242\323\325\000\037\077\242\323\326\000\037\077\242\323\327\000\037\077\242\323\330\000\037\077\242\323\331\000\037\077\242\301\221\323\204\000\037\077\242\301\221\323\245\000"},
+    {0x100E0,27,"\037\077\242\301\221\323\246\000\037\077\242\301\221\323\247\000\037\077\242\301\221\323\250\000\037\077\242\301\221\323\251\000\037\077\242\301\221\323\252\000\037\077\242\301\221\323\253\000\037\077\242\301\221\323\254\000\037\077\242\301\221\323\255\000\037\077\242\301\221\323\256\000\037\077\242\301\221\323\257\000\037\077\242\301\221\323\260\000\037\077\242\301\221\323\261\000\037\077\242\301\221\323\262\000\037\077\242\301\221\323\263\000\037\077\242\301\221\323\264\000\037\077\242\301\221\323\265\000\037\077\242\301\221\323\266\000\037\077\242\301\221\323\267\000\037\077\242\301\221\323\270\000\037\077\242\301\221\323\272\000\037\077\242\301\221\323\273\000\037\077\242\301\221\323\275\000\037\077\242\301\221\323\276\000\037\077\242\301\221\323\277\000\037\077\242\301\221\323\300\000\037\077\242\301\221\323\320\000\037\077\242\301\221\323\332\000"},
+    {0x10100,3,"\300\267\301\344\301\270\300\201\000\300\267\301\344\301\270<\000\300\267\302\231+\000"},
+    {0x10107,32,"\300\267\0362\000\300\267\0367\000\300\267\036B\000\300\267\036O\000\300\267\036V\000\300\267\036v\000\300\267\036\201\000\300\267\036u\000\300\267\036\211\000\300\267\036\300H\000\300\267\036\300\351\000\300\267\036\301\200\000\300\267\036\301\237\000\300\267\036\301H\000\300\267\036\302R\000\300\267\036\301V\000\300\267\036\302w\000\300\267\036\3010\000\300\267\0362\207\000\300\267\0367\207\000\300\267\036B\207\000\300\267\036O\207\000\300\267\036V\207\000\300\267\036v\207\000\300\267\036\201\207\000\300\267\036u\207\000\300\267\036\211\207\000\300\267\0362\254\000\300\267\0367\254\000\300\267\036B\254\000\300\267\036O\254\000\300\267\036V\254\000"},
+    {0x10127,13,"\300\267\036v\254\000\300\267\036\201\254\000\300\267\036u\254\000\300\267\036\211\254\000\300\267\036\300H\254\000\300\267\036\300\351\254\000\300\267\036\301\200\254\000\300\267\036\301\237\254\000\300\267\036\301H\254\000\300\267\036\302R\254\000\300\267\036\301V\254\000\300\267\036\302w\254\000\300\267\036\3010\254\000"},
+    {0x10137,32,"\300\267\304\377\305\343\302\373\000\300\267\304\377\303\205\304\002\000\300\267\304\377\303\237\304\002\000\300\267\304\377\302\321\304\002\000\300\267\304\377\306*\304\002\000\300\267\307\224\304@\303\205\304\002\000\300\267\314F\304@\303\205\304\002\000\300\267\304@\303\237\304\002\000\300\267\304@\302\321\304\002\000\042\300\314\301\3152\3011\000\042\300\314\301\3152o\000\042\300\314\301\3152\307\223\000\042\300\314\301\315V\000\042\300\314\301\315\301H\000\042\300\314\301\315V\207\000\042\300\314\301\315V\254\000\042\300\314\301\315\301H\254\000\042\300\314\301\315V\304Z\000\042\300\314\301\315\300H\304Z\000\042\300\314\301\315\301H\304Z\000\042\300\314\301\3152\207\304Z\000\042\300\314\301\315V\207\304Z\000\042\300\314\301\3152\254\304Z\000\042\300\314\301\315V\254\304Z\000\042\300\314\301\315V\303\376\000\042\300\314\301\315\300H\303\376\000\042\300\314\301\315\301H\303\376\000\042\300\314\301\3152\207\303\376\000\042\300\314\301\315V\207\303\376\000\042\300\314\301\3152\254\303\376\000\042\300\314\301\315\300H\254\303\376\000\042\300\314\301\315\301H\254\303\376\000"},
+    {0x10157,32,"\042\300\314\301\315\300H\3109\000\042\300\314\336\2232\350/\000\042\300\314\303c2\000\042\300\314\307\3202\000\042\300\314\307\2367\000\042\300\314\303c7\000\042\300\314\331l7\313\010\000\042\300\314\307\2367\313\010\000\042\300\314\304\364V\000\042\300\314\304\364\300H\000\042\300\314\304\364\300H\301\033\020\000\042\300\314\307\320\300H\000\042\300\314\343\353\300H\000\042\300\314\303c\300H\000\042\300\314\303c\301\200\000\042\300\314\304\364\301H\000\042\300\314\304\364\301H\301\033\020\000\042\300\314\307\320\301H\000\042\300\314\303c\301H\000\042\300\314\303c2\207\000\042\300\314\303cB\207\000\042\300\314\307\236V\207\000\042\300\314\304\364V\207\000\042\300\314\303cV\207\000\042\300\314\324\365V\207\000\042\300\314\345\012V\207\000\042\300\314\303c2\254\000\042\300\314\303cV\254\000\042\300\314\332\037V\3109\000\042\300\314\355\031\301H\3109\000\0422o\002\000\0422o\002\301\033\020\000"},
+    {0x10177,24,"\0427\303\246\002\000\042B\302\206\002\000\042\317\023\002\000\042\355\346\002\000\042\307\223\002\000\042\347%\002\000\0427\306\224\002\000\042B\306\224\002\000\042O\306\224\002\000\042V\306\224\002\000\042\343\360\002\000\042\341\300\305\343\002\000\042\342w\002\000\042\347\134\002\000\042\361Q\002\000\042\322\322\002\000\042\322\312\002\000\042\336\012\002\000\042\356\350\305\343\002\000\042\300%\002\000\0422\3011\002\000\042\354a\002\000\042\340+\002\000\346\023\002\000"},
+    {0x10190,13,"\300\326\353\255\002\000\300\326\357\243\002\000\300\326\353\231\002\000\300\326\315\346\002\000\300\326\332Y\315\346\002\000\300\326\354[\002\000\300\326\332!\002\000\300\326\350\336\002\000\300\326\353\244\002\000\300\326\333\250\002\000\300\326\302\225\002\000\300\326\325\033\002\000\322\333\014\000"},
+    {0x101A0,1,"\042\014\302\077\301\230\000"},
+    {0x101D0,32,"\300\372\300\343\002\315H\000\300\372\300\343\002\3505\301\225\000\300\372\300\343\002\355\367\301\225\000\300\372\300\343\002\324\352\000\300\372\300\343\002\307\134\000\300\372\300\343\002\304\026\000\300\372\300\343\002\306=\000\300\372\300\343\002\335\203\000\300\372\300\343\002\356b\000\300\372\300\343\002\034\000\300\372\300\343\002\304|\000\300\372\300\343\002\310\313\000\300\372\300\343\002\307d\000\300\372\300\343\002\343\224\000\300\372\300\343\002\343\272\000\300\372\300\343\002\310\273\000\300\372\300\343\002\314B\000\300\372\300\343\002\312\177\000\300\372\300\343\002\312\226\315m\000\300\372\300\343\002\332\207\000\300\372\300\343\002\326\014\000\300\372\300\343\002\354\207\000\300\372\300\343\002\326\013\000\300\372\300\343\002\324*\000\300\372\300\343\002\310\314\000\300\372\300\343\002\301R\000\300\372\300\343\002\336\263\000\300\372\300\343\002\324\225\302\017\000\300\372\300\343\002\302\265\000\300\372\300\343\002\306\272\000\300\372\300\343\002\313\033\000\300\372\300\343\002\313\007\000"},
+    {0x101F0,14,"\300\372\300\343\002\357\027\000\300\372\300\343\002\304w\000\300\372\300\343\002\315m\303h\000\300\372\300\343\002\303\254\000\300\372\300\343\002\347\251\000\300\372\300\343\002\310\265\000\300\372\300\343\002\342c\000\300\372\300\343\002\306\232\302\327\000\300\372\300\343\002\313P\000\300\372\300\343\002\336\015\000\300\372\300\343\002\355\030\000\300\372\300\343\002\004\3076\000\300\372\300\343\002\303+\323\361\000\300\372\300\343\002 \302OI\000"},
+    {0x10280,29,"\301\207\001\025\000\301\207\0019\000\301\207\001\077\000\301\207\001\3249\000\301\207\001\300\003\000\301\207\001\300\024\000\301\207\001;\000\301\207\001\300P\000\301\207\001\300 \000\301\207\001\304\006\000\301\207\001\300U\000\301\207\001\300\011\000\301\207\001\300\260\000\301\207\001p\000\301\207\001\261\000\301\207\001\232\000\301\207\001\306\177\000\301\207\001\305z\000\301\207\0011\000\301\207\001\300<\000\301\207\001\306X\000\301\207\001c\000\301\207\001d\000\301\207\001\300\007\000\301\207\001\311*\000\301\207\001\3016\000\301\207\001\300\276\000\301\207\001\300\026\000\301\207\001\300>\000"},
+    {0x102A0,32,"\300\342\001\025\000\300\342\001\347r\000\300\342\001\300\024\000\300\342\001p\000\300\342\001\357\305\000\300\342\001c\000\300\342\001\342*\000\300\342\001\307'\000\300\342\001\300\260\000\300\342\001\077\000\300\342\001\261\000\300\342\0016\000\300\342\001\331\313\000\300\342\001\300\007\000\300\342\001\304P\000\300\342\001\353\357\000\300\342\001d\000\300\342\001\324\261\000\300\342\0011\000\300\342\001\305z\000\300\342\001\300>\000\300\342\001\232\000\300\342\001\356\367\000\300\342\001\300<\000\300\342\001\306\351\000\300\342\001;\000\300\342\0019\000\300\342\001\357\310\000\300\342\001\300\011\000\300\342\001\340\263\000\300\342\001\345)\000\300\342\001\300l\000"},
+    {0x102C0,17,"\300\342\001\300\003\000\300\342\001\335o\000\300\342\001\310\353\000\300\342\001\354\366\000\300\342\001\302\022\000\300\342\001\300T\000\300\342\001\324\262\000\300\342\001\311*\000\300\342\001\357\306\000\300\342\001\301%\000\300\342\001\310'\000\300\342\001\343\300\000\300\342\001\343\301\000\300\342\001\343\302\000\300\342\001\342+\000\300\342\001\302\337\000\300\342\001\357\307\000"},
+    {0x102E0,28,"^\301\224\304\014+\000^\301\224\0172\000^\301\224\0177\000^\301\224\017B\000^\301\224\017O\000^\301\224\017V\000^\301\224\017v\000^\301\224\017\201\000^\301\224\017u\000^\301\224\017\211\000^\301\224\036\300H\000^\301\224\036\300\351\000^\301\224\036\301\200\000^\301\224\036\301\237\000^\301\224\036\301H\000^\301\224\036\302R\000^\301\224\036\301V\000^\301\224\036\302w\000^\301\224\036\3010\000^\301\224\0362\207\000^\301\224\0367\207\000^\301\224\036B\207\000^\301\224\036O\207\000^\301\224\036V\207\000^\301\224\036v\207\000^\301\224\036\201\207\000^\301\224\036u\207\000^\301\224\036\211\207\000"},
+    {0x10300,32,"%-\001\025\000%-\001\302r\000%-\001\301\377\000%-\001\301\350\000%-\0019\000%-\001\302W\000%-\001\301\370\000%-\001\301\027\000%-\001\301\011\000%-\001;\000%-\001[\000%-\001\301\334\000%-\001\302,\000%-\001\300\276\000%-\001\302 \000%-\0016\000%-\001\300\363\000%-\001\300\374\000%-\001\301\355\000%-\001\302z\000%-\001\303\013\000%-\001\301=\000%-\0011\000%-\001\334\014\000%-\001\310\205\000%-\001\307\374\000%-\001\303A\000%-\001\3345\000%-\001\301\316\000%-\001\300T\000%-\001\300l\000%-\001\334=\000"},
+    {0x10320,4,"%-\300\1342\000%-\300\134V\000%-\300\134\300H\000%-\300\134\301H\000"},
+    {0x1032D,30,"%-\001\302o\000%-\001\314\375\302\254\000%-\001\316$\302\254\000\301\240\001\322U\000\301\240\001\323\354\000\301\240\001\335\330\000\301\240\001\331\324\000\301\240\001\322X\000\301\240\001\350\260\000\301\240\001\340P\000\301\240\001\336S\000\301\240\001\356@\000\301\240\001\334\010\000\301\240\001\341\250\000\301\240\001\341\346\000\301\240\001\343\230\000\301\240\001\345\010\000\301\240\001\340b\000\301\240\001\357\273\000\301\240\001\347\200\000\301\240\001\3010\000\301\240\001\351/\000\301\240\001\352n\000\301\240\001\356\024\000\301\240\001\361\022\000\301\240\001\334\261\000\301\240\001\340\017\000\301\240\001\313\273\000\301\240\001\347U\000\301\240\001\211\207\000"},
+    {0x10350,32,"%\301\015\001\3016\000%\301\015\001\303t\000%\301\015\001\335t\000%\301\015\001\313\001\000%\301\015\0019\000%\301\015\001\362Q\000%\301\015\001\333\275\000%\301\015\001\307\042\000%\301\015\001\333\276\000%\301\015\001;\000%\301\015\001\341m\000%\301\015\001\3427\000%\301\015\001\343\344\000%\301\015\001\314\332\000%\301\015\001\360\231\000%\301\015\001\347\316\000%\301\015\001\351X\000%\301\015\001\305\247\000%\301\015\0015\000%\301\015\0011\000%\301\015\001\325C\000%\301\015\001\354\031\000%\301\015\001\353\377\000%\301\015\001\361\346\000%\301\015\001\303/\000%\301\015\0016\000%\301\015\001\300\354\000%\301\015\001\303A\000%\301\015\001\203\000%\301\015\001\356\362\000%\301\015\001\3605\000%\301\015\001\305\315\000"},
+    {0x10370,11,"%\301\015\001\307\033\000%\301\015\001\303\255\000%\301\015\001\302L\000%\301\015\001\301)\000%\301\015\001\264\000%\301\015\001\306C\000 %\301\015\001\3016\000 %\301\015\001\313\001\000 %\301\015\001\307\042\000 %\301\015\001\314\332\000 %\301\015\001\305\247\000"},
+    {0x10380,30,"\301t\001\322t\000\301t\001\302\033\000\301t\001\335y\000\301t\001\300\223\000\301t\001\302\012\000\301t\001\301\242\000\301t\001\301\331\000\301t\001\302\323\000\301t\001\337`\000\301t\001\304b\000\301t\001\303n\000\301t\001\300\337\000\301t\001\301[\000\301t\001\302\242\000\301t\001\302#\000\301t\001\3325\000\301t\001\300\263\000\301t\001\303\005\000\301t\001\352[\000\301t\001\300\375\000\301t\001\302\312\000\301t\001\315\315\000\301t\001\350\323\000\301t\001\3518\000\301t\001\356/\000\301t\001\301\261\000\301t\001C\000\301t\001;\000\301t\0011\000\301t\001\310\352\000"},
+    {0x1039F,32,"\301t\301\344\304\214\000%\300\321\002\025\000%\300\321\002;\000%\300\321\0021\000%\300\321\002[\000%\300\321\002\301\355\000%\300\321\002\300\005\000%\300\321\002\302H\000%\300\321\002\302\222\000%\300\321\002\300m\000%\300\321\002\300g\000%\300\321\002\303\323\000%\300\321\002\265\000%\300\321\002\301\313\000%\300\321\002\300\001\000%\300\321\002\302\036\000%\300\321\002\302\037\000%\300\321\002\300\254\000%\300\321\002\230\000%\300\321\002\300\042\000%\300\321\002\301\026\000%\300\321\002\256\000%\300\321\002\301e\000%\300\321\002\251\000%\300\321\002\301|\000%\300\321\002\301!\000%\300\321\002\264\000%\300\321\002\300\307\000%\300\321\002\303\253\000%\300\321\002\235\000%\300\321\002\301\337\000%\300\321\002\252\000"},
+    {0x103BF,5,"%\300\321\002\271\000%\300\321\002\300\341\000%\300\321\002\300j\000%\300\321\002\301&\000%\300\321\002\203\000"},
+    {0x103C8,14,"%\300\321\002\322\373\000%\300\321\002\322\374\000%\300\321\002\322\375\000%\300\321\002\361d\000%\300\321\002\331\326\000%\300\321\002\331\327\000%\300\321\002\323\343\000%\300\321\002\324\250\000%\300\321\301\344\304\214\000%\300\321\0362\000%\300\321\0367\000%\300\321\036\300H\000%\300\321\036\300\351\000%\300\321\036\207\000"},
+    {0x10400,32,"\300Q\006\001\253;\000\300Q\006\001\2539\000\300Q\006\001\253\025\000\300Q\006\001\253\302\324\000\300Q\006\001\2536\000\300Q\006\001\253\300\354\000\300Q\006\001\300w;\000\300Q\006\001\300w9\000\300Q\006\001\300w\025\000\300Q\006\001\300w\302\324\000\300Q\006\001\300w6\000\300Q\006\001\300w\300\354\000\300Q\006\001\302\325\000\300Q\006\001\305\205\000\300Q\006\001\303.\000\300Q\006\001\305\004\000\300Q\006\001\300\026\000\300Q\006\001\303\227\000\300Q\006\001\304w\000\300Q\006\001\304\357\000\300Q\006\001\304\211\000\300Q\006\001\305\362\000\300Q\006\001\304\261\000\300Q\006\001\307\370\000\300Q\006\001\313k\000\300Q\006\001\303A\000\300Q\006\001\304\023\000\300Q\006\001\303\306\000\300Q\006\001\305\264\000\300Q\006\001\303\013\000\300Q\006\001\305\317\000\300Q\006\001\302 \000"},
+    {0x10420,32,"\300Q\006\001\307$\000\300Q\006\001\302z\000\300Q\006\001\301\334\000\300Q\006\001\302,\000\300Q\006\001\300\276\000\300Q\006\001\302\341\000\300Q\006\001\305\200\000\300Q\006\001\307\241\000\300Q\004\001\253;\000\300Q\004\001\2539\000\300Q\004\001\253\025\000\300Q\004\001\253\302\324\000\300Q\004\001\2536\000\300Q\004\001\253\300\354\000\300Q\004\001\300w;\000\300Q\004\001\300w9\000\300Q\004\001\300w\025\000\300Q\004\001\300w\302\324\000\300Q\004\001\300w6\000\300Q\004\001\300w\300\354\000\300Q\004\001\302\325\000\300Q\004\001\305\205\000\300Q\004\001\303.\000\300Q\004\001\305\004\000\300Q\004\001\300\026\000\300Q\004\001\303\227\000\300Q\004\001\304w\000\300Q\004\001\304\357\000\300Q\004\001\304\211\000\300Q\004\001\305\362\000\300Q\004\001\304\261\000\300Q\004\001\307\370\000"},
+    {0x10440,32,"\300Q\004\001\313k\000\300Q\004\001\303A\000\300Q\004\001\304\023\000\300Q\004\001\303\306\000\300Q\004\001\305\264\000\300Q\004\001\303\013\000\300Q\004\001\305\317\000\300Q\004\001\302 \000\300Q\004\001\307$\000\300Q\004\001\302z\000\300Q\004\001\301\334\000\300Q\004\001\302,\000\300Q\004\001\300\276\000\300Q\004\001\302\341\000\300Q\004\001\305\200\000\300Q\004\001\307\241\000\300\355\001\347\321\000\300\355\001\316\225\000\300\355\001\3413\000\300\355\001\304-\000\300\355\001\356:\000\300\355\001\301\273\000\300\355\001\355Y\000\300\355\001\312\254\000\300\355\001\361\257\000\300\355\001\337p\000\300\355\001\324A\000\300\355\001\332\013\000\300\355\001\335s\000\300\355\001\360\234\000\300\355\001\3567\000\300\355\001\317;\000"},
+    {0x10460,32,"\300\355\001\304@\000\300\355\001\340\223\000\300\355\001\361\036\000\300\355\001\336L\000\300\355\001\342\211\000\300\355\001\344C\000\300\355\001\340\015\000\300\355\001\313!\000\300\355\001\300\274\000\300\355\001\322:\000\300\355\001\300\216\000\300\355\001\316\376\000\300\355\001\302b\000\300\355\001\302\324\000\300\355\001\351\256\000\300\355\001\300\263\000\300\355\001\304\221\000\300\355\001\322M\000\300\355\001\303\321\000\300\355\001b\000\300\355\001\347\035\000\300\355\001\347G\000\300\355\001\306\226\000\300\355\001\323\011\000\300\355\001\322\276\000\300\355\001\300\037\000\300\355\001\304o\000\300\355\001\306\033\000\300\355\001\322\314\000\300\355\001\304(\000\300\355\001\313\302\000\300\355\001\361\300\000"},
+    {0x10480,30,"\301$\001w\000\301$\001\300\042\000\301$\001\265\000\301$\001\300g\000\301$\001\302\222\000\301$\001\300\223\000\301$\001\332\024\000\301$\001\235\000\301$\001\271\000\301$\001\354\017\000\301$\001\300\353\000\301$\001\312\233\000\301$\001\300\005\000\301$\001\301\026\000\301$\001\310\243\000\301$\001\313\352\000\301$\001\341\330\000\301$\001\344:\000\301$\001\346\205\000\301$\001\301\024\000\301$\001\203\000\301$\001\264\000\301$\001\025\000\301$\0019\000\301$\001;\000\301$\0016\000\301$\0011\000\301$\001\300/\000\301$\001\301\017\000\301$\001\300\354\000"},
+    {0x104A0,10,"\301$\017\300%\000\301$\0172\000\301$\0177\000\301$\017B\000\301$\017O\000\301$\017V\000\301$\017v\000\301$\017\201\000\301$\017u\000\301$\017\211\000"},
+    {0x104B0,32,"\300v\006\001\025\000\300v\006\001\300L\000\300v\006\001\300\375\000\300v\006\001\302\324\000\300v\006\001\312\203\000\300v\006\001\300\220\000\300v\006\001\313#\000\300v\006\0019\000\300v\006\001\313)\000\300v\006\001\203\000\300v\006\001\313\277\000\300v\006\001;\000\300v\006\001[\000\300v\006\001\313$\000\300v\006\001\310\012\000\300v\006\001\252\000\300v\006\001\251\000\300v\006\001\256\000\300v\006\0016\000\300v\006\001\315\036\000\300v\006\001\230\000\300v\006\001\313%\000\300v\006\001\271\000\300v\006\001\300j\000\300v\006\001\265\000\300v\006\001\313&\000\300v\006\001\301\201\000\300v\006\001\313'\000\300v\006\001\302\217\000\300v\006\001\300\353\000\300v\006\0011\000\300v\006\001\300q\000"},
+    {0x104D0,4,"\300v\006\001\300\223\000\300v\006\001\300\361\000\300v\006\001\300\341\000\300v\006\001\301\371\000"},
+    {0x104D8,32,"\300v\004\001\025\000\300v\004\001\300L\000\300v\004\001\300\375\000\300v\004\001\302\324\000\300v\004\001\312\203\000\300v\004\001\300\220\000\300v\004\001\313#\000\300v\004\0019\000\300v\004\001\313)\000\300v\004\001\203\000\300v\004\001\313\277\000\300v\004\001;\000\300v\004\001[\000\300v\004\001\313$\000\300v\004\001\310\012\000\300v\004\001\252\000\300v\004\001\251\000\300v\004\001\256\000\300v\004\0016\000\300v\004\001\315\036\000\300v\004\001\230\000\300v\004\001\313%\000\300v\004\001\271\000\300v\004\001\300j\000\300v\004\001\265\000\300v\004\001\313&\000\300v\004\001\301\201\000\300v\004\001\313'\000\300v\004\001\302\217\000\300v\004\001\300\353\000\300v\004\0011\000\300v\004\001\300q\000"},
+    {0x104F8,4,"\300v\004\001\300\223\000\300v\004\001\300\361\000\300v\004\001\300\341\000\300v\004\001\301\371\000"},
+    {0x10500,32,"\301 \001\025\000\301 \001\302r\000\301 \001\303u\000\301 \001\301\316\000\301 \001\301\350\000\301 \001\306\206\000\301 \001\305&\000\301 \001\303\177\000\301 \0019\000\301 \001\302\343\000\301 \001\303J\000\301 \001\307\306\000\301 \001\301\027\000\301 \001;\000\301 \001\302\347\000\301 \001\301\377\000\301 \001\300\345\000\301 \001\342|\000\301 \001\301S\000\301 \001\301K\000\301 \001\256\000\301 \001\303\351\000\301 \0016\000\301 \001\300\363\000\301 \001\306\263\000\301 \001\302:\000\301 \001\315\304\000\301 \001\301\363\000\301 \001\300\374\000\301 \001\301=\000\301 \001\301\011\000\301 \0011\000"},
+    {0x10520,8,"\301 \001\302W\000\301 \001\305\002\000\301 \001\300$\000\301 \001\301\370\000\301 \001\302q\000\301 \001\3021\000\301 \001\335\304\000\301 \001\307\374\000"},
+    {0x10530,32,"\300\317\300\315\001\322v\000\300\317\300\315\001\304y\000\300\317\300\315\001\307\305\000\300\317\300\315\001\312\333\000\300\317\300\315\001\307\231\000\300\317\300\315\001\3629\000\300\317\300\315\001\313B\000\300\317\300\315\001\362P\000\300\317\300\315\001\355\364\000\300\317\300\315\001\300\220\000\300\317\300\315\001\361\341\000\300\317\300\315\001\301\371\000\300\317\300\315\001\340C\000\300\317\300\315\001\300j\000\300\317\300\315\001\314+\000\300\317\300\315\001\340>\000\300\317\300\315\001\361R\000\300\317\300\315\001\333\272\000\300\317\300\315\001\303\271\000\300\317\300\315\001\340k\000\300\317\300\315\001\340\331\000\300\317\300\315\001\342\267\000\300\317\300\315\001\336\232\000\300\317\300\315\001\350\266\000\300\317\300\315\001\322\244\000\300\317\300\315\001\325b\000\300\317\300\315\001\301\256\000\300\317\300\315\001\331g\000\300\317\300\315\001\314\217\000\300\317\300\315\001\305\226\000\300\317\300\315\001\346!\000\300\317\300\315\001\333\277\000"},
+    {0x10550,20,"\300\317\300\315\001\353\361\000\300\317\300\315\001\340`\000\300\317\300\315\001\300\216\000\300\317\300\315\001\3576\000\300\317\300\315\001\334\267\000\300\317\300\315\001\333\274\000\300\317\300\315\001\312\246\000\300\317\300\315\001\304\323\000\300\317\300\315\001\335\320\000\300\317\300\315\001\306\273\000\300\317\300\315\001\353\353\000\300\317\300\315\001\360q\000\300\317\300\315\001\356{\000\300\317\300\315\001\315\366\000\300\317\300\315\001\340R\000\300\317\300\315\001\331f\000\300\317\300\315\001\312\233\000\300\317\300\315\001\361\255\000\300\317\300\315\001\310\213\000\300\317\300\315\001\341H\000"},
+    {0x1056F,12,"\300\317\300\315\325\202+\000\300\202\006\001\025\000\300\202\006\001\305\022\000\300\202\006\001\302r\000\300\202\006\001\303u\000\300\202\006\001\301\316\000\300\202\006\001\301\350\000\300\202\006\001\305&\000\300\202\006\001\303\177\000\300\202\006\0019\000\300\202\006\001\302\343\000\300\202\006\001\300\005\000"},
+    {0x1057C,15,"\300\202\006\001\203\000\300\202\006\001\303\213\000\300\202\006\001;\000\300\202\006\001\313\314\000\300\202\006\001\302\347\000\300\202\006\001[\000\300\202\006\001\252\000\300\202\006\001\301\243\000\300\202\006\001\301S\000\300\202\006\001\301K\000\300\202\006\001\303\351\000\300\202\006\0016\000\300\202\006\001\300\363\000\300\202\006\001\302\023\000\300\202\006\001\302:\000"},
+    {0x1058C,7,"\300\202\006\001\301\363\000\300\202\006\001\300\374\000\300\202\006\001\301=\000\300\202\006\001\301\011\000\300\202\006\0011\000\300\202\006\001\302W\000\300\202\006\001\305\002\000"},
+    {0x10594,2,"\300\202\006\001\300$\000\300\202\006\001\301\370\000"},
+    {0x10597,11,"\300\202\004\001\025\000\300\202\004\001\305\022\000\300\202\004\001\302r\000\300\202\004\001\303u\000\300\202\004\001\301\316\000\300\202\004\001\301\350\000\300\202\004\001\305&\000\300\202\004\001\303\177\000\300\202\004\0019\000\300\202\004\001\302\343\000\300\202\004\001\300\005\000"},
+    {0x105A3,15,"\300\202\004\001\203\000\300\202\004\001\303\213\000\300\202\004\001;\000\300\202\004\001\313\314\000\300\202\004\001\302\347\000\300\202\004\001[\000\300\202\004\001\252\000\300\202\004\001\301\243\000\300\202\004\001\301S\000\300\202\004\001\301K\000\300\202\004\001\303\351\000\300\202\004\0016\000\300\202\004\001\300\363\000\300\202\004\001\302\023\000\300\202\004\001\302:\000"},
+    {0x105B3,7,"\300\202\004\001\301\363\000\300\202\004\001\300\374\000\300\202\004\001\301=\000\300\202\004\001\301\011\000\300\202\004\0011\000\300\202\004\001\302W\000\300\202\004\001\305\002\000"},
+    {0x105BB,2,"\300\202\004\001\300$\000\300\202\004\001\301\370\000"},
+    {0x10600,32,"\037\025\002\321\324\000\037\025\002\321\325\000\037\025\002\321\326\000\037\025\002\321\327\000\037\025\002\321\330\000\037\025\002\321\331\000\037\025\002\321\332\000\037\025\002\321\333\000\037\025\002\321\334\000\037\025\002\321\335\000\037\025\002\321\336\000\037\025\002\321\337\000\037\025\002\321\340\000\037\025\002\321\341\000\037\025\002\321\342\000\037\025\002\321\343\000\037\025\002\321\344\000\037\025\002\321\345\000\037\025\002\321\346\000\037\025\002\321\347\000\037\025\002\321\350\000\037\025\002\321\351\000\037\025\002\321\352\000\037\025\002\321\353\000\037\025\002\321\354\000\037\025\002\321\355\000\037\025\002\321\356\000\037\025\002\317W\000\037\025\002\321\357\000\037\025\002\321\360\000\037\025\002\321\361\000\037\025\002\321\362\000"},
+    {0x10620,32,"\037\025\002\321\363\000\037\025\002\321\364\000\037\025\002\321\365\000\037\025\002\321\366\000\037\025\002\321\367\000\037\025\002\321\370\000\037\025\002\321\371\000\037\025\002\321\372\000\037\025\002\321\373\000\037\025\002\321\374\000\037\025\002\321\375\000\037\025\002\321\376\000\037\025\002\321\377\000\037\025\002\322\001\000\037\025\002\322\002\000\037\025\002\322\003\000\037\025\002\322\004\000\037\025\002\322\005\000\037\025\002\322\006\000\037\025\002\322\007\000\037\025\002\322\010\000\037\025\002\322\011\000\037\025\002\322\012\000\037\025\002\322\013\000\037\025\002\322\014\000\037\025\002\322\015\000\037\025\002\322\016\000\037\025\002\322\017\000\037\025\002\322\020\000\037\025\002\322\021\000\037\025\002\322\022\000\037\025\002\322\023\000"},
+    {0x10640,32,"\037\025\002\322\024\000\037\025\002\322\025\000\037\025\002\322\026\000\037\025\002\322\027\000\037\025\002\322\030\000\037\025\002\322\031\000\037\025\002\322\032\000\037\025\002\317\203\000\037\025\002\322\033\000\037\025\002\322\034\000\037\025\002\317\246\000\037\025\002\322\035\000\037\025\002\322\036\000\037\025\002\322\037\000\037\025\002\322 \000\037\025\002\317\263\000\037\025\002\322!\000\037\025\002\322\042\000\037\025\002\322#\000\037\025\002\322$\000\037\025\002\322%\000\037\025\002\311\252\000\037\025\002\311\253\000\037\025\002\311\254\000\037\025\002\311\255\000\037\025\002\311\256\000\037\025\002\311\257\000\037\025\002\311\260\000\037\025\002\311\261\000\037\025\002\311\262\000\037\025\002\320l\000\037\025\002\320m\000"},
+    {0x10660,32,"\037\025\002\311\263\000\037\025\002\311\264\000\037\025\002\311\265\000\037\025\002\320o\000\037\025\002\320p\000\037\025\002\320q\000\037\025\002\311\266\000\037\025\002\311\267\000\037\025\002\311\270\000\037\025\002\311\271\000\037\025\002\311\272\000\037\025\002\311\273\000\037\025\002\311\274\000\037\025\002\311\275\000\037\025\002\311\276\000\037\025\002\311\277\000\037\025\002\311\300\000\037\025\002\311\301\000\037\025\002\311\302\000\037\025\002\311\303\000\037\025\002\311\304\000\037\025\002\311\305\000\037\025\002\311\306\000\037\025\002\311\307\000\037\025\002\320s\000\037\025\002\311\310\000\037\025\002\311\311\000\037\025\002\311\312\000\037\025\002\311\313\000\037\025\002\311\314\000\037\025\002\311\315\000\037\025\002\311\316\000"},
+    {0x10680,32,"\037\025\002\311\317\000\037\025\002\311\320\000\037\025\002\311\321\000\037\025\002\311\322\000\037\025\002\311\323\000\037\025\002\311\324\000\037\025\002\311\325\000\037\025\002\311\326\000\037\025\002\311\327\000\037\025\002\311\330\000\037\025\002\311\331\000\037\025\002\311\332\000\037\025\002\311\333\000\037\025\002\311\334\000\037\025\002\311\335\000\037\025\002\311\336\000\037\025\002\311\337\000\037\025\002\311\340\000\037\025\002\311\341\000\037\025\002\311\342\000\037\025\002\311\343\000\037\025\002\311\344\000\037\025\002\311\345\000\037\025\002\311\346\000\037\025\002\311\347\000\037\025\002\311\350\000\037\025\002\311\351\000\037\025\002\311\352\000\037\025\002\311\353\000\037\025\002\311\354\000\037\025\002\311\355\000\037\025\002\311\356\000"},
+    {0x106A0,32,"\037\025\002\320\236\000\037\025\002\320\240\000\037\025\002\320\242\000\037\025\002\320\244\000\037\025\002\320\246\000\037\025\002\320\250\000\037\025\002\320\252\000\037\025\002\320\254\000\037\025\002\320\256\000\037\025\002\320\260\000\037\025\002\320\262\000\037\025\002\320\265\000\037\025\002\320\267\000\037\025\002\320\271\000\037\025\002\320\273\000\037\025\002\320\275\000\037\025\002\320\277\000\037\025\002\320\301\000\037\025\002\320\303\000\037\025\002\311\357\000\037\025\002\311\360\000\037\025\002\311\361\000\037\025\002\311\362\000\037\025\002\311\363\000\037\025\002\311\364\000\037\025\002\311\365\000\037\025\002\311\366\000\037\025\002\311\367\000\037\025\002\311\370\000\037\025\002\311\371\000\037\025\002\311\372\000\037\025\002\311\373\000"},
+    {0x106C0,32,"\037\025\002\311\374\000\037\025\002\311\375\000\037\025\002\311\376\000\037\025\002\311\377\000\037\025\002\312\001\000\037\025\002\312\002\000\037\025\002\312\003\000\037\025\002\312\004\000\037\025\002\312\005\000\037\025\002\312\006\000\037\025\002\312\007\000\037\025\002\321\034\000\037\025\002\321\035\000\037\025\002\321\036\000\037\025\002\321\037\000\037\025\002\321 \000\037\025\002\321!\000\037\025\002\321\042\000\037\025\002\321#\000\037\025\002\321$\000\037\025\002\321%\000\037\025\002\321&\000\037\025\002\321'\000\037\025\002\321(\000\037\025\002\321)\000\037\025\002\321*\000\037\025\002\321+\000\037\025\002\321,\000\037\025\002\321-\000\037\025\002\321.\000\037\025\002\321/\000\037\025\002\3210\000"},
+    {0x106E0,32,"\037\025\002\3211\000\037\025\002\3212\000\037\025\002\3213\000\037\025\002\3214\000\037\025\002\3215\000\037\025\002\3216\000\037\025\002\3217\000\037\025\002\3218\000\037\025\002\3219\000\037\025\002\321:\000\037\025\002\321;\000\037\025\002\321<\000\037\025\002\321=\000\037\025\002\321>\000\037\025\002\321\077\000\037\025\002\321@\000\037\025\002\321A\000\037\025\002\321B\000\037\025\002\321C\000\037\025\002\321D\000\037\025\002\321E\000\037\025\002\321F\000\037\025\002\321G\000\037\025\002\321H\000\037\025\002\321I\000\037\025\002\321J\000\037\025\002\321K\000\037\025\002\321L\000\037\025\002\321M\000\037\025\002\321N\000\037\025\002\321O\000\037\025\002\321P\000"},
+    {0x10700,32,"\037\025\002\321Q\000\037\025\002\321R\000\037\025\002\321S\000\037\025\002\321T\000\037\025\002\321U\000\037\025\002\321V\000\037\025\002\321W\000\037\025\002\321X\000\037\025\002\321Y\000\037\025\002\321Z\000\037\025\002\321[\000\037\025\002\321\134\000\037\025\002\321]\000\037\025\002\321^\000\037\025\002\321_\000\037\025\002\321`\000\037\025\002\321a\000\037\025\002\321b\000\037\025\002\321c\000\037\025\002\321d\000\037\025\002\321e\000\037\025\002\321f\000\037\025\002\321g\000\037\025\002\321h\000\037\025\002\321i\000\037\025\002\321j\000\037\025\002\321k\000\037\025\002\321l\000\037\025\002\321m\000\037\025\002\321n\000\037\025\002\321o\000\037\025\002\321p\000"},
+    {0x10720,23,"\037\025\002\321q\000\037\025\002\321r\000\037\025\002\321s\000\037\025\002\321t\000\037\025\002\321u\000\037\025\002\321v\000\037\025\002\321w\000\037\025\002\321x\000\037\025\002\321y\000\037\025\002\321z\000\037\025\002\321{\000\037\025\002\321|\000\037\025\002\321}\000\037\025\002\321~\000\037\025\002\321\177\000\037\025\002\321\200\000\037\025\002\321\201\000\037\025\002\321\202\000\037\025\002\321\203\000\037\025\002\321\204\000\037\025\002\321\205\000\037\025\002\321\206\000\037\025\002\321\207\000"},
+    {0x10740,22,"\037\025\002\321\210\025\000\037\025\002\321\211\077\000\037\025\002\321\212\300\024\000\037\025\002\321\2139\000\037\025\002\321\214\300u\000\037\025\002\321\215\300\026\000\037\025\002\321\216\300U\000\037\025\002\321\217\300\011\000\037\025\002\321\220p\000\037\025\002\321\221\341\322\000\037\025\002\321\222\341\323\000\037\025\002\321\223\341\324\000\037\025\002\321\224\341\325\000\037\025\002\321\225\300P\000\037\025\002\321\226\300>\000\037\025\002\321\227\300$\000\037\025\002\321\230\300n\000\037\025\002\321\231\322(\000\037\025\002\321\232\324\005\000\037\025\002\321\233\331\355\000\037\025\002\321\234\334a\000\037\025\002\321\235\302\347\000"},
+    {0x10760,8,"\037\025\002\321\236\000\037\025\002\321\237\000\037\025\002\321\240\000\037\025\002\321\241\000\037\025\002\321\242\000\037\025\002\321\243\000\037\025\002\321\244\000\037\025\002\321\245\000"},
+    {0x10780,6,">\001\004\006\300/\000>\001\301\232\301\366\301^\000>\001\301\232o\301\366\301^\000>\001\004\301X\000>\001\004\006\077\000>\001\004\077\003S\000"},
+    {0x10787,32,">\001\004\303@\301k\000>\001\004\303@\301k\003\301\022S\000>\001\004\303@\301k\003\301\347\000>\001\004\306\005\301k\000>\001\004\300\024\003\300\253\000>\001\004\300\024\003S\000>\001\004\300\024\003S\031\300\253\000>\001\004\300:9\000>\001\004\301\005\300:\2629\000>\001\004\307\250\301k\000>\001\004\315\232\301R\000>\001\004\006\300\003\000>\001\004\300\003\003S\000>\001\004\006\300\003\003S\000>\001\004\300\026\003I\000>\001\004\006\300\026\000>\001\004\305I\003S\000>\001\004\301\375\300U\003I\031S\000>\001\004\314Q\301k\000>\001\004\314[\301k\000>\001\004p\003\303\006\000>\001\004\006p\003\303\006\000>\001\004p\003\301\022S\031\303\006\000>\001\004\306l\000>\001\004\306l\003\301\022S\000>\001\004\241\300$\000>\001\004\241\300$\003\303\006\000>\001\0046\003I\000>\001\004\006\301\007\000>\001\004\301\005\300n\000>\001\004\300\260\000>\001\004\241c\003\253\302\017\000"},
+    {0x107A7,10,">\001\004\241c\003\253\302\017\031\301\022S\000>\001\004c\003\300\253\000>\001\004c\003\303\311\000>\001\004\006c\000>\001\004\316n\301k\003\301\347\000>\001\004\307\003\301k\000>\001\004\307\003\301k\003\301\022S\000>\001\004\306\365\301k\000>\001\004\300\007\003\301\022S\000>\001\004\300\015\003&S\000"},
+    {0x107B2,9,">\001\004\006\300$\000>\001\301I\300k\003I\000>\001\300:\301I\300k\003I\000>\001\307F\303\011\000>\001\307\210\303\011\000>\001\3140\303\011\000>\001\312#\303\011\000>\001\301\022\303\011\003\301\022S\000>\001\004d\003\301\347\000"},
+    {0x10800,6,"\300\305\005\025\000\300\305\0059\000\300\305\005;\000\300\305\0056\000\300\305\0051\000\300\305\005\300g\000"},
+    {0x10808,1,"\300\305\005\303\022\000"},
+    {0x1080A,32,"\300\305\005[\000\300\305\005\301\377\000\300\305\005\301\323\000\300\305\005\301\303\000\300\305\005\301\355\000\300\305\005\252\000\300\305\005\300\345\000\300\305\005\300\227\000\300\305\005\302\020\000\300\305\005\301\265\000\300\305\005\251\000\300\305\005\301S\000\300\305\005\301|\000\300\305\005\301\361\000\300\305\005\301!\000\300\305\005\256\000\300\305\005\301K\000\300\305\005\301L\000\300\305\005\301#\000\300\305\005\301e\000\300\305\005\230\000\300\305\005\300\363\000\300\305\005\300\325\000\300\305\005\3029\000\300\305\005\302\312\000\300\305\005\235\000\300\305\005\302:\000\300\305\005\302d\000\300\305\005\301\267\000\300\305\005\301\337\000\300\305\005\271\000\300\305\005\301\363\000"},
+    {0x1082A,12,"\300\305\005\301\340\000\300\305\005\301\273\000\300\305\005\301\365\000\300\305\005\265\000\300\305\005\301=\000\300\305\005\302&\000\300\305\005C\000\300\305\005\301\313\000\300\305\005\300q\000\300\305\005\301\300\000\300\305\005\301\367\000\300\305\005\301\331\000"},
+    {0x10837,2,"\300\305\005\302\222\000\300\305\005\305\002\000"},
+    {0x1083C,1,"\300\305\005\300\341\000"},
+    {0x1083F,23,"\300\305\005\303\004\000\301q\301j\001\302B\000\301q\301j\001\302D\000\301q\301j\001\302]\000\301q\301j\001\303=\000\301q\301j\001\301\027\000\301q\301j\001\301\024\000\301q\301j\001\302\261\000\301q\301j\001\302|\000\301q\301j\001\303)\000\301q\301j\001\302\224\000\301q\301j\001\302_\000\301q\301j\001\302\201\000\301q\301j\001\302#\000\301q\301j\001\300\263\000\301q\301j\001\302g\000\301q\301j\001\302\326\000\301q\301j\001\300\363\000\301q\301j\001\302f\000\301q\301j\001\303\364\000\301q\301j\001\302\313\000\301q\301j\001\301[\000\301q\301j\001\302T\000"},
+    {0x10857,32,"\301q\301j\3013\002\000\301q\301j\0362\000\301q\301j\0367\000\301q\301j\036B\000\301q\301j\036\300H\000\301q\301j\036\300\351\000\301q\301j\0362\207\000\301q\301j\0362\254\000\301q\301j\036\300H\254\000\301f\001\302B\000\301f\001\302D\000\301f\001\302]\000\301f\001\303=\000\301f\001\301\027\000\301f\001\301\024\000\301f\001\302\261\000\301f\001\302|\000\301f\001\303)\000\301f\001\302\224\000\301f\001\302_\000\301f\001\302\201\000\301f\001\302#\000\301f\0013\300\263\000\301f\001\300\263\000\301f\001\302g\000\301f\001\302\326\000\301f\001\300\363\000\301f\001\302f\000\301f\001\303\364\000\301f\001\302\313\000\301f\001\301[\000\301f\001\302T\000"},
+    {0x10877,32,"\301f\302\016\307\256\000\301f\301\325\307\256\000\301f\0362\000\301f\0367\000\301f\036B\000\301f\036O\000\301f\036V\000\301f\036\300H\000\301f\036\300\351\000\301\042\0013\302B\000\301\042\001\302B\000\301\042\0013\302D\000\301\042\001\302D\000\301\042\001\302]\000\301\042\001\303=\000\301\042\0013\301\027\000\301\042\001\301\027\000\301\042\001\301\024\000\301\042\001\302\261\000\301\042\001\302|\000\301\042\001\303)\000\301\042\0013\302\224\000\301\042\001\302\224\000\301\042\0013\302_\000\301\042\001\302_\000\301\042\0013\302\201\000\301\042\001\302\201\000\301\042\0013\302#\000\301\042\001\302#\000\301\042\0013\300\263\000\301\042\001\300\263\000\301\042\001\302g\000"},
+    {0x10897,8,"\301\042\001\302\326\000\301\042\001\300\363\000\301\042\001\302f\000\301\042\001\303\364\000\301\042\001\302\313\000\301\042\0013\301[\000\301\042\001\301[\000\301\042\001\302T\000"},
+    {0x108A7,9,"\301\042\0362\000\301\042\0367\000\301\042\036B\000\301\042\036O\000\301\042\331R\036O\000\301\042\036V\000\301\042\036\300H\000\301\042\036\300\351\000\301\042\0362\207\000"},
+    {0x108E0,19,"\301\262\001\302B\000\301\262\001\302D\000\301\262\001\302]\000\301\262\001\331\334\000\301\262\001\301\027\000\301\262\001\301\024\000\301\262\001\3172\000\301\262\001\302|\000\301\262\001\303)\000\301\262\001\302\224\000\301\262\001\302_\000\301\262\001\302\201\000\301\262\001\302#\000\301\262\001\300\263\000\301\262\001\302g\000\301\262\001\312E\000\301\262\001\300\363\000\301\262\001\302f\000\301\262\001\303\364\000"},
+    {0x108F4,2,"\301\262\001\301[\000\301\262\001\302T\000"},
+    {0x108FB,32,"\301\262\0362\000\301\262\036V\000\301\262\036\300H\000\301\262\036\300\351\000\301\262\0362\207\000\301\214\001\322l\000\301\214\001\304y\000\301\214\001\335x\000\301\214\001\332 \000\301\214\001\301\027\000\301\214\001\311=\000\301\214\001\3623\000\301\214\001\313\241\000\301\214\001\304b\000\301\214\001\303n\000\301\214\001\300\337\000\301\214\001\342\027\000\301\214\001\302#\000\301\214\001\300\263\000\301\214\001\353\230\000\301\214\001\300\375\000\301\214\001\300\363\000\301\214\001\315\315\000\301\214\001\310\244\000\301\214\001\351\273\000\301\214\001\301[\000\301\214\001\302\077\000\301\214\0362\000\301\214\036\300H\000\301\214\036\300\351\000\301\214\0362\207\000\301\214\0367\000"},
+    {0x1091B,1,"\301\214\036B\000"},
+    {0x1091F,27,"\301\214\301\344\301\270\000\301\246\001\025\000\301\246\001\077\000\301\246\001\300\003\000\301\246\001\300\024\000\301\246\0019\000\301\246\001\300\015\000\301\246\001;\000\301\246\001\300$\000\301\246\001\300\011\000\301\246\001p\000\301\246\001\261\000\301\246\001\232\000\301\246\0016\000\301\246\001c\000\301\246\001\306\351\000\301\246\001\300\007\000\301\246\0011\000\301\246\001\300u\000\301\246\001\300\260\000\301\246\001d\000\301\246\001\311*\000\301\246\001\3016\000\301\246\001\300\276\000\301\246\001\310\037\000\301\246\001\305z\000\301\246\001\3005\000"},
+    {0x1093F,1,"\301\246\301\366+\000"},
+    {0x10980,32,"\234\301c\001\025\000\234\301c\0019\000\234\301c\001;\000\234\301c\0016\000\234\301c\001\264\000\234\301c\001\300q\000\234\301c\001\300\042\000\234\301c\001\323\333\000\234\301c\001\230\000\234\301c\001\251\000\234\301c\001\256\000\234\301c\001\314\311\000\234\301c\001\301K\000\234\301c\001\314\327\000\234\301c\001\235\000\234\301c\001\315\225\000\234\301c\001\252\000\234\301c\001\300\223\000\234\301c\001\303\213\000\234\301c\001\271\000\234\301c\001\315\314\000\234\301c\001\301\363\000\234\301c\001[\000\234\301c\001\302\023\000\234\301c\001\265\000\234\301c\001\316d\000\234\301c\001\301=\000\234\301c\001\316p\000\234\301c\001C\000\234\301c\001\300\001\000\234\301c\014\360v\000\234\301c\014\360w\000"},
+    {0x109A0,24,"\234\300+\001\025\000\234\300+\0019\000\234\300+\001;\000\234\300+\0016\000\234\300+\001\264\000\234\300+\001\300q\000\234\300+\001\300\042\000\234\300+\001\230\000\234\300+\001\251\000\234\300+\001\256\000\234\300+\001\301K\000\234\300+\001\235\000\234\300+\001\252\000\234\300+\001\300\223\000\234\300+\001\303\213\000\234\300+\001\271\000\234\300+\001\301\034\271\000\234\300+\001\301\363\000\234\300+\001[\000\234\300+\001\302\023\000\234\300+\001\265\000\234\300+\001\301=\000\234\300+\001C\000\234\300+\001\300\001\000"},
+    {0x109BC,20,"\234\300+\300\016\302\340\303i\000\234\300+\300\0162o\000\234\300+\303\334\351\245\000\234\300+\303\334\340\037\000\234\300+\0362\000\234\300+\0367\000\234\300+\036B\000\234\300+\036O\000\234\300+\036V\000\234\300+\036v\000\234\300+\036\201\000\234\300+\036u\000\234\300+\036\211\000\234\300+\036\300H\000\234\300+\036\300\351\000\234\300+\036\301\200\000\234\300+\036\301\237\000\234\300+\036\301H\000\234\300+\036\302R\000\234\300+\036\301V\000"},
+    {0x109D2,32,"\234\300+\0362\207\000\234\300+\0367\207\000\234\300+\036B\207\000\234\300+\036O\207\000\234\300+\036V\207\000\234\300+\036v\207\000\234\300+\036\201\207\000\234\300+\036u\207\000\234\300+\036\211\207\000\234\300+\0362\254\000\234\300+\0367\254\000\234\300+\036B\254\000\234\300+\036O\254\000\234\300+\036V\254\000\234\300+\036v\254\000\234\300+\036\201\254\000\234\300+\036u\254\000\234\300+\036\211\254\000\234\300+\036\300H\254\000\234\300+\036\300\351\254\000\234\300+\036\301\200\254\000\234\300+\036\301\237\254\000\234\300+\036\301H\254\000\234\300+\036\302R\254\000\234\300+\036\301V\254\000\234\300+\036\302w\254\000\234\300+\036\3010\254\000\234\300+\0362\207\254\000\234\300+\0367\207\254\000\234\300+\036B\207\254\000\234\300+\036O\207\254\000\234\300+\036V\207\254\000"},
+    {0x109F2,18,"\234\300+\036v\207\254\000\234\300+\036\201\207\254\000\234\300+\036u\207\254\000\234\300+\036\211\207\254\000\234\300+\300\0162\357(\000\234\300+\300\0167\303i\000\234\300+\300\016B\303i\000\234\300+\300\016O\303i\000\234\300+\300\016V\303i\000\234\300+\300\016v\303i\000\234\300+\300\016\201\303i\000\234\300+\300\016u\303i\000\234\300+\300\016\211\303i\000\234\300+\300\016\300H\303i\000\300\211\001\025\000\300\211\021\002;\000\300\211\021\0021\000\300\211\021\002|c\000"},
+    {0x10A05,2,"\300\211\021\0029\000\300\211\021\0026\000"},
+    {0x10A0C,8,"\300\211\021\302\202+\000\300\211\0024\240:\000\300\211\002\300\316\000\300\211\002\3014\000\300\211\001[\000\300\211\001\300\223\000\300\211\001\300\005\000\300\211\001\300\361\000"},
+    {0x10A15,3,"\300\211\001\300m\000\300\211\001\300\220\000\300\211\001\300g\000"},
+    {0x10A19,29,"\300\211\001\300\225\000\300\211\001\300\334\000\300\211\001\301\023\000\300\211\001\300\335\000\300\211\001\301\036\000\300\211\001\301\002\000\300\211\001\265\000\300\211\001\300\254\000\300\211\001\300\001\000\300\211\001\300\353\000\300\211\001\256\000\300\211\001\230\000\300\211\001\300\306\000\300\211\001\300\042\000\300\211\001\301\004\000\300\211\001\251\000\300\211\001\264\000\300\211\001\235\000\300\211\001\252\000\300\211\001\300\307\000\300\211\001\300j\000\300\211\001\301&\000\300\211\001\271\000\300\211\001\300\341\000\300\211\001\203\000\300\211\001\310\001\000\300\211\001\357\005\000\300\211\001\316\267\000\300\211\001\360s\000"},
+    {0x10A38,3,"\300\211\002x'\000\300\211\002\324\370\000\300\211\002<:\000"},
+    {0x10A3F,10,"\300\211\301\031\000\300\211\0172\000\300\211\0177\000\300\211\017B\000\300\211\017O\000\300\211\036\300H\000\300\211\036\300\351\000\300\211\0362\207\000\300\211\0362\254\000\300\211\300\0162o\000"},
+    {0x10A50,9,"\300\211\300\006<\000\300\211\300\006\004y\000\300\211\300\006y\000\300\211\300\006\304\207x\000\300\211\300\006\343\226\000\300\211\300\006\306r\000\300\211\300\006\301z\000\300\211\300\0064\301z\000\300\211\300\006\310\030\000"},
+    {0x10A60,32,"%\3004\300\232\001\301\027\000%\3004\300\232\001\302\201\000%\3004\300\232\001\302|\000%\3004\300\232\001\302#\000%\3004\300\232\001\303\364\000%\3004\300\232\001\301\024\000%\3004\300\232\001\301[\000%\3004\300\232\001\302\313\000%\3004\300\232\001\302D\000%\3004\300\232\001\302T\000%\3004\300\232\001\310\272\000%\3004\300\232\001\302_\000%\3004\300\232\001\300\263\000%\3004\300\232\001\341\032\000%\3004\300\232\001\302f\000%\3004\300\232\001\302g\000%\3004\300\232\001\302\343\000%\3004\300\232\001w\000%\3004\300\232\001\312E\000%\3004\300\232\001\3324\000%\3004\300\232\001\302]\000%\3004\300\232\001\303=\000%\3004\300\232\001\335\307\000%\3004\300\232\001\303)\000%\3004\300\232\001\3172\000%\3004\300\232\001\3327\000%\3004\300\232\001\302\224\000%\3004\300\232\001\3561\000%\3004\300\232\001\3566\000%\3004\300\232\0362\000%\3004\300\232\036\301H\000%\3004\300\232\257\301Y\000"},
+    {0x10A80,32,"%\275\300\232\001\300\344\000%\275\300\232\001\300h\000%\275\300\232\001\246\000%\275\300\232\001Y\000%\275\300\232\001\301D\000%\275\300\232\001\301\024\000%\275\300\232\001\3347\000%\275\300\232\001\3012\000%\275\300\232\001\300\376\000%\275\300\232\001\300\322\000%\275\300\232\001\3346\000%\275\300\232\001\300\337\000%\275\300\232\001\300\215\000%\275\300\232\001\300\210\000%\275\300\232\001\301U\000%\275\300\232\001\3348\000%\275\300\232\001\301.\000%\275\300\232\001w\000%\275\300\232\001\300\375\000%\275\300\232\001\301`\000%\275\300\232\001\335\224\000%\275\300\232\001\302\035\000%\275\300\232\001\301\261\000%\275\300\232\001\301(\000%\275\300\232\001\302p\000%\275\300\232\001\304\010\000%\275\300\232\001]\000%\275\300\232\001\301\330\000%\275\300\232\001\302\260\000%\275\300\232\0362\000%\275\300\232\036\300H\000%\275\300\232\036\300\351\000"},
+    {0x10AC0,32,"\300\331\001\302B\000\300\331\001\302D\000\300\331\001\312c\000\300\331\001\302]\000\300\331\001\335\322\000\300\331\001\303=\000\300\331\001\301\027\000\300\331\001\301\024\000\300\331\002\301\233\000\300\331\001\302\261\000\300\331\001\362L\000\300\331\001\340_\000\300\331\001\340i\000\300\331\001\302|\000\300\331\001\303)\000\300\331\001\302\224\000\300\331\001\302_\000\300\331\001\361M\000\300\331\001\314\002\000\300\331\001\302\201\000\300\331\001\3328\000\300\331\001\356.\000\300\331\001\302#\000\300\331\001\300\263\000\300\331\001\302g\000\300\331\001\302\326\000\300\331\001\321\322\000\300\331\001\300\363\000\300\331\001\302\343\000\300\331\001\302f\000\300\331\001\303\364\000\300\331\001\361`\000"},
+    {0x10AE0,7,"\300\331\001\350\301\000\300\331\001\302\313\000\300\331\001\301[\000\300\331\001\354\343\000\300\331\001\302T\000\300\331\302\027+'\000\300\331\302\027+:\000"},
+    {0x10AEB,12,"\300\331\0362\000\300\331\036V\000\300\331\036\300H\000\300\331\036\300\351\000\300\331\0362\207\000\300\331\300\006\300\261\000\300\331\300\006\307\256\000\300\331\300\0064<\304j<\000\300\331\300\006<\304j<\000\300\331\300\006<\000\300\331\300\0067\214\000\300\331\300\006\300\201\303\204\000"},
+    {0x10B00,32,"\300\304\001\025\000\300\304\001\300/\000\300\304\001\305\327\000\300\304\001\321\315\000\300\304\001\3016\000\300\304\001\312\011\000\300\304\001\301X\000\300\304\001\312\023\000\300\304\0019\000\300\304\001\301\017\000\300\304\0016\000\300\304\001\300\354\000\300\304\001;\000\300\304\001\300T\000\300\304\0011\000\300\304\001\300l\000\300\304\001\301\377\000\300\304\001\305\002\000\300\304\001\317\010\000\300\304\001\361h\000\300\304\001\303J\000\300\304\001\307\302\000\300\304\001\3021\000\300\304\001\303u\000\300\304\001\302\347\000\300\304\001\301=\000\300\304\001\301\011\000\300\304\001\301\350\000\300\304\001\305&\000\300\304\001\305\273\000\300\304\001\300\363\000\300\304\001\302\343\000"},
+    {0x10B20,22,"\300\304\001\302r\000\300\304\001\305\345\000\300\304\001\314\340\000\300\304\001\345\233\000\300\304\001\345\232\000\300\304\001\301K\000\300\304\001\310g\000\300\304\001\345\377\000\300\304\001\301S\000\300\304\001\336\351\000\300\304\001\362\002\000\300\304\001\302o\000\300\304\001\302W\000\300\304\001\302:\000\300\304\001\300\345\000\300\304\001\301\363\000\300\304\001\301\370\000\300\304\001\300\374\000\300\304\001\302q\000\300\304\001\354E\000\300\304\001\354\342\000\300\304\001\301\027\000"},
+    {0x10B39,29,"\300\304\302\027+\000\305\2667\214\2232<\300\006\000\0047\214\2232<\300\006\000\300#7\214\2232<\300\006\000\300#2<\2237\214\300\006\000\300#7\315\272\2232\240\300\006\000\300#2\240\2237\315\272\300\006\000\300\272\301~\001\302B\000\300\272\301~\001\302D\000\300\272\301~\001\302]\000\300\272\301~\001\303=\000\300\272\301~\001\301\027\000\300\272\301~\001\301\024\000\300\272\301~\001\302\261\000\300\272\301~\001\302|\000\300\272\301~\001\303)\000\300\272\301~\001\302\224\000\300\272\301~\001\302_\000\300\272\301~\001\302\201\000\300\272\301~\001\302#\000\300\272\301~\001\300\263\000\300\272\301~\001\302g\000\300\272\301~\001\302\326\000\300\272\301~\001\300\363\000\300\272\301~\001\302f\000\300\272\301~\001\303\364\000\300\272\301~\001\302\313\000\300\272\301~\001\301[\000\300\272\301~\001\302T\000"},
+    {0x10B58,27,"\300\272\301~\0362\000\300\272\301~\0367\000\300\272\301~\036B\000\300\272\301~\036O\000\300\272\301~\036\300H\000\300\272\301~\036\300\351\000\300\272\301~\0362\207\000\300\272\301~\0362\254\000\300\272\300\301\001\302B\000\300\272\300\301\001\302D\000\300\272\300\301\001\302]\000\300\272\300\301\001\303=\000\300\272\300\301\001\301\027\000\300\272\300\301\001\316\361\000\300\272\300\301\001\302\261\000\300\272\300\301\001\302|\000\300\272\300\301\001\303)\000\300\272\300\301\001\302\224\000\300\272\300\301\001\302_\000\300\272\300\301\001\302\201\000\300\272\300\301\001\314\236\000\300\272\300\301\001\300\263\000\300\272\300\301\001\302g\000\300\272\300\301\001\300\363\000\300\272\300\301\001\302f\000\300\272\300\301\001\301[\000\300\272\300\301\001\302T\000"},
+    {0x10B78,26,"\300\272\300\301\0362\000\300\272\300\301\0367\000\300\272\300\301\036B\000\300\272\300\301\036O\000\300\272\300\301\036\300H\000\300\272\300\301\036\300\351\000\300\272\300\301\0362\207\000\300\272\300\301\0362\254\000\301\215\300\301\001\302B\000\301\215\300\301\001\302D\000\301\215\300\301\001\302]\000\301\215\300\301\001\303=\000\301\215\300\301\001\301\027\000\301\215\300\301\001\316\361\000\301\215\300\301\001\302\261\000\301\215\300\301\001\302|\000\301\215\300\301\001\302\224\000\301\215\300\301\001\302_\000\301\215\300\301\001\302\201\000\301\215\300\301\001\314\236\000\301\215\300\301\001\300\263\000\301\215\300\301\001\302g\000\301\215\300\301\001\300\363\000\301\215\300\301\001\302f\000\301\215\300\301\001\301[\000\301\215\300\301\001\302T\000"},
+    {0x10B99,4,"\301\215\300\301\3013+\000\301\215\300\301\241\3013+\000\301\215\300\301O\214\003\300\323\000\301\215\300\301O\214\003<\000"},
+    {0x10BA9,7,"\301\215\300\301\0362\000\301\215\300\301\0367\000\301\215\300\301\036B\000\301\215\300\301\036O\000\301\215\300\301\036\300H\000\301\215\300\301\036\300\351\000\301\215\300\301\0362\207\000"},
+    {0x10C00,32,"%\300o\001\301\021\025\000%\300o\001\301v\025\000%\300o\001\301v\301X\000%\300o\001\301\021;\000%\300o\001\301v;\000%\300o\001\301v9\000%\300o\001\301\0216\000%\300o\001\301\021\301\007\000%\300o\001\301v\301\007\000%\300o\001\301\021\301\372\000%\300o\001\301v\301\372\000%\300o\001\301\021\312\021\000%\300o\001\301v\312\021\000%\300o\001\301\021\305\323\000%\300o\001\301v\305\323\000%\300o\001\301\021\312\024\000%\300o\001\301v\312\024\000%\300o\001\301\021\304\030\000%\300o\001\301v\304\030\000%\300o\001\301\021\322=\000%\300o\001\301\021\3053\000%\300o\001\301v\3053\000%\300o\001\301\021\302\325\000%\300o\001\301v\302\325\000%\300o\001\301\021\312\030\000%\300o\001\301v\312\030\000%\300o\001\301\021\312\025\000%\300o\001\301v\312\025\000%\300o\001\301\021\315\035\000%\300o\001\301v\315\035\000%\300o\001\301\021\302A\000%\300o\001\301v\302A\000"},
+    {0x10C20,32,"%\300o\001\301\021\322\077\000%\300o\001\301\021\334\026\000%\300o\001\301\021\302,\000%\300o\001\301\021\3016\000%\300o\001\301\021\304n\000%\300o\001\301v\304n\000%\300o\001\301\021\306\031\000%\300o\001\301v\306\031\000%\300o\001\301\021\306\030\000%\300o\001\301v\306\030\000%\300o\001\301\021\304\224\000%\300o\001\301v\304\224\000%\300o\001\301v\302\262\000%\300o\001\301\021\302\341\000%\300o\001\301v\322@\000%\300o\001\301\021\306\032\000%\300o\001\301\021\310n\000%\300o\001\301\021\307\333\000%\300o\001\301\021\305.\000%\300o\001\301v\305.\000%\300o\001\301\021\305\016\000%\300o\001\301v\305\016\000%\300o\001\301\021\307\346\000%\300o\001\301v\307\346\000%\300o\001\301\021\310q\000%\300o\001\301v\310q\000%\300o\001\301\021\3070\000%\300o\001\301v\3070\000%\300o\001\301\021\322A\000%\300o\001\301\021\302\225\000%\300o\001\301\021\322C\000%\300o\001\301\021\300\274\000"},
+    {0x10C40,9,"%\300o\001\301v\300\274\000%\300o\001\301\021\302 \000%\300o\001\301v\302 \000%\300o\001\301\021\301\234\000%\300o\001\301v\301\234\000%\300o\001\301\021\312\027\000%\300o\001\301v\312\027\000%\300o\001\301\021\306\231\000%\300o\001\301\021\323\376\000"},
+    {0x10C80,32,"%\266\006\001\025\000%\266\006\001\300/\000%\266\006\001\307\231\000%\266\006\001\312$\000%\266\006\001\305.\000%\266\006\001\306\030\000%\266\006\001\313\036\000%\266\006\001\313\037\000%\266\006\001\031\000%\266\006\0019\000%\266\006\001\307a9\000%\266\006\001\301\017\000%\266\006\001\303A\000%\266\006\001\313 \000%\266\006\001\313\042\000%\266\006\001\303B\000%\266\006\001;\000%\266\006\001\300T\000%\266\006\001\313*\000%\266\006\001\304\223\000%\266\006\001\304q\000%\266\006\001\316\325\000%\266\006\001\301\334\000%\266\006\001\313,\000%\266\006\001\302,\000%\266\006\001\300\276\000%\266\006\001\304\224\000%\266\006\0016\000%\266\006\001\300\354\000%\266\006\001\306\215\301\007\000%\266\006\001\306\313\301\007\000%\266\006\001\315\034\000"},
+    {0x10CA0,19,"%\266\006\001\306\032\000%\266\006\001\313.\000%\266\006\001\302z\000%\266\006\001\300w\302z\000%\266\006\001\303\013\000%\266\006\001\313<\000%\266\006\001\302\273\000%\266\006\001\306\031\000%\266\006\001\313>\000%\266\006\001\304\222\000%\266\006\0011\000%\266\006\001\300l\000%\266\006\001\306\215\301\343\000%\266\006\001\306\313\301\343\000%\266\006\001\307\240\000%\266\006\001\3053\000%\266\006\001\313C\000%\266\006\001\3132\002\000%\266\006\001\307\017\000"},
+    {0x10CC0,32,"%\266\004\001\025\000%\266\004\001\300/\000%\266\004\001\307\231\000%\266\004\001\312$\000%\266\004\001\305.\000%\266\004\001\306\030\000%\266\004\001\313\036\000%\266\004\001\313\037\000%\266\004\001\031\000%\266\004\0019\000%\266\004\001\307a9\000%\266\004\001\301\017\000%\266\004\001\303A\000%\266\004\001\313 \000%\266\004\001\313\042\000%\266\004\001\303B\000%\266\004\001;\000%\266\004\001\300T\000%\266\004\001\313*\000%\266\004\001\304\223\000%\266\004\001\304q\000%\266\004\001\316\325\000%\266\004\001\301\334\000%\266\004\001\313,\000%\266\004\001\302,\000%\266\004\001\300\276\000%\266\004\001\304\224\000%\266\004\0016\000%\266\004\001\300\354\000%\266\004\001\306\215\301\007\000%\266\004\001\306\313\301\007\000%\266\004\001\315\034\000"},
+    {0x10CE0,19,"%\266\004\001\306\032\000%\266\004\001\313.\000%\266\004\001\302z\000%\266\004\001\300w\302z\000%\266\004\001\303\013\000%\266\004\001\313<\000%\266\004\001\302\273\000%\266\004\001\306\031\000%\266\004\001\313>\000%\266\004\001\304\222\000%\266\004\0011\000%\266\004\001\300l\000%\266\004\001\306\215\301\343\000%\266\004\001\306\313\301\343\000%\266\004\001\307\240\000%\266\004\001\3053\000%\266\004\001\313C\000%\266\004\001\3132\002\000%\266\004\001\307\017\000"},
+    {0x10CFA,32,"%\266\0362\000%\266\036V\000%\266\036\300H\000%\266\036\301H\000%\266\0362\207\000%\266\0362\254\000\300\336\300\332\001\025\000\300\336\300\332\001\300\042\000\300\336\300\332\001\230\000\300\336\300\332\001\265\000\300\336\300\332\001\300\334\000\300\336\300\332\001\300g\000\300\336\300\332\001\300m\000\300\336\300\332\001\203\000\300\336\300\332\001\300\223\000\300\336\300\332\001\301\026\000\300\336\300\332\001\300\001\000\300\336\300\332\001\300\335\000\300\336\300\332\001\235\000\300\336\300\332\001\302\024\000\300\336\300\332\001\300\341\000\300\336\300\332\001\271\000\300\336\300\332\001\300j\000\300\336\300\332\001[\000\300\336\300\332\001\300\005\000\300\336\300\332\001\252\000\300\336\300\332\001\251\000\300\336\300\332\001\256\000\300\336\300\332\001\300q\000\300\336\300\332\001\314\006\300q\000\300\336\300\332\001\264\000\300\336\300\332\001\314\006\264\000"},
+    {0x10D1A,14,"\300\336\300\332\001\300c\000\300\336\300\332\001\300\225\000\300\336\300\332\001\300\307\000\300\336\300\332\021\025\000\300\336\300\332\021;\000\300\336\300\332\0211\000\300\336\300\332\0219\000\300\336\300\332\0216\000\300\336\300\332+\352O\000\300\336\300\332+\256\341\037\000\300\336\300\332\002\336k\000\300\336\300\332\002\355\337\000\300\336\300\332\002\355\351\000\300\336\300\332\002\355\366\000"},
+    {0x10D30,10,"\300\336\300\332\017\300%\000\300\336\300\332\0172\000\300\336\300\332\0177\000\300\336\300\332\017B\000\300\336\300\332\017O\000\300\336\300\332\017V\000\300\336\300\332\017v\000\300\336\300\332\017\201\000\300\336\300\332\017u\000\300\336\300\332\017\211\000"},
+    {0x10E60,31,"\301r\0172\000\301r\0177\000\301r\017B\000\301r\017O\000\301r\017V\000\301r\017v\000\301r\017\201\000\301r\017u\000\301r\017\211\000\301r\036\300H\000\301r\036\300\351\000\301r\036\301\200\000\301r\036\301\237\000\301r\036\301H\000\301r\036\302R\000\301r\036\301V\000\301r\036\302w\000\301r\036\3010\000\301r\0362\207\000\301r\0367\207\000\301r\036B\207\000\301r\036O\207\000\301r\036V\207\000\301r\036v\207\000\301r\036\201\207\000\301r\036u\207\000\301r\036\211\207\000\301r\300\0162o\000\301r\300\0162\3011\000\301r\300\0162\302\321\000\301r\300\0167\303\246\000"},
+    {0x10E80,32,"\300\366\001\334\025\000\300\366\001\302r\000\300\366\001\300\363\000\300\366\001\310\205\000\300\366\001\301\011\000\300\366\001\301\363\000\300\366\001\302Z\000\300\366\001\325N\000\300\366\001\325H\000\300\366\001\303\213\000\300\366\001\302\222\000\300\366\001\302\035\000\300\366\001\307!\000\300\366\001\235\000\300\366\001\303\235\000\300\366\001\300\341\000\300\366\001\300g\000\300\366\001\306\337\000\300\366\001\301[\000\300\366\001\301U\000\300\366\001\301`\000\300\366\001\265\000\300\366\001\301\370\000\300\366\001\313B\000\300\366\001\361T\000\300\366\001\301\026\000\300\366\001\300\307\000\300\366\001\300\307\301\033\020\000\300\366\001\301D\000\300\366\001\300\337\000\300\366\001\341\024\000\300\366\001\303I\000"},
+    {0x10EA0,10,"\300\366\001\300h\000\300\366\001\306}\000\300\366\001\300\263\000\300\366\001\303\250\000\300\366\001\301\024\000\300\366\001\305\205\000\300\366\001\307\241\000\300\366\001\336t\000\300\366\001\305\316\000\300\366\001\302\273\000"},
+    {0x10EAB,3,"\300\366 \300S+\000\300\366 \303\031+\000\300\366\313\300+\000"},
+    {0x10EB0,2,"\300\366\001\300h\003<'\000\300\366\001\305\316\003\300M'\000"},
+    {0x10F00,32,"%\300=\001\302B\000%\300=\0013\302B\000%\300=\001\302D\000%\300=\0013\302D\000%\300=\001\302]\000%\300=\001\301\027\000%\300=\0013\301\027\000%\300=\001\301\024\000%\300=\001\302\261\000%\300=\001\302|\000%\300=\001\302\224\000%\300=\001\302_\000%\300=\001\302\201\000%\300=\001\302#\000%\300=\001\300\263\000%\300=\0013\300\263\000%\300=\0013\300\263\003T\300\253\000%\300=\001\302g\000%\300=\001\302\326\000%\300=\001\301\033\302\326\000%\300=\001\300\363\000%\300=\001\302f\000%\300=\0013\302f\000%\300=\0013\302f\003T\300\253\000%\300=\001\351i\000%\300=\001\301[\000%\300=\001\302T\000%\300=\0013\302T\000%\300=\0013\302T\003T\300\253\000%\300=\0362\000%\300=\0367\000%\300=\036B\000"},
+    {0x10F20,8,"%\300=\036O\000%\300=\036V\000%\300=\036\300H\000%\300=\036\300\351\000%\300=\036\301\200\000%\300=\0362\207\000%\300=\300\0162o\000%\300=!\323\016\000"},
+    {0x10F30,32,"\300=\001\302B\000\300=\001\302D\000\300=\001\302]\000\300=\001\301\027\000\300=\001\301\024\000\300=\001\302\261\000\300=\001\302|\000\300=\001\302\224\000\300=\001\302_\000\300=\001\302\201\000\300=\001\302#\000\300=\001\300\263\000\300=\001\302g\000\300=\001\302\326\000\300=\001\300\363\000\300=\001\302f\000\300=\001\351h\000\300=\001\301[\000\300=\001\302T\000\300=\001\334\315\000\300=\001\314;\000\300=\301\322\301[\000\300= <:\000\300= 7\214:\000\300= <'\000\300= 7\214'\000\300= \301*'\000\300= \301*:\000\300= S'\000\300= S:\000\300= \253S:\000\300= \302\313:\000"},
+    {0x10F50,10,"\300= I:\000\300=\0362\000\300=\036\300H\000\300=\036\300\351\000\300=\0362\207\000\300=\300\0067T\305\021\000\300=\300\0067T\305\021\003\214\000\300=\300\006y\003<\000\300=\300\0067\302F\003\214\000\300=\300\006oy\003<\000"},
+    {0x10F70,26,"%\301\277\001\302B\000%\301\277\001\302D\000%\301\277\001\335\341\000%\301\277\001\301\024\000%\301\277\001\302\261\000%\301\277\0013\302|\000%\301\277\001\302\224\000%\301\277\001\302_\000%\301\277\001\302\201\000%\301\277\001\302#\000%\301\277\001\300\263\000%\301\277\001\302g\000%\301\277\001\300\363\000%\301\277\001\302f\000%\301\277\001\302\313\000%\301\277\001\301[\000%\301\277\001\302T\000%\301\277\001\314;\000%\301\277 <'\000%\301\277 <:\000%\301\277 7\214'\000%\301\277 7\214:\000%\301\277\300\006x\000%\301\277\300\0067\305\021\000%\301\277\300\0067\214\000%\301\277\300\006O\214\000"},
+    {0x10FB0,28,"\301\223\001\302B\000\301\223\001\004\302B\000\301\223\001\302D\000\301\223\001\302]\000\301\223\001\303=\000\301\223\001\301\027\000\301\223\001\301\024\000\301\223\001\331]\301\024\000\301\223\001\302\261\000\301\223\001\302|\000\301\223\001\302\224\000\301\223\001\302_\000\301\223\001\302\201\000\301\223\001\302#\000\301\223\001\300\263\000\301\223\001\302g\000\301\223\001\302\326\000\301\223\001\300\363\000\301\223\001\302\313\000\301\223\001\301[\000\301\223\001\302T\000\301\223\0362\000\301\223\0367\000\301\223\036B\000\301\223\036O\000\301\223\036\300H\000\301\223\036\300\351\000\301\223\0362\207\000"},
+    {0x10FE0,23,"\301\335\001\302B\000\301\335\001\302D\000\301\335\001\302]\000\301\335\001\303=\000\301\335\001\301\027\000\301\335\001\301\024\000\301\335\001\302\261\000\301\335\001\302|\000\301\335\001\303)\000\301\335\001\302\224\000\301\335\001\302_\000\301\335\001\302\201\000\301\335\001\302#\000\301\335\001\300\263\000\301\335\001\302g\000\301\335\001\302\326\000\301\335\001\300\363\000\301\335\001\302f\000\301\335\001\303\364\000\301\335\001\302\313\000\301\335\001\301[\000\301\335\001\302T\000\301\335!\362>\000"},
+    {0x11000,32,"\250\002\301P\000\250\002\300\316\000\250\002\3014\000\250\002\304\262\000\250\002\304\371\000\250\001\025\000\250\001\300/\000\250\001;\000\250\001\300T\000\250\0011\000\250\001\300l\000\250\001|c\000\250\001|\301%\000\250\001|p\000\250\001|\301J\000\250\0019\000\250\001\300L\000\250\0016\000\250\001\300d\000\250\001[\000\250\001\300\223\000\250\001\300\005\000\250\001\300\361\000\250\001\300c\000\250\001\300m\000\250\001\300\220\000\250\001\300g\000\250\001\301B\000\250\001\300\225\000\250\001\300\334\000\250\001\301\023\000\250\001\300\335\000"},
+    {0x11020,32,"\250\001\301\036\000\250\001\301\002\000\250\001\265\000\250\001\300\254\000\250\001\300\001\000\250\001\300\353\000\250\001\256\000\250\001\230\000\250\001\300\306\000\250\001\300\042\000\250\001\301\004\000\250\001\251\000\250\001\264\000\250\001\235\000\250\001\252\000\250\001\300\307\000\250\001\300j\000\250\001\301&\000\250\001\271\000\250\001\203\000\250\001\301\243\000\250\001%\220\304\277\000\250\001%\220\302\024\000\250\001%\220\305{\000\250\021\002\300/\000\250\021\002\324<\300/\000\250\021\002;\000\250\021\002\300T\000\250\021\0021\000\250\021\002\300l\000\250\021\002|c\000\250\021\002|\301%\000"},
+    {0x11040,14,"\250\021\002|p\000\250\021\002|\301J\000\250\021\0029\000\250\021\002\300L\000\250\021\0026\000\250\021\002\300d\000\250\301\031\000\250\301z\000\2504\301z\000\250\300\006<\000\250\300\0064<\000\250\300\006\300\201\000\250\300\006\304\207x\000\250\300\006\306r\000"},
+    {0x11052,32,"\250\0362\000\250\0367\000\250\036B\000\250\036O\000\250\036V\000\250\036v\000\250\036\201\000\250\036u\000\250\036\211\000\250\036\300H\000\250\036\300\351\000\250\036\301\200\000\250\036\301\237\000\250\036\301H\000\250\036\302R\000\250\036\301V\000\250\036\302w\000\250\036\3010\000\250\0362\207\000\250\0362\254\000\250\017\300%\000\250\0172\000\250\0177\000\250\017B\000\250\017O\000\250\017V\000\250\017v\000\250\017\201\000\250\017u\000\250\017\211\000\250\002%\220\301\031\000\250\001%\220\300w9\000"},
+    {0x11072,4,"\250\001%\220\300w6\000\250\021\002%\220\300w9\000\250\021\002%\220\300w6\000\250\001%\220\301\243\000"},
+    {0x1107F,32,"\250\036\3048\000\300\207\002\301P\000\300\207\002\300\316\000\300\207\002\3014\000\300\207\001\025\000\300\207\001\300/\000\300\207\001;\000\300\207\001\300T\000\300\207\0011\000\300\207\001\300l\000\300\207\0019\000\300\207\001\300L\000\300\207\0016\000\300\207\001\300d\000\300\207\001[\000\300\207\001\300\223\000\300\207\001\300\005\000\300\207\001\300\361\000\300\207\001\300c\000\300\207\001\300m\000\300\207\001\300\220\000\300\207\001\300g\000\300\207\001\301B\000\300\207\001\300\225\000\300\207\001\300\334\000\300\207\001\301\023\000\300\207\001\300\335\000\300\207\001\312\340\000\300\207\001\301\036\000\300\207\001\303\235\000\300\207\001\301\002\000\300\207\001\265\000"},
+    {0x1109F,32,"\300\207\001\300\254\000\300\207\001\300\001\000\300\207\001\300\353\000\300\207\001\256\000\300\207\001\230\000\300\207\001\300\306\000\300\207\001\300\042\000\300\207\001\301\004\000\300\207\001\251\000\300\207\001\264\000\300\207\001\235\000\300\207\001\252\000\300\207\001\300\307\000\300\207\001\300j\000\300\207\001\301&\000\300\207\001\271\000\300\207\001\203\000\300\207\021\002\300/\000\300\207\021\002;\000\300\207\021\002\300T\000\300\207\021\0021\000\300\207\021\002\300l\000\300\207\021\0029\000\300\207\021\002\300L\000\300\207\021\0026\000\300\207\021\002\300d\000\300\207\002\301\031\000\300\207\002\301\306\000\300\207\302\027\002\000\300\207\334)\002\000\300\207\036\002\000\300\207\3013+\000"},
+    {0x110BF,4,"\300\2074\3013+\000\300\207\301z\000\300\2074\301z\000\300\207\021\002|c\000"},
+    {0x110CD,1,"\300\207\036\002'\000"},
+    {0x110D0,25,"\301N\301M\001\315\317\000\301N\301M\001\301(\000\301N\301M\001\323\350\000\301N\301M\001\324\327\000\301N\301M\001\331\325\000\301N\301M\001\313e\000\301N\301M\001\314\214\000\301N\301M\001\345\134\000\301N\301M\001\341\347\000\301N\301M\001\310G\000\301N\301M\001\301>\000\301N\301M\001\347~\000\301N\301M\001\307\032\000\301N\301M\001\351*\000\301N\301M\001\246\000\301N\301M\001\313\356\000\301N\301M\001\340X\000\301N\301M\001\346\211\000\301N\301M\001\302\324\000\301N\301M\001\333\376\000\301N\301M\001\307\335\000\301N\301M\001\3112\000\301N\301M\001\305\177\000\301N\301M\001\303B\000\301N\301M\001\314\211\000"},
+    {0x110F0,10,"\301N\301M\017\300%\000\301N\301M\0172\000\301N\301M\0177\000\301N\301M\017B\000\301N\301M\017O\000\301N\301M\017V\000\301N\301M\017v\000\301N\301M\017\201\000\301N\301M\017u\000\301N\301M\017\211\000"},
+    {0x11100,32,"\300z\002\301P\000\300z\002\300\316\000\300z\002\3014\000\300z\001\300/\000\300z\001;\000\300z\0011\000\300z\0019\000\300z\001\306P\000\300z\001\313\375\000\300z\001\305=\000\300z\001\313|\000\300z\001\306\210\000\300z\001\307S\000\300z\001\312\244\000\300z\001\313\333\000\300z\001\340g\000\300z\001\315\023\000\300z\001\316\262\000\300z\001\311+\000\300z\001\312\337\000\300z\001\312\342\000\300z\001\345\376\000\300z\001\304Y\000\300z\001\305\263\000\300z\001\312\315\000\300z\001\3322\000\300z\001\304\305\000\300z\001\306\233\000\300z\001\315U\000\300z\001\305\336\000\300z\001\324:\000\300z\001\310 \000"},
+    {0x11120,21,"\300z\001\362\001\000\300z\001\305\003\000\300z\001\305\231\000\300z\001\305a\000\300z\001\305\304\000\300z\001\306\315\000\300z\001\303\020\000\300z\021\002\025\000\300z\021\002;\000\300z\021\002\300T\000\300z\021\0021\000\300z\021\002\300l\000\300z\021\0029\000\300z\021\002\300L\000\300z\021\0026\000\300z\021\002\300d\000\300z\021\002\305\200\000\300z6+\000\300z\300d+\000\300z\301\031\000\300z\343v\000"},
+    {0x11136,18,"\300z\017\300%\000\300z\0172\000\300z\0177\000\300z\017B\000\300z\017O\000\300z\017V\000\300z\017v\000\300z\017\201\000\300z\017u\000\300z\017\211\000\300z\3013+\000\300z\301z\000\300z4\301z\000\300z\301\216+\000\300z\001\314\077\000\300z\021\002\300/\000\300z\021\002\303\177\000\300z\001\316\335\000"},
+    {0x11150,32,"\301+\001\025\000\301+\001;\000\301+\0011\000\301+\0019\000\301+\0016\000\301+\001[\000\301+\001\300\223\000\301+\001\300\005\000\301+\001\300\361\000\301+\001\300m\000\301+\001\300\220\000\301+\001\300g\000\301+\001\301B\000\301+\001\300\225\000\301+\001\300\334\000\301+\001\301\023\000\301+\001\300\335\000\301+\001\301\036\000\301+\001\301\002\000\301+\001\265\000\301+\001\300\254\000\301+\001\300\001\000\301+\001\300\353\000\301+\001\256\000\301+\001\230\000\301+\001\300\306\000\301+\001\300\042\000\301+\001\301\004\000\301+\001\251\000\301+\001\235\000\301+\001\252\000\301+\001\300\307\000"},
+    {0x11170,7,"\301+\001\271\000\301+\001\203\000\301+\001\302\024\000\301+\002\301\306\000\301+\302\027\002\000\301+\3013+\000\301+!\315\367\000"},
+    {0x11180,32,"\300\033\002\301P\000\300\033\002\300\316\000\300\033\002\3014\000\300\033\001\025\000\300\033\001\300/\000\300\033\001;\000\300\033\001\300T\000\300\033\0011\000\300\033\001\300l\000\300\033\001|c\000\300\033\001|\301%\000\300\033\001|p\000\300\033\001|\301J\000\300\033\0019\000\300\033\001\300L\000\300\033\0016\000\300\033\001\300d\000\300\033\001[\000\300\033\001\300\223\000\300\033\001\300\005\000\300\033\001\300\361\000\300\033\001\300c\000\300\033\001\300m\000\300\033\001\300\220\000\300\033\001\300g\000\300\033\001\301B\000\300\033\001\300\225\000\300\033\001\300\334\000\300\033\001\301\023\000\300\033\001\300\335\000\300\033\001\301\036\000\300\033\001\301\002\000"},
+    {0x111A0,32,"\300\033\001\265\000\300\033\001\300\254\000\300\033\001\300\001\000\300\033\001\300\353\000\300\033\001\256\000\300\033\001\230\000\300\033\001\300\306\000\300\033\001\300\042\000\300\033\001\301\004\000\300\033\001\251\000\300\033\001\264\000\300\033\001\235\000\300\033\001\252\000\300\033\001\301\243\000\300\033\001\300\307\000\300\033\001\300j\000\300\033\001\301&\000\300\033\001\271\000\300\033\001\203\000\300\033\021\002\300/\000\300\033\021\002;\000\300\033\021\002\300T\000\300\033\021\0021\000\300\033\021\002\300l\000\300\033\021\002|c\000\300\033\021\002|\301%\000\300\033\021\002|p\000\300\033\021\002|\301J\000\300\033\021\0029\000\300\033\021\002\300L\000\300\033\021\0026\000\300\033\021\002\300d\000"},
+    {0x111C0,32,"\300\033\002\301\031\000\300\033\002\302Y\000\300\033\002\304\262\000\300\033\002\304\371\000\300\033\302\303\000\300\033\301z\000\300\0334\301z\000\300\033\302\027\002\000\300\033\301\270\000\300\033\303\236+\000\300\033\002\301\306\000\300\033\021>+\000\300\033\334[\300w\021+\000\300\033\355_+\000\300\033\021\002\310\2329\000\300\033\002\300\221\301P\000\300\033\017\300%\000\300\033\0172\000\300\033\0177\000\300\033\017B\000\300\033\017O\000\300\033\017V\000\300\033\017v\000\300\033\017\201\000\300\033\017u\000\300\033\017\211\000\300\033\334\012\000\300\033\002\300\022\000\300\033\307\317\000\300\033\331(\002\000\300\033\3013\305g\000\300\033\3013\305h\000"},
+    {0x111E1,20,"\263\301\034\0172\000\263\301\034\0177\000\263\301\034\017B\000\263\301\034\017O\000\263\301\034\017V\000\263\301\034\017v\000\263\301\034\017\201\000\263\301\034\017u\000\263\301\034\017\211\000\263\301\034\036\300H\000\263\301\034\036\300\351\000\263\301\034\036\301\200\000\263\301\034\036\301\237\000\263\301\034\036\301H\000\263\301\034\036\302R\000\263\301\034\036\301V\000\263\301\034\036\302w\000\263\301\034\036\3010\000\263\301\034\0362\207\000\263\301\034\0362\254\000"},
+    {0x11200,18,"\300\243\001\025\000\300\243\001\300/\000\300\243\001;\000\300\243\0011\000\300\243\0019\000\300\243\001\300L\000\300\243\0016\000\300\243\001\300d\000\300\243\001[\000\300\243\001\300\223\000\300\243\001\300\005\000\300\243\001\304\237\000\300\243\001\300\361\000\300\243\001\300c\000\300\243\001\300m\000\300\243\001\300\220\000\300\243\001\300g\000\300\243\001\305T\000"},
+    {0x11213,32,"\300\243\001\300\225\000\300\243\001\300\334\000\300\243\001\301\023\000\300\243\001\300\335\000\300\243\001\301\036\000\300\243\001\301\002\000\300\243\001\265\000\300\243\001\300\254\000\300\243\001\300\001\000\300\243\001\305\377\000\300\243\001\300\353\000\300\243\001\256\000\300\243\001\230\000\300\243\001\300\306\000\300\243\001\300\042\000\300\243\001\304\035\000\300\243\001\301\004\000\300\243\001\251\000\300\243\001\264\000\300\243\001\235\000\300\243\001\252\000\300\243\001\300\307\000\300\243\001\271\000\300\243\001\203\000\300\243\001\301\243\000\300\243\021\002\300/\000\300\243\021\002;\000\300\243\021\002\300T\000\300\243\021\0021\000\300\243\021\0029\000\300\243\021\002\300L\000\300\243\021\0026\000"},
+    {0x11233,12,"\300\243\021\002\300d\000\300\243\002\300\316\000\300\243\002\301\031\000\300\243\002\301\306\000\300\243\002\302\250\000\300\243\301z\000\300\2434\301z\000\300\243\301\344\301\270\000\300\243\3013+\000\300\2434\3013+\000\300\243\302\027\002\000\300\243\002\304\003\000"},
+    {0x11280,7,"\301/\001\025\000\301/\001;\000\301/\0011\000\301/\0019\000\301/\001[\000\301/\001\300\223\000\301/\001\300\005\000"},
+    {0x11288,1,"\301/\001\300\361\000"},
+    {0x1128A,4,"\301/\001\300m\000\301/\001\300\220\000\301/\001\300g\000\301/\001\305T\000"},
+    {0x1128F,15,"\301/\001\300\225\000\301/\001\300\334\000\301/\001\301\023\000\301/\001\300\335\000\301/\001\305\377\000\301/\001\301\036\000\301/\001\301\002\000\301/\001\265\000\301/\001\300\254\000\301/\001\300\001\000\301/\001\300\353\000\301/\001\256\000\301/\001\230\000\301/\001\300\306\000\301/\001\300\042\000"},
+    {0x1129F,11,"\301/\001\301\004\000\301/\001\251\000\301/\001\264\000\301/\001\235\000\301/\001\252\000\301/\001\300\307\000\301/\001\271\000\301/\001\203\000\301/\001\302\024\000\301/\001\303\235\000\301/\3013+\000"},
+    {0x112B0,32,"\300\203\001\025\000\300\203\001\300/\000\300\203\001;\000\300\203\001\300T\000\300\203\0011\000\300\203\001\300l\000\300\203\0019\000\300\203\001\300L\000\300\203\0016\000\300\203\001\300d\000\300\203\001[\000\300\203\001\300\223\000\300\203\001\300\005\000\300\203\001\304\237\000\300\203\001\300\361\000\300\203\001\300c\000\300\203\001\300m\000\300\203\001\300\220\000\300\203\001\300g\000\300\203\001\305T\000\300\203\001\301B\000\300\203\001\300\225\000\300\203\001\300\334\000\300\203\001\301\023\000\300\203\001\300\335\000\300\203\001\305\377\000\300\203\001\302\024\000\300\203\001\301\036\000\300\203\001\301\002\000\300\203\001\265\000\300\203\001\300\254\000\300\203\001\300\001\000"},
+    {0x112D0,27,"\300\203\001\300\353\000\300\203\001\256\000\300\203\001\230\000\300\203\001\300\306\000\300\203\001\300\042\000\300\203\001\304\035\000\300\203\001\301\004\000\300\203\001\251\000\300\203\001\264\000\300\203\001\235\000\300\203\001\252\000\300\203\001\300\307\000\300\203\001\300j\000\300\203\001\271\000\300\203\001\203\000\300\203\002\300\316\000\300\203\021\002\300/\000\300\203\021\002;\000\300\203\021\002\300T\000\300\203\021\0021\000\300\203\021\002\300l\000\300\203\021\0029\000\300\203\021\002\300L\000\300\203\021\0026\000\300\203\021\002\300d\000\300\203\002\301\306\000\300\203\002\301\031\000"},
+    {0x112F0,10,"\300\203\017\300%\000\300\203\0172\000\300\203\0177\000\300\203\017B\000\300\203\017O\000\300\203\017V\000\300\203\017v\000\300\203\017\201\000\300\203\017u\000\300\203\017\211\000"},
+    {0x11300,4,"\300;\002 \300\316'\000\300;\002\301P\000\300;\002\300\316\000\300;\002\3014\000"},
+    {0x11305,8,"\300;\001\025\000\300;\001\300/\000\300;\001;\000\300;\001\300T\000\300;\0011\000\300;\001\300l\000\300;\001|c\000\300;\001|p\000"},
+    {0x1130F,2,"\300;\001\301\017\000\300;\001\300L\000"},
+    {0x11313,22,"\300;\001\300\354\000\300;\001\300d\000\300;\001[\000\300;\001\300\223\000\300;\001\300\005\000\300;\001\300\361\000\300;\001\300c\000\300;\001\300m\000\300;\001\300\220\000\300;\001\300g\000\300;\001\301B\000\300;\001\300\225\000\300;\001\300\334\000\300;\001\301\023\000\300;\001\300\335\000\300;\001\301\036\000\300;\001\301\002\000\300;\001\265\000\300;\001\300\254\000\300;\001\300\001\000\300;\001\300\353\000\300;\001\256\000"},
+    {0x1132A,7,"\300;\001\230\000\300;\001\300\306\000\300;\001\300\042\000\300;\001\301\004\000\300;\001\251\000\300;\001\264\000\300;\001\235\000"},
+    {0x11332,2,"\300;\001\252\000\300;\001\301\243\000"},
+    {0x11335,5,"\300;\001\300\307\000\300;\001\300j\000\300;\001\301&\000\300;\001\271\000\300;\001\203\000"},
+    {0x1133B,10," \302\264:\000\300;\002\301\306\000\300;\002\302Y\000\300;\021\002\300/\000\300;\021\002;\000\300;\021\002\300T\000\300;\021\0021\000\300;\021\002\300l\000\300;\021\002|c\000\300;\021\002|\301%\000"},
+    {0x11347,2,"\300;\021\002\301\017\000\300;\021\002\300L\000"},
+    {0x1134B,3,"\300;\021\002\300\354\000\300;\021\002\300d\000\300;\002\301\031\000"},
+    {0x11350,1,"\300;\302\303\000"},
+    {0x11357,1,"\300;\300d\302\202+\000"},
+    {0x1135D,7,"\300;\002\315o\000\300;\001\300\357\300\316\000\300;\001\300\3574\300\316\000\300;\001|\301%\000\300;\001|\301J\000\300;\021\002|p\000\300;\021\002|\301J\000"},
+    {0x11366,7," \300;\017\300%\000 \300;\0172\000 \300;\0177\000 \300;\017B\000 \300;\017O\000 \300;\017V\000 \300;\017v\000"},
+    {0x11370,5," \300;\001\025\000 \300;\001[\000 \300;\001\256\000 \300;\001\303\253\000 \300;\001\230\000"},
+    {0x11400,32,"\300\027\001\025\000\300\027\001\300/\000\300\027\001;\000\300\027\001\300T\000\300\027\0011\000\300\027\001\300l\000\300\027\001|c\000\300\027\001|\301%\000\300\027\001|p\000\300\027\001|\301J\000\300\027\0019\000\300\027\001\300L\000\300\027\0016\000\300\027\001\300d\000\300\027\001[\000\300\027\001\300\223\000\300\027\001\300\005\000\300\027\001\300\361\000\300\027\001\300c\000\300\027\001\314\347\000\300\027\001\300m\000\300\027\001\300\220\000\300\027\001\300g\000\300\027\001\301B\000\300\027\001\300\225\000\300\027\001\315\025\000\300\027\001\300\334\000\300\027\001\301\023\000\300\027\001\300\335\000\300\027\001\301\036\000\300\027\001\301\002\000\300\027\001\265\000"},
+    {0x11420,32,"\300\027\001\300\254\000\300\027\001\300\001\000\300\027\001\300\353\000\300\027\001\256\000\300\027\001\304\312\000\300\027\001\230\000\300\027\001\300\306\000\300\027\001\300\042\000\300\027\001\301\004\000\300\027\001\251\000\300\027\001\314\246\000\300\027\001\264\000\300\027\001\235\000\300\027\001\303\235\000\300\027\001\252\000\300\027\001\303\330\000\300\027\001\300q\000\300\027\001\300j\000\300\027\001\301&\000\300\027\001\271\000\300\027\001\203\000\300\027\021\002\300/\000\300\027\021\002;\000\300\027\021\002\300T\000\300\027\021\0021\000\300\027\021\002\300l\000\300\027\021\002|c\000\300\027\021\002|\301%\000\300\027\021\002|p\000\300\027\021\002|\301J\000\300\027\021\0029\000\300\027\021\002\300L\000"},
+    {0x11440,28,"\300\027\021\0026\000\300\027\021\002\300d\000\300\027\002\301\031\000\300\027\002\301P\000\300\027\002\300\316\000\300\027\002\3014\000\300\027\002\301\306\000\300\027\002\302Y\000\300\027\0023\300\316\000\300\027\302\303\000\300\027\354T\000\300\027\301z\000\300\0274\301z\000\300\027\300\251\000\300\027\304\236\303\204\000\300\027\302\027\002\000\300\027\017\300%\000\300\027\0172\000\300\027\0177\000\300\027\017B\000\300\027\017O\000\300\027\017V\000\300\027\017v\000\300\027\017\201\000\300\027\017u\000\300\027\017\211\000\300\0274\300\251\000\300\027\310\214+\000"},
+    {0x1145D,5,"\300\027\307\342\002\000\300\027\303\236+\000\300\027\001\300\357\300\316\000\300\027\002\304\262\000\300\027\002\304\371\000"},
+    {0x11480,32,"\300K\307-\000\300K\001\025\000\300K\001\300/\000\300K\001;\000\300K\001\300T\000\300K\0011\000\300K\001\300l\000\300K\001|c\000\300K\001|\301%\000\300K\001|p\000\300K\001|\301J\000\300K\0019\000\300K\001\300L\000\300K\0016\000\300K\001\300d\000\300K\001[\000\300K\001\300\223\000\300K\001\300\005\000\300K\001\300\361\000\300K\001\300c\000\300K\001\300m\000\300K\001\300\220\000\300K\001\300g\000\300K\001\301B\000\300K\001\300\225\000\300K\001\300\334\000\300K\001\301\023\000\300K\001\300\335\000\300K\001\301\036\000\300K\001\301\002\000\300K\001\265\000\300K\001\300\254\000"},
+    {0x114A0,32,"\300K\001\300\001\000\300K\001\300\353\000\300K\001\256\000\300K\001\230\000\300K\001\300\306\000\300K\001\300\042\000\300K\001\301\004\000\300K\001\251\000\300K\001\264\000\300K\001\235\000\300K\001\252\000\300K\001\300\307\000\300K\001\300j\000\300K\001\301&\000\300K\001\271\000\300K\001\203\000\300K\021\002\300/\000\300K\021\002;\000\300K\021\002\300T\000\300K\021\0021\000\300K\021\002\300l\000\300K\021\002|c\000\300K\021\002|\301%\000\300K\021\002|p\000\300K\021\002|\301J\000\300K\021\0029\000\300K\021\002\300w9\000\300K\021\002\300L\000\300K\021\0026\000\300K\021\002\300w6\000\300K\021\002\300d\000\300K\002\301P\000"},
+    {0x114C0,8,"\300K\002\300\316\000\300K\002\3014\000\300K\002\301\031\000\300K\002\301\306\000\300K\002\302Y\000\300K\336)\000\300K\302\027\002\000\300K\302\303\000"},
+    {0x114D0,10,"\300K\017\300%\000\300K\0172\000\300K\0177\000\300K\017B\000\300K\017O\000\300K\017V\000\300K\017v\000\300K\017\201\000\300K\017u\000\300K\017\211\000"},
+    {0x11580,32,"\300\022\001\025\000\300\022\001\300/\000\300\022\001;\000\300\022\001\300T\000\300\022\0011\000\300\022\001\300l\000\300\022\001|c\000\300\022\001|\301%\000\300\022\001|p\000\300\022\001|\301J\000\300\022\0019\000\300\022\001\300L\000\300\022\0016\000\300\022\001\300d\000\300\022\001[\000\300\022\001\300\223\000\300\022\001\300\005\000\300\022\001\300\361\000\300\022\001\300c\000\300\022\001\300m\000\300\022\001\300\220\000\300\022\001\300g\000\300\022\001\301B\000\300\022\001\300\225\000\300\022\001\300\334\000\300\022\001\301\023\000\300\022\001\300\335\000\300\022\001\301\036\000\300\022\001\301\002\000\300\022\001\265\000\300\022\001\300\254\000\300\022\001\300\001\000"},
+    {0x115A0,22,"\300\022\001\300\353\000\300\022\001\256\000\300\022\001\230\000\300\022\001\300\306\000\300\022\001\300\042\000\300\022\001\301\004\000\300\022\001\251\000\300\022\001\264\000\300\022\001\235\000\300\022\001\252\000\300\022\001\300\307\000\300\022\001\300j\000\300\022\001\301&\000\300\022\001\271\000\300\022\001\203\000\300\022\021\002\300/\000\300\022\021\002;\000\300\022\021\002\300T\000\300\022\021\0021\000\300\022\021\002\300l\000\300\022\021\002|c\000\300\022\021\002|\301%\000"},
+    {0x115B8,32,"\300\022\021\0029\000\300\022\021\002\300L\000\300\022\021\0026\000\300\022\021\002\300d\000\300\022\002\301P\000\300\022\002\300\316\000\300\022\002\3014\000\300\022\002\301\031\000\300\022\002\301\306\000\300\022\002\300\022\000\300\022\301z\000\300\0224\301z\000\300\022\301\270<\000\300\022\301\270x\000\300\022\305\234\305g\000\300\022\305\234\305h\000\300\022\305\234\314\221\000\300\022\301lK\303\244+\000\300\022\3013+\003\305\272\031\305\300\347R\000\300\022\3013+\003\305\272\031\301\016\303\274\000\300\022\3013+\003\303\037\031\301\016\303\274\000\300\022\3013+\003\303\037\031\301\0164\303\274\000\300\022\3013+\003\303\037\031\301\016\300\262\303\274\000\300\022\3013+4\240\000\300\022\3013+4\240\003\303\037\000\300\022\3013+\0034\303\274\000\300\022\3013+\003\300\262\303\274\000\300\022\3013+\003\303\036\303\274\000\300\022\3013+\003\353\240\303\274\000\300\022\3013+\003\302F\031\303\037\000\300\022\3013+\003\302F\0317\3130\000\300\022\3013+\003\302F\031O\3130\000"},
+    {0x115D8,6,"\300\022\001\356E\301\033;\000\300\022\001\3111\301\033;\000\300\022\001\3111\301\033\300T\000\300\022\001\301\0331\000\300\022\021\002\301\0331\000\300\022\021\002\301\033\300l\000"},
+    {0x11600,32,"\300X\001\025\000\300X\001\300/\000\300X\001;\000\300X\001\300T\000\300X\0011\000\300X\001\300l\000\300X\001|c\000\300X\001|\301%\000\300X\001|p\000\300X\001|\301J\000\300X\0019\000\300X\001\300L\000\300X\0016\000\300X\001\300d\000\300X\001[\000\300X\001\300\223\000\300X\001\300\005\000\300X\001\300\361\000\300X\001\300c\000\300X\001\300m\000\300X\001\300\220\000\300X\001\300g\000\300X\001\301B\000\300X\001\300\225\000\300X\001\300\334\000\300X\001\301\023\000\300X\001\300\335\000\300X\001\301\036\000\300X\001\301\002\000\300X\001\265\000\300X\001\300\254\000\300X\001\300\001\000"},
+    {0x11620,32,"\300X\001\300\353\000\300X\001\256\000\300X\001\230\000\300X\001\300\306\000\300X\001\300\042\000\300X\001\301\004\000\300X\001\251\000\300X\001\264\000\300X\001\235\000\300X\001\252\000\300X\001\300\307\000\300X\001\300j\000\300X\001\301&\000\300X\001\271\000\300X\001\203\000\300X\001\301\243\000\300X\021\002\300/\000\300X\021\002;\000\300X\021\002\300T\000\300X\021\0021\000\300X\021\002\300l\000\300X\021\002|c\000\300X\021\002|\301%\000\300X\021\002|p\000\300X\021\002|\301J\000\300X\021\0029\000\300X\021\002\300L\000\300X\021\0026\000\300X\021\002\300d\000\300X\002\300\316\000\300X\002\3014\000\300X\002\301\031\000"},
+    {0x11640,5,"\300X\002\322\275\000\300X\301z\000\300X4\301z\000\300X\302\027\002\000\300X\002\337y\000"},
+    {0x11650,10,"\300X\017\300%\000\300X\0172\000\300X\0177\000\300X\017B\000\300X\017O\000\300X\017V\000\300X\017v\000\300X\017\201\000\300X\017u\000\300X\017\211\000"},
+    {0x11660,13,"j\302\226\003\300\231\000j\300\235\302\226\000j4\302\226\003\300\231\000j\300\262\302\226\003\300\231\000j\302\226\0034\300\231\000j\300\235\302\226\003\300\231\000j\300\235\302\226\0034\300\231\000j\300\221\302\226\000j\300\221\302\226\0034\300\231\000j\305\257\302\226\000j\305\257\302\226\003\300\231\000j\305\257\302\226\0034\300\231\000j\241\305\257\302\226\0034\300\231\000"},
+    {0x11680,32,"\300\217\001\025\000\300\217\001\300/\000\300\217\001;\000\300\217\001\300T\000\300\217\0011\000\300\217\001\300l\000\300\217\0019\000\300\217\001\300L\000\300\217\0016\000\300\217\001\300d\000\300\217\001[\000\300\217\001\300\223\000\300\217\001\300\005\000\300\217\001\300\361\000\300\217\001\300c\000\300\217\001\300m\000\300\217\001\300\220\000\300\217\001\300g\000\300\217\001\301B\000\300\217\001\300\225\000\300\217\001\300\334\000\300\217\001\301\023\000\300\217\001\300\335\000\300\217\001\301\036\000\300\217\001\301\002\000\300\217\001\265\000\300\217\001\300\254\000\300\217\001\300\001\000\300\217\001\300\353\000\300\217\001\256\000\300\217\001\230\000\300\217\001\300\306\000"},
+    {0x116A0,26,"\300\217\001\300\042\000\300\217\001\301\004\000\300\217\001\251\000\300\217\001\264\000\300\217\001\235\000\300\217\001\252\000\300\217\001\300\307\000\300\217\001\300j\000\300\217\001\271\000\300\217\001\203\000\300\217\001\302\024\000\300\217\002\300\316\000\300\217\002\3014\000\300\217\021\002\300/\000\300\217\021\002;\000\300\217\021\002\300T\000\300\217\021\0021\000\300\217\021\002\300l\000\300\217\021\0029\000\300\217\021\002\300L\000\300\217\021\0026\000\300\217\021\002\300d\000\300\217\002\301\031\000\300\217\002\301\306\000\300\217\001\301\034\300\223\000\300\217\302\027\002\000"},
+    {0x116C0,10,"\300\217\017\300%\000\300\217\0172\000\300\217\0177\000\300\217\017B\000\300\217\017O\000\300\217\017V\000\300\217\017v\000\300\217\017\201\000\300\217\017u\000\300\217\017\211\000"},
+    {0x11700,27,"\300\226\001[\000\300\226\001\300\223\000\300\226\001\300c\000\300\226\001\256\000\300\226\001\265\000\300\226\001\301\033\265\000\300\226\001\230\000\300\226\001\300\306\000\300\226\001\300\042\000\300\226\001\251\000\300\226\001\300g\000\300\226\001\300\220\000\300\226\001\300\254\000\300\226\001\235\000\300\226\001\252\000\300\226\001\271\000\300\226\001\300\225\000\300\226\001\203\000\300\226\001\025\000\300\226\001\300\001\000\300\226\001\300\353\000\300\226\001\300\005\000\300\226\001\301\033\300\005\000\300\226\001\300\361\000\300\226\001\301\004\000\300\226\001\301B\000\300\226\001\301\033\300\042\000"},
+    {0x1171D,15,"\300\226\3003\002\300\017\252\000\300\226\3003\002\300\017\235\000\300\226\3003\002\300\017\342^\235\000\300\226\021\002\025\000\300\226\021\002\300/\000\300\226\021\002;\000\300\226\021\002\300T\000\300\226\021\0021\000\300\226\021\002\300l\000\300\226\021\0029\000\300\226\021\002\3075\000\300\226\021\0026\000\300\226\021\002\300L\000\300\226\021\002\3032\000\300\226\002\341;\000"},
+    {0x11730,23,"\300\226\017\300%\000\300\226\0172\000\300\226\0177\000\300\226\017B\000\300\226\017O\000\300\226\017V\000\300\226\017v\000\300\226\017\201\000\300\226\017u\000\300\226\017\211\000\300\226\036\300H\000\300\226\036\300\351\000\300\226\002\004\3013\000\300\226\002\3013\000\300\226\002\351\344\000\300\226\014\303\253\000\300\226\001\300m\000\300\226\001\300\334\000\300\226\001\301\023\000\300\226\001\300\335\000\300\226\001\301\036\000\300\226\001\301\002\000\300\226\001\301\243\000"},
+    {0x11800,32,"\300\255\001\025\000\300\255\001\300/\000\300\255\001;\000\300\255\001\300T\000\300\255\0011\000\300\255\001\300l\000\300\255\0019\000\300\255\001\300L\000\300\255\0016\000\300\255\001\300d\000\300\255\001[\000\300\255\001\300\223\000\300\255\001\300\005\000\300\255\001\300\361\000\300\255\001\300c\000\300\255\001\300m\000\300\255\001\300\220\000\300\255\001\300g\000\300\255\001\301B\000\300\255\001\300\225\000\300\255\001\300\334\000\300\255\001\301\023\000\300\255\001\300\335\000\300\255\001\301\036\000\300\255\001\301\002\000\300\255\001\265\000\300\255\001\300\254\000\300\255\001\300\001\000\300\255\001\300\353\000\300\255\001\256\000\300\255\001\230\000\300\255\001\300\306\000"},
+    {0x11820,28,"\300\255\001\300\042\000\300\255\001\301\004\000\300\255\001\251\000\300\255\001\264\000\300\255\001\235\000\300\255\001\252\000\300\255\001\300\307\000\300\255\001\300j\000\300\255\001\301&\000\300\255\001\271\000\300\255\001\203\000\300\255\001\302\024\000\300\255\021\002\300/\000\300\255\021\002;\000\300\255\021\002\300T\000\300\255\021\0021\000\300\255\021\002\300l\000\300\255\021\002|c\000\300\255\021\002|\301%\000\300\255\021\0029\000\300\255\021\002\300L\000\300\255\021\0026\000\300\255\021\002\300d\000\300\255\002\300\316\000\300\255\002\3014\000\300\255\002\301\031\000\300\255\002\301\306\000\300\255\302\027\002\000"},
+    {0x118A0,32,"\300C\300\077\006\001\306\210\000\300C\300\077\006\001\025\000\300C\300\077\006\001\301\367\000\300C\300\077\006\001\301)\000\300C\300\077\006\001\264\000\300C\300\077\006\001\301i\000\300C\300\077\006\001\300T\000\300C\300\077\006\001\300l\000\300C\300\077\006\0019\000\300C\300\077\006\0016\000\300C\300\077\006\001\302\262\000\300C\300\077\006\001\300\005\000\300C\300\077\006\001\301\303\000\300C\300\077\006\001\304\224\000\300C\300\077\006\001\317#\000\300C\300\077\006\001\307\012\000\300C\300\077\006\001\307\234\000\300C\300\077\006\001\304G\000\300C\300\077\006\001\305\273\000\300C\300\077\006\001\310d\000\300C\300\077\006\001\300\001\000\300C\300\077\006\001\301\234\000\300C\300\077\006\001\3032\000\300C\300\077\006\001\301\255\000\300C\300\077\006\001\302\312\000\300C\300\077\006\001\313\255\000\300C\300\077\006\001\313\263\000\300C\300\077\006\001\313\266\000\300C\300\077\006\001\304\245\000\300C\300\077\006\001\3163\000\300C\300\077\006\001\305\247\000\300C\300\077\006\001\316\347\000"},
+    {0x118C0,32,"\300C\300\077\004\001\306\210\000\300C\300\077\004\001\025\000\300C\300\077\004\001\301\367\000\300C\300\077\004\001\301)\000\300C\300\077\004\001\264\000\300C\300\077\004\001\301i\000\300C\300\077\004\001\300T\000\300C\300\077\004\001\300l\000\300C\300\077\004\0019\000\300C\300\077\004\0016\000\300C\300\077\004\001\302\262\000\300C\300\077\004\001\300\005\000\300C\300\077\004\001\301\303\000\300C\300\077\004\001\304\224\000\300C\300\077\004\001\317#\000\300C\300\077\004\001\307\012\000\300C\300\077\004\001\307\234\000\300C\300\077\004\001\304G\000\300C\300\077\004\001\305\273\000\300C\300\077\004\001\310d\000\300C\300\077\004\001\300\001\000\300C\300\077\004\001\301\234\000\300C\300\077\004\001\3032\000\300C\300\077\004\001\301\255\000\300C\300\077\004\001\302\312\000\300C\300\077\004\001\313\255\000\300C\300\077\004\001\313\263\000\300C\300\077\004\001\313\266\000\300C\300\077\004\001\304\245\000\300C\300\077\004\001\3163\000\300C\300\077\004\001\305\247\000\300C\300\077\004\001\316\347\000"},
+    {0x118E0,19,"\300C\300\077\017\300%\000\300C\300\077\0172\000\300C\300\077\0177\000\300C\300\077\017B\000\300C\300\077\017O\000\300C\300\077\017V\000\300C\300\077\017v\000\300C\300\077\017\201\000\300C\300\077\017u\000\300C\300\077\017\211\000\300C\300\077\036\300H\000\300C\300\077\036\300\351\000\300C\300\077\036\301\200\000\300C\300\077\036\301\237\000\300C\300\077\036\301H\000\300C\300\077\036\302R\000\300C\300\077\036\301V\000\300C\300\077\036\302w\000\300C\300\077\036\3010\000"},
+    {0x118FF,8,"\300C\300\077\302\303\000\300t\300r\001\025\000\300t\300r\001\300/\000\300t\300r\001;\000\300t\300r\001\300T\000\300t\300r\0011\000\300t\300r\001\300l\000\300t\300r\0019\000"},
+    {0x11909,1,"\300t\300r\0016\000"},
+    {0x1190C,8,"\300t\300r\001[\000\300t\300r\001\300\223\000\300t\300r\001\300\005\000\300t\300r\001\300\361\000\300t\300r\001\300c\000\300t\300r\001\300m\000\300t\300r\001\300\220\000\300t\300r\001\300g\000"},
+    {0x11915,2,"\300t\300r\001\300\225\000\300t\300r\001\300\334\000"},
+    {0x11918,30,"\300t\300r\001\300\335\000\300t\300r\001\301\036\000\300t\300r\001\301\002\000\300t\300r\001\265\000\300t\300r\001\300\254\000\300t\300r\001\300\001\000\300t\300r\001\300\353\000\300t\300r\001\256\000\300t\300r\001\230\000\300t\300r\001\300\306\000\300t\300r\001\300\042\000\300t\300r\001\301\004\000\300t\300r\001\251\000\300t\300r\001\264\000\300t\300r\001\307 \000\300t\300r\001\235\000\300t\300r\001\252\000\300t\300r\001\300\307\000\300t\300r\001\300j\000\300t\300r\001\301&\000\300t\300r\001\271\000\300t\300r\001\203\000\300t\300r\001\301\243\000\300t\300r\001\300\341\000\300t\300r\021\002\300/\000\300t\300r\021\002;\000\300t\300r\021\002\300T\000\300t\300r\021\0021\000\300t\300r\021\002\300l\000\300t\300r\021\0029\000"},
+    {0x11937,2,"\300t\300r\021\002\300L\000\300t\300r\021\0026\000"},
+    {0x1193B,12,"\300t\300r\002\300\316\000\300t\300r\002\301P\000\300t\300r\002\307\314\000\300t\300r\301\031\000\300t\300r\303Y\305s\002\000\300t\300r\300\017\264\000\300t\300rX\235\000\300t\300r\300\017\235\000\300t\300r\002\301\306\000\300t\300r4\301z\000\300t\300r\304\236\303\204\000\300t\300r\301lK\303\244+\000"},
+    {0x11950,10,"\300t\300r\017\300%\000\300t\300r\0172\000\300t\300r\0177\000\300t\300r\017B\000\300t\300r\017O\000\300t\300r\017V\000\300t\300r\017v\000\300t\300r\017\201\000\300t\300r\017u\000\300t\300r\017\211\000"},
+    {0x119A0,8,"\300\230\001\025\000\300\230\001\300/\000\300\230\001;\000\300\230\001\300T\000\300\230\0011\000\300\230\001\300l\000\300\230\001|c\000\300\230\001|\301%\000"},
+    {0x119AA,32,"\300\230\0019\000\300\230\001\300L\000\300\230\0016\000\300\230\001\300d\000\300\230\001[\000\300\230\001\300\223\000\300\230\001\300\005\000\300\230\001\300\361\000\300\230\001\300c\000\300\230\001\300m\000\300\230\001\300\220\000\300\230\001\300g\000\300\230\001\301B\000\300\230\001\300\225\000\300\230\001\300\334\000\300\230\001\301\023\000\300\230\001\300\335\000\300\230\001\301\036\000\300\230\001\301\002\000\300\230\001\265\000\300\230\001\300\254\000\300\230\001\300\001\000\300\230\001\300\353\000\300\230\001\256\000\300\230\001\230\000\300\230\001\300\306\000\300\230\001\300\042\000\300\230\001\301\004\000\300\230\001\251\000\300\230\001\264\000\300\230\001\235\000\300\230\001\252\000"},
+    {0x119CA,14,"\300\230\001\300\307\000\300\230\001\300j\000\300\230\001\301&\000\300\230\001\271\000\300\230\001\203\000\300\230\001\301\243\000\300\230\001\302\024\000\300\230\021\002\300/\000\300\230\021\002;\000\300\230\021\002\300T\000\300\230\021\0021\000\300\230\021\002\300l\000\300\230\021\002|c\000\300\230\021\002|\301%\000"},
+    {0x119DA,11,"\300\230\021\0029\000\300\230\021\002\300L\000\300\230\021\0026\000\300\230\021\002\300d\000\300\230\002\300\316\000\300\230\002\3014\000\300\230\002\301\031\000\300\230\002\302Y\000\300\230\002\300\022\000\300\230\307\317\000\300\230\021\002\310\2329\000"},
+    {0x11A00,32,"\300y,\001\025\000\300y,\021\002;\000\300y,\021\002\301\343\000\300y,\021\0021\000\300y,\021\0029\000\300y,\021\002\301\007\000\300y,\021\0026\000\300y,\021\002\300L\000\300y,\021\002\300d\000\300y,\021\002\300:;\000\300y,\021\302\202+\000\300y,\001[\000\300y,\001\300\223\000\300y,\001\300\005\000\300y,\001\300\361\000\300y,\001\300c\000\300y,\001\300m\000\300y,\001\300\220\000\300y,\001\300g\000\300y,\001\300\225\000\300y,\001\300\334\000\300y,\001\301\023\000\300y,\001\300\335\000\300y,\001\301\036\000\300y,\001\301\002\000\300y,\001\265\000\300y,\001\300\254\000\300y,\001\300\001\000\300y,\001\300\353\000\300y,\001\256\000\300y,\001\230\000\300y,\001\300\306\000"},
+    {0x11A20,32,"\300y,\001\300\042\000\300y,\001\301\004\000\300y,\001\251\000\300y,\001\301\201\000\300y,\001\302\217\000\300y,\001\302\271\000\300y,\001\305-\000\300y,\001\301\371\000\300y,\001\300\341\000\300y,\001\304m\000\300y,\001\264\000\300y,\001\235\000\300y,\001\252\000\300y,\001\300\307\000\300y,\001\300j\000\300y,\001\301&\000\300y,\001\271\000\300y,\001\203\000\300y,\001\305`\000\300y,3\3003+\000\300y,\002\301\031\000\300y,\002\301P\000\300y,\002\301P\003\300\231\000\300y,\002\302t\003\300\231\000\300y,\002\300\316\000\300y,\002\3014\000\300y,\305\037\001\235\000\300y,\305\370\001\264\000\300y,\305\370\001\235\000\300y,\305\370\001\252\000\300y,\305\370\001\300\307\000\300y,X\301\225+\000"},
+    {0x11A40,8,"\300y,\305\036\301\225+\000\300y,+\303*\000\300y,+\302h\000\300y,+4\302h\000\300y,+\253\303*\000\300y,X\313\006\301\225+\000\300y,\305\036\313\006\301\225+\000\300y,\316<\000"},
+    {0x11A50,32,"\300G\001\025\000\300G\021\002;\000\300G\021\002\301\343\000\300G\021\0021\000\300G\021\0029\000\300G\021\0026\000\300G\021\002\301\007\000\300G\021\002\300L\000\300G\021\002\300d\000\300G\021\002|c\000\300G\021\002|p\000\300G\021\302\202+\000\300G\001[\000\300G\001\300\223\000\300G\001\300\005\000\300G\001\300\361\000\300G\001\300c\000\300G\001\300m\000\300G\001\300\220\000\300G\001\300g\000\300G\001\301B\000\300G\001\300\225\000\300G\001\300\334\000\300G\001\301\023\000\300G\001\300\335\000\300G\001\301\036\000\300G\001\301\002\000\300G\001\265\000\300G\001\300\254\000\300G\001\300\001\000\300G\001\300\353\000\300G\001\256\000"},
+    {0x11A70,32,"\300G\001\230\000\300G\001\300\306\000\300G\001\300\042\000\300G\001\301\004\000\300G\001\251\000\300G\001\301\201\000\300G\001\302\217\000\300G\001\302\271\000\300G\001\301\371\000\300G\001\300\341\000\300G\001\304m\000\300G\001\264\000\300G\001\235\000\300G\001\252\000\300G\001\300\307\000\300G\001\300j\000\300G\001\301&\000\300G\001\271\000\300G\001\203\000\300G\001\305`\000\300G\002\304\262\000\300G\002\304\371\000\300G\305\037\001\235\000\300G\305\037\001\252\000\300G\305\037\001\300j\000\300G\305\037\001\271\000\300G3\3003\002\300\003\000\300G3\3003\002\300\011\000\300G3\3003\002\302\022\000\300G3\3003\002\300\024\000\300G3\3003\002\232\000\300G3\3003\002\077\000"},
+    {0x11A90,19,"\300G3\3003\002\261\000\300G3\3003\002c\000\300G3\3003\002p\000\300G3\3003\002\304P\000\300G3\3003\002d\000\300G3\3003\002\304m\000\300G\002\300\316\000\300G\002\3014\000\300G\305\077+\000\300G\316<\000\300G+\303*\000\300G+\302h\000\300G+4\302h\000\300G+\315o\000\300G\301\225+\003\301\211\031\302l\031\300\262\313L\000\300G\301\225+\003\301\211\031\302l\031\313L\000\300G\301\225+\003\301\211\031\302l\000\300G\316u\305g\000\300G\316u\305h\000"},
+    {0x11AB0,32,"\023\024\302\357\3019\000\023\024\302\357\313\250\000\023\024\302\357\301\242\000\023\024\302\357\305K\000\023\024\302\357\203\000\023\024\302\357\303\020\000\023\024\302\357\315\367\000\023\024\302\357\354.\000\023\024\302\357\3540\000\023\024\302\357\3541\000\023\024\302\357\354,\000\023\024\302\357\354-\000\023\024\354\264\000\023\024\354\272\000\023\024\354\300\000\023\024\354\256\000\300\273\300\271\300\266\001\230\000\300\273\300\271\300\266\001[\000\300\273\300\271\300\266\001\252\000\300\273\300\271\300\266\001\251\000\300\273\300\271\300\266\001\300\001\000\300\273\300\271\300\266\001\300\341\000\300\273\300\271\300\266\001\300\307\000\300\273\300\271\300\266\001\300c\000\300\273\300\271\300\266\001\203\000\300\273\300\271\300\266\001\300\005\000\300\273\300\271\300\266\001\300\223\000\300\273\300\271\300\266\001\271\000\300\273\300\271\300\266\001\300\042\000\300\273\300\271\300\266\001\300m\000\300\273\300\271\300\266\001\265\000\300\273\300\271\300\266\001\300\254\000"},
+    {0x11AD0,32,"\300\273\300\271\300\266\001\256\000\300\273\300\271\300\266\001\300\306\000\300\273\300\271\300\266\001\235\000\300\273\300\271\300\266\001\301\026\000\300\273\300\271\300\266\001\300\220\000\300\273\300\271\300\266\001\025\000\300\273\300\271\300\266\0019\000\300\273\300\271\300\266\001;\000\300\273\300\271\300\266\0016\000\300\273\300\271\300\266\0011\000\300\273\300\271\300\266\001\304\367\000\300\273\300\271\300\266\001\306C\000\300\273\300\271\300\266\0013\300<\000\300\273\300\271\300\266\0013\300\011\000\300\273\300\271\300\266\0013\300\007\000\300\273\300\271\300\266\0013\261\000\300\273\300\271\300\266\0013\232\000\300\273\300\271\300\266\0013p\000\300\273\300\271\300\266\0013\300P\000\300\273\300\271\300\266\0013\302\022\000\300\273\300\271\300\266\0013\300$\000\300\273\300\271\300\266\302\207\212\253\000\300\273\300\271\300\266\302\207\212\000\300\273\300\271\300\266\303\236\301I\300k\000\300\273\300\271\300\266\302\207\212\2533\000\300\273\300\271\300\266\302\207\2123\000\300\273\300\271\300\266\303\236\301I\300k3\000\300\273\300\271\300\266\303\236\212\253\000\300\273\300\271\300\266\303\236\212\000\300\273\300\271\300\266\303\236\212\2533\000\300\273\300\271\300\266\303\236\2123\000\300\273\300\271\300\266\3103\212\000"},
+    {0x11AF0,9,"\300\273\300\271\300\266\301I\300k\301h\000\300\273\300\271\300\266\3103\212\2533\000\300\273\300\271\300\266\3103\2123\000\300\273\300\271\300\266\306s\212\253\000\300\273\300\271\300\266\306s\212\000\300\273\300\271\300\266\301I\300k\000\300\273\300\271\300\266\306s\212\2533\000\300\273\300\271\300\266\306s\2123\000\300\273\300\271\300\266\301I\300k3\000"},
+    {0x11C00,9,"\300\023\001\025\000\300\023\001\300/\000\300\023\001;\000\300\023\001\300T\000\300\023\0011\000\300\023\001\300l\000\300\023\001|c\000\300\023\001|\301%\000\300\023\001|p\000"},
+    {0x11C0A,32,"\300\023\0019\000\300\023\001\300L\000\300\023\0016\000\300\023\001\300d\000\300\023\001[\000\300\023\001\300\223\000\300\023\001\300\005\000\300\023\001\300\361\000\300\023\001\300c\000\300\023\001\300m\000\300\023\001\300\220\000\300\023\001\300g\000\300\023\001\301B\000\300\023\001\300\225\000\300\023\001\300\334\000\300\023\001\301\023\000\300\023\001\300\335\000\300\023\001\301\036\000\300\023\001\301\002\000\300\023\001\265\000\300\023\001\300\254\000\300\023\001\300\001\000\300\023\001\300\353\000\300\023\001\256\000\300\023\001\230\000\300\023\001\300\306\000\300\023\001\300\042\000\300\023\001\301\004\000\300\023\001\251\000\300\023\001\264\000\300\023\001\235\000\300\023\001\252\000"},
+    {0x11C2A,13,"\300\023\001\300\307\000\300\023\001\300j\000\300\023\001\301&\000\300\023\001\271\000\300\023\001\203\000\300\023\021\002\300/\000\300\023\021\002;\000\300\023\021\002\300T\000\300\023\021\0021\000\300\023\021\002\300l\000\300\023\021\002|c\000\300\023\021\002|\301%\000\300\023\021\002|p\000"},
+    {0x11C38,14,"\300\023\021\0029\000\300\023\021\002\300L\000\300\023\021\0026\000\300\023\021\002\300d\000\300\023\002\301P\000\300\023\002\300\316\000\300\023\002\3014\000\300\023\002\301\031\000\300\023\002\302Y\000\300\023\301z\000\300\0234\301z\000\300\023\301\344\301\270\000\300\023\304\236\334\332\000\300\023\304\236\334\333\000"},
+    {0x11C50,29,"\300\023\017\300%\000\300\023\0172\000\300\023\0177\000\300\023\017B\000\300\023\017O\000\300\023\017V\000\300\023\017v\000\300\023\017\201\000\300\023\017u\000\300\023\017\211\000\300\023\0362\000\300\023\0367\000\300\023\036B\000\300\023\036O\000\300\023\036V\000\300\023\036v\000\300\023\036\201\000\300\023\036u\000\300\023\036\211\000\300\023\036\300H\000\300\023\036\300\351\000\300\023\036\301\200\000\300\023\036\301\237\000\300\023\036\301H\000\300\023\036\302R\000\300\023\036\301V\000\300\023\036\302w\000\300\023\036\3010\000\300\023\307\330\302\373+\000"},
+    {0x11C70,32,"\300\214\301\225+\000\300\214+\302h\000\300\214\001[\000\300\214\001\300\223\000\300\214\001\300\005\000\300\214\001\300c\000\300\214\001\300m\000\300\214\001\300\220\000\300\214\001\300g\000\300\214\001\300\225\000\300\214\001\265\000\300\214\001\300\254\000\300\214\001\300\001\000\300\214\001\256\000\300\214\001\230\000\300\214\001\300\306\000\300\214\001\300\042\000\300\214\001\251\000\300\214\001\301\201\000\300\214\001\302\217\000\300\214\001\302\271\000\300\214\001\300q\000\300\214\001\301\371\000\300\214\001\300\341\000\300\214\001\304m\000\300\214\001\264\000\300\214\001\235\000\300\214\001\252\000\300\214\001\300j\000\300\214\001\271\000\300\214\001\203\000\300\214\001\025\000"},
+    {0x11C92,22,"\300\214\300B\001[\000\300\214\300B\001\300\223\000\300\214\300B\001\300\005\000\300\214\300B\001\300c\000\300\214\300B\001\300m\000\300\214\300B\001\300\220\000\300\214\300B\001\300g\000\300\214\300B\001\300\225\000\300\214\300B\001\265\000\300\214\300B\001\300\254\000\300\214\300B\001\300\001\000\300\214\300B\001\256\000\300\214\300B\001\230\000\300\214\300B\001\300\306\000\300\214\300B\001\300\042\000\300\214\300B\001\251\000\300\214\300B\001\301\201\000\300\214\300B\001\302\217\000\300\214\300B\001\302\271\000\300\214\300B\001\300q\000\300\214\300B\001\301\371\000\300\214\300B\001\300\341\000"},
+    {0x11CA9,14,"\300\214\300B\001\264\000\300\214\300B\001\235\000\300\214\300B\001\252\000\300\214\300B\001\300j\000\300\214\300B\001\271\000\300\214\300B\001\203\000\300\214\300B\001\025\000\300\214\021\002\300/\000\300\214\021\002;\000\300\214\021\0021\000\300\214\021\0029\000\300\214\021\0026\000\300\214\002\300\316\000\300\214\002\301P\000"},
+    {0x11D00,7,"\300f\206\001\025\000\300f\206\001\300/\000\300f\206\001;\000\300f\206\001\300T\000\300f\206\0011\000\300f\206\001\300l\000\300f\206\0019\000"},
+    {0x11D08,2,"\300f\206\001\300L\000\300f\206\0016\000"},
+    {0x11D0B,32,"\300f\206\001\300d\000\300f\206\001[\000\300f\206\001\300\223\000\300f\206\001\300\005\000\300f\206\001\300\361\000\300f\206\001\300c\000\300f\206\001\300m\000\300f\206\001\300\220\000\300f\206\001\300g\000\300f\206\001\301B\000\300f\206\001\300\225\000\300f\206\001\300\334\000\300f\206\001\301\023\000\300f\206\001\300\335\000\300f\206\001\301\036\000\300f\206\001\301\002\000\300f\206\001\265\000\300f\206\001\300\254\000\300f\206\001\300\001\000\300f\206\001\300\353\000\300f\206\001\256\000\300f\206\001\230\000\300f\206\001\300\306\000\300f\206\001\300\042\000\300f\206\001\301\004\000\300f\206\001\251\000\300f\206\001\264\000\300f\206\001\235\000\300f\206\001\252\000\300f\206\001\300\307\000\300f\206\001\300j\000\300f\206\001\301&\000"},
+    {0x11D2B,12,"\300f\206\001\271\000\300f\206\001\203\000\300f\206\001\301\243\000\300f\206\001\305`\000\300f\206\001\313\347\000\300f\206\001\311\042\000\300f\206\021\002\300/\000\300f\206\021\002;\000\300f\206\021\002\300T\000\300f\206\021\0021\000\300f\206\021\002\300l\000\300f\206\021\002|c\000"},
+    {0x11D3A,1,"\300f\206\021\0029\000"},
+    {0x11D3C,2,"\300f\206\021\002\300L\000\300f\206\021\0026\000"},
+    {0x11D3F,9,"\300f\206\021\002\300d\000\300f\206\002\300\316\000\300f\206\002\3014\000\300f\206\002\301\306\000\300f\206\002\302t\000\300f\206\002\307\314\000\300f\206\301\031\000\300f\206\351e\000\300f\206\351\042\000"},
+    {0x11D50,10,"\300f\206\017\300%\000\300f\206\0172\000\300f\206\0177\000\300f\206\017B\000\300f\206\017O\000\300f\206\017V\000\300f\206\017v\000\300f\206\017\201\000\300f\206\017u\000\300f\206\017\211\000"},
+    {0x11D60,6,"\300\240\206\001\025\000\300\240\206\001\300/\000\300\240\206\001;\000\300\240\206\001\300T\000\300\240\206\0011\000\300\240\206\001\300l\000"},
+    {0x11D67,2,"\300\240\206\001\301\017\000\300\240\206\001\300L\000"},
+    {0x11D6A,32,"\300\240\206\001\300\354\000\300\240\206\001\300d\000\300\240\206\001\264\000\300\240\206\001\300\307\000\300\240\206\001\300\042\000\300\240\206\001\301\004\000\300\240\206\001\251\000\300\240\206\001[\000\300\240\206\001\300\223\000\300\240\206\001\265\000\300\240\206\001\300\254\000\300\240\206\001\252\000\300\240\206\001\300\005\000\300\240\206\001\300\361\000\300\240\206\001\300\001\000\300\240\206\001\300\353\000\300\240\206\001\256\000\300\240\206\001\300m\000\300\240\206\001\300\220\000\300\240\206\001\300\334\000\300\240\206\001\301\023\000\300\240\206\001\301\243\000\300\240\206\001\300g\000\300\240\206\001\301B\000\300\240\206\001\300\335\000\300\240\206\001\301\036\000\300\240\206\001\300c\000\300\240\206\001\230\000\300\240\206\001\300\306\000\300\240\206\001\203\000\300\240\206\001\235\000\300\240\206\001\271\000"},
+    {0x11D8A,5,"\300\240\206\021\002\300/\000\300\240\206\021\002;\000\300\240\206\021\002\300T\000\300\240\206\021\0021\000\300\240\206\021\002\300l\000"},
+    {0x11D90,2,"\300\240\206\021\002\301\017\000\300\240\206\021\002\300L\000"},
+    {0x11D93,6,"\300\240\206\021\002\300\354\000\300\240\206\021\002\300d\000\300\240\206\002\300\316\000\300\240\206\002\3014\000\300\240\206\301\031\000\300\240\206\302\303\000"},
+    {0x11DA0,10,"\300\240\206\017\300%\000\300\240\206\0172\000\300\240\206\0177\000\300\240\206\017B\000\300\240\206\017O\000\300\240\206\017V\000\300\240\206\017v\000\300\240\206\017\201\000\300\240\206\017u\000\300\240\206\017\211\000"},
+    {0x11EE0,25,"\301\304\001[\000\301\304\001\300\005\000\301\304\001\300c\000\301\304\001\230\000\301\304\001\300\042\000\301\304\001\251\000\301\304\001\265\000\301\304\001\300\001\000\301\304\001\256\000\301\304\001\300m\000\301\304\001\300g\000\301\304\001\300\225\000\301\304\001\264\000\301\304\001\235\000\301\304\001\252\000\301\304\001\300\307\000\301\304\001\271\000\301\304\001\025\000\301\304\322\212\000\301\304\021\002;\000\301\304\021\0021\000\301\304\021\0029\000\301\304\021\0026\000\301\304\347\270\000\301\304\301lK\3013\000"},
+    {0x11FB0,1,"\300\346\001\361\302\000"},
+    {0x11FC0,32,"\220\300\0162\356H\000\220\300\0162\315%\000\220\300\0162\334\007\000\220\300\0162\310\330\000\220\300\0162\313W\000\220\300\0162\311\016\000\220\300\016B\313(\000\220\300\016B\354u\000\220\300\0162\316\275\000\220\300\0162\354s\000\220\300\0162\354t\000\220\300\0162\311\011\000\220\300\0162\301,\000\220\300\016B\316\276\000\220\300\016B\306\340\000\220\300\0162\307\252\000\220\300\0162\3011\000\220\300\0162\336Z\000\220\300\0162\336[\000\220\300\016B\302\206\000\220\300\016\333\224\307\244\341:\000\220\002\345O\000\220\002\325%\000\220\002\321\323\000\220\002\357\316\000\220\002\344\262\000\220\002\341\245\000\220\002\347\277\000\220\002\344\232\000\220\002\340\302\000\220\002\347\221\000\220\002\305\222\000"},
+    {0x11FE0,18,"\220\002\360%\000\220\002\347u\000\220\002\341\254\000\220\002\3604\000\220\360\375\312\302\002\000\220\307\224\312\302\002\000\220\342\030\002\000\220\303]\310w\002\000\220\316\232\307s\002\000\220\316\232\036\002\000\220\307x\002\000\220\031\304G\002\000\220\354\270\002\000\220\316\226\002\000\220\300\241\315t\002\000\220\355\004\301A\002\000\220\002\344\260\000\220\002\360 \000"},
+    {0x11FFF,32,"\220\300\006\301lK\303\244\000\013\002\025\000\013\002\025\027\025\000\013\002\025\027\302\032\000\013\002\025\027\301\353\301\030\000\013\002\025\027\203\000\013\002\025\027\301d\000\013\002\025\027\302\200\300\300\000\013\002\025\027\302M\000\013\002\025\027\301\217\000\013\002\307'\000\013\002\301\372\000\013\002\301\372\027\3033\000\013\002\301\372\027\304'\300\300\000\013\002\301\372\027\303\210\000\013\002\301\372\027\301\353\301\030\000\013\002\301\372\027\203\000\013\002\301\372\027\301d\300\300\000\013\002\301\372\027\306E\000\013\002\301\372\027\300\242\000\013\002\301\372\027\310\312\000\013\002\301\372\0271a1a1\000\013\002\301\372\300\300\000\013\002\302\026\000\013\002\302\026\027\305\340\000\013\002\302\026\027\301\353\301\030\000\013\002\302\026\027\301Sa\300\276\000\013\002\302\026\027\302\367\000\013\002\302\026\027\302n\000\013\002\304\030\000\013\002\304q\000\013\002\304q\027\304\227\000"},
+    {0x1201F,32,"\013\002\304q\027\306\331a\301\354\000\013\002\302A\000\013\002\302A\027\302A\000\013\002\302A\027\307\213\000\013\002\302A\027\301\354\000\013\002\302A\027\203\000\013\002\302A\027\305V\000\013\002\302A\027\301\323\000\013\002\302A\027\300\374\000\013\002\302A\027\302\375\000\013\002\322f\000\013\002\302B\000\013\002\305\326\000\013\002\305\326\027\300\374\000\013\002\3016\000\013\002\3016\223\3016\000\013\002\3016B\027\000\013\002\3016a\303\344\303\353\3016a\303\344\000\013\002\3016a\303\344f\000\013\002\307.\000\013\002\322\250\000\013\002\3122\000\013\002\3122\027\302\042\000\013\002\322\304\000\013\002\322\330\000\013\002\300\274\000\013\002\300\274\3176\301\030\000\013\002\300\274\313\354\301\030\000\013\002\300\274\223\300\274\304\021\223\304\021\304\021\223\304\021\3028\000\013\002\300\274\223\300\274\223\300\274\000\013\002\300\274\223\300\274\223\300\274\301_\300\274\223\300\274\223\300\274\000\013\002\3033\000"},
+    {0x1203F,32,"\013\002\3073\000\013\002\300\042\000\013\002\302\032\000\013\002\323\342\000\013\002\305\017\000\013\002\305\020\000\013\002\305\020\223\305\020\000\013\002\305\340\000\013\002x\000\013\002\323\367\000\013\002\302\034\000\013\002\302\034\027\025\000\013\002\302\034\027\301\204\000\013\002\302\034\027\301d\300\300\000\013\002\301\255\000\013\002\301\255\223\301\255\301\372\000\013\002\301\255\223\301\255\303\251\000\013\002\301\255\301_\301\255\000\013\002\305\352\000\013\002\305\352\223\305\352\000\013\002\303t\000\013\002\324\237\000\013\002\300\001\000\013\002\301\236\000\013\002\301\236\301\205\027\025a\304\077\000\013\002\301\236\301\205\027\305\326\000\013\002\301\236\301\205\027\305\340\000\013\002\301\236\301\205\027\302\034\000\013\002\301\236\301\205\027\300\005\000\013\002\301\236\301\205\027\300\005a\304\077\000\013\002\301\236\301\205\027\301\321\000\013\002\301\236\301\205\027\3043\000"},
+    {0x1205F,32,"\013\002\301\236\301\205\027\302I\000\013\002\301\236\301\205\027\203\000\013\002\301\236\301\205\027\305Q\000\013\002\301\236\301\205\027\305Qa\301\265\000\013\002\301\236\301\205\027\303N\000\013\002\301\236\301\205\027\252\000\013\002\301\236\301\205\027\301\265\000\013\002\301\236\301\205\027\301\265a\314\222\000\013\002\301\236\301\205\027\302\354\000\013\002\301\236\301\205\027\301K\000\013\002\301\236\301\205\027\3028a\3028\000\013\002\301\236\301\205\027\301\340\000\013\002\301\236\301\205\027\302n\000\013\002\301\236\301\205\027\302\221a\3043\000\013\002\301\236\301\205\027\302\375\000\013\002\331\335\000\013\002\312\327\000\013\002\312\330\000\013\002\331\343\000\013\002\302\036\000\013\002\312\365\000\013\002\304$\000\013\002\304$\027\300\374\000\013\002\307\213\000\013\002\306\010\000\013\002\306\010\302~1\300\300\301\333\000\013\002\301\333\000\013\002\302\037\000\013\002\302\037\223\302\037\000\013\002\302\037\300\300\000\013\002\302\037\302i\000\013\002\304\217\000"},
+    {0x1207F,32,"\013\002\304\217\027\303C\000\013\002\333\235\000\013\002\301Q\000\013\002\333\240\000\013\002\333\241\000\013\002\307\226\000\013\002\304'\000\013\002\304'\300\300\000\013\002\304'\300\300\300\300\000\013\002\333\244\000\013\002\333\252\000\013\0029\000\013\0029\027\3028\000\013\0029\2239\300\263\223\300\263\000\013\002\302\337\000\013\002\302\337\027\025a\203a\300\001\000\013\002\302\337\027\301\204\000\013\002\302\337\027\301|\000\013\002\302\337\027\303\134\000\013\002\302\337\027\300\374\000\013\002\302\337\0271\000\013\002\333\373\000\013\002\334\004\000\013\002\301\334\000\013\002\300\276\000\013\002\300\276\027\301\353\000\013\002\300\276\027\301\353\301\030\000\013\002\300\276\027\301S\000\013\002\300\276\301_\300\276\000\013\002\300\276\303\353\300\276\000\013\002\300\276f\000\013\002\3137\000"},
+    {0x1209F,32,"\013\002\304\227\000\013\002\303C\000\013\002\301m\000\013\002\301m\027\025\000\013\002\301m\027\025a\302\353\000\013\002\301m\027\025a\302\353\027\302\353\000\013\002\301m\027\3016\000\013\002\301m\027\302\032\000\013\002\301m\027\304'\300\300\000\013\002\301m\027\304'\300\300\300\300\000\013\002\301m\027\203\000\013\002\301m\027\203\300\300\000\013\002\301m\027\301d\300\300\000\013\002\301m\027\302~\000\013\002\301m\027\302~f\000\013\002\301m\027\304\273\000\013\002\301m\027\252\000\013\002\301m\027\302\353\027\302\353\000\013\002\301m\027\300\227\000\013\002\301m\027\301\265\000\013\002\301m\027\302\221\000\013\002\301m\027\301\233\000\013\002\300\005\000\013\002\300\005\300\300\000\013\002\300^\000\013\002\300^\027\025a\300\001a\203\000\013\002\300^\027\025a\203\000\013\002\300^\027\025a\301d\000\013\002\300^\027\302\026\301\030a\303b\000\013\002\300^\027\3016\000\013\002\300^\027\300\274\000\013\002\300^\027\3033a\303\210\000"},
+    {0x120BF,32,"\013\002\300^\027\302\032\000\013\002\300^\027xa\235\000\013\002\300^\027\303t\000\013\002\300^\027\303ta\235\000\013\002\300^\027\300\001\000\013\002\300^\027\302\036\000\013\002\300^\027\304$\027\300\374\000\013\002\300^\027\304\217\000\013\002\300^\027\301\334\000\013\002\300^\027\301\334a\252\000\013\002\300^\027\300\276\000\013\002\300^\027\300\276\027\301\353\301\030\000\013\002\300^\027\301\353\301\030\000\013\002\300^\027\301\204\000\013\002\300^\027\301\321\000\013\002\300^\027\3042\000\013\002\300^\027\3042a\025\000\013\002\300^\027\3043a\301\365\000\013\002\300^\027\203a\301\265a\303C\000\013\002\300^\027\304\244\000\013\002\300^\027\304\244a\252\000\013\002\300^\027\3019a\300\227\000\013\002\300^\027\303\320\000\013\002\300^\027\301d\300\300\000\013\002\300^\027\307\347a\302\237a\300\274\000\013\002\300^\027\303N\000\013\002\300^\027\302~\000\013\002\300^\027\306V\000\013\002\300^\027\306Va\302\353\000\013\002\300^\027\304\273a\3016\000\013\002\300^\027\252\000\013\002\300^\027\301Sa\300\276\000"},
+    {0x120DF,32,"\013\002\300^\027\301|\000\013\002\300^\027\300\263\000\013\002\300^\027\300\263\223\300\263\000\013\002\300^\027\230\000\013\002\300^\027\303\134\000\013\002\300^\027\304\336\000\013\002\300^\027\300\374\000\013\002\300^\027\300\374a\304\366\000\013\002\300^\027\304\342\000\013\002\300^\027\304\352\000\013\002\300^\027\302n\000\013\002\300^\0271\000\013\002\300^\027\301\233\000\013\002\300^\027\301\233a\302\037\000\013\002\300^\223\300^\000\013\002\306.\000\013\002\306.\301_\306.\000\013\002\303H\000\013\002\303H\223\303H\301\204\223\301\204\000\013\002\303\210\000\013\002\303\210\303H\223\303H\301\204\223\301\204\000\013\002\335u\000\013\002\335v\000\013\002\3041\000\013\002\301\353\000\013\002\301\353\301\030\000\013\002\301\353\223\301\353\000\013\002\301\353\301_\301\353\000\013\002\301\204\000\013\002\335|\000\013\002\335\201\000\013\002\307\301\000"},
+    {0x120FF,32,"\013\002\307\301\027\302\042\000\013\002\301\321\000\013\002\301\321\0279\000\013\002\301\321\0271\000\013\002\301\321\301_\301\321\000\013\002\3042\000\013\002\3042\223\3042\000\013\002\3042\301_\3042\000\013\002\335\331\000\013\002\3043\000\013\002\3043\300\300\000\013\002\304\240\000\013\002\304\240\027\025a\301d\000\013\002\304\240\027\301\353\301\030\000\013\002\304\240\027\301d\000\013\002\304\240\027\301\265a\301d\000\013\002\304\240\027\230\000\013\002\335\350\000\013\002\301\354\000\013\002\301\354\301_\301\354\000\013\002\301\354\027\302\032\000\013\002\301\354\027\302n\000\013\002\301\354\301\030\000\013\002\302H\000\013\002\302H\301_\302H\000\013\002\3044\000\013\002\3044\027\303N\000\013\002\3044\027\303N\027\301d\300\300\000\013\002\3044\027\300\263\000\013\002\3044\027\303\134a\304\021\000\013\002\3044\300\300\000\013\002\302I\000"},
+    {0x1211F,32,"\013\002\302I\027\025a\302\042\000\013\002\302I\027\302\042\000\013\002\302I\223\302I\304=\000\013\002\313\216\000\013\002\307\313\000\013\002\307\313\027\300\374\000\013\002\3066\000\013\002\313\217\000\013\002\336$\000\013\002\336%\000\013\002\203\000\013\002\203\301\030\000\013\002\203\300\300\000\013\002\304\244\000\013\002\3019\000\013\002\3019\027\300\274\000\013\002\3019\027\3033\000\013\002\3019\027\302\032\000\013\002\3019\027\301\333\000\013\002\3019\027\303H\000\013\002\3019\027\307\376\000\013\002\3019\027\300\263\000\013\002\3019\027\300\374\000\013\002\3019\0271\000\013\002\302\237\000\013\002\303\320\000\013\002\303\320\027\3016\000\013\002\303\320\027\304\244\000\013\002\303\320\027\302~\000\013\002\303\320\027\310\031\000\013\002\303\320\027\301\233\000\013\002\337o\000"},
+    {0x1213F,32,"\013\002;\000\013\002;\025\000\013\002\307\332\000\013\002\305M\000\013\002\305M\223\305M\303t\000\013\002\305M\223\305Mf\000\013\002\313\312\000\013\002\301d\000\013\002\301d\312\365\000\013\002\301d\302d\000\013\002\301d\223\301d\304\343\223\304\343\301\233\223\301\233\000\013\002\301d\300\300\000\013\002\313\316\000\013\002\313\316\027\301\353\301\030\000\013\002\340\021\000\013\002\302}\000\013\002\302}\027\302n\000\013\002\302}\301_\302}\000\013\002\302}\303\353\302}\000\013\002\302}f\000\013\002\306E\000\013\002\300\241\000\013\002\305Q\000\013\002\307\347\000\013\002[\000\013\002[\027\025\000\013\002[\027\304\030\000\013\002[\027\304\030a\304\273\000\013\002[\027\3033\000\013\002[\027\302\032\000\013\002[\027\305\340\000\013\002[\027x\000"},
+    {0x1215F,32,"\013\002[\027\302\034\000\013\002[\027\304\227\000\013\002[\027\303C\000\013\002[\027\300\005\000\013\002[\027\303\210\000\013\002[\027\301\353\301\030\000\013\002[\027\301\204\000\013\002[\027\301\204a\302\367a\025\000\013\002[\027\301\321\000\013\002[\027\3043\000\013\002[\027\301\354a\304\336\000\013\002[\027\301\354\301_\301\354\000\013\002[\027\302H\000\013\002[\027\313\217\000\013\002[\027\301d\000\013\002[\027\302}\000\013\002[\027\303N\000\013\002[\027\301\323\000\013\002[\027\306V\000\013\002[\027\300\227\000\013\002[\027\301\265\000\013\002[\027\301S\000\013\002[\027\301Sa\302\037\000\013\002[\027\301Sa\301\321\000\013\002[\027\301Sa\301=\000\013\002[\027\301|\000\013\002[\027\301|a\302\244\000\013\002[\027\301K\000\013\002[\027\300\263\000\013\002[\027\300\325\000\013\002[\027\301\337\000\013\002[\027\271\000"},
+    {0x1217F,32,"\013\002[\027\304\336\000\013\002[\027\300j\000\013\002[\027\300\374\000\013\002[\027\304\342\000\013\002[\027\302\215\000\013\002[\027\316\002\000\013\002[\027\316A\000\013\002[\027\304]\000\013\002[\0271\000\013\002[\027\302\221\000\013\002[\027\301\233\000\013\002[\027\307\016\027\230\000\013\002[\027\302\375\000\013\002[\027\3030\000\013\002\307\360\000\013\002\307\360\301_\307\360\000\013\002\313\353\000\013\002\313\355\000\013\002\305V\000\013\002\340\312\000\013\002\307\361\000\013\002\307\361\223\307\361\000\013\002\303N\000\013\002\303N\027\301d\300\300\000\013\002\305W\000\013\002\305W\027\302\032\000\013\002\305W\301_\305W\000\013\002\340\321\000\013\002\340\322\000\013\002\302~\000\013\002\302~\300\242\0271\223\300\242\0271\000\013\002\302~\223\302~\300\242\0271\223\300\242\0271\000"},
+    {0x1219F,32,"\013\002\313\370\000\013\002\301\323\000\013\002\301\323\027\302\032\000\013\002\301\323\0271\000\013\002\301\323\027\301\233\000\013\002\306V\000\013\002\307\376\000\013\002\341D\000\013\002\341E\000\013\002\301\205\000\013\002\301\205\223\301\205\000\013\002\301\355\000\013\002\301\355\223\3019\027\3033\301\355\223\3019\027\3033\000\013\002\304\273\000\013\002\314\033\000\013\002\314\033\301h\020\000\013\002\341\222\000\013\002\306_\000\013\002\306_\300\300\000\013\002\314\034\000\013\002\302\042\000\013\002\302\042\303\353\302\042\000\013\002\304\274\000\013\002\341\262\000\013\002\252\000\013\002\300\242\000\013\002\300\242\027\025\000\013\002\300\242\027\025a\300\001a\203\000\013\002\300\242\027\025a\301\204\000\013\002\300\242\027\025a\302\353\000\013\002\300\242\027\302A\000\013\002\300\242\027\3016\000"},
+    {0x121BF,32,"\013\002\300\242\027\300\274\3176\301\030\000\013\002\300\242\027\302\032\000\013\002\300\242\027\302\034\000\013\002\300\242\027\312\327\000\013\002\300\242\027\300\276\000\013\002\300\242\027\300\005\000\013\002\300\242\027\301\204\000\013\002\300\242\027\302I\000\013\002\300\242\027\302Ia\302I\000\013\002\300\242\027\203\000\013\002\300\242\027\304\244\000\013\002\300\242\027\3019\027\300\263\000\013\002\300\242\027\301d\300\300\000\013\002\300\242\027\302}\000\013\002\300\242\027\302}a\203\000\013\002\300\242\027\302}a\301\265\000\013\002\300\242\027\301\323\000\013\002\300\242\027\307\376\000\013\002\300\242\027\304\273\000\013\002\300\242\027\306_\000\013\002\300\242\027\306_a\3019a\025\000\013\002\300\242\027\300\242\000\013\002\300\242\027\310\031\000\013\002\300\242\027\301\265\000\013\002\300\242\027\310\035\000\013\002\300\242\027\301S\000\013\002\300\242\027\301Sa\300\276\000\013\002\300\242\027\302M\000\013\002\300\242\027\301K\000\013\002\300\242\027\300\374a\304\352\000\013\002\300\242\027\306\331a\301\354a\304\227\000\013\002\300\242\027\306\331a\301\354\301\030\000"},
+    {0x121DF,32,"\013\002\300\242\027\303\241\000\013\002\300\242\027\303\241a\303\241\000\013\002\300\242\027\304\352\000\013\002\300\242\027\276\000\013\002\300\242\027\302n\000\013\002\300\242\027\301=a\025a\301\365a\256\000\013\002\300\242\0271\000\013\002\300\242\0271a\025\000\013\002\300\242\0271a1a1\000\013\002\300\242\027\302\221a\300\274\000\013\002\300\242\027\301\233\000\013\002\300\242\027\302\375\000\013\002\300\242f\000\013\002\302\200\000\013\002\302\200\027\300\374\000\013\002\302\200\027\300\374a\304\352\000\013\002\302\200\300\300\000\013\002\302\200\300\300\223\302\200\300\300\300\374\000\013\002\341\350\000\013\002\302\353\000\013\002\302\353\027\302\353\000\013\002\300h\000\013\002\300h\027\302\042\000\013\002\300h\027\302\042a\301\337\000\013\002\300\227\000\013\002\342a\000\013\002\342i\000\013\002\310\031\000\013\002\301\265\000\013\002\301\265\027\302\032\000\013\002\301C\000\013\002\301C\027\302A\000"},
+    {0x121FF,32,"\013\002\301C\027\302\032\000\013\002\301C\027\303C\000\013\002\301C\027\303C\301\030\000\013\002\301C\027\301\353\301\030\000\013\002\301C\027\3019\027\302\032\000\013\002\301C\027\302}\000\013\002\301C\027\313\355\000\013\002\301C\027\305V\000\013\002\301C\027\305Va\300\274\000\013\002\301C\027\301\323\000\013\002\301C\027\252a\300\274\000\013\002\301C\027\300\242\000\013\002\301C\027\301Sa\300\276\000\013\002\301C\027\301K\000\013\002\301C\027\301e\000\013\002\301C\027\301\340a\300\274\000\013\002\301C\027\316\005a\301\255\000\013\002\301C\027\304\021\000\013\002\301C\301\030\000\013\002\301C\301_\301C\000\013\002\301C\303\353\301C\000\013\002\301Cf\000\013\002\301C\302i\000\013\002\304\301\000\013\002\304=\000\013\002\304=\223\304=\000\013\002\304=\303\353\304=\000\013\002\304=\302i\000\013\002\310\034\000\013\002\310\035\000\013\002\302\354\000\013\002\302\354\223\302\354\000"},
+    {0x1221F,32,"\013\002\302\354\223\302\354\301\204\223\301\204\000\013\002\251\000\013\002\251\027\302n\000\013\002\251\300\300\000\013\002\343t\000\013\002\314\214\000\013\002\314\220\000\013\002\304\077\000\013\002\314\222\000\013\002\301S\000\013\002\3101\000\013\002\301|\000\013\002\306~\000\013\002\301!\000\013\002\301!\223\301!\000\013\002\306\201\000\013\002\306\201\300\300\000\013\002\344\241\000\013\002\344\253\000\013\002\302M\000\013\002\302M\027\025\000\013\002\302M\027\302\042\000\013\002\302M\027\300\341\000\013\002\302M\223\302M\000\013\002\302M\223\302M\027\025a\256\000\013\002\302M\301_\302M\000\013\002\304\303\000\013\002\304\303\027\025\000\013\002\304\303\027\025a\302\036\000\013\002\304\303\027\302\036\000\013\002\304\303\300\300\000\013\002\256\000"},
+    {0x1223F,32,"\013\002\314\312\000\013\002\303\344\000\013\002\303\344\300\221\000\013\002\303\344\027\302\215\301\030\000\013\002\303\344\303\353\303\344\000\013\002\344\371\000\013\002\314\316\315\014\000\013\002\314\316\000\013\002\314\317\000\013\002\301K\000\013\002\301K\027\025\000\013\002\301K\027\301\233\000\013\002\301K\302i\000\013\002\301L\000\013\002\301L\0279\000\013\002\345\250\000\013\002\310Z\000\013\002\310Z\027\301\353\301\030\000\013\002\310Z\027\301\204a\301\353\301\030\000\013\002\301\250\000\013\002\301\250\027\3016\000\013\002\301\250\027\300\274\000\013\002\301\250\027\300\274a\300\274\000\013\002\301\250\027\302I\000\013\002\301\250\027\301Sa\301\353\301\030\000\013\002\301\250\027\301K\000\013\002\301\250\027\300\263\000\013\002\301\250\027\300\374\000\013\002\301\250\027\300\374a\025\3016\000\013\002\301\250\027\300\374a\300\274\000\013\002\301\250\027\300\374a\300\274a\300\274\000\013\002\301\250\027\302\221a\300\274\000"},
+    {0x1225F,32,"\013\002\301\250\027\302\375\000\013\002\345\277\000\013\002\301e\000\013\002\315\007\000\013\002\300\263\000\013\002\300\263\302\200\027\301\204\000\013\002\300\263\302\200\027\304\077\000\013\002\300\263\302\200\027\303\134\000\013\002\300\263\302\200\027\303\134\223\300\263\302\200\027\303\134\000\013\002\300\263\302\200\027\302\375\000\013\002\300\263\301\030\000\013\002\300\263\223\300\263\000\013\002\300\263\301_\300\263\000\013\002\300\263\301_\300\263\302\200\223\302\200\000\013\002\302\244\000\013\002\302\244\302\026\027\3073\000\013\002\302\244\302\026\027\302\034\000\013\002\302\244\302\026\027\301Q\000\013\002\302\244\302\026\027\302I\000\013\002\302\244\302\026\027\301d\300\300\000\013\002\302\244\302\026\027\305V\000\013\002\302\244\302\026\027\252\000\013\002\302\244\302\026\027\301K\000\013\002\302\244\302\026\027\316\006\000\013\002\302\244\302\026\027\302\221\000\013\002\302\244\301\205\027\302\034\000\013\002\302\244\301\205\027\302\0341\000\013\002\230\000\013\002\305\206\000\013\002\310w\000\013\002\3028\000\013\002\315R\000"},
+    {0x1227F,32,"\013\002\300\325\000\013\002\300\325\027\025\000\013\002\300\325\027\301\372\000\013\002\300\325\027\302\034\000\013\002\300\325\027\301\255\000\013\002\300\325\0279\000\013\002\300\325\027;\000\013\002\300\325\027\307\332\000\013\002\300\325\0271\000\013\002\300\325\027\302\221\000\013\002\300\325\301_\300\325\000\013\002\304\324\000\013\002\304\324\027\305W\000\013\002\304\324\027\301\233\000\013\002\304\324\027\300\341\000\013\002\304\324\303\353\304\324\000\013\002\235\000\013\002\351&\000\013\002\302d\000\013\002\301\337\000\013\002\271\000\013\002\301\217\315\014\000\013\002\301\217\000\013\002\301\217\027\025\000\013\002\301\217\027\302\037\000\013\002\301\217\027\304\217\000\013\002\301\217\027\203\000\013\002\301\217\027\303N\000\013\002\301\217\027\302\042\000\013\002\301\217\027\302\354\000\013\002\301\217\027\301|\000\013\002\301\217\027\300\263\000"},
+    {0x1229F,32,"\013\002\301\217\027\303\134\000\013\002\301\217\027\304\342\000\013\002\301\217\027\303b\000\013\002\301\217\027\302\221\000\013\002\301\217\027\316\315\000\013\002\301\217\027\303\250\000\013\002\301\217\027\303\252\000\013\002\301\217\027\302\375\000\013\002\301\217\223\301\217\000\013\002\301\217\300\300\000\013\002\303\134\000\013\002\303\134\300\242\027\3033\000\013\002\352b\000\013\002\304\336\000\013\002\300j\000\013\002\302\367\000\013\002\302\367\027\025\000\013\002\302\367\027\302\032\000\013\002\302\367\027\301\354\000\013\002\302\367\027\301K\000\013\002\302\367\027\303\241\000\013\002\302\367\027\304\366\000\013\002\302\367\0271\000\013\002\302\367\0271a\025\000\013\002\315\350\000\013\002\353\360\000\013\002\302\370\000\013\002\300\374\000\013\002\300\374\302\237\000\013\002\300\374\223\300\374\303H\223\303H\301\204\223\301\204\000\013\002\300\374\223\300\374\303b\223\303b\301\204\223\301\204\000\013\002\354\003\000"},
+    {0x122BF,32,"\013\002\354\004\000\013\002\310\312\000\013\002\354\007\000\013\002\354\010\000\013\002\304\342\000\013\002\304\342\027\025\000\013\002\304\342\027\302}\000\013\002\302\317\000\013\002\302\317\027\025\000\013\002\302\317\027\305\020\000\013\002\302\317\027\305\352\000\013\002\302\317\027\306\010\000\013\002\302\317\027\301\204\000\013\002\302\317\027\301d\000\013\002\302\317\027\301d\300\300\000\013\002\302\317\027\304\274\000\013\002\302\317\027\310\035\000\013\002\302\317\027\306\201\000\013\002\302\317\027\303\134\000\013\002\354\021\000\013\002\304\343\000\013\002\304\343\301\030\000\013\002\304\343\223\304\343\303t\223\303t\000\013\002\306\331\000\013\002\302\215\000\013\002\302\215\223\300\221\302\215\000\013\002\303\241\000\013\002\3544\000\013\002\301\340\000\013\002\301\340\300\300\000\013\002\316\002\000\013\002\306\335\000"},
+    {0x122DF,32,"\013\002\306\335\223\306\335\303\241\000\013\002\316\005\000\013\002\316\006\000\013\002\301\365\000\013\002\301\365\223\301\365\000\013\002\355I\000\013\002\355J\000\013\002\316A\000\013\002\304\352\000\013\002\355L\000\013\002\306\360\000\013\002\355X\000\013\002\265\000\013\002\265\300\367\000\013\002\265\027\3019\000\013\002\265\027\301|\000\013\002\265\300\300\000\013\002\303b\000\013\002\303b\223\303b\301L\223\301L\301\333\223\301\333\000\013\002\303bf\000\013\002\276\000\013\002\276\027\302\034\000\013\002\276\027\302I\000\013\002\276\027\300\374\000\013\002\276\027\302\215\000\013\002\276\027\304\021\000\013\002\276\027\301\233\000\013\002\302n\000\013\002\304]\000\013\002\301=\000\013\002\301=\300\300\000\013\002\302&\000"},
+    {0x122FF,32,"\013\002\302&\301\030\000\013\002\311\027\000\013\002\304d\000\013\002\304d\027\302n\000\013\002\304d\223\304d\000\013\002\304d\223\304d\303H\223\303H\301\204\223\301\204\000\013\002\301\313\000\013\002\304\021\000\013\002\316\271\000\013\002\305\275\000\013\002\304\366\000\013\002\304\366\223\304\366\300\341\223\300\341\000\013\0021\000\013\0021\302I\000\013\002111\000\013\0021\2231\230\223\230\301\204\223\301\204\000\013\0021\2231\306\360\223\306\360\000\013\0021\22311\300:\2231\300:\000\013\002\302\221\000\013\002\316\315\000\013\002\301\233\000\013\002\301\233\304\274\000\013\002\301\233\027\302\032\000\013\002\301\233\027\301|\000\013\002\301\233\0271a1a1\000\013\002\301\233\0271a1a1\300\300\000\013\002\301\233\300\300\000\013\002\301\233\302i\000\013\002\301\233\302i\027\302\032\000\013\002\357\212\000\013\002\303\250\000\013\002\303\250\027\300\242\000"},
+    {0x1231F,32,"\013\002\303\250\027\301Sa\300\001\000\013\002\303\250\027\302\367\000\013\002\303\250\0271\000\013\002\357\234\000\013\002\307\016\000\013\002\307\016\027\302~\000\013\002\307\016\027\230\000\013\002\303\251\000\013\002\303\251\300\300\000\013\002\303\252\000\013\002\303\252\301_\303\252\000\013\002\303\252\302i\000\013\002\302\374\000\013\002\302\374\027\025a\203\000\013\002\302\374\027\025a\256\000\013\002\302\374\027\302A\000\013\002\302\374\027\203\000\013\002\302\374\027\300\263\000\013\002\302\374\027\302\221\000\013\002\302\374\027\302\221a\300\274\000\013\002\302\374\027\302\221a\302\034\000\013\002\357\265\000\013\002\357\267\000\013\002\357\270\000\013\002\301\253\000\013\002\301\253\027\025\000\013\002\301\253\027\3073\000\013\002\301\253\027x\000\013\002\301\253\027\307\226\000\013\002\301\253\027\300\005\000\013\002\301\253\027\303\210\000\013\002\301\253\027\301\353\301\030\000"},
+    {0x1233F,32,"\013\002\301\253\027\301\204\000\013\002\301\253\027\302H\000\013\002\301\253\027\203\000\013\002\301\253\027\301d\000\013\002\301\253\027\302}\000\013\002\301\253\027\307\347\000\013\002\301\253\027\301\323\000\013\002\301\253\027\302\354\000\013\002\301\253\027\306~\000\013\002\301\253\027\230\000\013\002\301\253\027\300\374\000\013\002\301\253\027\306\335\000\013\002\301\253\027\301\313\000\013\002\301\253\0271a\302I\000\013\002\301\253\027\301\233\000\013\002\301\253\027\304\372\000\013\002\304\372\000\013\002\304\372\0271\000\013\002\302\375\000\013\002\302\375\027\025\000\013\002\302\375\027\301\355\000\013\002\302\375\027\302\042\000\013\002\302\375\027\302n\000\013\002\357\301\000\013\002\357\276\000\013\002\357\300\000\013\002\357\304\000\013\002\316\334\000\013\002\316\334\027\302~\000\013\002\357\317\000\013\002\300\341\000\013\002\300\341\301\030\000"},
+    {0x1235F,32,"\013\002\300\341f\027\302\042\000\013\002\3622\000\013\002\3625\000\013\002\362\077\000\013\002\3030\000\013\002\3030\223\3030\000\013\002\362e\000\013\002\3175\000\013\002\3175\313\354\301\030\000\013\002\362i\000\013\002\3177\000\013\002\303\005\000\013\002\311`\000\013\002\311`\027\025\000\013\002\362y\000\013\002\362z\000\013\002\313\357\305/\000\013\002\301\372\027\300\263\000\013\002\302\026\027\025\000\013\002\305\326\027\341\231\000\013\002\301\236\301\205\027\302\221a\304\077\000\013\002\331\320\000\013\002\301\333a\302\215\000\013\002\304\217\027\300\374\000\013\002\301m\027\302I\000\013\002\301m\027\300\374\000\013\002\300^\027\3016a\303Na\025\000\013\002\300^\027\3033\000\013\002\335\217\000\013\002\335\337\000\013\002\337v\000\013\002[\027\307.\000"},
+    {0x1237F,27,"\013\002[\027\322\334\000\013\002[\027\301\354\000\013\002[\027\302I\000\013\002[\027\3019\027\3033\000\013\002[\027\302\354\000\013\002[\027\230\000\013\002[\027\3548\000\013\002[\027\301\313\000\013\002[\027\302\374\000\013\002\300\242\027\301\321\000\013\002\301C\302i\027\302\032\000\013\002\301C\027\303Ca\302\353\000\013\002\301C\027\302\215\000\013\002\314\241\000\013\002\304\303\027\300\341\000\013\002\344\366\000\013\002\310[\000\013\002\345\270\000\013\002\301\250\027\305\020\000\013\002\301\250\027\301\321\000\013\002\315\007\300\235\3010\300\320\000\013\002\315R\300\367\000\013\002\350 \000\013\002\301\217\027\301d\300\300\000\013\002\356a\000\013\002\303\250\027\301S\000\013\00211\000"},
+    {0x12400,32,"\013\257\0027\300\274\000\013\257\002B\300\274\000\013\257\002O\300\274\000\013\257\002V\300\274\000\013\257\002v\300\274\000\013\257\002\201\300\274\000\013\257\002u\300\274\000\013\257\002\211\300\274\000\013\257\002B\301\333\000\013\257\002O\301\333\000\013\257\002V\301\333\000\013\257\002v\301\333\000\013\257\002\201\301\333\000\013\257\002u\301\333\000\013\257\002\211\301\333\000\013\257\002O1\000\013\257\002V1\000\013\257\002v1\000\013\257\002\2011\000\013\257\002u1\000\013\257\002\2111\000\013\257\0022\303\211\000\013\257\0027\303\211\000\013\257\002B\303\211\000\013\257\002O\303\211\000\013\257\002V\303\211\000\013\257\002v\303\211\000\013\257\002\201\303\211\000\013\257\002u\303\211\000\013\257\002\211\303\211\000\013\257\0022\305@\000\013\257\0027\305@\000"},
+    {0x12420,32,"\013\257\002B\305@\000\013\257\002O\305@\000\013\257\002V\305@\000\013\257\0027\302\370\000\013\257\002B\302\370\000\013\257\002B\302\370\301h\020\000\013\257\002O\302\370\000\013\257\002V\302\370\000\013\257\002v\302\370\000\013\257\002\201\302\370\000\013\257\002u\302\370\000\013\257\002\211\302\370\000\013\257\0022\304\340\000\013\257\0027\304\340\000\013\257\002B\304\340\000\013\257\002B\304\340\301h\020\000\013\257\002O\304\340\000\013\257\002V\304\340\000\013\257\002\302\370\027\303\210a\301\333\000\013\257\002\302\370\027\303\210a\306~\000\013\257\0022\304\200\000\013\257\0027\304\200\000\013\257\002B\304\200\000\013\257\002B\304\200\301h\020\000\013\257\002O\304\200\000\013\257\002V\304\200\000\013\257\002B\301h\020\334:\000\013\257\002B\301h\020\334;\000\013\257\002O\301h\020\310\027\000\013\257\002O\301h\020\342j\000\013\257\002O\301h\020\310\027\025\000\013\257\002O\301h\020\310\027\077\000"},
+    {0x12440,32,"\013\257\002v\301h\020\322\335\000\013\257\002\201\301h\020\340\035\000\013\257\002\201\301h\020\306E\025\000\013\257\002\201\301h\020\306E\077\000\013\257\002u\301h\020\357\302\000\013\257\002u\301h\020\357\303\000\013\257\002\211\301h\020\313\317\000\013\257\002\211\301h\020\340\022\000\013\257\002\211\301h\020\340\023\000\013\257\002\211\301h\020\313\317\025\000\013\257\0027\300\274\301\030\000\013\257\002B\300\274\301\030\000\013\257\002O\300\274\301\030\000\013\257\002V\300\274\301\030\000\013\257\002v\300\274\301\030\000\013\257\0022\304\034\000\013\257\0027\304\034\000\013\257\002B\304\034\000\013\257\002O\304\034\000\013\257\002O\304\034\301h\020\000\013\257\002V\304\034\000\013\257\002V\304\034\301h\020\000\013\257\002\345\263\000\013\257\002\345\262\000\013\257\0022\313;\000\013\257\0027\313;\000\013\257\0022\302\321\301\333\000\013\257\0027\303\246\301\333\000\013\257\002V\316\020\301\333\000\013\257\0022\302\321\301h\020\025\000\013\257\0027\303\246\301h\020\025\000\013\257\0022\301,\300\274\000"},
+    {0x12460,15,"\013\257\0022\3011\300\274\000\013\257\002%\30742\310\327\000\013\257\002%\30742\3011\000\013\257\0022\3011\3066\000\013\257\0022o\3066\000\013\257\002\305/2\302\321\000\013\257\002\305/7\303\246\000\013\257\002\305/\301\237\000\013\257\002\305/\301H\000\013\257\002O1\301h\020\000\013\257\002V1\301h\020\000\013\257\002v1\301h\020\000\013\257\002\2011\301h\020\000\013\257\002u1\301h\020\000\013\257\002\2111\301h\020\000"},
+    {0x12470,5,"\013\300\006\002%\3074\301\344\304\214\000\013\300\006\002T\301^\000\013\300\006\002\274\301^\000\013\300\006\002\274\316\243\000\013\300\006\002\274\350\326\000"},
+    {0x12480,32,"\013\002\301\372\027\300\263\301\030\000\013\002\301\372\027\303\241\000\013\002\304\030\027\303C\000\013\002\302\032\027\301\333\301\030\000\013\002\305\017\027\302\026\000\013\002\305\017\027\301L\000\013\002\305\017\027\300\341\000\013\002\301\255\223\301\255\027\314\312\000\013\002\300\001\027\302n\000\013\002\301\236\027\302\042\000\013\002\304$\027\301d\000\013\002\304$\027111\000\013\002\307\213\027\301\233\000\013\002\301Q\027\307.\000\013\002\301Q\027\300\274\000\013\002\301Q\027\300\274\301\234(\000\013\002\301Q\027\306\010\000\013\002\301Q\027\307\226\000\013\002\301Q\027\304\227\000\013\002\301Q\027\300\005\000\013\002\301Q\027\301\321\000\013\002\301Q\027\3043\300\300\000\013\002\301Q\027\301\354\000\013\002\301Q\027\203\000\013\002\301Q\027\3019\000\013\002\301Q\027\301d\300\300\000\013\002\301Q\027\302~\000\013\002\301Q\027\302\042\000\013\002\301Q\027\304\274\000\013\002\301Q\027\304\274a\302~\000\013\002\301Q\027\341\353\000\013\002\301Q\027\300h\000"},
+    {0x124A0,32,"\013\002\301Q\027\300h\027\302\042\000\013\002\301Q\027\310\034a\301\354\000\013\002\301Q\027\304\077\000\013\002\301Q\027\3101\000\013\002\301Q\027\301|\000\013\002\301Q\027\301L\000\013\002\301Q\027\300\325\000\013\002\301Q\027\300\374\000\013\002\301Q\027\301\340\300\300\000\013\002\302\337\027\302\042\000\013\002\302\337\027\3028\000\013\002\304\227\300>\000\013\002\303C\301_\303C\000\013\002\301m\302i\027\300\274\000\013\002\301m\302i\027\3019\000\013\002\301m\302i\027\301d\300\300\000\013\002\301m\302i\027\252\000\013\002\301m\302i\027\302\353\000\013\002\301m\302i\027\301S\000\013\002\301m\302i\027\3101\000\013\002\301m\302i\027\301\365\000\013\002\301m\027\301\365\000\013\002\300^\027\305\017\000\013\002\300^\027\304$\300\300\000\013\002\300^\027\301Q\027\301d\300\300\000\013\002\300^\027\301Q\027\302~\000\013\002\300^\027\3137\000\013\002\300^\027\300\005\000\013\002\300^\027\301\204a\302\036\000\013\002\300^\027\301\204a\301K\000\013\002\300^\027\203a\025\000\013\002\300^\027\304\274a\302~\000"},
+    {0x124C0,32,"\013\002\300^\027\300h\000\013\002\300^\027\300h\027\302\042\000\013\002\300^\027\310\034\000\013\002\300^\027\302M\000\013\002\300^\027\301K\000\013\002\300^\027\301Ka\302\337\000\013\002\300^\027\301Ka\301\321\000\013\002\300^\027\302\317\000\013\002\300^\027\3177\000\013\002\306.\300\235\3010\300\320\000\013\002\307\301\0271\000\013\002\301\354\027\301\354\301_\301\354\000\013\002\3044\027\301d\300\300\000\013\002\302Ia\301\354\027\302n\000\013\002\203\301\030\300\300\000\013\002\3019\027\300\274\223\3019\027\300\274\000\013\002[\027\301\255\000\013\002[\027[\000\013\002[\027111\000\013\002[\027\303\252\000\013\002\300\242\027\303\005\223\303\005\000\013\002\341\352\000\013\002\341\354\000\013\002\341\355\000\013\002\341\356\000\013\002\314&\000\013\002\341\357\000\013\002\341\360\000\013\002\314'\223\314'\300\300\000\013\002\341\361\000\013\002\314(\223\314(\000\013\002\341\362\000"},
+    {0x124E0,32,"\013\002\341\363\000\013\002\341\364\000\013\002\341\365\000\013\002\341\366\000\013\002\341\367\000\013\002\341\370\000\013\002\341\371\000\013\002\341\372\000\013\002\341\373\000\013\002\341\374\000\013\002\341\375\000\013\002\341\376\000\013\002\341\377\000\013\002\342\001\000\013\002\342\002\000\013\002\342\003\000\013\002\342\004\000\013\002\304\275\000\013\002\304\275\027\302H\000\013\002\304\275\027\301d\000\013\002\304\275\027\3028a\304\301\000\013\002\304\275\027\3028a\3028a\304\301\000\013\002\304\275\027\302\221a\300\042\000\013\002\342\005\000\013\002\342\006\000\013\002\342\007\000\013\002\342\010\000\013\002\342\011\000\013\002\342\012\000\013\002\342\013\000\013\002\342\014\000\013\002\342\015\000"},
+    {0x12500,32,"\013\002\342\016\000\013\002\303\027\000\013\002\303\027\027\300\274\000\013\002\303\027\027\302\032\000\013\002\303\027\027\304'\300\300\300\300\000\013\002\303\027\027\304\273\000\013\002\303\027\027\252\000\013\002\303\027\027\304]\000\013\002\303\027\027\301=\000\013\002\303\027\027\302\221\000\013\002\303\027\027\301\233\000\013\002\303\027\027\304\372\000\013\002\342\017\000\013\002\303O\000\013\002\303O\027\304\217\000\013\002\303O\027\300\005\000\013\002\303O\027\301d\000\013\002\303O\027\301d\300\300\000\013\002\303O\027\301L\000\013\002\303O\027\3028a\3028a\304\301\000\013\002\303O\027\310\312a\301\323\000\013\002\303O\027\301\233\000\013\002\303O\027\304\372\000\013\002\342\021\000\013\002\342\022\000\013\002\301C\300\300\027\300\274\000\013\002\301C\027\301\333\000\013\002\301C\027\304\244\000\013\002\301C\027\3028\000\013\002\301C\027\3028a\3028a\304\301\000\013\002\301C\027\302n\000\013\002\301|a\317-\000"},
+    {0x12520,32,"\013\002\302M\223\302M\027\300\005\000\013\002\302M\223\302M\027\303N\000\013\002\301\250\027\304$\300\300\000\013\002\301\250\027\301\354\000\013\002\301\250\027\313\216\000\013\002\301\250\027\3019\000\013\002\301\250\027\313\370\000\013\002\301\250\027\314&\000\013\002\301\250\027\304\077\000\013\002\301\250\027\3028a\3028\000\013\002\301\250\0271\000\013\002\301\250\0271a1\000\013\002\301\250\027\304\372\000\013\002\301\217\300\300\027\203\000\013\002\301\217\027\300\276\000\013\002\301\217\027\300\374\301\234(\000\013\002\301\217\027\302n\000\013\002\315\350\301\030\000\013\002\300\374\223\300\374\000\013\002\300\374a\303\320\000\013\002\300\374a\314\317\000\013\002\300\374a\304\336\000\013\002\303\241a\301Q\027\301L\000\013\002\303\241a\302\337\027\3016\000\013\002\301\340\027\302n\000\013\002\302na\301\217\000\013\002\305\275\027\301\353\301\030\000\013\002\305\275\027B\301\333\000\013\002\302\374\300\221\000\013\002\302\374\027\301\233\000\013\002\301\253\027\312\330\000\013\002\301\253\027\342\020\000"},
+    {0x12540,4,"\013\002\301\253\027\304\301\000\013\002\317-\000\013\002\303\005\223\303\005a\304\336\000\013\002\311`\027B\301\333\301\030\000"},
+    {0x12F90,32,"\300\013\002\325\233\000\300\013\002\325\234\000\300\013\002\325\235\000\300\013\002\325\236\000\300\013\002\325\237\000\300\013\002\325\240\000\300\013\002\325\241\000\300\013\002\325\242\000\300\013\002\325\243\000\300\013\002\325\244\000\300\013\002\325\245\000\300\013\002\325\246\000\300\013\002\325\247\000\300\013\002\325\250\000\300\013\002\325\251\000\300\013\002\325\252\000\300\013\002\325\253\000\300\013\002\325\254\000\300\013\002\325\255\000\300\013\002\325\256\000\300\013\002\325\257\000\300\013\002\325\260\000\300\013\002\325\261\000\300\013\002\325\262\000\300\013\002\325\263\000\300\013\002\325\264\000\300\013\002\325\265\000\300\013\002\325\266\000\300\013\002\325\267\000\300\013\002\325\270\000\300\013\002\325\271\000\300\013\002\325\272\000"},
+    {0x12FB0,32,"\300\013\002\325\273\000\300\013\002\325\274\000\300\013\002\325\275\000\300\013\002\325\276\000\300\013\002\325\277\000\300\013\002\325\300\000\300\013\002\325\301\000\300\013\002\325\302\000\300\013\002\325\303\000\300\013\002\325\304\000\300\013\002\325\305\000\300\013\002\325\306\000\300\013\002\325\307\000\300\013\002\325\310\000\300\013\002\325\311\000\300\013\002\325\312\000\300\013\002\325\313\000\300\013\002\325\314\000\300\013\002\325\315\000\300\013\002\325\316\000\300\013\002\325\317\000\300\013\002\325\320\000\300\013\002\325\321\000\300\013\002\325\322\000\300\013\002\325\323\000\300\013\002\325\324\000\300\013\002\325\325\000\300\013\002\325\326\000\300\013\002\325\327\000\300\013\002\325\330\000\300\013\002\325\331\000\300\013\002\325\332\000"},
+    {0x12FD0,32,"\300\013\002\325\333\000\300\013\002\325\334\000\300\013\002\325\335\000\300\013\002\325\336\000\300\013\002\325\337\000\300\013\002\325\340\000\300\013\002\325\341\000\300\013\002\325\342\000\300\013\002\325\343\000\300\013\002\325\344\000\300\013\002\325\345\000\300\013\002\325\346\000\300\013\002\325\347\000\300\013\002\325\350\000\300\013\002\325\351\000\300\013\002\325\352\000\300\013\002\325\353\000\300\013\002\325\354\000\300\013\002\325\355\000\300\013\002\325\356\000\300\013\002\325\357\000\300\013\002\325\360\000\300\013\002\325\361\000\300\013\002\325\362\000\300\013\002\325\363\000\300\013\002\325\364\000\300\013\002\325\365\000\300\013\002\325\366\000\300\013\002\325\367\000\300\013\002\325\370\000\300\013\002\325\371\000\300\013\002\325\372\000"},
+    {0x12FF0,3,"\300\013\002\325\373\000\300\013\002\325\374\000\300\013\002\325\375\000"},
+    {0x13000,32,"\016\007\311c\000\016\007\311d\000\016\007\311e\000\016\007\311f\000\016\007\311g\000\016\007\317P\000\016\007\311h\000\016\007\317Q\000\016\007\317R\000\016\007\311i\000\016\007\311j\000\016\007\311k\000\016\007\311l\000\016\007\311m\000\016\007\311n\000\016\007\311o\000\016\007\311p\000\016\007\317T\000\016\007\311q\000\016\007\311r\000\016\007\311s\000\016\007\317U\000\016\007\311t\000\016\007\311u\000\016\007\311v\000\016\007\311w\000\016\007\311x\000\016\007\311y\000\016\007\311z\000\016\007\311{\000\016\007\311|\000\016\007\311}\000"},
+    {0x13020,32,"\016\007\311~\000\016\007\311\177\000\016\007\311\200\000\016\007\311\201\000\016\007\311\202\000\016\007\317X\000\016\007\311\203\000\016\007\311\204\000\016\007\311\205\000\016\007\311\206\000\016\007\311\207\000\016\007\311\210\000\016\007\311\211\000\016\007\311\212\000\016\007\317Z\000\016\007\311\213\000\016\007\311\214\000\016\007\317\134\000\016\007\311\215\000\016\007\317]\000\016\007\311\216\000\016\007\311\217\000\016\007\311\220\000\016\007\311\221\000\016\007\311\222\000\016\007\311\223\000\016\007\311\224\000\016\007\311\225\000\016\007\311\226\000\016\007\311\227\000\016\007\311\230\000\016\007\311\231\000"},
+    {0x13040,32,"\016\007\311\232\000\016\007\311\233\000\016\007\311\234\000\016\007\311\235\000\016\007\311\236\000\016\007\311\237\000\016\007\311\240\000\016\007\311\241\000\016\007\311\242\000\016\007\311\243\000\016\007\311\244\000\016\007\311\245\000\016\007\311\246\000\016\007\311\247\000\016\007\311\250\000\016\007\311\251\000\016\007\312G\000\016\007\312H\000\016\007\312I\000\016\007\312J\000\016\007\312K\000\016\007\323\020\000\016\007\312L\000\016\007\312M\000\016\007\312N\000\016\007\312O\000\016\007\324\263\000\016\007\324\264\000\016\007\324\265\000\016\007\324\266\000\016\007\324\267\000\016\007\324\270\000"},
+    {0x13060,32,"\016\007\324\271\000\016\007\324\272\000\016\007\324\273\000\016\007\324\274\000\016\007\324\275\000\016\007\324\276\000\016\007\324\277\000\016\007\324\300\000\016\007\324\301\000\016\007\324\302\000\016\007\324\303\000\016\007\324\304\000\016\007\324\305\000\016\007\324\306\000\016\007\324\307\000\016\007\324\310\000\016\007\324\311\000\016\007\324\312\000\016\007\324\313\000\016\007\324\314\000\016\007\324\315\000\016\007\324\316\000\016\007\331o\000\016\007\331p\000\016\007\331q\000\016\007\331r\000\016\007\331s\000\016\007\331t\000\016\007\331u\000\016\007\331v\000\016\007\331w\000\016\007\331x\000"},
+    {0x13080,32,"\016\007\331y\000\016\007\331z\000\016\007\331{\000\016\007\331|\000\016\007\331}\000\016\007\331~\000\016\007\331\177\000\016\007\331\200\000\016\007\331\201\000\016\007\331\202\000\016\007\331\203\000\016\007\331\204\000\016\007\331\205\000\016\007\331\206\000\016\007\331\207\000\016\007\331\210\000\016\007\331\211\000\016\007\331\212\000\016\007\331\213\000\016\007\331\214\000\016\007\331\215\000\016\007\331\216\000\016\007\331\217\000\016\007\331\220\000\016\007\331\221\000\016\007\331\222\000\016\007\331\223\000\016\007\331\224\000\016\007\331\225\000\016\007\331\226\000\016\007\331\227\000\016\007\331\230\000"},
+    {0x130A0,32,"\016\007\331\231\000\016\007\331\232\000\016\007\331\233\000\016\007\331\234\000\016\007\331\235\000\016\007\331\236\000\016\007\331\237\000\016\007\331\240\000\016\007\331\241\000\016\007\331\242\000\016\007\331\243\000\016\007\331\244\000\016\007\331\245\000\016\007\331\246\000\016\007\331\247\000\016\007\331\250\000\016\007\331\251\000\016\007\331\252\000\016\007\331\253\000\016\007\331\254\000\016\007\331\255\000\016\007\331\256\000\016\007\331\257\000\016\007\331\260\000\016\007\331\261\000\016\007\331\262\000\016\007\331\263\000\016\007\331\264\000\016\007\331\265\000\016\007\331\266\000\016\007\331\267\000\016\007\331\270\000"},
+    {0x130C0,32,"\016\007\331\271\000\016\007\331\272\000\016\007\331\273\000\016\007\331\274\000\016\007\331\275\000\016\007\331\276\000\016\007\331\277\000\016\007\331\300\000\016\007\331\301\000\016\007\331\302\000\016\007\331\303\000\016\007\331\304\000\016\007\331\305\000\016\007\331\306\000\016\007\331\307\000\016\007\331\310\000\016\007\331\311\000\016\007\331\312\000\016\007\333\310\000\016\007\333\311\000\016\007\333\312\000\016\007\333\313\000\016\007\333\314\000\016\007\333\315\000\016\007\333\316\000\016\007\333\317\000\016\007\333\320\000\016\007\333\321\000\016\007\333\322\000\016\007\333\323\000\016\007\333\324\000\016\007\333\325\000"},
+    {0x130E0,32,"\016\007\333\326\000\016\007\333\327\000\016\007\333\330\000\016\007\333\331\000\016\007\333\332\000\016\007\333\333\000\016\007\333\334\000\016\007\333\335\000\016\007\333\336\000\016\007\333\337\000\016\007\333\340\000\016\007\333\341\000\016\007\333\342\000\016\007\333\343\000\016\007\333\344\000\016\007\333\345\000\016\007\333\346\000\016\007\333\347\000\016\007\333\350\000\016\007\333\351\000\016\007\333\352\000\016\007\333\353\000\016\007\333\354\000\016\007\333\355\000\016\007\333\356\000\016\007\333\357\000\016\007\333\360\000\016\007\333\361\000\016\007\333\362\000\016\007\333\363\000\016\007\334b\000\016\007\334c\000"},
+    {0x13100,32,"\016\007\334d\000\016\007\334e\000\016\007\334f\000\016\007\334g\000\016\007\334h\000\016\007\334i\000\016\007\334j\000\016\007\334k\000\016\007\334l\000\016\007\334m\000\016\007\334n\000\016\007\334o\000\016\007\334p\000\016\007\334q\000\016\007\334r\000\016\007\334s\000\016\007\334t\000\016\007\334u\000\016\007\334v\000\016\007\334w\000\016\007\334x\000\016\007\334y\000\016\007\334z\000\016\007\334{\000\016\007\334|\000\016\007\334}\000\016\007\334~\000\016\007\334\177\000\016\007\334\200\000\016\007\334\201\000\016\007\334\202\000\016\007\334\203\000"},
+    {0x13120,32,"\016\007\334\204\000\016\007\334\205\000\016\007\334\206\000\016\007\334\207\000\016\007\334\210\000\016\007\334\211\000\016\007\334\212\000\016\007\334\213\000\016\007\334\214\000\016\007\334\215\000\016\007\334\216\000\016\007\334\217\000\016\007\334\220\000\016\007\334\221\000\016\007\334\222\000\016\007\334\223\000\016\007\334\224\000\016\007\334\225\000\016\007\334\226\000\016\007\334\227\000\016\007\334\230\000\016\007\334\231\000\016\007\334\232\000\016\007\334\233\000\016\007\334\234\000\016\007\334\235\000\016\007\334\236\000\016\007\334\237\000\016\007\334\240\000\016\007\334\241\000\016\007\334\242\000\016\007\335/\000"},
+    {0x13140,32,"\016\007\3350\000\016\007\3351\000\016\007\3352\000\016\007\3353\000\016\007\3354\000\016\007\3355\000\016\007\3356\000\016\007\3357\000\016\007\3358\000\016\007\3359\000\016\007\335:\000\016\007\335;\000\016\007\335<\000\016\007\335=\000\016\007\335>\000\016\007\335\077\000\016\007\335@\000\016\007\335A\000\016\007\335B\000\016\007\335C\000\016\007\335D\000\016\007\335E\000\016\007\335F\000\016\007\335G\000\016\007\335H\000\016\007\335I\000\016\007\335J\000\016\007\335K\000\016\007\335L\000\016\007\335M\000\016\007\335N\000\016\007\335O\000"},
+    {0x13160,32,"\016\007\335P\000\016\007\335Q\000\016\007\335R\000\016\007\335S\000\016\007\335T\000\016\007\335U\000\016\007\335V\000\016\007\335W\000\016\007\335X\000\016\007\335Y\000\016\007\335Z\000\016\007\335[\000\016\007\335\134\000\016\007\335]\000\016\007\335^\000\016\007\335_\000\016\007\335`\000\016\007\335a\000\016\007\335b\000\016\007\335c\000\016\007\335d\000\016\007\335e\000\016\007\335f\000\016\007\335g\000\016\007\335h\000\016\007\335i\000\016\007\335j\000\016\007\335k\000\016\007\335l\000\016\007\335m\000\016\007\335n\000\016\007\3368\000"},
+    {0x13180,32,"\016\007\3369\000\016\007\336:\000\016\007\336;\000\016\007\336<\000\016\007\336=\000\016\007\336>\000\016\007\336\077\000\016\007\336@\000\016\007\337\264\000\016\007\337\265\000\016\007\337\266\000\016\007\337\267\000\016\007\337\270\000\016\007\337\271\000\016\007\337\272\000\016\007\337\273\000\016\007\337\274\000\016\007\337\275\000\016\007\337\276\000\016\007\337\277\000\016\007\337\300\000\016\007\337\301\000\016\007\337\302\000\016\007\337\303\000\016\007\337\304\000\016\007\337\305\000\016\007\337\306\000\016\007\340\253\000\016\007\340\254\000\016\007\340\255\000\016\007\340\256\000\016\007\340\257\000"},
+    {0x131A0,32,"\016\007\340\260\000\016\007\340\261\000\016\007\340\262\000\016\007\341\310\000\016\007\341\311\000\016\007\341\312\000\016\007\341\313\000\016\007\341\314\000\016\007\341\315\000\016\007\341\316\000\016\007\341\317\000\016\007\341\320\000\016\007\341\321\000\016\007\314\134\000\016\007\342\275\000\016\007\342\276\000\016\007\314]\000\016\007\314^\000\016\007\342\277\000\016\007\314_\000\016\007\314`\000\016\007\314a\000\016\007\314b\000\016\007\314c\000\016\007\314d\000\016\007\314e\000\016\007\342\300\000\016\007\314f\000\016\007\314g\000\016\007\342\301\000\016\007\342\302\000\016\007\342\303\000"},
+    {0x131C0,32,"\016\007\342\304\000\016\007\342\305\000\016\007\342\306\000\016\007\342\307\000\016\007\342\310\000\016\007\314h\000\016\007\314i\000\016\007\314j\000\016\007\342\311\000\016\007\314k\000\016\007\342\312\000\016\007\314l\000\016\007\342\313\000\016\007\314m\000\016\007\314n\000\016\007\314o\000\016\007\314p\000\016\007\314q\000\016\007\342\314\000\016\007\314r\000\016\007\314s\000\016\007\342\315\000\016\007\314t\000\016\007\314u\000\016\007\314v\000\016\007\314w\000\016\007\342\316\000\016\007\314x\000\016\007\314y\000\016\007\314z\000\016\007\342\317\000\016\007\314{\000"},
+    {0x131E0,32,"\016\007\314|\000\016\007\342\320\000\016\007\342\321\000\016\007\314}\000\016\007\314~\000\016\007\314\177\000\016\007\314\200\000\016\007\314\201\000\016\007\314\202\000\016\007\314\203\000\016\007\342\322\000\016\007\314\204\000\016\007\314\205\000\016\007\314\206\000\016\007\314\207\000\016\007\344\275\000\016\007\344\276\000\016\007\344\277\000\016\007\344\300\000\016\007\344\301\000\016\007\344\302\000\016\007\344\303\000\016\007\344\304\000\016\007\344\305\000\016\007\344\306\000\016\007\344\307\000\016\007\344\310\000\016\007\344\311\000\016\007\344\312\000\016\007\344\313\000\016\007\344\314\000\016\007\344\315\000"},
+    {0x13200,32,"\016\007\344\316\000\016\007\344\317\000\016\007\344\320\000\016\007\344\321\000\016\007\344\322\000\016\007\344\323\000\016\007\344\324\000\016\007\344\325\000\016\007\344\326\000\016\007\344\327\000\016\007\344\330\000\016\007\344\331\000\016\007\344\332\000\016\007\344\333\000\016\007\344\334\000\016\007\344\335\000\016\007\344\336\000\016\007\344\337\000\016\007\344\340\000\016\007\344\341\000\016\007\344\342\000\016\007\344\343\000\016\007\344\344\000\016\007\344\345\000\016\007\344\346\000\016\007\344\347\000\016\007\344\350\000\016\007\344\351\000\016\007\344\352\000\016\007\344\353\000\016\007\344\354\000\016\007\344\355\000"},
+    {0x13220,32,"\016\007\345\346\000\016\007\345\347\000\016\007\345\350\000\016\007\345\351\000\016\007\345\352\000\016\007\345\353\000\016\007\345\354\000\016\007\345\355\000\016\007\345\356\000\016\007\345\357\000\016\007\345\360\000\016\007\345\361\000\016\007\345\362\000\016\007\345\363\000\016\007\345\364\000\016\007\345\365\000\016\007\345\366\000\016\007\345\367\000\016\007\345\370\000\016\007\345\371\000\016\007\345\372\000\016\007\345\373\000\016\007\346_\000\016\007\346`\000\016\007\346a\000\016\007\346b\000\016\007\346c\000\016\007\346d\000\016\007\346e\000\016\007\346f\000\016\007\346g\000\016\007\346h\000"},
+    {0x13240,32,"\016\007\346i\000\016\007\346j\000\016\007\346k\000\016\007\346l\000\016\007\346m\000\016\007\346n\000\016\007\346o\000\016\007\346p\000\016\007\346q\000\016\007\346r\000\016\007\346s\000\016\007\346t\000\016\007\346u\000\016\007\346v\000\016\007\346w\000\016\007\346x\000\016\007\346\320\000\016\007\346\321\000\016\007\346\322\000\016\007\346\323\000\016\007\346\324\000\016\007\346\325\000\016\007\346\326\000\016\007\346\327\000\016\007\346\330\000\016\007\346\331\000\016\007\346\332\000\016\007\346\333\000\016\007\346\334\000\016\007\346\335\000\016\007\346\336\000\016\007\346\337\000"},
+    {0x13260,32,"\016\007\346\340\000\016\007\346\341\000\016\007\346\342\000\016\007\346\343\000\016\007\346\344\000\016\007\346\345\000\016\007\346\346\000\016\007\346\347\000\016\007\346\350\000\016\007\346\351\000\016\007\346\352\000\016\007\346\353\000\016\007\346\354\000\016\007\346\355\000\016\007\346\356\000\016\007\346\357\000\016\007\346\360\000\016\007\346\361\000\016\007\346\362\000\016\007\346\363\000\016\007\346\364\000\016\007\346\365\000\016\007\346\366\000\016\007\346\367\000\016\007\346\370\000\016\007\346\371\000\016\007\346\372\000\016\007\346\373\000\016\007\346\374\000\016\007\346\375\000\016\007\346\376\000\016\007\346\377\000"},
+    {0x13280,32,"\016\007\347\001\000\016\007\347\002\000\016\007\347\003\000\016\007\347\004\000\016\007\347\005\000\016\007\347\006\000\016\007\347\007\000\016\007\347\010\000\016\007\347\011\000\016\007\347\012\000\016\007\347\013\000\016\007\347\014\000\016\007\347\015\000\016\007\347\016\000\016\007\347\017\000\016\007\347\020\000\016\007\347\021\000\016\007\347\022\000\016\007\347\023\000\016\007\347\024\000\016\007\347\025\000\016\007\347\026\000\016\007\347\027\000\016\007\347\030\000\016\007\347\031\000\016\007\347\032\000\016\007\347\033\000\016\007\347e\000\016\007\347f\000\016\007\347g\000\016\007\347h\000\016\007\347i\000"},
+    {0x132A0,32,"\016\007\347j\000\016\007\347k\000\016\007\347l\000\016\007\347m\000\016\007\347n\000\016\007\347o\000\016\007\347p\000\016\007\347q\000\016\007\350\246\000\016\007\350\247\000\016\007\350\250\000\016\007\350\251\000\016\007\350\252\000\016\007\350\253\000\016\007\350\254\000\016\007\350\374\000\016\007\350\375\000\016\007\350\376\000\016\007\350\377\000\016\007\351\001\000\016\007\351\002\000\016\007\351\003\000\016\007\351\004\000\016\007\351\005\000\016\007\351\006\000\016\007\351\007\000\016\007\351\010\000\016\007\351\011\000\016\007\351\012\000\016\007\351\013\000\016\007\351\014\000\016\007\351\015\000"},
+    {0x132C0,32,"\016\007\351\016\000\016\007\351\017\000\016\007\351\020\000\016\007\351\021\000\016\007\351\022\000\016\007\351\023\000\016\007\351\024\000\016\007\351\025\000\016\007\351\026\000\016\007\351\027\000\016\007\351\030\000\016\007\351\031\000\016\007\351\032\000\016\007\351\033\000\016\007\351\034\000\016\007\351\035\000\016\007\351\036\000\016\007\352\005\000\016\007\352\006\000\016\007\352\007\000\016\007\352\010\000\016\007\352\011\000\016\007\352\012\000\016\007\352\013\000\016\007\352\014\000\016\007\352\015\000\016\007\352\016\000\016\007\352\017\000\016\007\352\020\000\016\007\352\021\000\016\007\352\022\000\016\007\352\023\000"},
+    {0x132E0,32,"\016\007\352\024\000\016\007\352\025\000\016\007\352\026\000\016\007\352\027\000\016\007\352\030\000\016\007\352\031\000\016\007\352\032\000\016\007\352\033\000\016\007\352\034\000\016\007\352\035\000\016\007\352\036\000\016\007\352\037\000\016\007\352 \000\016\007\352!\000\016\007\352\042\000\016\007\352#\000\016\007\352$\000\016\007\352%\000\016\007\352&\000\016\007\352'\000\016\007\352(\000\016\007\352)\000\016\007\352*\000\016\007\352+\000\016\007\352,\000\016\007\352-\000\016\007\352.\000\016\007\352/\000\016\007\3520\000\016\007\3521\000\016\007\3522\000\016\007\3523\000"},
+    {0x13300,32,"\016\007\3524\000\016\007\3525\000\016\007\3526\000\016\007\3527\000\016\007\3528\000\016\007\3529\000\016\007\352:\000\016\007\355\245\000\016\007\355\246\000\016\007\355\247\000\016\007\355\250\000\016\007\355\251\000\016\007\355\252\000\016\007\355\253\000\016\007\355\254\000\016\007\355\255\000\016\007\355\256\000\016\007\355\257\000\016\007\355\260\000\016\007\355\261\000\016\007\355\262\000\016\007\355\263\000\016\007\355\264\000\016\007\355\265\000\016\007\355\266\000\016\007\355\267\000\016\007\355\270\000\016\007\355\271\000\016\007\355\272\000\016\007\355\273\000\016\007\355\274\000\016\007\355\275\000"},
+    {0x13320,32,"\016\007\355\276\000\016\007\355\277\000\016\007\355\300\000\016\007\355\301\000\016\007\355\302\000\016\007\355\303\000\016\007\355\304\000\016\007\355\305\000\016\007\355\306\000\016\007\355\307\000\016\007\355\310\000\016\007\355\311\000\016\007\355\312\000\016\007\355\313\000\016\007\355\314\000\016\007\355\315\000\016\007\355\316\000\016\007\355\317\000\016\007\355\320\000\016\007\357T\000\016\007\357U\000\016\007\357V\000\016\007\357W\000\016\007\357X\000\016\007\357Y\000\016\007\357Z\000\016\007\357[\000\016\007\357\134\000\016\007\357]\000\016\007\357^\000\016\007\357_\000\016\007\357`\000"},
+    {0x13340,32,"\016\007\357a\000\016\007\357b\000\016\007\357c\000\016\007\357d\000\016\007\357e\000\016\007\357f\000\016\007\357g\000\016\007\357h\000\016\007\357i\000\016\007\357j\000\016\007\357k\000\016\007\357l\000\016\007\357m\000\016\007\357n\000\016\007\357o\000\016\007\357p\000\016\007\357q\000\016\007\357r\000\016\007\357s\000\016\007\357t\000\016\007\357u\000\016\007\357v\000\016\007\357w\000\016\007\357x\000\016\007\357y\000\016\007\357z\000\016\007\357{\000\016\007\357|\000\016\007\357}\000\016\007\357~\000\016\007\357\177\000\016\007\357\200\000"},
+    {0x13360,32,"\016\007\357\201\000\016\007\357\202\000\016\007\357\320\000\016\007\357\321\000\016\007\357\322\000\016\007\357\323\000\016\007\357\324\000\016\007\357\325\000\016\007\357\326\000\016\007\357\327\000\016\007\357\330\000\016\007\357\331\000\016\007\357\332\000\016\007\357\333\000\016\007\357\334\000\016\007\357\335\000\016\007\357\336\000\016\007\357\337\000\016\007\357\340\000\016\007\357\341\000\016\007\357\342\000\016\007\357\343\000\016\007\357\344\000\016\007\357\345\000\016\007\357\346\000\016\007\357\347\000\016\007\357\350\000\016\007\357\351\000\016\007\357\352\000\016\007\357\353\000\016\007\357\354\000\016\007\357\355\000"},
+    {0x13380,32,"\016\007\357\356\000\016\007\357\357\000\016\007\357\360\000\016\007\357\361\000\016\007\357\362\000\016\007\357\363\000\016\007\357\364\000\016\007\357\365\000\016\007\357\366\000\016\007\357\367\000\016\007\357\370\000\016\007\357\371\000\016\007\357\372\000\016\007\357\373\000\016\007\357\374\000\016\007\357\375\000\016\007\357\376\000\016\007\357\377\000\016\007\360\001\000\016\007\360\002\000\016\007\360\003\000\016\007\360\004\000\016\007\360\005\000\016\007\360\006\000\016\007\360\007\000\016\007\360\010\000\016\007\360\011\000\016\007\360\012\000\016\007\360\013\000\016\007\360\014\000\016\007\360\015\000\016\007\360\016\000"},
+    {0x133A0,32,"\016\007\360\017\000\016\007\360\020\000\016\007\360\021\000\016\007\360\022\000\016\007\360\023\000\016\007\360\024\000\016\007\360\025\000\016\007\360\026\000\016\007\360\027\000\016\007\360\030\000\016\007\360\031\000\016\007\360\032\000\016\007\360\033\000\016\007\360\034\000\016\007\360\035\000\016\007\360\262\000\016\007\360\263\000\016\007\360\264\000\016\007\360\265\000\016\007\360\266\000\016\007\360\267\000\016\007\360\270\000\016\007\360\271\000\016\007\360\272\000\016\007\360\273\000\016\007\360\274\000\016\007\360\275\000\016\007\360\276\000\016\007\360\277\000\016\007\360\300\000\016\007\360\301\000\016\007\360\302\000"},
+    {0x133C0,32,"\016\007\360\303\000\016\007\360\304\000\016\007\360\305\000\016\007\360\306\000\016\007\360\307\000\016\007\360\310\000\016\007\360\311\000\016\007\360\312\000\016\007\360\313\000\016\007\360\314\000\016\007\360\315\000\016\007\360\316\000\016\007\360\317\000\016\007\360\320\000\016\007\360\321\000\016\007\361@\000\016\007\361A\000\016\007\361B\000\016\007\361C\000\016\007\361D\000\016\007\361E\000\016\007\361F\000\016\007\361G\000\016\007\361H\000\016\007\361I\000\016\007\361J\000\016\007\361K\000\016\007\361{\000\016\007\361|\000\016\007\361}\000\016\007\361~\000\016\007\361\177\000"},
+    {0x133E0,32,"\016\007\361\200\000\016\007\361\201\000\016\007\361\202\000\016\007\361\203\000\016\007\362\010\000\016\007\362\011\000\016\007\362\012\000\016\007\362\013\000\016\007\362\014\000\016\007\362\015\000\016\007\362\016\000\016\007\362\017\000\016\007\362\020\000\016\007\362\021\000\016\007\362\022\000\016\007\362\023\000\016\007\362\024\000\016\007\362\025\000\016\007\362\026\000\016\007\362\027\000\016\007\362\030\000\016\007\362\031\000\016\007\362\032\000\016\007\362\033\000\016\007\362\034\000\016\007\362\035\000\016\007\362\036\000\016\007\362\037\000\016\007\362 \000\016\007\362!\000\016\007\362\042\000\016\007\362#\000"},
+    {0x13400,32,"\016\007\362$\000\016\007\362%\000\016\007\362&\000\016\007\362'\000\016\007\362(\000\016\007\362)\000\016\007\362*\000\016\007\362+\000\016\007\362,\000\016\007\362-\000\016\007\362.\000\016\007\362/\000\016\007\3620\000\016\007\321\246\000\016\007\321\247\000\016\007\321\250\000\016\007\321\251\000\016\007\321\252\000\016\007\321\253\000\016\007\321\254\000\016\007\321\255\000\016\007\321\256\000\016\007\321\257\000\016\007\321\260\000\016\007\321\261\000\016\007\321\262\000\016\007\321\263\000\016\007\321\264\000\016\007\321\265\000\016\007\321\266\000\016\007\321\267\000\016\007\321\270\000"},
+    {0x13420,15,"\016\007\321\271\000\016\007\321\272\000\016\007\321\273\000\016\007\321\274\000\016\007\321\275\000\016\007\321\276\000\016\007\321\277\000\016\007\321\300\000\016\007\321\301\000\016\007\321\302\000\016\007\321\303\000\016\007\321\304\000\016\007\321\305\000\016\007\321\306\000\016\007\321\307\000"},
+    {0x13430,9,"\016\007T\3048\000\016\007\255\3048\000\016\007\306F\301\234\300\365\305\253\000\016\007\306F\301\234\3017\305\253\000\016\007\306F\301\234\300\365\301l\000\016\007\306F\301\234\3017\301l\000\016\007\301\336M\000\016\007\303\266\310\300\000\016\007\301l\310\300\000"},
+    {0x14400,32,"\033\007\311c\000\033\007\311d\000\033\007\311e\000\033\007\311f\000\033\007\311g\000\033\007\311h\000\033\007\311i\000\033\007\311j\000\033\007\311k\000\033\007\311l\000\033\007\317S\000\033\007\311m\000\033\007\311n\000\033\007\311o\000\033\007\311p\000\033\007\311q\000\033\007\311r\000\033\007\311s\000\033\007\311t\000\033\007\311u\000\033\007\311v\000\033\007\311w\000\033\007\311x\000\033\007\311y\000\033\007\311z\000\033\007\311{\000\033\007\311|\000\033\007\317V\000\033\007\311}\000\033\007\311~\000\033\007\311\177\000\033\007\311\200\000"},
+    {0x14420,32,"\033\007\311\201\000\033\007\311\202\000\033\007\311\203\000\033\007\311\204\000\033\007\311\205\000\033\007\311\206\000\033\007\311\207\000\033\007\311\210\000\033\007\311\211\000\033\007\317Y\000\033\007\311\212\000\033\007\311\213\000\033\007\317[\000\033\007\311\214\000\033\007\311\215\000\033\007\311\216\000\033\007\311\217\000\033\007\311\220\000\033\007\311\221\000\033\007\317^\000\033\007\317_\000\033\007\311\222\000\033\007\311\223\000\033\007\311\224\000\033\007\311\225\000\033\007\311\226\000\033\007\311\227\000\033\007\311\230\000\033\007\311\231\000\033\007\311\232\000\033\007\311\233\000\033\007\311\234\000"},
+    {0x14440,32,"\033\007\311\235\000\033\007\311\236\000\033\007\311\237\000\033\007\311\240\000\033\007\311\241\000\033\007\311\242\000\033\007\311\243\000\033\007\311\244\000\033\007\311\245\000\033\007\317`\000\033\007\317a\000\033\007\317b\000\033\007\311\246\000\033\007\311\247\000\033\007\311\250\000\033\007\311\251\000\033\007\317c\000\033\007\317d\000\033\007\317e\000\033\007\317f\000\033\007\317g\000\033\007\317h\000\033\007\317i\000\033\007\317j\000\033\007\317k\000\033\007\317l\000\033\007\317m\000\033\007\317n\000\033\007\317o\000\033\007\317p\000\033\007\317q\000\033\007\317r\000"},
+    {0x14460,32,"\033\007\317s\000\033\007\317t\000\033\007\317u\000\033\007\317v\000\033\007\317w\000\033\007\317x\000\033\007\317y\000\033\007\317z\000\033\007\317{\000\033\007\317|\000\033\007\317}\000\033\007\317~\000\033\007\317\177\000\033\007\317\200\000\033\007\317\201\000\033\007\317\202\000\033\007\317\204\000\033\007\317\205\000\033\007\317\206\000\033\007\317\207\000\033\007\317\210\000\033\007\317\211\000\033\007\317\212\000\033\007\317\213\000\033\007\317\214\000\033\007\317\215\000\033\007\317\216\000\033\007\317\217\000\033\007\317\220\000\033\007\317\221\000\033\007\317\222\000\033\007\317\223\000"},
+    {0x14480,32,"\033\007\317\224\000\033\007\317\225\000\033\007\317\226\000\033\007\317\227\000\033\007\317\230\000\033\007\317\231\000\033\007\317\232\000\033\007\317\233\000\033\007\317\234\000\033\007\317\235\000\033\007\317\236\000\033\007\317\237\000\033\007\317\240\000\033\007\317\241\000\033\007\317\242\000\033\007\317\243\000\033\007\317\244\000\033\007\317\245\000\033\007\317\247\000\033\007\317\250\000\033\007\317\251\000\033\007\317\252\000\033\007\317\253\000\033\007\317\254\000\033\007\317\255\000\033\007\317\256\000\033\007\317\257\000\033\007\317\260\000\033\007\317\261\000\033\007\317\262\000\033\007\317\264\000\033\007\317\265\000"},
+    {0x144A0,32,"\033\007\317\266\000\033\007\317\267\000\033\007\317\270\000\033\007\317\271\000\033\007\317\272\000\033\007\317\273\000\033\007\317\274\000\033\007\317\275\000\033\007\317\276\000\033\007\317\277\000\033\007\317\300\000\033\007\317\301\000\033\007\317\302\000\033\007\317\303\000\033\007\317\304\000\033\007\317\305\000\033\007\317\306\000\033\007\317\307\000\033\007\317\310\000\033\007\317\311\000\033\007\317\312\000\033\007\317\313\000\033\007\317\314\000\033\007\317\315\000\033\007\317\316\000\033\007\317\317\000\033\007\317\320\000\033\007\317\321\000\033\007\317\322\000\033\007\317\323\000\033\007\317\324\000\033\007\317\325\000"},
+    {0x144C0,32,"\033\007\317\326\000\033\007\317\327\000\033\007\317\330\000\033\007\317\331\000\033\007\317\332\000\033\007\317\333\000\033\007\317\334\000\033\007\317\335\000\033\007\317\336\000\033\007\317\337\000\033\007\317\340\000\033\007\317\341\000\033\007\317\342\000\033\007\317\343\000\033\007\317\344\000\033\007\317\345\000\033\007\317\346\000\033\007\317\347\000\033\007\317\350\000\033\007\317\351\000\033\007\317\352\000\033\007\317\353\000\033\007\317\354\000\033\007\317\355\000\033\007\317\356\000\033\007\317\357\000\033\007\317\360\000\033\007\317\361\000\033\007\317\362\000\033\007\317\363\000\033\007\317\364\000\033\007\317\365\000"},
+    {0x144E0,32,"\033\007\317\366\000\033\007\317\367\000\033\007\317\370\000\033\007\317\371\000\033\007\317\372\000\033\007\317\373\000\033\007\317\374\000\033\007\317\375\000\033\007\317\376\000\033\007\317\377\000\033\007\320\001\000\033\007\320\002\000\033\007\320\003\000\033\007\320\004\000\033\007\320\005\000\033\007\320\006\000\033\007\320\007\000\033\007\320\010\000\033\007\320\011\000\033\007\320\012\000\033\007\320\013\000\033\007\320\014\000\033\007\320\015\000\033\007\320\016\000\033\007\320\017\000\033\007\320\020\000\033\007\320\021\000\033\007\320\022\000\033\007\320\023\000\033\007\320\024\000\033\007\320\025\000\033\007\320\026\000"},
+    {0x14500,32,"\033\007\320\027\000\033\007\320\030\000\033\007\320\031\000\033\007\320\032\000\033\007\320\033\000\033\007\320\034\000\033\007\320\035\000\033\007\320\036\000\033\007\320\037\000\033\007\320 \000\033\007\320!\000\033\007\320\042\000\033\007\320#\000\033\007\320$\000\033\007\320%\000\033\007\320&\000\033\007\320'\000\033\007\320(\000\033\007\320)\000\033\007\320*\000\033\007\320+\000\033\007\320,\000\033\007\320-\000\033\007\320.\000\033\007\320/\000\033\007\3200\000\033\007\3201\000\033\007\3202\000\033\007\3203\000\033\007\3204\000\033\007\3205\000\033\007\3206\000"},
+    {0x14520,32,"\033\007\3207\000\033\007\3208\000\033\007\3209\000\033\007\320:\000\033\007\320;\000\033\007\320<\000\033\007\320=\000\033\007\320>\000\033\007\320\077\000\033\007\320@\000\033\007\320A\000\033\007\320B\000\033\007\320C\000\033\007\320D\000\033\007\320E\000\033\007\320F\000\033\007\320G\000\033\007\320H\000\033\007\320I\000\033\007\320J\000\033\007\320K\000\033\007\320L\000\033\007\320M\000\033\007\320N\000\033\007\320O\000\033\007\320P\000\033\007\320Q\000\033\007\320R\000\033\007\320S\000\033\007\320T\000\033\007\320U\000\033\007\320V\000"},
+    {0x14540,32,"\033\007\320W\000\033\007\320X\000\033\007\320Y\000\033\007\320Z\000\033\007\320[\000\033\007\320\134\000\033\007\320]\000\033\007\320^\000\033\007\320_\000\033\007\320`\000\033\007\320a\000\033\007\320b\000\033\007\320c\000\033\007\320d\000\033\007\320e\000\033\007\320f\000\033\007\320g\000\033\007\320h\000\033\007\320j\000\033\007\311\252\000\033\007\311\253\000\033\007\311\254\000\033\007\311\255\000\033\007\311\256\000\033\007\311\257\000\033\007\311\260\000\033\007\311\261\000\033\007\320k\000\033\007\311\262\000\033\007\311\263\000\033\007\311\264\000\033\007\311\265\000"},
+    {0x14560,32,"\033\007\320n\000\033\007\311\266\000\033\007\311\267\000\033\007\311\270\000\033\007\311\271\000\033\007\311\272\000\033\007\311\273\000\033\007\311\274\000\033\007\311\275\000\033\007\311\276\000\033\007\311\277\000\033\007\311\300\000\033\007\311\301\000\033\007\311\302\000\033\007\311\303\000\033\007\311\304\000\033\007\311\305\000\033\007\320r\000\033\007\311\306\000\033\007\311\307\000\033\007\320t\000\033\007\320u\000\033\007\320v\000\033\007\311\310\000\033\007\311\311\000\033\007\311\312\000\033\007\311\313\000\033\007\320w\000\033\007\320x\000\033\007\320y\000\033\007\311\314\000\033\007\311\315\000"},
+    {0x14580,32,"\033\007\311\316\000\033\007\311\317\000\033\007\311\320\000\033\007\311\321\000\033\007\311\322\000\033\007\311\323\000\033\007\311\324\000\033\007\311\325\000\033\007\311\326\000\033\007\311\327\000\033\007\311\330\000\033\007\311\331\000\033\007\311\332\000\033\007\311\333\000\033\007\311\334\000\033\007\311\335\000\033\007\311\336\000\033\007\311\337\000\033\007\311\340\000\033\007\311\341\000\033\007\311\342\000\033\007\320z\000\033\007\311\343\000\033\007\311\344\000\033\007\311\345\000\033\007\311\346\000\033\007\311\347\000\033\007\320{\000\033\007\311\350\000\033\007\311\351\000\033\007\311\352\000\033\007\311\353\000"},
+    {0x145A0,32,"\033\007\320|\000\033\007\311\354\000\033\007\311\355\000\033\007\311\356\000\033\007\320}\000\033\007\320~\000\033\007\320\177\000\033\007\320\200\000\033\007\320\201\000\033\007\320\202\000\033\007\320\203\000\033\007\320\204\000\033\007\320\205\000\033\007\320\206\000\033\007\320\207\000\033\007\320\210\000\033\007\320\211\000\033\007\320\212\235\300\037\302d\000\033\007\320\213\000\033\007\320\214\000\033\007\320\215\000\033\007\320\216\000\033\007\320\217\000\033\007\320\220\000\033\007\320\221\000\033\007\320\222\000\033\007\320\223\000\033\007\320\224\000\033\007\320\225\000\033\007\320\226u\000\033\007\320\227\000\033\007\320\230\000"},
+    {0x145C0,32,"\033\007\320\231\000\033\007\320\232\000\033\007\320\233\000\033\007\320\234\000\033\007\320\235\000\033\007\320\237\000\033\007\320\241\000\033\007\320\243\000\033\007\320\245\000\033\007\320\247\000\033\007\320\251\000\033\007\320\253\000\033\007\320\255\000\033\007\320\257\000\033\007\320\261\303\266\303\334+\000\033\007\320\263\301l\303\334+\000\033\007\320\264\000\033\007\320\266\000\033\007\320\270\000\033\007\320\272\000\033\007\320\274\000\033\007\320\276\000\033\007\320\300\000\033\007\320\302\000\033\007\320\304\000\033\007\320\305\000\033\007\320\306\000\033\007\320\307\000\033\007\320\310\000\033\007\320\311\000\033\007\320\312\000\033\007\320\313\000"},
+    {0x145E0,32,"\033\007\320\314\000\033\007\320\315\000\033\007\320\316\000\033\007\320\317\000\033\007\320\320\000\033\007\320\321\000\033\007\320\322\000\033\007\320\323\000\033\007\320\324\000\033\007\320\325\000\033\007\320\326\000\033\007\320\327\000\033\007\320\330\000\033\007\320\331\000\033\007\320\332\000\033\007\320\333\000\033\007\320\334\000\033\007\320\335\000\033\007\320\336\000\033\007\320\337\000\033\007\320\340\000\033\007\320\341\000\033\007\320\342\000\033\007\320\343\000\033\007\320\344\000\033\007\320\345\000\033\007\320\346\000\033\007\320\347\000\033\007\320\350\000\033\007\320\351\000\033\007\320\352\000\033\007\320\353\000"},
+    {0x14600,32,"\033\007\320\354\000\033\007\320\355\000\033\007\320\356\000\033\007\320\357\000\033\007\320\360\000\033\007\320\361\000\033\007\320\362\000\033\007\320\363\000\033\007\320\364\000\033\007\320\365\000\033\007\320\366\000\033\007\320\367\000\033\007\320\370\000\033\007\320\371\000\033\007\320\372\000\033\007\320\373\000\033\007\320\374\000\033\007\320\375\000\033\007\320\376\000\033\007\320\377\000\033\007\321\001\000\033\007\321\002\000\033\007\321\003\000\033\007\321\004\000\033\007\321\005\000\033\007\321\006\000\033\007\321\007\000\033\007\321\010\000\033\007\321\011\000\033\007\321\012\000\033\007\321\013\000\033\007\321\014\000"},
+    {0x14620,32,"\033\007\321\015\000\033\007\321\016\000\033\007\321\017\000\033\007\321\020\000\033\007\321\021\000\033\007\321\022\000\033\007\321\023\000\033\007\321\024\000\033\007\321\025\000\033\007\311\357\000\033\007\311\360\000\033\007\311\361\000\033\007\311\362\000\033\007\311\363\000\033\007\311\364\000\033\007\321\026\000\033\007\311\365\000\033\007\311\366\000\033\007\311\367\000\033\007\311\370\000\033\007\311\371\000\033\007\311\372\000\033\007\321\027\000\033\007\311\373\000\033\007\311\374\000\033\007\321\030\000\033\007\321\031\000\033\007\321\032\000\033\007\311\375\000\033\007\311\376\000\033\007\321\033\000\033\007\311\377\000"},
+    {0x14640,7,"\033\007\312\001\000\033\007\312\002\000\033\007\312\003\000\033\007\312\004\000\033\007\312\005\000\033\007\312\006\000\033\007\312\007\000"},
+    {0x16800,32,"\030\001\3008\314\351\303\340\000\030\001\3008\335\213\335\002\000\030\001\3008\305\222\303\340\315g\000\030\001\3008\305\222\303\340\315f\000\030\001\3008\304\305\303\340\000\030\001\3008\3545\000\030\001\3008\316\213\303\340\000\030\001\3008\310j\303\340\000\030\001\3008\354\020\230\304\313\000\030\001\3008\305\222\230\304\313\315g\000\030\001\3008\305\222\230\304\313\315f\000\030\001\3008\343~\000\030\001\3008\301\313\310#\000\030\001\3008\345_\000\030\001\3008\343\201\000\030\001\3008\343\233\000\030\001\3008\344\264\000\030\001\3008\353\247\000\030\001\3008\346T\000\030\001\3008\341\012\000\030\001\3008\345\344\000\030\001\3008\306\361\000\030\001\3008\345\210\000\030\001\3008\342\033\000\030\001\3008\310\024\306`\000\030\001\3008\306\217\343\367\000\030\001\3008\343|\000\030\001\3008\347\264\000\030\001\3008\335\313\000\030\001\3008\347\216\000\030\001\3008\302\300\314\344\000\030\001\3008\346\267\3102\000"},
+    {0x16820,32,"\030\001\30081\311V\314\314\000\030\001\3008\335\312\000\030\001\3008\306\217\315\004\000\030\001\3008\354l\000\030\001\3008\344\004\000\030\001\3008\343\363\000\030\001\3008\344w\000\030\001\3008\340\313\000\030\001\3008\230\310\022\000\030\001\3008\304\310\310\022\000\030\001\3008\347\345\000\030\001\3008\343\200\000\030\001\3008\345\265\000\030\001\3008\315\201\000\030\001\3008\357\016\000\030\001\3008\342\243\000\030\001\3008\354\242\000\030\001\3008\356'\000\030\001\3008\343\203\000\030\001\3008\304<\000\030\001\3008\345*\000\030\001\3008\341\236\000\030\001\3008\344v\000\030\001\3008\3549\000\030\001\3008\342\214\000\030\001\3008\334\342\000\030\001\3008\351\265\000\030\001\3008\341\202\000\030\001\3008\354\245\000\030\001\3008\305f\350\010\000\030\001\3008\354\023\000\030\001\3008\306\217\000"},
+    {0x16840,32,"\030\001\3008\310\316\310b\317$\000\030\001\3008\315\027\344o\000\030\001\3008\347t\000\030\001\3008\314\373\000\030\001\3008\357\254\000\030\001\3008\310S\000\030\001\3008\314\212\000\030\001\3008\314\365\000\030\001\3008\314\224\000\030\001\3008\310h\000\030\001\3008\316y\000\030\001\3008\310\341\000\030\001\3008\3157\000\030\001\3008\315\002\000\030\001\3008\310\042\000\030\001\3008\302\245\000\030\001\3008\340\330\000\030\001\3008\310a\000\030\001\3008\304\023\000\030\001\3008\301\265\000\030\001\3008\310P\000\030\001\3008\314\321\000\030\001\3008\343\305\000\030\001\300\303\346G\000\030\001\300\303\301\313\343\177\000\030\001\300\303\354V\000\030\001\300\303\303\240\301\313\000\030\001\300\303\314M\306\220\000\030\001\300\303\305i\343}\000\030\001\300\303\3415\000\030\001\300\303\361\276\000\030\001\300\303\343\304\000"},
+    {0x16860,32,"\030\001\300\303\340\320\000\030\001\300\303\347\322\000\030\001\300\303\361\227\310\022\000\030\001\300\303\300h\310b\306\222\000\030\001\300\303\346S\354\014\000\030\001\300\303\306\207\345\303\000\030\001\300\303\335\315\000\030\001\300\303\315i\000\030\001\300\303\301\313\315\003\000\030\001\300\303\315\357\345\305\000\030\001\300\303\354\013\000\030\001\300\303\303\340\316z\000\030\001\300\303\310)\343\303\000\030\001\300\303\302\245\306\220\000\030\001\300\303\341\015\000\030\001\300\303\335\314\000\030\001\300\303\341\020\000\030\001\300\303\341\331\000\030\001\300\303\347\262\000\030\001\300\303\360n\000\030\001\300\303\345\207\314\302\000\030\001\300\303\345n\310,\000\030\001\300\303\3613\000\030\001\300\303\352M\000\030\001\300\303\355\330\000\030\001\300\303\343\364\000\030\001\300\303\314\346\000\030\001\300\303\314\346\300#\000\030\001\300\303\343\374\000\030\001\300\303\316@\000\030\001\300\303\343\310\000\030\001\300\303\344u\000"},
+    {0x16880,32,"\030\001\300\303\346\210\000\030\001\300\303\350\213\000\030\001\300\303\3102\345m\000\030\001\300\303\334\317\000\030\001\300\303\343\317\000\030\001\300\303\304-\000\030\001\300\303\341\006\000\030\001\300\303\251\345\310\000\030\001\300\303\251\345\330\000\030\001\300\303\310\024\000\030\001\300\303\314\342\000\030\001\300\303\346B\000\030\001\300\303\251\000\030\001\300\303\341\077\000\030\001\300\303\310W\000\030\001\300\021\314\351\310#\000\030\001\300\021\310j\000\030\001\300\021\317$\000\030\001\300\021\360\346\000\030\001\300\021\310S\000\030\001\300\021\345.\000\030\001\300\021\345\201\000\030\001\300\021\335\306\000\030\001\300\021\343\306\000\030\001\300\021\335\207\000\030\001\300\021\346\225\344P\314\244\000\030\001\300\021\346W\310)\000\030\001\300\021\314\226\000\030\001\300\021\350\042\000\030\001\300\021\345:\000\030\001\300\021\304\302\324\321\000\030\001\300\021\341\017\000"},
+    {0x168A0,32,"\030\001\300\021\335\305\000\030\001\300\021\341\011\000\030\001\300\021\301)\344\243\000\030\001\300\021\346\253\000\030\001\300\021\343\315\000\030\001\300\021\346C\000\030\001\300\021\310)\000\030\001\300\021\361\275\000\030\001\300\021\341\177\000\030\001\300\021\306P\000\030\001\300\021\310\306\000\030\001\300\021\3453\000\030\001\300\021\355\332\000\030\001\300\021\314\372\000\030\001\300\021\316\213\361\363\000\030\001\300\021\355>\000\030\001\300\021\345r\306\222\000\030\001\300\021\360o\000\030\001\300\021\345\001\000\030\001\300\021\251\341\007\000\030\001\300\021\315\004\000\030\001\300\021\345w\000\030\001\300\021\310\015\000\030\001\300\021\343\312\000\030\001\300\021\344\005\000\030\001\300\021\346Q\000\030\001\300\021\356(\000\030\001\300\021\345u\000\030\001\300\021\313\134\000\030\001\300\021\345/\000\030\001\300\021\346A\000\030\001\300\021\346D\000"},
+    {0x168C0,32,"\030\001\300\021\324\230\000\030\001\300\021\360m\000\030\001\300\021\343\307\000\030\001\300\021\301\337\000\030\001\300\021\310\134\000\030\001\300\021\300h\000\030\001\300\021\356y\000\030\001\300\021\346N\310W\000\030\001\300\021\345\306\000\030\001\300\021\304<\000\030\001\300\021\310V\000\030\001\300\021\314\212\000\030\001\300\021\343\314\000\030\001\300\021\301\265\000\030\001\300\021\306`\000\030\001\300\021\314\365\000\030\001\300\021\310W\000\030\001\300\021\3619\000\030\001\300\021\345t\000\030\001\300\021\346K\000\030\001\300\021\346P\000\030\001\300\021\310\006\314\373\000\030\001\300\021\346M\000\030\001\300\021\314\325\000\030\001\300\021\251\315\003\000\030\001\300\021\305\003\000\030\001\300\021\310K\000\030\001\300\021\3546\000\030\001\300\021\353\245\000\030\001\300\021\310(\000\030\001\300\021\310#\000\030\001\300\021\314\224\000"},
+    {0x168E0,32,"\030\001\300\021\341\016\000\030\001\300\021\343\311\000\030\001\300\021\313\371\000\030\001\300\021\304\302\350\005\000\030\001\300\021\317&\000\030\001\300\021\314\366\000\030\001\300\021\314\251\000\030\001\300\021\314\277\000\030\001\300\021\315\362\000\030\001\300\021\304\265\3143\000\030\001\300\021\304\265\334\276\000\030\001\300\021\345a\000\030\001\300\021\314\321\000\030\001\300\021\342t\000\030\001\300\021\315d\000\030\001\300\021\304\323\000\030\001\300\021\304b\000\030\001\243\343\316\000\030\001\243\316\356\000\030\001\243\304\313\000\030\001\243\303\340\000\030\001\243\345\313\000\030\001\243\342X\000\030\001\243\345\311\000\030\001\243\346E\000\030\001\243\345j\000\030\001\243\306\222\000\030\001\243\3612\000\030\001\243\345\212\000\030\001\243\306\326\000\030\001\243\345\200\000\030\001\243\341\010\000"},
+    {0x16900,32,"\030\001\243\356&\000\030\001\243\354\011\000\030\001\243\345\304\000\030\001\243\316@\000\030\001\243\304<\000\030\001\243\361\225\000\030\001\243\341\235\000\030\001\243\315\326\000\030\001\243\343\372\000\030\001\243\3450\000\030\001\243\343\221\000\030\001\243\3102\000\030\001\243\353\246\000\030\001\243\305\314\000\030\001\243\345\307\000\030\001\243\341\013\343\313\000\030\001\243\345\204\000\030\001\243\301\313\000\030\001\243\313|\000\030\001\243\345\214\000\030\001\243\334\316\000\030\001\243\310L\000\030\001\243\344\015\000\030\001\243\342F\000\030\001\243\345;\000\030\001\243\344p\000\030\001\243\344\011\000\030\001\243\350\232\000\030\001\243\344\013\000\030\001\243\343\375\000\030\001\243\302\354\000\030\001\243\346I\000"},
+    {0x16920,32,"\030\001\243\304\302\000\030\001\243\341\256\000\030\001\243\310h\000\030\001\243\316y\000\030\001\243\310\341\000\030\001\243\317&\000\030\001\243\313\371\000\030\001\243\351)\000\030\001\243\356\021\000\030\001\243\345\203\000\030\001\243\343\370\000\030\001\243\346J\000\030\001\243\341\014\000\030\001\243\315e\000\030\001\243\347\353\000\030\001\243\346\235\000\030\001\243\310\024\000\030\001\243\314\342\000\030\001\243\343\373\000\030\001\243\345z\000\030\001\243\361\370\000\030\001\243\3028\000\030\001\243\317%\000\030\001\243\314\325\000\030\001\243\306\220\000\030\001\243\355<\000\030\001\243\314\034\000\030\001\243\345p\000\030\001\243\345\206\000\030\001\243\316\272\000\030\001\243\314\244\000\030\001\243\341\242\000"},
+    {0x16940,32,"\030\001\243\346L\000\030\001\243\356%\000\030\001\243\343\202\000\030\001\243\345k\000\030\001\243\342G\000\030\001\243\345v\000\030\001\243\310b\000\030\001\243\314\372\000\030\001\243\313~\000\030\001\243\301\355\000\030\001\243\306\277%\000\030\001\243\311\004\000\030\001\243\316\222\000\030\001\243\302\245\000\030\001\243\306\311\000\030\001\243\3147\000\030\001\243\310/\000\030\001\243\261\000\030\001\243\306\361\000\030\001\243\301!\000\030\001\243\306\330\000\030\001\243\315\360\000\030\001\243\306d\000\030\001\243\301e\000\030\001\243\302\215\000\030\001\243\310c\000\030\001\243\303\227\000\030\001\243\301L\000\030\001\243\310\316\000\030\001\243\350\217\000\030\001\243\314\302\000\030\001\243\306q\000"},
+    {0x16960,32,"\030\001\243\306\277\305n\000\030\001\243\302&\000\030\001\243\315\006\000\030\001\243\304\302\201\000\030\001\243\352g\000\030\001\243\306 \000\030\001q\310K\000\030\001q\356\235\000\030\001q\314\226\000\030\001q\310\015\000\030\001q\360\227\000\030\001q\342\225\000\030\001q\306\233\000\030\001q\316!\000\030\001q\3517\000\030\001q\346H\000\030\001q\345\077\000\030\001q\310\234\000\030\001q\304\134\000\030\001q\314\350\000\030\001q\341\201\000\030\001q\317\003\000\030\001q\304O\000\030\001q\314\344\000\030\001q\3157\000\030\001q\304\363\000\030\001q\310\006\000\030\001q\314M\000\030\001q\315\002\000\030\001q\314\354\000\030\001q\310\042\000\030\001q\345\205\000"},
+    {0x16980,32,"\030\001q\345\216\000\030\001q\346F\000\030\001q\351\232\000\030\001q\314\366\000\030\001q\347\320\000\030\001q\306\315\000\030\001q\345y\000\030\001q\314\245\000\030\001q\335\317\000\030\001q\345\202\000\030\001q\314\364\000\030\001q\305f\000\030\001q\314N\000\030\001q\345l\000\030\001q\3457\000\030\001q\355\336\306\220\000\030\001q\303\240\000\030\001q\350\207\000\030\001q\306\205\354\236\000\030\001q\345s\306\222\000\030\001q\361\304\000\030\001q\335\316\000\030\001q\357\015\000\030\001q\361\272\000\030\001q\3029\000\030\001q\357\024\000\030\001q\341\005\000\030\001q\355=\000\030\001q\316z\000\030\001q\360l\000\030\001q\360\376\000\030\001q\310\013\000"},
+    {0x169A0,32,"\030\001q\302\312\000\030\001q\355\331\000\030\001q\335\301\000\030\001q\345f\000\030\001q\354\012\000\030\001q\344\010\000\030\001q\306w\000\030\001q\346\247\000\030\001q\345\345\000\030\001q\335\211\000\030\001q\305\275\000\030\001q\341\227\000\030\001q\317\015\000\030\001q\302\245\325\215\000\030\001q\311T\000\030\001q\343\371\000\030\001q\3452\000\030\001q\350\007\000\030\001q\361\364\000\030\001q\342E\000\030\001q\313\134\000\030\001q\335\212\000\030\001q\345\213\000\030\001q\304<\000\030\001q\314\211\000\030\001q\345\177\000\030\001q\335\311\000\030\001q\301\026\000\030\001q\346Y\000\030\001q\347\352\000\030\001q\361\274\000\030\001q\345o\000"},
+    {0x169C0,32,"\030\001q\302\245\301\254\000\030\001q\346\272\000\030\001q\350I\000\030\001q\314\251\000\030\001q\335 \000\030\001q\314\314\000\030\001q\314\277\000\030\001q\313~\000\030\001q\303\207;\000\030\001q\344\265\000\030\001q\350\202\000\030\001q\345\211\000\030\001q\306`\000\030\001q\350\012\000\030\001q\306\217\000\030\001q\361\273\000\030\001q\345x\000\030\001q\230\315L\000\030\001q\303\207\307V\000\030\001q\307\262\000\030\001q\305y\000\030\001q\025\000\030\001q\316\222\000\030\001q6\000\030\001q;\000\030\001q\342\034\000\030\001q\230\3507\000\030\001q\304Y\000\030\001q\355\360\000\030\001q\306\205\314\310\304\252\000\030\001q\315\362\000\030\001q\361\277\000"},
+    {0x169E0,32,"\030\001q\345\222\000\030\001q\361\361\000\030\001q\307\036\355f\000\030\001q\307\036\307q\000\030\001q\311V\000\030\001q\361\366\000\030\001q\313\372\000\030\001q\310\204\000\030\001q\305y\3340\000\030\001q\315\200\000\030\001q\311H\000\030\001q\304-\000\030\001q\304\023\000\030\001q\301\265\000\030\001q\301|\000\030\001q\310\254\000\030\001q\304\330\000\030\001q\345\223\000\030\001q\300c\000\030\001q\303#\000\030\001q\310\316\000\030\001q\303\207\351_\000\030\001q\256\000\030\001q\300\325\000\030\001q\306q\000\030\001q\301\303\000\030\001q\303\032\000\030\001q\251\000\030\001q\314\217\000\030\001q\356$\000\030\001q\301\323\000\030\001q\302\300\000"},
+    {0x16A00,32,"\030\001q\300H\000\030\001q\334\272\000\030\001q\335\323\000\030\001\300\313[\000\030\001\300\3131\000\030\001\300\313\301\355\000\030\001\300\313\301\017\000\030\001\300\313\305\233\000\030\001\300\313\311\004\000\030\001\300\313\302\245\000\030\001\300\313\252\000\030\001\300\313\306\311\000\030\001\300\313\315\260\000\030\001\300\313\310/\000\030\001\300\313\304Y\000\030\001\300\313\306\205\000\030\001\300\313\310\134\000\030\001\300\313\261\000\030\001\300\313\306\361\000\030\001\300\313\306\330\000\030\001\300\313\301\340\000\030\001\300\313\310\306\000\030\001\300\313\306d\000\030\001\300\313\304<\000\030\001\300\313\315\010\000\030\001\300\313\301e\000\030\001\300\313\314\371\000\030\001\300\313\307\036\000\030\001\300\313\302\215\000\030\001\300\313\264\000\030\001\300\313\310a\000\030\001\300\313\310\204\000"},
+    {0x16A20,25,"\030\001\300\313\310c\000\030\001\300\313\311H\000\030\001\300\313\303\227\000\030\001\300\313\301\337\000\030\001\300\313\301L\000\030\001\300\313\310\254\000\030\001\300\313\304\265\000\030\001\300\313\314\352\000\030\001\300\313\305w\000\030\001\300\313\303#\000\030\001\300\313\310\234\000\030\001\300\313\307\262\000\030\001\300\313\300q\000\030\001\300\313\300\227\000\030\001\300\313\306q\000\030\001\300\313\301\303\000\030\001\300\313\314\225\000\030\001\300\313\306\277\000\030\001\300\313\251\000\030\001\300\313\301\361\000\030\001\300\313\304\302\000\030\001\300\313\304b\000\030\001\300\313\305_\000\030\001\300\313\315\323\000\030\001\300\313\360\241\000"},
+    {0x16A40,31,"\301\014\001\265\000\301\014\001\306\211\000\301\014\001\301i\000\301\014\001\306}\000\301\014\001\300\042\000\301\014\001\300\001\000\301\014\001\025\000\301\014\001\301\307\000\301\014\001\313\376\000\301\014\001\336h\000\301\014\001\331\330\000\301\014\001\305\365\000\301\014\001\340\365\000\301\014\001\300\350\000\301\014\001\310\042\000\301\014\001\310[\000\301\014\001\230\000\301\014\001\300\354\000\301\014\0016\000\301\014\001\301\267\000\301\014\001\304\341\000\301\014\001\3562\000\301\014\001\307\230\000\301\014\001\300q\000\301\014\0019\000\301\014\001\301\303\000\301\014\001\314+\000\301\014\001\252\000\301\014\001\336U\000\301\014\001\302d\000\301\014\001\356\025\000"},
+    {0x16A60,10,"\301\014\017\300%\000\301\014\0172\000\301\014\0177\000\301\014\017B\000\301\014\017O\000\301\014\017V\000\301\014\017v\000\301\014\017\201\000\301\014\017u\000\301\014\017\211\000"},
+    {0x16A6E,32,"\301\014\301z\000\301\0144\301z\000\3001\001\347d\000\3001\001\347(\000\3001\001\310q\000\3001\001\306\232\000\3001\001\312F\000\3001\001\305\321\000\3001\001\305\016\000\3001\001\312C\000\3001\001\360\260\000\3001\001\3600\000\3001\001\360\237\000\3001\001\360\252\000\3001\001\3053\000\3001\001\305.\000\3001\001\3341\000\3001\001\306\034\000\3001\001\340T\000\3001\001\307\333\000\3001\001\307\346\000\3001\001\313\331\000\3001\001\357\315\000\3001\001\307\012\000\3001\001\357\264\000\3001\001\357\313\000\3001\001\323\013\000\3001\001\323\010\000\3001\001\323\012\000\3001\001\312B\000\3001\001\357\233\000\3001\001\357\223\000"},
+    {0x16A8E,32,"\3001\001\357\225\000\3001\001\357\232\000\3001\0013\302\022\000\3001\001\253\316\317\000\3001\001\300w\316\320\000\3001\001\300w\312B\000\3001\001\357\214\000\3001\001\316\320\000\3001\001\357\220\000\3001\001\316\317\000\3001\001\357\231\000\3001\001\357\226\000\3001\001\357\227\000\3001\001\357\230\000\3001\001\344\272\000\3001\001\314\227\000\3001\001\344\211\000\3001\001\344\266\000\3001\001[\000\3001\001\300\223\000\3001\001\300\005\000\3001\001\300c\000\3001\001\271\000\3001\001\264\000\3001\001\300q\000\3001\001\230\000\3001\001\300\225\000\3001\001\300\306\000\3001\001\300\042\000\3001\001\251\000\3001\001\256\000\3001\001\203\000"},
+    {0x16AAE,17,"\3001\001\252\000\3001\001\313\270\000\3001\001\265\000\3001\001\300\001\000\3001\001\235\000\3001\001\304\312\000\3001\001\300j\000\3001\001\300m\000\3001\001\301\201\000\3001\001\300\361\000\3001\001\337f\000\3001\001\300\254\000\3001\001\302\222\000\3001\001\301\026\000\3001\001\300\353\000\3001\001\300\220\000\3001\001\300\341\000"},
+    {0x16AC0,10,"\3001\017\300%\000\3001\0172\000\3001\0177\000\3001\017B\000\3001\017O\000\3001\017V\000\3001\017v\000\3001\017\201\000\3001\017u\000\3001\017\211\000"},
+    {0x16AD0,30,"\301\035\301>\001\334\042\000\301\035\301>\001[\000\301\035\301>\001\301\363\000\301\035\301>\001\301\026\000\301\035\301>\001\306v\000\301\035\301>\001\317\030\000\301\035\301>\001\313e\000\301\035\301>\001\332C\000\301\035\301>\001\341}\000\301\035\301>\001\303\022\000\301\035\301>\001\337{\000\301\035\301>\001\300q\000\301\035\301>\001\303\004\000\301\035\301>\001\307\276\000\301\035\301>\001\302\013\000\301\035\301>\001\303u\000\301\035\301>\001\357\312\000\301\035\301>\001C\000\301\035\301>\001\300\042\000\301\035\301>\001\304i\000\301\035\301>\001\361\261\000\301\035\301>\001\230\000\301\035\301>\001\360\335\000\301\035\301>\001\025\000\301\035\301>\0016\000\301\035\301>\001\300\354\000\301\035\301>\0011\000\301\035\301>\001\301\017\000\301\035\301>\0019\000\301\035\301>\001;\000"},
+    {0x16AF0,6,"\301\035\301> \217\212\000\301\035\301> \210\212\000\301\035\301> \304A\212\000\301\035\301> \342\240\212\000\301\035\301> \336\275\212\000\301\035\301>\300\324\300k\000"},
+    {0x16B00,32,"\225Z\021\340\367\000\225Z\021\340\372\000\225Z\021\3412\000\225Z\021\341G\000\225Z\021\340\344\000\225Z\021\340\347\000\225Z\021\341\226\000\225Z\021\341\252\000\225Z\021\340\366\000\225Z\021\341\021\000\225Z\021\340\314\000\225Z\021\340\316\000\225Z\021\341p\000\225Z\021\341s\000\225Z\021\340\351\000\225Z\021\340\353\000\225Z\021\341\224\000\225Z\021\341\225\000\225Z\021\341h\000\225Z\021\341z\000\225Z\021\3410\000\225Z\021\3411\000\225Z\021\313\353\000\225Z\021\340\350\000\225Z\021\341\260\000\225Z\021\341\263\000\225Z\021\340\300\000\225Z\021\340\307\000\225Z\3003\360-\000\225Z\3003\346V\000\225Z\3003\342\042\000\225Z\3003\300\266\000"},
+    {0x16B20,32,"\225Z\3003\345\374\000\225Z\3003\351=\000\225Z\3003\345\343\000\225Z\3003\350\274\000\225Z\3003\361\250\000\225Z\3003\336\307\000\225Z\3003\343\273\000\225Z\3003\3253\000\225Z\3003\345(\000\225Z\3003\337\005\000\225Z\3003\3500\000\225Z\3003\346R\000\225Z\3003\345\004\000\225Z\3003\300d\000\225Z\3003\361N\000\225Z\3003\324\367\000\225Z+\302Z\357\017\000\225Z+\302Z\301\273\000\225Z+\302Z\341\004\000\225Z+\302Z\341\030\000\225Z+\302Z\355\077\000\225Z+\302Z\337%\000\225Z+\302Z\355\370\000\225Z\002\304h\356C\000\225Z\002\304h\356\356\325\024\000\225Z\002\302Z\3257\000\225Z\002\304h\3568\000\225Z\002\304h\334\304\000\225Z\002\307\031\346[\000\225Z\002\307\031\301\230\000\225Z\002\307\031\356\246\000\225Z\002\307\031\334\260\000"},
+    {0x16B40,6,"\225Z\002\304h\352\223\000\225Z\002\314\233\355;\000\225Z\002\304h\3464\000\225Z\002\307\332\317\013\000\225Z\002\361O\000\225Z\002\302Z\356\363\310\264\000"},
+    {0x16B50,10,"\225Z\017\300%\000\225Z\0172\000\225Z\0177\000\225Z\017B\000\225Z\017O\000\225Z\017V\000\225Z\017v\000\225Z\017\201\000\225Z\017u\000\225Z\017\211\000"},
+    {0x16B5B,7,"\225Z\036\303(\000\225Z\036\307\330\000\225Z\036\300H\304\014\000\225Z\036\304B\000\225Z\036\207\304B\000\225Z\036\300H\324N\000\225Z\036\356\276\000"},
+    {0x16B63,21,"\225Z\002\304h\342\244\000\225Z\002\361s\000\225Z\002\307\323\000\225Z\002\356=\307\323\000\225Z\002\362\203\356-\000\225Z\002\337\025\000\225Z\002\346'\000\225Z\002\361U\000\225Z\002\346X\000\225Z\002\304t\000\225Z\002\3574\325\025\000\225Z\002\314\233\356\354\000\225Z\002\302\077\000\225Z\002\342\231\000\225Z\002\344\255\000\225Z\002\302Z\336W\342\260\315\005\315\005\000\225Z\002\302Z\331V\356\360\000\225Z\002\302Z\316\307\000\225Z\002\302Z\316\307\325n\000\225Z\002\302Z\350\203\331\352\000\225Z\002\302Z\346-\356\243\000"},
+    {0x16B7D,19,"\225Z\302\010\002\356\357\000\225Z\302\010\002\361\260\000\225Z\302\010\002\342u\000\225Z\302\010\002\342$\000\225Z\302\010\002\361t\000\225Z\302\010\002\305]\000\225Z\302\010\002\336r\000\225Z\302\010\002\344\224\000\225Z\302\010\002\356B\000\225Z\302\010\002\356\353\000\225Z\302\010\002\347\360\000\225Z\302\010\002\341\023\000\225Z\302\010\002\336^\000\225Z\302\010\002\360\037\000\225Z\302\010\002\334\264\000\225Z\302\010\002\311L\000\225Z\302\010\002\356\366\000\225Z\302\010\002\341\261\000\225Z\302\010\002\360\251\000"},
+    {0x16E40,32,"\300)\006\001\261\000\300)\006\001d\000\300)\006\001\300\015\000\300)\006\001\300P\000\300)\006\001\312\077\000\300)\006\001\300 \000\300)\006\001\314\024\000\300)\006\001\300<\000\300)\006\001\300\007\000\300)\006\001\300\003\000\300)\006\001\300u\000\300)\006\001;\000\300)\006\001\300\011\000\300)\006\001\025\000\300)\006\001\300U\000\300)\006\0019\000\300)\006\001\077\000\300)\006\001\3005\000\300)\006\0011\000\300)\006\001\301)\000\300)\006\001p\000\300)\006\001\300\260\000\300)\006\001\306@\000\300)\006\001\315\022\000\300)\006\001\300>\000\300)\006\001\300\024\000\300)\006\001\301\007\000\300)\006\001\232\000\300)\006\001c\000\300)\006\0016\000\300)\006\001\300L\000\300)\006\001\300$\000"},
+    {0x16E60,32,"\300)\004\001\261\000\300)\004\001d\000\300)\004\001\300\015\000\300)\004\001\300P\000\300)\004\001\312\077\000\300)\004\001\300 \000\300)\004\001\314\024\000\300)\004\001\300<\000\300)\004\001\300\007\000\300)\004\001\300\003\000\300)\004\001\300u\000\300)\004\001;\000\300)\004\001\300\011\000\300)\004\001\025\000\300)\004\001\300U\000\300)\004\0019\000\300)\004\001\077\000\300)\004\001\3005\000\300)\004\0011\000\300)\004\001\301)\000\300)\004\001p\000\300)\004\001\300\260\000\300)\004\001\306@\000\300)\004\001\315\022\000\300)\004\001\300>\000\300)\004\001\300\024\000\300)\004\001\301\007\000\300)\004\001\232\000\300)\004\001c\000\300)\004\0016\000\300)\004\001\300L\000\300)\004\001\300$\000"},
+    {0x16E80,27,"\300)\017\300%\000\300)\0172\000\300)\0177\000\300)\017B\000\300)\017O\000\300)\017V\000\300)\017v\000\300)\017\201\000\300)\017u\000\300)\017\211\000\300)\036\300H\000\300)\036\302\340\000\300)\036\302\220\000\300)\036\304\012\000\300)\036\303\312\000\300)\036\303\015\000\300)\036\303`\000\300)\036\303\371\000\300)\036\303\200\000\300)\036\303\347\000\300)\0172\301\033\020\000\300)\0177\301\033\020\000\300)\017B\301\033\020\000\300)\300\251\000\300)\300\324\300k\000\300)\014\322]\000\300)\301\257\305\177\000"},
+    {0x16F00,32,"z\001\230\000z\001\300\042\000z\001\012\230\000z\001\306\251\000z\001\251\000z\001\314\246\000z\001\301\034\251\000z\001\301\026\000z\001\300\307\000z\001\360r\000z\001\265\000z\001\300\001\000z\001\012\300\334\000z\001\012\265\000z\001\300\334\000z\001\300\335\000z\001\256\000z\001\304\312\000z\001\012\301\002\000z\001\301\034\256\000z\001\301\002\000z\001\346\010\000z\001\252\000z\001\342\264\000z\001\303\330\000z\001\342S\000z\001\311\033\000z\001\332{\000z\001\356\202\000z\001\332|\000z\001[\000z\001\300\005\000"},
+    {0x16F20,32,"z\001\012[\000z\001\302\023\000z\001\350\271\000z\001\300c\000z\001\314\347\000z\001\301\034\300c\000z\001\203\000z\001\302\222\000z\001\300\361\000z\001\307\303\000z\001\356\364\000z\001\333\301\000z\001\300\225\000z\001\315\025\000z\001\302\217\000z\001\305-\000z\001\012\302\217\000z\001\012\305-\000z\001\303\233\302\217\000z\001\300j\000z\001\301&\000z\001\301\371\000z\001\362x\000z\001\301\201\000z\001\302\271\000z\001\012\301\201\000z\001\271\000z\001\300\341\000z\001\362w\000z\001\307%\000z\001\362\231\000z\001\301\034\307%\000"},
+    {0x16F40,11,"z\001\362\240\000z\001\362\232\000z\001\300q\000z\001\302\324\000z\001\303\213\000z\001\324\203\000z\001\355n\000z\001\333\300\000z\001\301=\000z\001\302\254\000z\001\351\326\000"},
+    {0x16F4F,32,"z\002\3003>x\000z\001\310H\000z\002\312<\000z\002\303\233\316\350\000z\002\303\233\312<\000z\021\002\025\000z\021\002\300/\000z\021\002\322T\000z\021\002\3016\000z\021\002\302\262\000z\021\0026\000z\021\002\300\354\000z\021\002\301\331\000z\021\002\300P\000z\021\0029\000z\021\002\300\276\000z\021\002\302\341\000z\021\002\3470\000z\021\002;\000z\021\002\306C\000z\021\002\313\302\000z\021\002\337\307\000z\021\002\307\345\000z\021\002\302L\000z\021\002\300T\000z\021\002\305R\000z\021\002\307\340\000z\021\0021\000z\021\002\304\367\000z\021\002\357\203\000z\021\002\357\204\000z\021\002\300l\000"},
+    {0x16F6F,25,"z\021\002\357\216\000z\021\002\357\247\000z\021\002\300$\000z\021\002\012\000z\021\002\301X\000z\021\002\312\023\000z\021\002\306\033\000z\021\002\302\213\306\033\000z\021\002\302z\000z\021\002\302\213\302z\000z\021\002\300L\000z\021\002\303\177\000z\021\002\300d\000z\021\002\303\354\000z\021\002\232\000z\021\002\302\022\000z\021\002\357\256\000z\021\002\361\365\000z\021\002\3473\000z\021\002\347/\000z\021\002\360\247\000z\021\002\313\312\000z\021\002\307\230\000z\021\002\340@\000z\021\002\307\014\000"},
+    {0x16F8F,17,"z\212&\000z\212\300\365&\000z\212'\000z\212:\000z\001\303e\000z\001\303\247\000z\001\304e\000z\001\303f\000z\001\306\374\000z\001\311\037\000z\001\306\375\000z\001\303\233\305\270\000z\001\303\233\303e\000z\001\303\233\304e\000z\001\303\233\303f\000z\001\303\233\306\374\000z\001\303\233\306\375\000"},
+    {0x16FE0,5,"\022\303\217+\000\346\204\303\217+\000%\3039S+\000%\3039\303\217+\000\341\034\004\236\303\204\000"},
+    {0x16FF0,2,"\316\344\301\033\315\240+\300m\000\316\344\301\033\315\240+\345\235\000"},
+    {0x18800,32,"\022\326\027\000\022\326\030\000\022\326\031\000\022\326\032\000\022\326\033\000\022\326\034\000\022\326\035\000\022\326\036\000\022\326\037\000\022\326 \000\022\326!\000\022\326\042\000\022\326#\000\022\326$\000\022\326%\000\022\326&\000\022\326'\000\022\326(\000\022\326)\000\022\326*\000\022\326+\000\022\326,\000\022\326-\000\022\326.\000\022\326/\000\022\3260\000\022\3261\000\022\3262\000\022\3263\000\022\3264\000\022\3265\000\022\3266\000"},
+    {0x18820,32,"\022\3267\000\022\3268\000\022\3269\000\022\326:\000\022\326;\000\022\326<\000\022\326=\000\022\326>\000\022\326\077\000\022\326@\000\022\326A\000\022\326B\000\022\326C\000\022\326D\000\022\326E\000\022\326F\000\022\326G\000\022\326H\000\022\326I\000\022\326J\000\022\326K\000\022\326L\000\022\326M\000\022\326N\000\022\326O\000\022\326P\000\022\326Q\000\022\326R\000\022\326S\000\022\326T\000\022\326U\000\022\326V\000"},
+    {0x18840,32,"\022\326W\000\022\326X\000\022\326Y\000\022\326Z\000\022\326[\000\022\326\134\000\022\326]\000\022\326^\000\022\326_\000\022\326`\000\022\326a\000\022\326b\000\022\326c\000\022\326d\000\022\326e\000\022\326f\000\022\326g\000\022\326h\000\022\326i\000\022\326j\000\022\326k\000\022\326l\000\022\326m\000\022\326n\000\022\326o\000\022\326p\000\022\326q\000\022\326r\000\022\326s\000\022\326t\000\022\326u\000\022\326v\000"},
+    {0x18860,32,"\022\326w\000\022\326x\000\022\326y\000\022\326z\000\022\326{\000\022\326|\000\022\326}\000\022\326~\000\022\326\177\000\022\326\200\000\022\326\201\000\022\326\202\000\022\326\203\000\022\326\204\000\022\326\205\000\022\326\206\000\022\326\207\000\022\326\210\000\022\326\211\000\022\326\212\000\022\326\213\000\022\326\214\000\022\326\215\000\022\326\216\000\022\326\217\000\022\326\220\000\022\326\221\000\022\326\222\000\022\326\223\000\022\326\224\000\022\326\225\000\022\326\226\000"},
+    {0x18880,32,"\022\326\227\000\022\326\230\000\022\326\231\000\022\326\232\000\022\326\233\000\022\326\234\000\022\326\235\000\022\326\236\000\022\326\237\000\022\326\240\000\022\326\241\000\022\326\242\000\022\326\243\000\022\326\244\000\022\326\245\000\022\326\246\000\022\326\247\000\022\326\250\000\022\326\251\000\022\326\252\000\022\326\253\000\022\326\254\000\022\326\255\000\022\326\256\000\022\326\257\000\022\326\260\000\022\326\261\000\022\326\262\000\022\326\263\000\022\326\264\000\022\326\265\000\022\326\266\000"},
+    {0x188A0,32,"\022\326\267\000\022\326\270\000\022\326\271\000\022\326\272\000\022\326\273\000\022\326\274\000\022\326\275\000\022\326\276\000\022\326\277\000\022\326\300\000\022\326\301\000\022\326\302\000\022\326\303\000\022\326\304\000\022\326\305\000\022\326\306\000\022\326\307\000\022\326\310\000\022\326\311\000\022\326\312\000\022\326\313\000\022\326\314\000\022\326\315\000\022\326\316\000\022\326\317\000\022\326\320\000\022\326\321\000\022\326\322\000\022\326\323\000\022\326\324\000\022\326\325\000\022\326\326\000"},
+    {0x188C0,32,"\022\326\327\000\022\326\330\000\022\326\331\000\022\326\332\000\022\326\333\000\022\326\334\000\022\326\335\000\022\326\336\000\022\326\337\000\022\326\340\000\022\326\341\000\022\326\342\000\022\326\343\000\022\326\344\000\022\326\345\000\022\326\346\000\022\326\347\000\022\326\350\000\022\326\351\000\022\326\352\000\022\326\353\000\022\326\354\000\022\326\355\000\022\326\356\000\022\326\357\000\022\326\360\000\022\326\361\000\022\326\362\000\022\326\363\000\022\326\364\000\022\326\365\000\022\326\366\000"},
+    {0x188E0,32,"\022\326\367\000\022\326\370\000\022\326\371\000\022\326\372\000\022\326\373\000\022\326\374\000\022\326\375\000\022\326\376\000\022\326\377\000\022\327\001\000\022\327\002\000\022\327\003\000\022\327\004\000\022\327\005\000\022\327\006\000\022\327\007\000\022\327\010\000\022\327\011\000\022\327\012\000\022\327\013\000\022\327\014\000\022\327\015\000\022\327\016\000\022\327\017\000\022\327\020\000\022\327\021\000\022\327\022\000\022\327\023\000\022\327\024\000\022\327\025\000\022\327\026\000\022\327\027\000"},
+    {0x18900,32,"\022\327\030\000\022\327\031\000\022\327\032\000\022\327\033\000\022\327\034\000\022\327\035\000\022\327\036\000\022\327\037\000\022\327 \000\022\327!\000\022\327\042\000\022\327#\000\022\327$\000\022\327%\000\022\327&\000\022\327'\000\022\327(\000\022\327)\000\022\327*\000\022\327+\000\022\327,\000\022\327-\000\022\327.\000\022\327/\000\022\3270\000\022\3271\000\022\3272\000\022\3273\000\022\3274\000\022\3275\000\022\3276\000\022\3277\000"},
+    {0x18920,32,"\022\3278\000\022\3279\000\022\327:\000\022\327;\000\022\327<\000\022\327=\000\022\327>\000\022\327\077\000\022\327@\000\022\327A\000\022\327B\000\022\327C\000\022\327D\000\022\327E\000\022\327F\000\022\327G\000\022\327H\000\022\327I\000\022\327J\000\022\327K\000\022\327L\000\022\327M\000\022\327N\000\022\327O\000\022\327P\000\022\327Q\000\022\327R\000\022\327S\000\022\327T\000\022\327U\000\022\327V\000\022\327W\000"},
+    {0x18940,32,"\022\327X\000\022\327Y\000\022\327Z\000\022\327[\000\022\327\134\000\022\327]\000\022\327^\000\022\327_\000\022\327`\000\022\327a\000\022\327b\000\022\327c\000\022\327d\000\022\327e\000\022\327f\000\022\327g\000\022\327h\000\022\327i\000\022\327j\000\022\327k\000\022\327l\000\022\327m\000\022\327n\000\022\327o\000\022\327p\000\022\327q\000\022\327r\000\022\327s\000\022\327t\000\022\327u\000\022\327v\000\022\327w\000"},
+    {0x18960,32,"\022\327x\000\022\327y\000\022\327z\000\022\327{\000\022\327|\000\022\327}\000\022\327~\000\022\327\177\000\022\327\200\000\022\327\201\000\022\327\202\000\022\327\203\000\022\327\204\000\022\327\205\000\022\327\206\000\022\327\207\000\022\327\210\000\022\327\211\000\022\327\212\000\022\327\213\000\022\327\214\000\022\327\215\000\022\327\216\000\022\327\217\000\022\327\220\000\022\327\221\000\022\327\222\000\022\327\223\000\022\327\224\000\022\327\225\000\022\327\226\000\022\327\227\000"},
+    {0x18980,32,"\022\327\230\000\022\327\231\000\022\327\232\000\022\327\233\000\022\327\234\000\022\327\235\000\022\327\236\000\022\327\237\000\022\327\240\000\022\327\241\000\022\327\242\000\022\327\243\000\022\327\244\000\022\327\245\000\022\327\246\000\022\327\247\000\022\327\250\000\022\327\251\000\022\327\252\000\022\327\253\000\022\327\254\000\022\327\255\000\022\327\256\000\022\327\257\000\022\327\260\000\022\327\261\000\022\327\262\000\022\327\263\000\022\327\264\000\022\327\265\000\022\327\266\000\022\327\267\000"},
+    {0x189A0,32,"\022\327\270\000\022\327\271\000\022\327\272\000\022\327\273\000\022\327\274\000\022\327\275\000\022\327\276\000\022\327\277\000\022\327\300\000\022\327\301\000\022\327\302\000\022\327\303\000\022\327\304\000\022\327\305\000\022\327\306\000\022\327\307\000\022\327\310\000\022\327\311\000\022\327\312\000\022\327\313\000\022\327\314\000\022\327\315\000\022\327\316\000\022\327\317\000\022\327\320\000\022\327\321\000\022\327\322\000\022\327\323\000\022\327\324\000\022\327\325\000\022\327\326\000\022\327\327\000"},
+    {0x189C0,32,"\022\327\330\000\022\327\331\000\022\327\332\000\022\327\333\000\022\327\334\000\022\327\335\000\022\327\336\000\022\327\337\000\022\327\340\000\022\327\341\000\022\327\342\000\022\327\343\000\022\327\344\000\022\327\345\000\022\327\346\000\022\327\347\000\022\327\350\000\022\327\351\000\022\327\352\000\022\327\353\000\022\327\354\000\022\327\355\000\022\327\356\000\022\327\357\000\022\327\360\000\022\327\361\000\022\327\362\000\022\327\363\000\022\327\364\000\022\327\365\000\022\327\366\000\022\327\367\000"},
+    {0x189E0,32,"\022\327\370\000\022\327\371\000\022\327\372\000\022\327\373\000\022\327\374\000\022\327\375\000\022\327\376\000\022\327\377\000\022\330\001\000\022\330\002\000\022\330\003\000\022\330\004\000\022\330\005\000\022\330\006\000\022\330\007\000\022\330\010\000\022\330\011\000\022\330\012\000\022\330\013\000\022\330\014\000\022\330\015\000\022\330\016\000\022\330\017\000\022\330\020\000\022\330\021\000\022\330\022\000\022\330\023\000\022\330\024\000\022\330\025\000\022\330\026\000\022\330\027\000\022\330\030\000"},
+    {0x18A00,32,"\022\330\031\000\022\330\032\000\022\330\033\000\022\330\034\000\022\330\035\000\022\330\036\000\022\330\037\000\022\330 \000\022\330!\000\022\330\042\000\022\330#\000\022\330$\000\022\330%\000\022\330&\000\022\330'\000\022\330(\000\022\330)\000\022\330*\000\022\330+\000\022\330,\000\022\330-\000\022\330.\000\022\330/\000\022\3300\000\022\3301\000\022\3302\000\022\3303\000\022\3304\000\022\3305\000\022\3306\000\022\3307\000\022\3308\000"},
+    {0x18A20,32,"\022\3309\000\022\330:\000\022\330;\000\022\330<\000\022\330=\000\022\330>\000\022\330\077\000\022\330@\000\022\330A\000\022\330B\000\022\330C\000\022\330D\000\022\330E\000\022\330F\000\022\330G\000\022\330H\000\022\330I\000\022\330J\000\022\330K\000\022\330L\000\022\330M\000\022\330N\000\022\330O\000\022\330P\000\022\330Q\000\022\330R\000\022\330S\000\022\330T\000\022\330U\000\022\330V\000\022\330W\000\022\330X\000"},
+    {0x18A40,32,"\022\330Y\000\022\330Z\000\022\330[\000\022\330\134\000\022\330]\000\022\330^\000\022\330_\000\022\330`\000\022\330a\000\022\330b\000\022\330c\000\022\330d\000\022\330e\000\022\330f\000\022\330g\000\022\330h\000\022\330i\000\022\330j\000\022\330k\000\022\330l\000\022\330m\000\022\330n\000\022\330o\000\022\330p\000\022\330q\000\022\330r\000\022\330s\000\022\330t\000\022\330u\000\022\330v\000\022\330w\000\022\330x\000"},
+    {0x18A60,32,"\022\330y\000\022\330z\000\022\330{\000\022\330|\000\022\330}\000\022\330~\000\022\330\177\000\022\330\200\000\022\330\201\000\022\330\202\000\022\330\203\000\022\330\204\000\022\330\205\000\022\330\206\000\022\330\207\000\022\330\210\000\022\330\211\000\022\330\212\000\022\330\213\000\022\330\214\000\022\330\215\000\022\330\216\000\022\330\217\000\022\330\220\000\022\330\221\000\022\330\222\000\022\330\223\000\022\330\224\000\022\330\225\000\022\330\226\000\022\330\227\000\022\330\230\000"},
+    {0x18A80,32,"\022\330\231\000\022\330\232\000\022\330\233\000\022\330\234\000\022\330\235\000\022\330\236\000\022\330\237\000\022\330\240\000\022\330\241\000\022\330\242\000\022\330\243\000\022\330\244\000\022\330\245\000\022\330\246\000\022\330\247\000\022\330\250\000\022\330\251\000\022\330\252\000\022\330\253\000\022\330\254\000\022\330\255\000\022\330\256\000\022\330\257\000\022\330\260\000\022\330\261\000\022\330\262\000\022\330\263\000\022\330\264\000\022\330\265\000\022\330\266\000\022\330\267\000\022\330\270\000"},
+    {0x18AA0,32,"\022\330\271\000\022\330\272\000\022\330\273\000\022\330\274\000\022\330\275\000\022\330\276\000\022\330\277\000\022\330\300\000\022\330\301\000\022\330\302\000\022\330\303\000\022\330\304\000\022\330\305\000\022\330\306\000\022\330\307\000\022\330\310\000\022\330\311\000\022\330\312\000\022\330\313\000\022\330\314\000\022\330\315\000\022\330\316\000\022\330\317\000\022\330\320\000\022\330\321\000\022\330\322\000\022\330\323\000\022\330\324\000\022\330\325\000\022\330\326\000\022\330\327\000\022\330\330\000"},
+    {0x18AC0,32,"\022\330\331\000\022\330\332\000\022\330\333\000\022\330\334\000\022\330\335\000\022\330\336\000\022\330\337\000\022\330\340\000\022\330\341\000\022\330\342\000\022\330\343\000\022\330\344\000\022\330\345\000\022\330\346\000\022\330\347\000\022\330\350\000\022\330\351\000\022\330\352\000\022\330\353\000\022\330\354\000\022\330\355\000\022\330\356\000\022\330\357\000\022\330\360\000\022\330\361\000\022\330\362\000\022\330\363\000\022\330\364\000\022\330\365\000\022\330\366\000\022\330\367\000\022\330\370\000"},
+    {0x18AE0,32,"\022\330\371\000\022\330\372\000\022\330\373\000\022\330\374\000\022\330\375\000\022\330\376\000\022\330\377\000\022\331\001\000\022\331\002\000\022\331\003\000\022\331\004\000\022\331\005\000\022\331\006\000\022\331\007\000\022\331\010\000\022\331\011\000\022\331\012\000\022\331\013\000\022\331\014\000\022\331\015\000\022\331\016\000\022\331\017\000\022\331\020\000\022\331\021\000\022\331\022\000\022\331\023\000\022\331\024\000\022\331\025\000\022\331\026\000\022\331\027\000\022\331\030\000\022\331\031\000"},
+    {0x1AFF0,4,"H\001\302\277\303e\000H\001\302\277\303\247\000H\001\302\277\304e\000H\001\302\277\303f\000"},
+    {0x1AFF5,7,"H\001\302\277\311\037\000H\001\302\277\306\375\000H\001\302\277\304E\305\270\000H\001\302\277\304E\303e\000H\001\302\277\304E\303\247\000H\001\302\277\304E\304e\000H\001\302\277\304E\303f\000"},
+    {0x1AFFD,2,"H\001\302\277\304E\311\037\000H\001\302\277\304E\306\375\000"},
+    {0x1B000,32,"H\001\301\0349\000\300\035\001\301\034\302o\000A\001\317I\000A\001\317J\000A\001\317K\000A\001\317O\000A\001\337\241\000A\001\337\242\000A\001\337\243\000A\001\337\244\000A\001\357H\000A\001\357I\000A\001\357J\000A\001\357K\000A\001\357L\000A\001\333\302\000A\001\333\303\000A\001\333\304\000A\001\333\305\000A\001\333\306\000A\001\346\304\000A\001\346\305\000A\001\346\306\000A\001\340\264\000A\001\340\267\000A\001\340\270\000A\001\340\271\000A\001\340\272\000A\001\340\273\000A\001\340\274\000A\001\340\275\000A\001\340\276\000"},
+    {0x1B020,32,"A\001\340\265\000A\001\340\266\000A\001\340\277\000A\001\341(\000A\001\341)\000A\001\341*\000A\001\341+\000A\001\341,\000A\001\341-\000A\001\341.\000A\001\341/\000A\001\341\213\000A\001\341\214\000A\001\341\215\000A\001\341\216\000A\001\341\217\000A\001\341\220\000A\001\341\221\000A\001\340\357\000A\001\340\360\000A\001\340\361\000A\001\340\362\000A\001\340\363\000A\001\340\364\000A\001\341b\000A\001\341c\000A\001\341d\000A\001\341e\000A\001\352;\000A\001\315\314\000A\001\352<\000A\001\352=\000"},
+    {0x1B040,32,"A\001\352>\000A\001\352\077\000A\001\352@\000A\001\352A\000A\001\354K\000A\001\354L\000A\001\354M\000A\001\354N\000A\001\354O\000A\001\354P\000A\001\3553\000A\001\3554\000A\001\3555\000A\001\3556\000A\001\3557\000A\001\3558\000A\001\3559\000A\001\355:\000A\001\352\206\000A\001\352\207\000A\001\352\210\000A\001\352\211\000A\001\352\212\000A\001\354\223\000A\001\354\224\000A\001\354\225\000A\001\354\226\000A\001\354\227\000A\001\354\230\000A\001\354\231\000A\001\355\321\000A\001\316d\000"},
+    {0x1B060,32,"A\001\355\322\000A\001\355\323\000A\001\356Z\000A\001\356[\000A\001\356\134\000A\001\356]\000A\001\356^\000A\001\356_\000A\001\356`\000A\001\357\010\000A\001\357\011\000A\001\357\012\000A\001\357\013\000A\001\357\014\000A\001\355\377\000A\001\316p\000A\001\356\001\000A\001\356\002\000A\001\356\003\000A\001\356\004\000A\001\356\005\000A\001\356\006\000A\001\356\007\000A\001\356\204\000A\001\356\205\000A\001\356\206\000A\001\356\207\000A\001\356\210\000A\001\356\211\000A\001\356\212\000A\001\344\356\000A\001\314\311\000"},
+    {0x1B080,32,"A\001\344\357\000A\001\344\360\000A\001\344\361\000A\001\344\362\000A\001\344\363\000A\001\344\364\000A\001\344\365\000A\001\345\240\000A\001\345\241\000A\001\345\242\000A\001\345\243\000A\001\345\244\000A\001\345\245\000A\001\345\246\000A\001\345\247\000A\001\346\134\000A\001\346]\000A\001\346^\000A\001\345E\000A\001\314\327\000A\001\345F\000A\001\345G\000A\001\345H\000A\001\345I\000A\001\345J\000A\001\346\013\000A\001\346\014\000A\001\346\015\000A\001\346\016\000A\001\346\017\000A\001\336A\000A\001\336D\000"},
+    {0x1B0A0,32,"A\001\336E\000A\001\336F\000A\001\336G\000A\001\336H\000A\001\336I\000A\001\336J\000A\001\336K\000A\001\336B\000A\001\336C\000A\001\336\252\000A\001\336\253\000A\001\336\254\000A\001\336\255\000A\001\336\256\000A\001\336\257\000A\001\336\260\000A\001\337g\000A\001\337h\000A\001\337i\000A\001\336y\000A\001\336z\000A\001\336{\000A\001\336|\000A\001\336}\000A\001\336~\000A\001\336\177\000A\001\337\031\000A\001\337\032\000A\001\337\033\000A\001\337\034\000A\001\337\035\000A\001\337\036\000"},
+    {0x1B0C0,32,"A\001\337\037\000A\001\337 \000A\001\343m\000A\001\343n\000A\001\343o\000A\001\343p\000A\001\343q\000A\001\343r\000A\001\343s\000A\001\344#\000A\001\344$\000A\001\344%\000A\001\344&\000A\001\344'\000A\001\344(\000A\001\344)\000A\001\344\217\000A\001\344\220\000A\001\344\221\000A\001\344\222\000A\001\343\322\000A\001\343\323\000A\001\343\324\000A\001\344S\000A\001\344T\000A\001\344U\000A\001\344V\000A\001\344W\000A\001\344X\000A\001\361\204\000A\001\361\205\000A\001\361\206\000"},
+    {0x1B0E0,32,"A\001\361\207\000A\001\361\210\000A\001\317\011\000A\001\361\347\000A\001\361\350\000A\001\361\351\000A\001\361\352\000A\001\361\316\000A\001\361\317\000A\001\361\320\000A\001\361\321\000A\001\361\322\000A\001\361\323\000A\001\351\037\000A\001\315\225\000A\001\351 \000A\001\351!\000A\001\351z\000A\001\351{\000A\001\351|\000A\001\351}\000A\001\351~\000A\001\351\177\000A\001\351\200\000A\001\351\330\000A\001\351\331\000A\001\351\332\000A\001\351\333\000A\001\351\334\000A\001\351\335\000A\001\351C\000A\001\351D\000"},
+    {0x1B100,32,"A\001\351E\000A\001\351F\000A\001\351\246\000A\001\351\247\000A\001\351\250\000A\001\351\251\000A\001\351\252\000A\001\351\253\000A\001\360\322\000A\001\360\323\000A\001\360\324\000A\001\360\325\000A\001\360\326\000A\001\361\005\000A\001\361\006\000A\001\361\007\000A\001\361\010\000A\001\361\011\000A\001\360\361\000A\001\360\362\000A\001\360\363\000A\001\360\364\000A\001\361\026\000A\001\361\027\000A\001\361\030\000A\001\361\031\000A\001\361\032\000A\001\361\033\000A\001\361\034\000A\001\344\273\000A\001\344\274\000\300\035\001\301\034\303.\000"},
+    {0x1B120,3,"H\001\301\034\012\000H\001\301\034\302o\000H\001\301\034\303.\000"},
+    {0x1B150,3,"\300\035\001\004\301\367\000\300\035\001\004\301\300\000\300\035\001\004\301\331\000"},
+    {0x1B164,4,"H\001\004\301\367\000H\001\004\301\300\000H\001\004\301\331\000H\001\004\232\000"},
+    {0x1BC00,32,"\200\001\300\026\000\200\001\300>\000\200\001\300<\000\200\001\300\007\000\200\001\300u\000\200\001\300\011\000\200\001p\000\200\001\077\000\200\001\300\024\000\200\001\300\015\000\200\001\300\003\000\200\001c\000\200\001\300<\232\000\200\001\300\024d\000\200\001\300u\232\000\200\001\300\011\261\000\200\001cd\000\200\001\304\006\000\200\001\303\242\312\363\000\200\001\312\363\000\200\001\306X\000\200\001\303\242\300U\000\200\001\336\304\000\200\001\310\026\000\200\001\351w\000\200\001\261\000\200\001\232\000\200\001\300U\000\200\001d\000\200\001\261\232\000\200\001\232\261\000\200\001\300U\261\000"},
+    {0x1BC20,32,"\200\001d\300U\000\200\001\261\003<\000\200\001\232\003<\000\200\001\300U\003<\000\200\001\300U\003\214\302!\031'\000\200\001d\003<\000\200\001d\003<:\000\200\001\261d\000\200\001\232d\000\200\001\300Ud\000\200\001dd\000\200\001\261\232d\000\200\001\232\261d\000\200\001\300U\261d\000\200\001d\300Ud\000\200\001\300Ud\003<\000\200\001\300U\232\000\200\001\300U\232d\000\200\001d\300\007\000\200\001d\300\007c\000\200\001d\300<\000\200\001d\300<c\000\200\001\300\007d\000\200\001\300\007cd\000\200\001\300P\000\200\001\361\002\000\200\001\300Pc\000\200\001d\232\000\200\001d\261\000\200\001\300\011cd\000\200\001\300\003cd\000\200\001d\300\011\000"},
+    {0x1BC40,32,"\200\001d\300\011c\000\200\001\025\000\200\001\303\242\305\205\000\200\001\305~\000\200\0016\000\200\001\322\245\000\200\001;\000\200\0019\000\200\001\302L\000\200\001\300w;\000\200\001\307\014\000\200\001\301\017\000\200\001\303\242\303B\000\200\001\315\301;\000\200\001\303\242\301\017\000\200\001\253;\000\200\001\302o\000\200\0011\000\200\001\303\203\000\200\001\311J\000\200\0011\232\000\200\001\2531\000\200\001\315\3011\000\200\001\3112\000\200\001\303\2421\000\200\001\347C\000\200\001\305\205\000\200\001\303\354\000\200\001\300q\000\200\001\301\331\000\200\001\301\367\000\200\001\316\367\000"},
+    {0x1BC60,11,"\200\001\361*\000\200\001\305s1\000\200\001\305s6\000\200\001\305s;\000\200\001\305s\025\000\200\001\315P\3016\000\200\001\315P\3032\000\200\001\303\242\300\276\000\200\001\303\242\3016\000\200\001\303\242\300\216\000\200\001|\261\000"},
+    {0x1BC70,13,"\200\301](\255\303\370\000\200\301]\304A\255\303\370\000\200\301]&\255\303\370\000\200\301]\210T\303\370\000\200\301]\304AT\303\370\000\200\301]\217T\303\370\000\200\301]\301\374\303\370\000\200\301]\301\374\305d\303\370\000\200\301]\301\374\316h\000\200\301]\301\374\300\253\000\200\301]\301\3749S\000\200\301]\301\374;S\000\200\301]\301\374\316hS\000"},
+    {0x1BC80,9,"\200\301]\217\300!\000\200\301]\217\311\026\300!\000\200\301]\217\300\200\000\200\301]\217\253\300\200\000\200\301]\217<\000\200\301]\217y\000\200\301]\217\300\201\000\200\301]\217\301\134\000\200\301]\217T\000"},
+    {0x1BC90,10,"\200\301]\210\300!\000\200\301]\210\311\026\300!\000\200\301]\210\300\200\000\200\301]\210\253\300\200\000\200\301]\210<\000\200\301]\210y\000\200\301]\210\300\201\000\200\301]\210\301\134\000\200\301]\210T\000\200\301]\210\034\000"},
+    {0x1BC9C,8,"\200\0026\003\300\323\000\200\3569\001\305\243\000\2004+\000\200\300\006\325Q\300\324\300k\000\306\333\306)\001\310t\000\306\333\306)\331)\310t\000\306\333\306)t\310\354\000\306\333\306)b\310\354\000"},
+    {0x1CF00,32,"_ +\305C\303\350d\302\352\300\216(\000_ +\303\350d\302\352\300\216(\000_ +\311)\300\216(\000_ +\305C\303\350\300\216(\000_ +\303\350\300\216(\000_ +\316/\300\216(\000_ +\304>\302\307\300\216(\000_ +\302\307\300\216(\000_ +\304\376\300\216(\000_ +\304>\302\307d\304\267\300\216(\000_ +\302\307d\304\267\300\216(\000_ +\304\376d\304\267\300\216(\000_ +\305C\303\350d\302\352\300\216&\000_ +\303\350d\302\352\300\216&\000_ +\311)\300\216&\000_ +\305C\303\350\300\216&\000_ +\303\350\300\216&\000_ +\316/\300\216&\000_ +\304>\302\307\300\216&\000_ +\302\307\300\216&\000_ +\304\376\300\216&\000_ +\304>\302\307d\304\267\300\216&\000_ +\302\307d\304\267\300\216&\000_ +\304\376d\304\267\300\216&\000_ +\311)d\302\352\000_ +\304>\302\307d\302\352\000_ +\310\361\304>\302\307\000_ +\302\307d\302\352\000_ +\302\307\310\361\000_ +\304\376d\302\352\000_ +\304>\302\307\310\361\000_ +\305C\304\376\000"},
+    {0x1CF20,14,"_ +\362A\000_ +\300\216\000_ +\351>\000_ +\306\371\000_ +\324n\000_ +\357\211\000_ +\350>\000_ +\342\213\000_ +\341\241\000_ +\340\310\000_ +\362D\000_ +\354z\000_ +\351B\000_ +\306]\300\216(\000"},
+    {0x1CF30,23,"_ \302\253\305\232+\344\213\000_ \302\253\305\232+\355a\000_ \302\253\305\232+\356\265\000_ +\317/\000_ +\312\354\317/\000_ +\347Y\000_ +\310\215\000_ +\310\215\003TI\000_ +\307Z\000_ +\307Z\350D\000_ +\347\042\000_ +\316\042\315\001\000_ +\356\215\000_ +\333\266\000_ \322\364T\315#\000_ +\302\011\315#\000_ +\306]\000_ l\302\253\305\232\301Y\000_\305\224>\342H\000_\305\224>\342I\000_\305\224>\306\011\313O\000_\305\224>\306]\000_\305\224>\310\264\000"},
+    {0x1CF50,32,"_\247\314\032\000_\247\314\032\316\210\000_\247\347\254\000_\247\333\262\300\015\325=\000_\247\314\012\000_\247\3626\000_\247\310\360\000_\247\310\360d\347*\000_\247\315O\000_\247\315O\305u\000_\247\310\360\003\316\042\315\001\000_\247\312\250\000_\247\347\205\000_\247\304\027\000_\247\305B\324o\000_\247\305B\316\210\000_\247\305B\344\215\000_\247\305B\355b\000_\247\305B\356\266\000_\247\304\025\306\260\000_\247\304\025\310\077\000_\247\304\025\304\004\000_\247\304\025\307\001\000_\247\304\025\303\025\306\260\000_\247\304\025\303\025\310\077\000_\247\304\025\303\025\304\004\000_\247\304\025\303\025\307\001\000_\2474\304\027\000_\247\300:\312\250\000_\247\332'\000_\247\341\025\000_\247\307Z\000"},
+    {0x1CF70,32,"_\247\310\215\000_\247\303%\310\077\000_\247\303%\304\004\000_\247\303%\307\001\000_\247\303%\306\371\000_\247\312\354\314\012\000_\247\303%\303\025\304\004\000_\247\303%\314\013\000_\247\303%\303\025\306\371\000_\247\303%\304\220\306\260\000_\247\303%\304\220\304\004\000_\247\303%\304\220\305u\000_\247\303%\304\220\303\025\000_\247\306\343\000_\247\306\343d\305\006\000_\247\306\343\3624\000_\247\306\343d\302\352\000_\247\306]\000_\247\310\264\000_\247\304.\000_\247\341i\000_\247\362q\000_\247\303&\000_\247\303&d\305\006\000_\247\303&d\302\352\000_\247\303&d\305\006;\302\352\000_\247\303&d\302\352;\305\006\000_\247\303&\3170\000_\247\303&\3170d\305\006\000_\247\303&d\351\262\000_\247\303&d\333\267\3628\000_\247\303&d\305\006;\350=\000"},
+    {0x1CF90,32,"_\247\350C\000_\247\303&\305u\000_\247\301W\306\260\000_\247\301W\344\214\000_\247\301W\341\211\000_\247\301W\350F\000_\247\301W\306\257\000_\247\301W\305u\000_\247\301W\341\134\000_\247\301W\314\013\000_\247\301W\306\371\350\230\000_\247\301W\304\220\000_\247\301W\333\265\000_\247\301W\313\021\000_\247\301W\304\220\303\025\000_\247\301W\313\021\303\025\000_\247\301W\3064\003\300N\304\027\000_\247\301W\304\243\003\300N\304\027\000_\247\301W\3064\000_\247\301W\304\243\000_\247\301W\304\243\0034\304\027\000_\247\301W\3065\000_\247\301W\3065\306\257\000_\247\305j\000_\247\305j\350W\000_\247\305j\341^\000_\247\305j\341]\000_\247\305j\341[\000_\247\301W\356\345\000_\247\301W\356\346\000_\247\301W\356\347\000_\247\304\316\000"},
+    {0x1CFB0,20,"_\247\304\316\304\004\000_\247\304\316\307\001\000_\247\304\316\303\026\304\004\000_\247\304\316\303\025\304\004\000_\247\304\316\303\025\305u\000_\247\301W\303\026\000_\247\301W\303\026\306\257\000_\247\301W\303\026\3064\003\300N\304\027\000_\247\301W\303\026\304\243\003\300N\304\027\000_\247\301W\303\026\3064\000_\247\301W\303\026\304\243\000_\247\301W\303\026\304\243\0034\304\027\000_\247\301W\303\026\3065\000_\247\301W\303\026\3065\306\257\000_\247\301W\303\026\356\344\000_\247\341\230\000_\247\347#\000_\247\333\237\000_\247\345P\000_\247\347\301\000"},
+    {0x1D000,32,"G$\014\300Z\000G$\014\331\346\000G$\014\300\364\000G$\014\310u\306\025\000G$\014\310u\304%\000G$\014\3117\306\025\000G$\014\3117\304%\000G$\014\340\343\000G$\014\355\224\000G$\014\310{\000G$\014\317\035\000G$\014\317\035\304%\000G$\014\341\207\000G$\014\312-\306\025\000G$\014\307\242\306\025\000G$\014\316q\000G$\014\305Z\000G$\014\307/\000G$\014\307/\304%\000G$\014\355\216\000G$\014\356\077\000G$\014\315!\302\031\000G$\014\305D\302\031\000G$\014\350\177\000G$\014\325+\000G$\014\360,\000G$\014\307\350\302\031\000G$\014\306S\302\031\000G$\014\305Z\302\031\000G$\014\352s\000G$\014\347\256\000G$\014\3166\322\251\000"},
+    {0x1D020,32,"G$\014\347a\302\031\000G$\014\360&\302\031\000G$\014\312/\302\031\000G$\014\322\253\000G$\014\306Y\000G$\014\351t\000G$\014\315Z\302\031\000G$\014\356p\000G$\014\322\206\000G$\014\315\337\000G$\014\311\001\302\031\000G$\014\311\001\343\354\355\010\000G$\014\3155\302\031\000G$\014\316{\000G$\014\3428\000G$\014\306\020\000G$\014\356\270\000G$\014\311\012\000G$\014\341\204\000G$\014\312-\307\242\301\247\000G$\014\3020\302\031\000G$\014\340\033\000G$\014\307\002\302\031\000G$\014\340\341\307\002\000G$\014\315I\000G$\014\315\177\000G$\014\314\021\000G$\014\312\252\302\031\000G$\014\3516\000G$\014\310z\302\031\000G$\014\310{\302\031\000G$\014\337\312\000"},
+    {0x1D040,32,"G$\014\314\320\000G$\014\347\346\000G$\014\314\021\307*\000G$\014\307\002\307*\000G$\014\355\025\000G$\014\336\023\000G$\014\307\350\301\247\000G$\014\315!\301\247\000G$\014\310u\301\247\000G$\014\347\347\000G$\014\341y\000G$\014\347\350\000G$\014\341\205\000G$\014\315I\301\247\000G$\014\305Z\301\247\303\263\000G$\014\306S\301\247\303\263\000G$\014\361\345\000G$\014\307/\301\247\000G$\014\3120\355\215\301\247\000G$\014\361\344\000G$\014\341\206\000G$\014\334\016\000G$\014\325*\000G$\014\344<\307\350\000G$\014\3117\301\247\000G$\014\315Z\301\247\000G$\014\315\177\301\247\000G$\014\3477\000G$\014\322\241\000G$\014\342\265\000G$\014\310{\301\247\000G$\014\310z\301\247\000"},
+    {0x1D060,32,"G$\014\313=\310z\000G$\014\341\303\000G$\014\322\240\000G$\014\307\002\301\247\000G$\014\334\015\000G$\014\311\001\301\247\000G$\014\355\223\000G$\014\312\252\301\247\000G$\014\334/\000G$\014\315\337\301\247\000G$\014\361[\306Y\000G$\014\356\311\000G$\014\350|\000G$\014\356\307\000G$\014\356\310\000G$\014\350}\000G$\014\356\312\000G$\014\350~\000G$\014\335\377\000G$\014\3127\000G$\014\313=\3127\000G$\014\3155\301\247\000G$\014\316|\334<\000G$\014\316|\307\242\000G$\014\316{\312.\000G$\014\3565\304\263\322\254\000G$\014\340\342\000G$\014\334 \000G$\014\317\026\304;\000G$\014\317\026\303\263\000G$\014\3166\000G$\014\306Y\303\263\000"},
+    {0x1D080,32,"G$\014\304%\302\031\000G$\014\310\005\302\031\000G$\014\310\005\307*\000G$\014\310\005\301\247\000G$\014\312/\301\247\000G$\014\305\015\000G$\014\304%\000G$\014\356\300\000G$\014\356#\000G$\014\310\004\000G$\014\304\276\334#\312\253\000G$\014\304\276\306\020\307_\000G$\014\304\276\356\277\307_\000G$\014\304\276\356 \307_\000G$\014\304\276\340\036\312\253\000G$\014\305D\301\247\303\263\000G$\014\305D\305\210\3071\000G$\014\305D\305\210\312\361\000G$\014\306\007\000G$\014\306\007\305\210\3071\304;\000G$\014\306\007\305\210\3071\303\263\000G$\014\306\007\305\210\312\361\000G$\014\356\273\000G$\014\322\300\000G$\014\340\031\000G$\014\332J\000G$\014\303\260\315q\3126\000G$\014\303\260\322\301\000G$\014\303\260\3126\000G$\014\303\260\343\361\000G$\014\303\260\343\352\000G$\014\303\260\313\203\000"},
+    {0x1D0A0,32,"G$\014\303\260\336\001\000G$\014\303\260\315q\313\203\000G$\014\302\276\315~\302\274\000G$\014\302\276\312!\315~\302\274\000G$\014\302\276\312\362\302\274\000G$\014\302\276\312!\312\362\302\274\000G$\014\302\276\356\302\302\274\000G$\014\302\276\356\272\000G$\014\302\276\311\013\302\274\000G$\014\302\276\311\013\3148\302\274\000G$\014\302\276\3148\302\274\000G$\014\302\276\315k\302\274\000G$\014\340H\316s\313\304\000G$\014\3120\316s\313\304\000G$\014\307\245\356\042\000G$\014\307\245\314\267\000G$\014\307\245\312\366\000G$\014\302\276\360(\302\274\000G$\014\302\276\350y\302\274\000G$\014\302\276\315k\311\013\302\274\000G$\014\313\204\232\312.\000G$\014\313\204\232\332`\000G$\014\334\034\304\263\3020\316\352\000G$\014\340\032\000G$\014\340\034\000G$\014\3020\302\031\3321\337\313\000G$\014\3020\304!\230\000G$\014\3020\304!\314\320\000G$\014\3020\345\002\302\274\000G$\014\3020\304!\302\036\000G$\014\3020\310\331\332K\302\036\000G$\014\3020\304!\301\377\000"},
+    {0x1D0C0,32,"G$\014\3020\304!\303\004\000G$\014\3020\304!\301L\304;\000G$\014\3020\304!\301L\303\263\000G$\014\3020\314\215\305\364\312\366\000G$\014\3020\314\215\305\364\314\267\000G$\014\334\323\310\331\305\364\360)\000G$\014\3020\310\331\305\364\355\212\000G$\014\3020\345Q\000G$\014\307^\362\204\000G$\014\307^\341Z\000G$\014\307^\354\263\000G$\014\3020;\304l\316v\000G$\014\3020\334\033\322\237\000G$\014\304l\316\247\000G$\014\304\042\316\247\000G$\014\304\042\316v\000G$\014\304\042\305\015\306\020\303\301\000G$\014\304\042\314\270\311\012\303\301\000G$\014\304\042\312\367\306\034\303\301\000G$\014\304\042\316\244\315 \303\301\000G$\014\304l\305\015\306\020\303\301\000G$\014\304l\314\270\311\012\303\301\000G$\014\304l\312\367\306\034\303\301\000G$\014\304l\316\244\315 \303\301\000G$\014\313r\304\042\000G$\014\313r\304l\000G$\014\306\006\305\015\344;\000G$\014\306\006\305\015\343\332\000G$\014\306\006\304%\000G$\014\306\006\305\265\000G$\014\303\373\305\265\000G$\014\303\373\305\265\312\374\000"},
+    {0x1D0E0,22,"G$\014\303\373\305\265\316\246\000G$\014\303\373\305\265\316x\000G$\014\303\373\305\334\000G$\014\303\373\305\334\312\374\000G$\014\303\373\305\334\316\246\000G$\014\303\373\305\334\316x\000G$\014\332U\335\243\000G$\014\332S\303\354\000G$\014\310\355\000G$\014\304\032\230\000G$\014\304\032\316\352\000G$\014\304\032\300\005\000G$\014\304\032\302\036\000G$\014\304\032\301\377\000G$\014\304\032\303\004\000G$\014\304\032\301L\000G$\014\305Z\301\247\314\242\000G$\014\306S\301\247\314\242\000G$\014\305Z\301\247\304;\000G$\014\306S\301\247\304;\000G$\014\306Y\304;\000G$\014\305D\301\247\304;\000"},
+    {0x1D100,32,"$\014\300N\304v\000$\0144\304v\000$\0143\304v\000$\014\302\0033\304v\000$\014\302\267\304v\000$\014\300w\304v\000$\014(\303\234\002\000$\014&\303\234\002\000$\014\303\234\214\000$\014\302\035\315\335\000$\014\300\001\324\347\000$\014\315\335\000$\014\326\004\000$\014\310\253\334\325\000$\014\310\253\334\326\000$\014\310\253\334\327\000$\014\307\251\000$\014\307\251:\000$\014\307K+\000$\014\324\326\000$\014\324z\000$\014\202\000$\014\347:\303\375\000$\014\3571\303\375\000$\014\356J\303\375\000$\014\335\021\303\375\000$\014\334\347\303\375\000$\014\354o\303\375\000$\014\354q\313[\000$\014\335\023\313[\000$\014\300\003\303:\000$\014\300\003\303:\304\317\305\325\000"},
+    {0x1D120,7,"$\014\300\003\303:\304\317\301\035\000$\014\3005\303:\000$\014\300u\303:\000$\014\300u\303:\304\317\305\325\000$\014\300u\303:\304\317\301\035\000$\014\304\216\325\216\000$\014\304\216\325\217\000"},
+    {0x1D129,32,"$\014\302\301\304@\302;\000$\0144\304Q\000$\0144\304/\000$\014\304/b\000$\014\304/t\000$\014\310Jb\000$\014\310Jt\000$\014\304Qb\000$\014\304Qt\000$\014\3011\212\304Q\000$\014\3011\212\304/\000$\014\326\021\311\030\000$\014\307y\311\030\000$\014\304\317\305\325\000$\014\304\317\301\035\000$\014\315\216\305\325\000$\014\315\216\301\035\000$\014\344\234\302;\000$\014\311C\302;\000$\014o\302;\000$\014\3011\302;\000$\014\301,\302;\000$\014\304\345\302;\000$\014\311\016\302;\000$\014\310\330\302;\000$\0142\207\316\277\302;\000$\014\300>\301\305\000$\014a\301\305\000$\014y\300>\301\305\000$\014,\301\305@\000$\014,\301\3058\000$\014\260\301\305b@\000"},
+    {0x1D149,32,"$\014\260\301\305b8\000$\014\260\301\305(@\000$\014\260\301\305(8\000$\014\260\301\305&@\000$\014\260\301\305&8\000$\014\260\301\305t@\000$\014\260\301\305t8\000$\014\260\301\305b&@\000$\014\260\301\305b&8\000$\014\301\211\301\305@\000$\014\301\211\301\3058\000$\014\316\242\301\305t@\000$\014\316\242\301\305t8\000$\014\300\371\301\305\000$\014\360\221\301\305\000$\014\301\3058\000$\014\315\012\301\305\000$\014\312\262\301\305@\000$\014\312\262\301\3058\000$\014\300\270\000$\014\311C\301\251\000$\014o\301\251\000$\014\3011\301\251\000$\014\301,\301\251\000$\014\304\345\301\251\000$\014\311\016\301\251\000$\014\310\330\301\251\000$\0142\207\316\277\301\251\000$\014 \303'\000$\014 \354\306\303'\000$\014 \316\236\000$\014 \316\237\000"},
+    {0x1D169,32,"$\014 \316\240\000$\014\307\254\316\236\000$\014\307\254\316\237\000$\014\307\254\316\240\000$\014 \322\370<\000$\014 \334\354\000$\014 \334\355\000$\014 \334\356\000$\014 \334\357\000$\014 \334\360\000$\014\303\266\312[\000$\014\301l\312[\000$\014\303\266\304\362\000$\014\301l\304\362\000$\014\303\266\316\030\000$\014\301l\316\030\000$\014\303\266\315X\000$\014\301l\315X\000$\014 \300\206\000$\014 \354\370\000$\014 \356\035\000$\014 \354\367\000$\014 \343\243\000$\014 \343\244\000$\014 \322+\000$\014 \342\237\000$\014\3128b\000$\014\3128t\000$\014 \332\205\000$\014 \351\237\000$\014 \313O\000$\014 \354\214\000"},
+    {0x1D189,32,"$\014 \304x\000$\014 4\302U\000$\014 \300\262\302U\000$\014\351\234\000$\014\355A\000$\014\300 \000$\014\350\002\000$\014\343\366\000$\014\335\016\000$\014\331I\000$\014\332\023\000$\014\307\310\301\251\302j\000$\014\307\310\301\251\301#\302j\000$\014\356\251\000$\014\307\007\000$\014\300\221\307\007\000$\014\307\007\302j\000$\014\307\007b\000$\014\300\231\355$\000$\014\300\231\355'\000$\014\300\231\355(\000$\014\300\231\355)\000$\014\300\231\355*\000$\014\300\231\355+\000$\014\300\231\355,\000$\014\300\231\355-\000$\014\300\231\355.\000$\014\300\231\355%\000$\014\300\231\355&\000$\014\336q\000$\014\345K\000$\014\301lK\355\017\000"},
+    {0x1D1A9,32,"$\014\306\001\302j\000$\014 t\304|\000$\014 b\304|\000$\014 \336m\000$\014 \354\220\350'\000$\014\310\200+\000$\014\310\200b+\000$\014o\310\200+\000$\014\313\201b\000$\014\313\201t\000$\014\003\334\334\000$\014\312\321\000$\014\312\321\305\012\000$\014\343\275\000$\014\306p\000$\014\312\206\000$\014\310\303@\000$\014\310\3038\000$\014\3107\000$\014\31078\000$\014\310\305@\000$\014\310\3058\000$\014\313_@\000$\014\313_8\000$\014\306p\306\244\302;\000$\014\306p\304\253\302;\000$\014\312\206\302;\000$\014\310\303\302;\000$\014\3107\302;\000$\014\310\305\302;\000$\014\304\005\310\202\303\275\303\363\306\244\000$\014\304\005\310\202\303\275\303\363\304\253\000"},
+    {0x1D1C9,32,"$\014\304\005\310\202\303\275\303\363\306\244\312\370\000$\014\304\005\305N\303\275\303\363\306\244\000$\014\304\005\305N\303\275\303\363\304\253\000$\014\304\005\305N\303\275\303\363\304\253\312\370\000$\014\304\005\305N\303\275\303\363\304\253\332[\000$\014\304\005\305N\303\275\303\363\304\253\332\134\000$\014\331L\000$\014\313\210\3005\303:\000$\014\313\210\300u\303:\000$\014,\077\000$\014\360\204\000$\014\350<\000$\014\325\224\000$\014\315\332\000$\014\325\220\000$\014\316\223\000$\014\315s\000$\014\315s\313N\000$\014\315\332\313N\000$\014\316\223\351n\000$\014\347\343\355F\000$\014\303\023\3005\303:\000$\014\303\023\301lK\303\361\000$\014\303\0233\301\251\000$\014\303\023\351L+\000$\014\303\023\311C\301\251\000$\014\303\023o\301\251\000$\014\303\023\3011\301\251\303't\000$\014\303\023\3011\301\251\303'b\000$\014\303\023\301,\301\251\303't\000$\014\303\023\301,\301\251\303'b\000$\014\303\023\304/\002\000"},
+    {0x1D1E9,2,"$\014\354\246\000$\014\341v\000"},
+    {0x1D200,32,"\042\301\222\300Y\316O\000\042\301\222\300Y\316W\000\042\301\222\300Y\355y\000\042\301\222\300Y\316Z\000\042\301\222\300Y\316[\000\042\301\222\300Y\355\207\000\042\301\222\300Y\316a\000\042\301\222\300Y\316b\000\042\301\222\300Y\355\210\000\042\301\222\300Y\355o\000\042\301\222\300Y\316P\000\042\301\222\300Y\316Q\000\042\301\222\300Y\316R\000\042\301\222\300Y\316S\000\042\301\222\300Y\355p\000\042\301\222\300Y\355q\000\042\301\222\300Y\316T\000\042\301\222\300Y\316U\000\042\301\222\300Y\316V\000\042\301\222\300Y\355r\000\042\301\222\300Y\355s\000\042\301\222\300Y\355t\000\042\301\222\300Y\316X\000\042\301\222\300Y\316Y\000\042\301\222\300Y\316\134\000\042\301\222\300Y\316]\000\042\301\222\300Y\316^\000\042\301\222\300Y\316_\000\042\301\222\300Y\316`\000\042\301:\300Y\316O\000\042\301:\300Y\316W\000\042\301:\300Y\316Z\000"},
+    {0x1D220,32,"\042\301:\300Y\316[\000\042\301:\300Y\316a\000\042\301:\300Y\316b\000\042\301:\300Y\316P\000\042\301:\300Y\316Q\000\042\301:\300Y\316R\000\042\301:\300Y\316S\000\042\301:\300Y\316T\000\042\301:\300Y\316U\000\042\301:\300Y\316V\000\042\301:\300Y\316X\000\042\301:\300Y\316Y\000\042\301:\300Y\355u\000\042\301:\300Y\355v\000\042\301:\300Y\355w\000\042\301:\300Y\355x\000\042\301:\300Y\355z\000\042\301:\300Y\355{\000\042\301:\300Y\355|\000\042\301:\300Y\355}\000\042\301:\300Y\355~\000\042\301:\300Y\355\177\000\042\301:\300Y\355\200\000\042\301:\300Y\355\201\000\042\301:\300Y\355\202\000\042\301:\300Y\355\203\000\042\301:\300Y\355\204\000\042\301:\300Y\355\205\000\042\301:\300Y\355\206\000\042\301:\300Y\316\134\000\042\301:\300Y\316]\000\042\301:\300Y\316^\000"},
+    {0x1D240,6,"\042\301:\300Y\316_\000\042\301:\300Y\316`\000 \042$\316\245\000 \042$\316w\000 \042$\315K\000\042$\304\276\000"},
+    {0x1D2E0,20,"\302\021\300\134\300%\000\302\021\300\1342\000\302\021\300\1347\000\302\021\300\134B\000\302\021\300\134O\000\302\021\300\134V\000\302\021\300\134v\000\302\021\300\134\201\000\302\021\300\134u\000\302\021\300\134\211\000\302\021\300\134\300H\000\302\021\300\134\302\340\000\302\021\300\134\302\220\000\302\021\300\134\304\012\000\302\021\300\134\303\312\000\302\021\300\134\303\015\000\302\021\300\134\303`\000\302\021\300\134\303\371\000\302\021\300\134\303\200\000\302\021\300\134\303\347\000"},
+    {0x1D300,32,"\303\224)\302\134\000\303~)\336\207\302\134\000\303~)\307\327\302\134\000\303~)\313\035\306;\000\303~)\313\035\307\327\000\303~)\302\134\000\300O)\300\222\000\300O)\300\324y\000\300O)\344K\000\300O)\323\374\000\300O)\313\365\004\000\300O)\331-\000\300O)\322\332\000\300O)\310p\000\300O)\324\177\302b\000\300O)\332\026\300\037\332m\000\300O)\332p\000\300O)\361\340\000\300O)\307\336\000\300O)\347\325\000\300O)\315\237\000\300O)\304\203\000\300O)\304\247\302\327\000\300O)\316\354\000\300O)\313R\000\300O)\322;\000\300O)\351]\000\300O)\351k\000\300O)\333\370\000\300O)\307\357\000\300O)\331'\000\300O)\334\036\000"},
+    {0x1D320,32,"\300O)\333\260\000\300O)\325/\000\300O)\332\021\000\300O)\032\351l\000\300O)\347y\000\300O)\3425\000\300O)\325\225\000\300O)\341>\000\300O)\307\272\000\300O)\355\036\000\300O)\350\222\000\300O)\335\042\000\300O)\351j\000\300O)\3143\300\037\344[\000\300O)\315\252\000\300O)\335\367C\314\234\000\300O)\334\035\000\300O)\355\024\000\300O)\336\021\000\300O)\334!\000\300O)E\000\300O)\351\242\000\300O)\334\367\000\300O)\360*\300\037\360\354\000\300O)\331%\000\300O)\304@\000\300O)\307\237\000\300O)\357\253\000\300O)\332Z\000\300O)\301\005\300\347\000\300O)\336\030\000\300O)\307\272\300\241\000"},
+    {0x1D340,23,"\300O)\343\264\000\300O)\322/\000\300O)\334\027\000\300O)\333\222\000\300O)\316\360\000\300O)\354_\000\300O)\313\322\000\300O)\312\356\000\300O)\312\332\000\300O)\332]\000\300O)\334T\000\300O)\353\252\000\300O)\355\021\000\300O)\336l\000\300O)\307g\000\300O)\325\227\000\300O)\334\262\000\300O)\322O\000\300O)\326\026\000\300O)\300\216\301\011\3607\000\300O)\332Q\000\300O)\341\336\000\300O)\335\020\000"},
+    {0x1D360,25,"\302+\302<\302\373\0172\000\302+\302<\302\373\0177\000\302+\302<\302\373\017B\000\302+\302<\302\373\017O\000\302+\302<\302\373\017V\000\302+\302<\302\373\017v\000\302+\302<\302\373\017\201\000\302+\302<\302\373\017u\000\302+\302<\302\373\017\211\000\302+\302<\303(\0172\000\302+\302<\303(\0177\000\302+\302<\303(\017B\000\302+\302<\303(\017O\000\302+\302<\303(\017V\000\302+\302<\303(\017v\000\302+\302<\303(\017\201\000\302+\302<\303(\017u\000\302+\302<\303(\017\211\000\237\304[+2\000\237\304[+7\000\237\304[+B\000\237\304[+O\000\237\304[+V\000\304[+2\000\304[+V\000"},
+    {0x1D400,32,"\015\032\006\025\000\015\032\006\077\000\015\032\006\3005\000\015\032\006\300\024\000\015\032\0069\000\015\032\006\300u\000\015\032\006\300\003\000\015\032\006\300\026\000\015\032\006;\000\015\032\006\300U\000\015\032\006\300\011\000\015\032\006p\000\015\032\006\261\000\015\032\006\232\000\015\032\0066\000\015\032\006\300<\000\015\032\006\300\260\000\015\032\006c\000\015\032\006d\000\015\032\006\300\007\000\015\032\0061\000\015\032\006\300\015\000\015\032\006\300P\000\015\032\006\300>\000\015\032\006\300$\000\015\032\006\300 \000\015\032\004\025\000\015\032\004\077\000\015\032\004\3005\000\015\032\004\300\024\000\015\032\0049\000\015\032\004\300u\000"},
+    {0x1D420,32,"\015\032\004\300\003\000\015\032\004\300\026\000\015\032\004;\000\015\032\004\300U\000\015\032\004\300\011\000\015\032\004p\000\015\032\004\261\000\015\032\004\232\000\015\032\0046\000\015\032\004\300<\000\015\032\004\300\260\000\015\032\004c\000\015\032\004d\000\015\032\004\300\007\000\015\032\0041\000\015\032\004\300\015\000\015\032\004\300P\000\015\032\004\300>\000\015\032\004\300$\000\015\032\004\300 \000\015-\006\025\000\015-\006\077\000\015-\006\3005\000\015-\006\300\024\000\015-\0069\000\015-\006\300u\000\015-\006\300\003\000\015-\006\300\026\000\015-\006;\000\015-\006\300U\000\015-\006\300\011\000\015-\006p\000"},
+    {0x1D440,21,"\015-\006\261\000\015-\006\232\000\015-\0066\000\015-\006\300<\000\015-\006\300\260\000\015-\006c\000\015-\006d\000\015-\006\300\007\000\015-\0061\000\015-\006\300\015\000\015-\006\300P\000\015-\006\300>\000\015-\006\300$\000\015-\006\300 \000\015-\004\025\000\015-\004\077\000\015-\004\3005\000\015-\004\300\024\000\015-\0049\000\015-\004\300u\000\015-\004\300\003\000"},
+    {0x1D456,32,"\015-\004;\000\015-\004\300U\000\015-\004\300\011\000\015-\004p\000\015-\004\261\000\015-\004\232\000\015-\0046\000\015-\004\300<\000\015-\004\300\260\000\015-\004c\000\015-\004d\000\015-\004\300\007\000\015-\0041\000\015-\004\300\015\000\015-\004\300P\000\015-\004\300>\000\015-\004\300$\000\015-\004\300 \000\015\032-\006\025\000\015\032-\006\077\000\015\032-\006\3005\000\015\032-\006\300\024\000\015\032-\0069\000\015\032-\006\300u\000\015\032-\006\300\003\000\015\032-\006\300\026\000\015\032-\006;\000\015\032-\006\300U\000\015\032-\006\300\011\000\015\032-\006p\000\015\032-\006\261\000\015\032-\006\232\000"},
+    {0x1D476,32,"\015\032-\0066\000\015\032-\006\300<\000\015\032-\006\300\260\000\015\032-\006c\000\015\032-\006d\000\015\032-\006\300\007\000\015\032-\0061\000\015\032-\006\300\015\000\015\032-\006\300P\000\015\032-\006\300>\000\015\032-\006\300$\000\015\032-\006\300 \000\015\032-\004\025\000\015\032-\004\077\000\015\032-\004\3005\000\015\032-\004\300\024\000\015\032-\0049\000\015\032-\004\300u\000\015\032-\004\300\003\000\015\032-\004\300\026\000\015\032-\004;\000\015\032-\004\300U\000\015\032-\004\300\011\000\015\032-\004p\000\015\032-\004\261\000\015\032-\004\232\000\015\032-\0046\000\015\032-\004\300<\000\015\032-\004\300\260\000\015\032-\004c\000\015\032-\004d\000\015\032-\004\300\007\000"},
+    {0x1D496,7,"\015\032-\0041\000\015\032-\004\300\015\000\015\032-\004\300P\000\015\032-\004\300>\000\015\032-\004\300$\000\015\032-\004\300 \000\015\236\006\025\000"},
+    {0x1D49E,2,"\015\236\006\3005\000\015\236\006\300\024\000"},
+    {0x1D4A2,1,"\015\236\006\300\003\000"},
+    {0x1D4A5,2,"\015\236\006\300U\000\015\236\006\300\011\000"},
+    {0x1D4A9,4,"\015\236\006\232\000\015\236\0066\000\015\236\006\300<\000\015\236\006\300\260\000"},
+    {0x1D4AE,12,"\015\236\006d\000\015\236\006\300\007\000\015\236\0061\000\015\236\006\300\015\000\015\236\006\300P\000\015\236\006\300>\000\015\236\006\300$\000\015\236\006\300 \000\015\236\004\025\000\015\236\004\077\000\015\236\004\3005\000\015\236\004\300\024\000"},
+    {0x1D4BB,1,"\015\236\004\300u\000"},
+    {0x1D4BD,7,"\015\236\004\300\026\000\015\236\004;\000\015\236\004\300U\000\015\236\004\300\011\000\015\236\004p\000\015\236\004\261\000\015\236\004\232\000"},
+    {0x1D4C5,32,"\015\236\004\300<\000\015\236\004\300\260\000\015\236\004c\000\015\236\004d\000\015\236\004\300\007\000\015\236\0041\000\015\236\004\300\015\000\015\236\004\300P\000\015\236\004\300>\000\015\236\004\300$\000\015\236\004\300 \000\015\032\236\006\025\000\015\032\236\006\077\000\015\032\236\006\3005\000\015\032\236\006\300\024\000\015\032\236\0069\000\015\032\236\006\300u\000\015\032\236\006\300\003\000\015\032\236\006\300\026\000\015\032\236\006;\000\015\032\236\006\300U\000\015\032\236\006\300\011\000\015\032\236\006p\000\015\032\236\006\261\000\015\032\236\006\232\000\015\032\236\0066\000\015\032\236\006\300<\000\015\032\236\006\300\260\000\015\032\236\006c\000\015\032\236\006d\000\015\032\236\006\300\007\000\015\032\236\0061\000"},
+    {0x1D4E5,32,"\015\032\236\006\300\015\000\015\032\236\006\300P\000\015\032\236\006\300>\000\015\032\236\006\300$\000\015\032\236\006\300 \000\015\032\236\004\025\000\015\032\236\004\077\000\015\032\236\004\3005\000\015\032\236\004\300\024\000\015\032\236\0049\000\015\032\236\004\300u\000\015\032\236\004\300\003\000\015\032\236\004\300\026\000\015\032\236\004;\000\015\032\236\004\300U\000\015\032\236\004\300\011\000\015\032\236\004p\000\015\032\236\004\261\000\015\032\236\004\232\000\015\032\236\0046\000\015\032\236\004\300<\000\015\032\236\004\300\260\000\015\032\236\004c\000\015\032\236\004d\000\015\032\236\004\300\007\000\015\032\236\0041\000\015\032\236\004\300\015\000\015\032\236\004\300P\000\015\032\236\004\300>\000\015\032\236\004\300$\000\015\032\236\004\300 \000\015\300\014\006\025\000"},
+    {0x1D505,1,"\015\300\014\006\077\000"},
+    {0x1D507,4,"\015\300\014\006\300\024\000\015\300\014\0069\000\015\300\014\006\300u\000\015\300\014\006\300\003\000"},
+    {0x1D50D,8,"\015\300\014\006\300U\000\015\300\014\006\300\011\000\015\300\014\006p\000\015\300\014\006\261\000\015\300\014\006\232\000\015\300\014\0066\000\015\300\014\006\300<\000\015\300\014\006\300\260\000"},
+    {0x1D516,7,"\015\300\014\006d\000\015\300\014\006\300\007\000\015\300\014\0061\000\015\300\014\006\300\015\000\015\300\014\006\300P\000\015\300\014\006\300>\000\015\300\014\006\300$\000"},
+    {0x1D51E,28,"\015\300\014\004\025\000\015\300\014\004\077\000\015\300\014\004\3005\000\015\300\014\004\300\024\000\015\300\014\0049\000\015\300\014\004\300u\000\015\300\014\004\300\003\000\015\300\014\004\300\026\000\015\300\014\004;\000\015\300\014\004\300U\000\015\300\014\004\300\011\000\015\300\014\004p\000\015\300\014\004\261\000\015\300\014\004\232\000\015\300\014\0046\000\015\300\014\004\300<\000\015\300\014\004\300\260\000\015\300\014\004c\000\015\300\014\004d\000\015\300\014\004\300\007\000\015\300\014\0041\000\015\300\014\004\300\015\000\015\300\014\004\300P\000\015\300\014\004\300>\000\015\300\014\004\300$\000\015\300\014\004\300 \000\015\300\025\006\025\000\015\300\025\006\077\000"},
+    {0x1D53B,4,"\015\300\025\006\300\024\000\015\300\025\0069\000\015\300\025\006\300u\000\015\300\025\006\300\003\000"},
+    {0x1D540,5,"\015\300\025\006;\000\015\300\025\006\300U\000\015\300\025\006\300\011\000\015\300\025\006p\000\015\300\025\006\261\000"},
+    {0x1D546,1,"\015\300\025\0066\000"},
+    {0x1D54A,7,"\015\300\025\006d\000\015\300\025\006\300\007\000\015\300\025\0061\000\015\300\025\006\300\015\000\015\300\025\006\300P\000\015\300\025\006\300>\000\015\300\025\006\300$\000"},
+    {0x1D552,32,"\015\300\025\004\025\000\015\300\025\004\077\000\015\300\025\004\3005\000\015\300\025\004\300\024\000\015\300\025\0049\000\015\300\025\004\300u\000\015\300\025\004\300\003\000\015\300\025\004\300\026\000\015\300\025\004;\000\015\300\025\004\300U\000\015\300\025\004\300\011\000\015\300\025\004p\000\015\300\025\004\261\000\015\300\025\004\232\000\015\300\025\0046\000\015\300\025\004\300<\000\015\300\025\004\300\260\000\015\300\025\004c\000\015\300\025\004d\000\015\300\025\004\300\007\000\015\300\025\0041\000\015\300\025\004\300\015\000\015\300\025\004\300P\000\015\300\025\004\300>\000\015\300\025\004\300$\000\015\300\025\004\300 \000\015\032\300\014\006\025\000\015\032\300\014\006\077\000\015\032\300\014\006\3005\000\015\032\300\014\006\300\024\000\015\032\300\014\0069\000\015\032\300\014\006\300u\000"},
+    {0x1D572,32,"\015\032\300\014\006\300\003\000\015\032\300\014\006\300\026\000\015\032\300\014\006;\000\015\032\300\014\006\300U\000\015\032\300\014\006\300\011\000\015\032\300\014\006p\000\015\032\300\014\006\261\000\015\032\300\014\006\232\000\015\032\300\014\0066\000\015\032\300\014\006\300<\000\015\032\300\014\006\300\260\000\015\032\300\014\006c\000\015\032\300\014\006d\000\015\032\300\014\006\300\007\000\015\032\300\014\0061\000\015\032\300\014\006\300\015\000\015\032\300\014\006\300P\000\015\032\300\014\006\300>\000\015\032\300\014\006\300$\000\015\032\300\014\006\300 \000\015\032\300\014\004\025\000\015\032\300\014\004\077\000\015\032\300\014\004\3005\000\015\032\300\014\004\300\024\000\015\032\300\014\0049\000\015\032\300\014\004\300u\000\015\032\300\014\004\300\003\000\015\032\300\014\004\300\026\000\015\032\300\014\004;\000\015\032\300\014\004\300U\000\015\032\300\014\004\300\011\000\015\032\300\014\004p\000"},
+    {0x1D592,32,"\015\032\300\014\004\261\000\015\032\300\014\004\232\000\015\032\300\014\0046\000\015\032\300\014\004\300<\000\015\032\300\014\004\300\260\000\015\032\300\014\004c\000\015\032\300\014\004d\000\015\032\300\014\004\300\007\000\015\032\300\014\0041\000\015\032\300\014\004\300\015\000\015\032\300\014\004\300P\000\015\032\300\014\004\300>\000\015\032\300\014\004\300$\000\015\032\300\014\004\300 \000\0150\006\025\000\0150\006\077\000\0150\006\3005\000\0150\006\300\024\000\0150\0069\000\0150\006\300u\000\0150\006\300\003\000\0150\006\300\026\000\0150\006;\000\0150\006\300U\000\0150\006\300\011\000\0150\006p\000\0150\006\261\000\0150\006\232\000\0150\0066\000\0150\006\300<\000\0150\006\300\260\000\0150\006c\000"},
+    {0x1D5B2,32,"\0150\006d\000\0150\006\300\007\000\0150\0061\000\0150\006\300\015\000\0150\006\300P\000\0150\006\300>\000\0150\006\300$\000\0150\006\300 \000\0150\004\025\000\0150\004\077\000\0150\004\3005\000\0150\004\300\024\000\0150\0049\000\0150\004\300u\000\0150\004\300\003\000\0150\004\300\026\000\0150\004;\000\0150\004\300U\000\0150\004\300\011\000\0150\004p\000\0150\004\261\000\0150\004\232\000\0150\0046\000\0150\004\300<\000\0150\004\300\260\000\0150\004c\000\0150\004d\000\0150\004\300\007\000\0150\0041\000\0150\004\300\015\000\0150\004\300P\000\0150\004\300>\000"},
+    {0x1D5D2,32,"\0150\004\300$\000\0150\004\300 \000\0150\032\006\025\000\0150\032\006\077\000\0150\032\006\3005\000\0150\032\006\300\024\000\0150\032\0069\000\0150\032\006\300u\000\0150\032\006\300\003\000\0150\032\006\300\026\000\0150\032\006;\000\0150\032\006\300U\000\0150\032\006\300\011\000\0150\032\006p\000\0150\032\006\261\000\0150\032\006\232\000\0150\032\0066\000\0150\032\006\300<\000\0150\032\006\300\260\000\0150\032\006c\000\0150\032\006d\000\0150\032\006\300\007\000\0150\032\0061\000\0150\032\006\300\015\000\0150\032\006\300P\000\0150\032\006\300>\000\0150\032\006\300$\000\0150\032\006\300 \000\0150\032\004\025\000\0150\032\004\077\000\0150\032\004\3005\000\0150\032\004\300\024\000"},
+    {0x1D5F2,32,"\0150\032\0049\000\0150\032\004\300u\000\0150\032\004\300\003\000\0150\032\004\300\026\000\0150\032\004;\000\0150\032\004\300U\000\0150\032\004\300\011\000\0150\032\004p\000\0150\032\004\261\000\0150\032\004\232\000\0150\032\0046\000\0150\032\004\300<\000\0150\032\004\300\260\000\0150\032\004c\000\0150\032\004d\000\0150\032\004\300\007\000\0150\032\0041\000\0150\032\004\300\015\000\0150\032\004\300P\000\0150\032\004\300>\000\0150\032\004\300$\000\0150\032\004\300 \000\0150-\006\025\000\0150-\006\077\000\0150-\006\3005\000\0150-\006\300\024\000\0150-\0069\000\0150-\006\300u\000\0150-\006\300\003\000\0150-\006\300\026\000\0150-\006;\000\0150-\006\300U\000"},
+    {0x1D612,32,"\0150-\006\300\011\000\0150-\006p\000\0150-\006\261\000\0150-\006\232\000\0150-\0066\000\0150-\006\300<\000\0150-\006\300\260\000\0150-\006c\000\0150-\006d\000\0150-\006\300\007\000\0150-\0061\000\0150-\006\300\015\000\0150-\006\300P\000\0150-\006\300>\000\0150-\006\300$\000\0150-\006\300 \000\0150-\004\025\000\0150-\004\077\000\0150-\004\3005\000\0150-\004\300\024\000\0150-\0049\000\0150-\004\300u\000\0150-\004\300\003\000\0150-\004\300\026\000\0150-\004;\000\0150-\004\300U\000\0150-\004\300\011\000\0150-\004p\000\0150-\004\261\000\0150-\004\232\000\0150-\0046\000\0150-\004\300<\000"},
+    {0x1D632,32,"\0150-\004\300\260\000\0150-\004c\000\0150-\004d\000\0150-\004\300\007\000\0150-\0041\000\0150-\004\300\015\000\0150-\004\300P\000\0150-\004\300>\000\0150-\004\300$\000\0150-\004\300 \000\0150\032-\006\025\000\0150\032-\006\077\000\0150\032-\006\3005\000\0150\032-\006\300\024\000\0150\032-\0069\000\0150\032-\006\300u\000\0150\032-\006\300\003\000\0150\032-\006\300\026\000\0150\032-\006;\000\0150\032-\006\300U\000\0150\032-\006\300\011\000\0150\032-\006p\000\0150\032-\006\261\000\0150\032-\006\232\000\0150\032-\0066\000\0150\032-\006\300<\000\0150\032-\006\300\260\000\0150\032-\006c\000\0150\032-\006d\000\0150\032-\006\300\007\000\0150\032-\0061\000\0150\032-\006\300\015\000"},
+    {0x1D652,32,"\0150\032-\006\300P\000\0150\032-\006\300>\000\0150\032-\006\300$\000\0150\032-\006\300 \000\0150\032-\004\025\000\0150\032-\004\077\000\0150\032-\004\3005\000\0150\032-\004\300\024\000\0150\032-\0049\000\0150\032-\004\300u\000\0150\032-\004\300\003\000\0150\032-\004\300\026\000\0150\032-\004;\000\0150\032-\004\300U\000\0150\032-\004\300\011\000\0150\032-\004p\000\0150\032-\004\261\000\0150\032-\004\232\000\0150\032-\0046\000\0150\032-\004\300<\000\0150\032-\004\300\260\000\0150\032-\004c\000\0150\032-\004d\000\0150\032-\004\300\007\000\0150\032-\0041\000\0150\032-\004\300\015\000\0150\032-\004\300P\000\0150\032-\004\300>\000\0150\032-\004\300$\000\0150\032-\004\300 \000\015\300\244\006\025\000\015\300\244\006\077\000"},
+    {0x1D672,32,"\015\300\244\006\3005\000\015\300\244\006\300\024\000\015\300\244\0069\000\015\300\244\006\300u\000\015\300\244\006\300\003\000\015\300\244\006\300\026\000\015\300\244\006;\000\015\300\244\006\300U\000\015\300\244\006\300\011\000\015\300\244\006p\000\015\300\244\006\261\000\015\300\244\006\232\000\015\300\244\0066\000\015\300\244\006\300<\000\015\300\244\006\300\260\000\015\300\244\006c\000\015\300\244\006d\000\015\300\244\006\300\007\000\015\300\244\0061\000\015\300\244\006\300\015\000\015\300\244\006\300P\000\015\300\244\006\300>\000\015\300\244\006\300$\000\015\300\244\006\300 \000\015\300\244\004\025\000\015\300\244\004\077\000\015\300\244\004\3005\000\015\300\244\004\300\024\000\015\300\244\0049\000\015\300\244\004\300u\000\015\300\244\004\300\003\000\015\300\244\004\300\026\000"},
+    {0x1D692,20,"\015\300\244\004;\000\015\300\244\004\300U\000\015\300\244\004\300\011\000\015\300\244\004p\000\015\300\244\004\261\000\015\300\244\004\232\000\015\300\244\0046\000\015\300\244\004\300<\000\015\300\244\004\300\260\000\015\300\244\004c\000\015\300\244\004d\000\015\300\244\004\300\007\000\015\300\244\0041\000\015\300\244\004\300\015\000\015\300\244\004\300P\000\015\300\244\004\300>\000\015\300\244\004\300$\000\015\300\244\004\300 \000\015-\004\301\375;\000\015-\004\301\375\300U\000"},
+    {0x1D6A8,32,"\015\032\006\300s\000\015\032\006\302\033\000\015\032\006\301\352\000\015\032\006\302\012\000\015\032\006\301-\000\015\032\006\302\323\000\015\032\006\300\277\000\015\032\006\301\312\000\015\032\006\300\312\000\015\032\006\3025\000\015\032\006\302\242\000\015\032\006\301!\000\015\032\006\301e\000\015\032\006\302\223\000\015\032\006\301}\000\015\032\006\300\325\000\015\032\006\301\230\000\015\032\006\301\312\014\000\015\032\006\301\272\000\015\032\006\302\077\000\015\032\006\300\356\000\015\032\006\301\307\000\015\032\006\301\256\000\015\032\006\302P\000\015\032\006\300n\000\015\032\304\306\000\015\032\004\300s\000\015\032\004\302\033\000\015\032\004\301\352\000\015\032\004\302\012\000\015\032\004\301-\000\015\032\004\302\323\000"},
+    {0x1D6C8,32,"\015\032\004\300\277\000\015\032\004\301\312\000\015\032\004\300\312\000\015\032\004\3025\000\015\032\004\302\242\000\015\032\004\301!\000\015\032\004\301e\000\015\032\004\302\223\000\015\032\004\301}\000\015\032\004\300\325\000\015\032\004\301\230\000\015\032\0043\301\272\000\015\032\004\301\272\000\015\032\004\302\077\000\015\032\004\300\356\000\015\032\004\301\307\000\015\032\004\301\256\000\015\032\004\302P\000\015\032\004\300n\000\015\032\304\321\304\212\000\015\032\301-\014\000\015\032\301\312\014\000\015\032\3025\014\000\015\032\301\307\014\000\015\032\301\230\014\000\015\032\300\325\014\000\015-\006\300s\000\015-\006\302\033\000\015-\006\301\352\000\015-\006\302\012\000\015-\006\301-\000\015-\006\302\323\000"},
+    {0x1D6E8,32,"\015-\006\300\277\000\015-\006\301\312\000\015-\006\300\312\000\015-\006\3025\000\015-\006\302\242\000\015-\006\301!\000\015-\006\301e\000\015-\006\302\223\000\015-\006\301}\000\015-\006\300\325\000\015-\006\301\230\000\015-\006\301\312\014\000\015-\006\301\272\000\015-\006\302\077\000\015-\006\300\356\000\015-\006\301\307\000\015-\006\301\256\000\015-\006\302P\000\015-\006\300n\000\015-\304\306\000\015-\004\300s\000\015-\004\302\033\000\015-\004\301\352\000\015-\004\302\012\000\015-\004\301-\000\015-\004\302\323\000\015-\004\300\277\000\015-\004\301\312\000\015-\004\300\312\000\015-\004\3025\000\015-\004\302\242\000\015-\004\301!\000"},
+    {0x1D708,32,"\015-\004\301e\000\015-\004\302\223\000\015-\004\301}\000\015-\004\300\325\000\015-\004\301\230\000\015-\0043\301\272\000\015-\004\301\272\000\015-\004\302\077\000\015-\004\300\356\000\015-\004\301\307\000\015-\004\301\256\000\015-\004\302P\000\015-\004\300n\000\015-\304\321\304\212\000\015-\301-\014\000\015-\301\312\014\000\015-\3025\014\000\015-\301\307\014\000\015-\301\230\014\000\015-\300\325\014\000\015\032-\006\300s\000\015\032-\006\302\033\000\015\032-\006\301\352\000\015\032-\006\302\012\000\015\032-\006\301-\000\015\032-\006\302\323\000\015\032-\006\300\277\000\015\032-\006\301\312\000\015\032-\006\300\312\000\015\032-\006\3025\000\015\032-\006\302\242\000\015\032-\006\301!\000"},
+    {0x1D728,32,"\015\032-\006\301e\000\015\032-\006\302\223\000\015\032-\006\301}\000\015\032-\006\300\325\000\015\032-\006\301\230\000\015\032-\006\301\312\014\000\015\032-\006\301\272\000\015\032-\006\302\077\000\015\032-\006\300\356\000\015\032-\006\301\307\000\015\032-\006\301\256\000\015\032-\006\302P\000\015\032-\006\300n\000\015\032-\304\306\000\015\032-\004\300s\000\015\032-\004\302\033\000\015\032-\004\301\352\000\015\032-\004\302\012\000\015\032-\004\301-\000\015\032-\004\302\323\000\015\032-\004\300\277\000\015\032-\004\301\312\000\015\032-\004\300\312\000\015\032-\004\3025\000\015\032-\004\302\242\000\015\032-\004\301!\000\015\032-\004\301e\000\015\032-\004\302\223\000\015\032-\004\301}\000\015\032-\004\300\325\000\015\032-\004\301\230\000\015\032-\0043\301\272\000"},
+    {0x1D748,32,"\015\032-\004\301\272\000\015\032-\004\302\077\000\015\032-\004\300\356\000\015\032-\004\301\307\000\015\032-\004\301\256\000\015\032-\004\302P\000\015\032-\004\300n\000\015\032-\304\321\304\212\000\015\032-\301-\014\000\015\032-\301\312\014\000\015\032-\3025\014\000\015\032-\301\307\014\000\015\032-\301\230\014\000\015\032-\300\325\014\000\0150\032\006\300s\000\0150\032\006\302\033\000\0150\032\006\301\352\000\0150\032\006\302\012\000\0150\032\006\301-\000\0150\032\006\302\323\000\0150\032\006\300\277\000\0150\032\006\301\312\000\0150\032\006\300\312\000\0150\032\006\3025\000\0150\032\006\302\242\000\0150\032\006\301!\000\0150\032\006\301e\000\0150\032\006\302\223\000\0150\032\006\301}\000\0150\032\006\300\325\000\0150\032\006\301\230\000\0150\032\006\301\312\014\000"},
+    {0x1D768,32,"\0150\032\006\301\272\000\0150\032\006\302\077\000\0150\032\006\300\356\000\0150\032\006\301\307\000\0150\032\006\301\256\000\0150\032\006\302P\000\0150\032\006\300n\000\0150\032\304\306\000\0150\032\004\300s\000\0150\032\004\302\033\000\0150\032\004\301\352\000\0150\032\004\302\012\000\0150\032\004\301-\000\0150\032\004\302\323\000\0150\032\004\300\277\000\0150\032\004\301\312\000\0150\032\004\300\312\000\0150\032\004\3025\000\0150\032\004\302\242\000\0150\032\004\301!\000\0150\032\004\301e\000\0150\032\004\302\223\000\0150\032\004\301}\000\0150\032\004\300\325\000\0150\032\004\301\230\000\0150\032\0043\301\272\000\0150\032\004\301\272\000\0150\032\004\302\077\000\0150\032\004\300\356\000\0150\032\004\301\307\000\0150\032\004\301\256\000\0150\032\004\302P\000"},
+    {0x1D788,32,"\0150\032\004\300n\000\0150\032\304\321\304\212\000\0150\032\301-\014\000\0150\032\301\312\014\000\0150\032\3025\014\000\0150\032\301\307\014\000\0150\032\301\230\014\000\0150\032\300\325\014\000\0150\032-\006\300s\000\0150\032-\006\302\033\000\0150\032-\006\301\352\000\0150\032-\006\302\012\000\0150\032-\006\301-\000\0150\032-\006\302\323\000\0150\032-\006\300\277\000\0150\032-\006\301\312\000\0150\032-\006\300\312\000\0150\032-\006\3025\000\0150\032-\006\302\242\000\0150\032-\006\301!\000\0150\032-\006\301e\000\0150\032-\006\302\223\000\0150\032-\006\301}\000\0150\032-\006\300\325\000\0150\032-\006\301\230\000\0150\032-\006\301\312\014\000\0150\032-\006\301\272\000\0150\032-\006\302\077\000\0150\032-\006\300\356\000\0150\032-\006\301\307\000\0150\032-\006\301\256\000\0150\032-\006\302P\000"},
+    {0x1D7A8,32,"\0150\032-\006\300n\000\0150\032-\304\306\000\0150\032-\004\300s\000\0150\032-\004\302\033\000\0150\032-\004\301\352\000\0150\032-\004\302\012\000\0150\032-\004\301-\000\0150\032-\004\302\323\000\0150\032-\004\300\277\000\0150\032-\004\301\312\000\0150\032-\004\300\312\000\0150\032-\004\3025\000\0150\032-\004\302\242\000\0150\032-\004\301!\000\0150\032-\004\301e\000\0150\032-\004\302\223\000\0150\032-\004\301}\000\0150\032-\004\300\325\000\0150\032-\004\301\230\000\0150\032-\0043\301\272\000\0150\032-\004\301\272\000\0150\032-\004\302\077\000\0150\032-\004\300\356\000\0150\032-\004\301\307\000\0150\032-\004\301\256\000\0150\032-\004\302P\000\0150\032-\004\300n\000\0150\032-\304\321\304\212\000\0150\032-\301-\014\000\0150\032-\301\312\014\000\0150\032-\3025\014\000\0150\032-\301\307\014\000"},
+    {0x1D7C8,4,"\0150\032-\301\230\014\000\0150\032-\300\325\014\000\015\032\006\304\213\000\015\032\004\304\213\000"},
+    {0x1D7CE,32,"\015\032\017\300%\000\015\032\0172\000\015\032\0177\000\015\032\017B\000\015\032\017O\000\015\032\017V\000\015\032\017v\000\015\032\017\201\000\015\032\017u\000\015\032\017\211\000\015\300\025\017\300%\000\015\300\025\0172\000\015\300\025\0177\000\015\300\025\017B\000\015\300\025\017O\000\015\300\025\017V\000\015\300\025\017v\000\015\300\025\017\201\000\015\300\025\017u\000\015\300\025\017\211\000\0150\017\300%\000\0150\0172\000\0150\0177\000\0150\017B\000\0150\017O\000\0150\017V\000\0150\017v\000\0150\017\201\000\0150\017u\000\0150\017\211\000\0150\032\017\300%\000\0150\032\0172\000"},
+    {0x1D7EE,32,"\0150\032\0177\000\0150\032\017B\000\0150\032\017O\000\0150\032\017V\000\0150\032\017v\000\0150\032\017\201\000\0150\032\017u\000\0150\032\017\211\000\015\300\244\017\300%\000\015\300\244\0172\000\015\300\244\0177\000\015\300\244\017B\000\015\300\244\017O\000\015\300\244\017V\000\015\300\244\017v\000\015\300\244\017\201\000\015\300\244\017u\000\015\300\244\017\211\000\026\231k\000\026\302Jk\000\026\302{k\000\026\303\316k\000\026\301pk\000\026\3023k\000\026\231k\301x\000\026\302Jk\301x\000\026\231\221\303jk\301x\000\026\231k\301T\306[\000\026\231k\304\210\000\026\231k\302\014\000\026\231k\302\014\210\000\026\302Jk\313\252\000"},
+    {0x1D80E,32,"\026\231kM\000\026\302JkM\000\026\231kM\301x\000\026\231kM\301T\310\002\000\026\231kM\302\014\000\026\231kbM\302\014\000\026\231k\302\014Mb\000\026\231kM\301\203\000\026\231kM\301\203k\301x\000\026\231kM\301\203M\301x\000\026\231kM\301\203\304\210\000\026\231kM\301\203\302\014\000\026\231kM\302\266\000\026\302JkM\302\266\000\026\231M\301x\223k\000\026\231k\301x\223M\000\026\231kM\221\000\026\302JkM\221\000\026\231kM\301F\221\301x\000\026\231kM\301x\221\301F\000\026\231kM\221\301x\000\026\231kM\302\014\302k\221\301E\000\026\231kbM\302\014\221\301E\000\026\231kbM\302\014\221\301\203\000\026\231k\302\014Mb\221\301E\000\026\231kMb\302k\221\302/\000\026\231kM\221\304\210\000\026\231kM\221.\000\026\231kM\221\304\250\000\026\231kM\221\302\014\000\026\231\221\301\254kM\301F\000\026\231kM\301\203\221\301E\000"},
+    {0x1D82E,32,"\026\231kM\301\203\221\301E\301\203\000\026\231kM\301\203\221\301E\301x\000\026\231M\221\304\250kb\000\026\231k\221\304\250Mb\000\026\231kM\301\203\302\014\221\301E\000\026\231kM\302\266\221\301E\000\026\231kM\301\203\221\302/\000\026\231kM\301\203\304\210\221\302/\000\026\231M\221\304\210kb\000\026\231k\221\304\210Mb\000\026\231M\221.kb\000\026\231M\221.k\302\014\000\026\231k\221\304\031\302bMb\000\026\231k\221\304\031\300\241Mb\000\026\231k\221.Mb\000\026\231kM\221\301\203\302\014\000\026\231kM\221\304\031\302b\000\026\231kM\221\304\031\000\026\231M\221\304\031\302bkb\000\026\231M\221\304\031\302bk\302\266\000\026\231M\221\304\031kb\000\026\231k\221\304\250M\302\014\000\026\301\241O\301n\000\026\301\241O\301n\301x\000\026\301\241O\301n\302\014\000\026\301\241O\301n\301\203\000\026\301\241O\301n\301\203\304\346\000\026\303\315O\301n\301\203\000\026\231O\301n\301\203\301x\000\026\301pO\301n\301\203\000\026\301\241V\301n\302k\000\026\301\241\3047V\301n\302k\000"},
+    {0x1D84E,32,"\026\301\241V\301n\302kO\301x\000\026\301\241\3047V\301n\302kO\301x\000\026\301\241V\301n\302k\301x\000\026\301\241\3047V\301n\302k\301x\000\026\301\241V\301n\302k\221\302/\000\026\302{V\301n\302k\000\026\302{V\301n\302k\262\000\026\301pV\301n\302k\262\000\026\303\316V\301n\302k\000\026\301\241V\301n\302k\302\014\000\026\301\241V\301n\302k\302\014\221\301E\000\026\301\241V\301n\302k\302\014\301#\221\000\026\301\241\000\026\301\241\301\254\304\320\334\254\000\026\301\241\3047\000\026\301\241\221\301E\000\026\301\241\3047\221\301E\000\026\301\241\221\301x\000\026\301\241\221\302/\000\026\301\241\304\346k\221\301E\000\026\301\241\304\346\300\222\000\026\301\241\304\346\300\222\221\301E\000\026\301\241\304\346\300\222\221\301E\301x\000\026\301\241\304\346\300{\000\026\303\315\000\026\303\315\221\301E\000\026\303\315\301#\221\000\026\303\315\221\302/\000\026\303K\312\304\000\026\303K\000\026\302{\262\000\026\302{\000"},
+    {0x1D86E,32,"\026\302{\262\221\301E\000\026\302{\221\301E\000\026\302{\262\301#\221\000\026\302{\301#\221\000\026\302{\262\221\302/\000\026\302{\221\302/\000\026\3069\262\000\026\3069\000\026\302J\000\026\303\316\000\026\303\316\221\301E\000\026\303\316\301#\221\000\026\303\316\221\302/\000\026\301p\262\000\026\301p\262\221\302/\000\026\301p\000\026\301p\004\000\026\301p\262\221\301E\000\026\301p\221\301E\000\026\301p\262\301#\221\000\026\301p\301#\221\000\026\301p\221\301E\316\227k\000\026\301p\221\301\254M\240\000\026\3023\000\026\231kM\240\000\026\302JkM\240\000\026\301pkM\240\000\026\3023kM\240\000\026\301p\300{\000\026\231kM\240\301x\000\026\231kM\240\301\203\000\026\301pkM\240\301\203\000"},
+    {0x1D88E,32,"\026\231\300{t\000\026\231\300{t\315\273\301F\000\026\231\300{t\315\273\302\011\000\026\231\300{t\347X.\000\026\231\300{b\000\026\231\221\303j\300{b\000\026\302J\300{b\000\026\303\316\300{b\000\026\3023\300{b\000\026\231\300{\301T\306[\000\026\231\300{\301x\000\026\231\300{\356\244\221\000\026\231\300{\221\000\026\301p\300{\221\000\026\231\300{k\221\000\026\301p\300{k\221\000\026\3023\300{k\221k\221\302b\000\026\3023\300{k\221k\221\000\026\231\300{k\000\026\302J\300{k\000\026\301p\300{k\000\026\3023\300{k\000\026\231kM\300{\000\026\302JkM\300{\000\026\301pkM\300{\000\026\301p\240\000\026\3023kM\300{\000\026\231kM\300\323\300{\000\026\302JkM\300\323\300{\000\026\231\240t\000\026\301p\240tk\221SM\000\026\3023\240tM\221k\300\323\000"},
+    {0x1D8AE,32,"\026\231\240b\000\026\231\240\301T\306[\000\026\231\240\300{\000\026\302J\240\300{\000\026\303\316\240\300{\000\026\3023\240\300{\000\026\231\240M\000\026\231\240M\301\203\000\026\231\240M\301T\310\002\000\026\231\240k\000\026\231\240\221\000\026\303K\240\221\000\026\231k\240\300{\000\026\302Jk\240\300{\000\026\3069k\240\300{\300\216\000\026\303Kk\240\300{\302b\000\026\303Kk\240\300{\300\241\000\026\303Kk\240\300{\303j\000\026\302{k\240\300{\000\026\301pk\240\300{\000\026\3023k\240\300{\302b\000\026\3023k\240\300{\000\026\231Mt\000\026\301pM\000\026\231Mb\000\026\302JMb\000\026\231M\301T\306[\000\026\231Mb\221\301E\000\026\303KM\221\000\026\231M\221\300{\000\026\231M\300{\000\026\231M\240\300{\000"},
+    {0x1D8CE,32,"\026\302JM\240\300{\000\026\3069M\240\300{\300\216\000\026\302{M\240\300{\000\026\301pM\240\300{\000\026\3023M\240\300{\302b\000\026\3023M\240\300{\300\241\000\026\3023M\240\300{\000\026\302JM\240\300{\301x\000\026\303\315M\240\300{\301\203\000\026\303\315M\240\300{\301\203\301E\000\026\303KM\240\300{\301\203\302b\000\026\303KM\240\300{\301\203\300\241\000\026\303KM\240\300{\301\203\000\026\301pk\302\014\000\026\231k\221\301E\000\026\301pk\221\301E\000\026\231k\221\301E\221\274\000\026\231k\221\301E\221\301\203\000\026\231k\221\301E\221\301x\000\026\231k\221\301Ek\301x\000\026\231k\221\301E\312\201\301x\000\026\231k\221\301Ek\313\252\000\026\231k\221\302/k\301F\000\026\231k\221\302/k\301x\000\026\231k\221S\000\026\231k\221\312\304\000\026\231k\221\301*\221\302!\000\026\303\315k\221\301*\221\302!\000\026\231k\221\301*\221\303j\000\026\231k\221y\000\026\302{k\221\000\026\302{k\221\262\000"},
+    {0x1D8EE,32,"\026\301pk\221\262\000\026\301pk\221\300#\000\026\301pk\221\000\026\301pk\221\004\000\026\3023k\221\302b\000\026\3023k\221\300\241\000\026\3023k\221\000\026\231\221\000\026\231\221\3047\000\026\231\221\301E\274\000\026\231\221\301E\301\203\000\026\231\221\301E\301x\000\026\231\221\302/\000\026\231\221\301\254kM\000\026\231\221\301\254M\240\000\026\231\221\301\254\240\300{\000\026\231\221\303j7\301n\000\026\231\221\2237\301n\000\026\231\221\303jB\301n\000\026\231\221\303jO\301n\000\026\231\221\223O\301T\310\002\000\026\231\000\026\231\3047\000\026\311!\300N\000\026\311!\302\301\000\026\311!\301\254\000\026\307\311\300N\000\026\307\311\302\301\000\026\307\311\301\254\000\026\310\363\300N\000\026\310\363\302\301\000\026\310\363\301\254\000"},
+    {0x1D90E,32,"\026\304\177\300N\000\026\304\177\302\301\000\026\304\177\301\254\000\026\306\312\300N\000\026\306\312\302\301\000\026\306\312\301\254\000\026\310\372\310\377\000\026\310\372\301\254\000\026\304\347\300#\300N\000\026\304\347\004\300N\000\026\304\347\300#\302\301\000\026\304\347\004\302\301\000\026\304\347\306\322\000\026\304\234\300#\300N\000\026\304\234\004\300N\000\026\304\234\300#\302\301\000\026\304\234\004\302\301\000\026\304\234\306\322\000\026\304\347\304\234\301\332\000\026\304Dbt\300#\000\026\304Dbt\004\000\026\304Db\306\322\000\026\304Dt\306\322\000\026\304Dbt\301\332\300#\000\026\304Dbt\301\332\004\000\026\304D\301EC\301E\304\337\000\026\300A\303E\304\203\000\026\300_\303E\304\203\000\026\300A\300N\301F\004\000\026\300A\300N\301F\270\000\026\300A\300N\301F\300#\000\026\300A\300N\301F\303\222\000"},
+    {0x1D92E,32,"\026\300A\300N\302\256\303G\000\026\300A4\301F\000\026\300A4\302\256\303G\000\026\300A4\301\332\000\026\300A4\301\332\302\256\303G\000\026\300A\300\323\000\026\300A\300\262\301F\303\343\000\026\300A\300\262\302\256\303G\000\026\300A\300\262\301\332\000\026\300A\300\262\301\332\302\256\303G\000\026\300A\304x\004\000\026\300A\304x\270\000\026\300A\304x\300#\000\026\300A\3018\004\000\026\300A\3018\270\000\026\300A\3018\300#\000\026\300A\3018\302e\000\026\300A\302\231\004\000\026\300A\302\231\270\000\026\300A\302\231\300#\000\026\300Ae\004\000\026\300Ae\270\000\026\300Ae\300#\000\026\300A\303\003\004\000\026\300A\303\003\270\000\026\300A\303\003\300#\000\026\300A\304\322\004\000\026\300A\304\322\270\000\026\300A\304\322\300#\000\026\303g\302\212\300N\000\026\303g\302\2124\000\026\303g\302\212\301\332\000"},
+    {0x1D94E,32,"\026\303g\302\211\300N\000\026\303g\302\2114\000\026\303g\302\211\301\332\000\026\303g\306\325\000\026\303g\301\345\304W\300N\000\026\303g\301\345\304W4\000\026\303g\301\345\304W\300\262\000\026\302a\303\264\004\000\026\302a\303\264\270\000\026\302a\303\264\300#\000\026\302a\303\264\303\222\000\026\302a\304\016\004\000\026\302a\304\016\270\000\026\302a\304\016\300#\000\026\302a\304\016\303\222\000\026\302a\301\254\303\264\004\000\026\302a\301\254\303\264\270\000\026\302a\301\254\303\264\300#\000\026\302a\301\254\303\264\303\222\000\026\302a\301\254\304\016\004\000\026\302a\301\254\304\016\270\000\026\302a\301\254\304\016\300#\000\026\302a\301\254\304\016\303\222\000\026\300_\300N\301F\004\000\026\300_\300N\301F\270\000\026\300_\300N\301F\300#\000\026\300_\300N\301F\303\222\000\026\300_\300N\302\256\303G\000\026\300_4\301F\000\026\300_4\302\256\303G\000\026\300_4\301\332\000\026\300_4\301\332\302\256\303G\000"},
+    {0x1D96E,32,"\026\300_\300\323\000\026\300_\300\262\301F\303\343\000\026\300_\300\262\302\256\303G\000\026\300_\300\262\301\332\303\343\000\026\300_\300\262\301\332\302\256\303G\000\026\300_\304x\000\026\300_\3018\004\000\026\300_\3018\270\000\026\300_\3018\300#\000\026\300_\302\231\000\026\300_e\004\000\026\300_e\270\000\026\300_e\300#\000\026\300_\303\003\004\000\026\300_\303\003\270\000\026\300_\303\003\300#\000\026\300_\304\322\004\000\026\300_\304\322\270\000\026\300_\304\322\300#\000\026\304f\302\211\300N\000\026\304f\302\2114\000\026\304f\302\211\301\332\000\026\304f\302\212\300N\000\026\304f\302\2124\000\026\304f\302\212\301\332\000\026\304f\306\325\000\026\300A\301*\3011\004\000\026\300A\301*\3011\270\000\026\300A\301*\3011\300#\000\026\300A\301*\3011\303\222\000\026\300A\301*\305H\004\000\026\300A\301*\305H\270\000"},
+    {0x1D98E,32,"\026\300A\301*\305H\300#\000\026\300A\301*\305H\303\222\000\026\300A\301*\316\201y\004\000\026\300A\301*\316\201y\270\000\026\300A\302\240\004\000\026\300A\302\240\270\000\026\300A\302\240\300#\000\026\300A\301\244\004\000\026\300A\301\244\270\000\026\300A\301\244\300#\000\026\300A\301\244\0044\000\026\300A\301\134\301*4\004\000\026\300A\301\134\301*4\270\000\026\300A\301\134\301*4\300#\000\026\300A\301\134\301*\300\262\004\000\026\300A\301\134\301*\300\262\270\000\026\300A\301\134\301*\300\262\300#\000\026\300A\301*\303\245\301F\000\026\300A\302\011\300\323\004\000\026\300A\302\011\300\323\270\000\026\302\212\300N\000\026\302\2124\000\026\302\212\301\033\000\026\300A\306\325\000\026\300A\301*\300\311\303\206\302@\000\026\300A\302\240\300\311\303\206\302@\000\026\300A\301\244\300\311\303\206\302@\000\026\300A\301\134\300\311\303\206\302@\000\026\302\212\300N\300\311\303\206\302@\000\026\302\2124\300\311\303\206\302@\000\026\302\212\301\332\300\311\303\206\302@\000\026\300A\301*\300\311\304\037\000"},
+    {0x1D9AE,32,"\026\300A\302\240\300\311\304\037\000\026\300A\301\244\300\311\304\037\000\026\300A\301\134\300\311\304\037\000\026\302\212\300N\300\311\304\037\000\026\302\2124\300\311\304\037\000\026\302\212\301\332\300\311\304\037\000\026\300A\301\134\274\305\211\004\000\026\300A\301\134\274\305\211\270\000\026\300A\301\134\274\305\211\300#\000\026\300_\301*\300\311\302E\004\000\026\300_\301*\300\311\302E\300#\000\026\300_\302\240\300\311\302E\0044\000\026\300_\302\240\300\311\302E\300#4\000\026\300_\302\240\300\311\302E\004\300\262\000\026\300_\302\240\300\311\302E\300#\300\262\000\026\300_\301\244\300\311\302E\004\300N\000\026\300_\301\244\300\311\302E\300#\300N\000\026\300_\301\244\300\311\302E\0044\000\026\300_\301\244\300\311\302E\300#4\000\026\300_\301\134\300\311\302E\004\000\026\300_\301\134\300\311\302E\300#\000\026\302\211\300N\300\311\302E\000\026\302\2114\300\311\302E\000\026\302\211\301\332\300\311\302E\000\026\300_\301*\300\311\302.\004\000\026\300_\301*\300\311\302.\300#\000\026\300_\302\240\300\311\302.\0044\000\026\300_\302\240\300\311\302.\300#4\000\026\300_\302\240\300\311\302.\300\262\004\300\262\000\026\300_\302\240\300\311\302.\300\262\300#\300\262\000\026\300_\301\244\300\311\302.\004\300N\000\026\300_\301\244\300\311\302.\300#\300N\000"},
+    {0x1D9CE,32,"\026\300_\301\244\300\311\302.\0044\000\026\300_\301\244\300\311\302.\300#4\000\026\300_\301\134\300\311\302.\004\000\026\300_\301\134\300\311\302.\300#\000\026\302\211\300N\300\311\302.\000\026\302\2114\300\311\302.\000\026\302\211\301\332\300\311\302.\000\026\300_\301*\004\000\026\300_\301*\270\000\026\300_\301*\300#\000\026\300_\301*\303\222\000\026\300_\301*\326\016\000\026\300_\302\240\004\000\026\300_\301\244\004\000\026\300_\301\134\306\344\000\026\300_\301\134\004\000\026\300_\301\134\300#\000\026\302\211\300N\000\026\302\2114\000\026\302\211\301\332\000\026\300_\306\325\303X\000\026\300A\301\345y\004\300N\000\026\300A\301\345y\270\300N\000\026\300A\301\345y\0044\000\026\300A\301\345y\2704\000\026\300_\301\345y\300\311\302@\004\300N\000\026\300_\301\345y\300\311\302@\270\300N\000\026\300_\301\345y\300\311\302@\300#\300N\000\026\300_\301\345y\300\311\302@\0044\000\026\300_\301\345y\300\311\302@\2704\000\026\300_\301\345y\300\311\302@\300#4\000\026\300A\302\256y\303\206\300N\000"},
+    {0x1D9EE,32,"\026\300A\302\256y\303\2064\000\026\300_\302\256y\300\311\302@\300N\000\026\300_\302\256y\300\311\302@4\000\026\300A\303E\302F\300N\000\026\300A\303E\302F4\000\026\300_\303E\302F\300\311\302@\300N\000\026\300_\303E\302F\300\311\302@4\000\026\303\077\300a\004\000\026\303\077\300a\300#\000\026\303\077\334\274\000\026\303\077\316\027\000\026\303\077\304a\000\026\303\077\315\245\000\026\303\077\316\007\000\026\303\077\316\007\301\332\000\026\303\077\334N\347W\311\030\000\026\303\077\336\006\000\026\301\225\000\026\301\225\351\231\000\026\301\225\300A\301F\000\026\301\225\300A\356m\000\026\301\225\300_\301F\000\026\301\225\300A\301*\000\026\301\225\300_\301*\000\026\301\225\303\343y\000\026i\306\011\304\325\303\033\302/\306\372\000\026i\306\011\304\325\303\033b\300\037t\000\026i\306\011\304\325\303\033b\300\037t\306\372\000\026\304*\301Fb\000\026\304*\301F\301\020\000\026\304*\301Ft\000\026\306\017\304*\301\020t\000"},
+    {0x1DA0E,32,"\026\306\017\304*t\301\020\000\026\306\017\304*b\301\020\000\026\306\017\304*\301\020b\000\026\307\264\301\020\000\026\307\264\304\203\000\026\307\264\304k\000\026\301\260\262\000\026\301\260\354\315\000\026\301\260\301\005\000\026\303D\312o\300N\000\026\303D\312o\302\301\000\026\301\260o\262\000\026\301\260\302\376\262\000\026\301\260o\301\005\000\026\301\260\361\014\303\343\000\026\303D\361\023\000\026\307\243b\000\026\307\243t\000\026\307\243\313Q\000\026\3052\301F\000\026\3052\301F4\000\026\3052\301F\301\332\000\026\306\037\301F\000\026\306\037\301F4\000\026\306\037\301F\301\332\000\026\3052\302\011\000\026\306\037\302\011\000\026\3052\312\256\000\026\304\202\350\206\000\026\304\202\301\020\000\026\304\202\316\077\000\026\304a\304\202\217\000"},
+    {0x1DA2E,32,"\026\304a\304\202M\000\026\304a\304\202\210\000\026\313\034\000\026\303\033\301\020\000\026\303\033\304\203\000\026\303\033\311G\000\026\303\033\361\015\000\026\304o\312x\302b\000\026\304o\355H\300\241\000\026\304o\324b\004\315\303\000\026\304o\355G\004\315\303\000\026\307K\3400\000\026\307K\334S\000\026\300\347\301\005\301\020\000\026\300\347\301\005\302/\000\026\300\347\301\005\304\203\000\026\300\347\305\251\000\026\300\347\305\251\304k\000\026\300\347\305\251\262\000\026\300\347\306,\000\026\300\347\306,\304k\000\026\300\347\306,\262\000\026\300\347\262y\000\026\300\347\262\302/\000\026\300\347\262\304k\000\026\300\347\262\305\203\000\026\300\347\262\305\203\304k\000\026\300\347\262\305\203\317\020\000\026\300\347\262\303\232\000\026\300\347\262\303\232\304k\000\026\300\347\262\303\232\317\020\000\026\300\347\304\270\000"},
+    {0x1DA4E,32,"\026\300\347\304\270\302/\000\026\300\347\304\270\304k\000\026\300\347\304a\000\026\300\347\304a\302/\000\026\300\347\304a\316\077\000\026\303\332\350g\306\373\000\026\306ml\223s\000\026\306ms\223l\000\026\300\347\304\206\000\026\300\347\311G\300N\000\026\300\347\311G4\000\026\302U\3168\302b\334\273\000\026\302U\342W\303\332\000\026\302U\302\005\301\254\303\332\000\026\302U\302\005\316\227\302!\300\347\000\026\302U\302!\300\347\315\245\000\026\302U\344\205\322L\3256\000\026\302U\300\222\3168\302b\000\026\302U\300\222\302!\300\347\000\026\304`\000\026\304`\303\343\000\026\304`\300\216\302U\000\026\304`\300\216\302U\303\343\000\026\304`\300\216\303\332\000\026\304`\300\216\303\332\303\343\000\026\304`\324Z\303\332\000\026\300A\313\336\000\026\300_\313\336\000\026\314\330\000\026\3045\000\026\334R\000\026\305\246\304\246\354\274\000"},
+    {0x1DA6E,30,"\026\305\246\304\246\350O\000\026\360\342\305\246\304\246\314\275\000\026\334\370\305\246\304\246\314\275\000\026\305\246\306\372\301A\360\341\000\026\316\224\301F\355\037\000\026\316\224\302\011\304x\000\026\356\242\357/\000\026s\312{\306\372\301A\304\246\340\213\000\026\303\331\326\015\000\026\303\331\342:\000\026\303\331\342;\000\026\303\331\342<\000\026\303\331\342=\000\026\303\331\342>\000\026\303\331\342\077\000\026\303\331\342@\000\026\303E\000\026\342\204\301\364\000\026\342\203\301\364\000\026\303\333\336\212\000\026\303\333\303,\000\026\303\333\332&\000\026\303\333\301\225\314\330\000\026\303\333\356\241\000\026\303\333\342d\332T\000\026\300\251\000\026\300\324\300k\000\026\302\366\000\026\301^\000\026\300\371\000"},
+    {0x1DA9B,5,"\026\302-\314\261\000\026\302-\314\262\000\026\302-\314\263\000\026\302-\314\264\000\026\302-\314\265\000"},
+    {0x1DAA1,15,"\026\302e\314\261\000\026\302e\314\262\000\026\302e\314\263\000\026\302e\314\264\000\026\302e\314\265\000\026\302e\344g\000\026\302e\344h\000\026\302e\344i\000\026\302e\344`\000\026\302e\344a\000\026\302e\344b\000\026\302e\344c\000\026\302e\344d\000\026\302e\344e\000\026\302e\344f\000"},
+    {0x1DF00,31,"\010\004\001\307\250\301k\003\356\275\000\010\004\001\300:\236\300\003\000\010\001\004\006\241\300\003\000\010\004\001\300:\300\011\000\010\001\004\006p\003\303\006\000\010\004\001\306l\003\301\022S\000\010\004\001\241\300$\003\303\006\000\010\004\001\300:\302\341\000\010\004\001\241c\003\253\302\017\031\301\022S\000\010\004\001\300\007\003S\031\301\022S\000\010\001\301\022\303\011\003\301\022S\000\010\004\001\302 \0034x\000\010\004\001\302 \0034x\031\301\347\000\010\004\001\241\300\007\003\301\347\000\010\001\300\221\301I\300k\003\301\347\000\010\001\301\311\3005\003\301\347\000\010\001\004\006\241\300\011\000\010\004\001p\003\303\311\000\010\004\001\306\005\301k\003\301\213S\000\010\004\001p\003\303\006\031\301\213S\000\010\004\001\302\341\003\301\213S\000\010\004\001\241c\003\301\213S\000\010\004\001c\003\303\311\031\301\213S\000\010\004\001\306\365\301k\003\301\213S\000\010\004\001\302\342\003\301\213S\000\010\004\001\306\005\301k\003\301\022S\000\010\004\001;\003I\031\301\022S\000\010\004\0016\003\301\022S\000\010\004\001\306\365\301k\003\301\022S\000\010\004\001\3005\003\301\022S\000\010\004\001d\003\301\347\000"},
+    {0x1E000,7," \215\001\3078\000 \215\001\307O\000 \215\001\3118\000 \215\001\307\307\000 \215\001\307\222\000 \215\001\311S\000 \215\001\311\134\000"},
+    {0x1E008,17," \215\001\311Z\000 \215\001\304\257\000 \215\001X\304\257\000 \215\001;\000 \215\001\307\220\000 \215\001\307\362\000 \215\001\310\032\000 \215\001\305p\000 \215\001\310I\000 \215\001\310m\000 \215\001\310\216\000 \215\001\310\262\000 \215\001\310\334\000 \215\001\311-\000 \215\001\3114\000 \215\001\307\267\000 \215\001\307\321\000"},
+    {0x1E01B,7," \215\001\310\317\000 \215\001\304g\000 \215\001\305\034\000 \215\001\300j\000 \215\001\303/\000 \215\001\307\033\000 \215\001\311N\000"},
+    {0x1E023,2," \215\001\301)\000 \215\001\004\301w\000"},
+    {0x1E026,5," \215\001\301i\000 \215\001\304\255\004\301w\000 \215\001\302s\301w\000 \215\001\304\255\302s\301w\000 \215\001\304.\000"},
+    {0x1E100,32,"\300|\300}Z\001\251\000\300|\300}Z\001\301\201\000\300|\300}Z\001\346O\000\300|\300}Z\001\265\000\300|\300}Z\001\203\000\300|\300}Z\001\256\000\300|\300}Z\001\302\222\000\300|\300}Z\001\345\342\000\300|\300}Z\001\300m\000\300|\300}Z\001\252\000\300|\300}Z\001\271\000\300|\300}Z\001\300\341\000\300|\300}Z\001\345'\000\300|\300}Z\001\346U\000\300|\300}Z\001[\000\300|\300}Z\001\300\001\000\300|\300}Z\001\300\225\000\300|\300}Z\001\310`\000\300|\300}Z\001\300\307\000\300|\300}Z\001\346Z\000\300|\300}Z\001\3573\000\300|\300}Z\001\301\026\000\300|\300}Z\001\235\000\300|\300}Z\001\302\023\000\300|\300}Z\001\264\000\300|\300}Z\001\346&\000\300|\300}Z\001\230\000\300|\300}Z\001\317\007\000\300|\300}Z\001\346$\000\300|\300}Z\001\306\013\000\300|\300}Z\001\346%\000\300|\300}Z\001\246\000"},
+    {0x1E120,13,"\300|\300}Z\001\314\260\000\300|\300}Z\001\306\251\000\300|\300}Z\001\300\005\000\300|\300}Z\001\302\024\000\300|\300}Z\001\025\000\300|\300}Z\001\300/\000\300|\300}Z\001;\000\300|\300}Z\0011\000\300|\300}Z\0016\000\300|\300}Z\001\300\354\000\300|\300}Z\0019\000\300|\300}Z\001\301\017\000\300|\300}Z\001\300P\000"},
+    {0x1E130,14,"\300|\300}Z\356\224\000\300|\300}Z\356\230\000\300|\300}Z\356\227\000\300|\300}Z\356\232\000\300|\300}Z\356\231\000\300|\300}Z\356\226\000\300|\300}Z\356\225\000\300|\300}Z\002)\301\362\000\300|\300}Z\002)\356;\000\300|\300}Z\002)\303\333\000\300|\300}Z\002)\322\226\000\300|\300}Z\002)\340<\000\300|\300}Z\002\311J\311J\000\300|\300}Z\005\306k\000"},
+    {0x1E140,10,"\300|\300}Z\017\300%\000\300|\300}Z\0172\000\300|\300}Z\0177\000\300|\300}Z\017B\000\300|\300}Z\017O\000\300|\300}Z\017V\000\300|\300}Z\017v\000\300|\300}Z\017\201\000\300|\300}Z\017u\000\300|\300}Z\017\211\000"},
+    {0x1E14E,2,"\300|\300}Z\303\334\346\212\000\300|\300}Z.\300m\000"},
+    {0x1E290,31,"\301s\001\230\000\301s\001\300\042\000\301s\001\265\000\301s\001\300\001\000\301s\001[\000\301s\001\300\005\000\301s\001\251\000\301s\001\256\000\301s\001\300c\000\301s\001\271\000\301s\001\300\220\000\301s\001\264\000\301s\001\300q\000\301s\001\300g\000\301s\001\203\000\301s\001\235\000\301s\001\252\000\301s\001;\000\301s\001\305\027;\000\301s\001\305R\000\301s\001\305\027\305R\000\301s\0011\000\301s\0019\000\301s\001\305\0279\000\301s\001\3050\000\301s\001\305\027\3050\000\301s\0016\000\301s\001\301X\000\301s\001\305\027\301X\000\301s\001\025\000\301s\002\302\207\212\000"},
+    {0x1E2C0,32,"\300\265\001\300/\000\300\265\001\025\000\300\265\001\300\042\000\300\265\001\300m\000\300\265\001\300\001\000\300\265\001\300\005\000\300\265\001\264\000\300\265\001\300\306\000\300\265\001\252\000\300\265\001\256\000\300\265\001\230\000\300\265\001\265\000\300\265\001\300\254\000\300\265\001\301\026\000\300\265\001\271\000\300\265\001\300j\000\300\265\001\300g\000\300\265\001\300\341\000\300\265\001\300q\000\300\265\001\300\307\000\300\265\001[\000\300\265\0016\000\300\265\001\300d\000\300\265\001\235\000\300\265\001\251\000\300\265\001\300\223\000\300\265\001\203\000\300\265\0019\000\300\265\001;\000\300\265\001\300c\000\300\265\0011\000\300\265\001\342}\000"},
+    {0x1E2E0,26,"\300\265\001\301\201\000\300\265\001\311\042\000\300\265\001\315&\000\300\265\001\321\314\000\300\265\001\302\262\000\300\265\001\307\340\000\300\265\001\300\216\000\300\265\001\300\276\000\300\265\001\312\011\000\300\265\001\300\225\000\300\265\001\357\217\000\300\265\001\361\310\000\300\265\212\316\273\000\300\265\212\357\033\000\300\265\212\310\003\000\300\265\212\341l\000\300\265\017\300%\000\300\265\0172\000\300\265\0177\000\300\265\017B\000\300\265\017O\000\300\265\017V\000\300\265\017v\000\300\265\017\201\000\300\265\017u\000\300\265\017\211\000"},
+    {0x1E2FF,1,"\300\265\345\226\002\000"},
+    {0x1E7E0,7,"#\005\336\243\000#\005\336\251\000#\005\336\247\000#\005\336\244\000#\005\336\246\000#\005\336\245\000#\005\336\250\000"},
+    {0x1E7E8,4,"#\005\3022\313\245\000#\005\336\242\000#\005\336\241\000#\005\336\240\000"},
+    {0x1E7ED,2,"#\005\3022\306\204\000#\005\3022\314\304\000"},
+    {0x1E7F0,15,"#\005\3022\315\223\000#\005\3022\315\222\000#\005\3022\315\221\000#\005\3022\312\215\000#\005\3022\312\214\000#\005\3022\306c\000#\005\3022\314\036\000#\005\3022\306b\000#\005\3022\313\224\000#\005\3022\313\223\000#\005\3022\313\222\000#\005\3022\313c\000#\005\3022\313b\000#\005\3022\306\261\000#\005\3022\315\202\000"},
+    {0x1E800,32,"RQ\005\314\134\301\323\000RQ\005\314][\000RQ\005\314^\301\355\000RQ\005\342\347\307\371\000RQ\005\343\006\301\377\000RQ\005\342\362\305]\000RQ\005\342\326\301\303\000RQ\005\343Z\341\223\000RQ\005\314_\301\367\000RQ\005\314`\300q\000RQ\005\314a\303.\000RQ\005\343%\307\023\000RQ\005\343\035\301\300\000RQ\005\343\031\305\310\000RQ\005\342\323\301\331\000RQ\005\343i\3614\000RQ\005\3436\316\367\000RQ\005\342\343\361<\000RQ\005\342\327\361:\000RQ\005\3432\361;\000RQ\005\314b\306~\000RQ\005\314c\301\360\000RQ\005\314d\344\237\000RQ\005\342\341\303\032\000RQ\005\343\005\302\300\000RQ\005\343A\314\300\000RQ\005\343d\344\226\000RQ\005\314e\302\034\000RQ\005\314f\300\042\000RQ\005\314g\301\255\000RQ\005\343=\304w\000RQ\005\343\010\302r\000"},
+    {0x1E820,32,"RQ\005\343\016\312}\000RQ\005\3431\302\332\000RQ\005\314h;\000RQ\005\314i\025\000RQ\005\314j1\000RQ\005\343J\301\017\000RQ\005\343\0139\000RQ\005\343L\300\354\000RQ\005\343:6\000RQ\005\3430\303\177\000RQ\005\343*\300\241\000RQ\005\343.\300\241\000RQ\005\343j\3016\000RQ\005\343Y\300\276\000RQ\005\314n\301\340\000RQ\005\314o\271\000RQ\005\314p\301\365\000RQ\005\343I\304O\000RQ\005\343\033\301\363\000RQ\005\343/\305\252\000RQ\005\342\365\301\273\000RQ\005\343k\354Q\000RQ\005\314t\300\227\000RQ\005\314u\252\000RQ\005\314v\301\265\000RQ\005\342\372\306h\000RQ\005\342\357\300\345\000RQ\005\342\334\304\300\000RQ\005\343@\302\020\000RQ\005\343\025\253\300\345\000RQ\005\314k\302\036\000RQ\005\314l\300\001\000"},
+    {0x1E840,32,"RQ\005\314m\302\037\000RQ\005\342\377\304\211\000RQ\005\343[\313\004\000RQ\005\343\134\302\013\000RQ\005\314q\302&\000RQ\005\314r\265\000RQ\005\314s\301\313\000RQ\005\343\002\304\357\000RQ\005\342\335\301=\000RQ\005\343\017\304\363\000RQ\005\342\353C\000RQ\005\314w\303\323\000RQ\005\314x\300g\000RQ\005\314y\3049\000RQ\005\343D\304\261\000RQ\005\343\030\302\347\000RQ\005\343G\313\350\000RQ\005\342\345\303\022\000RQ\005\343V\253\303\022\000RQ\005\314z\012\000RQ\005\314{\264\000RQ\005\314|\301)\000RQ\005\343\024\305\004\000RQ\005\342\366\302o\000RQ\005\3434\307\035\000RQ\005\343 \301i\000RQ\005\314}\303\014\000RQ\005\314~\301\026\000RQ\005\314\177\303\207\000RQ\005\342\364\304-\000RQ\005\342\361\302\343\000RQ\005\343,\307\263\000"},
+    {0x1E860,32,"RQ\005\342\376\303\017\000RQ\005\343l\335\036\000RQ\005\343\014\313E\000RQ\005\314\200\310[\000RQ\005\314\201\344\374\000RQ\005\314\202\300\263\000RQ\005\343\034\310P\000RQ\005\343P\346\024\000RQ\005\343W\3019\000RQ\005\314\204\203\000RQ\005\343a\302\237\000RQ\005\314\203\306<\000RQ\005\343\007\301\027\000RQ\005\314\205\305K\000RQ\005\3433\301\242\000RQ\005\342\371\336\211\000RQ\005\343'\337+\000RQ\005\342\333\313\251\000RQ\005\343)\313\227\000RQ\005\342\375\313\272\000RQ\005\342\332\313\240\000RQ\005\343h\307\326\000RQ\005\342\324\337j\000RQ\005\343\001\314\345\000RQ\005\314\206\305w\000RQ\005\342\370\310V\000RQ\005\343\032\314\343\000RQ\005\3439\310R\000RQ\005\343C\310U\000RQ\005\343\037\310T\000RQ\005\343F\345i\000RQ\005\343&\345q\000"},
+    {0x1E880,32,"RQ\005\342\374\253\310R\000RQ\005\343\021\253\310U\000RQ\005\343^\253\310T\000RQ\005\343B\301\321\000RQ\005\343\026\300\005\000RQ\005\343O\302H\000RQ\005\343e\305>\000RQ\005\343M\336\032\000RQ\005\343N\336\026\000RQ\005\343_\314\341\000RQ\005\342\337\314\353\000RQ\005\343X\345\224\000RQ\005\342\352\300\325\000RQ\005\343\012\230\000RQ\005\342\330\302\312\000RQ\005\342\367\303\227\000RQ\005\342\331\300\363\000RQ\005\343\015\305\223\000RQ\005\342\350\3029\000RQ\005\3438\310(\000RQ\005\342\344\305i\000RQ\005\343!\310,\000RQ\005\342\325\306w\000RQ\005\343c\306w\000RQ\005\342\356\306v\000RQ\005\343S\310+\000RQ\005\343U\310*\000RQ\005\343b\343\320\000RQ\005\343H\253\306v\000RQ\005\343\020\253\310+\000RQ\005\3435\253\310*\000RQ\005\343+\314\027\000"},
+    {0x1E8A0,32,"RQ\005\343\003\305_\000RQ\005\342\360\314\031\000RQ\005\314\207\314\026\000RQ\005\343\023\314\025\000RQ\005\343\027\314\030\000RQ\005\343E\306\134\000RQ\005\343#\313m\000RQ\005\342\336\307\275\000RQ\005\343;\307\276\000RQ\005\343\004\313l\000RQ\005\343\022\306/\000RQ\005\342\355\313o\000RQ\005\342\354\313n\000RQ\005\343R\235\000RQ\005\343\042\310M\000RQ\005\343(\304\310\000RQ\005\343$\306\207\000RQ\005\343f\310L\000RQ\005\343\036\306\206\000RQ\005\342\351\314\326\000RQ\005\342\346\310N\000RQ\005\343\077\314\363\000RQ\005\343g\310]\000RQ\005\343<\305y\000RQ\005\343-\314\370\000RQ\005\343]\303\253\000RQ\005\343`\300\307\000RQ\005\343>\304i\000RQ\005\343T\304\023\000RQ\005\342\373\302W\000RQ\005\3437\316\351\000RQ\005\342\363\303k\000"},
+    {0x1E8C0,5,"RQ\005\343K\346\223\000RQ\005\342\340\346\213\000RQ\005\343Q\346\236\000RQ\005\343\011\346\216\000RQ\005\342\342\346\231\000"},
+    {0x1E8C7,16,"RQ\0172\000RQ\0177\000RQ\017B\000RQ\017O\000RQ\017V\000RQ\017v\000RQ\017\201\000RQ\017u\000RQ\017\211\000RQ \036\356\022\000RQ \036\303(\000RQ \036\307\330\000RQ \036\304\014\000RQ \036\300H\304\014\000RQ \036\207\304\014\000RQ \036\304B\000"},
+    {0x1E900,32,"\3002\006\001\307)\000\3002\006\001\312\316\000\3002\006\001\310\013\000\3002\006\001\314\255\000\3002\006\001\300\042\000\3002\006\001\316\011\000\3002\006\001\300\363\000\3002\006\001\305\345\000\3002\006\001\235\000\3002\006\0019\000\3002\006\001\301\026\000\3002\006\001;\000\3002\006\0016\000\3002\006\001\300\353\000\3002\006\001\317\027\000\3002\006\001\301\024\000\3002\006\001\300\263\000\3002\006\001\300\337\000\3002\006\001\264\000\3002\006\0011\000\3002\006\001\313\340\000\3002\006\001\301\256\000\3002\006\001\203\000\3002\006\001\310\243\000\3002\006\001\300\005\000\3002\006\001\300\225\000\3002\006\001\301\313\000\3002\006\001\304\312\000\3002\006\001\300\307\000\3002\006\001\300\223\000\3002\006\001\306/\000\3002\006\001\307!\000"},
+    {0x1E920,32,"\3002\006\001\306\134\000\3002\006\001\300j\000\3002\004\001\307)\000\3002\004\001\312\316\000\3002\004\001\310\013\000\3002\004\001\314\255\000\3002\004\001\300\042\000\3002\004\001\316\011\000\3002\004\001\300\363\000\3002\004\001\305\345\000\3002\004\001\235\000\3002\004\0019\000\3002\004\001\301\026\000\3002\004\001;\000\3002\004\0016\000\3002\004\001\300\353\000\3002\004\001\317\027\000\3002\004\001\301\024\000\3002\004\001\300\263\000\3002\004\001\300\337\000\3002\004\001\264\000\3002\004\0011\000\3002\004\001\313\340\000\3002\004\001\301\256\000\3002\004\001\203\000\3002\004\001\310\243\000\3002\004\001\300\005\000\3002\004\001\300\225\000\3002\004\001\301\313\000\3002\004\001\304\312\000\3002\004\001\300\307\000\3002\004\001\300\223\000"},
+    {0x1E940,12,"\3002\004\001\306/\000\3002\004\001\307!\000\3002\004\001\306\134\000\3002\004\001\300j\000\3002\307)\306k\000\3002\021\306k\000\3002\305\077+\000\3002\300S\000\3002\3003>\000\3002\335\226\3003>\000\3002\301\306\000\3002\310H+\000"},
+    {0x1E950,10,"\3002\017\300%\000\3002\0172\000\3002\0177\000\3002\017B\000\3002\017O\000\3002\017V\000\3002\017v\000\3002\017\201\000\3002\017u\000\3002\017\211\000"},
+    {0x1E95E,2,"\3002X\301\257+\000\3002X\301\216+\000"},
+    {0x1EC71,32,"\300[\224\0362\000\300[\224\0367\000\300[\224\036B\000\300[\224\036O\000\300[\224\036V\000\300[\224\036v\000\300[\224\036\201\000\300[\224\036u\000\300[\224\036\211\000\300[\224\036\300H\000\300[\224\036\300\351\000\300[\224\036\301\200\000\300[\224\036\301\237\000\300[\224\036\301H\000\300[\224\036\302R\000\300[\224\036\301V\000\300[\224\036\302w\000\300[\224\036\3010\000\300[\224\0362\207\000\300[\224\0367\207\000\300[\224\036B\207\000\300[\224\036O\207\000\300[\224\036V\207\000\300[\224\036v\207\000\300[\224\036\201\207\000\300[\224\036u\207\000\300[\224\036\211\207\000\300[\224\0362\254\000\300[\224\0367\254\000\300[\224\036B\254\000\300[\224\036O\254\000\300[\224\036V\254\000"},
+    {0x1EC91,32,"\300[\224\036v\254\000\300[\224\036\201\254\000\300[\224\036u\254\000\300[\224\036\211\254\000\300[\224\036\300H\254\000\300[\224\036\300\351\254\000\300[\224\036\301\200\254\000\300[\224\036\301\237\254\000\300[\224\036\301H\254\000\300[\224\036\302R\254\000\300[\224\036\301V\254\000\300[\224\036\302w\254\000\300[\224\036\3010\254\000\300[\224\036\310\014\000\300[\224\036\342\023\000\300[\224\310\014+\000\300[\224\036\340\334\000\300[\224\036\340\335\000\300[\224\036\303Y2\000\300[\224\036\303Y7\000\300[\224\036\303YB\000\300[\224\036\303YO\000\300[\224\036\303YV\000\300[\224\036\303Yv\000\300[\224\036\303Y\201\000\300[\224\036\303Yu\000\300[\224\036\303Y\211\000\300[\224\310\214\000\300[\224\300\0162\3011\000\300[\224\300\0162o\000\300[\224\300\016B\302\206\000\300[\224\303\366+\000"},
+    {0x1ECB1,4,"\300[\224\036\301\0332\000\300[\224\036\301\0337\000\300[\224\036\301\033\300H\254\000\300[\224\301\033\310\014+\000"},
+    {0x1ED01,32,"\300\252\224\0362\000\300\252\224\0367\000\300\252\224\036B\000\300\252\224\036O\000\300\252\224\036V\000\300\252\224\036v\000\300\252\224\036\201\000\300\252\224\036u\000\300\252\224\036\211\000\300\252\224\036\300H\000\300\252\224\036\300\351\000\300\252\224\036\301\200\000\300\252\224\036\301\237\000\300\252\224\036\301H\000\300\252\224\036\302R\000\300\252\224\036\301V\000\300\252\224\036\302w\000\300\252\224\036\3010\000\300\252\224\0362\207\000\300\252\224\0367\207\000\300\252\224\036B\207\000\300\252\224\036O\207\000\300\252\224\036V\207\000\300\252\224\036v\207\000\300\252\224\036\201\207\000\300\252\224\036u\207\000\300\252\224\036\211\207\000\300\252\224\0362\254\000\300\252\224\0367\254\000\300\252\224\036B\254\000\300\252\224\036O\254\000\300\252\224\036V\254\000"},
+    {0x1ED21,29,"\300\252\224\036v\254\000\300\252\224\036\201\254\000\300\252\224\036u\254\000\300\252\224\036\211\254\000\300\252\224\036\300H\254\000\300\252\224\036\300\351\254\000\300\252\224\036\301\200\254\000\300\252\224\036\301\237\254\000\300\252\224\036\301H\254\000\300\252\224\036\302R\254\000\300\252\224\036\301V\254\000\300\252\224\036\302w\254\000\300\252\224\036\3010\254\000\300\252\224\343\251\000\300\252\224\301\033\0367\000\300\252\224\301\033\036B\000\300\252\224\301\033\036O\000\300\252\224\301\033\036V\000\300\252\224\301\033\036v\000\300\252\224\301\033\036\201\000\300\252\224\301\033\036u\000\300\252\224\301\033\036\211\000\300\252\224\301\033\036\300H\000\300\252\224\301\033\036O\207\000\300\252\224\301\033\036v\207\000\300\252\224\301\033\0367\254\000\300\252\224\301\033\036\300H\254\000\300\252\224\300\0162o\000\300\252\224\300\0162\310\327\000"},
+    {0x1EE00,4,"\011\015w\000\011\015\300\376\000\011\015\300\004\000\011\015\302\035\000"},
+    {0x1EE05,27,"\011\015\301\024\000\011\015\302p\000\011\015\246\000\011\015\301(\000\011\015]\000\011\015\300\337\000\011\015\300h\000\011\015Y\000\011\015\300\215\000\011\015\300\333\000\011\015\300\375\000\011\015\301.\000\011\015\301U\000\011\015\301D\000\011\015\3012\000\011\015\301\010\000\011\015\300\322\000\011\015\301\330\000\011\015\300\210\000\011\015\304\010\000\011\015\301`\000\011\015\302\260\000\011\015\301\261\000\011\015\301\375\300\376\000\011\015\301\375\300\215\000\011\015\301\375\301.\000\011\015\301\375\301D\000"},
+    {0x1EE21,2,"\011\015X\300\376\000\011\015X\300\004\000"},
+    {0x1EE24,1,"\011\015X\300\344\000"},
+    {0x1EE27,1,"\011\015X\246\000"},
+    {0x1EE29,10,"\011\015X]\000\011\015X\300\337\000\011\015X\300h\000\011\015XY\000\011\015X\300\215\000\011\015X\300\333\000\011\015X\300\375\000\011\015X\301.\000\011\015X\301U\000\011\015X\301D\000"},
+    {0x1EE34,4,"\011\015X\301\010\000\011\015X\300\322\000\011\015X\301\330\000\011\015X\300\210\000"},
+    {0x1EE39,1,"\011\015X\301`\000"},
+    {0x1EE3B,1,"\011\015X\301\261\000"},
+    {0x1EE42,1,"\011\015\302m\300\004\000"},
+    {0x1EE47,1,"\011\015\302m\246\000"},
+    {0x1EE49,1,"\011\015\302m]\000"},
+    {0x1EE4B,1,"\011\015\302m\300h\000"},
+    {0x1EE4D,3,"\011\015\302m\300\215\000\011\015\302m\300\333\000\011\015\302m\300\375\000"},
+    {0x1EE51,2,"\011\015\302m\301U\000\011\015\302m\301D\000"},
+    {0x1EE54,1,"\011\015\302m\301\010\000"},
+    {0x1EE57,1,"\011\015\302m\300\210\000"},
+    {0x1EE59,1,"\011\015\302m\301`\000"},
+    {0x1EE5B,1,"\011\015\302m\301\261\000"},
+    {0x1EE5D,1,"\011\015\302m\301\375\300\215\000"},
+    {0x1EE5F,1,"\011\015\302m\301\375\301D\000"},
+    {0x1EE61,2,"\011\015\301\311\300\376\000\011\015\301\311\300\004\000"},
+    {0x1EE64,1,"\011\015\301\311\300\344\000"},
+    {0x1EE67,4,"\011\015\301\311\246\000\011\015\301\311\301(\000\011\015\301\311]\000\011\015\301\311\300\337\000"},
+    {0x1EE6C,7,"\011\015\301\311Y\000\011\015\301\311\300\215\000\011\015\301\311\300\333\000\011\015\301\311\300\375\000\011\015\301\311\301.\000\011\015\301\311\301U\000\011\015\301\311\301D\000"},
+    {0x1EE74,4,"\011\015\301\311\301\010\000\011\015\301\311\300\322\000\011\015\301\311\301\330\000\011\015\301\311\300\210\000"},
+    {0x1EE79,4,"\011\015\301\311\301`\000\011\015\301\311\302\260\000\011\015\301\311\301\261\000\011\015\301\311\301\375\300\376\000"},
+    {0x1EE7E,1,"\011\015\301\311\301\375\301.\000"},
+    {0x1EE80,10,"\011\015\301\245w\000\011\015\301\245\300\376\000\011\015\301\245\300\004\000\011\015\301\245\302\035\000\011\015\301\245\300\344\000\011\015\301\245\301\024\000\011\015\301\245\302p\000\011\015\301\245\246\000\011\015\301\245\301(\000\011\015\301\245]\000"},
+    {0x1EE8B,17,"\011\015\301\245\300h\000\011\015\301\245Y\000\011\015\301\245\300\215\000\011\015\301\245\300\333\000\011\015\301\245\300\375\000\011\015\301\245\301.\000\011\015\301\245\301U\000\011\015\301\245\301D\000\011\015\301\245\3012\000\011\015\301\245\301\010\000\011\015\301\245\300\322\000\011\015\301\245\301\330\000\011\015\301\245\300\210\000\011\015\301\245\304\010\000\011\015\301\245\301`\000\011\015\301\245\302\260\000\011\015\301\245\301\261\000"},
+    {0x1EEA1,3,"\011\015\300\025\300\376\000\011\015\300\025\300\004\000\011\015\300\025\302\035\000"},
+    {0x1EEA5,5,"\011\015\300\025\301\024\000\011\015\300\025\302p\000\011\015\300\025\246\000\011\015\300\025\301(\000\011\015\300\025]\000"},
+    {0x1EEAB,17,"\011\015\300\025\300h\000\011\015\300\025Y\000\011\015\300\025\300\215\000\011\015\300\025\300\333\000\011\015\300\025\300\375\000\011\015\300\025\301.\000\011\015\300\025\301U\000\011\015\300\025\301D\000\011\015\300\025\3012\000\011\015\300\025\301\010\000\011\015\300\025\300\322\000\011\015\300\025\301\330\000\011\015\300\025\300\210\000\011\015\300\025\304\010\000\011\015\300\025\301`\000\011\015\300\025\302\260\000\011\015\300\025\301\261\000"},
+    {0x1EEF0,2,"\011\015\300\362Y\003\246\003\304\356\000\011\015\300\362\246\003\302\035\000"},
+    {0x1F000,32,"\301\006~\300\237\303-\000\301\006~\3004\303-\000\301\006~\300\310\303-\000\301\006~\275\303-\000\301\006~\302$\303\302\000\301\006~\303\314\303\302\000\301\006~@\303\302\000\301\006~2K\303w\000\301\006~7K\303w\000\301\006~BK\303w\000\301\006~OK\303w\000\301\006~VK\303w\000\301\006~vK\303w\000\301\006~\201K\303w\000\301\006~uK\303w\000\301\006~\211K\303w\000\301\006~2K\303q\000\301\006~7K\303q\000\301\006~BK\303q\000\301\006~OK\303q\000\301\006~VK\303q\000\301\006~vK\303q\000\301\006~\201K\303q\000\301\006~uK\303q\000\301\006~\211K\303q\000\301\006~2K\302F\000\301\006~7K\302F\000\301\006~BK\302F\000\301\006~OK\302F\000\301\006~VK\302F\000\301\006~vK\302F\000\301\006~\201K\302F\000"},
+    {0x1F020,12,"\301\006~uK\302F\000\301\006~\211K\302F\000\301\006~\3504\000\301\006~\347O\000\301\006~\307=\000\301\006~\325c\000\301\006~\354\307\000\301\006~\355M\000\301\006~\323\003\000\301\006~\361\024\000\301\006~\306O\000\301\006~\302\327\000"},
+    {0x1F030,32,"\300\010~\255\302\327\000\300\010~\337-\000\300\010~\337.\000\300\010~\337/\000\300\010~\3370\000\300\010~\3371\000\300\010~\3372\000\300\010~\3373\000\300\010~\3374\000\300\010~\3375\000\300\010~\3376\000\300\010~\3377\000\300\010~\3378\000\300\010~\3379\000\300\010~\337:\000\300\010~\337;\000\300\010~\337<\000\300\010~\337=\000\300\010~\337>\000\300\010~\337\077\000\300\010~\337@\000\300\010~\337A\000\300\010~\337B\000\300\010~\337C\000\300\010~\337D\000\300\010~\337E\000\300\010~\337F\000\300\010~\337G\000\300\010~\337H\000\300\010~\337I\000\300\010~\337J\000\300\010~\337K\000"},
+    {0x1F050,32,"\300\010~\337L\000\300\010~\337M\000\300\010~\337N\000\300\010~\337O\000\300\010~\337P\000\300\010~\337Q\000\300\010~\337R\000\300\010~\337S\000\300\010~\337T\000\300\010~\337U\000\300\010~\337V\000\300\010~\337W\000\300\010~\337X\000\300\010~\337Y\000\300\010~\337Z\000\300\010~\337[\000\300\010~\337\134\000\300\010~\337]\000\300\010~T\302\327\000\300\010~\3609\000\300\010~\360:\000\300\010~\360;\000\300\010~\360<\000\300\010~\360=\000\300\010~\360>\000\300\010~\360\077\000\300\010~\360@\000\300\010~\360A\000\300\010~\360B\000\300\010~\360C\000\300\010~\360D\000\300\010~\360E\000"},
+    {0x1F070,32,"\300\010~\360F\000\300\010~\360G\000\300\010~\360H\000\300\010~\360I\000\300\010~\360J\000\300\010~\360K\000\300\010~\360L\000\300\010~\360M\000\300\010~\360N\000\300\010~\360O\000\300\010~\360P\000\300\010~\360Q\000\300\010~\360R\000\300\010~\360S\000\300\010~\360T\000\300\010~\360U\000\300\010~\360V\000\300\010~\360W\000\300\010~\360X\000\300\010~\360Y\000\300\010~\360Z\000\300\010~\360[\000\300\010~\360\134\000\300\010~\360]\000\300\010~\360^\000\300\010~\360_\000\300\010~\360`\000\300\010~\360a\000\300\010~\360b\000\300\010~\360c\000\300\010~\360d\000\300\010~\360e\000"},
+    {0x1F090,4,"\300\010~\360f\000\300\010~\360g\000\300\010~\360h\000\300\010~\360i\000"},
+    {0x1F0A0,15,"\300F\3006\302\327\000\300F\3006\305\322K\302\252\000\300F\30067K\302\252\000\300F\3006BK\302\252\000\300F\3006OK\302\252\000\300F\3006VK\302\252\000\300F\3006vK\302\252\000\300F\3006\201K\302\252\000\300F\3006uK\302\252\000\300F\3006\211K\302\252\000\300F\3006\300HK\302\252\000\300F\3006\306LK\302\252\000\300F\3006\301\226K\302\252\000\300F\3006\302cK\302\252\000\300F\3006\3027K\302\252\000"},
+    {0x1F0B1,15,"\300F\3006\305\322K\302K\000\300F\30067K\302K\000\300F\3006BK\302K\000\300F\3006OK\302K\000\300F\3006VK\302K\000\300F\3006vK\302K\000\300F\3006\201K\302K\000\300F\3006uK\302K\000\300F\3006\211K\302K\000\300F\3006\300HK\302K\000\300F\3006\306LK\302K\000\300F\3006\301\226K\302K\000\300F\3006\302cK\302K\000\300F\3006\3027K\302K\000\300F\3006\302$\306O\000"},
+    {0x1F0C1,15,"\300F\3006\305\322K\302\233\000\300F\30067K\302\233\000\300F\3006BK\302\233\000\300F\3006OK\302\233\000\300F\3006VK\302\233\000\300F\3006vK\302\233\000\300F\3006\201K\302\233\000\300F\3006uK\302\233\000\300F\3006\211K\302\233\000\300F\3006\300HK\302\233\000\300F\3006\306LK\302\233\000\300F\3006\301\226K\302\233\000\300F\3006\302cK\302\233\000\300F\3006\3027K\302\233\000\300F\30068\306O\000"},
+    {0x1F0D1,32,"\300F\3006\305\322K\302\232\000\300F\30067K\302\232\000\300F\3006BK\302\232\000\300F\3006OK\302\232\000\300F\3006VK\302\232\000\300F\3006vK\302\232\000\300F\3006\201K\302\232\000\300F\3006uK\302\232\000\300F\3006\211K\302\232\000\300F\3006\300HK\302\232\000\300F\3006\306LK\302\232\000\300F\3006\301\226K\302\232\000\300F\3006\302cK\302\232\000\300F\3006\3027K\302\232\000\300F\3006@\306O\000\300F\3006\335\005\000\300F\3006\356\314\000\300F\3006\356\327\000\300F\3006\356\332\000\300F\3006\356\333\000\300F\3006\356\334\000\300F\3006\356\335\000\300F\3006\356\336\000\300F\3006\356\337\000\300F\3006\356\340\000\300F\3006\356\315\000\300F\3006\356\316\000\300F\3006\356\317\000\300F\3006\356\320\000\300F\3006\356\321\000\300F\3006\356\322\000\300F\3006\356\323\000"},
+    {0x1F0F1,5,"\300F\3006\356\324\000\300F\3006\356\325\000\300F\3006\356\326\000\300F\3006\356\330\000\300F\3006\356\331\000"},
+    {0x1F100,32,"\017\300%\300\324\300k\000\017\300%\300\251\000\0172\300\251\000\0177\300\251\000\017B\300\251\000\017O\300\251\000\017V\300\251\000\017v\300\251\000\017\201\300\251\000\017u\300\251\000\017\211\300\251\000\301b.0\017\300%\000\301b\300\020.0\017\300%\000.\300%\003\302j\000.\301\373\034\000.\304&\002\003\310s\304\033\000\204\010\006\001\025\000\204\010\006\001\077\000\204\010\006\001\3005\000\204\010\006\001\300\024\000\204\010\006\0019\000\204\010\006\001\300u\000\204\010\006\001\300\003\000\204\010\006\001\300\026\000\204\010\006\001;\000\204\010\006\001\300U\000\204\010\006\001\300\011\000\204\010\006\001p\000\204\010\006\001\261\000\204\010\006\001\232\000\204\010\006\0016\000\204\010\006\001\300<\000"},
+    {0x1F120,32,"\204\010\006\001\300\260\000\204\010\006\001c\000\204\010\006\001d\000\204\010\006\001\300\007\000\204\010\006\0011\000\204\010\006\001\300\015\000\204\010\006\001\300P\000\204\010\006\001\300>\000\204\010\006\001\300$\000\204\010\006\001\300 \000\301\276\301g\3036\010\006\001d\000.-\010\006\001\3005\000.-\010\006\001c\000.\312\235\000.\361=\000\3315\014\000f\010\006\001\025\000f\010\006\001\077\000f\010\006\001\3005\000f\010\006\001\300\024\000f\010\006\0019\000f\010\006\001\300u\000f\010\006\001\300\003\000f\010\006\001\300\026\000f\010\006\001;\000f\010\006\001\300U\000f\010\006\001\300\011\000f\010\006\001p\000f\010\006\001\261\000f\010\006\001\232\000f\010\006\0016\000f\010\006\001\300<\000"},
+    {0x1F140,32,"f\010\006\001\300\260\000f\010\006\001c\000f\010\006\001d\000f\010\006\001\300\007\000f\010\006\0011\000f\010\006\001\300\015\000f\010\006\001\300P\000f\010\006\001\300>\000f\010\006\001\300$\000f\010\006\001\300 \000f\306A\000f\305o\000f\352\204\000f\306\351\000f\350^\000f\316\364\000\300\020.\010\006\001\025\000\300\020.\010\006\001\077\000\300\020.\010\006\001\3005\000\300\020.\010\006\001\300\024\000\300\020.\010\006\0019\000\300\020.\010\006\001\300u\000\300\020.\010\006\001\300\003\000\300\020.\010\006\001\300\026\000\300\020.\010\006\001;\000\300\020.\010\006\001\300U\000\300\020.\010\006\001\300\011\000\300\020.\010\006\001p\000\300\020.\010\006\001\261\000\300\020.\010\006\001\232\000\300\020.\010\006\0016\000\300\020.\010\006\001\300<\000"},
+    {0x1F160,32,"\300\020.\010\006\001\300\260\000\300\020.\010\006\001c\000\300\020.\010\006\001d\000\300\020.\010\006\001\300\007\000\300\020.\010\006\0011\000\300\020.\010\006\001\300\015\000\300\020.\010\006\001\300P\000\300\020.\010\006\001\300>\000\300\020.\010\006\001\300$\000\300\020.\010\006\001\300 \000\301T\314\227\002\000\301T\343\321\002\000\301T\344\212\002\000.\312\234\000.\3005\003\310s\304\033\000.\307\327\303\310\000\300\020f\010\006\001\025\000\300\020f\010\006\001\077\000\300\020f\010\006\001\3005\000\300\020f\010\006\001\300\024\000\300\020f\010\006\0019\000\300\020f\010\006\001\300u\000\300\020f\010\006\001\300\003\000\300\020f\010\006\001\300\026\000\300\020f\010\006\001;\000\300\020f\010\006\001\300U\000\300\020f\010\006\001\300\011\000\300\020f\010\006\001p\000\300\020f\010\006\001\261\000\300\020f\010\006\001\232\000\300\020f\010\006\0016\000\300\020f\010\006\001\300<\000"},
+    {0x1F180,32,"\300\020f\010\006\001\300\260\000\300\020f\010\006\001c\000\300\020f\010\006\001d\000\300\020f\010\006\001\300\007\000\300\020f\010\006\0011\000\300\020f\010\006\001\300\015\000\300\020f\010\006\001\300P\000\300\020f\010\006\001\300>\000\300\020f\010\006\001\300$\000\300\020f\010\006\001\300 \000\302\266\300\020f\010\006\001\300<\000\300\020f\307\333\000\300\020f\230\000\300\020f\271\000\300\020f\301\372\000\300\020f\316\364\000,\332w\000f\325\205\000f\3311\000f\305<\000f\337\314\000f\3007\000f\302\022\000f\306\227\000f\354\247\000fb\003\301\257+\000f\360\240\000fB\300\024\000f\303\237\305\242\000f7\300\011\000fO\300\011\000fu\300\011\000"},
+    {0x1F1A0,14,"fV\301\2522\000f\201\301\2522\000f\3110\301\2527\000f\302R\300<\000f2\207\300\351\300<\000f\010\004\001\300\024\000f\336w\000f\336x\000f\336\261\000f\342\232\000f\354B\000f\357\222\000f\360\217\000\310&\311F\014\000"},
+    {0x1F1E6,29,"\301\266\301Y\014\001\025\000\301\266\301Y\014\001\077\000\301\266\301Y\014\001\3005\000\301\266\301Y\014\001\300\024\000\301\266\301Y\014\0019\000\301\266\301Y\014\001\300u\000\301\266\301Y\014\001\300\003\000\301\266\301Y\014\001\300\026\000\301\266\301Y\014\001;\000\301\266\301Y\014\001\300U\000\301\266\301Y\014\001\300\011\000\301\266\301Y\014\001p\000\301\266\301Y\014\001\261\000\301\266\301Y\014\001\232\000\301\266\301Y\014\0016\000\301\266\301Y\014\001\300<\000\301\266\301Y\014\001\300\260\000\301\266\301Y\014\001c\000\301\266\301Y\014\001d\000\301\266\301Y\014\001\300\007\000\301\266\301Y\014\0011\000\301\266\301Y\014\001\300\015\000\301\266\301Y\014\001\300P\000\301\266\301Y\014\001\300>\000\301\266\301Y\014\001\300$\000\301\266\301Y\014\001\300 \000,\300\035\337$\000fH\341n\000fH\271\000"},
+    {0x1F210,32,"fW\300\327\337\341\000fW\300\327\337\335\000fW\300\327\337\325\000fH\301\350\000fW\300\327\313\307\000fW\300\327\337\333\000fW\300\327\337\366\000fW\300\327\337\334\000fW\300\327\337\317\000fW\300\327\337\350\000fW\300\327\337\357\000fW\300\327\337\346\000fW\300\327\337\322\000fW\300\327\337\340\000fW\300\327\337\320\000fW\300\327\337\347\000fW\300\327\337\321\000fW\300\327\337\365\000fW\300\327\337\360\000fW\300\327\337\367\000fW\300\327\337\332\000fW\300\327\337\330\000fW\300\327\337\355\000fW\300\327\337\342\000fW\300\327\337\344\000fW\300\327\337\315\000fW\300\327\313\306\000fW\300\327\337\371\000fW\300\327\337\337\000fW\300\327\337\316\000fW\300\327\337\326\000fW\300\327\337\343\000"},
+    {0x1F230,12,"fW\300\327\337\370\000fW\300\327\313\310\000fW\300\327\337\363\000fW\300\327\337\364\000fW\300\327\337\327\000fW\300\327\337\354\000fW\300\327\337\352\000fW\300\327\337\351\000fW\300\327\337\361\000fW\300\327\337\323\000fW\300\327\337\331\000fW\300\327\337\372\000"},
+    {0x1F240,9,"\301\276\301g\3036W\300\327\337\353\000\301\276\301g\3036W\300\327\313\306\000\301\276\301g\3036W\300\327\313\307\000\301\276\301g\3036W\300\327\337\336\000\301\276\301g\3036W\300\327\337\356\000\301\276\301g\3036W\300\327\313\310\000\301\276\301g\3036W\300\327\337\362\000\301\276\301g\3036W\300\327\337\324\000\301\276\301g\3036W\300\327\337\345\000"},
+    {0x1F250,2,".\300'\322<\000.\300'\322,\000"},
+    {0x1F260,6,"\302\213\014)\303\207\000\302\213\014)\301\265\000\302\213\014)\354(\000\302\213\014)\302\223\000\302\213\014)\3543\000\302\213\014)\324\330\000"},
+    {0x1F300,32,"\331h\000\334\376\000\301\005\305\302\000\306\214\003\355\003\000\316C\223\344\203\000\316C\000\312\260\301\234\333\256\000\355O\223\312\211\000\3512\000\304}\301\234\306\214\000\302\255\301\134\000\360\223\000\344@\305\306\000\302\134\3061\334K\000\302\134\3061\322~\000\302\134\3061\322\336\000\3061\003\343\350\000\3007\301\211\014\000\316\363\304\207\301\211\014\000\303\205\3011\301\211\014\000\316\363\313\200\301\211\014\000\300\324\301\211\014\000\316\355\313\200\301\211\014\000\310\016\3011\301\211\014\000\316\355\304\207\301\211\014\000\304\207\301\211\000\3007\301\211\003i\000\303\205\3011\301\211\003i\000\310\016\3011\301\211\003i\000\300\324\301\211\003i\000\302l\003i\000\335\360\300\261\000"},
+    {0x1F320,32,"\354\033\300\261\000\316~\0008\313\016\000@\302l\000@\302l\003\004\303;\000@\302l\307C\303;\000@\302l\307C\303;\003\304N\000\303;\003\304N\000\303;\003\310\336\000\303;\003\305e\000\303;\003\356\240\000\334\375\000\303-\312xi\000\305L\304\215\000\355\335\000\324\240\000\325D\000\352\221\000\334M\303h\000\332\020\303h\000\304\320\303h\000\324\324\000\305L\315M\000\357\023\000\325B\312w\000\351\272\000\336\262\000\355N\000\312w\000\304(K\343\220\000\304(K\304\332\000\336\224\000"},
+    {0x1F340,32,"O\301\356\325\230\000\343\240\301\356\000\334\266\301\356\000\301\356\313Q\300\241\303-\000\344\256\000\356\221\000\322\367\000\336\013\000\314\235\000\360\356\000\355\354\000\3429\000\323\360\000\350\036\000\302$\3121\000\303\314\3121\000\347\314\000\347\311\000\325A\000\355\034\000\336_\000\316\025K\350&\000\306y\300\216\305\347\000\350U\302\017\000\304\332\331F\000\304\332\302\330\000\331/\304\332\000\331_\031\304\332\000\355\011\307I\000\354\257\000\312\205\000\313Z\335\034\000"},
+    {0x1F360,32,"\351\257\316J\315u\000\331\341\000\347.\000\355]\000\335\033\315\370\000\303F\307T\003\305\257\332,\000\302\251\303\321\312\274\000\353\373\303\321\000\303\321\312\274\000\333\223\000\312\271\000\325[x\000\324\341\000\342\212\000\331a\000\337&\306\255\000\354%\000\3243e\000\306\255K\306&\000\3310\000\306(\031\304\271\000\356\012\305\307\313\230\000\352L\305\350\031\305#\000\307\025\304\241\000\326\002\304\241\000\316\251\313\013\000\312^\306\201\000\312\261\312^\344\227\000\304u\305\350\000\306(\031\304\271\003\350,\000\305\350\003\350L\3317\000\350J\000"},
+    {0x1F380,32,"\303 \000\361-\350f\000\324R\307T\000\340V\000\307]\303h\000\313F\307]\000\334\341\000\334\340\354\260\000\307;\000\310}\350K\000\331\035\302\330\000\355\352\303h\000\302\266\334\361\000\350\035\312\350\000\303\322\313\002\000\324\357\355\035\000\303-\325O\000\301\211\360|\325#\000\310\276\352i\000\336\007\305\356\000\301{\003\302\005\300\216\301\011(\000\312\202K\334\371\000\3106\305k\000\351`\303 \000$\305[\003\340W\000\355/\314\247\000\314>\354\205\000\304\204\341`\000\305\344\312:$\305|\000\305\344\307\212$\305|\000\313J\335\027\000\3229\356d\000"},
+    {0x1F3A0,32,"\324\356\303\214\000\334\312\307\024\000\315\277\325\377\000\334\344\305\221\031\303F\000\314\247\000\344\206\305\353\000\325}\000\336\203\000\322\324\347\204\000\300\365\3046\000\325\200\311\010\000\356c\000\325\210\305\026\000\347\336\3129\000\316\343\313g\000\307\214\313\254\000\354\211\310!\000\324M\000\313g\303\277\000\324u\000\305:\300F\324\354\000$\301\251\000\302\301$\305|\000\352t\000\336\034\000$\305[\000\356\341\000\360\202\000$\352|\000\310\267\354\024\003\352h\000\316t\315\227\031\302\330\000\316\024\031\316\024\312\200\000"},
+    {0x1F3C0,32,"\324\001\031\337)\000\325@\302\344\000\354\222\000\351\350\000\355Z\000\354\303\305k\000\356\313\000\303\214\310\250\000\322}\313T\000\351\341\313T\000\355e\000\304\377\342]\000\335\371\000\310\250\344\177\000\310\250\303\271\000\312\275\307\077\031\302\330\000\360\224\000\313I\313\260\303\377\031\302\330\000\303\321\313\260\303\377\031\350\205\000\311\003\316t\347z\031\302\330\000\310\336\324\350\303\342\000\324\336\000\324\042\003\305\302\000\305\030\307l\000\304\252\312\211\000\312\260\000\332(\304\252\305\030\000\325\212\305\030\000\312\357\000\312\357\340L\000\314\322\347\257\000\354\372\000"},
+    {0x1F3E0,32,"\304\252\305\030\000\304\252\003\335}\000\310k\305\030\000\303\322\310\222\310k\000\313@\310\222\310k\000\337_\000\307>\000\323\002\356\030\310!\000\313\267\000\310\033\313\267\000\331.\3169\000\310\276\000\332%\3169\000\334\256\000\340U\342\032\000\303\322\307X\000\313@\307X\000@\315J\0008\315J\000\311\077@\302\344\000\311\0778\302\344\000\310\265\0008\310\265\000\341\334\000\323\341\315\227\031\354@\000\304|\031\034\000\322\200\000\303\201>\3057\357;\000\303\201>\3057\316\310\000\303\201>\3057\316\311\000\303\201>\3057\316\312\000\303\201>\3057\316\313\000"},
+    {0x1F400,32,"\306\273\000\304C\000\306\232\000\302\255\324\221\000\305!\000\306\370\000\342B\000\315\226\000\302\265\000\303\302\000\331J\000\316\370\000\354\217\000\306\344\000\303\214\000\306\272\000\335\364\000\310\311\000\305m\000\351\270\000\325I\000\304\215\000\306\250\000\312y\000\307\232\000\347-\000\304W\301g\000\324\222\000\322\235\000\337'\000\341\343\312_\000\303F\000"},
+    {0x1F420,32,"\316\251\303F\000\324c\000\305\276\000\336o\307[\000\304u\307[\000\335\035\304u\307[\000\305\346\000\347\327\000\341g\000\350H\000\333\230\312\223\000\323\337\312\223\000\332\210\000\304Ci\000\305!i\000\306\370i\000\315\226i\000\302\265i\000\303\302i\000\354\305\316\370\000\303\214i\000\305mi\000\304\215i\000\306\250i\000\307\270i\000\336ai\000\361\037i\000\312\134i\000\347\223i\000\306\250\303\033\000\310~\350l\000\325R\000"},
+    {0x1F440,32,"\301\260\000\303D\000\304(\000\303\033\000\300\347\000\302U\000@b\300]\303\265k\000@t\300]\303\265k\000@(\300]\303\265k\000@&\300]\303\265k\000\334\345\301o\002\000\311\077\301o\002\000\306\227\301o\002\000\306\367b\002\000\306\367t\002\000\325\211\303\212\002\000\262\303\212\002\000\312\301\000\307\026\3046\000\334`\000\345L\000\355\244\000\340a\000\313\012\000\341<\000\324K\000\307\026\307c\000\350\224\000\336c\000\350T\000\343\232\304S\000\322\355\304S\000"},
+    {0x1F460,32,"\336\274\304S\000\307\026\315\324\000\307\026\324h\000\335\006\000\324\244\300\241\306\336\000\324\245\300\241\306\336\000\324w\000\335\345\000\301\360\000\304\026\000\313D\000\301\360\031\304\026\304\247\303\212\0007\303\032\304\247\303\212\0007\361 \304\247\303\212\000\306\253\3472\000\304\026\003\324\231\313\034\000\324\204\003\3603\000\301\362\003\324a\3045\000\301\360\003\336\025\300\325\343\237\000\301\360\003\316\274\000\310l\301\360\000\310l\304\026\000\304u\000\307l\361%\000\350k\000\303\322\3474\000\303\322\335\365\000\307\304\000\304u\322\211\000\334\134\312\037\000\312\037\344t\000\340 \000"},
+    {0x1F480,32,"\310\332\000\307\337\332-\301\362\000\336\031\000\331\337\000\342s\000\344\372\310\217\000i\343\263\000\336V\000\323\370\305\221\000\355\222\000\350\030\000\304\270+\000\310\033\001\000\240\000\335\225\310\357\000\304\270\000\312\202\000\331B\003\301{\000\360\367\000\324'\301{\000\304~\301{\0007\302K\000\354\262\301{\000\336\024\301{\000\301{\003\034\000\303\267\301{\000\303\314\301{\000\305\313\301{\000\310\235\301{\000\301{\003\303 \000\315\254\302K\000\301{\312\350\000"},
+    {0x1F4A0,32,"\300\360\353\370\003\025<\302!\000\306\026{\324\223\000\307,\014\000\324f\000\310\333\014\000\326\011\014\000\354\276\306\363\014\000\313\016\000\301\025\014\000\350\027K\305\223\000\334\366\324C\000\312\376\014\000\304V\307;\000\311\020\307;\000@\305:\000\207\350A\014\000\314\266\305\337\000\303<\334Q\000L\304&\002\000\307s\3006\000\305\342\003\305\314\002\000\305\342\003\304&\002\000\305\342\003\313\077\002\000\305\342\003\306\256\002\000\314\266\003\361\021\000\305\033\003\277\311%\031\305\314\002\000\352\214\000\315Q\307i\000\324\205\000\344E\000\306$\305'\000\315+\300\343\000"},
+    {0x1F4C0,32,"\333\263\000\3056\3040\000\262\3056\3040\000\303W\003\301\347\000\303W\3054b\000\307U\000\356\015\307U\000\3006k\000\305\033\003\277\311%\000\305\033\003\267\311%\000x\305\033\000\325\223\000\310\236\000\302\314\310\236\000\347\247\000\301F\315\306\000\301\366\315\306\000\312~\355\334\000\3420\000\314\377\000\314\377\003\332\022\307q\000\301\005\304{\000\262\304{\000\303\314\304{\000\303\267\304{\000\304\315\304{\000\324g\000\303\345\323\340\000\352\201\000\343\342\000\302\372\306\274\000\347|\000"},
+    {0x1F4E0,32,"\307\246\310!\000\315\330\312)\000\350\204\3224\342\236\000\3258\343\333\000\347]\316\235\000\340#\316\235\000\347x\000\333\307\014\000\340&\303\202\000\303\202\003\267\034'\000\301\005\306t\003\314P\302\344\000\301\005\306t\003\301T\302\344\000\262\306t\003\301T\302\344\000\262\306t\003\314P\302\344\000\350P\000\306\254\301R\000\314\336\000\305l\306\246\000\305l\306\246\003\134\034\301\234(\000\360t\344Z\000\305l\306\246\3471\000\301#\305l\347\374\000\312)\003\305\021\000\305\353\000\305\353\003\334\363\000\316\343\305\353\000\356\027\000\315\230\000\360u\000\313J\350t\000\350M\355\014\000\350`\324#\000"},
+    {0x1F500,32,"\357.\134\302C\000\302[\134\031n\262y\302C\000\302[\134\031n\262y\302C\003.2\301\336\000\302[\267\031\277\262y\302C\000\301\373\267\031\277\262y\302C\000\210\312\207\014\000\217\312\207\014\000\304U\003\305\354I\000\304U\000\304U\0032\302S\301\134\000\304U\003B\302S\311>\000\312U\000\306\026\3502\000\302\016\314\213\304\241\000\301\325\314\213\304\241\000\306o\003\3402\304\323\000\301\005\306o\003\303\221\000\303\221\000\306o\000\262\306o\000\304\036\000\304\036\003\305\354I\000\312~\000\314E\014\000\315\230\304\201\000\302\327\003n\034'\000\301l\003n\034'\000\300\216\003\301\257+\003(&\034'\000\354\243\003\134\034'\000\300\365\003\277\034'\000\301#2\303j\303\200\014\000\313\373\300H\000"},
+    {0x1F520,32,"\305O\014)\010\006\310\025\000\305O\014)\010\004\310\025\000\305O\014)\346{\000\305O\014)\310\377\000\305O\014)\010\310\025\000\303\016\000\306\026\356\237\000\316\377\000\3068\000\315\013\031\307H\000\337\042\000\350$\000\344,\000\356\026\000\331U\302\330\000v\301;\300\261\003M<\000\303\322\014)\324-\000\305\272\334\030\0008,\304\201\000@,\304\201\000\300#\302$y\000\300#\303\267y\000\300#\304\315\300\360\000\300#\303\267\300\360\000\004\304\315\300\360\000\004\303\267\300\360\000\302V\302$\260\000\302\270\302$\260\000\302V\004\302$\260\000\302\270\004\302$\260\000l&\302\316@y\000s&\302\316@y\000"},
+    {0x1F540,32,".\300\323\310\220\000\300\323\310\220\003\305H:\000\300\323\310\220\000\303V(\305\244\003B\214\000\303V&\305\244\003B\214\000\014)\343\250\3251\000@\010\300\323\000L\010\300\323\000\325\031\300\323\000\302\303\014\000\313\007K\310\177\000\340\301\000\344|\000\355\213\000\343\345\003\211\324~\000\307IK\337\226\000\301\235i2\302\361\000\301\235i7\302\361\000\301\235iB\302\361\000\301\235iO\302\361\000\301\235iV\302\361\000\301\235iv\302\361\000\301\235i\201\302\361\000\301\235iu\302\361\000\301\235i\211\302\361\000\301\235i\300H\302\361\000\301\235i\302\340\302\361\000\301\235i\302\220\302\361\000\301\235i\347<\000\301\235i\3572\000\301\235i\356L\000\301\235i\335\024\000"},
+    {0x1F560,32,"\301\235i\334\350\000\301\235i\354r\000\301\235i\353\250\000\301\235i\334\006\000\301\235i\345\271\000\301\235i\356\033\000\301\235i\334\023\000\301\235i\357)\000&\304U\000&\304U\0032\302S\301\134\000&\304U\003B\302S\311>\000\312\212\000\312\212\003\302S\311>\000\351\236\304\036\000\304{\000\324\340\000\343\235\301\235\0008\310\332\031\312\277\000\301#\350!\000\313\261\000\301\360\300\241\324\242\303\243\342J\000\354\203\300\037\354\314\000\312\331\316B\000\316)\000\316)\360\366\000\340\221\000\301\360\331\340\000(\301o\302\372\306\274\000\302\372\306\274\003\303W\000&\301o\302\372\306\274\000@\316\230\302\372\0008\316\230\302\372\000"},
+    {0x1F580,32,"\302\372\300\216\300\365K\344]\000\325\207\305l\306\246\000\302\327K\303\202\000\3164\303\202\000\303\202\003\305e\000\307\261\303\202\000\304\323\223\3164\303\202\000\342p\347\250\0008\310\236\000l(\306\242\000l(\323\357\304\323\000l(\313X\304\323\000l(\347\177\000l(\331G\000(\317\001\301o\000\241\306\227\301o\002\000\301T\301o\003\301n\316,\000\300:\301T\301o\003\301n\316,\000\300:\306\367b\002\000\300:\306\367t\002\000\300:\316\341\301o\000\300:\301o\003M\303E\301\351\000\301T\301o\003\310|\301\254M\031\240\301n\000@t\300](\301ok\000\302%@(\300]k\000\302%@&\300]k\000\302%8(\300]k\000\302%8&\300]k\0008(\300]\303\265k\0008&\300]\303\265k\000\302%@b\300]k\000\302%@t\300]k\000"},
+    {0x1F5A0,32,"\302%8b\300]k\000\302%8t\300]k\0008b\300]\303\265k\0008t\300]\303\265k\0008\301{\000\312\360\307i\000\305[\031\304C\000B\345V\331\033\000\315z\000\350;\324\333\0008\303L\301g\306$\305'\000@\303L\301g\306$\305'\000\302\251\301g\306$\305'\000\316j\324\363\000\361\025\305[\0002\304\201\304C\0007\304\201\304C\000B\304\201\304C\000\356\252\000%\315Q\307i\000\303L\305'\000\305\242\000\315z\307\334\000\307\246\307\334\000\315+\300\343\307\334\000\305*\003\303\244\000\305*\003\303\244\031\310\206\000\305*\003\310\206\000\306+\003\310\206\000\306+\003\356l\000\306+\003\3016\300>\0008\3040\000"},
+    {0x1F5C0,32,"\3040\000\262\3040\000\3006k\332q\000\3006\3056e\000\3056\324\322\000\302x\301\251\000\302x\301\251\303W\000\302x\301\251\305\206\000\301\251\000\301\251\303W\000\301\251\305\206\000\302x\305*\000\302x\303W\000\302x\3158\000\305*\000\303W\000\3158\000\360\353\000\304W\301\251\305\206\000\304W\307U\305\206\000\312\360\316\372\000\344F\000\343\276\000\310t\000\302[&\031(\305\244\302C\000\305\354\300>\000\307\336\313S\316\021\014\000\312\351\313S\316\021\014\000\331\032\000%\303\221\000\351\264\314\336\000\303W\003.\303\244\000"},
+    {0x1F5E0,32,"\310\356\305\033\000\304 \304\271\000\303\332\000\354\266\301\225\300\241\306\336\000B\303\037'\000B\303\037:\000B\303\037(\000B\303\037&\000(\304V\303s\000&\304V\303s\0007\304V\307N\000B\304V\307N\000(\311\020\303s\000&\311\020\303s\000(\307,\303s\000&\307,\303s\000\310=\303s\000\305e\310=\303s\000\305e\310=\000\302\263e\003\302\263\000\302\263\236\300>\000\302\263e\003\236\300>\000\302\263\032\236\300>\000\302\263e\003\032\236\300>\000{\302\231+\000\302\263e\003\032\302\231\000\361&\305f\000\344\202\335!\000\356\217\356\247\000\355\006K\342U\000\306\336K\340]\000\344\210\000"},
+    {0x1F600,32,"\305Ei\000\305Ei\003\301\326\301\260\000i\003\311\007K\307\357\000\301\326i\003\262\300\347\000\301\326i\003\262\300\347\031\301\326\301\260\000\301\326i\003\262\300\347\031\307f\306\363\000\301\326i\003\262\300\347\031\316\202\301\260\000\301\326i\003\336\134\000\301\326i\003\313\265\000\316\374i\000\301\326i\003\301\326\301\260\000i\352p\332\034\306&\000\315\246i\000\301\326i\003\313\236\301\260\000\301\326i\003\316B\000\354\215i\000\301\020i\000\334Yi\000\357\236i\000i\003\307f\306\363\000\347\332i\000\331 i\000\331\037i\000\306Wi\000i\356M\025\304\270\000\306Wi\003\301\326\301\260\000\306Wi\003\301\005\301\260\000i\003\310\365\302U\000i\003\310\365\302U\031\316\374\303D\000i\003\310\365\302U\031\316\202\301\260\000\312\373i\000\361(i\000"},
+    {0x1F620,32,"\322\214i\000\310\223i\000\307ui\000\347\340i\000i\003\342\224K\356\303\000\312\373\3037\315\246i\000\306-i\003\262\300\347\000\322\216i\000\334\301i\000\316\365i\000\354\202i\000\356vi\000\336\022i\000\342\235\307ui\000i\003\262\300\347\000\337wi\000i\003\262\300\347\031\307f\306\363\000i\352\177\300\241\334\300\000\322\346i\000\334\373i\000\310\333i\000\312\376i\000i\305\307\300\347\000i\003\343\326\310&\000\305E\302\265i\003\301\326\301\260\000\302\265i\003\311\007K\307\357\000\301\326\302\265i\003\262\300\347\000\301\326\302\265i\003\313\236\301\260\000\302\265i\003\3611\305\251\000\306W\302\265i\003\301\005\301\260\000\310\223\302\265i\000\307u\302\265i\000"},
+    {0x1F640,32,"\316\365\302\265i\000\306\342\306-i\000\306\342\301\326i\000\357\263i\000i\003\315\300\301\260\000i\003\301#\335\374\313v\000i\003\306\227\313v\000\301\362\324t\332\025\000\352\220\305m\000\336\205\305m\000\354\265\305m\000\336j\301\362\315\2312\301o\000\301\362\315\231\312\201\303\212\300\241\325\027\000\301\362\306-\000\301\362\003\310\223i\000\301\362\003\334\377\303\212\000\275\300\310\300]\301\356\000\3004\300\310\300]\301\356\000\275\300\237\300]\301\356\000\3004\300\237\300]\301\356\000\241\275\300\310\300]\301\356\000\241\3004\300\310\300]\301\356\000\241\275\300\237\300]\301\356\000\241\3004\300\237\300]\301\356\000\275\300\310\300]\303\254\301\356\000\3004\300\310\300]\303\254\301\356\000\275\300\237\300]\303\254\301\356\000\3004\300\237\300]\303\254\301\356\000L\275\300\310\300]\303\254\301\356\000L\3004\300\310\300]\303\254\301\356\000L\275\300\237\300]\303\254\301\356\000L\3004\300\237\300]\303\254\301\356\000"},
+    {0x1F660,32,"\275\300\310\300]\303\270\000\3004\300\310\300]\303\270\000\275\300\237\300]\303\270\000\3004\300\237\300]\303\270\000L\275\300\310\300]\303\270\000L\3004\300\310\300]\303\270\000L\275\300\237\300]\303\270\000L\3004\300\237\300]\303\270\000\313\262\306\266,\300\231\000\313\262\306\266,\300\231\300\2418,\000\316 \306\266,\300\231\000\316 \306\266,\300\231\300\2418,\000n\305\237\000\277\305\237\000\134\305\237\000\267\305\237\000\236!\302\273\300\231\000L\236!\302\273\300\231\000!\262\302\273\300\231\000L!\262\302\273\300\231\000L\303\262\300\231\000\304\354\303\262\300\231\0000L4\241\300\251\301\177+\300\231\0000L4\300\251\301\177+\300\231\0000L\2104\300\251\301\177+\300\231\000L\305P\300\231\0000\305P\300\231\000L0\305P\300\231\000\301uL\301\327\000\301uL\302\003\301\327\000\305\361\305\026\000\302\003\305\361\305\026\000"},
+    {0x1F680,32,"\305\237\000\336\215\000\3167\314K\000\306\271\303\271\000\313\247\311#\000\313\247\311#\003\302\227\303\033\000\311#\000\343\362\000{\3511\000\355\005\000\316\233\000\316\233\303\271\000\307Q\000\305\201\307Q\000\356\306\000\307Q\300k\000\344D\000\322|\000\303\016\3131\000\306\253\303\271\000\305\201\306\253\303\271\000\316l\000\305\201\316l\000\312A\000\305\201\312A\000\351O\3602\000\332\036\311&\000\322\323\342\230\000\356\253\000\344r\000\303\342\306\271\000\310\373\306\271\000"},
+    {0x1F6A0,32,"\303\342\324\323\000\322B\356\256\000\310\314\000\351\276\000\354\267\000\255\305\271{\000T\305\271{\000\307l\002\000\306\253\324\362\315\254{\000\301\366\302\344\300\216\310\222\000\313\005\000\301#\307\235\002\000\316\033\014\000\301#\316\033\014\000\310\237\314H\300\241\340O\304K\014\000\302\013\300\224\314H\014\000\350R\302\255\014\000\346\027\302\255\014\000\324D\000\301#\324E\000\312e\000\303\342\312e\000\315H\000\301#\347\315\000\325M\301_\000\343\346\014\000\361!\014\000\351m\000\304u\014\000\356\216\000\302\255\325\226\000\354*\000"},
+    {0x1F6C0,24,"\307@\000\312T\000\347\273\304\204\000\331c\000\323\345\325\206\000(\314R\000\260\003\302\213\304\206\000\350q\002\000.\307\337\310\342\000\324x\014\000\335\346\014\000\331\077\031\314*\000\310\333\322-\000\315\365\323\346\000\3241\304\036\000\324)\000\304KK\361)\000\347+\002\000\315\365\356\305\000\3551\000\347}\000\336\277\356\032\000\337x\000\334\021\000"},
+    {0x1F6DD,16,"\350-\354\204\000\307\024\000\240\324\235\000\3068\031\316\377\000\310\313\000\306\226\304\216\000\344\201\000\306\271\316\231\000\314\274\312z\000\302V\3106\303\261\000\302V\303\261\000\302V\004\303\261\000\004\303\261\000\346\034\303\261\000\303\261\312\356\000\303\261\322\316\000"},
+    {0x1F6F0,13,"\315\330\000\305\201\303\016\3131\000\332M\314K\000\347\267\310\314\000\315\333\000\314\274\315\333\000\324\345\000\354\200\000\307\261\352m\000\354w\000\323\001\351\203\000\350\006\311&\000\315\277\316\023\000"},
+    {0x1F700,32,"\244\014)\350\340\000\244\014)\304o\000\244\014)\303\016\000\244\014)\302\134\000\244\014)\302\255\000\244\014)\322\262\000\244\014)\305\331\351R\000\244\014)\305\331\351S\000\244\014)\305\331\360\211\000\244\014)\305\331\360\212\000\244\014)\316\345\000\244\014)\360\200\000\244\014)\360\201\000\244\014)\310\370\000\244\014)\347\367\310\370\000\244\014)8\310\370\000\244\014)\306{\305\255\000\244\014)\306{\355C\000\244\014)\306{\355D\000\244\014)\325~\000\244\014)\303]\000\244\014)\345\301\000\244\014)\360\213\000\244\014)\360\214\000\244\014)\310\263\303]\000\244\014)\310\263\352Y\000\244\014)\3062\000\244\014)\354\134\000\244\014)\306H\304I\000\244\014)\306H\347P\000\244\014)\307tK\306H\000\244\014)\306\275K\306H\000"},
+    {0x1F720,32,"\244\014)\304\205\304I\000\244\014)\340E\304I\000\244\014)\305\255K\304\205\000\244\014)\307tK\304\205\000\244\014)\307tK\3313\000\244\014)\304\205\312*\000\244\014)\303]K\304\205\312*\000\244\014)\305\255K\303]K\304\205\000\244\014)\3606\000\244\014)\356o\304I\000\244\014)\342-\304I\000\244\014)\304r\304I\000\244\014)\305\255K\304r\000\244\014)\303]K\304r\000\244\014)\305\255K\303]K\304r\000\244\014)\316\345K\304r\000\244\014)\306\275K\304r\000\244\014)\306\275K\322\242\000\244\014)\306\275\000\244\014)\351U\000\244\014)\351V\000\244\014)\351W\000\244\014)\322p\000\244\014)\322q\000\244\014)\343\242\000\244\014)\352R\000\244\014)\322\320\000\244\014)\351H\000\244\014)\351I\000\244\014)\322\376\000\244\014)\324W\304I\000\244\014)\355\361\000"},
+    {0x1F740,32,"\244\014)\355\362\000\244\014)\350\335\342e\000\244\014)\324j\000\244\014)\324k\000\244\014)\324l\000\244\014)\322x\000\244\014)\306\226\000\244\014)\306\346\000\244\014)\356q\000\244\014)\307\313\000\244\014)\316\362\000\244\014)\350X\000\244\014)\324\334\000\244\014)\357#\000\244\014)\324\353\344{\000\244\014)\352yK\340\216\000\244\014)\312\220\000\244\014)\305\272\000\244\014)\355\002\305\272\000\244\014)\342\206\000\244\014)\316\034\000\244\014)\357\271\000\244\014)\303\214\313\017\000\244\014)\312;\000\244\014)\306\255\312;\000\244\014)\307L\000\244\014)\350Y\307L\000\244\014)\322y\000\244\014)\310\362\316D\310\362\000\244\014)\310\362\316D\355\032\000\244\014)\355E\000\244\014)\350b\000"},
+    {0x1F760,20,"\244\014)\332k\000\244\014)\332i\000\244\014)\332j\000\244\014)\350\221\000\244\014)\350\231\000\244\014)\331M\000\244\014)\331N\000\244\014)\331O\000\244\014)\331P\000\244\014)\331Q\000\244\014)\312\034\000\244\014)\307@K\343\257\000\244\014)\307@K\360$\000\244\014)\351o\000\244\014)\301\263\000\244\014)\306\214\000\244\014)\331\354\000\244\014)\310;\000\244\014)o\313\011\000\244\014)o\3150\000"},
+    {0x1F780,32,"8\302\016\306J&\260\0008\302V\306J&\260\0008\301\325\306J&\260\0008\302\270\306J&\260\0008\306\342\004y\000\270\032@y\000\032@y\000L@y\000\301uL@y\000\304\232L@y\000@y\303z8\004y\000\302\314\311\005\0008\305\266,\0008\306\342\004,\000{@,\000\270@,\000\032@,\000L@,\000\301uL@,\000\304\232L@,\000@,\303z8\301u\004,\000@,\303z8\270,\000,\311\005\0008\305\266\300\360\0008\301u\004\300\360\0008\270\004\300\360\000@\300\360\303z8\301u\004\300\360\000@\300\360\303z8\270\300\360\000\300\360\311\005\0008\305\266\302\275\0008\301u\004\302\275\0008\270\004\302\275\000"},
+    {0x1F7A0,32,"@\302\275\303z8\004\302\275\000\306\366\042\300\323\000{\042\300\323\000\270\042\300\323\000\032\042\300\323\000\301u\032\042\300\323\000\301uL\042\300\323\000\304\232L\042\300\323\000\306\366\303!\000{\303!\000\270\303!\000\032\303!\000L\303!\000\301uL\303!\000\304\232L\303!\000{V\302=\300\367\000\270V\302=\300\367\000\032V\302=\300\367\000LV\302=\300\367\000\301uLV\302=\300\367\000\304\232LV\302=\300\367\000{v\302=\300\367\000\270v\302=\300\367\000\032v\302=\300\367\000Lv\302=\300\367\000\301uLv\302=\300\367\000\304\232Lv\302=\300\367\000{u\302=\300\367\000\270u\302=\300\367\000\032u\302=\300\367\000Lu\302=\300\367\000\301uLu\302=\300\367\000"},
+    {0x1F7C0,25,"{B\301;8\300\261\000\270B\301;8\300\261\000B\301;8\300\261\000\270B\301;\303\231\300\261\000{O\301;8\300\261\000\270O\301;8\300\261\000O\301;8\300\261\000\270O\301;\303\231\300\261\000\302\003{O\301;\303\231\300\261\000{V\301;8\300\261\000LV\301;8\300\261\000\270v\301;8\300\261\000Lv\301;8\300\261\000v\301;\303\231\300\261\000\270u\301;8\300\261\000Lu\301;8\300\261\000\301uLu\301;8\300\261\000Lu\301;\303\231\300\261\000{\302\220\301;8\300\261\000L\302\220\301;8\300\261\000L\302\220\301;\303\231\300\261\000.\260\000\300\020.\260\000.,\000\300\020.,\000"},
+    {0x1F7E0,12,"\300#\304\315y\000\300#\305\313y\000\300#\303\314y\000\300#\310\235y\000\300#\307My\000\300#\302$,\000\300#\303\267,\000\300#\304\315,\000\300#\305\313,\000\300#\303\314,\000\300#\310\235,\000\300#\307M,\000"},
+    {0x1F7F0,1,"L\301@\002\000"},
+    {0x1F800,12,"n\034\003\004\260\300a\000\277\034\003\004\260\300a\000\134\034\003\004\260\300a\000\267\034\003\004\260\300a\000n\034\003\270\260\300a\000\277\034\003\270\260\300a\000\134\034\003\270\260\300a\000\267\034\003\270\260\300a\000n\034\003\300#\260\300a\000\277\034\003\300#\260\300a\000\134\034\003\300#\260\300a\000\267\034\003\300#\260\300a\000"},
+    {0x1F810,32,"n\034\003\004\301\320\300a\000\277\034\003\004\301\320\300a\000\134\034\003\004\301\320\300a\000\267\034\003\004\301\320\300a\000n\034\003\301\320\300a\000\277\034\003\301\320\300a\000\134\034\003\301\320\300a\000\267\034\003\301\320\300a\000Ln\034\003\301\320\300a\000L\277\034\003\301\320\300a\000L\134\034\003\301\320\300a\000L\267\034\003\301\320\300a\000Ln\034\003\300#\301\320\300a\000L\277\034\003\300#\301\320\300a\000L\134\034\003\300#\301\320\300a\000L\267\034\003\300#\301\320\300a\000n\300`\034\003\304\307\301\271\000\277\300`\034\003\304\307\301\271\000\134\300`\034\003\304\307\301\271\000\267\300`\034\003\304\307\301\271\000n\300`\034\003\270\301\271\000\277\300`\034\003\270\301\271\000\134\300`\034\003\270\301\271\000\267\300`\034\003\270\301\271\000n\300`\034\003\032\301\271\000\277\300`\034\003\032\301\271\000\134\300`\034\003\032\301\271\000\267\300`\034\003\032\301\271\000n\300`\034\003L\301\271\000\277\300`\034\003L\301\271\000\134\300`\034\003L\301\271\000\267\300`\034\003L\301\271\000"},
+    {0x1F830,24,"n\300`\034\003\301uL\301\271\000\277\300`\034\003\301uL\301\271\000\134\300`\034\003\301uL\301\271\000\267\300`\034\003\301uL\301\271\000n\306\042\034\000\277\306\042\034\000\134\306\042\034\000\267\306\042\034\000nf\034\000\277f\034\000\134f\034\000\267f\034\000n\303\273\034\000\277\303\273\034\000\134\303\273\034\000\267\303\273\034\000nL\303\273\034\000\277L\303\273\034\000\134L\303\273\034\000\267L\303\273\034\000nL\034\000\277L\034\000\134L\034\000\267L\034\000"},
+    {0x1F850,10,"n0\034\000\2770\034\000\1340\034\000\2670\034\000\275\300\3100\034\000\275\300\2370\034\000\3004\300\2370\034\000\3004\300\3100\034\000(&0\034\000bt0\034\000"},
+    {0x1F860,32,"\301\032n{\273\034\000\301\032\277{\273\034\000\301\032\134{\273\034\000\301\032\267{\273\034\000\301\032\275\300\310{\273\034\000\301\032\275\300\237{\273\034\000\301\032\3004\300\237{\273\034\000\301\032\3004\300\310{\273\034\000\301\032n\273\034\000\301\032\277\273\034\000\301\032\134\273\034\000\301\032\267\273\034\000\301\032\275\300\310\273\034\000\301\032\275\300\237\273\034\000\301\032\3004\300\237\273\034\000\301\032\3004\300\310\273\034\000\301\032n\270\273\034\000\301\032\277\270\273\034\000\301\032\134\270\273\034\000\301\032\267\270\273\034\000\301\032\275\300\310\270\273\034\000\301\032\275\300\237\270\273\034\000\301\032\3004\300\237\270\273\034\000\301\032\3004\300\310\270\273\034\000\301\032nL\273\034\000\301\032\277L\273\034\000\301\032\134L\273\034\000\301\032\267L\273\034\000\301\032\275\300\310L\273\034\000\301\032\275\300\237L\273\034\000\301\032\3004\300\237L\273\034\000\301\032\3004\300\310L\273\034\000"},
+    {0x1F880,8,"\301\032n\301uL\273\034\000\301\032\277\301uL\273\034\000\301\032\134\301uL\273\034\000\301\032\267\301uL\273\034\000\301\032\275\300\310\301uL\273\034\000\301\032\275\300\237\301uL\273\034\000\301\032\3004\300\237\301uL\273\034\000\301\032\3004\300\310\301uL\273\034\000"},
+    {0x1F890,30,"n\260\300a\000\277\260\300a\000\134\260\300a\000\267\260\300a\000n@\034\304j\260\300a\000\277@\034\304j\260\300a\000\134@\034\304j\260\300a\000\267@\034\304j\260\300a\000n\034\003\303V\300\253\000\277\034\003\303V\300\253\000\134\034\003\303V\300\253\000\267\034\003\303V\300\253\000L\034\301\271\303,2\000L\034\301\271\303,7\303\246\000L\034\301\271\303,2o\000L\034\301\271\303,2\302\321\000n\324r@\034\000\134\3017\310\307@\034\000n\300\365\310\307@\034\000\134\300\365\310\307@\034\000n\310\023@\034\000\134\310\260@\034\000n\310\260@\034\000\134\310\023@\034\000n\3079\302\316@\034\000\134\3079\302\316@\034\000n\307\271\302\316@\034\000\134\307\271\302\316@\034\000@\034\301\271\303,2\000@\034\301\271\303,7\303\246\000"},
+    {0x1F8B0,2,"\034\300]\277\303\245\275\300\310\000\034\300]\134\303\245\305$\3004\300\310\000"},
+    {0x1F900,32,".\300\323\307\265\003O\214\000.\300\323\307\265\0037\214\000.\300\323\307\265\000(oy\003O\214\000(oy\003B\214\000(oy\0037\214\000(oy\003<\000(oy\000\306\015\3054S\000\306\015\3054\303VS\000\306\015\3054S\003<\000\306\015\3054\303VS\003<\000\350\033\301n\000@\301{\000\307M\301{\000\350\034\301o\000\362mi\000\344ni\000i\003\316~\000\345Si\000\356<i\000i\003\336\201\000\351\261i\000\313\271i\000\002K\301\011\313\265\000\307V\301S\301o\000\301T\302\327K\301o\000\306i\307\255\000\306\305\307\255\000\336f\000\301o\003k\031M\301n\302\266\000;\310\033\361\336\301o\002\000"},
+    {0x1F920,32,"i\003\331C\3046\000\325\231i\000\345\007i\000\315\300\300\216\301\011\302.\342#\000\333\231i\000\342\266i\000i\304\320\000\354\221i\000i\0032\334_\301T\000\305Ei\003\300\261\301\260\000\305Ei\0032\300#\0312\004\303D\000i\003\303E\307r\301\005\303\332\000\353\241i\003\310\377\307r\300\347\000\301\326i\003\301\326\301\260\031\301o\307r\300\347\000i\003\262\300\347\360\230\000\354\027i\003\334W\301\225\000\310\231\304\026\000\324\201\000\347\210b\306\373\000\353\226\000\350j\000\301\360\300\241\357&\000\314\273\307]\000\3542\000\301\362\332\204\324\364\000\340\226\000\334\310\000\344^\347\334\000\361/\000\302\255\350E\000\336d\000\332s\310&\000"},
+    {0x1F940,32,"\361\017\305:\000\304\216\003\333\234\000\312\261\335\354\000\357\025\304\241\000\310\345\000\303\313\304\311\000\351\223\000\303\205\304K\305k\000\303\237\304K\305k\000\302\321\304K\305k\000\324v\335\356\000\343\254\3129\357\251\000\331^\310\357\000\341\341\303\377\031\302\330\000\354\235\000\307\261\300\343\000\331K\000\323\007\000\331W\000\323\336\000\315u\000\324\361\000\323\347\312\205\000\303\314\352U\000\353\364\310wK\306&\000\3550\313M\000\313!\000\304\241K\344\077\000\347\313\000\341I\000\347\222\000\333\243\000"},
+    {0x1F960,32,"\335\017\312\271\000\355\344e\000\325_\000\307I\003\310\345\000\305#\003\355\033\000\326\003\000\324\210\000\315\134\000\350h\000\307yK\306y\000\352a\000\324\344\306&\000\342/\303\314\000\343\227\000\301\211\307T\000\323\344\000\301\326i\003\301\326\301\260\031B\302K\000\361\253i\000\301\326i\003\356\014\000i\003\310}\301R\031\310}\3046\000i\003\357\246\301\260\031\303+\300\347\000\347_i\000\335\031i\000\345\272\000\332fi\000i\304\247\302\327\311\007\000i\003\350.\301\260\000\315\327\000\341\332\312\263\000\335\366\000\336\276\312\200\000\304/\304S\000"},
+    {0x1F980,32,"\331E\000\342ri\000\352}\000\357\034\000\357\250i\000\313\033\000\333\236\000\307\077\000\353\372\000\347`\000\313Yi\000\324\247\000\307\206\000\336\002\000\342z\000\351x\000\315\370\000\354\316\000\335\344i\000\362@i\000\336\210\000\352o\000\355\243\000\312\275\000\340\324\000\342{\000\347\312\000\336\300\000\347\260\000\351'\000\342\202\000\344}\000"},
+    {0x1F9A0,32,"\344+\000\312P\000\355c\000\343\223\000\332\203\000\354\212\000\347[\000\347N\000\354{\000\334\362\000\347c\000\307B\000\324X\000\310\277\000\336\033\304\215\000\350n\324\342\000\303\201\305\371\302$\3045\000\303\201\305\371\301\077\3045\000\303\201\305\371\323\355\000\303\201\305\371@\3045\000\305\347\000\302\017\000\306'\000\306\376\000\355U\000\355W\000\310\270\360j\000\304(\003\336\206\322W\000\344\200\311B\000\343\236\311B\000\314\232\301\345\000\314\232\302\017\000"},
+    {0x1F9C0,32,"\3259\360\370\000\331Z\000\303]\353\362\000\312be\000\335~\000\347\077\000\334\265\000\360\337\000\324\246\000\343\267\313\013\000\303\321\307w\000\303s\356\011\000\356\304\000\354\376\301\362\000\341_\301\362\000\332\014\301\362\000i\003\344q\000\312\020\000\307\134\000\310l\312\020\000\324&\301\362\000\301\362\003\336\204\000\301\362\300\241\355\012\351\267\000\301\362\325\221\000\301\362\300\241\306r\304\325\000\343\204\000\334\263\000\360\042\000\343\351\000\334\024\000\335\232\000\362s\000"},
+    {0x1F9E0,32,"\324|\000\304\315\301{\000\324L\305\356\000\352x\000\335\357\000\312\263\000\354\234\000\302$\335\336\303\202\000\334\337\000\340q\350\234\303\361\000\356!\357\020\000\347\351\301\333\000\332\2004\336\216\000\326\023\000\322&\000\303\016\334Z\000\356\234\000\307L\000\343\206\000\314R\000\342\234\305\350\000\354\302K\311\021\000\302\330K\361\241\000\310\270\315d\000\356\020\312\134\000\324\212\000\323\377\000\351\263K\306\235\000xK\316\034\000\354\301\000\351J\000\345\014\322\202\000"},
+    {0x1FA00,32,"\301\020\300\032\3027\000\301\020\300\032\302c\000\301\020\300\032\302\365\000\301\020\300\032\302\331\000\301\020\300\032\301\226\000\301\020\300\032\302\363\000@\300\032\301\226\300\235\307\266\300\320\0008\300\032\301\226\300\235\307\266\300\320\000\301\020\300\032\301\226\300\235\307\266\300\320\000@\300\032\3027\300\235\3010\300\320\000@\300\032\302c\300\235\3010\300\320\000@\300\032\302\365\300\235\3010\300\320\000@\300\032\302\331\300\235\3010\300\320\000@\300\032\301\226\300\235\3010\300\320\000@\300\032\302\363\300\235\3010\300\320\0008\300\032\3027\300\235\3010\300\320\0008\300\032\302c\300\235\3010\300\320\0008\300\032\302\365\300\235\3010\300\320\0008\300\032\302\331\300\235\3010\300\320\0008\300\032\301\226\300\235\3010\300\320\0008\300\032\302\363\300\235\3010\300\320\000\301\020\300\032\3027\300\235\3010\300\320\000\301\020\300\032\302c\300\235\3010\300\320\000\301\020\300\032\302\365\300\235\3010\300\320\000\301\020\300\032\302\331\300\235\3010\300\320\000\301\020\300\032\301\226\300\235\3010\300\320\000\301\020\300\032\302\363\300\235\3010\300\320\000@\300\032\301\226\300\2352\207\311\015\300\320\0008\300\032\301\226\300\2352\207\311\015\300\320\000\301\020\300\032\301\226\300\2352\207\311\015\300\320\000@\300\032\241\3027\000@\300\032\241\302c\000"},
+    {0x1FA20,32,"@\300\032\241\302\365\000@\300\032\241\302\331\000@\300\032\241\301\226\000@\300\032\241\302\363\0008\300\032\241\3027\0008\300\032\241\302c\0008\300\032\241\302\365\0008\300\032\241\302\331\0008\300\032\241\301\226\0008\300\032\241\302\363\000\301\020\300\032\241\3027\000\301\020\300\032\241\302c\000\301\020\300\032\241\302\365\000\301\020\300\032\241\302\331\000\301\020\300\032\241\301\226\000\301\020\300\032\241\302\363\000@\300\032\301\226\300\2357\207\307\010\300\320\0008\300\032\301\226\300\2357\207\307\010\300\320\000\301\020\300\032\301\226\300\2357\207\307\010\300\320\000@\300\032\3027\300\2357\207\301V\300\320\000@\300\032\302c\300\2357\207\301V\300\320\000@\300\032\302\365\300\2357\207\301V\300\320\000@\300\032\302\331\300\2357\207\301V\300\320\000@\300\032\301\226\300\2357\207\301V\300\320\000@\300\032\302\363\300\2357\207\301V\300\320\0008\300\032\3027\300\2357\207\301V\300\320\0008\300\032\302c\300\2357\207\301V\300\320\0008\300\032\302\365\300\2357\207\301V\300\320\0008\300\032\302\331\300\2357\207\301V\300\320\0008\300\032\301\226\300\2357\207\301V\300\320\0008\300\032\302\363\300\2357\207\301V\300\320\000\301\020\300\032\3027\300\2357\207\301V\300\320\000"},
+    {0x1FA40,20,"\301\020\300\032\302c\300\2357\207\301V\300\320\000\301\020\300\032\302\365\300\2357\207\301V\300\320\000\301\020\300\032\302\331\300\2357\207\301V\300\320\000\301\020\300\032\301\226\300\2357\207\301V\300\320\000\301\020\300\032\302\363\300\2357\207\301V\300\320\000@\300\032\301\226\300\235B\207\303\015\300\320\0008\300\032\301\226\300\235B\207\303\015\300\320\000\301\020\300\032\301\226\300\235B\207\303\015\300\320\000@\300\032\304\226\0008\300\032\304\226\000\301\020\300\032\304\226\000@\300\032\304\226\300\235\3010\300\320\0008\300\032\304\226\300\235\3010\300\320\000\301\020\300\032\304\226\300\235\3010\300\320\000@\300\032\314\015\000@\300\032\314\016\000@\300\032\314\014\0008\300\032\314\015\0008\300\032\314\016\0008\300\032\314\014\000"},
+    {0x1FA60,14,"\302\257\302$\313q\000\302\257\302$\314\216\000\302\257\302$\307\232\000\302\257\302$\303\214\000\302\257\302$\305\032\000\302\257\302$\312\225\000\302\257\302$\316\037\000\302\2578\313q\000\302\2578\314\216\000\302\2578\307\232\000\302\2578\303\214\000\302\2578\305\032\000\302\2578\312\225\000\302\2578\316\037\000"},
+    {0x1FA70,5,"\323\356\354\030\000\347;\355g\000\324\206\000\306\334\000\316\200\315\324\000"},
+    {0x1FA78,5,"\333\232K\312v\000\3226\323\362\000\355\015\000\361>\000\331S\000"},
+    {0x1FA80,7,"\361\331\000\341F\000\347\252\000\312\177\000\343\205\360\344\000\350\032\000\345U\313\002\000"},
+    {0x1FA90,29,"\351\235\350*\000\312\245\000\351A\000\3076\000\332v\314*\000\323\364\000\3106\306=\000\322.\000\253\304\216\000\326\007\000\312\226\310\273\000\352\200\000\341\342\000S\000\314\257\000\316\372\000\3506\000\353\253\345M\000\341a\000\324\217\000\304C\356\261\000\356\236\000\313\235\000\350(\000\310\263\000\314\257\302\330\000\313\305\3006\000\210\312U\000\336`\000"},
+    {0x1FAB0,11,"\307\260\000\361'\000\312_\000\326\001\000\350S\350+\000\311E\000\306!\000\306r\000\3316\000\302x\314\335\000\314\335\003\334\003\000"},
+    {0x1FAC0,6,"\322\205\301{\000\342\247\000\315L\313\271\000\310\231\301\360\000\310\231\301\362\000\301\362\003\312\301\000"},
+    {0x1FAD0,10,"\324d\000\304\036\315M\000\315\042\000\313M\000\355\347\000\335\003\000\356\013\000\350V\314F\000\324%\000\313\335\000"},
+    {0x1FAE0,8,"\343\340i\000\352Zi\000i\003\262\301\260\031\301o\223\300\347\000i\003\347\317\303D\000i\003\274\300\347\000\301\016\300\201i\000\312k\306m\000\307N\000"},
+    {0x1FAF0,7,"\301o\003k\303E\031\221\302\266\000\134\301o\000n\301o\000\304\320t\301o\000\304\320b\301o\000k\300]\301\234\301\011\360{\000\301{\303\212\000"},
+    {0x1FB00,32,"r\353\256\000r\353\314\000r\353\257\000r\353\333\000r\353\276\000r\353\315\000r\353\260\000r\353\343\000r\353\305\000r\353\325\000r\353\267\000r\353\334\000r\353\277\000r\353\316\000r\353\261\000r\353\347\000r\353\311\000r\353\330\000r\353\273\000r\353\340\000r\353\322\000r\353\264\000r\353\344\000r\353\306\000r\353\326\000r\353\270\000r\353\335\000r\353\300\000r\353\317\000r\353\262\000r\353\351\000r\353\313\000"},
+    {0x1FB20,32,"r\353\332\000r\353\275\000r\353\342\000r\353\304\000r\353\324\000r\353\266\000r\353\346\000r\353\310\000r\353\272\000r\353\337\000r\353\302\000r\353\321\000r\353\263\000r\353\350\000r\353\312\000r\353\331\000r\353\274\000r\353\341\000r\353\303\000r\353\323\000r\353\265\000r\353\345\000r\353\307\000r\353\327\000r\353\271\000r\353\336\000r\353\301\000r\353\320\000l(r\274lM(Cl\300\222\000l(r\274lM(Cl&\000l(r\274sM(Cl\300\222\000l(r\274sM(Cl&\000"},
+    {0x1FB40,32,"l(r\274s(Cl\300\222\000l&r\274sM(Cs\300\222\000l&r\274sM(Cs&\000l&r\274lM(Cs\300\222\000l&r\274lM(Cs&\000l&r\274l(Cs\300\222\000l&r\274lM(CsM&\000l&r\274l\300\222ClM&\000l&r\274l(ClM&\000l&r\274l\300\222CsM&\000l&r\274l(CsM&\000l&r\274l\300\222Cs&\000l(r\274s\300\222CsM&\000l(r\274s(CsM&\000l(r\274s\300\222ClM&\000l(r\274s(ClM&\000l(r\274s\300\222Cl&\000l(r\274sM(ClM&\000s&r\274lM(Cl\300\222\000s&r\274lM(Cl&\000s&r\274sM(Cl\300\222\000s&r\274sM(Cl&\000s&r\274s(Cl\300\222\000s(r\274sM(Cs\300\222\000s(r\274sM(Cs&\000s(r\274lM(Cs\300\222\000s(r\274lM(Cs&\000s(r\274l(Cs\300\222\000s(r\274lM(CsM&\000s(r\274l\300\222ClM&\000s(r\274l(ClM&\000s(r\274l\300\222CsM&\000"},
+    {0x1FB60,32,"s(r\274l(CsM&\000s(r\274l\300\222Cs&\000s&r\274s\300\222CsM&\000s&r\274s(CsM&\000s&r\274s\300\222ClM&\000s&r\274s(ClM&\000s&r\274s\300\222Cl&\000s&r\274sM(ClM&\000s\031&\031l\301\366B\302\206r\000(\031l\031&\301\366B\302\206r\000s\031(\031l\301\366B\302\206r\000(\031s\031&\301\366B\302\206r\000(\301\3662\3011r\000s\301\3662\3011r\000&\301\3662\3011r\000l\301\3662\3011r\000T2\301,\312p\000T2\301,\312q\000T2\301,\312r\000T2\301,\312s\000T2\301,\312t\000T2\301,\312u\000\2552\301,\312p\000\2552\301,\312q\000\2552\301,\312r\000\2552\301,\312s\000\2552\301,\312t\000\2552\301,\312u\000(\031l2\301,r\000(\031s2\301,r\000&\031s2\301,r\000&\031l2\301,r\000"},
+    {0x1FB80,19,"s\031l2\301,r\000\2552\301,\324`\000s2\3011r\000sB\302vr\000sV\302vr\000sB\302\206r\000s\201\302vr\000&2\3011r\000&B\302vr\000&V\302vr\000&B\302\206r\000&\201\302vr\000(o\270\302\214\000&o\270\302\214\000so\270\302\214\000lo\270\302\214\000\303\021\270\302\214\000sor\031lo\303\021\270\302\214\000so\303\021\270\302\214\031lor\000"},
+    {0x1FB94,32,"(o\303\021\270\302\214\031&or\000\305\361\305\026\302-\000\303\021\305\361\305\026\302-\000L\255\302-\000s(Cl&\302-\000s&Cl(\302-\000s\031l\301\366or\000(\031&\301\366or\000s(\301\366\270\302\214\000s&\301\366\270\302\214\000l&\301\366\270\302\214\000l(\301\366\270\302\214\000e\177{\274s\300\222CM(\000e\177{\274s\300\222CM&\000e\177{\274M(Cl\300\222\000e\177{\274M&Cl\300\222\000e\177{\274s\300\222CM(Cl\300\222\000e\177{\274s\300\222CM&Cl\300\222\000e\177{\274M(Cl\300\222CM&\000e\177{\274M(Cs\300\222CM&\000e\177{\274s\300\222CM(\031M&Cl\300\222\000e\177{\274s\300\222CM&\031M(Cl\300\222\000e\177{\274s\300\222CM&Cl\300\222CM(\000e\177{\274s\300\222CM(Cl\300\222CM&\000e\177{\274M(Cs\300\222CM&Cl\300\222\000e\177{\274M&Cs\300\222CM(Cl\300\222\000e\177{\274\300\360\000e\177{\255\003TI\000\322\317\305\220\000\303\021\302\231+\000(o\310\267\301\360\000&o\310\267\301\360\000"},
+    {0x1FBB4,23,"\303\021\267\034\003\302\005n\000n\034\031s\031l2\301,r\000\134\034\031s\031l2\301,r\000\267\034\031&2\301,r\000\277\034\031&2\301,r\000(o\3040\000&o\3040\000\360\222\042\300\323\000&\262f<\000\300\020\274\300\323\000\300\020\274M&Cl\300\222\000\300\020\274\300\360\000@L\303!\003\302\213\304\206\000(\302\321@&\300]k\000M\302\321@&\300]k\000&\302\321@&\300]k\000\300\020f\301\216+\000\303\377\303\310\000\303\377\303\310\003\322\307\301T\000\303\377\303\310\3146(\000\303\377\303\310\3146&\000\303\377\303\310\003\313\012\000@\302V\312\251\000"},
+    {0x1FBF0,10,"\303^\017\300%\000\303^\0172\000\303^\0177\000\303^\017B\000\303^\017O\000\303^\017V\000\303^\017v\000\303^\017\201\000\303^\017u\000\303^\017\211\000"},
+    {0xE0001,1,"\342\031\276\000"},
+    {0xE0020,32,"\276\301\364\000\276\301\257+\000\276\301\177+\000\276\036\002\000\276\304&\002\000\276\305\215\002\000\276\303\262\000\276\303o\000\276(\300\371\000\276&\300\371\000\276\300\367\000\276a\002\000\276\300\251\000\276\306B\000\276\300\324\300k\000\276\301\327\000\276\017\300%\000\276\0172\000\276\0177\000\276\017B\000\276\017O\000\276\017V\000\276\017v\000\276\017\201\000\276\017u\000\276\017\211\000\276\301^\000\276\302\366\000\276\300\257\002\000\276\301@\002\000\276\300\256\002\000\276\301\216+\000"},
+    {0xE0040,32,"\276\305 \301\234\000\276\010\006\001\025\000\276\010\006\001\077\000\276\010\006\001\3005\000\276\010\006\001\300\024\000\276\010\006\0019\000\276\010\006\001\300u\000\276\010\006\001\300\003\000\276\010\006\001\300\026\000\276\010\006\001;\000\276\010\006\001\300U\000\276\010\006\001\300\011\000\276\010\006\001p\000\276\010\006\001\261\000\276\010\006\001\232\000\276\010\006\0016\000\276\010\006\001\300<\000\276\010\006\001\300\260\000\276\010\006\001c\000\276\010\006\001d\000\276\010\006\001\300\007\000\276\010\006\0011\000\276\010\006\001\300\015\000\276\010\006\001\300P\000\276\010\006\001\300>\000\276\010\006\001\300$\000\276\010\006\001\300 \000\276(,\202\000\276\302\003\301\327\000\276&,\202\000\276\300M\300\206\000\276\210\300\201\000"},
+    {0xE0060,32,"\276\300\200\300\206\000\276\010\004\001\025\000\276\010\004\001\077\000\276\010\004\001\3005\000\276\010\004\001\300\024\000\276\010\004\0019\000\276\010\004\001\300u\000\276\010\004\001\300\003\000\276\010\004\001\300\026\000\276\010\004\001;\000\276\010\004\001\300U\000\276\010\004\001\300\011\000\276\010\004\001p\000\276\010\004\001\261\000\276\010\004\001\232\000\276\010\004\0016\000\276\010\004\001\300<\000\276\010\004\001\300\260\000\276\010\004\001c\000\276\010\004\001d\000\276\010\004\001\300\007\000\276\010\004\0011\000\276\010\004\001\300\015\000\276\010\004\001\300P\000\276\010\004\001\300>\000\276\010\004\001\300$\000\276\010\004\001\300 \000\276(\301\077\202\000\276T\300\201\000\276&\301\077\202\000\276\272\000\312\224\276\000"},
+    {0xE0100,32,"D\352\342\000D\352\355\000D\352\370\000D\353\005\000D\353\020\000D\353\033\000D\353&\000D\3531\000D\353<\000D\353D\000D\353E\000D\353F\000D\353G\000D\353I\000D\353J\000D\353K\000D\353L\000D\353M\000D\353N\000D\353O\000D\353P\000D\353Q\000D\353R\000D\353T\000D\353U\000D\353V\000D\353W\000D\353X\000D\353Y\000D\353Z\000D\353[\000D\353\134\000"},
+    {0xE0120,32,"D\353]\000D\353_\000D\353`\000D\353a\000D\353b\000D\353c\000D\353d\000D\353e\000D\353f\000D\353g\000D\353h\000D\353j\000D\353k\000D\353l\000D\353m\000D\353n\000D\353o\000D\353p\000D\353q\000D\353r\000D\353s\000D\353u\000D\353v\000D\353w\000D\353x\000D\353y\000D\353z\000D\353{\000D\353|\000D\353}\000D\353~\000D\353\200\000"},
+    {0xE0140,32,"D\353\201\000D\353\202\000D\353\203\000D\353\204\000D\353\205\000D\353\206\000D\353\207\000D\353\210\000D\353\211\000D\353\213\000D\353\214\000D\353\215\000D\353\216\000D\353\217\000D\353\220\000D\353\221\000D\353\222\000D\353\223\000D\353\224\000D\352\226\000D\352\227\000D\352\230\000D\352\231\000D\352\232\000D\352\233\000D\352\234\000D\352\235\000D\352\236\000D\352\237\000D\352\241\000D\352\242\000D\352\243\000"},
+    {0xE0160,32,"D\352\244\000D\352\245\000D\352\246\000D\352\247\000D\352\250\000D\352\251\000D\352\252\000D\352\254\000D\352\255\000D\352\256\000D\352\257\000D\352\260\000D\352\261\000D\352\262\000D\352\263\000D\352\264\000D\352\265\000D\352\267\000D\352\270\000D\352\271\000D\352\272\000D\352\273\000D\352\274\000D\352\275\000D\352\276\000D\352\277\000D\352\300\000D\352\302\000D\352\303\000D\352\304\000D\352\305\000D\352\306\000"},
+    {0xE0180,32,"D\352\307\000D\352\310\000D\352\311\000D\352\312\000D\352\313\000D\352\315\000D\352\316\000D\352\317\000D\352\320\000D\352\321\000D\352\322\000D\352\323\000D\352\324\000D\352\325\000D\352\326\000D\352\330\000D\352\331\000D\352\332\000D\352\333\000D\352\334\000D\352\335\000D\352\336\000D\352\337\000D\352\340\000D\352\341\000D\352\343\000D\352\344\000D\352\345\000D\352\346\000D\352\347\000D\352\350\000D\352\351\000"},
+    {0xE01A0,32,"D\352\352\000D\352\353\000D\352\354\000D\352\356\000D\352\357\000D\352\360\000D\352\361\000D\352\362\000D\352\363\000D\352\364\000D\352\365\000D\352\366\000D\352\367\000D\352\371\000D\352\372\000D\352\373\000D\352\374\000D\352\375\000D\352\376\000D\352\377\000D\353\001\000D\353\002\000D\353\003\000D\353\006\000D\353\007\000D\353\010\000D\353\011\000D\353\012\000D\353\013\000D\353\014\000D\353\015\000D\353\016\000"},
+    {0xE01C0,32,"D\353\017\000D\353\021\000D\353\022\000D\353\023\000D\353\024\000D\353\025\000D\353\026\000D\353\027\000D\353\030\000D\353\031\000D\353\032\000D\353\034\000D\353\035\000D\353\036\000D\353\037\000D\353 \000D\353!\000D\353\042\000D\353#\000D\353$\000D\353%\000D\353'\000D\353(\000D\353)\000D\353*\000D\353+\000D\353,\000D\353-\000D\353.\000D\353/\000D\3530\000D\3532\000"},
+    {0xE01E0,16,"D\3533\000D\3534\000D\3535\000D\3536\000D\3537\000D\3538\000D\3539\000D\353:\000D\353;\000D\353=\000D\353>\000D\353\077\000D\353@\000D\353A\000D\353B\000D\353C\000"},
+};
+
+inline constexpr Range ranges[] = {
+    {0x3400,0x4DBF,"CJK UNIFIED IDEOGRAPH-"},
+    {0x4E00,0x9FFF,"CJK UNIFIED IDEOGRAPH-"},
+    {0xF900,0xFA6D,"CJK COMPATIBILITY IDEOGRAPH-"},
+    {0xFA70,0xFAD9,"CJK COMPATIBILITY IDEOGRAPH-"},
+    {0x18B00,0x18CD5,"KHITAN SMALL SCRIPT CHARACTER-"},
+    {0x1B170,0x1B2FB,"NUSHU CHARACTER-"},
+    {0x20000,0x2A6DF,"CJK UNIFIED IDEOGRAPH-"},
+    {0x2A700,0x2B738,"CJK UNIFIED IDEOGRAPH-"},
+    {0x2B740,0x2B81D,"CJK UNIFIED IDEOGRAPH-"},
+    {0x2B820,0x2CEA1,"CJK UNIFIED IDEOGRAPH-"},
+    {0x2CEB0,0x2EBE0,"CJK UNIFIED IDEOGRAPH-"},
+    {0x2F800,0x2FA1D,"CJK COMPATIBILITY IDEOGRAPH-"},
+    {0x30000,0x3134A,"CJK UNIFIED IDEOGRAPH-"},
+};
+
+inline constexpr const char* hangulLeading[] = { "G", "GG", "N", "D", "DD", "R", "M", "B", "BB", "S", "SS", "", "J", "JJ", "C", "K", "T", "P", "H" };
+inline constexpr const char* hangulVowel[] = { "A", "AE", "YA", "YAE", "EO", "E", "YEO", "YE", "O", "WA", "WAE", "OE", "YO", "U", "WEO", "WE", "WI", "YU", "EU", "YI", "I" };
+inline constexpr const char* hangulTrailing[] = { "", "G", "GG", "GS", "N", "NJ", "NH", "D", "L", "LG", "LM", "LB", "LS", "LT", "LP", "LH", "M", "B", "BS", "S", "SS", "NG", "J", "C", "K", "T", "P", "H" };
+
+}
@@ -0,0 +1,73 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include "UnicodeNameTables.h"
+
+// unicodeName returns the Unicode name of a code point, in capitals as in the Unicode Character Database, or an empty
+// string for code points that have none (controls, private use, surrogates, noncharacters and unassigned code points).
+//
+// The names are stored as codes for their words (see tools/GenerateUnicodeNames.py), which takes about a quarter of the
+// space of the names themselves; a lookup is a binary search for the run of names holding the code point and a scan
+// over at most 31 names before it in the run. Names that are numbered (CJK ideographs and the like) or made up of
+// parts (Hangul syllables) are built when asked for.
+//
+// std::string unicodeName(char32_t c)
+//     The name of c.
+
+inline std::string unicodeName(char32_t c) {
+
+    using namespace unicodeNameTables;
+
+    if (c - 0xAC00 < 11172) {
+        const char32_t s = c - 0xAC00;
+        return std::string("HANGUL SYLLABLE ") + hangulLeading[s / 588] + hangulVowel[s % 588 / 28] + hangulTrailing[s % 28];
+    }
+
+    const auto range = std::upper_bound(std::begin(ranges), std::end(ranges), c,
+                                        [](char32_t c, const Range& r) { return c < r.first; });
+    if (range != std::begin(ranges) && c <= range[-1].last) {
+        char number[8];
+        std::snprintf(number, sizeof number, "%04X", static_cast<unsigned>(c));
+        return range[-1].prefix + std::string(number);
+    }
+
+    const auto run = std::upper_bound(std::begin(runs), std::end(runs), c,
+                                      [](char32_t c, const Run& r) { return c < r.first; });
+    if (run == std::begin(runs) || c >= run[-1].first + run[-1].count) return {};
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(run[-1].names);
+    for (char32_t skip = c - run[-1].first; skip; --skip) while (*p++);
+    std::string name;
+    while (*p) {
+        const size_t word = *p < 0xC0 ? *p - 1 : oneByte + (*p - 0xC0) * 255 + p[1] - 1;
+        p += *p < 0xC0 ? 1 : 2;
+        if (!name.empty()) name += ' ';
+        name += words[word];
+    }
+    return name;
+
+}
@@ -0,0 +1,379 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include "UnicodeTables.h"
+
+// Unicode normalization (NFC, NFD, NFKC and NFKD) of UTF-16 text, using the tables in UnicodeTables.h
+// (generated by tools/GenerateUnicodeTables.py) rather than the operating system.
+//
+// Text is normalized a segment at a time. A segment begins at a starter (canonical combining class 0) which passes
+// the quick check for the form, so it is unchanged by normalization and can't combine with anything before it;
+// segments can therefore be normalized independently. A segment whose characters all pass the quick check and are
+// in canonical order is copied as it is, so ASCII and other text that is already normalized is never decomposed.
+// Unpaired surrogates are passed through unchanged.
+//
+// bool isNormalized(std::u16string_view text, NormalizationForm form)
+//     True if text passes the quick check for form, so it is certainly normalized; false if it might not be.
+//
+// std::u16string normalize(std::u16string_view text, NormalizationForm form)
+//     Returns text converted to form.
+//
+// size_t normalize(std::u16string_view text, NormalizationForm form, char16_t* out, size_t capacity)
+//     Writes text converted to form to out and returns the length; returns 0 if the result would be longer than
+//     capacity, or if a segment decomposes to more than segmentLimit code points. Does not allocate memory.
+//
+// size_t normalizeC(std::u16string_view text, char16_t* out, size_t capacity)
+//     normalize to NFC, in the form ComposeEngine takes as its Normalizer.
+//
+// size_t precomposeC(char32_t base, char32_t mark, char16_t* out)
+//     If base followed by mark is, in NFC, a single primary composite (as e and U+0301 make U+00E9), writes it to out,
+//     which must have room for 2 code units, and returns its length; otherwise returns 0, and the two must be
+//     normalized in full. It takes one lookup in the table of compositions, so ComposeEngine uses it for the most
+//     common implicit combination, a letter and one mark.
+//
+// NormalizationStream(NormalizationForm form)
+//     Normalizes text that arrives in pieces, such as a large document read a block at a time.
+//     void write(std::u16string_view text, F output)
+//         Normalizes text, calling output(std::u16string_view) with the results; the text after the last segment
+//         boundary is held until later text shows where its segment ends.
+//     void finish(F output)
+//         Normalizes and sends the text held back, leaving the stream ready for new text.
+
+enum class NormalizationForm { C, D, KC, KD };
+
+namespace unicodeNormalization {
+
+    // Property bits from UnicodeTables.h; the low eight bits are the canonical combining class.
+
+    enum : uint16_t { ClassMask = 0xFF, NoD = 0x100, NoKD = 0x200, NoC = 0x400, NoKC = 0x800, MaybeC = 0x1000 };
+
+    constexpr size_t segmentLimit = 128;
+    constexpr size_t maxExpansion = 18;  // code points in the longest decomposition of one code point
+
+    constexpr char32_t hangulBase  = 0xAC00, hangulCount = 11172;
+    constexpr char32_t leadingBase = 0x1100, leadingCount = 19;
+    constexpr char32_t vowelBase   = 0x1161, vowelCount = 21;
+    constexpr char32_t trailBase   = 0x11A7, trailCount = 28;
+
+    inline uint16_t properties(char32_t c) {
+        using namespace unicodeTables;
+        return c < 0x110000 ? propertyBlocks[propertyIndex[c >> 6] * 64 + (c & 63)] : 0;
+    }
+
+    inline uint8_t canonicalClass(char32_t c) { return c < 0x300 ? 0 : properties(c) & ClassMask; }
+
+    // Property bits that fail the quick check for a form.
+
+    inline uint16_t quickCheckMask(NormalizationForm form) {
+        switch (form) {
+        case NormalizationForm::C : return NoC  | MaybeC;
+        case NormalizationForm::D : return NoD;
+        case NormalizationForm::KC: return NoKC | MaybeC;
+        default                   : return NoKD;
+        }
+    }
+
+    // Reads the code point at text[i] and returns the number of code units it takes.
+
+    inline size_t decode(std::u16string_view text, size_t i, char32_t& c) {
+        c = text[i];
+        if (c >= 0xD800 && c < 0xDC00 && i + 1 < text.length() && text[i + 1] >= 0xDC00 && text[i + 1] <= 0xDFFF) {
+            c = 0x10000 + ((c - 0xD800) << 10) + (text[i + 1] - 0xDC00);
+            return 2;
+        }
+        return 1;
+    }
+
+    template<size_t N, size_t M>
+    std::u32string_view lookup(const char32_t (&codes)[N], const uint16_t (&offsets)[M], const char32_t* text, char32_t c) {
+        const char32_t* found = std::lower_bound(codes, codes + N, c);
+        if (found == codes + N || *found != c) return {};
+        const size_t i = found - codes;
+        return std::u32string_view(text + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+
+    // Appends the full decomposition of c to out, which must have room for maxExpansion code points;
+    // returns the number of code points written.
+
+    inline size_t decompose(char32_t c, bool compat, char32_t* out) {
+        using namespace unicodeTables;
+        if (c - hangulBase < hangulCount) {
+            const char32_t s = c - hangulBase;
+            out[0] = leadingBase + s / (vowelCount * trailCount);
+            out[1] = vowelBase + s % (vowelCount * trailCount) / trailCount;
+            if (s % trailCount == 0) return 2;
+            out[2] = trailBase + s % trailCount;
+            return 3;
+        }
+        std::u32string_view d;
+        const uint16_t p = c < 0xA0 ? 0 : properties(c);
+        if (compat && (p & NoKD)) d = lookup(compatCodes, compatOffsets, compatText, c);
+        if (d.empty() && (p & NoD)) d = lookup(canonicalCodes, canonicalOffsets, canonicalText, c);
+        if (d.empty()) {
+            out[0] = c;
+            return 1;
+        }
+        return d.copy(out, d.length());
+    }
+
+    // The primary composites are also kept in an open-addressed hash table, made on first use in static storage (so
+    // with no allocation), where a pair is usually found, or not, with one probe rather than a binary search.
+
+    constexpr size_t compositionSlots = 2048;  // a power of two, more than twice the number of compositions
+
+    inline size_t compositionSlot(char32_t first, char32_t second) {
+        return static_cast<size_t>(((uint64_t(first) << 32 | second) * 0x9E3779B97F4A7C15ull) >> 53);
+    }
+
+    inline const unicodeTables::Composition* compositionTable() {
+        static_assert(std::size(unicodeTables::compositions) * 2 < compositionSlots && 1 << 11 == compositionSlots);
+        static const auto table = [] {
+            std::array<unicodeTables::Composition, compositionSlots> t = {};
+            for (const auto& c : unicodeTables::compositions) {
+                size_t i = compositionSlot(c.first, c.second);
+                while (t[i].composite) i = (i + 1) & (compositionSlots - 1);
+                t[i] = c;
+            }
+            return t;
+        }();
+        return table.data();
+    }
+
+    // The primary composite of two code points, or 0 if there is none.
+
+    inline char32_t composePair(char32_t first, char32_t second) {
+        if (first - leadingBase < leadingCount && second - vowelBase < vowelCount)
+            return hangulBase + ((first - leadingBase) * vowelCount + second - vowelBase) * trailCount;
+        if (first - hangulBase < hangulCount && (first - hangulBase) % trailCount == 0
+            && second - trailBase - 1 < trailCount - 1)
+            return first + (second - trailBase);
+        if (!(properties(second) & MaybeC)) return 0;
+        const unicodeTables::Composition* table = compositionTable();
+        for (size_t i = compositionSlot(first, second); table[i].composite; i = (i + 1) & (compositionSlots - 1))
+            if (table[i].first == first && table[i].second == second) return table[i].composite;
+        return 0;
+    }
+
+    // Puts a decomposed segment of n code points in canonical order and, if compose is true, composes it;
+    // returns the new length.
+
+    inline size_t normalizeSegment(char32_t* text, size_t n, bool compose) {
+        for (size_t i = 1; i < n; ++i) {
+            const char32_t c = text[i];
+            const uint8_t cc = canonicalClass(c);
+            if (!cc) continue;
+            size_t j = i;
+            for (; j > 0 && canonicalClass(text[j - 1]) > cc; --j) text[j] = text[j - 1];
+            text[j] = c;
+        }
+        if (!compose || n == 0) return n;
+        uint8_t lastClass = canonicalClass(text[0]);
+        size_t starter = lastClass ? SIZE_MAX : 0;
+        size_t kept = 1;
+        for (size_t i = 1; i < n; ++i) {
+            const uint8_t cc = canonicalClass(text[i]);
+            if (starter != SIZE_MAX && (kept - 1 == starter || lastClass < cc))
+                if (const char32_t composite = composePair(text[starter], text[i])) {
+                    text[starter] = composite;
+                    continue;
+                }
+            if (!cc) starter = kept;
+            lastClass = cc;
+            text[kept++] = text[i];
+        }
+        return kept;
+    }
+
+    // Workspaces hold a segment while it is decomposed and composed; room(n) makes room for n code points,
+    // or returns false if it can't.
+
+    struct FixedWorkspace {
+        char32_t text[segmentLimit + maxExpansion];
+        char32_t* data() { return text; }
+        bool room(size_t n) const { return n <= segmentLimit + maxExpansion; }
+    };
+
+    struct GrowingWorkspace {
+        std::u32string text;
+        char32_t* data() { return text.data(); }
+        bool room(size_t n) {
+            if (n > text.length()) text.resize(std::max(n, 2 * text.length()));
+            return true;
+        }
+    };
+
+    // Normalizes text, which must begin at a segment boundary, and calls output(std::u16string_view) with the results.
+    // If final is false, the last segment is left unprocessed, since later text might belong to it. Returns the length
+    // of text processed, or SIZE_MAX if a segment didn't fit in the workspace.
+
+    template<typename Workspace, typename Output>
+    size_t normalizeText(std::u16string_view text, NormalizationForm form, bool final, Workspace& workspace, Output&& output) {
+        const uint16_t mask    = quickCheckMask(form);
+        const bool     compat  = form == NormalizationForm::KC || form == NormalizationForm::KD;
+        const bool     compose = form == NormalizationForm::C  || form == NormalizationForm::KC;
+        size_t sent = 0;
+        size_t start = 0;
+        while (start < text.length()) {
+            while (start + 1 < text.length() && text[start] < 0x80 && text[start + 1] < 0x80) ++start;  // ASCII is a segment of its own
+            bool quick = true;
+            uint8_t lastClass = 0;
+            size_t end = start;
+            do {
+                char32_t c;
+                const size_t length = decode(text, end, c);
+                const uint16_t p = c < 0x80 ? 0 : properties(c);
+                if (end > start && !(p & (mask | ClassMask))) break;
+                const uint8_t cc = p & ClassMask;
+                if ((p & mask) || (cc && cc < lastClass)) quick = false;
+                lastClass = cc;
+                end += length;
+            } while (end < text.length());
+            if (end == text.length() && !final) break;
+            if (!quick) {
+                if (sent < start) output(text.substr(sent, start - sent));
+                size_t n = 0;
+                for (size_t i = start; i < end;) {
+                    char32_t c;
+                    i += decode(text, i, c);
+                    if (!workspace.room(n + maxExpansion)) return SIZE_MAX;
+                    n += decompose(c, compat, workspace.data() + n);
+                }
+                n = normalizeSegment(workspace.data(), n, compose);
+                char16_t units[64];
+                size_t u = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    if (u + 2 > std::size(units)) {
+                        output(std::u16string_view(units, u));
+                        u = 0;
+                    }
+                    const char32_t c = workspace.data()[i];
+                    if (c >= 0x10000) {
+                        units[u++] = static_cast<char16_t>(0xD800 + ((c - 0x10000) >> 10));
+                        units[u++] = static_cast<char16_t>(0xDC00 + (c & 0x03FF));
+                    }
+                    else units[u++] = static_cast<char16_t>(c);
+                }
+                if (u) output(std::u16string_view(units, u));
+                sent = end;
+            }
+            start = end;
+        }
+        if (sent < start) output(text.substr(sent, start - sent));
+        return start;
+    }
+
+}
+
+
+inline bool isNormalized(std::u16string_view text, NormalizationForm form) {
+    using namespace unicodeNormalization;
+    const uint16_t mask = quickCheckMask(form);
+    uint8_t lastClass = 0;
+    for (size_t i = 0; i < text.length();) {
+        char32_t c;
+        i += decode(text, i, c);
+        if (c < 0x80) {
+            lastClass = 0;
+            continue;
+        }
+        const uint16_t p = properties(c);
+        const uint8_t cc = p & ClassMask;
+        if ((p & mask) || (cc && cc < lastClass)) return false;
+        lastClass = cc;
+    }
+    return true;
+}
+
+inline std::u16string normalize(std::u16string_view text, NormalizationForm form) {
+    std::u16string result;
+    result.reserve(text.length());
+    unicodeNormalization::GrowingWorkspace workspace;
+    unicodeNormalization::normalizeText(text, form, true, workspace, [&](std::u16string_view s) { result += s; });
+    return result;
+}
+
+inline size_t normalize(std::u16string_view text, NormalizationForm form, char16_t* out, size_t capacity) {
+    unicodeNormalization::FixedWorkspace workspace;
+    size_t length = 0;
+    bool fits = true;
+    const size_t done = unicodeNormalization::normalizeText(text, form, true, workspace, [&](std::u16string_view s) {
+        if (length + s.length() > capacity) fits = false;
+        else length += s.copy(out + length, s.length());
+    });
+    return fits && done != SIZE_MAX ? length : 0;
+}
+
+inline size_t normalizeC(std::u16string_view text, char16_t* out, size_t capacity) {
+    return normalize(text, NormalizationForm::C, out, capacity);
+}
+
+inline size_t precomposeC(char32_t base, char32_t mark, char16_t* out) {
+    using namespace unicodeNormalization;
+    // Neither may decompose, and base must be a starter, so the pair is already decomposed and in canonical order.
+    if ((properties(base) & (NoD | ClassMask)) || (properties(mark) & NoD)) return 0;
+    const char32_t c = composePair(base, mark);
+    if (!c) return 0;
+    if (c < 0x10000) {
+        out[0] = static_cast<char16_t>(c);
+        return 1;
+    }
+    out[0] = static_cast<char16_t>(0xD800 + ((c - 0x10000) >> 10));
+    out[1] = static_cast<char16_t>(0xDC00 + (c & 0x03FF));
+    return 2;
+}
+
+
+class NormalizationStream {
+
+    NormalizationForm                              form;
+    std::u16string                                 pending;    // text after the last segment boundary
+    unicodeNormalization::GrowingWorkspace         workspace;
+
+public:
+
+    explicit NormalizationStream(NormalizationForm form) : form(form) {}
+
+    template<typename F> void write(std::u16string_view text, F output) {
+        if (pending.empty()) {
+            const size_t done = unicodeNormalization::normalizeText(text, form, false, workspace, output);
+            pending.assign(text.substr(done));
+        }
+        else {
+            pending += text;
+            const size_t done = unicodeNormalization::normalizeText(pending, form, false, workspace, output);
+            pending.erase(0, done);
+        }
+    }
+
+    template<typename F> void finish(F output) {
+        unicodeNormalization::normalizeText(pending, form, true, workspace, output);
+        pending.clear();
+    }
+
+};
@@ -4,19 +4,24 @@
 //
 #define IDD_ABOUT                     101
 #define IDD_SETKEY                    102
+#define IDD_PALETTE                   103
 #define IDC_ABOUT_VERSION             1001
 #define IDC_ABOUT_HELP                1002
 #define IDC_ABOUT_MORE                1003
+#define IDC_ABOUT_STATISTICS          1004
 #define IDC_SETKEY_COMPOSE_KEY        1010
 #define IDC_SETKEY_COMPOSEKEY         1011
+#define IDC_PALETTE_SEARCH            1012
+#define IDC_PALETTE_LIST              1013
+#define IDC_PALETTE_COUNT             1014
 
 // Next default values for new objects
 // 
 #ifdef APSTUDIO_INVOKED
 #ifndef APSTUDIO_READONLY_SYMBOLS
-#define _APS_NEXT_RESOURCE_VALUE        103
+#define _APS_NEXT_RESOURCE_VALUE        104
 #define _APS_NEXT_COMMAND_VALUE         40001
-#define _APS_NEXT_CONTROL_VALUE         1012
+#define _APS_NEXT_CONTROL_VALUE         1015
 #define _APS_NEXT_SYMED_VALUE           101
 #endif
 #endif
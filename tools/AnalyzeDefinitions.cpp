@@ -0,0 +1,144 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// AnalyzeDefinitions checks a definitions file for sequences that conflict with each other or with implicit
+// combinations (see src/DefinitionsAnalyzer.h), for use on shared definitions files before they are committed.
+//
+//     g++ -std=c++20 -O2 -Isrc tools/AnalyzeDefinitions.cpp src/ComposeEngine.cpp -o AnalyzeDefinitions
+//     ./AnalyzeDefinitions [-b] [-n limit] file.jsonc
+//
+//     -b  analyzes the file by itself, as the built-in definitions are (for compose-default.jsonc); otherwise it is
+//         laid over the built-in definitions, as a user definitions file is
+//     -n  lists at most this many issues (default 100); the counts are always complete
+//
+// Each issue is listed as file: kind: "key" -> output, followed by what it conflicts with; then the number of each kind
+// and the time taken to load and to analyze the definitions. The exit status is 1 if the file can't be read or is
+// not a valid definitions file, 2 if there are duplicate keys or shadowed sequences (which are never intended),
+// and 0 otherwise; overrides and hidden implicit combinations are often deliberate.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include "DefaultSequences.h"
+#include "DefinitionsAnalyzer.h"
+
+namespace {
+
+    std::string utf8(std::u16string_view s) {
+        return utf16to8(std::wstring(s.begin(), s.end()));
+    }
+
+    // Quotes a key or output as in a definitions file.
+
+    std::string quote(std::string_view s) {
+        std::string result = "\"";
+        for (const char c : s) {
+            if (c == '"' || c == '\\') result += '\\';
+            if (static_cast<unsigned char>(c) >= 0x20) result += c;
+            else {
+                char escape[8];
+                std::snprintf(escape, sizeof escape, "\\u%04X", static_cast<unsigned char>(c));
+                result += escape;
+            }
+        }
+        return result + '"';
+    }
+
+    double milliseconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+
+    bool        alone = false;
+    size_t      limit = 100;
+    const char* file  = 0;
+    for (int i = 1; i < argc; ++i) {
+        if      (!std::strcmp(argv[i], "-b")) alone = true;
+        else if (!std::strcmp(argv[i], "-n") && i + 1 < argc) limit = std::strtoul(argv[++i], 0, 10);
+        else file = argv[i];
+    }
+    if (!file) {
+        std::fprintf(stderr, "usage: AnalyzeDefinitions [-b] [-n limit] file.jsonc\n");
+        return 1;
+    }
+    std::ifstream in(file, std::ios::binary);
+    std::stringstream content;
+    if (!(content << in.rdbuf())) {
+        std::fprintf(stderr, "Can't read %s\n", file);
+        return 1;
+    }
+
+    DefinitionsReport report;
+    report.limit = limit;
+    auto start = std::chrono::steady_clock::now();
+    auto definitions = alone ? std::make_shared<ComposeDefinitions>() : ComposeDefinitions::builtIn();
+    std::string error;
+    if (!definitions->overlay(content.str(), 0, &report, &error)) {
+        std::fprintf(stderr, "%s: error: not a valid definitions file: %s\n", file, error.c_str());
+        return 1;
+    }
+    const double loading = milliseconds(start);
+    start = std::chrono::steady_clock::now();
+    const SequenceTrie builtIn = defaultSequences::trie();
+    analyzeDefinitions(*definitions, report, alone ? 0 : &builtIn);
+    const double analyzing = milliseconds(start);
+
+    for (const DefinitionsIssue& issue : report.issues) {
+        const std::string key = quote(issue.key) + " -> " + quote(utf8(issue.output));
+        const std::string other = quote(utf8(issue.other));
+        switch (issue.kind) {
+        case DefinitionsIssue::Duplicate:
+            std::printf("%s: duplicate: %s replaces %s\n", file, key.c_str(), other.c_str());
+            break;
+        case DefinitionsIssue::Override:
+            std::printf("%s: override: %s replaces %s\n", file, key.c_str(), other.c_str());
+            break;
+        case DefinitionsIssue::Shadowed:
+            std::printf("%s: shadowed: %s can't be typed after %s -> %s\n", file, key.c_str(),
+                        quote(issue.otherKey).c_str(), other.c_str());
+            break;
+        case DefinitionsIssue::Implicit:
+            std::printf("%s: implicit: %s hides implicit combination %s\n", file, key.c_str(), other.c_str());
+            break;
+        case DefinitionsIssue::HexEntry:
+            std::printf("%s: hex entry: %s hides #x entry of %s\n", file, key.c_str(), other.c_str());
+            break;
+        }
+    }
+    const size_t listed = report.issues.size();
+    size_t total = 0;
+    for (size_t count : report.counts) total += count;
+    if (listed < total) std::printf("... %zu more\n", total - listed);
+    std::printf("%zu duplicate, %zu override, %zu shadowed, %zu implicit, %zu hex entry; loaded in %.1f ms, analyzed in %.1f ms\n",
+                report.counts[DefinitionsIssue::Duplicate], report.counts[DefinitionsIssue::Override],
+                report.counts[DefinitionsIssue::Shadowed], report.counts[DefinitionsIssue::Implicit],
+                report.counts[DefinitionsIssue::HexEntry], loading, analyzing);
+
+    return report.counts[DefinitionsIssue::Duplicate] || report.counts[DefinitionsIssue::Shadowed] ? 2 : 0;
+
+}
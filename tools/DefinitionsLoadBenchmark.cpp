@@ -0,0 +1,224 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// DefinitionsLoadBenchmark compares two ways of loading a user definitions file over the built-in definitions:
+//
+//     dom: parse the whole file into an nlohmann::json document, then copy the sequences out of it
+//          and compile them (the way the plugin loaded definitions before parseDefinitions)
+//     sax: parseDefinitions (see src/DefinitionsParser.h)
+//
+// For each size it generates a file of that many sequences with syntheticDefinitions (see SyntheticDefinitions.h),
+// then reports the time to parse and compile, the peak heap use while doing so, and the heap still in use afterward
+// (for dom, the document is kept, as it was by the plugin), also as bytes per sequence, with the bytes per sequence
+// of the compiled table alone. Heap use is measured by replacing the global operator new and operator delete.
+//
+// It then writes the file to a temporary file and loads it as loadSequenceDefinitions does, reporting the time taken by
+// each phase: read (the file, which the system will have cached), parse, sort, merge, build (the sequence table),
+// combining (the combining rules), and the total with the peak heap use; and, for the first keystroke of a sequence
+// with the new definitions, the time to process it compared with the median of later keystrokes.
+//
+//     g++ -std=c++20 -O2 -Isrc tools/DefinitionsLoadBenchmark.cpp src/ComposeEngine.cpp -o DefinitionsLoadBenchmark
+//     ./DefinitionsLoadBenchmark [count ...]
+//
+// The default counts are 1000 10000 100000 1000000.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <new>
+#include "ComposeEngine.h"
+#include "DefinitionsParser.h"
+#include "DefaultSequences.h"
+#include "SyntheticDefinitions.h"
+
+namespace {
+
+    size_t heapInUse = 0;
+    size_t heapPeak  = 0;
+
+    void* allocate(size_t size) {
+        size_t* p = static_cast<size_t*>(std::malloc(size + sizeof(std::max_align_t)));
+        if (!p) throw std::bad_alloc();
+        *p = size;
+        heapInUse += size;
+        if (heapInUse > heapPeak) heapPeak = heapInUse;
+        return reinterpret_cast<char*>(p) + sizeof(std::max_align_t);
+    }
+
+    void release(void* q) {
+        if (!q) return;
+        size_t* p = reinterpret_cast<size_t*>(static_cast<char*>(q) - sizeof(std::max_align_t));
+        heapInUse -= *p;
+        std::free(p);
+    }
+
+}
+
+void* operator new  (size_t size)                 { return allocate(size); }
+void* operator new[](size_t size)                 { return allocate(size); }
+void  operator delete  (void* p) noexcept         { release(p); }
+void  operator delete[](void* p) noexcept         { release(p); }
+void  operator delete  (void* p, size_t) noexcept { release(p); }
+void  operator delete[](void* p, size_t) noexcept { release(p); }
+
+namespace {
+
+    struct Measure {
+        double milliseconds;
+        size_t peak;
+        size_t retained;
+        size_t sequences;
+        size_t storage;
+    };
+
+    template<typename F> Measure measure(F load) {
+        const size_t before = heapInUse;
+        heapPeak = heapInUse;
+        const auto start = std::chrono::steady_clock::now();
+        auto result = load();
+        const auto stop  = std::chrono::steady_clock::now();
+        Measure m;
+        m.milliseconds = std::chrono::duration<double, std::milli>(stop - start).count();
+        m.peak         = heapPeak  - before;
+        m.retained     = heapInUse - before;
+        m.sequences    = 0;
+        m.storage      = result.second.storageBytes();
+        result.second.forEach([&](std::string_view, std::u16string_view) { ++m.sequences; });
+        return m;
+    }
+
+    class Discard : public ComposeEngine::OutputSink {
+    public:
+        void send(std::u16string_view) override {}
+    };
+
+    // Loads a definitions file as LoadSequenceDefinitions.cpp compile() does, and reports each phase.
+
+    void loadPhases(const std::string& path, size_t sequences) {
+
+        using clock = std::chrono::steady_clock;
+        auto ms = [](clock::time_point a, clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+        const size_t before = heapInUse;
+        heapPeak = heapInUse;
+        const auto start = clock::now();
+
+        auto definitions = ComposeDefinitions::builtIn();
+        std::string content;
+        std::ifstream userfile(path, std::ios::binary | std::ios::ate);
+        content.resize(static_cast<size_t>(userfile.tellg()));
+        userfile.seekg(0).read(content.data(), content.size());
+        const auto read = clock::now();
+
+        ParsePhases phases;
+        if (!definitions->overlay(content, &phases)) {
+            std::printf("  load: not a valid definitions file\n");
+            return;
+        }
+        content = std::string();
+        const std::shared_ptr<const ComposeDefinitions> published = std::move(definitions);
+        const auto stop = clock::now();
+        const size_t peak = heapPeak - before;
+
+        std::printf("  load %8.1f ms: read %.1f, parse %.1f, sort %.1f, merge %.1f, build %.1f, combining %.3f; %.1f MB peak\n",
+                    ms(start, stop), ms(start, read), phases.parse, phases.sort, phases.merge, phases.build, phases.combining,
+                    peak / 1048576.0);
+
+        // Type the first key of each of some sequences: the first is timed on its own, the rest for the median.
+
+        std::vector<std::string> keys;
+        published->sequences.forEach([&](std::string_view key, std::u16string_view) {
+            if (keys.size() < 1001 && std::hash<std::string_view>()(key) % (sequences / 1000 + 1) == 0) keys.emplace_back(key);
+        });
+        ComposeEngine engine;
+        Discard out;
+        std::vector<double> nanoseconds;
+        for (const std::string& key : keys) {
+            const std::wstring w = utf8to16(key);
+            const std::u16string first(1, static_cast<char16_t>(w[0]));
+            engine.start(published);
+            const auto a = clock::now();
+            engine.key(first, out);
+            const auto b = clock::now();
+            engine.cancel();
+            nanoseconds.push_back(std::chrono::duration<double, std::nano>(b - a).count());
+        }
+        if (nanoseconds.size() < 2) return;
+        const double firstKey = nanoseconds[0];
+        std::sort(nanoseconds.begin() + 1, nanoseconds.end());
+        std::printf("  first keystroke %.0f ns, later keystrokes %.0f ns (median)\n", firstKey, nanoseconds[nanoseconds.size() / 2]);
+
+    }
+
+    void report(const char* method, const Measure& m) {
+        std::printf("  %-4s %8.1f ms %8.1f MB peak %8.1f MB retained %10zu sequences %7.1f B/seq retained"
+                    " %7.1f B/seq table\n", method, m.milliseconds, m.peak / 1048576.0, m.retained / 1048576.0,
+                    m.sequences, double(m.retained) / m.sequences, double(m.storage) / m.sequences);
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+
+    std::vector<size_t> counts;
+    for (int i = 1; i < argc; ++i) counts.push_back(std::strtoull(argv[i], 0, 10));
+    if (counts.empty()) counts = { 1000, 10000, 100000, 1000000 };
+
+    const SequenceTrie base = defaultSequences::trie();
+
+    for (const size_t count : counts) {
+
+        const std::string file = syntheticDefinitions(count);
+        std::printf("%zu sequences, %.1f MB file\n", count, file.length() / 1048576.0);
+
+        report("dom", measure([&] {
+            auto document = nlohmann::json::parse(file, 0, false, true);
+            std::map<std::string, std::u16string> merged;
+            base.forEach([&](std::string_view key, std::u16string_view output) { merged.emplace(key, output); });
+            for (const auto& [key, value] : document.items()) {
+                if (value.is_string()) {
+                    const std::wstring w = utf8to16(value.get_ref<const std::string&>());
+                    merged[key] = std::u16string(w.begin(), w.end());
+                }
+                else merged.erase(key);
+            }
+            SequenceTrie::Rules rules(merged.begin(), merged.end());
+            return std::make_pair(std::move(document), SequenceTrie::build(rules));
+        }));
+
+        report("sax", measure([&] {
+            ParsedDefinitions parsed = parseDefinitions(file, base);
+            return std::make_pair(0, std::move(parsed.sequences));
+        }));
+
+        const std::string path = (std::filesystem::temp_directory_path() / "DefinitionsLoadBenchmark.jsonc").string();
+        std::ofstream(path, std::ios::binary) << file;
+        loadPhases(path, count);
+        std::filesystem::remove(path);
+
+    }
+
+    return 0;
+
+}
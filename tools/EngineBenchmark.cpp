@@ -0,0 +1,429 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// EngineBenchmark drives the compose engine (see src/ComposeEngine.h) without Windows or Notepad++: it types every
+// built-in sequence, one character per key, and checks that each one composes its output (a sequence that is a prefix
+// of another is typed as it would be, so the longer one can't be reached and is counted as unreachable).
+//
+// It reports the keys processed per second, matching by the sequence trie and by linear scan, and the number of heap
+// allocations made while processing keys, which should be zero; the exit status is nonzero if there were any,
+// or if any reachable sequence did not compose its output.
+//
+// It then types implicit combinations of letters with two stacked combining marks, and reports the combinations
+// composed (and normalized, by UnicodeNormalization.h) per second and the allocations made, which should also be zero.
+//
+// It also types every sequence with the engine committing on a unique prefix, reporting the keys saved, and checks
+// committing on a unique prefix, longest match and choosing by number (see ComposeEngine::setMatching and key)
+// on a few made-up sequences.
+//
+// Finally it checks the choices (see SequenceTrie::choices) of every prefix of a built-in sequence against the
+// sequences that begin with it, sorted by length and then by key, and reports the time to get the choices of a
+// prefix with the keys and output of each, as a host does to show them, and the allocations made, which should be zero.
+// It checks that a trie made from copies of the arrays with the stored summaries and choices, as one is made from a
+// cache file (see src/DefinitionsCache.cpp), gives the same completions and choices, and compares the time to make it
+// with the time to make one that computes them.
+//
+//     g++ -std=c++20 -O2 -Isrc tools/EngineBenchmark.cpp src/ComposeEngine.cpp -o EngineBenchmark
+//     ./EngineBenchmark [repetitions]
+//
+// The default is 20 repetitions.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <set>
+#include "ComposeEngine.h"
+#include "UnicodeFormatTranslation.h"
+
+namespace {
+
+    bool   counting    = false;
+    size_t allocations = 0;
+
+    void* allocate(size_t size) {
+        if (counting) ++allocations;
+        if (void* p = std::malloc(size ? size : 1)) return p;
+        throw std::bad_alloc();
+    }
+
+}
+
+void* operator new  (size_t size)                 { return allocate(size); }
+void* operator new[](size_t size)                 { return allocate(size); }
+void  operator delete  (void* p) noexcept         { std::free(p); }
+void  operator delete[](void* p) noexcept         { std::free(p); }
+void  operator delete  (void* p, size_t) noexcept { std::free(p); }
+void  operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+    // Collects what the engine sends, up to a fixed length.
+
+    class Collect : public ComposeEngine::OutputSink {
+    public:
+        FixedString<char16_t, 1024> text;
+        void send(std::u16string_view s) override { text.append(s); }
+    };
+
+    struct Sequence {
+        std::vector<std::u16string> keys;
+        std::u16string              output;
+        bool                        reachable = true;
+    };
+
+    // Splits each key into key text, one code point per key.
+
+    std::vector<Sequence> sequences(const ComposeDefinitions& definitions) {
+        std::vector<Sequence> result;
+        definitions.sequences.forEach([&](std::string_view key, std::u16string_view output) {
+            Sequence& sequence = result.emplace_back();
+            const std::wstring w = utf8to16(key);
+            for (size_t i = 0; i < w.length(); ++i) {
+                size_t n = w[i] >= 0xD800 && w[i] < 0xDC00 && i + 1 < w.length() ? 2 : 1;
+                sequence.keys.emplace_back(w.begin() + i, w.begin() + i + n);
+                i += n - 1;
+            }
+            sequence.output = output;
+            std::string_view prefix = key;
+            while (!prefix.empty()) {
+                prefix.remove_suffix(1);
+                if (definitions.sequences.complete(definitions.sequences.next(SequenceTrie::root, prefix)))
+                    sequence.reachable = false;
+            }
+        });
+        return result;
+    }
+
+    struct Result {
+        double keysPerSecond;
+        size_t keys;
+        size_t composed;
+        size_t failed;
+    };
+
+    // Types each letter followed by two different combining marks and Enter, repetitions times.
+
+    Result combine(std::shared_ptr<const ComposeDefinitions> definitions, int repetitions) {
+        ComposeEngine engine;
+        Collect out;
+        Result r = { 0, 0, 0, 0 };
+        std::vector<std::u16string> marks;
+        for (const CombiningRule& rule : definitions->combiningRules) if (rule.one > 1) {
+            marks.emplace_back(1, static_cast<char16_t>(rule.key));
+            if (rule.key >> 16) marks.back() += static_cast<char16_t>(rule.key >> 16);
+        }
+        const std::u16string_view letters = u"aeiouyAEIOUYcgnrsz";
+        counting = true;
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep) for (char16_t letter : letters)
+            for (const auto& first : marks) for (const auto& second : marks) {
+                if (&first == &second) continue;
+                out.text.clear();
+                engine.start(definitions);
+                for (std::u16string_view key : { std::u16string_view(&letter, 1), std::u16string_view(first),
+                                                 std::u16string_view(second), std::u16string_view(u"\r") }) {
+                    engine.key(key, out);
+                    ++r.keys;
+                    if (!engine.composing()) break;
+                }
+                if (engine.composing()) ++r.failed;
+                else ++r.composed;
+                engine.cancel();
+            }
+        const auto stop = std::chrono::steady_clock::now();
+        counting = false;
+        r.keysPerSecond = r.composed / std::chrono::duration<double>(stop - start).count();
+        return r;
+    }
+
+    Result run(std::shared_ptr<const ComposeDefinitions> definitions, const std::vector<Sequence>& list, int repetitions,
+               bool uniquePrefix = false) {
+        ComposeEngine engine;
+        engine.setMatching(uniquePrefix, false);
+        Collect out;
+        Result r = { 0, 0, 0, 0 };
+        counting = true;
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep) for (const Sequence& sequence : list) {
+            if (!sequence.reachable) continue;
+            out.text.clear();
+            engine.start(definitions);
+            for (const auto& key : sequence.keys) {
+                engine.key(key, out);
+                ++r.keys;
+                if (!engine.composing()) break;
+            }
+            if (rep == 0) {
+                if (!engine.composing() && out.text == sequence.output) ++r.composed;
+                else ++r.failed;
+            }
+            engine.cancel();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        counting = false;
+        r.keysPerSecond = r.keys / std::chrono::duration<double>(stop - start).count();
+        return r;
+    }
+
+    // Types keys with the matching options given, passing choosing with each; a key of * stands for the compose key
+    // (restart), and one of ! for the timeout that makes the host call expire. Returns what was sent, with | where
+    // composing ended.
+
+    std::u16string type(std::shared_ptr<const ComposeDefinitions> definitions, bool uniquePrefix, bool longestMatch,
+                        bool choosing, std::initializer_list<std::u16string_view> keys) {
+        ComposeEngine engine;
+        engine.setMatching(uniquePrefix, longestMatch);
+        Collect out;
+        engine.start(definitions);
+        for (std::u16string_view key : keys) {
+            if (key == u"*") engine.restart(out);
+            else if (key == u"!") engine.expire(out);
+            else engine.key(key, out, choosing);
+            if (!engine.composing()) {
+                out.text.push_back(u'|');
+                break;
+            }
+        }
+        return std::u16string(out.text);
+    }
+
+    // Checks committing on a unique prefix, longest match and choosing by number with definitions that have
+    // sequences which are complete and also the beginning of longer ones; returns the number of failures.
+
+    size_t matching() {
+        auto definitions = ComposeDefinitions::builtIn();
+        definitions->overlay(R"({ "§q": "1", "§qr": "2", "§qrs": "3", "§w": "4", "§5x": "8",)"
+                             R"(  "¤ab": "5", "¤ac": "5", "¤bd": "6", "¤be": "7" })");
+        struct Case { bool unique, longest, choices; std::initializer_list<std::u16string_view> keys; std::u16string_view expected; };
+        const Case cases[] = {
+            { false, false, false, { u"§", u"q", u"r" }            , u"1|"      },
+            { false, true , false, { u"§", u"q", u"r", u"s" }      , u"3|"      },
+            { false, true , false, { u"§", u"q", u"r", u"!" }      , u"2|"      },
+            { false, true , false, { u"§", u"q", u"x" }            , u"1x|"     },
+            { false, true , false, { u"§", u"q", u"r", u"[Up]" }   , u"2[Up]|"  },
+            { false, true , false, { u"§", u"q", u"*", u"§", u"w" }, u"14|"     },
+            { false, true , false, { u"§", u"w" }                  , u"4|"      },
+            { false, true , false, { u"§", u"!", u"w" }            , u"4|"      },
+            { true , false, false, { u"¤", u"a" }                  , u"5|"      },
+            { true , false, false, { u"¤", u"b", u"e" }            , u"7|"      },
+            { false, false, false, { u"¤", u"a", u"c" }            , u"5|"      },
+            { true , true , false, { u"§", u"q", u"r", u"s" }      , u"3|"      },
+            { false, false, false, { u"¤", u"3" }                  , u"¤3|"     },
+            { false, false, true , { u"¤", u"3" }                  , u"6|"      },
+            { false, false, true , { u"¤", u"b", u"2" }            , u"7|"      },
+            { false, false, true , { u"¤", u"b", u"3" }            , u"¤b3|"    },
+            { false, false, true , { u"§", u"2" }                  , u"4|"      },
+            { false, false, true , { u"§", u"3" }                  , u"8|"      },
+            { false, false, true , { u"§", u"5", u"x" }            , u"8|"      },
+            { false, true , true , { u"§", u"q", u"2" }            , u"2|"      },
+        };
+        size_t failures = 0;
+        for (const Case& c : cases) {
+            const std::u16string result = type(definitions, c.unique, c.longest, c.choices, c.keys);
+            if (result == c.expected) continue;
+            ++failures;
+            std::printf("  unique %d longest %d choices %d:", c.unique, c.longest, c.choices);
+            for (std::u16string_view key : c.keys) std::printf(" %s", utf16to8(std::wstring(key.begin(), key.end())).c_str());
+            std::printf(" sent %s, not %s\n", utf16to8(std::wstring(result.begin(), result.end())).c_str(),
+                        utf16to8(std::wstring(c.expected.begin(), c.expected.end())).c_str());
+        }
+        std::printf("  matching %zu cases, %zu failed\n", std::size(cases), failures);
+        return failures;
+    }
+
+    // Checks the choices of every prefix of a sequence, and times getting them as a host shows them; returns the
+    // number of failures.
+
+    size_t choices(const SequenceTrie& trie, int repetitions) {
+        std::vector<std::string> keys;
+        trie.forEach([&](std::string_view key, std::u16string_view) { keys.emplace_back(key); });
+        std::set<std::string> prefixes;
+        for (const std::string& key : keys) for (size_t n = 1; n <= key.length(); ++n) prefixes.insert(key.substr(0, n));
+        std::vector<SequenceTrie::State> states;
+        size_t failures = 0;
+        std::string widest;
+        uint32_t widestCount = 0;
+        for (const std::string& prefix : prefixes) {
+            const SequenceTrie::State state = trie.next(SequenceTrie::root, prefix);
+            states.push_back(state);
+            std::vector<std::string> expected;
+            for (auto i = std::lower_bound(keys.begin(), keys.end(), prefix); i != keys.end() && i->starts_with(prefix); ++i)
+                expected.push_back(*i);
+            std::stable_sort(expected.begin(), expected.end(),
+                             [](const std::string& a, const std::string& b) { return a.length() < b.length(); });
+            if (expected.size() > widestCount) {
+                widest      = prefix;
+                widestCount = static_cast<uint32_t>(expected.size());
+            }
+            expected.resize(std::min<size_t>(expected.size(), SequenceTrie::maxChoices));
+            std::vector<std::string> found;
+            for (const SequenceTrie::State choice : trie.choices(state)) {
+                char rest[256];
+                const size_t n = trie.suffix(state, choice, rest);
+                found.push_back(prefix + std::string(rest, n));
+                if (!trie.complete(choice)) found.back() += " (incomplete)";
+            }
+            if (found == expected) continue;
+            if (failures++ < 10) {
+                std::printf("  choices of %s:", prefix.c_str());
+                for (const std::string& key : found) std::printf(" %s", key.c_str());
+                std::printf(", not");
+                for (const std::string& key : expected) std::printf(" %s", key.c_str());
+                std::printf("\n");
+            }
+        }
+        const SequenceTrie::State widestState = trie.next(SequenceTrie::root, widest);
+        size_t bytes = 0;
+        allocations = 0;
+        counting = true;
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep) for (const SequenceTrie::State state : states)
+            for (const SequenceTrie::State choice : trie.choices(state)) {
+                char rest[256];
+                bytes += trie.suffix(state, choice, rest) + trie.output(choice).length();
+            }
+        const auto middle = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions * 1000; ++rep)
+            for (const SequenceTrie::State choice : trie.choices(widestState)) {
+                char rest[256];
+                bytes += trie.suffix(widestState, choice, rest) + trie.output(choice).length();
+            }
+        const auto stop = std::chrono::steady_clock::now();
+        counting = false;
+        [[maybe_unused]] static volatile size_t used;
+        used = bytes;  // so the loops are not optimized away
+        std::printf("  choices  %zu prefixes in %.0f ns each; %s (%u sequences) in %.0f ns; %zu failed %zu allocations\n",
+                    states.size(), std::chrono::duration<double>(middle - start).count() * 1e9 / (repetitions * states.size()),
+                    widest.c_str(), widestCount, std::chrono::duration<double>(stop - middle).count() * 1e9 / (repetitions * 1000),
+                    failures, allocations);
+        return failures + allocations;
+    }
+
+    // Copies the trie's arrays, with its summaries and choices, into one buffer as a cache file holds them, makes a
+    // trie that refers to the copies, and checks that it gives the same completions and choices for every state;
+    // times making a trie from the arrays with the summaries computed and with them stored. Returns the number of
+    // failures.
+
+    size_t stored(const SequenceTrie& trie, int repetitions) {
+        const auto nodes     = trie.nodeArray();
+        const auto edges     = trie.edgeArray();
+        const auto text      = trie.textArray();
+        const auto summaries = trie.summaryArray();
+        const auto choices   = trie.choiceArray();
+        size_t size = 0;
+        auto place = [&](size_t bytes) {
+            const size_t offset = size;
+            size = (size + bytes + 7) & ~size_t(7);
+            return offset;
+        };
+        const size_t nodeOffset    = place(nodes.size_bytes());
+        const size_t edgeOffset    = place(edges.size_bytes());
+        const size_t textOffset    = place(text.length() * sizeof(char16_t));
+        const size_t summaryOffset = place(summaries.size_bytes());
+        const size_t choiceOffset  = place(choices.size_bytes());
+        std::vector<uint64_t> buffer(size / 8);
+        char* base = reinterpret_cast<char*>(buffer.data());
+        std::memcpy(base + nodeOffset   , nodes.data()    , nodes.size_bytes());
+        std::memcpy(base + edgeOffset   , edges.data()    , edges.size_bytes());
+        std::memcpy(base + textOffset   , text.data()     , text.length() * sizeof(char16_t));
+        std::memcpy(base + summaryOffset, summaries.data(), summaries.size_bytes());
+        std::memcpy(base + choiceOffset , choices.data()  , choices.size_bytes());
+        const std::span<const SequenceTrie::Node> storedNodes(
+            reinterpret_cast<const SequenceTrie::Node*>(base + nodeOffset), nodes.size());
+        const std::span<const SequenceTrie::Edge> storedEdges(
+            reinterpret_cast<const SequenceTrie::Edge*>(base + edgeOffset), edges.size());
+        const std::u16string_view storedText(reinterpret_cast<const char16_t*>(base + textOffset), text.length());
+        const std::span<const SequenceTrie::Summary> storedSummaries(
+            reinterpret_cast<const SequenceTrie::Summary*>(base + summaryOffset), summaries.size());
+        const std::span<const SequenceTrie::State> storedChoices(
+            reinterpret_cast<const SequenceTrie::State*>(base + choiceOffset), choices.size());
+
+        const SequenceTrie copy(storedNodes, storedEdges, storedText, storedSummaries, storedChoices);
+        size_t failures = 0;
+        for (SequenceTrie::State state = 0; state < nodes.size(); ++state) {
+            const auto a = trie.choices(state);
+            const auto b = copy.choices(state);
+            if (trie.completions(state) == copy.completions(state) && trie.onlyCompletion(state) == copy.onlyCompletion(state)
+                && std::equal(a.begin(), a.end(), b.begin(), b.end())) continue;
+            if (failures++ < 10) std::printf("  stored summary of state %u differs\n", state);
+        }
+
+        size_t completions = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep)
+            completions += SequenceTrie(storedNodes, storedEdges, storedText).completions(SequenceTrie::root);
+        const auto middle = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep)
+            completions += SequenceTrie(storedNodes, storedEdges, storedText, storedSummaries, storedChoices)
+                               .completions(SequenceTrie::root);
+        const auto stop = std::chrono::steady_clock::now();
+        [[maybe_unused]] static volatile size_t used;
+        used = completions;
+        std::printf("  stored   %zu states; made in %.0f us summarizing, %.2f us with stored summaries; %zu failed\n",
+                    nodes.size(), std::chrono::duration<double>(middle - start).count() * 1e6 / repetitions,
+                    std::chrono::duration<double>(stop - middle).count() * 1e6 / repetitions, failures);
+        return failures;
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+
+    const int repetitions = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    auto trie = ComposeDefinitions::builtIn();
+    auto linear = ComposeDefinitions::builtIn();
+    linear->keepLinearRules();
+    const std::vector<Sequence> list = sequences(*trie);
+    size_t unreachable = 0;
+    for (const Sequence& sequence : list) if (!sequence.reachable) ++unreachable;
+    std::printf("%zu built-in sequences, %zu unreachable\n", list.size(), unreachable);
+
+    bool ok = true;
+    for (auto [method, definitions] : { std::make_pair("trie", trie), std::make_pair("linear", linear) }) {
+        allocations = 0;
+        const Result r = run(definitions, list, method == std::string_view("trie") ? repetitions : 1);
+        std::printf("  %-6s %12.0f keys/s %10zu keys %6zu composed %6zu failed %6zu allocations\n",
+                    method, r.keysPerSecond, r.keys, r.composed, r.failed, allocations);
+        ok = ok && r.failed == 0 && allocations == 0;
+    }
+
+    const Result all    = run(trie, list, 1);
+    const Result unique = run(trie, list, 1, true);
+    std::printf("  %-6s %10zu keys instead of %zu, %6zu composed %6zu failed (committing on a unique prefix)\n",
+                "unique", unique.keys, all.keys, unique.composed, unique.failed);
+    ok = ok && unique.failed == 0 && matching() == 0;
+
+    allocations = 0;
+    const Result r = combine(trie, repetitions);
+    std::printf("  %-8s %10.0f combinations/s %6zu composed %6zu failed %6zu allocations\n",
+                "implicit", r.keysPerSecond, r.composed, r.failed, allocations);
+    ok = ok && r.failed == 0 && allocations == 0;
+
+    ok = ok && choices(trie->sequences, repetitions) == 0;
+    ok = ok && stored(trie->sequences, repetitions) == 0;
+
+    return ok ? 0 : 1;
+
+}
@@ -0,0 +1,378 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// GenerateDefaultSequences reads compose-default.jsonc, checks it, and writes src/DefaultSequences.h,
+// which holds the built-in definitions as a compiled SequenceTrie in constexpr arrays, and the category of each
+// sequence: the section of the file it is in, named by the last comment before it that is on a line by itself
+// between blank lines (such as // Currency signs).
+//
+// It needs only a C++20 compiler and the headers in src; for example, from the repository root:
+//
+//     g++ -std=c++20 -O2 -Isrc tools/GenerateDefaultSequences.cpp -o GenerateDefaultSequences
+//     ./GenerateDefaultSequences compose-default.jsonc src/DefaultSequences.h
+//
+// Problems are reported as file:line: error/warning: message. If there are any errors, the output is not written
+// and the exit status is 1. Errors are:
+//     duplicate keys with different values (the one that would win at run time is not necessarily the one intended)
+//     explicit sequences whose values are neither strings nor null, and empty keys
+//     "implicit combining rules" that is not an object, or rows that are not arrays of four elements,
+//     of which the first is a single character and the rest are single characters, true or false
+// Warnings are duplicate keys with identical values and null values (which have no purpose in the defaults).
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include "nlohmann/json.hpp"
+#include "SequenceTrie.h"
+#include "UnicodeFormatTranslation.h"
+
+namespace {
+
+    using json = nlohmann::json;
+
+    std::string sourceName;
+    std::string sourceText;
+    int errors   = 0;
+    int warnings = 0;
+
+    // Line number of the n-th (zero-based) occurrence of a key at the beginning of a line (ignoring white space)
+    // in the source at or after offset start, or 0 if it can't be found.
+
+    int lineOf(const std::string& key, int n = 0, size_t start = 0) {
+        const std::string quoted = json(key).dump();
+        size_t position = start;
+        for (int i = 0; i <= n; ++i) {
+            for (bool first = true;; first = false) {
+                position = sourceText.find(quoted, i || !first ? position + 1 : position);
+                if (position == std::string::npos) return 0;
+                const size_t lineStart = sourceText.find_last_of('\n', position) + 1;  // npos + 1 == 0
+                if (sourceText.find_first_not_of(" \t", lineStart) == position) break;
+            }
+        }
+        return 1 + static_cast<int>(std::count(sourceText.begin(), sourceText.begin() + position, '\n'));
+    }
+
+    void report(bool error, int line, const std::string& message) {
+        std::cerr << sourceName << ':' << line << ": " << (error ? "error: " : "warning: ") << message << '\n';
+        ++(error ? errors : warnings);
+    }
+
+    bool singleCharacter(const json& j, char32_t& c) {
+        if (!j.is_string()) return false;
+        const std::u32string s = utf8to32(j.get_ref<const std::string&>());
+        if (s.length() != 1) return false;
+        c = s[0];
+        return true;
+    }
+
+    bool combiningValue(const json& j, char32_t& c) {
+        if (j.is_boolean()) {
+            c = j ? 1 : 0;
+            return true;
+        }
+        return singleCharacter(j, c);
+    }
+
+    struct CombiningRow { std::string key; char32_t one, two, up, down; };
+
+    // Top level entries in file order, and rows of "implicit combining rules" in file order, as seen by the parser.
+
+    std::vector<std::pair<std::string, json>> entries;
+    std::vector<std::pair<std::string, json>> combiningEntries;
+
+    bool parseSource() {
+        std::string key1, key2;
+        auto callback = [&](int depth, json::parse_event_t event, json& parsed) {
+            if (event == json::parse_event_t::key) {
+                if (depth == 1) key1 = parsed; else if (depth == 2) key2 = parsed;
+            }
+            else if (event == json::parse_event_t::value || event == json::parse_event_t::object_end
+                                                         || event == json::parse_event_t::array_end) {
+                if (depth == 1) entries.emplace_back(key1, parsed);
+                else if (depth == 2 && key1 == "implicit combining rules") combiningEntries.emplace_back(key2, parsed);
+            }
+            return true;
+        };
+        try {
+            json result = json::parse(sourceText, callback, true, true);
+            if (!result.is_object()) {
+                report(true, 1, "the file must contain a single JSON object");
+                return false;
+            }
+        }
+        catch (const json::parse_error& e) {
+            report(true, 0, e.what());
+            return false;
+        }
+        return true;
+    }
+
+    // Checks the entries and makes the sorted list of explicit rules and the list of combining rules.
+
+    void checkEntries(std::map<std::string, std::string>& rules, std::vector<CombiningRow>& combining) {
+
+        std::map<std::string, int> seen;  // key -> number of times seen so far
+        std::map<std::string, json> first;
+        for (const auto& [key, value] : entries) {
+            const int n = seen[key]++;
+            const int line = lineOf(key, n);
+            if (n) {
+                if (first[key] == value)
+                    report(false, line, "duplicate key " + json(key).dump() + " repeats the same value");
+                else
+                    report(true, line, "duplicate key " + json(key).dump() + " has value " + value.dump()
+                                     + " but line " + std::to_string(lineOf(key)) + " has " + first[key].dump());
+            }
+            else first[key] = value;
+            if (key == "implicit combining rules") continue;
+            if (key.empty()) report(true, line, "empty key");
+            else if (value.is_null()) report(false, line, "null value for " + json(key).dump() + " has no effect here");
+            else if (!value.is_string()) report(true, line, "value for " + json(key).dump() + " is not a string");
+            else if (!n) rules[key] = value.get<std::string>();
+        }
+
+        if (!seen.contains("implicit combining rules")) return;
+        if (!first["implicit combining rules"].is_object()) {
+            report(true, lineOf("implicit combining rules"), "\"implicit combining rules\" is not an object");
+            return;
+        }
+        const size_t start = sourceText.find("\"implicit combining rules\"");
+        std::map<std::string, int> seenRow;
+        for (const auto& [key, row] : combiningEntries) {
+            const int n = seenRow[key]++;
+            const int line = lineOf(key, n, start);
+            const std::string name = "implicit combining rule " + json(key).dump();
+            if (n) {
+                report(true, line, "duplicate " + name);
+                continue;
+            }
+            CombiningRow r = { key, 0, 0, 0, 0 };
+            if (key.empty()) report(true, line, "empty key in implicit combining rules");
+            else if (!row.is_array() || row.size() != 4)
+                report(true, line, name + " must be an array of four elements");
+            else if (!singleCharacter(row[0], r.one))
+                report(true, line, name + ": the first element must be a single character");
+            else if (!combiningValue(row[1], r.two) || !combiningValue(row[2], r.up) || !combiningValue(row[3], r.down))
+                report(true, line, name + ": elements after the first must be single characters, true or false");
+            else combining.push_back(r);
+        }
+
+    }
+
+    std::string cLiteral(std::string_view s) {
+        std::string r = "\"";
+        char octal[8];
+        for (const char c : s) {
+            if (c == '"' || c == '\\') { r += '\\'; r += c; }
+            else if (c >= 0x20 && c < 0x7F) r += c;
+            else {
+                std::snprintf(octal, sizeof octal, "\\%03o", static_cast<unsigned char>(c));
+                r += octal;
+            }
+        }
+        return r + '"';
+    }
+
+    // Section headings: (line number, text) of each comment on a line by itself between blank lines, in file order.
+
+    std::vector<std::pair<int, std::string>> sections() {
+        std::vector<std::pair<int, std::string>> result;
+        std::vector<std::string> lines;
+        std::istringstream in(sourceText);
+        for (std::string line; std::getline(in, line);) {
+            while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t')) line.pop_back();
+            lines.push_back(line.substr(std::min(line.find_first_not_of(" \t"), line.length())));
+        }
+        for (size_t i = 0; i < lines.size(); ++i) {
+            if (!lines[i].starts_with("//") || (i > 0 && !lines[i - 1].empty()) || (i + 1 < lines.size() && !lines[i + 1].empty()))
+                continue;
+            const std::string text = lines[i].substr(std::min(lines[i].find_first_not_of("/ \t"), lines[i].length()));
+            if (!text.empty()) result.emplace_back(static_cast<int>(i + 1), text);
+        }
+        return result;
+    }
+
+    std::string hex(uint32_t n) {
+        char buffer[16];
+        std::snprintf(buffer, sizeof buffer, "0x%04X", n);
+        return buffer;
+    }
+
+    // Writes comma-separated items, wrapping lines at about 120 characters.
+
+    class ListWriter {
+        std::ostringstream& out;
+        size_t column = 0;
+    public:
+        ListWriter(std::ostringstream& out) : out(out) {}
+        void operator()(const std::string& item) {
+            if (column == 0) { out << "   "; column = 3; }
+            out << ' ' << item << ',';
+            column += item.length() + 2;
+            if (column > 116) { out << '\n'; column = 0; }
+        }
+        ~ListWriter() { if (column) out << '\n'; }
+    };
+
+    uint64_t fnv1a(std::string_view s) {
+        uint64_t h = 0xCBF29CE484222325ull;
+        for (const char c : s) h = (h ^ static_cast<unsigned char>(c)) * 0x100000001B3ull;
+        return h;
+    }
+
+    std::string generate(const SequenceTrie& trie, const std::vector<CombiningRow>& combining, size_t ruleCount,
+                         const std::vector<std::string>& categories, const std::vector<uint8_t>& nodeCategories) {
+        std::ostringstream out;
+        out << "// Generated by tools/GenerateDefaultSequences.cpp from compose-default.jsonc -- do not edit.\n"
+               "// " << ruleCount << " explicit sequences, " << combining.size() << " implicit combining rules.\n\n"
+               "#pragma once\n\n"
+               "#include \"SequenceTrie.h\"\n\n"
+               "namespace defaultSequences {\n\n";
+        char buffer[32];
+        std::snprintf(buffer, sizeof buffer, "0x%016llX", static_cast<unsigned long long>(fnv1a(sourceText)));
+        out << "inline constexpr uint64_t sourceHash = " << buffer << "ull;  // FNV-1a hash of compose-default.jsonc\n\n";
+
+        out << "inline constexpr uint32_t none = SequenceTrie::noOutput;\n\n"
+               "inline constexpr SequenceTrie::Node nodes[] = {\n";
+        {
+            ListWriter list(out);
+            for (const auto& n : trie.nodeArray())
+                list('{' + std::to_string(n.firstEdge) + ','
+                   + (n.outputOffset == SequenceTrie::noOutput ? std::string("none")
+                                                               : std::to_string(n.outputOffset))
+                   + ',' + std::to_string(n.edgeCount) + ',' + std::to_string(n.outputLength) + '}');
+        }
+        out << "};\n\ninline constexpr SequenceTrie::Edge edges[] = {\n";
+        {
+            ListWriter list(out);
+            for (const auto& e : trie.edgeArray()) list('{' + std::to_string(e.byte) + ',' + std::to_string(e.target) + '}');
+        }
+        out << "};\n\ninline constexpr char16_t text[] = {\n";
+        {
+            ListWriter list(out);
+            for (const char16_t c : trie.textArray()) list(hex(c));
+        }
+        out << "};\n\n"
+               "struct CombiningRule { const char* key; char32_t one, two, up, down; };\n\n"
+               "inline constexpr CombiningRule combiningRules[] = {\n";
+        for (const auto& r : combining)
+            out << "    { " << cLiteral(r.key) << ", " << hex(r.one) << ", " << hex(r.two) << ", "
+                << hex(r.up) << ", " << hex(r.down) << " },\n";
+        out << "};\n\n"
+               "inline constexpr uint8_t noCategory = 0xFF;\n\n"
+               "inline constexpr const char* categories[] = {\n";
+        for (const std::string& category : categories) out << "    " << cLiteral(category) << ",\n";
+        out << "};\n\n"
+               "inline constexpr uint8_t nodeCategories[] = {  // index in categories for each complete node, else noCategory\n";
+        {
+            ListWriter list(out);
+            for (const uint8_t c : nodeCategories) list(std::to_string(c));
+        }
+        out << "};\n\n"
+               "inline SequenceTrie trie() {\n"
+               "    return SequenceTrie(nodes, edges, std::u16string_view(text, std::size(text)));\n"
+               "}\n\n"
+               "}\n";
+        return out.str();
+    }
+
+}
+
+
+int main(int argc, char* argv[]) {
+
+    if (argc != 3) {
+        std::cerr << "usage: GenerateDefaultSequences compose-default.jsonc DefaultSequences.h\n";
+        return 2;
+    }
+
+    sourceName = argv[1];
+    {
+        std::ifstream file(sourceName, std::ios::binary);
+        if (!file) {
+            std::cerr << sourceName << ": error: cannot open file\n";
+            return 1;
+        }
+        sourceText = { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>{} };
+    }
+
+    std::map<std::string, std::string> rules;
+    std::vector<CombiningRow> combining;
+    if (parseSource()) checkEntries(rules, combining);
+
+    if (errors) {
+        std::cerr << errors << " error(s), " << warnings << " warning(s); " << argv[2] << " not written\n";
+        return 1;
+    }
+
+    std::vector<std::u16string> outputs;
+    outputs.reserve(rules.size());
+    for (const auto& [key, value] : rules) {
+        const std::wstring w = utf8to16(value);
+        outputs.emplace_back(w.begin(), w.end());
+    }
+    SequenceTrie::Rules sorted;
+    size_t i = 0;
+    for (const auto& [key, value] : rules) sorted.emplace_back(key, outputs[i++]);
+    const SequenceTrie trie = SequenceTrie::build(sorted);
+
+    const auto headings = sections();
+    std::vector<size_t> sectionOf;  // index in headings of each rule's section, or npos
+    std::vector<bool>   used(headings.size());
+    for (const auto& [key, value] : rules) {
+        const auto heading = std::upper_bound(headings.begin(), headings.end(), lineOf(key),
+                                              [](int line, const auto& h) { return line < h.first; });
+        sectionOf.push_back(heading == headings.begin() ? std::string::npos : heading - headings.begin() - 1);
+        if (sectionOf.back() != std::string::npos) used[sectionOf.back()] = true;
+    }
+    std::vector<std::string> categories;
+    std::vector<size_t>      categoryOf(headings.size());
+    for (size_t h = 0; h < headings.size(); ++h) if (used[h]) {
+        categoryOf[h] = categories.size();
+        categories.push_back(headings[h].second);
+    }
+    std::vector<uint8_t> nodeCategories(trie.nodeArray().size(), 0xFF);
+    i = 0;
+    for (const auto& [key, value] : rules) {
+        const size_t section = sectionOf[i++];
+        if (section != std::string::npos)
+            nodeCategories[trie.next(SequenceTrie::root, key)] = static_cast<uint8_t>(categoryOf[section]);
+    }
+    if (categories.size() >= 0xFF) {
+        std::cerr << sourceName << ": error: too many sections\n";
+        return 1;
+    }
+
+    const std::string header = generate(trie, combining, rules.size(), categories, nodeCategories);
+    std::ofstream output(argv[2], std::ios::binary);
+    output << header;
+    if (!output) {
+        std::cerr << argv[2] << ": error: cannot write file\n";
+        return 1;
+    }
+    std::cerr << rules.size() << " sequences, " << combining.size() << " combining rules, " << categories.size()
+              << " categories, " << warnings << " warning(s)\n";
+    return 0;
+
+}
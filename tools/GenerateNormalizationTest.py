@@ -0,0 +1,95 @@
+# This file is part of Compose for Notepad++.
+# Copyright 2025 by rjf.
+
+# The source code contained in this file is independent of Notepad++ code.
+# It is released under the MIT (Expat) license:
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+# LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+# WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+# SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+# GenerateNormalizationTest writes a file in the format of NormalizationTest.txt from the Unicode Character Database,
+# for checking src/UnicodeNormalization.h with tools/NormalizationBenchmark.cpp where the real file can't be had.
+# Every column is computed with Python's unicodedata.normalize, which is independent of the normalizer being checked
+# (though not of the data, since tools/GenerateUnicodeTables.py uses the same module):
+#
+#     @Part0    strings known to be troublesome: blocked and non-starter compositions, composition exclusions,
+#               singletons, Hangul, and marks that reorder
+#     @Part1    every code point that any form changes (the rest must be unchanged by all four)
+#     @Part2    each combining mark before and after U+0316 (class 220), between two letters
+#     @Part3    random strings of marks, decomposable characters, Hangul jamo and syllables, and other characters
+#
+# The Unicode version must be the one src/UnicodeTables.h was made with, which is given as the second argument:
+#
+#     python3 tools/GenerateNormalizationTest.py NormalizationTest.txt 14.0.0
+
+import random
+import sys
+import unicodedata
+
+forms = ('NFC', 'NFD', 'NFKC', 'NFKD')
+
+troublesome = [
+    '\u1E0A', '\u1E0C', '\u1E0A\u0323', '\u1E0C\u0307', 'D\u0307\u0323', 'D\u0323\u0307', '\u1E0A\u031B',
+    '\u1E0C\u031B', '\u1E0A\u031B\u0323', '\u1E14', '\u0112\u0300', '\u1E14\u0304', '\u00C8\u0304',
+    '\u00C5', '\u212B', '\u2126', '\u1E9B\u0323', '\uFB01', '\u0344', '\u0F73', '\u0F75', '\u0958', '\u2ADC',
+    '\U0001D15E', '\U0001D160', '\u0CCB', '\u0CC6\u0CC2\u0CD5', '\u0B4B', '\u0B47\u0300\u0B3E', '\u09CB',
+    '\u09C7\u0300\u09BE', '\uAC01', '\u1100\u1161\u11A8', '\uAC00\u11A8', '\uAC00\u11A8\u11A8', '\uD4DB',
+    '\u1100\uAC00\u11A8', '\u1100\u0300\u1161', 'a\u0315\u0300\u05AE\u0300b', 'a\u0300\u05AE\u0315\u0300b',
+    'a\u0316\u059A\u302Eb', '\u0105\u0301', 'A\u0328\u0301', '\u0104\u030A\u0301', '\u01FA', '\u00C5\u0301',
+    'A\u030A\u0301', '\u0308\u0301', '\u0308\u0301a', 'a\u0308\u0301', 'e\u0301\u0301', '\u3131\u314F',
+    '\u1E9B', '\u017F\u0307', '\u0390', '\u03B9\u0308\u0301', '\u03D3', '\u03D2\u0301',
+]
+
+def field(s):
+    return ' '.join('%04X' % ord(c) for c in s)
+
+def line(s):
+    return ';'.join(field(x) for x in (s,) + tuple(unicodedata.normalize(f, s) for f in forms)) + ';\n'
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: GenerateNormalizationTest.py output.txt unicode-version')
+    if unicodedata.unidata_version != sys.argv[2]:
+        sys.exit('Python has Unicode ' + unicodedata.unidata_version + ', not ' + sys.argv[2])
+
+    codes = [c for c in range(0x110000) if not 0xD800 <= c <= 0xDFFF]
+    assigned = [c for c in codes if unicodedata.category(chr(c)) != 'Cn']
+    marks = [c for c in assigned if unicodedata.combining(chr(c))]
+    decomposable = [c for c in assigned if unicodedata.decomposition(chr(c))]
+    hangul = list(range(0x1100, 0x1113)) + list(range(0x1161, 0x1176)) + list(range(0x11A8, 0x11C3)) \
+           + list(range(0xAC00, 0xAC40)) + list(range(0xD788, 0xD7A4))
+
+    random.seed(1)
+    parts = ['@Part0 # Specific cases\n'] + [line(s) for s in troublesome]
+    parts.append('@Part1 # Character by character test\n')
+    parts += [line(chr(c)) for c in codes if any(unicodedata.normalize(f, chr(c)) != chr(c) for f in forms)]
+    parts.append('@Part2 # Canonical order test\n')
+    for m in marks:
+        parts += [line('a' + chr(m) + '\u0316b'), line('a\u0316' + chr(m) + 'b')]
+    parts.append('@Part3 # Random strings\n')
+    for _ in range(50000):
+        s = ''
+        for _ in range(random.randint(1, 8)):
+            r = random.random()
+            pool = marks if r < 0.4 else decomposable if r < 0.6 else hangul if r < 0.7 else assigned
+            s += chr(random.randint(0x20, 0x7E)) if r > 0.95 else chr(random.choice(pool))
+        parts.append(line(s))
+
+    with open(sys.argv[1], 'w', encoding='utf-8', newline='\n') as f:
+        f.write('# NormalizationTest-' + unicodedata.unidata_version + '.txt, generated by'
+                ' tools/GenerateNormalizationTest.py from Python\'s unicodedata\n')
+        f.writelines(parts)
+
+main()
@@ -0,0 +1,57 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// GenerateSyntheticDefinitions writes a synthetic user definitions file (see SyntheticDefinitions.h), for trying
+// the plugin, or the benchmarks, with large definitions files.
+//
+//     g++ -std=c++20 -O2 -Isrc tools/GenerateSyntheticDefinitions.cpp -o GenerateSyntheticDefinitions
+//     ./GenerateSyntheticDefinitions count output.jsonc [seed] [nocombining]
+//
+// count may end in k or M (thousands or millions); nocombining leaves out the "implicit combining rules" object.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include "SyntheticDefinitions.h"
+
+int main(int argc, char* argv[]) {
+
+    if (argc < 3) {
+        std::cerr << "usage: GenerateSyntheticDefinitions count output.jsonc [seed] [nocombining]\n";
+        return 2;
+    }
+
+    char* end;
+    size_t count = std::strtoull(argv[1], &end, 10);
+    if (*end == 'k') count *= 1000;
+    else if (*end == 'M') count *= 1000000;
+    const unsigned seed = argc > 3 ? static_cast<unsigned>(std::strtoul(argv[3], 0, 10)) : 1;
+    const bool withCombiningRules = !(argc > 4 && std::string_view(argv[4]) == "nocombining");
+
+    std::ofstream out(argv[2], std::ios::binary);
+    out << syntheticDefinitions(count, seed, withCombiningRules);
+    if (!out) {
+        std::cerr << "can't write " << argv[2] << '\n';
+        return 1;
+    }
+    return 0;
+
+}
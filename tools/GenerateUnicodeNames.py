@@ -0,0 +1,123 @@
+# This file is part of Compose for Notepad++.
+# Copyright 2025 by rjf.
+
+# The source code contained in this file is independent of Notepad++ code.
+# It is released under the MIT (Expat) license:
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+# LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+# WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+# SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+# GenerateUnicodeNames writes src/UnicodeNameTables.h, which holds the character names used by src/UnicodeNames.h:
+#
+#     words                  the words of the names, most frequent first
+#     runs                   the other names, in runs of at most 32 consecutive code points: each name is a list of
+#                            word codes ending with a zero byte, where a word code is one byte, 1 to 0xBF, for
+#                            words[code - 1], or two bytes, 0xC0 + n / 255 and 1 + n % 255, for words[0xBF + n]
+#     ranges                 ranges of code points whose names are a prefix followed by the code point in hexadecimal
+#                            (such as CJK UNIFIED IDEOGRAPH-4E00)
+#     hangulLeading, hangulVowel, hangulTrailing
+#                            the short names of the jamo that make up the names of Hangul syllables
+#
+# The data comes from Python's unicodedata module, so the Unicode version is the one Python was built with (which
+# should be the version in src/UnicodeTables.h); from the repository root:
+#
+#     python3 tools/GenerateUnicodeNames.py src/UnicodeNameTables.h
+
+import collections
+import sys
+import unicodedata
+
+runLength = 32
+oneByte = 0xBF
+
+hangulLeading  = 'G GG N D DD R M B BB S SS  J JJ C K T P H'.split(' ')
+hangulVowel    = 'A AE YA YAE EO E YEO YE O WA WAE OE YO U WEO WE WI YU EU YI I'.split(' ')
+hangulTrailing = ' G GG GS N NJ NH D L LG LM LB LS LT LP LH M B BS S SS NG J C K T P H'.split(' ')
+
+def hangulName(c):
+    s = c - 0xAC00
+    return ('HANGUL SYLLABLE ' + hangulLeading[s // 588] + hangulVowel[s % 588 // 28] + hangulTrailing[s % 28])
+
+def literal(data):
+    return '"' + ''.join(chr(b) if 0x20 <= b < 0x7F and b not in (0x22, 0x3F, 0x5C) else '\\%03o' % b for b in data) + '"'
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('usage: GenerateUnicodeNames.py output.h')
+
+    names = {}
+    ranges = []
+    for c in range(0x110000):
+        name = unicodedata.name(chr(c), '')
+        if not name: continue
+        if 0xAC00 <= c < 0xAC00 + 11172:
+            assert name == hangulName(c)
+            continue
+        suffix = '-%04X' % c
+        if name.endswith(suffix):
+            prefix = name[:-len(suffix) + 1]
+            if ranges and ranges[-1][2] == prefix and ranges[-1][1] == c - 1: ranges[-1][1] = c
+            else: ranges.append([c, c, prefix])
+            continue
+        names[c] = name
+
+    frequency = collections.Counter(word for name in names.values() for word in name.split(' '))
+    words = [word for word, n in sorted(frequency.items(), key=lambda item: (-item[1], item[0]))]
+    assert len(words) <= oneByte + 64 * 255
+    code = {}
+    for i, word in enumerate(words):
+        code[word] = bytes([i + 1]) if i < oneByte else bytes([0xC0 + (i - oneByte) // 255, 1 + (i - oneByte) % 255])
+
+    runs = []
+    for c in sorted(names):
+        if runs and runs[-1][0] + len(runs[-1][1]) == c and len(runs[-1][1]) < runLength: runs[-1][1].append(c)
+        else: runs.append((c, [c]))
+
+    text = ('// Generated by tools/GenerateUnicodeNames.py from Unicode ' + unicodedata.unidata_version
+            + ' character data -- do not edit.\n'
+            '// ' + str(len(names)) + ' names of ' + str(len(words)) + ' words in ' + str(len(runs)) + ' runs, '
+            + str(len(ranges)) + ' ranges of numbered names.\n\n'
+            '#pragma once\n\n'
+            '#include <cstdint>\n\n'
+            'namespace unicodeNameTables {\n\n'
+            'inline constexpr const char* unicodeVersion = "' + unicodedata.unidata_version + '";\n\n'
+            'struct Run   { char32_t first; uint16_t count; const char* names; };\n'
+            'struct Range { char32_t first, last; const char* prefix; };\n\n'
+            'inline constexpr unsigned oneByte = ' + hex(oneByte).upper().replace('X', 'x') + ';\n\n'
+            'inline constexpr const char* words[] = {\n')
+    line = '   '
+    for word in words:
+        item = ' "' + word + '",'
+        if len(line) + len(item) > 120:
+            text += line + '\n'
+            line = '   '
+        line += item
+    text += line + '\n};\n\ninline constexpr Run runs[] = {\n'
+    for first, codes in runs:
+        text += '    {0x%X,%d,%s},\n' % (first, len(codes), literal(b''.join(b''.join(code[w] for w in names[c].split(' ')) + b'\0' for c in codes)))
+    text += '};\n\ninline constexpr Range ranges[] = {\n'
+    for first, last, prefix in ranges:
+        text += '    {0x%X,0x%X,"%s"},\n' % (first, last, prefix)
+    text += '};\n\n'
+    for name, parts in (('hangulLeading', hangulLeading), ('hangulVowel', hangulVowel), ('hangulTrailing', hangulTrailing)):
+        text += 'inline constexpr const char* ' + name + '[] = { ' + ', '.join('"' + p + '"' for p in parts) + ' };\n'
+    text += '\n}\n'
+
+    with open(sys.argv[1], 'w', newline='\n') as f:
+        f.write(text)
+    print(len(names), 'names of', len(words), 'words in', len(runs), 'runs,', len(ranges), 'ranges of numbered names')
+
+main()
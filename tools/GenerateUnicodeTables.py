@@ -0,0 +1,139 @@
+# This file is part of Compose for Notepad++.
+# Copyright 2025 by rjf.
+
+# The source code contained in this file is independent of Notepad++ code.
+# It is released under the MIT (Expat) license:
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+# LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+# WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+# SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+# GenerateUnicodeTables writes src/UnicodeTables.h, which holds the Unicode character data used by the normalizer
+# in src/UnicodeNormalization.h:
+#
+#     propertyIndex, propertyBlocks    a two-stage table giving each code point's canonical combining class and
+#                                      quick check results; propertyIndex[c >> 6] selects a block of 64 entries
+#     compositions                     the primary composites, as pairs of code points that compose to a third,
+#                                      sorted (Hangul syllables are composed arithmetically and are not listed)
+#     canonicalCodes, ...Offsets, ...Text
+#                                      the full canonical decompositions (NFD) of the code points that have them,
+#                                      other than Hangul syllables; the decomposition of canonicalCodes[i] is
+#                                      canonicalText from canonicalOffsets[i] to canonicalOffsets[i + 1]
+#     compatCodes, ...Offsets, ...Text the same for full compatibility decompositions (NFKD), where they differ
+#                                      from the canonical decompositions
+#     blocks                           the Unicode blocks, with the number of assigned code points in each, for the
+#                                      coverage report in src/ReverseIndex.h
+#
+# The data comes from Python's unicodedata module, so the Unicode version is the one Python was built with, and from
+# Blocks.txt in the Unicode Character Database for the same version; from the repository root:
+#
+#     python3 tools/GenerateUnicodeTables.py src/UnicodeTables.h Blocks.txt
+
+import sys
+import unicodedata
+
+NFC, NFD, NFKC, NFKD = (lambda s, form=form: unicodedata.normalize(form, s) for form in ('NFC', 'NFD', 'NFKC', 'NFKD'))
+
+# Property bits, as in UnicodeNormalization.h; the low eight bits are the canonical combining class.
+
+NoD, NoKD, NoC, NoKC, MaybeC = 0x100, 0x200, 0x400, 0x800, 0x1000
+blockSize = 64
+
+def rows(items, perLine):
+    return ''.join('    ' + ' '.join(items[i:i + perLine]) + '\n' for i in range(0, len(items), perLine))
+
+def decompositionTable(name, codes, decompose):
+    offsets = [0]
+    text = []
+    for c in codes:
+        text += [ord(x) for x in decompose(chr(c))]
+        offsets.append(len(text))
+    return ('inline constexpr char32_t ' + name + 'Codes[] = {\n' + rows(['0x%X,' % c for c in codes], 16) + '};\n\n'
+            'inline constexpr uint16_t ' + name + 'Offsets[] = {\n' + rows(['%d,' % o for o in offsets], 20) + '};\n\n'
+            'inline constexpr char32_t ' + name + 'Text[] = {\n' + rows(['0x%X,' % c for c in text], 16) + '};\n\n')
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: GenerateUnicodeTables.py output.h Blocks.txt')
+
+    blocks = []
+    with open(sys.argv[2], encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if not line: continue
+            codes, name = (x.strip() for x in line.split(';'))
+            first, last = (int(x, 16) for x in codes.split('..'))
+            assigned = sum(1 for c in range(first, last + 1) if unicodedata.category(chr(c)) != 'Cn')
+            blocks.append((first, last, assigned, name))
+
+    codes = [c for c in range(0x110000) if not 0xD800 <= c <= 0xDFFF]
+    hangul = range(0xAC00, 0xD7A4)
+
+    compositions = []
+    for c in codes:
+        d = unicodedata.decomposition(chr(c))
+        if not d or d.startswith('<'): continue
+        parts = [int(x, 16) for x in d.split()]
+        if len(parts) == 2 and NFC(chr(parts[0]) + chr(parts[1])) == chr(c):
+            compositions.append((parts[0], parts[1], c))
+    compositions.sort()
+    seconds = set(second for first, second, composite in compositions)
+    seconds |= set(range(0x1161, 0x1176)) | set(range(0x11A8, 0x11C3))   # vowel and trailing jamo
+
+    def properties(c):
+        if 0xD800 <= c <= 0xDFFF: return 0
+        s = chr(c)
+        return (unicodedata.combining(s) | (NoD if NFD(s) != s else 0) | (NoKD if NFKD(s) != s else 0)
+                | (NoC if NFC(s) != s else 0) | (NoKC if NFKC(s) != s else 0) | (MaybeC if c in seconds else 0))
+
+    propertyBlocks = {}
+    index = []
+    for b in range(0x110000 // blockSize):
+        block = tuple(properties(c) for c in range(b * blockSize, (b + 1) * blockSize))
+        index.append(propertyBlocks.setdefault(block, len(propertyBlocks)))
+    assert len(propertyBlocks) <= 256
+    blockList = [0] * (len(propertyBlocks) * blockSize)
+    for block, n in propertyBlocks.items(): blockList[n * blockSize:(n + 1) * blockSize] = block
+
+    canonical = [c for c in codes if c not in hangul and NFD(chr(c)) != chr(c)]
+    compat = [c for c in codes if NFKD(chr(c)) != NFD(chr(c))]
+
+    text = ('// Generated by tools/GenerateUnicodeTables.py from Unicode ' + unicodedata.unidata_version
+            + ' character data -- do not edit.\n'
+            '// ' + str(len(propertyBlocks)) + ' property blocks, ' + str(len(compositions)) + ' compositions, '
+            + str(len(canonical)) + ' canonical and ' + str(len(compat)) + ' compatibility decompositions, '
+            + str(len(blocks)) + ' Unicode blocks.\n\n'
+            '#pragma once\n\n'
+            '#include <cstdint>\n\n'
+            'namespace unicodeTables {\n\n'
+            'inline constexpr const char* unicodeVersion = "' + unicodedata.unidata_version + '";\n\n'
+            'struct Composition { char32_t first, second, composite; };\n\n'
+            'struct Block { char32_t first, last; uint32_t assigned; const char* name; };\n\n'
+            'inline constexpr uint8_t propertyIndex[] = {\n' + rows(['%d,' % n for n in index], 32) + '};\n\n'
+            'inline constexpr uint16_t propertyBlocks[] = {\n' + rows(['0x%X,' % p for p in blockList], 16) + '};\n\n'
+            'inline constexpr Composition compositions[] = {\n'
+            + rows(['{0x%X,0x%X,0x%X},' % t for t in compositions], 6) +
+            '};\n\n'
+            + decompositionTable('canonical', canonical, NFD)
+            + decompositionTable('compat', compat, NFKD) +
+            'inline constexpr Block blocks[] = {\n'
+            + rows(['{0x%X,0x%X,%d,"%s"},' % b for b in blocks], 1) +
+            '};\n\n'
+            '}\n')
+    with open(sys.argv[1], 'w', newline='\n') as f:
+        f.write(text)
+    print(len(propertyBlocks), 'property blocks,', len(compositions), 'compositions,', len(canonical), 'canonical and',
+          len(compat), 'compatibility decompositions,', len(blocks), 'Unicode blocks')
+
+main()
@@ -0,0 +1,189 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// KeyTranslationBenchmark checks and times the keyboard layout cache in src/KeyTranslation.h, using a made-up layout
+// like US English, with a dead key (the grave accent key with Ctrl and Alt), a key that types two characters and a key
+// that types more than the cache keeps.
+//
+// It checks that every key and every combination of modifiers translates as the layout says, both the first time and
+// from the cache; that the layout is asked only the first time (except for the long translation); that key names are
+// cached the same way; and that using more layouts than the cache holds drops the one least recently used. Then it
+// reports the time for a cached lookup of keys typed as in ordinary text.
+//
+//     g++ -std=c++20 -O2 -Isrc tools/KeyTranslationBenchmark.cpp -o KeyTranslationBenchmark
+//     ./KeyTranslationBenchmark [-r repetitions]
+//
+// The default is 10 repetitions of 10M keys. The exit status is nonzero if any check failed.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "KeyTranslation.h"
+
+namespace {
+
+    // A layout like US English: letters, digits and some punctuation, with Shift; Ctrl with a letter gives a control
+    // character; Ctrl+Alt+0 types "ab", Ctrl+Alt+1 types a long string and Ctrl+Alt with the grave accent key is a dead
+    // key. The number changes what each key types, so that layouts can be told apart.
+
+    class FakeLayout : public KeyboardLayout {
+    public:
+        int    number = 0;
+        size_t asked  = 0;
+        std::u16string expected(uint8_t virtualKey, uint8_t modifiers) const {
+            const bool shift = modifiers & KeyTranslationCache::Shift;
+            const uint8_t ctrlAlt = modifiers & (KeyTranslationCache::Control | KeyTranslationCache::Alt);
+            if (ctrlAlt == (KeyTranslationCache::Control | KeyTranslationCache::Alt)) {
+                if (virtualKey == '0') return u"ab";
+                if (virtualKey == '1') return u"a long translation";
+                if (virtualKey == 0xC0) return u"`";
+                return u"";
+            }
+            if (ctrlAlt == KeyTranslationCache::Alt) return u"";
+            if (virtualKey >= 'A' && virtualKey <= 'Z') {
+                if (ctrlAlt) return std::u16string(1, static_cast<char16_t>(virtualKey - 'A' + 1));
+                const char16_t c = static_cast<char16_t>((shift ? 'A' : 'a') + (virtualKey - 'A' + number) % 26);
+                return std::u16string(1, c);
+            }
+            if (ctrlAlt) return u"";
+            if (virtualKey >= '0' && virtualKey <= '9') return std::u16string(1, (shift ? u")!@#$%^&*(" : u"0123456789")[virtualKey - '0']);
+            if (virtualKey == 0x20) return u" ";
+            if (virtualKey == 0xBA) return shift ? u":" : u";";
+            if (virtualKey == 0xBC) return shift ? u"<" : u",";
+            if (virtualKey == 0xBE) return shift ? u">" : u".";
+            if (virtualKey == 0xC0) return shift ? u"~" : u"`";
+            return u"";
+        }
+        bool dead(uint8_t virtualKey, uint8_t modifiers) const {
+            return virtualKey == 0xC0 && (modifiers & 6) == 6;
+        }
+        int translate(uint8_t virtualKey, uint8_t, uint8_t modifiers, char16_t* out, int capacity) override {
+            ++asked;
+            const std::u16string text = expected(virtualKey, modifiers);
+            const int length = static_cast<int>(text.copy(out, capacity));
+            return dead(virtualKey, modifiers) ? -1 : length;
+        }
+        std::u16string expectedName(uint8_t scanCode, bool extended) const {
+            if (scanCode == 0 || scanCode >= 0x80) return u"";
+            return (extended ? u"Ext" : u"Key") + std::u16string(1, static_cast<char16_t>(u'A' + (scanCode + number) % 26))
+                 + u" number " + std::u16string(1, static_cast<char16_t>(u'0' + number));
+        }
+        int keyName(uint8_t scanCode, bool extended, char16_t* out, int capacity) override {
+            ++asked;
+            return static_cast<int>(expectedName(scanCode, extended).copy(out, capacity));
+        }
+    };
+
+    size_t failures = 0;
+
+    void check(bool ok, const char* what, int key, int modifiers) {
+        if (ok) return;
+        if (failures++ < 20) std::printf("  %s: key %02X, modifiers %d\n", what, key, modifiers);
+    }
+
+    // Checks every key of a layout twice; the second pass must not ask the layout except for the long translation.
+
+    void checkLayout(KeyTranslationCache& cache, FakeLayout& layout) {
+        for (int pass = 0; pass < 2; ++pass) {
+            const size_t asked = layout.asked;
+            size_t expectedAsks = 0;
+            for (int vk = 0; vk < 256; ++vk) for (uint8_t modifiers = 0; modifiers < 8; ++modifiers) {
+                const auto t = cache.translate(layout, layout.number, static_cast<uint8_t>(vk), 0, modifiers);
+                const std::u16string expected = layout.expected(static_cast<uint8_t>(vk), modifiers);
+                const bool dead = layout.dead(static_cast<uint8_t>(vk), modifiers);
+                check(t.length == (dead ? -1 : static_cast<int>(expected.length())), "wrong length", vk, modifiers);
+                check(t.text == expected, "wrong text", vk, modifiers);
+                if (pass == 0 || expected.length() > KeyTranslationCache::maxText) ++expectedAsks;
+            }
+            for (int scan = 0; scan < 256; ++scan) for (int extended = 0; extended < 2; ++extended) {
+                const std::u16string_view name = cache.name(layout, layout.number, static_cast<uint8_t>(scan), extended);
+                check(name == layout.expectedName(static_cast<uint8_t>(scan), extended), "wrong name", scan, extended);
+                if (pass == 0) ++expectedAsks;
+            }
+            check(layout.asked - asked == expectedAsks, pass ? "layout asked again" : "layout not asked once", layout.number, pass);
+        }
+    }
+
+    // Uses one more layout than the cache holds: the first must be dropped, and the others kept.
+
+    void checkLayouts() {
+        KeyTranslationCache& cache = *new KeyTranslationCache;
+        std::vector<FakeLayout> layouts(KeyTranslationCache::layouts + 1);
+        for (size_t i = 0; i < layouts.size(); ++i) {
+            layouts[i].number = static_cast<int>(i + 1);
+            checkLayout(cache, layouts[i]);
+        }
+        for (size_t i = layouts.size(); i-- > 0;) {
+            const size_t asked = layouts[i].asked;
+            const auto t = cache.translate(layouts[i], layouts[i].number, 'Q', 0, 0);
+            check(t.text == layouts[i].expected('Q', 0), "wrong text after switching layouts", 'Q', layouts[i].number);
+            check((layouts[i].asked != asked) == (i == 0), i ? "layout dropped too soon" : "layout not dropped", 'Q', layouts[i].number);
+        }
+        cache.clear();
+        const size_t asked = layouts[1].asked;
+        cache.translate(layouts[1], layouts[1].number, 'Q', 0, 0);
+        check(layouts[1].asked == asked + 1, "layout not asked after clear", 'Q', layouts[1].number);
+        std::printf("%zu layouts checked, %zu failures\n", layouts.size(), failures);
+        delete &cache;
+    }
+
+    // Times cached lookups of keys typed as in ordinary text.
+
+    void timeLookups(int repetitions) {
+        KeyTranslationCache& cache = *new KeyTranslationCache;
+        FakeLayout layout;
+        std::mt19937 random(1);
+        std::vector<std::pair<uint8_t, uint8_t>> keys;
+        const std::string typed = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789    ";
+        for (int i = 0; i < 4096; ++i)
+            keys.emplace_back(static_cast<uint8_t>(typed[random() % typed.length()]), random() % 10 ? 0 : KeyTranslationCache::Shift);
+        for (const auto& [vk, modifiers] : keys) cache.translate(layout, 1, vk, 0, modifiers);
+        size_t total = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep) for (int i = 0; i < 10000000; ++i) {
+            const auto& [vk, modifiers] = keys[i & 4095];
+            total += cache.translate(layout, 1, vk, 0, modifiers).text[0];
+        }
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::printf("cached lookup %6.2f ns each (checksum %zu, layout asked %zu times)\n",
+                    elapsed * 1e9 / (repetitions * 10000000.0), total, layout.asked);
+        delete &cache;
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+
+    int repetitions = 10;
+    for (int i = 1; i < argc; ++i) if (!std::strcmp(argv[i], "-r") && i + 1 < argc) repetitions = std::atoi(argv[++i]);
+
+    std::printf("%zu bytes for each cache\n", sizeof(KeyTranslationCache));
+    checkLayouts();
+    timeLookups(repetitions);
+
+    return failures ? 1 : 0;
+
+}
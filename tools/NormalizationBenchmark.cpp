@@ -0,0 +1,288 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// NormalizationBenchmark checks and times the normalizer in src/UnicodeNormalization.h.
+//
+// Given NormalizationTest.txt from the Unicode Character Database (https://www.unicode.org/Public/UCD/latest/ucd/),
+// for the Unicode version in src/UnicodeTables.h, it first checks every line against the invariants listed at the top
+// of that file, and that every code point not listed in part 1 is unchanged by all four forms; each failure is shown.
+// Where the real file can't be had, tools/GenerateNormalizationTest.py makes one in the same format (CMakeLists.txt
+// runs this check as the normalization-conformance test, with whichever file it has).
+//
+// It checks precomposeC against normalize for every pair of a character that begins a primary composite and a
+// character that can follow one, and for every Latin-1 and Latin Extended letter with them.
+//
+// It then reports the time to normalize the short strings implicit combinations produce (a letter followed by one
+// to three combining marks) to NFC, and to compose those with one mark by precomposeC, and the throughput of each form on generated documents of 1M code units:
+// ASCII, precomposed Latin, decomposed Latin and Korean, normalized whole and as a stream in 4K pieces
+// (the results of which must be the same).
+//
+//     g++ -std=c++20 -O2 -Isrc tools/NormalizationBenchmark.cpp -o NormalizationBenchmark
+//     ./NormalizationBenchmark [-r repetitions] [NormalizationTest.txt]
+//
+// The default is 10 repetitions. The exit status is nonzero if any check failed.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "UnicodeFormatTranslation.h"
+#include "UnicodeNormalization.h"
+
+namespace {
+
+    constexpr NormalizationForm forms[] = { NormalizationForm::C, NormalizationForm::D, NormalizationForm::KC, NormalizationForm::KD };
+    constexpr const char*       formNames[] = { "NFC", "NFD", "NFKC", "NFKD" };
+
+    std::u16string utf16(const std::u32string& s) {
+        const std::wstring w = utf32to16(s);
+        return std::u16string(w.begin(), w.end());
+    }
+
+    std::string hex(std::u16string_view s) {
+        std::string result;
+        const std::u32string u = utf16to32(std::wstring(s.begin(), s.end()));
+        for (char32_t c : u) {
+            char buffer[16];
+            std::snprintf(buffer, sizeof buffer, result.empty() ? "%04X" : " %04X", static_cast<unsigned>(c));
+            result += buffer;
+        }
+        return result;
+    }
+
+    // Checks the lines of NormalizationTest.txt; returns the number of failures.
+
+    size_t conformance(std::istream& file) {
+        size_t lines = 0;
+        size_t failures = 0;
+        std::vector<bool> listed(0x110000);
+        bool part1 = false;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            if (line[0] == '@') {
+                part1 = line.starts_with("@Part1");
+                continue;
+            }
+            std::u16string c[6];
+            std::istringstream fields(line);
+            for (int i = 1; i <= 5; ++i) {
+                std::string field;
+                std::getline(fields, field, ';');
+                std::istringstream codes(field);
+                std::u32string u;
+                unsigned code;
+                while (codes >> std::hex >> code) u += static_cast<char32_t>(code);
+                c[i] = utf16(u);
+                if (i == 1 && part1 && u.length() == 1) listed[u[0]] = true;
+            }
+            ++lines;
+            // Each form, then for each source column, the column its result must equal.
+            static constexpr int expect[4][6] = { { 0, 2, 2, 2, 4, 4 }, { 0, 3, 3, 3, 5, 5 },
+                                                  { 0, 4, 4, 4, 4, 4 }, { 0, 5, 5, 5, 5, 5 } };
+            for (int f = 0; f < 4; ++f) for (int i = 1; i <= 5; ++i) {
+                const std::u16string result = normalize(c[i], forms[f]);
+                if (result == c[expect[f][i]]) continue;
+                if (failures++ < 20)
+                    std::printf("  %s(c%d) of %s is %s, not %s\n", formNames[f], i, hex(c[1]).c_str(), hex(result).c_str(),
+                                hex(c[expect[f][i]]).c_str());
+            }
+        }
+        size_t unlisted = 0;
+        for (char32_t x = 0; x < 0x110000; ++x) {
+            if (listed[x] || (x >= 0xD800 && x <= 0xDFFF)) continue;
+            ++unlisted;
+            const std::u16string s = utf16(std::u32string(1, x));
+            for (int f = 0; f < 4; ++f) {
+                if (normalize(s, forms[f]) == s) continue;
+                if (failures++ < 20) std::printf("  %s changes unlisted %s\n", formNames[f], hex(s).c_str());
+            }
+        }
+        std::printf("%zu test lines and %zu unlisted code points checked, %zu failures\n", lines, unlisted, failures);
+        return failures;
+    }
+
+    double seconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Checks that precomposeC gives what normalize does whenever it gives anything; returns the number of failures.
+
+    size_t precomposed() {
+        std::vector<char32_t> firsts, seconds;
+        for (const auto& c : unicodeTables::compositions) {
+            firsts.push_back(c.first);
+            seconds.push_back(c.second);
+        }
+        for (char32_t c = 0x41; c < 0x250; ++c) firsts.push_back(c);
+        for (char32_t c = 0x1100; c < 0x1113; ++c) firsts.push_back(c);
+        for (char32_t c = 0xAC00; c < 0xAC00 + 28 * 3; ++c) firsts.push_back(c);
+        for (char32_t c = 0x1161; c < 0x1176; ++c) seconds.push_back(c);
+        for (char32_t c = 0x11A8; c < 0x11C3; ++c) seconds.push_back(c);
+        for (char32_t c = 0x300; c < 0x370; ++c) seconds.push_back(c);
+        for (auto* v : { &firsts, &seconds }) {
+            std::sort(v->begin(), v->end());
+            v->erase(std::unique(v->begin(), v->end()), v->end());
+        }
+        size_t pairs = 0, composed = 0, failures = 0;
+        for (const char32_t first : firsts) for (const char32_t second : seconds) {
+            ++pairs;
+            char16_t out[2];
+            const size_t n = precomposeC(first, second, out);
+            if (!n) continue;
+            ++composed;
+            const std::u16string expected = normalize(utf16(std::u32string{ first, second }), NormalizationForm::C);
+            if (std::u16string_view(out, n) == expected) continue;
+            if (failures++ < 20)
+                std::printf("  precomposeC of %04X %04X is %s, not %s\n", static_cast<unsigned>(first),
+                            static_cast<unsigned>(second), hex(std::u16string_view(out, n)).c_str(), hex(expected).c_str());
+        }
+        std::printf("precomposeC: %zu pairs checked, %zu composed, %zu failures\n", pairs, composed, failures);
+        return failures;
+    }
+
+    // Times NFC of letters followed by one to three combining marks, as implicit combinations produce them.
+
+    void composeStrings(int repetitions) {
+        static constexpr char16_t marks[] = { 0x301, 0x300, 0x302, 0x303, 0x308, 0x30A, 0x30C, 0x327, 0x328, 0x323,
+                                              0x304, 0x306, 0x307, 0x31B, 0x309, 0x30B, 0x331, 0x32D, 0x330, 0x332 };
+        std::vector<std::u16string> strings;
+        std::mt19937 random(1);
+        for (int i = 0; i < 10000; ++i) {
+            std::u16string s(1, u"aeiouyAEIOUYcgnrsz"[random() % 18]);
+            for (size_t n = 1 + random() % 3; n > 0; --n) s += marks[random() % std::size(marks)];
+            strings.push_back(s);
+        }
+        char16_t out[256];
+        size_t total = 0, shorter = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep) for (const auto& s : strings) {
+            const size_t length = normalizeC(s, out, std::size(out));
+            total += length;
+            if (rep == 0 && length < s.length()) ++shorter;
+        }
+        const double elapsed = seconds(start);
+        std::printf("compose strings %9.1f ns each (%zu of %zu composed at least one mark)\n",
+                    elapsed * 1e9 / (repetitions * strings.size()), shorter, strings.size());
+
+        // The strings of one letter and one mark, normalized and then composed by precomposeC.
+        std::vector<std::u16string> pairs;
+        for (const auto& s : strings) if (s.length() == 2) pairs.push_back(s);
+        size_t precomposed = 0;
+        const auto pairStart = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep) for (const auto& s : pairs) total += normalizeC(s, out, std::size(out));
+        const auto middle = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep) for (const auto& s : pairs) {
+            const size_t length = precomposeC(s[0], s[1], out);
+            total += length;
+            if (rep == 0 && length) ++precomposed;
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        [[maybe_unused]] static volatile size_t used;
+        used = total;  // so the loops are not optimized away
+        std::printf("one mark        %9.1f ns each normalized, %.1f ns by precomposeC (%zu of %zu precomposed)\n",
+                    std::chrono::duration<double>(middle - pairStart).count() * 1e9 / (repetitions * pairs.size()),
+                    std::chrono::duration<double>(stop - middle).count() * 1e9 / (repetitions * pairs.size()),
+                    precomposed, pairs.size());
+    }
+
+    // Generated documents of about 1M code units.
+
+    std::vector<std::pair<const char*, std::u16string>> documents() {
+        std::vector<std::pair<const char*, std::u16string>> result;
+        std::mt19937 random(2);
+        const std::u16string_view ascii = u"the quick brown fox jumps over the lazy dog. THE QUICK BROWN FOX; 0123456789\r\n";
+        const std::u16string_view latin = u"àáâãäåçèéêëìíîïñòóôõöùúûüýÿāăąćĉċčďēĕėęěĝğġģĥĩīĭįĵķĺļľńņňōŏőŕŗřśŝşšţťũūŭůűųŵŷźżžơưǎǐǒǔ";
+        std::u16string text;
+        while (text.length() < 1000000) text += ascii;
+        result.emplace_back("ascii", text);
+        text.clear();
+        while (text.length() < 1000000) {
+            for (int n = 3 + random() % 6; n > 0; --n)
+                text += random() % 3 ? ascii[random() % 26] : latin[random() % latin.length()];
+            text += u' ';
+        }
+        result.emplace_back("latin", text);
+        result.emplace_back("decomposed", normalize(text, NormalizationForm::D));
+        text.clear();
+        while (text.length() < 1000000) {
+            for (int n = 1 + random() % 4; n > 0; --n) text += static_cast<char16_t>(0xAC00 + random() % 11172);
+            text += u' ';
+        }
+        result.emplace_back("korean", text);
+        return result;
+    }
+
+    size_t documentThroughput(int repetitions) {
+        size_t failures = 0;
+        for (const auto& [name, text] : documents()) {
+            std::printf("%-10s", name);
+            for (int f = 0; f < 4; ++f) {
+                std::u16string whole;
+                const auto start = std::chrono::steady_clock::now();
+                for (int rep = 0; rep < repetitions; ++rep) whole = normalize(text, forms[f]);
+                const double elapsed = seconds(start);
+                std::u16string streamed;
+                NormalizationStream stream(forms[f]);
+                for (size_t i = 0; i < text.length(); i += 4096)
+                    stream.write(std::u16string_view(text).substr(i, 4096), [&](std::u16string_view s) { streamed += s; });
+                stream.finish([&](std::u16string_view s) { streamed += s; });
+                if (streamed != whole) ++failures;
+                std::printf(" %5s %7.0f MB/s%s", formNames[f], repetitions * text.length() * 2 / elapsed / 1e6,
+                            streamed == whole ? "" : " (stream differs)");
+            }
+            std::printf("\n");
+        }
+        return failures;
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+
+    int repetitions = 10;
+    const char* testFile = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "-r") && i + 1 < argc) repetitions = std::atoi(argv[++i]);
+        else testFile = argv[i];
+    }
+
+    std::printf("Unicode %s\n", unicodeTables::unicodeVersion);
+    size_t failures = 0;
+    if (testFile) {
+        std::ifstream file(testFile);
+        if (!file) {
+            std::fprintf(stderr, "Can't read %s\n", testFile);
+            return 1;
+        }
+        failures += conformance(file);
+    }
+    failures += precomposed();
+    composeStrings(repetitions);
+    failures += documentThroughput(repetitions);
+
+    return failures ? 1 : 0;
+
+}
@@ -0,0 +1,199 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// PaletteBenchmark times the sequence palette (see src/SequencePalette.h): making it for the built-in definitions
+// and a user definitions file laid over them (by default, 100,000 synthetic sequences; see SyntheticDefinitions.h),
+// then searching as each of a list of queries is typed one byte at a time and then erased one byte at a time. Every
+// result is checked against a search of every sequence without the index; each failure is shown.
+//
+//     g++ -std=c++20 -O2 -Isrc tools/PaletteBenchmark.cpp src/ComposeEngine.cpp -o PaletteBenchmark
+//     ./PaletteBenchmark [-n sequences] [file.jsonc]
+//
+// The exit status is nonzero if the file can't be read or any check failed.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include "SequencePalette.h"
+#include "SyntheticDefinitions.h"
+
+namespace {
+
+    constexpr const char* queries[] = { "e acute", "greek small letter alpha", "arrow", "LATIN CAPITAL", "quot", "html",
+                                        "em dash", "≠", "=/", "a", "x z", "circumflx", "rightwads arrow", "user",
+                                        "superscript two", "box drawings light", "zzzzzz" };
+
+    // The search without the index: every text is checked with the rules in SequencePalette.h.
+
+    struct Reference {
+
+        std::vector<std::string> texts, categories;  // for each sequence
+
+        static std::vector<std::string> terms(std::string_view query) {
+            std::vector<std::string> result;
+            std::string term;
+            for (const char c : PaletteIndex::fold(query) + PaletteIndex::separator) {
+                if (c != PaletteIndex::separator) term += c;
+                else if (!term.empty()) {
+                    if (result.size() < 8) result.push_back(term);
+                    term.clear();
+                }
+            }
+            return result;
+        }
+
+        static int exact(std::string_view text, std::string_view term) {
+            int best = 0;
+            for (size_t at = 0; at + term.length() <= text.length(); ++at) {
+                if (text.substr(at, term.length()) != term) continue;
+                const bool start = at == 0 || text[at - 1] == PaletteIndex::separator;
+                const bool end   = at + term.length() == text.length() || text[at + term.length()] == PaletteIndex::separator;
+                if (start || term.length() >= 3) best = std::max(best, start ? (end ? 6 : 4) : 2);
+            }
+            return best;
+        }
+
+        static bool nearly(std::string_view text, std::string_view term) {
+            // row[i] is the fewest edits that make term's first i bytes end at the current byte of text.
+            std::vector<size_t> row(term.length() + 1), next(term.length() + 1);
+            for (size_t i = 0; i <= term.length(); ++i) row[i] = i;
+            for (const char c : text) {
+                next[0] = 0;
+                for (size_t i = 1; i <= term.length(); ++i)
+                    next[i] = std::min({ row[i - 1] + (term[i - 1] != c), row[i] + 1, next[i - 1] + 1 });
+                row.swap(next);
+                if (row[term.length()] <= 1) return true;
+            }
+            return false;
+        }
+
+        std::vector<uint32_t> search(std::string_view query, bool fuzzy) const {
+            const std::vector<std::string> t = terms(query);
+            std::vector<std::pair<int, uint32_t>> scored;
+            if (fuzzy && std::none_of(t.begin(), t.end(), [](const std::string& s) { return s.length() >= 6; })) return {};
+            for (uint32_t i = 0; i < texts.size(); ++i) {
+                int total = 0;
+                for (const std::string& term : t) {
+                    int s = std::max(exact(texts[i], term), exact(categories[i], term));
+                    if (!s && fuzzy && term.length() >= 6 && (nearly(texts[i], term) || nearly(categories[i], term))) s = 1;
+                    if (!s) {
+                        total = 0;
+                        break;
+                    }
+                    total += s;
+                }
+                if (total || t.empty()) scored.emplace_back(-total, i);
+            }
+            std::stable_sort(scored.begin(), scored.end());
+            std::vector<uint32_t> result;
+            for (const auto& [score, i] : scored) result.push_back(i);
+            if (result.empty() && !fuzzy) return search(query, true);
+            return result;
+        }
+
+    };
+
+    double milliseconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+
+    size_t count = 0;
+    const char* path = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "-n") && i + 1 < argc) count = std::strtoul(argv[++i], 0, 10);
+        else path = argv[i];
+    }
+
+    std::shared_ptr<ComposeDefinitions> definitions = ComposeDefinitions::builtIn();
+    std::string content;
+    if (path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream stream;
+        stream << file.rdbuf();
+        if (!file) {
+            std::fprintf(stderr, "Can't read %s\n", path);
+            return 1;
+        }
+        content = stream.str();
+    }
+    else content = syntheticDefinitions(count ? count : 100000);
+    if (!definitions->overlay(content)) {
+        std::fprintf(stderr, "Can't read %s as a definitions file\n", path ? path : "the synthetic definitions");
+        return 1;
+    }
+    definitions->userDefinitions = true;
+
+    auto start = std::chrono::steady_clock::now();
+    SequencePalette palette(definitions);
+    std::printf("%zu sequences in the palette, made in %.1f ms\n", palette.size(), milliseconds(start));
+
+    Reference reference;
+    for (size_t i = 0; i < palette.size(); ++i) {
+        const PaletteEntry& e = palette[i];
+        reference.texts.push_back(PaletteIndex::fold(e.keys + PaletteIndex::separator
+                                                     + utf16to8(std::wstring(e.output.begin(), e.output.end()))
+                                                     + PaletteIndex::separator + e.name));
+        reference.categories.push_back(PaletteIndex::fold(SequencePalette::categoryName(e.category)));
+    }
+
+    size_t failures = 0, keystrokes = 0, slow = 0;
+    double total = 0, longest = 0;
+    std::vector<uint32_t> results;
+    for (const std::string_view query : queries) {
+        std::vector<std::string_view> typed;
+        for (size_t n = 1; n <= query.length(); ++n) typed.push_back(query.substr(0, n));
+        for (size_t n = query.length() - 1; n > 0; --n) typed.push_back(query.substr(0, n));
+        double queryLongest = 0;
+        for (const std::string_view q : typed) {
+            start = std::chrono::steady_clock::now();
+            palette.search(q, results);
+            const double elapsed = milliseconds(start);
+            total += elapsed;
+            longest = std::max(longest, elapsed);
+            queryLongest = std::max(queryLongest, elapsed);
+            slow += elapsed > 1;
+            ++keystrokes;
+            if (results != reference.search(q, false) && failures++ < 20)
+                std::printf("  \"%.*s\": the results differ\n", static_cast<int>(q.length()), q.data());
+        }
+        palette.search(query, results);
+        std::printf("  %-26s %6zu results, longest keystroke %.3f ms", query.data(), results.size(), queryLongest);
+        if (!results.empty())
+            std::printf(", first %s", palette[results[0]].name.empty() ? palette[results[0]].keys.c_str()
+                                                                       : palette[results[0]].name.c_str());
+        std::printf("\n");
+    }
+    std::printf("%zu keystrokes searched in %.3f ms average, %.3f ms longest, %zu over 1 ms\n", keystrokes, total / keystrokes,
+                longest, slow);
+
+    std::printf("%zu failures\n", failures);
+    return failures ? 1 : 0;
+
+}
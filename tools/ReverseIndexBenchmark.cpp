@@ -0,0 +1,137 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// ReverseIndexBenchmark times making the reverse index (see src/ReverseIndex.h) for the built-in definitions, or for
+// a user definitions file laid over them, with one thread and with one per processor, and checks that both give the
+// same index. It then types every way the index lists for each character of the Basic Multilingual Plane and a few
+// others into a compose engine, and checks that each one types that character; each failure is shown. Last, it shows
+// the ways to type a few characters and the blocks with the most characters covered.
+//
+//     g++ -std=c++20 -O2 -Isrc tools/ReverseIndexBenchmark.cpp src/ComposeEngine.cpp -o ReverseIndexBenchmark -pthread
+//     ./ReverseIndexBenchmark [file.jsonc]
+//
+// The exit status is nonzero if the file can't be read or any check failed.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "ReverseIndex.h"
+
+namespace {
+
+    std::string printable(std::u16string_view keys) {
+        std::wstring text(keys.begin(), keys.end());
+        std::replace(text.begin(), text.end(), L'\r', L'\x23CE');  // RETURN SYMBOL
+        return utf16to8(text);
+    }
+
+    // Types keys into engine, one key at a time, and returns what it sends.
+
+    std::u16string typed(ComposeEngine& engine, const std::shared_ptr<const ComposeDefinitions>& definitions,
+                         std::u16string_view keys) {
+        struct Sink : ComposeEngine::OutputSink {
+            std::u16string text;
+            void send(std::u16string_view s) override { text += s; }
+        } sink;
+        engine.start(definitions);
+        for (size_t i = 0; i < keys.length() && engine.composing();) {
+            const size_t n = definitionsAnalyzer::keyLength(keys.substr(i));
+            engine.key(keys.substr(i, n), sink);
+            i += n;
+        }
+        if (engine.composing()) {
+            engine.cancel();
+            return u"(unfinished) " + sink.text;
+        }
+        return sink.text;
+    }
+
+    double milliseconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+
+    std::shared_ptr<ComposeDefinitions> definitions = ComposeDefinitions::builtIn();
+    if (argc > 1) {
+        std::ifstream file(argv[1], std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        if (!file || !definitions->overlay(content.str())) {
+            std::fprintf(stderr, "Can't read %s as a definitions file\n", argv[1]);
+            return 1;
+        }
+    }
+
+    size_t failures = 0;
+    std::shared_ptr<const ReverseIndex> indexes[2];
+    const unsigned threads[] = { 1, std::max(1u, std::thread::hardware_concurrency()) };
+    for (int i = 0; i < 2; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        indexes[i] = ReverseIndex::build(definitions, threads[i]);
+        std::printf("%2u thread%s %8zu ways indexed in %7.1f ms\n", threads[i], threads[i] == 1 ? " " : "s",
+                    indexes[i]->size(), milliseconds(start));
+    }
+    const ReverseIndex& index = *indexes[1];
+
+    ComposeEngine engine;
+    size_t ways = 0, characters = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (char32_t c = 0; c < 0x20000; c = c == 0xFFFF ? 0x1F600 : c == 0x1F64F ? 0x20000 : c + 1) {
+        if (c >= 0xD800 && c < 0xE000) continue;
+        const std::u16string text = c < 0x10000 ? std::u16string(1, static_cast<char16_t>(c))
+            : std::u16string({ static_cast<char16_t>(0xD800 + ((c - 0x10000) >> 10)), static_cast<char16_t>(0xDC00 + (c & 0x3FF)) });
+        const std::vector<TypingWay> found = index.ways(text);
+        if (found != indexes[0]->ways(text)) {
+            if (failures++ < 20) std::printf("  U+%04X: the indexes differ\n", static_cast<unsigned>(c));
+        }
+        characters += !found.empty();
+        for (const TypingWay& way : found) {
+            ++ways;
+            const std::u16string result = typed(engine, definitions, way.keys);
+            if (result != text && failures++ < 20)
+                std::printf("  U+%04X: %s types %s\n", static_cast<unsigned>(c), printable(way.keys).c_str(),
+                            printable(result).c_str());
+        }
+    }
+    std::printf("%zu ways to type %zu characters looked up and checked in %.1f ms\n", ways, characters, milliseconds(start));
+
+    for (std::u16string_view text : { u"é", u"ǘ", u"æ", u"q̃", u"€", u"😀" }) {
+        std::printf("  %s:", printable(text).c_str());
+        for (const TypingWay& way : index.ways(text)) std::printf("  %s", printable(way.keys).c_str());
+        std::printf("\n");
+    }
+
+    std::vector<ReverseIndex::BlockCoverage> blocks = index.coverage();
+    std::sort(blocks.begin(), blocks.end(), [](const auto& a, const auto& b) { return a.covered > b.covered; });
+    for (size_t i = 0; i < 8 && blocks[i].covered; ++i)
+        std::printf("  %-40s %5u of %5u (explicit %u, implicit %u)\n", blocks[i].block->name, blocks[i].covered,
+                    blocks[i].block->assigned, blocks[i].explicitCount, blocks[i].implicitCount);
+
+    std::printf("%zu failures\n", failures);
+    return failures ? 1 : 0;
+
+}
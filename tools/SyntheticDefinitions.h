@@ -0,0 +1,223 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "DefaultSequences.h"
+#include "UnicodeFormatTranslation.h"
+
+// syntheticDefinitions makes a user definitions file of count sequences, for benchmarks, that looks like what a large
+// shared definitions file might: the same text for the same count and seed.
+//
+//   - Key lengths follow those of the built-in sequences, and most keys branch from a prefix of an earlier key, so many
+//     keys share prefixes; a few use bracketed key names such as [Left] or non-ASCII characters. No key repeats
+//     another, or begins with or is the beginning of another key (built-in or in the file), so none is shadowed.
+//   - Most outputs are one character; some are words, some are outside the BMP (emoji and mathematical letters),
+//     some span lines (like "wf" in userdefinitions-model.jsonc), and some are written with \u escapes.
+//   - About 1% of the sequences replace built-in sequences and 0.2% remove them (null).
+//   - There are section comments, block comments and trailing comments, and, if withCombiningRules is true,
+//     an "implicit combining rules" object with the built-in rules.
+//
+// std::string syntheticDefinitions(size_t count, unsigned seed = 1, bool withCombiningRules = true)
+
+namespace syntheticDefinitionsDetail {
+
+    inline void appendJsonString(std::string& file, const std::u32string& text, bool escape) {
+        file += '"';
+        for (const char32_t c : text) {
+            char buffer[16];
+            if (c == U'"' || c == U'\\') { file += '\\'; file += static_cast<char>(c); }
+            else if (c == U'\r') file += "\\r";
+            else if (c == U'\n') file += "\\n";
+            else if (escape && c >= 0x10000) {
+                std::snprintf(buffer, sizeof buffer, "\\u%04X\\u%04X", 0xD800 + ((c - 0x10000) >> 10), 0xDC00 + (c & 0x3FF));
+                file += buffer;
+            }
+            else if (escape && c >= 0x80) {
+                std::snprintf(buffer, sizeof buffer, "\\u%04X", static_cast<unsigned>(c));
+                file += buffer;
+            }
+            else file += utf32to8(std::u32string(1, c));
+        }
+        file += '"';
+    }
+
+    // A set of hashes, open-addressed in one array, so that millions of keys and their beginnings take little memory
+    // and time. Zero marks an empty slot, so the low bit of every hash is set.
+
+    class HashSet {
+        std::vector<uint64_t> slots = std::vector<uint64_t>(1024);
+        size_t count = 0;
+        size_t slot(uint64_t hash) const {
+            size_t i = hash & (slots.size() - 1);
+            while (slots[i] && slots[i] != hash) i = (i + 1) & (slots.size() - 1);
+            return i;
+        }
+    public:
+        bool contains(uint64_t hash) const { return slots[slot(hash | 1)]; }
+        void insert(uint64_t hash) {
+            size_t i = slot(hash |= 1);
+            if (slots[i]) return;
+            slots[i] = hash;
+            if (++count * 2 < slots.size()) return;
+            std::vector<uint64_t> old(slots.size() * 2);
+            old.swap(slots);
+            for (const uint64_t h : old) if (h) slots[slot(h)] = h;
+        }
+    };
+
+}
+
+inline std::string syntheticDefinitions(size_t count, unsigned seed = 1, bool withCombiningRules = true) {
+
+    using namespace syntheticDefinitionsDetail;
+
+    std::mt19937 random(seed);
+    auto chance  = [&](double p) { return std::uniform_real_distribution<double>(0, 1)(random) < p; };
+    auto between = [&](uint32_t low, uint32_t high) { return std::uniform_int_distribution<uint32_t>(low, high)(random); };
+
+    std::vector<std::string> builtInKeys;
+    std::vector<size_t> lengths;  // code points in each built-in key
+    static constexpr std::u32string_view keyChars =
+        U"!#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[]^_`abcdefghijklmnopqrstuvwxyz{|}~ ";
+    static constexpr std::u32string_view keyNames[] = { U"[Left]", U"[Right]", U"[Up]", U"[Down]", U"[F5]", U"[Num 5]" };
+    constexpr char32_t keyNamePlaceholder = 0xF700;  // stands for a key name while a key is made, so prefixes are whole keys
+    auto expand = [&](const std::u32string& key) {
+        std::u32string expanded;
+        for (const char32_t c : key)
+            if (c >= keyNamePlaceholder && c < keyNamePlaceholder + std::size(keyNames)) expanded += keyNames[c - keyNamePlaceholder];
+            else expanded += c;
+        return expanded;
+    };
+    static constexpr const char32_t* words[] = { U"Straße", U"naïve", U"façade", U"résumé", U"Ελλάδα", U"Москва", U"≤ ≥ ≠" };
+
+    // Keys, built-in or in the file, and their beginnings (as bytes, so that a key ending in "[Le" is known to be the
+    // beginning of one ending in "[Left]") are remembered by hash; a collision only means that a key is not used.
+    HashSet keys, prefixes;
+    const auto hash = std::hash<std::string_view>();
+    auto addKey = [&](std::string_view key) {
+        keys.insert(hash(key));
+        for (size_t n = 1; n < key.length(); ++n) prefixes.insert(hash(key.substr(0, n)));
+    };
+    defaultSequences::trie().forEach([&](std::string_view key, std::u16string_view) {
+        builtInKeys.emplace_back(key);
+        lengths.push_back(utf8to32(key).length());
+        addKey(key);
+    });
+
+    std::unordered_set<std::string> replaced;  // built-in keys in the file, none of which may appear twice
+    std::vector<std::u32string> recent;        // keys from whose prefixes later keys branch
+    std::string file = "// Synthetic user definitions (" + std::to_string(count) + " sequences, seed " + std::to_string(seed) + ")\n{\n";
+
+    for (size_t i = 0; i < count; ++i) {
+
+        if (i % 40 == 0) file += "\n// Section " + std::to_string(i / 40 + 1) + "\n\n";
+        if (i % 500 == 250) file += "/* Sequences contributed by team " + std::to_string(i / 500 + 1) + ";\n   reviewed quarterly. */\n";
+
+        // A new key takes the part of an earlier key before its last character, which is never itself a key, and
+        // grows from there until it is a new leaf; a character that would make it an existing key, or the beginning of
+        // one, is replaced by another.
+        std::u32string key;
+        bool replace = !builtInKeys.empty() && chance(0.012);
+        if (replace) {
+            key = utf8to32(builtInKeys[between(0, static_cast<uint32_t>(builtInKeys.size() - 1))]);
+            replace = replaced.insert(utf32to8(expand(key))).second;
+        }
+        if (!replace) for (;;) {
+            const size_t length = std::max<size_t>(2, lengths[between(0, static_cast<uint32_t>(lengths.size() - 1))]);
+            key.clear();
+            if (!recent.empty() && chance(0.7)) {
+                const std::u32string& prior = recent[between(0, static_cast<uint32_t>(recent.size() - 1))];
+                key = prior.substr(0, between(1, static_cast<uint32_t>(std::min(prior.length(), length))) - 1);
+            }
+            std::string expanded = utf32to8(expand(key));  // no key is the beginning of this
+            bool found = false;
+            for (int tries = 0; !found && tries < 1000; ++tries) {
+                const size_t valid = expanded.length();
+                if (chance(0.02)) key += static_cast<char32_t>(keyNamePlaceholder + between(0, std::size(keyNames) - 1));
+                else if (chance(0.02)) key += static_cast<char32_t>(between(0xC0, 0x17F));
+                else key += keyChars[between(0, static_cast<uint32_t>(keyChars.length() - 1))];
+                expanded += utf32to8(expand(key.substr(key.length() - 1)));
+                bool clash = false;
+                for (size_t n = valid + 1; n <= expanded.length() && !clash; ++n)
+                    clash = keys.contains(hash(std::string_view(expanded).substr(0, n)));
+                if (clash) {
+                    key.pop_back();
+                    expanded.resize(valid);
+                }
+                else found = key.length() >= length && !prefixes.contains(hash(expanded));
+            }
+            if (found) {
+                addKey(expanded);
+                break;
+            }
+        }
+        if (recent.size() < 4096) recent.push_back(key);
+        else recent[between(0, 4095)] = key;
+
+        std::u32string value;
+        bool remove = false;
+        const double kind = std::uniform_real_distribution<double>(0, 1)(random);
+        if (replace && kind < 0.15) remove = true;
+        else if (kind < 0.85) value = std::u32string(1, static_cast<char32_t>(between(0xA1, 0x2FFF)));
+        else if (kind < 0.92) value = words[between(0, std::size(words) - 1)];
+        else if (kind < 0.97) value = std::u32string(1, static_cast<char32_t>(chance(0.5) ? between(0x1F300, 0x1F64F) : between(0x1D400, 0x1D6A3)));
+        else if (kind < 0.98) value = U"1060 W Addison St\r\nChicago, IL " + utf8to32(std::to_string(60600 + i % 100));
+        else value = U"Signed,\r\n\r\nA. N. Other\r\nDepartment " + utf8to32(std::to_string(i % 50));
+        if (value.length() == 1 && (value[0] >= 0xD800 && value[0] <= 0xDFFF)) value[0] = U'?';
+
+        file += "    ";
+        appendJsonString(file, expand(key), false);
+        file += " : ";
+        if (remove) file += "null";
+        else appendJsonString(file, value, chance(0.1));
+        if (i + 1 < count || withCombiningRules) file += ",";
+        if (chance(0.05)) file += "  // " + std::to_string(i);
+        file += "\n";
+
+    }
+
+    if (withCombiningRules) {
+        file += "\n\"implicit combining rules\" : {\n";
+        for (const auto& rule : defaultSequences::combiningRules) {
+            file += "    ";
+            appendJsonString(file, utf8to32(rule.key), false);
+            file += " : [";
+            const char32_t accents[] = { rule.one, rule.two, rule.up, rule.down };
+            for (size_t a = 0; a < 4; ++a) {
+                if (a) file += ", ";
+                if (accents[a] == 0) file += "false";
+                else if (accents[a] == 1) file += "true";
+                else appendJsonString(file, std::u32string(1, accents[a]), true);
+            }
+            file += &rule == std::end(defaultSequences::combiningRules) - 1 ? "]\n" : "],\n";
+        }
+        file += "}\n";
+    }
+
+    return file + "}\n";
+
+}
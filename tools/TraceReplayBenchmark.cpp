@@ -0,0 +1,602 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and 
+// associated documentation files (the "Software"), to deal in the Software without restriction, 
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all copies or substantial 
+// portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT 
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// TraceReplayBenchmark replays keystroke traces (see src/KeystrokeTrace.h) through the compose engine without Windows
+// or Notepad++, checks that each sequence sends the text recorded in the trace, and reports the time taken to process
+// each key message (50th and 99th percentile and maximum) and the key messages processed per second.
+//
+// Given no trace files, it generates and replays three traces:
+//
+//     sequences: every built-in sequence (from compose-default.jsonc), one character per key; a sequence that has
+//                another as a prefix is left out, since it can't be typed
+//     numeric:   hexadecimal (#x) and &# entry of a sample of code points, including non-BMP code points
+//     combining: implicit combinations of letters with two and three stacked combining marks, typed both before
+//                and after the letter
+//
+// Numeric entries and combinations are left out when an explicit sequence would match first.
+//
+//     g++ -std=c++20 -O2 -Isrc tools/TraceReplayBenchmark.cpp src/ComposeEngine.cpp -o TraceReplayBenchmark
+//     ./TraceReplayBenchmark [-d definitions.jsonc] [-r repetitions] [-s] [-w directory] [trace ...]
+//
+//     -d  lays a user definitions file over the built-in definitions, as for traces recorded with it in use
+//     -r  replays each trace this many times (default 10) for timing; the results are checked on the first
+//     -s  collects statistics (see src/Statistics.h) while replaying, and writes them as JSON at the end
+//     -w  writes the generated traces to the directory as sequences.trace, numeric.trace and combining.trace
+//
+// The engine normalizes implicit combinations with UnicodeNormalization.h, as the plugin does, so the expected output
+// of the generated combining trace is the NFC form of the base and marks.
+//
+// Each trace is also replayed in batches of 256 key messages through ComposeEngine::process, as macro playback
+// would queue them, with a key that types x added before each sequence: the text sent must be the output in the trace
+// with the x's in place, and the key messages processed per second and the calls to send are reported.
+//
+// Each trace is also replayed once into a stand-in for a Scintilla view through EditorSink (src/EditorSink.h), as the
+// plugin inserts text when the focus is in a view: the document must end up holding all the output in the trace, and
+// each call to the engine that sends text must make exactly one undo action. Text is then inserted with
+// insertAtSelection at a single caret or selection (in either direction, or in virtual space), and with
+// insertAtSelections into a stand-in for Scintilla's multiple selections (with carets in shuffled order, selections
+// made in either direction, and carets in virtual space), which must give the same document as inserting the text
+// line by line. The exit status is nonzero if there were mismatches.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include "EditorSink.h"
+#include "KeystrokeTrace.h"
+#include "Statistics.h"
+
+namespace {
+
+    // Trace writes the lines of a generated trace.
+
+    class Trace {
+        FixedString<char, 1 << 16> line;
+    public:
+        std::string text;
+        void comment(std::string_view s) { text += "# "; text += s; text += '\n'; }
+        void key(uint16_t virtualKey, uint8_t flags, std::u16string_view keyText, uint32_t time = 120) {
+            line.clear();
+            appendTraceKey(line, time, virtualKey, 0, flags, keyText);
+            text += line.view();
+        }
+        void output(std::u16string_view s) {
+            line.clear();
+            appendTraceOutput(line, s);
+            text += line.view();
+        }
+        // Types a sequence: the compose key (Insert), then each key, with the output after the last key.
+        void sequence(const std::vector<std::u16string>& keys, std::u16string_view expected) {
+            key(0x2D, TraceEvent::ComposeKey | TraceEvent::Extended, {}, 1000);
+            key(0x2D, TraceEvent::ComposeKey | TraceEvent::Extended | TraceEvent::KeyUp, {}, 80);
+            for (const std::u16string& k : keys) {
+                const uint16_t virtualKey = k == u"\r" ? 0x0D : k.length() == 1 && k[0] >= u'a' && k[0] <= u'z' ? k[0] - 0x20
+                                          : k.length() == 1 && ((k[0] >= u'0' && k[0] <= u'9') || (k[0] >= u'A' && k[0] <= u'Z')) ? k[0] : 0;
+                key(virtualKey, 0, k);
+                if (&k == &keys.back()) output(expected);
+                key(virtualKey, TraceEvent::KeyUp, {}, 60);
+            }
+        }
+    };
+
+    std::u16string utf16(char32_t c) {
+        return c < 0x10000 ? std::u16string(1, static_cast<char16_t>(c))
+                           : std::u16string{ static_cast<char16_t>(0xD800 + ((c - 0x10000) >> 10)), static_cast<char16_t>(0xDC00 + (c & 0x3FF)) };
+    }
+
+    std::vector<std::u16string> keysOf(std::string_view s) {
+        std::vector<std::u16string> keys;
+        const std::wstring w = utf8to16(s);
+        for (size_t i = 0; i < w.length(); ++i) {
+            const size_t n = w[i] >= 0xD800 && w[i] < 0xDC00 && i + 1 < w.length() ? 2 : 1;
+            keys.emplace_back(w.begin() + i, w.begin() + i + n);
+            i += n - 1;
+        }
+        return keys;
+    }
+
+    // True if no explicit sequence matches keys or a prefix of keys, or begins with keys.
+
+    bool noExplicitMatch(const ComposeDefinitions& definitions, const std::vector<std::u16string>& keys) {
+        const SequenceTrie& trie = definitions.sequences;
+        SequenceTrie::State state = SequenceTrie::root;
+        for (const std::u16string& key : keys) {
+            FixedString<char, 128> bytes;
+            appendUtf8(bytes, key);
+            state = trie.next(state, bytes);
+            if (trie.complete(state)) return false;
+        }
+        return !trie.extendable(state);
+    }
+
+    std::string sequencesTrace(const ComposeDefinitions& definitions) {
+        Trace trace;
+        trace.comment("Every built-in sequence");
+        const SequenceTrie& trie = definitions.sequences;
+        trie.forEach([&](std::string_view key, std::u16string_view output) {
+            for (std::string_view prefix = key.substr(0, key.length() - 1); !prefix.empty(); prefix.remove_suffix(1))
+                if (trie.complete(trie.next(SequenceTrie::root, prefix))) return;
+            trace.sequence(keysOf(key), output);
+        });
+        return trace.text;
+    }
+
+    std::string numericTrace(const ComposeDefinitions& definitions) {
+        Trace trace;
+        trace.comment("Hexadecimal and &# entry");
+        for (char32_t c = 0x20; c < 0x110000; c += c < 0x3000 ? 7 : 331) {
+            if (c >= 0xD800 && c <= 0xDFFF) continue;
+            char hex[16], decimal[16];
+            std::snprintf(hex, sizeof hex, "%02x", static_cast<unsigned>(c));
+            std::snprintf(decimal, sizeof decimal, "%u", static_cast<unsigned>(c));
+            const std::u16string expected = utf16(c);
+            std::vector<std::u16string> keys = keysOf(hex);
+            if (c < 0x11000 && keys.size() < 6) keys.push_back(u"\r");
+            if (noExplicitMatch(definitions, keys)) trace.sequence(keys, expected);
+            keys = keysOf(std::string("&#") + decimal + ";");
+            if (noExplicitMatch(definitions, keys)) trace.sequence(keys, expected);
+            keys = keysOf(std::string("&#x") + hex + ";");
+            if (noExplicitMatch(definitions, keys)) trace.sequence(keys, expected);
+        }
+        return trace.text;
+    }
+
+    std::string combiningTrace(const ComposeDefinitions& definitions) {
+        Trace trace;
+        trace.comment("Implicit combinations with stacked marks");
+        std::vector<const CombiningRule*> marks;
+        for (const CombiningRule& rule : definitions.combiningRules) if (rule.one > 1) marks.push_back(&rule);
+        auto keyText = [](const CombiningRule* rule) {
+            std::u16string s(1, static_cast<char16_t>(rule->key));
+            if (rule->key >> 16) s += static_cast<char16_t>(rule->key >> 16);
+            return s;
+        };
+        size_t n = 0;
+        for (size_t i = 0; i < marks.size(); ++i) for (size_t j = 0; j < marks.size(); ++j) {
+            if (i == j) continue;
+            for (size_t k = 0; k <= marks.size(); ++k) {
+                if (k == i || k == j) continue;
+                const std::u16string base(1, static_cast<char16_t>(u"aeiouyAEIOUYcnsz"[n++ % 16]));
+                std::vector<std::u16string> stack = { keyText(marks[i]), keyText(marks[j]) };
+                std::u16string expected = base + utf16(marks[i]->one) + utf16(marks[j]->one);
+                if (k < marks.size()) {
+                    stack.push_back(keyText(marks[k]));
+                    expected += utf16(marks[k]->one);
+                }
+                expected = normalize(expected, NormalizationForm::C);
+                std::vector<std::u16string> keys = stack;
+                keys.push_back(base);
+                if (noExplicitMatch(definitions, keys)) trace.sequence(keys, expected);
+                keys = { base };
+                keys.insert(keys.end(), stack.begin(), stack.end());
+                keys.push_back(u"\r");
+                if (noExplicitMatch(definitions, keys)) trace.sequence(keys, expected);
+            }
+        }
+        return trace.text;
+    }
+
+    // Collects what the engine sends, without allocating memory.
+
+    class Collect : public ComposeEngine::OutputSink {
+    public:
+        FixedString<char16_t, 4096> text;
+        void send(std::u16string_view s) override { text.append(s); }
+    };
+
+    struct Result {
+        size_t sequences  = 0;
+        size_t mismatches = 0;
+        std::vector<uint32_t> nanoseconds;  // for each key message replayed
+    };
+
+    Result replay(const std::shared_ptr<const ComposeDefinitions>& definitions, const std::vector<TraceEvent>& events,
+                  int repetitions) {
+        Result result;
+        result.nanoseconds.reserve(events.size() * repetitions);
+        ComposeEngine engine;
+        Collect out;
+        std::u16string expected;
+        auto check = [&] {
+            if (out.text.empty() && expected.empty()) return;
+            ++result.sequences;
+            if (out.text != std::u16string_view(expected)) {
+                if (++result.mismatches <= 5) {
+                    FixedString<char, 8192> line;
+                    appendTraceOutput(line, expected);
+                    std::printf("    expected %.*s", static_cast<int>(line.length()), line.begin());
+                    line.clear();
+                    appendTraceOutput(line, out.text);
+                    std::printf("    sent     %.*s", static_cast<int>(line.length()), line.begin());
+                }
+            }
+            out.text.clear();
+            expected.clear();
+        };
+        for (int rep = 0; rep < repetitions; ++rep) {
+            for (const TraceEvent& event : events) {
+                if (event.output) {
+                    if (rep == 0) expected += event.text;
+                    continue;
+                }
+                if (rep == 0 && !engine.composing() && (event.flags & TraceEvent::ComposeKey) && !(event.flags & TraceEvent::KeyUp)) check();
+                const auto start = std::chrono::steady_clock::now();
+                replayTraceEvent(engine, definitions, event, out);
+                const auto stop = std::chrono::steady_clock::now();
+                result.nanoseconds.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()));
+            }
+            if (rep == 0) check();
+            out.text.clear();
+        }
+        return result;
+    }
+
+    // Returns the number of failures replaying events in batches.
+
+    size_t batches(const std::shared_ptr<const ComposeDefinitions>& definitions, const std::vector<TraceEvent>& events,
+                   int repetitions) {
+        static constexpr size_t batchSize = 256;
+        std::vector<KeyEvent> keys;
+        std::u16string expected;
+        {
+            ComposeEngine engine;
+            Collect ignore;
+            for (const TraceEvent& event : events) {
+                if (event.output) {
+                    expected += event.text;
+                    continue;
+                }
+                if ((event.flags & TraceEvent::ComposeKey) && !(event.flags & TraceEvent::KeyUp) && !engine.composing()) {
+                    keys.push_back({ 0, u"x" });
+                    keys.push_back({ KeyEvent::KeyUp, {} });
+                    expected += u'x';
+                }
+                keys.push_back({ static_cast<uint8_t>(event.flags & (TraceEvent::KeyUp | TraceEvent::Repeat | TraceEvent::ComposeKey)),
+                                 event.text });
+                replayTraceEvent(engine, definitions, event, ignore);
+                ignore.text.clear();
+            }
+        }
+        class Sent : public ComposeEngine::OutputSink {
+        public:
+            std::u16string* text  = 0;  // if not null, what is sent is appended
+            size_t          calls = 0;
+            void send(std::u16string_view s) override {
+                if (text) *text += s;
+                ++calls;
+            }
+        };
+        auto run = [&](Sent& out) {
+            ComposeEngine engine;
+            for (size_t i = 0; i < keys.size();) {
+                const size_t n = std::min(batchSize, keys.size() - i);
+                i += engine.process(std::span(keys).subspan(i, n), definitions, out);
+            }
+        };
+        std::u16string sent;
+        Sent check;
+        check.text = &sent;
+        run(check);
+        Sent timed;
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; ++rep) run(timed);
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::printf("%-16s %8zu events in batches of %zu %10.0f events/s %8zu sends   output %s\n", "  batch", keys.size(),
+                    batchSize, keys.size() * repetitions / elapsed, check.calls, sent == expected ? "matches" : "differs");
+        return sent != expected;
+    }
+
+    // Document stands in for a Scintilla view; it keeps the text inserted and counts undo actions, and counts as an
+    // error an insertion outside an undo action or an undo action that is not ended.
+
+    class Document : public TextEditor {
+    public:
+        std::string text;
+        size_t      undoActions = 0;
+        size_t      errors      = 0;
+        bool        open        = false;
+        void beginUndoAction() override {
+            if (open) ++errors;
+            open = true;
+            ++undoActions;
+        }
+        void endUndoAction() override {
+            if (!open) ++errors;
+            open = false;
+        }
+        void insert(std::string_view s) override {
+            if (!open) ++errors;
+            text += s;
+        }
+        void finish() override { if (!open) ++errors; }
+    };
+
+    // Notes whether an engine call sent any text, passing it on to an EditorSink.
+
+    class Sending : public ComposeEngine::OutputSink {
+    public:
+        EditorSink& sink;
+        bool        sent = false;
+        explicit Sending(EditorSink& sink) : sink(sink) {}
+        void send(std::u16string_view s) override {
+            if (!s.empty()) sent = true;
+            sink.send(s);
+        }
+    };
+
+    // Returns the number of failures replaying events into a Document.
+
+    size_t insertion(const std::shared_ptr<const ComposeDefinitions>& definitions,
+                     const std::vector<TraceEvent>& events) {
+        Document document;
+        EditorSink sink(document);
+        Sending sending(sink);
+        ComposeEngine engine;
+        std::u16string expected;
+        size_t calls = 0;
+        for (const TraceEvent& event : events) {
+            if (event.output) {
+                expected += event.text;
+                continue;
+            }
+            replayTraceEvent(engine, definitions, event, sending);
+            sink.finish();
+            if (sending.sent) ++calls;
+            sending.sent = false;
+        }
+        // A long piece of text, with a surrogate pair where EditorSink divides it
+        std::u16string text(1023, u'a');
+        text += u"\xD83D\xDE00";
+        text.append(2000, u'\xE9');
+        sink.send(text);
+        sink.send(u"\r\n");
+        sink.finish();
+        ++calls;
+        expected += text + u"\r\n";
+        const std::wstring wide(expected.begin(), expected.end());
+        const size_t failures = (document.text != utf16to8(wide)) + (document.undoActions != calls) + document.errors;
+        std::printf("%-16s %8zu undo actions for %6zu engine calls that sent text, document %s, %zu errors\n", "  insertion",
+                    document.undoActions, calls, document.text == utf16to8(wide) ? "matches" : "differs", document.errors);
+        return failures;
+    }
+
+    // FakeScintilla has the members of Scintilla::ScintillaCall that insertAtSelection and insertAtSelections use, and
+    // moves selections when text is inserted or deleted as Scintilla does (Selection::MovePositions); ReplaceSel and
+    // AddText, like Scintilla's, act on the main selection, which here is the first.
+
+    class FakeScintilla {
+        struct Position { ptrdiff_t position = 0, space = 0; };
+        struct Range    { Position caret, anchor; };
+        static void move(Position& p, bool insertion, ptrdiff_t start, ptrdiff_t length) {
+            if (insertion) {
+                if (p.position == start) {
+                    const ptrdiff_t used = std::min(length, p.space);
+                    p.space -= used;
+                    p.position += used;
+                }
+                else if (p.position > start) p.position += length;
+            }
+            else if (p.position > start) {
+                if (p.position > start + length) p.position -= length;
+                else p = { start, 0 };
+            }
+        }
+        void change(bool insertion, ptrdiff_t start, ptrdiff_t length) {
+            for (Range& r : ranges) {
+                move(r.caret , insertion, start, length);
+                move(r.anchor, insertion, start, length);
+            }
+        }
+        const Position& first(int i) const { return ranges[i].caret.position < ranges[i].anchor.position ? ranges[i].caret : ranges[i].anchor; }
+        const Position& last (int i) const { return ranges[i].caret.position < ranges[i].anchor.position ? ranges[i].anchor : ranges[i].caret; }
+    public:
+        std::string        text;
+        std::vector<Range> ranges;
+        ptrdiff_t          targetStart = 0, targetEnd = 0;
+        int       Selections() const                    { return static_cast<int>(ranges.size()); }
+        ptrdiff_t SelectionNStart(int i) const          { return first(i).position; }
+        ptrdiff_t SelectionNEnd(int i) const            { return last(i).position; }
+        ptrdiff_t SelectionNCaretVirtualSpace(int i)  const { return ranges[i].caret.space; }
+        ptrdiff_t SelectionNAnchorVirtualSpace(int i) const { return ranges[i].anchor.space; }
+        void      SetSelectionNCaret (int i, ptrdiff_t p)   { ranges[i].caret  = { p, 0 }; }
+        void      SetSelectionNAnchor(int i, ptrdiff_t p)   { ranges[i].anchor = { p, 0 }; }
+        void      SetTargetRange(ptrdiff_t start, ptrdiff_t end) { targetStart = start; targetEnd = end; }
+        ptrdiff_t TargetEnd() const                     { return targetEnd; }
+        bool      SelectionEmpty() const {
+            return std::all_of(ranges.begin(), ranges.end(), [](const Range& r) { return r.caret.position == r.anchor.position; });
+        }
+        void      AddText(ptrdiff_t length, const char* s) {
+            const ptrdiff_t caret = ranges[0].caret.position;
+            text.insert(caret, s, length);
+            change(true, caret, length);
+            ranges[0] = { { caret + length, 0 }, { caret + length, 0 } };
+        }
+        void      ReplaceSel(const char* s) {
+            const ptrdiff_t start = SelectionNStart(0);
+            const ptrdiff_t end   = SelectionNEnd(0);
+            text.erase(start, end - start);
+            change(false, start, end - start);
+            ranges[0] = { { start, 0 }, { start, 0 } };
+            AddText(static_cast<ptrdiff_t>(std::strlen(s)), s);
+        }
+        ptrdiff_t ReplaceTarget(std::string_view s) {
+            if (targetEnd > targetStart) {
+                text.erase(targetStart, targetEnd - targetStart);
+                change(false, targetStart, targetEnd - targetStart);
+            }
+            text.insert(targetStart, s);
+            change(true, targetStart, static_cast<ptrdiff_t>(s.length()));
+            targetEnd = targetStart + s.length();
+            return s.length();
+        }
+    };
+
+    // Inserts text in pieces at a single caret or selection of a FakeScintilla, placed in each way there is, and
+    // compares the result with the document expected; returns the number of failures.
+
+    size_t singleSelection() {
+        const std::string pieces[] = { "\xC3\xA9", "\xF0\x9F\x98\x80x", "" };
+        const std::string inserted = pieces[0] + pieces[1];
+        struct Case { ptrdiff_t caret, caretSpace, anchor, anchorSpace; std::string expected; };
+        const Case cases[] = {
+            { 2, 0, 2, 0, "xx" + inserted + "yyyy\n" },      // a caret
+            { 2, 0, 4, 0, "xx" + inserted + "yy\n" },        // two characters selected from right to left
+            { 4, 0, 2, 0, "xx" + inserted + "yy\n" },        // and from left to right
+            { 6, 3, 6, 3, "xxyyyy   " + inserted + "\n" },   // a caret three spaces past the end of the line
+        };
+        size_t failures = 0;
+        for (const Case& c : cases) {
+            FakeScintilla sci;
+            sci.text = "xxyyyy\n";
+            sci.ranges.push_back({ { c.caret, c.caretSpace }, { c.anchor, c.anchorSpace } });
+            for (const std::string& piece : pieces) insertAtSelection(sci, piece);
+            const ptrdiff_t caret = static_cast<ptrdiff_t>(c.expected.find(inserted) + inserted.length());
+            if (sci.text != c.expected || sci.SelectionNStart(0) != caret || sci.SelectionNEnd(0) != caret) ++failures;
+        }
+        std::printf("single selection    %zu cases, %zu failures\n", std::size(cases), failures);
+        return failures;
+    }
+
+    // Inserts text in pieces at the selections of a FakeScintilla and compares the result with the text inserted
+    // line by line; returns the number of failures.
+
+    size_t multipleSelections() {
+        const std::string pieces[] = { "\xC3\xA9", "\xF0\x9F\x98\x80x", "" };
+        const std::string inserted = pieces[0] + pieces[1];
+        FakeScintilla sci;
+        std::string expected;
+        for (int line = 0; line < 5000; ++line) {
+            const std::string prefix(line % 7, 'x');
+            const ptrdiff_t begin = static_cast<ptrdiff_t>(sci.text.length()) + static_cast<ptrdiff_t>(prefix.length());
+            sci.text += prefix + "yyyy\n";
+            switch (line % 4) {
+            case 0:  // a caret after the prefix
+                sci.ranges.push_back({ { begin, 0 }, { begin, 0 } });
+                expected += prefix + inserted + "yyyy\n";
+                break;
+            case 1:  // two characters selected from right to left
+                sci.ranges.push_back({ { begin, 0 }, { begin + 2, 0 } });
+                expected += prefix + inserted + "yy\n";
+                break;
+            case 2:  // a caret three spaces past the end of the line
+                sci.ranges.push_back({ { begin + 4, 3 }, { begin + 4, 3 } });
+                expected += prefix + "yyyy   " + inserted + "\n";
+                break;
+            default:
+                expected += prefix + "yyyy\n";
+            }
+        }
+        std::shuffle(sci.ranges.begin(), sci.ranges.end(), std::mt19937(3));
+        for (const std::string& piece : pieces) insertAtSelections(sci, piece);
+        size_t failures = sci.text != expected;
+        for (int i = 0; i < sci.Selections(); ++i) {
+            const ptrdiff_t caret = sci.SelectionNStart(i);
+            if (sci.SelectionNEnd(i) != caret || caret < static_cast<ptrdiff_t>(inserted.length())
+                || sci.text.compare(caret - inserted.length(), inserted.length(), inserted)) ++failures;
+        }
+        std::printf("multiple selections %zu carets, document %s, %zu failures\n", sci.ranges.size(),
+                    sci.text == expected ? "matches" : "differs", failures);
+        return failures;
+    }
+
+    void report(const char* name, const std::vector<TraceEvent>& events, Result& result) {
+        std::vector<uint32_t>& ns = result.nanoseconds;
+        if (ns.empty()) return;
+        double total = 0;
+        for (uint32_t t : ns) total += t;
+        std::sort(ns.begin(), ns.end());
+        std::printf("%-16s %8zu events %6zu sequences %4zu mismatches   p50 %6u ns   p99 %6u ns   max %8u ns   %10.0f events/s\n",
+                    name, events.size(), result.sequences, result.mismatches, ns[ns.size() / 2], ns[ns.size() * 99 / 100],
+                    ns.back(), ns.size() / (total / 1e9));
+    }
+
+    std::vector<TraceEvent> parse(const std::string& text) {
+        std::vector<TraceEvent> events;
+        std::istringstream lines(text);
+        std::string line;
+        TraceEvent event;
+        while (std::getline(lines, line)) if (parseTraceLine(line, event)) events.push_back(event);
+        return events;
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+
+    std::shared_ptr<ComposeDefinitions> definitions = ComposeDefinitions::builtIn();
+    int repetitions = 10;
+    std::string directory;
+    std::vector<std::pair<std::string, std::string>> traces;  // name, text
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "-s") statistics.enable(true);
+        else if ((arg == "-d" || arg == "-r" || arg == "-w") && i + 1 < argc) {
+            const char* value = argv[++i];
+            if (arg == "-r") repetitions = std::max(1, std::atoi(value));
+            else if (arg == "-w") directory = value;
+            else {
+                std::ifstream file(value, std::ios::binary);
+                std::stringstream content;
+                content << file.rdbuf();
+                if (!file || !definitions->overlay(content.str())) {
+                    std::fprintf(stderr, "%s is not a valid definitions file\n", value);
+                    return 2;
+                }
+            }
+        }
+        else {
+            std::ifstream file(argv[i], std::ios::binary);
+            if (!file) {
+                std::fprintf(stderr, "can't read %s\n", argv[i]);
+                return 2;
+            }
+            std::stringstream content;
+            content << file.rdbuf();
+            traces.emplace_back(argv[i], content.str());
+        }
+    }
+
+    if (traces.empty()) {
+        traces.emplace_back("sequences", sequencesTrace(*definitions));
+        traces.emplace_back("numeric"  , numericTrace  (*definitions));
+        traces.emplace_back("combining", combiningTrace(*definitions));
+        if (!directory.empty()) for (const auto& [name, text] : traces)
+            std::ofstream(directory + "/" + name + ".trace", std::ios::binary) << text;
+    }
+
+    size_t mismatches = 0;
+    for (const auto& [name, text] : traces) {
+        const std::vector<TraceEvent> events = parse(text);
+        Result result = replay(definitions, events, repetitions);
+        report(name.c_str(), events, result);
+        mismatches += result.mismatches + batches(definitions, events, repetitions) + insertion(definitions, events);
+    }
+    mismatches += singleSelection();
+    mismatches += multipleSelections();
+    if (statistics.on()) std::printf("%s", statistics.json().c_str());
+    return mismatches ? 1 : 0;
+
+}
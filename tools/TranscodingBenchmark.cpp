@@ -0,0 +1,365 @@
+// This file is part of Compose for Notepad++.
+// Copyright 2025 by rjf.
+
+// The source code contained in this file is independent of Notepad++ code.
+// It is released under the MIT (Expat) license:
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so,
+// subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial
+// portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+// LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// TranscodingBenchmark checks and times the translations between UTF-8, UTF-16 and UTF-32 in
+// src/UnicodeFormatTranslation.h.
+//
+// It first compares every translation, in each InvalidUnicode mode, with a simple reference written from the
+// definitions of the encodings: for every code point (and some values beyond), every UTF-8 sequence of up to three
+// bytes, every pair of UTF-16 code units from a set that covers each kind of unit, and random strings that mix
+// ASCII runs long enough for the block paths with valid and invalid sequences. For each, the string, span and
+// Length forms must agree, and a span one unit too short must be left untouched; invalid UTF-8 must round-trip
+// through UTF-16 with Preserve_8, and invalid UTF-16 through UTF-8 with Preserve_16. The first few failures are shown.
+//
+// It then reports the throughput of each translation, in MB/s of input, into a caller-provided buffer, on generated
+// documents of 1M code points: ASCII, Latin (mostly ASCII with accented letters), CJK and emoji (mixed with ASCII).
+// The length and output of every timed translation must match the reference.
+//
+//     g++ -std=c++20 -O2 -Isrc tools/TranscodingBenchmark.cpp -o TranscodingBenchmark
+//     ./TranscodingBenchmark [-r repetitions]
+//
+// The default is 20 repetitions. The exit status is nonzero if any check failed.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include "UnicodeFormatTranslation.h"
+
+namespace {
+
+    constexpr InvalidUnicode modes[]     = { InvalidUnicode::Substitute, InvalidUnicode::Preserve_8, InvalidUnicode::Preserve_16 };
+    constexpr const char*    modeNames[] = { "Substitute", "Preserve_8", "Preserve_16" };
+
+    // The reference translations, one code point at a time.
+
+    namespace reference {
+
+        std::u32string from8(std::string_view s, InvalidUnicode errs) {
+            std::u32string u;
+            auto b = [&](size_t i) { return i < s.length() ? static_cast<unsigned char>(s[i]) : 0u; };
+            auto trail = [&](size_t i) { return (b(i) & 0xC0) == 0x80; };
+            for (size_t i = 0; i < s.length();) {
+                const unsigned c = b(i);
+                if (c < 0x80) {
+                    u += c;
+                    i += 1;
+                }
+                else if (c >= 0xC2 && c <= 0xDF && trail(i + 1)) {
+                    u += (c & 0x1F) << 6 | (b(i + 1) & 0x3F);
+                    i += 2;
+                }
+                else if (c >= 0xE0 && c <= 0xEF && trail(i + 1) && trail(i + 2) && !(c == 0xE0 && b(i + 1) < 0xA0)
+                         && !(c == 0xED && b(i + 1) > 0x9F && errs != InvalidUnicode::Preserve_16)) {
+                    u += (c & 0x0F) << 12 | (b(i + 1) & 0x3F) << 6 | (b(i + 2) & 0x3F);
+                    i += 3;
+                }
+                else if (c >= 0xF0 && c <= 0xF4 && trail(i + 1) && trail(i + 2) && trail(i + 3)
+                         && !(c == 0xF0 && b(i + 1) < 0x90) && !(c == 0xF4 && b(i + 1) > 0x8F)) {
+                    u += (c & 0x07) << 18 | (b(i + 1) & 0x3F) << 12 | (b(i + 2) & 0x3F) << 6 | (b(i + 3) & 0x3F);
+                    i += 4;
+                }
+                else {
+                    u += errs == InvalidUnicode::Preserve_8 ? 0xDC00 + c : 0xFFFD;
+                    i += 1;
+                }
+            }
+            return u;
+        }
+
+        std::string to8(std::u32string_view u, InvalidUnicode errs) {
+            std::string s;
+            for (char32_t c : u) {
+                const bool surrogate = c >= 0xD800 && c <= 0xDFFF;
+                if (surrogate && errs == InvalidUnicode::Preserve_8 && c >= 0xDC80 && c <= 0xDCFF) {
+                    s += static_cast<char>(c - 0xDC00);
+                    continue;
+                }
+                if ((surrogate && errs != InvalidUnicode::Preserve_16) || c > 0x10FFFF) c = 0xFFFD;
+                if (c < 0x80) s += static_cast<char>(c);
+                else if (c < 0x800) s += { static_cast<char>(0xC0 | c >> 6), static_cast<char>(0x80 | (c & 0x3F)) };
+                else if (c < 0x10000) s += { static_cast<char>(0xE0 | c >> 12), static_cast<char>(0x80 | (c >> 6 & 0x3F)),
+                                             static_cast<char>(0x80 | (c & 0x3F)) };
+                else s += { static_cast<char>(0xF0 | c >> 18), static_cast<char>(0x80 | (c >> 12 & 0x3F)),
+                            static_cast<char>(0x80 | (c >> 6 & 0x3F)), static_cast<char>(0x80 | (c & 0x3F)) };
+            }
+            return s;
+        }
+
+        std::u32string from16(std::u16string_view w) {
+            std::u32string u;
+            for (size_t i = 0; i < w.length(); ++i) {
+                const bool high = w[i] >= 0xD800 && w[i] <= 0xDBFF;
+                if (high && i + 1 < w.length() && w[i + 1] >= 0xDC00 && w[i + 1] <= 0xDFFF) {
+                    u += 0x10000 + ((w[i] - 0xD800) << 10) + (w[i + 1] - 0xDC00);
+                    ++i;
+                }
+                else u += w[i];
+            }
+            return u;
+        }
+
+        std::u16string to16(std::u32string_view u) {
+            std::u16string w;
+            for (char32_t c : u) {
+                if (c > 0x10FFFF) w += u'\xFFFD';
+                else if (c >= 0x10000) w += { static_cast<char16_t>(0xD800 + ((c - 0x10000) >> 10)),
+                                              static_cast<char16_t>(0xDC00 + (c & 0x3FF)) };
+                else w += static_cast<char16_t>(c);
+            }
+            return w;
+        }
+
+    }
+
+    size_t failures = 0;
+
+    template<typename In> std::string hex(const In& s) {
+        std::string result;
+        for (size_t i = 0; i < s.length() && i < 12; ++i) {
+            char buffer[16];
+            std::snprintf(buffer, sizeof buffer, i ? " %X" : "%X", static_cast<unsigned>(s[i]) & (sizeof s[i] == 1 ? 0xFF : ~0u));
+            result += buffer;
+        }
+        return s.length() > 12 ? result + " ..." : result;
+    }
+
+    void fail(const char* what, const std::string& input, const char* mode) {
+        if (failures++ < 20) std::printf("  %s of %s (%s) differs from the reference\n", what, input.c_str(), mode);
+    }
+
+    // Checks that the string, span and Length forms of a translation agree with expected.
+
+    template<typename Out, typename Convert, typename Length>
+    void check(const char* what, const std::string& input, const char* mode, const Out& expected, const Out& result,
+               Convert convert, Length length) {
+        bool good = result == expected && length() == expected.length();
+        std::vector<typename Out::value_type> buffer(expected.length() + 1, 1);
+        good = good && convert(std::span(buffer.data(), expected.length())) == expected.length()
+                    && Out(buffer.data(), expected.length()) == expected && buffer.back() == 1;
+        if (good && !expected.empty()) {
+            std::fill(buffer.begin(), buffer.end(), 1);
+            good = convert(std::span(buffer.data(), expected.length() - 1)) == expected.length()
+                && std::all_of(buffer.begin(), buffer.end(), [](auto c) { return c == 1; });
+        }
+        if (!good) fail(what, input, mode);
+    }
+
+    std::u16string u16(const std::wstring& w) { return std::u16string(w.begin(), w.end()); }
+    std::wstring   wide(std::u16string_view w) { return std::wstring(w.begin(), w.end()); }
+
+    void check8(std::string_view s) {
+        const std::string input = hex(s);
+        for (int m = 0; m < 3; ++m) {
+            const InvalidUnicode errs = modes[m];
+            const std::u32string u = reference::from8(s, errs);
+            check("utf8to32", input, modeNames[m], u, utf8to32(s, errs),
+                  [&](std::span<char32_t> out) { return utf8to32(s, out, errs); }, [&] { return utf8to32Length(s, errs); });
+            const std::u16string w = reference::to16(u);
+            check("utf8to16", input, modeNames[m], w, u16(utf8to16(s, errs)),
+                  [&](std::span<char16_t> out) { return utf8to16(s, out, errs); }, [&] { return utf8to16Length(s, errs); });
+            if (errs == InvalidUnicode::Preserve_8 && utf16to8(utf8to16(s, errs), errs) != s) fail("Preserve_8 round trip", input, "");
+        }
+    }
+
+    void check16(std::u16string_view w) {
+        const std::string input = hex(w);
+        const std::u32string u = reference::from16(w);
+        check("utf16to32", input, "", u, utf16to32(wide(w)),
+              [&](std::span<char32_t> out) { return utf16to32(w, out); }, [&] { return utf16to32Length(w); });
+        for (int m = 0; m < 3; ++m) {
+            const InvalidUnicode errs = modes[m];
+            const std::string s = reference::to8(u, errs);
+            check("utf16to8", input, modeNames[m], s, utf16to8(wide(w), errs),
+                  [&](std::span<char> out) { return utf16to8(w, out, errs); }, [&] { return utf16to8Length(w, errs); });
+            if (errs == InvalidUnicode::Preserve_16 && u16(utf8to16(utf16to8(wide(w), errs), errs)) != w)
+                fail("Preserve_16 round trip", input, "");
+        }
+    }
+
+    void check32(std::u32string_view u) {
+        const std::string input = hex(u);
+        const std::u16string w = reference::to16(u);
+        check("utf32to16", input, "", w, u16(utf32to16(u)),
+              [&](std::span<char16_t> out) { return utf32to16(u, out); }, [&] { return utf32to16Length(u); });
+        for (int m = 0; m < 3; ++m) {
+            const InvalidUnicode errs = modes[m];
+            check("utf32to8", input, modeNames[m], reference::to8(u, errs), utf32to8(u, errs),
+                  [&](std::span<char> out) { return utf32to8(u, out, errs); }, [&] { return utf32to8Length(u, errs); });
+        }
+    }
+
+    void differential() {
+
+        std::u32string all;
+        for (char32_t c = 0; c < 0x110000; ++c) {
+            check32(std::u32string(1, c));
+            all += c;
+        }
+        for (char32_t c : { 0x110000u, 0x1FFFFFu, 0x7FFFFFFFu, 0xFFFFFFFFu }) check32(std::u32string(1, c)), all += c;
+        check32(all);
+        check8(utf32to8(all, InvalidUnicode::Preserve_16));
+        check16(u16(utf32to16(all)));
+
+        for (unsigned a = 0; a < 256; ++a) {
+            check8(std::string(1, static_cast<char>(a)));
+            for (unsigned b = 0; b < 256; ++b) {
+                check8(std::string{ static_cast<char>(a), static_cast<char>(b) });
+                if (a < 0xE0 || a > 0xF4) continue;
+                for (unsigned c = 0; c < 256; ++c) check8(std::string{ static_cast<char>(a), static_cast<char>(b), static_cast<char>(c) });
+            }
+        }
+
+        static constexpr char16_t units[] = { 0, 0x41, 0x7F, 0x80, 0xE9, 0x7FF, 0x800, 0x4E2D, 0xD7FF, 0xD800, 0xDB7F,
+                                              0xDBFF, 0xDC00, 0xDC80, 0xDCFF, 0xDD00, 0xDFFF, 0xE000, 0xFEFF, 0xFFFD, 0xFFFF };
+        for (char16_t a : units) for (char16_t b : units) for (char16_t c : units) check16(std::u16string{ a, b, c });
+
+        std::mt19937 random(1);
+        auto pick = [&](auto first, auto last) { return static_cast<unsigned>(first + random() % (last - first + 1)); };
+        for (int n = 0; n < 100000; ++n) {
+            std::u32string u;
+            std::string bytes;
+            std::u16string w;
+            for (int pieces = 1 + random() % 8; pieces > 0; --pieces) {
+                const unsigned kind = random() % 8;
+                const size_t run = kind == 0 ? random() % 70 : 1 + random() % 4;
+                for (size_t i = 0; i < run; ++i) {
+                    const char32_t c = kind <= 1 ? pick(0, 0x7F) : kind == 2 ? pick(0x80, 0x7FF) : kind == 3 ? pick(0x800, 0xFFFF)
+                                     : kind == 4 ? pick(0x10000, 0x10FFFF) : kind == 5 ? pick(0xD800, 0xDFFF)
+                                     : kind == 6 ? pick(0x80, 0xFF) : pick(0, 0x7FFFFFFF);
+                    u += c;
+                    if (kind == 6) bytes += static_cast<char>(c);
+                    else if (kind != 7) bytes += utf32to8(std::u32string(1, c), InvalidUnicode::Preserve_16);
+                    if (c <= 0x10FFFF) w += u16(utf32to16(std::u32string(1, c)));
+                }
+            }
+            check32(u);
+            check8(bytes);
+            check16(w);
+        }
+
+        std::printf("%zu failures\n", failures);
+    }
+
+    double seconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::vector<std::pair<const char*, std::u32string>> documents() {
+        std::vector<std::pair<const char*, std::u32string>> result;
+        std::mt19937 random(2);
+        const std::u32string_view ascii = U"the quick brown fox jumps over the lazy dog. THE QUICK BROWN FOX; 0123456789\r\n";
+        const std::u32string_view latin = U"àáâãäåçèéêëìíîïñòóôõöùúûüýÿāăąćĉċčďēĕėęěĝğġģĥĩīĭįĵķĺļľńņňōŏőŕŗřśŝşšţťũūŭůűųŵŷźżžơưǎǐǒǔ";
+        std::u32string text;
+        while (text.length() < 1000000) text += ascii;
+        result.emplace_back("ascii", text);
+        text.clear();
+        while (text.length() < 1000000) {
+            for (int n = 3 + random() % 6; n > 0; --n) text += random() % 8 ? ascii[random() % 26] : latin[random() % latin.length()];
+            text += U' ';
+        }
+        result.emplace_back("latin", text);
+        text.clear();
+        while (text.length() < 1000000) {
+            for (int n = 4 + random() % 20; n > 0; --n) text += static_cast<char32_t>(0x4E00 + random() % 20000);
+            text += U"\x3002";
+        }
+        result.emplace_back("cjk", text);
+        text.clear();
+        while (text.length() < 1000000) {
+            for (int n = 3 + random() % 6; n > 0; --n) text += ascii[random() % 26];
+            text += static_cast<char32_t>(0x1F600 + random() % 80);
+            text += U' ';
+        }
+        result.emplace_back("emoji", text);
+        return result;
+    }
+
+    // Keeps the timed translations from being optimized away: each repetition reads its input through a volatile
+    // pointer, and folds the length and the last unit of its output into a checksum, which is stored here.
+
+    volatile uint64_t sink;
+
+    void throughput(int repetitions) {
+        for (const auto& [name, u] : documents()) {
+            const std::string    s = reference::to8(u, InvalidUnicode::Substitute);
+            const std::u16string w = reference::to16(u);
+            std::vector<char>     out8(4 * u.length());
+            std::vector<char16_t> out16(2 * u.length());
+            std::vector<char32_t> out32(u.length());
+            // Times convert on input, then checks each result against expected (only its length, for output empty).
+            auto time = [&](const char* label, const auto& input, const auto& expected, const auto& output, auto convert) {
+                using Input = std::basic_string_view<typename std::remove_cvref_t<decltype(input)>::value_type>;
+                const auto* volatile data = input.data();
+                uint64_t checksum = 0;
+                bool good = true;
+                const auto start = std::chrono::steady_clock::now();
+                for (int rep = 0; rep < repetitions; ++rep) {
+                    const size_t length = convert(Input(data, input.length()));
+                    good = good && length == expected.length();
+                    checksum = checksum * 31 + length + (!output.empty() && length ? output[length - 1] : 0);
+                }
+                const double elapsed = seconds(start);
+                sink = checksum;
+                good = good && (output.empty() || std::equal(expected.begin(), expected.end(), output.begin()));
+                if (!good) fail(label, name, "document");
+                std::printf(" %s %6.0f", label, repetitions * input.length() * sizeof input[0] / elapsed / 1e6);
+            };
+            const std::vector<char> none;
+            std::printf("%-6s", name);
+            time("8>16"   , s, w, out16, [&](std::string_view    in) { return utf8to16(in, out16); });
+            time("16>8"   , w, s, out8 , [&](std::u16string_view in) { return utf16to8(in, out8); });
+            time("8>32"   , s, u, out32, [&](std::string_view    in) { return utf8to32(in, out32); });
+            time("32>8"   , u, s, out8 , [&](std::u32string_view in) { return utf32to8(in, out8); });
+            time("16>32"  , w, u, out32, [&](std::u16string_view in) { return utf16to32(in, out32); });
+            time("32>16"  , u, w, out16, [&](std::u32string_view in) { return utf32to16(in, out16); });
+            time("len8>16", s, w, none , [&](std::string_view    in) { return utf8to16Length(in); });
+            time("len16>8", w, s, none , [&](std::u16string_view in) { return utf16to8Length(in); });
+            std::printf(" MB/s\n");
+        }
+    }
+
+}
+
+int main(int argc, char* argv[]) {
+
+    int repetitions = 20;
+    for (int i = 1; i < argc; ++i) if (!std::strcmp(argv[i], "-r") && i + 1 < argc) repetitions = std::atoi(argv[++i]);
+
+#if UNICODE_FORMAT_AVX2
+    std::printf("AVX2 and SSE2 block translation\n");
+#elif UNICODE_FORMAT_SSE2
+    std::printf("SSE2 block translation\n");
+#elif UNICODE_FORMAT_NEON
+    std::printf("NEON block translation\n");
+#else
+    std::printf("No block translation\n");
+#endif
+    differential();
+    throughput(repetitions);
+
+    return failures ? 1 : 0;
+
+}